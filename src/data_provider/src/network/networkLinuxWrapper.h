@@ -16,6 +16,7 @@
 #include <net/if_arp.h>
 #include <sys/socket.h>
 #include "inetworkWrapper.h"
+#include "networkNetlinkLinux.h"
 #include "networkHelper.h"
 #include "filesystemHelper.h"
 #include "stringHelper.h"
@@ -194,6 +195,8 @@ class NetworkLinuxInterface final : public INetworkInterfaceWrapper
         ifaddrs* m_interfaceAddress;
         std::string m_gateway;
         std::string m_metrics;
+        const NetlinkLink* m_pLink;
+        std::shared_ptr<const NetlinkSnapshot> m_spSnapshot;
 
         static std::string getNameInfo(const sockaddr* inputData, const socklen_t socketLen)
         {
@@ -253,14 +256,30 @@ class NetworkLinuxInterface final : public INetworkInterfaceWrapper
         }
 
     public:
-        explicit NetworkLinuxInterface(ifaddrs* addrs)
+        /**
+         * @brief Reads the link data of the interface from the snapshot when it's given and has the interface,
+         * and from the /sys/class/net and /proc/net files otherwise.
+         */
+        explicit NetworkLinuxInterface(ifaddrs* addrs, const std::shared_ptr<const NetlinkSnapshot>& spSnapshot = nullptr)
             : m_interfaceAddress{ addrs }
             , m_gateway{UNKNOWN_VALUE}
+            , m_pLink{ nullptr }
+            , m_spSnapshot{ spSnapshot }
         {
             if (!addrs)
             {
                 throw std::runtime_error { "Nullptr instances of network interface" };
             }
+            else if (m_spSnapshot && (m_pLink = m_spSnapshot->link(this->name())))
+            {
+                const auto pRoute { m_spSnapshot->route(this->name()) };
+
+                if (pRoute)
+                {
+                    m_metrics = pRoute->metrics;
+                    m_gateway = pRoute->gateway.empty() ? UNKNOWN_VALUE : pRoute->gateway;
+                }
+            }
             else
             {
                 auto fileData { Utils::getFileContent(std::string(WM_SYS_NET_DIR) + "route") };
@@ -268,19 +287,21 @@ class NetworkLinuxInterface final : public INetworkInterfaceWrapper
 
                 if (!fileData.empty())
                 {
-                    auto lines { Utils::split(fileData, '\n') };
+                    // The line and its fields reuse their buffers, the routes are not copied one by one.
+                    std::string line;
+                    std::vector<std::string_view> fields;
 
-                    for (auto& line : lines)
+                    for (const auto rawLine : Utils::Tokenizer(fileData, '\n'))
                     {
-                        line = Utils::rightTrim(line);
+                        line.assign(Utils::rightTrimView(rawLine));
                         Utils::replaceAll(line, "\t", " ");
                         Utils::replaceAll(line, "  ", " ");
-                        const auto fields { Utils::split(line, ' ') };
+                        Utils::splitView(line, ' ', fields);
 
                         if (GatewayFileFields::Size == fields.size() &&
                                 fields.at(GatewayFileFields::Iface).compare(ifName) == 0)
                         {
-                            auto address { static_cast<uint32_t>(std::stol(fields.at(GatewayFileFields::Gateway), 0, 16)) };
+                            auto address { static_cast<uint32_t>(std::stol(std::string(fields.at(GatewayFileFields::Gateway)), 0, 16)) };
                             m_metrics = fields.at(GatewayFileFields::Metric);
 
                             if (address)
@@ -449,11 +470,19 @@ class NetworkLinuxInterface final : public INetworkInterfaceWrapper
         uint32_t mtu() const override
         {
             uint32_t retVal { 0 };
-            const auto mtuFileContent { Utils::getFileContent(std::string(WM_SYS_IFDATA_DIR) + this->name() + "/mtu") };
 
-            if (!mtuFileContent.empty())
+            if (m_pLink)
+            {
+                retVal = m_pLink->mtu;
+            }
+            else
             {
-                retVal =  std::stol(Utils::splitIndex(mtuFileContent, '\n', 0));
+                const auto mtuFileContent { Utils::getFileContent(std::string(WM_SYS_IFDATA_DIR) + this->name() + "/mtu") };
+
+                if (!mtuFileContent.empty())
+                {
+                    retVal =  std::stol(Utils::splitIndex(mtuFileContent, '\n', 0));
+                }
             }
 
             return retVal;
@@ -463,44 +492,55 @@ class NetworkLinuxInterface final : public INetworkInterfaceWrapper
         {
             LinkStats retVal {};
 
-            try
+            if (m_pLink)
             {
-                const auto devData { Utils::getFileContent(std::string(WM_SYS_NET_DIR) + "dev") };
-
-                if (!devData.empty())
+                retVal = m_pLink->stats;
+            }
+            else
+            {
+                try
                 {
-                    auto lines { Utils::split(devData, '\n') };
-                    lines.erase(lines.begin());
-                    lines.erase(lines.begin());
+                    const auto devData { Utils::getFileContent(std::string(WM_SYS_NET_DIR) + "dev") };
 
-                    for (auto& line : lines)
+                    if (!devData.empty())
                     {
-                        line = Utils::trim(line);
-                        Utils::replaceAll(line, "\t", " ");
-                        Utils::replaceAll(line, "  ", " ");
-                        Utils::replaceAll(line, ": ", " ");
-                        const auto fields { Utils::split(line, ' ') };
+                        const Utils::Tokenizer lines { devData, '\n' };
+                        auto it { lines.begin() };
+                        // Skip the two header lines.
+                        std::advance(it, 2);
+
+                        std::string line;
+                        std::vector<std::string_view> fields;
 
-                        if (NetDevFileFields::FieldsQuantity == fields.size())
+                        for (; it != lines.end(); ++it)
                         {
-                            if (fields.at(NetDevFileFields::Iface).compare(this->name()) == 0)
+                            line.assign(Utils::trimView(*it));
+                            Utils::replaceAll(line, "\t", " ");
+                            Utils::replaceAll(line, "  ", " ");
+                            Utils::replaceAll(line, ": ", " ");
+                            Utils::splitView(line, ' ', fields);
+
+                            if (NetDevFileFields::FieldsQuantity == fields.size())
                             {
-                                retVal.rxBytes = std::stoul(fields.at(NetDevFileFields::RxBytes));
-                                retVal.txBytes = std::stoul(fields.at(NetDevFileFields::TxBytes));
-                                retVal.rxPackets = std::stoul(fields.at(NetDevFileFields::RxPackets));
-                                retVal.txPackets = std::stoul(fields.at(NetDevFileFields::TxPackets));
-                                retVal.rxErrors = std::stoul(fields.at(NetDevFileFields::RxErrors));
-                                retVal.txErrors = std::stoul(fields.at(NetDevFileFields::TxErrors));
-                                retVal.rxDropped = std::stoul(fields.at(NetDevFileFields::RxDropped));
-                                retVal.txDropped = std::stoul(fields.at(NetDevFileFields::TxDropped));
-                                break;
+                                if (fields.at(NetDevFileFields::Iface).compare(this->name()) == 0)
+                                {
+                                    retVal.rxBytes = std::stoul(std::string(fields.at(NetDevFileFields::RxBytes)));
+                                    retVal.txBytes = std::stoul(std::string(fields.at(NetDevFileFields::TxBytes)));
+                                    retVal.rxPackets = std::stoul(std::string(fields.at(NetDevFileFields::RxPackets)));
+                                    retVal.txPackets = std::stoul(std::string(fields.at(NetDevFileFields::TxPackets)));
+                                    retVal.rxErrors = std::stoul(std::string(fields.at(NetDevFileFields::RxErrors)));
+                                    retVal.txErrors = std::stoul(std::string(fields.at(NetDevFileFields::TxErrors)));
+                                    retVal.rxDropped = std::stoul(std::string(fields.at(NetDevFileFields::RxDropped)));
+                                    retVal.txDropped = std::stoul(std::string(fields.at(NetDevFileFields::TxDropped)));
+                                    break;
+                                }
                             }
                         }
                     }
                 }
-            }
-            catch (...)
-            {
+                catch (...)
+                {
+                }
             }
 
             return retVal;
@@ -508,12 +548,20 @@ class NetworkLinuxInterface final : public INetworkInterfaceWrapper
 
         std::string type() const override
         {
-            const auto networkTypeCode { Utils::getFileContent(std::string(WM_SYS_IFDATA_DIR) + this->name() + "/type") };
             std::string type { UNKNOWN_VALUE };
 
-            if (!networkTypeCode.empty())
+            if (m_pLink)
+            {
+                type = Utils::NetworkHelper::getNetworkTypeStringCode(m_pLink->type, NETWORK_INTERFACE_TYPE);
+            }
+            else
             {
-                type = Utils::NetworkHelper::getNetworkTypeStringCode(std::stoi(networkTypeCode), NETWORK_INTERFACE_TYPE);
+                const auto networkTypeCode { Utils::getFileContent(std::string(WM_SYS_IFDATA_DIR) + this->name() + "/type") };
+
+                if (!networkTypeCode.empty())
+                {
+                    type = Utils::NetworkHelper::getNetworkTypeStringCode(std::stoi(networkTypeCode), NETWORK_INTERFACE_TYPE);
+                }
             }
 
             return type;
@@ -521,13 +569,20 @@ class NetworkLinuxInterface final : public INetworkInterfaceWrapper
 
         std::string state() const override
         {
-            const std::string operationalState { Utils::getFileContent(std::string(WM_SYS_IFDATA_DIR) + this->name() + "/operstate") };
-
             std::string state { UNKNOWN_VALUE };
 
-            if (!operationalState.empty())
+            if (m_pLink)
             {
-                state = Utils::splitIndex(operationalState, '\n', 0);
+                state = m_pLink->state;
+            }
+            else
+            {
+                const std::string operationalState { Utils::getFileContent(std::string(WM_SYS_IFDATA_DIR) + this->name() + "/operstate") };
+
+                if (!operationalState.empty())
+                {
+                    state = Utils::splitIndex(operationalState, '\n', 0);
+                }
             }
 
             return state;
@@ -535,13 +590,20 @@ class NetworkLinuxInterface final : public INetworkInterfaceWrapper
 
         std::string MAC() const override
         {
-            const std::string macContent { Utils::getFileContent(std::string(WM_SYS_IFDATA_DIR) + this->name() + "/address")};
-
             std::string mac { UNKNOWN_VALUE };
 
-            if (!macContent.empty())
+            if (m_pLink)
             {
-                mac = Utils::splitIndex(macContent, '\n', 0);
+                mac = m_pLink->mac;
+            }
+            else
+            {
+                const std::string macContent { Utils::getFileContent(std::string(WM_SYS_IFDATA_DIR) + this->name() + "/address")};
+
+                if (!macContent.empty())
+                {
+                    mac = Utils::splitIndex(macContent, '\n', 0);
+                }
             }
 
             return mac;
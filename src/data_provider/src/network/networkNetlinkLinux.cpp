@@ -0,0 +1,419 @@
+/*
+ * Wazuh SYSINFO
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+#include <vector>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include "networkNetlinkLinux.h"
+#include "networkHelper.h"
+#include "sharedDefs.h"
+
+// IFLA_STATS64 and the head of struct rtnl_link_stats64, not declared by the headers of the legacy systems.
+constexpr unsigned short NETLINK_IFLA_STATS64 {23};
+enum NetlinkStats64
+{
+    RxPackets,
+    TxPackets,
+    RxBytes,
+    TxBytes,
+    RxErrors,
+    TxErrors,
+    RxDropped,
+    TxDropped,
+    Multicast,
+    Collisions,
+    RxLengthErrors,
+    RxOverErrors,
+    RxCrcErrors,
+    RxFrameErrors,
+    RxFifoErrors,
+    RxMissedErrors,
+    Size
+};
+
+// Names of the IF_OPER_* states, as /sys/class/net/<iface>/operstate shows them.
+static const std::vector<std::string> OPERATIONAL_STATES
+{
+    "unknown",
+    "notpresent",
+    "down",
+    "lowerlayerdown",
+    "testing",
+    "dormant",
+    "up"
+};
+
+constexpr size_t NETLINK_BUFFER_SIZE {65536};
+
+class NetlinkSocket final
+{
+        int m_fd;
+
+    public:
+        explicit NetlinkSocket(const unsigned int groups = 0)
+            : m_fd{ socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE) }
+        {
+            if (m_fd < 0)
+            {
+                throw std::system_error{errno, std::system_category(), "socket"};
+            }
+
+            sockaddr_nl address {};
+            address.nl_family = AF_NETLINK;
+            address.nl_groups = groups;
+
+            if (bind(m_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0)
+            {
+                const auto error { errno };
+                close(m_fd);
+                throw std::system_error{error, std::system_category(), "bind"};
+            }
+        }
+
+        ~NetlinkSocket()
+        {
+            close(m_fd);
+        }
+
+        NetlinkSocket(const NetlinkSocket&) = delete;
+        NetlinkSocket& operator=(const NetlinkSocket&) = delete;
+
+        int fd() const
+        {
+            return m_fd;
+        }
+};
+
+template<typename T>
+static std::vector<char> dump(const NetlinkSocket& netlink, const uint16_t type, const T& body)
+{
+    static std::atomic<uint32_t> sequence {0};
+    struct
+    {
+        nlmsghdr header;
+        T body;
+    } request {};
+
+    request.header.nlmsg_len = NLMSG_LENGTH(sizeof(T));
+    request.header.nlmsg_type = type;
+    request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.header.nlmsg_seq = ++sequence;
+    request.body = body;
+
+    if (send(netlink.fd(), &request, request.header.nlmsg_len, 0) < 0)
+    {
+        throw std::system_error{errno, std::system_category(), "send"};
+    }
+
+    std::vector<char> messages;
+    std::vector<char> buffer(NETLINK_BUFFER_SIZE);
+    bool done { false };
+
+    while (!done)
+    {
+        const auto size { recv(netlink.fd(), buffer.data(), buffer.size(), 0) };
+
+        if (size < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            throw std::system_error{errno, std::system_category(), "recv"};
+        }
+
+        auto length { static_cast<unsigned int>(size) };
+
+        for (auto header { reinterpret_cast<const nlmsghdr*>(buffer.data()) }; NLMSG_OK(header, length); header = NLMSG_NEXT(header, length))
+        {
+            if (header->nlmsg_seq != request.header.nlmsg_seq)
+            {
+                continue;
+            }
+
+            if (NLMSG_DONE == header->nlmsg_type)
+            {
+                done = true;
+                break;
+            }
+
+            if (NLMSG_ERROR == header->nlmsg_type)
+            {
+                const auto error { reinterpret_cast<const nlmsgerr*>(NLMSG_DATA(header)) };
+                throw std::system_error{-error->error, std::system_category(), "netlink dump"};
+            }
+
+            const auto begin { reinterpret_cast<const char*>(header) };
+            messages.insert(messages.end(), begin, begin + header->nlmsg_len);
+            messages.resize(messages.size() + NLMSG_ALIGN(header->nlmsg_len) - header->nlmsg_len);
+        }
+    }
+
+    return messages;
+}
+
+// Socket subscribed to the IPv4 route changes, the routes are dumped again only after a notification.
+static std::mutex gs_routesMutex;
+static std::unique_ptr<NetlinkSocket> gs_spRoutesMonitor;
+static bool gs_routesMonitorTried {false};
+static bool gs_routesValid {false};
+static std::map<int, NetlinkRoute> gs_routes;
+
+static bool routesChanged()
+{
+    bool retVal { false };
+
+    if (!gs_routesMonitorTried)
+    {
+        gs_routesMonitorTried = true;
+
+        try
+        {
+            gs_spRoutesMonitor = std::make_unique<NetlinkSocket>(RTMGRP_IPV4_ROUTE);
+        }
+        catch (...)
+        {
+        }
+    }
+
+    if (gs_spRoutesMonitor)
+    {
+        std::vector<char> buffer(NETLINK_BUFFER_SIZE);
+
+        while (true)
+        {
+            const auto size { recv(gs_spRoutesMonitor->fd(), buffer.data(), buffer.size(), MSG_DONTWAIT) };
+
+            if (size > 0)
+            {
+                retVal = true;
+            }
+            else if (size < 0 && EINTR == errno)
+            {
+                continue;
+            }
+            else
+            {
+                // ENOBUFS means that notifications were lost, the routes are dumped again.
+                retVal |= size < 0 && ENOBUFS == errno;
+                break;
+            }
+        }
+    }
+    else
+    {
+        retVal = true;
+    }
+
+    return retVal;
+}
+
+std::shared_ptr<const NetlinkSnapshot> NetlinkSnapshot::take()
+{
+    auto spSnapshot { std::make_shared<NetlinkSnapshot>() };
+    const NetlinkSocket netlink;
+    ifinfomsg linkRequest {};
+    linkRequest.ifi_family = AF_UNSPEC;
+    const auto links { dump(netlink, RTM_GETLINK, linkRequest) };
+    spSnapshot->parseLinks(links.data(), links.size());
+
+    std::lock_guard<std::mutex> lock{gs_routesMutex};
+
+    // The monitor is drained before the dump, so a change made during the dump is seen on the next call.
+    if (routesChanged() || !gs_routesValid)
+    {
+        gs_routesValid = false;
+        rtmsg routeRequest {};
+        routeRequest.rtm_family = AF_INET;
+        const auto routes { dump(netlink, RTM_GETROUTE, routeRequest) };
+        NetlinkSnapshot routesSnapshot;
+        routesSnapshot.parseRoutes(routes.data(), routes.size());
+        gs_routes = std::move(routesSnapshot.m_routes);
+        gs_routesValid = true;
+    }
+
+    spSnapshot->m_routes = gs_routes;
+    return spSnapshot;
+}
+
+void NetlinkSnapshot::parseLinks(const void* buffer, size_t size)
+{
+    auto length { static_cast<unsigned int>(size) };
+
+    for (auto header { static_cast<const nlmsghdr*>(buffer) }; NLMSG_OK(header, length); header = NLMSG_NEXT(header, length))
+    {
+        if (RTM_NEWLINK != header->nlmsg_type)
+        {
+            continue;
+        }
+
+        const auto info { reinterpret_cast<const ifinfomsg*>(NLMSG_DATA(header)) };
+        NetlinkLink link {};
+        link.index = info->ifi_index;
+        link.type = info->ifi_type;
+        link.state = OPERATIONAL_STATES.front();
+        std::string name;
+        bool stats64 { false };
+        auto attributesLength { static_cast<unsigned int>(IFLA_PAYLOAD(header)) };
+
+        for (auto attribute { IFLA_RTA(info) }; RTA_OK(attribute, attributesLength); attribute = RTA_NEXT(attribute, attributesLength))
+        {
+            const auto data { RTA_DATA(attribute) };
+            const auto dataLength { RTA_PAYLOAD(attribute) };
+
+            if (IFLA_IFNAME == attribute->rta_type)
+            {
+                name.assign(static_cast<const char*>(data), strnlen(static_cast<const char*>(data), dataLength));
+            }
+            else if (IFLA_MTU == attribute->rta_type && dataLength >= sizeof(uint32_t))
+            {
+                std::memcpy(&link.mtu, data, sizeof(uint32_t));
+            }
+            else if (IFLA_OPERSTATE == attribute->rta_type && dataLength >= sizeof(uint8_t))
+            {
+                const auto state { *static_cast<const uint8_t*>(data) };
+                link.state = state < OPERATIONAL_STATES.size() ? OPERATIONAL_STATES.at(state) : OPERATIONAL_STATES.front();
+            }
+            else if (IFLA_ADDRESS == attribute->rta_type)
+            {
+                const auto bytes { static_cast<const unsigned char*>(data) };
+                char hex[4] {};
+                link.mac.clear();
+
+                for (size_t i = 0; i < dataLength; ++i)
+                {
+                    snprintf(hex, sizeof(hex), i ? ":%02x" : "%02x", bytes[i]);
+                    link.mac += hex;
+                }
+            }
+            else if (NETLINK_IFLA_STATS64 == attribute->rta_type && dataLength >= NetlinkStats64::Size * sizeof(uint64_t))
+            {
+                uint64_t counters[NetlinkStats64::Size];
+                std::memcpy(counters, data, sizeof(counters));
+                // Same counters as /proc/net/dev, whose drops include the missed packets.
+                link.stats.rxPackets = counters[NetlinkStats64::RxPackets];
+                link.stats.txPackets = counters[NetlinkStats64::TxPackets];
+                link.stats.rxBytes = counters[NetlinkStats64::RxBytes];
+                link.stats.txBytes = counters[NetlinkStats64::TxBytes];
+                link.stats.rxErrors = counters[NetlinkStats64::RxErrors];
+                link.stats.txErrors = counters[NetlinkStats64::TxErrors];
+                link.stats.rxDropped = counters[NetlinkStats64::RxDropped] + counters[NetlinkStats64::RxMissedErrors];
+                link.stats.txDropped = counters[NetlinkStats64::TxDropped];
+                stats64 = true;
+            }
+            else if (IFLA_STATS == attribute->rta_type && !stats64 && dataLength >= sizeof(rtnl_link_stats))
+            {
+                rtnl_link_stats counters {};
+                std::memcpy(&counters, data, sizeof(counters));
+                link.stats.rxPackets = counters.rx_packets;
+                link.stats.txPackets = counters.tx_packets;
+                link.stats.rxBytes = counters.rx_bytes;
+                link.stats.txBytes = counters.tx_bytes;
+                link.stats.rxErrors = counters.rx_errors;
+                link.stats.txErrors = counters.tx_errors;
+                link.stats.rxDropped = counters.rx_dropped + counters.rx_missed_errors;
+                link.stats.txDropped = counters.tx_dropped;
+            }
+        }
+
+        if (link.mac.empty())
+        {
+            link.mac = UNKNOWN_VALUE;
+        }
+
+        if (!name.empty())
+        {
+            m_links[name] = std::move(link);
+        }
+    }
+}
+
+void NetlinkSnapshot::parseRoutes(const void* buffer, size_t size)
+{
+    auto length { static_cast<unsigned int>(size) };
+
+    for (auto header { static_cast<const nlmsghdr*>(buffer) }; NLMSG_OK(header, length); header = NLMSG_NEXT(header, length))
+    {
+        if (RTM_NEWROUTE != header->nlmsg_type)
+        {
+            continue;
+        }
+
+        const auto route { reinterpret_cast<const rtmsg*>(NLMSG_DATA(header)) };
+
+        // /proc/net/route lists the main table without the broadcast and multicast routes.
+        if (AF_INET != route->rtm_family || RTN_BROADCAST == route->rtm_type || RTN_MULTICAST == route->rtm_type)
+        {
+            continue;
+        }
+
+        uint32_t table { route->rtm_table };
+        int index { 0 };
+        uint32_t priority { 0 };
+        uint32_t gateway { 0 };
+        auto attributesLength { static_cast<unsigned int>(RTM_PAYLOAD(header)) };
+
+        for (auto attribute { RTM_RTA(route) }; RTA_OK(attribute, attributesLength); attribute = RTA_NEXT(attribute, attributesLength))
+        {
+            const auto data { RTA_DATA(attribute) };
+
+            if (RTA_PAYLOAD(attribute) < sizeof(uint32_t))
+            {
+                continue;
+            }
+
+            if (RTA_TABLE == attribute->rta_type)
+            {
+                std::memcpy(&table, data, sizeof(uint32_t));
+            }
+            else if (RTA_OIF == attribute->rta_type)
+            {
+                std::memcpy(&index, data, sizeof(uint32_t));
+            }
+            else if (RTA_PRIORITY == attribute->rta_type)
+            {
+                std::memcpy(&priority, data, sizeof(uint32_t));
+            }
+            else if (RTA_GATEWAY == attribute->rta_type)
+            {
+                std::memcpy(&gateway, data, sizeof(uint32_t));
+            }
+        }
+
+        if (RT_TABLE_MAIN != table || !index)
+        {
+            continue;
+        }
+
+        // Like the /proc/net/route reading: the metric of the last route seen and the first gateway.
+        auto& entry { m_routes[index] };
+
+        if (entry.gateway.empty())
+        {
+            entry.metrics = std::to_string(priority);
+
+            if (gateway)
+            {
+                entry.gateway = Utils::NetworkHelper::IAddressToBinary(AF_INET, reinterpret_cast<in_addr*>(&gateway));
+            }
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * Wazuh SYSINFO
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _NETWORK_NETLINK_LINUX_H
+#define _NETWORK_NETLINK_LINUX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include "inetworkInterface.h"
+
+struct NetlinkLink
+{
+    int index;
+    int type;
+    std::string state;
+    uint32_t mtu;
+    std::string mac;
+    LinkStats stats;
+};
+
+struct NetlinkRoute
+{
+    std::string gateway;
+    std::string metrics;
+};
+
+// Links, stats and IPv4 routes of the host read with a few rtnetlink dumps, instead of reading the /sys/class/net
+// and /proc/net files once per interface.
+class NetlinkSnapshot final
+{
+        std::map<std::string, NetlinkLink> m_links;
+        std::map<int, NetlinkRoute> m_routes;
+
+    public:
+        /**
+         * @brief Dumps the links and the routes of the host.
+         *
+         * The routes are dumped again only when a route change was notified since the last call, or when the
+         * notifications are not available.
+         *
+         * @return Snapshot of the host.
+         * @throw std::system_error if the netlink socket can't be used.
+         */
+        static std::shared_ptr<const NetlinkSnapshot> take();
+
+        /**
+         * @brief Adds the RTM_NEWLINK messages of a dump.
+         *
+         * @param buffer Messages of the dump.
+         * @param size Size of the messages.
+         */
+        void parseLinks(const void* buffer, size_t size);
+
+        /**
+         * @brief Keeps the main table IPv4 routes of a dump: the metric of the interface and its first gateway.
+         *
+         * @param buffer Messages of the dump.
+         * @param size Size of the messages.
+         */
+        void parseRoutes(const void* buffer, size_t size);
+
+        const NetlinkLink* link(const std::string& name) const
+        {
+            const auto it { m_links.find(name) };
+            return m_links.end() != it ? &it->second : nullptr;
+        }
+
+        const NetlinkRoute* route(const std::string& name) const
+        {
+            const NetlinkRoute* retVal { nullptr };
+            const auto pLink { link(name) };
+
+            if (pLink)
+            {
+                const auto it { m_routes.find(pLink->index) };
+                retVal = m_routes.end() != it ? &it->second : nullptr;
+            }
+
+            return retVal;
+        }
+};
+
+#endif // _NETWORK_NETLINK_LINUX_H
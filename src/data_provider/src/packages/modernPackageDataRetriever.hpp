@@ -16,6 +16,7 @@
 #include "sharedDefs.h"
 #include <functional>
 #include <map>
+#include <mutex>
 
 #if defined(HAS_STDFILESYSTEM) && HAS_STDFILESYSTEM==true
 #include "packages/packagesNPM.hpp"
@@ -50,8 +51,13 @@ class ModernFactoryPackagesCreator<true> final
     public:
         static void getPackages(const std::map<std::string, std::set<std::string>>& paths, std::function<void(nlohmann::json&)> callback)
         {
-            PYPI().getPackages(paths.at("PYPI"), callback);
-            NPM().getPackages(paths.at("NPM"), callback);
+            // The instances keep the packages parsed in the previous scan, to skip the files that didn't change.
+            static std::mutex mutex;
+            static PYPI pypi {};
+            static NPM npm {};
+            std::lock_guard<std::mutex> lock {mutex};
+            pypi.getPackages(paths.at("PYPI"), callback);
+            npm.getPackages(paths.at("NPM"), callback);
         }
 };
 
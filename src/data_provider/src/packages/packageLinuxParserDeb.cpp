@@ -11,40 +11,154 @@
 
 #include "sharedDefs.h"
 #include "packageLinuxParserHelper.h"
-#include <fstream>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-void getDpkgInfo(const std::string& fileName, std::function<void(nlohmann::json&)> callback)
+// Fields of the status file that PackageLinuxHelper::parseDpkg uses. The others, such as Depends or Conffiles, are
+// skipped without being copied.
+static const std::vector<std::string> DPKG_FIELDS
 {
-    std::fstream file{fileName, std::ios_base::in};
+    "Package", "Status", "Priority", "Section", "Installed-Size", "Multi-Arch",
+    "Architecture", "Source", "Version", "Maintainer", "Description"
+};
 
-    if (file.is_open())
+static const std::string* dpkgField(const char* key, const size_t length)
+{
+    for (const auto& field : DPKG_FIELDS)
     {
-        while (file.good())
+        if (field.size() == length && 0 == std::memcmp(field.data(), key, length))
         {
-            std::string line;
-            std::vector<std::string> data;
+            return &field;
+        }
+    }
 
-            do
+    return nullptr;
+}
+
+static void parseDpkgRecords(const char* data,
+                             const size_t size,
+                             std::function<void(nlohmann::json&)> callback)
+{
+    std::map<std::string, std::string> info;
+    // Value of the last field read. Its trailing spaces are removed only when no continuation line follows, so the
+    // first line of a multi-line Description is kept as it always was.
+    std::string* lastValue { nullptr };
+    bool continued { false };
+    const auto endValue
+    {
+        [&lastValue, &continued]()
+        {
+            if (lastValue && !continued)
+            {
+                *lastValue = Utils::rightTrim(*lastValue);
+            }
+
+            lastValue = nullptr;
+            continued = false;
+        }
+    };
+    const auto reportPackage
+    {
+        [&info, &callback]()
+        {
+            if (info.count("Package") && info.count("Status"))
             {
-                std::getline(file, line);
+                auto packageInfo = PackageLinuxHelper::parseDpkg(info);
 
-                if (line.front() == ' ') //additional info
+                if (!packageInfo.empty())
                 {
-                    data.back() = data.back() + line + "\n";
+                    callback(packageInfo);
                 }
-                else
+            }
+
+            info.clear();
+        }
+    };
+    const char* const end { data + size };
+    const char* line { data };
+
+    while (line < end)
+    {
+        auto lineEnd { static_cast<const char*>(std::memchr(line, '\n', end - line)) };
+
+        if (!lineEnd)
+        {
+            lineEnd = end;
+        }
+
+        if (line == lineEnd)
+        {
+            // A blank line ends the package record.
+            endValue();
+            reportPackage();
+        }
+        else if (*line == ' ')
+        {
+            // Continuation line, only the first line of a value is reported.
+            continued = true;
+        }
+        else
+        {
+            endValue();
+            const auto colon { static_cast<const char*>(std::memchr(line, ':', lineEnd - line)) };
+
+            if (colon)
+            {
+                const auto field { dpkgField(line, colon - line) };
+
+                if (field)
                 {
-                    data.push_back(line + "\n");
+                    lastValue = &info[*field];
+                    *lastValue = Utils::leftTrim(std::string(colon + 1, lineEnd));
                 }
             }
-            while (!line.empty()); //end of package item info
+        }
 
-            auto packageInfo = PackageLinuxHelper::parseDpkg(data);
+        line = lineEnd + 1;
+    }
+
+    endValue();
+    reportPackage();
+}
+
+void getDpkgInfo(const std::string& fileName, std::function<void(nlohmann::json&)> callback)
+{
+    const auto fd { open(fileName.c_str(), O_RDONLY | O_CLOEXEC) };
 
-            if (!packageInfo.empty())
+    if (fd >= 0)
+    {
+        struct stat info {};
+
+        if (0 == fstat(fd, &info) && info.st_size > 0)
+        {
+            const auto size { static_cast<size_t>(info.st_size) };
+            const auto data { mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) };
+            // The mapping stays valid once the descriptor is closed.
+            close(fd);
+
+            if (MAP_FAILED != data)
             {
-                callback(packageInfo);
+                madvise(data, size, MADV_SEQUENTIAL);
+
+                try
+                {
+                    parseDpkgRecords(static_cast<const char*>(data), size, callback);
+                }
+                catch (...)
+                {
+                    munmap(data, size);
+                    throw;
+                }
+
+                munmap(data, size);
             }
         }
+        else
+        {
+            close(fd);
+        }
     }
 }
@@ -27,23 +27,10 @@
 namespace PackageLinuxHelper
 {
 
-    static nlohmann::json parseDpkg(const std::vector<std::string>& entries)
+    static nlohmann::json parseDpkg(const std::map<std::string, std::string>& info)
     {
-        std::map<std::string, std::string> info;
         nlohmann::json ret;
 
-        for (const auto& entry : entries)
-        {
-            const auto pos{entry.find(":")};
-
-            if (pos != std::string::npos)
-            {
-                const auto key{Utils::trim(entry.substr(0, pos))};
-                const auto value{Utils::trim(entry.substr(pos + 1), " \n")};
-                info[key] = value;
-            }
-        }
-
         /*
            According to dpkg documentation, the status of the package consists in three fields separated by spaces:
            'SELECTION_STATE FLAG PACKAGE_STATE'.
@@ -154,6 +141,25 @@ namespace PackageLinuxHelper
         return ret;
     }
 
+    static nlohmann::json parseDpkg(const std::vector<std::string>& entries)
+    {
+        std::map<std::string, std::string> info;
+
+        for (const auto& entry : entries)
+        {
+            const auto pos{entry.find(":")};
+
+            if (pos != std::string::npos)
+            {
+                const auto key{Utils::trim(entry.substr(0, pos))};
+                const auto value{Utils::trim(entry.substr(pos + 1), " \n")};
+                info[key] = value;
+            }
+        }
+
+        return parseDpkg(info);
+    }
+
     static nlohmann::json parseSnap(const nlohmann::json& info)
     {
         nlohmann::json ret;
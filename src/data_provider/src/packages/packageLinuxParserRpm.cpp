@@ -18,6 +18,41 @@
 #include "filesystemHelper.h"
 #include "stringHelper.h"
 #include "rpmlib.h"
+#include <mutex>
+#include <optional>
+
+// Files of the rpm databases, for the Berkeley DB, sqlite and ndb backends.
+static const std::vector<std::string> RPM_DATABASE_FILES
+{
+    RPM_DATABASE,
+    "/var/lib/rpm/rpmdb.sqlite",
+    "/var/lib/rpm/rpmdb.sqlite-wal",
+    "/var/lib/rpm/Packages.db",
+    "/usr/lib/sysimage/rpm/rpmdb.sqlite",
+    "/usr/lib/sysimage/rpm/rpmdb.sqlite-wal",
+    "/usr/lib/sysimage/rpm/Packages.db"
+};
+
+// Packages of the last scan, and the stamp of the databases they were read from.
+static std::mutex gs_rpmCacheMutex;
+static std::string gs_rpmCacheStamp;
+static std::vector<nlohmann::json> gs_rpmCachePackages;
+
+static std::string rpmDatabaseStamp()
+{
+    std::string retVal;
+    auto exists { false };
+
+    for (const auto& file : RPM_DATABASE_FILES)
+    {
+        const auto stamp { UtilsWrapperLinux::fileStamp(file) };
+        exists |= !stamp.empty();
+        retVal += stamp + ";";
+    }
+
+    // Without any database the packages can't be told unchanged.
+    return exists ? retVal : "";
+}
 
 void getRpmInfo(std::function<void(nlohmann::json&)> callback)
 {
@@ -30,11 +65,9 @@ void getRpmInfo(std::function<void(nlohmann::json&)> callback)
 
             if (!rawRpmPackagesInfo.empty())
             {
-                const auto rows { Utils::split(rawRpmPackagesInfo, '\n') };
-
-                for (const auto& row : rows)
+                for (const auto row : Utils::Tokenizer(rawRpmPackagesInfo, '\n'))
                 {
-                    auto package = PackageLinuxHelper::parseRpm(row);
+                    auto package = PackageLinuxHelper::parseRpm(std::string(row));
 
                     if (!package.empty())
                     {
@@ -45,12 +78,45 @@ void getRpmInfo(std::function<void(nlohmann::json&)> callback)
         }
     };
 
+    const auto stamp { rpmDatabaseStamp() };
+    std::optional<std::vector<nlohmann::json>> cached;
+
+    {
+        std::lock_guard<std::mutex> lock { gs_rpmCacheMutex };
+
+        if (!stamp.empty() && stamp == gs_rpmCacheStamp)
+        {
+            cached = gs_rpmCachePackages;
+        }
+    }
+
+    if (cached.has_value())
+    {
+        // The database didn't change since the last scan, its packages are returned again without reading it.
+        for (auto& package : *cached)
+        {
+            callback(package);
+        }
+
+        return;
+    }
+
+    std::vector<nlohmann::json> packages;
+    const auto collect
+    {
+        [&packages, &callback](nlohmann::json & package)
+        {
+            packages.push_back(package);
+            callback(package);
+        }
+    };
+
     if (!UtilsWrapperLinux::existsRegular(RPM_DATABASE))
     {
         // We are probably using RPM >= 4.16 – get the packages from librpm.
         try
         {
-            RpmPackageManager rpm{std::make_shared<RpmLib>()};
+            RpmPackageManager rpm{std::make_shared<RpmLib>(), RpmPackageManager::Tags::INVENTORY};
 
             for (const auto& p : rpm)
             {
@@ -58,13 +124,14 @@ void getRpmInfo(std::function<void(nlohmann::json&)> callback)
 
                 if (!packageJson.empty())
                 {
-                    callback(packageJson);
+                    collect(packageJson);
                 }
             }
         }
         catch (...)
         {
-            rpmDefaultQuery(callback);
+            packages.clear();
+            rpmDefaultQuery(collect);
         }
 
     }
@@ -82,7 +149,7 @@ void getRpmInfo(std::function<void(nlohmann::json&)> callback)
 
                 if (!package.empty())
                 {
-                    callback(package);
+                    collect(package);
                 }
 
                 row = db.getNext();
@@ -90,11 +157,13 @@ void getRpmInfo(std::function<void(nlohmann::json&)> callback)
         }
         catch (...)
         {
-            rpmDefaultQuery(callback);
+            packages.clear();
+            rpmDefaultQuery(collect);
         }
 
     }
 
-
-
+    std::lock_guard<std::mutex> lock { gs_rpmCacheMutex };
+    gs_rpmCacheStamp = stamp;
+    gs_rpmCachePackages = std::move(packages);
 }
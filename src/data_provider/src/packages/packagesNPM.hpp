@@ -20,6 +20,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <set>
 
 template<typename TFileSystem = RealFileSystem, typename TJsonReader = JsonIO<nlohmann::json>>
@@ -43,6 +44,23 @@ class NPM final
             {
                 if (TFileSystem::exists(path))
                 {
+                    const auto lastWriteTime {TFileSystem::last_write_time(path)};
+                    const auto cached {m_cache.find(path.string())};
+
+                    // The package.json didn't change since the last scan, report what it had then.
+                    if (m_cache.end() != cached && cached->second.first == lastWriteTime)
+                    {
+                        auto packageInfo = cached->second.second;
+                        m_currentCache.emplace(*cached);
+
+                        if (!packageInfo.is_null())
+                        {
+                            callback(packageInfo);
+                        }
+
+                        return;
+                    }
+
                     // Read json from filesystem path.
                     const auto packageJson = TJsonReader::readJson(path);
                     nlohmann::json packageInfo;
@@ -70,8 +88,13 @@ class NPM final
 
                     if (packageInfo.contains("name") && packageInfo.contains("version"))
                     {
+                        m_currentCache.emplace(path.string(), std::make_pair(lastWriteTime, packageInfo));
                         callback(packageInfo);
                     }
+                    else
+                    {
+                        m_currentCache.emplace(path.string(), std::make_pair(lastWriteTime, nlohmann::json {}));
+                    }
                 }
             }
             catch (const std::exception& e)
@@ -114,6 +137,7 @@ class NPM final
 
         void getPackages(const std::set<std::string>& osRootFolders, std::function<void(nlohmann::json&)> callback)
         {
+            m_currentCache.clear();
 
             // Iterate over node_modules folders
             for (const auto& osRootFolder : osRootFolders)
@@ -132,7 +156,18 @@ class NPM final
                     // Ignore exception, continue with next folder
                 }
             }
+
+            // Only the packages seen in this scan are kept.
+            m_cache.swap(m_currentCache);
+            m_currentCache.clear();
         }
+
+    private:
+        // Parsed package.json files by path, with their modification time. A null package is a file without name or
+        // version.
+        using PackagesCache = std::map<std::string, std::pair<std::filesystem::file_time_type, nlohmann::json>>;
+        PackagesCache m_cache;
+        PackagesCache m_currentCache;
 };
 
 #endif // _PACKAGES_NPM_HPP
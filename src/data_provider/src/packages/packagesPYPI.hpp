@@ -19,6 +19,7 @@
 #include "sharedDefs.h"
 #include "stringHelper.h"
 #include <iostream>
+#include <map>
 #include <set>
 
 const static std::map<std::string, std::string> FILE_MAPPING_PYPI {{"egg-info", "PKG-INFO"}, {"dist-info", "METADATA"}};
@@ -35,6 +36,38 @@ class PYPI final : public TFileSystem, public TFileIO
                 {"Home-page: ", "source"},
                 {"Author: ", "vendor"}};
 
+            std::filesystem::file_time_type lastWriteTime {};
+            auto cacheable {true};
+
+            try
+            {
+                lastWriteTime = TFileSystem::last_write_time(path);
+            }
+            catch (const std::exception&)
+            {
+                // Missing metadata file, parse it as before without caching it.
+                cacheable = false;
+            }
+
+            if (cacheable)
+            {
+                const auto cached {m_cache.find(path.string())};
+
+                // The metadata didn't change since the last scan, report what it had then.
+                if (m_cache.end() != cached && cached->second.first == lastWriteTime)
+                {
+                    auto packageInfo = cached->second.second;
+                    m_currentCache.emplace(*cached);
+
+                    if (!packageInfo.is_null())
+                    {
+                        callback(packageInfo);
+                    }
+
+                    return;
+                }
+            }
+
             // Parse the METADATA file
             nlohmann::json packageInfo;
 
@@ -76,8 +109,17 @@ class PYPI final : public TFileSystem, public TFileIO
             // Check if we have a name and version
             if (packageInfo.contains("name") && packageInfo.contains("version"))
             {
+                if (cacheable)
+                {
+                    m_currentCache.emplace(path.string(), std::make_pair(lastWriteTime, packageInfo));
+                }
+
                 callback(packageInfo);
             }
+            else if (cacheable)
+            {
+                m_currentCache.emplace(path.string(), std::make_pair(lastWriteTime, nlohmann::json {}));
+            }
         }
 
         void findCorrectPath(const std::filesystem::path& path, std::function<void(nlohmann::json&)> callback)
@@ -136,6 +178,7 @@ class PYPI final : public TFileSystem, public TFileIO
     public:
         void getPackages(const std::set<std::string>& osRootFolders, std::function<void(nlohmann::json&)> callback)
         {
+            m_currentCache.clear();
 
             for (const auto& osFolder : osRootFolders)
             {
@@ -153,7 +196,18 @@ class PYPI final : public TFileSystem, public TFileIO
                     // Do nothing, continue with the next path
                 }
             }
+
+            // Only the packages seen in this scan are kept.
+            m_cache.swap(m_currentCache);
+            m_currentCache.clear();
         }
+
+    private:
+        // Parsed metadata files by path, with their modification time. A null package is a file without name or
+        // version.
+        using PackagesCache = std::map<std::string, std::pair<std::filesystem::file_time_type, nlohmann::json>>;
+        PackagesCache m_cache;
+        PackagesCache m_currentCache;
 };
 
 #endif // _PACKAGES_PYPI_HPP
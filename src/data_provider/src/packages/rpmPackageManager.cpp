@@ -22,8 +22,9 @@
 
 bool RpmPackageManager::ms_instantiated = false;
 
-RpmPackageManager::RpmPackageManager(std::shared_ptr<IRpmLibWrapper>&& wrapper)
+RpmPackageManager::RpmPackageManager(std::shared_ptr<IRpmLibWrapper>&& wrapper, const Tags tags)
     : m_rpmlib{wrapper}
+    , m_tags{tags}
 {
     if (ms_instantiated)
     {
@@ -48,7 +49,7 @@ std::string RpmPackageManager::Iterator::getAttribute(rpmTag tag) const
 {
     std::string retval;
 
-    if (m_rpmlib->headerGet(m_header, tag, m_dataContainer, HEADERGET_DEFAULT))
+    if (m_rpmlib->headerGet(m_header, tag, m_dataContainer, getFlags()))
     {
         auto cstr {m_rpmlib->rpmtdGetString(m_dataContainer)};
 
@@ -65,7 +66,7 @@ uint64_t RpmPackageManager::Iterator::getAttributeNumber(rpmTag tag) const
 {
     uint64_t retval {};
 
-    if (m_rpmlib->headerGet(m_header, tag, m_dataContainer, HEADERGET_DEFAULT))
+    if (m_rpmlib->headerGet(m_header, tag, m_dataContainer, getFlags()))
     {
         retval = m_rpmlib->rpmtdGetNumber(m_dataContainer);
     }
@@ -73,6 +74,12 @@ uint64_t RpmPackageManager::Iterator::getAttributeNumber(rpmTag tag) const
     return retval;
 }
 
+headerGetFlags RpmPackageManager::Iterator::getFlags() const
+{
+    // The values are copied to the package right away, so they can point to the header.
+    return Tags::INVENTORY == m_tags ? HEADERGET_MINMEM : HEADERGET_DEFAULT;
+}
+
 const RpmPackageManager::Iterator RpmPackageManager::END_ITERATOR{};
 
 RpmPackageManager::Iterator::Iterator()
@@ -81,8 +88,9 @@ RpmPackageManager::Iterator::Iterator()
 
 }
 
-RpmPackageManager::Iterator::Iterator(std::shared_ptr<IRpmLibWrapper>& rpmlib)
+RpmPackageManager::Iterator::Iterator(std::shared_ptr<IRpmLibWrapper>& rpmlib, const Tags tags)
     : m_end{false},
+      m_tags{tags},
       m_rpmlib{rpmlib},
       m_transactionSet{rpmlib->rpmtsCreate()}
 {
@@ -163,12 +171,22 @@ RpmPackageManager::Package RpmPackageManager::Iterator::operator*()
     p.version = getAttribute(RPMTAG_VERSION);
     p.release = getAttribute(RPMTAG_RELEASE);
     p.epoch = getAttributeNumber(RPMTAG_EPOCH);
-    p.summary = getAttribute(RPMTAG_SUMMARY);
+
+    if (Tags::ALL == m_tags)
+    {
+        p.summary = getAttribute(RPMTAG_SUMMARY);
+    }
+
     p.installTime = std::to_string(getAttributeNumber(RPMTAG_INSTALLTIME));
     p.size = getAttributeNumber(RPMTAG_SIZE);
     p.vendor = getAttribute(RPMTAG_VENDOR);
     p.group = getAttribute(RPMTAG_GROUP);
-    p.source = getAttribute(RPMTAG_SOURCE);
+
+    if (Tags::ALL == m_tags)
+    {
+        p.source = getAttribute(RPMTAG_SOURCE);
+    }
+
     p.architecture = getAttribute(RPMTAG_ARCH);
     p.description = getAttribute(RPMTAG_DESCRIPTION);
     return p;
@@ -27,7 +27,17 @@
 class RpmPackageManager final
 {
     public:
-        explicit RpmPackageManager(std::shared_ptr<IRpmLibWrapper>&& wrapper);
+        // Tags read from the header of each package.
+        enum class Tags
+        {
+            // Every field of Package.
+            ALL,
+            // Only the fields of the packages inventory (no summary or source), pointing to the header data instead
+            // of copying it before building the strings.
+            INVENTORY
+        };
+
+        explicit RpmPackageManager(std::shared_ptr<IRpmLibWrapper>&& wrapper, const Tags tags = Tags::ALL);
         // LCOV_EXCL_START
         ~RpmPackageManager();
         // LCOV_EXCL_STOP
@@ -60,10 +70,12 @@ class RpmPackageManager final
                 // Used for end iterator
                 Iterator();
                 // Used for regular iterator
-                Iterator(std::shared_ptr<IRpmLibWrapper>& rpmlib);
+                Iterator(std::shared_ptr<IRpmLibWrapper>& rpmlib, const Tags tags);
                 std::string getAttribute(rpmTag tag) const;
                 uint64_t getAttributeNumber(rpmTag tag) const;
+                headerGetFlags getFlags() const;
                 bool m_end = false;
+                Tags m_tags = Tags::ALL;
                 std::shared_ptr<IRpmLibWrapper> m_rpmlib;
                 rpmts m_transactionSet = nullptr;
                 rpmdbMatchIterator m_matches = nullptr;
@@ -74,7 +86,7 @@ class RpmPackageManager final
         static const Iterator END_ITERATOR;
         Iterator begin()
         {
-            return Iterator{m_rpmlib};
+            return Iterator{m_rpmlib, m_tags};
         }
         const Iterator& end() const
         {
@@ -83,6 +95,7 @@ class RpmPackageManager final
     private:
         static bool ms_instantiated;
         std::shared_ptr<IRpmLibWrapper> m_rpmlib;
+        Tags m_tags;
 };
 
 #endif // _RPM_PACKAGE_MANAGER_H
@@ -10,8 +10,10 @@
  */
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <regex>
 #include <sys/utsname.h>
+#include <unordered_set>
 #include "packages/modernPackageDataRetriever.hpp"
 #include "sharedDefs.h"
 #include "stringHelper.h"
@@ -29,6 +31,7 @@
 #include "packages/berkeleyRpmDbHelper.h"
 #include "packages/packageLinuxDataRetriever.h"
 #include "linuxInfoHelper.h"
+#include "utilsWrapperLinux.hpp"
 
 using ProcessInfo = std::unordered_map<int64_t, std::pair<int32_t, std::string>>;
 
@@ -154,34 +157,15 @@ static std::string getSerialNumber()
     return serial;
 }
 
-static std::string getCpuName()
+static void getCpuInfo(std::string& name, int& cores)
 {
-    std::string retVal { UNKNOWN_VALUE };
     std::map<std::string, std::string> systemInfo;
     getSystemInfo(WM_SYS_CPU_DIR, ":", systemInfo);
-    const auto& it { systemInfo.find("model name") };
+    const auto& itName { systemInfo.find("model name") };
+    const auto& itCores { systemInfo.find("processor") };
 
-    if (it != systemInfo.end())
-    {
-        retVal = it->second;
-    }
-
-    return retVal;
-}
-
-static int getCpuCores()
-{
-    int retVal { 0 };
-    std::map<std::string, std::string> systemInfo;
-    getSystemInfo(WM_SYS_CPU_DIR, ":", systemInfo);
-    const auto& it { systemInfo.find("processor") };
-
-    if (it != systemInfo.end())
-    {
-        retVal = std::stoi(it->second) + 1;
-    }
-
-    return retVal;
+    name = itName != systemInfo.end() ? itName->second : UNKNOWN_VALUE;
+    cores = itCores != systemInfo.end() ? std::stoi(itCores->second) + 1 : 0;
 }
 
 static int getCpuMHz()
@@ -269,12 +253,56 @@ static void getMemory(nlohmann::json& info)
     info["ram_usage"] = 100 - (100 * memFree / ramTotal);
 }
 
+static std::string readFirstLine(const std::string& fileName)
+{
+    std::string line;
+    std::fstream file{fileName, std::ios_base::in};
+
+    if (file.is_open())
+    {
+        std::getline(file, line);
+    }
+
+    return line;
+}
+
+// Hardware fields that only change on a reboot or a CPU hotplug. They are read again when the boot id or the
+// online CPUs change, the frequency and the memory are read on every call.
+struct StaticHardware
+{
+    std::string stamp;
+    std::string serial;
+    std::string cpuName;
+    int cpuCores;
+};
+
+static std::mutex gs_hardwareCacheMutex;
+static std::shared_ptr<const StaticHardware> gs_hardwareCache;
+
+static std::shared_ptr<const StaticHardware> getStaticHardware()
+{
+    const auto stamp { readFirstLine(WM_SYS_BOOT_ID) + "|" + readFirstLine(WM_SYS_CPU_ONLINE) };
+    std::lock_guard<std::mutex> lock{gs_hardwareCacheMutex};
+
+    if (!gs_hardwareCache || gs_hardwareCache->stamp != stamp)
+    {
+        auto spHardware { std::make_shared<StaticHardware>() };
+        spHardware->stamp = stamp;
+        spHardware->serial = getSerialNumber();
+        getCpuInfo(spHardware->cpuName, spHardware->cpuCores);
+        gs_hardwareCache = std::move(spHardware);
+    }
+
+    return gs_hardwareCache;
+}
+
 nlohmann::json SysInfo::getHardware() const
 {
     nlohmann::json hardware;
-    hardware["board_serial"] = getSerialNumber();
-    hardware["cpu_name"] = getCpuName();
-    hardware["cpu_cores"] = getCpuCores();
+    const auto spStatic { getStaticHardware() };
+    hardware["board_serial"] = spStatic->serial;
+    hardware["cpu_name"] = spStatic->cpuName;
+    hardware["cpu_cores"] = spStatic->cpuCores;
     hardware["cpu_mhz"] = double(getCpuMHz());
     getMemory(hardware);
     return hardware;
@@ -290,24 +318,25 @@ nlohmann::json SysInfo::getPackages() const
     return packages;
 }
 
+static const std::vector<std::string> UNIX_RELEASE_FILES{"/etc/os-release", "/usr/lib/os-release"};
+constexpr auto CENTOS_RELEASE_FILE{"/etc/centos-release"};
+static const std::vector<std::pair<std::string, std::string>> PLATFORMS_RELEASE_FILES
+{
+    {"centos",      CENTOS_RELEASE_FILE     },
+    {"fedora",      "/etc/fedora-release"   },
+    {"rhel",        "/etc/redhat-release"   },
+    {"gentoo",      "/etc/gentoo-release"   },
+    {"suse",        "/etc/SuSE-release"     },
+    {"arch",        "/etc/arch-release"     },
+    {"debian",      "/etc/debian_version"   },
+    {"slackware",   "/etc/slackware-version"},
+    {"ubuntu",      "/etc/lsb-release"      },
+    {"alpine",      "/etc/alpine-release"   },
+};
+
 static bool getOsInfoFromFiles(nlohmann::json& info)
 {
     bool ret{false};
-    const std::vector<std::string> UNIX_RELEASE_FILES{"/etc/os-release", "/usr/lib/os-release"};
-    constexpr auto CENTOS_RELEASE_FILE{"/etc/centos-release"};
-    static const std::vector<std::pair<std::string, std::string>> PLATFORMS_RELEASE_FILES
-    {
-        {"centos",      CENTOS_RELEASE_FILE     },
-        {"fedora",      "/etc/fedora-release"   },
-        {"rhel",        "/etc/redhat-release"   },
-        {"gentoo",      "/etc/gentoo-release"   },
-        {"suse",        "/etc/SuSE-release"     },
-        {"arch",        "/etc/arch-release"     },
-        {"debian",      "/etc/debian_version"   },
-        {"slackware",   "/etc/slackware-version"},
-        {"ubuntu",      "/etc/lsb-release"      },
-        {"alpine",      "/etc/alpine-release"   },
-    };
     const auto parseFnc
     {
         [&info](const std::string & fileName, const std::string & platform)
@@ -348,12 +377,57 @@ static bool getOsInfoFromFiles(nlohmann::json& info)
     return ret;
 }
 
+// Release data of the OS, parsed again only when one of the release files changes (e.g. after an upgrade).
+struct OsReleaseCache
+{
+    std::string stamp;
+    bool found;
+    nlohmann::json info;
+};
+
+static std::mutex gs_osReleaseCacheMutex;
+static std::shared_ptr<const OsReleaseCache> gs_osReleaseCache;
+
+static std::string osReleaseStamp()
+{
+    std::string stamp;
+
+    for (const auto& unixReleaseFile : UNIX_RELEASE_FILES)
+    {
+        stamp += UtilsWrapperLinux::fileStamp(unixReleaseFile) + "|";
+    }
+
+    for (const auto& platform : PLATFORMS_RELEASE_FILES)
+    {
+        stamp += UtilsWrapperLinux::fileStamp(platform.second) + "|";
+    }
+
+    return stamp;
+}
+
+static bool getOsInfoFromCache(nlohmann::json& info)
+{
+    const auto stamp { osReleaseStamp() };
+    std::lock_guard<std::mutex> lock{gs_osReleaseCacheMutex};
+
+    if (!gs_osReleaseCache || gs_osReleaseCache->stamp != stamp)
+    {
+        auto spRelease { std::make_shared<OsReleaseCache>() };
+        spRelease->stamp = stamp;
+        spRelease->found = getOsInfoFromFiles(spRelease->info);
+        gs_osReleaseCache = std::move(spRelease);
+    }
+
+    info = gs_osReleaseCache->info;
+    return gs_osReleaseCache->found;
+}
+
 nlohmann::json SysInfo::getOsInfo() const
 {
     nlohmann::json ret;
     struct utsname uts {};
 
-    if (!getOsInfoFromFiles(ret))
+    if (!getOsInfoFromCache(ret))
     {
         ret["os_name"] = "Linux";
         ret["os_platform"] = "linux";
@@ -393,13 +467,25 @@ nlohmann::json SysInfo::getNetworks() const
     std::map<std::string, std::vector<ifaddrs*>> networkInterfaces;
     Utils::NetworkUnixHelper::getNetworks(interfacesAddress, networkInterfaces);
 
+    // The link data of all the interfaces is read at once, the files of each interface are read only if netlink
+    // can't be used.
+    std::shared_ptr<const NetlinkSnapshot> spSnapshot;
+
+    try
+    {
+        spSnapshot = NetlinkSnapshot::take();
+    }
+    catch (...)
+    {
+    }
+
     for (const auto& interface : networkInterfaces)
     {
         nlohmann::json ifaddr {};
 
         for (auto addr : interface.second)
         {
-            const auto networkInterfacePtr { FactoryNetworkFamilyCreator<OSPlatformType::LINUX>::create(std::make_shared<NetworkLinuxInterface>(addr)) };
+            const auto networkInterfacePtr { FactoryNetworkFamilyCreator<OSPlatformType::LINUX>::create(std::make_shared<NetworkLinuxInterface>(addr, spSnapshot)) };
 
             if (networkInterfacePtr)
             {
@@ -414,7 +500,7 @@ nlohmann::json SysInfo::getNetworks() const
 }
 
 
-ProcessInfo portProcessInfo(const std::string& procPath, const std::deque<int64_t>& inodes)
+ProcessInfo portProcessInfo(const std::string& procPath, const std::unordered_set<int64_t>& inodes)
 {
     ProcessInfo ret;
     auto getProcessName = [](const std::string & filePath) -> std::string
@@ -438,14 +524,15 @@ ProcessInfo portProcessInfo(const std::string& procPath, const std::deque<int64_
     {
         constexpr size_t MAX_LENGTH {256};
         char buffer[MAX_LENGTH];
+        const auto length {readlink(filePath.c_str(), buffer, MAX_LENGTH)};
 
-        if (-1 == readlink(filePath.c_str(), buffer, MAX_LENGTH))
+        if (-1 == length)
         {
             throw std::system_error(errno, std::system_category(), "readlink");
         }
 
         // ret format is "socket:[<num>]".
-        const std::string bufferStr {buffer};
+        const std::string bufferStr {buffer, static_cast<size_t>(length)};
         const auto openBracketPos {bufferStr.find("[")};
         const auto closeBracketPos {bufferStr.find("]")};
         const auto match {bufferStr.substr(openBracketPos + 1, closeBracketPos - openBracketPos - 1)};
@@ -471,6 +558,8 @@ ProcessInfo portProcessInfo(const std::string& procPath, const std::deque<int64_
                 if (Utils::existsDir(pidFilePath))
                 {
                     std::vector<std::string> fdFiles = Utils::enumerateDir(pidFilePath);
+                    // The process name is read once, by the first socket of the process that is a port.
+                    std::string processName;
 
                     // Iterate fd directory.
                     for (const auto& fdFile : fdFiles)
@@ -484,13 +573,13 @@ ProcessInfo portProcessInfo(const std::string& procPath, const std::deque<int64_
                             {
                                 int64_t inode {findInode(fdFilePath)};
 
-                                if (std::any_of(inodes.cbegin(), inodes.cend(), [&](const auto it)
-                            {
-                                return it == inode;
-                            }))
+                                if (inodes.count(inode))
                                 {
-                                    std::string statPath {procFilePath + "/" + "stat"};
-                                    std::string processName = getProcessName(statPath);
+                                    if (processName.empty())
+                                    {
+                                        processName = getProcessName(procFilePath + "/" + "stat");
+                                    }
+
                                     int32_t pid { std::stoi(procFile) };
 
                                     ret.emplace(std::make_pair(inode, std::make_pair(pid, processName)));
@@ -513,7 +602,7 @@ ProcessInfo portProcessInfo(const std::string& procPath, const std::deque<int64_
 nlohmann::json SysInfo::getPorts() const
 {
     nlohmann::json ports;
-    std::deque<int64_t> inodes;
+    std::unordered_set<int64_t> inodes;
 
     for (const auto& portType : PORTS_TYPE)
     {
@@ -533,7 +622,7 @@ nlohmann::json SysInfo::getPorts() const
                     Utils::replaceAll(row, "\t", " ");
                     Utils::replaceAll(row, "  ", " ");
                     std::make_unique<PortImpl>(std::make_shared<LinuxPortWrapper>(portType.first, row))->buildPortData(port);
-                    inodes.push_back(port.at("inode"));
+                    inodes.insert(port.at("inode").get<int64_t>());
                     ports.push_back(std::move(port));
                 }
 
@@ -577,9 +666,10 @@ nlohmann::json SysInfo::getPorts() const
 void SysInfo::getProcessesInfo(std::function<void(nlohmann::json&)> callback) const
 {
 
+    // The environment of the processes isn't reported, so it isn't read (PROC_FILLENV).
     const SysInfoProcessesTable spProcTable
     {
-        openproc(PROC_FILLMEM | PROC_FILLSTAT | PROC_FILLSTATUS | PROC_FILLARG | PROC_FILLGRP | PROC_FILLUSR | PROC_FILLCOM | PROC_FILLENV)
+        openproc(PROC_FILLMEM | PROC_FILLSTAT | PROC_FILLSTATUS | PROC_FILLARG | PROC_FILLGRP | PROC_FILLUSR | PROC_FILLCOM)
     };
 
     SysInfoProcess spProcInfo { readproc(spProcTable.get(), nullptr) };
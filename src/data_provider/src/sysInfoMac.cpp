@@ -20,6 +20,10 @@
 #include <sys/proc_info.h>
 #include <sys/sysctl.h>
 #include <sys/utsname.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include "ports/portBSDWrapper.h"
 #include "ports/portImpl.h"
 #include "packages/packageFamilyDataAFactory.h"
@@ -35,6 +39,10 @@ const std::string MAC_UTILITIES_PATH{"/Applications/Utilities"};
 const std::string MACPORTS_DB_NAME {"registry.db"};
 const std::string MACPORTS_QUERY {"SELECT name, version, date, location, archs FROM ports WHERE state = 'installed';"};
 constexpr auto MAC_ROSETTA_DEFAULT_ARCH {"arm64"};
+// Info.plist of a bundle, as read by PKGWrapper.
+constexpr auto MAC_APP_INFO_PATH {"Contents/Info.plist"};
+// Threads parsing the changed bundles.
+constexpr auto MAX_APP_WORKERS {8u};
 
 using ProcessTaskInfo = struct proc_taskallinfo;
 
@@ -101,6 +109,151 @@ nlohmann::json SysInfo::getHardware() const
     return hardware;
 }
 
+// Key of an Info.plist file, the bundles whose file keeps the same key are not parsed again.
+struct AppInfoKey
+{
+    int64_t mtime;
+    ino_t inode;
+    off_t size;
+
+    bool operator==(const AppInfoKey& other) const
+    {
+        return mtime == other.mtime && inode == other.inode && size == other.size;
+    }
+};
+
+struct CachedApp
+{
+    AppInfoKey key;
+    nlohmann::json package;
+};
+
+// Bundles of each applications directory as read on the last scan, by bundle name.
+using AppsCache = std::map<std::string, CachedApp>;
+static std::mutex gs_appsCacheMutex;
+static std::map<std::string, std::shared_ptr<const AppsCache>> gs_appsCache;
+
+static bool appInfoKey(const std::string& bundlePath, AppInfoKey& key)
+{
+    struct stat info {};
+    const auto ret { 0 == stat((bundlePath + "/" + MAC_APP_INFO_PATH).c_str(), &info) };
+
+    if (ret)
+    {
+        key = AppInfoKey
+        {
+            static_cast<int64_t>(info.st_mtimespec.tv_sec) * 1000000000 + info.st_mtimespec.tv_nsec,
+            info.st_ino,
+            info.st_size
+        };
+    }
+
+    return ret;
+}
+
+static void getAppPackages(const std::string& pkgDirectory, std::function<void(nlohmann::json&)> callback)
+{
+    std::vector<std::string> bundles;
+
+    for (auto& package : Utils::enumerateDir(pkgDirectory))
+    {
+        if (Utils::endsWith(package, ".app"))
+        {
+            bundles.push_back(std::move(package));
+        }
+    }
+
+    std::shared_ptr<const AppsCache> lastScan;
+    {
+        std::lock_guard<std::mutex> lock {gs_appsCacheMutex};
+        const auto it { gs_appsCache.find(pkgDirectory) };
+        lastScan = gs_appsCache.end() != it ? it->second : std::make_shared<const AppsCache>();
+    }
+
+    // Only the new bundles and the ones whose Info.plist changed since the last scan are parsed.
+    std::vector<CachedApp> apps(bundles.size());
+    std::vector<bool> keep(bundles.size());
+    std::vector<size_t> pending;
+
+    for (auto i { 0ul }; i < bundles.size(); ++i)
+    {
+        const auto hasKey { appInfoKey(pkgDirectory + "/" + bundles[i], apps[i].key) };
+        const auto it { lastScan->find(bundles[i]) };
+
+        // The bundles without an Info.plist are parsed on every scan, as there is nothing telling if they changed.
+        keep[i] = hasKey;
+
+        if (hasKey && lastScan->end() != it && it->second.key == apps[i].key)
+        {
+            apps[i].package = it->second.package;
+        }
+        else
+        {
+            pending.push_back(i);
+        }
+    }
+
+    // Each bundle is parsed by a single worker, which writes only its own entry.
+    std::atomic<size_t> next { 0 };
+    const auto worker
+    {
+        [&]()
+        {
+            for (auto i { next++ }; i < pending.size(); i = next++)
+            {
+                auto& app { apps[pending[i]] };
+
+                try
+                {
+                    FactoryPackageFamilyCreator<OSPlatformType::BSDBASED>::create(std::make_pair(PackageContext{pkgDirectory, bundles[pending[i]], ""}, PKG))->buildPackageData(app.package);
+                }
+                catch (const std::exception& e)
+                {
+                    app.package = nullptr;
+                    std::cerr << e.what() << std::endl;
+                }
+            }
+        }
+    };
+
+    const auto workers { std::min<size_t>({ std::max(std::thread::hardware_concurrency(), 1u), MAX_APP_WORKERS, pending.size() }) };
+    std::vector<std::thread> threads;
+
+    for (auto i { 1ul }; i < workers; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto scan { std::make_shared<AppsCache>() };
+
+    for (auto i { 0ul }; i < bundles.size(); ++i)
+    {
+        auto& app { apps[i] };
+
+        // Only return valid content packages
+        if (app.package.is_object() && !app.package.at("name").get_ref<const std::string&>().empty())
+        {
+            auto jsPackage { app.package };
+            callback(jsPackage);
+        }
+
+        if (keep[i])
+        {
+            scan->emplace(bundles[i], std::move(app));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock {gs_appsCacheMutex};
+    gs_appsCache[pkgDirectory] = std::move(scan);
+}
+
 static void getPackagesFromPath(const std::string& pkgDirectory, const int pkgType, std::function<void(nlohmann::json&)> callback)
 {
     if (MACPORTS == pkgType)
@@ -144,34 +297,17 @@ static void getPackagesFromPath(const std::string& pkgDirectory, const int pkgTy
             }
         }
     }
+    else if (PKG == pkgType)
+    {
+        getAppPackages(pkgDirectory, callback);
+    }
     else
     {
         const auto packages { Utils::enumerateDir(pkgDirectory) };
 
         for (const auto& package : packages)
         {
-            if (PKG == pkgType)
-            {
-                if (Utils::endsWith(package, ".app"))
-                {
-                    try
-                    {
-                        nlohmann::json jsPackage;
-                        FactoryPackageFamilyCreator<OSPlatformType::BSDBASED>::create(std::make_pair(PackageContext{pkgDirectory, package, ""}, pkgType))->buildPackageData(jsPackage);
-
-                        if (!jsPackage.at("name").get_ref<const std::string&>().empty())
-                        {
-                            // Only return valid content packages
-                            callback(jsPackage);
-                        }
-                    }
-                    catch (const std::exception& e)
-                    {
-                        std::cerr << e.what() << std::endl;
-                    }
-                }
-            }
-            else if (BREW == pkgType)
+            if (BREW == pkgType)
             {
                 if (!Utils::startsWith(package, "."))
                 {
@@ -15,9 +15,12 @@
 #include <winternl.h>
 #include <ntstatus.h>
 #include <iphlpapi.h>
+#include <atomic>
 #include <memory>
 #include <list>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <system_error>
 #include <winternl.h>
 #include <ntstatus.h>
@@ -43,6 +46,8 @@
 #include "packages/modernPackageDataRetriever.hpp"
 
 constexpr auto CENTRAL_PROCESSOR_REGISTRY {"HARDWARE\\DESCRIPTION\\System\\CentralProcessor\\0"};
+// Threads reading the Uninstall hives of the machine and the users.
+constexpr auto MAX_REGISTRY_WORKERS {8u};
 const std::string UNINSTALL_REGISTRY{"SOFTWARE\\Microsoft\\Windows\\CurrentVersion\\Uninstall"};
 constexpr auto SYSTEM_IDLE_PROCESS_NAME {"System Idle Process"};
 constexpr auto SYSTEM_PROCESS_NAME {"System"};
@@ -354,93 +359,137 @@ static nlohmann::json getProcessInfo(const PROCESSENTRY32& processEntry)
     return jsProcessInfo;
 }
 
-static void getPackagesFromReg(const HKEY key, const std::string& subKey, std::function<void(nlohmann::json&)> returnCallback, const REGSAM access = 0)
+// Package of an Uninstall subkey, as read on the last scan. The package is empty if the subkey has no name.
+struct CachedPackage
+{
+    ULONGLONG lastWriteTime;
+    nlohmann::json package;
+};
+
+// Packages of the last scan by subkey, the subkeys not written since then are not read again.
+using PackagesCache = std::map<std::string, CachedPackage>;
+static std::mutex gs_packagesCacheMutex;
+static std::shared_ptr<const PackagesCache> gs_packagesCache {std::make_shared<const PackagesCache>()};
+
+static nlohmann::json readPackageFromReg(const Utils::Registry& packageReg, const REGSAM access, std::vector<BYTE>& buffer)
+{
+    std::string value;
+    nlohmann::json packageJson;
+
+    std::string name;
+    std::string version;
+    std::string vendor;
+    std::string install_time;
+    std::string location;
+    std::string architecture;
+
+    if (packageReg.string("DisplayName", value, buffer))
+    {
+        name = value;
+    }
+
+    if (packageReg.string("DisplayVersion", value, buffer))
+    {
+        version = value;
+    }
+
+    if (packageReg.string("Publisher", value, buffer))
+    {
+        vendor = value;
+    }
+
+    if (packageReg.string("InstallDate", value, buffer))
+    {
+        try
+        {
+            install_time = Utils::normalizeTimestamp(value, packageReg.keyModificationDate());
+        }
+        catch (const std::exception& e)
+        {
+            install_time = packageReg.keyModificationDate();
+        }
+    }
+    else
+    {
+        install_time = packageReg.keyModificationDate();
+    }
+
+    if (packageReg.string("InstallLocation", value, buffer))
+    {
+        location = value;
+    }
+    else
+    {
+        location = UNKNOWN_VALUE;
+    }
+
+    if (!name.empty())
+    {
+        if (access & KEY_WOW64_32KEY)
+        {
+            architecture = "i686";
+        }
+        else if (access & KEY_WOW64_64KEY)
+        {
+            architecture = "x86_64";
+        }
+        else
+        {
+            architecture = UNKNOWN_VALUE;
+        }
+
+        packageJson["name"]         = std::move(name);
+        packageJson["description"]  = UNKNOWN_VALUE;
+        packageJson["version"]      = version.empty() ? UNKNOWN_VALUE : std::move(version);
+        packageJson["groups"]       = UNKNOWN_VALUE;
+        packageJson["priority"]       = UNKNOWN_VALUE;
+        packageJson["size"]           = 0;
+        packageJson["vendor"]       = vendor.empty() ? UNKNOWN_VALUE : std::move(vendor);
+        packageJson["source"]       = UNKNOWN_VALUE;
+        packageJson["install_time"] = install_time.empty() ? UNKNOWN_VALUE : std::move(install_time);
+        packageJson["location"]     = location.empty() ? UNKNOWN_VALUE : std::move(location);
+        packageJson["architecture"] = std::move(architecture);
+        packageJson["format"]       = "win";
+    }
+
+    return packageJson;
+}
+
+static void getPackagesFromReg(const HKEY key,
+                               const std::string& subKey,
+                               std::function<void(nlohmann::json&)> returnCallback,
+                               const REGSAM access,
+                               const PackagesCache& lastScan,
+                               PackagesCache& scan)
 {
     try
     {
+        // The values of all the packages are read in the same buffer.
+        std::vector<BYTE> buffer;
         const auto callback
         {
             [&](const std::string & package)
             {
-                std::string value;
-                nlohmann::json packageJson;
+                const auto packageKey {std::to_string(access) + "\\" + subKey + "\\" + package};
                 Utils::Registry packageReg{key, subKey + "\\" + package, access | KEY_READ};
+                ULONGLONG lastWriteTime {};
+                const auto hasLastWriteTime {packageReg.keyModificationTime(lastWriteTime)};
+                const auto it {lastScan.find(packageKey)};
 
-                std::string name;
-                std::string version;
-                std::string vendor;
-                std::string install_time;
-                std::string location;
-                std::string architecture;
-
-                if (packageReg.string("DisplayName", value))
-                {
-                    name = value;
-                }
-
-                if (packageReg.string("DisplayVersion", value))
-                {
-                    version = value;
-                }
+                auto cached {scan.end()};
 
-                if (packageReg.string("Publisher", value))
+                if (hasLastWriteTime && lastScan.end() != it && it->second.lastWriteTime == lastWriteTime)
                 {
-                    vendor = value;
-                }
-
-                if (packageReg.string("InstallDate", value))
-                {
-                    try
-                    {
-                        install_time = Utils::normalizeTimestamp(value, packageReg.keyModificationDate());
-                    }
-                    catch (const std::exception& e)
-                    {
-                        install_time = packageReg.keyModificationDate();
-                    }
-                }
-                else
-                {
-                    install_time = packageReg.keyModificationDate();
-                }
-
-                if (packageReg.string("InstallLocation", value))
-                {
-                    location = value;
+                    cached = scan.emplace(packageKey, it->second).first;
                 }
                 else
                 {
-                    location = UNKNOWN_VALUE;
+                    cached = scan.insert_or_assign(packageKey, CachedPackage {lastWriteTime, readPackageFromReg(packageReg, access, buffer)}).first;
                 }
 
-                if (!name.empty())
+                if (!cached->second.package.empty())
                 {
-                    if (access & KEY_WOW64_32KEY)
-                    {
-                        architecture = "i686";
-                    }
-                    else if (access & KEY_WOW64_64KEY)
-                    {
-                        architecture = "x86_64";
-                    }
-                    else
-                    {
-                        architecture = UNKNOWN_VALUE;
-                    }
-
-                    packageJson["name"]         = std::move(name);
-                    packageJson["description"]  = UNKNOWN_VALUE;
-                    packageJson["version"]      = version.empty() ? UNKNOWN_VALUE : std::move(version);
-                    packageJson["groups"]       = UNKNOWN_VALUE;
-                    packageJson["priority"]       = UNKNOWN_VALUE;
-                    packageJson["size"]           = 0;
-                    packageJson["vendor"]       = vendor.empty() ? UNKNOWN_VALUE : std::move(vendor);
-                    packageJson["source"]       = UNKNOWN_VALUE;
-                    packageJson["install_time"] = install_time.empty() ? UNKNOWN_VALUE : std::move(install_time);
-                    packageJson["location"]     = location.empty() ? UNKNOWN_VALUE : std::move(location);
-                    packageJson["architecture"] = std::move(architecture);
-                    packageJson["format"]       = "win";
-
+                    auto packageJson {cached->second.package};
                     returnCallback(packageJson);
                 }
             }
@@ -578,9 +627,12 @@ static void getMemory(nlohmann::json& info)
 
 nlohmann::json SysInfo::getHardware() const
 {
+    // The board and the processor don't change while the system runs, they are read once.
+    static const auto SERIAL_NUMBER { getSerialNumber() };
+    static const auto CPU_NAME { getCpuName() };
     nlohmann::json hardware;
-    hardware["board_serial"] = getSerialNumber();
-    hardware["cpu_name"] = getCpuName();
+    hardware["board_serial"] = SERIAL_NUMBER;
+    hardware["cpu_name"] = CPU_NAME;
     hardware["cpu_cores"] = getCpuCores();
     hardware["cpu_mhz"] = double(getCpuMHz());
     getMemory(hardware);
@@ -913,13 +965,91 @@ void SysInfo::getPackages(std::function<void(nlohmann::json&)> callback) const
         }
     }};
 
-    getPackagesFromReg(HKEY_LOCAL_MACHINE, UNINSTALL_REGISTRY, fillList, KEY_WOW64_64KEY);
-    getPackagesFromReg(HKEY_LOCAL_MACHINE, UNINSTALL_REGISTRY, fillList, KEY_WOW64_32KEY);
+    struct Hive
+    {
+        HKEY key;
+        std::string subKey;
+        REGSAM access;
+    };
+
+    std::vector<Hive> hives
+    {
+        {HKEY_LOCAL_MACHINE, UNINSTALL_REGISTRY, KEY_WOW64_64KEY},
+        {HKEY_LOCAL_MACHINE, UNINSTALL_REGISTRY, KEY_WOW64_32KEY}
+    };
+    const auto machineHives {hives.size()};
+    const auto users {Utils::Registry {HKEY_USERS, "", KEY_READ | KEY_ENUMERATE_SUB_KEYS}.enumerate()};
+
+    for (const auto& user : users)
+    {
+        hives.push_back({HKEY_USERS, user + "\\" + UNINSTALL_REGISTRY, 0});
+    }
+
+    std::shared_ptr<const PackagesCache> lastScan;
+    {
+        std::lock_guard<std::mutex> lock {gs_packagesCacheMutex};
+        lastScan = gs_packagesCache;
+    }
+
+    // The hives are read in parallel, as there may be hundreds of users. Their packages are reported afterwards in
+    // the same order as if they were read one after another, so the duplicated ones are discarded the same way.
+    std::vector<std::vector<nlohmann::json>> packages(hives.size());
+    std::vector<PackagesCache> scans(hives.size());
+    std::atomic<size_t> nextHive {0};
+    const auto worker
+    {
+        [&]()
+        {
+            for (auto i {nextHive++}; i < hives.size(); i = nextHive++)
+            {
+                getPackagesFromReg(hives[i].key,
+                                   hives[i].subKey,
+                                   [&packages, i](nlohmann::json & data)
+                {
+                    packages[i].push_back(std::move(data));
+                },
+                hives[i].access,
+                *lastScan,
+                scans[i]);
+            }
+        }
+    };
+
+    const auto workers {std::min<size_t>({std::max(std::thread::hardware_concurrency(), 1u), MAX_REGISTRY_WORKERS, hives.size()})};
+    std::vector<std::thread> threads;
+
+    for (auto i {1ull}; i < workers; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto scan {std::make_shared<PackagesCache>()};
+
+    for (auto i {0ull}; i < hives.size(); ++i)
+    {
+        for (auto& package : packages[i])
+        {
+            fillList(package);
+        }
+
+        if (i >= machineHives)
+        {
+            getStorePackages(HKEY_USERS, users[i - machineHives], fillList);
+        }
+
+        scan->merge(scans[i]);
+    }
 
-    for (const auto& user : Utils::Registry {HKEY_USERS, "", KEY_READ | KEY_ENUMERATE_SUB_KEYS}.enumerate())
     {
-        getPackagesFromReg(HKEY_USERS, user + "\\" + UNINSTALL_REGISTRY, fillList);
-        getStorePackages(HKEY_USERS, user, fillList);
+        std::lock_guard<std::mutex> lock {gs_packagesCacheMutex};
+        gs_packagesCache = std::move(scan);
     }
 
     const std::map<std::string, std::set<std::string>> searchPaths =
@@ -12,6 +12,7 @@
 #include "utilsWrapperLinux.hpp"
 #include "cmdHelper.h"
 #include "filesystemHelper.h"
+#include <sys/stat.h>
 
 std::string UtilsWrapperLinux::exec(const std::string& cmd, const size_t bufferSize)
 {
@@ -22,3 +23,17 @@ bool UtilsWrapperLinux::existsRegular(const std::string& path)
 {
     return Utils::existsRegular(path);
 }
+
+std::string UtilsWrapperLinux::fileStamp(const std::string& path)
+{
+    std::string retVal;
+    struct stat info {};
+
+    if (0 == stat(path.c_str(), &info))
+    {
+        retVal = std::to_string(info.st_mtim.tv_sec) + "." + std::to_string(info.st_mtim.tv_nsec) + ":" +
+                 std::to_string(info.st_size) + ":" + std::to_string(info.st_ino);
+    }
+
+    return retVal;
+}
@@ -20,6 +20,8 @@ class UtilsWrapperLinux final
     public:
         static std::string exec(const std::string& cmd, const size_t bufferSize = 128);
         static bool existsRegular(const std::string& path);
+        // Modification time, size and inode of a file, empty if it doesn't exist.
+        static std::string fileStamp(const std::string& path);
 };
 
 #endif // _UTILS_WRAPPER_LINUX_H
@@ -12,6 +12,10 @@
 #include "sysInfoNetworkLinux_test.h"
 #include "network/networkInterfaceLinux.h"
 #include "network/networkFamilyDataAFactory.h"
+#include "network/networkNetlinkLinux.h"
+#include <cstring>
+#include <net/if_arp.h>
+#include <linux/rtnetlink.h>
 
 void SysInfoNetworkLinuxTest::SetUp() {};
 
@@ -184,3 +188,103 @@ TEST_F(SysInfoNetworkLinuxTest, Test_Gateway_7546)
     EXPECT_EQ(1500, ifaddr.at("mtu").get<int32_t>());
     EXPECT_EQ("A12BA8C0", ifaddr.at("gateway").get_ref<const std::string&>());
 }
+
+// Appends a netlink message with its header and attributes to a dump.
+template<typename T>
+static void appendMessage(std::vector<char>& dump, uint16_t type, const T& body, const std::vector<std::pair<uint16_t, std::string>>& attributes)
+{
+    std::vector<char> message(NLMSG_SPACE(sizeof(T)));
+    std::memcpy(NLMSG_DATA(reinterpret_cast<nlmsghdr*>(message.data())), &body, sizeof(T));
+
+    for (const auto& attribute : attributes)
+    {
+        const auto offset { message.size() };
+        message.resize(offset + RTA_SPACE(attribute.second.size()));
+        const auto rta { reinterpret_cast<rtattr*>(message.data() + offset) };
+        rta->rta_type = attribute.first;
+        rta->rta_len = RTA_LENGTH(attribute.second.size());
+        std::memcpy(RTA_DATA(rta), attribute.second.data(), attribute.second.size());
+    }
+
+    const auto header { reinterpret_cast<nlmsghdr*>(message.data()) };
+    header->nlmsg_type = type;
+    header->nlmsg_len = message.size();
+    dump.insert(dump.end(), message.begin(), message.end());
+}
+
+template<typename T>
+static std::string rawValue(const T& value)
+{
+    return std::string(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+TEST_F(SysInfoNetworkLinuxTest, Test_Netlink_Links_And_Routes)
+{
+    std::vector<char> links;
+    ifinfomsg link {};
+    link.ifi_index = 2;
+    link.ifi_type = ARPHRD_ETHER;
+    uint64_t stats[16] {};
+
+    for (auto i = 0; i < 16; ++i)
+    {
+        stats[i] = i + 1;
+    }
+
+    appendMessage(links, RTM_NEWLINK, link,
+    {
+        {IFLA_IFNAME, std::string("eth0", 5)},
+        {IFLA_MTU, rawValue(uint32_t{1500})},
+        {IFLA_OPERSTATE, rawValue(uint8_t{6})},
+        {IFLA_ADDRESS, std::string("\x00\xa0\xc9\x14\xc8\x29", 6)},
+        {23, std::string(reinterpret_cast<const char*>(stats), sizeof(stats))}
+    });
+    link.ifi_index = 3;
+    appendMessage(links, RTM_NEWLINK, link, {{IFLA_IFNAME, std::string("veth1", 6)}});
+
+    std::vector<char> routes;
+    rtmsg route {};
+    route.rtm_family = AF_INET;
+    route.rtm_table = RT_TABLE_MAIN;
+    route.rtm_type = RTN_UNICAST;
+    appendMessage(routes, RTM_NEWROUTE, route, {{RTA_OIF, rawValue(int32_t{2})}, {RTA_PRIORITY, rawValue(uint32_t{100})}});
+    appendMessage(routes, RTM_NEWROUTE, route,
+    {
+        {RTA_OIF, rawValue(int32_t{2})},
+        {RTA_PRIORITY, rawValue(uint32_t{200})},
+        {RTA_GATEWAY, std::string("\xc0\xa8\x00\x01", 4)}
+    });
+    // Routes of the other tables are not listed by /proc/net/route.
+    route.rtm_table = RT_TABLE_LOCAL;
+    appendMessage(routes, RTM_NEWROUTE, route, {{RTA_OIF, rawValue(int32_t{3})}});
+
+    NetlinkSnapshot snapshot;
+    snapshot.parseLinks(links.data(), links.size());
+    snapshot.parseRoutes(routes.data(), routes.size());
+
+    const auto eth0 { snapshot.link("eth0") };
+    ASSERT_NE(nullptr, eth0);
+    EXPECT_EQ(1500u, eth0->mtu);
+    EXPECT_EQ("up", eth0->state);
+    EXPECT_EQ("00:a0:c9:14:c8:29", eth0->mac);
+    EXPECT_EQ(1u, eth0->stats.rxPackets);
+    EXPECT_EQ(2u, eth0->stats.txPackets);
+    EXPECT_EQ(3, eth0->stats.rxBytes);
+    EXPECT_EQ(4, eth0->stats.txBytes);
+    EXPECT_EQ(5u, eth0->stats.rxErrors);
+    EXPECT_EQ(6u, eth0->stats.txErrors);
+    EXPECT_EQ(7u + 16u, eth0->stats.rxDropped);
+    EXPECT_EQ(8u, eth0->stats.txDropped);
+
+    const auto veth1 { snapshot.link("veth1") };
+    ASSERT_NE(nullptr, veth1);
+    EXPECT_EQ("unknown", veth1->state);
+    EXPECT_EQ(" ", veth1->mac);
+
+    const auto eth0Route { snapshot.route("eth0") };
+    ASSERT_NE(nullptr, eth0Route);
+    EXPECT_EQ("192.168.0.1", eth0Route->gateway);
+    EXPECT_EQ("200", eth0Route->metrics);
+    EXPECT_EQ(nullptr, snapshot.route("veth1"));
+    EXPECT_EQ(nullptr, snapshot.link("eth1"));
+}
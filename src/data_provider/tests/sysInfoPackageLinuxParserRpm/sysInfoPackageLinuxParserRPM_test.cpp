@@ -30,6 +30,7 @@ class UtilsMock
     public:
         MOCK_METHOD(std::string, exec, (const std::string&, const size_t));
         MOCK_METHOD(bool, existsRegular, (const std::string& path));
+        MOCK_METHOD(std::string, fileStamp, (const std::string& path));
 };
 
 static UtilsMock* gs_utils_mock = NULL;
@@ -42,6 +43,10 @@ bool UtilsWrapperLinux::existsRegular(const std::string& path)
 {
     return gs_utils_mock->existsRegular(path);
 }
+std::string UtilsWrapperLinux::fileStamp(const std::string& path)
+{
+    return gs_utils_mock->fileStamp(path);
+}
 
 class RpmLibMock
 {
@@ -373,16 +378,15 @@ TEST(SysInfoPackageLinuxParserRPM_test, rpmFromLibRPM)
     EXPECT_CALL(*rpm_mock, rpmdbFreeIterator(_)).Times(1).WillOnce(Return(nullptr));
     EXPECT_CALL(*rpm_mock, rpmFreeRpmrc());
 
-    EXPECT_CALL(*rpm_mock, headerGet(_, _, _, _)).Times(AnyNumber()).WillRepeatedly(Return(1));
+    EXPECT_CALL(*rpm_mock, headerGet(_, _, _, HEADERGET_MINMEM)).Times(AnyNumber()).WillRepeatedly(Return(1));
 
+    // Only the tags of the inventory are read, without the summary and the source.
     EXPECT_CALL(*rpm_mock, rpmtdGetString(_)) \
     .WillOnce(Return("1")) \
     .WillOnce(Return("7")) \
     .WillOnce(Return("6")) \
-    .WillOnce(Return("summary")) \
     .WillOnce(Return("8")) \
     .WillOnce(Return("10")) \
-    .WillOnce(Return("source")) \
     .WillOnce(Return("2")) \
     .WillOnce(Return("3"));
     EXPECT_CALL(*rpm_mock, rpmtdGetNumber(_)).WillOnce(Return(5)).WillOnce(Return(9)).WillOnce(Return(4));
@@ -397,6 +401,62 @@ TEST(SysInfoPackageLinuxParserRPM_test, rpmFromLibRPM)
 
 }
 
+TEST(SysInfoPackageLinuxParserRPM_test, rpmFromLibRPMUnchangedDatabase)
+{
+    CallbackMock wrapper;
+
+    auto expectedPackage1 =
+        R"({"name":"1","architecture":"2","description":"3","size":4,"version":"5:7-6","vendor":"8","install_time":"9","groups":"10","format":"rpm","location":" ","priority":" ","source":" "})"_json;
+
+    auto utils_mock { std::make_unique<UtilsMock>() };
+    auto rpm_mock { std::make_unique<RpmLibMock>() };
+
+    gs_utils_mock = utils_mock.get();
+    gs_rpm_mock = rpm_mock.get();
+    rpmts ts = (rpmts) 0x123;
+    rpmtd td = (rpmtd) 0x123;
+    rpmdbMatchIterator mi = (rpmdbMatchIterator) 0x123;
+    Header header = (Header) 0x123;
+
+    // The database is read once, the second scan finds it unchanged.
+    EXPECT_CALL(*utils_mock, fileStamp(_)).WillRepeatedly(Return("unchanged"));
+    EXPECT_CALL(*utils_mock, existsRegular(_)).Times(1).WillOnce(Return(false));
+    EXPECT_CALL(*rpm_mock, rpmReadConfigFiles(_, _)).Times(1).WillOnce(Return(0));
+    EXPECT_CALL(*rpm_mock, rpmtsCreate()).Times(1).WillOnce(Return(ts));
+    EXPECT_CALL(*rpm_mock, rpmtsOpenDB(_, _)).Times(1).WillOnce(Return(0));
+    EXPECT_CALL(*rpm_mock, rpmtsRun(_, _, _)).Times(1).WillOnce(Return(0));
+    EXPECT_CALL(*rpm_mock, rpmtdNew()).Times(1).WillOnce(Return(td));
+    EXPECT_CALL(*rpm_mock, rpmtsInitIterator(_, _, _, _)).Times(1).WillOnce(Return(mi));
+    EXPECT_CALL(*rpm_mock, rpmdbNextIterator(_)).WillOnce(Return(header)).WillOnce(Return(nullptr));
+    EXPECT_CALL(*rpm_mock, rpmtsCloseDB(_)).Times(1).WillOnce(Return(0));
+    EXPECT_CALL(*rpm_mock, rpmtsFree(_)).Times(1).WillOnce(Return(nullptr));
+    EXPECT_CALL(*rpm_mock, rpmtdFree(_)).Times(1).WillOnce(Return(nullptr));
+    EXPECT_CALL(*rpm_mock, rpmdbFreeIterator(_)).Times(1).WillOnce(Return(nullptr));
+    EXPECT_CALL(*rpm_mock, rpmFreeRpmrc());
+
+    EXPECT_CALL(*rpm_mock, headerGet(_, _, _, _)).Times(AnyNumber()).WillRepeatedly(Return(1));
+
+    EXPECT_CALL(*rpm_mock, rpmtdGetString(_)) \
+    .WillOnce(Return("1")) \
+    .WillOnce(Return("7")) \
+    .WillOnce(Return("6")) \
+    .WillOnce(Return("8")) \
+    .WillOnce(Return("10")) \
+    .WillOnce(Return("2")) \
+    .WillOnce(Return("3"));
+    EXPECT_CALL(*rpm_mock, rpmtdGetNumber(_)).WillOnce(Return(5)).WillOnce(Return(9)).WillOnce(Return(4));
+
+    EXPECT_CALL(wrapper, callbackMock(expectedPackage1)).Times(2);
+
+    for (auto i = 0; i < 2; ++i)
+    {
+        getRpmInfo([&wrapper](nlohmann::json & data)
+        {
+            wrapper.callbackMock(data);
+        });
+    }
+}
+
 TEST(SysInfoPackageLinuxParserRPM_test, rpmFallbackFromLibRPM)
 {
     CallbackMock wrapper;
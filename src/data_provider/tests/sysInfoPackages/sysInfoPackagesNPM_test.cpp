@@ -182,3 +182,41 @@ TEST_F(NPMTest, getPackages_ValidPackageJson2Test)
     EXPECT_TRUE(callbackCalledSecond);
 }
 
+
+TEST_F(NPMTest, getPackages_UnchangedPackageJsonIsNotReadAgainTest)
+{
+    std::vector<std::filesystem::path> fakePackages = {"/fake/node_modules/package1"};
+    const std::filesystem::path packageJsonPath {"/fake/node_modules/package1/package.json"};
+    const auto firstWriteTime {std::filesystem::file_time_type {} + std::chrono::seconds(1)};
+    const auto secondWriteTime {firstWriteTime + std::chrono::seconds(1)};
+
+    EXPECT_CALL(*npm, exists(_)).WillRepeatedly(Return(true));
+    EXPECT_CALL(*npm, is_directory(_)).WillRepeatedly(Return(true));
+    EXPECT_CALL(*npm, directory_iterator(_)).WillRepeatedly(Return(fakePackages));
+    EXPECT_CALL(*npm, last_write_time(packageJsonPath))
+    .WillOnce(Return(firstWriteTime))
+    .WillOnce(Return(firstWriteTime))
+    .WillOnce(Return(secondWriteTime));
+
+    nlohmann::json fakePackageJson1 = {{"name", "TestPackage1"}, {"version", "1.0.0"}};
+    nlohmann::json fakePackageJson2 = {{"name", "TestPackage1"}, {"version", "1.0.1"}};
+
+    EXPECT_CALL(*npm, readJson(packageJsonPath))
+    .WillOnce(Return(fakePackageJson1))
+    .WillOnce(Return(fakePackageJson2));
+
+    std::vector<std::string> versions;
+
+    auto callback = [&](nlohmann::json & json)
+    {
+        versions.push_back(json.at("version"));
+    };
+
+    std::set<std::string> folders = {"/fake"};
+
+    npm->getPackages(folders, callback);
+    npm->getPackages(folders, callback);
+    npm->getPackages(folders, callback);
+
+    EXPECT_EQ(std::vector<std::string>({"1.0.0", "1.0.0", "1.0.1"}), versions);
+}
@@ -392,3 +392,41 @@ TEST_F(PYPITest, getPackages_InvalidPackageTest_MissingVersion)
     std::cout << capturedJson.dump(4) << std::endl;
     EXPECT_TRUE(capturedJson.empty());
 }
+
+TEST_F(PYPITest, getPackages_UnchangedMetadataIsNotReadAgainTest)
+{
+    std::vector<std::filesystem::path> fakeFiles = {"/fake/dir/dist-info"};
+    const std::filesystem::path metadataPath {"/fake/dir/dist-info"};
+    const auto writeTime {std::filesystem::file_time_type {} + std::chrono::seconds(1)};
+
+    EXPECT_CALL(*pypi, exists(_)).WillRepeatedly(Return(true));
+    EXPECT_CALL(*pypi, is_directory(_)).WillRepeatedly(Return(true));
+    EXPECT_CALL(*pypi, directory_iterator(_)).WillRepeatedly(Return(fakeFiles));
+    EXPECT_CALL(*pypi, is_regular_file(_)).WillRepeatedly(Return(true));
+    EXPECT_CALL(*pypi, last_write_time(metadataPath)).WillRepeatedly(Return(writeTime));
+
+    std::vector<std::string> fakePackageLines = {"Name: TestPackage", "Version: 1.0.0"};
+
+    EXPECT_CALL(*pypi, readLineByLine(metadataPath, _)).WillOnce([&](const std::filesystem::path&, const std::function<bool(const std::string&)>& callback)
+    {
+        for (const auto& line : fakePackageLines)
+        {
+            callback(line);
+        }
+    });
+
+    auto calls {0};
+    auto callback = [&](nlohmann::json & j)
+    {
+        EXPECT_EQ("TestPackage", j.at("name"));
+        EXPECT_EQ("1.0.0", j.at("version"));
+        ++calls;
+    };
+
+    std::set<std::string> folders = { "/usr/local/lib/python3.9/site-packages" };
+
+    pypi->getPackages(folders, callback);
+    pypi->getPackages(folders, callback);
+
+    EXPECT_EQ(2, calls);
+}
@@ -310,6 +310,56 @@ TEST(RpmLibTest, SinglePackage)
     }
 }
 
+TEST(RpmLibTest, SinglePackageInventoryTags)
+{
+    auto tsMock = reinterpret_cast<rpmts>(0x45);
+    auto tdMock = reinterpret_cast<rpmtd>(0x4D);
+    auto headerMock = reinterpret_cast<Header>(0xFE);
+    auto tsIteratorMock = reinterpret_cast<rpmdbMatchIterator>(0x41);
+    auto mock {std::make_shared<NiceMock<RpmLibMock>>()};
+    EXPECT_CALL(*mock, rpmtsCreate()).WillOnce(Return(tsMock));
+    EXPECT_CALL(*mock, rpmtdNew()).WillOnce(Return(tdMock));
+    EXPECT_CALL(*mock, rpmtsRun(tsMock, nullptr, _)).WillOnce(Return(0));
+    EXPECT_CALL(*mock, rpmtsInitIterator(tsMock, 1000, _, _)).WillOnce(Return(tsIteratorMock));
+
+    EXPECT_CALL(*mock, rpmdbNextIterator(_)).WillOnce(Return(headerMock)).WillOnce(nullptr);
+
+    // The summary and the source are not read, and the values point to the header.
+    EXPECT_CALL(*mock, headerGet(headerMock, RPMTAG_SUMMARY, _, _)).Times(0);
+    EXPECT_CALL(*mock, headerGet(headerMock, RPMTAG_SOURCE, _, _)).Times(0);
+    EXPECT_CALL(*mock, headerGet(headerMock, _, tdMock, HEADERGET_MINMEM)).WillRepeatedly(Return(1));
+    EXPECT_CALL(*mock, rpmtdGetString(_)).Times(7).WillOnce(Return("name"))
+    .WillOnce(Return("version"))
+    .WillOnce(Return("release"))
+    .WillOnce(Return("vendor"))
+    .WillOnce(Return("group"))
+    .WillOnce(Return("arch"))
+    .WillOnce(Return("description"));
+    EXPECT_CALL(*mock, rpmtdGetNumber(_)).Times(3)
+    .WillOnce(Return(1)) // epoch
+    .WillOnce(Return(20)) // installtime
+    .WillOnce(Return(20)); // size
+
+    {
+        RpmPackageManager rpm{mock, RpmPackageManager::Tags::INVENTORY};
+
+        for (const auto& p : rpm)
+        {
+            EXPECT_EQ(p.name, "name");
+            EXPECT_EQ(p.release, "release");
+            EXPECT_EQ(p.epoch, uint64_t{1});
+            EXPECT_TRUE(p.summary.empty());
+            EXPECT_EQ(p.installTime, "20");
+            EXPECT_EQ(p.size, uint64_t{20});
+            EXPECT_EQ(p.vendor, "vendor");
+            EXPECT_EQ(p.group, "group");
+            EXPECT_TRUE(p.source.empty());
+            EXPECT_EQ(p.architecture, "arch");
+            EXPECT_EQ(p.description, "description");
+        }
+    }
+}
+
 TEST(RpmLibTest, TwoPackages)
 {
     auto tsMock = reinterpret_cast<rpmts>(0x45);
@@ -59,8 +59,59 @@ const std::vector<std::string>
                        R"(2:10.0.0.1:Feb 14 09:40:10.326: %ASA-3-106014: Deny inbound icmp src inside:10.10.1.132 dst inside:192.3.69.136 (type 0, code 0))",
                        R"(2:10.0.0.1:Mar  1 18:48:50.483 UTC: %ASA-3-106014: Deny inbound icmp src fw111:10.10.10.10 dst fw111:10.10.10.10(type 8, code 0))",
                        R"(2:10.0.0.1:Mar  1 18:46:11: %ASA-2-106016: Deny IP spoof from (0.0.0.0) to 192.88.99.47 on interface Mobile_Traffic)"};
+
+/**
+ * @brief Previous implementation of parseWazuhEvent, kept as the baseline of the benchmarks
+ */
+base::Event legacyParseWazuhEvent(const std::string& event)
+{
+    auto parseEvent = std::make_shared<json::Json>();
+    parseEvent->setObject();
+
+    const int queue {event[0]};
+    parseEvent->setInt(queue, base::parseEvent::EVENT_QUEUE_ID);
+    auto locationIdx = std::string::npos;
+    for (auto i = 2; i < event.size(); ++i)
+    {
+        if (event[i] == ':' && event[i - 1] != '|')
+        {
+            locationIdx = i;
+            break;
+        }
+    }
+
+    std::string location = event.substr(2, locationIdx - 2);
+    {
+        size_t pos;
+        while ((pos = location.find("|:")) != std::string::npos)
+        {
+            location.erase(pos, 1);
+        }
+    }
+    parseEvent->setString(location, base::parseEvent::EVENT_LOCATION_ID);
+    parseEvent->setString(event.substr(locationIdx + 1), base::parseEvent::EVENT_MESSAGE_ID);
+
+    return parseEvent;
+}
 } // namespace
 
+// Parse Events (previous implementation)
+static void legacyParseWazuhEvent_batch(benchmark::State& state)
+{
+    const auto sizeOfEvents = sampleEventsStr.size();
+    auto current = 0;
+
+    for (auto _ : state)
+    {
+        current = (current + 1) % sizeOfEvents;
+        base::Event e;
+        benchmark::DoNotOptimize(e = legacyParseWazuhEvent(sampleEventsStr[current]));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(legacyParseWazuhEvent_batch)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
+
 // Parse Events
 static void parseWazuhEvent_batch(benchmark::State& state)
 {
@@ -82,6 +133,7 @@ static void parseWazuhEvent_batch(benchmark::State& state)
             state.SkipWithError("Parser failed");
         }
     }
+    state.SetItemsProcessed(state.iterations());
 }
 BENCHMARK(parseWazuhEvent_batch)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
 
@@ -5,6 +5,7 @@
 
 #include "poc_parsec.hpp"
 #include <hlp/hlp.hpp>
+#include <logpar/logpar.hpp>
 
 std::string randomString(int size)
 {
@@ -599,3 +600,84 @@ static void BM_pocLitIpLitFailureLastLit(benchmark::State& state)
     }
 }
 BENCHMARK(BM_pocLitIpLitFailureLastLit);
+
+// Logpar literals, type erased combinators against the parsec::st ones used by logpar
+static std::string logparLiteral(int size)
+{
+    std::string literal = randomString(size);
+    for (auto i = 7; i < size; i += 8)
+    {
+        literal[i] = ' ';
+    }
+
+    return literal + "<field>";
+}
+
+static void BM_logparLiteralErased(benchmark::State& state)
+{
+    using namespace hlp::logpar;
+    std::string input = logparLiteral(state.range(0));
+    std::string_view inputView(input);
+    std::string reserved {syntax::EXPR_BEGIN, syntax::EXPR_OPT, syntax::EXPR_GROUP_BEGIN, syntax::EXPR_GROUP_END};
+    auto literalP = parsec::many1(parser::pNotChar(reserved + syntax::EXPR_ESCAPE)
+                                  | parser::pEscapedChar(reserved, syntax::EXPR_ESCAPE));
+
+    for (auto _ : state)
+    {
+        auto result = literalP(inputView, 0);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+
+        if (result.failure())
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_logparLiteralErased)->RangeMultiplier(2)->Range(1, 256);
+
+static void BM_logparLiteralStatic(benchmark::State& state)
+{
+    using namespace hlp::logpar;
+    std::string input = logparLiteral(state.range(0));
+    std::string_view inputView(input);
+    auto literalP = parser::pLiteral();
+
+    for (auto _ : state)
+    {
+        auto result = literalP(inputView, 0);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+
+        if (result.failure())
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_logparLiteralStatic)->RangeMultiplier(2)->Range(1, 256);
+
+static void BM_logparExpression(benchmark::State& state)
+{
+    auto size = state.range(0);
+    std::string input;
+    for (int i = 0; i < size; ++i)
+    {
+        input += "<~tmp.field/arg1/arg\\/2> literal text ";
+    }
+    std::string_view inputView(input);
+    auto logparP = hlp::logpar::parser::pLogpar();
+
+    for (auto _ : state)
+    {
+        auto result = logparP(inputView, 0);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+
+        if (result.failure())
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_logparExpression)->RangeMultiplier(2)->Range(1, 32);
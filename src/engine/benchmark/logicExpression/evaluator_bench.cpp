@@ -71,8 +71,103 @@ static void BM_DijkstraEvaluator(benchmark::State& state)
     }
 }
 
+namespace
+{
+/**
+ * @brief Terms of the short-circuit benchmarks, "slow" stands for a regex or kvdb helper and is written first.
+ */
+std::function<bool(int)> costTermBuilder(std::string s)
+{
+    if (s == "slow")
+    {
+        return [](int i)
+        {
+            auto acc = i;
+            for (auto j = 0; j < 200; ++j)
+            {
+                benchmark::DoNotOptimize(acc = acc * 31 + j);
+            }
+            return acc % 2 == 0;
+        };
+    }
+    else if (s == "odd")
+    {
+        return [](int i)
+        {
+            return i % 2 != 0;
+        };
+    }
+    else if (s == "great5")
+    {
+        return [](int i)
+        {
+            return i > 5;
+        };
+    }
+    throw std::runtime_error("Error test costTermBuilder, got unexpected term: " + s);
+}
+
+logicexpr::evaluator::Estimate costTermEstimator(const std::string& s)
+{
+    if (s == "slow")
+    {
+        return {200, 0.5};
+    }
+    return {1, 0.5};
+}
+
+parsec::Parser<std::string> costTermParser()
+{
+    return [](std::string_view text, size_t pos) -> parsec::Result<std::string>
+    {
+        auto end = text.find_first_of(" ()", pos);
+        if (end == std::string_view::npos)
+        {
+            end = text.size();
+        }
+        if (std::isupper(text[pos]) || text[pos] == '(' || text[pos] == ')')
+        {
+            return parsec::makeError<std::string>("Unexpected token", pos);
+        }
+        return parsec::makeSuccess<std::string>(std::string {text.substr(pos, end - pos)}, end);
+    };
+}
+
+constexpr auto COST_EXPRESSION = "slow AND odd AND great5";
+} // namespace
+
+static void BM_CostDijkstraEvaluator(benchmark::State& state)
+{
+    auto evaluator =
+        logicexpr::buildDijstraEvaluator<int, std::string>(COST_EXPRESSION, costTermBuilder, costTermParser());
+    for (auto _ : state)
+    {
+        for (auto i = 0; i < state.range(0); ++i)
+        {
+            benchmark::DoNotOptimize(evaluator(i));
+        }
+    }
+}
+
+static void BM_CostShortCircuitEvaluator(benchmark::State& state)
+{
+    auto evaluator = logicexpr::buildShortCircuitEvaluator<int, std::string>(
+        COST_EXPRESSION, costTermBuilder, costTermParser(), costTermEstimator);
+    for (auto _ : state)
+    {
+        for (auto i = 0; i < state.range(0); ++i)
+        {
+            benchmark::DoNotOptimize(evaluator(i));
+        }
+    }
+}
+
 // Benchmarks
 
 BENCHMARK(BM_DijkstraEvaluator)
     ->RangeMultiplier(10)->Range(1, 10000000)
     ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_CostDijkstraEvaluator)->RangeMultiplier(10)->Range(1, 100000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_CostShortCircuitEvaluator)->RangeMultiplier(10)->Range(1, 100000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <base/error.hpp>
+#include <mmdb/manager.hpp>
+
+namespace
+{
+const std::string g_ip {"1.2.3.4"};
+
+std::shared_ptr<mmdb::IHandler> getHandler()
+{
+    static mmdb::Manager manager;
+    static std::shared_ptr<mmdb::IHandler> handler;
+    if (!handler)
+    {
+        manager.addHandler("bench", MMDB_PATH_TEST);
+        handler = base::getResponse(manager.getHandler("bench"));
+    }
+    return handler;
+}
+} // namespace
+
+// Lookup of the address as text, translated by libmaxminddb with getaddrinfo
+static void lookupString(benchmark::State& state)
+{
+    auto handler = getHandler();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(handler->lookup(g_ip));
+    }
+}
+BENCHMARK(lookupString);
+
+// Lookup of the address parsed with inet_pton, as done for the numeric addresses
+static void lookupParsed(benchmark::State& state)
+{
+    auto handler = getHandler();
+    for (auto _ : state)
+    {
+        auto address = mmdb::IPAddress::fromString(g_ip);
+        benchmark::DoNotOptimize(handler->lookup(*address));
+    }
+}
+BENCHMARK(lookupParsed);
+
+// Lookup of an address parsed beforehand
+static void lookupBinary(benchmark::State& state)
+{
+    auto handler = getHandler();
+    auto address = *mmdb::IPAddress::fromString(g_ip);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(handler->lookup(address));
+    }
+}
+BENCHMARK(lookupBinary);
@@ -0,0 +1,546 @@
+/**
+ * @brief End-to-end replay of an event corpus through the router, for regression tracking between releases.
+ *
+ * A policy of the store is loaded as in the engine (schema, logpar, kvdb, builder) and a recorded corpus of events,
+ * one per line in the protocol of the event socket ("<queue>:<location>:<message>"), is replayed through the
+ * Orchestrator with each configured number of workers. Each run reports:
+ *  - eps: events per second, from the first push to the last processed event.
+ *  - p50_us, p99_us, p999_us: latency from the push of an event to the end of its processing by the route.
+ *  - allocs_per_event: calls to operator new per event, including parsing.
+ *  - rss_mb, peak_rss_mb: resident memory after the run.
+ *
+ * The runs are google benchmarks, so --benchmark_out=<file> --benchmark_out_format=json produces the file compared
+ * with tools/compare.py of google benchmark. The store is imported into a temporary pack, it is not modified.
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <benchmark/benchmark.h>
+
+#include <base/logging.hpp>
+#include <base/parseEvent.hpp>
+#include <bk/flat/controller.hpp>
+#include <bk/rx/controller.hpp>
+#include <builder/builder.hpp>
+#include <defs/defs.hpp>
+#include <geo/downloader.hpp>
+#include <geo/manager.hpp>
+#include <hlp/hlp.hpp>
+#include <kvdb/kvdbManager.hpp>
+#include <logpar/logpar.hpp>
+#include <logpar/registerParsers.hpp>
+#include <metrics/metricsManager.hpp>
+#include <queue/concurrentQueue.hpp>
+#include <router/orchestrator.hpp>
+#include <schemf/schema.hpp>
+#include <sockiface/unixSocketFactory.hpp>
+#include <store/drivers/fileDriver.hpp>
+#include <store/drivers/packDriver.hpp>
+#include <store/store.hpp>
+#include <wdb/wdbManager.hpp>
+
+namespace
+{
+std::atomic<uint64_t> g_allocations {0}; ///< Calls to operator new, the aligned variants are not counted
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using QEventType = base::queue::ConcurrentQueue<base::Event>;
+using QTestType = base::queue::ConcurrentQueue<router::test::QueueType>;
+
+constexpr auto ROUTE_NAME = "replay-bench";
+
+struct Options
+{
+    std::string storePath {"/var/ossec/engine/store"};
+    std::string kvdbPath {"/var/ossec/etc/kvdb/"};
+    std::string tzdbPath {"/var/ossec/engine/tzdb"};
+    std::string policy {"policy/wazuh/0"};
+    std::string filter {"filter/allow-all/0"};
+    std::string events;
+    std::vector<int> workers {1};
+    int repeat {1};
+    int batchSize {64};
+    int queueSize {1000000};
+    bool flat {false};
+};
+
+/**
+ * @brief Resident memory of the process in MB, field VmRSS or VmHWM of /proc/self/status
+ */
+double residentMb(const std::string& field)
+{
+    std::ifstream status {"/proc/self/status"};
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.rfind(field + ":", 0) == 0)
+        {
+            return std::stod(line.substr(field.size() + 1)) / 1024.0;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Push time of the events in flight, by address of the event. Sharded to not serialize the workers.
+ */
+class InFlight
+{
+private:
+    static constexpr std::size_t SHARDS = 64;
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<const json::Json*, Clock::time_point> pushed;
+    };
+
+    std::array<Shard, SHARDS> m_shards;
+    std::mutex m_latenciesMutex;
+    std::vector<int64_t> m_latencies; ///< Nanoseconds, of the processed events
+    std::atomic<std::size_t> m_processed {0};
+
+    Shard& shard(const json::Json* event) { return m_shards[(reinterpret_cast<uintptr_t>(event) >> 4) % SHARDS]; }
+
+public:
+    void pushed(const base::Event& event)
+    {
+        auto& target = shard(event.get());
+        std::lock_guard lock {target.mutex};
+        target.pushed.insert_or_assign(event.get(), Clock::now());
+    }
+
+    void processed(const base::Event& event)
+    {
+        const auto now = Clock::now();
+        auto& target = shard(event.get());
+        Clock::time_point start;
+        {
+            std::lock_guard lock {target.mutex};
+            auto it = target.pushed.find(event.get());
+            if (it == target.pushed.end())
+            {
+                return;
+            }
+            start = it->second;
+            target.pushed.erase(it);
+        }
+        {
+            std::lock_guard lock {m_latenciesMutex};
+            m_latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count());
+        }
+        m_processed.fetch_add(1, std::memory_order_release);
+    }
+
+    std::size_t processedCount() const { return m_processed.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Percentile of the latencies in microseconds, sorts the latencies
+     */
+    double percentileUs(double percentile)
+    {
+        std::lock_guard lock {m_latenciesMutex};
+        if (m_latencies.empty())
+        {
+            return 0;
+        }
+        std::sort(m_latencies.begin(), m_latencies.end());
+        const auto index = std::min(m_latencies.size() - 1, static_cast<std::size_t>(percentile * m_latencies.size()));
+        return m_latencies[index] / 1000.0;
+    }
+};
+
+/**
+ * @brief Controller that notifies the end of the processing of each event
+ */
+class TimedController final : public bk::IController
+{
+private:
+    std::shared_ptr<bk::IController> m_controller;
+    std::shared_ptr<InFlight> m_inFlight;
+
+public:
+    TimedController(std::shared_ptr<bk::IController> controller, std::shared_ptr<InFlight> inFlight)
+        : m_controller {std::move(controller)}
+        , m_inFlight {std::move(inFlight)}
+    {
+    }
+
+    void ingest(base::Event&& event) override
+    {
+        auto processed = event;
+        m_controller->ingest(std::move(event));
+        m_inFlight->processed(processed);
+    }
+
+    base::Event ingestGet(base::Event&& event) override
+    {
+        auto processed = m_controller->ingestGet(std::move(event));
+        m_inFlight->processed(processed);
+        return processed;
+    }
+
+    void ingestBatch(std::vector<base::Event>& events) override
+    {
+        m_controller->ingestBatch(events);
+        for (const auto& event : events)
+        {
+            m_inFlight->processed(event);
+        }
+    }
+
+    bool isAviable() const override { return m_controller->isAviable(); }
+    bool isThreadSafe() const override { return m_controller->isThreadSafe(); }
+    void start() override { m_controller->start(); }
+    void stop() override { m_controller->stop(); }
+    std::string printGraph() const override { return m_controller->printGraph(); }
+    const std::unordered_set<std::string>& getTraceables() const override { return m_controller->getTraceables(); }
+    base::RespOrError<bk::Subscription> subscribe(const std::string& traceable,
+                                                  const bk::Subscriber& subscriber) override
+    {
+        return m_controller->subscribe(traceable, subscriber);
+    }
+    void unsubscribe(const std::string& traceable, bk::Subscription subscription) override
+    {
+        m_controller->unsubscribe(traceable, subscription);
+    }
+    void unsubscribeAll() override { m_controller->unsubscribeAll(); }
+};
+
+class TimedControllerMaker final : public bk::IControllerMaker
+{
+private:
+    std::shared_ptr<bk::IControllerMaker> m_maker;
+    std::shared_ptr<InFlight> m_inFlight;
+
+public:
+    TimedControllerMaker(std::shared_ptr<bk::IControllerMaker> maker, std::shared_ptr<InFlight> inFlight)
+        : m_maker {std::move(maker)}
+        , m_inFlight {std::move(inFlight)}
+    {
+    }
+
+    std::shared_ptr<bk::IController> create(const base::Expression& expression,
+                                            const std::unordered_set<std::string>& traceables,
+                                            const std::function<void()>& endCallback) override
+    {
+        return std::make_shared<TimedController>(m_maker->create(expression, traceables, endCallback), m_inFlight);
+    }
+};
+
+/**
+ * @brief Modules of the engine needed to build the policy, as started by the engine
+ */
+struct Engine
+{
+    std::filesystem::path packPath;
+    std::shared_ptr<metricsManager::MetricsManager> metrics;
+    std::shared_ptr<store::Store> store;
+    std::shared_ptr<kvdbManager::KVDBManager> kvdbManager;
+    std::shared_ptr<builder::Builder> builder;
+
+    explicit Engine(const Options& opt)
+    {
+        metrics = std::make_shared<metricsManager::MetricsManager>();
+
+        // The orchestrator saves its tables in the store, work on a copy
+        packPath = std::filesystem::temp_directory_path()
+                   / ("wazuh-replay-bench-" + std::to_string(getpid()) + ".pack");
+        auto packDriver = std::make_shared<store::drivers::PackDriver>(packPath, true);
+        if (auto error = packDriver->import(store::drivers::FileDriver(opt.storePath)))
+        {
+            throw std::runtime_error {"Error importing the store: " + error.value().message};
+        }
+        store = std::make_shared<store::Store>(packDriver);
+
+        kvdbManager::KVDBManagerOptions kvdbOptions {opt.kvdbPath, "kvdb"};
+        kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions, metrics);
+        kvdbManager->initialize();
+
+        auto geoManager = std::make_shared<geo::Manager>(store, std::make_shared<geo::Downloader>());
+
+        auto schema = std::make_shared<schemf::Schema>();
+        auto schemaJson = store->readInternalDoc("schema/engine-schema/0");
+        if (base::isError(schemaJson))
+        {
+            LOG_WARNING("Running without schema: {}", base::getError(schemaJson).message);
+        }
+        else
+        {
+            schema->load(base::getResponse(schemaJson));
+        }
+
+        hlp::initTZDB(opt.tzdbPath, false);
+        auto hlpParsers = store->readInternalDoc("schema/wazuh-logpar-types/0");
+        if (base::isError(hlpParsers))
+        {
+            throw std::runtime_error {"Error loading the logpar types: " + base::getError(hlpParsers).message};
+        }
+        auto logpar = std::make_shared<hlp::logpar::Logpar>(base::getResponse(hlpParsers), schema);
+        hlp::registerParsers(logpar);
+
+        builder::BuilderDeps builderDeps;
+        builderDeps.logpar = logpar;
+        builderDeps.kvdbScopeName = "builder";
+        builderDeps.kvdbManager = kvdbManager;
+        builderDeps.sockFactory = std::make_shared<sockiface::UnixSocketFactory>();
+        builderDeps.wdbManager = std::make_shared<wazuhdb::WDBManager>(std::string(wazuhdb::WDB_SOCK_PATH),
+                                                                       builderDeps.sockFactory);
+        builderDeps.geoManager = geoManager;
+        auto defs = std::make_shared<defs::DefinitionsBuilder>();
+        builder = std::make_shared<builder::Builder>(store, schema, defs, builderDeps);
+    }
+
+    ~Engine()
+    {
+        builder.reset();
+        kvdbManager->finalize();
+        store.reset();
+        std::error_code ec;
+        std::filesystem::remove(packPath, ec);
+    }
+};
+
+std::vector<std::string> readCorpus(const std::string& path)
+{
+    std::ifstream file {path};
+    if (!file.is_open())
+    {
+        throw std::runtime_error {"Cannot open the events file '" + path + "'"};
+    }
+
+    std::vector<std::string> corpus;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (!line.empty())
+        {
+            corpus.emplace_back(std::move(line));
+        }
+    }
+
+    if (corpus.empty())
+    {
+        throw std::runtime_error {"The events file '" + path + "' is empty"};
+    }
+    return corpus;
+}
+
+void replay(benchmark::State& state,
+            const Options& opt,
+            Engine& engine,
+            const std::vector<std::string>& corpus,
+            int workers)
+{
+    for (auto _ : state)
+    {
+        auto inFlight = std::make_shared<InFlight>();
+        std::shared_ptr<bk::IControllerMaker> maker;
+        if (opt.flat)
+        {
+            maker = std::make_shared<bk::flat::ControllerMaker>();
+        }
+        else
+        {
+            maker = std::make_shared<bk::rx::ControllerMaker>();
+        }
+
+        auto eventQueue = std::make_shared<QEventType>(
+            opt.queueSize, engine.metrics->getMetricsScope("BenchEventQueue"),
+            engine.metrics->getMetricsScope("BenchEventQueueDelta"));
+        auto testQueue = std::make_shared<QTestType>(
+            1, engine.metrics->getMetricsScope("BenchTestQueue"),
+            engine.metrics->getMetricsScope("BenchTestQueueDelta"));
+
+        router::Orchestrator::Options config {.m_numThreads = workers,
+                                              .m_wStore = engine.store,
+                                              .m_builder = engine.builder,
+                                              .m_controllerMaker =
+                                                  std::make_shared<TimedControllerMaker>(maker, inFlight),
+                                              .m_prodQueue = eventQueue,
+                                              .m_testQueue = testQueue,
+                                              .m_testTimeout = 1000,
+                                              .m_batchSize = opt.batchSize,
+                                              .m_shareEnvironments = opt.flat};
+        auto orchestrator = std::make_shared<router::Orchestrator>(config);
+        if (auto error = orchestrator->postEntry(router::prod::EntryPost(ROUTE_NAME, opt.policy, opt.filter, 1)))
+        {
+            state.SkipWithError(error.value().message.c_str());
+            break;
+        }
+        orchestrator->start();
+
+        std::size_t total {0};
+        std::size_t invalid {0};
+        const auto allocationsStart = g_allocations.load(std::memory_order_relaxed);
+        const auto start = Clock::now();
+        for (auto i = 0; i < opt.repeat; ++i)
+        {
+            for (const auto& line : corpus)
+            {
+                base::Event event;
+                try
+                {
+                    event = base::parseEvent::parseWazuhEvent(line);
+                }
+                catch (const std::exception&)
+                {
+                    // Discarded by the engine as well
+                    ++invalid;
+                    continue;
+                }
+                inFlight->pushed(event);
+                orchestrator->postEvent(std::move(event));
+                ++total;
+            }
+        }
+
+        // The events discarded by the filter are not processed, wait until the workers are idle
+        auto last = inFlight->processedCount();
+        auto lastChange = Clock::now();
+        while (inFlight->processedCount() < total)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            const auto processed = inFlight->processedCount();
+            if (processed != last)
+            {
+                last = processed;
+                lastChange = Clock::now();
+            }
+            else if (eventQueue->empty() && Clock::now() - lastChange > std::chrono::seconds(1))
+            {
+                break;
+            }
+        }
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        const auto allocations = g_allocations.load(std::memory_order_relaxed) - allocationsStart;
+        const auto processed = inFlight->processedCount();
+
+        orchestrator->stop();
+        orchestrator->deleteEntry(ROUTE_NAME);
+
+        state.SetIterationTime(elapsed);
+        state.counters["events"] = static_cast<double>(processed);
+        state.counters["invalid"] = static_cast<double>(invalid);
+        state.counters["not_processed"] = static_cast<double>(total - processed);
+        state.counters["eps"] = elapsed > 0 ? processed / elapsed : 0;
+        state.counters["p50_us"] = inFlight->percentileUs(0.50);
+        state.counters["p99_us"] = inFlight->percentileUs(0.99);
+        state.counters["p999_us"] = inFlight->percentileUs(0.999);
+        state.counters["allocs_per_event"] = processed > 0 ? static_cast<double>(allocations) / processed : 0;
+        state.counters["rss_mb"] = residentMb("VmRSS");
+        state.counters["peak_rss_mb"] = residentMb("VmHWM");
+    }
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    logging::testInit();
+
+    // The google benchmark flags are removed from argv, the rest are the options of the replay
+    benchmark::Initialize(&argc, argv);
+
+    Options opt;
+    CLI::App app {"Replay an event corpus through the router of the engine"};
+    app.add_option("--store_path", opt.storePath, "Store with the policy, it is not modified.")->capture_default_str();
+    app.add_option("--kvdb_path", opt.kvdbPath, "KVDB databases used by the policy.")->capture_default_str();
+    app.add_option("--tzdb_path", opt.tzdbPath, "Timezone database.")->capture_default_str();
+    app.add_option("--policy", opt.policy, "Policy of the route.")->capture_default_str();
+    app.add_option("--filter", opt.filter, "Filter of the route.")->capture_default_str();
+    app.add_option("--events", opt.events, "Corpus, one event per line as '<queue>:<location>:<message>'.")
+        ->required()
+        ->check(CLI::ExistingFile);
+    app.add_option("--workers", opt.workers, "Router workers of each run.")->delimiter(',')->capture_default_str();
+    app.add_option("--repeat", opt.repeat, "Times the corpus is replayed in each run.")
+        ->check(CLI::PositiveNumber)
+        ->capture_default_str();
+    app.add_option("--batch_size", opt.batchSize, "Events dequeued at once by each worker.")
+        ->check(CLI::PositiveNumber)
+        ->capture_default_str();
+    app.add_option("--queue_size", opt.queueSize, "Capacity of the event queue.")
+        ->check(CLI::PositiveNumber)
+        ->capture_default_str();
+    app.add_flag("--flat", opt.flat, "Use the flat backend with the environments shared between workers.");
+    CLI11_PARSE(app, argc, argv);
+
+    try
+    {
+        const auto corpus = readCorpus(opt.events);
+        Engine engine {opt};
+
+        for (auto workers : opt.workers)
+        {
+            benchmark::RegisterBenchmark(("replay/workers:" + std::to_string(workers)).c_str(),
+                                         [&opt, &engine, &corpus, workers](benchmark::State& state)
+                                         { replay(state, opt, engine, corpus, workers); })
+                ->Iterations(1)
+                ->UseManualTime()
+                ->Unit(benchmark::kMillisecond);
+        }
+
+        benchmark::RunSpecifiedBenchmarks();
+        benchmark::Shutdown();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Replay benchmark failed: {}", e.what());
+        return 1;
+    }
+
+    return 0;
+}
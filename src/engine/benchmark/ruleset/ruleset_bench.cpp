@@ -0,0 +1,651 @@
+/**
+ * @brief Cost of each decoder of a ruleset over the sample logs of its integrations.
+ *
+ * The decoders of a ruleset directory (wazuh-core and integrations, as in the repository) are loaded into a copy of
+ * the store and built as in the engine. The corpus is made of the test inputs of the integrations
+ * (integrations/<name>/test/.../*_input.*, with the format and origin of engine-test.conf), each event is first
+ * decoded by the parents of the benchmarked decoder, as the policy would do, and then by the decoder alone. Each
+ * decoder is a google benchmark reporting:
+ *  - events, matched: events of the corpus and events whose check and parse succeeded.
+ *  - match_ns, miss_ns: mean time of the decoder on the matched and on the missed events.
+ *  - eps: events per second over the whole corpus.
+ *  - allocs_match, allocs_miss: mean calls to operator new on the matched and on the missed events.
+ *
+ * After the runs, the decoders are printed ranked by the time they take over the whole corpus, which is the cost
+ * paid by a manager that enables them.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <benchmark/benchmark.h>
+
+#include <base/expression.hpp>
+#include <base/logging.hpp>
+#include <base/parseEvent.hpp>
+#include <bk/flat/controller.hpp>
+#include <builder/builder.hpp>
+#include <defs/defs.hpp>
+#include <geo/downloader.hpp>
+#include <geo/manager.hpp>
+#include <hlp/hlp.hpp>
+#include <kvdb/kvdbManager.hpp>
+#include <logpar/logpar.hpp>
+#include <logpar/registerParsers.hpp>
+#include <metrics/metricsManager.hpp>
+#include <schemf/schema.hpp>
+#include <sockiface/unixSocketFactory.hpp>
+#include <store/drivers/fileDriver.hpp>
+#include <store/drivers/packDriver.hpp>
+#include <store/store.hpp>
+#include <wdb/wdbManager.hpp>
+#include <yml/yml.hpp>
+
+namespace
+{
+std::atomic<uint64_t> g_allocations {0}; ///< Calls to operator new, the aligned variants are not counted
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr auto DEFAULT_NAMESPACE = "wazuh";
+
+struct Options
+{
+    std::string storePath {"/var/ossec/engine/store"};
+    std::string kvdbPath {"/var/ossec/etc/kvdb/"};
+    std::string tzdbPath {"/var/ossec/engine/tzdb"};
+    std::string ruleset {"ruleset"};
+    std::vector<std::string> decoders;
+    int repeat {10};
+};
+
+/**
+ * @brief Queue and origin of the engine-test formats, see tools/engine-suite event_format.py
+ */
+struct Format
+{
+    const char* name;
+    char queue;
+    const char* origin;
+    bool multiline;
+};
+
+constexpr Format FORMATS[] = {
+    {"audit", '1', "/test/audit.log", true},
+    {"command", '1', "commandTest --single", false},
+    {"eventchannel", 'f', "EventChannel", true},
+    {"full-command", '1', "commandTest --full", true},
+    {"json", '1', "/test/test.json", false},
+    {"macos", '1', "macos", false},
+    {"multi-line", '1', "/test/multiline.log", true},
+    {"syslog", '1', "/test/syslog.log", false},
+    {"remote-syslog", '2', "127.0.1.1", false},
+};
+
+/**
+ * @brief Sample event of the corpus, already decoded by the parents of the benchmarked decoder when it is run
+ */
+struct Sample
+{
+    std::string integration;
+    base::Event event;
+};
+
+/**
+ * @brief Measures of a decoder, for the ranked report
+ */
+struct Result
+{
+    std::string decoder;
+    std::size_t events {0};
+    std::size_t matched {0};
+    double totalNs {0};
+    double matchNs {0};
+    double missNs {0};
+    double allocsMatch {0};
+    double allocsMiss {0};
+    std::string error;
+};
+
+/**
+ * @brief Decoder of the ruleset and the integration it belongs to
+ */
+struct Decoder
+{
+    std::string name;
+    std::string integration;
+    std::vector<std::string> parents;
+};
+
+/**
+ * @brief Modules of the engine needed to build the decoders, as started by the engine
+ */
+struct Engine
+{
+    std::filesystem::path packPath;
+    std::shared_ptr<metricsManager::MetricsManager> metrics;
+    std::shared_ptr<store::Store> store;
+    std::shared_ptr<kvdbManager::KVDBManager> kvdbManager;
+    std::shared_ptr<builder::Builder> builder;
+
+    explicit Engine(const Options& opt)
+    {
+        metrics = std::make_shared<metricsManager::MetricsManager>();
+
+        // The decoders of the ruleset are written to the store, work on a copy
+        packPath = std::filesystem::temp_directory_path()
+                   / ("wazuh-ruleset-bench-" + std::to_string(getpid()) + ".pack");
+        auto packDriver = std::make_shared<store::drivers::PackDriver>(packPath, true);
+        if (auto error = packDriver->import(store::drivers::FileDriver(opt.storePath)))
+        {
+            throw std::runtime_error {"Error importing the store: " + error.value().message};
+        }
+        store = std::make_shared<store::Store>(packDriver);
+
+        kvdbManager::KVDBManagerOptions kvdbOptions {opt.kvdbPath, "kvdb"};
+        kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions, metrics);
+        kvdbManager->initialize();
+
+        auto geoManager = std::make_shared<geo::Manager>(store, std::make_shared<geo::Downloader>());
+
+        auto schema = std::make_shared<schemf::Schema>();
+        auto schemaJson = store->readInternalDoc("schema/engine-schema/0");
+        if (base::isError(schemaJson))
+        {
+            LOG_WARNING("Running without schema: {}", base::getError(schemaJson).message);
+        }
+        else
+        {
+            schema->load(base::getResponse(schemaJson));
+        }
+
+        hlp::initTZDB(opt.tzdbPath, false);
+        auto hlpParsers = store->readInternalDoc("schema/wazuh-logpar-types/0");
+        if (base::isError(hlpParsers))
+        {
+            throw std::runtime_error {"Error loading the logpar types: " + base::getError(hlpParsers).message};
+        }
+        auto logpar = std::make_shared<hlp::logpar::Logpar>(base::getResponse(hlpParsers), schema);
+        hlp::registerParsers(logpar);
+
+        builder::BuilderDeps builderDeps;
+        builderDeps.logpar = logpar;
+        builderDeps.kvdbScopeName = "builder";
+        builderDeps.kvdbManager = kvdbManager;
+        builderDeps.sockFactory = std::make_shared<sockiface::UnixSocketFactory>();
+        builderDeps.wdbManager = std::make_shared<wazuhdb::WDBManager>(std::string(wazuhdb::WDB_SOCK_PATH),
+                                                                       builderDeps.sockFactory);
+        builderDeps.geoManager = geoManager;
+        auto defs = std::make_shared<defs::DefinitionsBuilder>();
+        builder = std::make_shared<builder::Builder>(store, schema, defs, builderDeps);
+    }
+
+    ~Engine()
+    {
+        builder.reset();
+        kvdbManager->finalize();
+        store.reset();
+        std::error_code ec;
+        std::filesystem::remove(packPath, ec);
+    }
+};
+
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file {path};
+    if (!file.is_open())
+    {
+        throw std::runtime_error {"Cannot open '" + path.string() + "'"};
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+/**
+ * @brief Write the decoders of the ruleset to the store, replacing the ones of the installed policy
+ *
+ * @return Decoders found, with the integration of their directory ("wazuh-core" for the core ones)
+ */
+std::vector<Decoder> loadDecoders(const Options& opt, store::Store& store)
+{
+    std::vector<std::filesystem::path> files;
+    const std::filesystem::path ruleset {opt.ruleset};
+    for (const auto& root : {ruleset / "wazuh-core" / "decoders", ruleset / "integrations"})
+    {
+        if (!std::filesystem::exists(root))
+        {
+            continue;
+        }
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root))
+        {
+            const auto& path = entry.path();
+            if (entry.is_regular_file() && path.extension() == ".yml"
+                && path.string().find("/decoders/") != std::string::npos)
+            {
+                files.emplace_back(path);
+            }
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<Decoder> decoders;
+    for (const auto& file : files)
+    {
+        json::Json doc {yml::Converter::loadYMLfromFile(file.string())};
+        auto name = doc.getString("/name");
+        if (!name || name->rfind("decoder/", 0) != 0)
+        {
+            continue;
+        }
+
+        Decoder decoder {name.value(), "wazuh-core", {}};
+        const auto relative = std::filesystem::relative(file, ruleset / "integrations");
+        if (!relative.empty() && relative.begin()->string() != "..")
+        {
+            decoder.integration = relative.begin()->string();
+        }
+        if (auto parents = doc.getArray("/parents"))
+        {
+            for (const auto& parent : parents.value())
+            {
+                if (auto parentName = parent.getString())
+                {
+                    decoder.parents.emplace_back(parentName.value());
+                }
+            }
+        }
+
+        const base::Name assetName {decoder.name};
+        const auto namespaceId = store.getNamespace(assetName).value_or(store::NamespaceId {DEFAULT_NAMESPACE});
+        if (auto error = store.upsertDoc(assetName, namespaceId, doc))
+        {
+            LOG_WARNING("Decoder '{}' not loaded: {}", decoder.name, error.value().message);
+            continue;
+        }
+        decoders.emplace_back(std::move(decoder));
+    }
+
+    return decoders;
+}
+
+/**
+ * @brief Messages of the test inputs of the integrations, in the protocol of the event socket
+ */
+std::vector<std::pair<std::string, std::string>> loadCorpus(const Options& opt)
+{
+    std::vector<std::pair<std::string, std::string>> corpus;
+    const auto integrations = std::filesystem::path {opt.ruleset} / "integrations";
+    if (!std::filesystem::exists(integrations))
+    {
+        return corpus;
+    }
+
+    for (const auto& integrationDir : std::filesystem::directory_iterator(integrations))
+    {
+        const auto integration = integrationDir.path().filename().string();
+        const auto testDir = integrationDir.path() / "test";
+        const auto confPath = testDir / "engine-test.conf";
+        if (!std::filesystem::exists(confPath))
+        {
+            continue;
+        }
+
+        const json::Json conf {readFile(confPath).c_str()};
+        for (const auto& [key, test] : conf.getObject().value_or(std::vector<std::tuple<std::string, json::Json>> {}))
+        {
+            // "<integration>-<dir>" tests the inputs of test/<dir>, "<integration>" the ones of test/
+            auto inputDir = testDir;
+            if (key != integration && key.rfind(integration + "-", 0) == 0)
+            {
+                inputDir /= key.substr(integration.size() + 1);
+            }
+            if (!std::filesystem::is_directory(inputDir))
+            {
+                LOG_WARNING("Test '{}' of integration '{}' has no inputs", key, integration);
+                continue;
+            }
+
+            const auto formatName = test.getString("/format").value_or("syslog");
+            const auto format = std::find_if(std::begin(FORMATS),
+                                             std::end(FORMATS),
+                                             [&formatName](const auto& item) { return formatName == item.name; });
+            if (format == std::end(FORMATS))
+            {
+                LOG_WARNING("Test '{}' of integration '{}' has the unknown format '{}'", key, integration, formatName);
+                continue;
+            }
+            const auto origin = test.getString("/origin").value_or(format->origin);
+            const auto header = std::string {format->queue} + ":" + origin + ":";
+
+            for (const auto& input : std::filesystem::directory_iterator(inputDir))
+            {
+                const auto fileName = input.path().filename().string();
+                if (!input.is_regular_file() || fileName.find("_input.") == std::string::npos)
+                {
+                    continue;
+                }
+
+                const auto content = readFile(input.path());
+                if (format->multiline)
+                {
+                    corpus.emplace_back(integration, header + content);
+                    continue;
+                }
+
+                std::istringstream lines {content};
+                std::string line;
+                while (std::getline(lines, line))
+                {
+                    if (!line.empty())
+                    {
+                        corpus.emplace_back(integration, header + line);
+                    }
+                }
+            }
+        }
+    }
+
+    return corpus;
+}
+
+/**
+ * @brief Replace the consequence of a decoder with a chain that also sets a flag, so the matched events are known
+ *
+ * The expression of an asset is an implication of its check and parse into its normalize stages, or the check and
+ * parse alone when it has no normalize stage.
+ */
+base::Expression withMatchFlag(const base::Expression& asset, bool& matched)
+{
+    auto flag = base::Term<base::EngineOp>::create("matched",
+                                                   [&matched](base::Event event)
+                                                   {
+                                                       matched = true;
+                                                       return base::result::makeSuccess(std::move(event));
+                                                   });
+
+    const auto& operands = asset->getPtr<base::Operation>()->getOperands();
+    if (asset->isImplication() && operands.size() == 2)
+    {
+        return base::Implication::create(
+            asset->getName(), operands[0], base::Chain::create("consequence", {operands[1], flag}));
+    }
+
+    return base::And::create(asset->getName(), {asset, flag});
+}
+
+/**
+ * @brief Ancestors of a decoder, root first, following the first parent of each one
+ */
+std::vector<std::string> ancestors(const std::vector<Decoder>& decoders, const Decoder& decoder)
+{
+    std::vector<std::string> chain;
+    const auto* current = &decoder;
+    while (!current->parents.empty() && chain.size() < decoders.size())
+    {
+        const auto& parent = current->parents.front();
+        chain.insert(chain.begin(), parent);
+        auto it = std::find_if(decoders.begin(), decoders.end(), [&parent](const auto& d) { return d.name == parent; });
+        if (it == decoders.end())
+        {
+            break;
+        }
+        current = &(*it);
+    }
+    return chain;
+}
+
+void runDecoder(benchmark::State& state,
+                const Options& opt,
+                Engine& engine,
+                const std::vector<Decoder>& decoders,
+                const std::vector<std::pair<std::string, std::string>>& corpus,
+                const Decoder& decoder,
+                std::vector<Result>& results)
+{
+    Result result {.decoder = decoder.name};
+    for (auto _ : state)
+    {
+        bool matched {false};
+        std::vector<Sample> samples;
+        std::unique_ptr<bk::flat::Controller> controller;
+        try
+        {
+            // The parents prepare the events as in the policy, they are not measured
+            std::vector<std::unique_ptr<bk::flat::Controller>> parents;
+            for (const auto& parent : ancestors(decoders, decoder))
+            {
+                parents.emplace_back(std::make_unique<bk::flat::Controller>(
+                    engine.builder->buildAsset(base::Name {parent}), std::unordered_set<std::string> {}));
+            }
+            controller = std::make_unique<bk::flat::Controller>(
+                withMatchFlag(engine.builder->buildAsset(base::Name {decoder.name}), matched),
+                std::unordered_set<std::string> {});
+
+            for (const auto& [integration, message] : corpus)
+            {
+                auto event = base::parseEvent::parseWazuhEvent(message);
+                for (auto& parent : parents)
+                {
+                    event = parent->ingestGet(std::move(event));
+                }
+                samples.push_back(Sample {integration, std::move(event)});
+            }
+        }
+        catch (const std::exception& e)
+        {
+            result.error = e.what();
+            state.SkipWithError(result.error.c_str());
+            break;
+        }
+
+        double total {0};
+        double matchTotal {0};
+        double missTotal {0};
+        uint64_t allocsMatch {0};
+        uint64_t allocsMiss {0};
+        for (auto i = 0; i < opt.repeat; ++i)
+        {
+            for (const auto& sample : samples)
+            {
+                // Each run decodes its own copy, the copy is not measured
+                auto event = std::make_shared<json::Json>(*sample.event);
+                matched = false;
+
+                const auto allocationsStart = g_allocations.load(std::memory_order_relaxed);
+                const auto start = Clock::now();
+                auto decoded = controller->ingestGet(std::move(event));
+                const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+                const auto allocations = g_allocations.load(std::memory_order_relaxed) - allocationsStart;
+                benchmark::DoNotOptimize(decoded);
+
+                total += elapsed;
+                if (matched)
+                {
+                    matchTotal += elapsed;
+                    allocsMatch += allocations;
+                    ++result.matched;
+                }
+                else
+                {
+                    missTotal += elapsed;
+                    allocsMiss += allocations;
+                }
+                ++result.events;
+            }
+        }
+
+        const auto missed = result.events - result.matched;
+        result.totalNs = total;
+        result.matchNs = result.matched > 0 ? matchTotal / result.matched : 0;
+        result.missNs = missed > 0 ? missTotal / missed : 0;
+        result.allocsMatch = result.matched > 0 ? static_cast<double>(allocsMatch) / result.matched : 0;
+        result.allocsMiss = missed > 0 ? static_cast<double>(allocsMiss) / missed : 0;
+
+        state.SetIterationTime(total / 1e9);
+        state.counters["events"] = static_cast<double>(result.events);
+        state.counters["matched"] = static_cast<double>(result.matched);
+        state.counters["match_ns"] = result.matchNs;
+        state.counters["miss_ns"] = result.missNs;
+        state.counters["eps"] = total > 0 ? result.events / (total / 1e9) : 0;
+        state.counters["allocs_match"] = result.allocsMatch;
+        state.counters["allocs_miss"] = result.allocsMiss;
+    }
+
+    results.emplace_back(std::move(result));
+}
+
+void printRanking(std::vector<Result> results)
+{
+    std::sort(results.begin(), results.end(), [](const auto& a, const auto& b) { return a.totalNs > b.totalNs; });
+
+    std::printf("\n%-4s %-45s %10s %10s %12s %12s %12s %12s\n",
+                "rank",
+                "decoder",
+                "events",
+                "matched",
+                "total_ms",
+                "match_ns",
+                "miss_ns",
+                "allocs_match");
+    auto rank {1};
+    for (const auto& result : results)
+    {
+        if (!result.error.empty())
+        {
+            continue;
+        }
+        std::printf("%-4d %-45s %10zu %10zu %12.3f %12.1f %12.1f %12.1f\n",
+                    rank++,
+                    result.decoder.c_str(),
+                    result.events,
+                    result.matched,
+                    result.totalNs / 1e6,
+                    result.matchNs,
+                    result.missNs,
+                    result.allocsMatch);
+    }
+
+    for (const auto& result : results)
+    {
+        if (!result.error.empty())
+        {
+            std::printf("not built: %s: %s\n", result.decoder.c_str(), result.error.c_str());
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    logging::testInit();
+
+    // The google benchmark flags are removed from argv, the rest are the options of the suite
+    benchmark::Initialize(&argc, argv);
+
+    Options opt;
+    CLI::App app {"Measure the decoders of a ruleset over the test inputs of its integrations"};
+    app.add_option("--store_path", opt.storePath, "Store with the schema and logpar types, it is not modified.")
+        ->capture_default_str();
+    app.add_option("--kvdb_path", opt.kvdbPath, "KVDB databases used by the decoders.")->capture_default_str();
+    app.add_option("--tzdb_path", opt.tzdbPath, "Timezone database.")->capture_default_str();
+    app.add_option("--ruleset", opt.ruleset, "Ruleset directory, with wazuh-core and integrations.")
+        ->check(CLI::ExistingDirectory)
+        ->capture_default_str();
+    app.add_option("--decoders", opt.decoders, "Decoders to measure, all of the ruleset if empty.")->delimiter(',');
+    app.add_option("--repeat", opt.repeat, "Times the corpus is decoded by each decoder.")
+        ->check(CLI::PositiveNumber)
+        ->capture_default_str();
+    CLI11_PARSE(app, argc, argv);
+
+    try
+    {
+        Engine engine {opt};
+        const auto decoders = loadDecoders(opt, *engine.store);
+        const auto corpus = loadCorpus(opt);
+        if (corpus.empty())
+        {
+            throw std::runtime_error {"No test inputs found in '" + opt.ruleset + "'"};
+        }
+        LOG_INFO("{} decoders and {} sample events loaded.", decoders.size(), corpus.size());
+
+        std::vector<Result> results;
+        for (const auto& decoder : decoders)
+        {
+            if (!opt.decoders.empty()
+                && std::find(opt.decoders.begin(), opt.decoders.end(), decoder.name) == opt.decoders.end())
+            {
+                continue;
+            }
+
+            benchmark::RegisterBenchmark(
+                decoder.name.c_str(),
+                [&opt, &engine, &decoders, &corpus, &decoder, &results](benchmark::State& state)
+                { runDecoder(state, opt, engine, decoders, corpus, decoder, results); })
+                ->Iterations(1)
+                ->UseManualTime()
+                ->Unit(benchmark::kMillisecond);
+        }
+
+        benchmark::RunSpecifiedBenchmarks();
+        benchmark::Shutdown();
+        printRanking(std::move(results));
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Ruleset benchmark failed: {}", e.what());
+        return 1;
+    }
+
+    return 0;
+}
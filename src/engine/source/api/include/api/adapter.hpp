@@ -55,7 +55,8 @@ fromWazuhRequest(const base::utils::wazuhProtocol::WazuhRequest& wRequest)
     //static_assert(std::is_invocable_v<decltype(&U::set_error), U, const std::string&>,
     //              "U must have set_error function");
 
-    const auto json = wRequest.getParameters().value_or(json::Json {"{}"}).str();
+    // Serialized straight from the request, the parameters are not copied to a json first
+    const auto json = wRequest.getParametersStr().value_or("{}");
 
     auto res = eMessage::eMessageFromJson<T>(json);
     if (std::holds_alternative<base::Error>(res))
@@ -8,6 +8,7 @@
 #include <optional>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -191,6 +192,29 @@ public:
     std::optional<base::Error>
     validateResource(const Resource& item, const std::string& namespaceId, const std::string& content) const;
 
+    /**
+     * @brief Resource to validate with validateResources
+     *
+     */
+    struct ValidateItem
+    {
+        Resource item;           ///< Resource identifying an Asset or Integration
+        std::string namespaceId; ///< Namespace of the resource
+        std::string content;     ///< Content of the resource
+    };
+
+    /**
+     * @brief Validate several resources, as validateResource does for each one
+     *
+     * The resources are validated in parallel, and the repeated ones (same type, format, name, namespace and content) are
+     * only validated once.
+     *
+     * @param items Resources to validate
+     * @param threads Max threads validating the resources, 0 for one per hardware thread
+     * @return std::vector<base::OptError> Result of each resource, in the same order
+     */
+    std::vector<base::OptError> validateResources(const std::vector<ValidateItem>& items, std::size_t threads = 0) const;
+
     /**
      * @brief Get the All Namespaces object
      *
@@ -18,6 +18,12 @@ api::HandlerSync resourceGet(std::shared_ptr<Catalog> catalog, std::weak_ptr<rba
 api::HandlerSync resourceDelete(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
 api::HandlerSync resourcePut(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
 api::HandlerSync resourceValidate(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
+
+/* Bulk Resource Endpoint */
+api::HandlerSync resourcesPost(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
+api::HandlerSync resourcesGet(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
+api::HandlerSync resourcesValidate(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
+
 api::HandlerSync policyAddIntegration(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
 api::HandlerSync policyDelIntegration(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
 api::HandlerSync getNamespaces(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
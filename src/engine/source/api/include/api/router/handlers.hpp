@@ -27,6 +27,13 @@ api::HandlerSync getEpsSettings(const std::weak_ptr<::router::IRouterAPI>& route
 api::HandlerSync activateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>& router);
 api::HandlerSync deactivateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>& router);
 
+api::HandlerSync activateProfiler(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync deactivateProfiler(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync getProfilerReport(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync activateTap(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync deactivateTap(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync getTapEvents(const std::weak_ptr<::router::IRouterAPI>& router);
+
 /**
  * @brief Register all router commands
  *
@@ -1,5 +1,9 @@
 #include "api/catalog/catalog.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include <fmt/format.h>
 #include <base/logging.hpp>
 
@@ -573,4 +577,74 @@ std::optional<base::Error> Catalog::validateResource(const Resource& item, const
     ;
 }
 
+std::vector<base::OptError> Catalog::validateResources(const std::vector<ValidateItem>& items,
+                                                       std::size_t threads) const
+{
+    // Index of the first equal item, the repeated items take its result
+    std::vector<std::size_t> unique;
+    std::vector<std::size_t> source(items.size());
+    std::unordered_map<std::string, std::size_t> seen;
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        const auto& item = items[i];
+        auto key = fmt::format("{}|{}|{}|{}|{}",
+                               Resource::typeToStr(item.item.m_type),
+                               Resource::formatToStr(item.item.m_format),
+                               item.item.m_name.toStr(),
+                               item.namespaceId,
+                               item.content);
+        auto [it, inserted] = seen.try_emplace(std::move(key), i);
+        if (inserted)
+        {
+            unique.push_back(i);
+        }
+        source[i] = it->second;
+    }
+
+    std::vector<base::OptError> results(items.size());
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]()
+    {
+        for (auto n = next++; n < unique.size(); n = next++)
+        {
+            const auto& item = items[unique[n]];
+            try
+            {
+                results[unique[n]] = validateResource(item.item, item.namespaceId, item.content);
+            }
+            catch (const std::exception& e)
+            {
+                results[unique[n]] = base::Error {e.what()};
+            }
+        }
+    };
+
+    if (threads == 0)
+    {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, unique.size());
+
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < threads; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        if (source[i] != i)
+        {
+            results[i] = results[source[i]];
+        }
+    }
+
+    return results;
+}
+
 } // namespace api::catalog
@@ -33,6 +33,89 @@ auto checkResourcePermission(const base::Name& name,
 namespace eCatalog = ::com::wazuh::api::engine::catalog;
 namespace eEngine = ::com::wazuh::api::engine;
 
+namespace
+{
+
+// Target resources of the bulk commands, checked as the single resource commands do
+base::RespOrError<catalog::Resource> postTarget(const eCatalog::ResourcePost_Request& eRequest)
+{
+    const auto error = !eRequest.has_type()          ? std::make_optional("Missing /type parameter or is invalid")
+                       : !eRequest.has_format()      ? std::make_optional("Missing /format parameter or is invalid")
+                       : !eRequest.has_content()     ? std::make_optional("Missing /content parameter")
+                       : !eRequest.has_namespaceid() ? std::make_optional("Missing /namespace parameter")
+                                                     : std::nullopt;
+    if (error)
+    {
+        return base::Error {error.value()};
+    }
+
+    try
+    {
+        return catalog::Resource {base::Name {Resource::typeToStr(eRequest.type())}, eRequest.format()};
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {e.what()};
+    }
+}
+
+base::RespOrError<catalog::Resource> getTarget(const eCatalog::ResourceGet_Request& eRequest)
+{
+    const auto error = !eRequest.has_name()          ? std::make_optional("Missing /name parameter")
+                       : !eRequest.has_format()      ? std::make_optional("Missing or invalid /format parameter")
+                       : !eRequest.has_namespaceid() ? std::make_optional("Missing /namespaceid parameter")
+                                                     : std::nullopt;
+    if (error)
+    {
+        return base::Error {error.value()};
+    }
+
+    try
+    {
+        return catalog::Resource {base::Name {eRequest.name()}, eRequest.format()};
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {e.what()};
+    }
+}
+
+base::RespOrError<catalog::Resource> validateTarget(const eCatalog::ResourceValidate_Request& eRequest)
+{
+    const auto error = !eRequest.has_name()      ? std::make_optional("Missing /name parameter")
+                       : !eRequest.has_format()  ? std::make_optional("Missing or invalid /format parameter")
+                       : !eRequest.has_content() ? std::make_optional("Missing /content parameter")
+                                                 : std::nullopt;
+    if (error)
+    {
+        return base::Error {error.value()};
+    }
+
+    try
+    {
+        return catalog::Resource {base::Name {eRequest.name()}, eRequest.format()};
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {e.what()};
+    }
+}
+
+void addResult(eCatalog::Resources_Response& eResponse, const base::OptError& error)
+{
+    auto* result = eResponse.add_results();
+    if (error)
+    {
+        result->set_status(eEngine::ReturnStatus::ERROR);
+        result->set_error(error.value().message);
+    }
+    else
+    {
+        result->set_status(eEngine::ReturnStatus::OK);
+    }
+}
+} // namespace
+
 api::HandlerSync resourcePost(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac)
 {
 
@@ -423,6 +506,153 @@ api::HandlerSync resourceValidate(std::shared_ptr<Catalog> catalog, std::weak_pt
     };
 }
 
+api::HandlerSync resourcesPost(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac)
+{
+
+    auto rbacPtr = rbac.lock();
+    if (!rbacPtr)
+    {
+        throw std::runtime_error {"RBAC instance is not available"};
+    }
+
+    return [catalog](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eCatalog::ResourcesPost_Request;
+        using ResponseType = eCatalog::Resources_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+        const auto& eRequest = std::get<RequestType>(res);
+
+        // Posted in order, a resource may depend on a previous one
+        ResponseType eResponse;
+        for (const auto& eResource : eRequest.resources())
+        {
+            auto target = postTarget(eResource);
+            if (base::isError(target))
+            {
+                addResult(eResponse, base::getError(target));
+                continue;
+            }
+
+            addResult(eResponse,
+                      catalog->postResource(base::getResponse(target), eResource.namespaceid(), eResource.content()));
+        }
+
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+        return ::api::adapter::toWazuhResponse(eResponse);
+    };
+}
+
+api::HandlerSync resourcesGet(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac)
+{
+
+    auto rbacPtr = rbac.lock();
+    if (!rbacPtr)
+    {
+        throw std::runtime_error {"RBAC instance is not available"};
+    }
+
+    return [catalog](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eCatalog::ResourcesGet_Request;
+        using ResponseType = eCatalog::Resources_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+        const auto& eRequest = std::get<RequestType>(res);
+
+        ResponseType eResponse;
+        for (const auto& eResource : eRequest.resources())
+        {
+            auto target = getTarget(eResource);
+            if (base::isError(target))
+            {
+                addResult(eResponse, base::getError(target));
+                continue;
+            }
+
+            auto queryRes = catalog->getResource(base::getResponse(target), eResource.namespaceid());
+            if (base::isError(queryRes))
+            {
+                addResult(eResponse, base::getError(queryRes));
+                continue;
+            }
+
+            addResult(eResponse, base::noError());
+            eResponse.mutable_results(eResponse.results_size() - 1)->set_content(base::getResponse<std::string>(queryRes));
+        }
+
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+        return ::api::adapter::toWazuhResponse(eResponse);
+    };
+}
+
+api::HandlerSync resourcesValidate(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac)
+{
+
+    auto rbacPtr = rbac.lock();
+    if (!rbacPtr)
+    {
+        throw std::runtime_error {"RBAC instance is not available"};
+    }
+
+    return [catalog](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eCatalog::ResourcesValidate_Request;
+        using ResponseType = eCatalog::Resources_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+        const auto& eRequest = std::get<RequestType>(res);
+
+        // The malformed entries keep their error, the others are validated together
+        std::vector<base::OptError> results(eRequest.resources_size());
+        std::vector<Catalog::ValidateItem> items;
+        std::vector<std::size_t> positions;
+        for (auto i = 0; i < eRequest.resources_size(); ++i)
+        {
+            const auto& eResource = eRequest.resources(i);
+            auto target = validateTarget(eResource);
+            if (base::isError(target))
+            {
+                results[i] = base::getError(target);
+                continue;
+            }
+
+            items.push_back({base::getResponse(target), eResource.namespaceid(), eResource.content()});
+            positions.push_back(i);
+        }
+
+        auto validated = catalog->validateResources(items);
+        for (std::size_t i = 0; i < validated.size(); ++i)
+        {
+            results[positions[i]] = std::move(validated[i]);
+        }
+
+        ResponseType eResponse;
+        for (const auto& result : results)
+        {
+            addResult(eResponse, result);
+        }
+
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+        return ::api::adapter::toWazuhResponse(eResponse);
+    };
+}
+
 api::HandlerSync getNamespaces(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac)
 {
 
@@ -478,6 +708,9 @@ void registerHandlers(std::shared_ptr<Catalog> catalog, std::shared_ptr<api::Api
                     && api->registerHandler("catalog.resource/put", Api::convertToHandlerAsync(resourcePut(catalog, api->getRBAC())))
                     && api->registerHandler("catalog.resource/delete", Api::convertToHandlerAsync(resourceDelete(catalog, api->getRBAC())))
                     && api->registerHandler("catalog.resource/validate", Api::convertToHandlerAsync(resourceValidate(catalog, api->getRBAC())))
+                    && api->registerHandler("catalog.resources/post", Api::convertToHandlerAsync(resourcesPost(catalog, api->getRBAC())))
+                    && api->registerHandler("catalog.resources/get", Api::convertToHandlerAsync(resourcesGet(catalog, api->getRBAC())))
+                    && api->registerHandler("catalog.resources/validate", Api::convertToHandlerAsync(resourcesValidate(catalog, api->getRBAC())))
                     && api->registerHandler("catalog.namespaces/get", Api::convertToHandlerAsync(getNamespaces(catalog, api->getRBAC())));
 
     if (!ok)
@@ -1,5 +1,6 @@
 #include <api/kvdb/handlers.hpp>
 
+#include <optional>
 #include <string>
 
 #include <fmt/format.h>
@@ -7,6 +8,7 @@
 #include <api/adapter.hpp>
 #include <eMessages/eMessage.h>
 #include <eMessages/kvdb.pb.h>
+#include <google/protobuf/arena.h>
 #include <base/json.hpp>
 #include <base/utils/stringUtils.hpp>
 
@@ -20,6 +22,77 @@ constexpr auto MESSAGE_MISSING_NAME = "Missing /name";
 constexpr auto MESSAGE_NAME_EMPTY = "Field /name is empty";
 constexpr auto MESSAGE_MISSING_KEY = "Missing /key";
 constexpr auto MESSAGE_KEY_EMPTY = "Field /key is empty";
+constexpr auto MESSAGE_CURSOR_INVALID = "Field /cursor is invalid";
+constexpr auto MESSAGE_CURSOR_AND_PAGE = "Fields /cursor and /page cannot be used together";
+
+namespace
+{
+// The cursor is the last key returned, hex encoded so the clients handle it as an opaque token
+std::string encodeCursor(const std::string& key)
+{
+    constexpr auto HEX = "0123456789abcdef";
+    std::string cursor;
+    cursor.reserve(key.size() * 2);
+    for (const unsigned char c : key)
+    {
+        cursor.push_back(HEX[c >> 4]);
+        cursor.push_back(HEX[c & 0x0F]);
+    }
+
+    return cursor;
+}
+
+std::optional<std::string> decodeCursor(const std::string& cursor)
+{
+    auto nibble = [](char c) -> int
+    {
+        return c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+    };
+
+    if (cursor.size() % 2 != 0)
+    {
+        return std::nullopt;
+    }
+
+    std::string key;
+    key.reserve(cursor.size() / 2);
+    for (std::size_t i = 0; i < cursor.size(); i += 2)
+    {
+        const auto high = nibble(cursor[i]);
+        const auto low = nibble(cursor[i + 1]);
+        if (high < 0 || low < 0)
+        {
+            return std::nullopt;
+        }
+        key.push_back(static_cast<char>((high << 4) | low));
+    }
+
+    return key;
+}
+
+/**
+ * @brief Add the records to the entries of a dump or search response, each value is parsed in place
+ *
+ * @return base::OptError The error if a value is not a valid JSON
+ */
+template<typename ResponseType>
+base::OptError addEntries(ResponseType& eResponse, const std::list<std::pair<std::string, std::string>>& records)
+{
+    auto entries = eResponse.mutable_entries();
+    entries->Reserve(static_cast<int>(records.size()));
+    for (const auto& [key, value] : records)
+    {
+        auto entry = entries->Add();
+        entry->set_key(key);
+        if (auto error = eMessage::eMessageFromJson(value, entry->mutable_value()); error)
+        {
+            return base::Error {fmt::format("{}. For key '{}' and value {}", error->message, key, value)};
+        }
+    }
+
+    return std::nullopt;
+}
+} // namespace
 
 /* Manager Endpoint */
 
@@ -171,6 +244,7 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
                             ? std::make_optional("Field /page must be greater than 0")
                         : eRequest.has_records() && eRequest.records() == 0
                             ? std::make_optional("Field /records must be greater than 0")
+                        : eRequest.has_cursor() && eRequest.has_page() ? std::make_optional(MESSAGE_CURSOR_AND_PAGE)
                             : std::nullopt;
 
         if (errorMsg.has_value())
@@ -178,6 +252,12 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
             return ::api::adapter::genericError<ResponseType>(errorMsg.value());
         }
 
+        const auto after = eRequest.has_cursor() ? decodeCursor(eRequest.cursor()) : std::make_optional<std::string>();
+        if (!after)
+        {
+            return ::api::adapter::genericError<ResponseType>(MESSAGE_CURSOR_INVALID);
+        }
+
         const auto resultExists = kvdbManager->existsDB(eRequest.name());
 
         if (!resultExists)
@@ -193,32 +273,25 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
         }
 
         auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
-        auto dumpRes = handler->dump(page, records);
+        auto dumpRes = eRequest.has_cursor() ? handler->scan("", after.value(), records) : handler->dump(page, records);
 
         if (std::holds_alternative<base::Error>(dumpRes))
         {
             return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(dumpRes).message);
         }
         const auto& dump = std::get<std::list<std::pair<std::string, std::string>>>(dumpRes);
-        ResponseType eResponse;
+        // The entries and their values are allocated in the arena and released at once with it
+        google::protobuf::Arena arena;
+        auto& eResponse = *google::protobuf::Arena::CreateMessage<ResponseType>(&arena);
         eResponse.set_status(eEngine::ReturnStatus::OK);
-
-        auto entries = eResponse.mutable_entries();
-        for (const auto& [key, value] : dump)
+        if (eRequest.has_cursor() && dump.size() == records)
         {
-            auto entry = eKVDB::Entry();
-            entry.mutable_key()->assign(key);
+            eResponse.set_next_cursor(encodeCursor(dump.back().first));
+        }
 
-            const auto res = eMessage::eMessageFromJson<google::protobuf::Value>(value);
-            if (std::holds_alternative<base::Error>(res)) // Should not happen but just in case
-            {
-                const auto msg =
-                    fmt::format("{}. For key '{}' and value {}", std::get<base::Error>(res).message, key, value);
-                return ::api::adapter::genericError<ResponseType>(msg);
-            }
-            const auto json_value = std::get<google::protobuf::Value>(res);
-            entry.mutable_value()->CopyFrom(json_value);
-            entries->Add(std::move(entry));
+        if (auto error = addEntries(eResponse, dump); error)
+        {
+            return ::api::adapter::genericError<ResponseType>(error->message);
         }
 
         // Adapt the response to wazuh api
@@ -273,17 +346,13 @@ api::HandlerSync dbGet(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager, c
             return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(resultGet).message);
         }
 
-        const auto protoVal = eMessage::eMessageFromJson<google::protobuf::Value>(std::get<std::string>(resultGet));
-        if (std::holds_alternative<base::Error>(protoVal)) // Should not happen but just in case
+        ResponseType eResponse;
+        const auto& value = std::get<std::string>(resultGet);
+        if (auto error = eMessage::eMessageFromJson(value, eResponse.mutable_value()); error) // Should not happen
         {
-            const auto msj =
-                std::get<base::Error>(protoVal).message + ". For value " + std::get<std::string>(resultGet);
+            const auto msj = error->message + ". For value " + value;
             return ::api::adapter::genericError<ResponseType>(msj);
         }
-
-        ResponseType eResponse;
-        const auto json_value = std::get<google::protobuf::Value>(protoVal);
-        eResponse.mutable_value()->CopyFrom(json_value);
         eResponse.set_status(eEngine::ReturnStatus::OK);
 
         // Adapt the response to wazuh api
@@ -436,6 +505,7 @@ api::HandlerSync dbSearch(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager
                             ? std::make_optional("Field /page must be greater than 0")
                         : eRequest.has_records() && eRequest.records() == 0
                             ? std::make_optional("Field /records must be greater than 0")
+                        : eRequest.has_cursor() && eRequest.has_page() ? std::make_optional(MESSAGE_CURSOR_AND_PAGE)
                             : std::nullopt;
 
         if (errorMsg.has_value())
@@ -443,6 +513,12 @@ api::HandlerSync dbSearch(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager
             return ::api::adapter::genericError<ResponseType>(errorMsg.value());
         }
 
+        const auto after = eRequest.has_cursor() ? decodeCursor(eRequest.cursor()) : std::make_optional<std::string>();
+        if (!after)
+        {
+            return ::api::adapter::genericError<ResponseType>(MESSAGE_CURSOR_INVALID);
+        }
+
         if (!kvdbManager->existsDB(eRequest.name()))
         {
             return ::api::adapter::genericError<ResponseType>(fmt::format(MESSAGE_DB_NOT_EXISTS, eRequest.name()));
@@ -457,32 +533,26 @@ api::HandlerSync dbSearch(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager
 
         auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
 
-        const auto searchRes = handler->search(eRequest.prefix(), page, records);
+        const auto searchRes = eRequest.has_cursor() ? handler->scan(eRequest.prefix(), after.value(), records)
+                                                     : handler->search(eRequest.prefix(), page, records);
 
         if (std::holds_alternative<base::Error>(searchRes))
         {
             return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(searchRes).message);
         }
         const auto& resultSearch = std::get<std::list<std::pair<std::string, std::string>>>(searchRes);
-        ResponseType eResponse;
+        // The entries and their values are allocated in the arena and released at once with it
+        google::protobuf::Arena arena;
+        auto& eResponse = *google::protobuf::Arena::CreateMessage<ResponseType>(&arena);
         eResponse.set_status(eEngine::ReturnStatus::OK);
+        if (eRequest.has_cursor() && resultSearch.size() == records)
+        {
+            eResponse.set_next_cursor(encodeCursor(resultSearch.back().first));
+        }
 
-        auto entries = eResponse.mutable_entries();
-        for (const auto& [key, value] : resultSearch)
-        {
-            auto entry = eKVDB::Entry();
-            entry.mutable_key()->assign(key);
-
-            const auto res = eMessage::eMessageFromJson<google::protobuf::Value>(value);
-            if (std::holds_alternative<base::Error>(res)) // Should not happen but just in case
-            {
-                const auto msg =
-                    fmt::format("{}. For key '{}' and value {}", std::get<base::Error>(res).message, key, value);
-                return ::api::adapter::genericError<ResponseType>(msg);
-            }
-            const auto json_value = std::get<google::protobuf::Value>(res);
-            entry.mutable_value()->CopyFrom(json_value);
-            entries->Add(std::move(entry));
+        if (auto error = addEntries(eResponse, resultSearch); error)
+        {
+            return ::api::adapter::genericError<ResponseType>(error->message);
         }
 
         // Adapt the response to wazuh api
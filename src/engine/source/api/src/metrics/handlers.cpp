@@ -37,12 +37,12 @@ api::HandlerSync metricsDumpCmd(const std::shared_ptr<metricsManager::IMetricsMa
             return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(result).message);
         }
 
-        const auto protoVal = eMessage::eMessageFromJson<google::protobuf::Value>(std::get<std::string>(result));
-        const auto json_value = std::get<google::protobuf::Value>(protoVal);
-
         ResponseType eResponse;
+        if (auto error = eMessage::eMessageFromJson(std::get<std::string>(result), eResponse.mutable_value()); error)
+        {
+            return ::api::adapter::genericError<ResponseType>(error->message);
+        }
         eResponse.set_status(eEngine::ReturnStatus::OK);
-        eResponse.mutable_value()->CopyFrom(json_value);
 
         return ::api::adapter::toWazuhResponse(eResponse);
     };
@@ -80,11 +80,11 @@ api::HandlerSync metricsGetCmd(const std::shared_ptr<metricsManager::IMetricsMan
             return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(result).message);
         }
 
-        const auto protoVal = eMessage::eMessageFromJson<google::protobuf::Value>(std::get<std::string>(result));
-        const auto json_value = std::get<google::protobuf::Value>(protoVal);
-
         ResponseType eResponse;
-        eResponse.mutable_value()->CopyFrom(json_value);
+        if (auto error = eMessage::eMessageFromJson(std::get<std::string>(result), eResponse.mutable_value()); error)
+        {
+            return ::api::adapter::genericError<ResponseType>(error->message);
+        }
         eResponse.set_status(eEngine::ReturnStatus::OK);
 
         return ::api::adapter::toWazuhResponse(eResponse);
@@ -178,13 +178,12 @@ api::HandlerSync metricsList(const std::shared_ptr<metricsManager::IMetricsManag
             return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(result).message);
         }
 
+        if (auto error = eMessage::eMessageFromJson(std::get<std::string>(result), eResponse.mutable_value()); error)
+        {
+            return ::api::adapter::genericError<ResponseType>(error->message);
+        }
         eResponse.set_status(eEngine::ReturnStatus::OK);
 
-        const auto aux = std::get<std::string>(result);
-        const auto protoVal = eMessage::eMessageFromJson<google::protobuf::Value>(aux);
-        const auto json_value = std::get<google::protobuf::Value>(protoVal);
-        eResponse.mutable_value()->CopyFrom(json_value);
-
         return ::api::adapter::toWazuhResponse(eResponse);
     };
 }
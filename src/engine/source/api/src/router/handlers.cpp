@@ -117,6 +117,7 @@ eRouter::Entry eRouteEntryFromEntry(const ::router::prod::Entry& entry,
     {
         eEntry.mutable_description()->assign(entry.description().value());
     }
+    eEntry.set_tee(entry.tee());
 
     eRouter::State state = ::router::env::State::ENABLED == entry.status()    ? eRouter::State::ENABLED
                            : ::router::env::State::DISABLED == entry.status() ? eRouter::State::DISABLED
@@ -172,6 +173,7 @@ api::HandlerSync routePost(const std::weak_ptr<::router::IRouterAPI>& router)
         {
             entryPost.description(eRequest.route().description());
         }
+        entryPost.tee(eRequest.route().tee());
         auto error = router->postEntry(entryPost);
 
         // Build the response
@@ -476,6 +478,200 @@ api::HandlerSync deactivateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>&
     };
 }
 
+api::HandlerSync activateProfiler(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::ProfilerEnable_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        const auto changeRes = router->activateProfiler(true, eRequest.sample_rate());
+
+        if (changeRes.has_value())
+        {
+            return genericError<ResponseType>(changeRes.value().message);
+        }
+        return genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync deactivateProfiler(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::ProfilerDisable_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        const auto changeRes = router->activateProfiler(false, 0);
+
+        if (changeRes.has_value())
+        {
+            return genericError<ResponseType>(changeRes.value().message);
+        }
+        return genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync getProfilerReport(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::ProfilerGet_Request;
+        using ResponseType = eRouter::ProfilerGet_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        const auto getRes = router->getProfilerReport(eRequest.top());
+
+        if (base::isError(getRes))
+        {
+            return genericError<ResponseType>(base::getError(getRes).message);
+        }
+
+        auto toStats = [](const ::router::prof::Stats& stats, eRouter::ProfilerStats* eStats)
+        {
+            eStats->set_name(stats.name);
+            eStats->set_calls(stats.calls);
+            eStats->set_matches(stats.matches);
+            eStats->set_match_rate(stats.calls == 0 ? 0.0 : static_cast<double>(stats.matches) / stats.calls);
+            eStats->set_total_ns(stats.totalNs);
+        };
+
+        // Build the response
+        ResponseType eResponse;
+        const auto& report = base::getResponse(getRes);
+        eResponse.set_enabled(report.enabled);
+        eResponse.set_sample_rate(report.sampleRate);
+        for (const auto& asset : report.assets)
+        {
+            toStats(asset, eResponse.add_assets());
+        }
+        for (const auto& helper : report.helpers)
+        {
+            toStats(helper, eResponse.add_helpers());
+        }
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse<ResponseType>(eResponse);
+    };
+}
+
+api::HandlerSync activateTap(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::TapEnable_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        if (eRequest.has_field() != eRequest.has_value())
+        {
+            return genericError<ResponseType>("Fields /field and /value must be used together");
+        }
+
+        const auto changeRes = router->activateTap(true, eRequest.sample_rate(), eRequest.field(), eRequest.value());
+
+        if (changeRes.has_value())
+        {
+            return genericError<ResponseType>(changeRes.value().message);
+        }
+        return genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync deactivateTap(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::TapDisable_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        const auto changeRes = router->activateTap(false, 0, "", "");
+
+        if (changeRes.has_value())
+        {
+            return genericError<ResponseType>(changeRes.value().message);
+        }
+        return genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync getTapEvents(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::TapGet_Request;
+        using ResponseType = eRouter::TapGet_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        auto getRes = router->getTapEvents(eRequest.max());
+
+        if (base::isError(getRes))
+        {
+            return genericError<ResponseType>(base::getError(getRes).message);
+        }
+
+        // Build the response
+        ResponseType eResponse;
+        auto& tapEvents = base::getResponse(getRes);
+        eResponse.set_enabled(tapEvents.enabled);
+        eResponse.set_sample_rate(tapEvents.rate);
+        for (auto& event : tapEvents.events)
+        {
+            eResponse.add_events(std::move(event));
+        }
+        eResponse.set_sampled(tapEvents.sampled);
+        eResponse.set_dropped(tapEvents.dropped);
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse<ResponseType>(eResponse);
+    };
+}
+
 void registerHandlers(const std::weak_ptr<::router::IRouterAPI>& router,
                       const std::weak_ptr<api::policy::IPolicy>& policy,
                       std::shared_ptr<api::Api> api)
@@ -495,7 +691,15 @@ void registerHandlers(const std::weak_ptr<::router::IRouterAPI>& router,
         && api->registerHandler("router.eps/update", Api::convertToHandlerAsync(changeEpsSettings(router)))
         && api->registerHandler("router.eps/get", Api::convertToHandlerAsync(getEpsSettings(router)))
         && api->registerHandler("router.eps/activate", Api::convertToHandlerAsync(activateEpsLimiter(router)))
-        && api->registerHandler("router.eps/deactivate", Api::convertToHandlerAsync(deactivateEpsLimiter(router)));
+        && api->registerHandler("router.eps/deactivate", Api::convertToHandlerAsync(deactivateEpsLimiter(router)))
+        // Commands to manage the profiler of the routes
+        && api->registerHandler("router.profiler/activate", Api::convertToHandlerAsync(activateProfiler(router)))
+        && api->registerHandler("router.profiler/deactivate", Api::convertToHandlerAsync(deactivateProfiler(router)))
+        && api->registerHandler("router.profiler/get", Api::convertToHandlerAsync(getProfilerReport(router)))
+        // Commands to manage the tap of the production events
+        && api->registerHandler("router.tap/activate", Api::convertToHandlerAsync(activateTap(router)))
+        && api->registerHandler("router.tap/deactivate", Api::convertToHandlerAsync(deactivateTap(router)))
+        && api->registerHandler("router.tap/get", Api::convertToHandlerAsync(getTapEvents(router)));
 
     if (!ok)
     {
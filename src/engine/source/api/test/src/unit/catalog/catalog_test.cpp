@@ -138,3 +138,23 @@ INSTANTIATE_TEST_SUITE_P(CatalogCommand,
                                            std::make_tuple(true, successResourceAssetYml, successYml, "user"),
                                            std::make_tuple(true, failResourceAsset, successYml, "user"),
                                            std::make_tuple(true, successCollectionAssetJson, successJson.str(), "user")));
+
+TEST(CatalogValidateResourcesTest, ResultPerItemInOrder)
+{
+    logging::testInit();
+    api::catalog::Catalog catalog(getConfig());
+    const api::catalog::Resource schemaResource {successSchemaName, api::catalog::Resource::Format::json};
+
+    std::vector<api::catalog::Catalog::ValidateItem> items {{schemaResource, "user", schema},
+                                                            {successResourceAssetYml, "user", "[invalid"},
+                                                            {schemaResource, "user", schema}};
+
+    std::vector<base::OptError> results;
+    ASSERT_NO_THROW(results = catalog.validateResources(items, 2));
+    ASSERT_EQ(results.size(), items.size());
+    ASSERT_TRUE(results[0]);
+    ASSERT_TRUE(results[1]);
+    ASSERT_TRUE(results[2]);
+    EXPECT_EQ(results[0].value().message, results[2].value().message);
+    EXPECT_NE(results[0].value().message, results[1].value().message);
+}
@@ -1064,7 +1064,37 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(R"({"name": "test", "page": 1, "records": 0})",
                         R"({"status":"ERROR","entries":[],"error":"Field /records must be greater than 0"})"),
         std::make_tuple(R"({"name": "test", "page": 0, "records": 2})",
-                        R"({"status":"ERROR","entries":[],"error":"Field /page must be greater than 0"})")));
+                        R"({"status":"ERROR","entries":[],"error":"Field /page must be greater than 0"})"),
+        std::make_tuple(
+            R"({"name": "test", "page": 1, "cursor": ""})",
+            R"({"status":"ERROR","entries":[],"error":"Fields /cursor and /page cannot be used together"})"),
+        std::make_tuple(R"({"name": "test", "cursor": "6b6"})",
+                        R"({"status":"ERROR","entries":[],"error":"Field /cursor is invalid"})"),
+        std::make_tuple(R"({"name": "test", "cursor": "zz"})",
+                        R"({"status":"ERROR","entries":[],"error":"Field /cursor is invalid"})")));
+
+TEST(DumpWithCursor, ContinuesAfterLastKey)
+{
+    logging::testInit();
+    auto kvdbManager = std::make_shared<MockKVDBManager>();
+    EXPECT_CALL(*kvdbManager, existsDB("test")).WillRepeatedly(testing::Return(true));
+
+    auto kvdbHandler = std::make_shared<MockKVDBHandler>();
+    std::list<std::pair<std::string, std::string>> page {{"key2", R"("value2")"}, {"key3", R"("value3")"}};
+    EXPECT_CALL(*kvdbHandler, scan("", "key1", 2))
+        .WillOnce(testing::Return(base::RespOrError<std::list<std::pair<std::string, std::string>>> {page}));
+    EXPECT_CALL(*kvdbManager, getKVDBHandler("test", "test")).WillRepeatedly(testing::Return(kvdbHandler));
+
+    api::HandlerSync cmd;
+    ASSERT_NO_THROW(cmd = managerDump(kvdbManager, "test"));
+    json::Json jsonParams(R"({"name": "test", "records": 2, "cursor": "6b657931"})");
+    const auto response = cmd(api::wpRequest::create(rCommand, rOrigin, jsonParams));
+    const auto expectedData = json::Json(
+        R"({"status":"OK","entries":[{"key":"key2","value":"value2"},{"key":"key3","value":"value3"}],"next_cursor":"6b657933"})");
+
+    ASSERT_TRUE(response.isValid());
+    ASSERT_EQ(response.data(), expectedData);
+}
 
 using DumpWithMultiplePages = DumpTest<std::tuple<std::string, std::string>>;
 
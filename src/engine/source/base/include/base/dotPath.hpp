@@ -2,6 +2,7 @@
 #define _DOT_PATH_HPP
 
 #include <algorithm>
+#include <functional>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -20,6 +21,7 @@ class DotPath
 private:
     std::string m_str;                ///< The string representation of the path
     std::vector<std::string> m_parts; ///< The parts of the path
+    size_t m_hash {0};                ///< Hash of the string representation, compared before the strings
 
     /**
      * @brief Parse the string representation of the path into its parts.
@@ -30,6 +32,7 @@ private:
     {
         m_parts.clear();
         m_parts = base::utils::string::splitEscaped(m_str, '.', '\\');
+        m_hash = m_str.empty() ? 0 : std::hash<std::string> {}(m_str);
 
         for (auto part : m_parts)
         {
@@ -44,12 +47,22 @@ private:
     {
         m_str = rhs.m_str;
         m_parts = rhs.m_parts;
+        m_hash = rhs.m_hash;
     }
 
     void move(DotPath&& rhs) noexcept
     {
+        if (this == &rhs)
+        {
+            return;
+        }
+
         m_str = std::move(rhs.m_str);
         m_parts = std::move(rhs.m_parts);
+        m_hash = rhs.m_hash;
+        rhs.m_str.clear();
+        rhs.m_parts.clear();
+        rhs.m_hash = 0;
     }
 
 public:
@@ -153,7 +166,10 @@ public:
      */
     auto cend() const { return m_parts.cend(); }
 
-    friend bool operator==(const DotPath& lhs, const DotPath& rhs) { return lhs.m_str == rhs.m_str; }
+    friend bool operator==(const DotPath& lhs, const DotPath& rhs)
+    {
+        return lhs.m_hash == rhs.m_hash && lhs.m_str == rhs.m_str;
+    }
     friend bool operator!=(const DotPath& lhs, const DotPath& rhs) { return !(lhs == rhs); }
 
     friend std::ostream& operator<<(std::ostream& os, const DotPath& dp)
@@ -183,6 +199,13 @@ public:
      */
     const std::vector<std::string>& parts() const { return m_parts; }
 
+    /**
+     * @brief Get the hash of the path, computed once when the path is parsed
+     *
+     * @return size_t
+     */
+    size_t hash() const { return m_hash; }
+
     /**
      * @brief Transform pointer path string to dot path string
      *
@@ -234,6 +257,15 @@ public:
     }
 };
 
+namespace std
+{
+template<>
+struct hash<DotPath>
+{
+    size_t operator()(const DotPath& path) const { return path.hash(); }
+};
+} // namespace std
+
 // Make DotPath formatable by fmt
 template<>
 struct fmt::formatter<DotPath> : formatter<std::string>
@@ -3,7 +3,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -25,6 +28,120 @@ namespace json
 constexpr bool RECURSIVE {true};
 constexpr bool NOT_RECURSIVE {false};
 
+/**
+ * @brief Precompiled reference to a field of a Json document.
+ *
+ * Holds the json pointer path already tokenized, the Json accessors that take a FieldRef do not parse the path on
+ * every call. Build it once (e.g. when the helper is built) and reuse it for every event.
+ */
+class FieldRef
+{
+private:
+    std::string m_path;           ///< Json pointer path, empty if the path is borrowed
+    std::string_view m_view;      ///< Json pointer path, m_path or the borrowed one
+    rapidjson::Pointer m_pointer; ///< Tokenized pointer
+
+    struct Borrowed
+    {
+    };
+
+    FieldRef(Borrowed, std::string_view pointerPath)
+        : m_view {pointerPath}
+        , m_pointer {m_view.data(), m_view.size()}
+    {
+    }
+
+    /**
+     * @brief Tokenize a path for a single call, without copying it. The path must outlive the FieldRef.
+     *
+     * Used by the Json accessors that take the path as a string.
+     */
+    static FieldRef borrow(std::string_view pointerPath) { return {Borrowed {}, pointerPath}; }
+
+    friend class Json;
+
+public:
+    /**
+     * @brief Construct a new Field Ref object
+     *
+     * @param pointerPath Json pointer path of the field.
+     * @note An invalid path does not throw here, the accessors throw when they use it.
+     */
+    explicit FieldRef(std::string_view pointerPath = "")
+        : m_path {pointerPath}
+        , m_view {m_path}
+        , m_pointer {m_view.data(), m_view.size()}
+    {
+    }
+
+    // rapidjson::Pointer copies keep a reference to the allocator of the source, tokenize the path again instead
+    FieldRef(const FieldRef& other)
+        : FieldRef(other.m_view)
+    {
+    }
+
+    FieldRef& operator=(const FieldRef& other)
+    {
+        if (this != &other)
+        {
+            m_path = other.m_view;
+            m_view = m_path;
+            m_pointer = rapidjson::Pointer(m_view.data(), m_view.size());
+        }
+        return *this;
+    }
+
+    std::string_view path() const { return m_view; }
+    const rapidjson::Pointer& pointer() const { return m_pointer; }
+    bool isValid() const { return m_pointer.IsValid(); }
+};
+
+/**
+ * @brief Precompiled selection of the fields of a Json document to serialize.
+ *
+ * The fields are merged in a tree of names, Json::str(buffer, projection) walks it along with the document and writes
+ * only the selected fields, without copying the document first.
+ */
+class Projection
+{
+public:
+    enum class Mode
+    {
+        Include, ///< Only the fields and their children are written
+        Exclude  ///< Everything but the fields and their children is written
+    };
+
+private:
+    struct Node
+    {
+        std::string name;
+        bool whole {false}; ///< The field itself was selected, not only some of its children
+        std::vector<Node> children;
+    };
+
+    Mode m_mode;
+    Node m_root;
+
+    bool selects(const rapidjson::Value& value, const Node& node) const;
+    void write(const rapidjson::Value& value,
+               const Node& node,
+               rapidjson::Writer<rapidjson::StringBuffer>& writer) const;
+
+    friend class Json;
+
+public:
+    /**
+     * @brief Construct a new Projection object
+     *
+     * @param mode Whether the fields are included or excluded.
+     * @param pointerPaths Json pointer paths of the fields.
+     * @throw std::runtime_error If a path is invalid or the list is empty.
+     */
+    Projection(Mode mode, const std::vector<std::string>& pointerPaths);
+
+    Mode mode() const { return m_mode; }
+};
+
 class Json
 {
 public:
@@ -100,8 +217,39 @@ public:
         }
     }
 
+    using Allocator = rapidjson::Document::AllocatorType; ///< Allocator of the internal document
+
 private:
-    rapidjson::Document m_document;
+    std::shared_ptr<Allocator> m_allocator; ///< External allocator of the document, nullptr if the document owns it
+    rapidjson::Document m_document;         ///< Must be declared after the allocator, it is destroyed before it
+
+    /**
+     * @brief Native value of a schema typed field, valid while the document is not modified after it was stored.
+     */
+    struct TypedSlot
+    {
+        size_t id;
+        uint64_t version;
+        int64_t value;
+    };
+    mutable std::vector<TypedSlot> m_typedSlots; ///< Side buffer of decoded values, not copied with the document
+    uint64_t m_version {0};                      ///< Incremented on every modification of the document
+    std::vector<std::shared_ptr<const std::string>> m_pinned; ///< Buffers the borrowed strings of the document point to
+
+    /**
+     * @brief Check if a string lies inside one of the pinned buffers.
+     *
+     * @param value The string to check.
+     * @return true if the string can be borrowed instead of copied.
+     */
+    bool isPinned(std::string_view value) const;
+
+    /**
+     * @brief Keep alive the pinned buffers of another Json, its values are about to be copied into this one.
+     *
+     * @param other The Json whose values are copied.
+     */
+    void sharePins(const Json& other);
 
     /**
      * @brief Construct a new Json object form a rapidjason::Value.
@@ -159,6 +307,24 @@ public:
      */
     explicit Json(rapidjson::Document&& document);
 
+    /**
+     * @brief Construct a new Json empty json object that allocates from an external allocator.
+     *
+     * The allocator is kept alive as long as the document, e.g. an arena borrowed from json::ArenaPool.
+     *
+     * @param allocator The allocator to use, if nullptr the document owns its own allocator.
+     */
+    explicit Json(std::shared_ptr<Allocator> allocator);
+
+    /**
+     * @brief Construct a new Json object from a rapidjson Document built with an external allocator.
+     * Moves the document.
+     *
+     * @param document The rapidjson::Document to move, it must allocate from `allocator`.
+     * @param allocator The allocator used by the document.
+     */
+    Json(rapidjson::Document&& document, std::shared_ptr<Allocator> allocator);
+
     /**
      * @brief Construct a new Json object from a json string
      *
@@ -232,6 +398,11 @@ public:
      */
     bool exists(std::string_view pointerPath) const;
 
+    /**
+     * @brief exists() with a precompiled field reference, the path is not parsed again.
+     */
+    bool exists(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json contains a field with the given dot path, and if so, with
      * the given value.
@@ -245,6 +416,11 @@ public:
      */
     bool equals(std::string_view pointerPath, const Json& value) const;
 
+    /**
+     * @brief equals() with a precompiled field reference, the path is not parsed again.
+     */
+    bool equals(const FieldRef& field, const Json& value) const;
+
     /**
      * @brief Check if basePointerPath field's value is equal to referencePointerPath
      * field's value. If basePointerPath or referencePointerPath is not found, returns
@@ -259,6 +435,57 @@ public:
      */
     bool equals(std::string_view basePointerPath, std::string_view referencePointerPath) const;
 
+    /**
+     * @brief equals() with precompiled field references, the paths are not parsed again.
+     */
+    bool equals(const FieldRef& baseField, const FieldRef& referenceField) const;
+
+    /**
+     * @brief Check if the array at the field contains the value, without copying the array.
+     *
+     * @param field The field of the array.
+     * @param value The value to search.
+     * @return std::optional<bool> Empty if the field is not an array.
+     *
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<bool> arrayContains(const FieldRef& field, const Json& value) const;
+
+    /**
+     * @brief Check if the array at the field contains the value of another field, without copying either of them.
+     *
+     * @param field The field of the array.
+     * @param valueField The field of the value to search.
+     * @return std::optional<bool> Empty if the field is not an array or the value field is not found.
+     *
+     * @throws std::runtime_error If any pointer path is invalid.
+     */
+    std::optional<bool> arrayContains(const FieldRef& field, const FieldRef& valueField) const;
+
+    /**
+     * @brief Get the canonical key of a scalar value. Two scalars that compare equal have the same key, so the scalars
+     * can be kept in hash sets. The numbers are keyed by their value, regardless of their representation.
+     *
+     * @param field The field of the value.
+     * @return std::optional<std::string> Empty if the field is not found or it is an array or an object.
+     *
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<std::string> scalarKey(const FieldRef& field) const;
+
+    /**
+     * @brief Visit the canonical keys (see scalarKey) of the scalar elements of the array at the field, without
+     * copying the array. The arrays and objects inside the array are skipped.
+     *
+     * @param field The field of the array.
+     * @param visitor Called with the key of each element, the visit stops when it returns true.
+     * @return std::optional<bool> Empty if the field is not an array, otherwise true if the visitor stopped the visit.
+     *
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<bool> visitArrayKeys(const FieldRef& field,
+                                       const std::function<bool(const std::string&)>& visitor) const;
+
     /**
      * @brief Set the value of the field with the given pointer path.
      * Overwrites previous value.
@@ -270,6 +497,11 @@ public:
      */
     void set(std::string_view pointerPath, const Json& value);
 
+    /**
+     * @brief set() with a precompiled field reference, the path is not parsed again.
+     */
+    void set(const FieldRef& field, const Json& value);
+
     /**
      * @brief Set the value of the base field with the value of the reference field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -282,6 +514,11 @@ public:
      */
     void set(std::string_view basePointerPath, std::string_view referencePointerPath);
 
+    /**
+     * @brief set() with precompiled field references, the paths are not parsed again.
+     */
+    void set(const FieldRef& baseField, const FieldRef& referenceField);
+
     /************************************************************************************/
     // Getters
     /************************************************************************************/
@@ -299,6 +536,22 @@ public:
      */
     std::optional<std::string> getString(std::string_view path = "") const;
 
+    /**
+     * @brief getString() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<std::string> getString(const FieldRef& field) const;
+
+    /**
+     * @brief getString() without copying the string out of the document.
+     *
+     * @param field The field of the string.
+     * @return std::optional<std::string_view> Empty if the field is not found or it is not a string. The view is valid
+     * until the document is modified.
+     *
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<std::string_view> getStringView(const FieldRef& field) const;
+
     /**
      * @brief get the value of the int field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -312,6 +565,11 @@ public:
      */
     std::optional<int> getInt(std::string_view path = "") const;
 
+    /**
+     * @brief getInt() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<int> getInt(const FieldRef& field) const;
+
     /**
      * @brief get the value of the int64 field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -325,6 +583,11 @@ public:
      */
     std::optional<int64_t> getInt64(std::string_view path = "") const;
 
+    /**
+     * @brief getInt64() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<int64_t> getInt64(const FieldRef& field) const;
+
     /**
      * @brief Get the value of the int or int64 field as int64.
      *
@@ -334,6 +597,11 @@ public:
      */
     std::optional<int64_t> getIntAsInt64(std::string_view path = "") const;
 
+    /**
+     * @brief getIntAsInt64() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<int64_t> getIntAsInt64(const FieldRef& field) const;
+
     /**
      * @brief get the value of the float field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -347,6 +615,11 @@ public:
      */
     std::optional<float_t> getFloat(std::string_view path = "") const;
 
+    /**
+     * @brief getFloat() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<float_t> getFloat(const FieldRef& field) const;
+
     /**
      * @brief get the value of the double field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -360,6 +633,11 @@ public:
      */
     std::optional<double_t> getDouble(std::string_view path = "") const;
 
+    /**
+     * @brief getDouble() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<double_t> getDouble(const FieldRef& field) const;
+
     /**
      * @brief get the value of either a double or int field as a double.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -375,6 +653,11 @@ public:
      */
     std::optional<double> getNumberAsDouble(std::string_view path = "") const;
 
+    /**
+     * @brief getNumberAsDouble() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<double> getNumberAsDouble(const FieldRef& field) const;
+
     /**
      * @brief get the value of the bool field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -388,6 +671,11 @@ public:
      */
     std::optional<bool> getBool(std::string_view path = "") const;
 
+    /**
+     * @brief getBool() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<bool> getBool(const FieldRef& field) const;
+
     /**
      * @brief get the value of the array field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -401,6 +689,11 @@ public:
      */
     std::optional<std::vector<Json>> getArray(std::string_view path = "") const;
 
+    /**
+     * @brief getArray() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<std::vector<Json>> getArray(const FieldRef& field) const;
+
     /**
      * @brief get the value of the object field.
      *
@@ -412,6 +705,11 @@ public:
      */
     std::optional<std::vector<std::tuple<std::string, Json>>> getObject(std::string_view path = "") const;
 
+    /**
+     * @brief getObject() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<std::vector<std::tuple<std::string, Json>>> getObject(const FieldRef& field) const;
+
     /**
      * @brief Get Json prettyfied string.
      *
@@ -426,6 +724,26 @@ public:
      */
     std::string str() const;
 
+    /**
+     * @brief Get Json string into a buffer reused by the caller, without the allocations of str().
+     *
+     * Unlike str(), the non-ASCII characters are written as UTF-8 instead of being escaped, so rapidjson scans the
+     * strings with SIMD instructions when the engine is built with ENGINE_JSON_SIMD.
+     *
+     * @param buffer Buffer of the string, its previous content is discarded.
+     * @return std::string_view The Json string, valid until the buffer is modified.
+     */
+    std::string_view str(rapidjson::StringBuffer& buffer) const;
+
+    /**
+     * @brief str(buffer) writing only the fields selected by the projection.
+     *
+     * @param buffer Buffer of the string, its previous content is discarded.
+     * @param projection The fields to write, an object without them is written as {}.
+     * @return std::string_view The Json string, valid until the buffer is modified.
+     */
+    std::string_view str(rapidjson::StringBuffer& buffer, const Projection& projection) const;
+
     /**
      * @brief Get Json string from an object.
      *
@@ -435,6 +753,11 @@ public:
      */
     std::optional<std::string> str(std::string_view path) const;
 
+    /**
+     * @brief str() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<std::string> str(const FieldRef& field) const;
+
     /**
      * @brief Get a copy of the Json object or nothing if the path not found.c++ diagram
      *
@@ -444,6 +767,11 @@ public:
      */
     std::optional<Json> getJson(std::string_view path = "") const;
 
+    /**
+     * @brief getJson() with a precompiled field reference, the path is not parsed again.
+     */
+    std::optional<Json> getJson(const FieldRef& field) const;
+
     friend std::ostream& operator<<(std::ostream& os, const Json& json);
 
     /************************************************************************************/
@@ -460,6 +788,11 @@ public:
      */
     size_t size(std::string_view path = "") const;
 
+    /**
+     * @brief size() with a precompiled field reference, the path is not parsed again.
+     */
+    size_t size(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is Null.
      *
@@ -474,6 +807,11 @@ public:
      */
     bool isNull(std::string_view path = "") const;
 
+    /**
+     * @brief isNull() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isNull(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is Bool.
      *
@@ -488,6 +826,11 @@ public:
      */
     bool isBool(std::string_view path = "") const;
 
+    /**
+     * @brief isBool() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isBool(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is Number.
      *
@@ -502,6 +845,11 @@ public:
      */
     bool isNumber(std::string_view path = "") const;
 
+    /**
+     * @brief isNumber() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isNumber(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is integer.
      *
@@ -516,6 +864,11 @@ public:
      */
     bool isInt(std::string_view path = "") const;
 
+    /**
+     * @brief isInt() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isInt(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is int64.
      *
@@ -530,6 +883,11 @@ public:
      */
     bool isInt64(std::string_view path = "") const;
 
+    /**
+     * @brief isInt64() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isInt64(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is float.
      *
@@ -544,6 +902,11 @@ public:
      */
     bool isFloat(std::string_view path = "") const;
 
+    /**
+     * @brief isFloat() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isFloat(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is double.
      *
@@ -558,6 +921,11 @@ public:
      */
     bool isDouble(std::string_view path = "") const;
 
+    /**
+     * @brief isDouble() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isDouble(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is String.
      *
@@ -572,6 +940,11 @@ public:
      */
     bool isString(std::string_view path = "") const;
 
+    /**
+     * @brief isString() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isString(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is Array.
      *
@@ -586,6 +959,11 @@ public:
      */
     bool isArray(std::string_view path = "") const;
 
+    /**
+     * @brief isArray() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isArray(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is Object.
      *
@@ -600,6 +978,11 @@ public:
      */
     bool isObject(std::string_view path = "") const;
 
+    /**
+     * @brief isObject() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isObject(const FieldRef& field) const;
+
     /**
      * @brief Check if the Json described by the path is empty.
      *
@@ -615,6 +998,11 @@ public:
      */
     bool isEmpty(std::string_view path = "") const;
 
+    /**
+     * @brief isEmpty() with a precompiled field reference, the path is not parsed again.
+     */
+    bool isEmpty(const FieldRef& field) const;
+
     /**
      * @brief Get the type name of the Json.
      *
@@ -622,6 +1010,11 @@ public:
      */
     std::string typeName(std::string_view path = "") const;
 
+    /**
+     * @brief typeName() with a precompiled field reference, the path is not parsed again.
+     */
+    std::string typeName(const FieldRef& field) const;
+
     /**
      * @brief Get Type of the Json.
      *
@@ -634,6 +1027,11 @@ public:
      */
     Type type(std::string_view path = "") const;
 
+    /**
+     * @brief type() with a precompiled field reference, the path is not parsed again.
+     */
+    Type type(const FieldRef& field) const;
+
     /**
      * @brief Validate the Json agains the schema.
      *
@@ -664,6 +1062,11 @@ public:
      */
     void setNull(std::string_view path = "");
 
+    /**
+     * @brief setNull() with a precompiled field reference, the path is not parsed again.
+     */
+    void setNull(const FieldRef& field);
+
     /**
      * @brief Set the Boolean object at the path.
      * Parents objects are created if they do not exist.
@@ -675,6 +1078,11 @@ public:
      */
     void setBool(bool value, std::string_view path = "");
 
+    /**
+     * @brief setBool() with a precompiled field reference, the path is not parsed again.
+     */
+    void setBool(bool value, const FieldRef& field);
+
     /**
      * @brief Set the Integer object at the path.
      * Parents objects are created if they do not exist.
@@ -686,6 +1094,11 @@ public:
      */
     void setInt(int value, std::string_view path = "");
 
+    /**
+     * @brief setInt() with a precompiled field reference, the path is not parsed again.
+     */
+    void setInt(int value, const FieldRef& field);
+
     /**
      * @brief Set the Integer object at the path.
      * Parents objects are created if they do not exist.
@@ -697,6 +1110,11 @@ public:
      */
     void setInt64(int64_t value, std::string_view path = "");
 
+    /**
+     * @brief setInt64() with a precompiled field reference, the path is not parsed again.
+     */
+    void setInt64(int64_t value, const FieldRef& field);
+
     /**
      * @brief Set the Double object at the path.
      * Parents objects are created if they do not exist.
@@ -708,6 +1126,11 @@ public:
      */
     void setDouble(double_t value, std::string_view path = "");
 
+    /**
+     * @brief setDouble() with a precompiled field reference, the path is not parsed again.
+     */
+    void setDouble(double_t value, const FieldRef& field);
+
     /**
      * @brief Set the Double object at the path.
      * Parents objects are created if they do not exist.
@@ -719,10 +1142,17 @@ public:
      */
     void setFloat(float_t value, std::string_view path = "");
 
+    /**
+     * @brief setFloat() with a precompiled field reference, the path is not parsed again.
+     */
+    void setFloat(float_t value, const FieldRef& field);
+
     /**
      * @brief Set the String object at the path.
      * Parents objects are created if they do not exist.
      *
+     * If the value lies inside a buffer pinned with pin(), the document refers to it instead of copying it.
+     *
      * @param value The value to set.
      * @param path The path to the object, default value is root object ("").
      *
@@ -730,6 +1160,22 @@ public:
      */
     void setString(std::string_view value, std::string_view path = "");
 
+    /**
+     * @brief setString() with a precompiled field reference, the path is not parsed again.
+     */
+    void setString(std::string_view value, const FieldRef& field);
+
+    /**
+     * @brief Keep a copy of a string alive as long as the document, or any Json its values are copied to.
+     *
+     * The strings later set from views inside the copy are borrowed instead of copied, e.g. the fields that a
+     * parser extracts from the pinned log. A pinned copy with the same content is reused.
+     *
+     * @param value The string to pin.
+     * @return std::string_view The pinned copy.
+     */
+    std::string_view pin(std::string_view value);
+
     /**
      * @brief Set the Array object at the path.
      * Parents objects are created if they do not exist.
@@ -740,6 +1186,11 @@ public:
      */
     void setArray(std::string_view path = "");
 
+    /**
+     * @brief setArray() with a precompiled field reference, the path is not parsed again.
+     */
+    void setArray(const FieldRef& field);
+
     /**
      * @brief Set the Object object at the path.
      * Parents objects are created if they do not exist.
@@ -750,6 +1201,11 @@ public:
      */
     void setObject(std::string_view path = "");
 
+    /**
+     * @brief setObject() with a precompiled field reference, the path is not parsed again.
+     */
+    void setObject(const FieldRef& field);
+
     /**
      * @brief Append string to the Array object at the path.
      * Parents objects are created if they do not exist.
@@ -762,6 +1218,23 @@ public:
      */
     void appendString(std::string_view value, std::string_view path = "");
 
+    /**
+     * @brief appendString() with a precompiled field reference, the path is not parsed again.
+     */
+    void appendString(std::string_view value, const FieldRef& field);
+
+    /**
+     * @brief Append strings to the Array object at the field, resolving the field once.
+     * Parents objects are created if they do not exist.
+     * If the object is not an Array, it is converted to an Array.
+     *
+     * @param values The strings to append, in order.
+     * @param field The field of the array.
+     *
+     * @throws std::runtime_error If path is invalid.
+     */
+    void appendStrings(const std::vector<std::string_view>& values, const FieldRef& field);
+
     /**
      * @brief Append Json to the Array object at the path.
      *
@@ -772,6 +1245,11 @@ public:
      */
     void appendJson(const Json& value, std::string_view path = "");
 
+    /**
+     * @brief appendJson() with a precompiled field reference, the path is not parsed again.
+     */
+    void appendJson(const Json& value, const FieldRef& field);
+
     /**
      * @brief Erase Json object at the path.
      *
@@ -782,6 +1260,11 @@ public:
      */
     bool erase(std::string_view path = "");
 
+    /**
+     * @brief erase() with a precompiled field reference, the path is not parsed again.
+     */
+    bool erase(const FieldRef& field);
+
     /**
      * @brief Merge the Json Value at the path with the given Json Value.
      *
@@ -803,7 +1286,7 @@ public:
      * path.
      *
      * Merges only first level of the Json Value.
-     * Reference value is deleted after merge.
+     * Reference value is deleted after merge, so its items are moved instead of copied.
      *
      * @param other The Json path pointing to the value to be merged.
      * @param path  The path to the object, default value is root object ("").
@@ -830,6 +1313,34 @@ public:
     bool eraseIfKey(const std::function<bool(const std::string&)>&, bool recursive = false, const std::string& = "");
 
     static Json makeObjectJson(const std::string& key, const json::Json& value);
+
+    /**
+     * @brief Get the id of the typed slot of a field, the same path always gets the same id.
+     *
+     * Typed slots keep the native value of a field (integer, IPv4 address, timestamp) decoded from the document, so
+     * helpers reading the same field on the same event do not look it up and convert it again. Only use them for
+     * fields whose type is known by the schema.
+     *
+     * @param pointerPath Json pointer path of the field
+     * @return size_t Slot id
+     */
+    static size_t typedSlotId(std::string_view pointerPath);
+
+    /**
+     * @brief Get the value stored in a typed slot.
+     *
+     * @param id Slot id
+     * @return std::optional<int64_t> The value, or empty if it was not stored or the document changed since then
+     */
+    std::optional<int64_t> getTypedSlot(size_t id) const;
+
+    /**
+     * @brief Store the native value of a field in a typed slot, until the document is modified.
+     *
+     * @param id Slot id
+     * @param value Native value decoded from the field
+     */
+    void setTypedSlot(size_t id, int64_t value) const;
 };
 
 } // namespace json
@@ -0,0 +1,261 @@
+#ifndef _JSON_ARENA_HPP
+#define _JSON_ARENA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <base/json.hpp>
+
+namespace json
+{
+
+/**
+ * @brief Pool of reusable memory arenas for json::Json documents
+ *
+ * Each arena is a fixed buffer used as the first chunk of a rapidjson MemoryPoolAllocator. Documents built on an
+ * arena allocate from the buffer without calling malloc, and the whole arena is reset at once when it is reused
+ * instead of being freed piece by piece.
+ *
+ * The pool is split in shards, each with its own list of free arenas. A thread uses the shard of its index, given
+ * process wide in the order the threads first use any pool, so the threads that build documents at once (the router
+ * workers parsing the raw events) work on their own shards without contention. When all the documents are built on
+ * one thread, e.g. the endpoint thread, only one shard is used and a single shard is enough. An arena goes back to
+ * the free list of its shard once every document that uses it is destroyed, no matter which thread destroys it.
+ *
+ * @note When the shard of the thread has no free arena and is full, the free arenas of the other shards are used.
+ * acquire() only returns nullptr when there is no free arena in any shard, then the document falls back to its own
+ * allocator.
+ */
+class ArenaPool
+{
+private:
+    static constexpr std::size_t BLOCK_SIZE = 128; ///< Storage for the control block of the pointer to an arena
+
+    /**
+     * @brief Arena, a buffer and the allocator that uses it as the first chunk
+     */
+    class Arena
+    {
+    private:
+        std::unique_ptr<char[]> m_buffer; ///< Memory of the first chunk
+        Json::Allocator m_allocator;      ///< Allocator, it falls back to malloc when the buffer is exhausted
+        alignas(std::max_align_t) unsigned char m_block[BLOCK_SIZE]; ///< Control block of the pointer given out
+
+    public:
+        explicit Arena(std::size_t size)
+            : m_buffer(new char[size])
+            , m_allocator(m_buffer.get(), size)
+        {
+        }
+
+        Json::Allocator& allocator() { return m_allocator; }
+
+        void* block() { return m_block; }
+    };
+
+    struct Shard
+    {
+        std::mutex m_mutex;                           ///< Protects the arenas of the shard
+        std::vector<std::unique_ptr<Arena>> m_arenas; ///< Arenas, they live as long as the shard
+        std::vector<Arena*> m_free;                   ///< Arenas not used by any document, the last released on top
+
+        void release(Arena* arena)
+        {
+            std::lock_guard<std::mutex> lock {m_mutex};
+            m_free.push_back(arena);
+        }
+    };
+
+    /**
+     * @brief Allocator of the control block of the pointer to an arena
+     *
+     * The control block is built in the arena, so giving out an arena does not allocate. Its release is the last
+     * step of the release of the pointer, so the arena goes back to the free list there. The allocator keeps the shard
+     * alive, the documents may outlive the pool.
+     */
+    template<typename T>
+    struct BlockAllocator
+    {
+        using value_type = T;
+
+        std::shared_ptr<Shard> m_shard; ///< Shard of the arena
+        Arena* m_arena;                 ///< Arena of the control block
+
+        BlockAllocator(std::shared_ptr<Shard> shard, Arena* arena)
+            : m_shard(std::move(shard))
+            , m_arena(arena)
+        {
+        }
+
+        template<typename U>
+        BlockAllocator(const BlockAllocator<U>& other)
+            : m_shard(other.m_shard)
+            , m_arena(other.m_arena)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            if (sizeof(T) * n > BLOCK_SIZE || alignof(T) > alignof(std::max_align_t))
+            {
+                return static_cast<T*>(::operator new(sizeof(T) * n));
+            }
+            return static_cast<T*>(m_arena->block());
+        }
+
+        void deallocate(T* block, std::size_t) noexcept
+        {
+            if (static_cast<void*>(block) != m_arena->block())
+            {
+                ::operator delete(block);
+            }
+            m_shard->release(m_arena);
+        }
+
+        template<typename U>
+        bool operator==(const BlockAllocator<U>& other) const
+        {
+            return m_arena == other.m_arena;
+        }
+
+        template<typename U>
+        bool operator!=(const BlockAllocator<U>& other) const
+        {
+            return m_arena != other.m_arena;
+        }
+    };
+
+    std::size_t m_arenaSize;                      ///< Size of the buffer of each arena
+    std::size_t m_maxArenas;                      ///< Max arenas per shard
+    std::vector<std::shared_ptr<Shard>> m_shards; ///< Shards of the pool
+
+    /**
+     * @brief Index of the calling thread, process wide, given in the order the threads first use any pool
+     */
+    static std::size_t threadIndex()
+    {
+        static std::atomic_size_t next {0};
+        thread_local const auto index = next.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    /**
+     * @brief Take a free arena of the shard, the shard lock must be held
+     *
+     * @param shard The shard
+     * @param grow Create a new arena if there are no free ones and the shard is not full
+     * @return Arena* The arena, nullptr if there are no free arenas.
+     */
+    Arena* acquireFrom(Shard& shard, bool grow)
+    {
+        if (!shard.m_free.empty())
+        {
+            auto* arena = shard.m_free.back();
+            shard.m_free.pop_back();
+            return arena;
+        }
+
+        if (grow && shard.m_arenas.size() < m_maxArenas)
+        {
+            return shard.m_arenas.emplace_back(std::make_unique<Arena>(m_arenaSize)).get();
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Give out an arena of the shard, it goes back to the shard when the last reference is released
+     */
+    static std::shared_ptr<Json::Allocator> share(const std::shared_ptr<Shard>& shard, Arena* arena)
+    {
+        // The document is gone when the deleter runs, the allocations are discarded before the next use
+        return {&arena->allocator(),
+                [](Json::Allocator* allocator) { allocator->Clear(); },
+                BlockAllocator<Json::Allocator> {shard, arena}};
+    }
+
+public:
+    static constexpr std::size_t MIN_ARENA_SIZE = 1024; ///< Smaller arenas are not worth it
+
+    /**
+     * @brief Construct a new Arena Pool
+     *
+     * @param arenaSize Size in bytes of each arena buffer
+     * @param maxArenas Max number of arenas per shard
+     * @param shards Number of shards, by default one per hardware thread
+     * @throw std::runtime_error if the arguments are invalid
+     */
+    ArenaPool(std::size_t arenaSize, std::size_t maxArenas, std::size_t shards = std::thread::hardware_concurrency())
+        : m_arenaSize(arenaSize)
+        , m_maxArenas(maxArenas)
+    {
+        if (m_arenaSize < MIN_ARENA_SIZE)
+        {
+            throw std::runtime_error("The arena size must be at least 1024 bytes");
+        }
+
+        if (m_maxArenas == 0)
+        {
+            throw std::runtime_error("The maximum number of arenas must be greater than 0");
+        }
+
+        shards = shards == 0 ? 1 : shards;
+        for (std::size_t i = 0; i < shards; ++i)
+        {
+            m_shards.emplace_back(std::make_shared<Shard>());
+        }
+    }
+
+    /**
+     * @brief Get a free arena allocator for a new document
+     *
+     * @return std::shared_ptr<Json::Allocator> The allocator, nullptr if there are no free arenas.
+     */
+    std::shared_ptr<Json::Allocator> acquire()
+    {
+        const auto own = threadIndex() % m_shards.size();
+        {
+            const auto& shard = m_shards[own];
+            std::unique_lock<std::mutex> lock {shard->m_mutex};
+            if (auto* arena = acquireFrom(*shard, true))
+            {
+                lock.unlock();
+                return share(shard, arena);
+            }
+        }
+
+        // Borrow a free arena of the other shards, skipping the ones locked by their own thread
+        for (std::size_t i = 1; i < m_shards.size(); ++i)
+        {
+            const auto& shard = m_shards[(own + i) % m_shards.size()];
+            std::unique_lock<std::mutex> lock {shard->m_mutex, std::try_to_lock};
+            if (!lock.owns_lock())
+            {
+                continue;
+            }
+            if (auto* arena = acquireFrom(*shard, false))
+            {
+                lock.unlock();
+                return share(shard, arena);
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Build a new empty document on a free arena, or on its own allocator if there is none
+     *
+     * @return std::shared_ptr<Json> The new document
+     */
+    std::shared_ptr<Json> makeJson() { return std::make_shared<Json>(acquire()); }
+};
+
+} // namespace json
+
+#endif // _JSON_ARENA_HPP
@@ -1,6 +1,8 @@
 #ifndef _H_LOGGING
 #define _H_LOGGING
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <map>
 
@@ -56,6 +58,12 @@ constexpr auto DEFAULT_LOG_THREADS {0};
  */
 constexpr auto DEFAULT_LOG_THREADS_QUEUE_SIZE {8192};
 
+/**
+ * @brief Default overflow policy of the log threads' queue.
+ * false means the callers wait for room in the queue, true means the oldest queued messages are dropped.
+ */
+constexpr auto DEFAULT_LOG_DROP_ON_OVERFLOW {false};
+
 /**
  * @brief Default flush interval for logs.
  * Value in milliseconds.
@@ -164,11 +172,61 @@ struct LoggingConfig
     std::string filePath {STD_OUT_PATH};                       ///< Path to the log file.
     Level level {Level::Info};                                 ///< Log level.
     const uint32_t flushInterval {DEFAULT_LOG_FLUSH_INTERVAL}; ///< Flush interval in milliseconds.
-    const uint32_t dedicatedThreads {DEFAULT_LOG_THREADS};     ///< Number of dedicated threads.
-    const uint32_t queueSize {DEFAULT_LOG_THREADS_QUEUE_SIZE}; ///< Size of the log queue for dedicated threads.
+    uint32_t dedicatedThreads {DEFAULT_LOG_THREADS};           ///< Number of dedicated threads, 0 to log synchronously.
+    uint32_t queueSize {DEFAULT_LOG_THREADS_QUEUE_SIZE};       ///< Size of the log queue for dedicated threads.
+    bool dropOnOverflow {DEFAULT_LOG_DROP_ON_OVERFLOW};        ///< Drop the oldest queued messages when it is full.
     bool truncate {false}; ///< If true, the log file will be deleted for each start of the engine.
 };
 
+/**
+ * @brief Limits the messages logged from a call site to a number per second.
+ *
+ * Used by the LOG_*_RL macros, each call site has its own limiter. The messages over the limit are not formatted, they
+ * are counted and the count is reported with the next message that is logged.
+ */
+class RateLimiter
+{
+private:
+    const uint32_t m_maxPerSecond;         ///< Messages allowed per second
+    std::atomic<int64_t> m_second {-1};    ///< Second of the current window
+    std::atomic<uint32_t> m_count {0};     ///< Messages in the current window
+    std::atomic<uint64_t> m_suppressed {0}; ///< Messages suppressed since the last one logged
+
+public:
+    explicit RateLimiter(uint32_t maxPerSecond)
+        : m_maxPerSecond {maxPerSecond}
+    {
+    }
+
+    /**
+     * @brief Check if a message can be logged now.
+     *
+     * @param suppressed Set to the number of messages suppressed since the last one logged, if allowed.
+     * @return true if the message is under the limit.
+     */
+    bool allow(uint64_t& suppressed)
+    {
+        const auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count();
+
+        auto second = m_second.load(std::memory_order_relaxed);
+        if (second != now && m_second.compare_exchange_strong(second, now, std::memory_order_relaxed))
+        {
+            m_count.store(0, std::memory_order_relaxed);
+        }
+
+        if (m_count.fetch_add(1, std::memory_order_relaxed) < m_maxPerSecond)
+        {
+            suppressed = m_suppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        m_suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+};
+
 /**
  * @brief Retrieves the default logger.
  * @return Shared pointer to the default logger.
@@ -199,23 +257,45 @@ void testInit();
 
 } // namespace logging
 
-#define LOG_TRACE(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::trace, msg, ##__VA_ARGS__)
-#define LOG_DEBUG(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::debug, msg, ##__VA_ARGS__)
-#define LOG_INFO(msg, ...)                                                                                             \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::info, msg, ##__VA_ARGS__)
-#define LOG_WARNING(msg, ...)                                                                                          \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::warn, msg, ##__VA_ARGS__)
-#define LOG_ERROR(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::err, msg, ##__VA_ARGS__)
-#define LOG_CRITICAL(msg, ...)                                                                                         \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::critical, msg, ##__VA_ARGS__)
+// The arguments are only evaluated, and the message formatted, if the level is enabled
+#define LOG_AT_LEVEL(level, msg, ...)                                                                                  \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        auto _logger = logging::getDefaultLogger();                                                                    \
+        if (_logger->should_log(level))                                                                                \
+        {                                                                                                              \
+            _logger->log(spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, level, msg, ##__VA_ARGS__);         \
+        }                                                                                                              \
+    } while (0)
+
+// Logs at most maxPerSecond messages per second from the call site, the rest are counted and reported later
+#define LOG_AT_LEVEL_RL(level, maxPerSecond, msg, ...)                                                                 \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static logging::RateLimiter _rateLimiter {maxPerSecond};                                                       \
+        auto _logger = logging::getDefaultLogger();                                                                    \
+        uint64_t _suppressed = 0;                                                                                      \
+        if (_logger->should_log(level) && _rateLimiter.allow(_suppressed))                                             \
+        {                                                                                                              \
+            const spdlog::source_loc _loc {__FILE__, __LINE__, SPDLOG_FUNCTION};                                       \
+            if (_suppressed > 0)                                                                                       \
+            {                                                                                                          \
+                _logger->log(_loc, level, "{} similar messages were suppressed", _suppressed);                        \
+            }                                                                                                          \
+            _logger->log(_loc, level, msg, ##__VA_ARGS__);                                                             \
+        }                                                                                                              \
+    } while (0)
+
+#define LOG_TRACE(msg, ...)    LOG_AT_LEVEL(spdlog::level::trace, msg, ##__VA_ARGS__)
+#define LOG_DEBUG(msg, ...)    LOG_AT_LEVEL(spdlog::level::debug, msg, ##__VA_ARGS__)
+#define LOG_INFO(msg, ...)     LOG_AT_LEVEL(spdlog::level::info, msg, ##__VA_ARGS__)
+#define LOG_WARNING(msg, ...)  LOG_AT_LEVEL(spdlog::level::warn, msg, ##__VA_ARGS__)
+#define LOG_ERROR(msg, ...)    LOG_AT_LEVEL(spdlog::level::err, msg, ##__VA_ARGS__)
+#define LOG_CRITICAL(msg, ...) LOG_AT_LEVEL(spdlog::level::critical, msg, ##__VA_ARGS__)
+
+#define LOG_DEBUG_RL(maxPerSecond, msg, ...)   LOG_AT_LEVEL_RL(spdlog::level::debug, maxPerSecond, msg, ##__VA_ARGS__)
+#define LOG_INFO_RL(maxPerSecond, msg, ...)    LOG_AT_LEVEL_RL(spdlog::level::info, maxPerSecond, msg, ##__VA_ARGS__)
+#define LOG_WARNING_RL(maxPerSecond, msg, ...) LOG_AT_LEVEL_RL(spdlog::level::warn, maxPerSecond, msg, ##__VA_ARGS__)
+#define LOG_ERROR_RL(maxPerSecond, msg, ...)   LOG_AT_LEVEL_RL(spdlog::level::err, maxPerSecond, msg, ##__VA_ARGS__)
 
 #endif // _H_LOGGING
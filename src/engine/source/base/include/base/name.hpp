@@ -3,7 +3,7 @@
 
 #include <initializer_list>
 #include <iostream>
-#include <numeric>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -36,6 +36,28 @@ public:
 
 private:
     std::vector<std::string> m_parts;
+    std::string m_str; ///< Full name, cached as names are mostly used as map keys and store paths
+    size_t m_hash {0}; ///< Hash of the parts, compared before the parts to reject different names
+
+    /**
+     * @brief Compute the cached full name and hash from the parts, must be called whenever the parts change.
+     */
+    void cache()
+    {
+        m_str.clear();
+        m_hash = 0;
+        std::hash<std::string> hasher;
+        for (const auto& part : m_parts)
+        {
+            if (!m_str.empty())
+            {
+                m_str += SEPARATOR_C;
+            }
+            m_str += part;
+            // Order dependent combination, the parts of a/b and b/a must not cancel out
+            m_hash ^= hasher(part) + 0x9e3779b97f4a7c15ULL + (m_hash << 6) + (m_hash >> 2);
+        }
+    }
 
     void assertSize(size_t size) const
     {
@@ -57,8 +79,27 @@ private:
         }
     }
 
-    void copy(const Name& other) { m_parts = other.m_parts; }
-    void copyMove(Name&& other) noexcept { m_parts = std::move(other.m_parts); }
+    void copy(const Name& other)
+    {
+        m_parts = other.m_parts;
+        m_str = other.m_str;
+        m_hash = other.m_hash;
+    }
+
+    void copyMove(Name&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        m_parts = std::move(other.m_parts);
+        m_str = std::move(other.m_str);
+        m_hash = other.m_hash;
+        other.m_parts.clear();
+        other.m_str.clear();
+        other.m_hash = 0;
+    }
 
 public:
     Name() = default;
@@ -74,6 +115,7 @@ public:
     {
         assertSize(parts.size());
         m_parts = parts;
+        cache();
     }
 
     /**
@@ -86,6 +128,7 @@ public:
     {
         m_parts = std::move(parts);
         assertSize(m_parts.size());
+        cache();
     }
 
     /**
@@ -98,6 +141,7 @@ public:
     {
         m_parts = base::utils::string::split(fullName, SEPARATOR_C);
         assertSize(m_parts.size());
+        cache();
     }
 
     /**
@@ -162,7 +206,10 @@ public:
      * @return true
      * @return false
      */
-    friend bool operator==(const Name& rh, const Name& lh) { return rh.m_parts == lh.m_parts; }
+    friend bool operator==(const Name& rh, const Name& lh)
+    {
+        return rh.m_hash == lh.m_hash && rh.m_parts == lh.m_parts;
+    }
 
     /**
      * @brief Inequality comparison operator
@@ -174,18 +221,11 @@ public:
     friend bool operator!=(const Name& rh, const Name& lh) { return !(rh == lh); }
 
     /**
-     * @brief Implicit conversion to std::string
+     * @brief Get the full name string
      *
-     * @return std::string
+     * @return const std::string& Full name string in the form <part>SEPARATOR<part>...
      */
-    std::string toStr() const
-    {
-        return std::accumulate(m_parts.cbegin() + 1,
-                               m_parts.cend(),
-                               m_parts.front(),
-                               [](const std::string& a, const std::string& b) -> std::string
-                               { return a + SEPARATOR_S + b; });
-    }
+    const std::string& toStr() const { return m_str; }
 
     /**
      * @brief Implicit conversion to std::string
@@ -244,7 +284,7 @@ public:
      * @return std::string Full name string in the form
      * <type>SEPARATOR<name>SEPARATOR<version>
      */
-    std::string fullName() const { return toStr(); } // TODO deprecated, remove
+    const std::string& fullName() const { return toStr(); } // TODO deprecated, remove
 
     /**
      * @brief Get the parts of the name
@@ -252,26 +292,24 @@ public:
      * @return const std::vector<std::string>&
      */
     const std::vector<std::string>& parts() const { return m_parts; }
+
+    /**
+     * @brief Get the hash of the name, computed once when the name is built
+     *
+     * @return size_t
+     */
+    size_t hash() const { return m_hash; }
 };
 
 } // namespace base
 
-/* lazy std::hash specialization for base::Name */
+/* std::hash specialization for base::Name, the hash is cached by the name */
 namespace std
 {
 template<>
 struct hash<base::Name>
 {
-    size_t operator()(const base::Name& name) const
-    {
-        std::hash<std::string> hasher;
-        size_t hashValue = 0;
-        for (const auto& part : name.parts())
-        {
-            hashValue ^= hasher(part);
-        }
-        return hashValue;
-    }
+    size_t operator()(const base::Name& name) const { return name.hash(); }
 };
 } // namespace std
 
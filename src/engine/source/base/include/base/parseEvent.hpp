@@ -3,6 +3,7 @@
 #define _PARSE_EVENT_H
 
 #include <string>
+#include <string_view>
 
 #include <base/baseTypes.hpp>
 
@@ -15,10 +16,15 @@ constexpr char EVENT_MESSAGE_ID[] {"/event/original"};
 /**
  * @brief Parse an Wazuh message and extract the queue, location and message
  *
+ * The message is scanned once and the location and message are copied straight into the event document.
+ *
  * @param event Wazuh message
+ * @param allocator (Optional) Allocator of the event document, e.g. an arena of json::ArenaPool. If nullptr the
+ * document uses its own allocator.
  * @return Event Event object
+ * @throw std::runtime_error if the message format is invalid
  */
-Event parseWazuhEvent(const std::string& event);
+Event parseWazuhEvent(std::string_view event, const std::shared_ptr<json::Json::Allocator>& allocator = nullptr);
 
 } // namespace base::parseEvent
 
@@ -29,8 +29,8 @@ public:
      * @param success Status of the event.
      */
     Result(Event payload, std::string trace, bool success)
-        : m_payload {payload}
-        , m_trace {trace}
+        : m_payload {std::move(payload)}
+        , m_trace {std::move(trace)}
         , m_success {success}
     {
     }
@@ -54,7 +54,7 @@ public:
      */
     Result(Result&& other)
         : m_payload {std::move(other.m_payload)}
-        , m_trace {other.m_trace}
+        , m_trace {std::move(other.m_trace)}
         , m_success {other.m_success}
     {
     }
@@ -87,7 +87,7 @@ public:
     Result& operator=(Result&& other)
     {
         m_payload = std::move(other.m_payload);
-        m_trace = other.m_trace;
+        m_trace = std::move(other.m_trace);
         m_success = other.m_success;
         return *this;
     }
@@ -126,16 +126,16 @@ public:
     /**
      * @brief Returns the event trace.
      *
-     * @return std::string the event trace.
+     * @return const std::string& the event trace.
      */
-    std::string trace() const { return m_trace; }
+    const std::string& trace() const { return m_trace; }
 
     /**
-     * @brief Returns the event trace.
+     * @brief Moves out the event trace.
      *
      * @return std::string the event trace.
      */
-    std::string popTrace() const { return std::move(m_trace); }
+    std::string popTrace() { return std::move(m_trace); }
 
     /**
      * @brief Get the payload object.
@@ -156,7 +156,7 @@ public:
      *
      * @param trace the trace object.
      */
-    void setTrace(std::string trace) { m_trace = trace; }
+    void setTrace(std::string trace) { m_trace = std::move(trace); }
 
     /**
      * @brief Set the payload object.
@@ -166,36 +166,73 @@ public:
     void setPayload(Event&& payload) { m_payload = std::move(payload); }
 };
 
+/**
+ * @brief Whether the results made by the current thread keep their traces.
+ *
+ * Disabled by default, so the events processed in production don't copy the trace of every operation. Enabled with
+ * a TracingScope by the threads that collect the traces.
+ *
+ * @return bool& The flag of the current thread.
+ */
+inline bool& tracing()
+{
+    static thread_local bool enabled = false;
+    return enabled;
+}
+
+/**
+ * @brief Enables the traces of the results made by the current thread during its lifetime.
+ *
+ */
+class TracingScope
+{
+private:
+    bool m_previous;
+
+public:
+    explicit TracingScope(bool enable = true)
+        : m_previous {tracing()}
+    {
+        tracing() = enable;
+    }
+
+    ~TracingScope() { tracing() = m_previous; }
+
+    TracingScope(const TracingScope&) = delete;
+    TracingScope& operator=(const TracingScope&) = delete;
+};
+
 /**
  * @brief Returns the result of the event with all the information that it has been
  * success.
- * Incorporates the trace and sets m_success to true
+ * Incorporates the trace, if tracing is enabled in the current thread, and sets m_success to true
  *
  * @tparam Event
  * @param payload event message
  * @param trace trace to be filled
  * @return Result<Event> Result of the event with all the complete information.
  */
-template<typename Event>
-Result<Event> makeSuccess(Event payload, std::string trace = "")
+template<typename Event, typename Trace = const char*>
+Result<Event> makeSuccess(Event payload, Trace&& trace = "")
 {
-    return Result<Event> {payload, trace, true};
+    return Result<Event> {std::move(payload), tracing() ? std::string(std::forward<Trace>(trace)) : std::string {}, true};
 }
 
 /**
  * @brief Returns the result of the event with all the information that it has been
  * failure.
- * Incorporates the trace and sets m_success to false
+ * Incorporates the trace, if tracing is enabled in the current thread, and sets m_success to false
  *
  * @tparam Event
  * @param payload event message
  * @param trace trace to be filled
  * @return Result<Event> Result of the event with all the complete information.
  */
-template<typename Event>
-Result<Event> makeFailure(Event payload, std::string trace = "")
+template<typename Event, typename Trace = const char*>
+Result<Event> makeFailure(Event payload, Trace&& trace = "")
 {
-    return Result<Event> {payload, trace, false};
+    return Result<Event> {
+        std::move(payload), tracing() ? std::string(std::forward<Trace>(trace)) : std::string {}, false};
 }
 
 } // namespace base::result
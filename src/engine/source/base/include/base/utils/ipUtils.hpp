@@ -1,7 +1,11 @@
 #ifndef _IP_UTILS_H
 #define _IP_UTILS_H
 
+#include <array>
+#include <cstdint>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace utils::ip
 {
@@ -74,6 +78,59 @@ bool isSpecialIPv4Address(const std::string& ip);
  */
 bool isSpecialIPv6Address(const std::string& ip);
 
+/**
+ * @brief Set of IPv4 and IPv6 networks compiled into a binary radix tree per family.
+ *
+ * Checking an address walks at most one node per bit of its longest matching prefix, so the cost does not depend on the
+ * number of networks in the set. Networks covered by another network of the set are not stored.
+ */
+class CIDRSet
+{
+private:
+    struct Node
+    {
+        std::array<uint32_t, 2> children {0, 0}; ///< Index of the children, 0 if none (the root is never a child)
+        bool terminal {false};                   ///< A network of the set ends in this node
+    };
+
+    std::vector<Node> m_ipv4; ///< Radix tree of the IPv4 networks, the root is the first node
+    std::vector<Node> m_ipv6; ///< Radix tree of the IPv6 networks, the root is the first node
+    std::size_t m_size;       ///< Number of networks added
+
+    static void insert(std::vector<Node>& tree, const uint8_t* address, std::size_t prefixLength);
+    static bool lookup(const std::vector<Node>& tree, const uint8_t* address, std::size_t bits);
+
+public:
+    CIDRSet();
+
+    /**
+     * @brief Add a network to the set
+     *
+     * @param cidr Network as address/prefix length (IPv4 or IPv6), address/dotted mask (IPv4) or a single address
+     * @throws std::invalid_argument if the network is not valid
+     */
+    void add(const std::string& cidr);
+
+    /**
+     * @brief Check if an address belongs to a network of the set
+     *
+     * @param ip IPv4 or IPv6 address
+     * @return true if a network of the set contains the address
+     * @throws std::invalid_argument if the address is not valid
+     */
+    bool contains(const std::string& ip) const;
+
+    /**
+     * @brief Check if an IPv4 address, as returned by IPv4ToUInt, belongs to a network of the set
+     */
+    bool contains(uint32_t ipv4) const;
+
+    /**
+     * @brief Number of networks added to the set
+     */
+    std::size_t size() const { return m_size; }
+};
+
 } // namespace utils::ip
 
 #endif // _IP_UTILS_H
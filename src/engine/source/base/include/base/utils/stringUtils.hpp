@@ -17,6 +17,15 @@ namespace base::utils::string
  */
 std::vector<std::string> split(std::string_view str, const char delimiter);
 
+/**
+ * @brief Split a string into views of it, as split() does but without copying the parts
+ *
+ * @param str String to be split, must outlive the views
+ * @param delimiter Delimiter to split the string
+ * @return std::vector<std::string_view>
+ */
+std::vector<std::string_view> splitView(std::string_view str, const char delimiter);
+
 /**
  * @brief Concatenates all the strings of a vector, separated by `separator`.
  *
@@ -126,6 +135,49 @@ unescapeString(std::string_view str, char escapeChar, const char escapedChar, co
     return unescapeString(str, escapeChar, std::string(1, escapedChar), strictMode);
 }
 
+/**
+ * @brief Convert the ASCII lowercase letters of a string to uppercase, in place. The other bytes are not changed.
+ *
+ * Eight bytes are folded at a time with word arithmetic, the helpers run it on almost every event.
+ *
+ * @param str String to convert.
+ */
+void toUpperAscii(std::string& str);
+
+/**
+ * @brief Convert the ASCII uppercase letters of a string to lowercase, in place. The other bytes are not changed.
+ *
+ * @param str String to convert.
+ */
+void toLowerAscii(std::string& str);
+
+/**
+ * @brief Replace all the non overlapping occurrences of a substring, in a single pass over the input.
+ *
+ * @param str Input string.
+ * @param from Substring to replace, must not be empty.
+ * @param to Replacement.
+ * @return std::string The string with the replacements.
+ */
+std::string replaceAll(std::string_view str, std::string_view from, std::string_view to);
+
+/**
+ * @brief Decode a string of hexadecimal digits, two digits per byte, either case.
+ *
+ * @param hex Hexadecimal digits.
+ * @param out Decoded bytes, replaces its content. Undefined if the decoding fails.
+ * @return true if the string was decoded.
+ * @return false if the number of digits is odd or there is a character that is not an hexadecimal digit.
+ */
+bool decodeHex(std::string_view hex, std::string& out);
+
+/**
+ * @brief Encode bytes as lowercase hexadecimal digits, two digits per byte.
+ *
+ * @param data Bytes to encode.
+ * @return std::string The hexadecimal digits.
+ */
+std::string encodeHex(std::string_view data);
 
 // TODO Add scape string with char. Implement on test handler location.
 
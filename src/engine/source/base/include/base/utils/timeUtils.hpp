@@ -0,0 +1,43 @@
+#ifndef _TIME_UTILS_H
+#define _TIME_UTILS_H
+
+#include <cstdint>
+#include <string>
+
+namespace base::utils::time
+{
+
+/**
+ * @brief Seconds since epoch of the system clock.
+ *
+ * Reads the coarse realtime clock where available, it is updated once per scheduler tick and is much cheaper to read
+ * than the precise one, which does not matter at seconds resolution.
+ *
+ * @return std::int64_t Seconds since epoch
+ */
+std::int64_t epochSeconds();
+
+/**
+ * @brief Format seconds since epoch as an ISO 8601 UTC date, YYYY-MM-DDTHH:MM:SSZ.
+ *
+ * The digits are written directly, the calendar date and the last formatted second are cached per thread, as the
+ * events close in time share them.
+ *
+ * @param seconds Seconds since epoch
+ * @param out Set to the formatted date
+ * @return true if the date was formatted, false if the year is not between 0 and 9999
+ */
+bool formatSeconds(std::int64_t seconds, std::string& out);
+
+/**
+ * @brief Format milliseconds since epoch as an ISO 8601 UTC date, YYYY-MM-DDTHH:MM:SS.sssZ.
+ *
+ * @param millis Milliseconds since epoch
+ * @param out Set to the formatted date
+ * @return true if the date was formatted, false if the year is not between 0 and 9999
+ */
+bool formatMillis(std::int64_t millis, std::string& out);
+
+} // namespace base::utils::time
+
+#endif // _TIME_UTILS_H
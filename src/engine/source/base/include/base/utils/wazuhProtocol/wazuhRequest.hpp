@@ -96,6 +96,16 @@ public:
         return isValid() ? m_jrequest.getJson("/parameters") : std::nullopt;
     }
 
+    /**
+     * @brief Get the parameters of the request serialized, without copying them to a new json
+     *
+     * @return std::optional<std::string> The parameters or nothing if the request is invalid or has none
+     */
+    std::optional<std::string> getParametersStr() const
+    {
+        return isValid() ? m_jrequest.str("/parameters") : std::nullopt;
+    }
+
     /**
      * @brief Check if the request is valid
      *
@@ -59,7 +59,7 @@ public:
      * from a module use the other one with a error code of 0
      */
     explicit WazuhResponse(json::Json&& data, int error = 0, std::string_view message = "") noexcept
-        : m_data(data)
+        : m_data(std::move(data))
         , m_error(error)
     {
         m_message = message.empty() ? std::nullopt : std::optional<std::string> {message};
@@ -1,6 +1,11 @@
 #include <base/json.hpp>
 
+#include <algorithm>
 #include <exception>
+#include <functional>
+#include <type_traits>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "rapidjson/schema.h"
@@ -12,11 +17,231 @@ namespace
 {
 constexpr auto INVALID_POINTER_TYPE_MSG = "Invalid pointer path '{}'";
 constexpr auto PATH_NOT_FOUND_MSG = "Path '{}' not found";
+
+/**
+ * @brief Canonical key of a scalar value, see Json::scalarKey. rapidjson compares the numbers by their double value
+ * when one of them is a double, so the integral doubles share the key of the integers.
+ */
+bool scalarKeyOf(const rapidjson::Value& value, std::string& key)
+{
+    switch (value.GetType())
+    {
+        case rapidjson::kNullType: key = "n"; return true;
+        case rapidjson::kFalseType: key = "f"; return true;
+        case rapidjson::kTrueType: key = "t"; return true;
+        case rapidjson::kStringType:
+            key.assign(1, 's');
+            key.append(value.GetString(), value.GetStringLength());
+            return true;
+        case rapidjson::kNumberType:
+            if (value.IsDouble())
+            {
+                const auto number = value.GetDouble();
+                if (std::trunc(number) == number && number >= -9.2e18 && number <= 9.2e18)
+                {
+                    key = "i" + std::to_string(static_cast<int64_t>(number));
+                }
+                else
+                {
+                    key = fmt::format("d{}", number);
+                }
+            }
+            else if (value.IsInt64())
+            {
+                key = "i" + std::to_string(value.GetInt64());
+            }
+            else
+            {
+                key = "i" + std::to_string(value.GetUint64());
+            }
+            return true;
+        default: return false;
+    }
+}
+
+/**
+ * @brief Throw if two values cannot be merged, they must be both objects or both arrays.
+ */
+void checkMergeable(const rapidjson::Value& dst, const rapidjson::Value& source)
+{
+    if (dst.GetType() != source.GetType())
+    {
+        throw std::runtime_error("JSON objects of different types cannot be merged");
+    }
+    if (!dst.IsObject() && !dst.IsArray())
+    {
+        throw std::runtime_error("JSON elements must be both either objects or arrays to be merged");
+    }
+}
+
+/**
+ * @brief Merge source into dst. Objects are merged, arrays are appended without duplicates.
+ *
+ * A const source is copied, a mutable source must belong to the allocator of dst and its values are moved out of it.
+ */
+template<typename Source>
+void mergeValues(bool isRecursive, rapidjson::Value& dst, Source& source, rapidjson::Document::AllocatorType& allocator)
+{
+    constexpr bool MOVE = !std::is_const_v<Source>;
+    checkMergeable(dst, source);
+
+    if (dst.IsObject())
+    {
+        for (auto srcIt = source.MemberBegin(); srcIt != source.MemberEnd(); ++srcIt)
+        {
+            auto dstIt = dst.FindMember(srcIt->name);
+            if (dstIt != dst.MemberEnd())
+            {
+                if (isRecursive && (srcIt->value.IsObject() || srcIt->value.IsArray()))
+                {
+                    mergeValues(isRecursive, dstIt->value, srcIt->value, allocator);
+                }
+                else if constexpr (MOVE)
+                {
+                    dstIt->value = srcIt->value;
+                }
+                else
+                {
+                    dstIt->value.CopyFrom(srcIt->value, allocator);
+                }
+            }
+            else if constexpr (MOVE)
+            {
+                dst.AddMember(srcIt->name, srcIt->value, allocator);
+            }
+            else
+            {
+                rapidjson::Value cpyValue {srcIt->value, allocator};
+                rapidjson::Value cpyName {srcIt->name, allocator};
+                dst.AddMember(cpyName, cpyValue, allocator);
+            }
+        }
+        return;
+    }
+
+    for (auto srcIt = source.Begin(); srcIt != source.End(); ++srcIt)
+    {
+        // Find if value is already in dst
+        // TODO: this is inefficient, but rapidjson does not provide a way
+        // to do it.
+        if (std::find(dst.Begin(), dst.End(), *srcIt) != dst.End())
+        {
+            continue;
+        }
+
+        if constexpr (MOVE)
+        {
+            dst.PushBack(*srcIt, allocator);
+        }
+        else
+        {
+            rapidjson::Value cpyValue {*srcIt, allocator};
+            dst.PushBack(cpyValue, allocator);
+        }
+    }
+}
 } // namespace
 
 namespace json
 {
 
+Projection::Projection(Mode mode, const std::vector<std::string>& pointerPaths)
+    : m_mode {mode}
+{
+    if (pointerPaths.empty())
+    {
+        throw std::runtime_error("Projection without fields");
+    }
+
+    for (const auto& path : pointerPaths)
+    {
+        const rapidjson::Pointer pointer(path.data(), path.size());
+        if (!pointer.IsValid())
+        {
+            throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+        }
+
+        auto* node = &m_root;
+        for (size_t i = 0; i < pointer.GetTokenCount() && !node->whole; ++i)
+        {
+            const auto& token = pointer.GetTokens()[i];
+            const std::string_view name {token.name, token.length};
+            auto it = std::find_if(node->children.begin(),
+                                   node->children.end(),
+                                   [&name](const Node& child) { return child.name == name; });
+            if (it == node->children.end())
+            {
+                it = node->children.insert(node->children.end(), Node {std::string {name}, false, {}});
+            }
+            node = &*it;
+        }
+
+        // A selected field covers its children
+        node->whole = true;
+        node->children.clear();
+    }
+}
+
+bool Projection::selects(const rapidjson::Value& value, const Node& node) const
+{
+    for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it)
+    {
+        const std::string_view name {it->name.GetString(), it->name.GetStringLength()};
+        for (const auto& child : node.children)
+        {
+            if (child.name == name && (child.whole || (it->value.IsObject() && selects(it->value, child))))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void Projection::write(const rapidjson::Value& value,
+                       const Node& node,
+                       rapidjson::Writer<rapidjson::StringBuffer>& writer) const
+{
+    // Arrays and scalars are not walked, a field inside of them selects the whole value
+    if (!value.IsObject())
+    {
+        value.Accept(writer);
+        return;
+    }
+
+    writer.StartObject();
+    for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it)
+    {
+        const std::string_view name {it->name.GetString(), it->name.GetStringLength()};
+        const auto child = std::find_if(
+            node.children.begin(), node.children.end(), [&name](const Node& c) { return c.name == name; });
+
+        const auto selected = child != node.children.end();
+        if (m_mode == Mode::Include)
+        {
+            if (!selected || (!child->whole && (!it->value.IsObject() || !selects(it->value, *child))))
+            {
+                continue;
+            }
+        }
+        else if (selected && child->whole)
+        {
+            continue;
+        }
+
+        writer.Key(it->name.GetString(), it->name.GetStringLength());
+        if (selected && !child->whole)
+        {
+            write(it->value, *child, writer);
+        }
+        else
+        {
+            it->value.Accept(writer);
+        }
+    }
+    writer.EndObject();
+}
+
 Json::Json(const rapidjson::Value& value)
     : m_document {rapidjson::Document()}
 {
@@ -42,6 +267,22 @@ Json::Json(rapidjson::Document&& document)
     m_document = std::move(document);
 }
 
+Json::Json(std::shared_ptr<Allocator> allocator)
+    : m_allocator {std::move(allocator)}
+    , m_document {m_allocator.get()}
+{
+}
+
+Json::Json(rapidjson::Document&& document, std::shared_ptr<Allocator> allocator)
+    : m_allocator {std::move(allocator)}
+    , m_document {std::move(document)}
+{
+    if (m_allocator && &m_document.GetAllocator() != m_allocator.get())
+    {
+        throw std::runtime_error("JSON document does not use the given allocator");
+    }
+}
+
 Json::Json(const char* json)
     : m_document {rapidjson::Document()}
 {
@@ -61,6 +302,7 @@ Json::Json(const char* json)
 
 Json::Json(const Json& other)
     : m_document {}
+    , m_pinned {other.m_pinned}
 {
     m_document.CopyFrom(other.m_document, m_document.GetAllocator());
 }
@@ -123,51 +365,108 @@ std::string Json::formatJsonPath(std::string_view dotPath, bool skipDot)
 }
 
 Json::Json(Json&& other) noexcept
-    : m_document {std::move(other.m_document)}
+    : m_allocator {std::move(other.m_allocator)}
+    , m_document {std::move(other.m_document)}
+    , m_typedSlots {std::move(other.m_typedSlots)}
+    , m_version {other.m_version}
+    , m_pinned {std::move(other.m_pinned)}
 {
+    ++other.m_version;
 }
 
 Json& Json::operator=(Json&& other) noexcept
 {
+    // Release the current document before its allocator
     m_document = std::move(other.m_document);
+    m_allocator = std::move(other.m_allocator);
+    m_typedSlots = std::move(other.m_typedSlots);
+    m_version = other.m_version;
+    ++other.m_version;
+    m_pinned = std::move(other.m_pinned);
     return *this;
 }
 
-bool Json::exists(std::string_view ptrPath) const
+size_t Json::typedSlotId(std::string_view pointerPath)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, size_t> ids;
+
+    std::lock_guard lock {mutex};
+    return ids.try_emplace(std::string {pointerPath}, ids.size()).first->second;
+}
+
+std::optional<int64_t> Json::getTypedSlot(size_t id) const
 {
-    const auto fieldPtr = rapidjson::Pointer(ptrPath.data());
+    for (const auto& slot : m_typedSlots)
+    {
+        if (slot.id == id)
+        {
+            return slot.version == m_version ? std::make_optional(slot.value) : std::nullopt;
+        }
+    }
+
+    return std::nullopt;
+}
+
+void Json::setTypedSlot(size_t id, int64_t value) const
+{
+    for (auto& slot : m_typedSlots)
+    {
+        if (slot.id == id || slot.version != m_version)
+        {
+            slot = {id, m_version, value};
+            return;
+        }
+    }
+
+    m_typedSlots.push_back({id, m_version, value});
+}
+
+bool Json::exists(const FieldRef& field) const
+{
+    const auto& fieldPtr = field.pointer();
     if (fieldPtr.IsValid())
     {
         return fieldPtr.Get(m_document) != nullptr;
     }
 
-    throw std::runtime_error(fmt::format("..", __func__, ptrPath));
+    throw std::runtime_error(fmt::format("..", __func__, field.path()));
 }
 
-bool Json::equals(std::string_view ptrPath, const Json& value) const
+bool Json::exists(std::string_view ptrPath) const
 {
-    const auto fieldPtr = rapidjson::Pointer(ptrPath.data());
+    return exists(FieldRef::borrow(ptrPath));
+}
+
+bool Json::equals(const FieldRef& field, const Json& value) const
+{
+    const auto& fieldPtr = field.pointer();
     if (fieldPtr.IsValid())
     {
         const auto got {fieldPtr.Get(m_document)};
         return (got && *got == value.m_document);
     }
 
-    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, ptrPath));
+    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, field.path()));
 }
 
-bool Json::equals(std::string_view basePtrPath, std::string_view referencePtrPath) const
+bool Json::equals(std::string_view ptrPath, const Json& value) const
+{
+    return equals(FieldRef::borrow(ptrPath), value);
+}
+
+bool Json::equals(const FieldRef& baseField, const FieldRef& referenceField) const
 {
-    const auto fieldPtr = rapidjson::Pointer(basePtrPath.data());
-    const auto referencePtr = rapidjson::Pointer(referencePtrPath.data());
+    const auto& fieldPtr = baseField.pointer();
+    const auto& referencePtr = referenceField.pointer();
 
     if (!fieldPtr.IsValid())
     {
-        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, basePtrPath));
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, baseField.path()));
     }
     if (!referencePtr.IsValid())
     {
-        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, referencePtrPath));
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, referenceField.path()));
     }
 
     const auto fieldValue {fieldPtr.Get(m_document)};
@@ -176,32 +475,131 @@ bool Json::equals(std::string_view basePtrPath, std::string_view referencePtrPat
     return (fieldValue && referenceValue && *fieldValue == *referenceValue);
 }
 
+bool Json::equals(std::string_view basePtrPath, std::string_view referencePtrPath) const
+{
+    return equals(FieldRef::borrow(basePtrPath), FieldRef::borrow(referencePtrPath));
+}
+
+std::optional<bool> Json::arrayContains(const FieldRef& field, const Json& value) const
+{
+    const auto& fieldPtr = field.pointer();
+    if (!fieldPtr.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, field.path()));
+    }
+
+    const auto* array = fieldPtr.Get(m_document);
+    if (!array || !array->IsArray())
+    {
+        return std::nullopt;
+    }
+
+    const rapidjson::Value& target = value.m_document;
+    return std::find(array->Begin(), array->End(), target) != array->End();
+}
+
+std::optional<bool> Json::arrayContains(const FieldRef& field, const FieldRef& valueField) const
+{
+    const auto& fieldPtr = field.pointer();
+    const auto& valuePtr = valueField.pointer();
+    if (!fieldPtr.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, field.path()));
+    }
+    if (!valuePtr.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, valueField.path()));
+    }
+
+    const auto* array = fieldPtr.Get(m_document);
+    const auto* target = valuePtr.Get(m_document);
+    if (!array || !array->IsArray() || !target)
+    {
+        return std::nullopt;
+    }
+
+    return std::find(array->Begin(), array->End(), *target) != array->End();
+}
+
+std::optional<std::string> Json::scalarKey(const FieldRef& field) const
+{
+    const auto& fieldPtr = field.pointer();
+    if (!fieldPtr.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, field.path()));
+    }
+
+    const auto* value = fieldPtr.Get(m_document);
+    std::string key;
+    if (!value || !scalarKeyOf(*value, key))
+    {
+        return std::nullopt;
+    }
+
+    return key;
+}
+
+std::optional<bool> Json::visitArrayKeys(const FieldRef& field,
+                                         const std::function<bool(const std::string&)>& visitor) const
+{
+    const auto& fieldPtr = field.pointer();
+    if (!fieldPtr.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, field.path()));
+    }
+
+    const auto* array = fieldPtr.Get(m_document);
+    if (!array || !array->IsArray())
+    {
+        return std::nullopt;
+    }
+
+    std::string key;
+    for (const auto& element : array->GetArray())
+    {
+        if (scalarKeyOf(element, key) && visitor(key))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 // TODO Invert parameters to be consistent with other methods.
-void Json::set(std::string_view ptrPath, const Json& value)
+void Json::set(const FieldRef& field, const Json& value)
 {
-    const auto fieldPtr = rapidjson::Pointer(ptrPath.data());
+    ++m_version;
+    const auto& fieldPtr = field.pointer();
     if (fieldPtr.IsValid())
     {
+        sharePins(value);
         fieldPtr.Set(m_document, value.m_document);
     }
     else
     {
-        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, ptrPath));
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, field.path()));
     }
 }
 
-void Json::set(std::string_view basePtrPath, std::string_view referencePtrPath)
+void Json::set(std::string_view ptrPath, const Json& value)
+{
+    set(FieldRef::borrow(ptrPath), value);
+}
+
+void Json::set(const FieldRef& baseField, const FieldRef& referenceField)
 {
-    const auto fieldPtr = rapidjson::Pointer(basePtrPath.data());
-    const auto referencePtr = rapidjson::Pointer(referencePtrPath.data());
+    ++m_version;
+    const auto& fieldPtr = baseField.pointer();
+    const auto& referencePtr = referenceField.pointer();
 
     if (!fieldPtr.IsValid())
     {
-        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, basePtrPath));
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, baseField.path()));
     }
     if (!referencePtr.IsValid())
     {
-        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, referencePtrPath));
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, referenceField.path()));
     }
 
     const auto* reference = referencePtr.Get(m_document);
@@ -215,17 +613,23 @@ void Json::set(std::string_view basePtrPath, std::string_view referencePtrPath)
     }
 }
 
-std::optional<std::string> Json::getString(std::string_view path) const
+void Json::set(std::string_view basePtrPath, std::string_view referencePtrPath)
 {
+    set(FieldRef::borrow(basePtrPath), FieldRef::borrow(referencePtrPath));
+}
+
+std::optional<std::string> Json::getString(const FieldRef& field) const
+{
+    const auto& path = field.path();
     std::optional<std::string> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
         const auto* value = pp.Get(m_document);
         if (value && value->IsString())
         {
-            retval = std::string {value->GetString()};
+            retval = std::string {value->GetString(), value->GetStringLength()};
         }
         return retval;
     }
@@ -233,10 +637,34 @@ std::optional<std::string> Json::getString(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-std::optional<int> Json::getInt(std::string_view path) const
+std::optional<std::string_view> Json::getStringView(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
+
+    if (pp.IsValid())
+    {
+        const auto* value = pp.Get(m_document);
+        if (value && value->IsString())
+        {
+            return std::string_view {value->GetString(), value->GetStringLength()};
+        }
+        return std::nullopt;
+    }
+
+    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+}
+
+std::optional<std::string> Json::getString(std::string_view path) const
+{
+    return getString(FieldRef::borrow(path));
+}
+
+std::optional<int> Json::getInt(const FieldRef& field) const
 {
+    const auto& path = field.path();
     std::optional<int> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -251,9 +679,15 @@ std::optional<int> Json::getInt(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-std::optional<int64_t> Json::getInt64(std::string_view path) const
+std::optional<int> Json::getInt(std::string_view path) const
 {
-    auto pp = rapidjson::Pointer(path.data());
+    return getInt(FieldRef::borrow(path));
+}
+
+std::optional<int64_t> Json::getInt64(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -273,9 +707,15 @@ std::optional<int64_t> Json::getInt64(std::string_view path) const
     }
 }
 
-std::optional<int64_t> Json::getIntAsInt64(std::string_view path) const
+std::optional<int64_t> Json::getInt64(std::string_view path) const
 {
-    auto pp = rapidjson::Pointer(path.data());
+    return getInt64(FieldRef::borrow(path));
+}
+
+std::optional<int64_t> Json::getIntAsInt64(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -299,9 +739,15 @@ std::optional<int64_t> Json::getIntAsInt64(std::string_view path) const
     }
 }
 
-std::optional<float_t> Json::getFloat(std::string_view path) const
+std::optional<int64_t> Json::getIntAsInt64(std::string_view path) const
 {
-    auto pp = rapidjson::Pointer(path.data());
+    return getIntAsInt64(FieldRef::borrow(path));
+}
+
+std::optional<float_t> Json::getFloat(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -321,10 +767,16 @@ std::optional<float_t> Json::getFloat(std::string_view path) const
     }
 }
 
-std::optional<double_t> Json::getDouble(std::string_view path) const
+std::optional<float_t> Json::getFloat(std::string_view path) const
+{
+    return getFloat(FieldRef::borrow(path));
+}
+
+std::optional<double_t> Json::getDouble(const FieldRef& field) const
 {
+    const auto& path = field.path();
     std::optional<double> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -339,10 +791,16 @@ std::optional<double_t> Json::getDouble(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-std::optional<double> Json::getNumberAsDouble(std::string_view path) const
+std::optional<double_t> Json::getDouble(std::string_view path) const
+{
+    return getDouble(FieldRef::borrow(path));
+}
+
+std::optional<double> Json::getNumberAsDouble(const FieldRef& field) const
 {
+    const auto& path = field.path();
     std::optional<double> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -372,10 +830,16 @@ std::optional<double> Json::getNumberAsDouble(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-std::optional<bool> Json::getBool(std::string_view path) const
+std::optional<double> Json::getNumberAsDouble(std::string_view path) const
+{
+    return getNumberAsDouble(FieldRef::borrow(path));
+}
+
+std::optional<bool> Json::getBool(const FieldRef& field) const
 {
+    const auto& path = field.path();
     std::optional<bool> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -390,10 +854,16 @@ std::optional<bool> Json::getBool(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-std::optional<std::vector<Json>> Json::getArray(std::string_view path) const
+std::optional<bool> Json::getBool(std::string_view path) const
+{
+    return getBool(FieldRef::borrow(path));
+}
+
+std::optional<std::vector<Json>> Json::getArray(const FieldRef& field) const
 {
+    const auto& path = field.path();
     std::optional<std::vector<Json>> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -404,6 +874,7 @@ std::optional<std::vector<Json>> Json::getArray(std::string_view path) const
             for (const auto& item : value->GetArray())
             {
                 result.push_back(Json(item));
+                result.back().sharePins(*this);
             }
             retval = std::move(result);
         }
@@ -413,10 +884,16 @@ std::optional<std::vector<Json>> Json::getArray(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-std::optional<std::vector<std::tuple<std::string, Json>>> Json::getObject(std::string_view path) const
+std::optional<std::vector<Json>> Json::getArray(std::string_view path) const
+{
+    return getArray(FieldRef::borrow(path));
+}
+
+std::optional<std::vector<std::tuple<std::string, Json>>> Json::getObject(const FieldRef& field) const
 {
+    const auto& path = field.path();
     std::optional<std::vector<std::tuple<std::string, Json>>> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -427,6 +904,7 @@ std::optional<std::vector<std::tuple<std::string, Json>>> Json::getObject(std::s
             for (auto& [key, value] : value->GetObject())
             {
                 result.emplace_back(std::make_tuple(key.GetString(), Json(value)));
+                std::get<1>(result.back()).sharePins(*this);
             }
             retval = std::move(result);
         }
@@ -436,6 +914,11 @@ std::optional<std::vector<std::tuple<std::string, Json>>> Json::getObject(std::s
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+std::optional<std::vector<std::tuple<std::string, Json>>> Json::getObject(std::string_view path) const
+{
+    return getObject(FieldRef::borrow(path));
+}
+
 std::string Json::prettyStr() const
 {
     rapidjson::StringBuffer buffer;
@@ -453,10 +936,40 @@ std::string Json::str() const
     return buffer.GetString();
 }
 
-std::optional<std::string> Json::str(std::string_view path) const
+std::string_view Json::str(rapidjson::StringBuffer& buffer) const
+{
+    // Only the default Writer of a StringBuffer has the SIMD scanning of the strings
+    buffer.Clear();
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    this->m_document.Accept(writer);
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
+std::string_view Json::str(rapidjson::StringBuffer& buffer, const Projection& projection) const
+{
+    buffer.Clear();
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    if (!projection.m_root.whole)
+    {
+        projection.write(m_document, projection.m_root, writer);
+    }
+    else if (projection.m_mode == Projection::Mode::Include)
+    {
+        m_document.Accept(writer);
+    }
+    else
+    {
+        writer.StartObject();
+        writer.EndObject();
+    }
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
+std::optional<std::string> Json::str(const FieldRef& field) const
 {
+    const auto& path = field.path();
     std::optional<std::string> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -475,15 +988,21 @@ std::optional<std::string> Json::str(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+std::optional<std::string> Json::str(std::string_view path) const
+{
+    return str(FieldRef::borrow(path));
+}
+
 std::ostream& operator<<(std::ostream& os, const Json& json)
 {
     os << json.str();
     return os;
 }
 
-size_t Json::size(std::string_view path) const
+size_t Json::size(const FieldRef& field) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -512,9 +1031,15 @@ size_t Json::size(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isNull(std::string_view path) const
+size_t Json::size(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return size(FieldRef::borrow(path));
+}
+
+bool Json::isNull(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -530,9 +1055,15 @@ bool Json::isNull(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isBool(std::string_view path) const
+bool Json::isNull(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isNull(FieldRef::borrow(path));
+}
+
+bool Json::isBool(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -548,9 +1079,15 @@ bool Json::isBool(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isNumber(std::string_view path) const
+bool Json::isBool(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isBool(FieldRef::borrow(path));
+}
+
+bool Json::isNumber(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -566,9 +1103,15 @@ bool Json::isNumber(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isInt(std::string_view path) const
+bool Json::isNumber(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isNumber(FieldRef::borrow(path));
+}
+
+bool Json::isInt(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -584,9 +1127,15 @@ bool Json::isInt(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isInt64(std::string_view path) const
+bool Json::isInt(std::string_view path) const
+{
+    return isInt(FieldRef::borrow(path));
+}
+
+bool Json::isInt64(const FieldRef& field) const
 {
-    auto pp = rapidjson::Pointer(path.data());
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -602,9 +1151,15 @@ bool Json::isInt64(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isFloat(std::string_view path) const
+bool Json::isInt64(std::string_view path) const
+{
+    return isInt64(FieldRef::borrow(path));
+}
+
+bool Json::isFloat(const FieldRef& field) const
 {
-    auto pp = rapidjson::Pointer(path.data());
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -620,9 +1175,15 @@ bool Json::isFloat(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isDouble(std::string_view path) const
+bool Json::isFloat(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isFloat(FieldRef::borrow(path));
+}
+
+bool Json::isDouble(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -638,9 +1199,15 @@ bool Json::isDouble(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isString(std::string_view path) const
+bool Json::isDouble(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isDouble(FieldRef::borrow(path));
+}
+
+bool Json::isString(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -656,9 +1223,15 @@ bool Json::isString(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isArray(std::string_view path) const
+bool Json::isString(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isString(FieldRef::borrow(path));
+}
+
+bool Json::isArray(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -674,9 +1247,15 @@ bool Json::isArray(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isObject(std::string_view path) const
+bool Json::isArray(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isArray(FieldRef::borrow(path));
+}
+
+bool Json::isObject(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -692,9 +1271,15 @@ bool Json::isObject(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-bool Json::isEmpty(std::string_view path) const
+bool Json::isObject(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isObject(FieldRef::borrow(path));
+}
+
+bool Json::isEmpty(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -733,9 +1318,15 @@ bool Json::isEmpty(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-std::string Json::typeName(std::string_view path) const
+bool Json::isEmpty(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return isEmpty(FieldRef::borrow(path));
+}
+
+std::string Json::typeName(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -761,9 +1352,15 @@ std::string Json::typeName(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-Json::Type Json::type(std::string_view path) const
+std::string Json::typeName(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return typeName(FieldRef::borrow(path));
+}
+
+Json::Type Json::type(const FieldRef& field) const
+{
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -779,9 +1376,16 @@ Json::Type Json::type(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::setNull(std::string_view path)
+Json::Type Json::type(std::string_view path) const
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return type(FieldRef::borrow(path));
+}
+
+void Json::setNull(const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -792,9 +1396,16 @@ void Json::setNull(std::string_view path)
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::setBool(bool value, std::string_view path)
+void Json::setNull(std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return setNull(FieldRef::borrow(path));
+}
+
+void Json::setBool(bool value, const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -805,9 +1416,16 @@ void Json::setBool(bool value, std::string_view path)
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::setInt(int value, std::string_view path)
+void Json::setBool(bool value, std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return setBool(value, FieldRef::borrow(path));
+}
+
+void Json::setInt(int value, const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -818,9 +1436,16 @@ void Json::setInt(int value, std::string_view path)
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::setInt64(int64_t value, std::string_view path)
+void Json::setInt(int value, std::string_view path)
+{
+    return setInt(value, FieldRef::borrow(path));
+}
+
+void Json::setInt64(int64_t value, const FieldRef& field)
 {
-    auto pp = rapidjson::Pointer(path.data());
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -832,9 +1457,16 @@ void Json::setInt64(int64_t value, std::string_view path)
     }
 }
 
-void Json::setFloat(float_t value, std::string_view path)
+void Json::setInt64(int64_t value, std::string_view path)
 {
-    auto pp = rapidjson::Pointer(path.data());
+    return setInt64(value, FieldRef::borrow(path));
+}
+
+void Json::setFloat(float_t value, const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -846,9 +1478,16 @@ void Json::setFloat(float_t value, std::string_view path)
     }
 }
 
-void Json::setDouble(double_t value, std::string_view path)
+void Json::setFloat(float_t value, std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return setFloat(value, FieldRef::borrow(path));
+}
+
+void Json::setDouble(double_t value, const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -859,22 +1498,96 @@ void Json::setDouble(double_t value, std::string_view path)
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::setString(std::string_view value, std::string_view path)
+void Json::setDouble(double_t value, std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return setDouble(value, FieldRef::borrow(path));
+}
+
+void Json::setString(std::string_view value, const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
-        pp.Set(m_document, std::string(value).c_str());
+        rapidjson::Value string;
+        if (isPinned(value))
+        {
+            string.SetString(rapidjson::StringRef(value.data(), value.size()));
+        }
+        else
+        {
+            string.SetString(value.empty() ? "" : value.data(),
+                             static_cast<rapidjson::SizeType>(value.size()),
+                             m_document.GetAllocator());
+        }
+        pp.Set(m_document, string);
         return;
     }
 
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::setArray(std::string_view path)
+void Json::setString(std::string_view value, std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return setString(value, FieldRef::borrow(path));
+}
+
+std::string_view Json::pin(std::string_view value)
+{
+    for (const auto& buffer : m_pinned)
+    {
+        if (*buffer == value)
+        {
+            return *buffer;
+        }
+    }
+
+    return *m_pinned.emplace_back(std::make_shared<const std::string>(value));
+}
+
+bool Json::isPinned(std::string_view value) const
+{
+    if (value.empty())
+    {
+        return false;
+    }
+
+    const std::less<const char*> before {};
+    for (const auto& buffer : m_pinned)
+    {
+        const auto* begin = buffer->data();
+        if (!before(value.data(), begin) && !before(begin + buffer->size(), value.data() + value.size()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Json::sharePins(const Json& other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+
+    for (const auto& buffer : other.m_pinned)
+    {
+        if (std::find(m_pinned.begin(), m_pinned.end(), buffer) == m_pinned.end())
+        {
+            m_pinned.emplace_back(buffer);
+        }
+    }
+}
+
+void Json::setArray(const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -885,9 +1598,16 @@ void Json::setArray(std::string_view path)
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::setObject(std::string_view path)
+void Json::setArray(std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return setArray(FieldRef::borrow(path));
+}
+
+void Json::setObject(const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -898,9 +1618,16 @@ void Json::setObject(std::string_view path)
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::appendString(std::string_view value, std::string_view path)
+void Json::setObject(std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    return setObject(FieldRef::borrow(path));
+}
+
+void Json::appendString(std::string_view value, const FieldRef& field)
+{
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -936,12 +1663,52 @@ void Json::appendString(std::string_view value, std::string_view path)
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-void Json::appendJson(const Json& value, std::string_view path)
+void Json::appendString(std::string_view value, std::string_view path)
+{
+    return appendString(value, FieldRef::borrow(path));
+}
+
+void Json::appendStrings(const std::vector<std::string_view>& values, const FieldRef& field)
+{
+    ++m_version;
+    const auto& pp = field.pointer();
+    if (!pp.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, field.path()));
+    }
+
+    auto* array = pp.Get(m_document);
+    if (!array)
+    {
+        array = &pp.Set(m_document, rapidjson::Value(rapidjson::kArrayType));
+    }
+    else if (!array->IsArray())
+    {
+        array->SetArray();
+    }
+
+    auto& allocator = m_document.GetAllocator();
+    array->Reserve(array->Size() + static_cast<rapidjson::SizeType>(values.size()), allocator);
+    for (const auto& value : values)
+    {
+        if (static_cast<size_t>(static_cast<rapidjson::SizeType>(value.size())) != value.size())
+        {
+            throw std::runtime_error(fmt::format("String is too long ({}): '{}'.", value.size(), value));
+        }
+        rapidjson::Value item(value.data(), static_cast<rapidjson::SizeType>(value.size()), allocator);
+        array->PushBack(item, allocator);
+    }
+}
+
+void Json::appendJson(const Json& value, const FieldRef& field)
 {
-    auto pp = rapidjson::Pointer(path.data());
+    ++m_version;
+    const auto& path = field.path();
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
+        sharePins(value);
         rapidjson::Value rapidValue {value.m_document, m_document.GetAllocator()};
         auto* val = pp.Get(m_document);
         if (val)
@@ -966,8 +1733,15 @@ void Json::appendJson(const Json& value, std::string_view path)
     }
 }
 
-bool Json::erase(std::string_view path)
+void Json::appendJson(const Json& value, std::string_view path)
+{
+    return appendJson(value, FieldRef::borrow(path));
+}
+
+bool Json::erase(const FieldRef& field)
 {
+    ++m_version;
+    const auto& path = field.path();
     if (path.empty())
     {
         m_document.SetNull();
@@ -975,7 +1749,7 @@ bool Json::erase(std::string_view path)
     }
     else
     {
-        const auto pp = rapidjson::Pointer(path.data());
+        const auto& pp = field.pointer();
 
         if (pp.IsValid())
         {
@@ -986,74 +1760,23 @@ bool Json::erase(std::string_view path)
     }
 }
 
+bool Json::erase(std::string_view path)
+{
+    return erase(FieldRef::borrow(path));
+}
+
 void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(path.data());
+    ++m_version;
+    const auto pp = rapidjson::Pointer(path.data(), path.size());
 
     if (pp.IsValid())
     {
         auto* dstValue = pp.Get(m_document);
         if (dstValue)
         {
-            if (dstValue->GetType() == source.GetType())
-            {
-                if (dstValue->IsObject())
-                {
-                    for (auto srcIt = source.MemberBegin(); srcIt != source.MemberEnd(); ++srcIt)
-                    {
-                        if (dstValue->HasMember(srcIt->name))
-                        {
-                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator()};
-                            if (isRecursive && (srcIt->value.IsObject() || srcIt->value.IsArray()))
-                            {
-                                std::string newPath {std::string(path) + "/" + srcIt->name.GetString()};
-                                merge(isRecursive, cpyValue, newPath);
-                            }
-                            else
-                            {
-                                dstValue->FindMember(srcIt->name)->value = cpyValue;
-                            }
-                        }
-                        else
-                        {
-                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator()};
-                            rapidjson::Value cpyName {srcIt->name, m_document.GetAllocator()};
-                            dstValue->AddMember(cpyName, cpyValue, m_document.GetAllocator());
-                        }
-                    }
-                }
-                else if (dstValue->IsArray())
-                {
-                    for (auto srcIt = source.Begin(); srcIt != source.End(); ++srcIt)
-                    {
-                        // Find if value is already in dstValue
-                        // TODO: this is inefficient, but rapidjson does not provide a way
-                        // to do it.
-                        auto found = false;
-                        for (auto dstIt = dstValue->Begin(); dstIt != dstValue->End(); ++dstIt)
-                        {
-                            if (*dstIt == *srcIt)
-                            {
-                                found = true;
-                                break;
-                            }
-                        }
-                        if (!found)
-                        {
-                            rapidjson::Value cpyValue {*srcIt, m_document.GetAllocator()};
-                            dstValue->PushBack(cpyValue, m_document.GetAllocator());
-                        }
-                    }
-                }
-                else
-                {
-                    throw std::runtime_error("JSON elements must be both either objects or arrays to be merged");
-                }
-
-                return;
-            }
-
-            throw std::runtime_error("JSON objects of different types cannot be merged");
+            mergeValues(isRecursive, *dstValue, source, m_document.GetAllocator());
+            return;
         }
 
         throw std::runtime_error(fmt::format(PATH_NOT_FOUND_MSG, path));
@@ -1064,19 +1787,47 @@ void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::st
 
 void Json::merge(const bool isRecursive, const Json& other, std::string_view path)
 {
+    sharePins(other);
     merge(isRecursive, other.m_document, path);
 }
 
 void Json::merge(const bool isRecursive, std::string_view source, std::string_view path)
 {
-    const auto pp = rapidjson::Pointer(source.data());
+    const auto pp = rapidjson::Pointer(source.data(), source.size());
 
     if (pp.IsValid())
     {
         auto* srcValue = pp.Get(m_document);
         if (srcValue)
         {
-            merge(isRecursive, *srcValue, path);
+            // The source is erased after the merge, move its items unless the target is inside of it
+            const auto targetInSource =
+                path.substr(0, source.size()) == source && (path.size() == source.size() || path[source.size()] == '/');
+            if (targetInSource)
+            {
+                merge(isRecursive, *srcValue, path);
+                erase(source);
+                return;
+            }
+
+            const auto dstPp = rapidjson::Pointer(path.data(), path.size());
+            if (!dstPp.IsValid())
+            {
+                throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+            }
+            auto* dstValue = dstPp.Get(m_document);
+            if (!dstValue)
+            {
+                throw std::runtime_error(fmt::format(PATH_NOT_FOUND_MSG, path));
+            }
+            checkMergeable(*dstValue, *srcValue);
+
+            ++m_version;
+            rapidjson::Value detached;
+            detached = *srcValue; // Moves the value, leaves null at the source
+            // The target may be the parent of the source, resolve it again after detaching
+            dstValue = dstPp.Get(m_document);
+            mergeValues(isRecursive, *dstValue, detached, m_document.GetAllocator());
             erase(source);
             return;
         }
@@ -1087,10 +1838,11 @@ void Json::merge(const bool isRecursive, std::string_view source, std::string_vi
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
-std::optional<Json> Json::getJson(std::string_view path) const
+std::optional<Json> Json::getJson(const FieldRef& field) const
 {
+    const auto& path = field.path();
     std::optional<Json> retval {std::nullopt};
-    const auto pp = rapidjson::Pointer(path.data());
+    const auto& pp = field.pointer();
 
     if (pp.IsValid())
     {
@@ -1098,6 +1850,7 @@ std::optional<Json> Json::getJson(std::string_view path) const
         if (val)
         {
             retval = Json(*val);
+            retval->sharePins(*this);
         }
         return retval;
     }
@@ -1105,6 +1858,11 @@ std::optional<Json> Json::getJson(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+std::optional<Json> Json::getJson(std::string_view path) const
+{
+    return getJson(FieldRef::borrow(path));
+}
+
 std::optional<base::Error> Json::validate(const Json& schema) const
 {
     rapidjson::SchemaDocument sd(schema.m_document);
@@ -1178,6 +1936,7 @@ std::optional<base::Error> Json::checkDuplicateKeys() const
 
 bool Json::eraseIfKey(const std::function<bool(const std::string&)>& func, bool recursive, const std::string& path)
 {
+    ++m_version;
     bool modified = false;
     const auto pp = rapidjson::Pointer(path.data());
 
@@ -1221,7 +1980,9 @@ Json Json::makeObjectJson(const std::string& key, const json::Json& value)
         rapidjson::Value v(value.m_document, doc.GetAllocator());
         doc.AddMember(k, v, doc.GetAllocator());
     }
-    return Json(std::move(doc));
+    Json result(std::move(doc));
+    result.sharePins(value);
+    return result;
 }
 
 } // namespace json
@@ -40,26 +40,38 @@ void setLevel(Level level)
 
 void start(const LoggingConfig& cfg)
 {
-    std::shared_ptr<spdlog::logger> logger;
-
-    if (0 < cfg.dedicatedThreads)
-    {
-        spdlog::init_thread_pool(cfg.queueSize, cfg.dedicatedThreads);
-    }
+    spdlog::sink_ptr sink;
 
     if (cfg.filePath == STD_ERR_PATH)
     {
-        logger = spdlog::stderr_color_mt("default");
+        sink = std::make_shared<spdlog::sinks::stderr_color_sink_mt>();
     }
     else if (cfg.filePath == STD_OUT_PATH)
     {
-        logger = spdlog::stdout_color_mt("default");
+        sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
     }
     else
     {
-        logger = spdlog::basic_logger_mt("default", cfg.filePath, cfg.truncate);
+        sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(cfg.filePath, cfg.truncate);
     }
 
+    std::shared_ptr<spdlog::logger> logger;
+
+    if (0 < cfg.dedicatedThreads)
+    {
+        // The callers only queue the formatted messages, the dedicated threads write them to the sink
+        spdlog::init_thread_pool(cfg.queueSize, cfg.dedicatedThreads);
+        const auto policy =
+            cfg.dropOnOverflow ? spdlog::async_overflow_policy::overrun_oldest : spdlog::async_overflow_policy::block;
+        logger = std::make_shared<spdlog::async_logger>("default", sink, spdlog::thread_pool(), policy);
+    }
+    else
+    {
+        logger = std::make_shared<spdlog::logger>("default", sink);
+    }
+
+    spdlog::register_logger(logger);
+
     setLevel(cfg.level);
 
     logger->flush_on(spdlog::level::trace);
@@ -1,5 +1,7 @@
 #include "parseEvent.hpp"
 
+#include <cstring>
+
 #include <fmt/format.h>
 #include <base/logging.hpp>
 
@@ -12,15 +14,52 @@ namespace
 constexpr int LOCATION_OFFSET = 2; // Given the "q:" prefix.
 constexpr int MINIMUM_EVENT_ALLOWED_LENGTH = 4;
 constexpr char FIRST_FULL_LOCATION_CHAR {'['};
-} // namespace
 
-Event parseWazuhEvent(const std::string& event)
+/**
+ * @brief Find the colon that ends the location, skipping the escaped ones ("|:")
+ *
+ * @param event Wazuh message
+ * @return std::size_t Index of the colon or std::string_view::npos if not found
+ */
+std::size_t findLocationEnd(std::string_view event)
 {
-    int msgStartIndex {0};
+    const char* begin = event.data();
+    const char* end = begin + event.size();
+    const char* pos = begin + LOCATION_OFFSET;
 
-    auto parseEvent = std::make_shared<json::Json>();
-    parseEvent->setObject();
+    while (pos < end)
+    {
+        pos = static_cast<const char*>(std::memchr(pos, ':', end - pos));
+        if (pos == nullptr)
+        {
+            return std::string_view::npos;
+        }
+        if (*(pos - 1) != '|')
+        {
+            return pos - begin;
+        }
+        ++pos;
+    }
+
+    return std::string_view::npos;
+}
 
+/**
+ * @brief Set a string member without an intermediate copy, the bytes are copied once into the document
+ */
+inline void addStringMember(rapidjson::Value& object,
+                            const char* key,
+                            std::string_view value,
+                            rapidjson::Document::AllocatorType& allocator)
+{
+    object.AddMember(rapidjson::StringRef(key),
+                     rapidjson::Value(value.data(), static_cast<rapidjson::SizeType>(value.size()), allocator),
+                     allocator);
+}
+} // namespace
+
+Event parseWazuhEvent(std::string_view event, const std::shared_ptr<json::Json::Allocator>& allocator)
+{
     if (event.length() <= MINIMUM_EVENT_ALLOWED_LENGTH)
     {
         throw std::runtime_error(fmt::format("Invalid event format, event is too short ({})", event.length()));
@@ -31,35 +70,53 @@ Event parseWazuhEvent(const std::string& event)
         throw std::runtime_error("Invalid event format, a colon was expected to be right after the first character");
     }
 
-    const int queue {event[0]};
-    parseEvent->setInt(queue, EVENT_QUEUE_ID);
-    auto locationIdx = std::string::npos;
     // If we have an IPv6, double dots are preceded by a |
-    for (auto i = LOCATION_OFFSET; i < event.size(); ++i)
+    const auto locationIdx = findLocationEnd(event);
+    if (locationIdx == std::string_view::npos)
     {
-        if (event[i] == ':' && event[i - 1] != '|')
-        {
-            locationIdx = i;
-            break;
-        }
+        throw std::runtime_error("Invalid event format, a colon was expected to be right after the location");
     }
 
-    if (locationIdx == std::string::npos)
+    const auto rawLocation = event.substr(LOCATION_OFFSET, locationIdx - LOCATION_OFFSET);
+    const auto message = event.substr(locationIdx + 1);
+
+    // Build the document directly, avoiding the json pointer parsing of every field
+    // {"wazuh": {"queue": <queue>, "location": <location>}, "event": {"original": <message>}}
+    rapidjson::Document document {allocator.get()};
+    auto& docAllocator = document.GetAllocator();
+    document.SetObject();
+
+    rapidjson::Value wazuh(rapidjson::kObjectType);
+    wazuh.AddMember("queue", rapidjson::Value(static_cast<int>(event[0])), docAllocator);
+    if (std::memchr(rawLocation.data(), '|', rawLocation.size()) == nullptr)
     {
-        throw std::runtime_error("Invalid event format, a colon was expected to be right after the location");
+        addStringMember(wazuh, "location", rawLocation, docAllocator);
     }
-
-    std::string location = event.substr(LOCATION_OFFSET, locationIdx - LOCATION_OFFSET);
+    else
     {
-        size_t pos;
-        while ((pos = location.find("|:")) != std::string::npos)
+        // Unescape "|:" -> ":", only for the locations with escaped colons (IPv6)
+        std::string location;
+        location.reserve(rawLocation.size());
+        for (std::size_t i = 0; i < rawLocation.size(); ++i)
         {
-            location.erase(pos, 1);
+            if (rawLocation[i] == '|' && i + 1 < rawLocation.size() && rawLocation[i + 1] == ':')
+            {
+                continue;
+            }
+            location.push_back(rawLocation[i]);
         }
+        addStringMember(wazuh, "location", location, docAllocator);
     }
-    parseEvent->setString(location, EVENT_LOCATION_ID);
-    parseEvent->setString(event.substr(locationIdx + 1), EVENT_MESSAGE_ID);
+    document.AddMember("wazuh", std::move(wazuh), docAllocator);
 
-    return parseEvent;
+    rapidjson::Value original(rapidjson::kObjectType);
+    addStringMember(original, "original", message, docAllocator);
+    document.AddMember("event", std::move(original), docAllocator);
+
+    if (allocator)
+    {
+        return std::make_shared<json::Json>(std::move(document), allocator);
+    }
+    return std::make_shared<json::Json>(std::move(document));
 }
 } // namespace base::parseEvent
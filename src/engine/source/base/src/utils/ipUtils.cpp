@@ -104,4 +104,143 @@ bool isSpecialIPv6Address(const std::string& ip)
 }
 
 
+CIDRSet::CIDRSet()
+    : m_ipv4(1)
+    , m_ipv6(1)
+    , m_size(0)
+{
+}
+
+void CIDRSet::insert(std::vector<Node>& tree, const uint8_t* address, std::size_t prefixLength)
+{
+    uint32_t node = 0;
+    for (std::size_t bit = 0; bit < prefixLength; ++bit)
+    {
+        if (tree[node].terminal)
+        {
+            // Already covered by a shorter network
+            return;
+        }
+
+        const auto side = (address[bit / 8] >> (7 - bit % 8)) & 1;
+        if (tree[node].children[side] == 0)
+        {
+            tree[node].children[side] = static_cast<uint32_t>(tree.size());
+            tree.emplace_back();
+        }
+        node = tree[node].children[side];
+    }
+
+    // The longer networks under this one are unreachable, the lookup stops here
+    tree[node].terminal = true;
+    tree[node].children = {0, 0};
+}
+
+bool CIDRSet::lookup(const std::vector<Node>& tree, const uint8_t* address, std::size_t bits)
+{
+    uint32_t node = 0;
+    for (std::size_t bit = 0; bit < bits; ++bit)
+    {
+        if (tree[node].terminal)
+        {
+            return true;
+        }
+
+        node = tree[node].children[(address[bit / 8] >> (7 - bit % 8)) & 1];
+        if (node == 0)
+        {
+            return false;
+        }
+    }
+
+    return tree[node].terminal;
+}
+
+void CIDRSet::add(const std::string& cidr)
+{
+    const auto slash = cidr.find('/');
+    const auto ip = cidr.substr(0, slash);
+    const auto prefix = slash == std::string::npos ? std::string {} : cidr.substr(slash + 1);
+
+    struct in_addr ipv4;
+    struct in6_addr ipv6;
+    if (inet_pton(AF_INET, ip.c_str(), &ipv4) == 1)
+    {
+        std::size_t prefixLength = 32;
+        if (!prefix.empty())
+        {
+            // Throws if the mask is not valid
+            const auto mask = IPv4MaskUInt(prefix);
+            prefixLength = 0;
+            while (prefixLength < 32 && (mask & (0x80000000U >> prefixLength)))
+            {
+                ++prefixLength;
+            }
+            if (prefixLength < 32 && (mask << prefixLength) != 0)
+            {
+                throw std::invalid_argument(fmt::format("Invalid IPv4 mask '{}' in '{}'", prefix, cidr));
+            }
+        }
+
+        insert(m_ipv4, reinterpret_cast<const uint8_t*>(&ipv4.s_addr), prefixLength);
+    }
+    else if (inet_pton(AF_INET6, ip.c_str(), &ipv6) == 1)
+    {
+        std::size_t prefixLength = 128;
+        if (!prefix.empty())
+        {
+            std::size_t end = 0;
+            int value = -1;
+            try
+            {
+                value = std::stoi(prefix, &end);
+            }
+            catch (const std::exception&)
+            {
+            }
+
+            if (end != prefix.size() || value < 0 || value > 128)
+            {
+                throw std::invalid_argument(fmt::format("Invalid IPv6 prefix length '{}' in '{}'", prefix, cidr));
+            }
+            prefixLength = static_cast<std::size_t>(value);
+        }
+
+        insert(m_ipv6, ipv6.s6_addr, prefixLength);
+    }
+    else
+    {
+        throw std::invalid_argument(fmt::format("Invalid network '{}'", cidr));
+    }
+
+    ++m_size;
+}
+
+bool CIDRSet::contains(const std::string& ip) const
+{
+    struct in_addr ipv4;
+    if (inet_pton(AF_INET, ip.c_str(), &ipv4) == 1)
+    {
+        return lookup(m_ipv4, reinterpret_cast<const uint8_t*>(&ipv4.s_addr), 32);
+    }
+
+    struct in6_addr ipv6;
+    if (inet_pton(AF_INET6, ip.c_str(), &ipv6) == 1)
+    {
+        return lookup(m_ipv6, ipv6.s6_addr, 128);
+    }
+
+    throw std::invalid_argument(fmt::format("Invalid IP address '{}'", ip));
+}
+
+bool CIDRSet::contains(uint32_t ipv4) const
+{
+    // Network byte order, as the addresses are inserted
+    const std::array<uint8_t, 4> address {static_cast<uint8_t>(ipv4 >> 24),
+                                          static_cast<uint8_t>(ipv4 >> 16),
+                                          static_cast<uint8_t>(ipv4 >> 8),
+                                          static_cast<uint8_t>(ipv4)};
+    return lookup(m_ipv4, address.data(), 32);
+}
+
 } // namespace utils::ip
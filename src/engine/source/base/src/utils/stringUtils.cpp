@@ -1,11 +1,150 @@
 #include "utils/stringUtils.hpp"
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+
 namespace base::utils::string
 {
 
-std::vector<std::string> split(std::string_view str, const char delimiter)
+namespace
+{
+constexpr std::uint64_t ONES = 0x0101010101010101ULL;
+constexpr std::uint64_t HIGH_BITS = 0x8080808080808080ULL;
+
+/**
+ * @brief Flip the case of the bytes in [first, last], both ASCII letters of the same case.
+ *
+ * The high bit of each byte of the word is used as a flag: adding (0x80 - first) to the low 7 bits sets it for the
+ * bytes >= first, adding (0x80 - last - 1) for the bytes > last, and no addition carries into the next byte. The bytes
+ * with the high bit already set are not ASCII and are left alone. The flag shifted to 0x20 is the case bit.
+ */
+template<char First, char Last>
+void flipCase(std::string& str)
+{
+    constexpr auto geFirst = ONES * (0x80 - First);
+    constexpr auto gtLast = ONES * (0x80 - Last - 1);
+
+    auto* data = str.data();
+    const auto size = str.size();
+    std::size_t i = 0;
+
+    for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t))
+    {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        const auto low = word & ~HIGH_BITS;
+        const auto inRange = ((low + geFirst) ^ (low + gtLast)) & ~word & HIGH_BITS;
+        if (inRange != 0)
+        {
+            word ^= inRange >> 2;
+            std::memcpy(data + i, &word, sizeof(word));
+        }
+    }
+
+    for (; i < size; ++i)
+    {
+        if (data[i] >= First && data[i] <= Last)
+        {
+            data[i] ^= 0x20;
+        }
+    }
+}
+
+constexpr std::array<std::int8_t, 256> makeHexTable()
+{
+    std::array<std::int8_t, 256> table {};
+    for (auto& digit : table)
+    {
+        digit = -1;
+    }
+    for (auto c = 0; c < 10; ++c)
+    {
+        table['0' + c] = static_cast<std::int8_t>(c);
+    }
+    for (auto c = 0; c < 6; ++c)
+    {
+        table['a' + c] = static_cast<std::int8_t>(10 + c);
+        table['A' + c] = static_cast<std::int8_t>(10 + c);
+    }
+    return table;
+}
+
+constexpr auto HEX_VALUES = makeHexTable();
+constexpr auto HEX_DIGITS = "0123456789abcdef";
+} // namespace
+
+void toUpperAscii(std::string& str)
+{
+    flipCase<'a', 'z'>(str);
+}
+
+void toLowerAscii(std::string& str)
+{
+    flipCase<'A', 'Z'>(str);
+}
+
+std::string replaceAll(std::string_view str, std::string_view from, std::string_view to)
 {
-    std::vector<std::string> ret;
+    std::string result;
+    auto pos = str.find(from);
+    if (pos == std::string_view::npos)
+    {
+        return std::string {str};
+    }
+
+    result.reserve(to.size() > from.size() ? str.size() + (to.size() - from.size()) * 4 : str.size());
+    std::size_t last = 0;
+    while (pos != std::string_view::npos)
+    {
+        result.append(str.data() + last, pos - last);
+        result.append(to);
+        last = pos + from.size();
+        pos = str.find(from, last);
+    }
+    result.append(str.data() + last, str.size() - last);
+
+    return result;
+}
+
+bool decodeHex(std::string_view hex, std::string& out)
+{
+    if (hex.size() % 2 != 0)
+    {
+        return false;
+    }
+
+    out.resize(hex.size() / 2);
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        const auto high = HEX_VALUES[static_cast<unsigned char>(hex[2 * i])];
+        const auto low = HEX_VALUES[static_cast<unsigned char>(hex[2 * i + 1])];
+        if ((high | low) < 0)
+        {
+            return false;
+        }
+        out[i] = static_cast<char>((high << 4) | low);
+    }
+
+    return true;
+}
+
+std::string encodeHex(std::string_view data)
+{
+    std::string result(data.size() * 2, '\0');
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        const auto byte = static_cast<unsigned char>(data[i]);
+        result[2 * i] = HEX_DIGITS[byte >> 4];
+        result[2 * i + 1] = HEX_DIGITS[byte & 0x0F];
+    }
+
+    return result;
+}
+
+std::vector<std::string_view> splitView(std::string_view str, const char delimiter)
+{
+    std::vector<std::string_view> ret;
     if (!str.empty() && str[0] == delimiter)
     {
         str = str.substr(1);
@@ -30,6 +169,12 @@ std::vector<std::string> split(std::string_view str, const char delimiter)
     return ret;
 }
 
+std::vector<std::string> split(std::string_view str, const char delimiter)
+{
+    const auto views = splitView(str, delimiter);
+    return {views.begin(), views.end()};
+}
+
 std::string join(const std::vector<std::string>& strVector, std::string_view separator, const bool startsWithSeparator)
 {
     std::string strResult {};
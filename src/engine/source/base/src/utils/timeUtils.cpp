@@ -0,0 +1,160 @@
+#include "utils/timeUtils.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+#include <time.h>
+
+namespace base::utils::time
+{
+
+namespace
+{
+constexpr std::int64_t SECONDS_PER_DAY = 86400;
+constexpr std::int64_t FIRST_DAY = -719528; ///< 0000-01-01 in days since epoch
+constexpr std::int64_t LAST_DAY = 2932896;  ///< 9999-12-31 in days since epoch
+
+constexpr std::size_t DATE_SIZE = 11;    ///< YYYY-MM-DDT
+constexpr std::size_t SECONDS_SIZE = 20; ///< YYYY-MM-DDTHH:MM:SSZ
+
+/**
+ * @brief Dates formatted last by the thread.
+ */
+struct Cache
+{
+    std::int64_t day {std::numeric_limits<std::int64_t>::min()};
+    std::int64_t second {std::numeric_limits<std::int64_t>::min()};
+    char text[SECONDS_SIZE] {}; ///< Formatted second, its date prefix is the formatted day
+};
+
+void writeDigits(char* out, unsigned value, std::size_t digits)
+{
+    for (auto i = digits; i > 0; --i)
+    {
+        out[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+/**
+ * @brief Write the calendar date of a day since epoch, with the algorithm of civil_from_days by Howard Hinnant.
+ */
+void writeDate(std::int64_t day, char* out)
+{
+    const auto z = day + 719468;
+    const auto era = (z >= 0 ? z : z - 146096) / 146097;
+    const auto doe = static_cast<unsigned>(z - era * 146097);
+    const auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const auto mp = (5 * doy + 2) / 153;
+    const auto d = doy - (153 * mp + 2) / 5 + 1;
+    const auto m = mp < 10 ? mp + 3 : mp - 9;
+    const auto y = static_cast<std::int64_t>(yoe) + era * 400 + (m <= 2 ? 1 : 0);
+
+    writeDigits(out, static_cast<unsigned>(y), 4);
+    out[4] = '-';
+    writeDigits(out + 5, m, 2);
+    out[7] = '-';
+    writeDigits(out + 8, d, 2);
+    out[10] = 'T';
+}
+
+/**
+ * @brief Format a second in the thread cache.
+ *
+ * @return const char* The formatted second, nullptr if it is out of range
+ */
+const char* formatCached(std::int64_t seconds)
+{
+    thread_local Cache cache {};
+    if (seconds == cache.second)
+    {
+        return cache.text;
+    }
+
+    // Floor division, the negative seconds are in the days before the epoch
+    auto day = seconds / SECONDS_PER_DAY;
+    auto secondOfDay = seconds % SECONDS_PER_DAY;
+    if (secondOfDay < 0)
+    {
+        secondOfDay += SECONDS_PER_DAY;
+        --day;
+    }
+
+    if (day < FIRST_DAY || day > LAST_DAY)
+    {
+        return nullptr;
+    }
+
+    if (day != cache.day)
+    {
+        writeDate(day, cache.text);
+        cache.day = day;
+    }
+
+    const auto sod = static_cast<unsigned>(secondOfDay);
+    writeDigits(cache.text + DATE_SIZE, sod / 3600, 2);
+    cache.text[13] = ':';
+    writeDigits(cache.text + 14, sod / 60 % 60, 2);
+    cache.text[16] = ':';
+    writeDigits(cache.text + 17, sod % 60, 2);
+    cache.text[19] = 'Z';
+    cache.second = seconds;
+
+    return cache.text;
+}
+} // namespace
+
+std::int64_t epochSeconds()
+{
+#ifdef CLOCK_REALTIME_COARSE
+    timespec now {};
+    if (clock_gettime(CLOCK_REALTIME_COARSE, &now) == 0)
+    {
+        return static_cast<std::int64_t>(now.tv_sec);
+    }
+#endif
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+bool formatSeconds(std::int64_t seconds, std::string& out)
+{
+    const auto* text = formatCached(seconds);
+    if (text == nullptr)
+    {
+        return false;
+    }
+
+    out.assign(text, SECONDS_SIZE);
+    return true;
+}
+
+bool formatMillis(std::int64_t millis, std::string& out)
+{
+    auto seconds = millis / 1000;
+    auto milli = millis % 1000;
+    if (milli < 0)
+    {
+        milli += 1000;
+        --seconds;
+    }
+
+    const auto* text = formatCached(seconds);
+    if (text == nullptr)
+    {
+        return false;
+    }
+
+    // YYYY-MM-DDTHH:MM:SS.sssZ
+    char buffer[SECONDS_SIZE + 4];
+    std::memcpy(buffer, text, SECONDS_SIZE - 1);
+    buffer[SECONDS_SIZE - 1] = '.';
+    writeDigits(buffer + SECONDS_SIZE, static_cast<unsigned>(milli), 3);
+    buffer[SECONDS_SIZE + 3] = 'Z';
+    out.assign(buffer, sizeof(buffer));
+    return true;
+}
+
+} // namespace base::utils::time
@@ -238,3 +238,76 @@ TEST(isSpecialIPv6Address, Valid_range)
     EXPECT_FALSE(utils::ip::isSpecialIPv6Address("2001:db8:1234:0:0:0:0:1"));
     EXPECT_FALSE(utils::ip::isSpecialIPv6Address("2001:0db8:1234:ffff:ffff:ffff:ffff:ffff"));
 }
+
+TEST(CIDRSet, Invalid_network)
+{
+    utils::ip::CIDRSet set;
+    EXPECT_THROW(set.add(""), std::invalid_argument);
+    EXPECT_THROW(set.add("1.2.3"), std::invalid_argument);
+    EXPECT_THROW(set.add("1.2.3.4/33"), std::invalid_argument);
+    EXPECT_THROW(set.add("1.2.3.4/255.0.255.0"), std::invalid_argument);
+    EXPECT_THROW(set.add("2001:db8::/129"), std::invalid_argument);
+    EXPECT_THROW(set.add("2001:db8::/x"), std::invalid_argument);
+    EXPECT_EQ(set.size(), 0);
+}
+
+TEST(CIDRSet, Invalid_address)
+{
+    utils::ip::CIDRSet set;
+    set.add("10.0.0.0/8");
+    EXPECT_THROW(set.contains("10.0.0"), std::invalid_argument);
+    EXPECT_THROW(set.contains("only text"), std::invalid_argument);
+}
+
+TEST(CIDRSet, IPv4)
+{
+    utils::ip::CIDRSet set;
+    set.add("10.0.0.0/8");
+    set.add("192.168.1.0/255.255.255.0");
+    set.add("8.8.8.8");
+    EXPECT_EQ(set.size(), 3);
+
+    EXPECT_TRUE(set.contains("10.0.0.0"));
+    EXPECT_TRUE(set.contains("10.255.255.255"));
+    EXPECT_FALSE(set.contains("11.0.0.0"));
+    EXPECT_TRUE(set.contains("192.168.1.200"));
+    EXPECT_FALSE(set.contains("192.168.2.1"));
+    EXPECT_TRUE(set.contains("8.8.8.8"));
+    EXPECT_FALSE(set.contains("8.8.8.9"));
+    EXPECT_FALSE(set.contains("2001:db8::1"));
+
+    EXPECT_TRUE(set.contains(utils::ip::IPv4ToUInt("10.1.2.3")));
+    EXPECT_FALSE(set.contains(utils::ip::IPv4ToUInt("8.8.4.4")));
+}
+
+TEST(CIDRSet, IPv6)
+{
+    utils::ip::CIDRSet set;
+    set.add("2001:db8::/32");
+    set.add("fe80::/10");
+    set.add("::1");
+
+    EXPECT_TRUE(set.contains("2001:db8:1234::1"));
+    EXPECT_FALSE(set.contains("2001:db9::1"));
+    EXPECT_TRUE(set.contains("febf::1"));
+    EXPECT_FALSE(set.contains("fec0::1"));
+    EXPECT_TRUE(set.contains("::1"));
+    EXPECT_FALSE(set.contains("::2"));
+    EXPECT_FALSE(set.contains("10.0.0.1"));
+}
+
+TEST(CIDRSet, Nested_networks)
+{
+    utils::ip::CIDRSet set;
+    set.add("10.1.2.0/24");
+    set.add("10.0.0.0/8");
+    set.add("10.3.0.0/16");
+
+    EXPECT_TRUE(set.contains("10.1.2.3"));
+    EXPECT_TRUE(set.contains("10.200.0.1"));
+
+    utils::ip::CIDRSet all;
+    all.add("0.0.0.0/0");
+    EXPECT_TRUE(all.contains("1.2.3.4"));
+    EXPECT_FALSE(all.contains("::1"));
+}
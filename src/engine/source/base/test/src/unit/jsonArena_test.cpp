@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <base/jsonArena.hpp>
+#include <base/parseEvent.hpp>
+
+using namespace json;
+
+TEST(ArenaPoolTest, BuildsError)
+{
+    EXPECT_THROW(ArenaPool(ArenaPool::MIN_ARENA_SIZE - 1, 1), std::runtime_error);
+    EXPECT_THROW(ArenaPool(ArenaPool::MIN_ARENA_SIZE, 0), std::runtime_error);
+    EXPECT_NO_THROW(ArenaPool(ArenaPool::MIN_ARENA_SIZE, 1, 0));
+}
+
+TEST(ArenaPoolTest, AcquireUntilFull)
+{
+    ArenaPool pool(ArenaPool::MIN_ARENA_SIZE, 2, 1);
+    auto first = pool.acquire();
+    auto second = pool.acquire();
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(first, second);
+
+    // No free arenas
+    ASSERT_EQ(pool.acquire(), nullptr);
+
+    // The arena is reused once released
+    auto* released = first.get();
+    first.reset();
+    ASSERT_EQ(pool.acquire().get(), released);
+}
+
+TEST(ArenaPoolTest, ReusesAnyReleasedArena)
+{
+    ArenaPool pool(ArenaPool::MIN_ARENA_SIZE, 16, 1);
+    std::vector<std::shared_ptr<Json::Allocator>> arenas;
+    for (auto i = 0; i < 16; ++i)
+    {
+        arenas.emplace_back(pool.acquire());
+        ASSERT_NE(arenas.back(), nullptr);
+    }
+    ASSERT_EQ(pool.acquire(), nullptr);
+
+    // The last released arena is reused first
+    auto* middle = arenas[7].get();
+    auto* last = arenas.back().get();
+    arenas[7].reset();
+    arenas.back().reset();
+    auto reusedLast = pool.acquire();
+    ASSERT_EQ(reusedLast.get(), last);
+    auto reused = pool.acquire();
+    ASSERT_EQ(reused.get(), middle);
+    ASSERT_EQ(pool.acquire(), nullptr);
+
+    // Copies of the pointer keep the arena in use
+    auto copy = reused;
+    reused.reset();
+    ASSERT_EQ(pool.acquire(), nullptr);
+    copy.reset();
+    ASSERT_EQ(pool.acquire().get(), middle);
+}
+
+TEST(ArenaPoolTest, DocumentsOutliveThePool)
+{
+    std::shared_ptr<Json::Allocator> arena;
+    {
+        ArenaPool pool(ArenaPool::MIN_ARENA_SIZE, 1, 1);
+        arena = pool.acquire();
+        ASSERT_NE(arena, nullptr);
+    }
+    arena->Malloc(16);
+    arena.reset();
+}
+
+TEST(ArenaPoolTest, BorrowsFromOtherShard)
+{
+    ArenaPool pool(ArenaPool::MIN_ARENA_SIZE, 1, 2);
+
+    // Threads get consecutive indexes on their first use of any pool, so each one has its own shard
+    std::thread([&pool]() { ASSERT_NE(pool.acquire(), nullptr); }).join();
+    std::thread(
+        [&pool]()
+        {
+            auto own = pool.acquire();
+            ASSERT_NE(own, nullptr);
+
+            // The own shard is full, the free arena of the first thread is used
+            auto borrowed = pool.acquire();
+            ASSERT_NE(borrowed, nullptr);
+            ASSERT_NE(borrowed, own);
+            ASSERT_EQ(pool.acquire(), nullptr);
+        })
+        .join();
+}
+
+TEST(ArenaPoolTest, DocumentKeepsArena)
+{
+    ArenaPool pool(ArenaPool::MIN_ARENA_SIZE, 1, 1);
+    {
+        auto doc = pool.makeJson();
+        doc->setObject();
+        doc->setString(std::string(4 * ArenaPool::MIN_ARENA_SIZE, 'a'), "/big"); // Grows beyond the arena buffer
+        doc->setInt(1, "/num");
+
+        // In use by the document
+        ASSERT_EQ(pool.acquire(), nullptr);
+
+        // Moved documents keep the arena
+        Json moved {std::move(*doc)};
+        doc.reset();
+        ASSERT_EQ(pool.acquire(), nullptr);
+        ASSERT_EQ(moved.getInt("/num"), 1);
+
+        // Copies do not use the arena
+        Json copy {moved};
+        ASSERT_EQ(copy, moved);
+    }
+    ASSERT_NE(pool.acquire(), nullptr);
+}
+
+TEST(ArenaPoolTest, ReleasedFromOtherThread)
+{
+    ArenaPool pool(ArenaPool::MIN_ARENA_SIZE, 1, 1);
+    auto event = base::parseEvent::parseWazuhEvent("1:location:message", pool.acquire());
+    ASSERT_EQ(event->getString(base::parseEvent::EVENT_MESSAGE_ID), "message");
+    ASSERT_EQ(pool.acquire(), nullptr);
+
+    std::thread([event = std::move(event)]() mutable { event.reset(); }).join();
+    ASSERT_NE(pool.acquire(), nullptr);
+}
+
+TEST(ArenaPoolTest, NoArenaFallback)
+{
+    ArenaPool pool(ArenaPool::MIN_ARENA_SIZE, 1, 1);
+    auto busy = pool.acquire();
+    auto doc = pool.makeJson();
+    doc->setString("value", "/key");
+    ASSERT_EQ(doc->getString("/key"), "value");
+}
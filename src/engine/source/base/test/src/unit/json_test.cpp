@@ -240,6 +240,112 @@ TEST_F(JsonRuntime, Exists)
     ASSERT_THROW(doc.exists(".key/key2/key3/key4"), std::runtime_error);
 }
 
+TEST_F(JsonRuntime, FieldRefAccessors)
+{
+    Json doc {R"({"key":{"str":"value","int":1,"bool":true,"arr":["a"]}})"};
+    const FieldRef str {"/key/str"};
+    const FieldRef num {"/key/int"};
+    const FieldRef arr {"/key/arr"};
+    const FieldRef missing {"/key/missing"};
+
+    ASSERT_TRUE(str.isValid());
+    ASSERT_EQ(str.path(), "/key/str");
+    ASSERT_TRUE(doc.exists(str));
+    ASSERT_FALSE(doc.exists(missing));
+    ASSERT_EQ(doc.getString(str), "value");
+    ASSERT_FALSE(doc.getString(num).has_value());
+    ASSERT_EQ(doc.getStringView(str), "value");
+    ASSERT_FALSE(doc.getStringView(num).has_value());
+    ASSERT_FALSE(doc.getStringView(missing).has_value());
+    ASSERT_EQ(doc.getInt(num), 1);
+    ASSERT_EQ(doc.getIntAsInt64(num), 1);
+    ASSERT_TRUE(doc.getBool(FieldRef {"/key/bool"}).value());
+    ASSERT_TRUE(doc.isArray(arr));
+    ASSERT_EQ(doc.size(arr), 1);
+    ASSERT_EQ(doc.type(str), Json::Type::String);
+
+    doc.setString("other", missing);
+    ASSERT_EQ(doc.getString("/key/missing"), "other");
+    doc.appendString("b", arr);
+    ASSERT_EQ(doc.size("/key/arr"), 2);
+    doc.set(str, Json {"2"});
+    ASSERT_TRUE(doc.equals(str, Json {"2"}));
+    ASSERT_TRUE(doc.erase(missing));
+    ASSERT_FALSE(doc.exists("/key/missing"));
+}
+
+TEST_F(JsonRuntime, Projection)
+{
+    Json doc {R"({"a":{"b":1,"c":{"d":2,"e":3}},"f":[1,2],"g":"x"})"};
+    rapidjson::StringBuffer buffer;
+
+    using Mode = json::Projection::Mode;
+    ASSERT_EQ(doc.str(buffer, json::Projection(Mode::Include, {"/a/c/d", "/g"})), R"({"a":{"c":{"d":2}},"g":"x"})");
+    ASSERT_EQ(doc.str(buffer, json::Projection(Mode::Include, {"/a/c", "/a/c/d"})), R"({"a":{"c":{"d":2,"e":3}}})");
+    ASSERT_EQ(doc.str(buffer, json::Projection(Mode::Include, {"/a/missing", "/g/sub"})), R"({})");
+    ASSERT_EQ(doc.str(buffer, json::Projection(Mode::Include, {""})), doc.str());
+    ASSERT_EQ(doc.str(buffer, json::Projection(Mode::Exclude, {"/a/c/d", "/f"})),
+              R"({"a":{"b":1,"c":{"e":3}},"g":"x"})");
+    ASSERT_EQ(doc.str(buffer, json::Projection(Mode::Exclude, {"/g/sub"})), doc.str());
+    ASSERT_EQ(doc.str(buffer, json::Projection(Mode::Exclude, {""})), R"({})");
+
+    ASSERT_THROW(json::Projection(Mode::Include, {}), std::runtime_error);
+    ASSERT_THROW(json::Projection(Mode::Include, {"invalid"}), std::runtime_error);
+}
+
+TEST_F(JsonRuntime, PinnedStrings)
+{
+    std::string log {"user=root src=10.0.0.1"};
+    std::optional<Json> copy;
+    {
+        Json event {};
+        const auto pinned = event.pin(log);
+        ASSERT_EQ(pinned, log);
+        ASSERT_NE(pinned.data(), log.data());
+        ASSERT_EQ(event.pin(log).data(), pinned.data());
+
+        // Borrowed, not null terminated, and the log can change without affecting the event
+        event.setString(pinned.substr(5, 4), "/user");
+        event.setString(pinned.substr(14), "/src");
+        log.assign(log.size(), 'x');
+        ASSERT_EQ(event.getString("/user"), "root");
+        ASSERT_EQ(event.getStringView("/user"), "root");
+        ASSERT_EQ(event.str(), R"({"user":"root","src":"10.0.0.1"})");
+
+        Json wrapped {};
+        wrapped.set("/event", event);
+        copy = std::move(wrapped);
+        ASSERT_EQ(event.getJson("/user").value().getString(), "root");
+    }
+
+    // The pinned buffer outlives the event through the copies of its values
+    ASSERT_EQ(copy->getString("/event/user"), "root");
+    ASSERT_EQ(copy->getString("/event/src"), "10.0.0.1");
+    ASSERT_EQ(Json(*copy).str(), R"({"event":{"user":"root","src":"10.0.0.1"}})");
+}
+
+TEST_F(JsonRuntime, FieldRefCopy)
+{
+    Json doc {R"({"key":"value"})"};
+    std::optional<FieldRef> original {FieldRef {"/key"}};
+    const auto copy {*original};
+    original.reset();
+
+    ASSERT_EQ(copy.path(), "/key");
+    ASSERT_EQ(doc.getString(copy), "value");
+}
+
+TEST_F(JsonRuntime, FieldRefInvalid)
+{
+    Json doc {R"({"key":"value"})"};
+    const FieldRef invalid {"key"};
+
+    ASSERT_FALSE(invalid.isValid());
+    ASSERT_THROW(doc.exists(invalid), std::runtime_error);
+    ASSERT_THROW(doc.getString(invalid), std::runtime_error);
+    ASSERT_THROW(doc.setString("value", invalid), std::runtime_error);
+}
+
 TEST_F(JsonRuntime, EqualsValue)
 {
     Json doc {R"({
@@ -2172,6 +2278,136 @@ TEST_F(JsonSettersTest, MergeRefFailCases)
     ASSERT_THROW(jObjDst.merge(json::NOT_RECURSIVE, "/to_merge_obj", "/key1"), std::runtime_error);
 }
 
+TEST_F(JsonSettersTest, MergeRefIntoParent)
+{
+    Json jObjDst {R"({
+        "key1": "value1",
+        "to_merge": {
+            "key1": "newValue1",
+            "key2": ["newValue2"]
+        }
+    })"};
+
+    Json jObjExpected {R"({
+        "key1": "newValue1",
+        "key2": ["newValue2"]
+    })"};
+
+    ASSERT_NO_THROW(jObjDst.merge(json::NOT_RECURSIVE, "/to_merge"));
+    ASSERT_EQ(jObjDst, jObjExpected);
+}
+
+TEST_F(JsonSettersTest, MergeRefRecursive)
+{
+    Json jObjDst {R"({
+        "key1": {"key2": ["value2"], "key3": "value3"},
+        "to_merge": {"key2": ["value2", "newValue2"], "key4": "newValue4"}
+    })"};
+
+    Json jObjExpected {R"({
+        "key1": {"key2": ["value2", "newValue2"], "key3": "value3", "key4": "newValue4"}
+    })"};
+
+    ASSERT_NO_THROW(jObjDst.merge(json::RECURSIVE, "/to_merge", "/key1"));
+    ASSERT_EQ(jObjDst, jObjExpected);
+}
+
+TEST_F(JsonSettersTest, MergeRefFailKeepsSource)
+{
+    Json jObjDst {R"({"key1": "value1", "to_merge": {"key2": "value2"}})"};
+    Json jObjExpected {jObjDst};
+
+    ASSERT_THROW(jObjDst.merge(json::NOT_RECURSIVE, "/to_merge", "/key1"), std::runtime_error);
+    ASSERT_EQ(jObjDst, jObjExpected);
+}
+
+TEST_F(JsonSettersTest, AppendStrings)
+{
+    Json jObj {R"({"key1": ["value1"], "key2": "value2"})"};
+
+    ASSERT_NO_THROW(jObj.appendStrings({"value2", "value3"}, FieldRef("/key1")));
+    ASSERT_NO_THROW(jObj.appendStrings({"value4"}, FieldRef("/key2")));
+    ASSERT_NO_THROW(jObj.appendStrings({"value5", ""}, FieldRef("/key3/key4")));
+    ASSERT_EQ(jObj,
+              Json {R"({"key1": ["value1", "value2", "value3"], "key2": ["value4"], "key3": {"key4": ["value5", ""]}})"});
+
+    ASSERT_THROW(jObj.appendStrings({"value"}, FieldRef("invalid")), std::runtime_error);
+}
+
+TEST(JsonArrayContainsTest, ArrayContains)
+{
+    Json jObj {R"({"array": [1, "value", {"key": "value"}], "value": {"key": "value"}, "other": 2, "string": "a"})"};
+
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/array"), Json {"1"}), true);
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/array"), Json {R"("value")"}), true);
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/array"), Json {"2"}), false);
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/string"), Json {R"("a")"}), std::nullopt);
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/missing"), Json {"1"}), std::nullopt);
+
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/array"), FieldRef("/value")), true);
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/array"), FieldRef("/other")), false);
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/array"), FieldRef("/missing")), std::nullopt);
+    EXPECT_EQ(jObj.arrayContains(FieldRef("/string"), FieldRef("/other")), std::nullopt);
+
+    EXPECT_THROW(jObj.arrayContains(FieldRef("invalid"), Json {"1"}), std::runtime_error);
+    EXPECT_THROW(jObj.arrayContains(FieldRef("/array"), FieldRef("invalid")), std::runtime_error);
+}
+
+TEST(JsonStrTest, StrIntoBuffer)
+{
+    rapidjson::StringBuffer buffer;
+    Json ascii {R"({"key": "value", "array": [1, 2.5, true, null], "escaped": "a\"b\\c\n"})"};
+    EXPECT_EQ(ascii.str(buffer), ascii.str());
+
+    // The buffer is reused, the previous content is discarded
+    Json small {R"({"a": 1})"};
+    EXPECT_EQ(small.str(buffer), R"({"a":1})");
+
+    // Non-ASCII characters are kept as UTF-8
+    Json utf8 {R"({"key": "ñandú"})"};
+    EXPECT_EQ(utf8.str(buffer), R"({"key":"ñandú"})");
+    EXPECT_EQ(Json {std::string(utf8.str(buffer)).c_str()}, utf8);
+}
+
+TEST(JsonScalarKeyTest, ScalarKey)
+{
+    Json jObj {R"({"int": 1, "double": 1.0, "real": 1.5, "string": "1", "bool": true, "null": null, "array": [1]})"};
+
+    EXPECT_EQ(jObj.scalarKey(FieldRef("/int")), jObj.scalarKey(FieldRef("/double")));
+    EXPECT_NE(jObj.scalarKey(FieldRef("/int")), jObj.scalarKey(FieldRef("/real")));
+    EXPECT_NE(jObj.scalarKey(FieldRef("/int")), jObj.scalarKey(FieldRef("/string")));
+    EXPECT_NE(jObj.scalarKey(FieldRef("/bool")), jObj.scalarKey(FieldRef("/null")));
+    EXPECT_EQ(jObj.scalarKey(FieldRef("/array")), std::nullopt);
+    EXPECT_EQ(jObj.scalarKey(FieldRef("/missing")), std::nullopt);
+    EXPECT_EQ(Json {R"("1")"}.scalarKey(FieldRef()), jObj.scalarKey(FieldRef("/string")));
+
+    EXPECT_THROW(jObj.scalarKey(FieldRef("invalid")), std::runtime_error);
+}
+
+TEST(JsonScalarKeyTest, VisitArrayKeys)
+{
+    Json jObj {R"({"array": [1, "value", {"key": "value"}, 2.0], "string": "a"})"};
+
+    std::vector<std::string> keys;
+    auto collect = [&keys](const std::string& key)
+    {
+        keys.push_back(key);
+        return false;
+    };
+    EXPECT_EQ(jObj.visitArrayKeys(FieldRef("/array"), collect), false);
+    ASSERT_EQ(keys.size(), 3);
+    EXPECT_EQ(keys[1], Json {R"("value")"}.scalarKey(FieldRef()));
+    EXPECT_EQ(keys[2], Json {"2"}.scalarKey(FieldRef()));
+
+    auto stop = [](const std::string&)
+    {
+        return true;
+    };
+    EXPECT_EQ(jObj.visitArrayKeys(FieldRef("/array"), stop), true);
+    EXPECT_EQ(jObj.visitArrayKeys(FieldRef("/string"), stop), std::nullopt);
+    EXPECT_EQ(jObj.visitArrayKeys(FieldRef("/missing"), stop), std::nullopt);
+}
+
 // json getJson test
 TEST_F(getJsonTest, getObjectOk)
 {
@@ -2605,3 +2841,46 @@ INSTANTIATE_TEST_SUITE_P(CheckDuplicateKey,
         "check": "$event == 2",
         "check": "$event.id == 2"
         })")));
+
+TEST(JsonTypedSlotTest, SameIdForSamePath)
+{
+    auto id = Json::typedSlotId("/source/ip");
+    ASSERT_EQ(Json::typedSlotId("/source/ip"), id);
+    ASSERT_NE(Json::typedSlotId("/destination/ip"), id);
+}
+
+TEST(JsonTypedSlotTest, KeptUntilModified)
+{
+    Json json {R"({"source": {"ip": "10.0.0.1"}, "port": 22})"};
+    auto ip = Json::typedSlotId("/source/ip");
+    auto port = Json::typedSlotId("/port");
+
+    ASSERT_FALSE(json.getTypedSlot(ip));
+    json.setTypedSlot(ip, 167772161);
+    json.setTypedSlot(port, 22);
+    ASSERT_EQ(json.getTypedSlot(ip), 167772161);
+    ASSERT_EQ(json.getTypedSlot(port), 22);
+
+    // Any modification invalidates the slots
+    json.setInt(23, "/port");
+    ASSERT_FALSE(json.getTypedSlot(ip));
+    ASSERT_FALSE(json.getTypedSlot(port));
+
+    json.setTypedSlot(port, 23);
+    ASSERT_EQ(json.getTypedSlot(port), 23);
+    json.erase("/source");
+    ASSERT_FALSE(json.getTypedSlot(port));
+}
+
+TEST(JsonTypedSlotTest, NotCopied)
+{
+    Json json {R"({"port": 22})"};
+    auto port = Json::typedSlotId("/port");
+    json.setTypedSlot(port, 22);
+
+    Json copy {json};
+    ASSERT_FALSE(copy.getTypedSlot(port));
+
+    Json moved {std::move(json)};
+    ASSERT_EQ(moved.getTypedSlot(port), 22);
+}
@@ -187,3 +187,56 @@ INSTANTIATE_TEST_CASE_P(
                         std::regex(R"(\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}\.\d+ \d+:\d+ (\w+): .*)")),
         std::make_tuple(logging::Level::Critical,
                         std::regex(R"(\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}\.\d+ \d+:\d+ (\w+): .*)"))));
+
+TEST_F(LoggerTest, LogArgumentsNotEvaluatedIfDisabled)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {.filePath = m_tmpPath, .level = logging::Level::Warn}));
+
+    auto evaluations = 0;
+    auto argument = [&evaluations]()
+    {
+        ++evaluations;
+        return "argument";
+    };
+
+    LOG_DEBUG("DEBUG message {}", argument());
+    LOG_WARNING("WARNING message {}", argument());
+
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_EQ(readFileContents(m_tmpPath).find("DEBUG message"), std::string::npos);
+    EXPECT_NE(readFileContents(m_tmpPath).find("WARNING message argument"), std::string::npos);
+}
+
+TEST_F(LoggerTest, LogRateLimited)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {.filePath = m_tmpPath, .level = logging::Level::Info}));
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        LOG_WARNING_RL(2, "Limited message {}", i);
+    }
+
+    auto content = readFileContents(m_tmpPath);
+    EXPECT_NE(content.find("Limited message 0"), std::string::npos);
+    EXPECT_NE(content.find("Limited message 1"), std::string::npos);
+    EXPECT_EQ(content.find("Limited message 2"), std::string::npos);
+}
+
+TEST_F(LoggerTest, LogAsync)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {.filePath = m_tmpPath,
+                                                           .level = logging::Level::Info,
+                                                           .dedicatedThreads = 1,
+                                                           .queueSize = 16,
+                                                           .dropOnOverflow = true}));
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        LOG_INFO("Async message {}", i);
+    }
+
+    // Stopping waits for the queued messages to be written
+    logging::stop();
+
+    EXPECT_NE(readFileContents(m_tmpPath).find("Async message 99"), std::string::npos);
+}
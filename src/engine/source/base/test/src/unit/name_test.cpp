@@ -127,3 +127,21 @@ TEST_F(NameTest, FullName)
                           base::Name::SEPARATOR_S,
                           base::Name::SEPARATOR_S));
 }
+
+TEST_F(NameTest, HashDependsOnOrder)
+{
+    base::Name name1 ({"type", "name", "version"});
+    base::Name name2 ("type/name/version");
+    base::Name name3 ({"version", "name", "type"});
+    ASSERT_EQ(std::hash<base::Name>()(name1), std::hash<base::Name>()(name2));
+    ASSERT_NE(std::hash<base::Name>()(name1), std::hash<base::Name>()(name3));
+    ASSERT_NE(name1, name3);
+}
+
+TEST_F(NameTest, MovedNameIsEmpty)
+{
+    base::Name name ({"type", "name", "version"});
+    base::Name moved (std::move(name));
+    ASSERT_EQ(moved.toStr(), "type/name/version");
+    ASSERT_EQ(name, base::Name());
+}
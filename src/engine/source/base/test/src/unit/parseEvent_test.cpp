@@ -63,6 +63,22 @@ TEST(parseWazuhEvent, InvalidShortEvent)
     ASSERT_THROW(base::parseEvent::parseWazuhEvent(event), std::runtime_error);
 }
 
+TEST(parseWazuhEvent, NotNullTerminatedView)
+{
+    const std::string buffer {"1:location:message tail-not-included"};
+    const std::string_view event {buffer.data(), buffer.find(" tail")};
+
+    auto e = base::parseEvent::parseWazuhEvent(event);
+    EXPECT_EQ(e->getString(base::parseEvent::EVENT_LOCATION_ID).value(), "location");
+    EXPECT_EQ(e->getString(base::parseEvent::EVENT_MESSAGE_ID).value(), "message");
+}
+
+TEST(parseWazuhEvent, LocationWithoutEnd)
+{
+    const std::string event {"1:ABCD|:EFG0|:1234"};
+    ASSERT_THROW(base::parseEvent::parseWazuhEvent(event), std::runtime_error);
+}
+
 TEST(parseWazuhEvent, Forms)
 {
     std::vector<UseCase> useCases = {
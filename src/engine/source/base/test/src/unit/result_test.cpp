@@ -147,3 +147,21 @@ TEST(Result, MakeFailure)
     ASSERT_TRUE(result.failure());
     ASSERT_FALSE(result.success());
 }
+
+TEST(Result, MakeKeepsTraceOnlyWhenTracing)
+{
+    const std::string trace {"trace"};
+    ASSERT_EQ(makeSuccess<int>(0, trace).trace(), "");
+    ASSERT_EQ(makeFailure<int>(0, "trace").trace(), "");
+
+    {
+        TracingScope tracing;
+        ASSERT_EQ(makeSuccess<int>(0, trace).trace(), "trace");
+        ASSERT_EQ(makeFailure<int>(0, "trace").trace(), "trace");
+
+        TracingScope disabled {false};
+        ASSERT_EQ(makeSuccess<int>(0, trace).trace(), "");
+    }
+
+    ASSERT_FALSE(tracing());
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cctype>
 #include <vector>
 
 #include <base/utils/stringUtils.hpp>
@@ -61,6 +62,15 @@ TEST(split, ok_delimiter)
     ASSERT_EQ(result, expected);
 }
 
+TEST(splitView, doble_delimiter)
+{
+    std::string test = "//value1//value2//";
+    std::vector<std::string_view> expected = {"", "value1", "", "value2", ""};
+    auto result = base::utils::string::splitView(test, '/');
+    ASSERT_EQ(result, expected);
+    ASSERT_EQ(result[1].data(), test.data() + 2);
+}
+
 TEST(splitMulti, ThreeDelimiters)
 {
     std::string input = "this is-a test to split by - and ,,where-are included in the result";
@@ -250,3 +260,60 @@ TEST(splitEscaped, EcapeEscapedChar)
     std::vector<std::string> result = base::utils::string::splitEscaped(input, '!', '#');
     ASSERT_EQ(result, expected);
 }
+
+TEST(caseAscii, UpperAndLower)
+{
+    // Longer than a word, with a tail, the letters next to the range bounds and non ASCII bytes
+    std::string str = "azAZ@[`{09 hello WORLD \xc3\xa1\xc3\x81 tail";
+    base::utils::string::toUpperAscii(str);
+    ASSERT_EQ(str, "AZAZ@[`{09 HELLO WORLD \xc3\xa1\xc3\x81 TAIL");
+    base::utils::string::toLowerAscii(str);
+    ASSERT_EQ(str, "azaz@[`{09 hello world \xc3\xa1\xc3\x81 tail");
+}
+
+TEST(caseAscii, MatchesStandard)
+{
+    std::string str;
+    for (auto c = 0; c < 256; ++c)
+    {
+        str += static_cast<char>(c);
+    }
+
+    auto upper = str;
+    auto lower = str;
+    base::utils::string::toUpperAscii(upper);
+    base::utils::string::toLowerAscii(lower);
+    for (auto c = 0; c < 256; ++c)
+    {
+        const auto expectedUpper = c < 128 ? std::toupper(c) : c;
+        const auto expectedLower = c < 128 ? std::tolower(c) : c;
+        ASSERT_EQ(static_cast<unsigned char>(upper[c]), expectedUpper) << c;
+        ASSERT_EQ(static_cast<unsigned char>(lower[c]), expectedLower) << c;
+    }
+}
+
+TEST(replaceAll, Success)
+{
+    ASSERT_EQ(base::utils::string::replaceAll("a-b-c", "-", "--"), "a--b--c");
+    ASSERT_EQ(base::utils::string::replaceAll("aaaa", "aa", "b"), "bb");
+    ASSERT_EQ(base::utils::string::replaceAll("abc", "x", "y"), "abc");
+    ASSERT_EQ(base::utils::string::replaceAll("abcabc", "abc", ""), "");
+    ASSERT_EQ(base::utils::string::replaceAll("", "a", "b"), "");
+}
+
+TEST(hex, DecodeEncode)
+{
+    std::string out;
+    ASSERT_TRUE(base::utils::string::decodeHex("48656C6C6f20776F726C6421", out));
+    ASSERT_EQ(out, "Hello world!");
+    ASSERT_EQ(base::utils::string::encodeHex(out), "48656c6c6f20776f726c6421");
+    ASSERT_TRUE(base::utils::string::decodeHex("", out));
+    ASSERT_EQ(out, "");
+    ASSERT_EQ(base::utils::string::encodeHex("\xff\x00\x10"), "ff");
+    ASSERT_EQ(base::utils::string::encodeHex(std::string_view("\xff\x00\x10", 3)), "ff0010");
+
+    ASSERT_FALSE(base::utils::string::decodeHex("486", out));
+    ASSERT_FALSE(base::utils::string::decodeHex("4G", out));
+    ASSERT_FALSE(base::utils::string::decodeHex("+1", out));
+    ASSERT_FALSE(base::utils::string::decodeHex("0x", out));
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include <base/utils/timeUtils.hpp>
+
+using namespace base::utils::time;
+
+TEST(TimeUtilsTest, EpochSeconds)
+{
+    const auto now =
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    const auto seconds = epochSeconds();
+    EXPECT_LE(std::abs(seconds - now), 1);
+}
+
+using FormatT = std::tuple<std::int64_t, bool, std::string>;
+
+class FormatSecondsTest : public ::testing::TestWithParam<FormatT>
+{
+};
+
+TEST_P(FormatSecondsTest, Format)
+{
+    const auto& [seconds, success, expected] = GetParam();
+    std::string out {"untouched"};
+    ASSERT_EQ(formatSeconds(seconds, out), success);
+    ASSERT_EQ(out, success ? expected : "untouched");
+
+    // Cached by the thread
+    ASSERT_EQ(formatSeconds(seconds, out), success);
+    ASSERT_EQ(out, success ? expected : "untouched");
+}
+
+INSTANTIATE_TEST_SUITE_P(TimeUtilsTest,
+                         FormatSecondsTest,
+                         ::testing::Values(FormatT(0, true, "1970-01-01T00:00:00Z"),
+                                           FormatT(1, true, "1970-01-01T00:00:01Z"),
+                                           FormatT(-1, true, "1969-12-31T23:59:59Z"),
+                                           FormatT(951782400, true, "2000-02-29T00:00:00Z"),
+                                           FormatT(1700000000, true, "2023-11-14T22:13:20Z"),
+                                           FormatT(1700000059, true, "2023-11-14T22:14:19Z"),
+                                           FormatT(4102444799, true, "2099-12-31T23:59:59Z"),
+                                           FormatT(-62167219200, true, "0000-01-01T00:00:00Z"),
+                                           FormatT(253402300799, true, "9999-12-31T23:59:59Z"),
+                                           FormatT(-62167219201, false, ""),
+                                           FormatT(253402300800, false, "")));
+
+TEST(TimeUtilsTest, FormatMillis)
+{
+    std::string out;
+    ASSERT_TRUE(formatMillis(1700000000123, out));
+    ASSERT_EQ(out, "2023-11-14T22:13:20.123Z");
+
+    ASSERT_TRUE(formatMillis(1700000000007, out));
+    ASSERT_EQ(out, "2023-11-14T22:13:20.007Z");
+
+    ASSERT_TRUE(formatMillis(-1, out));
+    ASSERT_EQ(out, "1969-12-31T23:59:59.999Z");
+
+    ASSERT_FALSE(formatMillis(253402300800000, out));
+}
@@ -273,10 +273,18 @@ TEST_F(WazuhRequest_getParameters, invalidRequest)
     EXPECT_TRUE(wrequest.error());
     ASSERT_FALSE(wrequest.isValid());
     ASSERT_FALSE(wrequest.getParameters());
+    ASSERT_FALSE(wrequest.getParametersStr());
     ASSERT_STREQ(wrequest.error()->c_str(),
                  "The request must have a 'parameters' field containing a JSON object value");
 }
 
+TEST_F(WazuhRequest_getParameters, validStr)
+{
+    auto wrequest = base::utils::wazuhProtocol::WazuhRequest {jrequest};
+    ASSERT_TRUE(wrequest.isValid());
+    ASSERT_EQ(wrequest.getParametersStr().value(), wrequest.getParameters().value().str());
+}
+
 TEST_F(WazuhRequest_create, valid_paramObjtype)
 {
     auto wrequest = base::utils::wazuhProtocol::WazuhRequest::create(
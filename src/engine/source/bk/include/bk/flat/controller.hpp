@@ -0,0 +1,194 @@
+#ifndef _BK_FLAT_CONTROLLER_HPP
+#define _BK_FLAT_CONTROLLER_HPP
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <bk/icontroller.hpp>
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+
+namespace bk::flat
+{
+
+using Offset = uint32_t;                                          ///< Index of an instruction in the program
+constexpr Offset END_OF_PROGRAM = std::numeric_limits<Offset>::max(); ///< Jump target that ends the evaluation
+
+/**
+ * @brief Instruction of a flat program, a term and where to jump after it
+ *
+ * The operations of the expression (and, or, chain...) do not exist in the program, they are encoded in the jump
+ * targets of the terms.
+ */
+struct Instruction
+{
+    base::EngineOp m_op;  ///< Term function
+    Subscriber m_trace;   ///< Publisher of the traces of the term, can be empty
+    Offset m_onSuccess;   ///< Next instruction if the term succeeded
+    Offset m_onFailure;   ///< Next instruction if the term failed
+    std::string m_name;   ///< Name of the term, for printGraph
+};
+
+/**
+ * @brief Backend that flattens the expression into a contiguous array of instructions
+ *
+ * Evaluating an event is a loop over the array following the jump offsets, without graph scheduling, observables or
+ * virtual dispatch per operation.
+ */
+class Controller final : public IController
+{
+private:
+    class TracerImpl; ///< Implementation of the trace
+
+    std::unordered_map<std::string, std::shared_ptr<TracerImpl>> m_traces; ///< Traces
+    std::unordered_set<std::string> m_traceables;                          ///< Traceables
+    base::Expression m_expression;                                         ///< Expression
+
+    std::vector<Instruction> m_program;  ///< Flat program
+    Offset m_entry;                      ///< First instruction
+    std::function<void()> m_endCallback; ///< Called after each event
+
+    /**
+     * @brief Run the program over an event
+     *
+     * @param event Event to process
+     */
+    void run(base::Event& event) const
+    {
+        auto pc = m_entry;
+        while (pc != END_OF_PROGRAM)
+        {
+            const auto& instruction = m_program[pc];
+            auto res = instruction.m_op(event);
+            if (instruction.m_trace)
+            {
+                instruction.m_trace(res.trace(), res.success());
+            }
+
+            pc = res.success() ? instruction.m_onSuccess : instruction.m_onFailure;
+        }
+
+        if (m_endCallback)
+        {
+            m_endCallback();
+        }
+    }
+
+public:
+    Controller() = delete;
+    Controller(const Controller&) = delete;
+
+    ~Controller() = default;
+
+    /**
+     * @brief Construct a new Controller from an expression and a set of traceables
+     *
+     * @param expression expression to build
+     * @param traceables traceables expressions
+     * @param endCallback callback to call when the expression is finished
+     */
+    Controller(const base::Expression& expression,
+               const std::unordered_set<std::string>& traceables,
+               const std::function<void()>& endCallback = nullptr);
+
+    /**
+     * @copydoc bk::IController::ingest
+     */
+    void ingest(base::Event&& event) override
+    {
+        auto local = std::move(event);
+        run(local);
+    }
+
+    /**
+     * @copydoc bk::IController::ingestGet
+     */
+    base::Event ingestGet(base::Event&& event) override
+    {
+        auto local = std::move(event);
+        run(local);
+        return local;
+    }
+
+    /**
+     * @copydoc bk::IController::ingestBatch
+     */
+    void ingestBatch(std::vector<base::Event>& events) override
+    {
+        for (auto& event : events)
+        {
+            run(event);
+        }
+    }
+
+    /**
+     * @copydoc bk::IController::start
+     */
+    void start() override {}
+
+    /**
+     * @copydoc bk::IController::stop
+     */
+    void stop() override {}
+
+    /**
+     * @copydoc bk::IController::isAviable
+     */
+    inline bool isAviable() const override { return true; }
+
+    /**
+     * @copydoc bk::IController::isThreadSafe
+     *
+     * The program is immutable, the evaluation state lives on the stack of run() and the traces lock their subscribers.
+     * The helpers that keep state between events synchronize it: the geo locators and the sockets of the active
+     * response, upgrade confirmation and SCA helpers.
+     */
+    inline bool isThreadSafe() const override { return true; }
+
+    /**
+     * @copydoc bk::IController::printGraph
+     */
+    std::string printGraph() const override;
+
+    /**
+     * @copydoc bk::IController::getTraceables
+     */
+    const std::unordered_set<std::string>& getTraceables() const override { return m_traceables; }
+
+    /**
+     * @copydoc bk::IController::getTraces
+     */
+    base::RespOrError<Subscription> subscribe(const std::string& traceable, const Subscriber& subscriber) override;
+
+    /**
+     * @copydoc bk::IController::unsubscribe
+     */
+    void unsubscribe(const std::string& traceable, Subscription subscription) override;
+
+    /**
+     * @copydoc bk::IController::unsubscribeAll
+     */
+    void unsubscribeAll() override;
+};
+
+class ControllerMaker : public IControllerMaker
+{
+public:
+    /**
+     * @copydoc bk::IControllerMaker::create
+     */
+    std::shared_ptr<IController> create(const base::Expression& expression,
+                                        const std::unordered_set<std::string>& traceables,
+                                        const std::function<void()>& endCallback) override
+    {
+        return std::make_shared<Controller>(expression, traceables, endCallback);
+    }
+};
+
+} // namespace bk::flat
+
+#endif // _BK_FLAT_CONTROLLER_HPP
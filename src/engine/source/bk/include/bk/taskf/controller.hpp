@@ -1,9 +1,11 @@
 #ifndef _BK_TASKF_CONTROLLER_HPP
 #define _BK_TASKF_CONTROLLER_HPP
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <taskflow/taskflow.hpp>
 
@@ -13,6 +15,25 @@
 namespace bk::taskf
 {
 
+/**
+ * @brief How the controller evaluates the expression
+ */
+enum class Mode
+{
+    TASKFLOW, ///< Run the taskflow graph on the executor
+    INLINE,   ///< Evaluate the expression sequentially on the calling thread
+    AUTO      ///< Inline for small expressions (up to INLINE_MAX_TERMS terms), taskflow otherwise
+};
+
+constexpr std::size_t INLINE_MAX_TERMS = 64; ///< Max terms of an expression evaluated inline in Mode::AUTO
+
+/**
+ * @brief Get the executor shared by all the controllers, with one thread per hardware thread
+ *
+ * @return std::shared_ptr<tf::Executor>
+ */
+std::shared_ptr<tf::Executor> sharedExecutor();
+
 class Controller final : public IController
 {
 private:
@@ -22,10 +43,14 @@ private:
     std::unordered_set<std::string> m_traceables;                          ///< Traceables
     base::Expression m_expression;                                         ///< Expression
 
-    tf::Taskflow m_tf;       ///< Taskflow
-    tf::Executor m_executor; ///< Executor
+    tf::Taskflow m_tf;                        ///< Taskflow
+    std::shared_ptr<tf::Executor> m_executor; ///< Executor, shared with other controllers
+
+    std::function<bool(base::Event&)> m_inline; ///< Sequential program, if set the taskflow is not used
+    std::function<void()> m_endCallback;        ///< End callback, called here in inline mode
 
     base::Event m_event; ///< Shared event between the tasks
+    bool m_tracing {false}; ///< Whether the tasks keep the traces, as the thread that ingests the events
 
 public:
     Controller() = delete;
@@ -39,19 +64,26 @@ public:
      * @param expression expression to build
      * @param traceables traceables expressions
      * @param endCallback callback to call when the expression is finished
+     * @param executor executor to run the taskflow, the shared executor if nullptr
+     * @param mode how the expression is evaluated
      */
     Controller(const base::Expression& expression,
                const std::unordered_set<std::string>& traceables,
-               const std::function<void()> endCallback = nullptr);
+               const std::function<void()> endCallback = nullptr,
+               std::shared_ptr<tf::Executor> executor = nullptr,
+               Mode mode = Mode::TASKFLOW);
 
     /**
      * @copydoc bk::IController::ingest
      */
-    void ingest(base::Event&& event) override
-    {
-        m_event = std::move(event);
-        m_executor.run(m_tf).wait();
-    }
+    void ingest(base::Event&& event) override;
+
+    /**
+     * @copydoc bk::IController::ingestBatch
+     *
+     * In taskflow mode the whole batch is a single submission to the executor, the graph is run once per event.
+     */
+    void ingestBatch(std::vector<base::Event>& events) override;
 
     /**
      * @copydoc bk::IController::ingestGet
@@ -105,7 +137,23 @@ public:
 
 class ControllerMaker : public IControllerMaker
 {
+private:
+    std::shared_ptr<tf::Executor> m_executor; ///< Executor shared by all the controllers created
+    Mode m_mode;                              ///< Evaluation mode of the controllers created
+
 public:
+    /**
+     * @brief Construct a new Controller Maker
+     *
+     * @param mode evaluation mode of the controllers
+     * @param executor executor shared by the controllers, the process wide one if nullptr
+     */
+    explicit ControllerMaker(Mode mode = Mode::AUTO, std::shared_ptr<tf::Executor> executor = nullptr)
+        : m_executor {executor ? std::move(executor) : sharedExecutor()}
+        , m_mode {mode}
+    {
+    }
+
     /**
      * @copydoc bk::IControllerMaker::create
      */
@@ -113,7 +161,7 @@ public:
                                         const std::unordered_set<std::string>& traceables,
                                         const std::function<void()>& endCallback) override
     {
-        return std::make_shared<Controller>(expression, traceables, endCallback);
+        return std::make_shared<Controller>(expression, traceables, endCallback, m_executor, m_mode);
     }
 };
 
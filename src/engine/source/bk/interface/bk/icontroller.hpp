@@ -5,6 +5,7 @@
 #include <memory>
 #include <string_view>
 #include <unordered_set>
+#include <vector>
 
 #include <base/baseTypes.hpp>
 #include <base/error.hpp>
@@ -45,6 +46,23 @@ public:
      */
     virtual base::Event ingestGet(base::Event&& event) = 0;
 
+    /**
+     * @brief Ingest a batch of events, each event is replaced by the result of processing it.
+     *
+     * The default implementation ingests the events one by one, backends can override it to amortize the cost of
+     * dispatching each event.
+     * @param events The events to ingest, in order.
+     * @note this method is not thread-safe and its blocking.
+     * @throw std::runtime_error if cannot ingest the data (e.g. the backend is not started, not thread-safe, etc.)
+     */
+    virtual void ingestBatch(std::vector<base::Event>& events)
+    {
+        for (auto& event : events)
+        {
+            event = ingestGet(std::move(event));
+        }
+    }
+
     /**
      * @brief Check if the backend is available to ingest data. i.e. if the backend is started and built correctly.
      *
@@ -52,6 +70,15 @@ public:
      */
     virtual bool isAviable() const = 0;
 
+    /**
+     * @brief Check if the backend can ingest events from several threads at once.
+     *
+     * A thread-safe backend keeps all the per-event state local to the ingesting thread, so one controller can be
+     * shared by all the workers instead of building one per worker.
+     * @return true if ingest, ingestGet and ingestBatch can be called concurrently. false otherwise.
+     */
+    virtual bool isThreadSafe() const { return false; }
+
     /**
      * @brief Start the backend.
      *
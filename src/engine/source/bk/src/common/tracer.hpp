@@ -1,7 +1,8 @@
-#ifndef _BK_RX_TRACER_HPP
-#define _BK_RX_TRACER_HPP
+#ifndef _BK_COMMON_TRACER_HPP
+#define _BK_COMMON_TRACER_HPP
 
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
@@ -9,10 +10,13 @@
 #include <bk/icontroller.hpp>
 #include <base/error.hpp>
 
-namespace bk::rx::detail
+namespace bk::detail
 {
 using Publisher = Subscriber;
 
+/**
+ * @brief Trace of a named expression, shared by all the backends
+ */
 class Tracer : public std::enable_shared_from_this<Tracer>
 {
 private:
@@ -91,6 +95,6 @@ public:
     }
 };
 
-} // namespace bk::rx::detail
+} // namespace bk::detail
 
-#endif // _BK_RX_TRACER_HPP
+#endif // _BK_COMMON_TRACER_HPP
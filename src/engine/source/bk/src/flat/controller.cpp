@@ -0,0 +1,83 @@
+#include "controller.hpp"
+
+#include <sstream>
+
+#include "programBuilder.hpp"
+#include "common/tracer.hpp"
+
+namespace bk::flat
+{
+
+class Controller::TracerImpl final : public detail::Tracer
+{
+};
+
+Controller::Controller(const base::Expression& expression,
+                       const std::unordered_set<std::string>& traceables,
+                       const std::function<void()>& endCallback)
+    : m_traceables {traceables}
+    , m_expression {expression}
+    , m_endCallback {endCallback}
+{
+    detail::ProgramBuilder builder;
+    std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
+    m_entry = builder.build(m_expression, m_program, traces, m_traceables);
+    for (auto& [name, trace] : traces)
+    {
+        m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
+    }
+}
+
+std::string Controller::printGraph() const
+{
+    auto target = [](Offset offset)
+    {
+        return offset == END_OF_PROGRAM ? std::string {"end"} : std::to_string(offset);
+    };
+
+    std::stringstream ss;
+    ss << "digraph G {\n";
+    ss << "  entry -> " << target(m_entry) << ";\n";
+    for (std::size_t i = 0; i < m_program.size(); ++i)
+    {
+        const auto& instruction = m_program[i];
+        ss << "  " << i << " [label=\"" << instruction.m_name << "\"];\n";
+        ss << "  " << i << " -> " << target(instruction.m_onSuccess) << " [label=\"success\"];\n";
+        ss << "  " << i << " -> " << target(instruction.m_onFailure) << " [label=\"failure\"];\n";
+    }
+    ss << "}\n";
+
+    return ss.str();
+}
+
+base::RespOrError<Subscription> Controller::subscribe(const std::string& traceable, const Subscriber& subscriber)
+{
+    auto it = m_traces.find(traceable);
+    if (it == m_traces.end())
+    {
+        return base::Error {"Traceable not found"};
+    }
+
+    return it->second->subscribe(subscriber);
+}
+
+void Controller::unsubscribe(const std::string& traceable, Subscription subscription)
+{
+    auto it = m_traces.find(traceable);
+    if (it == m_traces.end())
+    {
+        return;
+    }
+
+    it->second->unsubscribe(subscription);
+}
+
+void Controller::unsubscribeAll()
+{
+    for (auto& [name, trace] : m_traces)
+    {
+        trace->unsubscribeAll();
+    }
+}
+
+} // namespace bk::flat
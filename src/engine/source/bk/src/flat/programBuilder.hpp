@@ -0,0 +1,237 @@
+#ifndef _BK_FLAT_PROGRAMBUILDER_HPP
+#define _BK_FLAT_PROGRAMBUILDER_HPP
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+
+#include <bk/flat/controller.hpp>
+
+#include "common/tracer.hpp"
+
+namespace bk::flat::detail
+{
+using bk::detail::Publisher;
+using bk::detail::Tracer;
+
+/**
+ * @brief Compiles an expression into a flat program
+ *
+ * Each operation is compiled knowing where to continue on success and on failure, so only the terms emit
+ * instructions:
+ * - And: each operand continues to the next one on success and to the failure target on failure.
+ * - Or: each operand continues to the success target on success and to the next one on failure.
+ * - Chain and Broadcast: each operand continues to the next one, the last one to the success target.
+ * - Implication: the condition continues to the consequence on success, the consequence always succeeds.
+ *
+ * The operands are compiled from the last one, as their continuation must be known, and the program is reversed at
+ * the end so the evaluation mostly moves forward in memory. The traces are resolved first in the same order as the
+ * other backends, so each term publishes to the same traces.
+ */
+class ProgramBuilder
+{
+private:
+    struct BuildParams
+    {
+        Publisher publisher;
+        std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
+        const std::unordered_set<std::string>& traceables;
+        std::vector<Instruction>& program;
+        std::vector<Publisher> termPublishers; ///< Publisher of each term, in order of appearance
+    };
+
+    Offset emit(BuildParams& params, Instruction&& instruction)
+    {
+        if (params.program.size() >= END_OF_PROGRAM)
+        {
+            throw std::runtime_error {"Expression too large to be flattened"};
+        }
+
+        params.program.emplace_back(std::move(instruction));
+        return static_cast<Offset>(params.program.size() - 1);
+    }
+
+    Offset buildTerm(const base::Term<base::EngineOp>& term, Offset onSuccess, Offset onFailure, BuildParams& params)
+    {
+        auto publisher = std::move(params.termPublishers.back());
+        params.termPublishers.pop_back();
+
+        return emit(params,
+                    Instruction {.m_op = term.getFn(),
+                                 .m_trace = std::move(publisher),
+                                 .m_onSuccess = onSuccess,
+                                 .m_onFailure = onFailure,
+                                 .m_name = term.getName()});
+    }
+
+    Offset buildChain(const base::Operation& operation, Offset onSuccess, BuildParams& params)
+    {
+        const auto& operands = operation.getOperands();
+        auto next = onSuccess;
+        for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+        {
+            next = recBuild(*it, next, next, params);
+        }
+
+        return next;
+    }
+
+    Offset buildImplication(const base::Implication& implication,
+                            Offset onSuccess,
+                            Offset onFailure,
+                            BuildParams& params)
+    {
+        const auto& operands = implication.getOperands();
+        if (operands.size() != 2)
+        {
+            throw std::runtime_error {"Implication must have two operands"};
+        }
+
+        const auto then = recBuild(operands[1], onSuccess, onSuccess, params);
+        return recBuild(operands[0], then, onFailure, params);
+    }
+
+    Offset buildAnd(const base::And& andExpr, Offset onSuccess, Offset onFailure, BuildParams& params)
+    {
+        const auto& operands = andExpr.getOperands();
+        auto next = onSuccess;
+        for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+        {
+            next = recBuild(*it, next, onFailure, params);
+        }
+
+        return next;
+    }
+
+    Offset buildOr(const base::Or& orExpr, Offset onSuccess, Offset onFailure, BuildParams& params)
+    {
+        const auto& operands = orExpr.getOperands();
+        auto next = onFailure;
+        for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+        {
+            next = recBuild(*it, onSuccess, next, params);
+        }
+
+        return next;
+    }
+
+    void collectPublishers(const base::Expression& expression, BuildParams& params)
+    {
+        // Error if empty expression
+        if (expression == nullptr)
+        {
+            throw std::runtime_error {"Expression is null"};
+        }
+
+        // Create traceable if found and get the publisher function
+        auto traceIt = params.traceables.find(expression->getName());
+        if (traceIt != params.traceables.end())
+        {
+            if (params.traces.find(expression->getName()) == params.traces.end())
+            {
+                params.traces.emplace(expression->getName(), std::make_unique<Tracer>());
+            }
+
+            params.publisher = params.traces[expression->getName()]->publisher();
+        }
+
+        if (expression->isTerm())
+        {
+            params.termPublishers.emplace_back(params.publisher);
+        }
+        else if (expression->isOperation())
+        {
+            for (const auto& operand : expression->getPtr<base::Operation>()->getOperands())
+            {
+                collectPublishers(operand, params);
+            }
+        }
+    }
+
+    Offset recBuild(const base::Expression& expression, Offset onSuccess, Offset onFailure, BuildParams& params)
+    {
+        if (expression->isTerm())
+        {
+            return buildTerm(*expression->getPtr<base::Term<base::EngineOp>>(), onSuccess, onFailure, params);
+        }
+        else if (expression->isOperation())
+        {
+            if (expression->isBroadcast() || expression->isChain())
+            {
+                return buildChain(*expression->getPtr<base::Operation>(), onSuccess, params);
+            }
+            else if (expression->isImplication())
+            {
+                return buildImplication(*expression->getPtr<base::Implication>(), onSuccess, onFailure, params);
+            }
+            else if (expression->isAnd())
+            {
+                return buildAnd(*expression->getPtr<base::And>(), onSuccess, onFailure, params);
+            }
+            else if (expression->isOr())
+            {
+                return buildOr(*expression->getPtr<base::Or>(), onSuccess, onFailure, params);
+            }
+            else
+            {
+                throw std::runtime_error("Unsupported operation type");
+            }
+        }
+        else
+        {
+            throw std::runtime_error("Unsupported expression type");
+        }
+    }
+
+public:
+    virtual ~ProgramBuilder() = default;
+    ProgramBuilder() = default;
+
+    /**
+     * @brief Build the program of an expression
+     *
+     * @param expression Expression to build
+     * @param program Output program
+     * @param traces Output traces
+     * @param traceables Traceable expressions
+     * @return Offset First instruction of the program, END_OF_PROGRAM if the program is empty
+     */
+    Offset build(const base::Expression& expression,
+                 std::vector<Instruction>& program,
+                 std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
+                 const std::unordered_set<std::string>& traceables)
+    {
+        program.clear();
+        BuildParams params {.publisher = nullptr, .traces = traces, .traceables = traceables, .program = program};
+
+        // The terms are compiled from the last one, so the publishers are taken from the back
+        collectPublishers(expression, params);
+        const auto entry = recBuild(expression, END_OF_PROGRAM, END_OF_PROGRAM, params);
+
+        // Reverse the program, the entry is the last emitted instruction
+        const auto last = static_cast<Offset>(program.size() - 1);
+        auto remap = [last](Offset offset)
+        {
+            return offset == END_OF_PROGRAM ? END_OF_PROGRAM : last - offset;
+        };
+
+        for (auto& instruction : program)
+        {
+            instruction.m_onSuccess = remap(instruction.m_onSuccess);
+            instruction.m_onFailure = remap(instruction.m_onFailure);
+        }
+        std::reverse(program.begin(), program.end());
+
+        return remap(entry);
+    }
+};
+
+} // namespace bk::flat::detail
+
+#endif // _BK_FLAT_PROGRAMBUILDER_HPP
@@ -1,7 +1,7 @@
 #include "controller.hpp"
 
 #include "exprBuilder.hpp"
-#include "tracer.hpp"
+#include "common/tracer.hpp"
 
 namespace bk::rx
 {
@@ -7,10 +7,12 @@
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
 
-#include "tracer.hpp"
+#include "common/tracer.hpp"
 
 namespace bk::rx::detail
 {
+using bk::detail::Publisher;
+using bk::detail::Tracer;
 
 class ExprBuilder
 {
@@ -130,7 +132,7 @@ private:
                     // TODO: should we allow to not include tracer?
                     if (tracer != nullptr)
                     {
-                        tracer(std::string {result->trace()}, result->success());
+                        tracer(result->trace(), result->success());
                     }
                     return result;
                 });
@@ -1,7 +1,8 @@
 #include "controller.hpp"
 
 #include "exprBuilder.hpp"
-#include "tracer.hpp"
+#include "inlineBuilder.hpp"
+#include "common/tracer.hpp"
 namespace bk::taskf
 {
 
@@ -9,24 +10,98 @@ class Controller::TracerImpl final : public detail::Tracer
 {
 };
 
+std::shared_ptr<tf::Executor> sharedExecutor()
+{
+    static auto executor = std::make_shared<tf::Executor>();
+    return executor;
+}
+
 Controller::Controller(const base::Expression& expression,
                        const std::unordered_set<std::string>& traceables,
-                       const std::function<void()> endCallback)
+                       const std::function<void()> endCallback,
+                       std::shared_ptr<tf::Executor> executor,
+                       Mode mode)
     : m_tf()
-    , m_executor(1)
+    , m_executor(executor ? std::move(executor) : sharedExecutor())
     , m_event()
     , m_traceables(traceables)
     , m_expression(expression)
 {
-    detail::ExprBuilder builder;
     std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
-    builder.build(m_expression, m_tf, &m_event, traces, m_traceables, endCallback);
+
+    const auto isInline =
+        mode == Mode::INLINE
+        || (mode == Mode::AUTO && detail::InlineBuilder::countTerms(m_expression) <= INLINE_MAX_TERMS);
+    if (isInline)
+    {
+        detail::InlineBuilder builder;
+        m_inline = builder.build(m_expression, traces, m_traceables);
+        m_endCallback = endCallback;
+    }
+    else
+    {
+        detail::ExprBuilder builder;
+        builder.build(m_expression, m_tf, &m_event, &m_tracing, traces, m_traceables, endCallback);
+    }
+
     for (auto& [name, trace] : traces)
     {
         m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
     }
 }
 
+void Controller::ingest(base::Event&& event)
+{
+    m_event = std::move(event);
+    if (m_inline)
+    {
+        m_inline(m_event);
+        if (m_endCallback)
+        {
+            m_endCallback();
+        }
+        return;
+    }
+
+    m_tracing = base::result::tracing();
+    m_executor->run(m_tf).wait();
+}
+
+void Controller::ingestBatch(std::vector<base::Event>& events)
+{
+    if (m_inline)
+    {
+        for (auto& event : events)
+        {
+            ingest(std::move(event));
+            event = std::move(m_event);
+        }
+        return;
+    }
+
+    // The predicate is checked before each run, it stores the result of the previous event and loads the next one
+    m_tracing = base::result::tracing();
+    std::size_t next = 0;
+    m_executor
+        ->run_until(m_tf,
+                    [&]()
+                    {
+                        if (next > 0)
+                        {
+                            events[next - 1] = std::move(m_event);
+                        }
+
+                        if (next == events.size())
+                        {
+                            return true;
+                        }
+
+                        m_event = std::move(events[next++]);
+                        return false;
+                    })
+        .wait();
+}
+
 base::RespOrError<Subscription> Controller::subscribe(const std::string& traceable, const Subscriber& subscriber)
 {
     auto it = m_traces.find(traceable);
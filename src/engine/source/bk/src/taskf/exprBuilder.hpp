@@ -8,11 +8,14 @@
 
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
+#include <base/result.hpp>
 
-#include "tracer.hpp"
+#include "common/tracer.hpp"
 
 namespace bk::taskf::detail
 {
+using bk::detail::Publisher;
+using bk::detail::Tracer;
 
 class ITask
 {
@@ -51,14 +54,21 @@ private:
     base::EngineOp m_op;
     Publisher m_publisher;
     void* m_data;
+    const bool* m_tracing;
     tf::Taskflow& m_tf;
 
 public:
-    TaskTerm(base::EngineOp op, const std::string& name, Publisher publisher, void* data, tf::Taskflow& tf)
+    TaskTerm(base::EngineOp op,
+             const std::string& name,
+             Publisher publisher,
+             void* data,
+             const bool* tracing,
+             tf::Taskflow& tf)
         : ITask()
         , m_op(op)
         , m_publisher(publisher)
         , m_data(data)
+        , m_tracing(tracing)
         , m_tf(tf)
         , m_task(tf.placeholder().name(name))
     {
@@ -70,9 +80,11 @@ public:
     {
         assertConnect();
         m_task.work(
-            [fn = m_op, publisher = m_publisher, data = m_data]()
+            [fn = m_op, publisher = m_publisher, data = m_data, tracing = m_tracing]()
             {
                 auto& event = *static_cast<base::Event*>(data);
+                // The task runs on a worker thread, it traces as the thread that ingested the event
+                base::result::TracingScope scope {*tracing};
                 auto res = fn(event);
                 if (publisher)
                 {
@@ -274,6 +286,7 @@ private:
         tf::Taskflow& tf;
         Publisher publisher;
         void* data;
+        const bool* tracing;
         std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
         const std::unordered_set<std::string>& traceables;
     };
@@ -281,7 +294,8 @@ private:
     ComplexTask buildTerm(const base::Term<base::EngineOp>& term, BuildParams& params)
     {
         auto taskTerm =
-            std::make_shared<TaskTerm>(term.getFn(), term.getName(), params.publisher, params.data, params.tf);
+            std::make_shared<TaskTerm>(
+            term.getFn(), term.getName(), params.publisher, params.data, params.tracing, params.tf);
         return taskTerm;
     }
 
@@ -414,11 +428,17 @@ public:
     void build(const base::Expression& expression,
                tf::Taskflow& tf,
                void* data,
+               const bool* tracing,
                std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
                const std::unordered_set<std::string>& traceables,
                std::function<void()> endCallback = nullptr)
     {
-        BuildParams params {.tf = tf, .publisher = nullptr, .data = data, .traces = traces, .traceables = traceables};
+        BuildParams params {.tf = tf,
+                            .publisher = nullptr,
+                            .data = data,
+                            .tracing = tracing,
+                            .traces = traces,
+                            .traceables = traceables};
         // As complex task are not finished until output is connected we need to force the connection
         auto finalTask = recBuild(expression, params);
         auto output = tf.placeholder().name("output");
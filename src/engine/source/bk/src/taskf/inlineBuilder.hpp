@@ -0,0 +1,241 @@
+#ifndef _BK_TASKF_INLINEBUILDER_HPP
+#define _BK_TASKF_INLINEBUILDER_HPP
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+
+#include "common/tracer.hpp"
+
+namespace bk::taskf::detail
+{
+using bk::detail::Publisher;
+using bk::detail::Tracer;
+
+/**
+ * @brief Sequential program of an expression, returns true if the expression succeeded
+ */
+using InlineOp = std::function<bool(base::Event&)>;
+
+/**
+ * @brief Builds an expression into nested sequential calls, with the same semantics as the taskflow graph, so small
+ * policies are evaluated on the calling thread without the executor round-trip.
+ */
+class InlineBuilder
+{
+private:
+    struct BuildParams
+    {
+        Publisher publisher;
+        std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
+        const std::unordered_set<std::string>& traceables;
+    };
+
+    std::vector<InlineOp> buildOperands(const base::Operation& operation, BuildParams& params)
+    {
+        std::vector<InlineOp> operands;
+        operands.reserve(operation.getOperands().size());
+        for (const auto& operand : operation.getOperands())
+        {
+            operands.emplace_back(recBuild(operand, params));
+        }
+
+        return operands;
+    }
+
+    InlineOp buildTerm(const base::Term<base::EngineOp>& term, BuildParams& params)
+    {
+        return [fn = term.getFn(), publisher = params.publisher](base::Event& event)
+        {
+            auto res = fn(event);
+            if (publisher)
+            {
+                publisher(res.trace(), res.success());
+            }
+
+            return res.success();
+        };
+    }
+
+    InlineOp buildBroadcast(const base::Broadcast& broadcast, BuildParams& params)
+    {
+        return [operands = buildOperands(broadcast, params)](base::Event& event)
+        {
+            for (const auto& operand : operands)
+            {
+                operand(event);
+            }
+
+            return true;
+        };
+    }
+
+    InlineOp buildChain(const base::Chain& chain, BuildParams& params)
+    {
+        return [operands = buildOperands(chain, params)](base::Event& event)
+        {
+            for (const auto& operand : operands)
+            {
+                operand(event);
+            }
+
+            return true;
+        };
+    }
+
+    InlineOp buildImplication(const base::Implication& implication, BuildParams& params)
+    {
+        auto condition = recBuild(implication.getOperands()[0], params);
+        auto then = recBuild(implication.getOperands()[1], params);
+
+        return [condition, then](base::Event& event)
+        {
+            if (!condition(event))
+            {
+                return false;
+            }
+
+            then(event);
+            return true;
+        };
+    }
+
+    InlineOp buildAnd(const base::And& andExpr, BuildParams& params)
+    {
+        return [operands = buildOperands(andExpr, params)](base::Event& event)
+        {
+            for (const auto& operand : operands)
+            {
+                if (!operand(event))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+    }
+
+    InlineOp buildOr(const base::Or& orExpr, BuildParams& params)
+    {
+        return [operands = buildOperands(orExpr, params)](base::Event& event)
+        {
+            for (const auto& operand : operands)
+            {
+                if (operand(event))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+    }
+
+    InlineOp recBuild(const base::Expression& expression, BuildParams& params)
+    {
+        // Error if empty expression
+        if (expression == nullptr)
+        {
+            throw std::runtime_error {"Expression is null"};
+        }
+
+        // Create traceable if found and get the publisher function
+        auto traceIt = params.traceables.find(expression->getName());
+        if (traceIt != params.traceables.end())
+        {
+            if (params.traces.find(expression->getName()) == params.traces.end())
+            {
+                params.traces.emplace(expression->getName(), std::make_unique<Tracer>());
+            }
+
+            params.publisher = params.traces[expression->getName()]->publisher();
+        }
+
+        if (expression->isTerm())
+        {
+            return buildTerm(*expression->getPtr<base::Term<base::EngineOp>>(), params);
+        }
+        else if (expression->isOperation())
+        {
+            if (expression->isBroadcast())
+            {
+                return buildBroadcast(*expression->getPtr<base::Broadcast>(), params);
+            }
+            else if (expression->isChain())
+            {
+                return buildChain(*expression->getPtr<base::Chain>(), params);
+            }
+            else if (expression->isImplication())
+            {
+                return buildImplication(*expression->getPtr<base::Implication>(), params);
+            }
+            else if (expression->isAnd())
+            {
+                return buildAnd(*expression->getPtr<base::And>(), params);
+            }
+            else if (expression->isOr())
+            {
+                return buildOr(*expression->getPtr<base::Or>(), params);
+            }
+            else
+            {
+                throw std::runtime_error("Unsupported operation type");
+            }
+        }
+        else
+        {
+            throw std::runtime_error("Unsupported expression type");
+        }
+    }
+
+public:
+    virtual ~InlineBuilder() = default;
+    InlineBuilder() = default;
+
+    InlineOp build(const base::Expression& expression,
+                   std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
+                   const std::unordered_set<std::string>& traceables)
+    {
+        BuildParams params {.publisher = nullptr, .traces = traces, .traceables = traceables};
+        return recBuild(expression, params);
+    }
+
+    /**
+     * @brief Count the terms of an expression
+     *
+     * @param expression Expression to count
+     * @return std::size_t Number of terms
+     */
+    static std::size_t countTerms(const base::Expression& expression)
+    {
+        if (expression == nullptr)
+        {
+            return 0;
+        }
+
+        if (expression->isTerm())
+        {
+            return 1;
+        }
+
+        std::size_t count = 0;
+        if (expression->isOperation())
+        {
+            for (const auto& operand : expression->getPtr<base::Operation>()->getOperands())
+            {
+                count += countTerms(operand);
+            }
+        }
+
+        return count;
+    }
+};
+
+} // namespace bk::taskf::detail
+
+#endif // _BK_TASKF_INLINEBUILDER_HPP
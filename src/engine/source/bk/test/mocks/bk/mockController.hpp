@@ -14,6 +14,7 @@ public:
     MOCK_METHOD(void, ingest, (base::Event&&), (override));
     MOCK_METHOD(base::Event, ingestGet, (base::Event&&), (override));
     MOCK_METHOD(bool, isAviable, (), (const, override));
+    MOCK_METHOD(bool, isThreadSafe, (), (const, override));
     MOCK_METHOD(void, start, (), (override));
     MOCK_METHOD(void, stop, (), (override));
     MOCK_METHOD(std::string, printGraph, (), (const, override));
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <bk/flat/controller.hpp>
 #include <bk/rx/controller.hpp>
 #include <bk/taskf/controller.hpp>
 #include <bk/mockController.hpp> // Force mock compilation
@@ -73,6 +74,46 @@ TEST_P(PipelineTest, TfProcessTraces)
     GTEST_SKIP(); // TODO
 }
 
+TEST_P(PipelineTest, TfInlineProcessEvent)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+
+    auto counter = 0;
+    auto controller = bk::taskf::Controller(testExpression, {}, [&]() { ++counter; }, nullptr, bk::taskf::Mode::INLINE);
+    auto event = std::make_shared<json::Json>();
+    ASSERT_NO_THROW(event = controller.ingestGet(std::move(event)));
+
+    ASSERT_EQ(counter, 1) << "Only one event was sent but the end callback received more than one event";
+
+    expectedPath.check(event);
+}
+
+TEST_P(PipelineTest, TfProcessBatch)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+
+    for (auto mode : {bk::taskf::Mode::TASKFLOW, bk::taskf::Mode::INLINE})
+    {
+        auto counter = 0;
+        auto controller = bk::taskf::Controller(testExpression, {}, [&]() { ++counter; }, nullptr, mode);
+        std::vector<base::Event> events(3);
+        for (auto& event : events)
+        {
+            event = std::make_shared<json::Json>();
+        }
+
+        ASSERT_NO_THROW(controller.ingestBatch(events));
+
+        ASSERT_EQ(counter, static_cast<int>(events.size())) << "The end callback must be called once per event";
+        for (const auto& event : events)
+        {
+            expectedPath.check(event);
+        }
+    }
+}
+
 TEST_P(PipelineTest, RxProessEvent)
 {
     auto [name, expression, expectedPath] = GetParam();
@@ -85,6 +126,35 @@ TEST_P(PipelineTest, RxProcessTraces)
     GTEST_SKIP(); // TODO
 }
 
+TEST_P(PipelineTest, FlatProcessEvent)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+    buildIngestTest<bk::flat::Controller>(testExpression, expectedPath);
+}
+
+TEST_P(PipelineTest, FlatProcessBatch)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+
+    auto counter = 0;
+    auto controller = bk::flat::Controller(testExpression, {}, [&]() { ++counter; });
+    std::vector<base::Event> events(3);
+    for (auto& event : events)
+    {
+        event = std::make_shared<json::Json>();
+    }
+
+    ASSERT_NO_THROW(controller.ingestBatch(events));
+
+    ASSERT_EQ(counter, static_cast<int>(events.size())) << "The end callback must be called once per event";
+    for (const auto& event : events)
+    {
+        expectedPath.check(event);
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     BK,
     PipelineTest,
@@ -848,6 +918,7 @@ struct Subscriber
     void checkTraceActivation(Controller& controller, const std::vector<std::string>& expected)
     {
         auto event = std::make_shared<json::Json>();
+        base::result::TracingScope tracing;
         ASSERT_NO_THROW(controller.ingest(std::move(event)));
         ASSERT_EQ(traces, expected);
     }
@@ -867,6 +938,7 @@ TEST(BKTraceTest, Subscribe)
 {
     subscribeTest<bk::taskf::Controller>();
     subscribeTest<bk::rx::Controller>();
+    subscribeTest<bk::flat::Controller>();
 }
 
 template<typename Controller>
@@ -883,6 +955,7 @@ TEST(BKTraceTest, SubscribeTraceableNotFound)
 {
     subscribeTraceableNotFoundTest<bk::taskf::Controller>();
     subscribeTraceableNotFoundTest<bk::rx::Controller>();
+    subscribeTraceableNotFoundTest<bk::flat::Controller>();
 }
 
 template<typename Controller>
@@ -901,6 +974,7 @@ TEST(BKTraceTest, MultipleSubscribers)
 {
     multipleSubscribersTest<bk::taskf::Controller>();
     multipleSubscribersTest<bk::rx::Controller>();
+    multipleSubscribersTest<bk::flat::Controller>();
 }
 
 template<typename Controller>
@@ -918,6 +992,7 @@ TEST(BKTraceTest, Unsubscribe)
 {
     unsubscribeTest<bk::taskf::Controller>();
     unsubscribeTest<bk::rx::Controller>();
+    unsubscribeTest<bk::flat::Controller>();
 }
 
 template<typename Controller>
@@ -937,4 +1012,25 @@ TEST(BKTraceTest, UnsubscribeNotExists)
 {
     unsubscribeNotExistsTest<bk::taskf::Controller>();
     unsubscribeNotExistsTest<bk::rx::Controller>();
+    unsubscribeNotExistsTest<bk::flat::Controller>();
+}
+
+TEST(BKTraceTest, SubscribeInline)
+{
+    bk::taskf::Controller c(EasyExp::term("term", true), {"term"}, nullptr, nullptr, bk::taskf::Mode::INLINE);
+    Subscriber<bk::taskf::Controller> s;
+    auto subRes = c.subscribe("term", s.getSubscriber());
+    ASSERT_FALSE(base::isError(subRes)) << "Error subscribing: " << base::getError(subRes).message;
+    s.checkTraceActivation(c, {SUCCES_TRACE});
+}
+
+TEST(BKTaskfTest, AutoMode)
+{
+    auto counter = 0;
+    bk::taskf::ControllerMaker maker {bk::taskf::Mode::AUTO};
+    auto controller = maker.create(EasyExp::term("term", true), {}, [&]() { ++counter; });
+    auto event = controller->ingestGet(std::make_shared<json::Json>());
+
+    ASSERT_EQ(counter, 1);
+    ASSERT_EQ(event->getString("/0/name"), "term");
 }
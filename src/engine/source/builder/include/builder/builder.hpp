@@ -5,8 +5,10 @@
 
 #include <defs/idefinitions.hpp>
 #include <geo/imanager.hpp>
+#include <indexer/iindexerConnector.hpp>
 #include <kvdb/ikvdbmanager.hpp>
 #include <logpar/logpar.hpp>
+#include <metrics/iMetricsScope.hpp>
 #include <schemf/ischema.hpp>
 #include <schemf/ivalidator.hpp>
 #include <sockiface/isockFactory.hpp>
@@ -19,6 +21,29 @@
 namespace builder
 {
 
+namespace policy
+{
+class Asset;
+class BuildCache;
+} // namespace policy
+
+/**
+ * @brief Configuration of the file output stages
+ *
+ * In async mode the workers only queue the serialized events, a dedicated thread per file writes them in batches,
+ * so a slow disk does not stall the event processing until the buffer fills up. The writer thread also syncs and
+ * rotates the files, the last four options only apply in async mode.
+ */
+struct FileOutputOptions
+{
+    bool async = false;             ///< Write the events from a dedicated thread per file
+    size_t bufferSize = 64 * 1024;  ///< Max events waiting to be written, workers wait when it is full
+    size_t fsyncIntervalMs = 1000;  ///< Time between fsyncs of the written events, 0 to leave it to the OS
+    size_t maxFileSize = 0;         ///< Rotate the file when it reaches this size in bytes, 0 to disable
+    size_t rotateIntervalSec = 0;   ///< Rotate the file when it is older than this time, 0 to disable
+    std::shared_ptr<metricsManager::IMetricsScope> metricsScope = nullptr; ///< Writer metrics, nullptr to disable
+};
+
 struct BuilderDeps
 {
     size_t logparDebugLvl = 0;
@@ -29,6 +54,9 @@ struct BuilderDeps
     std::shared_ptr<sockiface::ISockFactory> sockFactory;
     std::shared_ptr<wazuhdb::IWDBManager> wdbManager;
     std::shared_ptr<geo::IManager> geoManager;
+    FileOutputOptions fileOutput;
+    std::shared_ptr<indexer::IIndexerConnector> indexerConnector; ///< Null if no indexer is configured
+    size_t buildThreads = 1; ///< Threads building the assets of a policy, 0 for one per hardware thread
 };
 
 class Builder final
@@ -42,7 +70,14 @@ private:
     std::shared_ptr<schemf::IValidator> m_schema;                    ///< Schema validator
     std::shared_ptr<defs::IDefinitionsBuilder> m_definitionsBuilder; ///< Definitions builder
 
-    std::shared_ptr<Registry> m_registry; ///< builders registry
+    std::shared_ptr<Registry> m_registry;              ///< builders registry
+    std::shared_ptr<policy::BuildCache> m_buildCache; ///< Assets and subgraphs of the previous builds
+    size_t m_buildThreads {1};                        ///< Threads building the assets of a policy
+
+    /**
+     * @brief Build an asset from the store, or get it from the build cache if its document did not change.
+     */
+    policy::Asset getAsset(const base::Name& name) const;
 
 public:
     Builder() = default;
@@ -55,6 +90,7 @@ public:
 
     std::shared_ptr<IPolicy> buildPolicy(const base::Name& name) const override;
     base::Expression buildAsset(const base::Name& name) const override;
+    std::optional<AssetDiscriminator> assetDiscriminator(const base::Name& name) const override;
 
     base::OptError validateIntegration(const json::Json& json, const std::string& namespaceId) const override;
     base::OptError validateAsset(const json::Json& json) const override;
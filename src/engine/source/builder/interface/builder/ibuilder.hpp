@@ -2,15 +2,28 @@
 #define _BUILDER2_IBUILDER_HPP
 
 #include <memory>
+#include <optional>
+#include <string>
 
 #include <builder/ipolicy.hpp>
 #include <base/error.hpp>
 #include <base/expression.hpp>
+#include <base/json.hpp>
 #include <base/name.hpp>
 
 namespace builder
 {
 
+/**
+ * @brief Exact value an asset requires in a field to succeed, taken from the first literal condition of its check
+ * stage.
+ */
+struct AssetDiscriminator
+{
+    std::string field; ///< Json pointer path of the field
+    json::Json value;  ///< Required value
+};
+
 /**
  * @brief Builder Interface for building Policies and Assets.
  *
@@ -36,6 +49,14 @@ public:
      * @return base::RespOrError<base::Expression> The asset expression or an error.
      */
     virtual base::Expression buildAsset(const base::Name& name) const = 0;
+
+    /**
+     * @brief Get the discriminator of an asset, a field value every event accepted by the asset has.
+     *
+     * @param name Name of the asset.
+     * @return std::optional<AssetDiscriminator> The discriminator, empty if the asset has none or it is not known.
+     */
+    virtual std::optional<AssetDiscriminator> assetDiscriminator(const base::Name& name) const { return std::nullopt; }
 };
 
 } // namespace builder
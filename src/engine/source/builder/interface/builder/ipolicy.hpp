@@ -42,6 +42,23 @@ public:
      */
     virtual const base::Expression& expression() const = 0;
 
+    /**
+     * @brief Get the expression of the decoders of the policy.
+     *
+     * The policies built with the same decoders share this expression. Running it and then postDecoders is the same as
+     * running the expression of the policy.
+     *
+     * @return base::Expression The decoders, null if the policy is not split
+     */
+    virtual base::Expression decoders() const { return nullptr; }
+
+    /**
+     * @brief Get the expression of the rules and outputs of the policy, run after the decoders.
+     *
+     * @return base::Expression The rules and outputs, null if the policy is not split
+     */
+    virtual base::Expression postDecoders() const { return nullptr; }
+
     /**
      * @brief Get the Graphivz Str object
      *
@@ -6,6 +6,7 @@
 
 #include "builders/ibuildCtx.hpp"
 #include "policy/assetBuilder.hpp"
+#include "policy/buildCache.hpp"
 #include "policy/factory.hpp"
 #include "policy/policy.hpp"
 #include "register.hpp"
@@ -25,6 +26,7 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
     : m_storeRead {storeRead}
     , m_schema {schema}
     , m_definitionsBuilder {definitionsBuilder}
+    , m_buildThreads {builderDeps.buildThreads}
 {
     if (!m_storeRead)
     {
@@ -46,6 +48,9 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
 
     detail::registerStageBuilders<Registry>(m_registry, builderDeps);
     detail::registerOpBuilders<Registry>(m_registry, builderDeps);
+
+    // Shared by the policies of all the routes, a rebuild only builds what changed in the store
+    m_buildCache = std::make_shared<policy::BuildCache>();
 }
 
 std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name) const
@@ -56,13 +61,18 @@ std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name) const
         throw std::runtime_error(base::getError(policyDoc).message);
     }
 
-    auto policy = std::make_shared<policy::Policy>(
-        base::getResponse<store::Doc>(policyDoc), m_storeRead, m_definitionsBuilder, m_registry, m_schema);
+    auto policy = std::make_shared<policy::Policy>(base::getResponse<store::Doc>(policyDoc),
+                                                   m_storeRead,
+                                                   m_definitionsBuilder,
+                                                   m_registry,
+                                                   m_schema,
+                                                   m_buildCache,
+                                                   m_buildThreads);
 
     return policy;
 }
 
-base::Expression Builder::buildAsset(const base::Name& name) const
+policy::Asset Builder::getAsset(const base::Name& name) const
 {
     auto assetDoc = store::utils::get(m_storeRead, name);
     if (base::isError(assetDoc))
@@ -70,15 +80,41 @@ base::Expression Builder::buildAsset(const base::Name& name) const
         throw std::runtime_error(base::getError(assetDoc).message);
     }
 
+    const auto& doc = base::getResponse<store::Doc>(assetDoc);
+    const auto hash = policy::BuildCache::hash(doc);
+    if (auto cached = m_buildCache->getAsset(name, hash))
+    {
+        return std::move(cached.value());
+    }
+
     auto buildCtx = std::make_shared<builders::BuildCtx>();
     buildCtx->setRegistry(m_registry);
     buildCtx->setValidator(m_schema);
     buildCtx->runState().trace = true;
 
     auto assetBuilder = std::make_shared<policy::AssetBuilder>(buildCtx, m_definitionsBuilder);
-    auto asset = (*assetBuilder)(base::getResponse<store::Doc>(assetDoc));
+    auto asset = (*assetBuilder)(doc);
+    asset.setHash(hash);
+    m_buildCache->putAsset(name, asset);
+
+    return asset;
+}
+
+base::Expression Builder::buildAsset(const base::Name& name) const
+{
+    return getAsset(name).expression();
+}
+
+std::optional<AssetDiscriminator> Builder::assetDiscriminator(const base::Name& name) const
+{
+    const auto asset = getAsset(name);
+    const auto& discriminator = asset.discriminator();
+    if (!discriminator)
+    {
+        return std::nullopt;
+    }
 
-    return asset.expression();
+    return AssetDiscriminator {.field = discriminator->field, .value = discriminator->value};
 }
 
 base::OptError Builder::validateIntegration(const json::Json& json, const std::string& namespaceId) const
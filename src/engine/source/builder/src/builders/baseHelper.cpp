@@ -58,7 +58,8 @@ namespace builder::builders
 OpBuilder buildType(const OpBuilder& builder,
                     const Reference& targetField,
                     const schemf::ValidationToken& validationToken,
-                    const schemf::IValidator& validator)
+                    const schemf::IValidator& validator,
+                    const std::shared_ptr<ValidationStats>& stats)
 {
     auto resp = validator.validate(targetField.dotPath(), validationToken);
     if (base::isError(resp))
@@ -68,6 +69,12 @@ OpBuilder buildType(const OpBuilder& builder,
 
     auto validation = base::getResponse<schemf::ValidationResult>(resp);
 
+    // Only map operations are validated at runtime
+    if (stats && std::holds_alternative<MapBuilder>(builder))
+    {
+        ++(validation.needsRuntimeValidation() ? stats->runtime : stats->buildTime);
+    }
+
     if (!validation.needsRuntimeValidation())
     {
         return builder;
@@ -259,8 +266,9 @@ base::Expression baseHelperBuilder(const std::string& helperName,
     base::Expression op;
     try
     {
-        auto finalBuilder =
-            toTransform(buildType(builder, targetField, validationToken, newBuildCtx->validator()), targetField);
+        auto typedBuilder = buildType(
+            builder, targetField, validationToken, newBuildCtx->validator(), newBuildCtx->validationStats());
+        auto finalBuilder = toTransform(typedBuilder, targetField);
 
         op = toExpression(finalBuilder(targetField, opArgs, newBuildCtx), name);
     }
@@ -9,7 +9,8 @@ namespace builder::builders
 OpBuilder buildType(const OpBuilder& builder,
                     const Reference& targetField,
                     const schemf::ValidationToken& validationToken,
-                    const schemf::IValidator& validator);
+                    const schemf::IValidator& validator,
+                    const std::shared_ptr<ValidationStats>& stats = nullptr);
 
 OpBuilder
 runType(const OpBuilder& builder, const Reference& targetField, const schemf::ValidationResult& validationResult);
@@ -22,6 +22,10 @@ private:
 
     std::shared_ptr<const schemf::ISchema> m_schema; // Schema
 
+    std::shared_ptr<RegexSets> m_regexSets; // Regex sets shared by the assets of the build
+
+    std::shared_ptr<ValidationStats> m_validationStats; // Schema validation counters
+
 public:
     BuildCtx()
     {
@@ -30,6 +34,8 @@ public:
         m_registry = nullptr;
         m_definitions = nullptr;
         m_schemaValidator = nullptr;
+        m_regexSets = std::make_shared<RegexSets>();
+        m_validationStats = std::make_shared<ValidationStats>();
     }
 
     ~BuildCtx() = default;
@@ -44,6 +50,8 @@ public:
         , m_registry(registry)
         , m_definitions(definitions)
         , m_schemaValidator(schemaValidator)
+        , m_regexSets(std::make_shared<RegexSets>())
+        , m_validationStats(std::make_shared<ValidationStats>())
     {
     }
 
@@ -72,6 +80,11 @@ public:
 
     inline std::shared_ptr<const RunState> runState() const override { return m_runState; }
     inline RunState& runState() { return *m_runState; }
+
+    inline std::shared_ptr<RegexSets> regexSets() const override { return m_regexSets; }
+
+    inline std::shared_ptr<ValidationStats> validationStats() const override { return m_validationStats; }
+    inline void setValidationStats(const std::shared_ptr<ValidationStats>& stats) { m_validationStats = stats; }
 };
 
 } // namespace builder::builders
@@ -9,6 +9,7 @@
 
 #include "builders.hpp"
 #include "iregistry.hpp"
+#include "regexSet.hpp"
 
 namespace builder::builders
 {
@@ -24,6 +25,16 @@ struct RunState
     bool check;   // Active/Inactive hard type enforcement mode
 };
 
+/**
+ * @brief Counters of the schema validations of the map operations built
+ *
+ */
+struct ValidationStats
+{
+    size_t buildTime; // Operations proven valid when built, without runtime validation
+    size_t runtime;   // Operations that validate their result on each event
+};
+
 /**
  * @brief Context for the builder
  *
@@ -56,6 +67,10 @@ public:
     virtual Context& context() = 0;
 
     virtual std::shared_ptr<const RunState> runState() const = 0;
+
+    virtual std::shared_ptr<RegexSets> regexSets() const = 0;
+
+    virtual std::shared_ptr<ValidationStats> validationStats() const = 0;
 };
 
 } // namespace builder::builders
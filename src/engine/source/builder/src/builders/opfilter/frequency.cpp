@@ -0,0 +1,324 @@
+#include "frequency.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include <fmt/format.h>
+
+namespace builder::builders::opfilter
+{
+
+namespace
+{
+constexpr std::size_t INITIAL_ENTRIES = 16; ///< Initial size of the table of a shard
+
+std::int64_t steadyNow()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+std::uint64_t hashKey(std::string_view key)
+{
+    const auto hash = static_cast<std::uint64_t>(std::hash<std::string_view> {}(key));
+    return hash == 0 ? 1 : hash;
+}
+
+std::size_t shardOf(std::uint64_t hash)
+{
+    // The high bits pick the shard, the low bits the position in its table
+    return static_cast<std::size_t>(hash >> 60) % FrequencyStore::SHARDS;
+}
+} // namespace
+
+FrequencyStore::FrequencyStore(std::chrono::milliseconds timeframe, std::size_t maxKeys, Clock clock)
+    : m_slotWidth {std::max<std::int64_t>(1, timeframe.count() / static_cast<std::int64_t>(SLOTS))}
+    , m_maxPerShard {std::max<std::size_t>(1, (maxKeys + SHARDS - 1) / SHARDS)}
+    , m_clock {clock ? std::move(clock) : Clock {steadyNow}}
+{
+    if (timeframe.count() <= 0)
+    {
+        throw std::runtime_error("The timeframe must be greater than 0");
+    }
+
+    const auto tick = m_clock() / m_slotWidth;
+    for (auto& shard : m_shards)
+    {
+        shard.entries.resize(INITIAL_ENTRIES, Entry {0, 0, {}});
+        shard.expired = tick;
+    }
+}
+
+std::size_t FrequencyStore::find(const Shard& shard, std::uint64_t hash) const
+{
+    const auto mask = shard.entries.size() - 1;
+    auto index = static_cast<std::size_t>(hash) & mask;
+    while (shard.entries[index].hash != 0 && shard.entries[index].hash != hash)
+    {
+        index = (index + 1) & mask;
+    }
+
+    return index;
+}
+
+// Backward shift deletion: the entries after the erased one that would not be reachable from their home position
+// anymore are moved back, so the table never needs tombstones.
+void FrequencyStore::erase(Shard& shard, std::size_t index)
+{
+    const auto mask = shard.entries.size() - 1;
+    auto hole = index;
+    auto next = index;
+    while (true)
+    {
+        next = (next + 1) & mask;
+        const auto hash = shard.entries[next].hash;
+        if (hash == 0)
+        {
+            break;
+        }
+
+        const auto home = static_cast<std::size_t>(hash) & mask;
+        const auto stays = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+        if (!stays)
+        {
+            shard.entries[hole] = shard.entries[next];
+            hole = next;
+        }
+    }
+
+    shard.entries[hole].hash = 0;
+    --shard.used;
+}
+
+void FrequencyStore::expire(Shard& shard, std::int64_t tick)
+{
+    if (tick <= shard.expired)
+    {
+        return;
+    }
+
+    // The bucket of a tick still holds the keys hit SLOTS ticks before, their window ends now unless they were hit
+    // again later, which put them in a newer bucket too.
+    const auto first = std::max(shard.expired + 1, tick - static_cast<std::int64_t>(SLOTS) + 1);
+    for (auto current = first; current <= tick; ++current)
+    {
+        auto& bucket = shard.wheel[static_cast<std::size_t>(current) % SLOTS];
+        for (const auto hash : bucket)
+        {
+            const auto index = find(shard, hash);
+            if (shard.entries[index].hash == hash
+                && shard.entries[index].tick <= tick - static_cast<std::int64_t>(SLOTS))
+            {
+                erase(shard, index);
+            }
+        }
+        bucket.clear();
+    }
+
+    shard.expired = tick;
+}
+
+std::optional<std::uint32_t> FrequencyStore::hit(std::string_view key)
+{
+    const auto hash = hashKey(key);
+    auto& shard = m_shards[shardOf(hash)];
+    const auto tick = m_clock() / m_slotWidth;
+    const auto slot = static_cast<std::size_t>(tick) % SLOTS;
+
+    std::lock_guard lock {shard.mutex};
+    expire(shard, tick);
+
+    auto index = find(shard, hash);
+    if (shard.entries[index].hash != hash)
+    {
+        if (shard.used >= m_maxPerShard)
+        {
+            return std::nullopt;
+        }
+
+        // Keep the load factor under 1/2, the probes stay short
+        if ((shard.used + 1) * 2 > shard.entries.size())
+        {
+            std::vector<Entry> old(shard.entries.size() * 2, Entry {0, 0, {}});
+            old.swap(shard.entries);
+            for (const auto& entry : old)
+            {
+                if (entry.hash != 0)
+                {
+                    shard.entries[find(shard, entry.hash)] = entry;
+                }
+            }
+            index = find(shard, hash);
+        }
+
+        shard.entries[index] = Entry {hash, tick, {}};
+        shard.wheel[slot].push_back(hash);
+        ++shard.used;
+    }
+    else if (shard.entries[index].tick != tick)
+    {
+        auto& entry = shard.entries[index];
+        if (tick - entry.tick >= static_cast<std::int64_t>(SLOTS))
+        {
+            entry.counts.fill(0);
+        }
+        else
+        {
+            for (auto stale = entry.tick + 1; stale <= tick; ++stale)
+            {
+                entry.counts[static_cast<std::size_t>(stale) % SLOTS] = 0;
+            }
+        }
+        entry.tick = tick;
+        shard.wheel[slot].push_back(hash);
+    }
+
+    auto& counts = shard.entries[index].counts;
+    ++counts[slot];
+    return std::accumulate(counts.begin(), counts.end(), std::uint32_t {0});
+}
+
+std::size_t FrequencyStore::size()
+{
+    const auto tick = m_clock() / m_slotWidth;
+    std::size_t total = 0;
+    for (auto& shard : m_shards)
+    {
+        std::lock_guard lock {shard.mutex};
+        expire(shard, tick);
+        total += shard.used;
+    }
+
+    return total;
+}
+
+std::shared_ptr<FrequencyStore> FrequencyStores::get(const std::string& key, std::chrono::milliseconds timeframe)
+{
+    std::lock_guard lock {m_mutex};
+
+    // The stores of the assets no longer built are forgotten here, the registry does not grow with the rebuilds
+    for (auto it = m_stores.begin(); it != m_stores.end();)
+    {
+        it = it->second.expired() ? m_stores.erase(it) : std::next(it);
+    }
+
+    auto& entry = m_stores[key];
+    auto store = entry.lock();
+    if (!store)
+    {
+        store = std::make_shared<FrequencyStore>(timeframe);
+        entry = store;
+    }
+
+    return store;
+}
+
+std::size_t FrequencyStores::size()
+{
+    std::lock_guard lock {m_mutex};
+    return std::count_if(m_stores.begin(), m_stores.end(), [](const auto& entry) { return !entry.second.expired(); });
+}
+
+FilterOp frequencyBuilder(const Reference& targetField,
+                          const std::vector<OpArg>& opArgs,
+                          const std::shared_ptr<const IBuildCtx>& buildCtx,
+                          const std::shared_ptr<FrequencyStores>& stores)
+{
+    utils::assertSize(opArgs, 2, utils::MAX_OP_ARGS);
+    utils::assertValue(opArgs, 0, 1);
+
+    const auto positive = [&opArgs](std::size_t i, const char* name)
+    {
+        const auto value = std::static_pointer_cast<Value>(opArgs[i])->value().getIntAsInt64();
+        if (!value || value.value() <= 0 || value.value() > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::runtime_error(fmt::format("Expected the {} to be a positive integer but got '{}'",
+                                                 name,
+                                                 std::static_pointer_cast<Value>(opArgs[i])->value().str()));
+        }
+        return value.value();
+    };
+    const auto threshold = static_cast<std::uint32_t>(positive(0, "threshold"));
+    const auto timeframe = std::chrono::seconds {positive(1, "timeframe")};
+
+    std::vector<json::FieldRef> keyFields {targetField.field()};
+    std::vector<std::string> keyNames {targetField.dotPath()};
+    for (std::size_t i = 2; i < opArgs.size(); ++i)
+    {
+        if (!opArgs[i]->isReference())
+        {
+            throw std::runtime_error(fmt::format("Expected argument {} to be a reference", i));
+        }
+        const auto& ref = *std::static_pointer_cast<Reference>(opArgs[i]);
+        keyFields.emplace_back(ref.field());
+        keyNames.emplace_back(ref.dotPath());
+    }
+
+    const auto& context = buildCtx->context();
+    const auto name = context.opName;
+    std::vector<std::string> notFoundTraces;
+    for (const auto& keyName : keyNames)
+    {
+        notFoundTraces.emplace_back(fmt::format("{} -> Failure: Key field '{}' not found", name, keyName));
+    }
+    const auto fullTrace = fmt::format("{} -> Failure: Too many keys counted, the event is not counted", name);
+    const auto belowTrace =
+        fmt::format("{} -> Failure: Expected {} events of the key in the timeframe but got ", name, threshold);
+    const auto successTrace = fmt::format("{} -> Success", name);
+
+    // The helper of an asset counts the events of all the workers, the name has the target and all the arguments
+    auto store = stores->get(fmt::format("{}/{}/{}", context.assetName, context.stageName, name), timeframe);
+
+    return [store,
+            threshold,
+            keyFields = std::move(keyFields),
+            notFoundTraces = std::move(notFoundTraces),
+            fullTrace,
+            belowTrace,
+            successTrace,
+            runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
+    {
+        std::string key;
+        for (std::size_t i = 0; i < keyFields.size(); ++i)
+        {
+            // The values are serialized, a string is quoted, so the separator can not be confused with them
+            auto value = event->str(keyFields[i]);
+            if (!value)
+            {
+                RETURN_FAILURE(runState, false, notFoundTraces[i]);
+            }
+            key.append(value.value()).push_back('|');
+        }
+
+        const auto count = store->hit(key);
+        if (!count)
+        {
+            RETURN_FAILURE(runState, false, fullTrace);
+        }
+
+        if (count.value() < threshold)
+        {
+            RETURN_FAILURE(runState, false, belowTrace + std::to_string(count.value()));
+        }
+
+        RETURN_SUCCESS(runState, true, successTrace);
+    };
+}
+
+FilterBuilder getFrequencyBuilder(const std::shared_ptr<FrequencyStores>& stores)
+{
+    if (!stores)
+    {
+        throw std::runtime_error("The frequency stores are null");
+    }
+
+    return [stores](const Reference& targetField,
+                    const std::vector<OpArg>& opArgs,
+                    const std::shared_ptr<const IBuildCtx>& buildCtx)
+    {
+        return frequencyBuilder(targetField, opArgs, buildCtx, stores);
+    };
+}
+
+} // namespace builder::builders::opfilter
@@ -0,0 +1,156 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_FREQUENCY_HPP
+#define _BUILDER_BUILDERS_OPFILTER_FREQUENCY_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "builders/types.hpp"
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Sliding-window event counters by key, the state of the frequency helper.
+ *
+ * The keys are spread over shards, each one with its own lock, so the workers only contend when they hit keys of the
+ * same shard. A shard is an open-addressing table of fixed-size entries, the 64-bit hash of the key and the counts of
+ * the last SLOTS sub-windows of the timeframe, so a lookup touches one or two cache lines. A timer
+ * wheel with one bucket per sub-window remembers which keys were hit in each one and frees the entries whose whole
+ * window expired. The number of keys is bounded: when a shard is full the new keys are not counted.
+ *
+ * Two keys with the same 64-bit hash share their counters.
+ */
+class FrequencyStore
+{
+public:
+    constexpr static std::size_t SLOTS = 8;                ///< Sub-windows of the timeframe
+    constexpr static std::size_t SHARDS = 16;              ///< Independently locked parts of the store
+    constexpr static std::size_t DEFAULT_MAX_KEYS = 65536; ///< Default max number of keys counted at the same time
+
+    /**
+     * @brief Monotonic time in milliseconds
+     */
+    using Clock = std::function<std::int64_t()>;
+
+    /**
+     * @brief Construct a new Frequency Store
+     *
+     * @param timeframe Length of the sliding window
+     * @param maxKeys Max number of keys counted at the same time
+     * @param clock Source of the time, the steady clock by default
+     */
+    explicit FrequencyStore(std::chrono::milliseconds timeframe,
+                            std::size_t maxKeys = DEFAULT_MAX_KEYS,
+                            Clock clock = {});
+
+    /**
+     * @brief Count an event of the key
+     *
+     * @param key Key of the event
+     * @return std::optional<std::uint32_t> Events of the key in the window, including this one. Empty if the key is
+     * new and its shard is full.
+     */
+    std::optional<std::uint32_t> hit(std::string_view key);
+
+    /**
+     * @brief Number of keys with events in the window. The shards free their expired keys when they are hit, this
+     * frees them in all the shards first.
+     */
+    std::size_t size();
+
+private:
+    struct Entry
+    {
+        std::uint64_t hash;                      ///< Hash of the key, 0 for an empty entry
+        std::int64_t tick;                       ///< Last sub-window with events
+        std::array<std::uint32_t, SLOTS> counts; ///< Events by sub-window, indexed by tick modulo SLOTS
+    };
+
+    struct alignas(64) Shard
+    {
+        std::mutex mutex;
+        std::vector<Entry> entries;                          ///< Open-addressing table, the size is a power of 2
+        std::size_t used {0};                                ///< Entries in use
+        std::array<std::vector<std::uint64_t>, SLOTS> wheel; ///< Hashes hit by sub-window, indexed by tick modulo SLOTS
+        std::int64_t expired {0};                            ///< Last tick whose expired entries were freed
+    };
+
+    std::int64_t m_slotWidth;  ///< Length of a sub-window in milliseconds
+    std::size_t m_maxPerShard; ///< Max entries in use by shard
+    Clock m_clock;             ///< Source of the time
+    std::array<Shard, SHARDS> m_shards;
+
+    std::size_t find(const Shard& shard, std::uint64_t hash) const;
+    void erase(Shard& shard, std::size_t index);
+    void expire(Shard& shard, std::int64_t tick);
+};
+
+/**
+ * @brief Frequency stores of the built frequency helpers, by asset and helper.
+ *
+ * Each router worker builds its own copy of a policy, the helpers of the same asset take the same store from the
+ * registry so the events of all the workers are counted together, and a rebuild of the asset keeps its counters. The
+ * registry does not own the stores, a store is freed with the last policy that uses it. It is thread safe.
+ */
+class FrequencyStores
+{
+private:
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<FrequencyStore>> m_stores; ///< By asset, stage and helper
+
+public:
+    /**
+     * @brief Get the store of a helper, created if no built helper uses it
+     *
+     * @param key Asset, stage and helper with its arguments
+     * @param timeframe Length of the sliding window of a new store
+     * @return std::shared_ptr<FrequencyStore>
+     */
+    std::shared_ptr<FrequencyStore> get(const std::string& key, std::chrono::milliseconds timeframe);
+
+    /**
+     * @brief Number of stores used by the built helpers
+     */
+    std::size_t size();
+};
+
+/**
+ * @brief Builds the frequency filter: counts the events by the value of the target field, and optionally the values of
+ * other fields, and passes when a key reaches the threshold inside the timeframe.
+ *
+ * field: frequency(threshold, timeframe, [$ref1, $ref2, ...])
+ *
+ * @param targetField Field of the key
+ * @param opArgs Threshold, a positive integer, the timeframe in seconds, a positive integer, and the other fields of
+ * the key as references
+ * @param buildCtx Build context
+ * @param stores Registry the counters of the helper are taken from
+ * @return FilterOp
+ *
+ * @throws std::runtime_error If the arguments are invalid
+ */
+FilterOp frequencyBuilder(const Reference& targetField,
+                          const std::vector<OpArg>& opArgs,
+                          const std::shared_ptr<const IBuildCtx>& buildCtx,
+                          const std::shared_ptr<FrequencyStores>& stores);
+
+/**
+ * @brief Get the builder of the frequency filter
+ *
+ * @param stores Registry of the counters, shared by all the builds of the builder
+ * @return FilterBuilder
+ */
+FilterBuilder getFrequencyBuilder(const std::shared_ptr<FrequencyStores>& stores);
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_FREQUENCY_HPP
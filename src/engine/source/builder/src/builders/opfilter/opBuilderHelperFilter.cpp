@@ -1,7 +1,10 @@
 #include "opBuilderHelperFilter.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <optional>
+#include <string_view>
+#include <unordered_map>
 #include <variant>
 
 #include <re2/re2.h>
@@ -43,6 +46,204 @@ enum class Type
     INT
 };
 
+/**
+ * @brief Get the typed slot of a field if the schema types it as any integer.
+ *
+ * @param targetField Reference of the field
+ * @param buildCtx Build context
+ * @return std::optional<size_t> Slot id, empty if the field is not an integer in the schema
+ */
+std::optional<size_t> getIntTypedSlot(const Reference& targetField, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    if (!buildCtx->validator().hasField(targetField.dotPath()))
+    {
+        return std::nullopt;
+    }
+
+    switch (buildCtx->validator().getType(targetField.dotPath()))
+    {
+        case schemf::Type::BYTE:
+        case schemf::Type::SHORT:
+        case schemf::Type::INTEGER:
+        case schemf::Type::LONG: return json::Json::typedSlotId(targetField.jsonPath());
+        default: return std::nullopt;
+    }
+}
+
+/**
+ * @brief Starts with comparison, the operators that are not in <functional>
+ */
+struct StartsWith
+{
+    bool operator()(std::string_view l, std::string_view r) const { return l.substr(0, r.length()) == r; }
+};
+
+/**
+ * @brief Contains comparison, an empty string is not contained
+ */
+struct Contains
+{
+    bool operator()(std::string_view l, std::string_view r) const
+    {
+        return !r.empty() && l.find(r) != std::string_view::npos;
+    }
+};
+
+/**
+ * @brief Call fn with the function object of an order operator, so each operator gets its own instantiation
+ *
+ * @throws std::runtime_error if the operator is not an order operator
+ */
+template<typename Fn>
+FilterOp withOrderOperator(Operator op, Fn&& fn)
+{
+    switch (op)
+    {
+        case Operator::EQ: return fn(std::equal_to<> {});
+        case Operator::NE: return fn(std::not_equal_to<> {});
+        case Operator::GT: return fn(std::greater<> {});
+        case Operator::GE: return fn(std::greater_equal<> {});
+        case Operator::LT: return fn(std::less<> {});
+        case Operator::LE: return fn(std::less_equal<> {});
+        default:
+            throw std::runtime_error(fmt::format("Comparison helper: Operator '{}' not supported", static_cast<int>(op)));
+    }
+}
+
+/**
+ * @brief Call fn with the function object of a string operator, so each operator gets its own instantiation
+ */
+template<typename Fn>
+FilterOp withStringOperator(Operator op, Fn&& fn)
+{
+    switch (op)
+    {
+        case Operator::ST: return fn(StartsWith {});
+        case Operator::CN: return fn(Contains {});
+        default: return withOrderOperator(op, std::forward<Fn>(fn));
+    }
+}
+
+/**
+ * @brief Tracing messages of the comparison helpers
+ */
+struct CmpTraces
+{
+    std::string success;
+    std::string targetNotFound;
+    std::string referenceNotFound;
+    std::string isFalse;
+
+    CmpTraces(const std::string& name, const std::string& targetPath)
+        : success {fmt::format("[{}] -> Success", name)}
+        , targetNotFound {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetPath)}
+        , referenceNotFound {fmt::format("[{}] -> Failure: Reference not found", name)}
+        , isFalse {fmt::format("[{}] -> Failure: Comparison is false", name)}
+    {
+    }
+};
+
+/**
+ * @brief Closure of an integer comparison, instantiated for each operator and kind of right parameter
+ *
+ * The kind of the parameter and the operator are resolved at build time, the closure has no branch on them.
+ *
+ * @tparam Cmp Function object of the operator
+ * @tparam RightIsRef Whether the right parameter is a reference (its field) or a value (the integer)
+ */
+template<typename Cmp, bool RightIsRef>
+FilterOp intCmpClosure(json::FieldRef targetField,
+                       std::optional<size_t> typedSlot,
+                       std::conditional_t<RightIsRef, json::FieldRef, int64_t> rValue,
+                       std::shared_ptr<const CmpTraces> traces,
+                       std::shared_ptr<const RunState> runState)
+{
+    return [=](base::ConstEvent event) -> FilterResult
+    {
+        // Fields typed as integers by the schema keep their value in a typed slot of the event
+        auto lValue = typedSlot ? event->getTypedSlot(typedSlot.value()) : std::nullopt;
+        if (!lValue.has_value())
+        {
+            lValue = event->getIntAsInt64(targetField);
+            if (!lValue.has_value())
+            {
+                RETURN_FAILURE(runState, false, traces->targetNotFound);
+            }
+            if (typedSlot)
+            {
+                event->setTypedSlot(typedSlot.value(), lValue.value());
+            }
+        }
+
+        int64_t resolvedValue {0};
+        if constexpr (RightIsRef)
+        {
+            const auto resolvedRValue = event->getIntAsInt64(rValue);
+            if (!resolvedRValue.has_value())
+            {
+                RETURN_FAILURE(runState, false, traces->referenceNotFound);
+            }
+            resolvedValue = resolvedRValue.value();
+        }
+        else
+        {
+            resolvedValue = rValue;
+        }
+
+        if (Cmp {}(lValue.value(), resolvedValue))
+        {
+            RETURN_SUCCESS(runState, true, traces->success);
+        }
+        RETURN_FAILURE(runState, false, traces->isFalse);
+    };
+}
+
+/**
+ * @brief Closure of a string comparison, instantiated for each operator and kind of right parameter
+ *
+ * The strings are compared in place in the event, without copies. The kind of the parameter and the operator are
+ * resolved at build time, the closure has no branch on them.
+ *
+ * @tparam Cmp Function object of the operator
+ * @tparam RightIsRef Whether the right parameter is a reference (its field) or a value (the string)
+ */
+template<typename Cmp, bool RightIsRef>
+FilterOp stringCmpClosure(json::FieldRef targetField,
+                          std::conditional_t<RightIsRef, json::FieldRef, std::string> rValue,
+                          std::shared_ptr<const CmpTraces> traces,
+                          std::shared_ptr<const RunState> runState)
+{
+    return [=](base::ConstEvent event) -> FilterResult
+    {
+        const auto lValue = event->getStringView(targetField);
+        if (!lValue.has_value())
+        {
+            RETURN_FAILURE(runState, false, traces->targetNotFound);
+        }
+
+        std::string_view resolvedValue {};
+        if constexpr (RightIsRef)
+        {
+            const auto resolvedRValue = event->getStringView(rValue);
+            if (!resolvedRValue.has_value())
+            {
+                RETURN_FAILURE(runState, false, traces->referenceNotFound);
+            }
+            resolvedValue = resolvedRValue.value();
+        }
+        else
+        {
+            resolvedValue = rValue;
+        }
+
+        if (Cmp {}(lValue.value(), resolvedValue))
+        {
+            RETURN_SUCCESS(runState, true, traces->success);
+        }
+        RETURN_FAILURE(runState, false, traces->isFalse);
+    };
+}
+
 /**
  * @brief Get the Int Cmp Function object
  *
@@ -55,13 +256,13 @@ enum class Type
  *   - if the right parameter is a value and not a valid integer
  *   - if helper::base::Parameter::Type is not supported
  */
-FilterOp getIntCmpFunction(const std::string& targetField,
+FilterOp getIntCmpFunction(const Reference& targetField,
                            Operator op,
                            const OpArg& rightParameter,
                            const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     // Depending on rValue type we store the reference or the integer value
-    std::variant<std::string, int64_t> rValue {};
+    std::variant<int64_t, json::FieldRef> rValue {};
 
     if (rightParameter->isValue())
     {
@@ -87,97 +288,25 @@ FilterOp getIntCmpFunction(const std::string& targetField,
                             ref->dotPath(),
                             schemf::typeToStr(buildCtx->validator().getType(ref->dotPath()))));
         }
-        rValue = std::static_pointer_cast<Reference>(rightParameter)->jsonPath();
+        rValue = ref->field();
     }
 
-    // Depending on the operator we return the correct function
-    std::function<bool(int64_t l, int64_t r)> cmpFunction;
-    switch (op)
-    {
-        case Operator::EQ:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l == r;
-            };
-            break;
-        case Operator::NE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l != r;
-            };
-            break;
-        case Operator::GT:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l > r;
-            };
-            break;
-        case Operator::GE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l >= r;
-            };
-            break;
-        case Operator::LT:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l < r;
-            };
-            break;
-        case Operator::LE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l <= r;
-            };
-            break;
-        default: break;
-    }
+    const auto typedSlot = getIntTypedSlot(targetField, buildCtx);
+    const auto traces = std::make_shared<const CmpTraces>(buildCtx->context().opName, targetField.jsonPath());
 
-    // Tracing messages
-    const auto name = buildCtx->context().opName;
-    const auto successTrace {fmt::format("[{}] -> Success", name)};
-
-    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
-    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
-
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
-    {
-        // We assert that references exists, checking if the optional from Json getter is
-        // empty ot not. Then if is a reference we get the value from the event, otherwise
-        // we get the value from the parameter
-
-        auto lValue = event->getIntAsInt64(targetField);
-        if (!lValue.has_value())
-        {
-            RETURN_FAILURE(runState, false, failureTrace1);
-        }
-
-        int64_t resolvedValue {0};
-        if (std::holds_alternative<std::string>(rValue))
+    return withOrderOperator(
+        op,
+        [&](auto cmp) -> FilterOp
         {
-            auto resolvedRValue = event->getIntAsInt64(std::get<std::string>(rValue));
-            if (!resolvedRValue.has_value())
+            using Cmp = decltype(cmp);
+            if (std::holds_alternative<json::FieldRef>(rValue))
             {
-                RETURN_FAILURE(runState, false, failureTrace2);
+                return intCmpClosure<Cmp, true>(
+                    targetField.field(), typedSlot, std::get<json::FieldRef>(rValue), traces, buildCtx->runState());
             }
-            resolvedValue = resolvedRValue.value();
-        }
-        else
-        {
-            resolvedValue = std::get<int64_t>(rValue);
-        }
-
-        if (cmpFunction(lValue.value(), resolvedValue))
-        {
-            RETURN_SUCCESS(runState, true, successTrace);
-        }
-        else
-        {
-            RETURN_FAILURE(runState, false, failureTrace3);
-        }
-    };
+            return intCmpClosure<Cmp, false>(
+                targetField.field(), typedSlot, std::get<int64_t>(rValue), traces, buildCtx->runState());
+        });
 }
 
 /**
@@ -186,76 +315,15 @@ FilterOp getIntCmpFunction(const std::string& targetField,
  * @param targetField Reference of the field to compare, obtained from the YAML key
  * @param op Operator to use
  * @param rightParameter Right parameter to compare, obtained from the YAML value
- * @param name Formatted name of the helper
  * @return std::function<FilterResult(base::Event)>
  *
  * @throws std::runtime_error if helper::base::Parameter::Type is not supported
  */
-FilterOp getStringCmpFunction(const std::string& targetField,
+FilterOp getStringCmpFunction(const Reference& targetField,
                               Operator op,
                               const OpArg& rightParameter,
                               const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    // Depending on the operator we return the correct function
-    std::function<bool(const std::string& l, const std::string& r)> cmpFunction;
-    switch (op)
-    {
-        case Operator::EQ:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l == r;
-            };
-            break;
-        case Operator::NE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l != r;
-            };
-            break;
-        case Operator::GT:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l > r;
-            };
-            break;
-        case Operator::GE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l >= r;
-            };
-            break;
-        case Operator::LT:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l < r;
-            };
-            break;
-        case Operator::LE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l <= r;
-            };
-            break;
-        case Operator::ST:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l.substr(0, r.length()) == r;
-            };
-            break;
-        case Operator::CN:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                if (!r.empty())
-                {
-                    return l.find(r) != std::string::npos;
-                }
-                return false;
-            };
-            break;
-
-        default: break;
-    }
-
     if (rightParameter->isValue())
     {
         if (!std::static_pointer_cast<Value>(rightParameter)->value().isString())
@@ -281,53 +349,26 @@ FilterOp getStringCmpFunction(const std::string& targetField,
         }
     }
 
-    // Tracing messages
-    const auto name = buildCtx->context().opName;
-    const auto successTrace {fmt::format("[{}] -> Success", name)};
-
-    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
-    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
+    const auto traces = std::make_shared<const CmpTraces>(buildCtx->context().opName, targetField.jsonPath());
 
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
-    {
-        // We assert that references exists, checking if the optional from Json getter is
-        // empty ot not. Then if is a reference we get the value from the event, otherwise
-        // we get the value from the parameter
-
-        const auto lValue {event->getString(targetField)};
-        if (!lValue.has_value())
+    return withStringOperator(
+        op,
+        [&](auto cmp) -> FilterOp
         {
-            RETURN_FAILURE(runState, false, failureTrace1);
-        }
-
-        std::string rValue {};
-        if (rightParameter->isValue())
-        {
-            rValue = std::static_pointer_cast<Value>(rightParameter)->value().getString().value();
-        }
-        else
-        {
-            const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
-            if (!resolvedRValue.has_value())
+            using Cmp = decltype(cmp);
+            if (rightParameter->isReference())
             {
-                RETURN_FAILURE(runState, false, failureTrace2);
+                return stringCmpClosure<Cmp, true>(targetField.field(),
+                                                   std::static_pointer_cast<Reference>(rightParameter)->field(),
+                                                   traces,
+                                                   buildCtx->runState());
             }
-
-            rValue = resolvedRValue.value();
-        }
-
-        if (cmpFunction(lValue.value(), rValue))
-        {
-            RETURN_SUCCESS(runState, true, successTrace);
-        }
-        else
-        {
-            RETURN_FAILURE(runState, false, failureTrace3);
-        }
-    };
+            return stringCmpClosure<Cmp, false>(
+                targetField.field(),
+                std::static_pointer_cast<Value>(rightParameter)->value().getString().value(),
+                traces,
+                buildCtx->runState());
+        });
 }
 
 /**
@@ -338,7 +379,7 @@ FilterOp getStringCmpFunction(const std::string& targetField,
  * @param type Type of the comparison
  * @return base::Expression
  */
-FilterOp opBuilderComparison(const std::string& targetField,
+FilterOp opBuilderComparison(const Reference& targetField,
                              const std::vector<OpArg>& parameters,
                              Operator op,
                              Type t,
@@ -374,7 +415,7 @@ FilterOp opBuilderHelperIntEqual(const Reference& targetField,
                                  const std::vector<OpArg>& opArgs,
                                  const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::EQ, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::EQ, Type::INT, buildCtx);
     return op;
 }
 
@@ -383,7 +424,7 @@ FilterOp opBuilderHelperIntNotEqual(const Reference& targetField,
                                     const std::vector<OpArg>& opArgs,
                                     const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::NE, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::NE, Type::INT, buildCtx);
     return op;
 }
 
@@ -392,7 +433,7 @@ FilterOp opBuilderHelperIntLessThan(const Reference& targetField,
                                     const std::vector<OpArg>& opArgs,
                                     const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::LT, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::LT, Type::INT, buildCtx);
     return op;
 }
 
@@ -401,7 +442,7 @@ FilterOp opBuilderHelperIntLessThanEqual(const Reference& targetField,
                                          const std::vector<OpArg>& opArgs,
                                          const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::LE, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::LE, Type::INT, buildCtx);
     return op;
 }
 
@@ -410,7 +451,7 @@ FilterOp opBuilderHelperIntGreaterThan(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::GT, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::GT, Type::INT, buildCtx);
     return op;
 }
 
@@ -419,7 +460,7 @@ FilterOp opBuilderHelperIntGreaterThanEqual(const Reference& targetField,
                                             const std::vector<OpArg>& opArgs,
                                             const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::GE, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::GE, Type::INT, buildCtx);
     return op;
 }
 
@@ -432,7 +473,7 @@ FilterOp opBuilderHelperStringEqual(const Reference& targetField,
                                     const std::vector<OpArg>& opArgs,
                                     const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::EQ, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::EQ, Type::STRING, buildCtx);
     return op;
 }
 
@@ -441,7 +482,7 @@ FilterOp opBuilderHelperStringNotEqual(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::NE, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::NE, Type::STRING, buildCtx);
     return op;
 }
 
@@ -450,7 +491,7 @@ FilterOp opBuilderHelperStringGreaterThan(const Reference& targetField,
                                           const std::vector<OpArg>& opArgs,
                                           const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::GT, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::GT, Type::STRING, buildCtx);
     return op;
 }
 
@@ -459,7 +500,7 @@ FilterOp opBuilderHelperStringGreaterThanEqual(const Reference& targetField,
                                                const std::vector<OpArg>& opArgs,
                                                const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::GE, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::GE, Type::STRING, buildCtx);
     return op;
 }
 
@@ -468,7 +509,7 @@ FilterOp opBuilderHelperStringLessThan(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::LT, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::LT, Type::STRING, buildCtx);
     return op;
 }
 
@@ -477,7 +518,7 @@ FilterOp opBuilderHelperStringLessThanEqual(const Reference& targetField,
                                             const std::vector<OpArg>& opArgs,
                                             const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::LE, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::LE, Type::STRING, buildCtx);
     return op;
 }
 
@@ -486,7 +527,7 @@ FilterOp opBuilderHelperStringStarts(const Reference& targetField,
                                      const std::vector<OpArg>& opArgs,
                                      const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::ST, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::ST, Type::STRING, buildCtx);
     return op;
 }
 
@@ -495,7 +536,7 @@ FilterOp opBuilderHelperStringContains(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::CN, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::CN, Type::STRING, buildCtx);
     return op;
 }
 
@@ -610,6 +651,38 @@ FilterOp opBuilderHelperBinaryAnd(const Reference& targetField,
 //*               Regex filters                   *
 //*************************************************
 
+namespace
+{
+/**
+ * @brief Get the matcher of a regex, shared with the regex helpers of the build on the same field if possible.
+ *
+ * @param targetField Target field of the regex.
+ * @param value Regex pattern, already validated.
+ * @param buildCtx Build context.
+ * @return std::function<bool(std::string_view)> Partial match of the regex.
+ */
+std::function<bool(std::string_view)> getRegexMatcher(const Reference& targetField,
+                                                      const std::string& value,
+                                                      const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    auto regexSets = buildCtx->regexSets();
+    if (regexSets)
+    {
+        auto [regexSet, index] = regexSets->add(targetField.jsonPath(), value);
+        return [regexSet = regexSet, index = index](std::string_view input)
+        {
+            return regexSet->matches(input, index);
+        };
+    }
+
+    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
+    return [regex_ptr](std::string_view input)
+    {
+        return RE2::PartialMatch(input, *regex_ptr);
+    };
+}
+} // namespace
+
 // field: +regex_match/regexp
 FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
                                    const std::vector<OpArg>& opArgs,
@@ -622,11 +695,11 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
 
     auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
-    if (!regex_ptr->ok())
+    if (!RE2(value, RE2::Quiet).ok())
     {
         throw std::runtime_error(fmt::format("Invalid regex: \"{}\".", value));
     }
+    auto matcher = getRegexMatcher(targetField, value, buildCtx);
 
     // Tracing
     const auto name = buildCtx->context().opName;
@@ -637,7 +710,7 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
     const std::string failureTrace2 {fmt::format("[{}] -> Failure: Regex did not match", name)};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = targetField.field()](
                base::ConstEvent event) -> FilterResult
     {
         const auto resolvedField {event->getString(targetField)};
@@ -646,7 +719,7 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        if (RE2::PartialMatch(resolvedField.value(), *regex_ptr))
+        if (matcher(resolvedField.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -672,14 +745,14 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
     const auto name = buildCtx->context().opName;
     const auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
-    if (!regex_ptr->ok())
+    if (!RE2(value, RE2::Quiet).ok())
     {
         throw std::runtime_error(fmt::format("\"{}\" function: "
                                              "Invalid regex: \"{}\".",
                                              name,
                                              value));
     }
+    auto matcher = getRegexMatcher(targetField, value, buildCtx);
 
     // Tracing
     const auto successTrace {fmt::format("[{}] -> Success", name)};
@@ -689,7 +762,7 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
     const std::string failureTrace2 {fmt::format("[{}] -> Failure: Regex did match", name)};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = targetField.field()](
                base::ConstEvent event) -> FilterResult
     {
         const auto resolvedField {event->getString(targetField)};
@@ -698,7 +771,7 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        if (!RE2::PartialMatch(resolvedField.value(), *regex_ptr))
+        if (!matcher(resolvedField.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -757,6 +830,14 @@ FilterOp opBuilderHelperIPCIDR(const Reference& targetField,
     uint32_t net_lower {network & mask};
     uint32_t net_upper {net_lower | (~mask)};
 
+    // Fields typed as IP by the schema keep the parsed IPv4 address in a typed slot of the event
+    std::optional<size_t> typedSlot {};
+    if (buildCtx->validator().hasField(targetField.dotPath())
+        && buildCtx->validator().getType(targetField.dotPath()) == schemf::Type::IP)
+    {
+        typedSlot = json::Json::typedSlotId(targetField.jsonPath());
+    }
+
     // Tracing
     const std::string successTrace {fmt::format("[{}] -> Success", name)};
 
@@ -766,27 +847,42 @@ FilterOp opBuilderHelperIPCIDR(const Reference& targetField,
     const std::string failureTrace3 {fmt::format("[{}] -> Failure: IP address is not in CIDR", name)};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = targetField.field()](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
-        if (!resolvedField.has_value())
-        {
-            RETURN_FAILURE(runState, false, failureTrace1);
-        }
-
         uint32_t ip {};
-        try
+        const auto cached = typedSlot ? event->getTypedSlot(typedSlot.value()) : std::nullopt;
+        if (cached.has_value())
         {
-            ip = ::utils::ip::IPv4ToUInt(resolvedField.value());
+            ip = static_cast<uint32_t>(cached.value());
         }
-        catch (std::exception& e)
+        else
         {
-            RETURN_FAILURE(
-                runState,
-                false,
-                failureTrace2 + fmt::format("'{}' could not be converted to int: {}", resolvedField.value(), e.what()));
+            const auto resolvedField {event->getString(targetField)};
+            if (!resolvedField.has_value())
+            {
+                RETURN_FAILURE(runState, false, failureTrace1);
+            }
+
+            try
+            {
+                ip = ::utils::ip::IPv4ToUInt(resolvedField.value());
+            }
+            catch (std::exception& e)
+            {
+                RETURN_FAILURE(runState,
+                               false,
+                               failureTrace2
+                                   + fmt::format(
+                                       "'{}' could not be converted to int: {}", resolvedField.value(), e.what()));
+            }
+
+            if (typedSlot)
+            {
+                event->setTypedSlot(typedSlot.value(), ip);
+            }
         }
+
         if (net_lower <= ip && ip <= net_upper)
         {
             RETURN_SUCCESS(runState, true, successTrace);
@@ -798,6 +894,131 @@ FilterOp opBuilderHelperIPCIDR(const Reference& targetField,
     };
 }
 
+FilterOp ipCIDRSetFilter(const Reference& targetField,
+                         std::shared_ptr<const ::utils::ip::CIDRSet> cidrSet,
+                         const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    const auto name = buildCtx->context().opName;
+
+    // Fields typed as IP by the schema keep the parsed IPv4 address in a typed slot of the event
+    std::optional<size_t> typedSlot {};
+    if (buildCtx->validator().hasField(targetField.dotPath())
+        && buildCtx->validator().getType(targetField.dotPath()) == schemf::Type::IP)
+    {
+        typedSlot = json::Json::typedSlotId(targetField.jsonPath());
+    }
+
+    // Tracing
+    const std::string successTrace {fmt::format("[{}] -> Success", name)};
+    const std::string failureTrace1 {
+        fmt::format("[{}] -> Failure: Target field '{}' not found or not a string", name, targetField.dotPath())};
+    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Not a valid IP address", name)};
+    const std::string failureTrace3 {fmt::format("[{}] -> Failure: IP address is not in any CIDR of the set", name)};
+
+    // Return Op
+    return [=, runState = buildCtx->runState(), targetField = targetField.field()](
+               base::ConstEvent event) -> FilterResult
+    {
+        bool found {false};
+        const auto cached = typedSlot ? event->getTypedSlot(typedSlot.value()) : std::nullopt;
+        if (cached.has_value())
+        {
+            found = cidrSet->contains(static_cast<uint32_t>(cached.value()));
+        }
+        else
+        {
+            const auto resolvedField {event->getString(targetField)};
+            if (!resolvedField.has_value())
+            {
+                RETURN_FAILURE(runState, false, failureTrace1);
+            }
+
+            try
+            {
+                // Only IPv4 addresses are cached, the IPv6 ones are parsed by each helper
+                if (typedSlot && ::utils::ip::checkStrIsIPv4(resolvedField.value()))
+                {
+                    const auto ip = ::utils::ip::IPv4ToUInt(resolvedField.value());
+                    event->setTypedSlot(typedSlot.value(), ip);
+                    found = cidrSet->contains(ip);
+                }
+                else
+                {
+                    found = cidrSet->contains(resolvedField.value());
+                }
+            }
+            catch (const std::exception&)
+            {
+                RETURN_FAILURE(runState, false, failureTrace2);
+            }
+        }
+
+        if (found)
+        {
+            RETURN_SUCCESS(runState, true, successTrace);
+        }
+        RETURN_FAILURE(runState, false, failureTrace3);
+    };
+}
+
+// field: +ip_cidr_set_match/10.0.0.0/8/192.168.0.0/16/2001:db8::/32
+// field: +ip_cidr_set_match/$networks
+FilterOp opBuilderHelperIPCIDRSet(const Reference& targetField,
+                                  const std::vector<OpArg>& opArgs,
+                                  const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    // Assert expected number of parameters
+    utils::assertSize(opArgs, 1, utils::MAX_OP_ARGS);
+    // Parameter type check
+    utils::assertValue(opArgs);
+    // Format name for the tracer
+    const auto name = buildCtx->context().opName;
+
+    auto cidrSet = std::make_shared<::utils::ip::CIDRSet>();
+    auto addNetwork = [&](const json::Json& network)
+    {
+        const auto cidr = network.getString();
+        if (!cidr.has_value())
+        {
+            throw std::runtime_error(
+                fmt::format("\"{}\" function: Expected a network string but got '{}'", name, network.str()));
+        }
+
+        try
+        {
+            cidrSet->add(cidr.value());
+        }
+        catch (const std::exception& e)
+        {
+            throw std::runtime_error(fmt::format("\"{}\" function: {}", name, e.what()));
+        }
+    };
+
+    for (const auto& arg : opArgs)
+    {
+        const auto& value = std::static_pointer_cast<Value>(arg)->value();
+        if (value.isArray())
+        {
+            const auto networks = value.getArray().value();
+            for (const auto& network : networks)
+            {
+                addNetwork(network);
+            }
+        }
+        else
+        {
+            addNetwork(value);
+        }
+    }
+
+    if (cidrSet->size() == 0)
+    {
+        throw std::runtime_error(fmt::format("\"{}\" function: Expected at least one network", name));
+    }
+
+    return ipCIDRSetFilter(targetField, std::move(cidrSet), buildCtx);
+}
+
 FilterOp opBuilderHelperPublicIP(const Reference& targetField,
                                  const std::vector<OpArg>& opArgs,
                                  const std::shared_ptr<const IBuildCtx>& buildCtx)
@@ -830,7 +1051,7 @@ FilterOp opBuilderHelperPublicIP(const Reference& targetField,
     };
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = targetField.field()](
                base::ConstEvent event) -> FilterResult
     {
         const auto resolvedField {event->getString(targetField)};
@@ -856,6 +1077,126 @@ FilterOp opBuilderHelperPublicIP(const Reference& targetField,
 //*************************************************
 //*               Array filters                   *
 //*************************************************
+namespace
+{
+/**
+ * @brief Constant values of a helper compiled for membership checks. The scalars are hashed by their canonical key, the
+ * arrays and objects are compared one by one.
+ */
+class ValueSet
+{
+private:
+    std::unordered_map<std::string, std::size_t> m_keys; ///< Index of each distinct scalar
+    std::vector<json::Json> m_others;                    ///< Distinct arrays and objects
+
+public:
+    explicit ValueSet(const std::vector<json::Json>& values)
+    {
+        const json::FieldRef root {};
+        for (const auto& value : values)
+        {
+            if (auto key = value.scalarKey(root))
+            {
+                m_keys.emplace(std::move(key.value()), m_keys.size());
+            }
+            else if (std::find(m_others.begin(), m_others.end(), value) == m_others.end())
+            {
+                m_others.push_back(value);
+            }
+        }
+    }
+
+    /**
+     * @brief Number of distinct values
+     */
+    std::size_t size() const { return m_keys.size() + m_others.size(); }
+
+    /**
+     * @brief Check if the value of a field of the event is in the set
+     */
+    bool contains(const json::Json& event, const json::FieldRef& field) const
+    {
+        if (const auto key = event.scalarKey(field))
+        {
+            return m_keys.find(key.value()) != m_keys.end();
+        }
+
+        const auto value = event.getJson(field);
+        return value && std::find(m_others.begin(), m_others.end(), value.value()) != m_others.end();
+    }
+
+    /**
+     * @brief Number of distinct values of the set that are in the array of a field of the event
+     *
+     * @param stopAtFirst Stop at the first value found, the result is then 0 or 1
+     */
+    std::size_t countPresent(const json::Json& event, const json::FieldRef& array, bool stopAtFirst) const
+    {
+        std::size_t present = 0;
+        if (!m_keys.empty())
+        {
+            std::vector<bool> seen(stopAtFirst ? 0 : m_keys.size());
+            event.visitArrayKeys(array,
+                                 [&](const std::string& key)
+                                 {
+                                     const auto it = m_keys.find(key);
+                                     if (it == m_keys.end())
+                                     {
+                                         return false;
+                                     }
+                                     if (stopAtFirst)
+                                     {
+                                         present = 1;
+                                         return true;
+                                     }
+                                     if (!seen[it->second])
+                                     {
+                                         seen[it->second] = true;
+                                         ++present;
+                                     }
+                                     return present == m_keys.size();
+                                 });
+            if (stopAtFirst && present > 0)
+            {
+                return present;
+            }
+        }
+
+        for (const auto& other : m_others)
+        {
+            if (event.arrayContains(array, other).value_or(false))
+            {
+                ++present;
+                if (stopAtFirst)
+                {
+                    return present;
+                }
+            }
+        }
+
+        return present;
+    }
+};
+
+/**
+ * @brief Compile the parameters of an array helper when they are all values, the references are resolved per event.
+ */
+std::shared_ptr<const ValueSet> compileValues(const std::vector<OpArg>& opArgs)
+{
+    std::vector<json::Json> values;
+    for (const auto& arg : opArgs)
+    {
+        if (arg->isReference())
+        {
+            return nullptr;
+        }
+        values.push_back(std::static_pointer_cast<Value>(arg)->value());
+    }
+
+    return std::make_shared<const ValueSet>(values);
+}
+} // namespace
+
 FilterOp opBuilderHelperArrayPresence(const Reference& targetField,
                                       const std::vector<OpArg>& opArgs,
                                       bool atleastOne,
@@ -878,8 +1219,11 @@ FilterOp opBuilderHelperArrayPresence(const Reference& targetField,
                                                  targetField.dotPath(),
                                                  "does not contain at least one")};
 
+    // Constant parameters are looked up in a hash set, the cost does not depend on their number
+    const auto valueSet = compileValues(opArgs);
+
     // Return Op
-    return [=, parameters = opArgs, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, parameters = opArgs, runState = buildCtx->runState(), targetField = targetField.field()](
                base::ConstEvent event) -> FilterResult
     {
         if (!event->exists(targetField))
@@ -887,38 +1231,36 @@ FilterOp opBuilderHelperArrayPresence(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        const auto resolvedArray {event->getArray(targetField)};
-        if (!resolvedArray.has_value())
+        if (!event->isArray(targetField))
         {
             RETURN_FAILURE(runState, false, failureTrace2);
         }
 
-        json::Json cmpValue {};
-        auto successCount {0};
-        for (const auto& parameter : parameters)
+        if (valueSet)
         {
-            if (parameter->isReference())
+            const auto present = valueSet->countPresent(*event, targetField, atleastOne);
+            if (atleastOne ? present > 0 : present == valueSet->size())
             {
-                auto resolvedParameter {event->getJson(std::static_pointer_cast<Reference>(parameter)->jsonPath())};
-                if (resolvedParameter.has_value())
-                {
-                    cmpValue = std::move(resolvedParameter.value());
-                }
-                else
-                {
-                    continue;
-                }
+                RETURN_SUCCESS(runState, true, successTrace);
             }
-            else
+            RETURN_FAILURE(runState, false, failureTrace3);
+        }
+
+        auto successCount {0};
+        for (const auto& parameter : parameters)
+        {
+            // The array and the parameters are compared in place, none of them is copied
+            const auto contains =
+                parameter->isReference()
+                    ? event->arrayContains(targetField, std::static_pointer_cast<Reference>(parameter)->field())
+                    : event->arrayContains(targetField, std::static_pointer_cast<Value>(parameter)->value());
+            if (!contains.has_value())
             {
-                cmpValue = std::move(std::static_pointer_cast<Value>(parameter)->value().getJson().value());
+                continue;
             }
 
             // Check if the array contains the value, if so finish
-            if (std::find_if(resolvedArray.value().begin(),
-                             resolvedArray.value().end(),
-                             [&cmpValue](const json::Json& value) { return value == cmpValue; })
-                != resolvedArray.value().end())
+            if (contains.value())
             {
                 if (atleastOne)
                 {
@@ -959,8 +1301,11 @@ FilterOp opBuilderHelperArrayNotPresence(const Reference& targetField,
                                                  targetField.dotPath(),
                                                  "contain at least one")};
 
+    // Constant parameters are looked up in a hash set, the cost does not depend on their number
+    const auto valueSet = compileValues(opArgs);
+
     // Return Op
-    return [=, parameters = opArgs, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, parameters = opArgs, runState = buildCtx->runState(), targetField = targetField.field()](
                base::ConstEvent event) -> FilterResult
     {
         if (!event->exists(targetField))
@@ -968,38 +1313,36 @@ FilterOp opBuilderHelperArrayNotPresence(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        const auto resolvedArray {event->getArray(targetField)};
-        if (!resolvedArray.has_value())
+        if (!event->isArray(targetField))
         {
             RETURN_FAILURE(runState, false, failureTrace2);
         }
 
-        json::Json cmpValue {};
-        auto successCount {0};
-        for (const auto& parameter : parameters)
+        if (valueSet)
         {
-            if (parameter->isReference())
+            const auto present = valueSet->countPresent(*event, targetField, !atleastOne);
+            if (atleastOne ? present < valueSet->size() : present == 0)
             {
-                auto resolvedParameter {event->getJson(std::static_pointer_cast<Reference>(parameter)->jsonPath())};
-                if (resolvedParameter.has_value())
-                {
-                    cmpValue = std::move(resolvedParameter.value());
-                }
-                else
-                {
-                    continue;
-                }
+                RETURN_SUCCESS(runState, true, successTrace);
             }
-            else
+            RETURN_FAILURE(runState, false, failureTrace3);
+        }
+
+        auto successCount {0};
+        for (const auto& parameter : parameters)
+        {
+            // The array and the parameters are compared in place, none of them is copied
+            const auto contains =
+                parameter->isReference()
+                    ? event->arrayContains(targetField, std::static_pointer_cast<Reference>(parameter)->field())
+                    : event->arrayContains(targetField, std::static_pointer_cast<Value>(parameter)->value());
+            if (!contains.has_value())
             {
-                cmpValue = std::move(std::static_pointer_cast<Value>(parameter)->value().getJson().value());
+                continue;
             }
 
             // Check if the array contains the value, if so finish
-            if (std::find_if(resolvedArray.value().begin(),
-                             resolvedArray.value().end(),
-                             [&cmpValue](const json::Json& value) { return value == cmpValue; })
-                == resolvedArray.value().end())
+            if (!contains.value())
             {
                 if (atleastOne)
                 {
@@ -1081,7 +1424,7 @@ FilterOp typeMatcher(const Reference& targetField,
         fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField.dotPath());
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = targetField.field()](
                base::ConstEvent event) -> FilterResult
     {
         FilterResult result;
@@ -1242,8 +1585,16 @@ FilterOp opBuilderHelperMatchValue(const Reference& targetField,
     const std::string failureTrace4 {fmt::format("[{}] -> Failure: Reference is not an array", name)};
     const std::string failureTrace5 {fmt::format("[{}] -> Failure", name)};
 
+    // A constant array is looked up in a hash set, the cost does not depend on its size
+    std::shared_ptr<const ValueSet> valueSet;
+    if (opArgs[0]->isValue())
+    {
+        valueSet = std::make_shared<const ValueSet>(
+            std::static_pointer_cast<Value>(opArgs[0])->value().getArray().value());
+    }
+
     // Return op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath(), parameter = opArgs[0]](
+    return [=, runState = buildCtx->runState(), targetField = targetField.field(), parameter = opArgs[0]](
                base::ConstEvent event) -> FilterResult
     {
         if (!event->exists(targetField))
@@ -1251,6 +1602,15 @@ FilterOp opBuilderHelperMatchValue(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
+        if (valueSet)
+        {
+            if (valueSet->contains(*event, targetField))
+            {
+                RETURN_SUCCESS(runState, true, successTrace);
+            }
+            RETURN_FAILURE(runState, false, failureTrace5);
+        }
+
         // Get value
         json::Json cmpValue {};
         {
@@ -1274,31 +1634,21 @@ FilterOp opBuilderHelperMatchValue(const Reference& targetField,
                    != def.end();
         };
 
-        // Get array
-        if (parameter->isReference())
+        // Get array, the parameter is a reference
+        // TODO Should be 1 trace, if exist and is array, in all helers, no shearch for existance twice
+        const auto& refPath = std::static_pointer_cast<Reference>(parameter)->field();
+        if (!event->exists(refPath))
         {
-            // TODO Should be 1 trace, if exist and is array, in all helers, no shearch for existance twice
-            // Parameter is a reference
-            auto refPath = std::static_pointer_cast<Reference>(parameter)->jsonPath();
-            if (!event->exists(refPath))
-            {
-                RETURN_FAILURE(runState, false, failureTrace3);
-            }
-
-            if (!event->isArray(refPath))
-            {
-                RETURN_FAILURE(runState, false, failureTrace4);
-            }
-
-            isSuccess = searchCmpValue(event->getArray(refPath).value());
+            RETURN_FAILURE(runState, false, failureTrace3);
         }
-        else
+
+        if (!event->isArray(refPath))
         {
-            // Parameter is a value
-            auto value = std::static_pointer_cast<Value>(parameter)->value().getArray().value();
-            isSuccess = searchCmpValue(value);
+            RETURN_FAILURE(runState, false, failureTrace4);
         }
 
+        isSuccess = searchCmpValue(event->getArray(refPath).value());
+
         // Check if the array contains the value
         if (isSuccess)
         {
@@ -1358,7 +1708,7 @@ FilterOp opBuilderHelperMatchKey(const Reference& targetField,
         fmt::format("[{}] -> Failure: Object does not contain '{}'", name, targetField.dotPath())};
 
     // Return op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath(), parameter = opArgs[0]](
+    return [=, runState = buildCtx->runState(), targetField = targetField.field(), parameter = opArgs[0]](
                base::ConstEvent event) -> FilterResult
     {
         // Get key
@@ -1,6 +1,8 @@
 #ifndef _OP_BUILDER_HELPER_FILTER_H
 #define _OP_BUILDER_HELPER_FILTER_H
 
+#include <base/utils/ipUtils.hpp>
+
 #include "builders/types.hpp"
 
 /*
@@ -302,6 +304,35 @@ FilterOp opBuilderHelperIPCIDR(const Reference& targetField,
                                const std::vector<OpArg>& opArgs,
                                const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Create `ip_cidr_set_match` helper function that filters events if the field
+ * is in any of the specified IPv4 or IPv6 networks.
+ *
+ * The networks are compiled into a radix tree when the helper is built, so the cost of each event does not depend on
+ * the number of networks.
+ * @param targetField target field of the helper
+ * @param opArgs Networks (address/prefix), each argument is a string or an array of strings.
+ * @param buildCtx Shared pointer to the build context used for the conversion operation.
+ * @return FilterOp The lifter with the `ip_cidr_set_match` filter.
+ * @throw std::runtime_error if there is no network or a network is not valid.
+ */
+FilterOp opBuilderHelperIPCIDRSet(const Reference& targetField,
+                                  const std::vector<OpArg>& opArgs,
+                                  const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+/**
+ * @brief Build the filter of the IP CIDR set helpers, shared by the helpers that load the networks from different
+ * sources.
+ *
+ * @param targetField target field of the helper
+ * @param cidrSet Compiled networks
+ * @param buildCtx Shared pointer to the build context used for the conversion operation.
+ * @return FilterOp The filter, it passes if the field is an address in a network of the set.
+ */
+FilterOp ipCIDRSetFilter(const Reference& targetField,
+                         std::shared_ptr<const ::utils::ip::CIDRSet> cidrSet,
+                         const std::shared_ptr<const IBuildCtx>& buildCtx);
+
 /**
  * @brief Create `is_public_ip` helper function that filters events if the field
  * is a public IP address.
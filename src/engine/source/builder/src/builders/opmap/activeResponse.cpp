@@ -2,6 +2,7 @@
 
 // TODO: move the wazuhRequest to a common path such as "utils"
 #include <base/utils/wazuhProtocol/wazuhRequest.hpp>
+#include <sockiface/syncSockHandler.hpp>
 
 namespace builder::builders
 {
@@ -274,7 +275,8 @@ MapOp SendAR(std::shared_ptr<sockiface::ISockFactory> sockFactory,
     }
     const auto& rightParameter = opArgs[0];
 
-    auto socketAR = sockFactory->getHandler(Protocol::DATAGRAM, ar::AR_QUEUE_PATH);
+    // Shared by all the workers that run the route
+    auto socketAR = sockiface::makeSync(sockFactory->getHandler(Protocol::DATAGRAM, ar::AR_QUEUE_PATH));
 
     const auto& name = buildCtx->context().opName;
 
@@ -9,6 +9,7 @@
 #include <kvdb/ikvdbhandler.hpp>
 #include <base/utils/stringUtils.hpp>
 
+#include "builders/opfilter/opBuilderHelperFilter.hpp"
 #include "syntax.hpp"
 
 namespace builder::builders
@@ -147,17 +148,17 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
             resolvedKey = std::static_pointer_cast<const Value>(key)->value().getString().value();
         }
 
-        // Get value from KVDB
-        auto resultValue = kvdbHandler->get(resolvedKey);
-
-        if (base::isError(resultValue))
-        {
-            RETURN_FAILURE(runState, event, failureTrace4)
-        }
-
         try
         {
-            json::Json value {base::getResponse<std::string>(resultValue).c_str()};
+            // Get value from KVDB, the handler keeps the parsed values
+            auto resultValue = kvdbHandler->getJson(resolvedKey);
+
+            if (base::isError(resultValue))
+            {
+                RETURN_FAILURE(runState, event, failureTrace4)
+            }
+
+            const auto& value = *base::getResponse<std::shared_ptr<const json::Json>>(resultValue);
             if (validator != nullptr)
             {
                 auto res = validator(value);
@@ -319,6 +320,87 @@ FilterBuilder getOpBuilderKVDBNotMatch(std::shared_ptr<IKVDBManager> kvdbManager
     };
 }
 
+// <field>: +kvdb_ip_cidr_match/<DB>/<key>
+FilterBuilder getOpBuilderKVDBIPCIDRMatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
+{
+    return [kvdbManager, kvdbScopeName](const Reference& targetField,
+                                        const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx) -> FilterOp
+    {
+        if (!kvdbManager)
+        {
+            throw std::runtime_error("Got null KVDB manager");
+        }
+
+        // Verify parameters size and types
+        utils::assertSize(opArgs, 2);
+        utils::assertValue(opArgs, 0, 1);
+
+        const auto& dbArg = std::static_pointer_cast<Value>(opArgs[0])->value();
+        const auto& keyArg = std::static_pointer_cast<Value>(opArgs[1])->value();
+        if (!dbArg.isString())
+        {
+            throw std::runtime_error(
+                fmt::format("Expected db name 'string' as first argument but got '{}'", dbArg.str()));
+        }
+        if (!keyArg.isString())
+        {
+            throw std::runtime_error(fmt::format("Expected key 'string' as second argument but got '{}'", keyArg.str()));
+        }
+        const auto dbName = dbArg.getString().value();
+        const auto key = keyArg.getString().value();
+
+        // The networks are read and compiled once, when the asset is built
+        auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+        if (base::isError(resultHandler))
+        {
+            throw std::runtime_error(
+                fmt::format("Could not get KVDB handler: {}.", base::getError(resultHandler).message));
+        }
+        auto kvdbHandler = base::getResponse<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+
+        auto resultValue = kvdbHandler->get(key);
+        if (base::isError(resultValue))
+        {
+            throw std::runtime_error(
+                fmt::format("Could not get networks from KVDB: {}.", base::getError(resultValue).message));
+        }
+
+        json::Json networks;
+        try
+        {
+            networks = json::Json {base::getResponse<std::string>(resultValue).c_str()};
+        }
+        catch (const std::runtime_error& e)
+        {
+            throw std::runtime_error(fmt::format("Malformed JSON value for key '{}' in DB: {}", key, e.what()));
+        }
+
+        auto cidrSet = std::make_shared<::utils::ip::CIDRSet>();
+        const auto list = networks.isArray() ? networks.getArray().value() : std::vector<json::Json> {networks};
+        for (const auto& network : list)
+        {
+            const auto cidr = network.getString();
+            if (!cidr.has_value())
+            {
+                throw std::runtime_error(
+                    fmt::format("Expected a network string in key '{}' of DB but got '{}'", key, network.str()));
+            }
+
+            try
+            {
+                cidrSet->add(cidr.value());
+            }
+            catch (const std::exception& e)
+            {
+                throw std::runtime_error(fmt::format("Invalid network in key '{}' of DB: {}", key, e.what()));
+            }
+        }
+
+        return opfilter::ipCIDRSetFilter(targetField, std::move(cidrSet), buildCtx);
+    };
+}
+
 TransformOp KVDBSet(std::shared_ptr<IKVDBManager> kvdbManager,
                     const std::string& kvdbScopeName,
                     const Reference& targetField,
@@ -785,22 +867,23 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
             std::vector<json::Json> values;
             for (const auto& jKey : keys)
             {
-                auto resultValue = kvdbHandler->get(jKey.getString().value());
-                if (base::isError(resultValue))
-                {
-                    RETURN_FAILURE(runState, event, failureTrace3 + std::get<base::Error>(resultValue).message);
-                }
-
-                json::Json jValue;
+                base::RespOrError<std::shared_ptr<const json::Json>> resultValue;
                 try
                 {
-                    jValue = json::Json {std::get<std::string>(resultValue).c_str()};
+                    resultValue = kvdbHandler->getJson(jKey.getString().value());
                 }
                 catch (const std::runtime_error& e)
                 {
                     RETURN_FAILURE(runState, event, failureTrace4 + e.what());
                 }
 
+                if (base::isError(resultValue))
+                {
+                    RETURN_FAILURE(runState, event, failureTrace3 + std::get<base::Error>(resultValue).message);
+                }
+
+                json::Json jValue {*base::getResponse<std::shared_ptr<const json::Json>>(resultValue)};
+
                 if (first)
                 {
                     type = jValue.type();
@@ -93,6 +93,19 @@ FilterBuilder getOpBuilderKVDBMatch(std::shared_ptr<IKVDBManager> kvdbManager, c
  */
 FilterBuilder getOpBuilderKVDBNotMatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
 
+/**
+ * @brief Get the KVDB IP CIDR match function helper builder.
+ * <field>: +kvdb_ip_cidr_match/<DB>/<key>
+ *
+ * The value of the key is a network or an array of networks (address/prefix). The networks are compiled into a radix
+ * tree when the asset is built, later changes of the key apply when the asset is rebuilt.
+ *
+ * @param kvdbManager KVDB Manager
+ * @param kvdbScopeName KVDB Scope Name
+ * @return Builder
+ */
+FilterBuilder getOpBuilderKVDBIPCIDRMatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
+
 /**
  * @brief Get the KVDB Set function helper builder
  *
@@ -1,7 +1,10 @@
 #include "opBuilderHelperMap.hpp"
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
+#include <cstdint>
+#include <limits>
 #include <numeric>
 #include <optional>
 #include <string>
@@ -16,6 +19,7 @@
 
 #include <base/utils/ipUtils.hpp>
 #include <base/utils/stringUtils.hpp>
+#include <base/utils/timeUtils.hpp>
 
 #include "syntax.hpp"
 
@@ -120,26 +124,12 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
 
     const auto& rightParameter = opArgs[0];
 
-    // Depending on the operator we return the correct function
-    std::function<std::string(const std::string& value)> transformFunction;
+    // Depending on the operator we return the correct function, the string is converted in place
+    void (*transformFunction)(std::string&) = nullptr;
     switch (op)
     {
-        case StringOperator::UP:
-            transformFunction = [](const std::string& value)
-            {
-                std::string result;
-                std::transform(value.begin(), value.end(), std::back_inserter(result), ::toupper);
-                return result;
-            };
-            break;
-        case StringOperator::LO:
-            transformFunction = [](const std::string& value)
-            {
-                std::string result;
-                std::transform(value.begin(), value.end(), std::back_inserter(result), ::tolower);
-                return result;
-            };
-            break;
+        case StringOperator::UP: transformFunction = base::utils::string::toUpperAscii; break;
+        case StringOperator::LO: transformFunction = base::utils::string::toLowerAscii; break;
         default: break;
     }
 
@@ -148,42 +138,34 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
 
     const std::string failureTrace1 {fmt::format("[{}] -> Failure: Reference not found", name)};
 
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
+    // A value parameter is converted once, here, the closure only returns it
+    if (rightParameter->isValue())
     {
-        // We assert that references exists, checking if the optional from Json getter
-        // is empty ot not. Then if is a reference we get the value from the event,
-        // otherwise we get the value from the parameter
-
-        // REF
+        auto constResult = std::static_pointer_cast<Value>(rightParameter)->value().getString().value();
+        transformFunction(constResult);
+        json::Json result;
+        result.setString(constResult);
 
-        if (rightParameter->isReference())
+        return [result, successTrace, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
         {
-            const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
+            RETURN_SUCCESS(runState, result, successTrace);
+        };
+    }
 
-            if (!resolvedRValue.has_value())
-            {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
-            }
-            else
-            {
-                // TODO: should we check the result?
-                auto res {transformFunction(resolvedRValue.value())};
-                json::Json result;
-                result.setString(res);
-                RETURN_SUCCESS(runState, result, successTrace);
-            }
-        }
-        else
+    // Function that implements the helper for a reference
+    return [=, runState = buildCtx->runState(), field = std::static_pointer_cast<Reference>(rightParameter)->field()](
+               base::ConstEvent event) -> MapResult
+    {
+        auto resolvedRValue {event->getString(field)};
+        if (!resolvedRValue.has_value())
         {
-            // TODO: should we check the result?
-            const auto res {
-                transformFunction(std::static_pointer_cast<Value>(rightParameter)->value().getString().value())};
-            json::Json result;
-            result.setString(res);
-            RETURN_SUCCESS(runState, result, successTrace);
+            RETURN_FAILURE(runState, json::Json {}, failureTrace1);
         }
+
+        transformFunction(resolvedRValue.value());
+        json::Json result;
+        result.setString(resolvedRValue.value());
+        RETURN_SUCCESS(runState, result, successTrace);
     };
 }
 
@@ -363,10 +345,6 @@ MapOp opBuilderHelperIntTransformation(IntOperator op,
 
 std::optional<std::string> hashStringSHA1(std::string& input)
 {
-    // Sha1 digest len (20) * 2 (hex chars per byte)
-    constexpr int OS_SHA1_HEXDIGEST_SIZE = (SHA_DIGEST_LENGTH * 2);
-    constexpr int OS_SHA1_ARRAY_SIZE_LEN = OS_SHA1_HEXDIGEST_SIZE + 1;
-
     char* parameter = nullptr;
     unsigned char digest[EVP_MAX_MD_SIZE];
     unsigned int digest_size;
@@ -394,14 +372,7 @@ std::optional<std::string> hashStringSHA1(std::string& input)
     EVP_DigestFinal_ex(ctx, digest, &digest_size);
     EVP_MD_CTX_destroy(ctx);
 
-    // OS_SHA1_Hexdigest(digest, hexdigest);
-    char output[OS_SHA1_ARRAY_SIZE_LEN];
-    for (size_t n = 0; n < SHA_DIGEST_LENGTH; n++)
-    {
-        sprintf(&output[n * 2], "%02x", digest[n]);
-    }
-
-    return {output};
+    return base::utils::string::encodeHex({reinterpret_cast<const char*>(digest), SHA_DIGEST_LENGTH});
 }
 
 } // namespace
@@ -462,11 +433,12 @@ TransformOp opBuilderHelperStringTrim(const Reference& targetField,
         throw std::runtime_error(fmt::format("Expected 'string' parameter but got type '{}'",
                                              std::static_pointer_cast<Value>(opArgs[1])->value().typeName()));
     }
-    std::string trimChar {trimCharResp.value()};
-    if (trimChar.size() != 1)
+    if (trimCharResp.value().size() != 1)
     {
-        throw std::runtime_error(fmt::format("Expected parameter 2 to be a single character but got '{}'", trimChar));
+        throw std::runtime_error(
+            fmt::format("Expected parameter 2 to be a single character but got '{}'", trimCharResp.value()));
     }
+    const char trimChar {trimCharResp.value()[0]};
 
     // Format name for the tracer
     const auto name = buildCtx->context().opName;
@@ -480,7 +452,7 @@ TransformOp opBuilderHelperStringTrim(const Reference& targetField,
 
     // Return Op
     return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](base::Event event) -> TransformResult
+        [=, runState = buildCtx->runState(), targetField = targetField.field()](base::Event event) -> TransformResult
     {
         // Get field value
         if (!event->exists(targetField))
@@ -488,7 +460,7 @@ TransformOp opBuilderHelperStringTrim(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace1);
         }
 
-        auto resolvedField {event->getString(targetField)};
+        auto resolvedField {event->getStringView(targetField)};
 
         // Check if field is a string
         if (!resolvedField.has_value())
@@ -496,29 +468,31 @@ TransformOp opBuilderHelperStringTrim(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        // Get string
-        std::string strToTrim {resolvedField.value()};
-
-        // Trim
+        // Trim a view of the string, it is only copied back if something was trimmed
+        const auto original = resolvedField.value();
+        auto strToTrim = original;
         switch (trimType)
         {
             case 's':
                 // Trim begin
-                strToTrim.erase(0, strToTrim.find_first_not_of(trimChar));
+                strToTrim.remove_prefix(std::min(strToTrim.find_first_not_of(trimChar), strToTrim.size()));
                 break;
             case 'e':
                 // Trim end
-                strToTrim.erase(strToTrim.find_last_not_of(trimChar) + 1);
+                strToTrim = strToTrim.substr(0, strToTrim.find_last_not_of(trimChar) + 1);
                 break;
             case 'b':
                 // Trim both
-                strToTrim.erase(0, strToTrim.find_first_not_of(trimChar));
-                strToTrim.erase(strToTrim.find_last_not_of(trimChar) + 1);
+                strToTrim.remove_prefix(std::min(strToTrim.find_first_not_of(trimChar), strToTrim.size()));
+                strToTrim = strToTrim.substr(0, strToTrim.find_last_not_of(trimChar) + 1);
                 break;
             default: RETURN_FAILURE(runState, event, failureTrace3); break;
         }
 
-        event->setString(strToTrim, targetField);
+        if (strToTrim.size() != original.size())
+        {
+            event->setString(strToTrim, targetField);
+        }
 
         RETURN_SUCCESS(runState, event, successTrace);
     };
@@ -759,52 +733,35 @@ MapOp opBuilderHelperStringFromHexa(const std::vector<OpArg>& opArgs, const std:
     // Return Op
     return [=, runState = buildCtx->runState(), sourceField = hexRef.jsonPath()](base::ConstEvent event) -> MapResult
     {
-        std::string strHex {};
-
         // Getting string field from a reference
         if (!event->exists(sourceField))
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace1);
         }
 
-        const auto refStrHEX = event->getString(sourceField);
-        if (!refStrHEX.has_value())
+        const auto strHex = event->getStringView(sourceField);
+        if (!strHex.has_value())
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        strHex = refStrHEX.value();
-
-        const auto lenHex = strHex.length();
-
-        if (lenHex % 2)
+        if (strHex.value().length() % 2)
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
 
         std::string strASCII {};
-        strASCII.resize((lenHex / 2) + 1);
-
-        for (int iHex = 0, iASCII = 0; iHex < lenHex; iHex += 2, iASCII++)
+        if (!base::utils::string::decodeHex(strHex.value(), strASCII))
         {
-            char* err = nullptr;
-
-            std::string byte = strHex.substr(iHex, 2);
-            char chr = (char)strtol(byte.c_str(), &err, 16); // BASE: 16 (Hexa)
-
-            if (err != nullptr && *err != 0)
-            {
-                RETURN_FAILURE(runState,
-                               json::Json {},
-                               failureTrace4 + fmt::format("Character '{}' is not a valid hexa digit", err));
-            }
-
-            if (chr < 0 || chr > 127)
-            {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace5);
-            }
+            const auto invalid = strHex.value()[strHex.value().find_first_not_of("0123456789abcdefABCDEF")];
+            RETURN_FAILURE(runState,
+                           json::Json {},
+                           failureTrace4 + fmt::format("Character '{}' is not a valid hexa digit", invalid));
+        }
 
-            strASCII[iASCII] = chr;
+        if (std::any_of(strASCII.begin(), strASCII.end(), [](char chr) { return chr < 0; }))
+        {
+            RETURN_FAILURE(runState, json::Json {}, failureTrace5);
         }
 
         json::Json result;
@@ -852,22 +809,35 @@ MapOp opBuilderHelperHexToNumber(const std::vector<OpArg>& opArgs, const std::sh
             RETURN_FAILURE(runState, json::Json {}, failureTrace1);
         }
 
-        const auto refStrHEX = event->getString(sourceField);
+        const auto refStrHEX = event->getStringView(sourceField);
         if (!refStrHEX.has_value())
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
-        std::stringstream ss;
-        ss << refStrHEX.value();
-        int result;
-        ss >> std::hex >> result;
-        if (ss.fail() || !ss.eof())
+
+        // Same input as the std::hex extraction of an int: an optional sign and 0x prefix, no trailing characters
+        auto digits = refStrHEX.value();
+        const auto negative = !digits.empty() && digits.front() == '-';
+        if (negative || (!digits.empty() && digits.front() == '+'))
+        {
+            digits.remove_prefix(1);
+        }
+        if (digits.size() > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X'))
+        {
+            digits.remove_prefix(2);
+        }
+
+        std::uint32_t magnitude {};
+        const auto [end, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), magnitude, 16);
+        const auto limit = static_cast<std::uint32_t>(std::numeric_limits<int>::max()) + (negative ? 1 : 0);
+        if (digits.empty() || ec != std::errc() || end != digits.data() + digits.size() || magnitude > limit)
         {
             RETURN_FAILURE(runState,
                            json::Json {},
                            failureTrace3 + fmt::format("String '{}' is not a hexadecimal value", refStrHEX.value()));
         }
 
+        const auto result = negative ? -static_cast<std::int64_t>(magnitude) : static_cast<std::int64_t>(magnitude);
         json::Json resultJson;
         resultJson.setInt64(result);
         RETURN_SUCCESS(runState, resultJson, successTrace);
@@ -914,7 +884,7 @@ TransformOp opBuilderHelperStringReplace(const Reference& targetField,
 
     // Return Op
     return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](base::Event event) -> TransformResult
+        [=, runState = buildCtx->runState(), targetField = targetField.field()](base::Event event) -> TransformResult
     {
         if (!event->exists(targetField))
         {
@@ -922,7 +892,7 @@ TransformOp opBuilderHelperStringReplace(const Reference& targetField,
         }
 
         // Get field value
-        auto resolvedField = event->getString(targetField);
+        auto resolvedField = event->getStringView(targetField);
 
         // Check if field is a string
         if (!resolvedField.has_value())
@@ -930,17 +900,12 @@ TransformOp opBuilderHelperStringReplace(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        auto newString = resolvedField.value();
-
-        size_t start_pos = 0;
-        while ((start_pos = newString.find(oldSubstr, start_pos)) != std::string::npos)
+        // The string is built in a single pass and only set if there was something to replace
+        if (resolvedField.value().find(oldSubstr) != std::string_view::npos)
         {
-            newString.replace(start_pos, oldSubstr.length(), newSubstr);
-            start_pos += newSubstr.length();
+            event->setString(base::utils::string::replaceAll(resolvedField.value(), oldSubstr, newSubstr), targetField);
         }
 
-        event->setString(newString, targetField);
-
         RETURN_SUCCESS(runState, event, successTrace);
     };
 }
@@ -1219,8 +1184,8 @@ TransformOp opBuilderHelperAppendSplitString(const Reference& targetField,
     // Return Op
     return [=,
             runState = buildCtx->runState(),
-            targetField = targetField.jsonPath(),
-            fieldReference = ref.jsonPath(),
+            targetField = targetField.field(),
+            fieldReference = ref.field(),
             separator = separator[0]](base::Event event) -> TransformResult
     {
         // Check if reference exists
@@ -1234,12 +1199,8 @@ TransformOp opBuilderHelperAppendSplitString(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        const auto splitted = base::utils::string::split(resolvedReference.value(), separator);
-
-        for (const auto& value : splitted)
-        {
-            event->appendString(value, targetField);
-        }
+        // Views of the resolved string, appended resolving the target once
+        event->appendStrings(base::utils::string::splitView(resolvedReference.value(), separator), targetField);
 
         RETURN_SUCCESS(runState, event, successTrace);
     };
@@ -1267,8 +1228,10 @@ TransformOp opBuilderHelperMerge(const Reference& targetField,
     // Return Op
     return [=,
             runState = buildCtx->runState(),
-            targetField = targetField.jsonPath(),
-            fieldReference = refField.jsonPath()](base::Event event) -> TransformResult
+            targetPath = targetField.jsonPath(),
+            referencePath = refField.jsonPath(),
+            targetField = targetField.field(),
+            fieldReference = refField.field()](base::Event event) -> TransformResult
     {
         // Check target and reference field exists
         if (!event->exists(targetField))
@@ -1292,8 +1255,8 @@ TransformOp opBuilderHelperMerge(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace4);
         }
 
-        // Merge
-        event->merge(json::NOT_RECURSIVE, fieldReference, targetField);
+        // Merge, the items of the reference are moved to the target
+        event->merge(json::NOT_RECURSIVE, referencePath, targetPath);
 
         RETURN_SUCCESS(runState, event, successTrace);
     };
@@ -1324,7 +1287,7 @@ TransformOp opBuilderHelperDeleteField(const Reference& targetField,
 
     // Return Op
     return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](base::Event event) -> TransformResult
+        [=, runState = buildCtx->runState(), targetField = targetField.field()](base::Event event) -> TransformResult
     {
         bool result {false};
         try
@@ -1383,7 +1346,7 @@ TransformOp opBuilderHelperRenameField(const Reference& targetField,
     const auto failureTrace4 = fmt::format("{} -> Source field '{}' is not valid: ", name, srcField.dotPath());
 
     return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath(), sourceField = srcField.jsonPath()](
+        [=, runState = buildCtx->runState(), targetField = targetField.field(), sourceField = srcField.jsonPath()](
             base::Event event) -> TransformResult
     {
         if (event->exists(targetField))
@@ -1503,8 +1466,7 @@ MapOp opBuilderHelperEpochTimeFromSystem(const std::vector<OpArg>& opArgs,
     // Return Op
     return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
     {
-        auto sec = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
-                       .count();
+        auto sec = base::utils::time::epochSeconds();
         // TODO: Delete this and dd SetInt64 or SetIntAny to JSON class, get
         // Number of any type (fix concat helper)
         if (sec > std::numeric_limits<int64_t>::max())
@@ -1563,8 +1525,13 @@ MapOp opBuilderHelperDateFromEpochTime(const std::vector<OpArg>& opArgs,
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        date::sys_time<std::chrono::seconds> tp {std::chrono::seconds {epoch.value()}};
-        auto result = date::format("%Y-%m-%dT%H:%M:%SZ", tp);
+        // The years out of the four digits range are left to the date library
+        std::string result;
+        if (!base::utils::time::formatSeconds(epoch.value(), result))
+        {
+            date::sys_time<std::chrono::seconds> tp {std::chrono::seconds {epoch.value()}};
+            result = date::format("%Y-%m-%dT%H:%M:%SZ", tp);
+        }
         if (result.empty())
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
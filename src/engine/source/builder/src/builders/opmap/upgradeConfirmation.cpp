@@ -3,6 +3,8 @@
 #include <optional>
 #include <string>
 
+#include <sockiface/syncSockHandler.hpp>
+
 namespace builder::builders::opmap
 {
 
@@ -18,8 +20,9 @@ MapBuilder getUpgradeConfirmationBUilder(const std::shared_ptr<sockiface::ISockF
 
         const auto& refParam = *std::static_pointer_cast<const Reference>(opArgs[0]);
 
-        // Socket instance
-        auto socketUC = sockFactory->getHandler(sockiface::ISockHandler::Protocol::STREAM, WM_UPGRADE_SOCK);
+        // Socket instance, shared by all the workers that run the route
+        auto socketUC =
+            sockiface::makeSync(sockFactory->getHandler(sockiface::ISockHandler::Protocol::STREAM, WM_UPGRADE_SOCK));
 
         // Tracing
         const auto successTrace = fmt::format("{} -> Success", name);
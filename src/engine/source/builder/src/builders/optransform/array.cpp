@@ -27,7 +27,7 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
 
         auto arrayValidator = base::getResponse<schemf::ValidationResult>(result).getValidator();
 
-        // Transform the vector of arguments into a vector of map ops
+        // Transform the vector of arguments into a vector of map ops, they collect the items to append to the target
         using AppendOp = std::function<base::OptError(std::vector<json::Json>&, json::Json::Type&, const base::Event&)>;
         std::vector<AppendOp> appendOps;
         appendOps.reserve(opArgs.size());
@@ -47,12 +47,13 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                 }
 
                 appendOps.emplace_back(
-                    [targetField = targetField.jsonPath(),
+                    [targetField = targetField.field(),
+                     firstItem = json::FieldRef(targetField.jsonPath() + "/0"),
                      i,
                      targetFieldtype,
                      unique,
                      isInSchema,
-                     value = asValue->value()](std::vector<json::Json>& targetArray,
+                     value = asValue->value()](std::vector<json::Json>& newItems,
                                                json::Json::Type& valueType,
                                                const base::Event& event) -> base::OptError
                     {
@@ -62,13 +63,13 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                             {
                                 // If the target field is empty, take as type the type of the first element to be added,
                                 // otherwise take the type of the first element of the target field.
-                                if (!event->getArray(targetField).has_value())
+                                if (!event->exists(firstItem))
                                 {
                                     valueType = value.type();
                                 }
                                 else
                                 {
-                                    valueType = event->getArray(targetField).value()[0].type();
+                                    valueType = event->type(firstItem);
                                 }
                             }
                             else
@@ -86,13 +87,14 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
 
                         if (unique)
                         {
-                            if (std::find(targetArray.begin(), targetArray.end(), value) != targetArray.end())
+                            if (event->arrayContains(targetField, value).value_or(false)
+                                || std::find(newItems.begin(), newItems.end(), value) != newItems.end())
                             {
                                 return base::noError();
                             }
                         }
 
-                        targetArray.emplace_back(value);
+                        newItems.emplace_back(value);
                         return base::noError();
                     });
             }
@@ -102,15 +104,16 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                     fmt::format("'{}' not found", std::static_pointer_cast<const Reference>(opArgs[i])->dotPath());
 
                 appendOps.emplace_back(
-                    [targetField = targetField.jsonPath(),
+                    [targetField = targetField.field(),
+                     firstItem = json::FieldRef(targetField.jsonPath() + "/0"),
                      i,
                      targetFieldtype,
                      isInSchema,
                      refNotFound,
                      unique,
                      atleastOne,
-                     referencePath = std::static_pointer_cast<const Reference>(opArgs[i])->jsonPath()](
-                        std::vector<json::Json>& targetArray,
+                     referencePath = std::static_pointer_cast<const Reference>(opArgs[i])->field()](
+                        std::vector<json::Json>& newItems,
                         json::Json::Type& valueType,
                         const base::Event& event) -> base::OptError
                     {
@@ -130,13 +133,13 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                             {
                                 // If the target field is empty, take as type the type of the first element to be added,
                                 // otherwise take the type of the first element of the target field.
-                                if (!event->getArray(targetField).has_value())
+                                if (!event->exists(firstItem))
                                 {
                                     valueType = value.value().type();
                                 }
                                 else
                                 {
-                                    valueType = event->getArray(targetField).value()[0].type();
+                                    valueType = event->type(firstItem);
                                 }
                             }
                             else
@@ -154,13 +157,14 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
 
                         if (unique)
                         {
-                            if (std::find(targetArray.begin(), targetArray.end(), value.value()) != targetArray.end())
+                            if (event->arrayContains(targetField, value.value()).value_or(false)
+                                || std::find(newItems.begin(), newItems.end(), value.value()) != newItems.end())
                             {
                                 return base::noError();
                             }
                         }
 
-                        targetArray.emplace_back(value.value());
+                        newItems.emplace_back(std::move(value.value()));
                         return base::noError();
                     });
             }
@@ -179,7 +183,7 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
         // TransformOp
         return [successTrace,
                 runState = buildCtx->runState(),
-                targetField = targetField.jsonPath(),
+                targetField = targetField.field(),
                 arrayValidator,
                 failureTrace,
                 failureNotArray,
@@ -191,40 +195,33 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                 RETURN_FAILURE(runState, event, failureNotArray);
             }
 
-            auto resp = event->getArray(targetField);
-            std::vector<json::Json> targetArray = resp.value_or(std::vector<json::Json>());
-            if (resp)
-            {
-                targetArray = std::vector<json::Json>(resp.value());
-            }
-
+            // Only the new items are collected, the target array is not copied
+            std::vector<json::Json> newItems;
             auto valueType = json::Json::Type::Unknow;
-            auto initialSize = targetArray.size();
             for (auto i = 0; i < appendOps.size(); i++)
             {
-                auto res = appendOps[i](targetArray, valueType, event);
+                auto res = appendOps[i](newItems, valueType, event);
                 if (base::isError(res))
                 {
                     RETURN_FAILURE(runState, event, failureTrace + base::getError(res).message);
                 }
             }
 
-            if (targetArray.size() == initialSize)
+            if (newItems.empty())
             {
                 RETURN_FAILURE(runState, event, referencesNotFound);
             }
 
-            auto jArray = json::Json();
-            jArray.setArray();
-
-            for (const auto& item : targetArray)
-            {
-                jArray.appendJson(item);
-            }
-
-            // Validate the array
+            // Validate the new items, the items already in the target are not validated again
             if (arrayValidator != nullptr)
             {
+                auto jArray = json::Json();
+                jArray.setArray();
+                for (const auto& item : newItems)
+                {
+                    jArray.appendJson(item);
+                }
+
                 auto res = arrayValidator(jArray);
                 if (base::isError(res))
                 {
@@ -232,7 +229,10 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                 }
             }
 
-            event->set(targetField, jArray);
+            for (const auto& item : newItems)
+            {
+                event->appendJson(item, targetField);
+            }
 
             RETURN_SUCCESS(runState, event, successTrace);
         };
@@ -9,11 +9,13 @@
 
 #include <base/logging.hpp>
 #include <base/utils/stringUtils.hpp>
+#include <sockiface/syncSockHandler.hpp>
 
 namespace
 {
 constexpr std::string_view CFG_AR_SOCK_PATH {"/var/ossec/queue/alerts/cfgarq"};
-}
+constexpr std::size_t CHECK_CACHE_CAPACITY {100000}; ///< Max checks remembered by each SCA decoder helper
+} // namespace
 
 namespace builder::builders::optransform
 {
@@ -26,6 +28,92 @@ constexpr auto TYPE_POLICIES = "policies"; ///< Policies Event type
 constexpr auto TYPE_DUMP_END = "dump_end"; ///< Dump end Event type
 constexpr auto WDB_ATTEMPTS = 2;
 
+/****************************************************************************************
+                                 Check cache
+*****************************************************************************************/
+
+CheckCache::CheckCache(std::size_t capacity)
+    : m_size {0}
+    , m_capacity {capacity}
+{
+}
+
+std::size_t CheckCache::hash(const std::string& result, const std::string& reason, int scanId)
+{
+    return std::hash<std::string> {}(fmt::format("{}|{}|{}", result, reason, scanId));
+}
+
+std::optional<CheckCache::Entry>
+CheckCache::get(const std::string& agentId, const std::string& policyId, int checkId) const
+{
+    std::lock_guard lock {m_mutex};
+    auto agent = m_agents.find(agentId);
+    if (agent == m_agents.end())
+    {
+        return std::nullopt;
+    }
+    auto policy = agent->second.find(policyId);
+    if (policy == agent->second.end())
+    {
+        return std::nullopt;
+    }
+    auto check = policy->second.find(checkId);
+    if (check == policy->second.end())
+    {
+        return std::nullopt;
+    }
+    return check->second;
+}
+
+void CheckCache::set(const std::string& agentId, const std::string& policyId, int checkId, Entry entry)
+{
+    std::lock_guard lock {m_mutex};
+    if (m_size >= m_capacity)
+    {
+        m_agents.clear();
+        m_size = 0;
+    }
+
+    auto [it, inserted] = m_agents[agentId][policyId].insert_or_assign(checkId, std::move(entry));
+    if (inserted)
+    {
+        ++m_size;
+    }
+}
+
+void CheckCache::erase(const std::string& agentId, const std::string& policyId, int checkId)
+{
+    std::lock_guard lock {m_mutex};
+    auto agent = m_agents.find(agentId);
+    if (agent == m_agents.end())
+    {
+        return;
+    }
+    auto policy = agent->second.find(policyId);
+    if (policy == agent->second.end())
+    {
+        return;
+    }
+    m_size -= policy->second.erase(checkId);
+}
+
+void CheckCache::erasePolicy(const std::string& agentId, const std::string& policyId)
+{
+    std::lock_guard lock {m_mutex};
+    auto agent = m_agents.find(agentId);
+    if (agent == m_agents.end())
+    {
+        return;
+    }
+    auto policy = agent->second.find(policyId);
+    if (policy == agent->second.end())
+    {
+        return;
+    }
+    m_size -= policy->second.size();
+    agent->second.erase(policy);
+}
+
 namespace field
 {
 
@@ -450,9 +538,26 @@ std::optional<std::string> handleCheckEvent(const DecodeCxt& ctx)
     const auto result = ctx.getSrcStr(field::Name::CHECK_RESULT).value_or("");
     const auto reason = ctx.getSrcStr(field::Name::CHECK_REASON).value_or("");
 
-    // Prepare and execute the policy monitoring
-    const auto scaQuery = fmt::format("agent {} sca query {}", ctx.agentID, checkID);
-    const auto [resPreviosResult, previousResult] = searchAndParse(scaQuery, ctx.wdb);
+    const auto policyID = ctx.getSrcStr(field::Name::POLICY_ID).value();
+    const auto scanID = ctx.getSrcInt(field::Name::ID).value_or(-1);
+    const auto hash = CheckCache::hash(result, reason, scanID);
+
+    // Checks already stored by this helper are not looked up again
+    SearchResult resPreviosResult {SearchResult::ERROR};
+    std::string previousResult {};
+    const auto cached =
+        ctx.checkCache ? ctx.checkCache->get(ctx.agentID, policyID, checkID) : std::optional<CheckCache::Entry> {};
+    if (cached)
+    {
+        resPreviosResult = SearchResult::FOUND;
+        previousResult = cached->result;
+    }
+    else
+    {
+        // Prepare and execute the policy monitoring
+        const auto scaQuery = fmt::format("agent {} sca query {}", ctx.agentID, checkID);
+        std::tie(resPreviosResult, previousResult) = searchAndParse(scaQuery, ctx.wdb);
+    }
 
     // Generate the new query to save or update the policy monitoring
     std::string saveQuery {};
@@ -460,10 +565,14 @@ std::optional<std::string> handleCheckEvent(const DecodeCxt& ctx)
     {
         case SearchResult::FOUND:
         {
-            // There is a previous result, update it
-            const auto id = ctx.getSrcInt(field::Name::ID).value_or(-1);
+            // Same result, reason and scan as the stored check, nothing to update
+            if (cached && cached->hash == hash)
+            {
+                break;
+            }
 
-            saveQuery = fmt::format("agent {} sca update {}|{}|{}|{}", ctx.agentID, checkID, result, reason, id);
+            // There is a previous result, update it
+            saveQuery = fmt::format("agent {} sca update {}|{}|{}|{}", ctx.agentID, checkID, result, reason, scanID);
             break;
         }
         case SearchResult::NOT_FOUND:
@@ -483,11 +592,23 @@ std::optional<std::string> handleCheckEvent(const DecodeCxt& ctx)
                         ctx.agentID);
             return std::string("Error querying policy monitoring database for agent ") + ctx.agentID;
     }
-    // Save or update the policy monitoring
-    const auto [resSavePolicy, empty] = ctx.wdb->tryQueryAndParseResult(saveQuery, WDB_ATTEMPTS);
-    if (wazuhdb::QueryResultCodes::OK != resSavePolicy)
+
+    if (!saveQuery.empty())
     {
-        LOG_WARNING("Engine SCA decoder builder: Error saving policy monitoring for agent '{}'.", ctx.agentID);
+        // Save or update the policy monitoring
+        const auto [resSavePolicy, empty] = ctx.wdb->tryQueryAndParseResult(saveQuery, WDB_ATTEMPTS);
+        if (wazuhdb::QueryResultCodes::OK != resSavePolicy)
+        {
+            LOG_WARNING("Engine SCA decoder builder: Error saving policy monitoring for agent '{}'.", ctx.agentID);
+            if (ctx.checkCache)
+            {
+                ctx.checkCache->erase(ctx.agentID, policyID, checkID);
+            }
+        }
+        else if (ctx.checkCache)
+        {
+            ctx.checkCache->set(ctx.agentID, policyID, checkID, {result, hash});
+        }
     }
 
     // If policies are new, then save the rules and compliance
@@ -759,6 +880,11 @@ bool deletePolicyAndCheck(const DecodeCxt& ctx, const std::string& policyId)
         return false;
     }
 
+    if (ctx.checkCache)
+    {
+        ctx.checkCache->erasePolicy(ctx.agentID, policyId);
+    }
+
     // "Deleting check for policy '%s', agent id '%s'"
     query = fmt::format("agent {} sca delete_check {}", ctx.agentID, policyId);
 
@@ -980,6 +1106,12 @@ void deletePolicyCheckDistinct(const DecodeCxt& ctx, const std::string& policyId
     // "Deleting check distinct policy id , agent id "
     const auto query = fmt::format("agent {} sca delete_check_distinct {}|{}", ctx.agentID, policyId, scanId);
 
+    // The checks of the other scans are removed, the rest is looked up again
+    if (ctx.checkCache)
+    {
+        ctx.checkCache->erasePolicy(ctx.agentID, policyId);
+    }
+
     const auto [resultCode, payload] = ctx.wdb->tryQueryAndParseResult(query, WDB_ATTEMPTS);
     if (wazuhdb::QueryResultCodes::OK != resultCode)
     {
@@ -1075,7 +1207,9 @@ TransformBuilder getBuilderSCAdecoder(const std::shared_ptr<wazuhdb::IWDBManager
         /* Create the context for SCA decoder */
         namespace SF = sca::field;
         auto wdb = wdbManager->connection();
-        auto cfgarSock = sockFactory->getHandler(sockiface::ISockHandler::Protocol::DATAGRAM, CFG_AR_SOCK_PATH);
+        auto cfgarSock =
+            sockiface::makeSync(sockFactory->getHandler(sockiface::ISockHandler::Protocol::DATAGRAM, CFG_AR_SOCK_PATH));
+        auto checkCache = std::make_shared<sca::CheckCache>(CHECK_CACHE_CAPACITY);
         /*  Maps of paths. Contains the orginal path and the mapped path for each field */
         std::unordered_map<SF::Name, std::string> fieldSource {};
         std::unordered_map<SF::Name, std::string> fieldDest {};
@@ -1095,6 +1229,7 @@ TransformBuilder getBuilderSCAdecoder(const std::shared_ptr<wazuhdb::IWDBManager
                 fieldSrc = std::move(fieldSource),
                 fieldDst = std::move(fieldDest),
                 cfgarSock = std::move(cfgarSock),
+                checkCache = std::move(checkCache),
                 wdb = std::move(wdb)](base::Event event) -> TransformResult
         {
             std::optional<std::string> error;
@@ -1103,7 +1238,7 @@ TransformBuilder getBuilderSCAdecoder(const std::shared_ptr<wazuhdb::IWDBManager
             if (event->exists(sourceSCApath) && event->exists(agentIdPath) && event->isString(agentIdPath))
             {
                 const auto agentId = event->getString(agentIdPath).value();
-                const auto cxt = sca::DecodeCxt {event, agentId, wdb, cfgarSock, fieldSrc, fieldDst};
+                const auto cxt = sca::DecodeCxt {event, agentId, wdb, cfgarSock, fieldSrc, fieldDst, checkCache};
 
                 // TODO: Field type is mandatory and should be checked in the decoder
                 auto type = event->getString(sourceSCApath + "/type");
@@ -1,6 +1,11 @@
 #ifndef _OP_BUILDER_SCA_DECODER_H
 #define _OP_BUILDER_SCA_DECODER_H
 
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
 #include <sockiface/isockFactory.hpp>
 #include <wdb/iwdbManager.hpp>
 
@@ -90,6 +95,68 @@ enum class SearchResult
     FOUND       ///< Found.
 };
 
+/**
+ * @brief Last known state of the checks stored in wazuh-db, grouped by agent and policy.
+ *
+ * A check known to be stored does not need the 'sca query' lookup, and a check with the same result, reason and scan
+ * as the stored one does not need the 'sca update' either. The entries of a policy are dropped when its checks are
+ * deleted, and the whole cache is dropped when it grows over its capacity.
+ */
+class CheckCache
+{
+public:
+    /**
+     * @brief State of a stored check.
+     */
+    struct Entry
+    {
+        std::string result; ///< Stored result
+        std::size_t hash;   ///< Hash of the stored result, reason and scan id
+    };
+
+private:
+    /** @brief agent -> policy -> check id -> entry */
+    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<int, Entry>>> m_agents;
+    std::size_t m_size;     ///< Number of checks in the cache
+    std::size_t m_capacity; ///< Max number of checks in the cache
+    mutable std::mutex m_mutex;
+
+public:
+    /**
+     * @brief Construct a new Check Cache
+     *
+     * @param capacity Max number of checks in the cache
+     */
+    explicit CheckCache(std::size_t capacity);
+
+    /**
+     * @brief Hash of the fields of a check saved in wazuh-db.
+     */
+    static std::size_t hash(const std::string& result, const std::string& reason, int scanId);
+
+    /**
+     * @brief Get the state of a stored check
+     *
+     * @return std::optional<Entry> Empty if the check is not in the cache
+     */
+    std::optional<Entry> get(const std::string& agentId, const std::string& policyId, int checkId) const;
+
+    /**
+     * @brief Set the state of a stored check
+     */
+    void set(const std::string& agentId, const std::string& policyId, int checkId, Entry entry);
+
+    /**
+     * @brief Remove a check, its state in wazuh-db is unknown
+     */
+    void erase(const std::string& agentId, const std::string& policyId, int checkId);
+
+    /**
+     * @brief Remove all the checks of a policy of an agent
+     */
+    void erasePolicy(const std::string& agentId, const std::string& policyId);
+};
+
 /**
  * @brief Store all decoder information and context for processing the SCA Event.
  */
@@ -104,6 +171,8 @@ struct DecodeCxt
     const std::unordered_map<sca::field::Name, std::string>& sourcePath;
     /** @brief Mapping the field Name to path of the field in the /sca Event. */
     const std::unordered_map<sca::field::Name, std::string>& destinationPath;
+    /** @brief Stored checks of the agents, if null every check is looked up in wazuh-db. */
+    std::shared_ptr<CheckCache> checkCache {};
 
     /**
      * @brief Get int value of a field.
@@ -1,42 +1,116 @@
 #include "builders/optransform/windows.hpp"
 
-#include <regex>
+#include <cctype>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 
 using namespace builder::builders;
 
 namespace
 {
 
+/**
+ * @brief SID descriptions of a kvdb, compiled when the helper is built.
+ *
+ * The lookups take views of the SIDs of the event, the SIDs are not copied to search them.
+ */
+class SidTable
+{
+private:
+    std::unordered_map<std::string, std::string> m_entries;          ///< Owns the keys and descriptions
+    std::unordered_map<std::string_view, std::string_view> m_index; ///< Views of m_entries, nodes do not move
+
+public:
+    explicit SidTable(const std::map<std::string, std::string>& entries)
+        : m_entries {entries.begin(), entries.end()}
+    {
+        m_index.reserve(m_entries.size());
+        for (const auto& [key, value] : m_entries)
+        {
+            m_index.emplace(key, value);
+        }
+    }
+
+    SidTable(const SidTable&) = delete;
+    SidTable& operator=(const SidTable&) = delete;
+
+    std::optional<std::string_view> find(std::string_view sid) const
+    {
+        auto it = m_index.find(sid);
+        if (it == m_index.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+};
+
 /**
  * @brief Parse the list of SID, the list must be in the format:
  *
  * '%{sid1} %{sid2} %{sid3} ... ' // TODO: Check the format
  *
- * Ths function will return a vector with the sids in the same order as the input
- * or return an empty vector if the input is not valid
+ * Calls visitor with each sid in the same order as the input, splitting it as base::utils::string::split does.
  * @param listSrt String with the list of sids
- * @return std::vector<std::string>
+ * @param visitor Function called with each sid
+ * @return false if the list is empty
  */
-std::vector<std::string> parserListSID(const std::string& listStr)
+template<typename Visitor>
+bool parserListSID(std::string_view listStr, Visitor&& visitor)
 {
-    const char DELIMITER = ' ';
-    const std::string HEADER = "%{";
-    const std::string TAIL = "}";
-    const size_t HEADER_SIZE = HEADER.size();
-    const size_t TAIL_SIZE = TAIL.size();
-
-    std::vector<std::string> result = base::utils::string::split(listStr, DELIMITER); // TODO Check format
+    constexpr char DELIMITER = ' ';
+    constexpr std::string_view HEADER = "%{";
+    constexpr std::string_view TAIL = "}";
 
-    for (auto& sid : result)
+    auto visit = [&visitor](std::string_view sid)
     {
-        if (sid.size() > HEADER_SIZE + TAIL_SIZE)
+        if (sid.size() > HEADER.size() + TAIL.size())
         {
             // Remove header '%{' and tail '}'
-            sid = sid.substr(HEADER_SIZE, sid.size() - HEADER_SIZE - TAIL_SIZE);
+            sid = sid.substr(HEADER.size(), sid.size() - HEADER.size() - TAIL.size());
         }
+        visitor(sid);
+    };
+
+    if (!listStr.empty() && listStr[0] == DELIMITER)
+    {
+        listStr.remove_prefix(1);
+    }
+
+    bool found = false;
+    for (auto pos = listStr.find(DELIMITER); pos != std::string_view::npos; pos = listStr.find(DELIMITER))
+    {
+        visit(listStr.substr(0, pos));
+        listStr.remove_prefix(pos + 1);
+        found = true;
     }
 
-    return result;
+    if (!listStr.empty())
+    {
+        visit(listStr);
+        found = true;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Relative identifier of a domain SID, its last 1 to 5 digits.
+ *
+ * @return std::string_view Empty if the SID does not end with a digit
+ */
+std::string_view domainRid(std::string_view sid)
+{
+    constexpr std::size_t MAX_DIGITS = 5;
+
+    std::size_t digits = 0;
+    while (digits < MAX_DIGITS && digits < sid.size() && std::isdigit(sid[sid.size() - 1 - digits]))
+    {
+        ++digits;
+    }
+    return sid.substr(sid.size() - digits);
 }
 
 } // namespace
@@ -123,9 +197,11 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
         };
 
         // Account SID Description
-        auto asdMap = parseDbJsonToMap(detail::ACC_SID_DESC_KEY, "accountSIDDescription");
+        auto asdTable =
+            std::make_shared<const SidTable>(parseDbJsonToMap(detail::ACC_SID_DESC_KEY, "accountSIDDescription"));
         // Domain Specific SID
-        auto dssMap = parseDbJsonToMap(detail::DOM_SPC_SID_KEY, "DomainSpecificSID");
+        auto dssTable =
+            std::make_shared<const SidTable>(parseDbJsonToMap(detail::DOM_SPC_SID_KEY, "DomainSpecificSID"));
 
         // Trace messages
         const auto name = buildCtx->context().opName;
@@ -136,12 +212,11 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
             fmt::format("{} -> Error parsing reference '{}' as sidList", name, sidListRef.dotPath());
         // const std::string failureItemNotString {
         //     fmt::format("[{}] -> Failure: Item in array {} is not a string", name, sidListRef)};
-        std::regex endRegex("\\d{1,5}$");
 
         // Return Op
         return [=,
-                targetField = targetField.jsonPath(),
-                sidListRef = sidListRef.jsonPath(),
+                targetField = targetField.field(),
+                sidListRef = sidListRef.field(),
                 runState = buildCtx->runState()](base::Event event) -> TransformResult
         {
             // Get reference
@@ -150,47 +225,37 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
             {
                 RETURN_FAILURE(runState, event, referenceNotFoundTrace);
             }
-            auto sidList = parserListSID(optSidList.value());
-            if (sidList.empty())
-            {
-                RETURN_FAILURE(runState, event, failureRefErrorParsing);
-            }
 
-            // Iterate over the sids and get the mappings
-            // Parse de sid list
-            for (const auto& sid : sidList)
-            {
+            // Parse de sid list and map each sid in one pass
+            auto found = parserListSID(optSidList.value(),
+                                       [&](std::string_view sid)
+                                       {
+                                           // Check if is a account sid
+                                           if (auto desc = asdTable->find(sid))
+                                           {
+                                               event->appendString(desc.value(), targetField);
+                                               return;
+                                           }
 
-                auto asdIt = asdMap.find(sid);
-                bool hasDesc = false;
-                // Check if is a account sid
-                if (asdIt != asdMap.end())
-                {
-                    event->appendString(asdIt->second, targetField);
-                    hasDesc = true;
-                }
-                else if (base::utils::string::startsWith(sid, "S-1-5-21")) // If not found and check if is a domain
-                {
-                    // Che if sid end with a number between 1 and 5 digits
-                    std::smatch matches;
-
-                    if (std::regex_search(sid, matches, endRegex)) // If the regex matches
-                    {
-                        // Extraxt string from the regex match
-                        auto match = matches[0].str();
-                        auto dssIt = dssMap.find(match);
-                        if (dssIt != dssMap.end())
-                        {
-                            event->appendString(dssIt->second, targetField);
-                            hasDesc = true;
-                        }
-                    }
-                }
+                                           // If not found and check if is a domain
+                                           if (base::utils::string::startsWith(sid, "S-1-5-21"))
+                                           {
+                                               auto rid = domainRid(sid);
+                                               if (!rid.empty())
+                                               {
+                                                   if (auto desc = dssTable->find(rid))
+                                                   {
+                                                       event->appendString(desc.value(), targetField);
+                                                       return;
+                                                   }
+                                               }
+                                           }
 
-                if (!hasDesc)
-                {
-                    event->appendString(sid, targetField);
-                }
+                                           event->appendString(sid, targetField);
+                                       });
+            if (!found)
+            {
+                RETURN_FAILURE(runState, event, failureRefErrorParsing);
             }
 
             RETURN_SUCCESS(runState, event, successTrace);
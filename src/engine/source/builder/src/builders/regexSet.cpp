@@ -0,0 +1,139 @@
+#include "builders/regexSet.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+#include <re2/re2.h>
+#include <re2/set.h>
+
+namespace builder::builders
+{
+
+namespace
+{
+constexpr std::size_t MAX_MEMOS = 16; ///< Max memoized results per thread
+
+/**
+ * @brief Result of the last pass of a set in the current thread
+ */
+struct Memo
+{
+    uint64_t id;               ///< Set of the result
+    std::string input;         ///< Input of the pass
+    std::vector<bool> matched; ///< Matched patterns by index
+};
+
+std::atomic<uint64_t> g_nextId {0};
+} // namespace
+
+struct RegexSet::Impl
+{
+    std::vector<std::unique_ptr<RE2>> m_regexes; ///< Each pattern, used if the set can not be compiled
+    std::unique_ptr<RE2::Set> m_set;            ///< Compiled set, null if it has a single pattern or failed
+};
+
+RegexSet::RegexSet()
+    : m_impl {std::make_unique<Impl>()}
+    , m_id {g_nextId.fetch_add(1, std::memory_order_relaxed)}
+    , m_compiled {false}
+{
+}
+
+RegexSet::~RegexSet() = default;
+
+std::size_t RegexSet::add(const std::string& pattern)
+{
+    if (isCompiled())
+    {
+        throw std::runtime_error("Can not add a pattern to a compiled regex set");
+    }
+
+    auto regex = std::make_unique<RE2>(pattern, RE2::Quiet);
+    if (!regex->ok())
+    {
+        throw std::runtime_error(fmt::format("Invalid regex: \"{}\".", pattern));
+    }
+
+    m_impl->m_regexes.emplace_back(std::move(regex));
+    return m_impl->m_regexes.size() - 1;
+}
+
+std::size_t RegexSet::size() const
+{
+    return m_impl->m_regexes.size();
+}
+
+void RegexSet::compile() const
+{
+    std::call_once(m_compileFlag,
+                   [this]()
+                   {
+                       m_compiled.store(true, std::memory_order_release);
+                       if (m_impl->m_regexes.size() < 2)
+                       {
+                           return;
+                       }
+
+                       auto set = std::make_unique<RE2::Set>(RE2::Quiet, RE2::UNANCHORED);
+                       for (const auto& regex : m_impl->m_regexes)
+                       {
+                           if (set->Add(regex->pattern(), nullptr) < 0)
+                           {
+                               return;
+                           }
+                       }
+
+                       if (set->Compile())
+                       {
+                           m_impl->m_set = std::move(set);
+                       }
+                   });
+}
+
+bool RegexSet::matches(std::string_view input, std::size_t index) const
+{
+    compile();
+
+    if (!m_impl->m_set)
+    {
+        return RE2::PartialMatch(input, *m_impl->m_regexes[index]);
+    }
+
+    thread_local std::vector<Memo> memos;
+    auto memo = std::find_if(memos.begin(), memos.end(), [this](const Memo& memo) { return memo.id == m_id; });
+    if (memo == memos.end())
+    {
+        if (memos.size() >= MAX_MEMOS)
+        {
+            memos.erase(memos.begin());
+        }
+        memos.emplace_back(Memo {m_id, {}, {}});
+        memo = memos.end() - 1;
+    }
+    else if (memo->input == input && !memo->matched.empty())
+    {
+        return memo->matched[index];
+    }
+
+    std::vector<int> matchedIndexes;
+    RE2::Set::ErrorInfo errorInfo {};
+    if (!m_impl->m_set->Match(input, &matchedIndexes, &errorInfo) && errorInfo.kind != RE2::Set::kNoError)
+    {
+        // The pass failed (e.g. the DFA ran out of memory on this input), test the pattern on its own
+        memo->matched.clear();
+        return RE2::PartialMatch(input, *m_impl->m_regexes[index]);
+    }
+
+    memo->input.assign(input.data(), input.size());
+    memo->matched.assign(m_impl->m_regexes.size(), false);
+    for (auto matched : matchedIndexes)
+    {
+        memo->matched[matched] = true;
+    }
+
+    return memo->matched[index];
+}
+
+} // namespace builder::builders
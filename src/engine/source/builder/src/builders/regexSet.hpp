@@ -0,0 +1,109 @@
+#ifndef _BUILDER_BUILDERS_REGEXSET_HPP
+#define _BUILDER_BUILDERS_REGEXSET_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace builder::builders
+{
+
+/**
+ * @brief Regexes tested against the same field, evaluated together in a single pass.
+ *
+ * The patterns are added while building, the set is compiled on the first match. The result of the pass is memoized
+ * per thread for the last input, so the rest of the helpers of the set that test the same value only read the result.
+ */
+class RegexSet
+{
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+
+    const uint64_t m_id;                  ///< Unique identifier of the set, keys the memoized results
+    mutable std::atomic<bool> m_compiled; ///< True once the set is compiled, no more patterns can be added
+    mutable std::once_flag m_compileFlag; ///< Compile the set only once
+
+    void compile() const;
+
+public:
+    RegexSet();
+    ~RegexSet();
+
+    RegexSet(const RegexSet&) = delete;
+    RegexSet& operator=(const RegexSet&) = delete;
+
+    /**
+     * @brief Add a pattern to the set.
+     *
+     * @param pattern Regex pattern.
+     * @return std::size_t Index of the pattern in the set.
+     *
+     * @throw std::runtime_error if the pattern is invalid or the set is already compiled.
+     */
+    std::size_t add(const std::string& pattern);
+
+    /**
+     * @brief Check if the pattern has a partial match in the input.
+     *
+     * @param input Input to test.
+     * @param index Index of the pattern, as returned by add.
+     * @return true if the pattern matches.
+     */
+    bool matches(std::string_view input, std::size_t index) const;
+
+    /**
+     * @brief Check if the set is compiled.
+     */
+    bool isCompiled() const { return m_compiled.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Get the number of patterns in the set.
+     */
+    std::size_t size() const;
+};
+
+/**
+ * @brief Regex sets of a build, one per target field.
+ */
+class RegexSets
+{
+private:
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::shared_ptr<RegexSet>> m_sets;
+
+public:
+    /**
+     * @brief Add a pattern to the set of a field.
+     *
+     * If the set of the field is already compiled a new one is started.
+     *
+     * @param field Target field of the regex.
+     * @param pattern Regex pattern.
+     * @return std::pair<std::shared_ptr<RegexSet>, std::size_t> Set of the field and index of the pattern in it.
+     *
+     * @throw std::runtime_error if the pattern is invalid.
+     */
+    std::pair<std::shared_ptr<RegexSet>, std::size_t> add(const std::string& field, const std::string& pattern)
+    {
+        std::lock_guard<std::mutex> lock {m_mutex};
+
+        auto& set = m_sets[field];
+        if (!set || set->isCompiled())
+        {
+            set = std::make_shared<RegexSet>();
+        }
+
+        auto index = set->add(pattern);
+        return {set, index};
+    }
+};
+
+} // namespace builder::builders
+
+#endif // _BUILDER_BUILDERS_REGEXSET_HPP
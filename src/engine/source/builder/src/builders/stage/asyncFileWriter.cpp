@@ -0,0 +1,298 @@
+#include "asyncFileWriter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <base/logging.hpp>
+
+namespace builder::builders::detail
+{
+
+namespace
+{
+constexpr std::size_t MAX_BATCH = 512;                ///< Max lines taken from the queue per write
+constexpr int64_t WAIT_TIMEOUT_USEC = 100000;         ///< Wait for lines, then check the sync and rotation timers
+constexpr auto BACKPRESSURE_WAIT = std::chrono::microseconds(100);
+constexpr char NEW_LINE[] = "\n";
+
+std::string rotatedPath(const std::string& path)
+{
+    auto now = std::time(nullptr);
+    std::tm tm {};
+    localtime_r(&now, &tm);
+    char timestamp[32];
+    std::strftime(timestamp, sizeof(timestamp), "%Y%m%d-%H%M%S", &tm);
+
+    auto rotated = fmt::format("{}.{}", path, timestamp);
+    // Several rotations in the same second
+    for (std::size_t i = 1; std::filesystem::exists(rotated); ++i)
+    {
+        rotated = fmt::format("{}.{}.{}", path, timestamp, i);
+    }
+    return rotated;
+}
+} // namespace
+
+AsyncFileWriter::AsyncFileWriter(const std::string& path, const FileOutputOptions& options)
+    : m_path(path)
+    , m_options(options)
+    , m_hasMetrics(options.metricsScope != nullptr)
+    , m_queue(options.bufferSize)
+    , m_pending(0)
+    , m_stop(false)
+    , m_fd(-1)
+    , m_fileSize(0)
+    , m_dirty(false)
+{
+    if (0 == m_options.bufferSize)
+    {
+        throw std::invalid_argument("The file output buffer size must be greater than 0");
+    }
+
+    open();
+
+    if (m_hasMetrics)
+    {
+        const auto& scope = m_options.metricsScope;
+        m_metrics.m_queued = scope->getCounterUInteger("QueuedEvents");
+        m_metrics.m_written = scope->getCounterUInteger("WrittenEvents");
+        m_metrics.m_bytes = scope->getCounterUInteger("WrittenBytes");
+        m_metrics.m_used = scope->getUpDownCounterInteger("UsedBuffer");
+        m_metrics.m_backpressure = scope->getCounterUInteger("BackpressureWaits");
+        m_metrics.m_errors = scope->getCounterUInteger("WriteErrors");
+        m_metrics.m_rotations = scope->getCounterUInteger("Rotations");
+    }
+
+    m_syncedAt = std::chrono::steady_clock::now();
+    m_thread = std::thread(&AsyncFileWriter::run, this);
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    m_stop = true;
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    if (m_fd >= 0)
+    {
+        sync();
+        ::close(m_fd);
+    }
+}
+
+void AsyncFileWriter::open()
+{
+    m_fd = ::open(m_path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0660);
+    if (m_fd < 0)
+    {
+        throw std::invalid_argument(fmt::format("Could not open file {}: {}", m_path, std::strerror(errno)));
+    }
+
+    struct stat st {};
+    m_fileSize = (0 == fstat(m_fd, &st)) ? static_cast<std::size_t>(st.st_size) : 0;
+    m_openedAt = std::chrono::steady_clock::now();
+}
+
+void AsyncFileWriter::write(std::string&& line)
+{
+    if (m_pending.load(std::memory_order_relaxed) >= m_options.bufferSize)
+    {
+        if (m_hasMetrics)
+        {
+            m_metrics.m_backpressure->addValue(1UL);
+        }
+        while (m_pending.load(std::memory_order_relaxed) >= m_options.bufferSize)
+        {
+            std::this_thread::sleep_for(BACKPRESSURE_WAIT);
+        }
+    }
+
+    ++m_pending;
+    m_queue.enqueue(std::move(line));
+
+    if (m_hasMetrics)
+    {
+        m_metrics.m_queued->addValue(1UL);
+        m_metrics.m_used->addValue(1L);
+    }
+}
+
+void AsyncFileWriter::drain() const
+{
+    while (m_pending.load() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void AsyncFileWriter::run()
+{
+    std::vector<std::string> batch(MAX_BATCH);
+    while (true)
+    {
+        // Once stopping, take what is left without waiting
+        auto count = m_stop ? m_queue.try_dequeue_bulk(batch.begin(), MAX_BATCH)
+                            : m_queue.wait_dequeue_bulk_timed(batch.begin(), MAX_BATCH, WAIT_TIMEOUT_USEC);
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto rotateBySize = m_options.maxFileSize > 0 && m_fileSize >= m_options.maxFileSize;
+        const auto rotateByAge = m_options.rotateIntervalSec > 0 && m_fileSize > 0
+                                 && now - m_openedAt >= std::chrono::seconds(m_options.rotateIntervalSec);
+        if (rotateBySize || rotateByAge)
+        {
+            rotate();
+        }
+
+        if (count > 0)
+        {
+            writeBatch(batch, count);
+        }
+
+        if (m_dirty && m_options.fsyncIntervalMs > 0
+            && now - m_syncedAt >= std::chrono::milliseconds(m_options.fsyncIntervalMs))
+        {
+            sync();
+        }
+
+        if (0 == count && m_stop)
+        {
+            return;
+        }
+    }
+}
+
+void AsyncFileWriter::writeBatch(std::vector<std::string>& batch, std::size_t count)
+{
+    std::vector<iovec> iovecs;
+    iovecs.reserve(count * 2);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        iovecs.push_back({batch[i].data(), batch[i].size()});
+        iovecs.push_back({const_cast<char*>(NEW_LINE), 1});
+        total += batch[i].size() + 1;
+    }
+
+    if (m_fd < 0)
+    {
+        try
+        {
+            open();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_DEBUG("Could not reopen file: {}", e.what());
+        }
+    }
+
+    auto* iov = iovecs.data();
+    auto remaining = iovecs.size();
+    bool failed = m_fd < 0;
+    while (remaining > 0 && !failed)
+    {
+        auto written = ::writev(m_fd, iov, static_cast<int>(std::min<std::size_t>(remaining, IOV_MAX)));
+        if (written < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            LOG_ERROR("Could not write to file '{}': {}", m_path, std::strerror(errno));
+            failed = true;
+            break;
+        }
+
+        // Skip what was written, a partial write may end in the middle of a buffer
+        auto left = static_cast<std::size_t>(written);
+        while (remaining > 0 && left >= iov->iov_len)
+        {
+            left -= iov->iov_len;
+            ++iov;
+            --remaining;
+        }
+        if (remaining > 0)
+        {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+            iov->iov_len -= left;
+        }
+    }
+
+    if (!failed)
+    {
+        m_fileSize += total;
+        m_dirty = true;
+    }
+
+    m_pending -= count;
+
+    if (m_hasMetrics)
+    {
+        m_metrics.m_used->addValue(-static_cast<int64_t>(count));
+        if (failed)
+        {
+            m_metrics.m_errors->addValue(count);
+        }
+        else
+        {
+            m_metrics.m_written->addValue(count);
+            m_metrics.m_bytes->addValue(total);
+        }
+    }
+}
+
+void AsyncFileWriter::sync()
+{
+    if (m_fd >= 0 && m_dirty && 0 != ::fdatasync(m_fd))
+    {
+        LOG_WARNING("Could not sync file '{}': {}", m_path, std::strerror(errno));
+    }
+    m_dirty = false;
+    m_syncedAt = std::chrono::steady_clock::now();
+}
+
+void AsyncFileWriter::rotate()
+{
+    if (m_fd >= 0)
+    {
+        sync();
+        ::close(m_fd);
+        m_fd = -1;
+    }
+
+    const auto rotated = rotatedPath(m_path);
+    if (0 != std::rename(m_path.c_str(), rotated.c_str()))
+    {
+        LOG_ERROR("Could not rotate file '{}' to '{}': {}", m_path, rotated, std::strerror(errno));
+    }
+    else if (m_hasMetrics)
+    {
+        m_metrics.m_rotations->addValue(1UL);
+    }
+
+    try
+    {
+        open();
+    }
+    catch (const std::exception& e)
+    {
+        // Each batch tries to open it again, the ones that can not be written are counted as errors
+        LOG_ERROR("Could not reopen file after rotation: {}", e.what());
+        m_fileSize = 0;
+    }
+}
+
+} // namespace builder::builders::detail
@@ -0,0 +1,100 @@
+#ifndef _BUILDER_BUILDERS_STAGE_ASYNCFILEWRITER_HPP
+#define _BUILDER_BUILDERS_STAGE_ASYNCFILEWRITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <concurrentqueue/blockingconcurrentqueue.h>
+
+#include <builder/builder.hpp>
+
+namespace builder::builders::detail
+{
+
+/**
+ * @brief Appends lines to a file from a dedicated thread.
+ *
+ * The callers only queue the lines in a lock-free queue. The writer thread takes them in batches, writes each batch
+ * with writev, syncs the file every fsyncIntervalMs and rotates it by size or age, renaming it with a timestamp
+ * suffix. While the queue is full the callers wait, so no line is lost.
+ */
+class AsyncFileWriter
+{
+private:
+    struct Metrics
+    {
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_queued;       ///< Lines queued
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_written;      ///< Lines written
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_bytes;        ///< Bytes written
+        std::shared_ptr<metricsManager::iCounter<int64_t>> m_used;          ///< Lines waiting in the queue
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_backpressure; ///< Writes that waited for room
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_errors;       ///< Lines that could not be written
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_rotations;    ///< Files rotated
+    };
+
+    std::string m_path;
+    FileOutputOptions m_options;
+    Metrics m_metrics;
+    bool m_hasMetrics;
+
+    moodycamel::BlockingConcurrentQueue<std::string> m_queue;
+    std::atomic<std::size_t> m_pending; ///< Lines queued and not written yet
+    std::atomic<bool> m_stop;
+
+    // Writer thread only
+    int m_fd;
+    std::size_t m_fileSize;
+    std::chrono::steady_clock::time_point m_openedAt;
+    std::chrono::steady_clock::time_point m_syncedAt;
+    bool m_dirty; ///< Written since the last fsync
+
+    std::thread m_thread;
+
+    void open();
+    void run();
+    void writeBatch(std::vector<std::string>& batch, std::size_t count);
+    void rotate();
+    void sync();
+
+public:
+    /**
+     * @brief Open the file and start the writer thread
+     *
+     * @param path File to append the lines to
+     * @param options Output options
+     * @throw std::invalid_argument if the file can not be opened
+     */
+    AsyncFileWriter(const std::string& path, const FileOutputOptions& options);
+
+    /**
+     * @brief Write the queued lines, sync and close the file
+     */
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    /**
+     * @brief Queue a line, waits while the queue is full
+     *
+     * @param line Line without the trailing new line
+     */
+    void write(std::string&& line);
+
+    /**
+     * @brief Wait until all the queued lines are written
+     */
+    void drain() const;
+
+    /**
+     * @brief Path of the file
+     */
+    const std::string& path() const { return m_path; }
+};
+
+} // namespace builder::builders::detail
+
+#endif // _BUILDER_BUILDERS_STAGE_ASYNCFILEWRITER_HPP
@@ -1,8 +1,9 @@
 #include "check.hpp"
 
 #include <algorithm>
-
 #include <regex>
+#include <string_view>
+#include <unordered_map>
 
 #include <base/json.hpp>
 #include <logicexpr/logicexpr.hpp>
@@ -84,6 +85,61 @@ getTermBuilder(const std::shared_ptr<const IBuildCtx>& buildCtx)
     };
 }
 
+/**
+ * @brief Static estimate of the cost and pass rate of a term of a check expression, by helper.
+ *
+ * The costs are relative to an equality check, they order the operands of AND and OR so the cheap and selective
+ * terms run before the regexes, CIDR checks and kvdb lookups. The helpers that keep state between events count the
+ * events that reach them, they are marked as stateful so they keep their written position.
+ */
+logicexpr::evaluator::Estimate estimateTerm(const parsers::HelperToken& token)
+{
+    static const std::unordered_map<std::string_view, logicexpr::evaluator::Estimate> estimates {
+        {"exists", {0.5, 0.5}},
+        {"not_exists", {0.5, 0.5}},
+        {"int_equal", {1, 0.1}},
+        {"int_not_equal", {1, 0.9}},
+        {"string_equal", {1, 0.1}},
+        {"string_not_equal", {1, 0.9}},
+        {"int_greater", {1, 0.5}},
+        {"int_greater_or_equal", {1, 0.5}},
+        {"int_less", {1, 0.5}},
+        {"int_less_or_equal", {1, 0.5}},
+        {"string_greater", {1, 0.5}},
+        {"string_greater_or_equal", {1, 0.5}},
+        {"string_less", {1, 0.5}},
+        {"string_less_or_equal", {1, 0.5}},
+        {"starts_with", {2, 0.2}},
+        {"contains", {4, 0.2}},
+        {"array_contains", {4, 0.2}},
+        {"array_contains_any", {6, 0.2}},
+        {"array_not_contains", {4, 0.8}},
+        {"array_not_contains_any", {6, 0.8}},
+        {"binary_and", {2, 0.5}},
+        {"match_value", {4, 0.2}},
+        {"exists_key_in", {4, 0.2}},
+        {"ip_cidr_match", {8, 0.2}},
+        {"is_public_ip", {8, 0.5}},
+        {"regex_match", {20, 0.1}},
+        {"regex_not_match", {20, 0.9}},
+        {"kvdb_match", {40, 0.2}},
+        {"kvdb_not_match", {40, 0.8}},
+        {"frequency", {8, 0.1, true}},
+    };
+
+    if (auto it = estimates.find(token.name); it != estimates.end())
+    {
+        return it->second;
+    }
+
+    // Type checks (is_string, is_not_null...) are cheap, anything else is assumed to be moderately expensive
+    if (token.name.rfind("is_", 0) == 0)
+    {
+        return {0.5, 0.5};
+    }
+    return {5, 0.5};
+}
+
 base::Expression checkExpressionBuilder(const std::string& logicExpr, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     std::function<bool(base::Event)> evaluator;
@@ -92,8 +148,8 @@ base::Expression checkExpressionBuilder(const std::string& logicExpr, const std:
         // Apply definitions
         auto replacedExpr = buildCtx->definitions().replace(logicExpr);
         // TODO: make a factory and inject this dependency
-        evaluator = logicexpr::buildDijstraEvaluator<base::Event, parsers::HelperToken>(
-            replacedExpr, getTermBuilder(buildCtx), parsers::getTermParser());
+        evaluator = logicexpr::buildShortCircuitEvaluator<base::Event, parsers::HelperToken>(
+            replacedExpr, getTermBuilder(buildCtx), parsers::getTermParser(), estimateTerm);
     }
     catch (const std::exception& e)
     {
@@ -1,14 +1,27 @@
 #include "fileOutput.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
 
+#include "builders/stage/asyncFileWriter.hpp"
+#include "builders/stage/outputs.hpp"
 #include "builders/utils.hpp"
 
 namespace builder::builders
 {
 
-base::Expression fileOutputBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
+namespace
+{
+struct OutputDefinition
+{
+    std::string path;
+    std::shared_ptr<const json::Projection> projection;
+};
+
+OutputDefinition getOutputDefinition(const json::Json& definition)
 {
     if (!definition.isObject())
     {
@@ -16,24 +29,30 @@ base::Expression fileOutputBuilder(const json::Json& definition, const std::shar
             "Stage '{}' expects an object but got '{}'", syntax::asset::FILE_OUTPUT_KEY, definition.typeName()));
     }
 
-    if (definition.size() != 1)
+    auto projection = getOutputProjection(definition, syntax::asset::FILE_OUTPUT_KEY);
+    const size_t keys = projection ? 2 : 1;
+    if (definition.size() != keys)
     {
-        throw std::runtime_error(fmt::format("Stage '{}' expects an object with one key but got '{}'",
+        throw std::runtime_error(fmt::format("Stage '{}' expects an object with {} keys but got '{}'",
                                              syntax::asset::FILE_OUTPUT_KEY,
+                                             keys,
                                              definition.size()));
     }
 
     auto outputObj = definition.getObject().value();
-
-    const auto& [key, value] = *outputObj.begin();
-    if (key != syntax::asset::FILE_OUTPUT_PATH_KEY)
+    auto it = std::find_if(outputObj.begin(),
+                           outputObj.end(),
+                           [](const auto& item) { return std::get<0>(item) == syntax::asset::FILE_OUTPUT_PATH_KEY; });
+    if (it == outputObj.end())
     {
         throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}' but got '{}'",
                                              syntax::asset::FILE_OUTPUT_KEY,
                                              syntax::asset::FILE_OUTPUT_PATH_KEY,
-                                             key));
+                                             std::get<0>(outputObj.front())));
     }
 
+    const auto& value = std::get<1>(*it);
+
     if (!value.isString())
     {
         throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}' to be a string but got '{}'",
@@ -42,8 +61,40 @@ base::Expression fileOutputBuilder(const json::Json& definition, const std::shar
                                              value.typeName()));
     }
 
-    auto path = value.getString().value();
-    auto filePtr = std::make_shared<detail::FileOutput>(path);
+    return {value.getString().value(), std::move(projection)};
+}
+
+/**
+ * @brief Writers of the async file outputs, by path
+ *
+ * The stages of a new policy find the writers of the current one, so a file always has a single writer.
+ */
+class WriterRegistry
+{
+private:
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<detail::AsyncFileWriter>> m_writers;
+
+public:
+    std::shared_ptr<detail::AsyncFileWriter> get(const std::string& path, const FileOutputOptions& options)
+    {
+        std::lock_guard<std::mutex> lock {m_mutex};
+        auto& entry = m_writers[path];
+        auto writer = entry.lock();
+        if (!writer)
+        {
+            writer = std::make_shared<detail::AsyncFileWriter>(path, options);
+            entry = writer;
+        }
+        return writer;
+    }
+};
+} // namespace
+
+base::Expression fileOutputBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    auto [path, projection] = getOutputDefinition(definition);
+    auto filePtr = std::make_shared<detail::FileOutput>(path, std::move(projection));
     auto name = fmt::format("write.output({})", path);
     const auto successTrace = fmt::format("{} -> Success", name);
     const auto failureTrace = fmt::format("{} -> Could not write event to output", name);
@@ -64,4 +115,40 @@ base::Expression fileOutputBuilder(const json::Json& definition, const std::shar
                                               });
 }
 
+StageBuilder getFileOutputBuilder(const FileOutputOptions& options)
+{
+    if (!options.async)
+    {
+        return fileOutputBuilder;
+    }
+
+    auto writers = std::make_shared<WriterRegistry>();
+    return [options, writers](const json::Json& definition,
+                              const std::shared_ptr<const IBuildCtx>& buildCtx) -> base::Expression
+    {
+        auto [path, projection] = getOutputDefinition(definition);
+        auto writer = writers->get(path, options);
+        auto name = fmt::format("write.output({})", path);
+        const auto successTrace = fmt::format("{} -> Success", name);
+        const auto failureTrace = fmt::format("{} -> Could not write event to output", name);
+
+        return base::Term<base::EngineOp>::create(
+            name,
+            [writer, projection = std::move(projection), successTrace, failureTrace, runState = buildCtx->runState()](
+                base::Event event) -> base::result::Result<base::Event>
+            {
+                try
+                {
+                    thread_local rapidjson::StringBuffer buffer;
+                    writer->write(std::string(projection ? event->str(buffer, *projection) : event->str(buffer)));
+                    RETURN_SUCCESS(runState, event, successTrace);
+                }
+                catch (const std::exception& e)
+                {
+                    RETURN_FAILURE(runState, event, failureTrace);
+                }
+            });
+    };
+}
+
 } // namespace builder::builders
@@ -4,10 +4,13 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include <fmt/format.h>
 
+#include <builder/builder.hpp>
+
 #include "builders/types.hpp"
 
 namespace builder::builders
@@ -25,15 +28,18 @@ class FileOutput
 {
 protected:
     std::ofstream m_os;
+    std::shared_ptr<const json::Projection> m_projection; ///< Fields written, nullptr to write the whole event
 
 public:
     /**
      * @brief Construct a new File Output object
      *
      * @param path file to store the events received
+     * @param projection fields of the events to write, nullptr to write the whole events
      */
-    explicit FileOutput(const std::string& path)
+    explicit FileOutput(const std::string& path, std::shared_ptr<const json::Projection> projection = nullptr)
         : m_os {path, std::ios::out | std::ios::app | std::ios::binary}
+        , m_projection {std::move(projection)}
     {
         if (!this->m_os)
         {
@@ -58,12 +64,27 @@ public:
      *
      * @param e
      */
-    void write(base::ConstEvent e) { this->m_os << e->str() << std::endl; }
+    void write(base::ConstEvent e)
+    {
+        thread_local rapidjson::StringBuffer buffer;
+        this->m_os << (m_projection ? e->str(buffer, *m_projection) : e->str(buffer)) << std::endl;
+    }
 };
 } // namespace detail
 
 base::Expression fileOutputBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Get the file output stage builder for the given options
+ *
+ * In async mode the stages that write to the same path share one writer thread, the events are written in batches
+ * from it instead of from the worker threads.
+ *
+ * @param options File output options
+ * @return StageBuilder
+ */
+StageBuilder getFileOutputBuilder(const FileOutputOptions& options);
+
 } // namespace builder::builders
 
 #endif // _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
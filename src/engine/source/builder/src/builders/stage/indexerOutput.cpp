@@ -0,0 +1,108 @@
+#include "indexerOutput.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "builders/stage/outputs.hpp"
+#include "builders/utils.hpp"
+#include "syntax.hpp"
+
+namespace builder::builders
+{
+
+namespace
+{
+bool isValidIndexName(const std::string& index)
+{
+    constexpr std::string_view FORBIDDEN = "\\/*?\"<>|,#: ";
+    if (index.empty() || index.front() == '-' || index.front() == '_' || index.front() == '+')
+    {
+        return false;
+    }
+
+    return std::none_of(index.begin(),
+                        index.end(),
+                        [&FORBIDDEN](char c)
+                        {
+                            return std::isupper(static_cast<unsigned char>(c))
+                                   || FORBIDDEN.find(c) != std::string_view::npos;
+                        });
+}
+} // namespace
+
+StageBuilder getIndexerOutputBuilder(const std::shared_ptr<indexer::IIndexerConnector>& connector)
+{
+    return [connector](const json::Json& definition,
+                       const std::shared_ptr<const IBuildCtx>& buildCtx) -> base::Expression
+    {
+        if (!definition.isObject())
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' expects an object but got '{}'",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY,
+                                                 definition.typeName()));
+        }
+
+        auto projection = getOutputProjection(definition, syntax::asset::INDEXER_OUTPUT_KEY);
+        const size_t keys = projection ? 2 : 1;
+        if (definition.size() != keys)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' expects an object with {} keys but got '{}'",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY,
+                                                 keys,
+                                                 definition.size()));
+        }
+
+        auto indexValue = definition.getString(json::Json::formatJsonPath(syntax::asset::INDEXER_OUTPUT_INDEX_KEY));
+        if (!indexValue)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' expects an object with the string key '{}'",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY,
+                                                 syntax::asset::INDEXER_OUTPUT_INDEX_KEY));
+        }
+
+        const auto& index = indexValue.value();
+        if (!isValidIndexName(index))
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' got the invalid index name '{}', it must be lowercase and "
+                                                 "can not have spaces or any of \\/*?\"<>|,#:",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY,
+                                                 index));
+        }
+
+        if (!connector)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' can not be used, the indexer connector is not configured",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY));
+        }
+
+        auto name = fmt::format("write.indexer({})", index);
+        const auto successTrace = fmt::format("{} -> Success", name);
+        const auto failureTrace = fmt::format("{} -> Could not send event to the indexer", name);
+
+        return base::Term<base::EngineOp>::create(
+            name,
+            [connector,
+             index,
+             projection = std::move(projection),
+             successTrace,
+             failureTrace,
+             runState = buildCtx->runState()](base::Event event) -> base::result::Result<base::Event>
+            {
+                try
+                {
+                    thread_local rapidjson::StringBuffer buffer;
+                    connector->index(index, projection ? event->str(buffer, *projection) : event->str(buffer));
+                    RETURN_SUCCESS(runState, event, successTrace);
+                }
+                catch (const std::exception& e)
+                {
+                    RETURN_FAILURE(runState, event, failureTrace);
+                }
+            });
+    };
+}
+
+} // namespace builder::builders
@@ -0,0 +1,26 @@
+#ifndef _BUILDER_BUILDERS_STAGE_INDEXEROUTPUT_HPP
+#define _BUILDER_BUILDERS_STAGE_INDEXEROUTPUT_HPP
+
+#include <memory>
+
+#include <indexer/iindexerConnector.hpp>
+
+#include "builders/types.hpp"
+
+namespace builder::builders
+{
+
+/**
+ * @brief Get the indexer output stage builder
+ *
+ * The stage queues the event in the connector, which sends it to the index in bulk requests. It fails to build if no
+ * connector is configured.
+ *
+ * @param connector Indexer connector, may be null
+ * @return StageBuilder
+ */
+StageBuilder getIndexerOutputBuilder(const std::shared_ptr<indexer::IIndexerConnector>& connector);
+
+} // namespace builder::builders
+
+#endif // _BUILDER_BUILDERS_STAGE_INDEXEROUTPUT_HPP
@@ -82,4 +82,48 @@ base::Expression outputsBuilder(const json::Json& definition, const std::shared_
     return base::Broadcast::create("outputs", outputExpressions);
 }
 
+std::shared_ptr<const json::Projection> getOutputProjection(const json::Json& definition, std::string_view stage)
+{
+    const auto fieldsPath = json::Json::formatJsonPath(syntax::asset::OUTPUT_FIELDS_KEY);
+    const auto excludePath = json::Json::formatJsonPath(syntax::asset::OUTPUT_EXCLUDE_KEY);
+    const auto hasFields = definition.exists(fieldsPath);
+    const auto hasExclude = definition.exists(excludePath);
+
+    if (!hasFields && !hasExclude)
+    {
+        return nullptr;
+    }
+    if (hasFields && hasExclude)
+    {
+        throw std::runtime_error(fmt::format("Stage '{}' expects either '{}' or '{}' but got both",
+                                             stage,
+                                             syntax::asset::OUTPUT_FIELDS_KEY,
+                                             syntax::asset::OUTPUT_EXCLUDE_KEY));
+    }
+
+    const auto key = hasFields ? syntax::asset::OUTPUT_FIELDS_KEY : syntax::asset::OUTPUT_EXCLUDE_KEY;
+    const auto items = definition.getArray(hasFields ? fieldsPath : excludePath);
+    if (!items || items->empty())
+    {
+        throw std::runtime_error(fmt::format("Stage '{}' expects '{}' to be a non-empty array of fields", stage, key));
+    }
+
+    std::vector<std::string> paths;
+    for (const auto& item : items.value())
+    {
+        if (!item.isString())
+        {
+            throw std::runtime_error(
+                fmt::format("Stage '{}' expects '{}' to be an array of fields but got an item of type '{}'",
+                            stage,
+                            key,
+                            item.typeName()));
+        }
+        paths.emplace_back(json::Json::formatJsonPath(item.getString().value()));
+    }
+
+    return std::make_shared<const json::Projection>(
+        hasFields ? json::Projection::Mode::Include : json::Projection::Mode::Exclude, paths);
+}
+
 } // namespace builder::builders
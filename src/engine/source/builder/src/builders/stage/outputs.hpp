@@ -1,6 +1,9 @@
 #ifndef _BUILDER_BUILDERS_STAGE_OUTPUTS_HPP
 #define _BUILDER_BUILDERS_STAGE_OUTPUTS_HPP
 
+#include <memory>
+#include <string_view>
+
 #include "builders/types.hpp"
 
 namespace builder::builders
@@ -8,6 +11,16 @@ namespace builder::builders
 
 base::Expression outputsBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Get the fields an output writes, from the optional 'fields' or 'exclude' array of its definition
+ *
+ * @param definition Definition of the output
+ * @param stage Name of the output stage, for the error messages
+ * @return std::shared_ptr<const json::Projection> The compiled projection, nullptr if the whole event is written
+ * @throw std::runtime_error if the arrays are invalid or both are given
+ */
+std::shared_ptr<const json::Projection> getOutputProjection(const json::Json& definition, std::string_view stage);
+
 } // namespace builder::builders
 
 #endif // _BUILDER_BUILDERS_STAGE_OUTPUTS_HPP
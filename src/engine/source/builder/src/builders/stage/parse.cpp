@@ -4,8 +4,112 @@
 
 #include "syntax.hpp"
 
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
 namespace builder::builders
 {
+namespace
+{
+base::Expression buildParseTerm(const std::string& field, const std::string& logparExpr, hlp::parser::Parser&& parser)
+{
+    // Traces
+    const auto name = fmt::format("{}: {}", field, logparExpr);
+    const auto successTrace = fmt::format("[{}] -> Success", name);
+
+    // field to be parsed not exists
+    const std::string failureTrace1 =
+        fmt::format(R"([{}] -> Failure: Parameter "{}" reference not found)", name, field);
+    // Parsing failed
+    const std::string failureTrace2 = fmt::format("[{}] -> Failure: Parse operation failed: ", name);
+    // Parsing ok, mapping failed
+    const std::string failureTrace3 = fmt::format("[{}] -> Failure: field [{}] is not a string", name, field);
+
+    try
+    {
+        return base::Term<base::EngineOp>::create(
+            logparExpr,
+            [=, parser = std::move(parser)](base::Event event)
+            {
+                if (!event->exists(field))
+                {
+                    return base::result::makeFailure(std::move(event), failureTrace1);
+                }
+                if (!event->isString(field))
+                {
+                    return base::result::makeFailure(std::move(event), failureTrace3);
+                }
+
+                // The parsed fields borrow from the pinned log instead of copying it piece by piece
+                const auto ev = event->pin(event->getStringView(field).value());
+                auto error = hlp::parser::run(parser, ev, *event);
+                if (error)
+                {
+                    return base::result::makeFailure(std::move(event), failureTrace2 + error.value().message);
+                }
+
+                return base::result::makeSuccess(std::move(event), successTrace);
+            });
+    }
+    catch (const std::exception& e)
+    {
+        throw std::runtime_error(fmt::format(
+            "[builder::opBuilderLogParser(json)] Exception creating [{}: {}]: {}", field, logparExpr, e.what()));
+    }
+}
+
+/**
+ * @brief Builds a single term for expressions that share a prefix, the prefix is parsed once for all of them.
+ */
+base::Expression buildAlternativesTerm(const std::string& field,
+                                       const std::vector<std::string>& logparExprs,
+                                       hlp::logpar::Logpar::Alternatives&& alternatives)
+{
+    // Traces
+    const auto exprs = fmt::format("{}", fmt::join(logparExprs, " | "));
+    const auto name = fmt::format("{}: {}", field, exprs);
+    std::vector<std::string> successTraces;
+    for (const auto& logparExpr : logparExprs)
+    {
+        successTraces.emplace_back(fmt::format("[{}: {}] -> Success", field, logparExpr));
+    }
+
+    // field to be parsed not exists
+    const std::string failureTrace1 =
+        fmt::format(R"([{}] -> Failure: Parameter "{}" reference not found)", name, field);
+    // Parsing failed
+    const std::string failureTrace2 = fmt::format("[{}] -> Failure: Parse operation failed: ", name);
+    // Parsing ok, mapping failed
+    const std::string failureTrace3 = fmt::format("[{}] -> Failure: field [{}] is not a string", name, field);
+
+    return base::Term<base::EngineOp>::create(
+        exprs,
+        [=, prefix = std::move(alternatives.prefix), suffixes = std::move(alternatives.suffixes)](base::Event event)
+        {
+            if (!event->exists(field))
+            {
+                return base::result::makeFailure(std::move(event), failureTrace1);
+            }
+            if (!event->isString(field))
+            {
+                return base::result::makeFailure(std::move(event), failureTrace3);
+            }
+
+            const auto ev = event->pin(event->getStringView(field).value());
+            auto result = hlp::parser::runAlternatives(prefix, suffixes, ev, *event);
+            if (std::holds_alternative<base::Error>(result))
+            {
+                return base::result::makeFailure(std::move(event),
+                                                 failureTrace2 + std::get<base::Error>(result).message);
+            }
+
+            return base::result::makeSuccess(std::move(event), successTraces[std::get<std::size_t>(result)]);
+        });
+}
+} // namespace
+
 // TODO: QoL error messages
 StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t debugLvl)
 {
@@ -35,7 +139,7 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
         }
 
         auto logparArr = definition.getArray().value();
-        std::vector<base::Expression> parsersExpressions {};
+        std::vector<std::pair<std::string, std::string>> items {};
         for (const json::Json& item : logparArr)
         {
             if (!item.isObject())
@@ -53,65 +157,57 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
             auto field = json::Json::formatJsonPath(std::get<0>(itemObj[0]));
             auto logparExpr = std::get<1>(itemObj[0]).getString().value();
             logparExpr = buildCtx->definitions().replace(logparExpr);
+            items.emplace_back(std::move(field), std::move(logparExpr));
+        }
 
-            hlp::parser::Parser parser;
-            try
+        std::vector<base::Expression> parsersExpressions {};
+        std::size_t first = 0;
+        while (first < items.size())
+        {
+            // Consecutive expressions over the same field are built together, so the ones with the same prefix
+            // share it
+            const auto& field = items[first].first;
+            auto last = first + 1;
+            while (last < items.size() && items[last].first == field)
             {
-                parser = logpar->build(logparExpr);
+                ++last;
             }
-            catch (const std::exception& e)
+
+            std::vector<std::string> logparExprs;
+            for (auto i = first; i < last; ++i)
             {
-                throw std::runtime_error(fmt::format("An error occurred while parsing a log: {}", e.what()));
+                logparExprs.emplace_back(items[i].second);
             }
 
-            // Traces
-            const auto name = fmt::format("{}: {}", field, logparExpr);
-            const auto successTrace = fmt::format("[{}] -> Success", name);
-
-            // field to be parsed not exists
-            const std::string failureTrace1 =
-                fmt::format(R"([{}] -> Failure: Parameter "{}" reference not found)", name, field);
-            // Parsing failed
-            const std::string failureTrace2 = fmt::format("[{}] -> Failure: Parse operation failed: ", name);
-            // Parsing ok, mapping failed
-            const std::string failureTrace3 = fmt::format("[{}] -> Failure: field [{}] is not a string", name, field);
-
-            base::Expression parseExpression;
+            std::vector<hlp::logpar::Logpar::Alternatives> groups;
             try
             {
-                parseExpression = base::Term<base::EngineOp>::create(
-                    logparExpr,
-                    [=, parser = std::move(parser)](base::Event event)
-                    {
-                        if (!event->exists(field))
-                        {
-                            return base::result::makeFailure(std::move(event), failureTrace1);
-                        }
-                        if (!event->isString(field))
-                        {
-                            return base::result::makeFailure(std::move(event), failureTrace3);
-                        }
-
-                        auto ev = event->getString(field).value();
-                        auto error = hlp::parser::run(parser, ev, *event);
-                        if (error)
-                        {
-                            return base::result::makeFailure(std::move(event), failureTrace2 + error.value().message);
-                        }
-
-                        return base::result::makeSuccess(std::move(event), successTrace);
-                    });
+                groups = logpar->buildAlternatives(logparExprs);
             }
             catch (const std::exception& e)
             {
-                throw std::runtime_error(
-                    fmt::format("[builder::opBuilderLogParser(json)] Exception creating [{}: {}]: {}",
-                                field,
-                                logparExpr,
-                                e.what()));
+                throw std::runtime_error(fmt::format("An error occurred while parsing a log: {}", e.what()));
+            }
+
+            for (auto& group : groups)
+            {
+                if (group.suffixes.size() == 1)
+                {
+                    parsersExpressions.push_back(
+                        buildParseTerm(field, logparExprs[group.indexes[0]], std::move(group.suffixes[0])));
+                }
+                else
+                {
+                    std::vector<std::string> groupExprs;
+                    for (auto index : group.indexes)
+                    {
+                        groupExprs.emplace_back(logparExprs[index]);
+                    }
+                    parsersExpressions.push_back(buildAlternativesTerm(field, groupExprs, std::move(group)));
+                }
             }
 
-            parsersExpressions.push_back(parseExpression);
+            first = last;
         }
 
         return base::Or::create("parse", parsersExpressions);
@@ -1,9 +1,12 @@
 #ifndef _BUILDER_POLICY_ASSET_HPP
 #define _BUILDER_POLICY_ASSET_HPP
 
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <base/expression.hpp>
+#include <base/json.hpp>
 
 namespace builder::policy
 {
@@ -14,10 +17,30 @@ namespace builder::policy
  */
 class Asset
 {
+public:
+    /**
+     * @brief Exact value the asset requires in a field to succeed, taken from its check stage
+     *
+     * Assets that require different values in the same field are mutually exclusive, the policy uses it to skip
+     * them without evaluating their conditions.
+     */
+    struct Discriminator
+    {
+        std::string field; ///< Json pointer path of the field
+        json::Json value;  ///< Required value
+
+        friend bool operator==(const Discriminator& lhs, const Discriminator& rhs)
+        {
+            return lhs.field == rhs.field && lhs.value == rhs.value;
+        }
+    };
+
 private:
-    base::Name m_name;                 ///< Asset name
-    base::Expression m_expression;     ///< Asset expression
-    std::vector<base::Name> m_parents; ///< Asset parents
+    base::Name m_name;                            ///< Asset name
+    base::Expression m_expression;                ///< Asset expression
+    std::vector<base::Name> m_parents;            ///< Asset parents
+    std::optional<Discriminator> m_discriminator; ///< Required field value, if any
+    std::optional<std::size_t> m_hash;            ///< Hash of the document the asset was built from, if known
 
 public:
     Asset() = default;
@@ -58,6 +81,34 @@ public:
     inline const std::vector<base::Name>& parents() const { return m_parents; }
     std::vector<base::Name>& parents() { return m_parents; }
 
+    /**
+     * @brief Get the discriminator of the asset
+     *
+     * @return const std::optional<Discriminator>& The discriminator, empty if the asset has none
+     */
+    inline const std::optional<Discriminator>& discriminator() const { return m_discriminator; }
+
+    /**
+     * @brief Set the discriminator of the asset
+     *
+     * @param discriminator Discriminator, must be a necessary condition for the expression to succeed
+     */
+    void setDiscriminator(std::optional<Discriminator>&& discriminator) { m_discriminator = std::move(discriminator); }
+
+    /**
+     * @brief Get the hash of the document the asset was built from
+     *
+     * @return const std::optional<std::size_t>& The hash, empty if the asset was not built by a cached build
+     */
+    inline const std::optional<std::size_t>& hash() const { return m_hash; }
+
+    /**
+     * @brief Set the hash of the document the asset was built from
+     *
+     * @param hash Hash of the document
+     */
+    void setHash(std::size_t hash) { m_hash = hash; }
+
     friend bool operator==(const Asset& lhs, const Asset& rhs)
     {
         return lhs.m_name == rhs.m_name && lhs.m_expression == rhs.m_expression && lhs.m_parents == rhs.m_parents;
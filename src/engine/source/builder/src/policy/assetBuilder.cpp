@@ -1,8 +1,10 @@
 #include "assetBuilder.hpp"
 
+#include <base/logging.hpp>
 #include <base/utils/stringUtils.hpp>
 #include <fmt/format.h>
 
+#include "builders/helperParser.hpp"
 #include "syntax.hpp"
 
 namespace builder::policy
@@ -76,6 +78,9 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
                                                std::vector<std::tuple<std::string, json::Json>>& objDoc) const
 {
     auto newContext = std::make_shared<builders::BuildCtx>(*m_buildCtx);
+    auto validationStats = std::make_shared<builders::ValidationStats>();
+    newContext->setValidationStats(validationStats);
+    newContext->context().assetName = name.toStr();
 
     // Get definitions (optional, may appear anywhere in the asset)
     auto definitionsPos = std::find_if(
@@ -111,6 +116,7 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
                     throw std::runtime_error(fmt::format("Could not find builder for stage '{}'", key));
                 }
                 auto builder = base::getResponse<builders::StageBuilder>(resp);
+                newContext->context().stageName = key;
                 auto check = builder(value, newContext);
                 conditionExpressions.emplace_back(std::move(check));
                 objDoc.erase(objDoc.begin());
@@ -166,6 +172,7 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
                     throw std::runtime_error(fmt::format("Could not find builder for stage '{}'", key));
                 }
                 auto builder = base::getResponse<builders::StageBuilder>(resp);
+                newContext->context().stageName = key;
                 auto parse = builder(stageParseValue, newContext);
                 conditionExpressions.emplace_back(std::move(parse));
                 objDoc.erase(objDoc.begin());
@@ -191,10 +198,16 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
             throw std::runtime_error(fmt::format("Could not find builder for stage '{}'", key));
         }
         auto builder = base::getResponse<builders::StageBuilder>(resp);
+        newContext->context().stageName = key;
         auto consequence = builder(value, newContext);
         consequenceExpressions.emplace_back(std::move(consequence));
     }
 
+    LOG_DEBUG("Asset '{}': {} schema validations resolved at build time, {} kept at runtime",
+              name.toStr(),
+              validationStats->buildTime,
+              validationStats->runtime);
+
     if (consequenceExpressions.empty())
     {
         return base::And::create(name, {std::move(condition)});
@@ -220,6 +233,73 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
     return base::Implication::create(name, std::move(condition), std::move(consequence));
 }
 
+std::optional<Asset::Discriminator>
+AssetBuilder::getDiscriminator(const std::vector<std::tuple<std::string, json::Json>>& objDoc) const
+{
+    // Check stage is the first stage, definitions may appear before it
+    auto checkPos = std::find_if(objDoc.begin(),
+                                 objDoc.end(),
+                                 [](const auto& tuple) { return std::get<0>(tuple) != syntax::asset::DEFINITIONS_KEY; });
+    if (checkPos == objDoc.end() || std::get<0>(*checkPos) != syntax::asset::CHECK_KEY)
+    {
+        return std::nullopt;
+    }
+
+    auto conditions = std::get<1>(*checkPos).getArray();
+    if (!conditions)
+    {
+        return std::nullopt;
+    }
+
+    for (const auto& condition : conditions.value())
+    {
+        auto objCondition = condition.getObject();
+        if (!objCondition || objCondition.value().size() != 1)
+        {
+            continue;
+        }
+
+        const auto& [field, value] = objCondition.value().front();
+        json::Json required;
+        if (value.isBool() || value.isNumber())
+        {
+            required = value;
+        }
+        else if (value.isString())
+        {
+            auto strValue = value.getString().value();
+            if (!builders::parsers::isDefaultHelper(strValue) || strValue.find(syntax::field::REF_ANCHOR) == 0)
+            {
+                continue;
+            }
+
+            // Scaped reference
+            if (strValue.size() >= 2 && strValue[0] == syntax::helper::DEFAULT_ESCAPE
+                && strValue[1] == syntax::field::REF_ANCHOR)
+            {
+                strValue = strValue.substr(1);
+            }
+            required.setString(strValue);
+        }
+        else
+        {
+            continue;
+        }
+
+        // Invalid fields are reported by the check stage builder
+        try
+        {
+            return Asset::Discriminator {.field = json::Json::formatJsonPath(field), .value = std::move(required)};
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return std::nullopt;
+}
+
 Asset AssetBuilder::operator()(const store::Doc& document) const
 {
     // Check document is an object
@@ -274,9 +354,12 @@ Asset AssetBuilder::operator()(const store::Doc& document) const
     }
 
     // Build the expression (rest of keys if any)
+    auto discriminator = getDiscriminator(objDoc);
     auto expression = buildExpression(name, objDoc);
 
-    return Asset {std::move(name), std::move(expression), std::move(parents)};
+    Asset asset {std::move(name), std::move(expression), std::move(parents)};
+    asset.setDiscriminator(std::move(discriminator));
+    return asset;
 }
 
 } // namespace builder::policy
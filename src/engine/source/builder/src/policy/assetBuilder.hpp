@@ -71,6 +71,19 @@ public:
     base::Expression buildExpression(const base::Name& name,
                                      std::vector<std::tuple<std::string, json::Json>>& objDoc) const;
 
+    /**
+     * @brief Obtain the discriminator of the asset from the object containing the asset stages.
+     *
+     * The discriminator is the first condition of a list check stage that compares a field with a literal value,
+     * i.e. not a helper nor a reference. Logic expression checks have no discriminator.
+     *
+     * @param objDoc Object containing the asset stages.
+     *
+     * @return std::optional<Asset::Discriminator> The discriminator, empty if the asset has none.
+     */
+    std::optional<Asset::Discriminator>
+    getDiscriminator(const std::vector<std::tuple<std::string, json::Json>>& objDoc) const;
+
     /**
      * @copydoc IAssetBuilder::operator()
      */
@@ -0,0 +1,154 @@
+#include "policy/buildCache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+namespace builder::policy
+{
+
+namespace
+{
+void hashCombine(std::size_t& seed, std::size_t value)
+{
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+} // namespace
+
+std::size_t BuildCache::hash(const store::Doc& document)
+{
+    return std::hash<std::string> {}(document.str());
+}
+
+std::optional<std::size_t> BuildCache::hash(const Graph<base::Name, Asset>& subgraph)
+{
+    std::hash<std::string> hasher;
+
+    // The nodes and edges are not ordered, sort them so the same subgraph has the same hash
+    std::vector<std::pair<std::string, std::size_t>> nodes;
+    nodes.reserve(subgraph.nodes().size());
+    for (const auto& [name, asset] : subgraph.nodes())
+    {
+        if (name == subgraph.rootId())
+        {
+            continue;
+        }
+        if (!asset.hash())
+        {
+            return std::nullopt;
+        }
+        nodes.emplace_back(name.toStr(), asset.hash().value());
+    }
+    std::sort(nodes.begin(), nodes.end());
+
+    std::vector<std::pair<std::string, const std::vector<base::Name>*>> edges;
+    edges.reserve(subgraph.edges().size());
+    for (const auto& [parent, children] : subgraph.edges())
+    {
+        edges.emplace_back(parent.toStr(), &children);
+    }
+    std::sort(edges.begin(), edges.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    std::size_t seed = hasher(subgraph.rootId().toStr());
+    for (const auto& [name, assetHash] : nodes)
+    {
+        hashCombine(seed, hasher(name));
+        hashCombine(seed, assetHash);
+    }
+    for (const auto& [parent, children] : edges)
+    {
+        hashCombine(seed, hasher(parent));
+        // The order of the children is the order of evaluation
+        hashCombine(seed, children->size());
+        for (const auto& child : *children)
+        {
+            hashCombine(seed, hasher(child.toStr()));
+        }
+    }
+
+    return seed;
+}
+
+std::optional<Asset> BuildCache::getAsset(const base::Name& name, std::size_t hash) const
+{
+    std::shared_lock lock {m_mutex};
+    auto it = m_assets.find(name);
+    if (it == m_assets.end() || it->second.hash != hash)
+    {
+        return std::nullopt;
+    }
+
+    return it->second.asset;
+}
+
+void BuildCache::putAsset(const base::Name& name, const Asset& asset)
+{
+    if (!asset.hash())
+    {
+        return;
+    }
+
+    std::unique_lock lock {m_mutex};
+    m_assets.insert_or_assign(name, CachedAsset {asset.hash().value(), asset});
+}
+
+std::optional<base::Expression> BuildCache::getSubgraph(const std::string& key, std::size_t hash) const
+{
+    std::shared_lock lock {m_mutex};
+    auto it = m_subgraphs.find(key);
+    if (it == m_subgraphs.end() || it->second.hash != hash)
+    {
+        return std::nullopt;
+    }
+
+    return it->second.expression;
+}
+
+void BuildCache::putSubgraph(const std::string& key, std::size_t hash, const base::Expression& expression)
+{
+    std::unique_lock lock {m_mutex};
+    m_subgraphs.insert_or_assign(key, CachedSubgraph {hash, expression});
+}
+
+std::optional<base::Expression> BuildCache::getSharedSubgraph(std::size_t hash) const
+{
+    std::shared_lock lock {m_mutex};
+    auto it = m_shared.find(hash);
+    if (it == m_shared.end())
+    {
+        return std::nullopt;
+    }
+
+    auto expression = it->second.lock();
+    if (expression == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return expression;
+}
+
+void BuildCache::putSharedSubgraph(std::size_t hash, const base::Expression& expression)
+{
+    std::unique_lock lock {m_mutex};
+
+    // Forget the subgraphs of the policies that are gone, there are only a few subgraphs
+    for (auto it = m_shared.begin(); it != m_shared.end();)
+    {
+        it = it->second.expired() ? m_shared.erase(it) : std::next(it);
+    }
+
+    m_shared.insert_or_assign(hash, expression);
+}
+
+void BuildCache::clear()
+{
+    std::unique_lock lock {m_mutex};
+    m_assets.clear();
+    m_subgraphs.clear();
+    m_shared.clear();
+}
+
+} // namespace builder::policy
@@ -0,0 +1,131 @@
+#ifndef _BUILDER_POLICY_BUILDCACHE_HPP
+#define _BUILDER_POLICY_BUILDCACHE_HPP
+
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include <base/expression.hpp>
+#include <base/graph.hpp>
+#include <store/istore.hpp>
+
+#include "asset.hpp"
+
+namespace builder::policy
+{
+
+/**
+ * @brief Assets and subgraph expressions of the previous policy builds, by content hash.
+ *
+ * An asset is built again only if its document changed. A subgraph expression is built again only if any of its
+ * assets, their relations or the injected filters changed, so after a catalog update a policy only rebuilds the dirty
+ * assets and the subgraphs that contain them. The built expressions are never modified, the policies share them.
+ *
+ * The cache keeps the last version of each asset and of each subgraph of each policy, so it does not grow with the
+ * updates. The decoder subgraphs are also shared between policies: the policies with the same decoders, relations and
+ * filters get the same expression, so the router can decode an event once for all of them. It is thread safe.
+ *
+ * The cache only lives in memory: the expressions are closures over helper state (compiled regular expressions, kvdb
+ * handles, parsers, sockets...) that cannot be written to disk and mapped back, so a restart builds the policies
+ * again. The builder_threads option spreads that first build over several threads.
+ */
+class BuildCache
+{
+private:
+    struct CachedAsset
+    {
+        std::size_t hash; ///< Hash of the document
+        Asset asset;      ///< Asset built from the document, without default parents
+    };
+
+    struct CachedSubgraph
+    {
+        std::size_t hash; ///< Hash of the subgraph
+        base::Expression expression;
+    };
+
+    std::unordered_map<base::Name, CachedAsset> m_assets;
+    std::unordered_map<std::string, CachedSubgraph> m_subgraphs;           ///< By policy and asset type
+    std::unordered_map<std::size_t, std::weak_ptr<base::Formula>> m_shared; ///< Shared subgraphs by hash, while used
+    mutable std::shared_mutex m_mutex;
+
+public:
+    /**
+     * @brief Hash of an asset document.
+     *
+     * @param document Store document of the asset.
+     * @return std::size_t
+     */
+    static std::size_t hash(const store::Doc& document);
+
+    /**
+     * @brief Hash of a subgraph, takes the hash of each asset, the relations and the order of the children.
+     *
+     * @param subgraph Subgraph of the policy.
+     * @return std::optional<std::size_t> The hash, empty if an asset was not built from a hashed document.
+     */
+    static std::optional<std::size_t> hash(const Graph<base::Name, Asset>& subgraph);
+
+    /**
+     * @brief Get the asset built from a document.
+     *
+     * @param name Name of the asset.
+     * @param hash Hash of the current document of the asset.
+     * @return std::optional<Asset> The asset, empty if it was not built or the document changed.
+     */
+    std::optional<Asset> getAsset(const base::Name& name, std::size_t hash) const;
+
+    /**
+     * @brief Store the asset built from a document, replacing the previous version.
+     *
+     * @param name Name of the asset.
+     * @param asset Built asset, its hash is the hash of the document.
+     */
+    void putAsset(const base::Name& name, const Asset& asset);
+
+    /**
+     * @brief Get the expression of a subgraph.
+     *
+     * @param key Policy and asset type of the subgraph.
+     * @param hash Hash of the current subgraph.
+     * @return std::optional<base::Expression> The expression, empty if it was not built or the subgraph changed.
+     */
+    std::optional<base::Expression> getSubgraph(const std::string& key, std::size_t hash) const;
+
+    /**
+     * @brief Store the expression of a subgraph, replacing the previous version.
+     *
+     * @param key Policy and asset type of the subgraph.
+     * @param hash Hash of the subgraph.
+     * @param expression Expression of the subgraph.
+     */
+    void putSubgraph(const std::string& key, std::size_t hash, const base::Expression& expression);
+
+    /**
+     * @brief Get the expression of a subgraph built by any policy, as long as a policy still uses it.
+     *
+     * @param hash Hash of the subgraph.
+     * @return std::optional<base::Expression> The expression, empty if no policy in use built it.
+     */
+    std::optional<base::Expression> getSharedSubgraph(std::size_t hash) const;
+
+    /**
+     * @brief Share the expression of a subgraph with the other policies, the cache does not keep it alive.
+     *
+     * @param hash Hash of the subgraph.
+     * @param expression Expression of the subgraph.
+     */
+    void putSharedSubgraph(std::size_t hash, const base::Expression& expression);
+
+    /**
+     * @brief Drop all the cached assets and subgraphs.
+     *
+     */
+    void clear();
+};
+
+} // namespace builder::policy
+
+#endif // _BUILDER_POLICY_BUILDCACHE_HPP
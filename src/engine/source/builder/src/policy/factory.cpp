@@ -1,7 +1,13 @@
 #include "policy/factory.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
 #include <numeric> // std::accumulate
+#include <optional>
 #include <stdexcept>
+#include <thread>
 
 #include <fmt/format.h>
 
@@ -318,45 +324,150 @@ PolicyData readData(const store::Doc& doc, const std::shared_ptr<store::IStoreRe
 
 BuiltAssets buildAssets(const PolicyData& data,
                         const std::shared_ptr<store::IStoreReader> store,
-                        const std::shared_ptr<IAssetBuilder>& assetBuilder)
+                        const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                        const std::shared_ptr<BuildCache>& cache,
+                        std::size_t threads)
 {
-    BuiltAssets builtAssets;
-
-    // Build assets for each type
+    // An asset to build, in the order of the policy data
+    struct Job
+    {
+        PolicyData::AssetType type;
+        const store::NamespaceId* ns;
+        const base::Name* name;
+        const SubgraphData* subgraphData;
+        store::Doc doc;
+        std::optional<std::size_t> hash;
+        Asset asset;
+        bool built = false;
+    };
+
+    std::vector<Job> jobs;
+
+    // Read the documents, the store is only accessed from the calling thread
     for (const auto& [assetType, subgraphData] : data.subgraphs())
     {
         for (const auto& [assetNs, assetNames] : subgraphData.assets)
         {
             for (const auto& assetName : assetNames)
             {
-                // Get document
                 auto resp = store::utils::get(store, assetName);
                 if (base::isError(resp))
                 {
                     throw std::runtime_error(fmt::format("Asset '{}' not found", assetName));
                 }
 
-                Asset asset = (*assetBuilder)(base::getResponse<store::Doc>(resp));
-
-                // Add parents
-                if (asset.parents().empty())
+                auto& job = jobs.emplace_back(Job {.type = assetType,
+                                                   .ns = &assetNs,
+                                                   .name = &assetName,
+                                                   .subgraphData = &subgraphData,
+                                                   .doc = std::move(base::getResponse<store::Doc>(resp))});
+                if (cache)
                 {
-                    auto defParentIt = subgraphData.defaultParents.find(assetNs);
-                    if (defParentIt != subgraphData.defaultParents.end())
+                    // Unchanged documents reuse the asset of the previous build
+                    job.hash = BuildCache::hash(job.doc);
+                    if (auto cached = cache->getAsset(assetName, job.hash.value()))
                     {
-                        asset.parents().emplace_back(defParentIt->second);
+                        job.asset = std::move(cached.value());
+                        job.built = true;
                     }
                 }
+            }
+        }
+    }
 
-                // Add built asset to the subgraph
-                if (builtAssets.find(assetType) == builtAssets.end())
+    std::vector<Job*> pending;
+    for (auto& job : jobs)
+    {
+        if (!job.built)
+        {
+            pending.push_back(&job);
+        }
+    }
+
+    if (threads == 0)
+    {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, pending.size());
+
+    if (threads <= 1)
+    {
+        for (auto* job : pending)
+        {
+            job->asset = (*assetBuilder)(job->doc);
+        }
+    }
+    else
+    {
+        // Each thread takes the next asset to build, so the slow assets (large parsers, regular expressions...) do
+        // not leave the other threads idle. The first error stops the build and is thrown on the calling thread.
+        std::atomic<std::size_t> next {0};
+        std::atomic<bool> failed {false};
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        auto worker = [&]()
+        {
+            for (auto i = next++; i < pending.size() && !failed; i = next++)
+            {
+                try
                 {
-                    builtAssets.emplace(assetType, std::unordered_map<base::Name, Asset> {});
+                    pending[i]->asset = (*assetBuilder)(pending[i]->doc);
                 }
+                catch (...)
+                {
+                    std::lock_guard lock {errorMutex};
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i)
+        {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    if (cache)
+    {
+        for (auto* job : pending)
+        {
+            job->asset.setHash(job->hash.value());
+            cache->putAsset(*job->name, job->asset);
+        }
+    }
 
-                builtAssets[assetType].emplace(assetName, asset);
+    BuiltAssets builtAssets;
+    for (auto& job : jobs)
+    {
+        // Add parents
+        if (job.asset.parents().empty())
+        {
+            auto defParentIt = job.subgraphData->defaultParents.find(*job.ns);
+            if (defParentIt != job.subgraphData->defaultParents.end())
+            {
+                job.asset.parents().emplace_back(defParentIt->second);
             }
         }
+
+        // Add built asset to the subgraph
+        builtAssets[job.type].emplace(*job.name, std::move(job.asset));
     }
 
     return builtAssets;
@@ -467,7 +578,92 @@ PolicyGraph buildGraph(const BuiltAssets& assets, const PolicyData& data)
     return graph;
 }
 
-base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& data)
+namespace
+{
+base::Expression buildDispatchGuard(const Asset::Discriminator& discriminator)
+{
+    const auto name = fmt::format("dispatch: {} == {}", discriminator.field, discriminator.value.str());
+    const auto successTrace = fmt::format("[{}] -> Success", name);
+    const auto failureTrace = fmt::format("[{}] -> Failure", name);
+
+    return base::Term<base::EngineOp>::create(
+        name,
+        [field = json::FieldRef(discriminator.field), value = discriminator.value, successTrace, failureTrace](
+            base::Event event)
+        {
+            if (event->equals(field, value))
+            {
+                return base::result::makeSuccess(event, successTrace);
+            }
+
+            return base::result::makeFailure(event, failureTrace);
+        });
+}
+} // namespace
+
+std::vector<base::Expression> buildDispatch(const Graph<base::Name, Asset>& subgraph,
+                                            const std::vector<base::Name>& children,
+                                            std::vector<base::Expression>&& operands)
+{
+    if (children.size() != operands.size())
+    {
+        throw std::runtime_error("Each operand must have its asset to be dispatched");
+    }
+
+    std::vector<base::Expression> dispatched;
+    std::size_t i = 0;
+    while (i < operands.size())
+    {
+        const auto& discriminator = subgraph.node(children[i]).discriminator();
+
+        // Run of consecutive operands discriminated by the same field
+        auto end = i;
+        while (end < operands.size())
+        {
+            const auto& current = subgraph.node(children[end]).discriminator();
+            if (!discriminator || !current || current->field != discriminator->field)
+            {
+                break;
+            }
+            ++end;
+        }
+
+        if (end - i < MIN_DISPATCH_RUN)
+        {
+            dispatched.emplace_back(std::move(operands[i]));
+            ++i;
+            continue;
+        }
+
+        // Buckets by value, in order of first appearance
+        std::vector<std::pair<Asset::Discriminator, std::vector<base::Expression>>> buckets;
+        for (; i < end; ++i)
+        {
+            const auto& current = subgraph.node(children[i]).discriminator().value();
+            auto bucket = std::find_if(
+                buckets.begin(), buckets.end(), [&current](const auto& pair) { return pair.first == current; });
+            if (bucket == buckets.end())
+            {
+                buckets.emplace_back(current, std::vector<base::Expression> {});
+                bucket = buckets.end() - 1;
+            }
+            bucket->second.emplace_back(std::move(operands[i]));
+        }
+
+        for (auto& [bucketDiscriminator, bucketOperands] : buckets)
+        {
+            auto guard = buildDispatchGuard(bucketDiscriminator);
+            const auto name = guard->getName();
+            dispatched.emplace_back(
+                base::And::create(name, {std::move(guard), base::Or::create(name, std::move(bucketOperands))}));
+        }
+    }
+
+    return dispatched;
+}
+
+base::Expression
+buildExpression(const PolicyGraph& graph, const PolicyData& data, const std::shared_ptr<BuildCache>& cache)
 {
     // Expression of the policy, expression to be returned.
     // All subgraphs are added to this expression.
@@ -476,6 +672,32 @@ base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& dat
     // Generate the graph in the specified order
     for (const auto& [assetType, subgraph] : graph.subgraphs)
     {
+        // Reuse the expression of the previous build if the subgraph did not change
+        std::optional<std::size_t> subgraphHash;
+        const auto cacheKey = fmt::format("{}/{}", data.name(), PolicyData::assetTypeStr(assetType));
+        if (cache)
+        {
+            subgraphHash = BuildCache::hash(subgraph);
+            if (subgraphHash)
+            {
+                auto cached = cache->getSubgraph(cacheKey, subgraphHash.value());
+                if (!cached && assetType == PolicyData::AssetType::DECODER)
+                {
+                    // Another policy may have built the same decoders, sharing them lets the router decode once
+                    cached = cache->getSharedSubgraph(subgraphHash.value());
+                    if (cached)
+                    {
+                        cache->putSubgraph(cacheKey, subgraphHash.value(), cached.value());
+                    }
+                }
+                if (cached)
+                {
+                    policy->getOperands().emplace_back(std::move(cached.value()));
+                    continue;
+                }
+            }
+        }
+
         // Create subgraph expression
         base::Expression subgraphExpr;
 
@@ -492,6 +714,15 @@ base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& dat
                 throw std::runtime_error("Invalid asset type");
         }
 
+        if (subgraphHash)
+        {
+            cache->putSubgraph(cacheKey, subgraphHash.value(), subgraphExpr);
+            if (assetType == PolicyData::AssetType::DECODER)
+            {
+                cache->putSharedSubgraph(subgraphHash.value(), subgraphExpr);
+            }
+        }
+
         // Add subgraph expression to the policy expression
         policy->getOperands().emplace_back(subgraphExpr);
     }
@@ -12,6 +12,7 @@
 #include <base/graph.hpp>
 #include <store/istore.hpp>
 
+#include "buildCache.hpp"
 #include "iregistry.hpp"
 #include "iassetBuilder.hpp"
 
@@ -244,6 +245,9 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
  * @param data Policy data.
  * @param store The store interface to query assets and namespaces.
  * @param assetBuilder The asset builder instance to build each asset.
+ * @param cache Assets of the previous builds, only the assets whose document changed are built. Nullptr to build all.
+ * @param threads Number of threads building the assets, 1 to build them on the calling thread and 0 to use one per
+ * hardware thread. The documents are read and the result is assembled on the calling thread.
  *
  * @return BuiltAssets
  *
@@ -251,7 +255,9 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
  */
 BuiltAssets buildAssets(const PolicyData& data,
                         const std::shared_ptr<store::IStoreReader> store,
-                        const std::shared_ptr<IAssetBuilder>& assetBuilder);
+                        const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                        const std::shared_ptr<BuildCache>& cache = nullptr,
+                        std::size_t threads = 1);
 
 /**
  * @brief This struct contains the policy graphs by type.
@@ -303,6 +309,26 @@ Graph<base::Name, Asset> buildSubgraph(const std::string& subgraphName,
  */
 PolicyGraph buildGraph(const BuiltAssets& assets, const PolicyData& data);
 
+constexpr std::size_t MIN_DISPATCH_RUN = 3; ///< Min consecutive discriminated siblings to group them
+
+/**
+ * @brief Group the operands of an Or by the discriminator of their assets.
+ *
+ * Runs of consecutive operands whose assets require a value in the same field are split into buckets by value. Each
+ * bucket becomes And(guard, Or(bucket)), where the guard compares the field once, so an event only evaluates the
+ * conditions of the assets that can match it. Assets of different buckets are mutually exclusive and the order inside
+ * each bucket is kept, so the first asset that succeeds is the same as without the grouping.
+ *
+ * @param subgraph Subgraph of the operands.
+ * @param children Asset name of each operand.
+ * @param operands Operands of the Or, in order.
+ *
+ * @return std::vector<base::Expression> The new operands.
+ */
+std::vector<base::Expression> buildDispatch(const Graph<base::Name, Asset>& subgraph,
+                                            const std::vector<base::Name>& children,
+                                            std::vector<base::Expression>&& operands);
+
 /**
  * @brief Generates the expression of a subgraph.
  *
@@ -324,6 +350,25 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
     // Avoid duplicating nodes when multiple parents has the same child node
     std::map<std::string, base::Expression> builtNodes;
 
+    // Only the first asset that succeeds is run in an Or, so its operands can be dispatched
+    auto addChildren = [&](base::Operation& operation, const std::string& parent, auto& visitRef)
+    {
+        const auto& children = subgraph.children(parent);
+        std::vector<base::Expression> childrenExpr;
+        for (auto& child : children)
+        {
+            childrenExpr.push_back(visitRef(child, parent, visitRef));
+        }
+
+        if constexpr (std::is_same_v<ChildOperator, base::Or>)
+        {
+            childrenExpr = buildDispatch(subgraph, children, std::move(childrenExpr));
+        }
+
+        auto& operands = operation.getOperands();
+        operands.insert(operands.end(), childrenExpr.begin(), childrenExpr.end());
+    };
+
     // parentNode Expression is passed as filters need it.
     auto visit = [&](const std::string& current, const std::string& parent, auto& visitRef) -> base::Expression
     {
@@ -348,10 +393,7 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
                 assetNode = base::Implication::create(asset.name() + "Node", asset.expression(), assetChildren);
 
                 // Visit children and add them to the children node
-                for (auto& child : subgraph.children(current))
-                {
-                    assetChildren->getOperands().push_back(visitRef(child, current, visitRef));
-                }
+                addChildren(*assetChildren, current, visitRef);
             }
             else
             {
@@ -370,10 +412,7 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
     };
 
     // Visit root childs and add them to the root expression
-    for (auto& child : subgraph.children(subgraph.rootId()))
-    {
-        root->getOperands().push_back(visit(child, subgraph.rootId(), visit));
-    }
+    addChildren(*root, subgraph.rootId(), visit);
 
     return root;
 }
@@ -383,12 +422,15 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
  *
  * @param graph Policy graph.
  * @param data Policy data.
+ * @param cache Subgraph expressions of the previous builds, only the changed subgraphs are generated. The decoders
+ * subgraph is also taken from the other policies that built the same one. Nullptr to generate all.
  *
  * @return base::Expression
  *
  * @throw std::runtime_error If any error occurs.
  */
-base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& data);
+base::Expression
+buildExpression(const PolicyGraph& graph, const PolicyData& data, const std::shared_ptr<BuildCache>& cache = nullptr);
 
 } // namespace builder::policy::factory
 
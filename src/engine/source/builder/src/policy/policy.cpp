@@ -13,7 +13,9 @@ Policy::Policy(const store::Doc& doc,
                const std::shared_ptr<store::IStoreReader>& store,
                const std::shared_ptr<defs::IDefinitionsBuilder>& definitionsBuilder,
                const std::shared_ptr<builders::RegistryType>& registry,
-               const std::shared_ptr<schemf::IValidator>& schema)
+               const std::shared_ptr<schemf::IValidator>& schema,
+               const std::shared_ptr<BuildCache>& cache,
+               std::size_t buildThreads)
 {
     // Read the policy data
     auto policyData = factory::readData(doc, store);
@@ -33,7 +35,7 @@ Policy::Policy(const store::Doc& doc,
     buildCtx->runState().trace = true;
 
     auto assetBuilder = std::make_shared<AssetBuilder>(buildCtx, definitionsBuilder);
-    auto builtAssets = factory::buildAssets(policyData, store, assetBuilder);
+    auto builtAssets = factory::buildAssets(policyData, store, assetBuilder, cache, buildThreads);
 
     // Assign the assets
     for (const auto& [type, assets] : builtAssets)
@@ -50,7 +52,16 @@ Policy::Policy(const store::Doc& doc,
     // TODO: Assign graphiv string
 
     // Build the expression
-    m_expression = factory::buildExpression(policyGraph, policyData);
+    m_expression = factory::buildExpression(policyGraph, policyData, cache);
+
+    // Split the decoders from the other stages, the stages of the expression follow the order of the asset types
+    const auto& stages = m_expression->getPtr<base::Operation>()->getOperands();
+    if (policyGraph.subgraphs.find(factory::PolicyData::AssetType::DECODER) != policyGraph.subgraphs.end()
+        && !stages.empty())
+    {
+        m_decoders = stages.front();
+        m_postDecoders = base::Chain::create(m_name.toStr(), {stages.begin() + 1, stages.end()});
+    }
 }
 
 } // namespace builder::policy
@@ -7,6 +7,7 @@
 #include <store/istore.hpp>
 
 #include "builders/ibuildCtx.hpp"
+#include "policy/buildCache.hpp"
 
 namespace builder::policy
 {
@@ -21,6 +22,8 @@ private:
     std::string m_hash;                      ///< Hash of the policy
     std::unordered_set<base::Name> m_assets; ///< Assets in the policy
     base::Expression m_expression;           ///< Expression of the policy
+    base::Expression m_decoders;             ///< Decoders stage of the expression, may be shared with other policies
+    base::Expression m_postDecoders;         ///< Rules and outputs stages of the expression
 
 public:
     Policy() = default;
@@ -34,12 +37,16 @@ public:
      * @param definitionsBuilder Definitions builder
      * @param registry Registry instance
      * @param schema Schema validator instance
+     * @param cache Assets and subgraphs of the previous builds to reuse, nullptr to build everything
+     * @param buildThreads Threads building the assets, see factory::buildAssets
      */
     Policy(const store::Doc& doc,
            const std::shared_ptr<store::IStoreReader>& store,
            const std::shared_ptr<defs::IDefinitionsBuilder>& definitionsBuilder,
            const std::shared_ptr<builders::RegistryType>& registry,
-           const std::shared_ptr<schemf::IValidator>& schema);
+           const std::shared_ptr<schemf::IValidator>& schema,
+           const std::shared_ptr<BuildCache>& cache = nullptr,
+           std::size_t buildThreads = 1);
 
     /**
      * @copydoc IPolicy::name
@@ -63,6 +70,16 @@ public:
      */
     inline const base::Expression& expression() const override { return m_expression; }
 
+    /**
+     * @copydoc IPolicy::decoders
+     */
+    inline base::Expression decoders() const override { return m_decoders; }
+
+    /**
+     * @copydoc IPolicy::postDecoders
+     */
+    inline base::Expression postDecoders() const override { return m_postDecoders; }
+
     /**
      * @copydoc IPolicy::getGraphivzStr
      */
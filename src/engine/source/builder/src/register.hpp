@@ -10,6 +10,7 @@
 // Filter builders
 #include "builders/opfilter/exists.hpp"
 #include "builders/opfilter/filter.hpp"
+#include "builders/opfilter/frequency.hpp"
 #include "builders/opfilter/opBuilderHelperFilter.hpp"
 
 // Map builders
@@ -30,6 +31,7 @@
 // Stage builders
 #include "builders/stage/check.hpp"
 #include "builders/stage/fileOutput.hpp"
+#include "builders/stage/indexerOutput.hpp"
 #include "builders/stage/map.hpp"
 #include "builders/stage/normalize.hpp"
 #include "builders/stage/outputs.hpp"
@@ -87,6 +89,9 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
         {schemf::JTypeToken::create(json::Json::Type::Number), builders::opfilter::opBuilderHelperIntNotEqual});
     registry->template add<builders::OpBuilderEntry>(
         "ip_cidr_match", {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::opBuilderHelperIPCIDR});
+    registry->template add<builders::OpBuilderEntry>(
+        "ip_cidr_set_match",
+        {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::opBuilderHelperIPCIDRSet});
     registry->template add<builders::OpBuilderEntry>(
         "is_public_ip", {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::opBuilderHelperPublicIP});
     registry->template add<builders::OpBuilderEntry>(
@@ -151,6 +156,10 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
     registry->template add<builders::OpBuilderEntry>(
         "exists_key_in",
         {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::opBuilderHelperMatchKey});
+    registry->template add<builders::OpBuilderEntry>(
+        "frequency",
+        {schemf::runtimeValidation(),
+         builders::opfilter::getFrequencyBuilder(std::make_shared<builders::opfilter::FrequencyStores>())});
 
     // Map builders
     registry->template add<builders::OpBuilderEntry>("map",
@@ -287,6 +296,10 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
     registry->template add<builders::OpBuilderEntry>(
         "kvdb_get_merge",
         {schemf::runtimeValidation(), builders::getOpBuilderKVDBGetMerge(deps.kvdbManager, deps.kvdbScopeName)});
+    registry->template add<builders::OpBuilderEntry>(
+        "kvdb_ip_cidr_match",
+        {schemf::STypeToken::create(schemf::Type::IP),
+         builders::getOpBuilderKVDBIPCIDRMatch(deps.kvdbManager, deps.kvdbScopeName)});
     registry->template add<builders::OpBuilderEntry>(
         "kvdb_match",
         {schemf::runtimeValidation(), builders::getOpBuilderKVDBMatch(deps.kvdbManager, deps.kvdbScopeName)});
@@ -350,7 +363,10 @@ void registerStageBuilders(const std::shared_ptr<Registry>& registry, const Buil
     registry->template add<builders::StageBuilder>(syntax::asset::PARSE_KEY,
                                                    builders::getParseBuilder(deps.logpar, deps.logparDebugLvl));
     registry->template add<builders::StageBuilder>(syntax::asset::OUTPUTS_KEY, builders::outputsBuilder);
-    registry->template add<builders::StageBuilder>(syntax::asset::FILE_OUTPUT_KEY, builders::fileOutputBuilder);
+    registry->template add<builders::StageBuilder>(syntax::asset::FILE_OUTPUT_KEY,
+                                                   builders::getFileOutputBuilder(deps.fileOutput));
+    registry->template add<builders::StageBuilder>(syntax::asset::INDEXER_OUTPUT_KEY,
+                                                   builders::getIndexerOutputBuilder(deps.indexerConnector));
 }
 
 } // namespace builder::detail
@@ -12,6 +12,7 @@ class MockBuilder : public IBuilder
 public:
     MOCK_METHOD(std::shared_ptr<IPolicy>, buildPolicy, (const base::Name& name), (const, override));
     MOCK_METHOD(base::Expression, buildAsset, (const base::Name& name), (const, override));
+    MOCK_METHOD(std::optional<AssetDiscriminator>, assetDiscriminator, (const base::Name& name), (const, override));
 };
 } // namespace builder::mocks
 
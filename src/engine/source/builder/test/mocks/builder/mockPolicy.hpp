@@ -14,6 +14,8 @@ public:
     MOCK_METHOD(const std::string&, hash, (), (const, override));
     MOCK_METHOD(const std::unordered_set<base::Name>&, assets, (), (const, override));
     MOCK_METHOD(const base::Expression&, expression, (), (const, override));
+    MOCK_METHOD(base::Expression, decoders, (), (const, override));
+    MOCK_METHOD(base::Expression, postDecoders, (), (const, override));
     MOCK_METHOD(std::string, getGraphivzStr, (), (const, override));
 };
 } // namespace builder::mocks
@@ -175,6 +175,52 @@ INSTANTIATE_TEST_SUITE_P(
                 opfilter::opBuilderHelperNotContains,
                 "target",
                 {makeRef("ref"), makeRef("notRef"), makeValue(R"("value")"), makeValue(R"("value4")")},
+                FAILURE()),
+        /*** Constant parameters compiled into a set ***/
+        FilterT(R"({"target": [1, "b", {"key": "value"}]})",
+                opfilter::opBuilderHelperContainsAny,
+                "target",
+                {makeValue(R"(1.0)"), makeValue(R"("x")")},
+                SUCCESS()),
+        FilterT(R"({"target": [1, "b", {"key": "value"}]})",
+                opfilter::opBuilderHelperContainsAny,
+                "target",
+                {makeValue(R"("1")"), makeValue(R"({"key": "other"})")},
+                FAILURE()),
+        FilterT(R"({"target": [1, "b", {"key": "value"}]})",
+                opfilter::opBuilderHelperContainsAny,
+                "target",
+                {makeValue(R"("x")"), makeValue(R"({"key": "value"})")},
+                SUCCESS()),
+        FilterT(R"({"target": ["a", "b", "a"]})",
+                opfilter::opBuilderHelperContains,
+                "target",
+                {makeValue(R"("a")"), makeValue(R"("a")"), makeValue(R"("b")")},
+                SUCCESS()),
+        FilterT(R"({"target": ["a", "a"]})",
+                opfilter::opBuilderHelperContains,
+                "target",
+                {makeValue(R"("a")"), makeValue(R"("b")")},
+                FAILURE()),
+        FilterT(R"({"target": ["a", "b"]})",
+                opfilter::opBuilderHelperNotContainsAny,
+                "target",
+                {makeValue(R"("a")"), makeValue(R"("b")")},
+                FAILURE()),
+        FilterT(R"({"target": ["a", "b"]})",
+                opfilter::opBuilderHelperNotContainsAny,
+                "target",
+                {makeValue(R"("a")"), makeValue(R"("c")")},
+                SUCCESS()),
+        FilterT(R"({"target": ["a", "b"]})",
+                opfilter::opBuilderHelperNotContains,
+                "target",
+                {makeValue(R"("c")"), makeValue(R"("d")")},
+                SUCCESS()),
+        FilterT(R"({"target": ["a", "b"]})",
+                opfilter::opBuilderHelperNotContains,
+                "target",
+                {makeValue(R"("c")"), makeValue(R"("b")")},
                 FAILURE())),
     testNameFormatter<FilterOperationTest>("ArrayContains"));
 } // namespace filteroperatestest
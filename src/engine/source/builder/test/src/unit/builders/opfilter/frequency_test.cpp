@@ -0,0 +1,204 @@
+#include "builders/baseBuilders_test.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include "builders/opfilter/frequency.hpp"
+
+namespace
+{
+auto getBuilder()
+{
+    return []()
+    {
+        return opfilter::getFrequencyBuilder(std::make_shared<opfilter::FrequencyStores>());
+    };
+}
+} // namespace
+
+namespace filterbuildtest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    FilterBuilderWithDepsTest,
+    testing::Values(
+        // Wrong arguments number
+        FilterDepsT({}, getBuilder(), FAILURE()),
+        FilterDepsT({makeValue(R"(3)")}, getBuilder(), FAILURE()),
+        // Threshold and timeframe
+        FilterDepsT({makeValue(R"(3)"), makeValue(R"(60)")}, getBuilder(), SUCCESS()),
+        FilterDepsT({makeValue(R"(0)"), makeValue(R"(60)")}, getBuilder(), FAILURE()),
+        FilterDepsT({makeValue(R"(3)"), makeValue(R"(-1)")}, getBuilder(), FAILURE()),
+        FilterDepsT({makeValue(R"(1.5)"), makeValue(R"(60)")}, getBuilder(), FAILURE()),
+        FilterDepsT({makeValue(R"("3")"), makeValue(R"(60)")}, getBuilder(), FAILURE()),
+        FilterDepsT({makeRef("ref"), makeValue(R"(60)")}, getBuilder(), FAILURE()),
+        FilterDepsT({makeValue(R"(3)"), makeRef("ref")}, getBuilder(), FAILURE()),
+        // Other key fields
+        FilterDepsT(
+            {makeValue(R"(3)"), makeValue(R"(60)"), makeRef("ref"), makeRef("ref2")}, getBuilder(), SUCCESS()),
+        FilterDepsT({makeValue(R"(3)"), makeValue(R"(60)"), makeValue(R"("value")")}, getBuilder(), FAILURE())),
+    testNameFormatter<FilterBuilderWithDepsTest>("Frequency"));
+} // namespace filterbuildtest
+
+namespace filteroperatestest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    FilterOperationWithDepsTest,
+    testing::Values(
+        FilterDepsT(R"({"target": "1.1.1.1"})",
+                    getBuilder(),
+                    "target",
+                    {makeValue(R"(1)"), makeValue(R"(60)")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": "1.1.1.1"})",
+                    getBuilder(),
+                    "target",
+                    {makeValue(R"(2)"), makeValue(R"(60)")},
+                    FAILURE()),
+        FilterDepsT(R"({"target": "1.1.1.1", "ref": {"a": 1}})",
+                    getBuilder(),
+                    "target",
+                    {makeValue(R"(1)"), makeValue(R"(60)"), makeRef("ref")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": "1.1.1.1"})",
+                    getBuilder(),
+                    "notTarget",
+                    {makeValue(R"(1)"), makeValue(R"(60)")},
+                    FAILURE()),
+        FilterDepsT(R"({"target": "1.1.1.1"})",
+                    getBuilder(),
+                    "target",
+                    {makeValue(R"(1)"), makeValue(R"(60)"), makeRef("ref")},
+                    FAILURE())),
+    testNameFormatter<FilterOperationWithDepsTest>("Frequency"));
+} // namespace filteroperatestest
+
+using namespace builder::builders::opfilter;
+
+TEST(FrequencyStoreTest, SlidingWindow)
+{
+    std::int64_t now = 1000000;
+    FrequencyStore store(std::chrono::seconds(8), FrequencyStore::DEFAULT_MAX_KEYS, [&now]() { return now; });
+
+    EXPECT_EQ(store.hit("a"), 1);
+    EXPECT_EQ(store.hit("a"), 2);
+    EXPECT_EQ(store.hit("b"), 1);
+
+    now += 3000;
+    EXPECT_EQ(store.hit("a"), 3);
+
+    // The first two events of "a" and the one of "b" are out of the window
+    now += 5000;
+    EXPECT_EQ(store.hit("a"), 2);
+    EXPECT_EQ(store.size(), 1);
+
+    now += 20000;
+    EXPECT_EQ(store.size(), 0);
+    EXPECT_EQ(store.hit("a"), 1);
+}
+
+TEST(FrequencyStoreTest, BoundedKeys)
+{
+    std::int64_t now = 0;
+    FrequencyStore store(std::chrono::seconds(1), 32, [&now]() { return now; });
+
+    auto notCounted = 0;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        if (!store.hit(std::to_string(i)))
+        {
+            ++notCounted;
+        }
+    }
+    EXPECT_LE(store.size(), 32);
+    EXPECT_EQ(notCounted, 1000 - static_cast<int>(store.size()));
+
+    // The expired keys make room for new ones
+    now += 2000;
+    EXPECT_EQ(store.size(), 0);
+    EXPECT_EQ(store.hit("new"), 1);
+}
+
+TEST(FrequencyStoreTest, ConcurrentHits)
+{
+    FrequencyStore store(std::chrono::seconds(60));
+
+    std::vector<std::thread> workers;
+    for (auto t = 0; t < 4; ++t)
+    {
+        workers.emplace_back(
+            [&store]()
+            {
+                for (auto i = 0; i < 10000; ++i)
+                {
+                    store.hit(std::to_string(i % 100));
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    EXPECT_EQ(store.size(), 100);
+    EXPECT_EQ(store.hit("5"), 401);
+}
+
+TEST(FrequencyStoresTest, SharedByTheBuildsOfAnAsset)
+{
+    auto stores = std::make_shared<FrequencyStores>();
+    const auto frequency = getFrequencyBuilder(stores);
+
+    Context context {"decoder/test/0", "", "check", "target: frequency(8, 60)"};
+    Context otherAsset {"decoder/other/0", "", "check", "target: frequency(8, 60)"};
+    auto buildCtx = std::make_shared<MockBuildCtx>();
+    auto otherCtx = std::make_shared<MockBuildCtx>();
+    auto runState = std::make_shared<const RunState>();
+    ON_CALL(*buildCtx, context()).WillByDefault(testing::ReturnRef(context));
+    ON_CALL(*buildCtx, runState()).WillByDefault(testing::Return(runState));
+    ON_CALL(*otherCtx, context()).WillByDefault(testing::ReturnRef(otherAsset));
+    ON_CALL(*otherCtx, runState()).WillByDefault(testing::Return(runState));
+
+    const std::vector<OpArg> args {std::make_shared<Value>(json::Json("8")), std::make_shared<Value>(json::Json("60"))};
+    const Reference target {"target"};
+
+    // Each worker builds its own copy of the policy, the copies of the asset count the events together
+    std::vector<FilterOp> workers;
+    for (auto i = 0; i < 4; ++i)
+    {
+        workers.emplace_back(frequency(target, args, buildCtx));
+    }
+    auto other = frequency(target, args, otherCtx);
+    EXPECT_EQ(stores->size(), 2);
+
+    std::vector<std::thread> threads;
+    std::atomic_int passed {0};
+    for (auto& op : workers)
+    {
+        threads.emplace_back(
+            [&op, &passed]()
+            {
+                auto event = std::make_shared<const json::Json>(R"({"target": "1.1.1.1"})");
+                for (auto i = 0; i < 2; ++i)
+                {
+                    if (op(event).success())
+                    {
+                        ++passed;
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Only the eighth event reaches the threshold, an asset with its own counters has not seen any of them
+    EXPECT_EQ(passed, 1);
+    EXPECT_FALSE(other(std::make_shared<const json::Json>(R"({"target": "1.1.1.1"})")).success());
+
+    // A store is freed with the last build of its asset
+    workers.clear();
+    EXPECT_EQ(stores->size(), 1);
+}
@@ -8,8 +8,9 @@ auto customRefExpected()
 {
     return [](const BuildersMocks& mocks)
     {
-        EXPECT_CALL(*mocks.ctx, validator());
+        EXPECT_CALL(*mocks.ctx, validator()).Times(testing::AtLeast(1));
         EXPECT_CALL(*mocks.validator, hasField(DotPath("ref"))).WillOnce(testing::Return(false));
+        EXPECT_CALL(*mocks.validator, hasField(DotPath("targetField"))).WillRepeatedly(testing::Return(false));
         return None {};
     };
 }
@@ -21,6 +22,7 @@ auto typeRefExpected(schemf::Type type, bool success = true)
         EXPECT_CALL(*mocks.ctx, validator()).Times(testing::AtLeast(1));
         EXPECT_CALL(*mocks.validator, hasField(DotPath("ref"))).WillOnce(testing::Return(true));
         EXPECT_CALL(*mocks.validator, getType(DotPath("ref"))).WillRepeatedly(testing::Return(type));
+        EXPECT_CALL(*mocks.validator, hasField(DotPath("targetField"))).WillRepeatedly(testing::Return(false));
         return None {};
     };
 }
@@ -27,6 +27,25 @@ INSTANTIATE_TEST_SUITE_P(
                     FilterT({makeValue(R"("192.168.255.255")")}, opfilter::opBuilderHelperPublicIP, FAILURE()),
                     FilterT({makeRef("ref")}, opfilter::opBuilderHelperPublicIP, FAILURE())),
     testNameFormatter<FilterBuilderTest>("PublicIP"));
+
+INSTANTIATE_TEST_SUITE_P(
+    BuilderIPCIDRSet,
+    FilterBuilderTest,
+    testing::Values(
+        FilterT({}, opfilter::opBuilderHelperIPCIDRSet, FAILURE()),
+        FilterT({makeValue(R"("10.0.0.0/8")")}, opfilter::opBuilderHelperIPCIDRSet, SUCCESS()),
+        FilterT({makeValue(R"("10.0.0.0/8")"), makeValue(R"("2001:db8::/32")")},
+                opfilter::opBuilderHelperIPCIDRSet,
+                SUCCESS()),
+        FilterT({makeValue(R"(["10.0.0.0/8", "192.168.0.0/255.255.0.0"])")},
+                opfilter::opBuilderHelperIPCIDRSet,
+                SUCCESS()),
+        FilterT({makeValue(R"([])")}, opfilter::opBuilderHelperIPCIDRSet, FAILURE()),
+        FilterT({makeValue(R"("10.0.0.0/33")")}, opfilter::opBuilderHelperIPCIDRSet, FAILURE()),
+        FilterT({makeValue(R"("not an ip")")}, opfilter::opBuilderHelperIPCIDRSet, FAILURE()),
+        FilterT({makeValue(R"(8)")}, opfilter::opBuilderHelperIPCIDRSet, FAILURE()),
+        FilterT({makeRef("ref")}, opfilter::opBuilderHelperIPCIDRSet, FAILURE())),
+    testNameFormatter<FilterBuilderTest>("IPCIDRSet"));
 } // namespace filterbuildtest
 
 namespace filteroperatestest
@@ -52,9 +71,80 @@ INSTANTIATE_TEST_SUITE_P(BuilderIPCIDR,
                                                  opfilter::opBuilderHelperIPCIDR,
                                                  "notTarget",
                                                  {makeValue(R"("192.168.255.0")"), makeValue(R"("255.255.255.0")")},
-                                                 FAILURE())),
+                                                 FAILURE()),
+                                         FilterT(R"({"target": "192.168.255.255"})",
+                                                 opfilter::opBuilderHelperIPCIDR,
+                                                 "target",
+                                                 {makeValue(R"("192.168.255.0")"), makeValue(R"("24")")},
+                                                 SUCCESS(
+                                                     [](const BuildersMocks& mocks)
+                                                     {
+                                                         EXPECT_CALL(*mocks.validator, hasField(DotPath("target")))
+                                                             .WillOnce(testing::Return(true));
+                                                         EXPECT_CALL(*mocks.validator, getType(DotPath("target")))
+                                                             .WillOnce(testing::Return(schemf::Type::IP));
+                                                         return None {};
+                                                     }))),
                          testNameFormatter<FilterOperationTest>("IPCIDR"));
 
+INSTANTIATE_TEST_SUITE_P(
+    BuilderIPCIDRSet,
+    FilterOperationTest,
+    testing::Values(
+        FilterT(R"({"target": "10.1.2.3"})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"("10.0.0.0/8")"), makeValue(R"("192.168.0.0/16")")},
+                SUCCESS()),
+        FilterT(R"({"target": "192.168.255.1"})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"(["10.0.0.0/8", "192.168.0.0/16"])")},
+                SUCCESS()),
+        FilterT(R"({"target": "172.16.0.1"})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"("10.0.0.0/8")"), makeValue(R"("192.168.0.0/16")")},
+                FAILURE()),
+        FilterT(R"({"target": "2001:db8::1"})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"("10.0.0.0/8")"), makeValue(R"("2001:db8::/32")")},
+                SUCCESS()),
+        FilterT(R"({"target": "2001:db9::1"})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"("2001:db8::/32")")},
+                FAILURE()),
+        FilterT(R"({"target": "not an ip"})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"("10.0.0.0/8")")},
+                FAILURE()),
+        FilterT(R"({"target": 10})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"("10.0.0.0/8")")},
+                FAILURE()),
+        FilterT(R"({"notTarget": "10.1.2.3"})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"("10.0.0.0/8")")},
+                FAILURE()),
+        FilterT(R"({"target": "10.1.2.3"})",
+                opfilter::opBuilderHelperIPCIDRSet,
+                "target",
+                {makeValue(R"("10.0.0.0/8")")},
+                SUCCESS(
+                    [](const BuildersMocks& mocks)
+                    {
+                        EXPECT_CALL(*mocks.validator, hasField(DotPath("target"))).WillOnce(testing::Return(true));
+                        EXPECT_CALL(*mocks.validator, getType(DotPath("target")))
+                            .WillOnce(testing::Return(schemf::Type::IP));
+                        return None {};
+                    }))),
+    testNameFormatter<FilterOperationTest>("IPCIDRSet"));
+
 INSTANTIATE_TEST_SUITE_P(
     BuilderPublicIP,
     FilterOperationTest,
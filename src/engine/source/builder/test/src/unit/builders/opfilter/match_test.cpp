@@ -112,6 +112,13 @@ INSTANTIATE_TEST_SUITE_P(
                 "target",
                 {makeValue(R"(["val0", "val1"])")},
                 FAILURE()),
+        FilterT(R"({"target": 1})", opfilter::opBuilderHelperMatchValue, "target", {makeValue(R"([1.0])")}, SUCCESS()),
+        FilterT(R"({"target": 1})", opfilter::opBuilderHelperMatchValue, "target", {makeValue(R"(["1"])")}, FAILURE()),
+        FilterT(R"({"target": {"a": 1}})",
+                opfilter::opBuilderHelperMatchValue,
+                "target",
+                {makeValue(R"(["a", {"a": 2}, {"a": 1}])")},
+                SUCCESS()),
         FilterT(R"({"target": "value", "ref": ["value"]})",
                 opfilter::opBuilderHelperMatchValue,
                 "target",
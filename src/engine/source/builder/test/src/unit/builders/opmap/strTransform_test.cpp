@@ -353,11 +353,26 @@ INSTANTIATE_TEST_SUITE_P(
              FAILURE(customRefExpected())),
         MapT(R"({"ref": null})", opBuilderHelperStringFromHexa, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"ref": "FF"})", opBuilderHelperStringFromHexa, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": "48656c6C6f"})",
+             opBuilderHelperStringFromHexa,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json(R"("Hello")")))),
+        MapT(R"({"ref": "486"})", opBuilderHelperStringFromHexa, {makeRef("ref")}, FAILURE(customRefExpected())),
         /*** Hex to Number*/
         MapT(R"({"ref": "48656C"})",
              opBuilderHelperHexToNumber,
              {makeRef("ref")},
              SUCCESS(customRefExpected(json::Json("4744556")))),
+        MapT(R"({"ref": "0x7fffffff"})",
+             opBuilderHelperHexToNumber,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json("2147483647")))),
+        MapT(R"({"ref": "-1a"})",
+             opBuilderHelperHexToNumber,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json("-26")))),
+        MapT(R"({"ref": "80000000"})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": ""})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"ref": "48656P"})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"notRef": "48656C"})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"ref": 1})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
@@ -1749,6 +1749,65 @@ TEST_F(checkTypeDecoderSCA, FindEventcheckOkNotFoundWithoutComplianceNorRules)
     ASSERT_FALSE(event->exists("/sca/check/previous_result"));
 }
 
+// The second event of a stored check is not looked up, and it is not saved if nothing changed
+TEST_F(checkTypeDecoderSCA, StoredCheckSkipsQueries)
+{
+    const auto tuple {std::make_tuple(targetField, commonArguments, ctx)};
+
+    EXPECT_CALL(*wdbManager, connection());
+    EXPECT_CALL(*sockFactory, getHandler(testing::_, testing::_));
+
+    const auto op {std::apply(getBuilderSCAdecoder(wdbManager, sockFactory), tuple)};
+
+    const auto event {std::make_shared<json::Json>(checkTypeEvtWithMandatoryFields)};
+    const auto original = event->str("/event/original").value_or("error");
+
+    EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
+        .WillOnce(testing::Return(okQueryRes("not found")));
+    EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca insert " + original), testing::_))
+        .WillOnce(testing::Return(okQueryRes()));
+    ASSERT_TRUE(op(event));
+
+    // Same check, result and scan: no queries
+    const auto repeated {std::make_shared<json::Json>(checkTypeEvtWithMandatoryFields)};
+    ASSERT_TRUE(op(repeated));
+    ASSERT_FALSE(repeated->exists("/sca/type"));
+
+    // New result: updated without looking it up
+    const auto changed {std::make_shared<json::Json>(checkTypeEvtWithMandatoryFields)};
+    changed->setString("Other Result", "/event/original/check/result");
+    EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca update 911|Other Result||404"), testing::_))
+        .WillOnce(testing::Return(okQueryRes()));
+    ASSERT_TRUE(op(changed));
+    ASSERT_STREQ(changed->getString("/sca/check/previous_result").value().c_str(), "Some Result");
+}
+
+TEST(scaCheckCache, ErasePolicy)
+{
+    sca::CheckCache cache {10};
+    cache.set("007", "policy", 1, {"passed", sca::CheckCache::hash("passed", "", 1)});
+    cache.set("007", "other", 2, {"failed", sca::CheckCache::hash("failed", "", 1)});
+
+    cache.erasePolicy("007", "policy");
+
+    ASSERT_FALSE(cache.get("007", "policy", 1));
+    ASSERT_TRUE(cache.get("007", "other", 2));
+    ASSERT_STREQ(cache.get("007", "other", 2)->result.c_str(), "failed");
+}
+
+TEST(scaCheckCache, Capacity)
+{
+    sca::CheckCache cache {2};
+    cache.set("007", "policy", 1, {"passed", 0});
+    cache.set("007", "policy", 2, {"passed", 0});
+    cache.set("007", "policy", 2, {"failed", 0});
+    ASSERT_TRUE(cache.get("007", "policy", 1));
+
+    cache.set("007", "policy", 3, {"passed", 0});
+    ASSERT_FALSE(cache.get("007", "policy", 1));
+    ASSERT_TRUE(cache.get("007", "policy", 3));
+}
+
 TEST_F(checkTypeDecoderSCA, SaveACompliance)
 {
     const auto tuple {
@@ -109,6 +109,11 @@ INSTANTIATE_TEST_SUITE_P(Builders,
                                         "target",
                                         {makeValue(R"("begin")"), makeValue(R"("/")")},
                                         SUCCESS(makeEvent(R"({"target": "--value--"})"))),
+                             TransformT(R"({"target": "----"})",
+                                        opBuilderHelperStringTrim,
+                                        "target",
+                                        {makeValue(R"("both")"), makeValue(R"("-")")},
+                                        SUCCESS(makeEvent(R"({"target": ""})"))),
                              /*** Replace ***/
                              TransformT(R"({"target": "--value--"})",
                                         opBuilderHelperStringReplace,
@@ -130,6 +135,11 @@ INSTANTIATE_TEST_SUITE_P(Builders,
                                         "target",
                                         {makeValue(R"("-")"), makeValue(R"("++")")},
                                         SUCCESS(makeEvent(R"({"target": "++++value++++"})"))),
+                             TransformT(R"({"target": "aaaaa"})",
+                                        opBuilderHelperStringReplace,
+                                        "target",
+                                        {makeValue(R"("aa")"), makeValue(R"("a")")},
+                                        SUCCESS(makeEvent(R"({"target": "aaa"})"))),
                              TransformT(R"({"target": "--value--"})",
                                         opBuilderHelperStringReplace,
                                         "target",
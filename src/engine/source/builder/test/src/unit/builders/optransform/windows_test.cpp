@@ -224,7 +224,39 @@ INSTANTIATE_TEST_SUITE_P(
                                                }),
                        "target",
                        {makeValue(R"("dbname")"), makeRef("ref")},
-                       FAILURE(customRefExpected("ref")))
+                       FAILURE(customRefExpected("ref"))),
+        TransformDepsT(R"({"ref": "%{S-1-5-18} %{S-1-5-21-1004336348-1177238915-682003330-512} %{S-1-2-3}"})",
+                       getBuilderExpectHandler("dbname",
+                                               [](const std::shared_ptr<MockKVDBHandler>& kvdbHandler)
+                                               {
+                                                   expectKvdbGet(detail::ACC_SID_DESC_KEY,
+                                                                 R"({"S-1-5-18": "Local System"})")(kvdbHandler);
+                                                   expectKvdbGet(detail::DOM_SPC_SID_KEY,
+                                                                 R"({"512": "Domain Admins"})")(kvdbHandler);
+                                               }),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       SUCCESS(customRefExpected(
+                           "ref",
+                           makeEvent(
+                               R"({"ref": "%{S-1-5-18} %{S-1-5-21-1004336348-1177238915-682003330-512} %{S-1-2-3}",
+                                   "target": ["Local System", "Domain Admins", "S-1-2-3"]})")))),
+        TransformDepsT(R"({"ref": "%{S-1-5-21-1004336348-1177238915-682003330-100512}"})",
+                       getBuilderExpectHandler("dbname",
+                                               [](const std::shared_ptr<MockKVDBHandler>& kvdbHandler)
+                                               {
+                                                   expectKvdbGet(detail::ACC_SID_DESC_KEY,
+                                                                 R"({"key": "value"})")(kvdbHandler);
+                                                   expectKvdbGet(detail::DOM_SPC_SID_KEY,
+                                                                 R"({"512": "Domain Admins", "00512": "Last digits"})")(
+                                                       kvdbHandler);
+                                               }),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       SUCCESS(customRefExpected(
+                           "ref",
+                           makeEvent(R"({"ref": "%{S-1-5-21-1004336348-1177238915-682003330-100512}",
+                                         "target": ["Last digits"]})"))))
         // TODO -> {"ref": "desc"} outputs in "ref": ["s"]
         ),
     testNameFormatter<TransformOperationWithDepsTest>("Win"));
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "builders/regexSet.hpp"
+
+using namespace builder::builders;
+
+TEST(RegexSetTest, InvalidPattern)
+{
+    RegexSet set;
+    ASSERT_THROW(set.add("InvalidRegex["), std::runtime_error);
+    ASSERT_EQ(set.size(), 0);
+}
+
+TEST(RegexSetTest, SinglePattern)
+{
+    RegexSet set;
+    auto index = set.add("^ab+c$");
+
+    ASSERT_TRUE(set.matches("abbbc", index));
+    ASSERT_FALSE(set.matches("ac", index));
+}
+
+TEST(RegexSetTest, ManyPatterns)
+{
+    RegexSet set;
+    auto starts = set.add("^error");
+    auto contains = set.add("disk");
+    auto digits = set.add("[0-9]+$");
+
+    ASSERT_TRUE(set.matches("error: disk 42", starts));
+    ASSERT_TRUE(set.matches("error: disk 42", contains));
+    ASSERT_TRUE(set.matches("error: disk 42", digits));
+
+    ASSERT_FALSE(set.matches("warning: disk full", starts));
+    ASSERT_TRUE(set.matches("warning: disk full", contains));
+    ASSERT_FALSE(set.matches("warning: disk full", digits));
+
+    // The memoized result of the previous value is not reused
+    ASSERT_TRUE(set.matches("error", starts));
+    ASSERT_FALSE(set.matches("error", contains));
+}
+
+TEST(RegexSetTest, AddAfterCompile)
+{
+    RegexSet set;
+    auto index = set.add("a");
+    set.add("b");
+    ASSERT_TRUE(set.matches("a", index));
+
+    ASSERT_TRUE(set.isCompiled());
+    ASSERT_THROW(set.add("c"), std::runtime_error);
+}
+
+TEST(RegexSetTest, SetsByField)
+{
+    RegexSets sets;
+    auto [setA, indexA] = sets.add("/field", "a");
+    auto [setB, indexB] = sets.add("/field", "b");
+    auto [setOther, indexOther] = sets.add("/other", "a");
+
+    ASSERT_EQ(setA, setB);
+    ASSERT_NE(setA, setOther);
+    ASSERT_EQ(indexA, 0);
+    ASSERT_EQ(indexB, 1);
+    ASSERT_EQ(indexOther, 0);
+
+    // A compiled set is not extended
+    ASSERT_TRUE(setA->matches("a", indexA));
+    auto [setC, indexC] = sets.add("/field", "c");
+    ASSERT_NE(setA, setC);
+    ASSERT_EQ(indexC, 0);
+}
+
+TEST(RegexSetTest, MatchFromManyThreads)
+{
+    RegexSet set;
+    auto even = set.add("[02468]$");
+    auto odd = set.add("[13579]$");
+
+    std::vector<std::thread> threads;
+    std::atomic<bool> failed {false};
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                for (auto i = 0; i < 1000; ++i)
+                {
+                    auto value = std::to_string(i + t);
+                    auto isEven = (i + t) % 2 == 0;
+                    if (set.matches(value, even) != isEven || set.matches(value, odd) == isEven)
+                    {
+                        failed = true;
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(failed);
+}
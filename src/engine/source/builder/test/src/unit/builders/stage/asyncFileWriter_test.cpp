@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "builders/buildCtx.hpp"
+#include "builders/stage/asyncFileWriter.hpp"
+#include "builders/stage/fileOutput.hpp"
+
+using namespace builder::builders;
+using builder::builders::detail::AsyncFileWriter;
+
+namespace asyncfilewritertest
+{
+constexpr auto DIR_PATH = "/tmp/asyncFileWriterTest";
+constexpr auto FILE_PATH = "/tmp/asyncFileWriterTest/file";
+
+class AsyncFileWriterTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::filesystem::remove_all(DIR_PATH);
+        std::filesystem::create_directories(DIR_PATH);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(DIR_PATH); }
+
+    std::string readFile(const std::string& path) const
+    {
+        std::ifstream ifs(path);
+        std::stringstream buffer;
+        buffer << ifs.rdbuf();
+        return buffer.str();
+    }
+
+    std::size_t countFiles() const
+    {
+        std::size_t count = 0;
+        for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator(DIR_PATH))
+        {
+            ++count;
+        }
+        return count;
+    }
+};
+
+TEST_F(AsyncFileWriterTest, Create)
+{
+    ASSERT_NO_THROW(AsyncFileWriter(FILE_PATH, FileOutputOptions {}));
+    ASSERT_TRUE(std::filesystem::exists(FILE_PATH));
+}
+
+TEST_F(AsyncFileWriterTest, UnknownPath)
+{
+    ASSERT_THROW(AsyncFileWriter("/tmp45/file", FileOutputOptions {}), std::invalid_argument);
+}
+
+TEST_F(AsyncFileWriterTest, ZeroBufferSize)
+{
+    FileOutputOptions options;
+    options.bufferSize = 0;
+    ASSERT_THROW(AsyncFileWriter(FILE_PATH, options), std::invalid_argument);
+}
+
+TEST_F(AsyncFileWriterTest, WriteAndDrain)
+{
+    AsyncFileWriter writer(FILE_PATH, FileOutputOptions {});
+    writer.write("line1");
+    writer.write("line2");
+    writer.drain();
+
+    ASSERT_EQ(readFile(FILE_PATH), "line1\nline2\n");
+}
+
+TEST_F(AsyncFileWriterTest, WritesPendingLinesOnDestruction)
+{
+    {
+        AsyncFileWriter writer(FILE_PATH, FileOutputOptions {});
+        for (auto i = 0; i < 1000; ++i)
+        {
+            writer.write(std::to_string(i));
+        }
+    }
+
+    std::stringstream expected;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        expected << i << "\n";
+    }
+    ASSERT_EQ(readFile(FILE_PATH), expected.str());
+}
+
+TEST_F(AsyncFileWriterTest, Backpressure)
+{
+    FileOutputOptions options;
+    options.bufferSize = 4;
+    AsyncFileWriter writer(FILE_PATH, options);
+
+    std::vector<std::thread> producers;
+    for (auto t = 0; t < 4; ++t)
+    {
+        producers.emplace_back(
+            [&writer]()
+            {
+                for (auto i = 0; i < 250; ++i)
+                {
+                    writer.write("line");
+                }
+            });
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    writer.drain();
+
+    auto content = readFile(FILE_PATH);
+    ASSERT_EQ(content.size(), 1000 * std::string("line\n").size());
+}
+
+TEST_F(AsyncFileWriterTest, RotateBySize)
+{
+    FileOutputOptions options;
+    options.maxFileSize = 10;
+    AsyncFileWriter writer(FILE_PATH, options);
+
+    writer.write("0123456789");
+    writer.drain();
+    writer.write("next");
+    writer.drain();
+
+    ASSERT_EQ(readFile(FILE_PATH), "next\n");
+    ASSERT_EQ(countFiles(), 2);
+}
+
+TEST_F(AsyncFileWriterTest, BuilderSharesWriterByPath)
+{
+    FileOutputOptions options;
+    options.async = true;
+    auto builder = getFileOutputBuilder(options);
+
+    auto buildCtx = std::make_shared<builder::builders::BuildCtx>();
+    auto definition = json::Json(fmt::format(R"({{"path": "{}"}})", FILE_PATH).c_str());
+    auto first = builder(definition, buildCtx);
+    auto second = builder(definition, buildCtx);
+
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    auto firstOp = first->getPtr<base::Term<base::EngineOp>>()->getFn();
+    auto secondOp = second->getPtr<base::Term<base::EngineOp>>()->getFn();
+    ASSERT_TRUE(firstOp(event).success());
+    ASSERT_TRUE(secondOp(event).success());
+
+    // Releasing the expressions destroys the shared writer, which writes what is left
+    firstOp = nullptr;
+    secondOp = nullptr;
+    first.reset();
+    second.reset();
+
+    ASSERT_EQ(readFile(FILE_PATH), "{\"key\":\"value\"}\n{\"key\":\"value\"}\n");
+}
+} // namespace asyncfilewritertest
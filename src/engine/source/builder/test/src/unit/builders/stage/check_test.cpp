@@ -159,3 +159,44 @@ INSTANTIATE_TEST_SUITE_P(
                    }))),
     testNameFormatter<StageBuilderTest>("Check"));
 } // namespace stagebuildtest
+
+namespace stagebuildtest
+{
+using CheckOrderTest = BaseBuilderTest;
+
+TEST_F(CheckOrderTest, StatefulHelperKeepsItsPosition)
+{
+    std::vector<std::string> calls;
+    auto recording = [&calls](const std::string& name, bool result) -> OpBuilderEntry
+    {
+        ValidationInfo info {schemf::ValidationToken {}};
+        FilterBuilder builder = [&calls, name, result](const Reference&,
+                                                       const std::vector<OpArg>&,
+                                                       const std::shared_ptr<const IBuildCtx>&) -> FilterOp
+        {
+            return [&calls, name, result](base::ConstEvent) -> FilterResult
+            {
+                calls.push_back(name);
+                return result ? base::result::makeSuccess(true) : base::result::makeFailure(false);
+            };
+        };
+
+        return std::make_tuple(info, builder);
+    };
+
+    expectAnyFilterHelper<OpBuilderEntry>(Helper<OpBuilderEntry> {"regex_match", recording("regex_match", false)},
+                                          Helper<OpBuilderEntry> {"frequency", recording("frequency", true)},
+                                          Helper<OpBuilderEntry> {"exists", recording("exists", true)})(*mocks);
+    EXPECT_CALL(*mocks->ctx, definitions()).WillOnce(testing::ReturnRef(*mocks->definitions));
+    EXPECT_CALL(*mocks->definitions, replace(testing::_))
+        .WillOnce(testing::Invoke([](auto expr) { return std::string(expr); }));
+
+    // The counter is cheaper than the regex, but it only counts the events the regex accepts, and the existence check
+    // is not moved in front of it either
+    auto check = checkBuilder(json::Json(R"("regex_match($arg) AND frequency($arg) AND exists($arg)")"), mocks->ctx);
+    auto result = check->getPtr<base::Term<base::EngineOp>>()->getFn()(makeEvent(R"({"arg": "value"})"));
+
+    EXPECT_FALSE(result.success());
+    EXPECT_EQ(calls, std::vector<std::string> {"regex_match"});
+}
+} // namespace stagebuildtest
@@ -16,7 +16,19 @@ INSTANTIATE_TEST_SUITE_P(Builders,
                                          StageT(R"({"key": "val", "key2": "val2"})", fileOutputBuilder, FAILURE()),
                                          StageT(R"({"path": 1})", fileOutputBuilder, FAILURE()),
                                          StageT(R"({"path": "///"})", fileOutputBuilder, FAILURE()),
+                                         StageT(R"({"path": "/tmp/path", "fields": []})", fileOutputBuilder, FAILURE()),
+                                         StageT(R"({"path": "/tmp/path", "fields": [1]})",
+                                                fileOutputBuilder,
+                                                FAILURE()),
+                                         StageT(R"({"path": "/tmp/path", "fields": ["a"], "exclude": ["b"]})",
+                                                fileOutputBuilder,
+                                                FAILURE()),
+                                         StageT(R"({"fields": ["a"], "exclude": ["b"]})", fileOutputBuilder, FAILURE()),
                                          StageT(R"({"path": "/tmp/path"})",
+                                                fileOutputBuilder,
+                                                SUCCESS(base::Term<base::EngineOp>::create("write.output(/tmp/path)",
+                                                                                           {}))),
+                                         StageT(R"({"path": "/tmp/path", "exclude": ["event.original"]})",
                                                 fileOutputBuilder,
                                                 SUCCESS(base::Term<base::EngineOp>::create("write.output(/tmp/path)",
                                                                                            {})))),
@@ -110,4 +122,21 @@ TEST_F(FileOutputTest, Write)
 
     ASSERT_EQ(buffer.str(), compact_message);
 }
+
+TEST_F(FileOutputTest, WriteProjection)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+    auto projection = std::make_shared<const json::Projection>(
+        json::Projection::Mode::Include, std::vector<std::string> {"/wazuh/agent/id", "/wazuh/module"});
+    auto output = FileOutput(FILE_PATH, projection);
+    ASSERT_NO_THROW(output.write(msg));
+
+    std::ifstream ifs(FILE_PATH);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+
+    ASSERT_EQ(buffer.str(),
+              R"({"wazuh":{"agent":{"id":"001"},"module":{"name":"logcollector","source":"apache-access"}}})"
+              "\n");
+}
 } // namespace fileoutputtest
@@ -0,0 +1,66 @@
+#include "builders/baseBuilders_test.hpp"
+#include "builders/buildCtx.hpp"
+#include "builders/stage/indexerOutput.hpp"
+
+#include <indexer/mockIndexerConnector.hpp>
+
+using namespace builder::builders;
+
+namespace
+{
+auto getBuilder()
+{
+    return getIndexerOutputBuilder(std::make_shared<indexer::mocks::MockIndexerConnector>());
+}
+} // namespace
+
+namespace stagebuildtest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    StageBuilderTest,
+    testing::Values(StageT(R"([])", getBuilder(), FAILURE()),
+                    StageT(R"("notObject")", getBuilder(), FAILURE()),
+                    StageT(R"(1)", getBuilder(), FAILURE()),
+                    StageT(R"(null)", getBuilder(), FAILURE()),
+                    StageT(R"({})", getBuilder(), FAILURE()),
+                    StageT(R"({"index": "alerts", "other": "val"})", getBuilder(), FAILURE()),
+                    StageT(R"({"other": "alerts"})", getBuilder(), FAILURE()),
+                    StageT(R"({"index": 1})", getBuilder(), FAILURE()),
+                    StageT(R"({"index": ""})", getBuilder(), FAILURE()),
+                    StageT(R"({"index": "Alerts"})", getBuilder(), FAILURE()),
+                    StageT(R"({"index": "wazuh alerts"})", getBuilder(), FAILURE()),
+                    StageT(R"({"index": "_alerts"})", getBuilder(), FAILURE()),
+                    StageT(R"({"index": "wazuh-alerts"})", getIndexerOutputBuilder(nullptr), FAILURE()),
+                    StageT(R"({"index": "wazuh-alerts"})",
+                           getBuilder(),
+                           SUCCESS(base::Term<base::EngineOp>::create("write.indexer(wazuh-alerts)", {})))),
+    testNameFormatter<StageBuilderTest>("IndexerOutput"));
+} // namespace stagebuildtest
+
+namespace indexeroutputtest
+{
+TEST(IndexerOutputTest, SendsEvent)
+{
+    auto connector = std::make_shared<indexer::mocks::MockIndexerConnector>();
+    auto expression = getIndexerOutputBuilder(connector)(json::Json(R"({"index": "wazuh-alerts"})"),
+                                                         std::make_shared<BuildCtx>());
+    auto op = expression->getPtr<base::Term<base::EngineOp>>()->getFn();
+
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    EXPECT_CALL(*connector, index(std::string_view("wazuh-alerts"), std::string_view(R"({"key":"value"})")));
+    ASSERT_TRUE(op(event).success());
+}
+
+TEST(IndexerOutputTest, ConnectorFails)
+{
+    auto connector = std::make_shared<indexer::mocks::MockIndexerConnector>();
+    auto expression = getIndexerOutputBuilder(connector)(json::Json(R"({"index": "wazuh-alerts"})"),
+                                                         std::make_shared<BuildCtx>());
+    auto op = expression->getPtr<base::Term<base::EngineOp>>()->getFn();
+
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    EXPECT_CALL(*connector, index(testing::_, testing::_)).WillOnce(testing::Throw(std::runtime_error("error")));
+    ASSERT_FALSE(op(event).success());
+}
+} // namespace indexeroutputtest
@@ -22,6 +22,8 @@ public:
     MOCK_METHOD((const Context&), context, (), (const));
     MOCK_METHOD((Context&), context, (), ());
     MOCK_METHOD((std::shared_ptr<const RunState>), runState, (), (const));
+    MOCK_METHOD((std::shared_ptr<RegexSets>), regexSets, (), (const));
+    MOCK_METHOD((std::shared_ptr<ValidationStats>), validationStats, (), (const));
 };
 
 } // namespace builder::builders::mocks
@@ -245,6 +245,25 @@ TEST_P(BuildAssets, PolicyData)
     }
 }
 
+TEST_P(BuildAssets, PolicyDataParallel)
+{
+    auto [policyData, expected] = GetParam();
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto store = std::make_shared<MockStoreRead>();
+    if (expected)
+    {
+        factory::BuiltAssets got;
+        auto expectedData = expected.succCase()(store, assetBuilder);
+        ASSERT_NO_THROW(got = factory::buildAssets(policyData, store, assetBuilder, nullptr, 4));
+        ASSERT_EQ(got, expectedData);
+    }
+    else
+    {
+        expected.failCase()(store, assetBuilder);
+        ASSERT_THROW(factory::buildAssets(policyData, store, assetBuilder, nullptr, 4), std::runtime_error);
+    }
+}
+
 using D = factory::PolicyData::Params;
 using A = std::unordered_map<store::NamespaceId, std::unordered_set<base::Name>>;
 
@@ -802,3 +821,263 @@ INSTANTIATE_TEST_SUITE_P(
             ));
 
 } // namespace buildexpressiontest
+
+namespace builddispatchtest
+{
+using buildgraphtest::assetExpr;
+
+Asset discriminatedAsset(const std::string& name, std::optional<int> queue)
+{
+    auto asset = Asset {base::Name {name}, assetExpr(name), {base::Name {"decoder/Input"}}};
+    if (queue)
+    {
+        json::Json value;
+        value.setInt(queue.value());
+        asset.setDiscriminator(Asset::Discriminator {.field = "/wazuh/queue", .value = std::move(value)});
+    }
+
+    return asset;
+}
+
+Graph<base::Name, Asset> dispatchGraph(const std::vector<std::pair<std::string, std::optional<int>>>& children)
+{
+    Graph<base::Name, Asset> graph {base::Name {"decoder/Input"}, Asset {}};
+    for (const auto& [name, queue] : children)
+    {
+        graph.addNode(base::Name {name}, discriminatedAsset(name, queue));
+        graph.addEdge(base::Name {"decoder/Input"}, base::Name {name});
+    }
+
+    return graph;
+}
+
+TEST(BuildDispatch, GroupsByValueKeepingOrder)
+{
+    auto graph =
+        dispatchGraph({{"decoder/a", 1}, {"decoder/b", 2}, {"decoder/c", 1}, {"decoder/d", std::nullopt}});
+    const auto& children = graph.children(graph.rootId());
+    std::vector<base::Expression> operands;
+    for (const auto& child : children)
+    {
+        operands.emplace_back(graph.node(child).expression());
+    }
+
+    std::vector<base::Expression> got;
+    ASSERT_NO_THROW(got = factory::buildDispatch(graph, children, std::move(operands)));
+
+    ASSERT_EQ(got.size(), 3);
+    ASSERT_TRUE(got[0]->isAnd());
+    const auto& bucket1 = got[0]->getPtr<base::Operation>()->getOperands();
+    ASSERT_EQ(bucket1.size(), 2);
+    ASSERT_TRUE(bucket1[0]->isTerm());
+    ASSERT_TRUE(bucket1[1]->isOr());
+    const auto& bucket1Assets = bucket1[1]->getPtr<base::Operation>()->getOperands();
+    ASSERT_EQ(bucket1Assets.size(), 2);
+    ASSERT_EQ(bucket1Assets[0]->getName(), "decoder/a");
+    ASSERT_EQ(bucket1Assets[1]->getName(), "decoder/c");
+
+    ASSERT_TRUE(got[1]->isAnd());
+    const auto& bucket2Assets = got[1]->getPtr<base::Operation>()->getOperands()[1]->getPtr<base::Operation>()->getOperands();
+    ASSERT_EQ(bucket2Assets.size(), 1);
+    ASSERT_EQ(bucket2Assets[0]->getName(), "decoder/b");
+
+    ASSERT_EQ(got[2]->getName(), "decoder/d");
+}
+
+TEST(BuildDispatch, GuardChecksTheField)
+{
+    auto graph = dispatchGraph({{"decoder/a", 1}, {"decoder/b", 2}, {"decoder/c", 1}});
+    const auto& children = graph.children(graph.rootId());
+    std::vector<base::Expression> operands;
+    for (const auto& child : children)
+    {
+        operands.emplace_back(graph.node(child).expression());
+    }
+
+    auto got = factory::buildDispatch(graph, children, std::move(operands));
+    auto guard = got[0]->getPtr<base::Operation>()->getOperands()[0]->getPtr<base::Term<base::EngineOp>>();
+
+    auto event = std::make_shared<json::Json>(R"({"wazuh":{"queue":1}})");
+    ASSERT_TRUE(guard->getFn()(event).success());
+    event->setInt(2, "/wazuh/queue");
+    ASSERT_FALSE(guard->getFn()(event).success());
+    event->erase("/wazuh/queue");
+    ASSERT_FALSE(guard->getFn()(event).success());
+}
+
+TEST(BuildDispatch, ShortRunsAreKept)
+{
+    auto graph = dispatchGraph({{"decoder/a", 1}, {"decoder/b", 2}, {"decoder/c", std::nullopt}});
+    const auto& children = graph.children(graph.rootId());
+    std::vector<base::Expression> operands;
+    for (const auto& child : children)
+    {
+        operands.emplace_back(graph.node(child).expression());
+    }
+
+    auto got = factory::buildDispatch(graph, children, std::move(operands));
+
+    ASSERT_EQ(got.size(), 3);
+    ASSERT_EQ(got[0]->getName(), "decoder/a");
+    ASSERT_EQ(got[1]->getName(), "decoder/b");
+    ASSERT_EQ(got[2]->getName(), "decoder/c");
+}
+
+} // namespace builddispatchtest
+
+namespace buildcachetest
+{
+using buildgraphtest::assetExpr;
+using AT = factory::PolicyData::AssetType;
+
+factory::PolicyData decoderData()
+{
+    return factory::PolicyData({.name = "policy/test/0",
+                                .hash = "hash",
+                                .assets = {{AT::DECODER, {{"ns", {{"decoder/a"}, {"decoder/b"}}}}}}});
+}
+
+store::Doc assetDoc(const std::string& name, const std::string& field)
+{
+    return store::Doc {fmt::format(R"({{"name": "{}", "normalize": [{{"map": [{{"{}": "value"}}]}}]}})", name, field)
+                           .c_str()};
+}
+
+Asset hashedAsset(const std::string& name, std::size_t hash, std::vector<base::Name> parents = {})
+{
+    auto asset = Asset {base::Name {name}, assetExpr(name), std::move(parents)};
+    asset.setHash(hash);
+    return asset;
+}
+
+TEST(BuildCache, UnchangedAssetsAreNotBuilt)
+{
+    auto store = std::make_shared<MockStoreRead>();
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto cache = std::make_shared<BuildCache>();
+
+    EXPECT_CALL(*store, readDoc(base::Name("decoder/a")))
+        .WillRepeatedly(testing::Return(storeReadDocResp(assetDoc("decoder/a", "a"))));
+    EXPECT_CALL(*store, readDoc(base::Name("decoder/b")))
+        .WillOnce(testing::Return(storeReadDocResp(assetDoc("decoder/b", "b"))))
+        .WillOnce(testing::Return(storeReadDocResp(assetDoc("decoder/b", "b"))))
+        .WillOnce(testing::Return(storeReadDocResp(assetDoc("decoder/b", "changed"))));
+    EXPECT_CALL(*assetBuilder, CallableOp(assetDoc("decoder/a", "a")))
+        .WillOnce(testing::Return(Asset {"decoder/a", assetExpr("decoder/a"), {}}));
+    EXPECT_CALL(*assetBuilder, CallableOp(assetDoc("decoder/b", "b")))
+        .WillOnce(testing::Return(Asset {"decoder/b", assetExpr("decoder/b"), {}}));
+    EXPECT_CALL(*assetBuilder, CallableOp(assetDoc("decoder/b", "changed")))
+        .WillOnce(testing::Return(Asset {"decoder/b", assetExpr("decoder/b"), {}}));
+
+    auto first = factory::buildAssets(decoderData(), store, assetBuilder, cache);
+    auto second = factory::buildAssets(decoderData(), store, assetBuilder, cache);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(first.at(AT::DECODER).at("decoder/a").expression(), second.at(AT::DECODER).at("decoder/a").expression());
+    ASSERT_EQ(first.at(AT::DECODER).at("decoder/b").expression(), second.at(AT::DECODER).at("decoder/b").expression());
+
+    // Only the changed document is built again
+    auto third = factory::buildAssets(decoderData(), store, assetBuilder, cache);
+    ASSERT_EQ(first.at(AT::DECODER).at("decoder/a").expression(), third.at(AT::DECODER).at("decoder/a").expression());
+    ASSERT_NE(first.at(AT::DECODER).at("decoder/b").expression(), third.at(AT::DECODER).at("decoder/b").expression());
+}
+
+TEST(BuildCache, DefaultParentsAreNotCached)
+{
+    auto store = std::make_shared<MockStoreRead>();
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto cache = std::make_shared<BuildCache>();
+
+    EXPECT_CALL(*store, readDoc(base::Name("decoder/a")))
+        .WillRepeatedly(testing::Return(storeReadDocResp(assetDoc("decoder/a", "a"))));
+    EXPECT_CALL(*assetBuilder, CallableOp(testing::_))
+        .WillOnce(testing::Return(Asset {"decoder/a", assetExpr("decoder/a"), {}}));
+
+    auto withParent = factory::PolicyData({.name = "policy/test/0",
+                                           .hash = "hash",
+                                           .defaultParents = {{"ns", "decoder/parent"}},
+                                           .assets = {{AT::DECODER, {{"ns", {{"decoder/a"}}}}}}});
+    auto got = factory::buildAssets(withParent, store, assetBuilder, cache);
+    ASSERT_EQ(got.at(AT::DECODER).at("decoder/a").parents(), std::vector<base::Name> {"decoder/parent"});
+
+    auto withoutParent = factory::PolicyData(
+        {.name = "policy/test/0", .hash = "hash", .assets = {{AT::DECODER, {{"ns", {{"decoder/a"}}}}}}});
+    got = factory::buildAssets(withoutParent, store, assetBuilder, cache);
+    ASSERT_TRUE(got.at(AT::DECODER).at("decoder/a").parents().empty());
+}
+
+TEST(BuildCache, SubgraphHash)
+{
+    auto makeGraph = [](std::size_t hashB, const std::vector<std::string>& order)
+    {
+        Graph<base::Name, Asset> graph {base::Name {"decoder/Input"}, Asset {}};
+        for (const auto& name : order)
+        {
+            graph.addNode(base::Name {name}, hashedAsset(name, name == "decoder/b" ? hashB : 1));
+            graph.addEdge(base::Name {"decoder/Input"}, base::Name {name});
+        }
+        return graph;
+    };
+
+    auto hash = BuildCache::hash(makeGraph(2, {"decoder/a", "decoder/b"}));
+    ASSERT_TRUE(hash);
+    ASSERT_EQ(hash, BuildCache::hash(makeGraph(2, {"decoder/a", "decoder/b"})));
+    // Changed asset
+    ASSERT_NE(hash, BuildCache::hash(makeGraph(3, {"decoder/a", "decoder/b"})));
+    // Changed order of evaluation
+    ASSERT_NE(hash, BuildCache::hash(makeGraph(2, {"decoder/b", "decoder/a"})));
+
+    // Assets not built from a hashed document
+    Graph<base::Name, Asset> graph {base::Name {"decoder/Input"}, Asset {}};
+    graph.addNode(base::Name {"decoder/a"}, Asset {"decoder/a", assetExpr("decoder/a"), {}});
+    graph.addEdge(base::Name {"decoder/Input"}, base::Name {"decoder/a"});
+    ASSERT_FALSE(BuildCache::hash(graph));
+}
+
+TEST(BuildCache, UnchangedSubgraphsAreReused)
+{
+    auto cache = std::make_shared<BuildCache>();
+    auto data = factory::PolicyData({.name = "policy/test/0", .hash = "hash"});
+
+    auto makeGraph = [](std::size_t ruleHash)
+    {
+        factory::PolicyGraph graph;
+        Graph<base::Name, Asset> decoders {base::Name {"decoder/Input"}, Asset {}};
+        decoders.addNode(base::Name {"decoder/a"}, hashedAsset("decoder/a", 1));
+        decoders.addEdge(base::Name {"decoder/Input"}, base::Name {"decoder/a"});
+        Graph<base::Name, Asset> rules {base::Name {"rule/Input"}, Asset {}};
+        rules.addNode(base::Name {"rule/a"}, hashedAsset("rule/a", ruleHash));
+        rules.addEdge(base::Name {"rule/Input"}, base::Name {"rule/a"});
+        graph.subgraphs.emplace(AT::DECODER, std::move(decoders));
+        graph.subgraphs.emplace(AT::RULE, std::move(rules));
+        return graph;
+    };
+
+    auto first = factory::buildExpression(makeGraph(1), data, cache);
+    auto second = factory::buildExpression(makeGraph(2), data, cache);
+    builder::test::assertEqualExpr(first, factory::buildExpression(makeGraph(1), data));
+
+    const auto& firstOperands = first->getPtr<base::Operation>()->getOperands();
+    const auto& secondOperands = second->getPtr<base::Operation>()->getOperands();
+    ASSERT_EQ(firstOperands[0], secondOperands[0]);
+    ASSERT_NE(firstOperands[1], secondOperands[1]);
+
+    // Other policies share the decoders, but not the other subgraphs
+    auto otherData = factory::PolicyData({.name = "policy/other/0", .hash = "hash"});
+    auto other = factory::buildExpression(makeGraph(2), otherData, cache);
+    ASSERT_EQ(other->getPtr<base::Operation>()->getOperands()[0], secondOperands[0]);
+    ASSERT_NE(other->getPtr<base::Operation>()->getOperands()[1], secondOperands[1]);
+}
+
+TEST(BuildCache, SharedSubgraphsAreNotKeptAlive)
+{
+    BuildCache cache;
+    auto expression = assetExpr("decoder/a");
+    cache.putSharedSubgraph(1, expression);
+    ASSERT_EQ(cache.getSharedSubgraph(1), expression);
+    ASSERT_FALSE(cache.getSharedSubgraph(2));
+
+    expression.reset();
+    ASSERT_FALSE(cache.getSharedSubgraph(1));
+}
+
+} // namespace buildcachetest
@@ -93,7 +93,7 @@ void runIngest(std::shared_ptr<apiclnt::Client> client, const std::string& event
  *
  * @param client A shared pointer to the apiclnt::Client instance.
  * @param eps Number of events per second allowed to be processed
- * @param intervalSec Interval window size in seconds for resetting the counter
+ * @param intervalSec Refresh interval in seconds, stored but not used by the token bucket limiter
  */
 void runChangeEpsSettings(std::shared_ptr<apiclnt::Client> client, int eps, int intervalSec);
 
@@ -118,6 +118,30 @@ void runActivateEps(std::shared_ptr<apiclnt::Client> client);
  */
 void runDeactivateEps(std::shared_ptr<apiclnt::Client> client);
 
+/**
+ * @brief Activate the profiler of the routes
+ *
+ * @param client A shared pointer to the apiclnt::Client instance.
+ * @param sampleRate 1 of each sampleRate invocations of the assets and helpers is timed
+ */
+void runActivateProfiler(std::shared_ptr<apiclnt::Client> client, uint sampleRate);
+
+/**
+ * @brief Deactivate the profiler of the routes
+ *
+ * @param client A shared pointer to the apiclnt::Client instance.
+ */
+void runDeactivateProfiler(std::shared_ptr<apiclnt::Client> client);
+
+/**
+ * @brief Get the assets and helpers with the highest cumulative execution time
+ *
+ * @param client A shared pointer to the apiclnt::Client instance.
+ * @param top Max number of assets and helpers, 0 for all
+ * @param jsonFormat If true, the report is printed in Json format, otherwise in Yaml
+ */
+void runGetProfilerReport(std::shared_ptr<apiclnt::Client> client, uint top, bool jsonFormat);
+
 /**
  * @brief Configures the program using the provided CLI application instance.
  *
@@ -16,6 +16,15 @@ constexpr auto ENGINE_LOG_OUTPUT_ENV = "WZE_LOG_OUTPUT";
 constexpr auto ENGINE_LOG_TRUNCATE = false;
 constexpr auto ENGINE_LOG_TRUNCATE_ENV = "WZE_LOG_TRUNCATE";
 
+constexpr auto ENGINE_LOG_THREADS = 0;
+constexpr auto ENGINE_LOG_THREADS_ENV = "WZE_LOG_THREADS";
+
+constexpr auto ENGINE_LOG_QUEUE_SIZE = 8192;
+constexpr auto ENGINE_LOG_QUEUE_SIZE_ENV = "WZE_LOG_QUEUE_SIZE";
+
+constexpr auto ENGINE_LOG_DROP_ON_OVERFLOW = false;
+constexpr auto ENGINE_LOG_DROP_ON_OVERFLOW_ENV = "WZE_LOG_DROP_ON_OVERFLOW";
+
 // Server module
 constexpr auto ENGINE_SRV_PULL_THREADS = 1;
 constexpr auto ENGINE_SRV_PULL_THREADS_ENV = "WZE_PULL_THREADS";
@@ -26,6 +35,12 @@ constexpr auto ENGINE_SRV_EVENT_SOCK_ENV = "WZE_EVENT_SOCK";
 constexpr auto ENGINE_SRV_EVENT_QUEUE_TASK = 0;
 constexpr auto ENGINE_SRV_EVENT_QUEUE_TASK_ENV = "WZE_EVENT_QUEUE_TASK";
 
+constexpr auto ENGINE_SRV_EVENT_BATCH_SIZE = 32;
+constexpr auto ENGINE_SRV_EVENT_BATCH_SIZE_ENV = "WZE_EVENT_BATCH_SIZE";
+
+constexpr auto ENGINE_SRV_EVENT_FLOW_CONTROL = false;
+constexpr auto ENGINE_SRV_EVENT_FLOW_CONTROL_ENV = "WZE_EVENT_FLOW_CONTROL";
+
 constexpr auto ENGINE_SRV_API_SOCK = "/var/ossec/queue/sockets/engine-api";
 constexpr auto ENGINE_SRV_API_SOCK_ENV = "WZE_API_SOCK";
 
@@ -40,10 +55,23 @@ constexpr auto ENGINE_SRV_API_TIMEOUT_ENV = "WZE_API_TIMEOUT";
 constexpr auto ENGINE_DEFAULT_POLICY = "policy/wazuh/0";
 constexpr auto ENGINE_STORE_PATH = "/var/ossec/engine/store";
 constexpr auto ENGINE_STORE_PATH_ENV = "WZE_STORE_PATH";
+constexpr auto ENGINE_STORE_PACK_PATH = "";
+constexpr auto ENGINE_STORE_PACK_PATH_ENV = "WZE_STORE_PACK_PATH";
 
 // KVDB module
 constexpr auto ENGINE_KVDB_PATH = "/var/ossec/etc/kvdb/";
 constexpr auto ENGINE_KVDB_PATH_ENV = "WZE_KVDB_PATH";
+constexpr auto ENGINE_KVDB_CACHE_SIZE = 4096;
+constexpr auto ENGINE_KVDB_CACHE_SIZE_ENV = "WZE_KVDB_CACHE_SIZE";
+constexpr auto ENGINE_KVDB_SNAPSHOT_DBS_ENV = "WZE_KVDB_SNAPSHOT_DBS";
+constexpr auto ENGINE_KVDB_WRITE_BEHIND_WINDOW = 0;
+constexpr auto ENGINE_KVDB_WRITE_BEHIND_WINDOW_ENV = "WZE_KVDB_WRITE_BEHIND_WINDOW";
+
+// WDB module
+constexpr auto ENGINE_WDB_CACHE_SIZE = 0;
+constexpr auto ENGINE_WDB_CACHE_SIZE_ENV = "WZE_WDB_CACHE_SIZE";
+constexpr auto ENGINE_WDB_CACHE_TTL = 1000;
+constexpr auto ENGINE_WDB_CACHE_TTL_ENV = "WZE_WDB_CACHE_TTL";
 
 // TZDB
 constexpr auto ENGINE_TZDB_PATH = "/var/ossec/engine/tzdb";
@@ -58,6 +86,55 @@ constexpr auto ENGINE_KVDB_CLI_RECORDS = 50;
 constexpr auto ENGINE_ROUTER_THREADS = 1;
 constexpr auto ENGINE_ROUTER_THREADS_ENV = "WZE_ROUTER_THREADS";
 
+constexpr auto ENGINE_ROUTER_MIN_THREADS = 0;
+constexpr auto ENGINE_ROUTER_MIN_THREADS_ENV = "WZE_ROUTER_MIN_THREADS";
+
+constexpr auto ENGINE_ROUTER_SCALE_INTERVAL = 1000;
+constexpr auto ENGINE_ROUTER_SCALE_INTERVAL_ENV = "WZE_ROUTER_SCALE_INTERVAL";
+
+constexpr auto ENGINE_ROUTER_TEST_THREADS = 1;
+constexpr auto ENGINE_ROUTER_TEST_THREADS_ENV = "WZE_ROUTER_TEST_THREADS";
+
+constexpr auto ENGINE_ROUTER_TEST_SESSION_LIMIT = 4;
+constexpr auto ENGINE_ROUTER_TEST_SESSION_LIMIT_ENV = "WZE_ROUTER_TEST_SESSION_LIMIT";
+
+constexpr auto ENGINE_ROUTER_BATCH_SIZE = 64;
+constexpr auto ENGINE_ROUTER_BATCH_SIZE_ENV = "WZE_ROUTER_BATCH_SIZE";
+
+constexpr auto ENGINE_ROUTER_SHARDED_QUEUES = false;
+constexpr auto ENGINE_ROUTER_SHARDED_QUEUES_ENV = "WZE_ROUTER_SHARDED_QUEUES";
+
+constexpr auto ENGINE_ROUTER_RAW_EVENTS = false;
+constexpr auto ENGINE_ROUTER_RAW_EVENTS_ENV = "WZE_ROUTER_RAW_EVENTS";
+
+constexpr auto ENGINE_ROUTER_SHARED_ENVIRONMENTS = false;
+constexpr auto ENGINE_ROUTER_SHARED_ENVIRONMENTS_ENV = "WZE_ROUTER_SHARED_ENVIRONMENTS";
+
+constexpr auto ENGINE_ROUTER_BACKEND = "rx";
+constexpr auto ENGINE_ROUTER_BACKEND_ENV = "WZE_ROUTER_BACKEND";
+
+constexpr auto ENGINE_ROUTER_NUMA_AWARE = false;
+constexpr auto ENGINE_ROUTER_NUMA_AWARE_ENV = "WZE_ROUTER_NUMA_AWARE";
+
+constexpr auto ENGINE_ROUTER_LATENCY_METRICS = false;
+constexpr auto ENGINE_ROUTER_LATENCY_METRICS_ENV = "WZE_ROUTER_LATENCY_METRICS";
+constexpr auto ENGINE_STARTUP_PREWARM = false;
+constexpr auto ENGINE_STARTUP_PREWARM_ENV = "WZE_STARTUP_PREWARM";
+
+constexpr auto ENGINE_MEMORY_ACCOUNTING_INTERVAL = 0;
+constexpr auto ENGINE_MEMORY_ACCOUNTING_INTERVAL_ENV = "WZE_MEMORY_ACCOUNTING_INTERVAL";
+constexpr auto ENGINE_KVDB_MEMORY_LIMIT = 0;
+constexpr auto ENGINE_KVDB_MEMORY_LIMIT_ENV = "WZE_KVDB_MEMORY_LIMIT";
+constexpr auto ENGINE_GEO_MEMORY_LIMIT = 0;
+constexpr auto ENGINE_GEO_MEMORY_LIMIT_ENV = "WZE_GEO_MEMORY_LIMIT";
+
+constexpr auto ENGINE_ROUTER_DEDUP_WINDOW = 0;
+constexpr auto ENGINE_ROUTER_DEDUP_WINDOW_ENV = "WZE_ROUTER_DEDUP_WINDOW";
+constexpr auto ENGINE_ROUTER_DEDUP_FIELDS_ENV = "WZE_ROUTER_DEDUP_FIELDS";
+
+constexpr auto ENGINE_ROUTER_PROFILER_SAMPLE_RATE = 100;
+constexpr auto ENGINE_ROUTER_PROFILER_TOP = 20;
+
 // Maxmind module
 constexpr auto ENGINE_MMDB_ASN_PATH = "";
 constexpr auto ENGINE_MMDB_ASN_PATH_ENV = "WZE_MMDB_ASN_PATH";
@@ -72,12 +149,78 @@ constexpr auto ENGINE_QUEUE_SIZE_ENV = "WZE_QUEUE_SIZE";
 constexpr auto ENGINE_QUEUE_FLOOD_FILE = "/var/ossec/logs/engine-flood.log";
 constexpr auto ENGINE_QUEUE_FLOOD_FILE_ENV = "WZE_QUEUE_FLOOD_FILE";
 
+constexpr auto ENGINE_QUEUE_SPILL_PATH = "";
+constexpr auto ENGINE_QUEUE_SPILL_PATH_ENV = "WZE_QUEUE_SPILL_PATH";
+
+constexpr auto ENGINE_QUEUE_SPILL_SIZE = 1024;
+constexpr auto ENGINE_QUEUE_SPILL_SIZE_ENV = "WZE_QUEUE_SPILL_SIZE";
+
+constexpr auto ENGINE_QUEUE_PRIORITY_CLASSES = "";
+constexpr auto ENGINE_QUEUE_PRIORITY_CLASSES_ENV = "WZE_QUEUE_PRIORITY_CLASSES";
+
 constexpr auto ENGINE_QUEUE_FLOOD_ATTEMPTS = 3;
 constexpr auto ENGINE_QUEUE_FLOOD_ATTEMPTS_ENV = "WZE_QUEUE_FLOOD_ATTEMPTS";
 
 constexpr auto ENGINE_QUEUE_FLOOD_SLEEP = 100;
 constexpr auto ENGINE_QUEUE_FLOOD_SLEEP_ENV = "WZE_QUEUE_FLOOD_SLEEP";
 
+constexpr auto ENGINE_EVENT_ARENA_SIZE = 0;
+constexpr auto ENGINE_EVENT_ARENA_SIZE_ENV = "WZE_EVENT_ARENA_SIZE";
+
+constexpr auto ENGINE_EVENT_ARENA_COUNT = 8192;
+constexpr auto ENGINE_EVENT_ARENA_COUNT_ENV = "WZE_EVENT_ARENA_COUNT";
+
+// Builder
+constexpr auto ENGINE_BUILDER_THREADS = 1;
+constexpr auto ENGINE_BUILDER_THREADS_ENV = "WZE_BUILDER_THREADS";
+
+// File output
+constexpr auto ENGINE_OUTPUT_ASYNC = false;
+constexpr auto ENGINE_OUTPUT_ASYNC_ENV = "WZE_OUTPUT_ASYNC";
+
+constexpr auto ENGINE_OUTPUT_BUFFER_SIZE = 65536;
+constexpr auto ENGINE_OUTPUT_BUFFER_SIZE_ENV = "WZE_OUTPUT_BUFFER_SIZE";
+
+constexpr auto ENGINE_OUTPUT_FSYNC_INTERVAL = 1000;
+constexpr auto ENGINE_OUTPUT_FSYNC_INTERVAL_ENV = "WZE_OUTPUT_FSYNC_INTERVAL";
+
+constexpr auto ENGINE_OUTPUT_MAX_SIZE = 0;
+constexpr auto ENGINE_OUTPUT_MAX_SIZE_ENV = "WZE_OUTPUT_MAX_SIZE";
+
+constexpr auto ENGINE_OUTPUT_ROTATE_INTERVAL = 0;
+constexpr auto ENGINE_OUTPUT_ROTATE_INTERVAL_ENV = "WZE_OUTPUT_ROTATE_INTERVAL";
+
+// Indexer connector
+constexpr auto ENGINE_INDEXER_HOSTS = "";
+constexpr auto ENGINE_INDEXER_HOSTS_ENV = "WZE_INDEXER_HOSTS";
+
+constexpr auto ENGINE_INDEXER_USERNAME = "";
+constexpr auto ENGINE_INDEXER_USERNAME_ENV = "WZE_INDEXER_USERNAME";
+
+constexpr auto ENGINE_INDEXER_PASSWORD = "";
+constexpr auto ENGINE_INDEXER_PASSWORD_ENV = "WZE_INDEXER_PASSWORD";
+
+constexpr auto ENGINE_INDEXER_CA = "";
+constexpr auto ENGINE_INDEXER_CA_ENV = "WZE_INDEXER_CA";
+
+constexpr auto ENGINE_INDEXER_BATCH_BYTES = 5 * 1024 * 1024;
+constexpr auto ENGINE_INDEXER_BATCH_BYTES_ENV = "WZE_INDEXER_BATCH_BYTES";
+
+constexpr auto ENGINE_INDEXER_FLUSH_INTERVAL = 200;
+constexpr auto ENGINE_INDEXER_FLUSH_INTERVAL_ENV = "WZE_INDEXER_FLUSH_INTERVAL";
+
+constexpr auto ENGINE_INDEXER_CONNECTIONS = 4;
+constexpr auto ENGINE_INDEXER_CONNECTIONS_ENV = "WZE_INDEXER_CONNECTIONS";
+
+constexpr auto ENGINE_INDEXER_QUEUE_SIZE = 65536;
+constexpr auto ENGINE_INDEXER_QUEUE_SIZE_ENV = "WZE_INDEXER_QUEUE_SIZE";
+
+constexpr auto ENGINE_INDEXER_COMPRESS = true;
+constexpr auto ENGINE_INDEXER_COMPRESS_ENV = "WZE_INDEXER_COMPRESS";
+
+constexpr auto ENGINE_INDEXER_BUFFER_PATH = "/var/ossec/queue/indexer/engine";
+constexpr auto ENGINE_INDEXER_BUFFER_PATH_ENV = "WZE_INDEXER_BUFFER_PATH";
+
 // RBAC Module
 constexpr auto ENGINE_RBAC_ROLE = "user-developer";
 
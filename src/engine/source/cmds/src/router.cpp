@@ -21,6 +21,8 @@ struct Options
     int clientTimeout;
     uint eps;
     uint refreshInterval;
+    uint sampleRate;
+    uint top;
 };
 } // namespace
 
@@ -268,6 +270,68 @@ void runDeactivateEps(std::shared_ptr<apiclnt::Client> client)
     utils::apiAdapter::fromWazuhResponse<ResponseType>(response);
 }
 
+void runActivateProfiler(std::shared_ptr<apiclnt::Client> client, uint sampleRate)
+{
+    using RequestType = eRouter::ProfilerEnable_Request;
+    using ResponseType = eEngine::GenericStatus_Response;
+    const std::string command = "router.profiler/activate";
+
+    // Prepare the request
+    RequestType eRequest;
+    eRequest.set_sample_rate(sampleRate);
+
+    // Call the API, any error will throw an cmd::exception
+    const auto request = utils::apiAdapter::toWazuhRequest<RequestType>(command, details::ORIGIN_NAME, eRequest);
+    const auto response = client->send(request);
+    utils::apiAdapter::fromWazuhResponse<ResponseType>(response);
+}
+
+void runDeactivateProfiler(std::shared_ptr<apiclnt::Client> client)
+{
+    using RequestType = eRouter::ProfilerDisable_Request;
+    using ResponseType = eEngine::GenericStatus_Response;
+    const std::string command = "router.profiler/deactivate";
+
+    // Prepare the request
+    RequestType eRequest;
+
+    // Call the API, any error will throw an cmd::exception
+    const auto request = utils::apiAdapter::toWazuhRequest<RequestType>(command, details::ORIGIN_NAME, eRequest);
+    const auto response = client->send(request);
+    utils::apiAdapter::fromWazuhResponse<ResponseType>(response);
+}
+
+void runGetProfilerReport(std::shared_ptr<apiclnt::Client> client, uint top, bool jsonFormat)
+{
+    using RequestType = eRouter::ProfilerGet_Request;
+    using ResponseType = eRouter::ProfilerGet_Response;
+    const std::string command = "router.profiler/get";
+
+    // Prepare the request
+    RequestType eRequest;
+    eRequest.set_top(top);
+
+    // Call the API
+    const auto request = utils::apiAdapter::toWazuhRequest<RequestType>(command, details::ORIGIN_NAME, eRequest);
+    const auto response = client->send(request);
+    const auto eResponse = utils::apiAdapter::fromWazuhResponse<ResponseType>(response);
+
+    auto jString = std::get<std::string>(eMessage::eMessageToJson<eRouter::ProfilerGet_Response>(eResponse));
+    if (!jsonFormat)
+    {
+        rapidjson::Document doc;
+        doc.Parse(jString.c_str());
+        auto yaml = yml::Converter::jsonToYaml(doc);
+        YAML::Emitter out;
+        out << yaml;
+        std::cout << out.c_str() << std::endl;
+    }
+    else
+    {
+        std::cout << jString << std::endl;
+    }
+}
+
 void configure(CLI::App_p app)
 {
     auto routerApp = app->add_subcommand("router", "Manage the event routing of the policies");
@@ -361,7 +425,10 @@ void configure(CLI::App_p app)
     epsChangeSubcommand
         ->add_option("events-per-second", options->eps, "Number of events per second allowed to be processed.")
         ->required();
-    epsChangeSubcommand->add_option("refresh-interval", options->refreshInterval, "Interval window size in seconds.")
+    epsChangeSubcommand
+        ->add_option("refresh-interval",
+                     options->refreshInterval,
+                     "Refresh interval in seconds, stored but not used by the token bucket limiter.")
         ->required();
     epsChangeSubcommand->callback(
         [options]()
@@ -399,5 +466,44 @@ void configure(CLI::App_p app)
             const auto client = std::make_shared<apiclnt::Client>(options->serverApiSock, options->clientTimeout);
             runDeactivateEps(client);
         });
+
+    // ProfilerActivate
+    auto profilerActivateSubcommand =
+        routerApp->add_subcommand("profiler-enable", "Enable the profiler of the assets and helpers of the routes.");
+    profilerActivateSubcommand
+        ->add_option("-r, --sample-rate", options->sampleRate, "Time 1 of each sample-rate invocations.")
+        ->default_val(ENGINE_ROUTER_PROFILER_SAMPLE_RATE)
+        ->check(CLI::PositiveNumber);
+    profilerActivateSubcommand->callback(
+        [options]()
+        {
+            const auto client = std::make_shared<apiclnt::Client>(options->serverApiSock, options->clientTimeout);
+            runActivateProfiler(client, options->sampleRate);
+        });
+
+    // ProfilerDeactivate
+    auto profilerDeactivateSubcommand = routerApp->add_subcommand("profiler-disable", "Disable the profiler.");
+    profilerDeactivateSubcommand->callback(
+        [options]()
+        {
+            const auto client = std::make_shared<apiclnt::Client>(options->serverApiSock, options->clientTimeout);
+            runDeactivateProfiler(client);
+        });
+
+    // ProfilerGet
+    auto profilerGetSubcommand = routerApp->add_subcommand(
+        "profiler-get", "Get the assets and helpers with the highest cumulative execution time.");
+    profilerGetSubcommand->add_option("--top", options->top, "Max number of assets and helpers, 0 for all.")
+        ->default_val(ENGINE_ROUTER_PROFILER_TOP)
+        ->check(CLI::NonNegativeNumber);
+    profilerGetSubcommand->add_flag("-j, --json",
+                                    options->jsonFormat,
+                                    "Allows the output and trace generated by an event to be printed in Json format.");
+    profilerGetSubcommand->callback(
+        [options]()
+        {
+            const auto client = std::make_shared<apiclnt::Client>(options->serverApiSock, options->clientTimeout);
+            runGetProfilerReport(client, options->top, options->jsonFormat);
+        });
 }
 } // namespace cmd::router
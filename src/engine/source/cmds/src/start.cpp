@@ -1,10 +1,14 @@
 #include "cmds/start.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <csignal>
 #include <exception>
+#include <filesystem>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
@@ -21,19 +25,24 @@
 #include <api/policy/policy.hpp>
 #include <api/router/handlers.hpp>
 #include <api/tester/handlers.hpp>
+#include <bk/flat/controller.hpp>
 #include <bk/rx/controller.hpp>
+#include <bk/taskf/controller.hpp>
 #include <builder/builder.hpp>
 #include <cmds/details/stackExecutor.hpp>
 #include <defs/defs.hpp>
 #include <geo/downloader.hpp>
 #include <geo/manager.hpp>
+#include <indexer/indexerConnector.hpp>
 #include <kvdb/kvdbManager.hpp>
 #include <base/logging.hpp>
 #include <logpar/logpar.hpp>
 #include <logpar/registerParsers.hpp>
+#include <metrics/memoryAccounting.hpp>
 #include <metrics/metricsManager.hpp>
 #include <base/parseEvent.hpp>
 #include <queue/concurrentQueue.hpp>
+#include <queue/priorityQueue.hpp>
 #include <rbac/rbac.hpp>
 #include <router/orchestrator.hpp>
 #include <schemf/schema.hpp>
@@ -43,6 +52,7 @@
 #include <server/protocolHandlers/wStream.hpp>
 #include <sockiface/unixSocketFactory.hpp>
 #include <store/drivers/fileDriver.hpp>
+#include <store/drivers/packDriver.hpp>
 #include <store/store.hpp>
 #include <wdb/wdbManager.hpp>
 
@@ -56,6 +66,22 @@ struct QueueTraits : public moodycamel::ConcurrentQueueDefaultTraits
     static constexpr size_t BLOCK_SIZE = 2048;
     static constexpr size_t IMPLICIT_INITIAL_INDEX_SIZE = 8192;
 };
+
+/**
+ * @brief Rebuild an event from the spill log of the event queue, the log keeps the parsed event as JSON
+ */
+base::Event decodeSpilledEvent(std::string_view str)
+{
+    return std::make_shared<json::Json>(std::string {str}.c_str());
+}
+
+/**
+ * @brief Rebuild a raw event from the spill log of the raw event queue, the log keeps the received bytes
+ */
+router::RawEventPtr decodeSpilledRawEvent(std::string_view str)
+{
+    return std::make_shared<router::RawEvent>(str);
+}
 std::shared_ptr<engineserver::EngineServer> g_engineServer {};
 
 void sigintHandler(const int signum)
@@ -73,25 +99,78 @@ struct Options
     int serverThreads;
     std::string serverEventSock;
     int serverEventQueueSize;
+    int serverEventBatchSize;
+    bool serverEventFlowControl;
     std::string serverApiSock;
     int serverApiQueueSize;
     int serverApiTimeout;
     // Store
     std::string fileStorage;
+    std::string storePackPath;
     // KVDB
     std::string kvdbPath;
+    int kvdbCacheSize;
+    std::vector<std::string> kvdbSnapshotDBs;
+    int kvdbWriteBehindWindow;
+    // WDB
+    int wdbCacheSize;
+    int wdbCacheTtl;
     // Orchestration
     int routerThreads;
+    int routerMinThreads;
+    int routerScaleInterval;
+    int routerTestThreads;
+    int routerTestSessionLimit;
+    int routerBatchSize;
+    bool routerShardedQueues;
+    bool routerRawEvents;
+    bool routerSharedEnvironments;
+    std::string routerBackend;
+    bool routerNumaAware;
+    bool routerLatencyMetrics;
+    bool startupPrewarm;
+    int memoryAccountingInterval;
+    int kvdbMemoryLimit;
+    int geoMemoryLimit;
+    int routerDedupWindow;
+    std::vector<std::string> routerDedupFields;
     // Queue
     int queueSize;
     std::string queueFloodFile;
+    std::string queueSpillPath;
+    int queueSpillSize;
+    std::string queuePriorityClasses;
     int queueFloodAttempts;
     int queueFloodSleep;
     bool queueDropFlood;
+    int eventArenaSize;
+    int eventArenaCount;
+    // Builder
+    int builderThreads;
+    // File output
+    bool outputAsync;
+    int outputBufferSize;
+    int outputFsyncInterval;
+    int64_t outputMaxSize;
+    int outputRotateInterval;
+    // Indexer connector
+    std::string indexerHosts;
+    std::string indexerUsername;
+    std::string indexerPassword;
+    std::string indexerCa;
+    int indexerBatchBytes;
+    int indexerFlushInterval;
+    int indexerConnections;
+    int indexerQueueSize;
+    bool indexerCompress;
+    std::string indexerBufferPath;
     // Loggin
     std::string level;
     std::string logOutput;
     bool logTruncate;
+    int logThreads;
+    int logQueueSize;
+    bool logDropOnOverflow;
     // TZ_DB
     std::string tzdbPath;
     bool tzdbAutoUpdate;
@@ -113,45 +192,109 @@ void runStart(ConfHandler confManager)
     const auto level = confManager->get<std::string>("server.log_level");
     const auto logOutput = confManager->get<std::string>("server.log_output");
     const auto logTruncate = confManager->get<bool>("server.log_truncate");
+    const auto logThreads = confManager->get<int>("server.log_threads");
+    const auto logQueueSize = confManager->get<int>("server.log_queue_size");
+    const auto logDropOnOverflow = confManager->get<bool>("server.log_drop_on_overflow");
 
     // Server config
     const auto serverThreads = confManager->get<int>("server.server_threads");
     const auto serverEventSock = confManager->get<std::string>("server.event_socket");
     const auto serverEventQueueSize = confManager->get<int>("server.event_queue_tasks");
+    const auto serverEventBatchSize = confManager->get<int>("server.event_batch_size");
+    const auto serverEventFlowControl = confManager->get<bool>("server.event_flow_control");
     const auto serverApiSock = confManager->get<std::string>("server.api_socket");
     const auto serverApiQueueSize = confManager->get<int>("server.api_queue_tasks");
     const auto serverApiTimeout = confManager->get<int>("server.api_timeout");
 
     // Store config
     const auto fileStorage = confManager->get<std::string>("server.store_path");
+    const auto storePackPath = confManager->get<std::string>("server.store_pack_path");
 
     // Logging init
     logging::LoggingConfig logConfig;
     logConfig.level = logging::strToLevel(level);
     logConfig.truncate = logTruncate;
     logConfig.filePath = logOutput;
+    logConfig.dedicatedThreads = logThreads;
+    logConfig.queueSize = logQueueSize;
+    logConfig.dropOnOverflow = logDropOnOverflow;
 
     exitHandler.add([]() { logging::stop(); });
     logging::start(logConfig);
 
-    LOG_DEBUG("Logging configuration: filePath='{}', level='{}', flushInterval={}ms.",
+    LOG_DEBUG("Logging configuration: filePath='{}', level='{}', flushInterval={}ms, threads={}, queueSize={}, "
+              "dropOnOverflow={}.",
               logConfig.filePath,
               logging::levelToStr(logConfig.level),
-              logConfig.flushInterval);
+              logConfig.flushInterval,
+              logConfig.dedicatedThreads,
+              logConfig.queueSize,
+              logConfig.dropOnOverflow);
     LOG_INFO("Logging initialized.");
 
     // KVDB config
     const auto kvdbPath = confManager->get<std::string>("server.kvdb_path");
+    const auto kvdbCacheSize = confManager->get<int>("server.kvdb_cache_size");
+    const auto kvdbSnapshotDBs = confManager->get<std::vector<std::string>>("server.kvdb_snapshot_dbs");
+    const auto kvdbWriteBehindWindow = confManager->get<int>("server.kvdb_write_behind_window");
+
+    // WDB config
+    const auto wdbCacheSize = confManager->get<int>("server.wdb_cache_size");
+    const auto wdbCacheTtl = confManager->get<int>("server.wdb_cache_ttl");
 
     // Router Config
     const auto routerThreads = confManager->get<int>("server.router_threads");
+    const auto routerMinThreads = confManager->get<int>("server.router_min_threads");
+    const auto routerScaleInterval = confManager->get<int>("server.router_scale_interval");
+    const auto routerTestThreads = confManager->get<int>("server.router_test_threads");
+    const auto routerTestSessionLimit = confManager->get<int>("server.router_test_session_limit");
+    const auto routerBatchSize = confManager->get<int>("server.router_batch_size");
+    const auto routerShardedQueues = confManager->get<bool>("server.router_sharded_queues");
+    const auto routerRawEvents = confManager->get<bool>("server.router_raw_events");
+    const auto routerSharedEnvironments = confManager->get<bool>("server.router_shared_environments");
+    const auto routerBackend = confManager->get<std::string>("server.router_backend");
+    const auto routerNumaAware = confManager->get<bool>("server.router_numa_aware");
+    const auto routerLatencyMetrics = confManager->get<bool>("server.router_latency_metrics");
+    const auto startupPrewarm = confManager->get<bool>("server.startup_prewarm");
+    const auto memoryAccountingInterval = confManager->get<int>("server.memory_accounting_interval");
+    const auto kvdbMemoryLimit = confManager->get<int>("server.kvdb_memory_limit");
+    const auto geoMemoryLimit = confManager->get<int>("server.geo_memory_limit");
+    const auto routerDedupWindow = confManager->get<int>("server.router_dedup_window");
+    const auto routerDedupFields = confManager->get<std::vector<std::string>>("server.router_dedup_fields");
 
     // Queue config
     const auto queueSize = confManager->get<int>("server.queue_size");
     const auto queueFloodFile = confManager->get<std::string>("server.queue_flood_file");
+    const auto queueSpillPath = confManager->get<std::string>("server.queue_spill_path");
+    const auto queueSpillSize = confManager->get<int>("server.queue_spill_size");
+    const auto queuePriorityClasses = confManager->get<std::string>("server.queue_priority_classes");
     const auto queueFloodAttempts = confManager->get<int>("server.queue_flood_attempts");
     const auto queueFloodSleep = confManager->get<int>("server.queue_flood_sleep");
     const auto queueDropFlood = confManager->get<bool>("server.queue_drop_flood");
+    const auto eventArenaSize = confManager->get<int>("server.event_arena_size");
+    const auto eventArenaCount = confManager->get<int>("server.event_arena_count");
+
+    // Builder config
+    const auto builderThreads = confManager->get<int>("server.builder_threads");
+
+    // File output config
+    const auto outputAsync = confManager->get<bool>("server.output_async");
+    const auto outputBufferSize = confManager->get<int>("server.output_buffer_size");
+    const auto outputFsyncInterval = confManager->get<int>("server.output_fsync_interval");
+    const auto outputMaxSize = confManager->get<int64_t>("server.output_max_size");
+    const auto outputRotateInterval = confManager->get<int>("server.output_rotate_interval");
+
+    // Indexer connector config
+    const auto indexerHosts = confManager->get<std::string>("server.indexer_hosts");
+    const auto indexerUsername = confManager->get<std::string>("server.indexer_username");
+    const auto indexerPassword = confManager->get<std::string>("server.indexer_password");
+    const auto indexerCa = confManager->get<std::string>("server.indexer_ca");
+    const auto indexerBatchBytes = confManager->get<int>("server.indexer_batch_bytes");
+    const auto indexerFlushInterval = confManager->get<int>("server.indexer_flush_interval");
+    const auto indexerConnections = confManager->get<int>("server.indexer_connections");
+    const auto indexerQueueSize = confManager->get<int>("server.indexer_queue_size");
+    const auto indexerCompress = confManager->get<bool>("server.indexer_compress");
+    const auto indexerBufferPath = confManager->get<std::string>("server.indexer_buffer_path");
 
     // TZDB config
     const auto tzdbPath = confManager->get<std::string>("server.tzdb_path");
@@ -184,10 +327,12 @@ void runStart(ConfHandler confManager)
     std::shared_ptr<builder::Builder> builder;
     std::shared_ptr<api::catalog::Catalog> catalog;
     std::shared_ptr<router::Orchestrator> orchestrator;
+    std::size_t eventQueueCapacity {0}; // Events that fit in all the event queues, the credits of the producers
     std::shared_ptr<hlp::logpar::Logpar> logpar;
     std::shared_ptr<kvdbManager::KVDBManager> kvdbManager;
     std::shared_ptr<metricsManager::MetricsManager> metrics;
     std::shared_ptr<geo::Manager> geoManager;
+    std::shared_ptr<indexer::IndexerConnector> indexerConnector;
     std::shared_ptr<schemf::Schema> schema;
     std::shared_ptr<sockiface::UnixSocketFactory> sockFactory;
     std::shared_ptr<wazuhdb::WDBManager> wdbManager;
@@ -200,8 +345,25 @@ void runStart(ConfHandler confManager)
 
         // Store
         {
-            auto fileDriver = std::make_shared<store::drivers::FileDriver>(fileStorage);
-            store = std::make_shared<store::Store>(fileDriver);
+            if (storePackPath.empty())
+            {
+                auto fileDriver = std::make_shared<store::drivers::FileDriver>(fileStorage);
+                store = std::make_shared<store::Store>(fileDriver);
+            }
+            else
+            {
+                auto packDriver = std::make_shared<store::drivers::PackDriver>(storePackPath, true);
+                // First start with the pack, it takes the assets of the store folder
+                if (packDriver->empty())
+                {
+                    auto error = packDriver->import(store::drivers::FileDriver(fileStorage));
+                    if (error)
+                    {
+                        throw std::runtime_error(fmt::format("Error importing the store: {}", error.value().message));
+                    }
+                }
+                store = std::make_shared<store::Store>(packDriver);
+            }
             LOG_INFO("Store initialized.");
         }
 
@@ -213,7 +375,11 @@ void runStart(ConfHandler confManager)
 
         // KVDB
         {
-            kvdbManager::KVDBManagerOptions kvdbOptions {kvdbPath, "kvdb"};
+            kvdbManager::KVDBManagerOptions kvdbOptions {kvdbPath,
+                                                         "kvdb",
+                                                         static_cast<std::size_t>(kvdbCacheSize),
+                                                         {kvdbSnapshotDBs.begin(), kvdbSnapshotDBs.end()},
+                                                         std::chrono::milliseconds(kvdbWriteBehindWindow)};
             kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions, metrics);
             kvdbManager->initialize();
             LOG_INFO("KVDB initialized.");
@@ -233,6 +399,39 @@ void runStart(ConfHandler confManager)
             LOG_INFO("Geo initialized.");
         }
 
+        // Indexer connector, only if the outputs can send the events directly
+        if (!indexerHosts.empty())
+        {
+            indexer::Config indexerConfig;
+            std::string host;
+            std::istringstream hosts(indexerHosts);
+            while (std::getline(hosts, host, ','))
+            {
+                if (!host.empty())
+                {
+                    indexerConfig.hosts.push_back(host);
+                }
+            }
+            indexerConfig.username = indexerUsername;
+            indexerConfig.password = indexerPassword;
+            indexerConfig.caFile = indexerCa;
+            indexerConfig.maxBatchBytes = indexerBatchBytes;
+            indexerConfig.flushIntervalMs = indexerFlushInterval;
+            indexerConfig.connections = indexerConnections;
+            indexerConfig.queueSize = indexerQueueSize;
+            indexerConfig.compress = indexerCompress;
+            indexerConfig.bufferPath = indexerBufferPath;
+
+            indexerConnector = std::make_shared<indexer::IndexerConnector>(indexerConfig);
+            LOG_INFO("Indexer connector initialized.");
+            exitHandler.add(
+                [indexerConnector]()
+                {
+                    indexerConnector->drain();
+                    LOG_INFO("Indexer connector terminated.");
+                });
+        }
+
         // Schema
         {
             schema = std::make_shared<schemf::Schema>();
@@ -279,9 +478,25 @@ void runStart(ConfHandler confManager)
             builderDeps.kvdbScopeName = "builder";
             builderDeps.kvdbManager = kvdbManager;
             builderDeps.sockFactory = std::make_shared<sockiface::UnixSocketFactory>();
-            builderDeps.wdbManager =
-                std::make_shared<wazuhdb::WDBManager>(std::string(wazuhdb::WDB_SOCK_PATH), builderDeps.sockFactory);
+            // One connection per router worker, the helpers of all the environments share them
+            wazuhdb::WDBOptions wdbOptions;
+            wdbOptions.connections = static_cast<std::size_t>(routerThreads);
+            wdbOptions.cacheSize = static_cast<std::size_t>(wdbCacheSize);
+            wdbOptions.cacheTtl = std::chrono::milliseconds(wdbCacheTtl);
+            builderDeps.wdbManager = std::make_shared<wazuhdb::WDBManager>(
+                std::string(wazuhdb::WDB_SOCK_PATH), builderDeps.sockFactory, wdbOptions);
             builderDeps.geoManager = geoManager;
+            builderDeps.indexerConnector = indexerConnector;
+            builderDeps.buildThreads = builderThreads;
+            builderDeps.fileOutput.async = outputAsync;
+            builderDeps.fileOutput.bufferSize = outputBufferSize;
+            builderDeps.fileOutput.fsyncIntervalMs = outputFsyncInterval;
+            builderDeps.fileOutput.maxFileSize = outputMaxSize;
+            builderDeps.fileOutput.rotateIntervalSec = outputRotateInterval;
+            if (outputAsync)
+            {
+                builderDeps.fileOutput.metricsScope = metrics->getMetricsScope("OutputFile");
+            }
             auto defs = std::make_shared<defs::DefinitionsBuilder>();
             builder = std::make_shared<builder::Builder>(store, schema, defs, builderDeps);
             LOG_INFO("Builder initialized.");
@@ -307,17 +522,163 @@ void runStart(ConfHandler confManager)
             using QEventType = base::queue::ConcurrentQueue<base::Event, QueueTraits>;
             using QTestType = base::queue::ConcurrentQueue<router::test::QueueType>;
 
-            std::shared_ptr<QEventType> eventQueue {};
+            std::shared_ptr<router::ProdQueueType> eventQueue {};
             std::shared_ptr<QTestType> testQueue {};
+
+            // Event queue that floods to the file, or spills to a directory of its own if spilling is enabled
+            const auto spillBytes = static_cast<std::size_t>(queueSpillSize) * 1024 * 1024;
+            auto makeEventQueue = [&](int size,
+                                      const std::shared_ptr<metricsManager::IMetricsScope>& scope,
+                                      const std::shared_ptr<metricsManager::IMetricsScope>& scopeDelta,
+                                      const std::string& spillDir,
+                                      std::size_t spillSize) -> std::shared_ptr<router::ProdQueueType>
+            {
+                if (!queueSpillPath.empty())
+                {
+                    auto spillLog =
+                        std::make_shared<base::queue::SpillLog>(spillDir, std::max<std::size_t>(1, spillSize));
+                    return std::make_shared<QEventType>(size, scope, scopeDelta, spillLog, decodeSpilledEvent);
+                }
+                // TODO queueFloodFile, queueFloodAttempts, queueFloodSleep -> Move to Queue.flood options
+                return std::make_shared<QEventType>(
+                    size, scope, scopeDelta, queueFloodFile, queueFloodAttempts, queueFloodSleep, queueDropFlood);
+            };
+
+            std::vector<std::shared_ptr<router::ProdQueueType>> eventLanes {};
+            if (!routerShardedQueues)
             {
                 auto scope = metrics->getMetricsScope("EventQueue");
                 auto scopeDelta = metrics->getMetricsScope("EventQueueDelta");
-                // TODO queueFloodFile, queueFloodAttempts, queueFloodSleep -> Move to Queue.flood options
-                eventQueue = std::make_shared<QEventType>(
-                    queueSize, scope, scopeDelta, queueFloodFile, queueFloodAttempts, queueFloodSleep, queueDropFlood);
+                auto priorityClasses = base::queue::parsePriorityClasses(queuePriorityClasses);
+                if (priorityClasses.empty())
+                {
+                    eventQueue = makeEventQueue(queueSize, scope, scopeDelta, queueSpillPath, spillBytes);
+                    eventQueueCapacity = queueSize;
+                }
+                else
+                {
+                    // The queue ids that are not in any class go to the default class
+                    auto isDefault = [](const auto& priorityClass) { return priorityClass.name == "default"; };
+                    if (std::none_of(priorityClasses.begin(), priorityClasses.end(), isDefault))
+                    {
+                        priorityClasses.push_back({"default", 1, ""});
+                    }
+                    const auto defaultClass = static_cast<std::size_t>(
+                        std::find_if(priorityClasses.begin(), priorityClasses.end(), isDefault)
+                        - priorityClasses.begin());
+
+                    // Each class has its own queue of queueSize events, so a backlogged class does not block others
+                    std::array<std::size_t, 256> classByQueueId {};
+                    classByQueueId.fill(defaultClass);
+                    std::vector<base::queue::PriorityQueue<base::Event>::PriorityClass> classes;
+                    for (std::size_t i = 0; i < priorityClasses.size(); ++i)
+                    {
+                        const auto& priorityClass = priorityClasses[i];
+                        for (auto id : priorityClass.queueIds)
+                        {
+                            classByQueueId[static_cast<unsigned char>(id)] = i;
+                        }
+                        auto classScope = metrics->getMetricsScope("EventQueue." + priorityClass.name);
+                        auto classScopeDelta = metrics->getMetricsScope("EventQueueDelta." + priorityClass.name);
+                        const auto spillDir = (std::filesystem::path(queueSpillPath) / priorityClass.name).string();
+                        classes.push_back({makeEventQueue(queueSize,
+                                                          classScope,
+                                                          classScopeDelta,
+                                                          spillDir,
+                                                          spillBytes / priorityClasses.size()),
+                                           priorityClass.weight,
+                                           classScope});
+                    }
+
+                    eventQueue = std::make_shared<base::queue::PriorityQueue<base::Event>>(
+                        std::move(classes),
+                        [classByQueueId](const base::Event& event) -> std::size_t
+                        {
+                            const auto queueId = event ? event->getInt(base::parseEvent::EVENT_QUEUE_ID) : std::nullopt;
+                            return classByQueueId[static_cast<unsigned char>(queueId.value_or(0))];
+                        });
+                    eventQueueCapacity = static_cast<std::size_t>(queueSize) * priorityClasses.size();
+                    LOG_INFO("Event queue split in {} priority classes.", priorityClasses.size());
+                }
 
                 LOG_DEBUG("Event queue created.");
             }
+            else
+            {
+                if (!queuePriorityClasses.empty())
+                {
+                    LOG_WARNING("The priority classes of the event queue are ignored with the sharded queues.");
+                }
+
+                // The lanes replace the event queue. All of them share the metrics scopes, so the metrics are the
+                // aggregated of all of them, and the flooding file, so their writes do not interleave
+                auto scope = metrics->getMetricsScope("EventQueue");
+                auto scopeDelta = metrics->getMetricsScope("EventQueueDelta");
+                std::shared_ptr<base::queue::FloodingFile> floodingFile {};
+                if (queueSpillPath.empty() && !queueFloodFile.empty())
+                {
+                    floodingFile = std::make_shared<base::queue::FloodingFile>(queueFloodFile);
+                    LOG_INFO("The event queue lanes will be flooded in the file: {}", queueFloodFile);
+                }
+                const auto laneSize = std::max(1, queueSize / routerThreads);
+                for (auto i = 0; i < routerThreads; ++i)
+                {
+                    if (floodingFile)
+                    {
+                        eventLanes.emplace_back(std::make_shared<QEventType>(laneSize,
+                                                                             scope,
+                                                                             scopeDelta,
+                                                                             floodingFile,
+                                                                             queueFloodAttempts,
+                                                                             queueFloodSleep,
+                                                                             queueDropFlood));
+                        continue;
+                    }
+                    // Each lane spills to its own log, with its share of the size
+                    eventLanes.emplace_back(
+                        makeEventQueue(laneSize,
+                                       scope,
+                                       scopeDelta,
+                                       (std::filesystem::path(queueSpillPath) / ("lane-" + std::to_string(i))).string(),
+                                       spillBytes / routerThreads));
+                }
+                eventQueueCapacity = static_cast<std::size_t>(laneSize) * routerThreads;
+                LOG_DEBUG("Event queue lanes created ({} lanes of {} events).", routerThreads, laneSize);
+            }
+            std::shared_ptr<router::RawQueueType> rawQueue {};
+            if (routerRawEvents)
+            {
+                if (routerShardedQueues || !queuePriorityClasses.empty())
+                {
+                    // Both select the queue of each event by its parsed fields
+                    LOG_WARNING("The raw event queue is ignored with the sharded queues or the priority classes.");
+                }
+                else
+                {
+                    using QRawType = base::queue::ConcurrentQueue<router::RawEventPtr, QueueTraits>;
+                    auto scope = metrics->getMetricsScope("RawEventQueue");
+                    auto scopeDelta = metrics->getMetricsScope("RawEventQueueDelta");
+                    if (!queueSpillPath.empty())
+                    {
+                        const auto spillDir = (std::filesystem::path(queueSpillPath) / "raw").string();
+                        auto spillLog =
+                            std::make_shared<base::queue::SpillLog>(spillDir, std::max<std::size_t>(1, spillBytes));
+                        rawQueue =
+                            std::make_shared<QRawType>(queueSize, scope, scopeDelta, spillLog, decodeSpilledRawEvent);
+                    }
+                    else
+                    {
+                        rawQueue = std::make_shared<QRawType>(queueSize,
+                                                              scope,
+                                                              scopeDelta,
+                                                              queueFloodFile,
+                                                              queueFloodAttempts,
+                                                              queueFloodSleep,
+                                                              queueDropFlood);
+                    }
+                    LOG_DEBUG("Raw event queue created, the events are parsed by the router threads.");
+                }
+            }
             {
                 auto scope = metrics->getMetricsScope("TestQueue");
                 auto scopeDelta = metrics->getMetricsScope("TestQueueDelta");
@@ -325,13 +686,61 @@ void runStart(ConfHandler confManager)
                 LOG_DEBUG("Test queue created.");
             }
 
+            std::shared_ptr<json::ArenaPool> eventArenas {};
+            if (eventArenaSize > 0)
+            {
+                // Without the raw queue the events are only parsed on the endpoint thread, it uses a single shard
+                const auto shards = rawQueue ? std::max(1U, std::thread::hardware_concurrency()) : 1U;
+                const auto arenasPerShard = std::max(1U, static_cast<unsigned>(eventArenaCount) / shards);
+                eventArenas = std::make_shared<json::ArenaPool>(eventArenaSize, arenasPerShard, shards);
+                LOG_DEBUG("Event arenas created ({} shards of {} arenas of {} bytes).",
+                          shards,
+                          arenasPerShard,
+                          eventArenaSize);
+            }
+
+            // The shared routes are ingested by all the router threads at once, they need a thread-safe backend
+            std::shared_ptr<bk::IControllerMaker> controllerMaker {};
+            if (routerSharedEnvironments)
+            {
+                if (routerBackend != ENGINE_ROUTER_BACKEND)
+                {
+                    LOG_WARNING("The router backend '{}' is ignored with the shared environments.", routerBackend);
+                }
+                controllerMaker = std::make_shared<bk::flat::ControllerMaker>();
+            }
+            else if (routerBackend == "taskf")
+            {
+                controllerMaker = std::make_shared<bk::taskf::ControllerMaker>();
+            }
+            else
+            {
+                controllerMaker = std::make_shared<bk::rx::ControllerMaker>();
+            }
+            LOG_DEBUG("Router backend: {}.", routerSharedEnvironments ? "flat" : routerBackend);
+
             router::Orchestrator::Options config {.m_numThreads = routerThreads,
                                                   .m_wStore = store,
                                                   .m_builder = builder,
-                                                  .m_controllerMaker = std::make_shared<bk::rx::ControllerMaker>(),
+                                                  .m_controllerMaker = controllerMaker,
                                                   .m_prodQueue = eventQueue,
                                                   .m_testQueue = testQueue,
-                                                  .m_testTimeout = serverApiTimeout};
+                                                  .m_testTimeout = serverApiTimeout,
+                                                  .m_batchSize = routerBatchSize,
+                                                  .m_prodLanes = eventLanes,
+                                                  .m_eventArenas = eventArenas,
+                                                  .m_rawQueue = rawQueue,
+                                                  .m_shareEnvironments = routerSharedEnvironments,
+                                                  .m_numaAware = routerNumaAware,
+                                                  .m_minThreads = routerMinThreads,
+                                                  .m_scaleIntervalMs = routerScaleInterval,
+                                                  .m_testThreads = routerTestThreads,
+                                                  .m_testSessionLimit = routerTestSessionLimit,
+                                                  .m_dedupWindow = routerDedupWindow,
+                                                  .m_dedupFields = routerDedupFields,
+                                                  .m_latencyScope = routerLatencyMetrics
+                                                                        ? metrics->getMetricsScope("PipelineLatency")
+                                                                        : nullptr};
 
             orchestrator = std::make_shared<router::Orchestrator>(config);
             orchestrator->start();
@@ -340,6 +749,36 @@ void runStart(ConfHandler confManager)
             LOG_INFO("Router initialized.");
         }
 
+        // Prewarm, once the policies are loaded and before the endpoints open
+        if (startupPrewarm)
+        {
+            const auto geoBytes = geoManager->prewarm();
+            const auto kvdbBytes = kvdbManager->prewarm();
+            LOG_INFO("Prewarm done: {} bytes of geo databases and {} bytes of KVDB read.", geoBytes, kvdbBytes);
+        }
+
+        // Memory accounting, stopped before the KVDB and geo managers are finalized
+        if (memoryAccountingInterval > 0)
+        {
+            constexpr std::size_t MB = 1024 * 1024;
+            auto memory = std::make_shared<metricsManager::MemoryAccounting>(
+                metrics->getMetricsScope("Memory"), std::chrono::seconds(memoryAccountingInterval));
+            memory->addProbe(
+                "KVDB",
+                [kvdbManager]() { return kvdbManager->memoryUsage(); },
+                static_cast<std::size_t>(kvdbMemoryLimit) * MB,
+                [kvdbManager]() { kvdbManager->releaseMemory(); });
+            memory->addProbe(
+                "Geo",
+                [geoManager]() { return geoManager->memoryUsage(); },
+                static_cast<std::size_t>(geoMemoryLimit) * MB,
+                [geoManager]() { geoManager->releaseMemory(); });
+            memory->start();
+
+            exitHandler.add([memory]() { memory->stop(); });
+            LOG_INFO("Memory accounting started every {} seconds.", memoryAccountingInterval);
+        }
+
         // Create and configure the api endpints
         {
             // API
@@ -421,9 +860,40 @@ void runStart(ConfHandler confManager)
             // Event Endpoint
             auto eventMetricScope = metrics->getMetricsScope("endpointEvent");
             auto eventMetricScopeDelta = metrics->getMetricsScope("endpointEventRate", true);
-            auto eventHandler = std::bind(&router::Orchestrator::pushEvent, orchestrator, std::placeholders::_1);
-            auto eventEndpointCfg = std::make_shared<endpoint::UnixDatagram>(
-                serverEventSock, eventHandler, eventMetricScope, eventMetricScopeDelta, serverEventQueueSize);
+            std::shared_ptr<endpoint::UnixDatagram> eventEndpointCfg;
+            if (serverEventBatchSize > 1)
+            {
+                auto eventHandler = [orchestrator](const std::vector<std::string>& events)
+                {
+                    orchestrator->pushEvents(events);
+                };
+                eventEndpointCfg = std::make_shared<endpoint::UnixDatagram>(serverEventSock,
+                                                                            eventHandler,
+                                                                            eventMetricScope,
+                                                                            eventMetricScopeDelta,
+                                                                            serverEventBatchSize,
+                                                                            serverEventQueueSize);
+            }
+            else
+            {
+                auto eventHandler = std::bind(&router::Orchestrator::pushEvent, orchestrator, std::placeholders::_1);
+                eventEndpointCfg = std::make_shared<endpoint::UnixDatagram>(
+                    serverEventSock, eventHandler, eventMetricScope, eventMetricScopeDelta, serverEventQueueSize);
+            }
+            if (serverEventFlowControl)
+            {
+                // Read only while the event queues have room, resume once a tenth of them (or a batch) is free
+                eventEndpointCfg->setFlowControl(
+                    {.credits = [orchestrator, eventQueueCapacity]() -> std::size_t
+                     {
+                         const auto queued = orchestrator->queuedEvents();
+                         return queued < eventQueueCapacity ? eventQueueCapacity - queued : 0;
+                     },
+                     .resumeCredits = std::min(eventQueueCapacity,
+                                               std::max<std::size_t>(serverEventBatchSize, eventQueueCapacity / 10)),
+                     .checkIntervalMs = 10});
+                LOG_DEBUG("Event flow control enabled ({} credits).", eventQueueCapacity);
+            }
             server->addEndpoint("EVENT", eventEndpointCfg);
             LOG_DEBUG("Server configured.");
         }
@@ -480,6 +950,28 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_LOG_TRUNCATE)
         ->envname(ENGINE_LOG_TRUNCATE_ENV);
 
+    serverApp
+        ->add_option("--log_threads",
+                     options->logThreads,
+                     "Sets the number of threads that write the logs, 0 to write them synchronously.")
+        ->default_val(ENGINE_LOG_THREADS)
+        ->check(CLI::Range(0, 16))
+        ->envname(ENGINE_LOG_THREADS_ENV);
+
+    serverApp
+        ->add_option("--log_queue_size", options->logQueueSize, "Sets the size of the queue of the log threads.")
+        ->default_val(ENGINE_LOG_QUEUE_SIZE)
+        ->check(CLI::Range(1, 1048576))
+        ->envname(ENGINE_LOG_QUEUE_SIZE_ENV);
+
+    serverApp
+        ->add_flag("--log_drop_on_overflow",
+                   options->logDropOnOverflow,
+                   "If enabled, the oldest queued logs are dropped when the queue of the log threads is full, instead "
+                   "of waiting for room.")
+        ->default_val(ENGINE_LOG_DROP_ON_OVERFLOW)
+        ->envname(ENGINE_LOG_DROP_ON_OVERFLOW_ENV);
+
     // Server module
     serverApp
         ->add_option("--server_threads", options->serverThreads, "Sets the number of threads for server worker pool.")
@@ -496,6 +988,20 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_SRV_EVENT_QUEUE_TASK)
         ->check(CLI::NonNegativeNumber)
         ->envname(ENGINE_SRV_EVENT_QUEUE_TASK_ENV);
+    serverApp
+        ->add_option("--event_batch_size",
+                     options->serverEventBatchSize,
+                     "Sets the max number of datagrams read at once from the events socket (1 = one per read).")
+        ->default_val(ENGINE_SRV_EVENT_BATCH_SIZE)
+        ->check(CLI::Range(1, 1024))
+        ->envname(ENGINE_SRV_EVENT_BATCH_SIZE_ENV);
+    serverApp
+        ->add_flag("--event_flow_control",
+                   options->serverEventFlowControl,
+                   "If enabled, the events socket is read only while the event queue has room and the free room is "
+                   "sent back to the producers that bind their socket (as \"credits:<n>\").")
+        ->default_val(ENGINE_SRV_EVENT_FLOW_CONTROL)
+        ->envname(ENGINE_SRV_EVENT_FLOW_CONTROL_ENV);
     serverApp->add_option("--api_socket", options->serverApiSock, "Sets the API server socket address.")
         ->default_val(ENGINE_SRV_API_SOCK)
         ->envname(ENGINE_SRV_API_SOCK_ENV);
@@ -519,12 +1025,58 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_STORE_PATH)
         ->check(CLI::ExistingDirectory)
         ->envname(ENGINE_STORE_PATH_ENV);
+    serverApp
+        ->add_option("--store_pack_path",
+                     options->storePackPath,
+                     "Sets the path to the pack file the store is kept in, imported from the store folder on the first "
+                     "start. Empty to read the store folder.")
+        ->default_val(ENGINE_STORE_PACK_PATH)
+        ->envname(ENGINE_STORE_PACK_PATH_ENV);
 
     // KVDB Module
     serverApp->add_option("--kvdb_path", options->kvdbPath, "Sets the path to the KVDB folder.")
         ->default_val(ENGINE_KVDB_PATH)
         ->check(CLI::ExistingDirectory)
         ->envname(ENGINE_KVDB_PATH_ENV);
+    serverApp
+        ->add_option("--kvdb_cache_size",
+                     options->kvdbCacheSize,
+                     "Sets the number of parsed values cached by each KVDB handler. (0 = disable)")
+        ->default_val(ENGINE_KVDB_CACHE_SIZE)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_KVDB_CACHE_SIZE_ENV);
+    serverApp
+        ->add_option("--kvdb_snapshot_dbs",
+                     options->kvdbSnapshotDBs,
+                     "Sets the read-only KVDBs, comma separated, that are read from an in-memory snapshot taken when "
+                     "the policy is loaded.")
+        ->delimiter(',')
+        ->envname(ENGINE_KVDB_SNAPSHOT_DBS_ENV);
+    serverApp
+        ->add_option("--kvdb_write_behind_window",
+                     options->kvdbWriteBehindWindow,
+                     "Sets the milliseconds the KVDB writes of the helpers are coalesced for before being applied in "
+                     "the background, they are read back before being applied. (0 = synchronous writes)")
+        ->default_val(ENGINE_KVDB_WRITE_BEHIND_WINDOW)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_KVDB_WRITE_BEHIND_WINDOW_ENV);
+
+    // WDB module
+    serverApp
+        ->add_option("--wdb_cache_size",
+                     options->wdbCacheSize,
+                     "Sets the number of wazuh-db 'sql select' results cached, writes to the same database invalidate "
+                     "them. (0 = disable)")
+        ->default_val(ENGINE_WDB_CACHE_SIZE)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_WDB_CACHE_SIZE_ENV);
+    serverApp
+        ->add_option("--wdb_cache_ttl",
+                     options->wdbCacheTtl,
+                     "Sets the time in milliseconds a cached wazuh-db result is valid.")
+        ->default_val(ENGINE_WDB_CACHE_TTL)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_WDB_CACHE_TTL_ENV);
 
     // TZ_DB Installation Path
     serverApp->add_option("--tzdb_path", options->tzdbPath, "Sets the install path to the time zone database.")
@@ -545,6 +1097,148 @@ void configure(CLI::App_p app)
         ->check(CLI::Range(1, 128))
         ->envname(ENGINE_ROUTER_THREADS_ENV);
 
+    serverApp
+        ->add_option("--router_min_threads",
+                     options->routerMinThreads,
+                     "Sets the minimum number of router threads. If greater than 0, the router starts with this number "
+                     "of threads and adds threads up to router_threads while the load requires them.")
+        ->default_val(ENGINE_ROUTER_MIN_THREADS)
+        ->check(CLI::Range(0, 128))
+        ->envname(ENGINE_ROUTER_MIN_THREADS_ENV);
+
+    serverApp
+        ->add_option("--router_scale_interval",
+                     options->routerScaleInterval,
+                     "Sets the interval in milliseconds between two evaluations of the router load.")
+        ->default_val(ENGINE_ROUTER_SCALE_INTERVAL)
+        ->check(CLI::Range(1, 60000))
+        ->envname(ENGINE_ROUTER_SCALE_INTERVAL_ENV);
+
+    serverApp
+        ->add_option("--router_test_threads",
+                     options->routerTestThreads,
+                     "Sets the number of threads that only run the tests. If 0, the tests run on the router threads, "
+                     "between the production events.")
+        ->default_val(ENGINE_ROUTER_TEST_THREADS)
+        ->check(CLI::Range(0, 128))
+        ->envname(ENGINE_ROUTER_TEST_THREADS_ENV);
+
+    serverApp
+        ->add_option("--router_test_session_limit",
+                     options->routerTestSessionLimit,
+                     "Sets the maximum number of tests queued or running at once for the same test session. If 0, "
+                     "there is no limit.")
+        ->default_val(ENGINE_ROUTER_TEST_SESSION_LIMIT)
+        ->check(CLI::Range(0, 1024))
+        ->envname(ENGINE_ROUTER_TEST_SESSION_LIMIT_ENV);
+
+    serverApp
+        ->add_option("--router_batch_size",
+                     options->routerBatchSize,
+                     "Sets the maximum number of events dequeued at once by each router thread.")
+        ->default_val(ENGINE_ROUTER_BATCH_SIZE)
+        ->check(CLI::Range(1, 4096))
+        ->envname(ENGINE_ROUTER_BATCH_SIZE_ENV);
+
+    serverApp
+        ->add_flag("--router_sharded_queues",
+                   options->routerShardedQueues,
+                   "If enabled, each router thread has its own event queue and the events are distributed by agent.")
+        ->default_val(ENGINE_ROUTER_SHARDED_QUEUES)
+        ->envname(ENGINE_ROUTER_SHARDED_QUEUES_ENV);
+
+    serverApp
+        ->add_flag("--router_raw_events",
+                   options->routerRawEvents,
+                   "If enabled, the events are queued as received and parsed by the router threads instead of the "
+                   "server thread. Ignored with the sharded queues or the priority classes.")
+        ->default_val(ENGINE_ROUTER_RAW_EVENTS)
+        ->envname(ENGINE_ROUTER_RAW_EVENTS_ENV);
+
+    serverApp
+        ->add_flag("--router_shared_environments",
+                   options->routerSharedEnvironments,
+                   "If enabled, each route is built once and shared by all the router threads.")
+        ->default_val(ENGINE_ROUTER_SHARED_ENVIRONMENTS)
+        ->envname(ENGINE_ROUTER_SHARED_ENVIRONMENTS_ENV);
+
+    serverApp
+        ->add_option("--router_backend",
+                     options->routerBackend,
+                     "Sets the backend that runs the routes of each router thread: rx or taskf. Ignored with the "
+                     "shared environments.")
+        ->default_val(ENGINE_ROUTER_BACKEND)
+        ->check(CLI::IsMember({"rx", "taskf"}))
+        ->envname(ENGINE_ROUTER_BACKEND_ENV);
+
+    serverApp
+        ->add_flag("--router_numa_aware",
+                   options->routerNumaAware,
+                   "If enabled, the router threads are pinned to the NUMA nodes of the host, each node with its own "
+                   "copy of the shared routes.")
+        ->default_val(ENGINE_ROUTER_NUMA_AWARE)
+        ->envname(ENGINE_ROUTER_NUMA_AWARE_ENV);
+
+    serverApp
+        ->add_flag("--router_latency_metrics",
+                   options->routerLatencyMetrics,
+                   "If enabled, the time of the filter and of the decode, rules and outputs stages of each route is "
+                   "recorded in the latency histograms of the PipelineLatency metrics scope.")
+        ->default_val(ENGINE_ROUTER_LATENCY_METRICS)
+        ->envname(ENGINE_ROUTER_LATENCY_METRICS_ENV);
+
+    serverApp
+        ->add_flag("--startup_prewarm",
+                   options->startupPrewarm,
+                   "If enabled, the geo databases and the KVDBs are read into memory after the policies are loaded "
+                   "and before the endpoints open, so the first events do not wait for the disk.")
+        ->default_val(ENGINE_STARTUP_PREWARM)
+        ->envname(ENGINE_STARTUP_PREWARM_ENV);
+
+    serverApp
+        ->add_option("--memory_accounting_interval",
+                     options->memoryAccountingInterval,
+                     "Sets the interval in seconds in which the memory held by the KVDBs and the geo databases is "
+                     "published in the Memory metrics scope. If 0, the memory is not accounted.")
+        ->default_val(ENGINE_MEMORY_ACCOUNTING_INTERVAL)
+        ->check(CLI::Range(0, 3600))
+        ->envname(ENGINE_MEMORY_ACCOUNTING_INTERVAL_ENV);
+
+    serverApp
+        ->add_option("--kvdb_memory_limit",
+                     options->kvdbMemoryLimit,
+                     "Sets the soft limit in MB of the memory held by the KVDBs, above which the unused cached blocks "
+                     "and snapshots are released. If 0, there is no limit.")
+        ->default_val(ENGINE_KVDB_MEMORY_LIMIT)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_KVDB_MEMORY_LIMIT_ENV);
+
+    serverApp
+        ->add_option("--geo_memory_limit",
+                     options->geoMemoryLimit,
+                     "Sets the soft limit in MB of the memory held by the geo databases, above which their lookup "
+                     "caches are cleared. If 0, there is no limit.")
+        ->default_val(ENGINE_GEO_MEMORY_LIMIT)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_GEO_MEMORY_LIMIT_ENV);
+
+    serverApp
+        ->add_option("--router_dedup_window",
+                     options->routerDedupWindow,
+                     "Sets the window in seconds in which the repeated events are dropped before routing. If 0, the "
+                     "events are not deduplicated.")
+        ->default_val(ENGINE_ROUTER_DEDUP_WINDOW)
+        ->check(CLI::Range(0, 86400))
+        ->envname(ENGINE_ROUTER_DEDUP_WINDOW_ENV);
+
+    serverApp
+        ->add_option("--router_dedup_fields",
+                     options->routerDedupFields,
+                     "Sets the fields, comma separated, that identify the repeated events. If empty, the whole events "
+                     "are compared.")
+        ->delimiter(',')
+        ->envname(ENGINE_ROUTER_DEDUP_FIELDS_ENV);
+
     // Queue module
     serverApp
         ->add_option(
@@ -560,6 +1254,30 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_QUEUE_FLOOD_FILE)
         ->envname(ENGINE_QUEUE_FLOOD_FILE_ENV);
 
+    serverApp
+        ->add_option("--queue_spill_path",
+                     options->queueSpillPath,
+                     "Sets the directory where the events are spilled when the queue is full, to be processed later. "
+                     "If set, it replaces the flood file.")
+        ->default_val(ENGINE_QUEUE_SPILL_PATH)
+        ->envname(ENGINE_QUEUE_SPILL_PATH_ENV);
+
+    serverApp
+        ->add_option("--queue_spill_size",
+                     options->queueSpillSize,
+                     "Sets the maximum size in MiB of the spilled events, the events are discarded beyond it.")
+        ->default_val(ENGINE_QUEUE_SPILL_SIZE)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_QUEUE_SPILL_SIZE_ENV);
+
+    serverApp
+        ->add_option("--queue_priority_classes",
+                     options->queuePriorityClasses,
+                     "Sets the priority classes of the events, as name=weight:queue_ids separated by commas (e.g. "
+                     "'realtime=8:1,bulk=1:8dp'). Each class has its own queue and they are dequeued by weight.")
+        ->default_val(ENGINE_QUEUE_PRIORITY_CLASSES)
+        ->envname(ENGINE_QUEUE_PRIORITY_CLASSES_ENV);
+
     serverApp
         ->add_option("--queue_flood_attempts",
                      options->queueFloodAttempts,
@@ -580,6 +1298,140 @@ void configure(CLI::App_p app)
                         options->queueDropFlood,
                         "If enabled, the queue will drop the flood events instead of storing them in the file.");
 
+    serverApp
+        ->add_option("--event_arena_size",
+                     options->eventArenaSize,
+                     "Sets the size in bytes of the reusable memory arena of each event (0 = disable).")
+        ->default_val(ENGINE_EVENT_ARENA_SIZE)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_EVENT_ARENA_SIZE_ENV);
+
+    serverApp
+        ->add_option("--event_arena_count",
+                     options->eventArenaCount,
+                     "Sets the maximum number of event arenas, the events beyond it are allocated without arena.")
+        ->default_val(ENGINE_EVENT_ARENA_COUNT)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_EVENT_ARENA_COUNT_ENV);
+
+    // Builder
+    serverApp
+        ->add_option("--builder_threads",
+                     options->builderThreads,
+                     "Sets the number of threads that build the assets of a policy, 0 to use one per CPU core.")
+        ->default_val(ENGINE_BUILDER_THREADS)
+        ->check(CLI::Range(0, 128))
+        ->envname(ENGINE_BUILDER_THREADS_ENV);
+
+    // File output
+    serverApp
+        ->add_flag("--output_async",
+                   options->outputAsync,
+                   "If enabled, the file outputs queue the events and write them in batches from a writer thread.")
+        ->default_val(ENGINE_OUTPUT_ASYNC)
+        ->envname(ENGINE_OUTPUT_ASYNC_ENV);
+
+    serverApp
+        ->add_option("--output_buffer_size",
+                     options->outputBufferSize,
+                     "Sets the number of events each async file output can queue before the writers wait.")
+        ->default_val(ENGINE_OUTPUT_BUFFER_SIZE)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_OUTPUT_BUFFER_SIZE_ENV);
+
+    serverApp
+        ->add_option("--output_fsync_interval",
+                     options->outputFsyncInterval,
+                     "Sets the milliseconds between syncs of the async file outputs to disk (0 = disable).")
+        ->default_val(ENGINE_OUTPUT_FSYNC_INTERVAL)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_OUTPUT_FSYNC_INTERVAL_ENV);
+
+    serverApp
+        ->add_option("--output_max_size",
+                     options->outputMaxSize,
+                     "Sets the size in bytes at which the async file outputs are rotated (0 = disable).")
+        ->default_val(ENGINE_OUTPUT_MAX_SIZE)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_OUTPUT_MAX_SIZE_ENV);
+
+    serverApp
+        ->add_option("--output_rotate_interval",
+                     options->outputRotateInterval,
+                     "Sets the seconds after which the async file outputs are rotated (0 = disable).")
+        ->default_val(ENGINE_OUTPUT_ROTATE_INTERVAL)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_OUTPUT_ROTATE_INTERVAL_ENV);
+
+    // Indexer connector
+    serverApp
+        ->add_option("--indexer_hosts",
+                     options->indexerHosts,
+                     "Sets the comma separated indexer URLs the indexer outputs send the events to (empty = disable).")
+        ->default_val(ENGINE_INDEXER_HOSTS)
+        ->envname(ENGINE_INDEXER_HOSTS_ENV);
+
+    serverApp
+        ->add_option("--indexer_username", options->indexerUsername, "Sets the user of the indexer connection.")
+        ->default_val(ENGINE_INDEXER_USERNAME)
+        ->envname(ENGINE_INDEXER_USERNAME_ENV);
+
+    serverApp
+        ->add_option("--indexer_password", options->indexerPassword, "Sets the password of the indexer connection.")
+        ->default_val(ENGINE_INDEXER_PASSWORD)
+        ->envname(ENGINE_INDEXER_PASSWORD_ENV);
+
+    serverApp
+        ->add_option("--indexer_ca",
+                     options->indexerCa,
+                     "Sets the CA bundle used to verify the indexer certificate (empty = system bundle).")
+        ->default_val(ENGINE_INDEXER_CA)
+        ->envname(ENGINE_INDEXER_CA_ENV);
+
+    serverApp
+        ->add_option("--indexer_batch_bytes",
+                     options->indexerBatchBytes,
+                     "Sets the size in bytes at which a bulk request is sent to the indexer.")
+        ->default_val(ENGINE_INDEXER_BATCH_BYTES)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_INDEXER_BATCH_BYTES_ENV);
+
+    serverApp
+        ->add_option("--indexer_flush_interval",
+                     options->indexerFlushInterval,
+                     "Sets the milliseconds an event can wait for its bulk request to be sent to the indexer.")
+        ->default_val(ENGINE_INDEXER_FLUSH_INTERVAL)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_INDEXER_FLUSH_INTERVAL_ENV);
+
+    serverApp
+        ->add_option("--indexer_connections",
+                     options->indexerConnections,
+                     "Sets the number of bulk requests in flight to the indexer at the same time.")
+        ->default_val(ENGINE_INDEXER_CONNECTIONS)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_INDEXER_CONNECTIONS_ENV);
+
+    serverApp
+        ->add_option("--indexer_queue_size",
+                     options->indexerQueueSize,
+                     "Sets the number of events waiting in memory for the indexer before using the disk buffer.")
+        ->default_val(ENGINE_INDEXER_QUEUE_SIZE)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_INDEXER_QUEUE_SIZE_ENV);
+
+    serverApp
+        ->add_option("--indexer_compress", options->indexerCompress, "Sets if the bulk requests are gzip compressed.")
+        ->default_val(ENGINE_INDEXER_COMPRESS)
+        ->envname(ENGINE_INDEXER_COMPRESS_ENV);
+
+    serverApp
+        ->add_option("--indexer_buffer_path",
+                     options->indexerBufferPath,
+                     "Sets the directory of the disk buffer for the events not sent to the indexer (empty = disable).")
+        ->default_val(ENGINE_INDEXER_BUFFER_PATH)
+        ->envname(ENGINE_INDEXER_BUFFER_PATH_ENV);
+
     // Start subcommand
     auto startApp = serverApp->add_subcommand("start", "Start a Wazuh engine instance");
 
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 
@@ -23,6 +24,7 @@ static const std::string INTERNAL_NAME = "geo";
 static const std::string PATH_PATH = "/path";
 static const std::string HASH_PATH = "/hash";
 static const std::string TYPE_PATH = "/type";
+static const std::string TMP_SUFFIX = ".tmp"; ///< Suffix of a downloaded database until it replaces the current one
 
 class Manager final : public IManager
 {
@@ -30,6 +32,7 @@ private:
     std::map<std::string, std::shared_ptr<DbEntry>> m_dbs; ///< The databases that have been added.
     std::map<Type, std::string> m_dbTypes;  ///< Map by Types for quick access to the db name. (only one db per type)
     mutable std::shared_mutex m_rwMapMutex; ///< Mutex to avoid simultaneous updates on the db map
+    std::mutex m_upsertMutex;               ///< Serializes the remote upserts, held while downloading
 
     std::shared_ptr<store::IStoreInternal> m_store; ///< The store used to store the MMDB hash.
     std::shared_ptr<IDownloader> m_downloader;      ///< The downloader used to download the MMDB database.
@@ -38,9 +41,10 @@ private:
      * @brief Upsert the internal store entry for a database.
      *
      * @param path The path to the database.
+     * @param type The type of the database.
      * @return base::OptError An error if the store entry could not be upserted.
      */
-    base::OptError upsertStoreEntry(const std::string& path);
+    base::OptError upsertStoreEntry(const std::string& path, Type type);
 
     /**
      * @brief Remove the internal store entry for a database.
@@ -108,6 +112,26 @@ public:
      * @copydoc IManager::getLocator
      */
     base::RespOrError<std::shared_ptr<ILocator>> getLocator(Type type) const override;
+
+    /**
+     * @brief Fault in the pages of all the databases, so the first lookups after a start do not read the disk.
+     *
+     * @return std::size_t Bytes of the databases read.
+     */
+    std::size_t prewarm() const;
+
+    /**
+     * @brief Estimate the memory held by the databases: their mapped files and lookup caches.
+     *
+     * @return std::size_t Bytes held.
+     */
+    std::size_t memoryUsage() const;
+
+    /**
+     * @brief Clear the lookup caches of the databases, the mappings are kept for the locators.
+     *
+     */
+    void releaseMemory() const;
 };
 
 } // namespace geo
@@ -1,32 +1,115 @@
 #ifndef _GEO_DBENTRY_HPP
 #define _GEO_DBENTRY_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <shared_mutex>
+
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include <maxminddb.h>
 
+#include <base/error.hpp>
 #include <geo/imanager.hpp>
 
+#include "lookupCache.hpp"
+
 namespace geo
 {
 
+/**
+ * @brief An opened MMDB database, never modified once it is published.
+ *
+ * Each update of a database opens a new generation and publishes it in the entry, the locators pin the generation they
+ * use and the database is closed when the last one releases it. The old generation is marked as retired when it is
+ * replaced so the locators know they have to pin the new one.
+ */
+class Database
+{
+public:
+    MMDB_s mmdb;               ///< The MMDB database.
+    LookupCache cache;         ///< Lookups shared by the locators, they point into this database.
+    std::atomic<bool> retired; ///< Set when the generation is replaced or removed.
+
+    Database()
+        : mmdb {}
+        , cache()
+        , retired {false}
+    {
+    }
+
+    Database(const Database&) = delete;
+    Database& operator=(const Database&) = delete;
+    Database(Database&&) = delete;
+    Database& operator=(Database&&) = delete;
+
+    ~Database() { MMDB_close(&mmdb); }
+
+    /**
+     * @brief Open a new generation of a database.
+     *
+     * @param path The path to the database file, the file can be renamed or removed once it is opened.
+     * @return base::RespOrError<std::shared_ptr<Database>> The database or the MMDB error if the file is not valid.
+     */
+    static base::RespOrError<std::shared_ptr<Database>> open(const std::string& path)
+    {
+        auto database = std::make_shared<Database>();
+        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, &database->mmdb);
+        if (MMDB_SUCCESS != status)
+        {
+            // MMDB_open frees what it allocated on failure, leave nothing for the destructor to close
+            database->mmdb = {};
+            return base::Error {MMDB_strerror(status)};
+        }
+
+        return database;
+    }
+
+    /**
+     * @brief Read every page of the mapped file, so the first lookups do not fault them in from the disk.
+     *
+     * @return std::size_t Bytes of the database.
+     */
+    std::size_t prefault() const
+    {
+        const auto* content = static_cast<const volatile uint8_t*>(mmdb.file_content);
+        const auto size = static_cast<std::size_t>(mmdb.file_size);
+        if (content == nullptr)
+        {
+            return 0;
+        }
+
+        const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        madvise(const_cast<uint8_t*>(mmdb.file_content), size, MADV_WILLNEED);
+        uint8_t sink {0};
+        for (std::size_t offset = 0; offset < size; offset += pageSize)
+        {
+            sink ^= content[offset];
+        }
+        static_cast<void>(sink);
+
+        return size;
+    }
+};
+
 /**
  * @brief Class to hold the needed information for a database.
  */
 class DbEntry
 {
+private:
+    std::shared_ptr<Database> m_database; ///< The current generation, only accessed with the atomic functions.
+
 public:
-    std::string path;                  ///< The path to the database.
-    Type type;                         ///< The type of database.
-    mutable std::shared_mutex rwMutex; ///< Read-Write mutex for thread safety access to the MMDB database.
-    std::unique_ptr<MMDB_s> mmdb;      ///< The MMDB database.
+    std::string path; ///< The path to the database.
+    Type type;        ///< The type of database.
 
-    DbEntry(const std::string& path, Type type)
-        : path(path)
+    DbEntry(const std::string& path, Type type, std::shared_ptr<Database> database = nullptr)
+        : m_database(std::move(database))
+        , path(path)
         , type(type)
     {
-        mmdb = std::make_unique<MMDB_s>();
     }
 
     DbEntry(const DbEntry&) = delete;
@@ -34,11 +117,26 @@ public:
     DbEntry(DbEntry&&) = delete;
     DbEntry& operator=(DbEntry&&) = delete;
 
-    ~DbEntry()
+    ~DbEntry() { publish(nullptr); }
+
+    /**
+     * @brief Get the current generation of the database.
+     *
+     * @return std::shared_ptr<Database> The database, null if it was removed.
+     */
+    std::shared_ptr<Database> get() const { return std::atomic_load(&m_database); }
+
+    /**
+     * @brief Replace the current generation and retire the previous one.
+     *
+     * @param database The new generation, null to remove the database.
+     */
+    void publish(std::shared_ptr<Database> database)
     {
-        if (mmdb != nullptr)
+        auto previous = std::atomic_exchange(&m_database, std::move(database));
+        if (previous != nullptr)
         {
-            MMDB_close(mmdb.get());
+            previous->retired.store(true, std::memory_order_release);
         }
     }
 };
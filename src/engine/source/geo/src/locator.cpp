@@ -2,11 +2,14 @@
 
 #include <cinttypes>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
-#include <shared_mutex>
+#include <optional>
 #include <sstream>
 
+#include <netinet/in.h>
+
 #include "dbEntry.hpp"
 #include "manager.hpp"
 
@@ -242,87 +245,160 @@ MMDB_entry_data_list_s* dumpEntryDataList(MMDB_entry_data_list_s* eDataList, jso
 static const std::string TRANSLATE_ERROR = "Error translating IP address ";
 static const std::string LIBMMD_ERROR = "Error from libmaxminddb: ";
 
+/**
+ * @brief Looks up a binary address, built with LookupCache::makeKey, without translating it again.
+ *
+ * @param mmdb The database.
+ * @param key The family followed by the binary address.
+ * @param ip The address in text form, for the error message.
+ * @return The lookup result or an error from libmaxminddb.
+ */
+base::RespOrError<MMDB_lookup_result_s> lookupAddress(MMDB_s* mmdb, const std::string& key, const std::string& ip)
+{
+    int mmdb_error = MMDB_SUCCESS;
+    MMDB_lookup_result_s result;
+    if (AF_INET == key.front())
+    {
+        sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        std::memcpy(&addr.sin_addr, key.data() + 1, sizeof(addr.sin_addr));
+        result = MMDB_lookup_sockaddr(mmdb, reinterpret_cast<const sockaddr*>(&addr), &mmdb_error);
+    }
+    else
+    {
+        sockaddr_in6 addr {};
+        addr.sin6_family = AF_INET6;
+        std::memcpy(&addr.sin6_addr, key.data() + 1, sizeof(addr.sin6_addr));
+        result = MMDB_lookup_sockaddr(mmdb, reinterpret_cast<const sockaddr*>(&addr), &mmdb_error);
+    }
+
+    if (MMDB_SUCCESS != mmdb_error)
+    {
+        return base::Error {TRANSLATE_ERROR + ip + ": " + LIBMMD_ERROR + MMDB_strerror(mmdb_error)};
+    }
+
+    return result;
+}
+
 } // namespace
 
 namespace geo
 {
 
-base::OptError Locator::lookup(const std::string& ip, const std::shared_ptr<DbEntry>& entry)
+Database* Locator::pin(State& state)
 {
-    // Check if the IP address is the same as the cached one
-    if (ip == m_cachedIp)
+    if (state.database != nullptr && !state.database->retired.load(std::memory_order_acquire))
     {
-        return base::noError();
+        return state.database.get();
     }
 
-    // Lookup the IP address in the database
-    int gai_error, mmdb_error;
-    MMDB_lookup_result_s result = MMDB_lookup_string(entry->mmdb.get(), ip.c_str(), &gai_error, &mmdb_error);
+    // The cached result points into the retired generation
+    state.database.reset();
+    state.cachedIp.clear();
+    state.cachedKey.clear();
+    state.cachedResult = {};
 
-    if (0 != gai_error) // translation error
+    if (auto entry = m_weakDbEntry.lock())
     {
-        return base::Error {TRANSLATE_ERROR + ip + ": " + gai_strerror(gai_error)};
+        state.database = entry->get();
     }
 
-    if (MMDB_SUCCESS != mmdb_error) // libmaxminddb error, should not happen
-    {
-        return base::Error {LIBMMD_ERROR + MMDB_strerror(mmdb_error)};
-    }
-
-    m_cachedIp = ip;
-    m_cachedResult = result;
-
-    return base::noError();
+    return state.database.get();
 }
 
-base::RespOrError<MMDB_entry_data_s> Locator::getEData(const DotPath& path)
+base::RespOrError<MMDB_entry_data_s>
+Locator::getEData(const std::string& ip, const DotPath& path, Database& database, State& state)
 {
-    if (!m_cachedResult.found_entry)
+    std::optional<MMDB_entry_data_s> cachedValue;
+
+    if (ip != state.cachedIp)
+    {
+        MMDB_lookup_result_s result;
+        state.cachedKey.clear();
+        if (LookupCache::makeKey(ip, state.cachedKey))
+        {
+            if (!database.cache.get(state.cachedKey, path.str(), result, cachedValue))
+            {
+                // Search with the binary address, the text was already parsed to build the key
+                auto lookupResp = lookupAddress(&database.mmdb, state.cachedKey, ip);
+                if (base::isError(lookupResp))
+                {
+                    state.cachedKey.clear();
+                    return base::getError(lookupResp);
+                }
+                result = base::getResponse(lookupResp);
+                database.cache.putResult(state.cachedKey, result);
+            }
+        }
+        else
+        {
+            // Not a plain IPv4 or IPv6 address, let libmaxminddb translate it
+            int gai_error, mmdb_error;
+            result = MMDB_lookup_string(&database.mmdb, ip.c_str(), &gai_error, &mmdb_error);
+
+            if (0 != gai_error) // translation error
+            {
+                return base::Error {TRANSLATE_ERROR + ip + ": " + gai_strerror(gai_error)};
+            }
+
+            if (MMDB_SUCCESS != mmdb_error) // libmaxminddb error, should not happen
+            {
+                return base::Error {LIBMMD_ERROR + MMDB_strerror(mmdb_error)};
+            }
+        }
+
+        state.cachedIp = ip;
+        state.cachedResult = result;
+    }
+    else if (!state.cachedKey.empty())
+    {
+        MMDB_lookup_result_s result;
+        database.cache.get(state.cachedKey, path.str(), result, cachedValue);
+    }
+
+    if (!state.cachedResult.found_entry)
     {
         return base::Error {"No data found for the IP address"};
     }
 
+    if (cachedValue)
+    {
+        return cachedValue.value();
+    }
+
     MMDB_entry_data_s eData;
     auto pathCStrVec = getPathCStrVec(path);
 
-    int status = MMDB_aget_value((MMDB_entry_s* const)&m_cachedResult.entry, &eData, pathCStrVec.data());
+    int status = MMDB_aget_value((MMDB_entry_s* const)&state.cachedResult.entry, &eData, pathCStrVec.data());
     if (MMDB_SUCCESS != status)
     {
         return base::Error {fmt::format("Error getting value: {}", MMDB_strerror(status))};
     }
 
+    if (!state.cachedKey.empty())
+    {
+        database.cache.putValue(state.cachedKey, path.str(), eData);
+    }
+
     return eData;
 }
 
 base::RespOrError<std::string> Locator::getString(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
+    // The last lookup is kept by the locator, a thread that finds it in use looks up with its own state
+    std::unique_lock lock {m_mutex, std::try_to_lock};
+    State local {};
+    auto& state = lock.owns_lock() ? m_state : local;
 
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // The pinned generation stays open while it is in use, even if the database is updated meanwhile
+    auto* database = pin(state);
+    if (database == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
-    if (base::isError(lookError))
-    {
-        return base::getError(lookError);
-    }
-
-    // Retrieve the entry data for the given path
-    auto eDataResp = getEData(path);
+    // Retrieve the entry data of the IP address for the given path
+    auto eDataResp = getEData(ip, path, *database, state);
     if (base::isError(eDataResp))
     {
         return base::getError(eDataResp);
@@ -340,33 +416,20 @@ base::RespOrError<std::string> Locator::getString(const std::string& ip, const D
 
 base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
+    // The last lookup is kept by the locator, a thread that finds it in use looks up with its own state
+    std::unique_lock lock {m_mutex, std::try_to_lock};
+    State local {};
+    auto& state = lock.owns_lock() ? m_state : local;
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // The pinned generation stays open while it is in use, even if the database is updated meanwhile
+    auto* database = pin(state);
+    if (database == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
-    if (base::isError(lookError))
-    {
-        return base::getError(lookError);
-    }
-
-    // Retrieve the entry data for the given path
-    auto eDataResp = getEData(path);
+    // Retrieve the entry data of the IP address for the given path
+    auto eDataResp = getEData(ip, path, *database, state);
     if (base::isError(eDataResp))
     {
         return base::getError(eDataResp);
@@ -384,33 +447,20 @@ base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotP
 
 base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
+    // The last lookup is kept by the locator, a thread that finds it in use looks up with its own state
+    std::unique_lock lock {m_mutex, std::try_to_lock};
+    State local {};
+    auto& state = lock.owns_lock() ? m_state : local;
 
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // The pinned generation stays open while it is in use, even if the database is updated meanwhile
+    auto* database = pin(state);
+    if (database == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
-    if (base::isError(lookError))
-    {
-        return base::getError(lookError);
-    }
-
-    // Retrieve the entry data for the given path
-    auto eDataResp = getEData(path);
+    // Retrieve the entry data of the IP address for the given path
+    auto eDataResp = getEData(ip, path, *database, state);
     if (base::isError(eDataResp))
     {
         return base::getError(eDataResp);
@@ -428,33 +478,20 @@ base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPat
 
 base::RespOrError<json::Json> Locator::getAsJson(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
+    // The last lookup is kept by the locator, a thread that finds it in use looks up with its own state
+    std::unique_lock lock {m_mutex, std::try_to_lock};
+    State local {};
+    auto& state = lock.owns_lock() ? m_state : local;
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // The pinned generation stays open while it is in use, even if the database is updated meanwhile
+    auto* database = pin(state);
+    if (database == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
-    if (base::isError(lookError))
-    {
-        return base::getError(lookError);
-    }
-
-    // Retrieve the entry data for the given path
-    auto eDataResp = getEData(path);
+    // Retrieve the entry data of the IP address for the given path
+    auto eDataResp = getEData(ip, path, *database, state);
     if (base::isError(eDataResp))
     {
         return base::getError(eDataResp);
@@ -3,37 +3,65 @@
 
 #include <geo/ilocator.hpp>
 
+#include <mutex>
+
 #include <maxminddb.h>
 
 namespace geo
 {
 
-class DbEntry; ///< Forward declaration
+class DbEntry;  ///< Forward declaration
+class Database; ///< Forward declaration
 
+/**
+ * @brief Locator of the IP addresses in a database
+ *
+ * The locator keeps the last lookup, so the fields of the same IP are read without searching again. It can be shared
+ * by several threads: the one that finds the state in use by another one looks up with a state of its own.
+ */
 class Locator final : public ILocator
 {
 private:
-    std::weak_ptr<DbEntry> m_weakDbEntry; ///< The weak pointer to the database entry.
+    /**
+     * @brief Pinned generation of the database and the last lookup made on it
+     */
+    struct State
+    {
+        std::shared_ptr<Database> database; ///< The pinned generation of the database, until it is retired.
+        std::string cachedIp;               ///< The cached IP address.
+        std::string cachedKey;              ///< Binary form of the cached IP, empty if it is not in the shared cache.
+        MMDB_lookup_result_s cachedResult;  ///< The cached lookup result, from the pinned generation.
+    };
 
-    std::string m_cachedIp;              ///< The cached IP address.
-    MMDB_lookup_result_s m_cachedResult; ///< The cached lookup result.
+    std::weak_ptr<DbEntry> m_weakDbEntry; ///< The weak pointer to the database entry.
+    State m_state;                        ///< State of the locator, kept between the lookups
+    std::mutex m_mutex;                   ///< Protects m_state, the locator can be shared by several threads
 
     /**
-     * @brief Retrieves the entry data for a given dot path.
+     * @brief Get the pinned generation of the database, pinning the current one if it was retired.
      *
-     * @param path The dot path to retrieve the entry data for.
-     * @return A base::RespOrError object containing the entry data or an error message.
+     * The lookups only check the retired flag of the pinned generation, the entry is only accessed again when the
+     * database is updated or removed.
+     *
+     * @param state The state that keeps the pinned generation.
+     * @return Database* The database, null if it is not available anymore.
      */
-    base::RespOrError<MMDB_entry_data_s> getEData(const DotPath& path);
+    Database* pin(State& state);
 
     /**
-     * @brief Looks up the given IP address in the database if it is not already cached.
+     * @brief Retrieves the entry data of an IP address for a given dot path.
+     *
+     * The last IP is kept by the locator, the rest are looked up in the shared cache of the database before
+     * searching the database.
      *
      * @param ip The IP address to look up.
-     * @param dbEntry The database entry to use for the lookup.
-     * @return A base::OptError object containing an error message if the lookup failed.
+     * @param path The dot path to retrieve the entry data for.
+     * @param database The pinned database to use for the lookup.
+     * @param state The state that keeps the last IP.
+     * @return A base::RespOrError object containing the entry data or an error message.
      */
-    base::OptError lookup(const std::string& ip, const std::shared_ptr<DbEntry>& dbEntry);
+    base::RespOrError<MMDB_entry_data_s>
+    getEData(const std::string& ip, const DotPath& path, Database& database, State& state);
 
 public:
     virtual ~Locator() = default;
@@ -47,6 +75,7 @@ public:
      */
     Locator(const std::shared_ptr<DbEntry>& dbEntry)
         : m_weakDbEntry(dbEntry)
+        , m_state {}
     {
         if (m_weakDbEntry.expired())
         {
@@ -79,14 +108,14 @@ public:
      *
      * @return The cached IP address.
      */
-    inline const std::string& getCachedIp() const { return m_cachedIp; }
+    inline const std::string& getCachedIp() const { return m_state.cachedIp; }
 
     /**
      * @brief Retrieves the cached lookup result.
      *
      * @return The cached lookup result.
      */
-    inline const MMDB_lookup_result_s& getCachedResult() const { return m_cachedResult; }
+    inline const MMDB_lookup_result_s& getCachedResult() const { return m_state.cachedResult; }
 };
 
 } // namespace geo
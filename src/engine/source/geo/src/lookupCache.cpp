@@ -0,0 +1,167 @@
+#include "lookupCache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+
+namespace geo
+{
+
+LookupCache::LookupCache(std::size_t capacity, std::size_t shards)
+    : m_shards(std::max<std::size_t>(1, std::min(shards, capacity)))
+{
+    if (capacity == 0)
+    {
+        throw std::runtime_error("Geo lookup cache capacity must be greater than 0");
+    }
+
+    m_shardCapacity = (capacity + m_shards.size() - 1) / m_shards.size();
+}
+
+bool LookupCache::makeKey(const std::string& ip, std::string& key)
+{
+    unsigned char addr[sizeof(in6_addr)];
+    if (1 == inet_pton(AF_INET, ip.c_str(), addr))
+    {
+        key.assign(1, static_cast<char>(AF_INET));
+        key.append(reinterpret_cast<const char*>(addr), sizeof(in_addr));
+        return true;
+    }
+
+    if (1 == inet_pton(AF_INET6, ip.c_str(), addr))
+    {
+        key.assign(1, static_cast<char>(AF_INET6));
+        key.append(reinterpret_cast<const char*>(addr), sizeof(in6_addr));
+        return true;
+    }
+
+    return false;
+}
+
+LookupCache::Shard& LookupCache::shardFor(const std::string& key)
+{
+    return m_shards[std::hash<std::string> {}(key) % m_shards.size()];
+}
+
+bool LookupCache::get(const std::string& ipKey,
+                      const std::string& path,
+                      MMDB_lookup_result_s& result,
+                      std::optional<MMDB_entry_data_s>& value)
+{
+    auto& shard = shardFor(ipKey);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(ipKey);
+    if (it == shard.index.end())
+    {
+        return false;
+    }
+
+    auto entry = it->second;
+    shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+
+    result = entry->result;
+    value.reset();
+    for (const auto& [valuePath, data] : entry->values)
+    {
+        if (valuePath == path)
+        {
+            value = data;
+            break;
+        }
+    }
+
+    return true;
+}
+
+void LookupCache::putResult(const std::string& ipKey, const MMDB_lookup_result_s& result)
+{
+    auto& shard = shardFor(ipKey);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(ipKey);
+    if (it != shard.index.end())
+    {
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        return;
+    }
+
+    if (shard.entries.size() >= m_shardCapacity)
+    {
+        shard.index.erase(shard.entries.back().key);
+        shard.entries.pop_back();
+    }
+
+    shard.entries.push_front(Entry {ipKey, result, {}});
+    // The key of the index points to the string owned by the entry
+    shard.index.emplace(shard.entries.front().key, shard.entries.begin());
+}
+
+void LookupCache::putValue(const std::string& ipKey, const std::string& path, const MMDB_entry_data_s& value)
+{
+    auto& shard = shardFor(ipKey);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(ipKey);
+    if (it == shard.index.end())
+    {
+        return;
+    }
+
+    auto& values = it->second->values;
+    auto found = std::find_if(values.begin(), values.end(), [&path](const auto& pair) { return pair.first == path; });
+    if (found == values.end() && values.size() < MAX_VALUES)
+    {
+        values.emplace_back(path, value);
+    }
+}
+
+void LookupCache::clear()
+{
+    for (auto& shard : m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.index.clear();
+        shard.entries.clear();
+    }
+}
+
+std::size_t LookupCache::size() const
+{
+    std::size_t total = 0;
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.entries.size();
+    }
+
+    return total;
+}
+
+std::size_t LookupCache::bytes() const
+{
+    // List node and index node of each entry, besides the entry
+    constexpr auto ENTRY_OVERHEAD = 2 * sizeof(void*) + sizeof(std::pair<std::string_view, void*>) + sizeof(void*);
+
+    std::size_t total = 0;
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.index.bucket_count() * sizeof(void*);
+        for (const auto& entry : shard.entries)
+        {
+            total += sizeof(Entry) + ENTRY_OVERHEAD + entry.key.capacity();
+            total += entry.values.capacity() * sizeof(std::pair<std::string, MMDB_entry_data_s>);
+            for (const auto& [path, value] : entry.values)
+            {
+                total += path.capacity();
+            }
+        }
+    }
+
+    return total;
+}
+
+} // namespace geo
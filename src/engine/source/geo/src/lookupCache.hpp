@@ -0,0 +1,116 @@
+#ifndef _GEO_LOOKUPCACHE_HPP
+#define _GEO_LOOKUPCACHE_HPP
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maxminddb.h>
+
+namespace geo
+{
+
+/**
+ * @brief Lookup results of a database keyed by binary IP address, shared by all its locators.
+ *
+ * Split in shards with their own lock, each keeping its IPs in least recently used order. Besides the lookup result,
+ * each IP keeps the decoded values of the paths requested for it, so a repeated IP does not walk the database again.
+ * The values point into the database memory, the cache must be cleared before the database is closed.
+ */
+class LookupCache
+{
+public:
+    /**
+     * @brief Construct a new Lookup Cache
+     *
+     * @param capacity Maximum number of IPs, split between the shards.
+     * @param shards Number of shards.
+     */
+    explicit LookupCache(std::size_t capacity = DEFAULT_CAPACITY, std::size_t shards = DEFAULT_SHARDS);
+
+    /**
+     * @brief Get the cached lookup of an IP.
+     *
+     * @param ipKey Binary IP address, as returned by makeKey.
+     * @param path Path of the value to get.
+     * @param result Set to the lookup result if the IP is cached.
+     * @param value Set to the value of the path if it is cached.
+     * @return true if the IP is cached.
+     */
+    bool get(const std::string& ipKey,
+             const std::string& path,
+             MMDB_lookup_result_s& result,
+             std::optional<MMDB_entry_data_s>& value);
+
+    /**
+     * @brief Cache the lookup result of an IP.
+     *
+     */
+    void putResult(const std::string& ipKey, const MMDB_lookup_result_s& result);
+
+    /**
+     * @brief Cache the value of a path for a cached IP, ignored if the IP was evicted.
+     *
+     */
+    void putValue(const std::string& ipKey, const std::string& path, const MMDB_entry_data_s& value);
+
+    /**
+     * @brief Remove all the entries.
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Number of cached IPs.
+     *
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Estimate of the memory held by the cached IPs and values.
+     *
+     */
+    std::size_t bytes() const;
+
+    /**
+     * @brief Make the key of an IP address.
+     *
+     * @param ip IPv4 or IPv6 address in text form.
+     * @param key Set to the address family followed by the binary address.
+     * @return false if the text is not a valid address.
+     */
+    static bool makeKey(const std::string& ip, std::string& key);
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 8192;
+    static constexpr std::size_t DEFAULT_SHARDS = 16;
+    static constexpr std::size_t MAX_VALUES = 32; ///< Paths cached per IP
+
+private:
+    struct Entry
+    {
+        std::string key;
+        MMDB_lookup_result_s result;
+        std::vector<std::pair<std::string, MMDB_entry_data_s>> values;
+    };
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::list<Entry> entries; ///< Most recently used first
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+    };
+
+    Shard& shardFor(const std::string& key);
+
+    std::vector<Shard> m_shards;
+    std::size_t m_shardCapacity;
+};
+
+} // namespace geo
+
+#endif // _GEO_LOOKUPCACHE_HPP
@@ -61,7 +61,7 @@ Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store, const std:
     }
 }
 
-base::OptError Manager::upsertStoreEntry(const std::string& path)
+base::OptError Manager::upsertStoreEntry(const std::string& path, Type type)
 {
     std::filesystem::path dbPath(path);
 
@@ -83,7 +83,7 @@ base::OptError Manager::upsertStoreEntry(const std::string& path)
     auto doc = store::Doc();
     doc.setString(path, PATH_PATH);
     doc.setString(hash, HASH_PATH);
-    doc.setString(typeName(m_dbs.at(dbPath.filename().string())->type), TYPE_PATH);
+    doc.setString(typeName(type), TYPE_PATH);
 
     return m_store->upsertInternalDoc(internalName, doc);
 }
@@ -113,19 +113,18 @@ base::OptError Manager::addDbUnsafe(const std::string& path, Type type, bool ups
     }
 
     // Add the database
-    auto entry = std::make_shared<DbEntry>(path, type);
-    int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->mmdb.get());
-    if (MMDB_SUCCESS != status)
+    auto databaseResp = Database::open(path);
+    if (base::isError(databaseResp))
     {
-        return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+        return base::Error {fmt::format("Cannot add database '{}': {}", path, base::getError(databaseResp).message)};
     }
 
-    m_dbs.emplace(name, std::move(entry));
+    m_dbs.emplace(name, std::make_shared<DbEntry>(path, type, base::getResponse(databaseResp)));
     m_dbTypes.emplace(type, name);
 
     if (upsertStore)
     {
-        auto internalResp = upsertStoreEntry(path);
+        auto internalResp = upsertStoreEntry(path, type);
         if (base::isError(internalResp))
         {
             LOG_WARNING("Cannot update internal store for '{}': {}", path, base::getError(internalResp).message);
@@ -145,22 +144,9 @@ base::OptError Manager::removeDbUnsafe(const std::string& path)
         return base::Error {fmt::format("Database '{}' not found", name)};
     }
 
-    {
-        // We need to hold the entry so the lock is not released after the entry is removed
-        auto entry = m_dbs.at(name);
-
-        // Lock the database entry internal mutex for write
-        std::unique_lock<std::shared_mutex> lockEntry(entry->rwMutex);
-
-        // Remove the database
-        m_dbs.erase(name);
-
-        // Unlock the entry mutex
-        lockEntry.unlock();
-
-        // Freed the entry
-        entry.reset();
-    }
+    // Retire the database, it is closed when the locators using it release it
+    m_dbs.at(name)->publish(nullptr);
+    m_dbs.erase(name);
 
     // Remove the type from the map if it was the one in use
     for (auto it = m_dbTypes.begin(); it != m_dbTypes.end(); ++it)
@@ -232,13 +218,21 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
 {
     auto name = std::filesystem::path(path).filename().string();
 
-    // Hold write lock on the map
-    std::unique_lock lock(m_rwMapMutex);
+    // The download and the opening of the new database are done without the map lock, the lookups keep using the
+    // current database until the new one is published
+    std::lock_guard upsertLock(m_upsertMutex);
 
-    // If the type has a different database, fail
-    if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
+    bool exists;
     {
-        return base::Error {fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
+        std::shared_lock lock(m_rwMapMutex);
+
+        // If the type has a different database, fail
+        if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
+        {
+            return base::Error {
+                fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
+        }
+        exists = m_dbs.find(name) != m_dbs.end();
     }
 
     // Download the database hash
@@ -251,8 +245,7 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
     auto hash = base::getResponse(hashResp);
 
     // Check if it is already updated
-    auto entry = m_dbs.find(name);
-    if (entry != m_dbs.end())
+    if (exists)
     {
         auto internalResp =
             m_store->readInternalDoc(base::Name(fmt::format("{}{}{}", INTERNAL_NAME, base::Name::SEPARATOR_S, name)));
@@ -295,46 +288,58 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
         return error;
     }
 
-    // Write the database to the file
-    // If the database is already added, hold the internal mutex for write
-    if (entry != m_dbs.end())
+    // Write the database next to the current one and open it, the current file is still mapped by the lookups so it
+    // is replaced with a rename instead of being overwritten
+    auto tmpPath = path + TMP_SUFFIX;
+    std::error_code ec;
+    auto writeResp = writeDb(tmpPath, content);
+    if (base::isError(writeResp))
+    {
+        std::filesystem::remove(tmpPath, ec);
+        return base::getError(writeResp);
+    }
+
+    auto databaseResp = Database::open(tmpPath);
+    if (base::isError(databaseResp))
+    {
+        std::filesystem::remove(tmpPath, ec);
+        return base::Error {fmt::format("Cannot add database '{}': {}", path, base::getError(databaseResp).message)};
+    }
+
     {
-        std::unique_lock lockEntry(entry->second->rwMutex);
-        auto writeResp = writeDb(path, content);
-        if (base::isError(writeResp))
+        // Hold write lock on the map
+        std::unique_lock lock(m_rwMapMutex);
+
+        if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
         {
-            return base::getError(writeResp);
+            std::filesystem::remove(tmpPath, ec);
+            return base::Error {
+                fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
         }
 
-        // Close the MMDB and reopen it
-        MMDB_close(entry->second->mmdb.get());
-        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->second->mmdb.get());
-        if (MMDB_SUCCESS != status)
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec)
         {
-            // Remove the database
-            lockEntry.unlock();
-            removeDbUnsafe(path);
-
-            return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+            auto renameError = base::Error {fmt::format("Cannot replace database '{}': {}", path, ec.message())};
+            std::filesystem::remove(tmpPath, ec);
+            return renameError;
         }
-    }
-    else
-    {
-        auto writeResp = writeDb(path, content);
-        if (base::isError(writeResp))
+
+        // Publish the new generation, the locators pin it on their next lookup
+        auto entry = m_dbs.find(name);
+        if (entry != m_dbs.end())
         {
-            return base::getError(writeResp);
+            entry->second->publish(base::getResponse(databaseResp));
         }
-
-        auto addResp = addDbUnsafe(path, type, false);
-        if (base::isError(addResp))
+        else
         {
-            return base::getError(addResp);
+            m_dbs.emplace(name, std::make_shared<DbEntry>(path, type, base::getResponse(databaseResp)));
+            m_dbTypes.emplace(type, name);
         }
     }
 
     // Update the internal store
-    auto internalResp = upsertStoreEntry(path);
+    auto internalResp = upsertStoreEntry(path, type);
     if (base::isError(internalResp))
     {
         LOG_WARNING("Cannot update internal store for '{}': {}", path, base::getError(internalResp).message);
@@ -372,4 +377,54 @@ std::vector<DbInfo> Manager::listDbs() const
     return dbs;
 }
 
+std::size_t Manager::prewarm() const
+{
+    std::vector<std::shared_ptr<Database>> databases;
+    {
+        std::shared_lock lock(m_rwMapMutex);
+        for (const auto& [name, entry] : m_dbs)
+        {
+            if (auto database = entry->get())
+            {
+                databases.emplace_back(std::move(database));
+            }
+        }
+    }
+
+    // Without the lock, the databases are pinned
+    std::size_t bytes {0};
+    for (const auto& database : databases)
+    {
+        bytes += database->prefault();
+    }
+    return bytes;
+}
+
+std::size_t Manager::memoryUsage() const
+{
+    std::size_t bytes {0};
+    std::shared_lock lock(m_rwMapMutex);
+    for (const auto& [name, entry] : m_dbs)
+    {
+        if (auto database = entry->get())
+        {
+            bytes += static_cast<std::size_t>(database->mmdb.file_size) + database->cache.bytes();
+        }
+    }
+    return bytes;
+}
+
+void Manager::releaseMemory() const
+{
+    std::shared_lock lock(m_rwMapMutex);
+    for (const auto& [name, entry] : m_dbs)
+    {
+        // Pinned by the shared pointer, the cached values point into its mapping
+        if (auto database = entry->get())
+        {
+            database->cache.clear();
+        }
+    }
+}
+
 } // namespace geo
@@ -3,6 +3,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <thread>
 #include <base/json.hpp>
 
 #include <fmt/format.h>
@@ -226,6 +227,31 @@ TEST_F(LocatorTest, GetRemovedFromManagerDb)
     testAllGetBehavesEqual(g_ipFullData, false);
 }
 
+// Must success with the new database, the locator pins it on the next lookup
+TEST_F(LocatorTest, GetUpdatedDb)
+{
+    testAllGetBehavesEqual(g_ipFullData, true);
+    auto oldMmdb = locator->getCachedResult().entry.mmdb;
+
+    const auto& file = tmpFiles.front();
+    std::ifstream ifs(file, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    auto internalName =
+        base::Name(fmt::format("{}/{}", INTERNAL_NAME, std::filesystem::path(file).filename().string()));
+    json::Json docJson;
+    docJson.setString("old_hash", HASH_PATH);
+
+    EXPECT_CALL(*mockDownloader, downloadMD5("hashUrl")).WillOnce(testing::Return(std::string("hash")));
+    EXPECT_CALL(*mockStore, readInternalDoc(internalName)).WillOnce(testing::Return(storeReadDocResp(docJson)));
+    EXPECT_CALL(*mockDownloader, downloadHTTPS("dbUrl")).WillOnce(testing::Return(content));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillRepeatedly(testing::Return("hash"));
+    EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
+    ASSERT_FALSE(base::isError(manager->remoteUpsertDb(file, Type::CITY, "dbUrl", "hashUrl")));
+
+    testAllGetBehavesEqual(g_ipFullData, true);
+    ASSERT_NE(oldMmdb, locator->getCachedResult().entry.mmdb);
+}
+
 TEST_F(LocatorTest, GetUpdatesCache)
 {
     // Initial state, empty cache
@@ -252,6 +278,59 @@ TEST_F(LocatorTest, GetUpdatesCache)
     ASSERT_EQ(locator->getCachedIp(), g_ipNotFound);
 }
 
+TEST_F(LocatorTest, InterleavedIpsUseSharedCache)
+{
+    auto other = std::dynamic_pointer_cast<Locator>(base::getResponse(manager->getLocator(Type::CITY)));
+    auto expected = locator->getString(g_ipFullData, "test_map.test_str1");
+    ASSERT_FALSE(base::isError(expected));
+
+    // Each IP change misses the locator's last IP, the values come from the cache shared by the locators
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto res = other->getString(g_ipFullData, "test_map.test_str1");
+        ASSERT_FALSE(base::isError(res));
+        ASSERT_EQ(base::getResponse(res), base::getResponse(expected));
+
+        ASSERT_TRUE(base::isError(other->getString(g_ipNotFound, "test_map.test_str1")));
+        ASSERT_TRUE(base::isError(locator->getString("1.2.3.256", "test_map.test_str1")));
+    }
+}
+
+TEST_F(LocatorTest, SharedByThreads)
+{
+    auto expected = locator->getString(g_ipFullData, "test_map.test_str1");
+    ASSERT_FALSE(base::isError(expected));
+
+    // Each thread alternates the IPs, so the last lookup of the locator keeps changing under the others
+    std::vector<std::thread> threads;
+    std::atomic<int> failures {0};
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (auto i = 0; i < 1000; ++i)
+                {
+                    auto res = locator->getString(g_ipFullData, "test_map.test_str1");
+                    if (base::isError(res) || base::getResponse(res) != base::getResponse(expected))
+                    {
+                        ++failures;
+                    }
+                    if (!base::isError(locator->getString(g_ipNotFound, "test_map.test_str1")))
+                    {
+                        ++failures;
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(failures.load(), 0);
+}
+
 /************************************************************
  * Test each get method use cases
  ************************************************************/
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "lookupCache.hpp"
+
+using namespace geo;
+
+namespace
+{
+MMDB_lookup_result_s makeResult(uint32_t offset)
+{
+    MMDB_lookup_result_s result {};
+    result.found_entry = true;
+    result.entry.offset = offset;
+    return result;
+}
+
+std::string key(const std::string& ip)
+{
+    std::string ipKey;
+    EXPECT_TRUE(LookupCache::makeKey(ip, ipKey));
+    return ipKey;
+}
+} // namespace
+
+TEST(LookupCacheTest, ZeroCapacity)
+{
+    ASSERT_THROW(LookupCache(0), std::runtime_error);
+}
+
+TEST(LookupCacheTest, MakeKey)
+{
+    std::string ipKey;
+    ASSERT_TRUE(LookupCache::makeKey("1.2.3.4", ipKey));
+    ASSERT_EQ(ipKey.size(), 5);
+    ASSERT_TRUE(LookupCache::makeKey("::1", ipKey));
+    ASSERT_EQ(ipKey.size(), 17);
+    ASSERT_NE(key("1.2.3.4"), key("::ffff:1.2.3.4"));
+    ASSERT_EQ(key("2001:db8::1"), key("2001:0db8:0000::0001"));
+
+    ASSERT_FALSE(LookupCache::makeKey("1.2.3.256", ipKey));
+    ASSERT_FALSE(LookupCache::makeKey("not an ip", ipKey));
+    ASSERT_FALSE(LookupCache::makeKey("", ipKey));
+}
+
+TEST(LookupCacheTest, MissAndHit)
+{
+    LookupCache cache(16);
+    MMDB_lookup_result_s result {};
+    std::optional<MMDB_entry_data_s> value;
+
+    ASSERT_FALSE(cache.get(key("1.2.3.4"), "city", result, value));
+
+    cache.putResult(key("1.2.3.4"), makeResult(10));
+    ASSERT_TRUE(cache.get(key("1.2.3.4"), "city", result, value));
+    ASSERT_EQ(result.entry.offset, 10);
+    ASSERT_FALSE(value);
+
+    MMDB_entry_data_s data {};
+    data.uint32 = 42;
+    cache.putValue(key("1.2.3.4"), "city", data);
+    ASSERT_TRUE(cache.get(key("1.2.3.4"), "city", result, value));
+    ASSERT_TRUE(value);
+    ASSERT_EQ(value->uint32, 42);
+
+    ASSERT_TRUE(cache.get(key("1.2.3.4"), "country", result, value));
+    ASSERT_FALSE(value);
+}
+
+TEST(LookupCacheTest, ValueOfEvictedIpIsIgnored)
+{
+    LookupCache cache(16);
+    cache.putValue(key("1.2.3.4"), "city", MMDB_entry_data_s {});
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(LookupCacheTest, EvictsLeastRecentlyUsed)
+{
+    LookupCache cache(2, 1);
+    MMDB_lookup_result_s result {};
+    std::optional<MMDB_entry_data_s> value;
+
+    cache.putResult(key("1.1.1.1"), makeResult(1));
+    cache.putResult(key("2.2.2.2"), makeResult(2));
+    ASSERT_TRUE(cache.get(key("1.1.1.1"), "", result, value));
+    cache.putResult(key("3.3.3.3"), makeResult(3));
+
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_TRUE(cache.get(key("1.1.1.1"), "", result, value));
+    ASSERT_FALSE(cache.get(key("2.2.2.2"), "", result, value));
+    ASSERT_TRUE(cache.get(key("3.3.3.3"), "", result, value));
+}
+
+TEST(LookupCacheTest, Clear)
+{
+    LookupCache cache(16);
+    cache.putResult(key("1.2.3.4"), makeResult(1));
+    cache.putResult(key("::1"), makeResult(2));
+    ASSERT_EQ(cache.size(), 2);
+
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(LookupCacheTest, Bytes)
+{
+    LookupCache cache(16);
+    const auto empty = cache.bytes();
+
+    cache.putResult(key("1.2.3.4"), makeResult(1));
+    const auto withResult = cache.bytes();
+    ASSERT_GT(withResult, empty);
+
+    MMDB_entry_data_s value {};
+    cache.putValue(key("1.2.3.4"), "country.iso_code", value);
+    ASSERT_GT(cache.bytes(), withResult);
+
+    cache.clear();
+    ASSERT_LT(cache.bytes(), withResult);
+}
+
+TEST(LookupCacheTest, ConcurrentAccess)
+{
+    LookupCache cache(64);
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&cache, t]()
+            {
+                MMDB_lookup_result_s result {};
+                std::optional<MMDB_entry_data_s> value;
+                for (auto i = 0; i < 1000; ++i)
+                {
+                    auto ipKey = key("10.0." + std::to_string(t) + "." + std::to_string(i % 200));
+                    if (!cache.get(ipKey, "asn", result, value))
+                    {
+                        cache.putResult(ipKey, makeResult(i));
+                        cache.putValue(ipKey, "asn", MMDB_entry_data_s {});
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_LE(cache.size(), 64);
+}
@@ -564,6 +564,37 @@ TEST_F(GeoManagerTest, RemoteUpsertDbErrorWriting)
     ASSERT_EQ(manager.listDbs().size(), 0);
 }
 
+TEST_F(GeoManagerTest, RemoteUpsertDbInvalidKeepsCurrent)
+{
+    auto dbFile = getTmpDb();
+    auto dbType = Type::ASN;
+    auto hash = "hash";
+    auto dbUrl = "dbUrl";
+    auto hashUrl = "hashUrl";
+    auto content = std::string("not a database");
+    auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
+    auto dbDoc = json::Json();
+    dbDoc.setString("old_hash", HASH_PATH);
+
+    auto manager = getManagerWithDb(dbFile, dbType);
+
+    EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
+    EXPECT_CALL(*mockStore, readInternalDoc(internalName)).WillOnce(testing::Return(storeReadDocResp(dbDoc)));
+    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
+        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
+
+    base::OptError error;
+    ASSERT_NO_THROW(error = manager.remoteUpsertDb(dbFile, dbType, dbUrl, hashUrl));
+    ASSERT_TRUE(base::isError(error));
+    ASSERT_FALSE(std::filesystem::exists(dbFile + TMP_SUFFIX));
+    ASSERT_EQ(manager.listDbs().size(), 1);
+
+    auto locatorResp = manager.getLocator(dbType);
+    ASSERT_FALSE(base::isError(locatorResp));
+    ASSERT_FALSE(base::isError(base::getResponse(locatorResp)->getUint32("1.2.3.4", "test_uint32")));
+}
+
 TEST_F(GeoManagerTest, RemoteUpsertDbFailInternalStore)
 {
     auto manager = getEmptyManager();
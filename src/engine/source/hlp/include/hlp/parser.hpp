@@ -56,26 +56,14 @@ using Result = abs::Result<ResultT>;
 using Parser = abs::Parser<ResultT>;
 
 /**
- * @brief Runs three steps of parsing: syntax, semantic and mapping. Returns an error if any of the steps fails at any
- * point.
+ * @brief Runs the semantic parsers of a successful syntax result, collecting the mappers in order.
  *
- * @param parser Parser to run
- * @param text Text to parse
- * @param event Event to map to
- * @return std::optional<base::Error>
+ * @param synRes Syntax result
+ * @param mappers Output mappers
+ * @return std::optional<base::Error> Error of the first semantic parser that failed
  */
-inline std::optional<base::Error> run(const Parser& parser, std::string_view text, json::Json& event)
+inline std::optional<base::Error> collectMappers(const Result& synRes, std::vector<Mapper>& mappers)
 {
-    // Syntax parsing
-    auto synRes = parser(text);
-    if (synRes.failure())
-    {
-        const auto error = fmt::format("Parser {} failed at: {}", synRes.trace(), synRes.remaining());
-        return base::Error {error};
-    }
-
-    // Semantinc parsing
-    std::vector<Mapper> mappers;
     auto semVisitor = [&mappers](const Result& result, auto& recurRef) -> std::optional<base::Error>
     {
         if (result.hasValue())
@@ -101,7 +89,31 @@ inline std::optional<base::Error> run(const Parser& parser, std::string_view tex
         return std::nullopt;
     };
 
-    auto error = semVisitor(synRes, semVisitor);
+    return semVisitor(synRes, semVisitor);
+}
+
+/**
+ * @brief Runs three steps of parsing: syntax, semantic and mapping. Returns an error if any of the steps fails at any
+ * point.
+ *
+ * @param parser Parser to run
+ * @param text Text to parse
+ * @param event Event to map to
+ * @return std::optional<base::Error>
+ */
+inline std::optional<base::Error> run(const Parser& parser, std::string_view text, json::Json& event)
+{
+    // Syntax parsing
+    auto synRes = parser(text);
+    if (synRes.failure())
+    {
+        const auto error = fmt::format("Parser {} failed at: {}", synRes.trace(), synRes.remaining());
+        return base::Error {error};
+    }
+
+    // Semantinc parsing
+    std::vector<Mapper> mappers;
+    auto error = collectMappers(synRes, mappers);
     if (error)
     {
         return std::move(error);
@@ -116,6 +128,75 @@ inline std::optional<base::Error> run(const Parser& parser, std::string_view tex
     return std::nullopt;
 }
 
+/**
+ * @brief Runs alternatives that share a prefix, the prefix is parsed once and each suffix is tried in order from where
+ * the prefix ended. Only the first alternative that passes the syntax and semantic steps is mapped.
+ *
+ * The result is the same as running the concatenation of the prefix and each suffix in order until one succeeds.
+ *
+ * @param prefix Parser of the prefix, if empty the suffixes start at the beginning of the text
+ * @param suffixes Parser of the rest of each alternative
+ * @param text Text to parse
+ * @param event Event to map to
+ * @return std::variant<size_t, base::Error> Index of the alternative mapped, or the error of the last one tried
+ */
+inline std::variant<size_t, base::Error> runAlternatives(const Parser& prefix,
+                                                         const std::vector<Parser>& suffixes,
+                                                         std::string_view text,
+                                                         json::Json& event)
+{
+    std::vector<Mapper> prefixMappers;
+    auto remaining = text;
+    if (prefix)
+    {
+        auto prefixRes = prefix(text);
+        if (prefixRes.failure())
+        {
+            return base::Error {fmt::format("Parser {} failed at: {}", prefixRes.trace(), prefixRes.remaining())};
+        }
+
+        // The semantic of the prefix is the same for all the alternatives
+        auto error = collectMappers(prefixRes, prefixMappers);
+        if (error)
+        {
+            return std::move(error.value());
+        }
+        remaining = prefixRes.remaining();
+    }
+
+    base::Error lastError {"No alternatives to parse"};
+    for (size_t i = 0; i < suffixes.size(); ++i)
+    {
+        auto synRes = suffixes[i](remaining);
+        if (synRes.failure())
+        {
+            lastError = base::Error {fmt::format("Parser {} failed at: {}", synRes.trace(), synRes.remaining())};
+            continue;
+        }
+
+        std::vector<Mapper> mappers;
+        auto error = collectMappers(synRes, mappers);
+        if (error)
+        {
+            lastError = std::move(error.value());
+            continue;
+        }
+
+        for (const auto& mapper : prefixMappers)
+        {
+            mapper(event);
+        }
+        for (const auto& mapper : mappers)
+        {
+            mapper(event);
+        }
+
+        return i;
+    }
+
+    return lastError;
+}
+
 /**
  * @brief Combinators used by HLP.
  *
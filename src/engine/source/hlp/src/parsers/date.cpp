@@ -1,8 +1,15 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <chrono>
+#include <limits>
 #include <locale>
+#include <optional>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <curl/curl.h>
@@ -10,6 +17,7 @@
 #include <date/tz.h>
 
 #include <base/logging.hpp>
+#include <base/utils/timeUtils.hpp>
 
 #include "hlp.hpp"
 #include "syntax.hpp"
@@ -28,6 +36,46 @@ Mapper getMapper(std::string&& parsed, std::string_view targetField)
     };
 }
 
+/**
+ * @brief Get the time zone of an abbreviation, the zones are cached per thread as looking them up in the database is
+ * expensive.
+ *
+ * @param abbrev Time zone name or abbreviation
+ * @return const date::time_zone* Time zone
+ * @throw std::runtime_error if the time zone is not found
+ */
+const date::time_zone* locateZone(const std::string& abbrev)
+{
+    thread_local std::unordered_map<std::string, const date::time_zone*> zones {};
+
+    auto it = zones.find(abbrev);
+    if (it != zones.end())
+    {
+        return it->second;
+    }
+
+    auto zone = date::locate_zone(abbrev);
+    zones.emplace(abbrev, zone);
+    return zone;
+}
+
+/**
+ * @brief Format a time as strict_date_optional_time with milliseconds, without going through a stream.
+ *
+ * @param sinceEpoch Time since epoch
+ * @return std::optional<std::string> Formatted time, or empty if the year is out of the four digits range
+ */
+std::optional<std::string> formatTime(std::chrono::milliseconds sinceEpoch)
+{
+    std::string formatted;
+    if (!base::utils::time::formatMillis(sinceEpoch.count(), formatted))
+    {
+        return std::nullopt;
+    }
+
+    return formatted;
+}
+
 SemParser getSemParser(std::string_view targetField,
                        date::fields<std::chrono::nanoseconds> fds,
                        std::string&& abbrev,
@@ -42,49 +90,59 @@ SemParser getSemParser(std::string_view targetField,
         date::year_month_day ymd = fds.ymd;
         if (!fds.ymd.year().ok())
         {
-            auto now = date::floor<date::days>(std::chrono::system_clock::now());
+            auto now = date::sys_days {date::days {base::utils::time::epochSeconds() / 86400}};
             auto ny = date::year_month_day {now}.year();
             ymd = ny / fds.ymd.month() / fds.ymd.day();
         }
 
         auto tp = date::sys_days(ymd) + fds.tod.to_duration();
 
-        // Format to strict_date_optional_time
-        std::ostringstream out {};
-        out.imbue(std::locale("en_US.UTF-8"));
-
         // If we have timezone information, transform it to UTC
         // else, assume we have UTC.
         //
         // If there is no timezone, we substract the offset to UTC
         // as default offset is 0
+        auto tms = date::floor<std::chrono::milliseconds>(tp);
+        std::optional<std::string> formatted {};
+        const date::time_zone* zone = nullptr;
+        if (!abbrev.empty())
         {
-            auto tms = date::floor<std::chrono::milliseconds>(tp);
-            if (!abbrev.empty())
+            try
             {
-                // TODO: evaluate this function as it can be expensive
-                // we might consider restrict the abbrev supported
-                try
-                {
-                    auto tz = date::make_zoned(abbrev, tms);
-                    date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tz);
-                }
-                catch (std::exception& e)
-                {
-                    return base::Error {fmt::format("{} failed to set timezone: {}", name, e.what())};
-                }
+                zone = locateZone(abbrev);
+            }
+            catch (std::exception& e)
+            {
+                return base::Error {fmt::format("{} failed to set timezone: {}", name, e.what())};
+            }
+            formatted = formatTime(zone->to_local(tms).time_since_epoch());
+        }
+        else
+        {
+            formatted = formatTime((tms - offset).time_since_epoch());
+        }
+
+        // Format to strict_date_optional_time
+        if (!formatted)
+        {
+            std::ostringstream out {};
+            out.imbue(std::locale("en_US.UTF-8"));
+            if (zone != nullptr)
+            {
+                date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", date::make_zoned(zone, tms));
             }
             else
             {
                 date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tms - offset);
             }
+            formatted = out.str();
         }
 
         if (targetField.empty())
         {
             return noMapper();
         }
-        return getMapper(out.str(), targetField);
+        return getMapper(std::move(formatted.value()), targetField);
     };
 }
 
@@ -156,6 +214,342 @@ std::string formatDateFromSample(const std::string& dateSample, const std::strin
     // Return the matching format
     return matchingFormats[0];
 }
+
+/**
+ * @brief Step of a compiled date layout
+ */
+enum class Step
+{
+    YEAR,         ///< %Y, four digits
+    MONTH,        ///< %m
+    MONTH_NAME,   ///< %b or %h, english abbreviated name
+    DAY,          ///< %d
+    HOUR,         ///< %H
+    MINUTE,       ///< %M
+    SECOND,       ///< %S, with optional fraction
+    OFFSET,       ///< %z, +hhmm
+    OFFSET_COLON, ///< %Ez or %Oz, +hh:mm
+    SPACE,        ///< Whitespace
+    LITERAL       ///< Any other character
+};
+
+struct LayoutStep
+{
+    Step step;
+    char literal;
+};
+
+using Layout = std::vector<LayoutStep>;
+
+// Expansion of %F and %T
+const Layout DATE_STEPS {{Step::YEAR, 0}, {Step::LITERAL, '-'}, {Step::MONTH, 0}, {Step::LITERAL, '-'}, {Step::DAY, 0}};
+const Layout TIME_STEPS {
+    {Step::HOUR, 0}, {Step::LITERAL, ':'}, {Step::MINUTE, 0}, {Step::LITERAL, ':'}, {Step::SECOND, 0}};
+
+/**
+ * @brief Compile a date format into fixed steps, so the common formats are parsed without the date library.
+ *
+ * Only formats with numeric fields, abbreviated month names and numeric offsets can be compiled.
+ *
+ * @param format Date format
+ * @return std::optional<Layout> Compiled layout, or empty if the format is not supported
+ */
+std::optional<Layout> compileLayout(std::string_view format)
+{
+    Layout layout {};
+    bool hasMonth = false;
+    bool hasDay = false;
+    for (size_t i = 0; i < format.size(); ++i)
+    {
+        const auto c = format[i];
+        if (c != '%')
+        {
+            layout.push_back({std::isspace(static_cast<unsigned char>(c)) ? Step::SPACE : Step::LITERAL, c});
+            continue;
+        }
+
+        if (++i == format.size())
+        {
+            return std::nullopt;
+        }
+
+        switch (format[i])
+        {
+            case 'Y': layout.push_back({Step::YEAR, 0}); break;
+            case 'm':
+                layout.push_back({Step::MONTH, 0});
+                hasMonth = true;
+                break;
+            case 'b':
+            case 'h':
+                layout.push_back({Step::MONTH_NAME, 0});
+                hasMonth = true;
+                break;
+            case 'd':
+                layout.push_back({Step::DAY, 0});
+                hasDay = true;
+                break;
+            case 'H': layout.push_back({Step::HOUR, 0}); break;
+            case 'M': layout.push_back({Step::MINUTE, 0}); break;
+            case 'S': layout.push_back({Step::SECOND, 0}); break;
+            case 'F':
+                layout.insert(layout.end(), DATE_STEPS.begin(), DATE_STEPS.end());
+                hasMonth = hasDay = true;
+                break;
+            case 'T':
+                layout.insert(layout.end(), TIME_STEPS.begin(), TIME_STEPS.end());
+                break;
+            case 'R': layout.insert(layout.end(), {{Step::HOUR, 0}, {Step::LITERAL, ':'}, {Step::MINUTE, 0}}); break;
+            case 'z': layout.push_back({Step::OFFSET, 0}); break;
+            case 'E':
+            case 'O':
+                if (i + 1 == format.size() || format[i + 1] != 'z')
+                {
+                    return std::nullopt;
+                }
+                ++i;
+                layout.push_back({Step::OFFSET_COLON, 0});
+                break;
+            case '%': layout.push_back({Step::LITERAL, '%'}); break;
+            default: return std::nullopt;
+        }
+    }
+
+    if (!hasMonth || !hasDay)
+    {
+        return std::nullopt;
+    }
+
+    return layout;
+}
+
+/**
+ * @brief Read between one and maxDigits digits.
+ *
+ * @return size_t Number of digits read, 0 if there is no digit at pos
+ */
+size_t readDigits(std::string_view text, size_t& pos, size_t maxDigits, unsigned& value)
+{
+    size_t count = 0;
+    value = 0;
+    while (count < maxDigits && pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos])))
+    {
+        value = value * 10 + static_cast<unsigned>(text[pos] - '0');
+        ++pos;
+        ++count;
+    }
+
+    return count;
+}
+
+bool isDigitAt(std::string_view text, size_t pos)
+{
+    return pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]));
+}
+
+/**
+ * @brief Parse a text with a compiled layout.
+ *
+ * Only accepts the texts the date library would parse to the same fields. Anything doubtful, as optional
+ * whitespace, signed numbers, full month names or out of range values, returns false so the caller falls back to the
+ * date library, which keeps the behavior and error reporting of the general parser.
+ *
+ * @param layout Compiled layout
+ * @param text Text to parse
+ * @param fds Parsed fields
+ * @param offset Parsed offset to UTC
+ * @param pos Position after the date
+ * @return true if the text was parsed
+ */
+bool parseLayout(const Layout& layout,
+                 std::string_view text,
+                 date::fields<std::chrono::nanoseconds>& fds,
+                 std::chrono::minutes& offset,
+                 size_t& pos)
+{
+    static constexpr std::array<std::string_view, 12> MONTHS {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+    std::optional<unsigned> year {};
+    unsigned month = 0;
+    unsigned day = 0;
+    unsigned hour = 0;
+    unsigned minute = 0;
+    unsigned second = 0;
+    std::chrono::nanoseconds fraction {0};
+    bool hasTod = false;
+
+    pos = 0;
+    for (const auto& step : layout)
+    {
+        switch (step.step)
+        {
+            case Step::YEAR:
+            {
+                unsigned value = 0;
+                if (readDigits(text, pos, 4, value) != 4)
+                {
+                    return false;
+                }
+                year = value;
+                break;
+            }
+            case Step::MONTH:
+                if (readDigits(text, pos, 2, month) == 0)
+                {
+                    return false;
+                }
+                break;
+            case Step::MONTH_NAME:
+            {
+                auto name = text.substr(pos, 3);
+                auto it = std::find(MONTHS.begin(), MONTHS.end(), name);
+                // A longer word could be a full month name
+                if (it == MONTHS.end()
+                    || (pos + 3 < text.size() && std::isalpha(static_cast<unsigned char>(text[pos + 3]))))
+                {
+                    return false;
+                }
+                month = static_cast<unsigned>(it - MONTHS.begin()) + 1;
+                pos += 3;
+                break;
+            }
+            case Step::DAY:
+                if (readDigits(text, pos, 2, day) == 0)
+                {
+                    return false;
+                }
+                break;
+            case Step::HOUR:
+                if (readDigits(text, pos, 2, hour) == 0 || hour > 23)
+                {
+                    return false;
+                }
+                hasTod = true;
+                break;
+            case Step::MINUTE:
+                if (readDigits(text, pos, 2, minute) == 0 || minute > 59)
+                {
+                    return false;
+                }
+                hasTod = true;
+                break;
+            case Step::SECOND:
+            {
+                // The date library reads the seconds as a decimal number of up to 12 characters
+                if (readDigits(text, pos, 2, second) != 2 || second > 59 || isDigitAt(text, pos))
+                {
+                    return false;
+                }
+                if (pos < text.size() && text[pos] == '.')
+                {
+                    ++pos;
+                    unsigned value = 0;
+                    auto digits = readDigits(text, pos, 9, value);
+                    if (digits == 0 || isDigitAt(text, pos))
+                    {
+                        return false;
+                    }
+                    for (; digits < 9; ++digits)
+                    {
+                        value *= 10;
+                    }
+                    fraction = std::chrono::nanoseconds {value};
+                }
+                else if (pos < text.size() && text[pos] == ',')
+                {
+                    return false;
+                }
+                hasTod = true;
+                break;
+            }
+            case Step::OFFSET:
+            case Step::OFFSET_COLON:
+            {
+                if (pos >= text.size() || (text[pos] != '+' && text[pos] != '-'))
+                {
+                    return false;
+                }
+                const auto negative = text[pos++] == '-';
+
+                unsigned hours = 0;
+                unsigned minutes = 0;
+                if (readDigits(text, pos, 2, hours) != 2)
+                {
+                    return false;
+                }
+                if (step.step == Step::OFFSET_COLON)
+                {
+                    if (pos >= text.size() || text[pos] != ':')
+                    {
+                        return false;
+                    }
+                    ++pos;
+                }
+                if (readDigits(text, pos, 2, minutes) != 2 || hours > 23 || minutes > 59 || isDigitAt(text, pos)
+                    || (pos < text.size() && text[pos] == ':'))
+                {
+                    return false;
+                }
+
+                const auto value = std::chrono::minutes {hours * 60 + minutes};
+                offset = negative ? -value : value;
+                break;
+            }
+            case Step::SPACE:
+                if (pos >= text.size() || text[pos] != ' ')
+                {
+                    return false;
+                }
+                while (pos < text.size() && text[pos] == ' ')
+                {
+                    ++pos;
+                }
+                if (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+                {
+                    return false;
+                }
+                break;
+            case Step::LITERAL:
+                if (pos >= text.size() || text[pos] != step.literal)
+                {
+                    return false;
+                }
+                ++pos;
+                break;
+        }
+    }
+
+    if (month < 1 || month > 12 || day < 1)
+    {
+        return false;
+    }
+
+    if (year)
+    {
+        fds.ymd = date::year {static_cast<int>(year.value())} / date::month {month} / date::day {day};
+        if (!fds.ymd.ok())
+        {
+            return false;
+        }
+    }
+    else
+    {
+        // Without year only the days valid in any year are taken for sure
+        const auto ymd = date::year {2001} / date::month {month} / date::day {day};
+        if (!ymd.ok())
+        {
+            return false;
+        }
+        fds.ymd = date::year {std::numeric_limits<short>::min()} / date::month {month} / date::day {day};
+    }
+
+    fds.tod = date::hh_mm_ss<std::chrono::nanoseconds> {std::chrono::hours {hour} + std::chrono::minutes {minute}
+                                                        + std::chrono::seconds {second} + fraction};
+    fds.has_tod = hasTod;
+
+    return true;
+}
 } // namespace
 
 namespace hlp
@@ -271,8 +665,28 @@ Parser getDateParser(const Params& params)
 
     const auto target = params.targetField.empty() ? std::string {} : params.targetField;
 
-    return [format, locale, name = params.name, target](std::string_view text)
+    // The compiled layouts only know the english month names
+    std::optional<Layout> layout {};
+    if (localeStr == "en_US.UTF-8" || localeStr == "C")
     {
+        layout = compileLayout(format);
+    }
+
+    return [format, locale, name = params.name, target, layout](std::string_view text)
+    {
+        if (layout)
+        {
+            date::fields<std::chrono::nanoseconds> fds {};
+            std::chrono::minutes offset {0};
+            size_t pos = 0;
+            if (parseLayout(layout.value(), text, fds, offset, pos))
+            {
+                return abs::makeSuccess(
+                    SemToken {text.substr(0, pos), getSemParser(target, fds, std::string {}, name, offset)},
+                    text.substr(pos));
+            }
+        }
+
         auto ss = std::istringstream(std::string(text));
         ss.imbue(locale);
 
@@ -29,8 +29,9 @@ SemParser getSemParser(const std::string& targetField)
         struct in_addr ip;
         struct in6_addr ip6;
 
-        if (!inet_pton(AF_INET, std::string(parsed).c_str(), &ip)
-            && !inet_pton(AF_INET6, std::string(parsed).c_str(), &ip6))
+        // Copied once, the syntax parser already limits its size
+        const std::string address(parsed);
+        if (!inet_pton(AF_INET, address.c_str(), &ip) && !inet_pton(AF_INET6, address.c_str(), &ip6))
         {
             return base::Error {"Invalid IPv4 or IPv6 address"};
         }
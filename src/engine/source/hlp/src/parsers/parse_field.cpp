@@ -1,6 +1,7 @@
 #include "parse_field.hpp"
 #include "fmt/format.h"
 #include "number.hpp"
+#include "scan.hpp"
 #include <iostream>
 #include <base/json.hpp>
 #include <string_view>
@@ -25,7 +26,9 @@ std::optional<Field> getField(std::string_view input,
     bool isEscaped = false;
     bool isQuoted = false;
 
-    for (auto i = 0ul; i < input.size(); i++)
+    // Only the delimiter, quote and escape characters change the state, the rest of the field is skipped
+    for (auto i = scan::findFirstOf(input, 0, delimiter, quote, escape); i != std::string_view::npos;
+         i = scan::findFirstOf(input, i + 1, delimiter, quote, escape))
     {
         if (input[i] == delimiter && !quote_opened)
         {
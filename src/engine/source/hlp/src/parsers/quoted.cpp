@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -47,34 +48,44 @@ syntax::Parser getSynParser(char quote, char escape)
 
         bool checkEscape = false;
         bool closed = false;
-        auto it = input.begin() + 1;
-        for (; it < input.end(); ++it)
+        std::size_t pos = 1;
+        while (pos < input.size())
         {
+            // The character after an escape is checked as is, otherwise skip to the next quote or escape
+            if (!checkEscape)
+            {
+                pos = scan::findFirstOf(input, pos, quote, escape, escape);
+                if (pos == std::string_view::npos)
+                {
+                    break;
+                }
+            }
+
+            const auto ch = input[pos];
             if (checkEscape)
             {
-                if (*it != quote && *it != escape)
+                if (ch != quote && ch != escape)
                 {
                     return abs::makeFailure<syntax::ResultT>(input, {});
                 }
                 checkEscape = false;
-                continue;
             }
-            else if (*it == escape)
+            else if (ch == escape)
             {
                 checkEscape = true;
-                continue;
             }
-            else if (*it == quote)
+            else
             {
-                ++it;
                 closed = true;
+                ++pos;
                 break;
             }
+            ++pos;
         }
 
         if (closed)
         {
-            return abs::makeSuccess<syntax::ResultT>(input.substr(it - input.begin()));
+            return abs::makeSuccess<syntax::ResultT>(input.substr(pos));
         }
         else
         {
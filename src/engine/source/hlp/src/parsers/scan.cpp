@@ -0,0 +1,143 @@
+#include "scan.hpp"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#include <immintrin.h>
+#define HLP_SCAN_X86 1
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HLP_SCAN_NEON 1
+#endif
+
+namespace
+{
+using Kernel = const char* (*)(const char*, const char*, char, char, char);
+
+const char* scalarFind(const char* begin, const char* end, char a, char b, char c)
+{
+    for (; begin < end; ++begin)
+    {
+        const auto ch = *begin;
+        if (ch == a || ch == b || ch == c)
+        {
+            return begin;
+        }
+    }
+
+    return end;
+}
+
+#if defined(HLP_SCAN_X86)
+const char* sse2Find(const char* begin, const char* end, char a, char b, char c)
+{
+    const auto va = _mm_set1_epi8(a);
+    const auto vb = _mm_set1_epi8(b);
+    const auto vc = _mm_set1_epi8(c);
+
+    for (; end - begin >= 16; begin += 16)
+    {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        const auto eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, va), _mm_cmpeq_epi8(block, vb)),
+                                     _mm_cmpeq_epi8(block, vc));
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(eq));
+        if (mask != 0)
+        {
+            return begin + __builtin_ctz(mask);
+        }
+    }
+
+    return scalarFind(begin, end, a, b, c);
+}
+
+__attribute__((target("avx2"))) const char* avx2Find(const char* begin, const char* end, char a, char b, char c)
+{
+    const auto va = _mm256_set1_epi8(a);
+    const auto vb = _mm256_set1_epi8(b);
+    const auto vc = _mm256_set1_epi8(c);
+
+    for (; end - begin >= 32; begin += 32)
+    {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+        const auto eq = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, va), _mm256_cmpeq_epi8(block, vb)),
+                                        _mm256_cmpeq_epi8(block, vc));
+        const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+        if (mask != 0)
+        {
+            return begin + __builtin_ctz(mask);
+        }
+    }
+
+    return sse2Find(begin, end, a, b, c);
+}
+#endif
+
+#if defined(HLP_SCAN_NEON)
+const char* neonFind(const char* begin, const char* end, char a, char b, char c)
+{
+    const auto va = vdupq_n_u8(static_cast<uint8_t>(a));
+    const auto vb = vdupq_n_u8(static_cast<uint8_t>(b));
+    const auto vc = vdupq_n_u8(static_cast<uint8_t>(c));
+
+    for (; end - begin >= 16; begin += 16)
+    {
+        const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(begin));
+        const auto eq = vorrq_u8(vorrq_u8(vceqq_u8(block, va), vceqq_u8(block, vb)), vceqq_u8(block, vc));
+
+        // Narrow each byte of the comparison to 4 bits, so the mask fits in 64 bits
+        const auto nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+        const auto mask = vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+        if (mask != 0)
+        {
+            return begin + (__builtin_ctzll(mask) >> 2);
+        }
+    }
+
+    return scalarFind(begin, end, a, b, c);
+}
+#endif
+
+struct Selected
+{
+    Kernel kernel;
+    const char* name;
+};
+
+Selected selectKernel()
+{
+#if defined(HLP_SCAN_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return {avx2Find, "avx2"};
+    }
+    return {sse2Find, "sse2"};
+#elif defined(HLP_SCAN_NEON)
+    return {neonFind, "neon"};
+#else
+    return {scalarFind, "scalar"};
+#endif
+}
+
+const Selected& selected()
+{
+    static const Selected kernel = selectKernel();
+    return kernel;
+}
+} // namespace
+
+namespace hlp::scan
+{
+
+const char* firstOf(const char* begin, const char* end, char a, char b, char c)
+{
+    return selected().kernel(begin, end, a, b, c);
+}
+
+const char* kernelName()
+{
+    return selected().name;
+}
+
+} // namespace hlp::scan
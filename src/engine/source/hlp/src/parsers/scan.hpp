@@ -0,0 +1,54 @@
+#ifndef _HLP_SCAN_HPP
+#define _HLP_SCAN_HPP
+
+#include <cstddef>
+#include <string_view>
+
+namespace hlp::scan
+{
+
+/**
+ * @brief Find the first occurrence of any of three characters.
+ *
+ * Uses AVX2 or SSE2 on x86 and NEON on ARM, the best one supported by the CPU is chosen at startup. Repeat a
+ * character to look for less than three.
+ *
+ * @param begin Start of the text
+ * @param end End of the text
+ * @param a First character
+ * @param b Second character
+ * @param c Third character
+ * @return const char* First occurrence, or end if none is found
+ */
+const char* firstOf(const char* begin, const char* end, char a, char b, char c);
+
+/**
+ * @brief Find the first occurrence of any of three characters from a position.
+ *
+ * @param text Text to scan
+ * @param pos Position to start from
+ * @param a First character
+ * @param b Second character
+ * @param c Third character
+ * @return std::size_t Position of the first occurrence, or std::string_view::npos if none is found
+ */
+inline std::size_t findFirstOf(std::string_view text, std::size_t pos, char a, char b, char c)
+{
+    if (pos >= text.size())
+    {
+        return std::string_view::npos;
+    }
+
+    const auto end = text.data() + text.size();
+    const auto found = firstOf(text.data() + pos, end, a, b, c);
+    return found == end ? std::string_view::npos : static_cast<std::size_t>(found - text.data());
+}
+
+/**
+ * @brief Name of the kernel in use, for debugging and tests.
+ */
+const char* kernelName();
+
+} // namespace hlp::scan
+
+#endif // _HLP_SCAN_HPP
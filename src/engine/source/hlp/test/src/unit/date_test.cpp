@@ -384,4 +384,35 @@ INSTANTIATE_TEST_SUITE_P(
                j(fmt::format(R"({{"{}": "2021-02-14T10:45:33.000Z"}})", TARGET.substr(1))),
                strlen("2021-02-14 10:45:33 UTC"),
                initAndGetDateParser(),
-               {NAME, TARGET, {}, {"POSTGRES"}})));
+               {NAME, TARGET, {}, {"POSTGRES"}}),
+        // Compiled layouts, and the texts they leave to the date library
+        ParseT(SUCCESS,
+               "Jun  4 15:16:01 host",
+               j(fmt::format(R"({{"{}": "{}-06-04T15:16:01.000Z"}})", TARGET.substr(1), BUILD_YEAR)),
+               15,
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"SYSLOG"}}),
+        ParseT(SUCCESS,
+               "Jun 14 15:16:01.25",
+               j(fmt::format(R"({{"{}": "{}-06-14T15:16:01.250Z"}})", TARGET.substr(1), BUILD_YEAR)),
+               18,
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"SYSLOG"}}),
+        ParseT(SUCCESS,
+               "June 14 15:16:01",
+               j(fmt::format(R"({{"{}": "{}-06-14T15:16:01.000Z"}})", TARGET.substr(1), BUILD_YEAR)),
+               16,
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"SYSLOG"}}),
+        ParseT(SUCCESS,
+               "26/Dec/2016:16:22:14 -0730 GET",
+               j(fmt::format(R"({{"{}": "2016-12-26T23:52:14.000Z"}})", TARGET.substr(1))),
+               strlen("26/Dec/2016:16:22:14 -0730"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"HTTPDATE"}}),
+        ParseT(SUCCESS,
+               "2018-08-14T14:30:02+05:30",
+               j(fmt::format(R"({{"{}": "2018-08-14T09:00:02.000Z"}})", TARGET.substr(1))),
+               strlen("2018-08-14T14:30:02+05:30"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"ISO8601"}})));
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "scan.hpp"
+
+using namespace hlp::scan;
+
+namespace
+{
+std::size_t scalarFirstOf(std::string_view text, std::size_t pos, char a, char b, char c)
+{
+    for (; pos < text.size(); ++pos)
+    {
+        if (text[pos] == a || text[pos] == b || text[pos] == c)
+        {
+            return pos;
+        }
+    }
+
+    return std::string_view::npos;
+}
+} // namespace
+
+TEST(HlpScanTest, Kernel)
+{
+    ASSERT_NE(kernelName(), nullptr);
+}
+
+TEST(HlpScanTest, Empty)
+{
+    ASSERT_EQ(findFirstOf("", 0, ',', '"', '\\'), std::string_view::npos);
+    ASSERT_EQ(findFirstOf("abc", 3, ',', '"', '\\'), std::string_view::npos);
+    ASSERT_EQ(findFirstOf("abc", 10, ',', '"', '\\'), std::string_view::npos);
+}
+
+TEST(HlpScanTest, NotFound)
+{
+    const std::string text(1000, 'a');
+    ASSERT_EQ(findFirstOf(text, 0, ',', '"', '\\'), std::string_view::npos);
+}
+
+// Every position in and around the vector blocks, for each of the characters
+TEST(HlpScanTest, AllPositions)
+{
+    for (auto size : {1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 200})
+    {
+        for (auto target : {',', '"', '\\'})
+        {
+            for (auto at = 0; at < size; ++at)
+            {
+                std::string text(size, 'x');
+                text[at] = target;
+                for (auto from : {0, at / 2, at})
+                {
+                    ASSERT_EQ(findFirstOf(text, from, ',', '"', '\\'), static_cast<std::size_t>(at))
+                        << "size " << size << " at " << at << " from " << from;
+                }
+                if (at + 1 < size)
+                {
+                    ASSERT_EQ(findFirstOf(text, at + 1, ',', '"', '\\'), std::string_view::npos);
+                }
+            }
+        }
+    }
+}
+
+TEST(HlpScanTest, MatchesScalar)
+{
+    std::string text;
+    for (auto i = 0; i < 4096; ++i)
+    {
+        text += static_cast<char>((i * 7919) % 251 + 1);
+    }
+
+    for (std::size_t pos = 0; pos < text.size(); pos += 13)
+    {
+        ASSERT_EQ(findFirstOf(text, pos, '=', ' ', '\xF0'), scalarFirstOf(text, pos, '=', ' ', '\xF0'));
+    }
+}
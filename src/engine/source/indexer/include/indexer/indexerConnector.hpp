@@ -0,0 +1,155 @@
+#ifndef _INDEXER_INDEXER_CONNECTOR_HPP
+#define _INDEXER_INDEXER_CONNECTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <concurrentqueue/blockingconcurrentqueue.h>
+
+#include <indexer/iindexerConnector.hpp>
+
+namespace rocksdb
+{
+class DB;
+}
+
+namespace indexer
+{
+
+/**
+ * @brief Indexer connector configuration
+ *
+ */
+struct Config
+{
+    std::vector<std::string> hosts; ///< Indexer URLs, as https://host:port
+    std::string username;           ///< Basic auth user, empty for no auth
+    std::string password;           ///< Basic auth password
+    std::string caFile;             ///< CA bundle to verify the indexer certificate, empty for the system one
+    std::size_t maxBatchBytes = 5 * 1024 * 1024; ///< A bulk is sent once it reaches this size
+    std::size_t flushIntervalMs = 200;           ///< or when its first document waited this long
+    std::size_t connections = 4;                 ///< Bulk requests in flight at the same time
+    std::size_t queueSize = 65536;               ///< Documents waiting in memory before spilling to disk
+    std::size_t timeoutMs = 30000;               ///< Timeout of each bulk request
+    bool compress = true;                        ///< Send the bulks gzip compressed
+    std::string bufferPath; ///< RocksDB directory for the documents that can not be sent, empty to disable it
+};
+
+/**
+ * @brief Sends the documents to the indexer with the bulk API.
+ *
+ * The documents are queued in memory and a batcher thread joins them in bulks, which are sent by one thread per
+ * connection. When the memory queue is full or a bulk can not be sent, the documents are stored in a RocksDB buffer
+ * and sent again once the indexer answers, so disk is only touched under backpressure. Without a buffer the callers
+ * wait for room and the bulks that fail are dropped.
+ */
+class IndexerConnector final : public IIndexerConnector
+{
+public:
+    /**
+     * @brief Sends a bulk request body, returns false if it was not accepted.
+     *
+     */
+    using Transport = std::function<bool(const std::string& body)>;
+
+    /**
+     * @brief Creates the transport of a connection, given its number.
+     *
+     */
+    using TransportFactory = std::function<Transport(std::size_t connection)>;
+
+    /**
+     * @brief Construct a connector that sends the bulks over HTTP
+     *
+     * @param config Connector configuration
+     * @throw std::runtime_error if the configuration is not valid or the buffer can not be opened
+     */
+    explicit IndexerConnector(const Config& config);
+
+    /**
+     * @brief Construct a connector with custom transports
+     *
+     * @param config Connector configuration, the hosts are not used
+     * @param transportFactory Transport factory, called once per connection
+     * @throw std::runtime_error if the configuration is not valid or the buffer can not be opened
+     */
+    IndexerConnector(const Config& config, TransportFactory transportFactory);
+
+    /**
+     * @brief Send the queued documents, those that fail are kept in the buffer.
+     *
+     */
+    ~IndexerConnector() override;
+
+    IndexerConnector(const IndexerConnector&) = delete;
+    IndexerConnector& operator=(const IndexerConnector&) = delete;
+
+    /**
+     * @copydoc IIndexerConnector::index
+     */
+    void index(std::string_view index, std::string_view document) override;
+
+    /**
+     * @brief Block until the documents in memory are sent or buffered.
+     *
+     */
+    void drain() const;
+
+    /**
+     * @brief Number of bulks stored in the disk buffer.
+     *
+     */
+    std::size_t buffered() const { return m_diskRecords.load(); }
+
+private:
+    struct Batch
+    {
+        std::string body;
+        std::size_t documents = 0; ///< Documents, or bulks for a batch read from disk
+        bool fromDisk = false;
+        uint64_t firstKey = 0; ///< Buffer keys of a batch read from disk
+        uint64_t lastKey = 0;
+    };
+
+    Config m_config;
+
+    moodycamel::BlockingConcurrentQueue<std::string> m_lines; ///< Bulk lines of the documents
+    std::atomic<std::size_t> m_pendingLines;                  ///< Lines queued and not batched yet
+    std::atomic<std::size_t> m_building;                      ///< Lines in the batch being built
+    moodycamel::BlockingConcurrentQueue<Batch> m_batches;
+    std::atomic<std::size_t> m_inFlight; ///< Batches queued or being sent
+    std::atomic<bool> m_stop;
+    std::atomic<bool> m_stopSenders;
+
+    // Disk buffer
+    std::unique_ptr<rocksdb::DB> m_db;
+    mutable std::mutex m_dbMutex;
+    uint64_t m_nextKey;
+    std::atomic<std::size_t> m_diskRecords;
+    std::atomic<bool> m_diskBatchInFlight;
+    std::chrono::steady_clock::time_point m_diskRetryAt;
+
+    std::thread m_batcher;
+    std::vector<std::thread> m_senders;
+
+    void openBuffer();
+    void spill(const std::string& body);
+    bool readBuffer(Batch& batch);
+    void dropBuffered(const Batch& batch);
+
+    void runBatcher();
+    void submit(Batch&& batch);
+    void runSender(Transport transport);
+    bool send(Transport& transport, const Batch& batch);
+};
+
+} // namespace indexer
+
+#endif // _INDEXER_INDEXER_CONNECTOR_HPP
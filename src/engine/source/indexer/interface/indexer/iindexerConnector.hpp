@@ -0,0 +1,26 @@
+#ifndef _INDEXER_IINDEXER_CONNECTOR_HPP
+#define _INDEXER_IINDEXER_CONNECTOR_HPP
+
+#include <string>
+#include <string_view>
+
+namespace indexer
+{
+
+class IIndexerConnector
+{
+public:
+    virtual ~IIndexerConnector() = default;
+
+    /**
+     * @brief Queue a document to be indexed, the indexer generates its id.
+     *
+     * @param index Index name.
+     * @param document Serialized Json document.
+     */
+    virtual void index(std::string_view index, std::string_view document) = 0;
+};
+
+} // namespace indexer
+
+#endif // _INDEXER_IINDEXER_CONNECTOR_HPP
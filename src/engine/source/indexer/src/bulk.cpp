@@ -0,0 +1,81 @@
+#include "bulk.hpp"
+
+#include <stdexcept>
+
+#include <zlib.h>
+
+namespace indexer::bulk
+{
+
+namespace
+{
+/**
+ * @brief Append the value escaped as the content of a JSON string.
+ */
+void appendEscaped(std::string& out, std::string_view value)
+{
+    constexpr std::string_view HEX = "0123456789abcdef";
+    for (const auto c : value)
+    {
+        switch (c)
+        {
+            case '"': out.append(R"(\")"); break;
+            case '\\': out.append(R"(\\)"); break;
+            case '\n': out.append(R"(\n)"); break;
+            case '\r': out.append(R"(\r)"); break;
+            case '\t': out.append(R"(\t)"); break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    out.append(R"(\u00)");
+                    out.push_back(HEX[static_cast<unsigned char>(c) >> 4]);
+                    out.push_back(HEX[static_cast<unsigned char>(c) & 0xF]);
+                }
+                else
+                {
+                    out.push_back(c);
+                }
+        }
+    }
+}
+} // namespace
+
+void appendIndex(std::string& bulk, std::string_view index, std::string_view document)
+{
+    bulk.append(R"({"index":{"_index":")");
+    appendEscaped(bulk, index);
+    bulk.append(R"("}})");
+    bulk.append("\n");
+    bulk.append(document);
+    bulk.append("\n");
+}
+
+std::string gzip(std::string_view data)
+{
+    z_stream stream {};
+    // 16 added to the window bits writes the gzip header and trailer
+    if (Z_OK != deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY))
+    {
+        throw std::runtime_error("Could not initialize the gzip compression");
+    }
+
+    std::string compressed;
+    compressed.resize(deflateBound(&stream, data.size()));
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+
+    const auto result = deflate(&stream, Z_FINISH);
+    deflateEnd(&stream);
+    if (Z_STREAM_END != result)
+    {
+        throw std::runtime_error("Could not compress the bulk");
+    }
+
+    compressed.resize(stream.total_out);
+    return compressed;
+}
+
+} // namespace indexer::bulk
@@ -0,0 +1,33 @@
+#ifndef _INDEXER_BULK_HPP
+#define _INDEXER_BULK_HPP
+
+#include <string>
+#include <string_view>
+
+namespace indexer::bulk
+{
+
+/**
+ * @brief Append the index action and the document to a bulk request body.
+ *
+ * Same format as the builderBulkIndex of the shared indexer connector, without the document id so the indexer
+ * generates it.
+ *
+ * @param bulk Bulk request body.
+ * @param index Index name, escaped in the action line.
+ * @param document Serialized Json document, in a single line.
+ */
+void appendIndex(std::string& bulk, std::string_view index, std::string_view document);
+
+/**
+ * @brief Compress data in gzip format.
+ *
+ * @param data Data to compress.
+ * @return std::string Compressed data.
+ * @throw std::runtime_error if zlib fails.
+ */
+std::string gzip(std::string_view data);
+
+} // namespace indexer::bulk
+
+#endif // _INDEXER_BULK_HPP
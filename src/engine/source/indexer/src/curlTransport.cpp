@@ -0,0 +1,110 @@
+#include "curlTransport.hpp"
+
+#include <stdexcept>
+
+#include <base/logging.hpp>
+
+namespace indexer
+{
+
+namespace
+{
+size_t writeCallback(void* contents, size_t size, size_t nmemb, std::string* userp)
+{
+    userp->append(static_cast<char*>(contents), size * nmemb);
+    return size * nmemb;
+}
+} // namespace
+
+CurlTransport::CurlTransport(const Config& config, std::size_t firstHost)
+    : m_curl(curl_easy_init())
+    , m_headers(nullptr)
+    , m_current(firstHost % config.hosts.size())
+{
+    if (nullptr == m_curl)
+    {
+        throw std::runtime_error("Could not create the indexer connection");
+    }
+
+    for (const auto& host : config.hosts)
+    {
+        auto url = host;
+        while (!url.empty() && url.back() == '/')
+        {
+            url.pop_back();
+        }
+        m_urls.push_back(url + "/_bulk");
+    }
+
+    m_headers = curl_slist_append(m_headers, "Content-Type: application/x-ndjson");
+    if (config.compress)
+    {
+        m_headers = curl_slist_append(m_headers, "Content-Encoding: gzip");
+    }
+
+    curl_easy_setopt(m_curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(m_curl, CURLOPT_HTTPHEADER, m_headers);
+    curl_easy_setopt(m_curl, CURLOPT_TIMEOUT_MS, static_cast<long>(config.timeoutMs));
+    curl_easy_setopt(m_curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(m_curl, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(m_curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(m_curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_easy_setopt(m_curl, CURLOPT_WRITEFUNCTION, writeCallback);
+    curl_easy_setopt(m_curl, CURLOPT_WRITEDATA, &m_response);
+
+    if (!config.caFile.empty())
+    {
+        curl_easy_setopt(m_curl, CURLOPT_CAINFO, config.caFile.c_str());
+    }
+
+    if (!config.username.empty())
+    {
+        curl_easy_setopt(m_curl, CURLOPT_HTTPAUTH, CURLAUTH_BASIC);
+        curl_easy_setopt(m_curl, CURLOPT_USERNAME, config.username.c_str());
+        curl_easy_setopt(m_curl, CURLOPT_PASSWORD, config.password.c_str());
+    }
+}
+
+CurlTransport::~CurlTransport()
+{
+    curl_easy_cleanup(m_curl);
+    curl_slist_free_all(m_headers);
+}
+
+bool CurlTransport::send(const std::string& body)
+{
+    const auto& url = m_urls[m_current];
+    m_response.clear();
+
+    curl_easy_setopt(m_curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(m_curl, CURLOPT_POSTFIELDS, body.data());
+    curl_easy_setopt(m_curl, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(body.size()));
+
+    const auto res = curl_easy_perform(m_curl);
+    long status = 0;
+    curl_easy_getinfo(m_curl, CURLINFO_RESPONSE_CODE, &status);
+
+    if (CURLE_OK != res || status < 200 || status >= 300)
+    {
+        if (CURLE_OK != res)
+        {
+            LOG_WARNING("Indexer bulk to '{}' failed: {}", url, curl_easy_strerror(res));
+        }
+        else
+        {
+            LOG_WARNING("Indexer bulk to '{}' failed with status {}: {}", url, status, m_response);
+        }
+        m_current = (m_current + 1) % m_urls.size();
+        return false;
+    }
+
+    // The indexer rejected some documents, sending the bulk again would duplicate the accepted ones
+    if (m_response.find(R"("errors":true)") != std::string::npos)
+    {
+        LOG_WARNING("Indexer rejected some documents of a bulk: {}", m_response.substr(0, 1024));
+    }
+
+    return true;
+}
+
+} // namespace indexer
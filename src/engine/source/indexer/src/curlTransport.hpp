@@ -0,0 +1,52 @@
+#ifndef _INDEXER_CURL_TRANSPORT_HPP
+#define _INDEXER_CURL_TRANSPORT_HPP
+
+#include <string>
+#include <vector>
+
+#include <curl/curl.h>
+
+#include <indexer/indexerConnector.hpp>
+
+namespace indexer
+{
+
+/**
+ * @brief Posts the bulks of one connection with its own curl handle, so the HTTP connection is kept alive between
+ * requests. A failed request moves the connection to the next host.
+ */
+class CurlTransport
+{
+private:
+    CURL* m_curl;
+    curl_slist* m_headers;
+    std::vector<std::string> m_urls;
+    std::size_t m_current;
+    std::string m_response;
+
+public:
+    /**
+     * @brief Construct a new Curl Transport
+     *
+     * @param config Connector configuration
+     * @param firstHost Host used first, so the connections are spread between the hosts
+     * @throw std::runtime_error if the curl handle can not be created
+     */
+    CurlTransport(const Config& config, std::size_t firstHost);
+    ~CurlTransport();
+
+    CurlTransport(const CurlTransport&) = delete;
+    CurlTransport& operator=(const CurlTransport&) = delete;
+
+    /**
+     * @brief Post a bulk request body
+     *
+     * @param body Request body, compressed if the configuration says so
+     * @return true if the indexer accepted the bulk
+     */
+    bool send(const std::string& body);
+};
+
+} // namespace indexer
+
+#endif // _INDEXER_CURL_TRANSPORT_HPP
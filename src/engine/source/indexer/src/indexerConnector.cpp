@@ -0,0 +1,391 @@
+#include <indexer/indexerConnector.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <curl/curl.h>
+#include <fmt/format.h>
+#include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
+
+#include <base/logging.hpp>
+
+#include "bulk.hpp"
+#include "curlTransport.hpp"
+
+namespace indexer
+{
+
+namespace
+{
+constexpr std::size_t MAX_DEQUEUE = 1024;              ///< Lines taken from the queue at once
+constexpr auto WAIT_TIMEOUT = std::chrono::milliseconds(50);
+constexpr auto BACKPRESSURE_WAIT = std::chrono::microseconds(100);
+constexpr std::size_t MAX_RETRIES = 2;                 ///< Retries of a bulk before buffering it
+constexpr auto RETRY_WAIT = std::chrono::milliseconds(500);
+constexpr auto BUFFER_RETRY_WAIT = std::chrono::seconds(5); ///< Wait before sending the buffer again after a failure
+
+// Big endian, so the keys are iterated in insertion order
+std::string encodeKey(uint64_t key)
+{
+    std::string encoded(sizeof(key), '\0');
+    for (std::size_t i = 0; i < sizeof(key); ++i)
+    {
+        encoded[i] = static_cast<char>((key >> (8 * (sizeof(key) - 1 - i))) & 0xFF);
+    }
+    return encoded;
+}
+
+uint64_t decodeKey(const rocksdb::Slice& encoded)
+{
+    uint64_t key = 0;
+    for (std::size_t i = 0; i < sizeof(key) && i < encoded.size(); ++i)
+    {
+        key = (key << 8) | static_cast<unsigned char>(encoded[i]);
+    }
+    return key;
+}
+
+IndexerConnector::TransportFactory curlTransportFactory(const Config& config)
+{
+    if (config.hosts.empty())
+    {
+        throw std::runtime_error("The indexer connector needs at least one host");
+    }
+
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+    return [config](std::size_t connection) -> IndexerConnector::Transport
+    {
+        auto transport = std::make_shared<CurlTransport>(config, connection);
+        return [transport](const std::string& body)
+        {
+            return transport->send(body);
+        };
+    };
+}
+} // namespace
+
+IndexerConnector::IndexerConnector(const Config& config)
+    : IndexerConnector(config, curlTransportFactory(config))
+{
+}
+
+IndexerConnector::IndexerConnector(const Config& config, TransportFactory transportFactory)
+    : m_config(config)
+    , m_pendingLines(0)
+    , m_building(0)
+    , m_inFlight(0)
+    , m_stop(false)
+    , m_stopSenders(false)
+    , m_nextKey(0)
+    , m_diskRecords(0)
+    , m_diskBatchInFlight(false)
+{
+    if (0 == m_config.connections || 0 == m_config.queueSize || 0 == m_config.maxBatchBytes)
+    {
+        throw std::runtime_error("The indexer connections, queue size and batch size must be greater than 0");
+    }
+
+    if (!m_config.bufferPath.empty())
+    {
+        openBuffer();
+    }
+
+    for (std::size_t i = 0; i < m_config.connections; ++i)
+    {
+        m_senders.emplace_back(&IndexerConnector::runSender, this, transportFactory(i));
+    }
+    m_batcher = std::thread(&IndexerConnector::runBatcher, this);
+}
+
+IndexerConnector::~IndexerConnector()
+{
+    // The batcher submits what is left, then the senders empty the batch queue
+    m_stop = true;
+    if (m_batcher.joinable())
+    {
+        m_batcher.join();
+    }
+
+    m_stopSenders = true;
+    for (auto& sender : m_senders)
+    {
+        if (sender.joinable())
+        {
+            sender.join();
+        }
+    }
+}
+
+void IndexerConnector::openBuffer()
+{
+    rocksdb::Options options;
+    options.create_if_missing = true;
+
+    rocksdb::DB* db = nullptr;
+    const auto status = rocksdb::DB::Open(options, m_config.bufferPath, &db);
+    if (!status.ok())
+    {
+        throw std::runtime_error(
+            fmt::format("Could not open the indexer buffer '{}': {}", m_config.bufferPath, status.ToString()));
+    }
+    m_db.reset(db);
+
+    // Continue after the last key, the bulks left by the previous run are sent first
+    std::unique_ptr<rocksdb::Iterator> it(m_db->NewIterator(rocksdb::ReadOptions()));
+    for (it->SeekToFirst(); it->Valid(); it->Next())
+    {
+        ++m_diskRecords;
+    }
+    it->SeekToLast();
+    if (it->Valid())
+    {
+        m_nextKey = decodeKey(it->key()) + 1;
+    }
+
+    if (m_diskRecords > 0)
+    {
+        LOG_INFO("Indexer buffer '{}' has {} bulks to send.", m_config.bufferPath, m_diskRecords.load());
+    }
+}
+
+void IndexerConnector::spill(const std::string& body)
+{
+    std::lock_guard<std::mutex> lock(m_dbMutex);
+    const auto status = m_db->Put(rocksdb::WriteOptions(), encodeKey(m_nextKey), body);
+    if (!status.ok())
+    {
+        LOG_ERROR("Could not store a bulk in the indexer buffer: {}", status.ToString());
+        return;
+    }
+    ++m_nextKey;
+    ++m_diskRecords;
+}
+
+bool IndexerConnector::readBuffer(Batch& batch)
+{
+    std::lock_guard<std::mutex> lock(m_dbMutex);
+    if (std::chrono::steady_clock::now() < m_diskRetryAt)
+    {
+        return false;
+    }
+
+    std::unique_ptr<rocksdb::Iterator> it(m_db->NewIterator(rocksdb::ReadOptions()));
+    for (it->SeekToFirst(); it->Valid() && batch.body.size() < m_config.maxBatchBytes; it->Next())
+    {
+        const auto key = decodeKey(it->key());
+        if (batch.body.empty())
+        {
+            batch.firstKey = key;
+        }
+        batch.lastKey = key;
+        batch.body.append(it->value().data(), it->value().size());
+        ++batch.documents;
+    }
+
+    batch.fromDisk = true;
+    return !batch.body.empty();
+}
+
+void IndexerConnector::dropBuffered(const Batch& batch)
+{
+    std::lock_guard<std::mutex> lock(m_dbMutex);
+    // The batch has all the keys between the first and the last one, new bulks get greater keys
+    rocksdb::WriteBatch writeBatch;
+    writeBatch.DeleteRange(encodeKey(batch.firstKey), encodeKey(batch.lastKey + 1));
+    const auto status = m_db->Write(rocksdb::WriteOptions(), &writeBatch);
+    if (!status.ok())
+    {
+        LOG_ERROR("Could not remove the sent bulks from the indexer buffer: {}", status.ToString());
+        return;
+    }
+    m_diskRecords -= batch.documents;
+}
+
+void IndexerConnector::index(std::string_view index, std::string_view document)
+{
+    std::string line;
+    line.reserve(index.size() + document.size() + 32);
+    bulk::appendIndex(line, index, document);
+
+    if (m_pendingLines.load(std::memory_order_relaxed) >= m_config.queueSize)
+    {
+        if (m_db)
+        {
+            spill(line);
+            return;
+        }
+
+        while (m_pendingLines.load(std::memory_order_relaxed) >= m_config.queueSize)
+        {
+            std::this_thread::sleep_for(BACKPRESSURE_WAIT);
+        }
+    }
+
+    ++m_pendingLines;
+    m_lines.enqueue(std::move(line));
+}
+
+void IndexerConnector::drain() const
+{
+    while (m_pendingLines.load() > 0 || m_building.load() > 0 || m_inFlight.load() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void IndexerConnector::runBatcher()
+{
+    const auto flushInterval = std::chrono::milliseconds(m_config.flushIntervalMs);
+    const auto waitTimeout = std::clamp(flushInterval, std::chrono::milliseconds(1), WAIT_TIMEOUT);
+
+    std::vector<std::string> lines(MAX_DEQUEUE);
+    Batch batch;
+    auto batchStart = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        // Once stopping, take what is left without waiting
+        const auto stopping = m_stop.load();
+        auto count = stopping ? m_lines.try_dequeue_bulk(lines.begin(), MAX_DEQUEUE)
+                              : m_lines.wait_dequeue_bulk_timed(lines.begin(), MAX_DEQUEUE, waitTimeout);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (batch.body.empty())
+            {
+                batchStart = std::chrono::steady_clock::now();
+            }
+            batch.body.append(lines[i]);
+            ++batch.documents;
+            ++m_building;
+            --m_pendingLines;
+
+            if (batch.body.size() >= m_config.maxBatchBytes)
+            {
+                submit(std::move(batch));
+                batch = Batch {};
+            }
+        }
+
+        if (!batch.body.empty() && (stopping || std::chrono::steady_clock::now() - batchStart >= flushInterval))
+        {
+            submit(std::move(batch));
+            batch = Batch {};
+        }
+
+        if (stopping)
+        {
+            if (0 == count && batch.body.empty())
+            {
+                return;
+            }
+            continue;
+        }
+
+        // With a spare connection send the buffered bulks, one batch at a time so they are not read twice
+        if (m_db && m_diskRecords > 0 && !m_diskBatchInFlight && m_inFlight < m_config.connections)
+        {
+            Batch diskBatch;
+            if (readBuffer(diskBatch))
+            {
+                m_diskBatchInFlight = true;
+                submit(std::move(diskBatch));
+            }
+        }
+    }
+}
+
+void IndexerConnector::submit(Batch&& batch)
+{
+    // Bounded in flight, while the senders are busy the memory queue fills up and spills to disk
+    while (m_inFlight.load() >= 2 * m_config.connections)
+    {
+        std::this_thread::sleep_for(BACKPRESSURE_WAIT);
+    }
+
+    const auto documents = batch.fromDisk ? 0 : batch.documents;
+    ++m_inFlight;
+    m_batches.enqueue(std::move(batch));
+    m_building -= documents;
+}
+
+bool IndexerConnector::send(Transport& transport, const Batch& batch)
+{
+    std::string compressed;
+    if (m_config.compress)
+    {
+        compressed = bulk::gzip(batch.body);
+    }
+    const auto& body = m_config.compress ? compressed : batch.body;
+
+    for (std::size_t attempt = 0; attempt <= MAX_RETRIES; ++attempt)
+    {
+        try
+        {
+            if (transport(body))
+            {
+                return true;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Indexer bulk failed: {}", e.what());
+        }
+
+        // Do not hold the shutdown, the bulk is buffered
+        if (m_stop || attempt == MAX_RETRIES)
+        {
+            break;
+        }
+        std::this_thread::sleep_for(RETRY_WAIT * (attempt + 1));
+    }
+
+    return false;
+}
+
+void IndexerConnector::runSender(Transport transport)
+{
+    Batch batch;
+    while (true)
+    {
+        if (!m_batches.wait_dequeue_timed(batch, WAIT_TIMEOUT))
+        {
+            if (m_stopSenders)
+            {
+                return;
+            }
+            continue;
+        }
+
+        const auto sent = send(transport, batch);
+        if (batch.fromDisk)
+        {
+            if (sent)
+            {
+                dropBuffered(batch);
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(m_dbMutex);
+                m_diskRetryAt = std::chrono::steady_clock::now() + BUFFER_RETRY_WAIT;
+            }
+            m_diskBatchInFlight = false;
+        }
+        else if (!sent)
+        {
+            if (m_db)
+            {
+                spill(batch.body);
+            }
+            else
+            {
+                LOG_ERROR("Indexer bulk of {} documents dropped, no buffer is configured.", batch.documents);
+            }
+        }
+
+        --m_inFlight;
+    }
+}
+
+} // namespace indexer
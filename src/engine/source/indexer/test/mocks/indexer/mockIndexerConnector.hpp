@@ -0,0 +1,17 @@
+#ifndef _INDEXER_MOCK_INDEXER_CONNECTOR_HPP
+#define _INDEXER_MOCK_INDEXER_CONNECTOR_HPP
+
+#include <gmock/gmock.h>
+
+#include <indexer/iindexerConnector.hpp>
+
+namespace indexer::mocks
+{
+class MockIndexerConnector : public IIndexerConnector
+{
+public:
+    MOCK_METHOD(void, index, (std::string_view index, std::string_view document), (override));
+};
+} // namespace indexer::mocks
+
+#endif // _INDEXER_MOCK_INDEXER_CONNECTOR_HPP
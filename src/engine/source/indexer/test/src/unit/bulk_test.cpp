@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <zlib.h>
+
+#include "bulk.hpp"
+
+using namespace indexer::bulk;
+
+namespace
+{
+std::string gunzip(const std::string& data)
+{
+    z_stream stream {};
+    inflateInit2(&stream, MAX_WBITS + 16);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+
+    std::string out;
+    char buffer[4096];
+    int result = Z_OK;
+    while (Z_OK == result)
+    {
+        stream.next_out = reinterpret_cast<Bytef*>(buffer);
+        stream.avail_out = sizeof(buffer);
+        result = inflate(&stream, Z_NO_FLUSH);
+        out.append(buffer, sizeof(buffer) - stream.avail_out);
+    }
+    inflateEnd(&stream);
+    EXPECT_EQ(result, Z_STREAM_END);
+    return out;
+}
+} // namespace
+
+TEST(BulkTest, AppendIndex)
+{
+    std::string bulk;
+    appendIndex(bulk, "wazuh-alerts", R"({"a":1})");
+    appendIndex(bulk, "wazuh-alerts", R"({"b":2})");
+
+    ASSERT_EQ(bulk,
+              "{\"index\":{\"_index\":\"wazuh-alerts\"}}\n{\"a\":1}\n"
+              "{\"index\":{\"_index\":\"wazuh-alerts\"}}\n{\"b\":2}\n");
+}
+
+TEST(BulkTest, AppendIndexEscapesName)
+{
+    std::string bulk;
+    appendIndex(bulk, "wazuh\"-\\alerts\n", R"({"a":1})");
+
+    ASSERT_EQ(bulk, "{\"index\":{\"_index\":\"wazuh\\\"-\\\\alerts\\n\"}}\n{\"a\":1}\n");
+}
+
+TEST(BulkTest, GzipRoundTrip)
+{
+    std::string bulk;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        appendIndex(bulk, "wazuh-alerts", R"({"event":{"original":"some repeated content"}})");
+    }
+
+    auto compressed = gzip(bulk);
+    ASSERT_LT(compressed.size(), bulk.size());
+    ASSERT_EQ(gunzip(compressed), bulk);
+}
+
+TEST(BulkTest, GzipEmpty)
+{
+    auto compressed = gzip("");
+    ASSERT_FALSE(compressed.empty());
+    ASSERT_EQ(gunzip(compressed), "");
+}
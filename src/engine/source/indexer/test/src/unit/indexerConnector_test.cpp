@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <indexer/indexerConnector.hpp>
+
+using namespace indexer;
+
+namespace
+{
+constexpr auto BUFFER_PATH = "/tmp/indexerConnectorTest";
+
+/**
+ * @brief Records the bodies sent by all the connections, fails while told to.
+ */
+struct FakeIndexer
+{
+    std::mutex mutex;
+    std::vector<std::string> bodies;
+    std::atomic<bool> failing {false};
+    std::atomic<std::size_t> inFlight {0};
+    std::atomic<std::size_t> maxInFlight {0};
+    std::chrono::milliseconds latency {0};
+
+    IndexerConnector::TransportFactory factory()
+    {
+        return [this](std::size_t) -> IndexerConnector::Transport
+        {
+            return [this](const std::string& body)
+            {
+                auto current = ++inFlight;
+                auto max = maxInFlight.load();
+                while (current > max && !maxInFlight.compare_exchange_weak(max, current))
+                {
+                }
+                std::this_thread::sleep_for(latency);
+                --inFlight;
+
+                if (failing)
+                {
+                    return false;
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                bodies.push_back(body);
+                return true;
+            };
+        };
+    }
+
+    std::size_t documents()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::size_t count = 0;
+        for (const auto& body : bodies)
+        {
+            count += std::count(body.begin(), body.end(), '\n') / 2;
+        }
+        return count;
+    }
+};
+
+Config testConfig()
+{
+    Config config;
+    config.compress = false;
+    config.flushIntervalMs = 10;
+    config.connections = 2;
+    return config;
+}
+
+class IndexerConnectorTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { std::filesystem::remove_all(BUFFER_PATH); }
+    void TearDown() override { std::filesystem::remove_all(BUFFER_PATH); }
+};
+} // namespace
+
+TEST_F(IndexerConnectorTest, InvalidConfig)
+{
+    FakeIndexer fake;
+    auto config = testConfig();
+    config.connections = 0;
+    ASSERT_THROW(IndexerConnector(config, fake.factory()), std::runtime_error);
+}
+
+TEST_F(IndexerConnectorTest, NoHosts)
+{
+    ASSERT_THROW(IndexerConnector {testConfig()}, std::runtime_error);
+}
+
+TEST_F(IndexerConnectorTest, SendsByLatency)
+{
+    FakeIndexer fake;
+    IndexerConnector connector(testConfig(), fake.factory());
+
+    connector.index("wazuh-alerts", R"({"a":1})");
+    connector.index("wazuh-alerts", R"({"b":2})");
+    connector.drain();
+
+    std::lock_guard<std::mutex> lock(fake.mutex);
+    ASSERT_EQ(fake.bodies.size(), 1);
+    ASSERT_EQ(fake.bodies[0],
+              "{\"index\":{\"_index\":\"wazuh-alerts\"}}\n{\"a\":1}\n"
+              "{\"index\":{\"_index\":\"wazuh-alerts\"}}\n{\"b\":2}\n");
+}
+
+TEST_F(IndexerConnectorTest, SendsBySize)
+{
+    FakeIndexer fake;
+    auto config = testConfig();
+    config.maxBatchBytes = 256;
+    config.flushIntervalMs = 60000;
+    IndexerConnector connector(config, fake.factory());
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        connector.index("wazuh-alerts", R"({"event":{"original":"some content"}})");
+    }
+
+    // The last partial bulk waits for the flush interval, the full ones are already sent
+    while (fake.documents() < 90)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::lock_guard<std::mutex> lock(fake.mutex);
+    for (const auto& body : fake.bodies)
+    {
+        ASSERT_GE(body.size(), config.maxBatchBytes);
+        ASSERT_LT(body.size(), 2 * config.maxBatchBytes);
+    }
+}
+
+TEST_F(IndexerConnectorTest, SendsPendingOnDestruction)
+{
+    FakeIndexer fake;
+    auto config = testConfig();
+    config.flushIntervalMs = 60000;
+    {
+        IndexerConnector connector(config, fake.factory());
+        for (auto i = 0; i < 10; ++i)
+        {
+            connector.index("wazuh-alerts", R"({"a":1})");
+        }
+    }
+
+    ASSERT_EQ(fake.documents(), 10);
+}
+
+TEST_F(IndexerConnectorTest, ConnectionsInFlight)
+{
+    FakeIndexer fake;
+    fake.latency = std::chrono::milliseconds(20);
+    auto config = testConfig();
+    config.connections = 4;
+    config.maxBatchBytes = 64;
+    IndexerConnector connector(config, fake.factory());
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        connector.index("wazuh-alerts", R"({"event":{"original":"some content"}})");
+    }
+    connector.drain();
+
+    ASSERT_EQ(fake.documents(), 100);
+    ASSERT_GT(fake.maxInFlight.load(), 1);
+    ASSERT_LE(fake.maxInFlight.load(), config.connections);
+}
+
+TEST_F(IndexerConnectorTest, BuffersWhileIndexerFails)
+{
+    FakeIndexer fake;
+    fake.failing = true;
+    auto config = testConfig();
+    config.bufferPath = BUFFER_PATH;
+    IndexerConnector connector(config, fake.factory());
+
+    connector.index("wazuh-alerts", R"({"a":1})");
+    connector.drain();
+    ASSERT_EQ(connector.buffered(), 1);
+    ASSERT_EQ(fake.documents(), 0);
+
+    // Sent again once the indexer answers
+    fake.failing = false;
+    while (connector.buffered() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(fake.documents(), 1);
+}
+
+TEST_F(IndexerConnectorTest, BufferSurvivesRestart)
+{
+    FakeIndexer fake;
+    fake.failing = true;
+    auto config = testConfig();
+    config.bufferPath = BUFFER_PATH;
+    {
+        IndexerConnector connector(config, fake.factory());
+        connector.index("wazuh-alerts", R"({"a":1})");
+        connector.index("wazuh-alerts", R"({"b":2})");
+    }
+
+    fake.failing = false;
+    IndexerConnector connector(config, fake.factory());
+    while (connector.buffered() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(fake.documents(), 2);
+}
+
+TEST_F(IndexerConnectorTest, SpillsWhenQueueIsFull)
+{
+    FakeIndexer fake;
+    fake.failing = true;
+    auto config = testConfig();
+    config.queueSize = 1;
+    config.connections = 1;
+    config.bufferPath = BUFFER_PATH;
+    IndexerConnector connector(config, fake.factory());
+
+    // The callers do not wait, what does not fit goes to the buffer
+    for (auto i = 0; i < 50; ++i)
+    {
+        connector.index("wazuh-alerts", R"({"a":1})");
+    }
+
+    fake.failing = false;
+    connector.drain();
+    while (connector.buffered() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(fake.documents(), 50);
+}
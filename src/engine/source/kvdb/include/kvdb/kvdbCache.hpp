@@ -0,0 +1,91 @@
+#ifndef _KVDB_CACHE_H
+#define _KVDB_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <base/json.hpp>
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Version of the content of a DB, shared by all the handlers of the DB.
+ *
+ * Every write increases it, so the values cached before the write are no longer used.
+ */
+using KVDBVersion = std::atomic<uint64_t>;
+
+/**
+ * @brief Bounded cache of parsed values, split in shards with their own lock.
+ *
+ * Each shard keeps its entries in least recently used order and evicts the oldest one when it is full. An entry is
+ * only returned if it was cached with the version being read.
+ */
+class KVDBCache
+{
+public:
+    /**
+     * @brief Construct a new KVDBCache object
+     *
+     * @param capacity Maximum number of entries, split between the shards.
+     * @param shards Number of shards.
+     */
+    explicit KVDBCache(std::size_t capacity, std::size_t shards = DEFAULT_SHARDS);
+
+    /**
+     * @brief Get a cached value.
+     *
+     * @param key Key of the value.
+     * @param version Current version of the DB.
+     * @return std::shared_ptr<const json::Json> The value, or nullptr if it is not cached or is stale.
+     */
+    std::shared_ptr<const json::Json> get(const std::string& key, uint64_t version);
+
+    /**
+     * @brief Cache a value.
+     *
+     * @param key Key of the value.
+     * @param value Parsed value.
+     * @param version Version of the DB read before reading the value.
+     */
+    void put(const std::string& key, const std::shared_ptr<const json::Json>& value, uint64_t version);
+
+    /**
+     * @brief Number of cached entries, including the stale ones not evicted yet.
+     */
+    std::size_t size() const;
+
+    static constexpr std::size_t DEFAULT_SHARDS = 8;
+
+private:
+    struct Entry
+    {
+        std::string key;
+        std::shared_ptr<const json::Json> value;
+        uint64_t version;
+    };
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::list<Entry> entries; ///< Most recently used first
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+    };
+
+    Shard& shardFor(const std::string& key);
+
+    std::vector<Shard> m_shards;
+    std::size_t m_shardCapacity;
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_CACHE_H
@@ -3,6 +3,9 @@
 
 #include <kvdb/ikvdbhandler.hpp>
 #include <kvdb/ikvdbhandlercollection.hpp>
+#include <kvdb/kvdbCache.hpp>
+#include <kvdb/kvdbSnapshot.hpp>
+#include <kvdb/kvdbWriteBehind.hpp>
 
 #include <rocksdb/slice.h>
 
@@ -34,18 +37,30 @@ public:
      * @param cfHandle Pointer to the RocksDB:ColumnFamilyHandle instance.
      * @param dbName Name of the DB.
      * @param scopeName Name of the Scope.
+     * @param version Version of the DB content, shared with the other handlers of the DB.
+     * @param cacheSize Maximum number of parsed values kept by getJson (0 = disabled).
+     * @param snapshot Read-only copy of the DB used for the reads while the DB is not written, may be null.
+     * @param writeBuffer Buffer the writes are applied from in the background, null to write synchronously.
      *
      */
     KVDBHandler(std::weak_ptr<rocksdb::DB> weakDB,
                 std::weak_ptr<rocksdb::ColumnFamilyHandle> weakCFHandle,
                 std::shared_ptr<IKVDBHandlerCollection> collection,
                 const std::string& dbName,
-                const std::string& scopeName)
+                const std::string& scopeName,
+                std::shared_ptr<KVDBVersion> version = nullptr,
+                std::size_t cacheSize = 0,
+                std::shared_ptr<const KVDBSnapshot> snapshot = nullptr,
+                std::shared_ptr<KVDBWriteBuffer> writeBuffer = nullptr)
         : m_weakDB {weakDB}
         , m_weakCFHandle {weakCFHandle}
         , m_dbName {dbName}
         , m_scopeName {scopeName}
         , m_spCollection {collection}
+        , m_spVersion {version ? std::move(version) : std::make_shared<KVDBVersion>(0)}
+        , m_upCache {cacheSize > 0 ? std::make_unique<KVDBCache>(cacheSize) : nullptr}
+        , m_spSnapshot {std::move(snapshot)}
+        , m_spWriteBuffer {std::move(writeBuffer)}
     {
     }
 
@@ -91,6 +106,13 @@ public:
      */
     base::RespOrError<std::string> get(const std::string& key) override;
 
+    /**
+     * @copydoc IKVDBHandler::getJson
+     *
+     * The parsed values are cached until the DB is written through any of its handlers.
+     */
+    base::RespOrError<std::shared_ptr<const json::Json>> getJson(const std::string& key) override;
+
     /**
      * @copydoc IKVDBHandler::dump
      *
@@ -105,6 +127,13 @@ public:
     base::RespOrError<std::list<std::pair<std::string, std::string>>>
     search(const std::string& filter, const unsigned int page, const unsigned int records) override;
 
+    /**
+     * @copydoc IKVDBHandler::scan
+     *
+     */
+    base::RespOrError<std::list<std::pair<std::string, std::string>>>
+    scan(const std::string& prefix, const std::string& after, const unsigned int records) override;
+
 protected:
     /**
      *  @brief Weak Pointer to the RocksDB:ColumnFamilyHandle instance.
@@ -136,7 +165,58 @@ protected:
      */
     std::shared_ptr<IKVDBHandlerCollection> m_spCollection;
 
+    /**
+     * @brief Version of the DB content, increased on every write.
+     *
+     */
+    std::shared_ptr<KVDBVersion> m_spVersion;
+
+    /**
+     * @brief Cache of parsed values, null if disabled.
+     *
+     */
+    std::unique_ptr<KVDBCache> m_upCache;
+
+    /**
+     * @brief Snapshot taken when the handler was created, null if the DB is not in snapshot mode.
+     *
+     */
+    std::shared_ptr<const KVDBSnapshot> m_spSnapshot;
+
+    /**
+     * @brief Writes of the DB not applied yet, null if the writes are synchronous.
+     *
+     * The reads look it up first, the iterations (dump, search, scan) only see the writes once they are applied.
+     */
+    std::shared_ptr<KVDBWriteBuffer> m_spWriteBuffer;
+
 private:
+    /**
+     * @brief Get the snapshot if it still matches the content of the DB.
+     *
+     * @return const KVDBSnapshot* The snapshot, or nullptr if there is none or the DB was written after it.
+     */
+    const KVDBSnapshot* currentSnapshot() const
+    {
+        if (m_spSnapshot && m_spSnapshot->version() == m_spVersion->load(std::memory_order_acquire))
+        {
+            return m_spSnapshot.get();
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Get the last write of a key not applied to the DB yet.
+     *
+     * @param key Key to look for.
+     * @return std::optional<KVDBWriteBuffer::Pending> The write, or nullopt if there is none.
+     */
+    std::optional<KVDBWriteBuffer::Pending> pendingWrite(const std::string& key) const
+    {
+        return m_spWriteBuffer ? m_spWriteBuffer->find(key) : std::nullopt;
+    }
+
     /**
      * @brief Function to page the content of iterator
      *
@@ -3,76 +3,16 @@
 
 #include <kvdb/ikvdbhandlercollection.hpp>
 
+#include <atomic>
 #include <map>
 #include <memory>
-#include <set>
-#include <shared_mutex>
+#include <mutex>
 
 #include <kvdb/kvdbHandler.hpp>
-#include <kvdb/refCounter.hpp>
 
 namespace kvdbManager
 {
 
-/**
- * @brief Helper class to manage the reference counters for a given DB.
- * This is used to track how many scopes are using a given DB.
- *
- */
-class KVDBHandlerInstance
-{
-public:
-    /**
-     * @brief Add a new scope to the reference counter.
-     *
-     * @param scopeName Name of the Scope.
-     *
-     */
-    void addScope(const std::string& scopeName);
-
-    /**
-     * @brief Remove a scope from the reference counter.
-     *
-     * @param scopeName Name of the Scope.
-     */
-    void removeScope(const std::string& scopeName);
-
-    /**
-     * @brief Returns if there are no scopes referencing this DB.
-     *
-     * @return true No scopes are referencing this DB.
-     * @return false Some scopes are referencing this DB.
-     */
-    bool emptyScopes(void);
-
-    /**
-     * @brief Get the list of scopes referencing this DB.
-     *
-     * @return std::vector<std::string> List of Scope names.
-     */
-    std::vector<std::string> getRefNames(void);
-
-    /**
-     * @brief Get the Ref Map object
-     *
-     * @return std::map<std::string, uint32_t> Map of DB names and their reference count.
-     */
-    std::map<std::string, uint32_t> getRefMap(void);
-
-private:
-    /**
-     * @brief Basically a wrapper to std::map<std::string, int> with some helper functions.
-     *
-     */
-    RefCounter m_scopeCounter;
-
-    /**
-     * @brief Mutex to protect the internal counter.
-     *
-     */
-    std::shared_mutex m_mutex;
-};
-
 /**
  * @brief Collection of KVDB Handlers for a given DB and the Scopes referencing them.
  *
@@ -116,17 +56,44 @@ public:
     std::map<std::string, uint32_t> getRefMap(const std::string& dbName);
 
 private:
+    using Counter = std::atomic<uint32_t>;
+    /**
+     * @brief DB names, the Scopes referencing them and the number of handlers of each pair.
+     *
+     * The counters are shared by the successive snapshots of the registry, so a snapshot is only replaced the first
+     * time a pair is registered and the handlers of known pairs are counted without locks. The pairs are kept when
+     * their count drops to zero, a handler of an old snapshot could still be counting on them.
+     */
+    using Registry = std::map<std::string, std::map<std::string, std::shared_ptr<Counter>>>;
+
+    /**
+     * @brief Current snapshot of the registry, loaded and replaced atomically.
+     *
+     */
+    std::shared_ptr<const Registry> m_registry {std::make_shared<const Registry>()};
+
     /**
-     * @brief Internal map holding DB names and their KVDBHandlerInstance with extra info.
+     * @brief Serializes the replacements of the snapshot.
      *
      */
-    std::map<std::string, std::shared_ptr<KVDBHandlerInstance>> m_mapInstances;
+    std::mutex m_mutex;
+
+    /**
+     * @brief Get the counter of a DB and Scope pair, registering it if needed.
+     *
+     * @param dbName Name of the DB.
+     * @param scopeName Name of the Scope.
+     * @return std::shared_ptr<Counter> The counter of the pair.
+     */
+    std::shared_ptr<Counter> counter(const std::string& dbName, const std::string& scopeName);
 
     /**
-     * @brief Mutex to protect the internal map.
+     * @brief Find the counter of a DB and Scope pair in a snapshot.
      *
+     * @return std::shared_ptr<Counter> The counter, nullptr if the pair is not registered.
      */
-    std::shared_mutex m_mutex;
+    static std::shared_ptr<Counter>
+    find(const Registry& registry, const std::string& dbName, const std::string& scopeName);
 };
 
 } // namespace kvdbManager
@@ -2,9 +2,12 @@
 #define _KVDB_MANAGER_H
 
 #include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <filesystem>
 #include <map>
 #include <mutex>
+#include <set>
 
 #include <rocksdb/db.h>
 #include <rocksdb/options.h>
@@ -14,6 +17,8 @@
 #include <kvdb/ikvdbmanager.hpp>
 #include <kvdb/kvdbHandler.hpp>
 #include <kvdb/kvdbHandlerCollection.hpp>
+#include <kvdb/kvdbWriteBehind.hpp>
+#include <kvdb/refCounter.hpp>
 
 namespace metricsManager
 {
@@ -34,6 +39,10 @@ struct KVDBManagerOptions
 {
     std::filesystem::path dbStoragePath;
     std::string dbName;
+    std::size_t cacheSize {0}; ///< Parsed values cached by each handler (0 = disabled)
+    std::set<std::string> snapshotDBs {}; ///< DBs read from an in-memory snapshot taken when their handlers are created
+    std::chrono::milliseconds writeBehindWindow {0}; ///< Writes coalesced and applied in the background every window
+                                                     ///< (0 = synchronous writes)
 };
 
 /**
@@ -69,6 +78,29 @@ public:
      */
     void finalize() override;
 
+    /**
+     * @brief Read the DBs in order into the block cache, so the first lookups after a start do not read the disk.
+     *
+     * Stops when half of the block cache is filled, leaving room for the blocks the lookups bring in.
+     *
+     * @return std::size_t Bytes of keys and values read.
+     */
+    std::size_t prewarm();
+
+    /**
+     * @brief Estimate the memory held by the DBs: the block cache, which the memtables are charged to, the table
+     * readers not kept in the cache and the snapshots of the DBs in snapshot mode.
+     *
+     * @return std::size_t Bytes held.
+     */
+    std::size_t memoryUsage();
+
+    /**
+     * @brief Drop the unused blocks of the block cache and the snapshots not pinned by a handler.
+     *
+     */
+    void releaseMemory();
+
     /**
      * @copydoc IKVDBManager::getKVDBScopesInfo
      *
@@ -132,7 +164,7 @@ public:
 
 private:
     /**
-     * @brief Setup RocksDB Options. Populate m_rocksDBOptions with the default values.
+     * @brief Setup RocksDB Options. Populate m_rocksDBOptions and m_cfOptions.
      *
      */
     void initializeOptions();
@@ -150,12 +182,25 @@ private:
     void finalizeMainDB();
 
     /**
-     * @brief Get the content of a json file
+     * @brief Load the entries of a json file into a DB.
      *
-     * @param path Path of the json file.
-     * @return base::RespOrError<json::Json> A json document or specific error.
+     * The file is parsed as a stream and written in batches, so its size is not bounded by the memory.
+     *
+     * @param name Name of the DB, which must exist.
+     * @param file Open json file, whose content is an object of key-value pairs.
+     * @param path Path of the json file, for the errors.
+     * @return base::OptError Specific error.
+     */
+    base::OptError loadDBFromFile(const std::string& name, FILE* file, const std::string& path);
+
+    /**
+     * @brief Write a batch of entries of a DB and clear it.
+     *
+     * @param name Name of the DB.
+     * @param batch Entries to write.
+     * @return base::OptError Specific error.
      */
-    base::RespOrError<json::Json> getContentFromJsonFile(const std::string& path);
+    base::OptError writeBatch(const std::string& name, rocksdb::WriteBatch& batch);
 
     /**
      * @brief Create a Shared Column Family Shared Pointer with custom delete function.
@@ -185,6 +230,24 @@ private:
      */
     base::OptError createColumnFamily(const std::string& name);
 
+    /**
+     * @brief Get the content version of a DB, shared by all its handlers.
+     *
+     * @param name Name of the DB.
+     * @return std::shared_ptr<KVDBVersion> Version, created on first use.
+     */
+    std::shared_ptr<KVDBVersion> getVersion(const std::string& name);
+
+    /**
+     * @brief Get the snapshot of a DB, taking a new one if the DB was written after the last one.
+     *
+     * @param name Name of the DB.
+     * @param cfHandle Column Family of the DB.
+     * @return std::shared_ptr<const KVDBSnapshot> Snapshot, or null if the DB could not be read.
+     */
+    std::shared_ptr<const KVDBSnapshot> getSnapshot(const std::string& name,
+                                                    const std::shared_ptr<rocksdb::ColumnFamilyHandle>& cfHandle);
+
     /**
      * @brief Options the Manager was built with.
      *
@@ -197,6 +260,18 @@ private:
      */
     rocksdb::Options m_rocksDBOptions;
 
+    /**
+     * @brief Options of every Column Family, tuned for point lookups over a shared block cache.
+     *
+     */
+    rocksdb::ColumnFamilyOptions m_cfOptions;
+
+    /**
+     * @brief Block cache shared by all the DBs.
+     *
+     */
+    std::shared_ptr<rocksdb::Cache> m_blockCache;
+
     /**
      * @brief Internal rocksdb::DB object. This is the main object through which all operations are done.
      *
@@ -215,6 +290,30 @@ private:
      */
     std::shared_ptr<rocksdb::ColumnFamilyHandle> m_pDefaultCFHandle;
 
+    /**
+     * @brief Content version of each DB, used to invalidate the caches of the handlers.
+     *
+     */
+    std::map<std::string, std::shared_ptr<KVDBVersion>> m_mapVersions;
+
+    /**
+     * @brief Last snapshot of each DB in snapshot mode.
+     *
+     */
+    std::map<std::string, std::shared_ptr<const KVDBSnapshot>> m_mapSnapshots;
+
+    /**
+     * @brief Applies the writes of the handlers in the background, null if the writes are synchronous.
+     *
+     */
+    std::unique_ptr<KVDBWriteBehind> m_upWriteBehind;
+
+    /**
+     * @brief Syncronization object for the versions and snapshots maps (m_mapVersions, m_mapSnapshots).
+     *
+     */
+    std::mutex m_mutexVersions;
+
     /**
      * @brief Syncronization object for Scopes Collection (m_mapScopes).
      *
@@ -0,0 +1,77 @@
+#ifndef _KVDB_SNAPSHOT_H
+#define _KVDB_SNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <base/json.hpp>
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Read-only copy of the content of a DB, indexed with a perfect hash.
+ *
+ * The keys are placed with hash and displace: each key goes to a bucket, and each bucket stores the seed that sends
+ * all its keys to free slots. A lookup computes two hashes and compares one key, without locks or RocksDB calls.
+ */
+class KVDBSnapshot
+{
+public:
+    /**
+     * @brief Entry of the snapshot.
+     *
+     */
+    struct Entry
+    {
+        std::string key;
+        std::string value;
+        std::shared_ptr<const json::Json> json; ///< Parsed value, null if the value is not a valid Json
+    };
+
+    /**
+     * @brief Build a snapshot.
+     *
+     * @param entries Key/value pairs of the DB, the keys must be unique.
+     * @param version Version of the DB read before reading the entries.
+     */
+    KVDBSnapshot(std::vector<std::pair<std::string, std::string>> entries, uint64_t version);
+
+    /**
+     * @brief Find the entry of a key.
+     *
+     * @param key Key to look for.
+     * @return const Entry* The entry, or nullptr if the key is not in the snapshot.
+     */
+    const Entry* find(std::string_view key) const;
+
+    /**
+     * @brief Version of the DB the snapshot was built from.
+     */
+    uint64_t version() const { return m_version; }
+
+    /**
+     * @brief Number of entries.
+     */
+    std::size_t size() const { return m_entries.size(); }
+
+    /**
+     * @brief Estimate of the memory held, the parsed values are counted as the size of their raw string.
+     */
+    std::size_t bytes() const { return m_bytes; }
+
+private:
+    std::vector<Entry> m_entries;
+    std::vector<uint32_t> m_seeds; ///< Seed of each bucket
+    std::vector<uint32_t> m_slots; ///< Index of the entry in each slot plus one, 0 if the slot is free
+    uint64_t m_version;
+    std::size_t m_bytes {0};
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_SNAPSHOT_H
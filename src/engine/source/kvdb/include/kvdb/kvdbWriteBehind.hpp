@@ -0,0 +1,178 @@
+#ifndef _KVDB_WRITE_BEHIND_H
+#define _KVDB_WRITE_BEHIND_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rocksdb
+{
+class DB;
+class ColumnFamilyHandle;
+class WriteBatch;
+}; // namespace rocksdb
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Writes of a DB not applied to RocksDB yet, shared by all the handlers of the DB.
+ *
+ * The writes are coalesced by key, only the last one of each key is applied. The handlers look up the buffer before
+ * reading the DB, so they read their own writes before they are applied.
+ */
+class KVDBWriteBuffer
+{
+public:
+    /**
+     * @brief Last write of a key.
+     *
+     */
+    struct Pending
+    {
+        bool removed {false}; ///< The key was removed
+        std::string value;    ///< Value set, empty if removed
+    };
+
+    /**
+     * @brief Construct a new KVDBWriteBuffer object
+     *
+     * @param weakCFHandle Column Family of the DB.
+     */
+    explicit KVDBWriteBuffer(std::weak_ptr<rocksdb::ColumnFamilyHandle> weakCFHandle)
+        : m_weakCFHandle {std::move(weakCFHandle)}
+    {
+    }
+
+    /**
+     * @brief Buffer setting a key, replacing the previous write of the key.
+     */
+    void set(const std::string& key, std::string value);
+
+    /**
+     * @brief Buffer removing a key, replacing the previous write of the key.
+     */
+    void remove(const std::string& key);
+
+    /**
+     * @brief Find the last write of a key not applied yet.
+     *
+     * @param key Key to look for.
+     * @return std::optional<Pending> The write, or nullopt if the key has no pending write.
+     */
+    std::optional<Pending> find(const std::string& key) const;
+
+    /**
+     * @brief Add the pending writes to a batch, they are kept in the buffer until release() is called.
+     *
+     * @param batch Batch to add the writes to.
+     * @param collected Keys added and the sequence of their write, to release them after the batch is written.
+     * @return std::shared_ptr<rocksdb::ColumnFamilyHandle> Column Family the writes refer to, to keep it alive until
+     * the batch is written. Null if the DB no longer exists, nothing is added then.
+     */
+    std::shared_ptr<rocksdb::ColumnFamilyHandle>
+    collect(rocksdb::WriteBatch& batch, std::vector<std::pair<std::string, uint64_t>>& collected) const;
+
+    /**
+     * @brief Remove the writes applied to RocksDB, unless the key was written again after collect().
+     *
+     * @param collected Keys returned by collect().
+     */
+    void release(const std::vector<std::pair<std::string, uint64_t>>& collected);
+
+    /**
+     * @brief Number of pending writes.
+     */
+    std::size_t size() const { return m_size.load(std::memory_order_acquire); }
+
+private:
+    struct Entry
+    {
+        Pending pending;
+        uint64_t sequence;
+    };
+
+    void write(const std::string& key, Pending pending);
+
+    std::weak_ptr<rocksdb::ColumnFamilyHandle> m_weakCFHandle;
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    uint64_t m_sequence {0};
+    std::atomic<std::size_t> m_size {0}; ///< Size of m_entries, read without the lock
+};
+
+/**
+ * @brief Applies the buffered writes of all the DBs in a background thread.
+ *
+ * Every window the pending writes are collected in a single rocksdb::WriteBatch, so the workers do not wait for
+ * RocksDB. The writes that fail are kept and retried in the next window.
+ */
+class KVDBWriteBehind
+{
+public:
+    /**
+     * @brief Construct a new KVDBWriteBehind object and start its thread.
+     *
+     * @param weakDB RocksDB instance.
+     * @param window Time between the flushes.
+     */
+    KVDBWriteBehind(std::weak_ptr<rocksdb::DB> weakDB, std::chrono::milliseconds window);
+
+    /**
+     * @brief Stop the thread, flushing the pending writes.
+     *
+     */
+    ~KVDBWriteBehind();
+
+    KVDBWriteBehind(const KVDBWriteBehind&) = delete;
+    KVDBWriteBehind& operator=(const KVDBWriteBehind&) = delete;
+
+    /**
+     * @brief Get the write buffer of a DB, created on first use.
+     *
+     * @param dbName Name of the DB.
+     * @param weakCFHandle Column Family of the DB.
+     * @return std::shared_ptr<KVDBWriteBuffer> The buffer.
+     */
+    std::shared_ptr<KVDBWriteBuffer> buffer(const std::string& dbName,
+                                            std::weak_ptr<rocksdb::ColumnFamilyHandle> weakCFHandle);
+
+    /**
+     * @brief Discard the pending writes of a DB, e.g. because it was deleted.
+     *
+     * @param dbName Name of the DB.
+     */
+    void drop(const std::string& dbName);
+
+    /**
+     * @brief Apply the pending writes of all the DBs now.
+     *
+     */
+    void flush();
+
+private:
+    void run();
+
+    std::weak_ptr<rocksdb::DB> m_weakDB;
+    std::chrono::milliseconds m_window;
+    std::mutex m_mutex; ///< Protects m_buffers and m_stop
+    std::condition_variable m_cv;
+    bool m_stop {false};
+    std::map<std::string, std::shared_ptr<KVDBWriteBuffer>> m_buffers;
+    std::mutex m_flushMutex; ///< Serializes the flushes, so the writes of a key are applied in order
+    std::thread m_thread;
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_WRITE_BEHIND_H
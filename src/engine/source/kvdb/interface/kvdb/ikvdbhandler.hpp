@@ -3,6 +3,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <variant>
@@ -80,6 +81,26 @@ public:
      */
     virtual base::RespOrError<std::string> get(const std::string& key) = 0;
 
+    /**
+     * @brief Gets the value of a key parsed as Json.
+     *
+     * Implementations may keep the parsed values of the most used keys, so the returned value must not be modified.
+     *
+     * @param key Provided key.
+     * @return base::RespOrError<std::shared_ptr<const json::Json>> Json value of the key. Specific error otherwise.
+     * @throw std::runtime_error If the stored value is not a valid Json.
+     */
+    virtual base::RespOrError<std::shared_ptr<const json::Json>> getJson(const std::string& key)
+    {
+        auto result = get(key);
+        if (base::isError(result))
+        {
+            return base::getError(result);
+        }
+
+        return std::make_shared<const json::Json>(base::getResponse<std::string>(result).c_str());
+    }
+
     /**
      * @brief Retrieves all content with pagination from the database.
      *
@@ -131,6 +152,21 @@ public:
     {
         return search(prefix, 0, 0);
     };
+
+    /**
+     * @brief Retrieves the entries that follow a key, in key order.
+     *
+     * Unlike the pages of dump and search, which are counted from the first key on every call, the iteration
+     * resumes at the given key, so reading the whole database a batch at a time is linear.
+     *
+     * @param prefix Only the keys starting with it, empty for all the keys.
+     * @param after Last key already read, empty to start from the first key.
+     * @param records Max quantity of records to retrieve, 0 for all of them.
+     * @return base::RespOrError<std::list<std::pair<std::string, std::string>>> Map of key-value pairs.
+     * Specific error otherwise.
+     */
+    virtual base::RespOrError<std::list<std::pair<std::string, std::string>>>
+    scan(const std::string& prefix, const std::string& after, const unsigned int records) = 0;
 };
 
 } // namespace kvdbManager
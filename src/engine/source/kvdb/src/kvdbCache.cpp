@@ -0,0 +1,91 @@
+#include <kvdb/kvdbCache.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace kvdbManager
+{
+
+KVDBCache::KVDBCache(std::size_t capacity, std::size_t shards)
+    : m_shards(std::max<std::size_t>(1, std::min(shards, capacity)))
+{
+    if (capacity == 0)
+    {
+        throw std::runtime_error("KVDB cache capacity must be greater than 0");
+    }
+
+    m_shardCapacity = (capacity + m_shards.size() - 1) / m_shards.size();
+}
+
+KVDBCache::Shard& KVDBCache::shardFor(const std::string& key)
+{
+    return m_shards[std::hash<std::string> {}(key) % m_shards.size()];
+}
+
+std::shared_ptr<const json::Json> KVDBCache::get(const std::string& key, uint64_t version)
+{
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it == shard.index.end())
+    {
+        return nullptr;
+    }
+
+    auto entry = it->second;
+    if (entry->version != version)
+    {
+        shard.index.erase(it);
+        shard.entries.erase(entry);
+        return nullptr;
+    }
+
+    shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+    return entry->value;
+}
+
+void KVDBCache::put(const std::string& key, const std::shared_ptr<const json::Json>& value, uint64_t version)
+{
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it != shard.index.end())
+    {
+        // Keep the entry of the newest version, a slower reader may come with an older one
+        auto entry = it->second;
+        if (entry->version <= version)
+        {
+            entry->value = value;
+            entry->version = version;
+        }
+        shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+        return;
+    }
+
+    if (shard.entries.size() >= m_shardCapacity)
+    {
+        shard.index.erase(shard.entries.back().key);
+        shard.entries.pop_back();
+    }
+
+    shard.entries.push_front(Entry {key, value, version});
+    // The key of the index points to the string owned by the entry
+    shard.index.emplace(shard.entries.front().key, shard.entries.begin());
+}
+
+std::size_t KVDBCache::size() const
+{
+    std::size_t total = 0;
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.entries.size();
+    }
+
+    return total;
+}
+
+} // namespace kvdbManager
@@ -15,6 +15,13 @@ KVDBHandler::~KVDBHandler()
 
 std::optional<base::Error> KVDBHandler::set(const std::string& key, const std::string& value)
 {
+    if (m_spWriteBuffer)
+    {
+        m_spWriteBuffer->set(key, value);
+        m_spVersion->fetch_add(1, std::memory_order_acq_rel);
+        return std::nullopt;
+    }
+
     auto pRocksDB = m_weakDB.lock();
     if (pRocksDB)
     {
@@ -23,6 +30,8 @@ std::optional<base::Error> KVDBHandler::set(const std::string& key, const std::s
         {
             auto status =
                 pRocksDB->Put(rocksdb::WriteOptions(), pCFhandle.get(), rocksdb::Slice(key), rocksdb::Slice(value));
+            // Increased after the write, so a value read before it is cached with a stale version
+            m_spVersion->fetch_add(1, std::memory_order_acq_rel);
 
             if (status.ok())
             {
@@ -55,6 +64,13 @@ std::optional<base::Error> KVDBHandler::add(const std::string& key)
 
 std::optional<base::Error> KVDBHandler::remove(const std::string& key)
 {
+    if (m_spWriteBuffer)
+    {
+        m_spWriteBuffer->remove(key);
+        m_spVersion->fetch_add(1, std::memory_order_acq_rel);
+        return std::nullopt;
+    }
+
     auto pRocksDB = m_weakDB.lock();
     if (pRocksDB)
     {
@@ -62,6 +78,7 @@ std::optional<base::Error> KVDBHandler::remove(const std::string& key)
         if (pCFhandle)
         {
             auto status = pRocksDB->Delete(rocksdb::WriteOptions(), pCFhandle.get(), rocksdb::Slice(key));
+            m_spVersion->fetch_add(1, std::memory_order_acq_rel);
 
             if (status.ok())
             {
@@ -84,6 +101,22 @@ std::optional<base::Error> KVDBHandler::remove(const std::string& key)
 
 std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
 {
+    if (auto pending = pendingWrite(key))
+    {
+        return !pending->removed;
+    }
+
+    if (auto snapshot = currentSnapshot())
+    {
+        return snapshot->find(key) != nullptr;
+    }
+
+    // A value cached for the current version is known to exist
+    if (m_upCache && m_upCache->get(key, m_spVersion->load(std::memory_order_acquire)))
+    {
+        return true;
+    }
+
     auto pRocksDB = m_weakDB.lock();
     if (pRocksDB)
     {
@@ -127,6 +160,27 @@ std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
 
 std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
 {
+    if (auto pending = pendingWrite(key))
+    {
+        if (pending->removed)
+        {
+            return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+        }
+
+        return std::move(pending->value);
+    }
+
+    if (auto snapshot = currentSnapshot())
+    {
+        auto entry = snapshot->find(key);
+        if (!entry)
+        {
+            return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+        }
+
+        return entry->value;
+    }
+
     auto pRocksDB = m_weakDB.lock();
     if (pRocksDB)
     {
@@ -158,6 +212,60 @@ std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
     return base::Error {"Can not access RocksDB::DB"};
 }
 
+base::RespOrError<std::shared_ptr<const json::Json>> KVDBHandler::getJson(const std::string& key)
+{
+    // Not cached, the write is applied within the window
+    if (auto pending = pendingWrite(key))
+    {
+        if (pending->removed)
+        {
+            return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+        }
+
+        return std::make_shared<const json::Json>(pending->value.c_str());
+    }
+
+    if (auto snapshot = currentSnapshot())
+    {
+        auto entry = snapshot->find(key);
+        if (!entry)
+        {
+            return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+        }
+        if (!entry->json)
+        {
+            throw std::runtime_error(fmt::format("Value of key '{}' is not a valid Json", key));
+        }
+
+        return entry->json;
+    }
+
+    // Read before the DB, so a concurrent write leaves the cached value stale
+    const auto version = m_spVersion->load(std::memory_order_acquire);
+
+    if (m_upCache)
+    {
+        if (auto cached = m_upCache->get(key, version))
+        {
+            return cached;
+        }
+    }
+
+    auto result = get(key);
+    if (base::isError(result))
+    {
+        return base::getError(result);
+    }
+
+    auto value = std::make_shared<const json::Json>(base::getResponse<std::string>(result).c_str());
+    if (m_upCache)
+    {
+        m_upCache->put(key, value, version);
+    }
+
+    return value;
+}
+
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHandler::dump(const unsigned int page,
                                                                                             const unsigned int records)
 {
@@ -180,6 +288,47 @@ KVDBHandler::search(const std::string& prefix, const unsigned int page, const un
     return pageContent(page, records, filter);
 }
 
+base::RespOrError<std::list<std::pair<std::string, std::string>>>
+KVDBHandler::scan(const std::string& prefix, const std::string& after, const unsigned int records)
+{
+    auto pRocksDB = m_weakDB.lock();
+    if (pRocksDB)
+    {
+        auto pCFhandle = m_weakCFHandle.lock();
+        if (pCFhandle)
+        {
+            std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(rocksdb::ReadOptions(), pCFhandle.get()));
+            std::list<std::pair<std::string, std::string>> content;
+            const rocksdb::Slice slicePrefix(prefix);
+
+            // The keys are sorted, so the iteration starts at the first candidate key and ends with the prefix
+            iter->Seek(after < prefix ? prefix : after);
+            if (iter->Valid() && !after.empty() && iter->key() == rocksdb::Slice(after))
+            {
+                iter->Next();
+            }
+
+            for (; iter->Valid() && (records == 0 || content.size() < records) && iter->key().starts_with(slicePrefix);
+                 iter->Next())
+            {
+                content.emplace_back(iter->key().ToString(), iter->value().ToString());
+            }
+
+            if (!iter->status().ok())
+            {
+                return base::Error {fmt::format(
+                    "Database '{}': Could not iterate over database: '{}'", m_dbName, iter->status().ToString())};
+            }
+
+            return content;
+        }
+
+        return base::Error {"Can not access RocksDB Column Family Handle"};
+    }
+
+    return base::Error {"Can not access RocksDB::DB"};
+}
+
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error>
 KVDBHandler::pageContent(const unsigned int page, const unsigned int records)
 {
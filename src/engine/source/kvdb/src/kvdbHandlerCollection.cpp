@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <base/logging.hpp>
@@ -7,51 +9,82 @@
 namespace kvdbManager
 {
 
-void KVDBHandlerCollection::addKVDBHandler(const std::string& dbName,
-                                           const std::string& scopeName)
+std::shared_ptr<KVDBHandlerCollection::Counter>
+KVDBHandlerCollection::find(const Registry& registry, const std::string& dbName, const std::string& scopeName)
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    const auto dbIt = registry.find(dbName);
+    if (dbIt == registry.end())
+    {
+        return nullptr;
+    }
 
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+    const auto scopeIt = dbIt->second.find(scopeName);
+    if (scopeIt == dbIt->second.end())
     {
-        auto& instance = it->second;
-        instance->addScope(scopeName);
+        return nullptr;
     }
-    else
+
+    return scopeIt->second;
+}
+
+std::shared_ptr<KVDBHandlerCollection::Counter> KVDBHandlerCollection::counter(const std::string& dbName,
+                                                                               const std::string& scopeName)
+{
+    if (auto found = find(*std::atomic_load(&m_registry), dbName, scopeName))
+    {
+        return found;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Registered by another thread while waiting for the lock
+    const auto current = std::atomic_load(&m_registry);
+    if (auto found = find(*current, dbName, scopeName))
     {
-        auto spInstance = std::make_shared<KVDBHandlerInstance>();
-        spInstance->addScope(scopeName);
-        m_mapInstances.emplace(dbName, std::move(spInstance));
+        return found;
     }
+
+    auto registry = std::make_shared<Registry>(*current);
+    auto added = std::make_shared<Counter>(0);
+    (*registry)[dbName].emplace(scopeName, added);
+    std::atomic_store(&m_registry, std::shared_ptr<const Registry>(std::move(registry)));
+
+    return added;
 }
 
-void KVDBHandlerCollection::removeKVDBHandler(const std::string& dbName, const std::string& scopeName)
+void KVDBHandlerCollection::addKVDBHandler(const std::string& dbName, const std::string& scopeName)
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    counter(dbName, scopeName)->fetch_add(1, std::memory_order_relaxed);
+}
 
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+void KVDBHandlerCollection::removeKVDBHandler(const std::string& dbName, const std::string& scopeName)
+{
+    if (auto found = find(*std::atomic_load(&m_registry), dbName, scopeName))
     {
-        auto& instance = it->second;
-        instance->removeScope(scopeName);
-        if (instance->emptyScopes())
+        auto handlers = found->load(std::memory_order_relaxed);
+        while (handlers > 0 && !found->compare_exchange_weak(handlers, handlers - 1, std::memory_order_relaxed))
         {
-            m_mapInstances.erase(it);
         }
     }
 }
 
 std::vector<std::string> KVDBHandlerCollection::getDBNames()
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    const auto registry = std::atomic_load(&m_registry);
 
     std::vector<std::string> dbNames;
-    dbNames.reserve(m_mapInstances.size());
+    dbNames.reserve(registry->size());
 
-    for (const auto& instance : m_mapInstances)
+    for (const auto& [dbName, scopes] : *registry)
     {
-        dbNames.push_back(instance.first);
+        const auto used = std::any_of(scopes.begin(),
+                                      scopes.end(),
+                                      [](const auto& scope)
+                                      { return scope.second->load(std::memory_order_relaxed) > 0; });
+        if (used)
+        {
+            dbNames.push_back(dbName);
+        }
     }
 
     return dbNames;
@@ -59,50 +92,22 @@ std::vector<std::string> KVDBHandlerCollection::getDBNames()
 
 std::map<std::string, uint32_t> KVDBHandlerCollection::getRefMap(const std::string& dbName)
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    const auto registry = std::atomic_load(&m_registry);
 
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+    std::map<std::string, uint32_t> refMap;
+    const auto it = registry->find(dbName);
+    if (it != registry->end())
     {
-        return it->second->getRefMap();
+        for (const auto& [scopeName, count] : it->second)
+        {
+            if (const auto handlers = count->load(std::memory_order_relaxed); handlers > 0)
+            {
+                refMap.emplace(scopeName, handlers);
+            }
+        }
     }
 
-    return {};
-}
-
-void KVDBHandlerInstance::addScope(const std::string& scopeName)
-{
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
-
-    m_scopeCounter.addRef(scopeName);
-}
-
-void KVDBHandlerInstance::removeScope(const std::string& scopeName)
-{
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
-
-    m_scopeCounter.removeRef(scopeName);
-}
-
-bool KVDBHandlerInstance::emptyScopes()
-{
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
-
-    return m_scopeCounter.empty();
-}
-
-std::vector<std::string> KVDBHandlerInstance::getRefNames()
-{
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
-
-    return m_scopeCounter.getRefNames();
-}
-
-std::map<std::string, uint32_t> KVDBHandlerInstance::getRefMap()
-{
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
-
-    return m_scopeCounter.getRefMap();
+    return refMap;
 }
 
 } // namespace kvdbManager
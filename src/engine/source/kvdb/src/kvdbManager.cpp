@@ -1,15 +1,158 @@
+#include <cstdio>
 #include <filesystem>
 #include <fmt/format.h>
-#include <fstream>
+#include <functional>
 #include <optional>
 
+#include "rocksdb/cache.h"
 #include "rocksdb/db.h"
+#include "rocksdb/filter_policy.h"
 #include "rocksdb/options.h"
+#include "rocksdb/table.h"
+#include "rocksdb/write_batch.h"
+#include "rocksdb/write_buffer_manager.h"
+
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include <kvdb/kvdbManager.hpp>
 #include <base/logging.hpp>
 #include <metrics/metricsManager.hpp>
 
+namespace
+{
+constexpr size_t BLOCK_CACHE_SIZE = 64 * 1024 * 1024;  ///< Block cache shared by all the DBs
+constexpr size_t WRITE_BUFFER_SIZE = 32 * 1024 * 1024; ///< Memtables of all the DBs, charged to the block cache
+constexpr int BLOOM_BITS_PER_KEY = 10;
+constexpr double MEMTABLE_BLOOM_RATIO = 0.02;
+constexpr size_t IMPORT_BATCH_SIZE = 10000;  ///< Entries written to RocksDB at once when importing a DB
+constexpr size_t IMPORT_READ_BUFFER = 65536; ///< Bytes of the file read at once when importing a DB
+constexpr size_t PREWARM_BUDGET = BLOCK_CACHE_SIZE / 2; ///< Bytes of the DBs read into the block cache on prewarm
+constexpr size_t PREWARM_READAHEAD = 2 * 1024 * 1024;   ///< Bytes read ahead by the prewarm iterators
+
+/**
+ * @brief SAX handler that emits each member of the top level object of a JSON document, with its value serialized,
+ * without keeping the document in memory.
+ */
+class ImportHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ImportHandler>
+{
+public:
+    using OnEntry = std::function<bool(const std::string& key, const std::string& value)>;
+
+    explicit ImportHandler(OnEntry onEntry)
+        : m_onEntry {std::move(onEntry)}
+        , m_writer {m_buffer}
+    {
+    }
+
+    bool isObject() const { return !m_notObject; }
+
+    bool Null() { return begin() && m_writer.Null() && end(); }
+    bool Bool(bool b) { return begin() && m_writer.Bool(b) && end(); }
+    bool Int(int i) { return begin() && m_writer.Int(i) && end(); }
+    bool Uint(unsigned u) { return begin() && m_writer.Uint(u) && end(); }
+    bool Int64(int64_t i) { return begin() && m_writer.Int64(i) && end(); }
+    bool Uint64(uint64_t u) { return begin() && m_writer.Uint64(u) && end(); }
+    bool Double(double d) { return begin() && m_writer.Double(d) && end(); }
+    bool String(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        return begin() && m_writer.String(str, length, copy) && end();
+    }
+
+    bool StartObject()
+    {
+        if (m_depth == 0)
+        {
+            m_depth = 1;
+            return true;
+        }
+
+        begin();
+        ++m_depth;
+        return m_writer.StartObject();
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        if (m_depth == 1)
+        {
+            m_key.assign(str, length);
+            return true;
+        }
+
+        return m_writer.Key(str, length, copy);
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount)
+    {
+        if (m_depth == 1)
+        {
+            m_depth = 0;
+            return true;
+        }
+
+        --m_depth;
+        return m_writer.EndObject(memberCount) && end();
+    }
+
+    bool StartArray()
+    {
+        if (!begin())
+        {
+            return false;
+        }
+
+        ++m_depth;
+        return m_writer.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType elementCount)
+    {
+        --m_depth;
+        return m_writer.EndArray(elementCount) && end();
+    }
+
+private:
+    // Called before each value, a value out of the top level object means the document is not an object
+    bool begin()
+    {
+        if (m_depth == 0)
+        {
+            m_notObject = true;
+            return false;
+        }
+
+        if (m_depth == 1)
+        {
+            m_buffer.Clear();
+            m_writer.Reset(m_buffer);
+        }
+
+        return true;
+    }
+
+    // Called after each value, emits the completed members of the top level object
+    bool end()
+    {
+        if (m_depth == 1)
+        {
+            return m_onEntry(m_key, std::string(m_buffer.GetString(), m_buffer.GetSize()));
+        }
+
+        return true;
+    }
+
+    OnEntry m_onEntry;
+    rapidjson::StringBuffer m_buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> m_writer;
+    std::string m_key;
+    size_t m_depth {0};
+    bool m_notObject {false};
+};
+} // namespace
+
 namespace kvdbManager
 {
 
@@ -40,12 +183,98 @@ void KVDBManager::finalize()
     }
 }
 
+std::size_t KVDBManager::prewarm()
+{
+    std::size_t bytes {0};
+    if (!m_isInitialized)
+    {
+        return bytes;
+    }
+
+    rocksdb::ReadOptions readOptions;
+    readOptions.readahead_size = PREWARM_READAHEAD;
+    for (const auto& [name, cfHandle] : m_mapCFHandles)
+    {
+        std::unique_ptr<rocksdb::Iterator> iter(m_pRocksDB->NewIterator(readOptions, cfHandle.get()));
+        for (iter->SeekToFirst(); iter->Valid() && bytes < PREWARM_BUDGET; iter->Next())
+        {
+            bytes += iter->key().size() + iter->value().size();
+        }
+
+        if (bytes >= PREWARM_BUDGET)
+        {
+            LOG_DEBUG("Database '{}': Prewarm stopped, the budget of {} bytes is used.", name, PREWARM_BUDGET);
+            break;
+        }
+    }
+
+    return bytes;
+}
+
+std::size_t KVDBManager::memoryUsage()
+{
+    std::size_t bytes {0};
+    if (!m_isInitialized)
+    {
+        return bytes;
+    }
+
+    bytes += m_blockCache->GetUsage();
+
+    uint64_t tableReaders {0};
+    if (m_pRocksDB->GetAggregatedIntProperty(rocksdb::DB::Properties::kEstimateTableReadersMem, &tableReaders))
+    {
+        bytes += tableReaders;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+    for (const auto& [name, snapshot] : m_mapSnapshots)
+    {
+        bytes += snapshot ? snapshot->bytes() : 0;
+    }
+
+    return bytes;
+}
+
+void KVDBManager::releaseMemory()
+{
+    if (!m_isInitialized)
+    {
+        return;
+    }
+
+    m_blockCache->EraseUnRefEntries();
+
+    // The handlers keep the snapshot they use, the next handler of the DB takes a new one
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+    m_mapSnapshots.clear();
+    LOG_DEBUG("KVDB: Released the unused blocks and snapshots.");
+}
+
 void KVDBManager::initializeOptions()
 {
     m_rocksDBOptions = rocksdb::Options();
     m_rocksDBOptions.IncreaseParallelism();
     m_rocksDBOptions.OptimizeLevelStyleCompaction();
     m_rocksDBOptions.create_if_missing = true;
+
+    // One cache and one memtable budget for all the DBs (column families), instead of the defaults of each one
+    m_blockCache = rocksdb::NewLRUCache(BLOCK_CACHE_SIZE);
+    m_rocksDBOptions.write_buffer_manager =
+        std::make_shared<rocksdb::WriteBufferManager>(WRITE_BUFFER_SIZE, m_blockCache);
+
+    // The DBs are used for point lookups of keys that may be missing
+    rocksdb::BlockBasedTableOptions tableOptions;
+    tableOptions.block_cache = m_blockCache;
+    tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(BLOOM_BITS_PER_KEY));
+    tableOptions.data_block_index_type = rocksdb::BlockBasedTableOptions::kDataBlockBinaryAndHash;
+    tableOptions.cache_index_and_filter_blocks = true;
+    tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+
+    m_cfOptions = rocksdb::ColumnFamilyOptions(m_rocksDBOptions);
+    m_cfOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+    m_cfOptions.memtable_whole_key_filtering = true;
+    m_cfOptions.memtable_prefix_bloom_size_ratio = MEMTABLE_BLOOM_RATIO;
 }
 
 void KVDBManager::initializeMainDB()
@@ -72,7 +301,7 @@ void KVDBManager::initializeMainDB()
                 hasDefaultCF = true;
             }
 
-            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, rocksdb::ColumnFamilyOptions());
+            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, m_cfOptions);
             cfDescriptors.push_back(newDescriptor);
         }
     }
@@ -80,7 +309,7 @@ void KVDBManager::initializeMainDB()
     if (!hasDefaultCF)
     {
         auto newDescriptor =
-            rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions());
+            rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, m_cfOptions);
         cfDescriptors.push_back(newDescriptor);
     }
 
@@ -107,6 +336,11 @@ void KVDBManager::initializeMainDB()
                 m_pDefaultCFHandle = createSharedCFHandle(cfHandles[cfDescriptorIndex]);
             }
         }
+
+        if (m_ManagerOptions.writeBehindWindow.count() > 0)
+        {
+            m_upWriteBehind = std::make_unique<KVDBWriteBehind>(m_pRocksDB, m_ManagerOptions.writeBehindWindow);
+        }
     }
     else
     {
@@ -117,6 +351,8 @@ void KVDBManager::initializeMainDB()
 
 void KVDBManager::finalizeMainDB()
 {
+    // Applies the pending writes before the DB is closed
+    m_upWriteBehind.reset();
     m_mapCFHandles.clear();
     m_pDefaultCFHandle.reset();
     m_pRocksDB.reset();
@@ -138,7 +374,18 @@ base::RespOrError<std::shared_ptr<IKVDBHandler>> KVDBManager::getKVDBHandler(con
 
     m_kvdbHandlerCollection->addKVDBHandler(dbName, scopeName);
 
-    auto kvdbHandler = std::make_shared<KVDBHandler>(m_pRocksDB, cfHandle, m_kvdbHandlerCollection, dbName, scopeName);
+    auto kvdbHandler = std::make_shared<KVDBHandler>(m_pRocksDB,
+                                                     cfHandle,
+                                                     m_kvdbHandlerCollection,
+                                                     dbName,
+                                                     scopeName,
+                                                     getVersion(dbName),
+                                                     m_ManagerOptions.cacheSize,
+                                                     m_ManagerOptions.snapshotDBs.count(dbName) > 0
+                                                         ? getSnapshot(dbName, cfHandle)
+                                                         : nullptr,
+                                                     m_upWriteBehind ? m_upWriteBehind->buffer(dbName, cfHandle)
+                                                                     : nullptr);
 
     return kvdbHandler;
 }
@@ -175,7 +422,14 @@ base::OptError KVDBManager::deleteDB(const std::string& name)
             const auto opStatus = m_pRocksDB->DropColumnFamily(cfHandle.get());
             if (opStatus.ok())
             {
+                if (m_upWriteBehind)
+                {
+                    m_upWriteBehind->drop(name);
+                }
                 m_mapCFHandles.erase(it);
+                std::lock_guard<std::mutex> lock(m_mutexVersions);
+                m_mapVersions.erase(name);
+                m_mapSnapshots.erase(name);
             }
             else
             {
@@ -212,29 +466,38 @@ base::OptError KVDBManager::loadDBFromJson(const std::string& name, const json::
 
     entries = content.getObject().value();
 
+    rocksdb::WriteBatch batch;
     for (const auto& [key, value] : entries)
     {
-        const auto status = m_pRocksDB->Put(rocksdb::WriteOptions(), cfHandle.get(), key, value.str());
-        if (!status.ok())
+        batch.Put(cfHandle.get(), key, value.str());
+        if (batch.Count() >= IMPORT_BATCH_SIZE)
         {
-            return base::Error {fmt::format(
-                "An error occurred while inserting data key {}, value {}: ", key, value.str(), status.ToString())};
+            if (auto error = writeBatch(name, batch))
+            {
+                return error;
+            }
         }
     }
 
-    return std::nullopt;
+    return writeBatch(name, batch);
 }
 
 base::OptError KVDBManager::createDB(const std::string& name, const std::string& path)
 {
-    auto result = getContentFromJsonFile(path);
+    // TODO: No check the size, the location, the type of file, the permissions it's a
+    // security issue. The API should be changed to receive a stream instead of a path
+    if (path.empty())
+    {
+        return base::Error {"The path is empty."};
+    }
 
-    if (std::holds_alternative<base::Error>(result))
+    std::unique_ptr<FILE, decltype(&std::fclose)> file(std::fopen(path.c_str(), "rb"), &std::fclose);
+    if (!file)
     {
-        return std::get<base::Error>(result);
+        return base::Error {fmt::format("An error occurred while opening the file '{}'", path.c_str())};
     }
 
-    auto content = std::get<json::Json>(result);
+    const auto existed = existsDB(name);
     auto errorCreate = createDB(name);
 
     if (errorCreate)
@@ -242,9 +505,10 @@ base::OptError KVDBManager::createDB(const std::string& name, const std::string&
         return errorCreate;
     }
 
-    auto errorLoad = loadDBFromJson(name, content);
+    auto errorLoad = loadDBFromFile(name, file.get(), path);
 
-    if (errorLoad)
+    // Only a DB created here is removed, the entries of a failed import are not rolled back in an existing one
+    if (errorLoad && !existed)
     {
         auto errorDelete = deleteDB(name);
 
@@ -254,9 +518,131 @@ base::OptError KVDBManager::createDB(const std::string& name, const std::string&
         }
     }
 
+    return errorLoad;
+}
+
+base::OptError KVDBManager::loadDBFromFile(const std::string& name, FILE* file, const std::string& path)
+{
+    auto cfHandle = m_mapCFHandles[name];
+    rocksdb::WriteBatch batch;
+    base::OptError errorWrite;
+
+    ImportHandler handler(
+        [&](const std::string& key, const std::string& value)
+        {
+            batch.Put(cfHandle.get(), key, value);
+            if (batch.Count() >= IMPORT_BATCH_SIZE)
+            {
+                errorWrite = writeBatch(name, batch);
+            }
+
+            return !errorWrite;
+        });
+
+    std::vector<char> buffer(IMPORT_READ_BUFFER);
+    rapidjson::FileReadStream stream(file, buffer.data(), buffer.size());
+    rapidjson::Reader reader;
+
+    if (!reader.Parse(stream, handler))
+    {
+        if (errorWrite)
+        {
+            return errorWrite;
+        }
+
+        if (!handler.isObject())
+        {
+            return base::Error {fmt::format(
+                "An error occurred while parsing the JSON file '{}': JSON is not an object", path.c_str())};
+        }
+
+        return base::Error {fmt::format("An error occurred while parsing the JSON file '{}'", path.c_str())};
+    }
+
+    return writeBatch(name, batch);
+}
+
+base::OptError KVDBManager::writeBatch(const std::string& name, rocksdb::WriteBatch& batch)
+{
+    if (batch.Count() == 0)
+    {
+        return std::nullopt;
+    }
+
+    // The buffered writes came first, they must not overwrite the batch later
+    if (m_upWriteBehind)
+    {
+        m_upWriteBehind->flush();
+    }
+
+    const auto status = m_pRocksDB->Write(rocksdb::WriteOptions(), &batch);
+    getVersion(name)->fetch_add(1, std::memory_order_acq_rel);
+    batch.Clear();
+
+    if (!status.ok())
+    {
+        return base::Error {
+            fmt::format("An error occurred while inserting data into the DB '{}': {}", name, status.ToString())};
+    }
+
     return std::nullopt;
 }
 
+std::shared_ptr<KVDBVersion> KVDBManager::getVersion(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+
+    auto& version = m_mapVersions[name];
+    if (!version)
+    {
+        version = std::make_shared<KVDBVersion>(0);
+    }
+
+    return version;
+}
+
+std::shared_ptr<const KVDBSnapshot>
+KVDBManager::getSnapshot(const std::string& name, const std::shared_ptr<rocksdb::ColumnFamilyHandle>& cfHandle)
+{
+    const auto version = getVersion(name)->load(std::memory_order_acquire);
+    {
+        std::lock_guard<std::mutex> lock(m_mutexVersions);
+        auto it = m_mapSnapshots.find(name);
+        if (it != m_mapSnapshots.end() && it->second->version() == version)
+        {
+            return it->second;
+        }
+    }
+
+    // Read after the version, a write while iterating leaves the snapshot stale
+    std::vector<std::pair<std::string, std::string>> entries;
+    std::unique_ptr<rocksdb::Iterator> iter(m_pRocksDB->NewIterator(rocksdb::ReadOptions(), cfHandle.get()));
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next())
+    {
+        entries.emplace_back(iter->key().ToString(), iter->value().ToString());
+    }
+
+    if (!iter->status().ok())
+    {
+        LOG_WARNING("Database '{}': Could not take a snapshot, reading from the DB: '{}'",
+                    name,
+                    iter->status().ToString());
+        return nullptr;
+    }
+
+    auto snapshot = std::make_shared<const KVDBSnapshot>(std::move(entries), version);
+    LOG_DEBUG("Database '{}': Snapshot with {} keys taken.", name, snapshot->size());
+
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+    auto& current = m_mapSnapshots[name];
+    if (!current || current->version() <= version)
+    {
+        current = snapshot;
+    }
+
+    return snapshot;
+}
+
 base::OptError KVDBManager::createDB(const std::string& name)
 {
     if (existsDB(name))
@@ -344,7 +730,7 @@ uint32_t KVDBManager::getKVDBHandlersCount(const std::string& dbName) const
 base::OptError KVDBManager::createColumnFamily(const std::string& name)
 {
     rocksdb::ColumnFamilyHandle* cfHandle {nullptr};
-    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(rocksdb::ColumnFamilyOptions(), name, &cfHandle)};
+    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(m_cfOptions, name, &cfHandle)};
 
     if (s.ok())
     {
@@ -370,52 +756,4 @@ std::shared_ptr<rocksdb::ColumnFamilyHandle> KVDBManager::createSharedCFHandle(r
         });
 }
 
-base::RespOrError<json::Json> KVDBManager::getContentFromJsonFile(const std::string& path)
-{
-    std::vector<std::tuple<std::string, json::Json>> entries {};
-
-    // TODO: to improve
-    if (path.empty())
-    {
-        return base::Error {"The path is empty."};
-    }
-
-    // Open file and read content
-    std::string contents;
-    // TODO: No check the size, the location, the type of file, the permissions it's a
-    // security issue. The API should be changed to receive a stream instead of a path
-    std::ifstream in(path, std::ios::in | std::ios::binary);
-    if (in)
-    {
-        in.seekg(0, std::ios::end);
-        contents.resize(in.tellg());
-        in.seekg(0, std::ios::beg);
-        in.read(&contents[0], static_cast<std::streamsize>(contents.size()));
-        in.close();
-    }
-    else
-    {
-        return base::Error {fmt::format("An error occurred while opening the file '{}'", path.c_str())};
-    }
-
-    json::Json fileContentsJson;
-
-    try
-    {
-        fileContentsJson = json::Json {contents.c_str()};
-    }
-    catch (const std::exception& e)
-    {
-        return base::Error {fmt::format("An error occurred while parsing the JSON file '{}'", path.c_str())};
-    }
-
-    if (!fileContentsJson.isObject())
-    {
-        return base::Error {
-            fmt::format("An error occurred while parsing the JSON file '{}': JSON is not an object", path.c_str())};
-    }
-
-    return fileContentsJson;
-}
-
 } // namespace kvdbManager
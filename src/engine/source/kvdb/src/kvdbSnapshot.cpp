@@ -0,0 +1,153 @@
+#include <kvdb/kvdbSnapshot.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace kvdbManager
+{
+
+namespace
+{
+constexpr std::size_t KEYS_PER_BUCKET = 4;
+constexpr uint32_t MAX_SEED = 1 << 16;
+
+uint64_t hashKey(std::string_view key, uint64_t seed)
+{
+    // FNV-1a, finished with the splitmix64 mixer so the seeds give independent hashes
+    uint64_t hash = 14695981039346656037ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+    for (auto c : key)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+/**
+ * @brief Try to place all the buckets, returns false if one of them finds no seed.
+ */
+bool placeBuckets(const std::vector<std::vector<uint32_t>>& buckets,
+                  const std::vector<KVDBSnapshot::Entry>& entries,
+                  std::vector<uint32_t>& seeds,
+                  std::vector<uint32_t>& slots)
+{
+    std::vector<std::size_t> order(buckets.size());
+    std::iota(order.begin(), order.end(), 0);
+    // Bigger buckets first, while there are more free slots
+    std::stable_sort(
+        order.begin(), order.end(), [&](auto lhs, auto rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+    std::vector<std::size_t> positions;
+    for (auto bucket : order)
+    {
+        const auto& keys = buckets[bucket];
+        if (keys.empty())
+        {
+            break;
+        }
+
+        bool placed = false;
+        for (uint32_t seed = 1; seed < MAX_SEED && !placed; ++seed)
+        {
+            positions.clear();
+            placed = true;
+            for (auto index : keys)
+            {
+                auto pos = hashKey(entries[index].key, seed) % slots.size();
+                if (slots[pos] != 0 || std::find(positions.begin(), positions.end(), pos) != positions.end())
+                {
+                    placed = false;
+                    break;
+                }
+                positions.push_back(pos);
+            }
+
+            if (placed)
+            {
+                seeds[bucket] = seed;
+                for (std::size_t i = 0; i < keys.size(); ++i)
+                {
+                    slots[positions[i]] = keys[i] + 1;
+                }
+            }
+        }
+
+        if (!placed)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
+
+KVDBSnapshot::KVDBSnapshot(std::vector<std::pair<std::string, std::string>> entries, uint64_t version)
+    : m_version {version}
+{
+    m_entries.reserve(entries.size());
+    for (auto& [key, value] : entries)
+    {
+        std::shared_ptr<const json::Json> parsed;
+        try
+        {
+            parsed = std::make_shared<const json::Json>(value.c_str());
+        }
+        catch (const std::runtime_error&)
+        {
+            // Kept as raw string, getJson reports it as malformed
+        }
+        m_bytes += sizeof(Entry) + key.capacity() + value.capacity() * (parsed ? 2 : 1);
+        m_entries.push_back(Entry {std::move(key), std::move(value), std::move(parsed)});
+    }
+
+    if (m_entries.empty())
+    {
+        return;
+    }
+
+    std::vector<std::vector<uint32_t>> buckets((m_entries.size() + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET);
+    for (uint32_t i = 0; i < m_entries.size(); ++i)
+    {
+        buckets[hashKey(m_entries[i].key, 0) % buckets.size()].push_back(i);
+    }
+
+    // Start with a 0.8 load factor, and add room when some bucket can not be placed
+    auto slotCount = m_entries.size() + m_entries.size() / 4 + 1;
+    while (true)
+    {
+        m_seeds.assign(buckets.size(), 0);
+        m_slots.assign(slotCount, 0);
+        if (placeBuckets(buckets, m_entries, m_seeds, m_slots))
+        {
+            break;
+        }
+        slotCount += slotCount / 8 + 1;
+    }
+    m_bytes += (m_seeds.size() + m_slots.size()) * sizeof(uint32_t);
+}
+
+const KVDBSnapshot::Entry* KVDBSnapshot::find(std::string_view key) const
+{
+    if (m_entries.empty())
+    {
+        return nullptr;
+    }
+
+    const auto seed = m_seeds[hashKey(key, 0) % m_seeds.size()];
+    const auto slot = m_slots[hashKey(key, seed) % m_slots.size()];
+    if (slot == 0 || m_entries[slot - 1].key != key)
+    {
+        return nullptr;
+    }
+
+    return &m_entries[slot - 1];
+}
+
+} // namespace kvdbManager
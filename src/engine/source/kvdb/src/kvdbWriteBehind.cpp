@@ -0,0 +1,202 @@
+#include <kvdb/kvdbWriteBehind.hpp>
+
+#include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
+
+#include <base/logging.hpp>
+
+namespace kvdbManager
+{
+
+void KVDBWriteBuffer::write(const std::string& key, Pending pending)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& entry = m_entries[key];
+    entry.pending = std::move(pending);
+    entry.sequence = ++m_sequence;
+    m_size.store(m_entries.size(), std::memory_order_release);
+}
+
+void KVDBWriteBuffer::set(const std::string& key, std::string value)
+{
+    write(key, {false, std::move(value)});
+}
+
+void KVDBWriteBuffer::remove(const std::string& key)
+{
+    write(key, {true, {}});
+}
+
+std::optional<KVDBWriteBuffer::Pending> KVDBWriteBuffer::find(const std::string& key) const
+{
+    // Most of the reads happen with nothing pending, skip the lock
+    if (size() == 0)
+    {
+        return std::nullopt;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return std::nullopt;
+    }
+
+    return it->second.pending;
+}
+
+std::shared_ptr<rocksdb::ColumnFamilyHandle>
+KVDBWriteBuffer::collect(rocksdb::WriteBatch& batch, std::vector<std::pair<std::string, uint64_t>>& collected) const
+{
+    auto pCFhandle = m_weakCFHandle.lock();
+    if (!pCFhandle)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& [key, entry] : m_entries)
+    {
+        const auto status = entry.pending.removed ? batch.Delete(pCFhandle.get(), rocksdb::Slice(key))
+                                                  : batch.Put(pCFhandle.get(),
+                                                              rocksdb::Slice(key),
+                                                              rocksdb::Slice(entry.pending.value));
+        if (status.ok())
+        {
+            collected.emplace_back(key, entry.sequence);
+        }
+    }
+
+    return pCFhandle;
+}
+
+void KVDBWriteBuffer::release(const std::vector<std::pair<std::string, uint64_t>>& collected)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& [key, sequence] : collected)
+    {
+        const auto it = m_entries.find(key);
+        if (it != m_entries.end() && it->second.sequence == sequence)
+        {
+            m_entries.erase(it);
+        }
+    }
+    m_size.store(m_entries.size(), std::memory_order_release);
+}
+
+KVDBWriteBehind::KVDBWriteBehind(std::weak_ptr<rocksdb::DB> weakDB, std::chrono::milliseconds window)
+    : m_weakDB {std::move(weakDB)}
+    , m_window {window}
+{
+    m_thread = std::thread(&KVDBWriteBehind::run, this);
+}
+
+KVDBWriteBehind::~KVDBWriteBehind()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+std::shared_ptr<KVDBWriteBuffer>
+KVDBWriteBehind::buffer(const std::string& dbName, std::weak_ptr<rocksdb::ColumnFamilyHandle> weakCFHandle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& buffer = m_buffers[dbName];
+    if (!buffer)
+    {
+        buffer = std::make_shared<KVDBWriteBuffer>(std::move(weakCFHandle));
+    }
+
+    return buffer;
+}
+
+void KVDBWriteBehind::drop(const std::string& dbName)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.erase(dbName);
+}
+
+void KVDBWriteBehind::flush()
+{
+    std::lock_guard<std::mutex> flushLock(m_flushMutex);
+
+    std::vector<std::shared_ptr<KVDBWriteBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        buffers.reserve(m_buffers.size());
+        for (const auto& [dbName, buffer] : m_buffers)
+        {
+            if (buffer->size() > 0)
+            {
+                buffers.emplace_back(buffer);
+            }
+        }
+    }
+
+    if (buffers.empty())
+    {
+        return;
+    }
+
+    auto pRocksDB = m_weakDB.lock();
+    if (!pRocksDB)
+    {
+        return;
+    }
+
+    rocksdb::WriteBatch batch;
+    std::vector<std::shared_ptr<rocksdb::ColumnFamilyHandle>> cfHandles;
+    std::vector<std::vector<std::pair<std::string, uint64_t>>> collected(buffers.size());
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+    {
+        if (auto pCFhandle = buffers[i]->collect(batch, collected[i]))
+        {
+            cfHandles.emplace_back(std::move(pCFhandle));
+        }
+    }
+
+    if (batch.Count() == 0)
+    {
+        return;
+    }
+
+    const auto status = pRocksDB->Write(rocksdb::WriteOptions(), &batch);
+    if (!status.ok())
+    {
+        LOG_WARNING("KVDB: Could not apply {} buffered writes, retrying later: {}", batch.Count(), status.ToString());
+        return;
+    }
+
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+    {
+        buffers[i]->release(collected[i]);
+    }
+}
+
+void KVDBWriteBehind::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+        m_cv.wait_for(lock, m_window, [this]() { return m_stop; });
+
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+} // namespace kvdbManager
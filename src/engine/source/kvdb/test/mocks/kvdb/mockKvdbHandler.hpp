@@ -82,6 +82,10 @@ public:
                 search,
                 (const std::string& prefix),
                 ());
+    MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>),
+                scan,
+                (const std::string& prefix, const std::string& after, const unsigned int records),
+                (override));
 };
 
 } // namespace kvdb::mocks
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <filesystem>
 #include <gtest/gtest.h>
 #include <iostream>
@@ -95,7 +96,7 @@ protected:
         kvdbPath = uniquePath(KVDB_PATH);
         ::Setup(kvdbPath);
 
-        kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME};
+        kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME, 16};
 
         m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions, metricsManager);
 
@@ -240,6 +241,121 @@ TEST_F(KVDBHandlerTest, GetKeyWithoutValue)
     ASSERT_EQ(std::get<std::string>(resultGet), "");
 }
 
+TEST_F(KVDBHandlerTest, GetJsonInvalidatedByWrites)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("GetJsonInvalidatedByWrites"));
+    auto resultReader = m_kvdbManager->getKVDBHandler("GetJsonInvalidatedByWrites", "scope1");
+    auto resultWriter = m_kvdbManager->getKVDBHandler("GetJsonInvalidatedByWrites", "scope2");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultReader));
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultWriter));
+
+    auto reader = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultReader));
+    auto writer = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultWriter));
+    ASSERT_TRUE(writer->set("key1", json::Json {R"({"field": 1})"}) == std::nullopt);
+
+    auto first = reader->getJson("key1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(first));
+    auto second = reader->getJson("key1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(second));
+    // Served from the cache
+    ASSERT_EQ(std::get<std::shared_ptr<const json::Json>>(first), std::get<std::shared_ptr<const json::Json>>(second));
+
+    // Writing through another handler invalidates it
+    ASSERT_TRUE(writer->set("key1", json::Json {R"({"field": 2})"}) == std::nullopt);
+    auto updated = reader->getJson("key1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(updated));
+    ASSERT_EQ(*std::get<std::shared_ptr<const json::Json>>(updated), json::Json {R"({"field": 2})"});
+
+    ASSERT_TRUE(writer->remove("key1") == std::nullopt);
+    ASSERT_TRUE(std::holds_alternative<base::Error>(reader->getJson("key1")));
+    ASSERT_FALSE(std::get<bool>(reader->contains("key1")));
+
+    ASSERT_TRUE(writer->set("key2", "not json") == std::nullopt);
+    ASSERT_THROW(reader->getJson("key2"), std::runtime_error);
+}
+
+TEST(KVDBHandlerSnapshotTest, ReadsSnapshotUntilWritten)
+{
+    auto kvdbPath = uniquePath(KVDB_PATH).string() + "snapshot/";
+    ::Setup(kvdbPath);
+
+    kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME, 0, {"snapshot"}};
+    auto manager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions, metricsManager);
+    manager->initialize();
+
+    {
+        ASSERT_FALSE(manager->createDB("snapshot"));
+        auto writer = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(manager->getKVDBHandler("snapshot", "s1"));
+        ASSERT_TRUE(writer->set("key1", json::Json {R"({"field": 1})"}) == std::nullopt);
+        ASSERT_TRUE(writer->add("key2") == std::nullopt);
+
+        // Taken when the handler is created
+        auto reader = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(manager->getKVDBHandler("snapshot", "s2"));
+        ASSERT_EQ(std::get<std::string>(reader->get("key1")), R"({"field":1})");
+        ASSERT_EQ(*std::get<std::shared_ptr<const json::Json>>(reader->getJson("key1")),
+                  json::Json {R"({"field": 1})"});
+        ASSERT_TRUE(std::get<bool>(reader->contains("key2")));
+        ASSERT_FALSE(std::get<bool>(reader->contains("key3")));
+        ASSERT_TRUE(std::holds_alternative<base::Error>(reader->get("key3")));
+
+        // Once the DB is written, the reads go to the DB
+        ASSERT_TRUE(writer->set("key3", "value") == std::nullopt);
+        ASSERT_EQ(std::get<std::string>(reader->get("key3")), "value");
+        ASSERT_TRUE(writer->remove("key1") == std::nullopt);
+        ASSERT_FALSE(std::get<bool>(reader->contains("key1")));
+    }
+
+    manager->finalize();
+    ::TearDown(kvdbPath);
+}
+
+TEST(KVDBHandlerWriteBehindTest, ReadsOwnWritesBeforeApplied)
+{
+    auto kvdbPath = uniquePath(KVDB_PATH).string() + "writeBehind/";
+    ::Setup(kvdbPath);
+
+    // Long enough that the writes are only applied by the flush on finalize
+    kvdbManager::KVDBManagerOptions kvdbManagerOptions {
+        kvdbPath, KVDB_DB_FILENAME, 16, {}, std::chrono::milliseconds(60000)};
+    auto manager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions, metricsManager);
+    manager->initialize();
+
+    {
+        ASSERT_FALSE(manager->createDB("buffered"));
+        auto writer = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(manager->getKVDBHandler("buffered", "s1"));
+        auto reader = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(manager->getKVDBHandler("buffered", "s2"));
+
+        ASSERT_TRUE(writer->set("key1", json::Json {R"({"field": 1})"}) == std::nullopt);
+        ASSERT_TRUE(writer->set("key1", json::Json {R"({"field": 2})"}) == std::nullopt);
+        ASSERT_TRUE(writer->add("key2") == std::nullopt);
+        ASSERT_EQ(*std::get<std::shared_ptr<const json::Json>>(reader->getJson("key1")),
+                  json::Json {R"({"field": 2})"});
+        ASSERT_TRUE(std::get<bool>(reader->contains("key2")));
+
+        // Not applied yet
+        ASSERT_TRUE(std::get<std::list<std::pair<std::string, std::string>>>(reader->dump(1, 10)).empty());
+
+        ASSERT_TRUE(writer->remove("key2") == std::nullopt);
+        ASSERT_FALSE(std::get<bool>(reader->contains("key2")));
+        ASSERT_TRUE(std::holds_alternative<base::Error>(reader->get("key2")));
+    }
+
+    manager->finalize();
+
+    // Applied on finalize
+    manager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions, metricsManager);
+    manager->initialize();
+    {
+        auto reader = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(manager->getKVDBHandler("buffered", "s1"));
+        ASSERT_EQ(std::get<std::string>(reader->get("key1")), R"({"field":2})");
+        ASSERT_FALSE(std::get<bool>(reader->contains("key2")));
+    }
+
+    manager->finalize();
+    ::TearDown(kvdbPath);
+}
+
 TEST_F(KVDBHandlerTest, DumpOkValidateOrder)
 {
     ASSERT_FALSE(m_kvdbManager->createDB("DumpOkValidateOrder"));
@@ -292,6 +408,54 @@ TEST_F(KVDBHandlerTest, DumpWihoutKeys)
     ASSERT_EQ(result.size(), 0);
 }
 
+TEST_F(KVDBHandlerTest, ScanResumesAfterKey)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("ScanResumesAfterKey"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("ScanResumesAfterKey", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    for (auto i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(handler->set(fmt::format("a{0}", i), fmt::format("value{0}", i)), std::nullopt);
+        ASSERT_EQ(handler->set(fmt::format("b{0}", i), fmt::format("value{0}", i)), std::nullopt);
+    }
+
+    // All the keys, two at a time
+    std::vector<std::string> keys;
+    std::string after;
+    while (true)
+    {
+        const auto resultScan = handler->scan("", after, 2);
+        ASSERT_FALSE(base::isError(resultScan));
+        const auto& result = base::getResponse(resultScan);
+        if (result.empty())
+        {
+            break;
+        }
+        for (const auto& [key, value] : result)
+        {
+            keys.push_back(key);
+        }
+        after = result.back().first;
+    }
+    ASSERT_EQ(keys.size(), 10);
+    ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    // Only the prefixed keys, from any key
+    const auto resultPrefix = handler->scan("b", "a3", 0);
+    ASSERT_FALSE(base::isError(resultPrefix));
+    const auto& prefixed = base::getResponse(resultPrefix);
+    ASSERT_EQ(prefixed.size(), 5);
+    ASSERT_EQ(prefixed.front().first, "b0");
+    ASSERT_EQ(prefixed.back().first, "b4");
+
+    const auto resultAfter = handler->scan("b", "b2", 0);
+    ASSERT_FALSE(base::isError(resultAfter));
+    ASSERT_EQ(base::getResponse(resultAfter).size(), 2);
+    ASSERT_EQ(base::getResponse(resultAfter).front().first, "b3");
+}
+
 TEST_P(DumpWithMultiplePages, Dump)
 {
     auto [inserts, page, records, expected] = GetParam();
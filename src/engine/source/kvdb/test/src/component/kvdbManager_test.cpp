@@ -100,6 +100,21 @@ TEST_F(KVDBManagerTest, InitializeDBInUseWithOtherManager)
     ASSERT_THROW(kvdbManager->initialize(), std::runtime_error);
 }
 
+TEST_F(KVDBManagerTest, Prewarm)
+{
+    auto manager = std::static_pointer_cast<kvdbManager::KVDBManager>(m_kvdbManager);
+    ASSERT_EQ(manager->prewarm(), 0);
+
+    ASSERT_EQ(m_kvdbManager->createDB("Prewarm"), std::nullopt);
+    {
+        auto handler =
+            std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("Prewarm", "test"));
+        ASSERT_EQ(handler->set("key", "value"), std::nullopt);
+    }
+
+    ASSERT_EQ(manager->prewarm(), std::string("key").size() + std::string("value").size());
+}
+
 TEST_F(KVDBManagerTest, DeleteDB)
 {
     // Create a DB
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <kvdb/kvdbCache.hpp>
+
+using namespace kvdbManager;
+
+namespace
+{
+std::shared_ptr<const json::Json> makeValue(const char* value)
+{
+    return std::make_shared<const json::Json>(value);
+}
+} // namespace
+
+TEST(KVDBCacheTest, InvalidCapacity)
+{
+    ASSERT_THROW(KVDBCache(0), std::runtime_error);
+    ASSERT_NO_THROW(KVDBCache(1));
+}
+
+TEST(KVDBCacheTest, GetPut)
+{
+    KVDBCache cache(16);
+    ASSERT_EQ(cache.get("key", 0), nullptr);
+
+    auto value = makeValue(R"({"a": 1})");
+    cache.put("key", value, 0);
+    ASSERT_EQ(cache.get("key", 0), value);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(KVDBCacheTest, StaleVersion)
+{
+    KVDBCache cache(16);
+    cache.put("key", makeValue("1"), 0);
+
+    ASSERT_EQ(cache.get("key", 1), nullptr);
+    ASSERT_EQ(cache.size(), 0);
+
+    // A slower reader can not replace a newer value
+    auto newer = makeValue("2");
+    cache.put("key", newer, 2);
+    cache.put("key", makeValue("1"), 1);
+    ASSERT_EQ(cache.get("key", 2), newer);
+}
+
+TEST(KVDBCacheTest, EvictsLeastRecentlyUsed)
+{
+    KVDBCache cache(2, 1);
+    cache.put("a", makeValue("1"), 0);
+    cache.put("b", makeValue("2"), 0);
+    ASSERT_NE(cache.get("a", 0), nullptr);
+
+    cache.put("c", makeValue("3"), 0);
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_NE(cache.get("a", 0), nullptr);
+    ASSERT_EQ(cache.get("b", 0), nullptr);
+    ASSERT_NE(cache.get("c", 0), nullptr);
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <fmt/format.h>
+
+#include <kvdb/kvdbSnapshot.hpp>
+
+using namespace kvdbManager;
+
+TEST(KVDBSnapshotTest, Empty)
+{
+    KVDBSnapshot snapshot({}, 3);
+    ASSERT_EQ(snapshot.size(), 0);
+    ASSERT_EQ(snapshot.version(), 3);
+    ASSERT_EQ(snapshot.find("key"), nullptr);
+}
+
+TEST(KVDBSnapshotTest, FindsAllKeys)
+{
+    std::vector<std::pair<std::string, std::string>> entries;
+    for (auto i = 0; i < 5000; ++i)
+    {
+        entries.emplace_back(fmt::format("key-{}", i), fmt::format("{}", i));
+    }
+
+    KVDBSnapshot snapshot(entries, 0);
+    ASSERT_EQ(snapshot.size(), entries.size());
+    for (const auto& [key, value] : entries)
+    {
+        auto entry = snapshot.find(key);
+        ASSERT_NE(entry, nullptr) << key;
+        ASSERT_EQ(entry->key, key);
+        ASSERT_EQ(entry->value, value);
+        ASSERT_NE(entry->json, nullptr);
+    }
+
+    ASSERT_EQ(snapshot.find("key-5000"), nullptr);
+    ASSERT_EQ(snapshot.find(""), nullptr);
+}
+
+TEST(KVDBSnapshotTest, InvalidJsonKeepsValue)
+{
+    KVDBSnapshot snapshot({{"valid", R"({"a": 1})"}, {"invalid", "not json"}, {"empty", ""}}, 0);
+
+    ASSERT_NE(snapshot.find("valid")->json, nullptr);
+    ASSERT_EQ(snapshot.find("invalid")->json, nullptr);
+    ASSERT_EQ(snapshot.find("invalid")->value, "not json");
+    ASSERT_EQ(snapshot.find("empty")->json, nullptr);
+}
@@ -1,7 +1,9 @@
 #ifndef _LOGICEXPR_EVALUATOR_H
 #define _LOGICEXPR_EVALUATOR_H
 
+#include <algorithm>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <stack>
 #include <stdexcept>
@@ -45,6 +47,10 @@ public:
     FunctionType m_function;
     std::shared_ptr<ThisType> m_left, m_right;
 
+    double m_cost {1};       ///< Estimated cost of a term, relative to an equality check
+    double m_passRate {0.5}; ///< Estimated fraction of the events for which a term is true
+    bool m_stateful {false}; ///< The term keeps state between events, its position is never changed
+
     /**
      * @brief Get the Ptr object
      *
@@ -211,6 +217,191 @@ typename Expression<Event>::FunctionType getDijstraEvaluator(const std::shared_p
     };
 }
 
+/**
+ * @brief Estimated cost and pass rate of an expression
+ */
+struct Estimate
+{
+    double cost;           ///< Expected cost of an evaluation, with short-circuit
+    double passRate;       ///< Fraction of the events for which the expression is true
+    bool stateful {false}; ///< The expression has a term that keeps state between events (i.e. a counter)
+};
+
+namespace details
+{
+/**
+ * @brief Collect the operands of a chain of the same commutative operator, i.e. (a AND (b AND c)) -> [a, b, c]
+ */
+template<typename ExpressionPtr>
+void collectOperands(const ExpressionPtr& expression, ExpressionType type, std::vector<ExpressionPtr>& operands)
+{
+    if (expression->m_type == type)
+    {
+        collectOperands<ExpressionPtr>(expression->m_left, type, operands);
+        collectOperands<ExpressionPtr>(expression->m_right, type, operands);
+    }
+    else
+    {
+        operands.push_back(expression);
+    }
+}
+} // namespace details
+
+/**
+ * @brief Reorder the operands of the AND and OR operators to evaluate first the ones that are cheap and decide the
+ * result, using the estimates of the terms (m_cost, m_passRate).
+ *
+ * The operands of a chain of the same operator are sorted by cost / (1 - passRate) for AND and by cost / passRate for
+ * OR, the order that minimizes the expected cost of a short-circuit evaluation of independent operands. The result of
+ * the expression does not change as long as the terms have no side effects. The tree is modified in place.
+ *
+ * A term that keeps state between events (m_stateful) has a side effect: the operands written before it decide which
+ * events reach it. An operand with a stateful term is an ordering barrier, it keeps its position and the other
+ * operands are only reordered between two barriers, never moved across one.
+ *
+ * @tparam Event
+ * @param expression root expression
+ * @return Estimate of the reordered expression
+ */
+template<typename Event>
+Estimate optimize(const std::shared_ptr<Expression<Event>>& expression)
+{
+    switch (expression->m_type)
+    {
+        case ExpressionType::TERM: return {expression->m_cost, expression->m_passRate, expression->m_stateful};
+        case ExpressionType::NOT:
+        {
+            auto estimate = optimize<Event>(expression->m_left);
+            return {estimate.cost, 1 - estimate.passRate, estimate.stateful};
+        }
+        case ExpressionType::AND:
+        case ExpressionType::OR:
+        {
+            const auto type = expression->m_type;
+            const bool isAnd = type == ExpressionType::AND;
+
+            std::vector<std::shared_ptr<Expression<Event>>> operands;
+            details::collectOperands(expression, type, operands);
+
+            std::vector<std::pair<Estimate, std::shared_ptr<Expression<Event>>>> estimated;
+            estimated.reserve(operands.size());
+            for (const auto& operand : operands)
+            {
+                estimated.emplace_back(optimize<Event>(operand), operand);
+            }
+
+            // Probability of deciding the result of the operator after evaluating the operand
+            auto decides = [isAnd](const Estimate& estimate)
+            {
+                return isAnd ? 1 - estimate.passRate : estimate.passRate;
+            };
+            auto rank = [&decides](const Estimate& estimate)
+            {
+                const auto probability = decides(estimate);
+                return probability > 0 ? estimate.cost / probability : std::numeric_limits<double>::max();
+            };
+            auto byRank = [&rank](const auto& lhs, const auto& rhs)
+            {
+                return rank(lhs.first) < rank(rhs.first);
+            };
+
+            // Only the operands between two barriers are sorted
+            auto first = estimated.begin();
+            for (auto it = estimated.begin(); it != estimated.end(); ++it)
+            {
+                if (it->first.stateful)
+                {
+                    std::stable_sort(first, it, byRank);
+                    first = std::next(it);
+                }
+            }
+            std::stable_sort(first, estimated.end(), byRank);
+
+            // Rebuild the chain, the left operand is evaluated first: a OP (b OP (c ...))
+            Estimate total {0, isAnd ? 1.0 : 0.0};
+            double reached {1};
+            for (const auto& [estimate, operand] : estimated)
+            {
+                total.stateful = total.stateful || estimate.stateful;
+                total.cost += reached * estimate.cost;
+                reached *= 1 - decides(estimate);
+                total.passRate =
+                    isAnd ? total.passRate * estimate.passRate : 1 - (1 - total.passRate) * (1 - estimate.passRate);
+            }
+
+            auto node = expression;
+            for (std::size_t i = 0; i + 2 < estimated.size(); ++i)
+            {
+                node->m_left = estimated[i].second;
+                node->m_right = Expression<Event>::create(ExpressionType {type});
+                node = node->m_right;
+            }
+            node->m_left = estimated[estimated.size() - 2].second;
+            node->m_right = estimated.back().second;
+
+            return total;
+        }
+        default: throw std::runtime_error("Engine logic expression optimizer got unknown operator type.");
+    }
+}
+
+/**
+ * @brief Get an evaluator function that stops evaluating the operands of AND and OR as soon as the result is known.
+ *
+ * The operands are evaluated from left to right, use optimize to reorder them before.
+ *
+ * @tparam Event
+ * @param expression root expression
+ * @return Expression<Event>::FunctionType
+ */
+template<typename Event>
+typename Expression<Event>::FunctionType
+getShortCircuitEvaluator(const std::shared_ptr<const Expression<Event>>& expression)
+{
+    using FunctionType = typename Expression<Event>::FunctionType;
+
+    switch (expression->m_type)
+    {
+        case ExpressionType::TERM: return expression->m_function;
+        case ExpressionType::NOT:
+        {
+            auto operand = getShortCircuitEvaluator<Event>(expression->m_left);
+            return [operand](Event event) -> bool
+            {
+                return !operand(event);
+            };
+        }
+        case ExpressionType::AND:
+        case ExpressionType::OR:
+        {
+            // Flatten the chain so each evaluation is a loop instead of nested calls
+            std::vector<std::shared_ptr<const Expression<Event>>> chain;
+            details::collectOperands(expression, expression->m_type, chain);
+            std::vector<FunctionType> operands;
+            operands.reserve(chain.size());
+            for (const auto& operand : chain)
+            {
+                operands.push_back(getShortCircuitEvaluator<Event>(operand));
+            }
+
+            // AND stops at the first false operand, OR at the first true one
+            const bool stopAt = expression->m_type == ExpressionType::OR;
+            return [operands, stopAt](Event event) -> bool
+            {
+                for (const auto& operand : operands)
+                {
+                    if (operand(event) == stopAt)
+                    {
+                        return stopAt;
+                    }
+                }
+                return !stopAt;
+            };
+        }
+        default: throw std::runtime_error("Engine logic expression evaluator got unknown operator type.");
+    }
+}
+
 } // namespace logicexpr::evaluator
 
 #endif // _LOGICEXPR_EVALUATOR_H
@@ -14,6 +14,63 @@
 namespace logicexpr
 {
 
+namespace details
+{
+/**
+ * @brief Generate an evaluator::Expression tree from a parser::Expression tree, building the function of each term
+ * with termBuilder and its estimate with termEstimator.
+ *
+ * The parser links the operands of the binary operators from right to left, they are linked here in the written order
+ * so the short-circuit evaluation follows it between operands of the same estimate.
+ */
+template<typename Event, typename TermType, typename TermBuilder, typename TermEstimator>
+std::shared_ptr<evaluator::Expression<Event>>
+buildExpression(const std::shared_ptr<const parser::Expression>& tokenExpr,
+                const TermBuilder& termBuilder,
+                const TermEstimator& termEstimator)
+{
+    auto builtExpr = evaluator::Expression<Event>::create();
+
+    if (tokenExpr->m_token->isTerm())
+    {
+        auto termToken = tokenExpr->m_token->getPtr<parser::TermToken<TermType>>();
+        builtExpr->m_type = evaluator::ExpressionType::TERM;
+        const auto estimate = termEstimator(termToken->buildToken());
+        builtExpr->m_cost = estimate.cost;
+        builtExpr->m_passRate = estimate.passRate;
+        builtExpr->m_stateful = estimate.stateful;
+        builtExpr->m_function = termBuilder(termToken->buildToken());
+        return builtExpr;
+    }
+
+    if (tokenExpr->m_token->isNot())
+    {
+        builtExpr->m_type = evaluator::ExpressionType::NOT;
+        builtExpr->m_left = buildExpression<Event, TermType>(tokenExpr->m_left, termBuilder, termEstimator);
+        return builtExpr;
+    }
+
+    if (tokenExpr->m_token->isOr())
+    {
+        builtExpr->m_type = evaluator::ExpressionType::OR;
+        builtExpr->m_left = buildExpression<Event, TermType>(tokenExpr->m_right, termBuilder, termEstimator);
+        builtExpr->m_right = buildExpression<Event, TermType>(tokenExpr->m_left, termBuilder, termEstimator);
+        return builtExpr;
+    }
+
+    if (tokenExpr->m_token->isAnd())
+    {
+        builtExpr->m_type = evaluator::ExpressionType::AND;
+        builtExpr->m_left = buildExpression<Event, TermType>(tokenExpr->m_right, termBuilder, termEstimator);
+        builtExpr->m_right = buildExpression<Event, TermType>(tokenExpr->m_left, termBuilder, termEstimator);
+        return builtExpr;
+    }
+
+    throw std::runtime_error(
+        fmt::format("Engine logic expression: Unexpected token type of token '{}'", tokenExpr->m_token->text()));
+}
+} // namespace details
+
 /**
  * @brief Generate evaluation function from a string logic expression.
  * This function parses the string and generates a token tree, then uses the
@@ -31,57 +88,49 @@ template<typename Event, typename TermType, typename TermBuilder, typename TermP
 std::function<bool(Event)>
 buildDijstraEvaluator(const std::string& expression, TermBuilder&& termBuilder, TermParser&& termParser)
 {
-
-    // visitor to generate an evaluator::Expression tree from a
-    // parser::Expression tree and a term builder function.
-    auto visit = [termBuilder](const std::shared_ptr<const parser::Expression>& tokenExpr,
-                               auto& visitRef) -> std::shared_ptr<evaluator::Expression<Event>>
+    auto defaultEstimate = [](const TermType&)
     {
-        auto builtExpr = evaluator::Expression<Event>::create();
-
-        if (tokenExpr->m_token->isTerm())
-        {
-            auto termToken = tokenExpr->m_token->getPtr<parser::TermToken<TermType>>();
-            builtExpr->m_type = evaluator::ExpressionType::TERM;
-            builtExpr->m_function = termBuilder(termToken->buildToken());
-            return builtExpr;
-        }
-
-        if (tokenExpr->m_token->isNot())
-        {
-            builtExpr->m_type = evaluator::ExpressionType::NOT;
-            builtExpr->m_left = visitRef(tokenExpr->m_left, visitRef);
-            return builtExpr;
-        }
-
-        if (tokenExpr->m_token->isOr())
-        {
-            builtExpr->m_type = evaluator::ExpressionType::OR;
-            builtExpr->m_left = visitRef(tokenExpr->m_left, visitRef);
-            builtExpr->m_right = visitRef(tokenExpr->m_right, visitRef);
-            return builtExpr;
-        }
-
-        if (tokenExpr->m_token->isAnd())
-        {
-            builtExpr->m_type = evaluator::ExpressionType::AND;
-            builtExpr->m_left = visitRef(tokenExpr->m_left, visitRef);
-            builtExpr->m_right = visitRef(tokenExpr->m_right, visitRef);
-            return builtExpr;
-        }
-
-        throw std::runtime_error(
-            fmt::format("Engine logic expression: Unexpected token type of token '{}'", tokenExpr->m_token->text()));
+        return evaluator::Estimate {1, 0.5};
     };
 
     // Parse, build and return the evaluator function.
     auto tokenExpression = parser::parse(expression, std::forward<TermParser>(termParser));
-    auto builtExprPtr = visit(tokenExpression, visit);
+    auto builtExprPtr = details::buildExpression<Event, TermType>(tokenExpression, termBuilder, defaultEstimate);
     auto evaluatorFunction = evaluator::getDijstraEvaluator<Event>(builtExprPtr);
 
     return evaluatorFunction;
 }
 
+/**
+ * @brief Generate a short-circuit evaluation function from a string logic expression, with the operands of the AND
+ * and OR operators reordered by the estimated cost and pass rate of their terms.
+ *
+ * Equivalent to buildDijstraEvaluator if the terms have no side effects, but the cheap terms that decide the result
+ * (i.e. an existence check) are evaluated before the expensive ones (i.e. a regex or a kvdb lookup), and the rest
+ * are skipped. The terms estimated as stateful keep their written position, they only see the events that the
+ * operands written before them let through.
+ *
+ * @tparam Event Type of the event to be evaluated.
+ * @param expression String logic expression.
+ * @param termBuilder Builder to generate the term's evaluation function from its description.
+ * @param termParser Parser to parse the term's of the expression.
+ * @param termEstimator Estimator of the cost and pass rate of a term from its description, returns an
+ * evaluator::Estimate.
+ * @return std::function<bool(Event)> Evaluation function.
+ */
+template<typename Event, typename TermType, typename TermBuilder, typename TermParser, typename TermEstimator>
+std::function<bool(Event)> buildShortCircuitEvaluator(const std::string& expression,
+                                                      TermBuilder&& termBuilder,
+                                                      TermParser&& termParser,
+                                                      TermEstimator&& termEstimator)
+{
+    auto tokenExpression = parser::parse(expression, std::forward<TermParser>(termParser));
+    auto builtExprPtr = details::buildExpression<Event, TermType>(tokenExpression, termBuilder, termEstimator);
+    evaluator::optimize<Event>(builtExprPtr);
+
+    return evaluator::getShortCircuitEvaluator<Event>(builtExprPtr);
+}
+
 } // namespace logicexpr
 
 #endif // _LOGIC_EXPRESSION_H
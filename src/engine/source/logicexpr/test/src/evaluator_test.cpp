@@ -107,3 +107,158 @@ TEST(LogicExpressionEvaluator, getDijstraEvaluatorSingleTerm)
     EXPECT_TRUE(evaluator(6));
     EXPECT_FALSE(evaluator(7));
 }
+
+TEST(LogicExpressionEvaluator, getShortCircuitEvaluator)
+{
+    // True if: (pair or not i>5) and i>1
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = Expression<int>::create([](int i) { return i > 1; });
+    root->m_right = Expression<int>::create(ExpressionType::OR);
+    root->m_right->m_left = Expression<int>::create([](int i) { return i % 2 == 0; });
+    root->m_right->m_right = Expression<int>::create(ExpressionType::NOT);
+    root->m_right->m_right->m_left = Expression<int>::create([](int i) { return i > 5; });
+
+    std::function<bool(int)> evaluator;
+    ASSERT_NO_THROW(evaluator = getShortCircuitEvaluator<int>(root));
+    auto dijstra = getDijstraEvaluator<int>(root);
+    for (auto i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(evaluator(i), dijstra(i)) << i;
+    }
+}
+
+TEST(LogicExpressionEvaluator, getShortCircuitEvaluatorSkipsOperands)
+{
+    auto calls = std::make_shared<int>(0);
+    auto counted = [calls](bool result)
+    {
+        return Expression<int>::create(
+            [calls, result](int)
+            {
+                ++(*calls);
+                return result;
+            });
+    };
+
+    auto andRoot = Expression<int>::create(ExpressionType::AND);
+    andRoot->m_left = counted(false);
+    andRoot->m_right = counted(true);
+    EXPECT_FALSE(getShortCircuitEvaluator<int>(andRoot)(0));
+    EXPECT_EQ(*calls, 1);
+
+    *calls = 0;
+    auto orRoot = Expression<int>::create(ExpressionType::OR);
+    orRoot->m_left = counted(true);
+    orRoot->m_right = counted(false);
+    EXPECT_TRUE(getShortCircuitEvaluator<int>(orRoot)(0));
+    EXPECT_EQ(*calls, 1);
+}
+
+TEST(LogicExpressionEvaluator, optimizeOrdersByCost)
+{
+    auto term = [](double cost, double passRate, int id)
+    {
+        auto expression = Expression<int>::create([id](int i) { return i == id; });
+        expression->m_cost = cost;
+        expression->m_passRate = passRate;
+        return expression;
+    };
+
+    // (expensive AND (medium AND cheap)) -> cheap AND (medium AND expensive)
+    auto expensive = term(100, 0.5, 1);
+    auto medium = term(10, 0.5, 2);
+    auto cheap = term(1, 0.5, 3);
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = expensive;
+    root->m_right = Expression<int>::create(ExpressionType::AND);
+    root->m_right->m_left = medium;
+    root->m_right->m_right = cheap;
+
+    auto estimate = optimize<int>(root);
+    EXPECT_EQ(root->m_left, cheap);
+    ASSERT_EQ(root->m_right->m_type, ExpressionType::AND);
+    EXPECT_EQ(root->m_right->m_left, medium);
+    EXPECT_EQ(root->m_right->m_right, expensive);
+    EXPECT_DOUBLE_EQ(estimate.cost, 1 + 0.5 * 10 + 0.25 * 100);
+    EXPECT_DOUBLE_EQ(estimate.passRate, 0.125);
+}
+
+TEST(LogicExpressionEvaluator, optimizeOrdersBySelectivity)
+{
+    auto term = [](double cost, double passRate)
+    {
+        auto expression = Expression<int>::create([](int) { return true; });
+        expression->m_cost = cost;
+        expression->m_passRate = passRate;
+        return expression;
+    };
+
+    // Same cost, the OR evaluates first the operand that is true more often
+    auto rare = term(1, 0.1);
+    auto frequent = term(1, 0.9);
+    auto root = Expression<int>::create(ExpressionType::OR);
+    root->m_left = rare;
+    root->m_right = frequent;
+    optimize<int>(root);
+    EXPECT_EQ(root->m_left, frequent);
+    EXPECT_EQ(root->m_right, rare);
+
+    // The NOT inverts the pass rate of its operand, the AND evaluates first the operand that is false more often
+    auto notFrequent = Expression<int>::create(ExpressionType::NOT);
+    notFrequent->m_left = term(1, 0.9);
+    auto andRoot = Expression<int>::create(ExpressionType::AND);
+    andRoot->m_left = term(1, 0.5);
+    andRoot->m_right = notFrequent;
+    optimize<int>(andRoot);
+    EXPECT_EQ(andRoot->m_left, notFrequent);
+}
+
+TEST(LogicExpressionEvaluator, optimizeKeepsTheStatefulTermsInPlace)
+{
+    auto term = [](double cost, bool stateful = false)
+    {
+        auto expression = Expression<int>::create([](int) { return true; });
+        expression->m_cost = cost;
+        expression->m_stateful = stateful;
+        return expression;
+    };
+
+    // (d AND (counter AND (c AND (b AND a)))), the cheapest terms are written last
+    auto a = term(1);
+    auto b = term(2);
+    auto c = term(3);
+    auto counter = term(5, true);
+    auto d = term(10);
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = d;
+    root->m_right = Expression<int>::create(ExpressionType::AND);
+    root->m_right->m_left = counter;
+    root->m_right->m_right = Expression<int>::create(ExpressionType::AND);
+    root->m_right->m_right->m_left = c;
+    root->m_right->m_right->m_right = Expression<int>::create(ExpressionType::AND);
+    root->m_right->m_right->m_right->m_left = b;
+    root->m_right->m_right->m_right->m_right = a;
+
+    // The counter only sees the events accepted by d, the terms after it are sorted among them
+    auto estimate = optimize<int>(root);
+    std::vector<std::shared_ptr<Expression<int>>> order;
+    details::collectOperands(root, ExpressionType::AND, order);
+    ASSERT_EQ(order.size(), 5);
+    EXPECT_EQ(order[0], d);
+    EXPECT_EQ(order[1], counter);
+    EXPECT_EQ(order[2], a);
+    EXPECT_EQ(order[3], b);
+    EXPECT_EQ(order[4], c);
+    EXPECT_TRUE(estimate.stateful);
+
+    // A NOT or an OR with a stateful term is a barrier too
+    auto notCounter = Expression<int>::create(ExpressionType::NOT);
+    notCounter->m_left = term(5, true);
+    auto cheap = term(1);
+    auto andRoot = Expression<int>::create(ExpressionType::AND);
+    andRoot->m_left = notCounter;
+    andRoot->m_right = cheap;
+    optimize<int>(andRoot);
+    EXPECT_EQ(andRoot->m_left, notCounter);
+    EXPECT_EQ(andRoot->m_right, cheap);
+}
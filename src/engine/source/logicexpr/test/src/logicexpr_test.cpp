@@ -75,3 +75,79 @@ TEST(LogicExpression, buildDijstraEvaluator)
     EXPECT_TRUE(evaluator(6));
     EXPECT_FALSE(evaluator(7));
 }
+
+TEST(LogicExpression, buildShortCircuitEvaluator)
+{
+    auto calls = std::make_shared<std::vector<std::string>>();
+    auto fakeTermBuilder = [calls](std::string s) -> std::function<bool(int)>
+    {
+        if (s == "even")
+        {
+            return [calls](int i)
+            {
+                calls->push_back("even");
+                return i % 2 == 0;
+            };
+        }
+        else if (s == "great1")
+        {
+            return [calls](int i)
+            {
+                calls->push_back("great1");
+                return i > 1;
+            };
+        }
+        else if (s == "expensive")
+        {
+            return [calls](int i)
+            {
+                calls->push_back("expensive");
+                return i < 5;
+            };
+        }
+        else
+        {
+            throw std::runtime_error("Error test fakeBuilder, got unexpected term: " + s);
+        }
+    };
+
+    auto fakeTermEstimator = [](const std::string& s)
+    {
+        return evaluator::Estimate {s == "expensive" ? 100.0 : 1.0, 0.5};
+    };
+
+    parsec::Parser<std::string> termP = [](std::string_view text, size_t pos) -> parsec::Result<std::string>
+    {
+        auto end = text.find_first_of(" ()", pos);
+        if (end == std::string_view::npos)
+        {
+            end = text.size();
+        }
+        if (std::isupper(text[pos]) || text[pos] == '(' || text[pos] == ')')
+        {
+            return parsec::makeError<std::string>("Unexpected token", pos);
+        }
+        return parsec::makeSuccess<std::string>(std::string {text.substr(pos, end - pos)}, end);
+    };
+
+    // True if: 2, 4
+    auto expression = "expensive AND (even AND great1)";
+    std::function<bool(int)> evaluator;
+    EXPECT_NO_THROW((evaluator = buildShortCircuitEvaluator<int, std::string>(
+                         expression, fakeTermBuilder, termP, fakeTermEstimator)));
+
+    EXPECT_FALSE(evaluator(0));
+    EXPECT_FALSE(evaluator(1));
+    EXPECT_TRUE(evaluator(2));
+    EXPECT_FALSE(evaluator(3));
+    EXPECT_TRUE(evaluator(4));
+    EXPECT_FALSE(evaluator(6));
+
+    // The expensive term is evaluated last, only if the cheap ones are true
+    calls->clear();
+    evaluator(1);
+    EXPECT_EQ(*calls, (std::vector<std::string> {"even"}));
+    calls->clear();
+    evaluator(2);
+    EXPECT_EQ(*calls, (std::vector<std::string> {"even", "great1", "expensive"}));
+}
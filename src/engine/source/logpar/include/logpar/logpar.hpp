@@ -1,12 +1,15 @@
 #ifndef _LOGPAR_HPP
 #define _LOGPAR_HPP
 
+#include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include <hlp/hlp.hpp>
 #include <base/json.hpp>
@@ -382,6 +385,20 @@ private:
     std::unordered_map<SchemaType, ParserType> m_typeParsers;
     std::unordered_map<ParserType, ParserBuilder> m_parserBuilders;
 
+    // Parsers already built, by expression or by field configuration. They are kept while any decoder uses them
+    mutable std::mutex m_cacheMutex;
+    mutable std::unordered_map<std::string, std::weak_ptr<const Hlp>> m_cache;
+    mutable size_t m_cachePurgeAt {64};
+
+    /**
+     * @brief Get the parser of the key from the cache, or build and cache it
+     *
+     * @param key identifies everything the parser is built from
+     * @param build builds the parser if it is not in the cache
+     * @return Hlp parser that shares the cached one
+     */
+    Hlp cached(const std::string& key, const std::function<Hlp()>& build) const;
+
     // build the parsers from the different parser info types
     Hlp buildLiteralParser(const parser::Literal& literal) const;
     Hlp buildFieldParser(const parser::Field& field, const std::vector<std::string>& endTokens = {}) const;
@@ -391,6 +408,9 @@ private:
     // build the parsers while adding the target field to the json
     Hlp buildParsers(const std::list<parser::ParserInfo>& parserInfos, size_t recurLvl) const;
 
+    // parse a logpar expression into its parser infos
+    std::list<parser::ParserInfo> parseExpression(std::string_view logpar) const;
+
 public:
     /**
      * @brief Construct a new Logpar object
@@ -426,6 +446,37 @@ public:
      * @throws std::runtime_error if errors occur while building the parser
      */
     Hlp build(std::string_view logpar) const;
+
+    /**
+     * @brief Alternative logpar expressions that start with the same parsers
+     *
+     * The prefix is parsed once, then the suffix of each alternative is tried in order from where the prefix ended.
+     */
+    struct Alternatives
+    {
+        Hlp prefix;                  ///< Parser of the prefix shared by the alternatives, empty if not shared
+        std::vector<Hlp> suffixes;   ///< Parser of the rest of each alternative, in order
+        std::vector<size_t> indexes; ///< Index of each alternative in the expressions built
+    };
+
+    /**
+     * @brief Build the parsers of alternative logpar expressions, merging the consecutive expressions that start with
+     * the same literals and fields
+     *
+     * Trying the alternatives of each group in order gives the same result as trying each expression in order.
+     *
+     * @param logpars the logpar expressions, in order
+     * @return std::vector<Alternatives> the groups of alternatives, in order
+     * @throws std::runtime_error if errors occur while building any parser
+     */
+    std::vector<Alternatives> buildAlternatives(const std::vector<std::string>& logpars) const;
+
+    /**
+     * @brief Get the number of distinct parsers in use, built by this object
+     *
+     * @return size_t number of cached parsers still alive
+     */
+    size_t cachedParsers() const;
 };
 } // namespace logpar
 } // namespace hlp
@@ -1,14 +1,78 @@
 #include "logpar.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <list>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 
 #include <fmt/format.h>
+#include <parsec/static.hpp>
 
 namespace hlp::logpar::parser
 {
+namespace
+{
+/*
+ * Static counterparts of the character parsers. The literal, argument and field name parsers try them once per
+ * character, so they are combined with parsec::st and only erased into a parsec::Parser once built.
+ */
+auto stChar(std::string chars)
+{
+    return parsec::st::make(
+        [chars = std::move(chars)](std::string_view t, size_t i)
+        {
+            if (i < t.size() && chars.find(t[i]) != std::string::npos)
+            {
+                return parsec::st::makeSuccess(char {t[i]}, i + 1);
+            }
+
+            return parsec::st::makeError<char>("Unexpected character", i);
+        });
+}
+
+auto stNotChar(std::string chars)
+{
+    return parsec::st::make(
+        [chars = std::move(chars)](std::string_view t, size_t i)
+        {
+            if (i < t.size() && chars.find(t[i]) == std::string::npos)
+            {
+                return parsec::st::makeSuccess(char {t[i]}, i + 1);
+            }
+
+            return parsec::st::makeError<char>("Expected a character that is not reserved", i);
+        });
+}
+
+auto stCharAlphaNum(std::string extended)
+{
+    return parsec::st::make(
+        [extended = std::move(extended)](std::string_view t, size_t i)
+        {
+            if (i < t.size()
+                && ((t[i] >= 'a' && t[i] <= 'z') || (t[i] >= 'A' && t[i] <= 'Z') || (t[i] >= '0' && t[i] <= '9')
+                    || extended.find(t[i]) != std::string::npos))
+            {
+                return parsec::st::makeSuccess(char {t[i]}, i + 1);
+            }
+
+            return parsec::st::makeError<char>("Expected an alphanumeric character", i);
+        });
+}
+
+auto stRawChar(const std::string& reservedChars, char esc)
+{
+    return stNotChar(reservedChars + esc) | (stChar(std::string {esc}) >> stChar(reservedChars + esc));
+}
+
+std::string toString(const parsec::st::Values<char>& values)
+{
+    return std::string {values.begin(), values.end()};
+}
+} // namespace
+
 parsec::Parser<char> pChar(std::string chars)
 {
     return [=](std::string_view t, size_t i)
@@ -60,32 +124,12 @@ parsec::Parser<char> pEscapedChar(std::string chars, char esc)
 
 parsec::Parser<std::string> pRawLiteral(std::string reservedChars, char esc)
 {
-    return parsec::fmap<std::string, parsec::Values<char>>(
-        [=](parsec::Values<char> values)
-        {
-            std::string result {};
-            for (auto c : values)
-            {
-                result += c;
-            }
-            return result;
-        },
-        parsec::many(pNotChar(reservedChars + esc) | pEscapedChar(reservedChars, esc)));
+    return parsec::st::erase(parsec::st::fmap(toString, parsec::st::many(stRawChar(reservedChars, esc))));
 }
 
 parsec::Parser<std::string> pRawLiteral1(std::string reservedChars, char esc)
 {
-    return parsec::fmap<std::string, parsec::Values<char>>(
-        [=](parsec::Values<char> values)
-        {
-            std::string result {};
-            for (auto c : values)
-            {
-                result += c;
-            }
-            return result;
-        },
-        parsec::many1(pNotChar(reservedChars + esc) | pEscapedChar(reservedChars, esc)));
+    return parsec::st::erase(parsec::st::fmap(toString, parsec::st::many1(stRawChar(reservedChars, esc))));
 }
 
 parsec::Parser<char> pCharAlphaNum(std::string extended)
@@ -113,10 +157,18 @@ parsec::Parser<char> pCharAlphaNum(std::string extended)
 
 parsec::Parser<parsec::Values<std::string>> pArgs()
 {
-    auto pArg =
-        pChar({syntax::EXPR_ARG_SEP}) >> pRawLiteral({syntax::EXPR_ARG_SEP, syntax::EXPR_END}, {syntax::EXPR_ESCAPE});
+    auto pArg = stChar({syntax::EXPR_ARG_SEP})
+                >> parsec::st::fmap(toString,
+                                    parsec::st::many(stRawChar({syntax::EXPR_ARG_SEP, syntax::EXPR_END},
+                                                               syntax::EXPR_ESCAPE)));
 
-    return parsec::many(pArg);
+    return parsec::st::erase(parsec::st::fmap(
+        [](parsec::st::Values<std::string>&& args)
+        {
+            return parsec::Values<std::string> {std::make_move_iterator(args.begin()),
+                                                std::make_move_iterator(args.end())};
+        },
+        parsec::st::many(pArg)));
 }
 
 parsec::Parser<FieldName> pFieldName()
@@ -124,20 +176,16 @@ parsec::Parser<FieldName> pFieldName()
     std::string extendedChars = syntax::EXPR_FIELD_EXTENDED_CHARS;
     extendedChars += syntax::EXPR_FIELD_SEP;
     std::string extendedCharsFirst = syntax::EXPR_FIELD_EXTENDED_CHARS_FIRST;
-    auto pName = parsec::fmap<std::string, std::tuple<char, parsec::Values<char>>>(
-        [](auto t)
+    auto pName = stCharAlphaNum(extendedCharsFirst) & parsec::st::many(stCharAlphaNum(extendedChars));
+
+    return parsec::st::erase(parsec::st::fmap(
+        [](std::tuple<char, parsec::st::Values<char>>&& t)
         {
-            std::string result {};
-            result.push_back(std::get<0>(t));
-            for (auto c : std::get<1>(t))
-            {
-                result += c;
-            }
-            return result;
+            std::string result {std::get<0>(t)};
+            result += toString(std::get<1>(t));
+            return FieldName {std::move(result)};
         },
-        pCharAlphaNum(extendedCharsFirst) & parsec::many(pCharAlphaNum(extendedChars)));
-
-    return parsec::fmap<FieldName, std::string>([](auto s) { return FieldName {s}; }, pName);
+        pName));
 }
 
 parsec::Parser<Field> pField()
@@ -425,15 +473,28 @@ Logpar::Hlp Logpar::buildFieldParser(const parser::Field& field, const std::vect
         builderParams.targetField = json::Json::formatJsonPath(field.name.value);
     }
 
-    auto p = m_parserBuilders.at(type)(builderParams);
-
-    // If field is optional, wrap in optional parser
-    if (field.optional)
-    {
-        p = hlp::parser::combinator::opt(p);
-    }
-
-    return p;
+    // The field parser only depends on its type, params and if it is optional
+    auto key = fmt::format("field\x1f{}\x1f{}\x1f{}\x1f{}\x1f{}\x1f{}",
+                           parserTypeToStr(type),
+                           builderParams.name,
+                           builderParams.targetField,
+                           field.optional,
+                           fmt::join(builderParams.stop, "\x1e"),
+                           fmt::join(builderParams.options, "\x1e"));
+
+    return cached(key,
+                  [&]()
+                  {
+                      auto p = m_parserBuilders.at(type)(builderParams);
+
+                      // If field is optional, wrap in optional parser
+                      if (field.optional)
+                      {
+                          p = hlp::parser::combinator::opt(p);
+                      }
+
+                      return p;
+                  });
 }
 
 Logpar::Hlp Logpar::buildChoiceParser(const parser::Choice& choice, const std::vector<std::string>& endTokens) const
@@ -633,7 +694,7 @@ void Logpar::registerBuilder(ParserType type, const ParserBuilder& builder)
     m_parserBuilders[type] = builder;
 }
 
-Logpar::Hlp Logpar::build(std::string_view logpar) const
+std::list<parser::ParserInfo> Logpar::parseExpression(std::string_view logpar) const
 {
     auto result = parser::pLogpar()(logpar, 0);
     if (result.failure())
@@ -641,10 +702,162 @@ Logpar::Hlp Logpar::build(std::string_view logpar) const
         throw std::runtime_error(parsec::formatTrace(logpar, result.trace(), 1));
     }
 
-    auto parserInfos = result.value();
-    auto p = buildParsers(parserInfos, 0);
+    return result.value();
+}
+
+Logpar::Hlp Logpar::build(std::string_view logpar) const
+{
+    auto parserInfos = parseExpression(logpar);
+    return cached(fmt::format("expr\x1f{}", logpar),
+                  [&]()
+                  {
+                      auto p = buildParsers(parserInfos, 0);
+                      return hlp::parser::combinator::all({p, hlp::parsers::getEofParser({.name = "EOF"})});
+                  });
+}
+
+namespace
+{
+/**
+ * @brief Number of leading parser infos of two expressions whose parsers are built the same way
+ *
+ * A literal only depends on itself. A field or choice depends on the end tokens given by the next parser info, so the
+ * next one must also be the same. Groups, and fields followed by a group, are never shared.
+ */
+size_t sharedPrefix(const std::list<parser::ParserInfo>& lhs, const std::list<parser::ParserInfo>& rhs)
+{
+    size_t equal = 0;
+    for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end() && r != rhs.end() && *l == *r; ++l, ++r)
+    {
+        ++equal;
+    }
+
+    size_t shared = 0;
+    for (auto it = lhs.begin(); shared < equal; ++it, ++shared)
+    {
+        if (std::holds_alternative<parser::Literal>(*it))
+        {
+            continue;
+        }
+
+        if (std::holds_alternative<parser::Group>(*it) || shared + 1 >= equal
+            || std::holds_alternative<parser::Group>(*std::next(it)))
+        {
+            break;
+        }
+    }
+
+    return shared;
+}
+} // namespace
+
+std::vector<Logpar::Alternatives> Logpar::buildAlternatives(const std::vector<std::string>& logpars) const
+{
+    std::vector<std::list<parser::ParserInfo>> infos;
+    infos.reserve(logpars.size());
+    for (const auto& logpar : logpars)
+    {
+        infos.emplace_back(parseExpression(logpar));
+    }
+
+    const auto eof = hlp::parsers::getEofParser({.name = "EOF"});
+
+    std::vector<Alternatives> groups;
+    size_t first = 0;
+    while (first < infos.size())
+    {
+        // Extend the group while the next expression shares the whole prefix of the group
+        size_t prefixLen = 0;
+        auto last = first + 1;
+        for (; last < infos.size(); ++last)
+        {
+            const auto shared = sharedPrefix(infos[first], infos[last]);
+            if (shared == 0 || (last > first + 1 && shared < prefixLen))
+            {
+                break;
+            }
+            prefixLen = last == first + 1 ? shared : std::min(prefixLen, shared);
+        }
+
+        Alternatives group;
+        if (prefixLen > 0)
+        {
+            std::list<parser::ParserInfo> prefix(infos[first].begin(), std::next(infos[first].begin(), prefixLen));
+            group.prefix = buildParsers(prefix, 0);
+        }
+
+        for (auto i = first; i < last; ++i)
+        {
+            if (prefixLen == 0)
+            {
+                group.suffixes.emplace_back(build(logpars[i]));
+            }
+            else
+            {
+                std::list<parser::ParserInfo> suffix(std::next(infos[i].begin(), prefixLen), infos[i].end());
+                group.suffixes.emplace_back(hlp::parser::combinator::all({buildParsers(suffix, 0), eof}));
+            }
+            group.indexes.emplace_back(i);
+        }
+
+        groups.emplace_back(std::move(group));
+        first = last;
+    }
+
+    return groups;
+}
+
+Logpar::Hlp Logpar::cached(const std::string& key, const std::function<Hlp()>& build) const
+{
+    auto share = [](std::shared_ptr<const Hlp> parser) -> Hlp
+    {
+        return [parser](std::string_view txt)
+        {
+            return (*parser)(txt);
+        };
+    };
 
-    return hlp::parser::combinator::all({p, hlp::parsers::getEofParser({.name = "EOF"})});
+    {
+        std::lock_guard<std::mutex> lock {m_cacheMutex};
+        auto it = m_cache.find(key);
+        if (it != m_cache.end())
+        {
+            if (auto parser = it->second.lock())
+            {
+                return share(parser);
+            }
+        }
+    }
+
+    // Built without the lock, as building a parser builds and caches its inner parsers
+    auto parser = std::make_shared<const Hlp>(build());
+
+    std::lock_guard<std::mutex> lock {m_cacheMutex};
+    auto& entry = m_cache[key];
+    if (auto other = entry.lock())
+    {
+        // Built meanwhile by other thread
+        return share(other);
+    }
+    entry = parser;
+
+    // Drop the parsers no longer used, not on every insertion
+    if (m_cache.size() >= m_cachePurgeAt)
+    {
+        for (auto it = m_cache.begin(); it != m_cache.end();)
+        {
+            it = it->second.expired() ? m_cache.erase(it) : std::next(it);
+        }
+        m_cachePurgeAt = std::max<size_t>(64, m_cache.size() * 2);
+    }
+
+    return share(parser);
+}
+
+size_t Logpar::cachedParsers() const
+{
+    std::lock_guard<std::mutex> lock {m_cacheMutex};
+    return std::count_if(m_cache.begin(), m_cache.end(), [](const auto& entry) { return !entry.second.expired(); });
 }
 
 } // namespace hlp::logpar
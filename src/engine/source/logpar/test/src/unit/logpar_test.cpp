@@ -2,7 +2,9 @@
 
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <variant>
 
 #include <fmt/format.h>
 
@@ -445,3 +447,131 @@ INSTANTIATE_TEST_SUITE_P(
                                      logp::Literal {":"},
                                      logp::Field {logp::FieldName {"~"}, {}, false}},
                                     40)));
+
+class LogparCacheTest
+    : public ::testing::Test
+    , public logpar_test::LogparPBase
+{
+protected:
+    void SetUp() override { init(); }
+};
+
+TEST_F(LogparCacheTest, SharesSameExpression)
+{
+    auto parser1 = logpar->build("<text>:<long>");
+    auto cached = logpar->cachedParsers();
+    auto parser2 = logpar->build("<text>:<long>");
+    ASSERT_EQ(logpar->cachedParsers(), cached);
+
+    for (const auto& parser : {parser1, parser2})
+    {
+        json::Json event;
+        auto error = hlp::parser::run(parser, "some text:1", event);
+        ASSERT_FALSE(error) << error.value().message;
+        ASSERT_EQ(event, logpar_test::J(R"({"text":"some text","long":1})"));
+    }
+}
+
+TEST_F(LogparCacheTest, SharesSameField)
+{
+    size_t builds = 0;
+    auto config = logpar_test::getConfig();
+    auto counting = std::make_shared<hlp::logpar::Logpar>(config, schema);
+    counting->registerBuilder(hlp::ParserType::P_TEXT,
+                              [&builds](const hlp::Params& params)
+                              {
+                                  ++builds;
+                                  return hlp::parsers::getTextParser(params);
+                              });
+    counting->registerBuilder(hlp::ParserType::P_LONG, hlp::parsers::getLongParser);
+    counting->registerBuilder(hlp::ParserType::P_LITERAL, hlp::parsers::getLiteralParser);
+
+    // Same text field with the same end token in both expressions
+    auto parser1 = counting->build("<text>:<long>");
+    auto parser2 = counting->build("<text>:<long>:end");
+    ASSERT_EQ(builds, 1);
+
+    // Different end token
+    auto parser3 = counting->build("<text>-<long>");
+    ASSERT_EQ(builds, 2);
+
+    json::Json event;
+    ASSERT_FALSE(hlp::parser::run(parser2, "some text:1:end", event));
+    ASSERT_EQ(event, logpar_test::J(R"({"text":"some text","long":1})"));
+}
+
+TEST_F(LogparCacheTest, DropsUnusedParsers)
+{
+    {
+        auto parser = logpar->build("<text>:<long>");
+        ASSERT_GT(logpar->cachedParsers(), 0);
+    }
+
+    ASSERT_EQ(logpar->cachedParsers(), 0);
+}
+
+class LogparAlternativesTest
+    : public ::testing::Test
+    , public logpar_test::LogparPBase
+{
+protected:
+    void SetUp() override { init(); }
+};
+
+TEST_F(LogparAlternativesTest, GroupsSharedPrefix)
+{
+    auto groups = logpar->buildAlternatives({"<text>:<long>:a", "<text>:<long>:b", "<long>-<text>", "start <text>"});
+    ASSERT_EQ(groups.size(), 3);
+
+    ASSERT_TRUE(groups[0].prefix);
+    ASSERT_EQ(groups[0].indexes, (std::vector<size_t> {0, 1}));
+    ASSERT_FALSE(groups[1].prefix);
+    ASSERT_EQ(groups[1].indexes, (std::vector<size_t> {2}));
+    ASSERT_FALSE(groups[2].prefix);
+    ASSERT_EQ(groups[2].indexes, (std::vector<size_t> {3}));
+}
+
+TEST_F(LogparAlternativesTest, SameResultAsSequential)
+{
+    const std::vector<std::string> exprs {"<text>:<long>:a", "<text>:<long>:b", "<text>:<long>"};
+    auto groups = logpar->buildAlternatives(exprs);
+    ASSERT_EQ(groups.size(), 1);
+    ASSERT_EQ(groups[0].suffixes.size(), 3);
+
+    for (const auto& input : {"some text:1:a", "some text:1:b", "some text:1", "some text:x:b", "some text"})
+    {
+        // First expression that parses the whole input
+        std::optional<size_t> expectedIndex;
+        json::Json expected;
+        for (size_t i = 0; i < exprs.size() && !expectedIndex; ++i)
+        {
+            json::Json event;
+            if (!hlp::parser::run(logpar->build(exprs[i]), input, event))
+            {
+                expectedIndex = i;
+                expected = std::move(event);
+            }
+        }
+
+        json::Json event;
+        auto result = hlp::parser::runAlternatives(groups[0].prefix, groups[0].suffixes, input, event);
+        if (expectedIndex)
+        {
+            ASSERT_TRUE(std::holds_alternative<size_t>(result)) << input;
+            ASSERT_EQ(std::get<size_t>(result), expectedIndex.value()) << input;
+            ASSERT_EQ(event, expected) << input;
+        }
+        else
+        {
+            ASSERT_TRUE(std::holds_alternative<base::Error>(result)) << input;
+            ASSERT_EQ(event, json::Json {}) << input;
+        }
+    }
+}
+
+TEST_F(LogparAlternativesTest, GroupNotShared)
+{
+    // A field followed by a group depends on the group, so it is never shared
+    auto groups = logpar->buildAlternatives({"<text>(?:<long>)", "<text>(?:<long>)"});
+    ASSERT_EQ(groups.size(), 2);
+}
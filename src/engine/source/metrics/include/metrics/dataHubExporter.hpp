@@ -11,6 +11,7 @@
 #include <string>
 
 #include <metrics/iDataHub.hpp>
+#include <metrics/shardedInstruments.hpp>
 
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace exporter
@@ -30,10 +31,12 @@ public:
      *
      * @param dataHub Interface to DataHub container
      * @param aggregation_temporality How new samples are processed with existing ones.
+     * @param shardedInstruments Instruments merged and exported on each export, besides the OpenTelemetry ones.
      */
     explicit DataHubExporter(std::shared_ptr<metricsManager::IDataHub> dataHub,
                              sdk::metrics::AggregationTemporality aggregationTemporality =
-                                 sdk::metrics::AggregationTemporality::kCumulative) noexcept;
+                                 sdk::metrics::AggregationTemporality::kCumulative,
+                             std::shared_ptr<metricsManager::ShardedInstruments> shardedInstruments = nullptr) noexcept;
 
     /**
      * @brief Export the registered instruments samples in the provider
@@ -76,6 +79,11 @@ private:
      */
     std::shared_ptr<metricsManager::IDataHub> m_dataHub;
 
+    /**
+     * @brief Per-thread instruments of the scope, merged on export.
+     */
+    std::shared_ptr<metricsManager::ShardedInstruments> m_shardedInstruments;
+
     /**
      * @brief Control variable to flag shutdown cycle.
      */
@@ -102,6 +110,11 @@ private:
     void printInstrumentationInfoMetricData(const sdk::metrics::ScopeMetrics& infoMetrics,
                                             const sdk::metrics::ResourceMetrics& data);
 
+    /**
+     * @brief Merge the shards of the sharded instruments and print them, one scope per instrument.
+     */
+    void printShardedMetricData();
+
     /**
      * @brief Print point data in JSON format.
      */
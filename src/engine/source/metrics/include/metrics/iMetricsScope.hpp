@@ -57,6 +57,19 @@ public:
    */
   virtual std::shared_ptr<iHistogram<uint64_t>> getHistogramUInteger(const std::string& name) = 0;
 
+  /**
+   * @brief Gets a latency histogram, with fine buckets to report its percentiles.
+   *
+   * The scopes without latency histograms return an unsigned integer histogram.
+   *
+   * @param name The name of the histogram.
+   * @return A shared pointer to the histogram, whose samples are nanoseconds.
+   */
+  virtual std::shared_ptr<iHistogram<uint64_t>> getLatencyHistogram(const std::string& name)
+  {
+      return getHistogramUInteger(name);
+  }
+
   /**
    * @brief Gets an integer gauge.
    *
@@ -0,0 +1,98 @@
+#ifndef _METRICS_MEMORY_ACCOUNTING_H
+#define _METRICS_MEMORY_ACCOUNTING_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <metrics/iMetricsScope.hpp>
+
+namespace metricsManager
+{
+
+/**
+ * @brief Periodic accounting of the memory held by the components of the engine.
+ *
+ * Each component registers a probe that estimates the bytes it holds. The probes are sampled every interval and
+ * published as the gauge "<name>.Bytes" of the scope. A probe may set a soft limit and a release function, called when
+ * a sample is over the limit and counted in "<name>.Releases".
+ */
+class MemoryAccounting
+{
+public:
+    using Usage = std::function<std::size_t()>; ///< Estimate of the bytes held by a component
+    using Release = std::function<void()>;      ///< Release what the component can drop, such as its caches
+
+    /**
+     * @brief Construct a new Memory Accounting
+     *
+     * @param scope Scope of the gauges and counters.
+     * @param interval Time between samples.
+     */
+    MemoryAccounting(const std::shared_ptr<IMetricsScope>& scope, std::chrono::milliseconds interval);
+
+    ~MemoryAccounting();
+
+    MemoryAccounting(const MemoryAccounting&) = delete;
+    MemoryAccounting& operator=(const MemoryAccounting&) = delete;
+
+    /**
+     * @brief Add a probe, must be called before start.
+     *
+     * @param name Name of the component.
+     * @param usage Estimate of the bytes held by the component, called from the sampling thread.
+     * @param softLimit Bytes above which the component is asked to release memory (0 = no limit).
+     * @param release Called when a sample is over the soft limit.
+     */
+    void addProbe(const std::string& name, Usage usage, std::size_t softLimit = 0, Release release = {});
+
+    /**
+     * @brief Sample all the probes once and release the components over their limit.
+     *
+     * @return std::size_t Total bytes of the probes.
+     */
+    std::size_t sample();
+
+    /**
+     * @brief Start sampling in the background.
+     *
+     */
+    void start();
+
+    /**
+     * @brief Stop the background sampling, waiting for the running sample.
+     *
+     */
+    void stop();
+
+private:
+    struct Probe
+    {
+        std::string name;
+        Usage usage;
+        std::size_t softLimit;
+        Release release;
+        std::shared_ptr<iGauge<int64_t>> bytes;
+        std::shared_ptr<iCounter<uint64_t>> releases;
+    };
+
+    std::shared_ptr<IMetricsScope> m_scope;
+    std::chrono::milliseconds m_interval;
+    std::vector<Probe> m_probes;
+    std::shared_ptr<iGauge<int64_t>> m_total;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_running {false};
+};
+
+} // namespace metricsManager
+
+#endif // _METRICS_MEMORY_ACCOUNTING_H
@@ -11,6 +11,7 @@
 #include <metrics/iMetricsScope.hpp>
 #include <metrics/instrumentCollection.hpp>
 #include <metrics/metricsInstruments.hpp>
+#include <metrics/shardedInstruments.hpp>
 
 namespace metricsManager
 {
@@ -70,6 +71,11 @@ public:
      */
     std::shared_ptr<iHistogram<uint64_t>> getHistogramUInteger(const std::string& name) override;
 
+    /**
+     * @copydoc IMetricsScope::getLatencyHistogram()
+     */
+    std::shared_ptr<iHistogram<uint64_t>> getLatencyHistogram(const std::string& name) override;
+
     /**
      * @copydoc IMetricsScope::getGaugeInteger()
      */
@@ -109,46 +115,9 @@ private:
     std::shared_ptr<OTSDKMeterProvider> m_meterProvider;
 
     /**
-     * @brief Collection of Double Counters mapping to OpenTelemetry internals.
-     */
-    InstrumentCollection<Counter<OTMetrics::Counter<double>, double>,
-                        OTstd::unique_ptr<OTMetrics::Counter<double>>>
-        m_collection_counter_double;
-
-    /**
-     * @brief Collection of unsigned integer counters that map to OpenTelemetry internals.
-     */
-    InstrumentCollection<Counter<OTMetrics::Counter<uint64_t>, uint64_t>,
-                         OTstd::unique_ptr<OTMetrics::Counter<uint64_t>>>
-        m_collection_counter_integer;
-
-    /**
-     * @brief Collection of double up-down counters that map to OpenTelemetry internals.
-     */
-    InstrumentCollection<Counter<OTMetrics::UpDownCounter<double>, double>,
-                         OTstd::unique_ptr<OTMetrics::UpDownCounter<double>>>
-        m_collection_updowncounter_double;
-
-    /**
-     * @brief Collection of integer up-down counters that map to OpenTelemetry internals.
-     */
-    InstrumentCollection<Counter<OTMetrics::UpDownCounter<int64_t>, int64_t>,
-                         OTstd::unique_ptr<OTMetrics::UpDownCounter<int64_t>>>
-        m_collection_updowncounter_integer;
-
-    /**
-     * @brief Collection of double histograms that map to OpenTelemetry internals.
-     */
-    InstrumentCollection<Histogram<OTMetrics::Histogram<double>, double>,
-                         OTstd::unique_ptr<OTMetrics::Histogram<double>>>
-        m_collection_histogram_double;
-
-    /**
-     * @brief Collection of unsigned integer histograms that map to OpenTelemetry internals.
+     * @brief Counters and histograms, updated per thread and merged by the exporter.
      */
-    InstrumentCollection<Histogram<OTMetrics::Histogram<uint64_t>, uint64_t>,
-                         OTstd::unique_ptr<OTMetrics::Histogram<uint64_t>>>
-        m_collection_histogram_integer;
+    std::shared_ptr<ShardedInstruments> m_shardedInstruments;
 
     /**
      * @brief Collection of integer gauges that map to OpenTelemetry internals.
@@ -0,0 +1,589 @@
+#ifndef _METRICS_SHARDED_INSTRUMENTS_H
+#define _METRICS_SHARDED_INSTRUMENTS_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/common/timestamp.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
+
+#include <metrics/iMetricsInstruments.hpp>
+#include <metrics/metricsInstruments.hpp>
+
+namespace metricsManager
+{
+
+namespace OTSDKMetrics = opentelemetry::sdk::metrics;
+
+constexpr std::size_t CACHE_LINE_SIZE = 64; ///< Each shard is padded to its own cache line
+constexpr std::size_t MAX_SHARDS = 64;      ///< Upper bound of shards per instrument
+
+namespace details
+{
+/**
+ * @brief Index of the calling thread, assigned on its first update. Used to pick the shard of the thread.
+ */
+inline std::size_t threadIndex()
+{
+    static std::atomic<std::size_t> next {0};
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+/**
+ * @brief Default number of shards, one per hardware thread.
+ */
+inline std::size_t defaultShards()
+{
+    return std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, MAX_SHARDS);
+}
+
+template <typename U>
+void atomicAdd(std::atomic<U>& target, U value)
+{
+    if constexpr (std::is_integral_v<U>)
+    {
+        target.fetch_add(value, std::memory_order_relaxed);
+    }
+    else
+    {
+        auto current = target.load(std::memory_order_relaxed);
+        while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+template <typename U, typename Compare>
+void atomicUpdate(std::atomic<U>& target, U value, Compare replaces)
+{
+    auto current = target.load(std::memory_order_relaxed);
+    while (replaces(value, current) && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Convert a value to the value type of the OpenTelemetry point data.
+ */
+template <typename U>
+OTSDKMetrics::ValueType toValueType(U value)
+{
+    if constexpr (std::is_integral_v<U>)
+    {
+        return static_cast<int64_t>(value);
+    }
+    else
+    {
+        return static_cast<double>(value);
+    }
+}
+} // namespace details
+
+/**
+ * @brief Instrument that keeps its samples itself instead of in the OpenTelemetry SDK.
+ *
+ * The samples are accumulated in per-thread shards without locks and merged by the exporter, so updating the
+ * instrument from a hot path costs one uncontended atomic operation.
+ */
+class IShardedInstrument
+{
+public:
+    virtual ~IShardedInstrument() = default;
+
+    /**
+     * @brief Type of the instrument, as reported in the records.
+     */
+    virtual OTSDKMetrics::InstrumentType type() const = 0;
+
+    /**
+     * @brief Merge the shards into a point.
+     *
+     * @param reset If true the shards are cleared, for delta temporality.
+     * @return The merged point and the start time of the samples.
+     */
+    virtual std::pair<OTSDKMetrics::PointType, opentelemetry::common::SystemTimestamp> collect(bool reset) = 0;
+};
+
+/**
+ * @brief Counter or up-down counter with per-thread shards.
+ *
+ * @tparam U Basic value type of the counter.
+ */
+template <typename U>
+class ShardedCounter
+    : public iCounter<U>
+    , public Instrument
+    , public IShardedInstrument
+{
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+        std::atomic<U> value {0};
+    };
+
+    OTSDKMetrics::InstrumentType m_type;
+    std::vector<Shard> m_shards;
+    std::atomic<std::chrono::system_clock::rep> m_start; ///< Start of the samples not yet reset
+
+public:
+    /**
+     * @brief Construct a new Sharded Counter object
+     *
+     * @param type kCounter or kUpDownCounter.
+     * @param shards Number of shards, the threads are spread over them.
+     */
+    explicit ShardedCounter(OTSDKMetrics::InstrumentType type, std::size_t shards = details::defaultShards())
+        : m_type {type}
+        , m_shards(std::max<std::size_t>(shards, 1))
+        , m_start {std::chrono::system_clock::now().time_since_epoch().count()}
+    {
+    }
+
+    /**
+     * @copydoc iCounter::addValue
+     */
+    void addValue(const U& value) override
+    {
+        if (getEnabledStatus())
+        {
+            details::atomicAdd(m_shards[details::threadIndex() % m_shards.size()].value, value);
+        }
+    }
+
+    /**
+     * @copydoc IShardedInstrument::type
+     */
+    OTSDKMetrics::InstrumentType type() const override { return m_type; }
+
+    /**
+     * @copydoc IShardedInstrument::collect
+     */
+    std::pair<OTSDKMetrics::PointType, opentelemetry::common::SystemTimestamp> collect(bool reset) override
+    {
+        auto now = std::chrono::system_clock::now().time_since_epoch().count();
+        auto start = reset ? m_start.exchange(now) : m_start.load();
+
+        U total {0};
+        for (auto& shard : m_shards)
+        {
+            total += reset ? shard.value.exchange(0, std::memory_order_relaxed)
+                           : shard.value.load(std::memory_order_relaxed);
+        }
+
+        OTSDKMetrics::SumPointData point {};
+        point.value_ = details::toValueType(total);
+        return {point,
+                opentelemetry::common::SystemTimestamp {std::chrono::system_clock::time_point {
+                    std::chrono::system_clock::duration {start}}}};
+    }
+};
+
+/**
+ * @brief Histogram with per-thread shards, with the default boundaries of OpenTelemetry.
+ *
+ * @tparam U Basic value type of the histogram.
+ */
+template <typename U>
+class ShardedHistogram
+    : public iHistogram<U>
+    , public Instrument
+    , public IShardedInstrument
+{
+public:
+    static constexpr std::array<double, 15> BOUNDARIES {
+        0.0, 5.0, 10.0, 25.0, 50.0, 75.0, 100.0, 250.0, 500.0, 750.0, 1000.0, 2500.0, 5000.0, 7500.0, 10000.0};
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+        std::array<std::atomic<uint64_t>, BOUNDARIES.size() + 1> counts {}; ///< (prev, boundary], last is overflow
+        std::atomic<uint64_t> count {0};
+        std::atomic<U> sum {0};
+        std::atomic<U> min {std::numeric_limits<U>::max()};
+        std::atomic<U> max {std::numeric_limits<U>::lowest()};
+    };
+
+    std::vector<Shard> m_shards;
+    std::atomic<std::chrono::system_clock::rep> m_start; ///< Start of the samples not yet reset
+
+public:
+    /**
+     * @brief Construct a new Sharded Histogram object
+     *
+     * @param shards Number of shards, the threads are spread over them.
+     */
+    explicit ShardedHistogram(std::size_t shards = details::defaultShards())
+        : m_shards(std::max<std::size_t>(shards, 1))
+        , m_start {std::chrono::system_clock::now().time_since_epoch().count()}
+    {
+    }
+
+    /**
+     * @copydoc iHistogram::recordValue
+     */
+    void recordValue(const U& value) override
+    {
+        if (!getEnabledStatus())
+        {
+            return;
+        }
+
+        auto& shard = m_shards[details::threadIndex() % m_shards.size()];
+        auto bucket = std::lower_bound(BOUNDARIES.begin(), BOUNDARIES.end(), static_cast<double>(value))
+                      - BOUNDARIES.begin();
+        shard.counts[bucket].fetch_add(1, std::memory_order_relaxed);
+        shard.count.fetch_add(1, std::memory_order_relaxed);
+        details::atomicAdd(shard.sum, value);
+        details::atomicUpdate(shard.min, value, std::less<U> {});
+        details::atomicUpdate(shard.max, value, std::greater<U> {});
+    }
+
+    /**
+     * @copydoc IShardedInstrument::type
+     */
+    OTSDKMetrics::InstrumentType type() const override { return OTSDKMetrics::InstrumentType::kHistogram; }
+
+    /**
+     * @copydoc IShardedInstrument::collect
+     */
+    std::pair<OTSDKMetrics::PointType, opentelemetry::common::SystemTimestamp> collect(bool reset) override
+    {
+        auto now = std::chrono::system_clock::now().time_since_epoch().count();
+        auto start = reset ? m_start.exchange(now) : m_start.load();
+
+        auto take = [reset](auto& atomic, auto initial)
+        {
+            return reset ? atomic.exchange(initial, std::memory_order_relaxed) : atomic.load(std::memory_order_relaxed);
+        };
+
+        std::vector<uint64_t> counts(BOUNDARIES.size() + 1, 0);
+        uint64_t count {0};
+        U sum {0};
+        U min {std::numeric_limits<U>::max()};
+        U max {std::numeric_limits<U>::lowest()};
+        for (auto& shard : m_shards)
+        {
+            for (std::size_t i = 0; i < counts.size(); ++i)
+            {
+                counts[i] += take(shard.counts[i], uint64_t {0});
+            }
+            count += take(shard.count, uint64_t {0});
+            sum += take(shard.sum, U {0});
+            min = std::min(min, take(shard.min, std::numeric_limits<U>::max()));
+            max = std::max(max, take(shard.max, std::numeric_limits<U>::lowest()));
+        }
+
+        OTSDKMetrics::HistogramPointData point {};
+        point.boundaries_.assign(BOUNDARIES.begin(), BOUNDARIES.end());
+        point.counts_ = std::move(counts);
+        point.count_ = count;
+        point.sum_ = details::toValueType(sum);
+        point.record_min_max_ = count > 0;
+        if (count > 0)
+        {
+            point.min_ = details::toValueType(min);
+            point.max_ = details::toValueType(max);
+        }
+
+        return {point,
+                opentelemetry::common::SystemTimestamp {std::chrono::system_clock::time_point {
+                    std::chrono::system_clock::duration {start}}}};
+    }
+};
+
+/**
+ * @brief Latency histogram with per-thread shards, with log-linear buckets in the manner of HdrHistogram.
+ *
+ * Each power of two is split in SUB_BUCKETS buckets, so a sample is kept with a relative error below 1/SUB_BUCKETS
+ * from nanoseconds to MAX_EXPONENT. The point reports only the non-empty buckets, with their upper bounds as
+ * boundaries, so the exporter and histogramPercentile() get percentiles of the same precision.
+ */
+class ShardedLatencyHistogram
+    : public iHistogram<uint64_t>
+    , public Instrument
+    , public IShardedInstrument
+{
+public:
+    static constexpr std::size_t SUB_BUCKET_BITS = 4;
+    static constexpr std::size_t SUB_BUCKETS = std::size_t {1} << SUB_BUCKET_BITS;
+    static constexpr std::size_t MAX_EXPONENT = 40; ///< Samples of 2^40 (about 18 minutes in ns) or more are clamped
+    static constexpr std::size_t BUCKETS = SUB_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    /**
+     * @brief Bucket of a sample.
+     */
+    static std::size_t bucketOf(uint64_t value)
+    {
+        if (value < SUB_BUCKETS)
+        {
+            return static_cast<std::size_t>(value);
+        }
+
+        const std::size_t exponent = 63 - __builtin_clzll(value);
+        if (exponent >= MAX_EXPONENT)
+        {
+            return BUCKETS - 1;
+        }
+
+        const auto shift = exponent - SUB_BUCKET_BITS;
+        return SUB_BUCKETS + shift * SUB_BUCKETS + static_cast<std::size_t>((value >> shift) - SUB_BUCKETS);
+    }
+
+    /**
+     * @brief Highest sample of a bucket.
+     */
+    static uint64_t upperBound(std::size_t bucket)
+    {
+        if (bucket < SUB_BUCKETS)
+        {
+            return bucket;
+        }
+
+        const auto shift = (bucket - SUB_BUCKETS) / SUB_BUCKETS;
+        const auto sub = SUB_BUCKETS + (bucket - SUB_BUCKETS) % SUB_BUCKETS;
+        return ((static_cast<uint64_t>(sub) + 1) << shift) - 1;
+    }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+        std::array<std::atomic<uint64_t>, BUCKETS> counts {};
+        std::atomic<uint64_t> count {0};
+        std::atomic<uint64_t> sum {0};
+        std::atomic<uint64_t> min {std::numeric_limits<uint64_t>::max()};
+        std::atomic<uint64_t> max {0};
+    };
+
+    std::vector<Shard> m_shards;
+    std::atomic<std::chrono::system_clock::rep> m_start; ///< Start of the samples not yet reset
+
+public:
+    /**
+     * @brief Construct a new Sharded Latency Histogram object
+     *
+     * @param shards Number of shards, the threads are spread over them.
+     */
+    explicit ShardedLatencyHistogram(std::size_t shards = details::defaultShards())
+        : m_shards(std::max<std::size_t>(shards, 1))
+        , m_start {std::chrono::system_clock::now().time_since_epoch().count()}
+    {
+    }
+
+    /**
+     * @copydoc iHistogram::recordValue
+     */
+    void recordValue(const uint64_t& value) override
+    {
+        if (!getEnabledStatus())
+        {
+            return;
+        }
+
+        auto& shard = m_shards[details::threadIndex() % m_shards.size()];
+        shard.counts[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.count.fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+        details::atomicUpdate(shard.min, value, std::less<uint64_t> {});
+        details::atomicUpdate(shard.max, value, std::greater<uint64_t> {});
+    }
+
+    /**
+     * @copydoc IShardedInstrument::type
+     */
+    OTSDKMetrics::InstrumentType type() const override { return OTSDKMetrics::InstrumentType::kHistogram; }
+
+    /**
+     * @copydoc IShardedInstrument::collect
+     */
+    std::pair<OTSDKMetrics::PointType, opentelemetry::common::SystemTimestamp> collect(bool reset) override
+    {
+        auto now = std::chrono::system_clock::now().time_since_epoch().count();
+        auto start = reset ? m_start.exchange(now) : m_start.load();
+
+        auto take = [reset](auto& atomic, uint64_t initial)
+        {
+            return reset ? atomic.exchange(initial, std::memory_order_relaxed) : atomic.load(std::memory_order_relaxed);
+        };
+
+        std::vector<uint64_t> counts(BUCKETS, 0);
+        uint64_t count {0};
+        uint64_t sum {0};
+        uint64_t min {std::numeric_limits<uint64_t>::max()};
+        uint64_t max {0};
+        for (auto& shard : m_shards)
+        {
+            for (std::size_t i = 0; i < BUCKETS; ++i)
+            {
+                counts[i] += take(shard.counts[i], 0);
+            }
+            count += take(shard.count, 0);
+            sum += take(shard.sum, 0);
+            min = std::min(min, take(shard.min, std::numeric_limits<uint64_t>::max()));
+            max = std::max(max, take(shard.max, 0));
+        }
+
+        OTSDKMetrics::HistogramPointData point {};
+        for (std::size_t i = 0; i < BUCKETS; ++i)
+        {
+            if (counts[i] > 0)
+            {
+                point.boundaries_.emplace_back(static_cast<double>(upperBound(i)));
+                point.counts_.emplace_back(counts[i]);
+            }
+        }
+        point.counts_.emplace_back(0); // (last boundary, +inf)
+        point.count_ = count;
+        point.sum_ = details::toValueType(sum);
+        point.record_min_max_ = count > 0;
+        if (count > 0)
+        {
+            point.min_ = details::toValueType(min);
+            point.max_ = details::toValueType(max);
+        }
+
+        return {point,
+                opentelemetry::common::SystemTimestamp {std::chrono::system_clock::time_point {
+                    std::chrono::system_clock::duration {start}}}};
+    }
+};
+
+/**
+ * @brief Percentile of the samples of a histogram point, the upper bound of the bucket of the sample of that rank.
+ *
+ * The result is kept between the min and the max of the point when they are recorded, which also bounds the
+ * overflow bucket.
+ *
+ * @param point Histogram point.
+ * @param quantile Quantile, between 0 and 1.
+ * @return The percentile, 0 if the point has no samples.
+ */
+inline double histogramPercentile(const OTSDKMetrics::HistogramPointData& point, double quantile)
+{
+    if (point.count_ == 0)
+    {
+        return 0.0;
+    }
+
+    auto asDouble = [](const OTSDKMetrics::ValueType& value)
+    {
+        return opentelemetry::nostd::holds_alternative<double>(value)
+                   ? opentelemetry::nostd::get<double>(value)
+                   : static_cast<double>(opentelemetry::nostd::get<int64_t>(value));
+    };
+    const auto min = point.record_min_max_ ? asDouble(point.min_) : std::numeric_limits<double>::lowest();
+    const auto max = point.record_min_max_ ? asDouble(point.max_) : std::numeric_limits<double>::max();
+
+    const auto rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(point.count_))));
+    uint64_t seen {0};
+    for (std::size_t i = 0; i < point.counts_.size(); ++i)
+    {
+        seen += point.counts_[i];
+        if (seen >= rank)
+        {
+            const auto bound = i < point.boundaries_.size() ? point.boundaries_[i] : max;
+            return std::clamp(bound, min, max);
+        }
+    }
+
+    return max;
+}
+
+/**
+ * @brief Sharded instruments of a scope, by name. Read by the exporter on each export.
+ */
+class ShardedInstruments
+{
+private:
+    std::map<std::string, std::shared_ptr<IShardedInstrument>> m_instruments;
+    mutable std::mutex m_mutex;
+
+    template <typename T, typename... Args>
+    std::shared_ptr<T>
+    getInstrument(const std::string& name, OTSDKMetrics::InstrumentType type, Args&&... args)
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_instruments.find(name);
+        if (m_instruments.end() != it)
+        {
+            auto instrument = std::dynamic_pointer_cast<T>(it->second);
+            if (!instrument || instrument->type() != type)
+            {
+                throw std::runtime_error {"Instrument '" + name + "' already exists with another type"};
+            }
+            return instrument;
+        }
+
+        auto instrument = std::make_shared<T>(std::forward<Args>(args)...);
+        m_instruments.emplace(name, instrument);
+        return instrument;
+    }
+
+public:
+    /**
+     * @brief Get or create a counter.
+     *
+     * @param name Name of the instrument.
+     * @param type kCounter or kUpDownCounter.
+     * @return The counter.
+     * @throw std::runtime_error if an instrument of another type has the same name.
+     */
+    template <typename U>
+    std::shared_ptr<ShardedCounter<U>> getCounter(const std::string& name, OTSDKMetrics::InstrumentType type)
+    {
+        return getInstrument<ShardedCounter<U>>(name, type, type);
+    }
+
+    /**
+     * @brief Get or create a histogram.
+     *
+     * @param name Name of the instrument.
+     * @return The histogram.
+     * @throw std::runtime_error if an instrument of another type has the same name.
+     */
+    template <typename U>
+    std::shared_ptr<ShardedHistogram<U>> getHistogram(const std::string& name)
+    {
+        return getInstrument<ShardedHistogram<U>>(name, OTSDKMetrics::InstrumentType::kHistogram);
+    }
+
+    /**
+     * @brief Get or create a latency histogram.
+     *
+     * @param name Name of the instrument.
+     * @return The latency histogram.
+     * @throw std::runtime_error if an instrument of another type has the same name.
+     */
+    std::shared_ptr<ShardedLatencyHistogram> getLatencyHistogram(const std::string& name)
+    {
+        return getInstrument<ShardedLatencyHistogram>(name, OTSDKMetrics::InstrumentType::kHistogram);
+    }
+
+    /**
+     * @brief Copy of the instruments, to export them without holding the lock.
+     */
+    std::vector<std::pair<std::string, std::shared_ptr<IShardedInstrument>>> instruments() const
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        return {m_instruments.begin(), m_instruments.end()};
+    }
+};
+
+} // namespace metricsManager
+
+#endif // _METRICS_SHARDED_INSTRUMENTS_H
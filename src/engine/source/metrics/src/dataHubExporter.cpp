@@ -77,8 +77,9 @@ using namespace metricsManager;
 
 DataHubExporter::DataHubExporter(
     std::shared_ptr<metricsManager::IDataHub> dataHub,
-    sdk::metrics::AggregationTemporality aggregationTemporality) noexcept
-    : m_dataHub(dataHub), aggregationTemporality_(aggregationTemporality)
+    sdk::metrics::AggregationTemporality aggregationTemporality,
+    std::shared_ptr<metricsManager::ShardedInstruments> shardedInstruments) noexcept
+    : m_dataHub(dataHub), m_shardedInstruments(shardedInstruments), aggregationTemporality_(aggregationTemporality)
 {}
 
 sdk::metrics::AggregationTemporality DataHubExporter::GetAggregationTemporality(
@@ -103,6 +104,8 @@ sdk::common::ExportResult DataHubExporter::Export(
     printInstrumentationInfoMetricData(record, data);
   }
 
+  printShardedMetricData();
+
   return sdk::common::ExportResult::kSuccess;
 }
 
@@ -164,6 +167,49 @@ void DataHubExporter::printInstrumentationInfoMetricData(
   m_dataHub->setResource(scopeName, jMetricData);
 }
 
+void DataHubExporter::printShardedMetricData()
+{
+  if (!m_shardedInstruments)
+  {
+    return;
+  }
+
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+
+  const auto reset = aggregationTemporality_ == sdk::metrics::AggregationTemporality::kDelta;
+
+  for (const auto &[instrumentName, instrument] : m_shardedInstruments->instruments())
+  {
+    auto [point, start] = instrument->collect(reset);
+
+    json::Json jMetricData;
+
+    jMetricData.setString("", "/schema");
+    jMetricData.setString("", "/version");
+
+    json::Json jRecord;
+
+    jRecord.setString(timeToString(start), "/start_time" );
+    jRecord.setString(instrumentName, "/instrument_name" );
+    jRecord.setString("", "/instrument_description" );
+    jRecord.setString("", "/unit" );
+    jRecord.setString(getInstrumentTypeName(instrument->type()), "/type" );
+
+    json::Json jAttributes;
+    json::Json jPointAttributes;
+    printPointData(jPointAttributes, point);
+    jAttributes.appendJson(jPointAttributes);
+    jRecord.set("/attributes", jAttributes);
+
+    json::Json jDataRecords;
+    jDataRecords.appendJson(jRecord);
+    jMetricData.set("/records", jDataRecords);
+
+    // Each instrument has its own scope, as the meters of the OpenTelemetry instruments
+    m_dataHub->setResource(instrumentName, jMetricData);
+  }
+}
+
 void DataHubExporter::printPointData(json::Json& jsonObj, const opentelemetry::sdk::metrics::PointType &pointData)
 {
   if (nostd::holds_alternative<sdk::metrics::SumPointData>(pointData))
@@ -251,6 +297,12 @@ void DataHubExporter::printPointData(json::Json& jsonObj, const opentelemetry::s
       jsonObj.set("/counts", ob);
     }
 
+    if (count > 0)
+    {
+      jsonObj.setDouble(histogramPercentile(histogram_point_data, 0.5), "/percentiles/p50");
+      jsonObj.setDouble(histogramPercentile(histogram_point_data, 0.99), "/percentiles/p99");
+      jsonObj.setDouble(histogramPercentile(histogram_point_data, 0.999), "/percentiles/p999");
+    }
 
   }
   else if (nostd::holds_alternative<sdk::metrics::LastValuePointData>(pointData))
@@ -0,0 +1,111 @@
+#include <metrics/memoryAccounting.hpp>
+
+#include <stdexcept>
+
+namespace metricsManager
+{
+
+MemoryAccounting::MemoryAccounting(const std::shared_ptr<IMetricsScope>& scope, std::chrono::milliseconds interval)
+    : m_scope(scope)
+    , m_interval(interval)
+{
+    if (m_scope == nullptr)
+    {
+        throw std::runtime_error {"Memory accounting needs a metrics scope"};
+    }
+    if (m_interval.count() <= 0)
+    {
+        throw std::runtime_error {"Memory accounting interval must be greater than 0"};
+    }
+
+    m_total = m_scope->getGaugeInteger("Total.Bytes", 0);
+}
+
+MemoryAccounting::~MemoryAccounting()
+{
+    stop();
+}
+
+void MemoryAccounting::addProbe(const std::string& name, Usage usage, std::size_t softLimit, Release release)
+{
+    if (!usage)
+    {
+        throw std::runtime_error {"Memory probe '" + name + "' needs a usage function"};
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_running)
+    {
+        throw std::runtime_error {"Memory probe '" + name + "' added after the accounting started"};
+    }
+
+    m_probes.emplace_back(Probe {name,
+                                 std::move(usage),
+                                 softLimit,
+                                 std::move(release),
+                                 m_scope->getGaugeInteger(name + ".Bytes", 0),
+                                 m_scope->getCounterUInteger(name + ".Releases")});
+}
+
+std::size_t MemoryAccounting::sample()
+{
+    std::size_t total {0};
+    for (auto& probe : m_probes)
+    {
+        const auto bytes = probe.usage();
+        probe.bytes->setValue(static_cast<int64_t>(bytes));
+        total += bytes;
+
+        if (probe.softLimit != 0 && bytes > probe.softLimit && probe.release)
+        {
+            probe.release();
+            probe.releases->addValue(1UL);
+        }
+    }
+
+    m_total->setValue(static_cast<int64_t>(total));
+    return total;
+}
+
+void MemoryAccounting::start()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_running)
+    {
+        return;
+    }
+
+    m_running = true;
+    m_thread = std::thread(
+        [this]()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!m_cv.wait_for(lock, m_interval, [this]() { return !m_running; }))
+            {
+                // The probes may take their own locks, do not hold ours while sampling
+                lock.unlock();
+                sample();
+                lock.lock();
+            }
+        });
+}
+
+void MemoryAccounting::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running)
+        {
+            return;
+        }
+        m_running = false;
+    }
+    m_cv.notify_all();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+} // namespace metricsManager
@@ -8,6 +8,7 @@ using OTSDKPerodicMetricReaderOptions = opentelemetry::sdk::metrics::PeriodicExp
 using OTGaugeInteger = opentelemetry::nostd::shared_ptr<opentelemetry::metrics::ObserverResultT<int64_t>>;
 using OTGaugeDouble = opentelemetry::nostd::shared_ptr<opentelemetry::metrics::ObserverResultT<double>>;
 using OTTemporality = opentelemetry::v1::sdk::metrics::AggregationTemporality;
+using OTInstrumentType = opentelemetry::sdk::metrics::InstrumentType;
 
 namespace metricsManager
 {
@@ -18,7 +19,9 @@ void MetricsScope::initialize(bool delta, int exporterIntervalMS, int exporterTi
 
     // Create Exporter
     OTTemporality temporality = delta?(OTTemporality::kDelta):(OTTemporality::kCumulative);
-    std::unique_ptr<OTSDKMetricExporter> metricExporter(new OTDataHubExporter(m_dataHub, temporality));
+    m_shardedInstruments = std::make_shared<ShardedInstruments>();
+    std::unique_ptr<OTSDKMetricExporter> metricExporter(
+        new OTDataHubExporter(m_dataHub, temporality, m_shardedInstruments));
 
     // Create Reader
     OTSDKPerodicMetricReaderOptions options;
@@ -47,14 +50,7 @@ json::Json MetricsScope::getAllMetrics(const std::string& metricsInstrumentName)
 
 std::shared_ptr<iCounter<double>> MetricsScope::getCounterDouble(const std::string& name)
 {
-    auto retValue = m_collection_counter_double.getInstrument(
-        name,
-        [&]()
-        {
-            auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateDoubleCounter(name);
-        }
-    );
+    auto retValue = m_shardedInstruments->getCounter<double>(name, OTInstrumentType::kCounter);
 
     registerInstrument(name, retValue);
 
@@ -63,14 +59,7 @@ std::shared_ptr<iCounter<double>> MetricsScope::getCounterDouble(const std::stri
 
 std::shared_ptr<iCounter<uint64_t>> MetricsScope::getCounterUInteger(const std::string& name)
 {
-    auto retValue = m_collection_counter_integer.getInstrument(
-        name,
-        [&]()
-        {
-            auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateUInt64Counter(name);
-        }
-    );
+    auto retValue = m_shardedInstruments->getCounter<uint64_t>(name, OTInstrumentType::kCounter);
 
     registerInstrument(name, retValue);
 
@@ -79,14 +68,7 @@ std::shared_ptr<iCounter<uint64_t>> MetricsScope::getCounterUInteger(const std::
 
 std::shared_ptr<iCounter<double>> MetricsScope::getUpDownCounterDouble(const std::string& name)
 {
-    auto retValue = m_collection_updowncounter_double.getInstrument(
-        name,
-        [&]()
-        {
-            auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateDoubleUpDownCounter(name);
-        }
-    );
+    auto retValue = m_shardedInstruments->getCounter<double>(name, OTInstrumentType::kUpDownCounter);
 
     registerInstrument(name, retValue);
 
@@ -95,14 +77,7 @@ std::shared_ptr<iCounter<double>> MetricsScope::getUpDownCounterDouble(const std
 
 std::shared_ptr<iCounter<int64_t>> MetricsScope::getUpDownCounterInteger(const std::string& name)
 {
-    auto retValue = m_collection_updowncounter_integer.getInstrument(
-        name,
-        [&]()
-        {
-            auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateInt64UpDownCounter(name);
-        }
-    );
+    auto retValue = m_shardedInstruments->getCounter<int64_t>(name, OTInstrumentType::kUpDownCounter);
 
     registerInstrument(name, retValue);
 
@@ -111,14 +86,7 @@ std::shared_ptr<iCounter<int64_t>> MetricsScope::getUpDownCounterInteger(const s
 
 std::shared_ptr<iHistogram<double>> MetricsScope::getHistogramDouble(const std::string& name)
 {
-    auto retValue = m_collection_histogram_double.getInstrument(
-        name,
-        [&]()
-        {
-            auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateDoubleHistogram(name);
-        }
-    );
+    auto retValue = m_shardedInstruments->getHistogram<double>(name);
 
     registerInstrument(name, retValue);
 
@@ -127,13 +95,16 @@ std::shared_ptr<iHistogram<double>> MetricsScope::getHistogramDouble(const std::
 
 std::shared_ptr<iHistogram<uint64_t>> MetricsScope::getHistogramUInteger(const std::string& name)
 {
-    auto retValue = m_collection_histogram_integer.getInstrument(
-        name,
-        [&]()
-        {
-            auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateUInt64Histogram(name);
-        });
+    auto retValue = m_shardedInstruments->getHistogram<uint64_t>(name);
+
+    registerInstrument(name, retValue);
+
+    return retValue;
+}
+
+std::shared_ptr<iHistogram<uint64_t>> MetricsScope::getLatencyHistogram(const std::string& name)
+{
+    auto retValue = m_shardedInstruments->getLatencyHistogram(name);
 
     registerInstrument(name, retValue);
 
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include <metrics/memoryAccounting.hpp>
+
+#include "mocks/mockMetricsInstrument.hpp"
+#include "mocks/mockMetricsScope.hpp"
+
+using namespace metricsManager;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class MemoryAccountingTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_scope = std::make_shared<NiceMock<MockMetricsScope>>();
+        m_gauge = std::make_shared<NiceMock<MockGauge<int64_t>>>();
+        m_counter = std::make_shared<NiceMock<MockCounter<uint64_t>>>();
+        ON_CALL(*m_scope, getGaugeInteger(_, _)).WillByDefault(Return(m_gauge));
+        ON_CALL(*m_scope, getCounterUInteger(_)).WillByDefault(Return(m_counter));
+    }
+
+    std::shared_ptr<NiceMock<MockMetricsScope>> m_scope;
+    std::shared_ptr<NiceMock<MockGauge<int64_t>>> m_gauge;
+    std::shared_ptr<NiceMock<MockCounter<uint64_t>>> m_counter;
+};
+
+TEST_F(MemoryAccountingTest, InvalidArguments)
+{
+    EXPECT_THROW(MemoryAccounting(nullptr, std::chrono::milliseconds(10)), std::runtime_error);
+    EXPECT_THROW(MemoryAccounting(m_scope, std::chrono::milliseconds(0)), std::runtime_error);
+
+    MemoryAccounting accounting(m_scope, std::chrono::milliseconds(10));
+    EXPECT_THROW(accounting.addProbe("probe", nullptr), std::runtime_error);
+}
+
+TEST_F(MemoryAccountingTest, SamplePublishesBytes)
+{
+    auto kvdbGauge = std::make_shared<MockGauge<int64_t>>();
+    auto totalGauge = std::make_shared<MockGauge<int64_t>>();
+    EXPECT_CALL(*m_scope, getGaugeInteger("Total.Bytes", 0)).WillOnce(Return(totalGauge));
+    EXPECT_CALL(*m_scope, getGaugeInteger("KVDB.Bytes", 0)).WillOnce(Return(kvdbGauge));
+    EXPECT_CALL(*m_scope, getGaugeInteger("Geo.Bytes", 0));
+
+    MemoryAccounting accounting(m_scope, std::chrono::milliseconds(10));
+    accounting.addProbe("KVDB", []() { return std::size_t {100}; });
+    accounting.addProbe("Geo", []() { return std::size_t {20}; });
+
+    EXPECT_CALL(*kvdbGauge, setValue(100));
+    EXPECT_CALL(*totalGauge, setValue(120));
+    EXPECT_EQ(accounting.sample(), 120);
+}
+
+TEST_F(MemoryAccountingTest, ReleaseOverSoftLimit)
+{
+    std::size_t bytes {50};
+    auto releases {0};
+    MemoryAccounting accounting(m_scope, std::chrono::milliseconds(10));
+    accounting.addProbe(
+        "Cache", [&bytes]() { return bytes; }, 100, [&releases, &bytes]() { ++releases, bytes = 0; });
+
+    accounting.sample();
+    EXPECT_EQ(releases, 0);
+
+    bytes = 150;
+    EXPECT_CALL(*m_counter, addValue(1UL));
+    accounting.sample();
+    EXPECT_EQ(releases, 1);
+
+    accounting.sample();
+    EXPECT_EQ(releases, 1);
+}
+
+TEST_F(MemoryAccountingTest, BackgroundSampling)
+{
+    std::atomic<int> samples {0};
+    MemoryAccounting accounting(m_scope, std::chrono::milliseconds(1));
+    accounting.addProbe("Probe",
+                        [&samples]()
+                        {
+                            ++samples;
+                            return std::size_t {1};
+                        });
+
+    accounting.start();
+    EXPECT_THROW(accounting.addProbe("Late", []() { return std::size_t {0}; }), std::runtime_error);
+    while (samples.load() < 3)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    accounting.stop();
+
+    const auto stopped = samples.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(samples.load(), stopped);
+}
@@ -14,6 +14,7 @@ public:
     MOCK_METHOD(std::shared_ptr<metricsManager::iCounter<int64_t>>, getUpDownCounterInteger, (const std::string&), (override));
     MOCK_METHOD(std::shared_ptr<metricsManager::iHistogram<double>>, getHistogramDouble, (const std::string&), (override));
     MOCK_METHOD(std::shared_ptr<metricsManager::iHistogram<uint64_t>>, getHistogramUInteger, (const std::string&), (override));
+    MOCK_METHOD(std::shared_ptr<metricsManager::iHistogram<uint64_t>>, getLatencyHistogram, (const std::string&), (override));
     MOCK_METHOD(std::shared_ptr<metricsManager::iGauge<int64_t>>, getGaugeInteger, (const std::string&, int64_t), (override));
     MOCK_METHOD(std::shared_ptr<metricsManager::iGauge<double>>, getGaugeDouble, (const std::string&, double), (override));
 };
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <metrics/shardedInstruments.hpp>
+
+using namespace metricsManager;
+using OTInstrumentType = opentelemetry::sdk::metrics::InstrumentType;
+namespace OTSDK = opentelemetry::sdk::metrics;
+
+TEST(ShardedInstrumentsTest, CounterMergesThreads)
+{
+    ShardedCounter<uint64_t> counter(OTInstrumentType::kCounter, 4);
+    const auto THREADS {8};
+    const auto UPDATES {10000};
+
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back(
+            [&counter, UPDATES]()
+            {
+                for (auto j = 0; j < UPDATES; ++j)
+                {
+                    counter.addValue(1);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto [point, start] = counter.collect(false);
+    auto sum = opentelemetry::nostd::get<OTSDK::SumPointData>(point);
+    EXPECT_EQ(opentelemetry::nostd::get<int64_t>(sum.value_), THREADS * UPDATES);
+}
+
+TEST(ShardedInstrumentsTest, CounterDeltaReset)
+{
+    ShardedCounter<double> counter(OTInstrumentType::kUpDownCounter);
+    counter.addValue(2.5);
+    counter.addValue(-1.0);
+
+    auto [point, start] = counter.collect(true);
+    EXPECT_DOUBLE_EQ(opentelemetry::nostd::get<double>(opentelemetry::nostd::get<OTSDK::SumPointData>(point).value_),
+                     1.5);
+
+    auto [reset, resetStart] = counter.collect(false);
+    EXPECT_DOUBLE_EQ(opentelemetry::nostd::get<double>(opentelemetry::nostd::get<OTSDK::SumPointData>(reset).value_),
+                     0.0);
+}
+
+TEST(ShardedInstrumentsTest, CounterDisabled)
+{
+    ShardedCounter<uint64_t> counter(OTInstrumentType::kCounter);
+    counter.setEnabledStatus(false);
+    counter.addValue(1);
+
+    auto [point, start] = counter.collect(false);
+    EXPECT_EQ(opentelemetry::nostd::get<int64_t>(opentelemetry::nostd::get<OTSDK::SumPointData>(point).value_), 0);
+}
+
+TEST(ShardedInstrumentsTest, HistogramBuckets)
+{
+    ShardedHistogram<uint64_t> histogram(2);
+    std::thread other([&histogram]() { histogram.recordValue(10000); });
+    histogram.recordValue(0);
+    histogram.recordValue(1);
+    histogram.recordValue(5);
+    histogram.recordValue(20000);
+    other.join();
+
+    auto [point, start] = histogram.collect(false);
+    auto data = opentelemetry::nostd::get<OTSDK::HistogramPointData>(point);
+    EXPECT_EQ(data.count_, 5);
+    EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.sum_), 30006);
+    EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.min_), 0);
+    EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.max_), 20000);
+    EXPECT_EQ(data.counts_, (std::vector<uint64_t> {1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1}));
+}
+
+TEST(ShardedInstrumentsTest, HistogramDeltaReset)
+{
+    ShardedHistogram<double> histogram;
+    histogram.recordValue(3.0);
+    histogram.collect(true);
+    histogram.recordValue(7.0);
+
+    auto [point, start] = histogram.collect(true);
+    auto data = opentelemetry::nostd::get<OTSDK::HistogramPointData>(point);
+    EXPECT_EQ(data.count_, 1);
+    EXPECT_DOUBLE_EQ(opentelemetry::nostd::get<double>(data.min_), 7.0);
+    EXPECT_DOUBLE_EQ(opentelemetry::nostd::get<double>(data.max_), 7.0);
+}
+
+TEST(ShardedInstrumentsTest, RegistryByName)
+{
+    ShardedInstruments instruments;
+    auto counter = instruments.getCounter<uint64_t>("counter", OTInstrumentType::kCounter);
+    EXPECT_EQ(counter, instruments.getCounter<uint64_t>("counter", OTInstrumentType::kCounter));
+    EXPECT_THROW(instruments.getCounter<uint64_t>("counter", OTInstrumentType::kUpDownCounter), std::runtime_error);
+    EXPECT_THROW(instruments.getHistogram<uint64_t>("counter"), std::runtime_error);
+
+    instruments.getHistogram<double>("histogram");
+    EXPECT_EQ(instruments.instruments().size(), 2);
+}
+
+TEST(ShardedInstrumentsTest, LatencyHistogramBuckets)
+{
+    // Every sample is in a bucket whose upper bound is within 1/SUB_BUCKETS of it
+    for (uint64_t value : {0UL, 1UL, 15UL, 16UL, 17UL, 31UL, 32UL, 1000UL, 123456789UL, (1UL << 39) + 12345})
+    {
+        const auto bound = ShardedLatencyHistogram::upperBound(ShardedLatencyHistogram::bucketOf(value));
+        EXPECT_GE(bound, value);
+        EXPECT_LE(bound - value, value / ShardedLatencyHistogram::SUB_BUCKETS);
+    }
+    EXPECT_EQ(ShardedLatencyHistogram::bucketOf(1UL << 50), ShardedLatencyHistogram::BUCKETS - 1);
+}
+
+TEST(ShardedInstrumentsTest, LatencyHistogramPercentiles)
+{
+    ShardedLatencyHistogram histogram(2);
+    std::thread other(
+        [&histogram]()
+        {
+            for (uint64_t i = 1; i <= 500; ++i)
+            {
+                histogram.recordValue(i * 1000);
+            }
+        });
+    for (uint64_t i = 501; i <= 1000; ++i)
+    {
+        histogram.recordValue(i * 1000);
+    }
+    other.join();
+
+    auto [point, start] = histogram.collect(true);
+    auto data = opentelemetry::nostd::get<OTSDK::HistogramPointData>(point);
+    EXPECT_EQ(data.count_, 1000);
+    EXPECT_EQ(data.counts_.size(), data.boundaries_.size() + 1);
+    EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.min_), 1000);
+    EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.max_), 1000000);
+
+    auto near = [](double percentile, double expected)
+    {
+        return percentile >= expected && percentile <= expected * (1.0 + 1.0 / ShardedLatencyHistogram::SUB_BUCKETS);
+    };
+    EXPECT_TRUE(near(histogramPercentile(data, 0.5), 500000));
+    EXPECT_TRUE(near(histogramPercentile(data, 0.99), 990000));
+    EXPECT_DOUBLE_EQ(histogramPercentile(data, 0.999), 1000000);
+
+    auto [reset, resetStart] = histogram.collect(false);
+    auto resetData = opentelemetry::nostd::get<OTSDK::HistogramPointData>(reset);
+    EXPECT_EQ(resetData.count_, 0);
+    EXPECT_DOUBLE_EQ(histogramPercentile(resetData, 0.5), 0.0);
+}
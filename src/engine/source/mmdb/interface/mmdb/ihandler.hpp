@@ -4,6 +4,7 @@
 #include <string>
 #include <memory>
 
+#include <mmdb/ipAddress.hpp>
 #include <mmdb/iresult.hpp>
 
 namespace mmdb {
@@ -26,6 +27,14 @@ class IHandler
          * @return A Result object containing the result of the search.
          */
         virtual std::shared_ptr<IResult> lookup(const std::string& ip) const = 0;
+
+        /**
+         * @brief Search an already parsed IP address in the MMDB database, without translating it.
+         *
+         * @param ip The IP address to search.
+         * @return A Result object containing the result of the search.
+         */
+        virtual std::shared_ptr<IResult> lookup(const IPAddress& ip) const = 0;
 };
 
 }
@@ -0,0 +1,57 @@
+#ifndef _MMDB_IPADDRESS_HPP
+#define _MMDB_IPADDRESS_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include <arpa/inet.h>
+
+namespace mmdb
+{
+
+/**
+ * @brief An IPv4 or IPv6 address in network byte order, parsed once so the lookups do not translate it again.
+ */
+struct IPAddress
+{
+    int family = AF_INET;             ///< AF_INET or AF_INET6
+    std::array<uint8_t, 16> bytes {}; ///< The first 4 bytes for IPv4, all of them for IPv6
+
+    /**
+     * @brief Parse a numeric IPv4 or IPv6 address.
+     *
+     * @param ip The address as text.
+     * @return The parsed address, or nullopt if the text is not a numeric address.
+     */
+    static std::optional<IPAddress> fromString(std::string_view ip)
+    {
+        // INET6_ADDRSTRLEN covers both families, longer strings are not numeric addresses
+        char buffer[INET6_ADDRSTRLEN];
+        if (ip.empty() || ip.size() >= sizeof(buffer))
+        {
+            return std::nullopt;
+        }
+        ip.copy(buffer, ip.size());
+        buffer[ip.size()] = '\0';
+
+        IPAddress address;
+        if (1 == inet_pton(AF_INET, buffer, address.bytes.data()))
+        {
+            return address;
+        }
+
+        address.family = AF_INET6;
+        if (1 == inet_pton(AF_INET6, buffer, address.bytes.data()))
+        {
+            return address;
+        }
+
+        return std::nullopt;
+    }
+};
+
+} // namespace mmdb
+
+#endif // _MMDB_IPADDRESS_HPP
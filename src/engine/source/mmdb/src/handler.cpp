@@ -1,3 +1,7 @@
+#include <cstring>
+
+#include <netinet/in.h>
+
 #include <base/logging.hpp>
 
 #include "handler.hpp"
@@ -39,6 +43,12 @@ std::shared_ptr<IResult> Handler::lookup(const std::string& ipStr) const
         throw std::runtime_error("MMDB database is not open");
     }
 
+    // Numeric addresses skip the getaddrinfo translation of MMDB_lookup_string
+    if (auto address = IPAddress::fromString(ipStr))
+    {
+        return lookup(*address);
+    }
+
     int gai_error, mmdb_error;
     MMDB_lookup_result_s result = MMDB_lookup_string(mmdb.get(), ipStr.c_str(), &gai_error, &mmdb_error);
 
@@ -61,4 +71,43 @@ std::shared_ptr<IResult> Handler::lookup(const std::string& ipStr) const
     return std::make_shared<Result>(result);
 }
 
+std::shared_ptr<IResult> Handler::lookup(const IPAddress& ip) const
+{
+    if (!isOpen)
+    {
+        throw std::runtime_error("MMDB database is not open");
+    }
+
+    int mmdb_error = MMDB_SUCCESS;
+    MMDB_lookup_result_s result;
+    if (AF_INET == ip.family)
+    {
+        sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        std::memcpy(&addr.sin_addr, ip.bytes.data(), sizeof(addr.sin_addr));
+        result = MMDB_lookup_sockaddr(mmdb.get(), reinterpret_cast<const sockaddr*>(&addr), &mmdb_error);
+    }
+    else if (AF_INET6 == ip.family)
+    {
+        sockaddr_in6 addr {};
+        addr.sin6_family = AF_INET6;
+        std::memcpy(&addr.sin6_addr, ip.bytes.data(), sizeof(addr.sin6_addr));
+        result = MMDB_lookup_sockaddr(mmdb.get(), reinterpret_cast<const sockaddr*>(&addr), &mmdb_error);
+    }
+    else
+    {
+        throw std::runtime_error("Unsupported IP address family");
+    }
+
+    // An IPv6 address in an IPv4-only database is reported as a lookup error
+    if (MMDB_SUCCESS != mmdb_error)
+    {
+        std::string msg {"Error from libmaxminddb: "};
+        msg += MMDB_strerror(mmdb_error);
+        throw std::runtime_error(msg);
+    }
+
+    return std::make_shared<Result>(result);
+}
+
 } // namespace mmdb
@@ -56,6 +56,11 @@ public:
      * @copydoc IHandler::lookup
      */
     std::shared_ptr<IResult> lookup(const std::string& ip) const override;
+
+    /**
+     * @copydoc IHandler::lookup(const IPAddress&) const
+     */
+    std::shared_ptr<IResult> lookup(const IPAddress& ip) const override;
 };
 } // namespace mmdb
 
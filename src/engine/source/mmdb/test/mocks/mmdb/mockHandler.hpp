@@ -12,6 +12,7 @@ class MockHandler : public IHandler
 public:
     MOCK_METHOD(bool, isAvailable, (), (const, override));
     MOCK_METHOD(std::shared_ptr<IResult>, lookup, (const std::string& ip), (const, override));
+    MOCK_METHOD(std::shared_ptr<IResult>, lookup, (const IPAddress& ip), (const, override));
 };
 } // namespace mmdb
 
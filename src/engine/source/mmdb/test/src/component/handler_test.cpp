@@ -33,3 +33,11 @@ TEST_F(HandlerTest, lookupOk)
     ASSERT_FALSE(m_handler->lookup(ipNotFound)->hasData());
     ASSERT_THROW(m_handler->lookup("invalid_ip"), std::runtime_error);
 }
+
+TEST_F(HandlerTest, lookupAddressOk)
+{
+    auto full = mmdb::IPAddress::fromString(ipFullData);
+    auto notFound = mmdb::IPAddress::fromString(ipNotFound);
+    ASSERT_TRUE(m_handler->lookup(*full)->hasData());
+    ASSERT_FALSE(m_handler->lookup(*notFound)->hasData());
+}
@@ -60,3 +60,44 @@ TEST_F(HandlerTest, lookupOk)
     ASSERT_FALSE(handler.lookup(g_ipNotFound)->hasData());
     ASSERT_THROW(handler.lookup("invalid_ip"), std::runtime_error);
 }
+
+TEST_F(HandlerTest, lookupAddressOk)
+{
+    mmdb::Handler handler(g_maxmindDbPath);
+    auto error = handler.open();
+    ASSERT_FALSE(error);
+
+    auto full = mmdb::IPAddress::fromString(g_ipFullData);
+    auto notFound = mmdb::IPAddress::fromString(g_ipNotFound);
+    ASSERT_TRUE(full.has_value());
+    ASSERT_TRUE(notFound.has_value());
+
+    ASSERT_TRUE(handler.lookup(*full)->hasData());
+    ASSERT_FALSE(handler.lookup(*notFound)->hasData());
+}
+
+TEST_F(HandlerTest, lookupAddressClosed)
+{
+    mmdb::Handler handler(g_maxmindDbPath);
+    auto address = mmdb::IPAddress::fromString(g_ipFullData);
+    ASSERT_THROW(handler.lookup(*address), std::runtime_error);
+}
+
+TEST_F(HandlerTest, parseAddress)
+{
+    auto ipv4 = mmdb::IPAddress::fromString("1.2.3.4");
+    ASSERT_TRUE(ipv4.has_value());
+    ASSERT_EQ(ipv4->family, AF_INET);
+    ASSERT_EQ(ipv4->bytes[0], 1);
+    ASSERT_EQ(ipv4->bytes[3], 4);
+
+    auto ipv6 = mmdb::IPAddress::fromString("::ffff:1.2.3.4");
+    ASSERT_TRUE(ipv6.has_value());
+    ASSERT_EQ(ipv6->family, AF_INET6);
+    ASSERT_EQ(ipv6->bytes[15], 4);
+
+    ASSERT_FALSE(mmdb::IPAddress::fromString("").has_value());
+    ASSERT_FALSE(mmdb::IPAddress::fromString("invalid_ip").has_value());
+    ASSERT_FALSE(mmdb::IPAddress::fromString("1.2.3.4.5").has_value());
+    ASSERT_FALSE(mmdb::IPAddress::fromString(std::string(64, '1')).has_value());
+}
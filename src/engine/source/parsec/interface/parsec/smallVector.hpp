@@ -0,0 +1,220 @@
+#ifndef _PARSEC_SMALLVECTOR_HPP_
+#define _PARSEC_SMALLVECTOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace parsec
+{
+
+/**
+ * @brief Vector that stores up to N elements inline, only allocating when it grows past them.
+ *
+ * @tparam T type of the elements
+ * @tparam N number of inline elements
+ */
+template<typename T, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector needs at least one inline element");
+
+private:
+    alignas(T) unsigned char m_inline[N * sizeof(T)];
+    T* m_data;
+    std::size_t m_size;
+    std::size_t m_capacity;
+
+    T* inlineData() noexcept { return std::launder(reinterpret_cast<T*>(m_inline)); }
+    bool isInline() const noexcept { return m_data == reinterpret_cast<const T*>(m_inline); }
+
+    void grow(std::size_t capacity)
+    {
+        auto data = static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t {alignof(T)}));
+        std::size_t moved = 0;
+        try
+        {
+            for (; moved < m_size; ++moved)
+            {
+                new (data + moved) T(std::move_if_noexcept(m_data[moved]));
+            }
+        }
+        catch (...)
+        {
+            std::destroy_n(data, moved);
+            ::operator delete(data, std::align_val_t {alignof(T)});
+            throw;
+        }
+
+        std::destroy_n(m_data, m_size);
+        release();
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    void release() noexcept
+    {
+        if (!isInline())
+        {
+            ::operator delete(m_data, std::align_val_t {alignof(T)});
+        }
+    }
+
+    void moveFrom(SmallVector&& other)
+    {
+        if (other.isInline())
+        {
+            for (std::size_t i = 0; i < other.m_size; ++i)
+            {
+                new (m_data + i) T(std::move(other.m_data[i]));
+            }
+            m_size = other.m_size;
+            other.clear();
+        }
+        else
+        {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = other.inlineData();
+            other.m_size = 0;
+            other.m_capacity = N;
+        }
+    }
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() noexcept
+        : m_data {inlineData()}
+        , m_size {0}
+        , m_capacity {N}
+    {
+    }
+
+    SmallVector(std::initializer_list<T> values)
+        : SmallVector()
+    {
+        reserve(values.size());
+        for (const auto& value : values)
+        {
+            push_back(value);
+        }
+    }
+
+    SmallVector(const SmallVector& other)
+        : SmallVector()
+    {
+        reserve(other.m_size);
+        for (const auto& value : other)
+        {
+            push_back(value);
+        }
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : SmallVector()
+    {
+        moveFrom(std::move(other));
+    }
+
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this != &other)
+        {
+            SmallVector copy {other};
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            release();
+            m_data = inlineData();
+            m_capacity = N;
+            moveFrom(std::move(other));
+        }
+
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        release();
+    }
+
+    void reserve(std::size_t capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            grow(capacity);
+        }
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity)
+        {
+            grow(m_capacity * 2);
+        }
+
+        auto value = new (m_data + m_size) T(std::forward<Args>(args)...);
+        ++m_size;
+        return *value;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back()
+    {
+        --m_size;
+        std::destroy_at(m_data + m_size);
+    }
+
+    void clear() noexcept
+    {
+        std::destroy_n(m_data, m_size);
+        m_size = 0;
+    }
+
+    std::size_t size() const noexcept { return m_size; }
+    std::size_t capacity() const noexcept { return m_capacity; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    T& operator[](std::size_t i) noexcept { return m_data[i]; }
+    const T& operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+    T& front() noexcept { return m_data[0]; }
+    const T& front() const noexcept { return m_data[0]; }
+    T& back() noexcept { return m_data[m_size - 1]; }
+    const T& back() const noexcept { return m_data[m_size - 1]; }
+
+    iterator begin() noexcept { return m_data; }
+    iterator end() noexcept { return m_data + m_size; }
+    const_iterator begin() const noexcept { return m_data; }
+    const_iterator end() const noexcept { return m_data + m_size; }
+
+    bool operator==(const SmallVector& other) const
+    {
+        return m_size == other.m_size && std::equal(begin(), end(), other.begin());
+    }
+    bool operator!=(const SmallVector& other) const { return !(*this == other); }
+};
+
+} // namespace parsec
+
+#endif // _PARSEC_SMALLVECTOR_HPP_
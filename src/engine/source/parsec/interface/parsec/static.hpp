@@ -0,0 +1,437 @@
+#ifndef _PARSEC_STATIC_HPP_
+#define _PARSEC_STATIC_HPP_
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <parsec/parsec.hpp>
+#include <parsec/smallVector.hpp>
+
+/**
+ * @brief Parser combinators resolved at compile time
+ *
+ * The parsers of this layer keep their concrete type, so combining them nests the calls instead of going through a
+ * std::function per parser, and their results carry a static error message instead of nested traces. The parsers are
+ * converted to parsec::Parser with erase() at the boundary, and existing parsec::Parser can be used inside with lift().
+ */
+namespace parsec::st
+{
+/****************************************************************************************
+ * Type definitions
+ ****************************************************************************************/
+/**
+ * @brief Return type of a static parser
+ *
+ * @tparam T type of the contained value
+ */
+template<typename T>
+class Result
+{
+private:
+    std::optional<T> m_value; ///< Value, only if succeeded
+    size_t m_index;           ///< Next character not consumed
+    const char* m_error;      ///< Static error message, only if failed
+
+public:
+    using value_type = T;
+
+    Result(std::optional<T>&& value, size_t index, const char* error)
+        : m_value {std::move(value)}
+        , m_index {index}
+        , m_error {error}
+    {
+    }
+
+    bool success() const { return m_value.has_value(); }
+    bool failure() const { return !success(); }
+
+    /**
+     * @brief Get the value
+     *
+     * @pre success() == true
+     */
+    const T& value() const { return *m_value; }
+    T& value() { return *m_value; }
+
+    size_t index() const { return m_index; }
+
+    /**
+     * @brief Get the error message
+     *
+     * @pre failure() == true
+     */
+    const char* error() const { return m_error; }
+};
+
+template<typename T>
+Result<T> makeSuccess(T&& value, size_t index)
+{
+    return Result<T> {std::make_optional<T>(std::forward<T>(value)), index, nullptr};
+}
+
+template<typename T>
+Result<T> makeError(const char* error, size_t index)
+{
+    return Result<T> {std::nullopt, index, error};
+}
+
+/**
+ * @brief Parser with a concrete type
+ *
+ * @tparam F callable with the signature Result<T>(std::string_view, size_t)
+ */
+template<typename F>
+class Parser
+{
+private:
+    F m_fn;
+
+public:
+    using result_type = std::invoke_result_t<const F&, std::string_view, size_t>;
+    using value_type = typename result_type::value_type;
+
+    explicit Parser(F fn)
+        : m_fn {std::move(fn)}
+    {
+    }
+
+    result_type operator()(std::string_view s, size_t i) const { return m_fn(s, i); }
+};
+
+/**
+ * @brief Make a static parser from a callable
+ *
+ * @tparam F callable with the signature Result<T>(std::string_view, size_t)
+ * @param fn parser function
+ * @return Parser<F>
+ */
+template<typename F>
+Parser<F> make(F fn)
+{
+    return Parser<F> {std::move(fn)};
+}
+
+/* List of values helper type */
+template<typename T, std::size_t N = 8>
+using Values = SmallVector<T, N>;
+
+/****************************************************************************************
+ * Boundary with parsec::Parser
+ ****************************************************************************************/
+
+/**
+ * @brief Converts a static parser into a parsec::Parser.
+ *
+ * The trace of the result has no nested traces, only the error message of the parser that failed.
+ *
+ * @tparam F type of the static parser
+ * @param p parser
+ * @return parsec::Parser<T> Type erased parser
+ */
+template<typename F>
+parsec::Parser<typename Parser<F>::value_type> erase(const Parser<F>& p)
+{
+    using T = typename Parser<F>::value_type;
+    return [p](std::string_view s, size_t i)
+    {
+        auto res = p(s, i);
+        if (res.failure())
+        {
+            return parsec::makeError<T>(res.error(), res.index());
+        }
+
+        return parsec::makeSuccess<T>(std::move(res.value()), res.index());
+    };
+}
+
+/**
+ * @brief Converts a parsec::Parser into a static parser, so it can be combined with them.
+ *
+ * @tparam T type of the value returned by the parser
+ * @param p parser
+ * @return Static parser
+ */
+template<typename T>
+auto lift(const parsec::Parser<T>& p)
+{
+    return make(
+        [p](std::string_view s, size_t i)
+        {
+            auto res = p(s, i);
+            if (res.failure())
+            {
+                return st::makeError<T>("P failed", res.index());
+            }
+
+            return st::makeSuccess<T>(std::move(res.value()), res.index());
+        });
+}
+
+/****************************************************************************************
+ * Parser combinators
+ ****************************************************************************************/
+
+/**
+ * @brief Makes parser optional. Always succeeds, returning the value of the parser if
+ * it succeeds, or the default value if it fails.
+ */
+template<typename F>
+auto opt(const Parser<F>& p)
+{
+    using T = typename Parser<F>::value_type;
+    return make(
+        [p](std::string_view s, size_t i)
+        {
+            auto res = p(s, i);
+            if (res.success())
+            {
+                return res;
+            }
+
+            return st::makeSuccess<T>(T {}, i);
+        });
+}
+
+/**
+ * @brief Creates a parser that succeeds if the given parser fails, and fails if the
+ * given parser succeeds. The resulting parser consumes no input.
+ */
+template<typename F>
+auto negativeLook(const Parser<F>& p)
+{
+    using T = typename Parser<F>::value_type;
+    return make(
+        [p](std::string_view s, size_t i)
+        {
+            auto res = p(s, i);
+            if (res.success())
+            {
+                return st::makeError<T>("NEG(P), P succeeded", res.index());
+            }
+
+            return st::makeSuccess<T>(T {}, i);
+        });
+}
+
+/**
+ * @brief Creates a parser that succeeds if the given parser succeeds, and fails if the
+ * given parser fails. The resulting parser consumes no input.
+ */
+template<typename F>
+auto positiveLook(const Parser<F>& p)
+{
+    using T = typename Parser<F>::value_type;
+    return make(
+        [p](std::string_view s, size_t i)
+        {
+            auto res = p(s, i);
+            if (res.success())
+            {
+                return st::makeSuccess<T>(T {}, i);
+            }
+
+            return st::makeError<T>("POS(P), P failed", res.index());
+        });
+}
+
+/**
+ * @brief Creates a parser that returns result of the first parser and ignores the
+ * result of the second. If any of the parsers fails, the result will be a failure.
+ */
+template<typename L, typename R>
+auto operator<<(const Parser<L>& l, const Parser<R>& r)
+{
+    using T = typename Parser<L>::value_type;
+    return make(
+        [l, r](std::string_view s, size_t i)
+        {
+            auto resL = l(s, i);
+            if (resL.failure())
+            {
+                return resL;
+            }
+
+            auto resR = r(s, resL.index());
+            if (resR.failure())
+            {
+                return st::makeError<T>(resR.error(), resR.index());
+            }
+
+            return st::makeSuccess<T>(std::move(resL.value()), resR.index());
+        });
+}
+
+/**
+ * @brief Creates a parser that returns result of the second parser and ignores the
+ * result of the first. If any of the parsers fails, the result will be a failure.
+ */
+template<typename L, typename R>
+auto operator>>(const Parser<L>& l, const Parser<R>& r)
+{
+    using T = typename Parser<R>::value_type;
+    return make(
+        [l, r](std::string_view s, size_t i)
+        {
+            auto resL = l(s, i);
+            if (resL.failure())
+            {
+                return st::makeError<T>(resL.error(), resL.index());
+            }
+
+            return r(s, resL.index());
+        });
+}
+
+/**
+ * @brief Creates a parser that returns the result of the first parser if it succeeds,
+ * or the result of the second parser if the first fails.
+ */
+template<typename L, typename R>
+auto operator|(const Parser<L>& l, const Parser<R>& r)
+{
+    static_assert(std::is_same_v<typename Parser<L>::value_type, typename Parser<R>::value_type>,
+                  "Both parsers must return the same type");
+    using T = typename Parser<L>::value_type;
+    return make(
+        [l, r](std::string_view s, size_t i)
+        {
+            auto resL = l(s, i);
+            if (resL.success())
+            {
+                return resL;
+            }
+
+            auto resR = r(s, i);
+            if (resR.success())
+            {
+                return resR;
+            }
+
+            return st::makeError<T>("L|R, both failed", i);
+        });
+}
+
+/**
+ * @brief Creates a parser that returns a tuple of the results of the two parsers. If
+ * any of the parsers fails, the result will be a failure.
+ */
+template<typename L, typename R>
+auto operator&(const Parser<L>& l, const Parser<R>& r)
+{
+    using T = std::tuple<typename Parser<L>::value_type, typename Parser<R>::value_type>;
+    return make(
+        [l, r](std::string_view s, size_t i)
+        {
+            auto resL = l(s, i);
+            if (resL.failure())
+            {
+                return st::makeError<T>(resL.error(), resL.index());
+            }
+
+            auto resR = r(s, resL.index());
+            if (resR.failure())
+            {
+                return st::makeError<T>(resR.error(), resR.index());
+            }
+
+            return st::makeSuccess<T>(T {std::move(resL.value()), std::move(resR.value())}, resR.index());
+        });
+}
+
+/**
+ * @brief Creates a parser that executes the function f on the result of the given
+ * parser and returns the result of the function. If the given parser fails, the
+ * result will be a failure.
+ */
+template<typename Fn, typename F>
+auto fmap(Fn f, const Parser<F>& p)
+{
+    using T = std::decay_t<std::invoke_result_t<const Fn&, typename Parser<F>::value_type&&>>;
+    return make(
+        [f, p](std::string_view s, size_t i)
+        {
+            auto res = p(s, i);
+            if (res.failure())
+            {
+                return st::makeError<T>(res.error(), res.index());
+            }
+
+            return st::makeSuccess<T>(f(std::move(res.value())), res.index());
+        });
+}
+
+/**
+ * @brief Creates a parser that executes the given parser zero or more times and
+ * returns a list of the results. This parser will never fail.
+ */
+template<typename F>
+auto many(const Parser<F>& p)
+{
+    using T = Values<typename Parser<F>::value_type>;
+    return make(
+        [p](std::string_view s, size_t i)
+        {
+            T values {};
+            auto res = p(s, i);
+            while (res.success())
+            {
+                values.emplace_back(std::move(res.value()));
+                i = res.index();
+                res = p(s, i);
+            }
+
+            return st::makeSuccess<T>(std::move(values), i);
+        });
+}
+
+/**
+ * @brief Creates a parser that executes the given parser one or more times and
+ * returns a list of the results. This parser will fail if the given parser does not
+ * succeed at least once.
+ */
+template<typename F>
+auto many1(const Parser<F>& p)
+{
+    using T = Values<typename Parser<F>::value_type>;
+    return make(
+        [manyP = many(p)](std::string_view s, size_t i)
+        {
+            auto res = manyP(s, i);
+            if (res.value().empty())
+            {
+                return st::makeError<T>("MANY1(P), P failed", i);
+            }
+
+            return res;
+        });
+}
+
+/**
+ * @brief Creates a parser that adds a tag to the result of the given parser. If the given
+ * parser fails, the result will be a failure.
+ */
+template<typename F, typename Tag>
+auto tag(const Parser<F>& p, Tag tag)
+{
+    using T = typename Parser<F>::value_type;
+    return fmap([tag](T&& val) { return std::make_tuple(std::move(val), tag); }, p);
+}
+
+/**
+ * @brief Creates a parser that replaces the result of the given parser with the given
+ * tag. If the given parser fails, the result will be a failure.
+ */
+template<typename F, typename Tag>
+auto replace(const Parser<F>& p, Tag tag)
+{
+    using T = typename Parser<F>::value_type;
+    return fmap([tag](T&&) { return tag; }, p);
+}
+
+} // namespace parsec::st
+
+#endif // _PARSEC_STATIC_HPP_
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <parsec/static.hpp>
+
+using namespace parsec;
+
+namespace
+{
+auto pChar(char c)
+{
+    return st::make(
+        [c](std::string_view text, size_t index)
+        {
+            if (index < text.size() && text[index] == c)
+            {
+                return st::makeSuccess<char>(char {c}, index + 1);
+            }
+
+            return st::makeError<char>("unexpected character", index);
+        });
+}
+
+auto pDigit()
+{
+    return st::make(
+        [](std::string_view text, size_t index)
+        {
+            if (index < text.size() && text[index] >= '0' && text[index] <= '9')
+            {
+                return st::makeSuccess<int>(text[index] - '0', index + 1);
+            }
+
+            return st::makeError<int>("expected digit", index);
+        });
+}
+} // namespace
+
+/****************************************************************************************/
+// SmallVector tests
+/****************************************************************************************/
+TEST(ParsecSmallVectorTest, InlineAndSpill)
+{
+    SmallVector<std::string, 2> values;
+    values.push_back("a");
+    values.push_back("b");
+    ASSERT_EQ(values.capacity(), 2);
+
+    values.push_back("c");
+    ASSERT_EQ(values.size(), 3);
+    ASSERT_GE(values.capacity(), 3);
+    ASSERT_EQ(values[0], "a");
+    ASSERT_EQ(values[2], "c");
+}
+
+TEST(ParsecSmallVectorTest, CopyAndMove)
+{
+    SmallVector<std::string, 2> small {"a"};
+    SmallVector<std::string, 2> big {"a", "b", "c"};
+
+    auto smallCopy = small;
+    auto bigCopy = big;
+    ASSERT_EQ(smallCopy, small);
+    ASSERT_EQ(bigCopy, big);
+
+    auto smallMoved = std::move(smallCopy);
+    auto bigMoved = std::move(bigCopy);
+    ASSERT_EQ(smallMoved, small);
+    ASSERT_EQ(bigMoved, big);
+    ASSERT_TRUE(smallCopy.empty());
+    ASSERT_TRUE(bigCopy.empty());
+
+    smallMoved = big;
+    ASSERT_EQ(smallMoved, big);
+    bigMoved = std::move(small);
+    ASSERT_EQ(bigMoved.size(), 1);
+    ASSERT_EQ(bigMoved[0], "a");
+}
+
+/****************************************************************************************/
+// Static combinators tests
+/****************************************************************************************/
+TEST(ParsecStaticTest, Opt)
+{
+    auto p = st::opt(pChar('a'));
+
+    auto res = p("a", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'a');
+    ASSERT_EQ(res.index(), 1);
+
+    res = p("b", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.index(), 0);
+}
+
+TEST(ParsecStaticTest, Looks)
+{
+    auto neg = st::negativeLook(pChar('a'));
+    auto pos = st::positiveLook(pChar('a'));
+
+    ASSERT_TRUE(neg("b", 0).success());
+    ASSERT_TRUE(neg("a", 0).failure());
+    ASSERT_TRUE(pos("a", 0).success());
+    ASSERT_EQ(pos("a", 0).index(), 0);
+    ASSERT_TRUE(pos("b", 0).failure());
+}
+
+TEST(ParsecStaticTest, Sequences)
+{
+    auto left = pChar('a') << pChar('b');
+    auto right = pChar('a') >> pDigit();
+    auto both = pChar('a') & pDigit();
+
+    auto resLeft = left("ab", 0);
+    ASSERT_TRUE(resLeft.success());
+    ASSERT_EQ(resLeft.value(), 'a');
+    ASSERT_EQ(resLeft.index(), 2);
+
+    auto resRight = right("a7", 0);
+    ASSERT_TRUE(resRight.success());
+    ASSERT_EQ(resRight.value(), 7);
+
+    auto resBoth = both("a7", 0);
+    ASSERT_TRUE(resBoth.success());
+    ASSERT_EQ(resBoth.value(), std::make_tuple('a', 7));
+
+    auto failed = both("ab", 0);
+    ASSERT_TRUE(failed.failure());
+    ASSERT_EQ(failed.index(), 1);
+    ASSERT_STREQ(failed.error(), "expected digit");
+}
+
+TEST(ParsecStaticTest, Or)
+{
+    auto p = pChar('a') | pChar('b');
+
+    ASSERT_EQ(p("a", 0).value(), 'a');
+    ASSERT_EQ(p("b", 0).value(), 'b');
+    ASSERT_TRUE(p("c", 0).failure());
+}
+
+TEST(ParsecStaticTest, FmapAndMany)
+{
+    auto number = st::fmap(
+        [](st::Values<int>&& digits)
+        {
+            int value = 0;
+            for (auto digit : digits)
+            {
+                value = value * 10 + digit;
+            }
+            return value;
+        },
+        st::many1(pDigit()));
+
+    auto res = number("123456789012x", 3);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 456789012);
+    ASSERT_EQ(res.index(), 12);
+
+    ASSERT_TRUE(number("x", 0).failure());
+    ASSERT_TRUE(st::many(pDigit())("x", 0).success());
+}
+
+TEST(ParsecStaticTest, TagAndReplace)
+{
+    auto tagged = st::tag(pChar('a'), 1);
+    auto replaced = st::replace(pChar('a'), std::string {"A"});
+
+    ASSERT_EQ(tagged("a", 0).value(), std::make_tuple('a', 1));
+    ASSERT_EQ(replaced("a", 0).value(), "A");
+    ASSERT_TRUE(replaced("b", 0).failure());
+}
+
+TEST(ParsecStaticTest, Boundary)
+{
+    parsec::Parser<char> erased = st::erase(pChar('a') << pChar('b'));
+
+    auto res = erased("ab", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'a');
+    ASSERT_EQ(res.index(), 2);
+
+    auto failed = erased("ac", 0);
+    ASSERT_TRUE(failed.failure());
+    ASSERT_EQ(failed.error(), "unexpected character");
+    ASSERT_EQ(failed.index(), 1);
+
+    auto lifted = st::lift(erased) >> pDigit();
+    ASSERT_EQ(lifted("ab5", 0).value(), 5);
+    ASSERT_TRUE(lifted("b5", 0).failure());
+}
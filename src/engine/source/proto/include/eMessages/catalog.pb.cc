@@ -123,6 +123,77 @@ struct ResourceValidate_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourceValidate_RequestDefaultTypeInternal _ResourceValidate_Request_default_instance_;
+PROTOBUF_CONSTEXPR ResourcesPost_Request::ResourcesPost_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.resources_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResourcesPost_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResourcesPost_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResourcesPost_RequestDefaultTypeInternal() {}
+  union {
+    ResourcesPost_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourcesPost_RequestDefaultTypeInternal _ResourcesPost_Request_default_instance_;
+PROTOBUF_CONSTEXPR ResourcesGet_Request::ResourcesGet_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.resources_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResourcesGet_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResourcesGet_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResourcesGet_RequestDefaultTypeInternal() {}
+  union {
+    ResourcesGet_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourcesGet_RequestDefaultTypeInternal _ResourcesGet_Request_default_instance_;
+PROTOBUF_CONSTEXPR ResourcesValidate_Request::ResourcesValidate_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.resources_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResourcesValidate_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResourcesValidate_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResourcesValidate_RequestDefaultTypeInternal() {}
+  union {
+    ResourcesValidate_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourcesValidate_RequestDefaultTypeInternal _ResourcesValidate_Request_default_instance_;
+PROTOBUF_CONSTEXPR ResourceResult::ResourceResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0} {}
+struct ResourceResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResourceResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResourceResultDefaultTypeInternal() {}
+  union {
+    ResourceResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourceResultDefaultTypeInternal _ResourceResult_default_instance_;
+PROTOBUF_CONSTEXPR Resources_Response::Resources_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0} {}
+struct Resources_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Resources_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Resources_ResponseDefaultTypeInternal() {}
+  union {
+    Resources_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Resources_ResponseDefaultTypeInternal _Resources_Response_default_instance_;
 PROTOBUF_CONSTEXPR NamespacesGet_Request::NamespacesGet_Request(
     ::_pbi::ConstantInitialized) {}
 struct NamespacesGet_RequestDefaultTypeInternal {
@@ -155,7 +226,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 }  // namespace api
 }  // namespace wazuh
 }  // namespace com
-static ::_pb::Metadata file_level_metadata_catalog_2eproto[8];
+static ::_pb::Metadata file_level_metadata_catalog_2eproto[13];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_catalog_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_catalog_2eproto = nullptr;
 
@@ -237,6 +308,51 @@ const uint32_t TableStruct_catalog_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   1,
   2,
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourcesPost_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourcesPost_Request, _impl_.resources_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourcesGet_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourcesGet_Request, _impl_.resources_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourcesValidate_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourcesValidate_Request, _impl_.resources_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceResult, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceResult, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceResult, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceResult, _impl_.content_),
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::Resources_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::Resources_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::Resources_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::Resources_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::Resources_Response, _impl_.results_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::NamespacesGet_Request, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -262,8 +378,13 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 38, 48, -1, sizeof(::com::wazuh::api::engine::catalog::ResourcePut_Request)},
   { 52, 60, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceDelete_Request)},
   { 62, 72, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceValidate_Request)},
-  { 76, -1, -1, sizeof(::com::wazuh::api::engine::catalog::NamespacesGet_Request)},
-  { 82, 91, -1, sizeof(::com::wazuh::api::engine::catalog::NamespacesGet_Response)},
+  { 76, -1, -1, sizeof(::com::wazuh::api::engine::catalog::ResourcesPost_Request)},
+  { 83, -1, -1, sizeof(::com::wazuh::api::engine::catalog::ResourcesGet_Request)},
+  { 90, -1, -1, sizeof(::com::wazuh::api::engine::catalog::ResourcesValidate_Request)},
+  { 97, 106, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceResult)},
+  { 109, 118, -1, sizeof(::com::wazuh::api::engine::catalog::Resources_Response)},
+  { 121, -1, -1, sizeof(::com::wazuh::api::engine::catalog::NamespacesGet_Request)},
+  { 127, 136, -1, sizeof(::com::wazuh::api::engine::catalog::NamespacesGet_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -273,6 +394,11 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::com::wazuh::api::engine::catalog::_ResourcePut_Request_default_instance_._instance,
   &::com::wazuh::api::engine::catalog::_ResourceDelete_Request_default_instance_._instance,
   &::com::wazuh::api::engine::catalog::_ResourceValidate_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::catalog::_ResourcesPost_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::catalog::_ResourcesGet_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::catalog::_ResourcesValidate_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::catalog::_ResourceResult_default_instance_._instance,
+  &::com::wazuh::api::engine::catalog::_Resources_Response_default_instance_._instance,
   &::com::wazuh::api::engine::catalog::_NamespacesGet_Request_default_instance_._instance,
   &::com::wazuh::api::engine::catalog::_NamespacesGet_Response_default_instance_._instance,
 };
@@ -306,24 +432,39 @@ const char descriptor_table_protodef_catalog_2eproto[] PROTOBUF_SECTION_VARIABLE
   "h.api.engine.catalog.ResourceFormatH\001\210\001\001"
   "\022\024\n\007content\030\003 \001(\tH\002\210\001\001\022\030\n\013namespaceid\030\004 "
   "\001(\tH\003\210\001\001B\007\n\005_nameB\t\n\007_formatB\n\n\010_content"
-  "B\016\n\014_namespaceid\"\027\n\025NamespacesGet_Reques"
-  "t\"~\n\026NamespacesGet_Response\0222\n\006status\030\001 "
-  "\001(\0162\".com.wazuh.api.engine.ReturnStatus\022"
-  "\022\n\005error\030\002 \001(\tH\000\210\001\001\022\022\n\nnamespaces\030\003 \003(\tB"
-  "\010\n\006_error*1\n\016ResourceFormat\022\010\n\004json\020\000\022\010\n"
-  "\004yaml\020\001\022\007\n\003yml\020\001\032\002\020\001*w\n\014ResourceType\022\013\n\007"
-  "UNKNOWN\020\000\022\013\n\007decoder\020\001\022\010\n\004rule\020\002\022\n\n\006filt"
-  "er\020\003\022\n\n\006output\020\004\022\n\n\006schema\020\005\022\016\n\ncollecti"
-  "on\020\006\022\017\n\013integration\020\007b\006proto3"
+  "B\016\n\014_namespaceid\"^\n\025ResourcesPost_Reques"
+  "t\022E\n\tresources\030\001 \003(\01322.com.wazuh.api.eng"
+  "ine.catalog.ResourcePost_Request\"\\\n\024Reso"
+  "urcesGet_Request\022D\n\tresources\030\001 \003(\01321.co"
+  "m.wazuh.api.engine.catalog.ResourceGet_R"
+  "equest\"f\n\031ResourcesValidate_Request\022I\n\tr"
+  "esources\030\001 \003(\01326.com.wazuh.api.engine.ca"
+  "talog.ResourceValidate_Request\"\204\001\n\016Resou"
+  "rceResult\0222\n\006status\030\001 \001(\0162\".com.wazuh.ap"
+  "i.engine.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001"
+  "\001\022\024\n\007content\030\003 \001(\tH\001\210\001\001B\010\n\006_errorB\n\n\010_co"
+  "ntent\"\245\001\n\022Resources_Response\0222\n\006status\030\001"
+  " \001(\0162\".com.wazuh.api.engine.ReturnStatus"
+  "\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022=\n\007results\030\003 \003(\0132,."
+  "com.wazuh.api.engine.catalog.ResourceRes"
+  "ultB\010\n\006_error\"\027\n\025NamespacesGet_Request\"~"
+  "\n\026NamespacesGet_Response\0222\n\006status\030\001 \001(\016"
+  "2\".com.wazuh.api.engine.ReturnStatus\022\022\n\005"
+  "error\030\002 \001(\tH\000\210\001\001\022\022\n\nnamespaces\030\003 \003(\tB\010\n\006"
+  "_error*1\n\016ResourceFormat\022\010\n\004json\020\000\022\010\n\004ya"
+  "ml\020\001\022\007\n\003yml\020\001\032\002\020\001*w\n\014ResourceType\022\013\n\007UNK"
+  "NOWN\020\000\022\013\n\007decoder\020\001\022\010\n\004rule\020\002\022\n\n\006filter\020"
+  "\003\022\n\n\006output\020\004\022\n\n\006schema\020\005\022\016\n\ncollection\020"
+  "\006\022\017\n\013integration\020\007b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_catalog_2eproto_deps[1] = {
   &::descriptor_table_engine_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_catalog_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_catalog_2eproto = {
-    false, false, 1469, descriptor_table_protodef_catalog_2eproto,
+    false, false, 2066, descriptor_table_protodef_catalog_2eproto,
     "catalog.proto",
-    &descriptor_table_catalog_2eproto_once, descriptor_table_catalog_2eproto_deps, 1, 8,
+    &descriptor_table_catalog_2eproto_once, descriptor_table_catalog_2eproto_deps, 1, 13,
     schemas, file_default_instances, TableStruct_catalog_2eproto::offsets,
     file_level_metadata_catalog_2eproto, file_level_enum_descriptors_catalog_2eproto,
     file_level_service_descriptors_catalog_2eproto,
@@ -2367,102 +2508,39 @@ void ResourceValidate_Request::InternalSwap(ResourceValidate_Request* other) {
 
 // ===================================================================
 
-class NamespacesGet_Request::_Internal {
- public:
-};
-
-NamespacesGet_Request::NamespacesGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.NamespacesGet_Request)
-}
-NamespacesGet_Request::NamespacesGet_Request(const NamespacesGet_Request& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  NamespacesGet_Request* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.NamespacesGet_Request)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NamespacesGet_Request::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NamespacesGet_Request::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata NamespacesGet_Request::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[6]);
-}
-
-// ===================================================================
-
-class NamespacesGet_Response::_Internal {
+class ResourcesPost_Request::_Internal {
  public:
-  using HasBits = decltype(std::declval<NamespacesGet_Response>()._impl_._has_bits_);
-  static void set_has_error(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-NamespacesGet_Response::NamespacesGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ResourcesPost_Request::ResourcesPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.ResourcesPost_Request)
 }
-NamespacesGet_Response::NamespacesGet_Response(const NamespacesGet_Response& from)
+ResourcesPost_Request::ResourcesPost_Request(const ResourcesPost_Request& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  NamespacesGet_Response* const _this = this; (void)_this;
+  ResourcesPost_Request* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.namespaces_){from._impl_.namespaces_}
-    , decltype(_impl_.error_){}
-    , decltype(_impl_.status_){}};
+      decltype(_impl_.resources_){from._impl_.resources_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.error_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_error()) {
-    _this->_impl_.error_.Set(from._internal_error(), 
-      _this->GetArenaForAllocation());
-  }
-  _this->_impl_.status_ = from._impl_.status_;
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.ResourcesPost_Request)
 }
 
-inline void NamespacesGet_Response::SharedCtor(
+inline void ResourcesPost_Request::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
+      decltype(_impl_.resources_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.namespaces_){arena}
-    , decltype(_impl_.error_){}
-    , decltype(_impl_.status_){0}
   };
-  _impl_.error_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-NamespacesGet_Response::~NamespacesGet_Response() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+ResourcesPost_Request::~ResourcesPost_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.ResourcesPost_Request)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2470,70 +2548,41 @@ NamespacesGet_Response::~NamespacesGet_Response() {
   SharedDtor();
 }
 
-inline void NamespacesGet_Response::SharedDtor() {
+inline void ResourcesPost_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.namespaces_.~RepeatedPtrField();
-  _impl_.error_.Destroy();
+  _impl_.resources_.~RepeatedPtrField();
 }
 
-void NamespacesGet_Response::SetCachedSize(int size) const {
+void ResourcesPost_Request::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void NamespacesGet_Response::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+void ResourcesPost_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.ResourcesPost_Request)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.namespaces_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
-  }
-  _impl_.status_ = 0;
-  _impl_._has_bits_.Clear();
+  _impl_.resources_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NamespacesGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ResourcesPost_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      // repeated .com.wazuh.api.engine.catalog.ResourcePost_Request resources = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
-        } else
-          goto handle_unusual;
-        continue;
-      // optional string error = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_error();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.NamespacesGet_Response.error"));
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated string namespaces = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
-            auto str = _internal_add_namespaces();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            ptr = ctx->ParseMessage(_internal_add_resources(), ptr);
             CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.NamespacesGet_Response.namespaces"));
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -2553,7 +2602,6 @@ const char* NamespacesGet_Response::_InternalParse(const char* ptr, ::_pbi::Pars
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -2561,126 +2609,1364 @@ failure:
 #undef CHK_
 }
 
-uint8_t* NamespacesGet_Response::_InternalSerialize(
+uint8_t* ResourcesPost_Request::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.ResourcesPost_Request)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .com.wazuh.api.engine.ReturnStatus status = 1;
-  if (this->_internal_status() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_status(), target);
-  }
-
-  // optional string error = 2;
-  if (_internal_has_error()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.catalog.NamespacesGet_Response.error");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_error(), target);
-  }
-
-  // repeated string namespaces = 3;
-  for (int i = 0, n = this->_internal_namespaces_size(); i < n; i++) {
-    const auto& s = this->_internal_namespaces(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.catalog.NamespacesGet_Response.namespaces");
-    target = stream->WriteString(3, s, target);
+  // repeated .com.wazuh.api.engine.catalog.ResourcePost_Request resources = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_resources_size()); i < n; i++) {
+    const auto& repfield = this->_internal_resources(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.ResourcesPost_Request)
   return target;
 }
 
-size_t NamespacesGet_Response::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+size_t ResourcesPost_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.ResourcesPost_Request)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated string namespaces = 3;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.namespaces_.size());
-  for (int i = 0, n = _impl_.namespaces_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.namespaces_.Get(i));
-  }
-
-  // optional string error = 2;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
-  }
-
-  // .com.wazuh.api.engine.ReturnStatus status = 1;
-  if (this->_internal_status() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  // repeated .com.wazuh.api.engine.catalog.ResourcePost_Request resources = 1;
+  total_size += 1UL * this->_internal_resources_size();
+  for (const auto& msg : this->_impl_.resources_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NamespacesGet_Response::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResourcesPost_Request::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    NamespacesGet_Response::MergeImpl
+    ResourcesPost_Request::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NamespacesGet_Response::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResourcesPost_Request::GetClassData() const { return &_class_data_; }
 
 
-void NamespacesGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<NamespacesGet_Response*>(&to_msg);
-  auto& from = static_cast<const NamespacesGet_Response&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+void ResourcesPost_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResourcesPost_Request*>(&to_msg);
+  auto& from = static_cast<const ResourcesPost_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.ResourcesPost_Request)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.namespaces_.MergeFrom(from._impl_.namespaces_);
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
-  }
-  if (from._internal_status() != 0) {
-    _this->_internal_set_status(from._internal_status());
-  }
+  _this->_impl_.resources_.MergeFrom(from._impl_.resources_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void NamespacesGet_Response::CopyFrom(const NamespacesGet_Response& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+void ResourcesPost_Request::CopyFrom(const ResourcesPost_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.ResourcesPost_Request)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NamespacesGet_Response::IsInitialized() const {
+bool ResourcesPost_Request::IsInitialized() const {
   return true;
 }
 
-void NamespacesGet_Response::InternalSwap(NamespacesGet_Response* other) {
+void ResourcesPost_Request::InternalSwap(ResourcesPost_Request* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.namespaces_.InternalSwap(&other->_impl_.namespaces_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.error_, lhs_arena,
-      &other->_impl_.error_, rhs_arena
+  _impl_.resources_.InternalSwap(&other->_impl_.resources_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResourcesPost_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
+      file_level_metadata_catalog_2eproto[6]);
+}
+
+// ===================================================================
+
+class ResourcesGet_Request::_Internal {
+ public:
+};
+
+ResourcesGet_Request::ResourcesGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+}
+ResourcesGet_Request::ResourcesGet_Request(const ResourcesGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResourcesGet_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.resources_){from._impl_.resources_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+}
+
+inline void ResourcesGet_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.resources_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResourcesGet_Request::~ResourcesGet_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResourcesGet_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.resources_.~RepeatedPtrField();
+}
+
+void ResourcesGet_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResourcesGet_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.resources_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResourcesGet_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .com.wazuh.api.engine.catalog.ResourceGet_Request resources = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_resources(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResourcesGet_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.catalog.ResourceGet_Request resources = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_resources_size()); i < n; i++) {
+    const auto& repfield = this->_internal_resources(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+  return target;
+}
+
+size_t ResourcesGet_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.catalog.ResourceGet_Request resources = 1;
+  total_size += 1UL * this->_internal_resources_size();
+  for (const auto& msg : this->_impl_.resources_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResourcesGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResourcesGet_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResourcesGet_Request::GetClassData() const { return &_class_data_; }
+
+
+void ResourcesGet_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResourcesGet_Request*>(&to_msg);
+  auto& from = static_cast<const ResourcesGet_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.resources_.MergeFrom(from._impl_.resources_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResourcesGet_Request::CopyFrom(const ResourcesGet_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResourcesGet_Request::IsInitialized() const {
+  return true;
+}
+
+void ResourcesGet_Request::InternalSwap(ResourcesGet_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.resources_.InternalSwap(&other->_impl_.resources_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResourcesGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
+      file_level_metadata_catalog_2eproto[7]);
+}
+
+// ===================================================================
+
+class ResourcesValidate_Request::_Internal {
+ public:
+};
+
+ResourcesValidate_Request::ResourcesValidate_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+}
+ResourcesValidate_Request::ResourcesValidate_Request(const ResourcesValidate_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResourcesValidate_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.resources_){from._impl_.resources_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+}
+
+inline void ResourcesValidate_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.resources_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResourcesValidate_Request::~ResourcesValidate_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResourcesValidate_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.resources_.~RepeatedPtrField();
+}
+
+void ResourcesValidate_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResourcesValidate_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.resources_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResourcesValidate_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .com.wazuh.api.engine.catalog.ResourceValidate_Request resources = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_resources(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResourcesValidate_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.catalog.ResourceValidate_Request resources = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_resources_size()); i < n; i++) {
+    const auto& repfield = this->_internal_resources(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+  return target;
+}
+
+size_t ResourcesValidate_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.catalog.ResourceValidate_Request resources = 1;
+  total_size += 1UL * this->_internal_resources_size();
+  for (const auto& msg : this->_impl_.resources_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResourcesValidate_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResourcesValidate_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResourcesValidate_Request::GetClassData() const { return &_class_data_; }
+
+
+void ResourcesValidate_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResourcesValidate_Request*>(&to_msg);
+  auto& from = static_cast<const ResourcesValidate_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.resources_.MergeFrom(from._impl_.resources_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResourcesValidate_Request::CopyFrom(const ResourcesValidate_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResourcesValidate_Request::IsInitialized() const {
+  return true;
+}
+
+void ResourcesValidate_Request::InternalSwap(ResourcesValidate_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.resources_.InternalSwap(&other->_impl_.resources_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResourcesValidate_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
+      file_level_metadata_catalog_2eproto[8]);
+}
+
+// ===================================================================
+
+class ResourceResult::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResourceResult>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ResourceResult::ResourceResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.ResourceResult)
+}
+ResourceResult::ResourceResult(const ResourceResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResourceResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.ResourceResult)
+}
+
+inline void ResourceResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ResourceResult::~ResourceResult() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.ResourceResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResourceResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+  _impl_.content_.Destroy();
+}
+
+void ResourceResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResourceResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.ResourceResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.content_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResourceResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.ResourceResult.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string content = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.ResourceResult.content"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResourceResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.ResourceResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.catalog.ResourceResult.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // optional string content = 3;
+  if (_internal_has_content()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.catalog.ResourceResult.content");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_content(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.ResourceResult)
+  return target;
+}
+
+size_t ResourceResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.ResourceResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
+
+    // optional string content = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_content());
+    }
+
+  }
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResourceResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResourceResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResourceResult::GetClassData() const { return &_class_data_; }
+
+
+void ResourceResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResourceResult*>(&to_msg);
+  auto& from = static_cast<const ResourceResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.ResourceResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_content(from._internal_content());
+    }
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResourceResult::CopyFrom(const ResourceResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.ResourceResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResourceResult::IsInitialized() const {
+  return true;
+}
+
+void ResourceResult::InternalSwap(ResourceResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResourceResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
+      file_level_metadata_catalog_2eproto[9]);
+}
+
+// ===================================================================
+
+class Resources_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Resources_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+Resources_Response::Resources_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.Resources_Response)
+}
+Resources_Response::Resources_Response(const Resources_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Resources_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.Resources_Response)
+}
+
+inline void Resources_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.results_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Resources_Response::~Resources_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.Resources_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Resources_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
+
+void Resources_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Resources_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.Resources_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Resources_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.Resources_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.catalog.ResourceResult results = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Resources_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.Resources_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.catalog.Resources_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // repeated .com.wazuh.api.engine.catalog.ResourceResult results = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.Resources_Response)
+  return target;
+}
+
+size_t Resources_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.Resources_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.catalog.ResourceResult results = 3;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Resources_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Resources_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Resources_Response::GetClassData() const { return &_class_data_; }
+
+
+void Resources_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Resources_Response*>(&to_msg);
+  auto& from = static_cast<const Resources_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.Resources_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Resources_Response::CopyFrom(const Resources_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.Resources_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Resources_Response::IsInitialized() const {
+  return true;
+}
+
+void Resources_Response::InternalSwap(Resources_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Resources_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
+      file_level_metadata_catalog_2eproto[10]);
+}
+
+// ===================================================================
+
+class NamespacesGet_Request::_Internal {
+ public:
+};
+
+NamespacesGet_Request::NamespacesGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.NamespacesGet_Request)
+}
+NamespacesGet_Request::NamespacesGet_Request(const NamespacesGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  NamespacesGet_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.NamespacesGet_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NamespacesGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NamespacesGet_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata NamespacesGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
+      file_level_metadata_catalog_2eproto[11]);
+}
+
+// ===================================================================
+
+class NamespacesGet_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NamespacesGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+NamespacesGet_Response::NamespacesGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+}
+NamespacesGet_Response::NamespacesGet_Response(const NamespacesGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NamespacesGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.namespaces_){from._impl_.namespaces_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+}
+
+inline void NamespacesGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.namespaces_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NamespacesGet_Response::~NamespacesGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NamespacesGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.namespaces_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
+
+void NamespacesGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NamespacesGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.namespaces_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NamespacesGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.NamespacesGet_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string namespaces = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_namespaces();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.NamespacesGet_Response.namespaces"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NamespacesGet_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.catalog.NamespacesGet_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // repeated string namespaces = 3;
+  for (int i = 0, n = this->_internal_namespaces_size(); i < n; i++) {
+    const auto& s = this->_internal_namespaces(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.catalog.NamespacesGet_Response.namespaces");
+    target = stream->WriteString(3, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  return target;
+}
+
+size_t NamespacesGet_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string namespaces = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.namespaces_.size());
+  for (int i = 0, n = _impl_.namespaces_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.namespaces_.Get(i));
+  }
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NamespacesGet_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NamespacesGet_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NamespacesGet_Response::GetClassData() const { return &_class_data_; }
+
+
+void NamespacesGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NamespacesGet_Response*>(&to_msg);
+  auto& from = static_cast<const NamespacesGet_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.namespaces_.MergeFrom(from._impl_.namespaces_);
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NamespacesGet_Response::CopyFrom(const NamespacesGet_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NamespacesGet_Response::IsInitialized() const {
+  return true;
+}
+
+void NamespacesGet_Response::InternalSwap(NamespacesGet_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.namespaces_.InternalSwap(&other->_impl_.namespaces_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
   );
   swap(_impl_.status_, other->_impl_.status_);
 }
@@ -2688,7 +3974,7 @@ void NamespacesGet_Response::InternalSwap(NamespacesGet_Response* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata NamespacesGet_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[7]);
+      file_level_metadata_catalog_2eproto[12]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -2722,6 +4008,26 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourceValidat
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourceValidate_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourceValidate_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourcesPost_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourcesPost_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourcesPost_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourcesGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourcesGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourcesGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourcesValidate_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourcesValidate_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourcesValidate_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourceResult*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourceResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourceResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::Resources_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::Resources_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::Resources_Response >(arena);
+}
 template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::NamespacesGet_Request*
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::NamespacesGet_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::NamespacesGet_Request >(arena);
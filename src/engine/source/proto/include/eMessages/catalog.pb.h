@@ -73,9 +73,24 @@ extern ResourcePost_RequestDefaultTypeInternal _ResourcePost_Request_default_ins
 class ResourcePut_Request;
 struct ResourcePut_RequestDefaultTypeInternal;
 extern ResourcePut_RequestDefaultTypeInternal _ResourcePut_Request_default_instance_;
+class ResourceResult;
+struct ResourceResultDefaultTypeInternal;
+extern ResourceResultDefaultTypeInternal _ResourceResult_default_instance_;
 class ResourceValidate_Request;
 struct ResourceValidate_RequestDefaultTypeInternal;
 extern ResourceValidate_RequestDefaultTypeInternal _ResourceValidate_Request_default_instance_;
+class ResourcesGet_Request;
+struct ResourcesGet_RequestDefaultTypeInternal;
+extern ResourcesGet_RequestDefaultTypeInternal _ResourcesGet_Request_default_instance_;
+class ResourcesPost_Request;
+struct ResourcesPost_RequestDefaultTypeInternal;
+extern ResourcesPost_RequestDefaultTypeInternal _ResourcesPost_Request_default_instance_;
+class ResourcesValidate_Request;
+struct ResourcesValidate_RequestDefaultTypeInternal;
+extern ResourcesValidate_RequestDefaultTypeInternal _ResourcesValidate_Request_default_instance_;
+class Resources_Response;
+struct Resources_ResponseDefaultTypeInternal;
+extern Resources_ResponseDefaultTypeInternal _Resources_Response_default_instance_;
 }  // namespace catalog
 }  // namespace engine
 }  // namespace api
@@ -89,7 +104,12 @@ template<> ::com::wazuh::api::engine::catalog::ResourceGet_Request* Arena::Creat
 template<> ::com::wazuh::api::engine::catalog::ResourceGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceGet_Response>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourcePost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourcePost_Request>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourcePut_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourcePut_Request>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourceResult* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceResult>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourceValidate_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceValidate_Request>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourcesGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourcesGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourcesPost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourcesPost_Request>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourcesValidate_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourcesValidate_Request>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::Resources_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::Resources_Response>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace com {
 namespace wazuh {
@@ -1350,6 +1370,855 @@ class ResourceValidate_Request final :
 };
 // -------------------------------------------------------------------
 
+class ResourcesPost_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourcesPost_Request) */ {
+ public:
+  inline ResourcesPost_Request() : ResourcesPost_Request(nullptr) {}
+  ~ResourcesPost_Request() override;
+  explicit PROTOBUF_CONSTEXPR ResourcesPost_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResourcesPost_Request(const ResourcesPost_Request& from);
+  ResourcesPost_Request(ResourcesPost_Request&& from) noexcept
+    : ResourcesPost_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ResourcesPost_Request& operator=(const ResourcesPost_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResourcesPost_Request& operator=(ResourcesPost_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResourcesPost_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourcesPost_Request* internal_default_instance() {
+    return reinterpret_cast<const ResourcesPost_Request*>(
+               &_ResourcesPost_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ResourcesPost_Request& a, ResourcesPost_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResourcesPost_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourcesPost_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResourcesPost_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourcesPost_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourcesPost_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourcesPost_Request& from) {
+    ResourcesPost_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResourcesPost_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.ResourcesPost_Request";
+  }
+  protected:
+  explicit ResourcesPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResourcesFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.catalog.ResourcePost_Request resources = 1;
+  int resources_size() const;
+  private:
+  int _internal_resources_size() const;
+  public:
+  void clear_resources();
+  ::com::wazuh::api::engine::catalog::ResourcePost_Request* mutable_resources(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourcePost_Request >*
+      mutable_resources();
+  private:
+  const ::com::wazuh::api::engine::catalog::ResourcePost_Request& _internal_resources(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourcePost_Request* _internal_add_resources();
+  public:
+  const ::com::wazuh::api::engine::catalog::ResourcePost_Request& resources(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourcePost_Request* add_resources();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourcePost_Request >&
+      resources() const;
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourcesPost_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourcePost_Request > resources_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResourcesGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourcesGet_Request) */ {
+ public:
+  inline ResourcesGet_Request() : ResourcesGet_Request(nullptr) {}
+  ~ResourcesGet_Request() override;
+  explicit PROTOBUF_CONSTEXPR ResourcesGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResourcesGet_Request(const ResourcesGet_Request& from);
+  ResourcesGet_Request(ResourcesGet_Request&& from) noexcept
+    : ResourcesGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ResourcesGet_Request& operator=(const ResourcesGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResourcesGet_Request& operator=(ResourcesGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResourcesGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourcesGet_Request* internal_default_instance() {
+    return reinterpret_cast<const ResourcesGet_Request*>(
+               &_ResourcesGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ResourcesGet_Request& a, ResourcesGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResourcesGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourcesGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResourcesGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourcesGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourcesGet_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourcesGet_Request& from) {
+    ResourcesGet_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResourcesGet_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.ResourcesGet_Request";
+  }
+  protected:
+  explicit ResourcesGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResourcesFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.catalog.ResourceGet_Request resources = 1;
+  int resources_size() const;
+  private:
+  int _internal_resources_size() const;
+  public:
+  void clear_resources();
+  ::com::wazuh::api::engine::catalog::ResourceGet_Request* mutable_resources(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceGet_Request >*
+      mutable_resources();
+  private:
+  const ::com::wazuh::api::engine::catalog::ResourceGet_Request& _internal_resources(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceGet_Request* _internal_add_resources();
+  public:
+  const ::com::wazuh::api::engine::catalog::ResourceGet_Request& resources(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceGet_Request* add_resources();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceGet_Request >&
+      resources() const;
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourcesGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceGet_Request > resources_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResourcesValidate_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourcesValidate_Request) */ {
+ public:
+  inline ResourcesValidate_Request() : ResourcesValidate_Request(nullptr) {}
+  ~ResourcesValidate_Request() override;
+  explicit PROTOBUF_CONSTEXPR ResourcesValidate_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResourcesValidate_Request(const ResourcesValidate_Request& from);
+  ResourcesValidate_Request(ResourcesValidate_Request&& from) noexcept
+    : ResourcesValidate_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ResourcesValidate_Request& operator=(const ResourcesValidate_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResourcesValidate_Request& operator=(ResourcesValidate_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResourcesValidate_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourcesValidate_Request* internal_default_instance() {
+    return reinterpret_cast<const ResourcesValidate_Request*>(
+               &_ResourcesValidate_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ResourcesValidate_Request& a, ResourcesValidate_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResourcesValidate_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourcesValidate_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResourcesValidate_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourcesValidate_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourcesValidate_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourcesValidate_Request& from) {
+    ResourcesValidate_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResourcesValidate_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.ResourcesValidate_Request";
+  }
+  protected:
+  explicit ResourcesValidate_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResourcesFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.catalog.ResourceValidate_Request resources = 1;
+  int resources_size() const;
+  private:
+  int _internal_resources_size() const;
+  public:
+  void clear_resources();
+  ::com::wazuh::api::engine::catalog::ResourceValidate_Request* mutable_resources(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceValidate_Request >*
+      mutable_resources();
+  private:
+  const ::com::wazuh::api::engine::catalog::ResourceValidate_Request& _internal_resources(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceValidate_Request* _internal_add_resources();
+  public:
+  const ::com::wazuh::api::engine::catalog::ResourceValidate_Request& resources(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceValidate_Request* add_resources();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceValidate_Request >&
+      resources() const;
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourcesValidate_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceValidate_Request > resources_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResourceResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourceResult) */ {
+ public:
+  inline ResourceResult() : ResourceResult(nullptr) {}
+  ~ResourceResult() override;
+  explicit PROTOBUF_CONSTEXPR ResourceResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResourceResult(const ResourceResult& from);
+  ResourceResult(ResourceResult&& from) noexcept
+    : ResourceResult() {
+    *this = ::std::move(from);
+  }
+
+  inline ResourceResult& operator=(const ResourceResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResourceResult& operator=(ResourceResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResourceResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourceResult* internal_default_instance() {
+    return reinterpret_cast<const ResourceResult*>(
+               &_ResourceResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(ResourceResult& a, ResourceResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResourceResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourceResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResourceResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourceResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourceResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourceResult& from) {
+    ResourceResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResourceResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.ResourceResult";
+  }
+  protected:
+  explicit ResourceResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kContentFieldNumber = 3,
+    kStatusFieldNumber = 1,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // optional string content = 3;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourceResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Resources_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.Resources_Response) */ {
+ public:
+  inline Resources_Response() : Resources_Response(nullptr) {}
+  ~Resources_Response() override;
+  explicit PROTOBUF_CONSTEXPR Resources_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Resources_Response(const Resources_Response& from);
+  Resources_Response(Resources_Response&& from) noexcept
+    : Resources_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline Resources_Response& operator=(const Resources_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Resources_Response& operator=(Resources_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Resources_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Resources_Response* internal_default_instance() {
+    return reinterpret_cast<const Resources_Response*>(
+               &_Resources_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(Resources_Response& a, Resources_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Resources_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Resources_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Resources_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Resources_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Resources_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Resources_Response& from) {
+    Resources_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Resources_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.Resources_Response";
+  }
+  protected:
+  explicit Resources_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.catalog.ResourceResult results = 3;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::com::wazuh::api::engine::catalog::ResourceResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceResult >*
+      mutable_results();
+  private:
+  const ::com::wazuh::api::engine::catalog::ResourceResult& _internal_results(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceResult* _internal_add_results();
+  public:
+  const ::com::wazuh::api::engine::catalog::ResourceResult& results(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceResult >&
+      results() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.Resources_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceResult > results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
 class NamespacesGet_Request final :
     public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.NamespacesGet_Request) */ {
  public:
@@ -1397,7 +2266,7 @@ class NamespacesGet_Request final :
                &_NamespacesGet_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    11;
 
   friend void swap(NamespacesGet_Request& a, NamespacesGet_Request& b) {
     a.Swap(&b);
@@ -1516,7 +2385,7 @@ class NamespacesGet_Response final :
                &_NamespacesGet_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    12;
 
   friend void swap(NamespacesGet_Response& a, NamespacesGet_Response& b) {
     a.Swap(&b);
@@ -2806,6 +3675,430 @@ inline void ResourceValidate_Request::set_allocated_namespaceid(std::string* nam
 
 // -------------------------------------------------------------------
 
+// ResourcesPost_Request
+
+// repeated .com.wazuh.api.engine.catalog.ResourcePost_Request resources = 1;
+inline int ResourcesPost_Request::_internal_resources_size() const {
+  return _impl_.resources_.size();
+}
+inline int ResourcesPost_Request::resources_size() const {
+  return _internal_resources_size();
+}
+inline void ResourcesPost_Request::clear_resources() {
+  _impl_.resources_.Clear();
+}
+inline ::com::wazuh::api::engine::catalog::ResourcePost_Request* ResourcesPost_Request::mutable_resources(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcesPost_Request.resources)
+  return _impl_.resources_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourcePost_Request >*
+ResourcesPost_Request::mutable_resources() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.catalog.ResourcesPost_Request.resources)
+  return &_impl_.resources_;
+}
+inline const ::com::wazuh::api::engine::catalog::ResourcePost_Request& ResourcesPost_Request::_internal_resources(int index) const {
+  return _impl_.resources_.Get(index);
+}
+inline const ::com::wazuh::api::engine::catalog::ResourcePost_Request& ResourcesPost_Request::resources(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcesPost_Request.resources)
+  return _internal_resources(index);
+}
+inline ::com::wazuh::api::engine::catalog::ResourcePost_Request* ResourcesPost_Request::_internal_add_resources() {
+  return _impl_.resources_.Add();
+}
+inline ::com::wazuh::api::engine::catalog::ResourcePost_Request* ResourcesPost_Request::add_resources() {
+  ::com::wazuh::api::engine::catalog::ResourcePost_Request* _add = _internal_add_resources();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.catalog.ResourcesPost_Request.resources)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourcePost_Request >&
+ResourcesPost_Request::resources() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.catalog.ResourcesPost_Request.resources)
+  return _impl_.resources_;
+}
+
+// -------------------------------------------------------------------
+
+// ResourcesGet_Request
+
+// repeated .com.wazuh.api.engine.catalog.ResourceGet_Request resources = 1;
+inline int ResourcesGet_Request::_internal_resources_size() const {
+  return _impl_.resources_.size();
+}
+inline int ResourcesGet_Request::resources_size() const {
+  return _internal_resources_size();
+}
+inline void ResourcesGet_Request::clear_resources() {
+  _impl_.resources_.Clear();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceGet_Request* ResourcesGet_Request::mutable_resources(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcesGet_Request.resources)
+  return _impl_.resources_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceGet_Request >*
+ResourcesGet_Request::mutable_resources() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.catalog.ResourcesGet_Request.resources)
+  return &_impl_.resources_;
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceGet_Request& ResourcesGet_Request::_internal_resources(int index) const {
+  return _impl_.resources_.Get(index);
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceGet_Request& ResourcesGet_Request::resources(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcesGet_Request.resources)
+  return _internal_resources(index);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceGet_Request* ResourcesGet_Request::_internal_add_resources() {
+  return _impl_.resources_.Add();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceGet_Request* ResourcesGet_Request::add_resources() {
+  ::com::wazuh::api::engine::catalog::ResourceGet_Request* _add = _internal_add_resources();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.catalog.ResourcesGet_Request.resources)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceGet_Request >&
+ResourcesGet_Request::resources() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.catalog.ResourcesGet_Request.resources)
+  return _impl_.resources_;
+}
+
+// -------------------------------------------------------------------
+
+// ResourcesValidate_Request
+
+// repeated .com.wazuh.api.engine.catalog.ResourceValidate_Request resources = 1;
+inline int ResourcesValidate_Request::_internal_resources_size() const {
+  return _impl_.resources_.size();
+}
+inline int ResourcesValidate_Request::resources_size() const {
+  return _internal_resources_size();
+}
+inline void ResourcesValidate_Request::clear_resources() {
+  _impl_.resources_.Clear();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceValidate_Request* ResourcesValidate_Request::mutable_resources(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcesValidate_Request.resources)
+  return _impl_.resources_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceValidate_Request >*
+ResourcesValidate_Request::mutable_resources() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.catalog.ResourcesValidate_Request.resources)
+  return &_impl_.resources_;
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceValidate_Request& ResourcesValidate_Request::_internal_resources(int index) const {
+  return _impl_.resources_.Get(index);
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceValidate_Request& ResourcesValidate_Request::resources(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcesValidate_Request.resources)
+  return _internal_resources(index);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceValidate_Request* ResourcesValidate_Request::_internal_add_resources() {
+  return _impl_.resources_.Add();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceValidate_Request* ResourcesValidate_Request::add_resources() {
+  ::com::wazuh::api::engine::catalog::ResourceValidate_Request* _add = _internal_add_resources();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.catalog.ResourcesValidate_Request.resources)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceValidate_Request >&
+ResourcesValidate_Request::resources() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.catalog.ResourcesValidate_Request.resources)
+  return _impl_.resources_;
+}
+
+// -------------------------------------------------------------------
+
+// ResourceResult
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void ResourceResult::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus ResourceResult::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus ResourceResult::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceResult.status)
+  return _internal_status();
+}
+inline void ResourceResult::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void ResourceResult::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceResult.status)
+}
+
+// optional string error = 2;
+inline bool ResourceResult::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResourceResult::has_error() const {
+  return _internal_has_error();
+}
+inline void ResourceResult::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResourceResult::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceResult.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourceResult::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceResult.error)
+}
+inline std::string* ResourceResult::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceResult.error)
+  return _s;
+}
+inline const std::string& ResourceResult::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void ResourceResult::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourceResult::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourceResult::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceResult.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResourceResult::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceResult.error)
+}
+
+// optional string content = 3;
+inline bool ResourceResult::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ResourceResult::has_content() const {
+  return _internal_has_content();
+}
+inline void ResourceResult::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ResourceResult::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceResult.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourceResult::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceResult.content)
+}
+inline std::string* ResourceResult::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceResult.content)
+  return _s;
+}
+inline const std::string& ResourceResult::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void ResourceResult::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourceResult::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourceResult::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceResult.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResourceResult::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceResult.content)
+}
+
+// -------------------------------------------------------------------
+
+// Resources_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void Resources_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus Resources_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus Resources_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.Resources_Response.status)
+  return _internal_status();
+}
+inline void Resources_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void Resources_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.Resources_Response.status)
+}
+
+// optional string error = 2;
+inline bool Resources_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Resources_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void Resources_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Resources_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.Resources_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Resources_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.Resources_Response.error)
+}
+inline std::string* Resources_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.Resources_Response.error)
+  return _s;
+}
+inline const std::string& Resources_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void Resources_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Resources_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Resources_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.Resources_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Resources_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.Resources_Response.error)
+}
+
+// repeated .com.wazuh.api.engine.catalog.ResourceResult results = 3;
+inline int Resources_Response::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int Resources_Response::results_size() const {
+  return _internal_results_size();
+}
+inline void Resources_Response::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceResult* Resources_Response::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.Resources_Response.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceResult >*
+Resources_Response::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.catalog.Resources_Response.results)
+  return &_impl_.results_;
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceResult& Resources_Response::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceResult& Resources_Response::results(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.Resources_Response.results)
+  return _internal_results(index);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceResult* Resources_Response::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceResult* Resources_Response::add_results() {
+  ::com::wazuh::api::engine::catalog::ResourceResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.catalog.Resources_Response.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceResult >&
+Resources_Response::results() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.catalog.Resources_Response.results)
+  return _impl_.results_;
+}
+
+// -------------------------------------------------------------------
+
 // NamespacesGet_Request
 
 // -------------------------------------------------------------------
@@ -2992,6 +4285,16 @@ NamespacesGet_Response::mutable_namespaces() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -14,31 +14,54 @@ namespace eMessage
 {
 
 /**
-* @brief Parse a JSON string into a google::protobuf::Message.
+ * @brief Parse a JSON string into an existing google::protobuf::Message.
  *
-* @tparam T The type of the google::protobuf::Message.
-* @param json The JSON string to parse.
-* @return A variant object with either an error message or the parsed message.
-*/
+ * The message is filled in place, so it can be a field of another message or live in an arena, and nothing is copied
+ * afterwards.
+ *
+ * @tparam T The type of the google::protobuf::Message.
+ * @param json The JSON string to parse.
+ * @param message The message to fill, it is cleared first.
+ * @return base::OptError The error if the JSON does not match the message.
+ */
 template<typename T>
-std::variant<base::Error, T> eMessageFromJson(const std::string& json)
+base::OptError eMessageFromJson(const std::string& json, T* message)
 {
     static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
-    T message;
 
     google::protobuf::util::JsonParseOptions inOptions = google::protobuf::util::JsonParseOptions();
     // inOptions.ignore_unknown_fields = false;
     inOptions.ignore_unknown_fields = true;
     inOptions.case_insensitive_enum_parsing = false;
 
-    const auto res = google::protobuf::util::JsonStringToMessage(json, &message, inOptions);
+    const auto res = google::protobuf::util::JsonStringToMessage(json, message, inOptions);
     if (res.ok())
     {
-        return message;
+        return std::nullopt;
     }
     return base::Error {res.ToString()};
 }
 
+/**
+* @brief Parse a JSON string into a google::protobuf::Message.
+ *
+* @tparam T The type of the google::protobuf::Message.
+* @param json The JSON string to parse.
+* @return A variant object with either an error message or the parsed message.
+*/
+template<typename T>
+std::variant<base::Error, T> eMessageFromJson(const std::string& json)
+{
+    static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
+    T message;
+
+    if (auto error = eMessageFromJson(json, &message); error)
+    {
+        return std::move(*error);
+    }
+    return message;
+}
+
 /**
 * @brief Serialize a google::protobuf::Message into a JSON string.
 *
@@ -77,6 +77,7 @@ PROTOBUF_CONSTEXPR dbSearch_Request::dbSearch_Request(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/0u
   , /*decltype(_impl_.records_)*/0u} {}
 struct dbSearch_RequestDefaultTypeInternal {
@@ -94,6 +95,7 @@ PROTOBUF_CONSTEXPR dbSearch_Response::dbSearch_Response(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.entries_)*/{}
   , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.next_cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.status_)*/0} {}
 struct dbSearch_ResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR dbSearch_ResponseDefaultTypeInternal()
@@ -199,6 +201,7 @@ PROTOBUF_CONSTEXPR managerDump_Request::managerDump_Request(
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/0u
   , /*decltype(_impl_.records_)*/0u} {}
 struct managerDump_RequestDefaultTypeInternal {
@@ -216,6 +219,7 @@ PROTOBUF_CONSTEXPR managerDump_Response::managerDump_Response(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.entries_)*/{}
   , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.next_cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.status_)*/0} {}
 struct managerDump_ResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR managerDump_ResponseDefaultTypeInternal()
@@ -278,10 +282,12 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Request, _impl_.prefix_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Request, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Request, _impl_.records_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Request, _impl_.cursor_),
   0,
   1,
-  2,
   3,
+  4,
+  2,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -291,9 +297,11 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_.status_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_.error_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_.next_cursor_),
   ~0u,
   0,
   ~0u,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbDelete_Request, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbDelete_Request, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -363,9 +371,11 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.records_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.cursor_),
   0,
-  1,
   2,
+  3,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -375,24 +385,26 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.status_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.error_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.next_cursor_),
   ~0u,
   0,
   ~0u,
+  1,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 8, -1, sizeof(::com::wazuh::api::engine::kvdb::Entry)},
   { 10, 18, -1, sizeof(::com::wazuh::api::engine::kvdb::dbGet_Request)},
   { 20, 29, -1, sizeof(::com::wazuh::api::engine::kvdb::dbGet_Response)},
-  { 32, 42, -1, sizeof(::com::wazuh::api::engine::kvdb::dbSearch_Request)},
-  { 46, 55, -1, sizeof(::com::wazuh::api::engine::kvdb::dbSearch_Response)},
-  { 58, 66, -1, sizeof(::com::wazuh::api::engine::kvdb::dbDelete_Request)},
-  { 68, 76, -1, sizeof(::com::wazuh::api::engine::kvdb::dbPut_Request)},
-  { 78, 86, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Request)},
-  { 88, 97, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Response)},
-  { 100, 108, -1, sizeof(::com::wazuh::api::engine::kvdb::managerPost_Request)},
-  { 110, 117, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDelete_Request)},
-  { 118, 127, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Request)},
-  { 130, 139, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Response)},
+  { 32, 43, -1, sizeof(::com::wazuh::api::engine::kvdb::dbSearch_Request)},
+  { 48, 58, -1, sizeof(::com::wazuh::api::engine::kvdb::dbSearch_Response)},
+  { 62, 70, -1, sizeof(::com::wazuh::api::engine::kvdb::dbDelete_Request)},
+  { 72, 80, -1, sizeof(::com::wazuh::api::engine::kvdb::dbPut_Request)},
+  { 82, 90, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Request)},
+  { 92, 101, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Response)},
+  { 104, 112, -1, sizeof(::com::wazuh::api::engine::kvdb::managerPost_Request)},
+  { 114, 121, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDelete_Request)},
+  { 122, 132, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Request)},
+  { 136, 146, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -421,35 +433,39 @@ const char descriptor_table_protodef_kvdb_2eproto[] PROTOBUF_SECTION_VARIABLE(pr
   "key\"\230\001\n\016dbGet_Response\0222\n\006status\030\001 \001(\0162\""
   ".com.wazuh.api.engine.ReturnStatus\022\022\n\005er"
   "ror\030\002 \001(\tH\000\210\001\001\022*\n\005value\030\003 \001(\0132\026.google.p"
-  "rotobuf.ValueH\001\210\001\001B\010\n\006_errorB\010\n\006_value\"\214"
+  "rotobuf.ValueH\001\210\001\001B\010\n\006_errorB\010\n\006_value\"\254"
   "\001\n\020dbSearch_Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\023"
   "\n\006prefix\030\002 \001(\tH\001\210\001\001\022\021\n\004page\030\003 \001(\rH\002\210\001\001\022\024"
-  "\n\007records\030\004 \001(\rH\003\210\001\001B\007\n\005_nameB\t\n\007_prefix"
-  "B\007\n\005_pageB\n\n\010_records\"\230\001\n\021dbSearch_Respo"
-  "nse\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engi"
-  "ne.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007e"
-  "ntries\030\003 \003(\0132 .com.wazuh.api.engine.kvdb"
-  ".EntryB\010\n\006_error\"H\n\020dbDelete_Request\022\021\n\004"
-  "name\030\001 \001(\tH\000\210\001\001\022\020\n\003key\030\002 \001(\tH\001\210\001\001B\007\n\005_na"
-  "meB\006\n\004_key\"k\n\rdbPut_Request\022\021\n\004name\030\001 \001("
-  "\tH\000\210\001\001\0224\n\005entry\030\002 \001(\0132 .com.wazuh.api.en"
-  "gine.kvdb.EntryH\001\210\001\001B\007\n\005_nameB\010\n\006_entry\""
-  "\\\n\022managerGet_Request\022\026\n\016must_be_loaded\030"
-  "\001 \001(\010\022\033\n\016filter_by_name\030\020 \001(\tH\000\210\001\001B\021\n\017_f"
-  "ilter_by_name\"t\n\023managerGet_Response\0222\n\006"
-  "status\030\001 \001(\0162\".com.wazuh.api.engine.Retu"
-  "rnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\013\n\003dbs\030\003 \003("
-  "\tB\010\n\006_error\"M\n\023managerPost_Request\022\021\n\004na"
-  "me\030\001 \001(\tH\000\210\001\001\022\021\n\004path\030\002 \001(\tH\001\210\001\001B\007\n\005_nam"
-  "eB\007\n\005_path\"3\n\025managerDelete_Request\022\021\n\004n"
-  "ame\030\001 \001(\tH\000\210\001\001B\007\n\005_name\"o\n\023managerDump_R"
-  "equest\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\021\n\004page\030\002 \001(\rH"
-  "\001\210\001\001\022\024\n\007records\030\003 \001(\rH\002\210\001\001B\007\n\005_nameB\007\n\005_"
-  "pageB\n\n\010_records\"\233\001\n\024managerDump_Respons"
-  "e\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engine"
-  ".ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007ent"
-  "ries\030\003 \003(\0132 .com.wazuh.api.engine.kvdb.E"
-  "ntryB\010\n\006_errorb\006proto3"
+  "\n\007records\030\004 \001(\rH\003\210\001\001\022\023\n\006cursor\030\005 \001(\tH\004\210\001"
+  "\001B\007\n\005_nameB\t\n\007_prefixB\007\n\005_pageB\n\n\010_recor"
+  "dsB\t\n\007_cursor\"\302\001\n\021dbSearch_Response\0222\n\006s"
+  "tatus\030\001 \001(\0162\".com.wazuh.api.engine.Retur"
+  "nStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007entries\030\003"
+  " \003(\0132 .com.wazuh.api.engine.kvdb.Entry\022\030"
+  "\n\013next_cursor\030\004 \001(\tH\001\210\001\001B\010\n\006_errorB\016\n\014_n"
+  "ext_cursor\"H\n\020dbDelete_Request\022\021\n\004name\030\001"
+  " \001(\tH\000\210\001\001\022\020\n\003key\030\002 \001(\tH\001\210\001\001B\007\n\005_nameB\006\n\004"
+  "_key\"k\n\rdbPut_Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001"
+  "\0224\n\005entry\030\002 \001(\0132 .com.wazuh.api.engine.k"
+  "vdb.EntryH\001\210\001\001B\007\n\005_nameB\010\n\006_entry\"\\\n\022man"
+  "agerGet_Request\022\026\n\016must_be_loaded\030\001 \001(\010\022"
+  "\033\n\016filter_by_name\030\020 \001(\tH\000\210\001\001B\021\n\017_filter_"
+  "by_name\"t\n\023managerGet_Response\0222\n\006status"
+  "\030\001 \001(\0162\".com.wazuh.api.engine.ReturnStat"
+  "us\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\013\n\003dbs\030\003 \003(\tB\010\n\006_"
+  "error\"M\n\023managerPost_Request\022\021\n\004name\030\001 \001"
+  "(\tH\000\210\001\001\022\021\n\004path\030\002 \001(\tH\001\210\001\001B\007\n\005_nameB\007\n\005_"
+  "path\"3\n\025managerDelete_Request\022\021\n\004name\030\001 "
+  "\001(\tH\000\210\001\001B\007\n\005_name\"\217\001\n\023managerDump_Reques"
+  "t\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\021\n\004page\030\002 \001(\rH\001\210\001\001\022"
+  "\024\n\007records\030\003 \001(\rH\002\210\001\001\022\023\n\006cursor\030\004 \001(\tH\003\210"
+  "\001\001B\007\n\005_nameB\007\n\005_pageB\n\n\010_recordsB\t\n\007_cur"
+  "sor\"\305\001\n\024managerDump_Response\0222\n\006status\030\001"
+  " \001(\0162\".com.wazuh.api.engine.ReturnStatus"
+  "\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007entries\030\003 \003(\0132 ."
+  "com.wazuh.api.engine.kvdb.Entry\022\030\n\013next_"
+  "cursor\030\004 \001(\tH\001\210\001\001B\010\n\006_errorB\016\n\014_next_cur"
+  "sorb\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_kvdb_2eproto_deps[2] = {
   &::descriptor_table_engine_2eproto,
@@ -457,7 +473,7 @@ static const ::_pbi::DescriptorTable* const descriptor_table_kvdb_2eproto_deps[2
 };
 static ::_pbi::once_flag descriptor_table_kvdb_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_kvdb_2eproto = {
-    false, false, 1502, descriptor_table_protodef_kvdb_2eproto,
+    false, false, 1651, descriptor_table_protodef_kvdb_2eproto,
     "kvdb.proto",
     &descriptor_table_kvdb_2eproto_once, descriptor_table_kvdb_2eproto_deps, 2, 13,
     schemas, file_default_instances, TableStruct_kvdb_2eproto::offsets,
@@ -1347,10 +1363,13 @@ class dbSearch_Request::_Internal {
     (*has_bits)[0] |= 2u;
   }
   static void set_has_page(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
+    (*has_bits)[0] |= 8u;
   }
   static void set_has_records(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
 };
 
@@ -1368,6 +1387,7 @@ dbSearch_Request::dbSearch_Request(const dbSearch_Request& from)
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
     , decltype(_impl_.prefix_){}
+    , decltype(_impl_.cursor_){}
     , decltype(_impl_.page_){}
     , decltype(_impl_.records_){}};
 
@@ -1388,6 +1408,14 @@ dbSearch_Request::dbSearch_Request(const dbSearch_Request& from)
     _this->_impl_.prefix_.Set(from._internal_prefix(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cursor()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.page_, &from._impl_.page_,
     static_cast<size_t>(reinterpret_cast<char*>(&_impl_.records_) -
     reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
@@ -1403,6 +1431,7 @@ inline void dbSearch_Request::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
     , decltype(_impl_.prefix_){}
+    , decltype(_impl_.cursor_){}
     , decltype(_impl_.page_){0u}
     , decltype(_impl_.records_){0u}
   };
@@ -1414,6 +1443,10 @@ inline void dbSearch_Request::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.prefix_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 dbSearch_Request::~dbSearch_Request() {
@@ -1429,6 +1462,7 @@ inline void dbSearch_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.name_.Destroy();
   _impl_.prefix_.Destroy();
+  _impl_.cursor_.Destroy();
 }
 
 void dbSearch_Request::SetCachedSize(int size) const {
@@ -1442,15 +1476,18 @@ void dbSearch_Request::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
+  if (cached_has_bits & 0x00000007u) {
     if (cached_has_bits & 0x00000001u) {
       _impl_.name_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000002u) {
       _impl_.prefix_.ClearNonDefaultToEmpty();
     }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.cursor_.ClearNonDefaultToEmpty();
+    }
   }
-  if (cached_has_bits & 0x0000000cu) {
+  if (cached_has_bits & 0x00000018u) {
     ::memset(&_impl_.page_, 0, static_cast<size_t>(
         reinterpret_cast<char*>(&_impl_.records_) -
         reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
@@ -1504,6 +1541,16 @@ const char* dbSearch_Request::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
+      // optional string cursor = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbSearch_Request.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1566,6 +1613,16 @@ uint8_t* dbSearch_Request::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_records(), target);
   }
 
+  // optional string cursor = 5;
+  if (_internal_has_cursor()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.dbSearch_Request.cursor");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_cursor(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1583,7 +1640,7 @@ size_t dbSearch_Request::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000001fu) {
     // optional string name = 1;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -1598,13 +1655,20 @@ size_t dbSearch_Request::ByteSizeLong() const {
           this->_internal_prefix());
     }
 
-    // optional uint32 page = 3;
+    // optional string cursor = 5;
     if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_cursor());
+    }
+
+    // optional uint32 page = 3;
+    if (cached_has_bits & 0x00000008u) {
       total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page());
     }
 
     // optional uint32 records = 4;
-    if (cached_has_bits & 0x00000008u) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_records());
     }
 
@@ -1628,7 +1692,7 @@ void dbSearch_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000001fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_name(from._internal_name());
     }
@@ -1636,9 +1700,12 @@ void dbSearch_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
       _this->_internal_set_prefix(from._internal_prefix());
     }
     if (cached_has_bits & 0x00000004u) {
-      _this->_impl_.page_ = from._impl_.page_;
+      _this->_internal_set_cursor(from._internal_cursor());
     }
     if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.page_ = from._impl_.page_;
+    }
+    if (cached_has_bits & 0x00000010u) {
       _this->_impl_.records_ = from._impl_.records_;
     }
     _this->_impl_._has_bits_[0] |= cached_has_bits;
@@ -1671,6 +1738,10 @@ void dbSearch_Request::InternalSwap(dbSearch_Request* other) {
       &_impl_.prefix_, lhs_arena,
       &other->_impl_.prefix_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(dbSearch_Request, _impl_.records_)
       + sizeof(dbSearch_Request::_impl_.records_)
@@ -1693,6 +1764,9 @@ class dbSearch_Response::_Internal {
   static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 dbSearch_Response::dbSearch_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -1709,6 +1783,7 @@ dbSearch_Response::dbSearch_Response(const dbSearch_Response& from)
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.entries_){from._impl_.entries_}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.next_cursor_){}
     , decltype(_impl_.status_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1720,6 +1795,14 @@ dbSearch_Response::dbSearch_Response(const dbSearch_Response& from)
     _this->_impl_.error_.Set(from._internal_error(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_.Set(from._internal_next_cursor(), 
+      _this->GetArenaForAllocation());
+  }
   _this->_impl_.status_ = from._impl_.status_;
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.dbSearch_Response)
 }
@@ -1733,12 +1816,17 @@ inline void dbSearch_Response::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.entries_){arena}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.next_cursor_){}
     , decltype(_impl_.status_){0}
   };
   _impl_.error_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.error_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 dbSearch_Response::~dbSearch_Response() {
@@ -1754,6 +1842,7 @@ inline void dbSearch_Response::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.entries_.~RepeatedPtrField();
   _impl_.error_.Destroy();
+  _impl_.next_cursor_.Destroy();
 }
 
 void dbSearch_Response::SetCachedSize(int size) const {
@@ -1768,8 +1857,13 @@ void dbSearch_Response::Clear() {
 
   _impl_.entries_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.next_cursor_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_.status_ = 0;
   _impl_._has_bits_.Clear();
@@ -1815,6 +1909,16 @@ const char* dbSearch_Response::_InternalParse(const char* ptr, ::_pbi::ParseCont
         } else
           goto handle_unusual;
         continue;
+      // optional string next_cursor = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_next_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbSearch_Response.next_cursor"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1870,6 +1974,16 @@ uint8_t* dbSearch_Response::_InternalSerialize(
         InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // optional string next_cursor = 4;
+  if (_internal_has_next_cursor()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next_cursor().data(), static_cast<int>(this->_internal_next_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.dbSearch_Response.next_cursor");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_next_cursor(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1893,14 +2007,23 @@ size_t dbSearch_Response::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional string error = 2;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
 
+    // optional string next_cursor = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_next_cursor());
+    }
+
+  }
   // .com.wazuh.api.engine.ReturnStatus status = 1;
   if (this->_internal_status() != 0) {
     total_size += 1 +
@@ -1926,8 +2049,14 @@ void dbSearch_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, cons
   (void) cached_has_bits;
 
   _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_next_cursor(from._internal_next_cursor());
+    }
   }
   if (from._internal_status() != 0) {
     _this->_internal_set_status(from._internal_status());
@@ -1957,6 +2086,10 @@ void dbSearch_Response::InternalSwap(dbSearch_Response* other) {
       &_impl_.error_, lhs_arena,
       &other->_impl_.error_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_cursor_, lhs_arena,
+      &other->_impl_.next_cursor_, rhs_arena
+  );
   swap(_impl_.status_, other->_impl_.status_);
 }
 
@@ -3549,10 +3682,13 @@ class managerDump_Request::_Internal {
     (*has_bits)[0] |= 1u;
   }
   static void set_has_page(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
+    (*has_bits)[0] |= 4u;
   }
   static void set_has_records(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
 };
 
@@ -3569,6 +3705,7 @@ managerDump_Request::managerDump_Request(const managerDump_Request& from)
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
+    , decltype(_impl_.cursor_){}
     , decltype(_impl_.page_){}
     , decltype(_impl_.records_){}};
 
@@ -3581,6 +3718,14 @@ managerDump_Request::managerDump_Request(const managerDump_Request& from)
     _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cursor()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.page_, &from._impl_.page_,
     static_cast<size_t>(reinterpret_cast<char*>(&_impl_.records_) -
     reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
@@ -3595,6 +3740,7 @@ inline void managerDump_Request::SharedCtor(
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
+    , decltype(_impl_.cursor_){}
     , decltype(_impl_.page_){0u}
     , decltype(_impl_.records_){0u}
   };
@@ -3602,6 +3748,10 @@ inline void managerDump_Request::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 managerDump_Request::~managerDump_Request() {
@@ -3616,6 +3766,7 @@ managerDump_Request::~managerDump_Request() {
 inline void managerDump_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.name_.Destroy();
+  _impl_.cursor_.Destroy();
 }
 
 void managerDump_Request::SetCachedSize(int size) const {
@@ -3629,10 +3780,15 @@ void managerDump_Request::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.name_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.cursor_.ClearNonDefaultToEmpty();
+    }
   }
-  if (cached_has_bits & 0x00000006u) {
+  if (cached_has_bits & 0x0000000cu) {
     ::memset(&_impl_.page_, 0, static_cast<size_t>(
         reinterpret_cast<char*>(&_impl_.records_) -
         reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
@@ -3676,6 +3832,16 @@ const char* managerDump_Request::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
+      // optional string cursor = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Request.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3728,6 +3894,16 @@ uint8_t* managerDump_Request::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_records(), target);
   }
 
+  // optional string cursor = 4;
+  if (_internal_has_cursor()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerDump_Request.cursor");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_cursor(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3745,7 +3921,7 @@ size_t managerDump_Request::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
+  if (cached_has_bits & 0x0000000fu) {
     // optional string name = 1;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -3753,13 +3929,20 @@ size_t managerDump_Request::ByteSizeLong() const {
           this->_internal_name());
     }
 
-    // optional uint32 page = 2;
+    // optional string cursor = 4;
     if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_cursor());
+    }
+
+    // optional uint32 page = 2;
+    if (cached_has_bits & 0x00000004u) {
       total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page());
     }
 
     // optional uint32 records = 3;
-    if (cached_has_bits & 0x00000004u) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_records());
     }
 
@@ -3783,14 +3966,17 @@ void managerDump_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
+  if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_name(from._internal_name());
     }
     if (cached_has_bits & 0x00000002u) {
-      _this->_impl_.page_ = from._impl_.page_;
+      _this->_internal_set_cursor(from._internal_cursor());
     }
     if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.page_ = from._impl_.page_;
+    }
+    if (cached_has_bits & 0x00000008u) {
       _this->_impl_.records_ = from._impl_.records_;
     }
     _this->_impl_._has_bits_[0] |= cached_has_bits;
@@ -3819,6 +4005,10 @@ void managerDump_Request::InternalSwap(managerDump_Request* other) {
       &_impl_.name_, lhs_arena,
       &other->_impl_.name_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(managerDump_Request, _impl_.records_)
       + sizeof(managerDump_Request::_impl_.records_)
@@ -3841,6 +4031,9 @@ class managerDump_Response::_Internal {
   static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 managerDump_Response::managerDump_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -3857,6 +4050,7 @@ managerDump_Response::managerDump_Response(const managerDump_Response& from)
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.entries_){from._impl_.entries_}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.next_cursor_){}
     , decltype(_impl_.status_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -3868,6 +4062,14 @@ managerDump_Response::managerDump_Response(const managerDump_Response& from)
     _this->_impl_.error_.Set(from._internal_error(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_.Set(from._internal_next_cursor(), 
+      _this->GetArenaForAllocation());
+  }
   _this->_impl_.status_ = from._impl_.status_;
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerDump_Response)
 }
@@ -3881,12 +4083,17 @@ inline void managerDump_Response::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.entries_){arena}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.next_cursor_){}
     , decltype(_impl_.status_){0}
   };
   _impl_.error_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.error_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 managerDump_Response::~managerDump_Response() {
@@ -3902,6 +4109,7 @@ inline void managerDump_Response::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.entries_.~RepeatedPtrField();
   _impl_.error_.Destroy();
+  _impl_.next_cursor_.Destroy();
 }
 
 void managerDump_Response::SetCachedSize(int size) const {
@@ -3916,8 +4124,13 @@ void managerDump_Response::Clear() {
 
   _impl_.entries_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.next_cursor_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_.status_ = 0;
   _impl_._has_bits_.Clear();
@@ -3963,6 +4176,16 @@ const char* managerDump_Response::_InternalParse(const char* ptr, ::_pbi::ParseC
         } else
           goto handle_unusual;
         continue;
+      // optional string next_cursor = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_next_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4018,6 +4241,16 @@ uint8_t* managerDump_Response::_InternalSerialize(
         InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // optional string next_cursor = 4;
+  if (_internal_has_next_cursor()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next_cursor().data(), static_cast<int>(this->_internal_next_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_next_cursor(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4041,14 +4274,23 @@ size_t managerDump_Response::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional string error = 2;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
+
+    // optional string next_cursor = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_next_cursor());
+    }
 
+  }
   // .com.wazuh.api.engine.ReturnStatus status = 1;
   if (this->_internal_status() != 0) {
     total_size += 1 +
@@ -4074,8 +4316,14 @@ void managerDump_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, c
   (void) cached_has_bits;
 
   _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_next_cursor(from._internal_next_cursor());
+    }
   }
   if (from._internal_status() != 0) {
     _this->_internal_set_status(from._internal_status());
@@ -4105,6 +4353,10 @@ void managerDump_Response::InternalSwap(managerDump_Response* other) {
       &_impl_.error_, lhs_arena,
       &other->_impl_.error_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_cursor_, lhs_arena,
+      &other->_impl_.next_cursor_, rhs_arena
+  );
   swap(_impl_.status_, other->_impl_.status_);
 }
 
@@ -786,6 +786,7 @@ class dbSearch_Request final :
   enum : int {
     kNameFieldNumber = 1,
     kPrefixFieldNumber = 2,
+    kCursorFieldNumber = 5,
     kPageFieldNumber = 3,
     kRecordsFieldNumber = 4,
   };
@@ -825,6 +826,24 @@ class dbSearch_Request final :
   std::string* _internal_mutable_prefix();
   public:
 
+  // optional string cursor = 5;
+  bool has_cursor() const;
+  private:
+  bool _internal_has_cursor() const;
+  public:
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
   // optional uint32 page = 3;
   bool has_page() const;
   private:
@@ -863,6 +882,7 @@ class dbSearch_Request final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
     uint32_t page_;
     uint32_t records_;
   };
@@ -994,6 +1014,7 @@ class dbSearch_Response final :
   enum : int {
     kEntriesFieldNumber = 3,
     kErrorFieldNumber = 2,
+    kNextCursorFieldNumber = 4,
     kStatusFieldNumber = 1,
   };
   // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
@@ -1032,6 +1053,24 @@ class dbSearch_Response final :
   std::string* _internal_mutable_error();
   public:
 
+  // optional string next_cursor = 4;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const std::string& next_cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next_cursor();
+  PROTOBUF_NODISCARD std::string* release_next_cursor();
+  void set_allocated_next_cursor(std::string* next_cursor);
+  private:
+  const std::string& _internal_next_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next_cursor(const std::string& value);
+  std::string* _internal_mutable_next_cursor();
+  public:
+
   // .com.wazuh.api.engine.ReturnStatus status = 1;
   void clear_status();
   ::com::wazuh::api::engine::ReturnStatus status() const;
@@ -1053,6 +1092,7 @@ class dbSearch_Response final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry > entries_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_cursor_;
     int status_;
   };
   union { Impl_ _impl_; };
@@ -2238,6 +2278,7 @@ class managerDump_Request final :
 
   enum : int {
     kNameFieldNumber = 1,
+    kCursorFieldNumber = 4,
     kPageFieldNumber = 2,
     kRecordsFieldNumber = 3,
   };
@@ -2259,6 +2300,24 @@ class managerDump_Request final :
   std::string* _internal_mutable_name();
   public:
 
+  // optional string cursor = 4;
+  bool has_cursor() const;
+  private:
+  bool _internal_has_cursor() const;
+  public:
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
   // optional uint32 page = 2;
   bool has_page() const;
   private:
@@ -2296,6 +2355,7 @@ class managerDump_Request final :
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
     uint32_t page_;
     uint32_t records_;
   };
@@ -2427,6 +2487,7 @@ class managerDump_Response final :
   enum : int {
     kEntriesFieldNumber = 3,
     kErrorFieldNumber = 2,
+    kNextCursorFieldNumber = 4,
     kStatusFieldNumber = 1,
   };
   // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
@@ -2465,6 +2526,24 @@ class managerDump_Response final :
   std::string* _internal_mutable_error();
   public:
 
+  // optional string next_cursor = 4;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const std::string& next_cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next_cursor();
+  PROTOBUF_NODISCARD std::string* release_next_cursor();
+  void set_allocated_next_cursor(std::string* next_cursor);
+  private:
+  const std::string& _internal_next_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next_cursor(const std::string& value);
+  std::string* _internal_mutable_next_cursor();
+  public:
+
   // .com.wazuh.api.engine.ReturnStatus status = 1;
   void clear_status();
   ::com::wazuh::api::engine::ReturnStatus status() const;
@@ -2486,6 +2565,7 @@ class managerDump_Response final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry > entries_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_cursor_;
     int status_;
   };
   union { Impl_ _impl_; };
@@ -3118,7 +3198,7 @@ inline void dbSearch_Request::set_allocated_prefix(std::string* prefix) {
 
 // optional uint32 page = 3;
 inline bool dbSearch_Request::_internal_has_page() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool dbSearch_Request::has_page() const {
@@ -3126,7 +3206,7 @@ inline bool dbSearch_Request::has_page() const {
 }
 inline void dbSearch_Request::clear_page() {
   _impl_.page_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline uint32_t dbSearch_Request::_internal_page() const {
   return _impl_.page_;
@@ -3136,7 +3216,7 @@ inline uint32_t dbSearch_Request::page() const {
   return _internal_page();
 }
 inline void dbSearch_Request::_internal_set_page(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_._has_bits_[0] |= 0x00000008u;
   _impl_.page_ = value;
 }
 inline void dbSearch_Request::set_page(uint32_t value) {
@@ -3146,7 +3226,7 @@ inline void dbSearch_Request::set_page(uint32_t value) {
 
 // optional uint32 records = 4;
 inline bool dbSearch_Request::_internal_has_records() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool dbSearch_Request::has_records() const {
@@ -3154,7 +3234,7 @@ inline bool dbSearch_Request::has_records() const {
 }
 inline void dbSearch_Request::clear_records() {
   _impl_.records_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000008u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline uint32_t dbSearch_Request::_internal_records() const {
   return _impl_.records_;
@@ -3164,7 +3244,7 @@ inline uint32_t dbSearch_Request::records() const {
   return _internal_records();
 }
 inline void dbSearch_Request::_internal_set_records(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_._has_bits_[0] |= 0x00000010u;
   _impl_.records_ = value;
 }
 inline void dbSearch_Request::set_records(uint32_t value) {
@@ -3172,6 +3252,74 @@ inline void dbSearch_Request::set_records(uint32_t value) {
   // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.records)
 }
 
+// optional string cursor = 5;
+inline bool dbSearch_Request::_internal_has_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool dbSearch_Request::has_cursor() const {
+  return _internal_has_cursor();
+}
+inline void dbSearch_Request::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& dbSearch_Request::cursor() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbSearch_Request::set_cursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+}
+inline std::string* dbSearch_Request::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+  return _s;
+}
+inline const std::string& dbSearch_Request::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void dbSearch_Request::_internal_set_cursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* dbSearch_Request::_internal_mutable_cursor() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* dbSearch_Request::release_cursor() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+  if (!_internal_has_cursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.cursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbSearch_Request::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+}
+
 // -------------------------------------------------------------------
 
 // dbSearch_Response
@@ -3304,6 +3452,74 @@ dbSearch_Response::entries() const {
   return _impl_.entries_;
 }
 
+// optional string next_cursor = 4;
+inline bool dbSearch_Response::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool dbSearch_Response::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void dbSearch_Response::clear_next_cursor() {
+  _impl_.next_cursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& dbSearch_Response::next_cursor() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Response.next_cursor)
+  return _internal_next_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbSearch_Response::set_next_cursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.next_cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Response.next_cursor)
+}
+inline std::string* dbSearch_Response::mutable_next_cursor() {
+  std::string* _s = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Response.next_cursor)
+  return _s;
+}
+inline const std::string& dbSearch_Response::_internal_next_cursor() const {
+  return _impl_.next_cursor_.Get();
+}
+inline void dbSearch_Response::_internal_set_next_cursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.next_cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* dbSearch_Response::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.next_cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* dbSearch_Response::release_next_cursor() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Response.next_cursor)
+  if (!_internal_has_next_cursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.next_cursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbSearch_Response::set_allocated_next_cursor(std::string* next_cursor) {
+  if (next_cursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.next_cursor_.SetAllocated(next_cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Response.next_cursor)
+}
+
 // -------------------------------------------------------------------
 
 // dbDelete_Request
@@ -4151,7 +4367,7 @@ inline void managerDump_Request::set_allocated_name(std::string* name) {
 
 // optional uint32 page = 2;
 inline bool managerDump_Request::_internal_has_page() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool managerDump_Request::has_page() const {
@@ -4159,7 +4375,7 @@ inline bool managerDump_Request::has_page() const {
 }
 inline void managerDump_Request::clear_page() {
   _impl_.page_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline uint32_t managerDump_Request::_internal_page() const {
   return _impl_.page_;
@@ -4169,7 +4385,7 @@ inline uint32_t managerDump_Request::page() const {
   return _internal_page();
 }
 inline void managerDump_Request::_internal_set_page(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_._has_bits_[0] |= 0x00000004u;
   _impl_.page_ = value;
 }
 inline void managerDump_Request::set_page(uint32_t value) {
@@ -4179,7 +4395,7 @@ inline void managerDump_Request::set_page(uint32_t value) {
 
 // optional uint32 records = 3;
 inline bool managerDump_Request::_internal_has_records() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool managerDump_Request::has_records() const {
@@ -4187,7 +4403,7 @@ inline bool managerDump_Request::has_records() const {
 }
 inline void managerDump_Request::clear_records() {
   _impl_.records_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline uint32_t managerDump_Request::_internal_records() const {
   return _impl_.records_;
@@ -4197,7 +4413,7 @@ inline uint32_t managerDump_Request::records() const {
   return _internal_records();
 }
 inline void managerDump_Request::_internal_set_records(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_._has_bits_[0] |= 0x00000008u;
   _impl_.records_ = value;
 }
 inline void managerDump_Request::set_records(uint32_t value) {
@@ -4205,6 +4421,74 @@ inline void managerDump_Request::set_records(uint32_t value) {
   // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerDump_Request.records)
 }
 
+// optional string cursor = 4;
+inline bool managerDump_Request::_internal_has_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool managerDump_Request::has_cursor() const {
+  return _internal_has_cursor();
+}
+inline void managerDump_Request::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& managerDump_Request::cursor() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void managerDump_Request::set_cursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+}
+inline std::string* managerDump_Request::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+  return _s;
+}
+inline const std::string& managerDump_Request::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void managerDump_Request::_internal_set_cursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* managerDump_Request::_internal_mutable_cursor() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* managerDump_Request::release_cursor() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+  if (!_internal_has_cursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.cursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void managerDump_Request::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+}
+
 // -------------------------------------------------------------------
 
 // managerDump_Response
@@ -4337,6 +4621,74 @@ managerDump_Response::entries() const {
   return _impl_.entries_;
 }
 
+// optional string next_cursor = 4;
+inline bool managerDump_Response::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool managerDump_Response::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void managerDump_Response::clear_next_cursor() {
+  _impl_.next_cursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& managerDump_Response::next_cursor() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor)
+  return _internal_next_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void managerDump_Response::set_next_cursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.next_cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor)
+}
+inline std::string* managerDump_Response::mutable_next_cursor() {
+  std::string* _s = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor)
+  return _s;
+}
+inline const std::string& managerDump_Response::_internal_next_cursor() const {
+  return _impl_.next_cursor_.Get();
+}
+inline void managerDump_Response::_internal_set_next_cursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.next_cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* managerDump_Response::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.next_cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* managerDump_Response::release_next_cursor() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor)
+  if (!_internal_has_next_cursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.next_cursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void managerDump_Response::set_allocated_next_cursor(std::string* next_cursor) {
+  if (next_cursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.next_cursor_.SetAllocated(next_cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -33,7 +33,8 @@ PROTOBUF_CONSTEXPR EntryPost::EntryPost(
   , /*decltype(_impl_.policy_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.priority_)*/0u} {}
+  , /*decltype(_impl_.priority_)*/0u
+  , /*decltype(_impl_.tee_)*/false} {}
 struct EntryPostDefaultTypeInternal {
   PROTOBUF_CONSTEXPR EntryPostDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -54,7 +55,8 @@ PROTOBUF_CONSTEXPR Entry::Entry(
   , /*decltype(_impl_.priority_)*/0u
   , /*decltype(_impl_.policy_sync_)*/0
   , /*decltype(_impl_.entry_status_)*/0
-  , /*decltype(_impl_.uptime_)*/0u} {}
+  , /*decltype(_impl_.uptime_)*/0u
+  , /*decltype(_impl_.tee_)*/false} {}
 struct EntryDefaultTypeInternal {
   PROTOBUF_CONSTEXPR EntryDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -252,12 +254,145 @@ struct EpsDisable_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpsDisable_RequestDefaultTypeInternal _EpsDisable_Request_default_instance_;
+PROTOBUF_CONSTEXPR ProfilerEnable_Request::ProfilerEnable_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sample_rate_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ProfilerEnable_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProfilerEnable_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProfilerEnable_RequestDefaultTypeInternal() {}
+  union {
+    ProfilerEnable_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProfilerEnable_RequestDefaultTypeInternal _ProfilerEnable_Request_default_instance_;
+PROTOBUF_CONSTEXPR ProfilerDisable_Request::ProfilerDisable_Request(
+    ::_pbi::ConstantInitialized) {}
+struct ProfilerDisable_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProfilerDisable_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProfilerDisable_RequestDefaultTypeInternal() {}
+  union {
+    ProfilerDisable_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProfilerDisable_RequestDefaultTypeInternal _ProfilerDisable_Request_default_instance_;
+PROTOBUF_CONSTEXPR ProfilerGet_Request::ProfilerGet_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.top_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ProfilerGet_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProfilerGet_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProfilerGet_RequestDefaultTypeInternal() {}
+  union {
+    ProfilerGet_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProfilerGet_RequestDefaultTypeInternal _ProfilerGet_Request_default_instance_;
+PROTOBUF_CONSTEXPR ProfilerStats::ProfilerStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.calls_)*/uint64_t{0u}
+  , /*decltype(_impl_.matches_)*/uint64_t{0u}
+  , /*decltype(_impl_.match_rate_)*/0
+  , /*decltype(_impl_.total_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ProfilerStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProfilerStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProfilerStatsDefaultTypeInternal() {}
+  union {
+    ProfilerStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProfilerStatsDefaultTypeInternal _ProfilerStats_default_instance_;
+PROTOBUF_CONSTEXPR ProfilerGet_Response::ProfilerGet_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.assets_)*/{}
+  , /*decltype(_impl_.helpers_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.enabled_)*/false
+  , /*decltype(_impl_.sample_rate_)*/0u} {}
+struct ProfilerGet_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProfilerGet_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProfilerGet_ResponseDefaultTypeInternal() {}
+  union {
+    ProfilerGet_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProfilerGet_ResponseDefaultTypeInternal _ProfilerGet_Response_default_instance_;
+PROTOBUF_CONSTEXPR TapEnable_Request::TapEnable_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.field_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sample_rate_)*/0} {}
+struct TapEnable_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TapEnable_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TapEnable_RequestDefaultTypeInternal() {}
+  union {
+    TapEnable_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TapEnable_RequestDefaultTypeInternal _TapEnable_Request_default_instance_;
+PROTOBUF_CONSTEXPR TapDisable_Request::TapDisable_Request(
+    ::_pbi::ConstantInitialized) {}
+struct TapDisable_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TapDisable_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TapDisable_RequestDefaultTypeInternal() {}
+  union {
+    TapDisable_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TapDisable_RequestDefaultTypeInternal _TapDisable_Request_default_instance_;
+PROTOBUF_CONSTEXPR TapGet_Request::TapGet_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.max_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TapGet_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TapGet_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TapGet_RequestDefaultTypeInternal() {}
+  union {
+    TapGet_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TapGet_RequestDefaultTypeInternal _TapGet_Request_default_instance_;
+PROTOBUF_CONSTEXPR TapGet_Response::TapGet_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.enabled_)*/false
+  , /*decltype(_impl_.sample_rate_)*/0
+  , /*decltype(_impl_.sampled_)*/uint64_t{0u}
+  , /*decltype(_impl_.dropped_)*/uint64_t{0u}} {}
+struct TapGet_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TapGet_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TapGet_ResponseDefaultTypeInternal() {}
+  union {
+    TapGet_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TapGet_ResponseDefaultTypeInternal _TapGet_Response_default_instance_;
 }  // namespace router
 }  // namespace engine
 }  // namespace api
 }  // namespace wazuh
 }  // namespace com
-static ::_pb::Metadata file_level_metadata_router_2eproto[16];
+static ::_pb::Metadata file_level_metadata_router_2eproto[25];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_router_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_router_2eproto = nullptr;
 
@@ -273,11 +408,13 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.filter_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.priority_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.tee_),
   ~0u,
   ~0u,
   ~0u,
   ~0u,
   0,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -292,6 +429,7 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.policy_sync_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.entry_status_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.uptime_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.tee_),
   ~0u,
   ~0u,
   ~0u,
@@ -300,6 +438,7 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,
   ~0u,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePost_Request, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePost_Request, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -416,24 +555,127 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerEnable_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerEnable_Request, _impl_.sample_rate_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerDisable_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Request, _impl_.top_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerStats, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerStats, _impl_.calls_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerStats, _impl_.matches_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerStats, _impl_.match_rate_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerStats, _impl_.total_ns_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Response, _impl_.enabled_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Response, _impl_.sample_rate_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Response, _impl_.assets_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfilerGet_Response, _impl_.helpers_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapEnable_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapEnable_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapEnable_Request, _impl_.sample_rate_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapEnable_Request, _impl_.field_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapEnable_Request, _impl_.value_),
+  ~0u,
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapDisable_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Request, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _impl_.enabled_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _impl_.sample_rate_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _impl_.sampled_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TapGet_Response, _impl_.dropped_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, 11, -1, sizeof(::com::wazuh::api::engine::router::EntryPost)},
-  { 16, 30, -1, sizeof(::com::wazuh::api::engine::router::Entry)},
-  { 38, 45, -1, sizeof(::com::wazuh::api::engine::router::RoutePost_Request)},
-  { 46, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteDelete_Request)},
-  { 53, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Request)},
-  { 60, 69, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Response)},
-  { 72, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteReload_Request)},
-  { 79, -1, -1, sizeof(::com::wazuh::api::engine::router::RoutePatchPriority_Request)},
-  { 87, -1, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Request)},
-  { 93, 102, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Response)},
-  { 105, -1, -1, sizeof(::com::wazuh::api::engine::router::QueuePost_Request)},
-  { 112, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsUpdate_Request)},
-  { 120, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Request)},
-  { 126, 137, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Response)},
-  { 142, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsEnable_Request)},
-  { 148, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsDisable_Request)},
+  { 0, 12, -1, sizeof(::com::wazuh::api::engine::router::EntryPost)},
+  { 18, 33, -1, sizeof(::com::wazuh::api::engine::router::Entry)},
+  { 42, 49, -1, sizeof(::com::wazuh::api::engine::router::RoutePost_Request)},
+  { 50, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteDelete_Request)},
+  { 57, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Request)},
+  { 64, 73, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Response)},
+  { 76, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteReload_Request)},
+  { 83, -1, -1, sizeof(::com::wazuh::api::engine::router::RoutePatchPriority_Request)},
+  { 91, -1, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Request)},
+  { 97, 106, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Response)},
+  { 109, -1, -1, sizeof(::com::wazuh::api::engine::router::QueuePost_Request)},
+  { 116, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsUpdate_Request)},
+  { 124, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Request)},
+  { 130, 141, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Response)},
+  { 146, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsEnable_Request)},
+  { 152, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsDisable_Request)},
+  { 158, -1, -1, sizeof(::com::wazuh::api::engine::router::ProfilerEnable_Request)},
+  { 165, -1, -1, sizeof(::com::wazuh::api::engine::router::ProfilerDisable_Request)},
+  { 171, -1, -1, sizeof(::com::wazuh::api::engine::router::ProfilerGet_Request)},
+  { 178, -1, -1, sizeof(::com::wazuh::api::engine::router::ProfilerStats)},
+  { 189, 201, -1, sizeof(::com::wazuh::api::engine::router::ProfilerGet_Response)},
+  { 207, 216, -1, sizeof(::com::wazuh::api::engine::router::TapEnable_Request)},
+  { 219, -1, -1, sizeof(::com::wazuh::api::engine::router::TapDisable_Request)},
+  { 225, -1, -1, sizeof(::com::wazuh::api::engine::router::TapGet_Request)},
+  { 232, 245, -1, sizeof(::com::wazuh::api::engine::router::TapGet_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -453,56 +695,86 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::com::wazuh::api::engine::router::_EpsGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsEnable_Request_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsDisable_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_ProfilerEnable_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_ProfilerDisable_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_ProfilerGet_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_ProfilerStats_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_ProfilerGet_Response_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_TapEnable_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_TapDisable_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_TapGet_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_TapGet_Response_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_router_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\014router.proto\022\033com.wazuh.api.engine.rou"
-  "ter\032\014engine.proto\"u\n\tEntryPost\022\014\n\004name\030\001"
-  " \001(\t\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n\010"
-  "priority\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001\001"
-  "B\016\n\014_description\"\363\001\n\005Entry\022\014\n\004name\030\001 \001(\t"
-  "\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n\010prio"
-  "rity\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001\001\0226\n\013"
-  "policy_sync\030\006 \001(\0162!.com.wazuh.api.engine"
-  ".router.Sync\0228\n\014entry_status\030\007 \001(\0162\".com"
-  ".wazuh.api.engine.router.State\022\016\n\006uptime"
-  "\030\010 \001(\rB\016\n\014_description\"Y\n\021RoutePost_Requ"
-  "est\022:\n\005route\030\001 \001(\0132&.com.wazuh.api.engin"
-  "e.router.EntryPostH\000\210\001\001B\010\n\006_route\"#\n\023Rou"
-  "teDelete_Request\022\014\n\004name\030\001 \001(\t\" \n\020RouteG"
-  "et_Request\022\014\n\004name\030\001 \001(\t\"\247\001\n\021RouteGet_Re"
-  "sponse\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.e"
-  "ngine.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0226"
-  "\n\005route\030\003 \001(\0132\".com.wazuh.api.engine.rou"
-  "ter.EntryH\001\210\001\001B\010\n\006_errorB\010\n\006_route\"#\n\023Ro"
-  "uteReload_Request\022\014\n\004name\030\001 \001(\t\"<\n\032Route"
-  "PatchPriority_Request\022\014\n\004name\030\001 \001(\t\022\020\n\010p"
-  "riority\030\002 \001(\r\"\022\n\020TableGet_Request\"\230\001\n\021Ta"
-  "bleGet_Response\0222\n\006status\030\001 \001(\0162\".com.wa"
-  "zuh.api.engine.ReturnStatus\022\022\n\005error\030\002 \001"
-  "(\tH\000\210\001\001\0221\n\005table\030\003 \003(\0132\".com.wazuh.api.e"
-  "ngine.router.EntryB\010\n\006_error\"5\n\021QueuePos"
-  "t_Request\022\023\n\013wazuh_event\030\001 \001(\tJ\004\010\002\020\003R\005ev"
-  "ent\":\n\021EpsUpdate_Request\022\013\n\003eps\030\001 \001(\r\022\030\n"
-  "\020refresh_interval\030\002 \001(\r\"\020\n\016EpsGet_Reques"
-  "t\"\233\001\n\017EpsGet_Response\0222\n\006status\030\001 \001(\0162\"."
-  "com.wazuh.api.engine.ReturnStatus\022\022\n\005err"
-  "or\030\002 \001(\tH\000\210\001\001\022\013\n\003eps\030\003 \001(\r\022\030\n\020refresh_in"
-  "terval\030\004 \001(\r\022\017\n\007enabled\030\005 \001(\010B\010\n\006_error\""
-  "\023\n\021EpsEnable_Request\"\024\n\022EpsDisable_Reque"
-  "st*5\n\005State\022\021\n\rSTATE_UNKNOWN\020\000\022\014\n\010DISABL"
-  "ED\020\001\022\013\n\007ENABLED\020\002*>\n\004Sync\022\020\n\014SYNC_UNKNOW"
-  "N\020\000\022\013\n\007UPDATED\020\001\022\014\n\010OUTDATED\020\002\022\t\n\005ERROR\020"
-  "\003b\006proto3"
+  "ter\032\014engine.proto\"\202\001\n\tEntryPost\022\014\n\004name\030"
+  "\001 \001(\t\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n"
+  "\010priority\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001"
+  "\001\022\013\n\003tee\030\006 \001(\010B\016\n\014_description\"\200\002\n\005Entry"
+  "\022\014\n\004name\030\001 \001(\t\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter"
+  "\030\003 \001(\t\022\020\n\010priority\030\004 \001(\r\022\030\n\013description\030"
+  "\005 \001(\tH\000\210\001\001\0226\n\013policy_sync\030\006 \001(\0162!.com.wa"
+  "zuh.api.engine.router.Sync\0228\n\014entry_stat"
+  "us\030\007 \001(\0162\".com.wazuh.api.engine.router.S"
+  "tate\022\016\n\006uptime\030\010 \001(\r\022\013\n\003tee\030\t \001(\010B\016\n\014_de"
+  "scription\"Y\n\021RoutePost_Request\022:\n\005route\030"
+  "\001 \001(\0132&.com.wazuh.api.engine.router.Entr"
+  "yPostH\000\210\001\001B\010\n\006_route\"#\n\023RouteDelete_Requ"
+  "est\022\014\n\004name\030\001 \001(\t\" \n\020RouteGet_Request\022\014\n"
+  "\004name\030\001 \001(\t\"\247\001\n\021RouteGet_Response\0222\n\006sta"
+  "tus\030\001 \001(\0162\".com.wazuh.api.engine.ReturnS"
+  "tatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0226\n\005route\030\003 \001(\013"
+  "2\".com.wazuh.api.engine.router.EntryH\001\210\001"
+  "\001B\010\n\006_errorB\010\n\006_route\"#\n\023RouteReload_Req"
+  "uest\022\014\n\004name\030\001 \001(\t\"<\n\032RoutePatchPriority"
+  "_Request\022\014\n\004name\030\001 \001(\t\022\020\n\010priority\030\002 \001(\r"
+  "\"\022\n\020TableGet_Request\"\230\001\n\021TableGet_Respon"
+  "se\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engin"
+  "e.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\005ta"
+  "ble\030\003 \003(\0132\".com.wazuh.api.engine.router."
+  "EntryB\010\n\006_error\"5\n\021QueuePost_Request\022\023\n\013"
+  "wazuh_event\030\001 \001(\tJ\004\010\002\020\003R\005event\":\n\021EpsUpd"
+  "ate_Request\022\013\n\003eps\030\001 \001(\r\022\030\n\020refresh_inte"
+  "rval\030\002 \001(\r\"\020\n\016EpsGet_Request\"\233\001\n\017EpsGet_"
+  "Response\0222\n\006status\030\001 \001(\0162\".com.wazuh.api"
+  ".engine.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001"
+  "\022\013\n\003eps\030\003 \001(\r\022\030\n\020refresh_interval\030\004 \001(\r\022"
+  "\017\n\007enabled\030\005 \001(\010B\010\n\006_error\"\023\n\021EpsEnable_"
+  "Request\"\024\n\022EpsDisable_Request\"-\n\026Profile"
+  "rEnable_Request\022\023\n\013sample_rate\030\001 \001(\r\"\031\n\027"
+  "ProfilerDisable_Request\"\"\n\023ProfilerGet_R"
+  "equest\022\013\n\003top\030\001 \001(\r\"c\n\rProfilerStats\022\014\n\004"
+  "name\030\001 \001(\t\022\r\n\005calls\030\002 \001(\004\022\017\n\007matches\030\003 \001"
+  "(\004\022\022\n\nmatch_rate\030\004 \001(\001\022\020\n\010total_ns\030\005 \001(\004"
+  "\"\207\002\n\024ProfilerGet_Response\0222\n\006status\030\001 \001("
+  "\0162\".com.wazuh.api.engine.ReturnStatus\022\022\n"
+  "\005error\030\002 \001(\tH\000\210\001\001\022\017\n\007enabled\030\003 \001(\010\022\023\n\013sa"
+  "mple_rate\030\004 \001(\r\022:\n\006assets\030\005 \003(\0132*.com.wa"
+  "zuh.api.engine.router.ProfilerStats\022;\n\007h"
+  "elpers\030\006 \003(\0132*.com.wazuh.api.engine.rout"
+  "er.ProfilerStatsB\010\n\006_error\"d\n\021TapEnable_"
+  "Request\022\023\n\013sample_rate\030\001 \001(\001\022\022\n\005field\030\002 "
+  "\001(\tH\000\210\001\001\022\022\n\005value\030\003 \001(\tH\001\210\001\001B\010\n\006_fieldB\010"
+  "\n\006_value\"\024\n\022TapDisable_Request\"\035\n\016TapGet"
+  "_Request\022\013\n\003max\030\001 \001(\r\"\273\001\n\017TapGet_Respons"
+  "e\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engine"
+  ".ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\017\n\007ena"
+  "bled\030\003 \001(\010\022\023\n\013sample_rate\030\004 \001(\001\022\016\n\006event"
+  "s\030\005 \003(\t\022\017\n\007sampled\030\006 \001(\004\022\017\n\007dropped\030\007 \001("
+  "\004B\010\n\006_error*5\n\005State\022\021\n\rSTATE_UNKNOWN\020\000\022"
+  "\014\n\010DISABLED\020\001\022\013\n\007ENABLED\020\002*>\n\004Sync\022\020\n\014SY"
+  "NC_UNKNOWN\020\000\022\013\n\007UPDATED\020\001\022\014\n\010OUTDATED\020\002\022"
+  "\t\n\005ERROR\020\003b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_router_2eproto_deps[1] = {
   &::descriptor_table_engine_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_router_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_router_2eproto = {
-    false, false, 1489, descriptor_table_protodef_router_2eproto,
+    false, false, 2338, descriptor_table_protodef_router_2eproto,
     "router.proto",
-    &descriptor_table_router_2eproto_once, descriptor_table_router_2eproto_deps, 1, 16,
+    &descriptor_table_router_2eproto_once, descriptor_table_router_2eproto_deps, 1, 25,
     schemas, file_default_instances, TableStruct_router_2eproto::offsets,
     file_level_metadata_router_2eproto, file_level_enum_descriptors_router_2eproto,
     file_level_service_descriptors_router_2eproto,
@@ -576,7 +848,8 @@ EntryPost::EntryPost(const EntryPost& from)
     , decltype(_impl_.policy_){}
     , decltype(_impl_.filter_){}
     , decltype(_impl_.description_){}
-    , decltype(_impl_.priority_){}};
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.tee_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.name_.InitDefault();
@@ -611,7 +884,9 @@ EntryPost::EntryPost(const EntryPost& from)
     _this->_impl_.description_.Set(from._internal_description(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.priority_ = from._impl_.priority_;
+  ::memcpy(&_impl_.priority_, &from._impl_.priority_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tee_) -
+    reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.tee_));
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EntryPost)
 }
 
@@ -627,6 +902,7 @@ inline void EntryPost::SharedCtor(
     , decltype(_impl_.filter_){}
     , decltype(_impl_.description_){}
     , decltype(_impl_.priority_){0u}
+    , decltype(_impl_.tee_){false}
   };
   _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -680,7 +956,9 @@ void EntryPost::Clear() {
   if (cached_has_bits & 0x00000001u) {
     _impl_.description_.ClearNonDefaultToEmpty();
   }
-  _impl_.priority_ = 0u;
+  ::memset(&_impl_.priority_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.tee_) -
+      reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.tee_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -740,6 +1018,14 @@ const char* EntryPost::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
         } else
           goto handle_unusual;
         continue;
+      // bool tee = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.tee_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -816,6 +1102,12 @@ uint8_t* EntryPost::_InternalSerialize(
         5, this->_internal_description(), target);
   }
 
+  // bool tee = 6;
+  if (this->_internal_tee() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_tee(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -866,6 +1158,11 @@ size_t EntryPost::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_priority());
   }
 
+  // bool tee = 6;
+  if (this->_internal_tee() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -899,6 +1196,9 @@ void EntryPost::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROT
   if (from._internal_priority() != 0) {
     _this->_internal_set_priority(from._internal_priority());
   }
+  if (from._internal_tee() != 0) {
+    _this->_internal_set_tee(from._internal_tee());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -935,7 +1235,12 @@ void EntryPost::InternalSwap(EntryPost* other) {
       &_impl_.description_, lhs_arena,
       &other->_impl_.description_, rhs_arena
   );
-  swap(_impl_.priority_, other->_impl_.priority_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EntryPost, _impl_.tee_)
+      + sizeof(EntryPost::_impl_.tee_)
+      - PROTOBUF_FIELD_OFFSET(EntryPost, _impl_.priority_)>(
+          reinterpret_cast<char*>(&_impl_.priority_),
+          reinterpret_cast<char*>(&other->_impl_.priority_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EntryPost::GetMetadata() const {
@@ -973,7 +1278,8 @@ Entry::Entry(const Entry& from)
     , decltype(_impl_.priority_){}
     , decltype(_impl_.policy_sync_){}
     , decltype(_impl_.entry_status_){}
-    , decltype(_impl_.uptime_){}};
+    , decltype(_impl_.uptime_){}
+    , decltype(_impl_.tee_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.name_.InitDefault();
@@ -1009,8 +1315,8 @@ Entry::Entry(const Entry& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.priority_, &from._impl_.priority_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.uptime_) -
-    reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.uptime_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tee_) -
+    reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.tee_));
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.Entry)
 }
 
@@ -1029,6 +1335,7 @@ inline void Entry::SharedCtor(
     , decltype(_impl_.policy_sync_){0}
     , decltype(_impl_.entry_status_){0}
     , decltype(_impl_.uptime_){0u}
+    , decltype(_impl_.tee_){false}
   };
   _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -1083,8 +1390,8 @@ void Entry::Clear() {
     _impl_.description_.ClearNonDefaultToEmpty();
   }
   ::memset(&_impl_.priority_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.uptime_) -
-      reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.uptime_));
+      reinterpret_cast<char*>(&_impl_.tee_) -
+      reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.tee_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -1170,6 +1477,14 @@ const char* Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // bool tee = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.tee_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1266,6 +1581,12 @@ uint8_t* Entry::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_uptime(), target);
   }
 
+  // bool tee = 9;
+  if (this->_internal_tee() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_tee(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1333,6 +1654,11 @@ size_t Entry::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_uptime());
   }
 
+  // bool tee = 9;
+  if (this->_internal_tee() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1375,6 +1701,9 @@ void Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF
   if (from._internal_uptime() != 0) {
     _this->_internal_set_uptime(from._internal_uptime());
   }
+  if (from._internal_tee() != 0) {
+    _this->_internal_set_tee(from._internal_tee());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1412,8 +1741,8 @@ void Entry::InternalSwap(Entry* other) {
       &other->_impl_.description_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Entry, _impl_.uptime_)
-      + sizeof(Entry::_impl_.uptime_)
+      PROTOBUF_FIELD_OFFSET(Entry, _impl_.tee_)
+      + sizeof(Entry::_impl_.tee_)
       - PROTOBUF_FIELD_OFFSET(Entry, _impl_.priority_)>(
           reinterpret_cast<char*>(&_impl_.priority_),
           reinterpret_cast<char*>(&other->_impl_.priority_));
@@ -3955,47 +4284,2077 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsDisable_Request::GetClassDa
       file_level_metadata_router_2eproto[15]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace router
-}  // namespace engine
-}  // namespace api
-}  // namespace wazuh
-}  // namespace com
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::EntryPost*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::EntryPost >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::EntryPost >(arena);
+// ===================================================================
+
+class ProfilerEnable_Request::_Internal {
+ public:
+};
+
+ProfilerEnable_Request::ProfilerEnable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.ProfilerEnable_Request)
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::Entry*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::Entry >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::Entry >(arena);
+ProfilerEnable_Request::ProfilerEnable_Request(const ProfilerEnable_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProfilerEnable_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sample_rate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.sample_rate_ = from._impl_.sample_rate_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.ProfilerEnable_Request)
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RoutePost_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RoutePost_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RoutePost_Request >(arena);
+
+inline void ProfilerEnable_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sample_rate_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteDelete_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteDelete_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteDelete_Request >(arena);
+
+ProfilerEnable_Request::~ProfilerEnable_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.ProfilerEnable_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteGet_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteGet_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteGet_Request >(arena);
+
+inline void ProfilerEnable_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteGet_Response*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteGet_Response >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteGet_Response >(arena);
+
+void ProfilerEnable_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteReload_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteReload_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteReload_Request >(arena);
+
+void ProfilerEnable_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.ProfilerEnable_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sample_rate_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RoutePatchPriority_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RoutePatchPriority_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RoutePatchPriority_Request >(arena);
+
+const char* ProfilerEnable_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 sample_rate = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sample_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::TableGet_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::TableGet_Request >(Arena* arena) {
+
+uint8_t* ProfilerEnable_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.ProfilerEnable_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 sample_rate = 1;
+  if (this->_internal_sample_rate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_sample_rate(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.ProfilerEnable_Request)
+  return target;
+}
+
+size_t ProfilerEnable_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.ProfilerEnable_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 sample_rate = 1;
+  if (this->_internal_sample_rate() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sample_rate());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProfilerEnable_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProfilerEnable_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProfilerEnable_Request::GetClassData() const { return &_class_data_; }
+
+
+void ProfilerEnable_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProfilerEnable_Request*>(&to_msg);
+  auto& from = static_cast<const ProfilerEnable_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.ProfilerEnable_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_sample_rate() != 0) {
+    _this->_internal_set_sample_rate(from._internal_sample_rate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProfilerEnable_Request::CopyFrom(const ProfilerEnable_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.ProfilerEnable_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProfilerEnable_Request::IsInitialized() const {
+  return true;
+}
+
+void ProfilerEnable_Request::InternalSwap(ProfilerEnable_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.sample_rate_, other->_impl_.sample_rate_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProfilerEnable_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[16]);
+}
+
+// ===================================================================
+
+class ProfilerDisable_Request::_Internal {
+ public:
+};
+
+ProfilerDisable_Request::ProfilerDisable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.ProfilerDisable_Request)
+}
+ProfilerDisable_Request::ProfilerDisable_Request(const ProfilerDisable_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  ProfilerDisable_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.ProfilerDisable_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProfilerDisable_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProfilerDisable_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProfilerDisable_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[17]);
+}
+
+// ===================================================================
+
+class ProfilerGet_Request::_Internal {
+ public:
+};
+
+ProfilerGet_Request::ProfilerGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.ProfilerGet_Request)
+}
+ProfilerGet_Request::ProfilerGet_Request(const ProfilerGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProfilerGet_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.top_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.top_ = from._impl_.top_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.ProfilerGet_Request)
+}
+
+inline void ProfilerGet_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.top_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ProfilerGet_Request::~ProfilerGet_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.ProfilerGet_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProfilerGet_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ProfilerGet_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProfilerGet_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.ProfilerGet_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.top_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProfilerGet_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 top = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.top_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProfilerGet_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.ProfilerGet_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 top = 1;
+  if (this->_internal_top() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_top(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.ProfilerGet_Request)
+  return target;
+}
+
+size_t ProfilerGet_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.ProfilerGet_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 top = 1;
+  if (this->_internal_top() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_top());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProfilerGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProfilerGet_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProfilerGet_Request::GetClassData() const { return &_class_data_; }
+
+
+void ProfilerGet_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProfilerGet_Request*>(&to_msg);
+  auto& from = static_cast<const ProfilerGet_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.ProfilerGet_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_top() != 0) {
+    _this->_internal_set_top(from._internal_top());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProfilerGet_Request::CopyFrom(const ProfilerGet_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.ProfilerGet_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProfilerGet_Request::IsInitialized() const {
+  return true;
+}
+
+void ProfilerGet_Request::InternalSwap(ProfilerGet_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.top_, other->_impl_.top_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProfilerGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[18]);
+}
+
+// ===================================================================
+
+class ProfilerStats::_Internal {
+ public:
+};
+
+ProfilerStats::ProfilerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.ProfilerStats)
+}
+ProfilerStats::ProfilerStats(const ProfilerStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProfilerStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.calls_){}
+    , decltype(_impl_.matches_){}
+    , decltype(_impl_.match_rate_){}
+    , decltype(_impl_.total_ns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.calls_, &from._impl_.calls_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_ns_) -
+    reinterpret_cast<char*>(&_impl_.calls_)) + sizeof(_impl_.total_ns_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.ProfilerStats)
+}
+
+inline void ProfilerStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.calls_){uint64_t{0u}}
+    , decltype(_impl_.matches_){uint64_t{0u}}
+    , decltype(_impl_.match_rate_){0}
+    , decltype(_impl_.total_ns_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ProfilerStats::~ProfilerStats() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.ProfilerStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProfilerStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void ProfilerStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProfilerStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.ProfilerStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.calls_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.total_ns_) -
+      reinterpret_cast<char*>(&_impl_.calls_)) + sizeof(_impl_.total_ns_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProfilerStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.ProfilerStats.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 calls = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.calls_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 matches = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.matches_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double match_rate = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.match_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_ns = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.total_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProfilerStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.ProfilerStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.ProfilerStats.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint64 calls = 2;
+  if (this->_internal_calls() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_calls(), target);
+  }
+
+  // uint64 matches = 3;
+  if (this->_internal_matches() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_matches(), target);
+  }
+
+  // double match_rate = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_match_rate = this->_internal_match_rate();
+  uint64_t raw_match_rate;
+  memcpy(&raw_match_rate, &tmp_match_rate, sizeof(tmp_match_rate));
+  if (raw_match_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_match_rate(), target);
+  }
+
+  // uint64 total_ns = 5;
+  if (this->_internal_total_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_total_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.ProfilerStats)
+  return target;
+}
+
+size_t ProfilerStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.ProfilerStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 calls = 2;
+  if (this->_internal_calls() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_calls());
+  }
+
+  // uint64 matches = 3;
+  if (this->_internal_matches() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_matches());
+  }
+
+  // double match_rate = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_match_rate = this->_internal_match_rate();
+  uint64_t raw_match_rate;
+  memcpy(&raw_match_rate, &tmp_match_rate, sizeof(tmp_match_rate));
+  if (raw_match_rate != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 total_ns = 5;
+  if (this->_internal_total_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProfilerStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProfilerStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProfilerStats::GetClassData() const { return &_class_data_; }
+
+
+void ProfilerStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProfilerStats*>(&to_msg);
+  auto& from = static_cast<const ProfilerStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.ProfilerStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_calls() != 0) {
+    _this->_internal_set_calls(from._internal_calls());
+  }
+  if (from._internal_matches() != 0) {
+    _this->_internal_set_matches(from._internal_matches());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_match_rate = from._internal_match_rate();
+  uint64_t raw_match_rate;
+  memcpy(&raw_match_rate, &tmp_match_rate, sizeof(tmp_match_rate));
+  if (raw_match_rate != 0) {
+    _this->_internal_set_match_rate(from._internal_match_rate());
+  }
+  if (from._internal_total_ns() != 0) {
+    _this->_internal_set_total_ns(from._internal_total_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProfilerStats::CopyFrom(const ProfilerStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.ProfilerStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProfilerStats::IsInitialized() const {
+  return true;
+}
+
+void ProfilerStats::InternalSwap(ProfilerStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProfilerStats, _impl_.total_ns_)
+      + sizeof(ProfilerStats::_impl_.total_ns_)
+      - PROTOBUF_FIELD_OFFSET(ProfilerStats, _impl_.calls_)>(
+          reinterpret_cast<char*>(&_impl_.calls_),
+          reinterpret_cast<char*>(&other->_impl_.calls_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProfilerStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[19]);
+}
+
+// ===================================================================
+
+class ProfilerGet_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProfilerGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ProfilerGet_Response::ProfilerGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.ProfilerGet_Response)
+}
+ProfilerGet_Response::ProfilerGet_Response(const ProfilerGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProfilerGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.assets_){from._impl_.assets_}
+    , decltype(_impl_.helpers_){from._impl_.helpers_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.enabled_){}
+    , decltype(_impl_.sample_rate_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sample_rate_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.sample_rate_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.ProfilerGet_Response)
+}
+
+inline void ProfilerGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.assets_){arena}
+    , decltype(_impl_.helpers_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.enabled_){false}
+    , decltype(_impl_.sample_rate_){0u}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ProfilerGet_Response::~ProfilerGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.ProfilerGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProfilerGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.assets_.~RepeatedPtrField();
+  _impl_.helpers_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
+
+void ProfilerGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProfilerGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.ProfilerGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.assets_.Clear();
+  _impl_.helpers_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  ::memset(&_impl_.status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sample_rate_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.sample_rate_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProfilerGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.ProfilerGet_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool enabled = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.enabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sample_rate = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.sample_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.router.ProfilerStats assets = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_assets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.router.ProfilerStats helpers = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_helpers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProfilerGet_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.ProfilerGet_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.ProfilerGet_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // bool enabled = 3;
+  if (this->_internal_enabled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_enabled(), target);
+  }
+
+  // uint32 sample_rate = 4;
+  if (this->_internal_sample_rate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_sample_rate(), target);
+  }
+
+  // repeated .com.wazuh.api.engine.router.ProfilerStats assets = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_assets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_assets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .com.wazuh.api.engine.router.ProfilerStats helpers = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_helpers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_helpers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.ProfilerGet_Response)
+  return target;
+}
+
+size_t ProfilerGet_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.ProfilerGet_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.router.ProfilerStats assets = 5;
+  total_size += 1UL * this->_internal_assets_size();
+  for (const auto& msg : this->_impl_.assets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .com.wazuh.api.engine.router.ProfilerStats helpers = 6;
+  total_size += 1UL * this->_internal_helpers_size();
+  for (const auto& msg : this->_impl_.helpers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // bool enabled = 3;
+  if (this->_internal_enabled() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 sample_rate = 4;
+  if (this->_internal_sample_rate() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sample_rate());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProfilerGet_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProfilerGet_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProfilerGet_Response::GetClassData() const { return &_class_data_; }
+
+
+void ProfilerGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProfilerGet_Response*>(&to_msg);
+  auto& from = static_cast<const ProfilerGet_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.ProfilerGet_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.assets_.MergeFrom(from._impl_.assets_);
+  _this->_impl_.helpers_.MergeFrom(from._impl_.helpers_);
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_enabled() != 0) {
+    _this->_internal_set_enabled(from._internal_enabled());
+  }
+  if (from._internal_sample_rate() != 0) {
+    _this->_internal_set_sample_rate(from._internal_sample_rate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProfilerGet_Response::CopyFrom(const ProfilerGet_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.ProfilerGet_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProfilerGet_Response::IsInitialized() const {
+  return true;
+}
+
+void ProfilerGet_Response::InternalSwap(ProfilerGet_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.assets_.InternalSwap(&other->_impl_.assets_);
+  _impl_.helpers_.InternalSwap(&other->_impl_.helpers_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProfilerGet_Response, _impl_.sample_rate_)
+      + sizeof(ProfilerGet_Response::_impl_.sample_rate_)
+      - PROTOBUF_FIELD_OFFSET(ProfilerGet_Response, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProfilerGet_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[20]);
+}
+
+// ===================================================================
+
+class TapEnable_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TapEnable_Request>()._impl_._has_bits_);
+  static void set_has_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+TapEnable_Request::TapEnable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.TapEnable_Request)
+}
+TapEnable_Request::TapEnable_Request(const TapEnable_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TapEnable_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.field_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.sample_rate_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.field_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.field_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_field()) {
+    _this->_impl_.field_.Set(from._internal_field(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.sample_rate_ = from._impl_.sample_rate_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.TapEnable_Request)
+}
+
+inline void TapEnable_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.field_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.sample_rate_){0}
+  };
+  _impl_.field_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.field_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TapEnable_Request::~TapEnable_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.TapEnable_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TapEnable_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.field_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void TapEnable_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TapEnable_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.TapEnable_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.field_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.sample_rate_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TapEnable_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double sample_rate = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.sample_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string field = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_field();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.TapEnable_Request.field"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.TapEnable_Request.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TapEnable_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.TapEnable_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double sample_rate = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sample_rate = this->_internal_sample_rate();
+  uint64_t raw_sample_rate;
+  memcpy(&raw_sample_rate, &tmp_sample_rate, sizeof(tmp_sample_rate));
+  if (raw_sample_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_sample_rate(), target);
+  }
+
+  // optional string field = 2;
+  if (_internal_has_field()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_field().data(), static_cast<int>(this->_internal_field().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.TapEnable_Request.field");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_field(), target);
+  }
+
+  // optional string value = 3;
+  if (_internal_has_value()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.TapEnable_Request.value");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.TapEnable_Request)
+  return target;
+}
+
+size_t TapEnable_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.TapEnable_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string field = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_field());
+    }
+
+    // optional string value = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_value());
+    }
+
+  }
+  // double sample_rate = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sample_rate = this->_internal_sample_rate();
+  uint64_t raw_sample_rate;
+  memcpy(&raw_sample_rate, &tmp_sample_rate, sizeof(tmp_sample_rate));
+  if (raw_sample_rate != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TapEnable_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TapEnable_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TapEnable_Request::GetClassData() const { return &_class_data_; }
+
+
+void TapEnable_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TapEnable_Request*>(&to_msg);
+  auto& from = static_cast<const TapEnable_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.TapEnable_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_field(from._internal_field());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sample_rate = from._internal_sample_rate();
+  uint64_t raw_sample_rate;
+  memcpy(&raw_sample_rate, &tmp_sample_rate, sizeof(tmp_sample_rate));
+  if (raw_sample_rate != 0) {
+    _this->_internal_set_sample_rate(from._internal_sample_rate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TapEnable_Request::CopyFrom(const TapEnable_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.TapEnable_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TapEnable_Request::IsInitialized() const {
+  return true;
+}
+
+void TapEnable_Request::InternalSwap(TapEnable_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.field_, lhs_arena,
+      &other->_impl_.field_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.sample_rate_, other->_impl_.sample_rate_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TapEnable_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[21]);
+}
+
+// ===================================================================
+
+class TapDisable_Request::_Internal {
+ public:
+};
+
+TapDisable_Request::TapDisable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.TapDisable_Request)
+}
+TapDisable_Request::TapDisable_Request(const TapDisable_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  TapDisable_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.TapDisable_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TapDisable_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TapDisable_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata TapDisable_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[22]);
+}
+
+// ===================================================================
+
+class TapGet_Request::_Internal {
+ public:
+};
+
+TapGet_Request::TapGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.TapGet_Request)
+}
+TapGet_Request::TapGet_Request(const TapGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TapGet_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.max_ = from._impl_.max_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.TapGet_Request)
+}
+
+inline void TapGet_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.max_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TapGet_Request::~TapGet_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.TapGet_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TapGet_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TapGet_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TapGet_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.TapGet_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.max_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TapGet_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 max = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TapGet_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.TapGet_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 max = 1;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.TapGet_Request)
+  return target;
+}
+
+size_t TapGet_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.TapGet_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 max = 1;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TapGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TapGet_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TapGet_Request::GetClassData() const { return &_class_data_; }
+
+
+void TapGet_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TapGet_Request*>(&to_msg);
+  auto& from = static_cast<const TapGet_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.TapGet_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TapGet_Request::CopyFrom(const TapGet_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.TapGet_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TapGet_Request::IsInitialized() const {
+  return true;
+}
+
+void TapGet_Request::InternalSwap(TapGet_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.max_, other->_impl_.max_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TapGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[23]);
+}
+
+// ===================================================================
+
+class TapGet_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TapGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TapGet_Response::TapGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.TapGet_Response)
+}
+TapGet_Response::TapGet_Response(const TapGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TapGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.enabled_){}
+    , decltype(_impl_.sample_rate_){}
+    , decltype(_impl_.sampled_){}
+    , decltype(_impl_.dropped_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dropped_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.dropped_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.TapGet_Response)
+}
+
+inline void TapGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.enabled_){false}
+    , decltype(_impl_.sample_rate_){0}
+    , decltype(_impl_.sampled_){uint64_t{0u}}
+    , decltype(_impl_.dropped_){uint64_t{0u}}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TapGet_Response::~TapGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.TapGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TapGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
+
+void TapGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TapGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.TapGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  ::memset(&_impl_.status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dropped_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.dropped_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TapGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.TapGet_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool enabled = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.enabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double sample_rate = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.sample_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string events = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_events();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.TapGet_Response.events"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sampled = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.sampled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 dropped = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TapGet_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.TapGet_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.TapGet_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // bool enabled = 3;
+  if (this->_internal_enabled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_enabled(), target);
+  }
+
+  // double sample_rate = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sample_rate = this->_internal_sample_rate();
+  uint64_t raw_sample_rate;
+  memcpy(&raw_sample_rate, &tmp_sample_rate, sizeof(tmp_sample_rate));
+  if (raw_sample_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_sample_rate(), target);
+  }
+
+  // repeated string events = 5;
+  for (int i = 0, n = this->_internal_events_size(); i < n; i++) {
+    const auto& s = this->_internal_events(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.TapGet_Response.events");
+    target = stream->WriteString(5, s, target);
+  }
+
+  // uint64 sampled = 6;
+  if (this->_internal_sampled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_sampled(), target);
+  }
+
+  // uint64 dropped = 7;
+  if (this->_internal_dropped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_dropped(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.TapGet_Response)
+  return target;
+}
+
+size_t TapGet_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.TapGet_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string events = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.events_.size());
+  for (int i = 0, n = _impl_.events_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.events_.Get(i));
+  }
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // bool enabled = 3;
+  if (this->_internal_enabled() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // double sample_rate = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sample_rate = this->_internal_sample_rate();
+  uint64_t raw_sample_rate;
+  memcpy(&raw_sample_rate, &tmp_sample_rate, sizeof(tmp_sample_rate));
+  if (raw_sample_rate != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 sampled = 6;
+  if (this->_internal_sampled() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sampled());
+  }
+
+  // uint64 dropped = 7;
+  if (this->_internal_dropped() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_dropped());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TapGet_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TapGet_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TapGet_Response::GetClassData() const { return &_class_data_; }
+
+
+void TapGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TapGet_Response*>(&to_msg);
+  auto& from = static_cast<const TapGet_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.TapGet_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_enabled() != 0) {
+    _this->_internal_set_enabled(from._internal_enabled());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sample_rate = from._internal_sample_rate();
+  uint64_t raw_sample_rate;
+  memcpy(&raw_sample_rate, &tmp_sample_rate, sizeof(tmp_sample_rate));
+  if (raw_sample_rate != 0) {
+    _this->_internal_set_sample_rate(from._internal_sample_rate());
+  }
+  if (from._internal_sampled() != 0) {
+    _this->_internal_set_sampled(from._internal_sampled());
+  }
+  if (from._internal_dropped() != 0) {
+    _this->_internal_set_dropped(from._internal_dropped());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TapGet_Response::CopyFrom(const TapGet_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.TapGet_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TapGet_Response::IsInitialized() const {
+  return true;
+}
+
+void TapGet_Response::InternalSwap(TapGet_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TapGet_Response, _impl_.dropped_)
+      + sizeof(TapGet_Response::_impl_.dropped_)
+      - PROTOBUF_FIELD_OFFSET(TapGet_Response, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TapGet_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[24]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace router
+}  // namespace engine
+}  // namespace api
+}  // namespace wazuh
+}  // namespace com
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::EntryPost*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::EntryPost >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::EntryPost >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::Entry*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::Entry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::Entry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RoutePost_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RoutePost_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RoutePost_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteDelete_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteDelete_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteDelete_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteGet_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteGet_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteGet_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteReload_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteReload_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteReload_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RoutePatchPriority_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RoutePatchPriority_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RoutePatchPriority_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::TableGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::TableGet_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::TableGet_Request >(arena);
 }
 template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::TableGet_Response*
@@ -4026,6 +6385,42 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::EpsDisable_Reque
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::EpsDisable_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::EpsDisable_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::ProfilerEnable_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::ProfilerEnable_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::ProfilerEnable_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::ProfilerDisable_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::ProfilerDisable_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::ProfilerDisable_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::ProfilerGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::ProfilerGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::ProfilerGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::ProfilerStats*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::ProfilerStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::ProfilerStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::ProfilerGet_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::ProfilerGet_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::ProfilerGet_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::TapEnable_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::TapEnable_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::TapEnable_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::TapDisable_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::TapDisable_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::TapDisable_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::TapGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::TapGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::TapGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::TapGet_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::TapGet_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::TapGet_Response >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
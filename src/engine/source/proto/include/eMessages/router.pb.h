@@ -73,6 +73,21 @@ extern EpsGet_ResponseDefaultTypeInternal _EpsGet_Response_default_instance_;
 class EpsUpdate_Request;
 struct EpsUpdate_RequestDefaultTypeInternal;
 extern EpsUpdate_RequestDefaultTypeInternal _EpsUpdate_Request_default_instance_;
+class ProfilerDisable_Request;
+struct ProfilerDisable_RequestDefaultTypeInternal;
+extern ProfilerDisable_RequestDefaultTypeInternal _ProfilerDisable_Request_default_instance_;
+class ProfilerEnable_Request;
+struct ProfilerEnable_RequestDefaultTypeInternal;
+extern ProfilerEnable_RequestDefaultTypeInternal _ProfilerEnable_Request_default_instance_;
+class ProfilerGet_Request;
+struct ProfilerGet_RequestDefaultTypeInternal;
+extern ProfilerGet_RequestDefaultTypeInternal _ProfilerGet_Request_default_instance_;
+class ProfilerGet_Response;
+struct ProfilerGet_ResponseDefaultTypeInternal;
+extern ProfilerGet_ResponseDefaultTypeInternal _ProfilerGet_Response_default_instance_;
+class ProfilerStats;
+struct ProfilerStatsDefaultTypeInternal;
+extern ProfilerStatsDefaultTypeInternal _ProfilerStats_default_instance_;
 class QueuePost_Request;
 struct QueuePost_RequestDefaultTypeInternal;
 extern QueuePost_RequestDefaultTypeInternal _QueuePost_Request_default_instance_;
@@ -100,6 +115,18 @@ extern TableGet_RequestDefaultTypeInternal _TableGet_Request_default_instance_;
 class TableGet_Response;
 struct TableGet_ResponseDefaultTypeInternal;
 extern TableGet_ResponseDefaultTypeInternal _TableGet_Response_default_instance_;
+class TapDisable_Request;
+struct TapDisable_RequestDefaultTypeInternal;
+extern TapDisable_RequestDefaultTypeInternal _TapDisable_Request_default_instance_;
+class TapEnable_Request;
+struct TapEnable_RequestDefaultTypeInternal;
+extern TapEnable_RequestDefaultTypeInternal _TapEnable_Request_default_instance_;
+class TapGet_Request;
+struct TapGet_RequestDefaultTypeInternal;
+extern TapGet_RequestDefaultTypeInternal _TapGet_Request_default_instance_;
+class TapGet_Response;
+struct TapGet_ResponseDefaultTypeInternal;
+extern TapGet_ResponseDefaultTypeInternal _TapGet_Response_default_instance_;
 }  // namespace router
 }  // namespace engine
 }  // namespace api
@@ -113,6 +140,11 @@ template<> ::com::wazuh::api::engine::router::EpsEnable_Request* Arena::CreateMa
 template<> ::com::wazuh::api::engine::router::EpsGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::EpsGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsGet_Response>(Arena*);
 template<> ::com::wazuh::api::engine::router::EpsUpdate_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsUpdate_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::ProfilerDisable_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::ProfilerDisable_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::ProfilerEnable_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::ProfilerEnable_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::ProfilerGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::ProfilerGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::ProfilerGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::ProfilerGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::router::ProfilerStats* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::ProfilerStats>(Arena*);
 template<> ::com::wazuh::api::engine::router::QueuePost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::QueuePost_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RouteDelete_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteDelete_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RouteGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteGet_Request>(Arena*);
@@ -122,6 +154,10 @@ template<> ::com::wazuh::api::engine::router::RoutePost_Request* Arena::CreateMa
 template<> ::com::wazuh::api::engine::router::RouteReload_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteReload_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::TableGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::TableGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::TableGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::TableGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::router::TapDisable_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::TapDisable_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::TapEnable_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::TapEnable_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::TapGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::TapGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::TapGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::TapGet_Response>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace com {
 namespace wazuh {
@@ -310,6 +346,7 @@ class EntryPost final :
     kFilterFieldNumber = 3,
     kDescriptionFieldNumber = 5,
     kPriorityFieldNumber = 4,
+    kTeeFieldNumber = 6,
   };
   // string name = 1;
   void clear_name();
@@ -380,6 +417,15 @@ class EntryPost final :
   void _internal_set_priority(uint32_t value);
   public:
 
+  // bool tee = 6;
+  void clear_tee();
+  bool tee() const;
+  void set_tee(bool value);
+  private:
+  bool _internal_tee() const;
+  void _internal_set_tee(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EntryPost)
  private:
   class _Internal;
@@ -395,6 +441,7 @@ class EntryPost final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
     uint32_t priority_;
+    bool tee_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_router_2eproto;
@@ -530,6 +577,7 @@ class Entry final :
     kPolicySyncFieldNumber = 6,
     kEntryStatusFieldNumber = 7,
     kUptimeFieldNumber = 8,
+    kTeeFieldNumber = 9,
   };
   // string name = 1;
   void clear_name();
@@ -627,6 +675,15 @@ class Entry final :
   void _internal_set_uptime(uint32_t value);
   public:
 
+  // bool tee = 9;
+  void clear_tee();
+  bool tee() const;
+  void set_tee(bool value);
+  private:
+  bool _internal_tee() const;
+  void _internal_set_tee(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.Entry)
  private:
   class _Internal;
@@ -645,6 +702,7 @@ class Entry final :
     int policy_sync_;
     int entry_status_;
     uint32_t uptime_;
+    bool tee_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_router_2eproto;
@@ -2794,691 +2852,3135 @@ class EpsDisable_Request final :
   };
   friend struct ::TableStruct_router_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class ProfilerEnable_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.ProfilerEnable_Request) */ {
+ public:
+  inline ProfilerEnable_Request() : ProfilerEnable_Request(nullptr) {}
+  ~ProfilerEnable_Request() override;
+  explicit PROTOBUF_CONSTEXPR ProfilerEnable_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  ProfilerEnable_Request(const ProfilerEnable_Request& from);
+  ProfilerEnable_Request(ProfilerEnable_Request&& from) noexcept
+    : ProfilerEnable_Request() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// EntryPost
+  inline ProfilerEnable_Request& operator=(const ProfilerEnable_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerEnable_Request& operator=(ProfilerEnable_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string name = 1;
-inline void EntryPost::clear_name() {
-  _impl_.name_.ClearToEmpty();
-}
-inline const std::string& EntryPost::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.name)
-  return _internal_name();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.name)
-}
-inline std::string* EntryPost::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.name)
-  return _s;
-}
-inline const std::string& EntryPost::_internal_name() const {
-  return _impl_.name_.Get();
-}
-inline void EntryPost::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
-}
-inline std::string* EntryPost::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
-}
-inline std::string* EntryPost::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.name)
-  return _impl_.name_.Release();
-}
-inline void EntryPost::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.name)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerEnable_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerEnable_Request* internal_default_instance() {
+    return reinterpret_cast<const ProfilerEnable_Request*>(
+               &_ProfilerEnable_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-// string policy = 2;
-inline void EntryPost::clear_policy() {
-  _impl_.policy_.ClearToEmpty();
-}
-inline const std::string& EntryPost::policy() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.policy)
-  return _internal_policy();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_policy(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.policy)
-}
-inline std::string* EntryPost::mutable_policy() {
-  std::string* _s = _internal_mutable_policy();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.policy)
-  return _s;
-}
-inline const std::string& EntryPost::_internal_policy() const {
-  return _impl_.policy_.Get();
-}
-inline void EntryPost::_internal_set_policy(const std::string& value) {
-  
-  _impl_.policy_.Set(value, GetArenaForAllocation());
-}
-inline std::string* EntryPost::_internal_mutable_policy() {
-  
-  return _impl_.policy_.Mutable(GetArenaForAllocation());
-}
-inline std::string* EntryPost::release_policy() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.policy)
-  return _impl_.policy_.Release();
-}
-inline void EntryPost::set_allocated_policy(std::string* policy) {
-  if (policy != nullptr) {
-    
-  } else {
-    
+  friend void swap(ProfilerEnable_Request& a, ProfilerEnable_Request& b) {
+    a.Swap(&b);
   }
-  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.policy_.IsDefault()) {
-    _impl_.policy_.Set("", GetArenaForAllocation());
+  inline void Swap(ProfilerEnable_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerEnable_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.policy)
-}
 
-// string filter = 3;
-inline void EntryPost::clear_filter() {
-  _impl_.filter_.ClearToEmpty();
-}
-inline const std::string& EntryPost::filter() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.filter)
-  return _internal_filter();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_filter(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.filter)
-}
-inline std::string* EntryPost::mutable_filter() {
-  std::string* _s = _internal_mutable_filter();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.filter)
-  return _s;
-}
-inline const std::string& EntryPost::_internal_filter() const {
-  return _impl_.filter_.Get();
-}
-inline void EntryPost::_internal_set_filter(const std::string& value) {
-  
-  _impl_.filter_.Set(value, GetArenaForAllocation());
-}
-inline std::string* EntryPost::_internal_mutable_filter() {
-  
-  return _impl_.filter_.Mutable(GetArenaForAllocation());
-}
-inline std::string* EntryPost::release_filter() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.filter)
-  return _impl_.filter_.Release();
-}
-inline void EntryPost::set_allocated_filter(std::string* filter) {
-  if (filter != nullptr) {
-    
-  } else {
-    
+  // implements Message ----------------------------------------------
+
+  ProfilerEnable_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerEnable_Request>(arena);
   }
-  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.filter_.IsDefault()) {
-    _impl_.filter_.Set("", GetArenaForAllocation());
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfilerEnable_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfilerEnable_Request& from) {
+    ProfilerEnable_Request::MergeImpl(*this, from);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.filter)
-}
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// uint32 priority = 4;
-inline void EntryPost::clear_priority() {
-  _impl_.priority_ = 0u;
-}
-inline uint32_t EntryPost::_internal_priority() const {
-  return _impl_.priority_;
-}
-inline uint32_t EntryPost::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.priority)
-  return _internal_priority();
-}
-inline void EntryPost::_internal_set_priority(uint32_t value) {
-  
-  _impl_.priority_ = value;
-}
-inline void EntryPost::set_priority(uint32_t value) {
-  _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.priority)
-}
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// optional string description = 5;
-inline bool EntryPost::_internal_has_description() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool EntryPost::has_description() const {
-  return _internal_has_description();
-}
-inline void EntryPost::clear_description() {
-  _impl_.description_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& EntryPost::description() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.description)
-  return _internal_description();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_description(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.description)
-}
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfilerEnable_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.ProfilerEnable_Request";
+  }
+  protected:
+  explicit ProfilerEnable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSampleRateFieldNumber = 1,
+  };
+  // uint32 sample_rate = 1;
+  void clear_sample_rate();
+  uint32_t sample_rate() const;
+  void set_sample_rate(uint32_t value);
+  private:
+  uint32_t _internal_sample_rate() const;
+  void _internal_set_sample_rate(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.ProfilerEnable_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t sample_rate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerDisable_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.ProfilerDisable_Request) */ {
+ public:
+  inline ProfilerDisable_Request() : ProfilerDisable_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ProfilerDisable_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerDisable_Request(const ProfilerDisable_Request& from);
+  ProfilerDisable_Request(ProfilerDisable_Request&& from) noexcept
+    : ProfilerDisable_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerDisable_Request& operator=(const ProfilerDisable_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerDisable_Request& operator=(ProfilerDisable_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerDisable_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerDisable_Request* internal_default_instance() {
+    return reinterpret_cast<const ProfilerDisable_Request*>(
+               &_ProfilerDisable_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(ProfilerDisable_Request& a, ProfilerDisable_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerDisable_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerDisable_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerDisable_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerDisable_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ProfilerDisable_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ProfilerDisable_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.ProfilerDisable_Request";
+  }
+  protected:
+  explicit ProfilerDisable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.ProfilerDisable_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.ProfilerGet_Request) */ {
+ public:
+  inline ProfilerGet_Request() : ProfilerGet_Request(nullptr) {}
+  ~ProfilerGet_Request() override;
+  explicit PROTOBUF_CONSTEXPR ProfilerGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerGet_Request(const ProfilerGet_Request& from);
+  ProfilerGet_Request(ProfilerGet_Request&& from) noexcept
+    : ProfilerGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerGet_Request& operator=(const ProfilerGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerGet_Request& operator=(ProfilerGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerGet_Request* internal_default_instance() {
+    return reinterpret_cast<const ProfilerGet_Request*>(
+               &_ProfilerGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(ProfilerGet_Request& a, ProfilerGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfilerGet_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfilerGet_Request& from) {
+    ProfilerGet_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfilerGet_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.ProfilerGet_Request";
+  }
+  protected:
+  explicit ProfilerGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTopFieldNumber = 1,
+  };
+  // uint32 top = 1;
+  void clear_top();
+  uint32_t top() const;
+  void set_top(uint32_t value);
+  private:
+  uint32_t _internal_top() const;
+  void _internal_set_top(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.ProfilerGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t top_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.ProfilerStats) */ {
+ public:
+  inline ProfilerStats() : ProfilerStats(nullptr) {}
+  ~ProfilerStats() override;
+  explicit PROTOBUF_CONSTEXPR ProfilerStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerStats(const ProfilerStats& from);
+  ProfilerStats(ProfilerStats&& from) noexcept
+    : ProfilerStats() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerStats& operator=(const ProfilerStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerStats& operator=(ProfilerStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerStats* internal_default_instance() {
+    return reinterpret_cast<const ProfilerStats*>(
+               &_ProfilerStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(ProfilerStats& a, ProfilerStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfilerStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfilerStats& from) {
+    ProfilerStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfilerStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.ProfilerStats";
+  }
+  protected:
+  explicit ProfilerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kCallsFieldNumber = 2,
+    kMatchesFieldNumber = 3,
+    kMatchRateFieldNumber = 4,
+    kTotalNsFieldNumber = 5,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 calls = 2;
+  void clear_calls();
+  uint64_t calls() const;
+  void set_calls(uint64_t value);
+  private:
+  uint64_t _internal_calls() const;
+  void _internal_set_calls(uint64_t value);
+  public:
+
+  // uint64 matches = 3;
+  void clear_matches();
+  uint64_t matches() const;
+  void set_matches(uint64_t value);
+  private:
+  uint64_t _internal_matches() const;
+  void _internal_set_matches(uint64_t value);
+  public:
+
+  // double match_rate = 4;
+  void clear_match_rate();
+  double match_rate() const;
+  void set_match_rate(double value);
+  private:
+  double _internal_match_rate() const;
+  void _internal_set_match_rate(double value);
+  public:
+
+  // uint64 total_ns = 5;
+  void clear_total_ns();
+  uint64_t total_ns() const;
+  void set_total_ns(uint64_t value);
+  private:
+  uint64_t _internal_total_ns() const;
+  void _internal_set_total_ns(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.ProfilerStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t calls_;
+    uint64_t matches_;
+    double match_rate_;
+    uint64_t total_ns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.ProfilerGet_Response) */ {
+ public:
+  inline ProfilerGet_Response() : ProfilerGet_Response(nullptr) {}
+  ~ProfilerGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR ProfilerGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerGet_Response(const ProfilerGet_Response& from);
+  ProfilerGet_Response(ProfilerGet_Response&& from) noexcept
+    : ProfilerGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerGet_Response& operator=(const ProfilerGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerGet_Response& operator=(ProfilerGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerGet_Response* internal_default_instance() {
+    return reinterpret_cast<const ProfilerGet_Response*>(
+               &_ProfilerGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(ProfilerGet_Response& a, ProfilerGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfilerGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfilerGet_Response& from) {
+    ProfilerGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfilerGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.ProfilerGet_Response";
+  }
+  protected:
+  explicit ProfilerGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAssetsFieldNumber = 5,
+    kHelpersFieldNumber = 6,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kEnabledFieldNumber = 3,
+    kSampleRateFieldNumber = 4,
+  };
+  // repeated .com.wazuh.api.engine.router.ProfilerStats assets = 5;
+  int assets_size() const;
+  private:
+  int _internal_assets_size() const;
+  public:
+  void clear_assets();
+  ::com::wazuh::api::engine::router::ProfilerStats* mutable_assets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats >*
+      mutable_assets();
+  private:
+  const ::com::wazuh::api::engine::router::ProfilerStats& _internal_assets(int index) const;
+  ::com::wazuh::api::engine::router::ProfilerStats* _internal_add_assets();
+  public:
+  const ::com::wazuh::api::engine::router::ProfilerStats& assets(int index) const;
+  ::com::wazuh::api::engine::router::ProfilerStats* add_assets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats >&
+      assets() const;
+
+  // repeated .com.wazuh.api.engine.router.ProfilerStats helpers = 6;
+  int helpers_size() const;
+  private:
+  int _internal_helpers_size() const;
+  public:
+  void clear_helpers();
+  ::com::wazuh::api::engine::router::ProfilerStats* mutable_helpers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats >*
+      mutable_helpers();
+  private:
+  const ::com::wazuh::api::engine::router::ProfilerStats& _internal_helpers(int index) const;
+  ::com::wazuh::api::engine::router::ProfilerStats* _internal_add_helpers();
+  public:
+  const ::com::wazuh::api::engine::router::ProfilerStats& helpers(int index) const;
+  ::com::wazuh::api::engine::router::ProfilerStats* add_helpers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats >&
+      helpers() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // bool enabled = 3;
+  void clear_enabled();
+  bool enabled() const;
+  void set_enabled(bool value);
+  private:
+  bool _internal_enabled() const;
+  void _internal_set_enabled(bool value);
+  public:
+
+  // uint32 sample_rate = 4;
+  void clear_sample_rate();
+  uint32_t sample_rate() const;
+  void set_sample_rate(uint32_t value);
+  private:
+  uint32_t _internal_sample_rate() const;
+  void _internal_set_sample_rate(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.ProfilerGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats > assets_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats > helpers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+    bool enabled_;
+    uint32_t sample_rate_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TapEnable_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.TapEnable_Request) */ {
+ public:
+  inline TapEnable_Request() : TapEnable_Request(nullptr) {}
+  ~TapEnable_Request() override;
+  explicit PROTOBUF_CONSTEXPR TapEnable_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TapEnable_Request(const TapEnable_Request& from);
+  TapEnable_Request(TapEnable_Request&& from) noexcept
+    : TapEnable_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline TapEnable_Request& operator=(const TapEnable_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TapEnable_Request& operator=(TapEnable_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TapEnable_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TapEnable_Request* internal_default_instance() {
+    return reinterpret_cast<const TapEnable_Request*>(
+               &_TapEnable_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(TapEnable_Request& a, TapEnable_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TapEnable_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TapEnable_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TapEnable_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TapEnable_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TapEnable_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TapEnable_Request& from) {
+    TapEnable_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TapEnable_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.TapEnable_Request";
+  }
+  protected:
+  explicit TapEnable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFieldFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kSampleRateFieldNumber = 1,
+  };
+  // optional string field = 2;
+  bool has_field() const;
+  private:
+  bool _internal_has_field() const;
+  public:
+  void clear_field();
+  const std::string& field() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_field(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_field();
+  PROTOBUF_NODISCARD std::string* release_field();
+  void set_allocated_field(std::string* field);
+  private:
+  const std::string& _internal_field() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_field(const std::string& value);
+  std::string* _internal_mutable_field();
+  public:
+
+  // optional string value = 3;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // double sample_rate = 1;
+  void clear_sample_rate();
+  double sample_rate() const;
+  void set_sample_rate(double value);
+  private:
+  double _internal_sample_rate() const;
+  void _internal_set_sample_rate(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.TapEnable_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr field_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    double sample_rate_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TapDisable_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.TapDisable_Request) */ {
+ public:
+  inline TapDisable_Request() : TapDisable_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR TapDisable_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TapDisable_Request(const TapDisable_Request& from);
+  TapDisable_Request(TapDisable_Request&& from) noexcept
+    : TapDisable_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline TapDisable_Request& operator=(const TapDisable_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TapDisable_Request& operator=(TapDisable_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TapDisable_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TapDisable_Request* internal_default_instance() {
+    return reinterpret_cast<const TapDisable_Request*>(
+               &_TapDisable_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(TapDisable_Request& a, TapDisable_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TapDisable_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TapDisable_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TapDisable_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TapDisable_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const TapDisable_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const TapDisable_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.TapDisable_Request";
+  }
+  protected:
+  explicit TapDisable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.TapDisable_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TapGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.TapGet_Request) */ {
+ public:
+  inline TapGet_Request() : TapGet_Request(nullptr) {}
+  ~TapGet_Request() override;
+  explicit PROTOBUF_CONSTEXPR TapGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TapGet_Request(const TapGet_Request& from);
+  TapGet_Request(TapGet_Request&& from) noexcept
+    : TapGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline TapGet_Request& operator=(const TapGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TapGet_Request& operator=(TapGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TapGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TapGet_Request* internal_default_instance() {
+    return reinterpret_cast<const TapGet_Request*>(
+               &_TapGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(TapGet_Request& a, TapGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TapGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TapGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TapGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TapGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TapGet_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TapGet_Request& from) {
+    TapGet_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TapGet_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.TapGet_Request";
+  }
+  protected:
+  explicit TapGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMaxFieldNumber = 1,
+  };
+  // uint32 max = 1;
+  void clear_max();
+  uint32_t max() const;
+  void set_max(uint32_t value);
+  private:
+  uint32_t _internal_max() const;
+  void _internal_set_max(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.TapGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TapGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.TapGet_Response) */ {
+ public:
+  inline TapGet_Response() : TapGet_Response(nullptr) {}
+  ~TapGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR TapGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TapGet_Response(const TapGet_Response& from);
+  TapGet_Response(TapGet_Response&& from) noexcept
+    : TapGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline TapGet_Response& operator=(const TapGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TapGet_Response& operator=(TapGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TapGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TapGet_Response* internal_default_instance() {
+    return reinterpret_cast<const TapGet_Response*>(
+               &_TapGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(TapGet_Response& a, TapGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TapGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TapGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TapGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TapGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TapGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TapGet_Response& from) {
+    TapGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TapGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.TapGet_Response";
+  }
+  protected:
+  explicit TapGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 5,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kEnabledFieldNumber = 3,
+    kSampleRateFieldNumber = 4,
+    kSampledFieldNumber = 6,
+    kDroppedFieldNumber = 7,
+  };
+  // repeated string events = 5;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  const std::string& events(int index) const;
+  std::string* mutable_events(int index);
+  void set_events(int index, const std::string& value);
+  void set_events(int index, std::string&& value);
+  void set_events(int index, const char* value);
+  void set_events(int index, const char* value, size_t size);
+  std::string* add_events();
+  void add_events(const std::string& value);
+  void add_events(std::string&& value);
+  void add_events(const char* value);
+  void add_events(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& events() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_events();
+  private:
+  const std::string& _internal_events(int index) const;
+  std::string* _internal_add_events();
+  public:
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // bool enabled = 3;
+  void clear_enabled();
+  bool enabled() const;
+  void set_enabled(bool value);
+  private:
+  bool _internal_enabled() const;
+  void _internal_set_enabled(bool value);
+  public:
+
+  // double sample_rate = 4;
+  void clear_sample_rate();
+  double sample_rate() const;
+  void set_sample_rate(double value);
+  private:
+  double _internal_sample_rate() const;
+  void _internal_set_sample_rate(double value);
+  public:
+
+  // uint64 sampled = 6;
+  void clear_sampled();
+  uint64_t sampled() const;
+  void set_sampled(uint64_t value);
+  private:
+  uint64_t _internal_sampled() const;
+  void _internal_set_sampled(uint64_t value);
+  public:
+
+  // uint64 dropped = 7;
+  void clear_dropped();
+  uint64_t dropped() const;
+  void set_dropped(uint64_t value);
+  private:
+  uint64_t _internal_dropped() const;
+  void _internal_set_dropped(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.TapGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+    bool enabled_;
+    double sample_rate_;
+    uint64_t sampled_;
+    uint64_t dropped_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// EntryPost
+
+// string name = 1;
+inline void EntryPost::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& EntryPost::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.name)
+}
+inline std::string* EntryPost::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.name)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void EntryPost::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.name)
+  return _impl_.name_.Release();
+}
+inline void EntryPost::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.name)
+}
+
+// string policy = 2;
+inline void EntryPost::clear_policy() {
+  _impl_.policy_.ClearToEmpty();
+}
+inline const std::string& EntryPost::policy() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.policy)
+  return _internal_policy();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.policy)
+}
+inline std::string* EntryPost::mutable_policy() {
+  std::string* _s = _internal_mutable_policy();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.policy)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_policy() const {
+  return _impl_.policy_.Get();
+}
+inline void EntryPost::_internal_set_policy(const std::string& value) {
+  
+  _impl_.policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_policy() {
+  
+  return _impl_.policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_policy() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.policy)
+  return _impl_.policy_.Release();
+}
+inline void EntryPost::set_allocated_policy(std::string* policy) {
+  if (policy != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.policy_.IsDefault()) {
+    _impl_.policy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.policy)
+}
+
+// string filter = 3;
+inline void EntryPost::clear_filter() {
+  _impl_.filter_.ClearToEmpty();
+}
+inline const std::string& EntryPost::filter() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.filter)
+  return _internal_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_filter(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.filter)
+}
+inline std::string* EntryPost::mutable_filter() {
+  std::string* _s = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.filter)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_filter() const {
+  return _impl_.filter_.Get();
+}
+inline void EntryPost::_internal_set_filter(const std::string& value) {
+  
+  _impl_.filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_filter() {
+  
+  return _impl_.filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_filter() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.filter)
+  return _impl_.filter_.Release();
+}
+inline void EntryPost::set_allocated_filter(std::string* filter) {
+  if (filter != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filter_.IsDefault()) {
+    _impl_.filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.filter)
+}
+
+// uint32 priority = 4;
+inline void EntryPost::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t EntryPost::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t EntryPost::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.priority)
+  return _internal_priority();
+}
+inline void EntryPost::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void EntryPost::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.priority)
+}
+
+// optional string description = 5;
+inline bool EntryPost::_internal_has_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EntryPost::has_description() const {
+  return _internal_has_description();
+}
+inline void EntryPost::clear_description() {
+  _impl_.description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& EntryPost::description() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.description)
+}
 inline std::string* EntryPost::mutable_description() {
   std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.description)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.description)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void EntryPost::_internal_set_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_description() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.description)
+  if (!_internal_has_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EntryPost::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.description)
+}
+
+// bool tee = 6;
+inline void EntryPost::clear_tee() {
+  _impl_.tee_ = false;
+}
+inline bool EntryPost::_internal_tee() const {
+  return _impl_.tee_;
+}
+inline bool EntryPost::tee() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.tee)
+  return _internal_tee();
+}
+inline void EntryPost::_internal_set_tee(bool value) {
+  
+  _impl_.tee_ = value;
+}
+inline void EntryPost::set_tee(bool value) {
+  _internal_set_tee(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.tee)
+}
+
+// -------------------------------------------------------------------
+
+// Entry
+
+// string name = 1;
+inline void Entry::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Entry::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.name)
+}
+inline std::string* Entry::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.name)
+  return _s;
+}
+inline const std::string& Entry::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Entry::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.name)
+  return _impl_.name_.Release();
+}
+inline void Entry::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.name)
+}
+
+// string policy = 2;
+inline void Entry::clear_policy() {
+  _impl_.policy_.ClearToEmpty();
+}
+inline const std::string& Entry::policy() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy)
+  return _internal_policy();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy)
+}
+inline std::string* Entry::mutable_policy() {
+  std::string* _s = _internal_mutable_policy();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.policy)
+  return _s;
+}
+inline const std::string& Entry::_internal_policy() const {
+  return _impl_.policy_.Get();
+}
+inline void Entry::_internal_set_policy(const std::string& value) {
+  
+  _impl_.policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_policy() {
+  
+  return _impl_.policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_policy() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.policy)
+  return _impl_.policy_.Release();
+}
+inline void Entry::set_allocated_policy(std::string* policy) {
+  if (policy != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.policy_.IsDefault()) {
+    _impl_.policy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.policy)
+}
+
+// string filter = 3;
+inline void Entry::clear_filter() {
+  _impl_.filter_.ClearToEmpty();
+}
+inline const std::string& Entry::filter() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.filter)
+  return _internal_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_filter(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.filter)
+}
+inline std::string* Entry::mutable_filter() {
+  std::string* _s = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.filter)
+  return _s;
+}
+inline const std::string& Entry::_internal_filter() const {
+  return _impl_.filter_.Get();
+}
+inline void Entry::_internal_set_filter(const std::string& value) {
+  
+  _impl_.filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_filter() {
+  
+  return _impl_.filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_filter() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.filter)
+  return _impl_.filter_.Release();
+}
+inline void Entry::set_allocated_filter(std::string* filter) {
+  if (filter != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filter_.IsDefault()) {
+    _impl_.filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.filter)
+}
+
+// uint32 priority = 4;
+inline void Entry::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t Entry::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t Entry::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.priority)
+  return _internal_priority();
+}
+inline void Entry::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void Entry::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.priority)
+}
+
+// optional string description = 5;
+inline bool Entry::_internal_has_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Entry::has_description() const {
+  return _internal_has_description();
+}
+inline void Entry::clear_description() {
+  _impl_.description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Entry::description() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.description)
+}
+inline std::string* Entry::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.description)
+  return _s;
+}
+inline const std::string& Entry::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void Entry::_internal_set_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_description() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.description)
+  if (!_internal_has_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.description)
+}
+
+// .com.wazuh.api.engine.router.Sync policy_sync = 6;
+inline void Entry::clear_policy_sync() {
+  _impl_.policy_sync_ = 0;
+}
+inline ::com::wazuh::api::engine::router::Sync Entry::_internal_policy_sync() const {
+  return static_cast< ::com::wazuh::api::engine::router::Sync >(_impl_.policy_sync_);
+}
+inline ::com::wazuh::api::engine::router::Sync Entry::policy_sync() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy_sync)
+  return _internal_policy_sync();
+}
+inline void Entry::_internal_set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
+  
+  _impl_.policy_sync_ = value;
+}
+inline void Entry::set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
+  _internal_set_policy_sync(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy_sync)
+}
+
+// .com.wazuh.api.engine.router.State entry_status = 7;
+inline void Entry::clear_entry_status() {
+  _impl_.entry_status_ = 0;
+}
+inline ::com::wazuh::api::engine::router::State Entry::_internal_entry_status() const {
+  return static_cast< ::com::wazuh::api::engine::router::State >(_impl_.entry_status_);
+}
+inline ::com::wazuh::api::engine::router::State Entry::entry_status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.entry_status)
+  return _internal_entry_status();
+}
+inline void Entry::_internal_set_entry_status(::com::wazuh::api::engine::router::State value) {
+  
+  _impl_.entry_status_ = value;
+}
+inline void Entry::set_entry_status(::com::wazuh::api::engine::router::State value) {
+  _internal_set_entry_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.entry_status)
+}
+
+// uint32 uptime = 8;
+inline void Entry::clear_uptime() {
+  _impl_.uptime_ = 0u;
+}
+inline uint32_t Entry::_internal_uptime() const {
+  return _impl_.uptime_;
+}
+inline uint32_t Entry::uptime() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.uptime)
+  return _internal_uptime();
+}
+inline void Entry::_internal_set_uptime(uint32_t value) {
+  
+  _impl_.uptime_ = value;
+}
+inline void Entry::set_uptime(uint32_t value) {
+  _internal_set_uptime(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.uptime)
+}
+
+// bool tee = 9;
+inline void Entry::clear_tee() {
+  _impl_.tee_ = false;
+}
+inline bool Entry::_internal_tee() const {
+  return _impl_.tee_;
+}
+inline bool Entry::tee() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.tee)
+  return _internal_tee();
+}
+inline void Entry::_internal_set_tee(bool value) {
+  
+  _impl_.tee_ = value;
+}
+inline void Entry::set_tee(bool value) {
+  _internal_set_tee(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.tee)
+}
+
+// -------------------------------------------------------------------
+
+// RoutePost_Request
+
+// optional .com.wazuh.api.engine.router.EntryPost route = 1;
+inline bool RoutePost_Request::_internal_has_route() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
+  return value;
+}
+inline bool RoutePost_Request::has_route() const {
+  return _internal_has_route();
+}
+inline void RoutePost_Request::clear_route() {
+  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::_internal_route() const {
+  const ::com::wazuh::api::engine::router::EntryPost* p = _impl_.route_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::EntryPost&>(
+      ::com::wazuh::api::engine::router::_EntryPost_default_instance_);
+}
+inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::route() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePost_Request.route)
+  return _internal_route();
+}
+inline void RoutePost_Request::unsafe_arena_set_allocated_route(
+    ::com::wazuh::api::engine::router::EntryPost* route) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
+  }
+  _impl_.route_ = route;
+  if (route) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::release_route() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::unsafe_arena_release_route() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePost_Request.route)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::_internal_mutable_route() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.route_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::EntryPost>(GetArenaForAllocation());
+    _impl_.route_ = p;
+  }
+  return _impl_.route_;
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::mutable_route() {
+  ::com::wazuh::api::engine::router::EntryPost* _msg = _internal_mutable_route();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePost_Request.route)
+  return _msg;
+}
+inline void RoutePost_Request::set_allocated_route(::com::wazuh::api::engine::router::EntryPost* route) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.route_;
+  }
+  if (route) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
+    if (message_arena != submessage_arena) {
+      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, route, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.route_ = route;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+}
+
+// -------------------------------------------------------------------
+
+// RouteDelete_Request
+
+// string name = 1;
+inline void RouteDelete_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RouteDelete_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RouteDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteDelete_Request.name)
+}
+inline std::string* RouteDelete_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  return _s;
+}
+inline const std::string& RouteDelete_Request::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void RouteDelete_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RouteDelete_Request::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RouteDelete_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  return _impl_.name_.Release();
+}
+inline void RouteDelete_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteDelete_Request.name)
+}
+
+// -------------------------------------------------------------------
+
+// RouteGet_Request
+
+// string name = 1;
+inline void RouteGet_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RouteGet_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Request.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RouteGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Request.name)
+}
+inline std::string* RouteGet_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Request.name)
+  return _s;
+}
+inline const std::string& RouteGet_Request::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void RouteGet_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RouteGet_Request::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RouteGet_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Request.name)
+  return _impl_.name_.Release();
+}
+inline void RouteGet_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Request.name)
+}
+
+// -------------------------------------------------------------------
+
+// RouteGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void RouteGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.status)
+  return _internal_status();
+}
+inline void RouteGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void RouteGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool RouteGet_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RouteGet_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void RouteGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& RouteGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RouteGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.error)
+}
+inline std::string* RouteGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.error)
+  return _s;
+}
+inline const std::string& RouteGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void RouteGet_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RouteGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RouteGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RouteGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.error)
+}
+
+// optional .com.wazuh.api.engine.router.Entry route = 3;
+inline bool RouteGet_Response::_internal_has_route() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
+  return value;
+}
+inline bool RouteGet_Response::has_route() const {
+  return _internal_has_route();
+}
+inline void RouteGet_Response::clear_route() {
+  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::_internal_route() const {
+  const ::com::wazuh::api::engine::router::Entry* p = _impl_.route_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::Entry&>(
+      ::com::wazuh::api::engine::router::_Entry_default_instance_);
+}
+inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::route() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.route)
+  return _internal_route();
+}
+inline void RouteGet_Response::unsafe_arena_set_allocated_route(
+    ::com::wazuh::api::engine::router::Entry* route) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
+  }
+  _impl_.route_ = route;
+  if (route) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+}
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::release_route() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::unsafe_arena_release_route() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.route)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::_internal_mutable_route() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.route_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::Entry>(GetArenaForAllocation());
+    _impl_.route_ = p;
+  }
+  return _impl_.route_;
+}
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::mutable_route() {
+  ::com::wazuh::api::engine::router::Entry* _msg = _internal_mutable_route();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.route)
+  return _msg;
+}
+inline void RouteGet_Response::set_allocated_route(::com::wazuh::api::engine::router::Entry* route) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.route_;
+  }
+  if (route) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
+    if (message_arena != submessage_arena) {
+      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, route, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.route_ = route;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+}
+
+// -------------------------------------------------------------------
+
+// RouteReload_Request
+
+// string name = 1;
+inline void RouteReload_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RouteReload_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteReload_Request.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RouteReload_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteReload_Request.name)
+}
+inline std::string* RouteReload_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteReload_Request.name)
   return _s;
 }
-inline const std::string& EntryPost::_internal_description() const {
-  return _impl_.description_.Get();
+inline const std::string& RouteReload_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void EntryPost::_internal_set_description(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.description_.Set(value, GetArenaForAllocation());
+inline void RouteReload_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EntryPost::_internal_mutable_description() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.description_.Mutable(GetArenaForAllocation());
+inline std::string* RouteReload_Request::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EntryPost::release_description() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.description)
-  if (!_internal_has_description()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.description_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline std::string* RouteReload_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteReload_Request.name)
+  return _impl_.name_.Release();
 }
-inline void EntryPost::set_allocated_description(std::string* description) {
-  if (description != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+inline void RouteReload_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    
   }
-  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.description)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteReload_Request.name)
 }
 
 // -------------------------------------------------------------------
 
-// Entry
+// RoutePatchPriority_Request
 
 // string name = 1;
-inline void Entry::clear_name() {
+inline void RoutePatchPriority_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& Entry::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.name)
+inline const std::string& RoutePatchPriority_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_name(ArgT0&& arg0, ArgT... args) {
+void RoutePatchPriority_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
 }
-inline std::string* Entry::mutable_name() {
+inline std::string* RoutePatchPriority_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
   return _s;
 }
-inline const std::string& Entry::_internal_name() const {
+inline const std::string& RoutePatchPriority_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void Entry::_internal_set_name(const std::string& value) {
+inline void RoutePatchPriority_Request::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_name() {
+inline std::string* RoutePatchPriority_Request::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.name)
-  return _impl_.name_.Release();
+inline std::string* RoutePatchPriority_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+  return _impl_.name_.Release();
+}
+inline void RoutePatchPriority_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+}
+
+// uint32 priority = 2;
+inline void RoutePatchPriority_Request::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t RoutePatchPriority_Request::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t RoutePatchPriority_Request::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
+  return _internal_priority();
+}
+inline void RoutePatchPriority_Request::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void RoutePatchPriority_Request::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
+}
+
+// -------------------------------------------------------------------
+
+// TableGet_Request
+
+// -------------------------------------------------------------------
+
+// TableGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void TableGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.status)
+  return _internal_status();
+}
+inline void TableGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void TableGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool TableGet_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableGet_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void TableGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TableGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.error)
+}
+inline std::string* TableGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.error)
+  return _s;
+}
+inline const std::string& TableGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void TableGet_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TableGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TableGet_Response.error)
+}
+
+// repeated .com.wazuh.api.engine.router.Entry table = 3;
+inline int TableGet_Response::_internal_table_size() const {
+  return _impl_.table_.size();
+}
+inline int TableGet_Response::table_size() const {
+  return _internal_table_size();
+}
+inline void TableGet_Response::clear_table() {
+  _impl_.table_.Clear();
+}
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::mutable_table(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _impl_.table_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >*
+TableGet_Response::mutable_table() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.TableGet_Response.table)
+  return &_impl_.table_;
+}
+inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::_internal_table(int index) const {
+  return _impl_.table_.Get(index);
+}
+inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::table(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _internal_table(index);
+}
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::_internal_add_table() {
+  return _impl_.table_.Add();
 }
-inline void Entry::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.name)
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::add_table() {
+  ::com::wazuh::api::engine::router::Entry* _add = _internal_add_table();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >&
+TableGet_Response::table() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _impl_.table_;
 }
 
-// string policy = 2;
-inline void Entry::clear_policy() {
-  _impl_.policy_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// QueuePost_Request
+
+// string wazuh_event = 1;
+inline void QueuePost_Request::clear_wazuh_event() {
+  _impl_.wazuh_event_.ClearToEmpty();
 }
-inline const std::string& Entry::policy() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy)
-  return _internal_policy();
+inline const std::string& QueuePost_Request::wazuh_event() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  return _internal_wazuh_event();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_policy(ArgT0&& arg0, ArgT... args) {
+void QueuePost_Request::set_wazuh_event(ArgT0&& arg0, ArgT... args) {
  
- _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy)
+ _impl_.wazuh_event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
 }
-inline std::string* Entry::mutable_policy() {
-  std::string* _s = _internal_mutable_policy();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.policy)
+inline std::string* QueuePost_Request::mutable_wazuh_event() {
+  std::string* _s = _internal_mutable_wazuh_event();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
   return _s;
 }
-inline const std::string& Entry::_internal_policy() const {
-  return _impl_.policy_.Get();
+inline const std::string& QueuePost_Request::_internal_wazuh_event() const {
+  return _impl_.wazuh_event_.Get();
 }
-inline void Entry::_internal_set_policy(const std::string& value) {
+inline void QueuePost_Request::_internal_set_wazuh_event(const std::string& value) {
   
-  _impl_.policy_.Set(value, GetArenaForAllocation());
+  _impl_.wazuh_event_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_policy() {
+inline std::string* QueuePost_Request::_internal_mutable_wazuh_event() {
   
-  return _impl_.policy_.Mutable(GetArenaForAllocation());
+  return _impl_.wazuh_event_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_policy() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.policy)
-  return _impl_.policy_.Release();
+inline std::string* QueuePost_Request::release_wazuh_event() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  return _impl_.wazuh_event_.Release();
 }
-inline void Entry::set_allocated_policy(std::string* policy) {
-  if (policy != nullptr) {
+inline void QueuePost_Request::set_allocated_wazuh_event(std::string* wazuh_event) {
+  if (wazuh_event != nullptr) {
     
   } else {
     
   }
-  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
+  _impl_.wazuh_event_.SetAllocated(wazuh_event, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.policy_.IsDefault()) {
-    _impl_.policy_.Set("", GetArenaForAllocation());
+  if (_impl_.wazuh_event_.IsDefault()) {
+    _impl_.wazuh_event_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.policy)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
 }
 
-// string filter = 3;
-inline void Entry::clear_filter() {
-  _impl_.filter_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// EpsUpdate_Request
+
+// uint32 eps = 1;
+inline void EpsUpdate_Request::clear_eps() {
+  _impl_.eps_ = 0u;
 }
-inline const std::string& Entry::filter() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.filter)
-  return _internal_filter();
+inline uint32_t EpsUpdate_Request::_internal_eps() const {
+  return _impl_.eps_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_filter(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.filter)
+inline uint32_t EpsUpdate_Request::eps() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
+  return _internal_eps();
 }
-inline std::string* Entry::mutable_filter() {
-  std::string* _s = _internal_mutable_filter();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.filter)
-  return _s;
+inline void EpsUpdate_Request::_internal_set_eps(uint32_t value) {
+  
+  _impl_.eps_ = value;
 }
-inline const std::string& Entry::_internal_filter() const {
-  return _impl_.filter_.Get();
+inline void EpsUpdate_Request::set_eps(uint32_t value) {
+  _internal_set_eps(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
 }
-inline void Entry::_internal_set_filter(const std::string& value) {
-  
-  _impl_.filter_.Set(value, GetArenaForAllocation());
+
+// uint32 refresh_interval = 2;
+inline void EpsUpdate_Request::clear_refresh_interval() {
+  _impl_.refresh_interval_ = 0u;
 }
-inline std::string* Entry::_internal_mutable_filter() {
-  
-  return _impl_.filter_.Mutable(GetArenaForAllocation());
+inline uint32_t EpsUpdate_Request::_internal_refresh_interval() const {
+  return _impl_.refresh_interval_;
 }
-inline std::string* Entry::release_filter() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.filter)
-  return _impl_.filter_.Release();
+inline uint32_t EpsUpdate_Request::refresh_interval() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
+  return _internal_refresh_interval();
 }
-inline void Entry::set_allocated_filter(std::string* filter) {
-  if (filter != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.filter_.IsDefault()) {
-    _impl_.filter_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.filter)
+inline void EpsUpdate_Request::_internal_set_refresh_interval(uint32_t value) {
+  
+  _impl_.refresh_interval_ = value;
+}
+inline void EpsUpdate_Request::set_refresh_interval(uint32_t value) {
+  _internal_set_refresh_interval(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
 }
 
-// uint32 priority = 4;
-inline void Entry::clear_priority() {
-  _impl_.priority_ = 0u;
+// -------------------------------------------------------------------
+
+// EpsGet_Request
+
+// -------------------------------------------------------------------
+
+// EpsGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void EpsGet_Response::clear_status() {
+  _impl_.status_ = 0;
 }
-inline uint32_t Entry::_internal_priority() const {
-  return _impl_.priority_;
+inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline uint32_t Entry::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.priority)
-  return _internal_priority();
+inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.status)
+  return _internal_status();
 }
-inline void Entry::_internal_set_priority(uint32_t value) {
+inline void EpsGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
-  _impl_.priority_ = value;
+  _impl_.status_ = value;
 }
-inline void Entry::set_priority(uint32_t value) {
-  _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.priority)
+inline void EpsGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.status)
 }
 
-// optional string description = 5;
-inline bool Entry::_internal_has_description() const {
+// optional string error = 2;
+inline bool EpsGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Entry::has_description() const {
-  return _internal_has_description();
+inline bool EpsGet_Response::has_error() const {
+  return _internal_has_error();
 }
-inline void Entry::clear_description() {
-  _impl_.description_.ClearToEmpty();
+inline void EpsGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Entry::description() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.description)
-  return _internal_description();
+inline const std::string& EpsGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_description(ArgT0&& arg0, ArgT... args) {
+void EpsGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.description)
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.error)
 }
-inline std::string* Entry::mutable_description() {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.description)
+inline std::string* EpsGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EpsGet_Response.error)
   return _s;
 }
-inline const std::string& Entry::_internal_description() const {
-  return _impl_.description_.Get();
+inline const std::string& EpsGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void Entry::_internal_set_description(const std::string& value) {
+inline void EpsGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.description_.Set(value, GetArenaForAllocation());
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_description() {
+inline std::string* EpsGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.description_.Mutable(GetArenaForAllocation());
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_description() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.description)
-  if (!_internal_has_description()) {
+inline std::string* EpsGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EpsGet_Response.error)
+  if (!_internal_has_error()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.description_.Release();
+  auto* p = _impl_.error_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Entry::set_allocated_description(std::string* description) {
-  if (description != nullptr) {
+inline void EpsGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.description)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EpsGet_Response.error)
 }
 
-// .com.wazuh.api.engine.router.Sync policy_sync = 6;
-inline void Entry::clear_policy_sync() {
-  _impl_.policy_sync_ = 0;
+// uint32 eps = 3;
+inline void EpsGet_Response::clear_eps() {
+  _impl_.eps_ = 0u;
 }
-inline ::com::wazuh::api::engine::router::Sync Entry::_internal_policy_sync() const {
-  return static_cast< ::com::wazuh::api::engine::router::Sync >(_impl_.policy_sync_);
+inline uint32_t EpsGet_Response::_internal_eps() const {
+  return _impl_.eps_;
 }
-inline ::com::wazuh::api::engine::router::Sync Entry::policy_sync() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy_sync)
-  return _internal_policy_sync();
+inline uint32_t EpsGet_Response::eps() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.eps)
+  return _internal_eps();
 }
-inline void Entry::_internal_set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
+inline void EpsGet_Response::_internal_set_eps(uint32_t value) {
   
-  _impl_.policy_sync_ = value;
+  _impl_.eps_ = value;
 }
-inline void Entry::set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
-  _internal_set_policy_sync(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy_sync)
+inline void EpsGet_Response::set_eps(uint32_t value) {
+  _internal_set_eps(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.eps)
 }
 
-// .com.wazuh.api.engine.router.State entry_status = 7;
-inline void Entry::clear_entry_status() {
-  _impl_.entry_status_ = 0;
+// uint32 refresh_interval = 4;
+inline void EpsGet_Response::clear_refresh_interval() {
+  _impl_.refresh_interval_ = 0u;
 }
-inline ::com::wazuh::api::engine::router::State Entry::_internal_entry_status() const {
-  return static_cast< ::com::wazuh::api::engine::router::State >(_impl_.entry_status_);
+inline uint32_t EpsGet_Response::_internal_refresh_interval() const {
+  return _impl_.refresh_interval_;
 }
-inline ::com::wazuh::api::engine::router::State Entry::entry_status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.entry_status)
-  return _internal_entry_status();
+inline uint32_t EpsGet_Response::refresh_interval() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
+  return _internal_refresh_interval();
 }
-inline void Entry::_internal_set_entry_status(::com::wazuh::api::engine::router::State value) {
+inline void EpsGet_Response::_internal_set_refresh_interval(uint32_t value) {
   
-  _impl_.entry_status_ = value;
+  _impl_.refresh_interval_ = value;
 }
-inline void Entry::set_entry_status(::com::wazuh::api::engine::router::State value) {
-  _internal_set_entry_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.entry_status)
+inline void EpsGet_Response::set_refresh_interval(uint32_t value) {
+  _internal_set_refresh_interval(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
 }
 
-// uint32 uptime = 8;
-inline void Entry::clear_uptime() {
-  _impl_.uptime_ = 0u;
+// bool enabled = 5;
+inline void EpsGet_Response::clear_enabled() {
+  _impl_.enabled_ = false;
 }
-inline uint32_t Entry::_internal_uptime() const {
-  return _impl_.uptime_;
+inline bool EpsGet_Response::_internal_enabled() const {
+  return _impl_.enabled_;
 }
-inline uint32_t Entry::uptime() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.uptime)
-  return _internal_uptime();
+inline bool EpsGet_Response::enabled() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.enabled)
+  return _internal_enabled();
 }
-inline void Entry::_internal_set_uptime(uint32_t value) {
+inline void EpsGet_Response::_internal_set_enabled(bool value) {
   
-  _impl_.uptime_ = value;
+  _impl_.enabled_ = value;
 }
-inline void Entry::set_uptime(uint32_t value) {
-  _internal_set_uptime(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.uptime)
+inline void EpsGet_Response::set_enabled(bool value) {
+  _internal_set_enabled(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.enabled)
 }
 
 // -------------------------------------------------------------------
 
-// RoutePost_Request
+// EpsEnable_Request
 
-// optional .com.wazuh.api.engine.router.EntryPost route = 1;
-inline bool RoutePost_Request::_internal_has_route() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
-  return value;
-}
-inline bool RoutePost_Request::has_route() const {
-  return _internal_has_route();
+// -------------------------------------------------------------------
+
+// EpsDisable_Request
+
+// -------------------------------------------------------------------
+
+// ProfilerEnable_Request
+
+// uint32 sample_rate = 1;
+inline void ProfilerEnable_Request::clear_sample_rate() {
+  _impl_.sample_rate_ = 0u;
 }
-inline void RoutePost_Request::clear_route() {
-  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+inline uint32_t ProfilerEnable_Request::_internal_sample_rate() const {
+  return _impl_.sample_rate_;
 }
-inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::_internal_route() const {
-  const ::com::wazuh::api::engine::router::EntryPost* p = _impl_.route_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::EntryPost&>(
-      ::com::wazuh::api::engine::router::_EntryPost_default_instance_);
+inline uint32_t ProfilerEnable_Request::sample_rate() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerEnable_Request.sample_rate)
+  return _internal_sample_rate();
 }
-inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::route() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePost_Request.route)
-  return _internal_route();
+inline void ProfilerEnable_Request::_internal_set_sample_rate(uint32_t value) {
+  
+  _impl_.sample_rate_ = value;
 }
-inline void RoutePost_Request::unsafe_arena_set_allocated_route(
-    ::com::wazuh::api::engine::router::EntryPost* route) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
-  }
-  _impl_.route_ = route;
-  if (route) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+inline void ProfilerEnable_Request::set_sample_rate(uint32_t value) {
+  _internal_set_sample_rate(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerEnable_Request.sample_rate)
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::release_route() {
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+
+// -------------------------------------------------------------------
+
+// ProfilerDisable_Request
+
+// -------------------------------------------------------------------
+
+// ProfilerGet_Request
+
+// uint32 top = 1;
+inline void ProfilerGet_Request::clear_top() {
+  _impl_.top_ = 0u;
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::unsafe_arena_release_route() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePost_Request.route)
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-  return temp;
+inline uint32_t ProfilerGet_Request::_internal_top() const {
+  return _impl_.top_;
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::_internal_mutable_route() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  if (_impl_.route_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::EntryPost>(GetArenaForAllocation());
-    _impl_.route_ = p;
-  }
-  return _impl_.route_;
+inline uint32_t ProfilerGet_Request::top() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerGet_Request.top)
+  return _internal_top();
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::mutable_route() {
-  ::com::wazuh::api::engine::router::EntryPost* _msg = _internal_mutable_route();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePost_Request.route)
-  return _msg;
+inline void ProfilerGet_Request::_internal_set_top(uint32_t value) {
+  
+  _impl_.top_ = value;
 }
-inline void RoutePost_Request::set_allocated_route(::com::wazuh::api::engine::router::EntryPost* route) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.route_;
-  }
-  if (route) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
-    if (message_arena != submessage_arena) {
-      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, route, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.route_ = route;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+inline void ProfilerGet_Request::set_top(uint32_t value) {
+  _internal_set_top(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerGet_Request.top)
 }
 
 // -------------------------------------------------------------------
 
-// RouteDelete_Request
+// ProfilerStats
 
 // string name = 1;
-inline void RouteDelete_Request::clear_name() {
+inline void ProfilerStats::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& RouteDelete_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteDelete_Request.name)
+inline const std::string& ProfilerStats::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerStats.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RouteDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void ProfilerStats::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerStats.name)
 }
-inline std::string* RouteDelete_Request::mutable_name() {
+inline std::string* ProfilerStats::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfilerStats.name)
   return _s;
 }
-inline const std::string& RouteDelete_Request::_internal_name() const {
+inline const std::string& ProfilerStats::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void RouteDelete_Request::_internal_set_name(const std::string& value) {
+inline void ProfilerStats::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RouteDelete_Request::_internal_mutable_name() {
+inline std::string* ProfilerStats::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RouteDelete_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteDelete_Request.name)
+inline std::string* ProfilerStats::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.ProfilerStats.name)
   return _impl_.name_.Release();
 }
-inline void RouteDelete_Request::set_allocated_name(std::string* name) {
+inline void ProfilerStats::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -3490,128 +5992,154 @@ inline void RouteDelete_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.ProfilerStats.name)
 }
 
-// -------------------------------------------------------------------
-
-// RouteGet_Request
-
-// string name = 1;
-inline void RouteGet_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// uint64 calls = 2;
+inline void ProfilerStats::clear_calls() {
+  _impl_.calls_ = uint64_t{0u};
 }
-inline const std::string& RouteGet_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Request.name)
-  return _internal_name();
+inline uint64_t ProfilerStats::_internal_calls() const {
+  return _impl_.calls_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RouteGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Request.name)
+inline uint64_t ProfilerStats::calls() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerStats.calls)
+  return _internal_calls();
 }
-inline std::string* RouteGet_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Request.name)
-  return _s;
+inline void ProfilerStats::_internal_set_calls(uint64_t value) {
+  
+  _impl_.calls_ = value;
 }
-inline const std::string& RouteGet_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline void ProfilerStats::set_calls(uint64_t value) {
+  _internal_set_calls(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerStats.calls)
 }
-inline void RouteGet_Request::_internal_set_name(const std::string& value) {
+
+// uint64 matches = 3;
+inline void ProfilerStats::clear_matches() {
+  _impl_.matches_ = uint64_t{0u};
+}
+inline uint64_t ProfilerStats::_internal_matches() const {
+  return _impl_.matches_;
+}
+inline uint64_t ProfilerStats::matches() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerStats.matches)
+  return _internal_matches();
+}
+inline void ProfilerStats::_internal_set_matches(uint64_t value) {
   
-  _impl_.name_.Set(value, GetArenaForAllocation());
+  _impl_.matches_ = value;
 }
-inline std::string* RouteGet_Request::_internal_mutable_name() {
+inline void ProfilerStats::set_matches(uint64_t value) {
+  _internal_set_matches(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerStats.matches)
+}
+
+// double match_rate = 4;
+inline void ProfilerStats::clear_match_rate() {
+  _impl_.match_rate_ = 0;
+}
+inline double ProfilerStats::_internal_match_rate() const {
+  return _impl_.match_rate_;
+}
+inline double ProfilerStats::match_rate() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerStats.match_rate)
+  return _internal_match_rate();
+}
+inline void ProfilerStats::_internal_set_match_rate(double value) {
   
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  _impl_.match_rate_ = value;
 }
-inline std::string* RouteGet_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Request.name)
-  return _impl_.name_.Release();
+inline void ProfilerStats::set_match_rate(double value) {
+  _internal_set_match_rate(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerStats.match_rate)
 }
-inline void RouteGet_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Request.name)
+
+// uint64 total_ns = 5;
+inline void ProfilerStats::clear_total_ns() {
+  _impl_.total_ns_ = uint64_t{0u};
+}
+inline uint64_t ProfilerStats::_internal_total_ns() const {
+  return _impl_.total_ns_;
+}
+inline uint64_t ProfilerStats::total_ns() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerStats.total_ns)
+  return _internal_total_ns();
+}
+inline void ProfilerStats::_internal_set_total_ns(uint64_t value) {
+  
+  _impl_.total_ns_ = value;
+}
+inline void ProfilerStats::set_total_ns(uint64_t value) {
+  _internal_set_total_ns(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerStats.total_ns)
 }
 
 // -------------------------------------------------------------------
 
-// RouteGet_Response
+// ProfilerGet_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void RouteGet_Response::clear_status() {
+inline void ProfilerGet_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus ProfilerGet_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus ProfilerGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerGet_Response.status)
   return _internal_status();
 }
-inline void RouteGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ProfilerGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void RouteGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ProfilerGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerGet_Response.status)
 }
 
 // optional string error = 2;
-inline bool RouteGet_Response::_internal_has_error() const {
+inline bool ProfilerGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool RouteGet_Response::has_error() const {
+inline bool ProfilerGet_Response::has_error() const {
   return _internal_has_error();
 }
-inline void RouteGet_Response::clear_error() {
+inline void ProfilerGet_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& RouteGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.error)
+inline const std::string& ProfilerGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerGet_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RouteGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void ProfilerGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerGet_Response.error)
 }
-inline std::string* RouteGet_Response::mutable_error() {
+inline std::string* ProfilerGet_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfilerGet_Response.error)
   return _s;
 }
-inline const std::string& RouteGet_Response::_internal_error() const {
+inline const std::string& ProfilerGet_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void RouteGet_Response::_internal_set_error(const std::string& value) {
+inline void ProfilerGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RouteGet_Response::_internal_mutable_error() {
+inline std::string* ProfilerGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RouteGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.error)
+inline std::string* ProfilerGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.ProfilerGet_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -3624,7 +6152,7 @@ inline std::string* RouteGet_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void RouteGet_Response::set_allocated_error(std::string* error) {
+inline void ProfilerGet_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3636,530 +6164,382 @@ inline void RouteGet_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.ProfilerGet_Response.error)
 }
 
-// optional .com.wazuh.api.engine.router.Entry route = 3;
-inline bool RouteGet_Response::_internal_has_route() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
-  return value;
-}
-inline bool RouteGet_Response::has_route() const {
-  return _internal_has_route();
+// bool enabled = 3;
+inline void ProfilerGet_Response::clear_enabled() {
+  _impl_.enabled_ = false;
 }
-inline void RouteGet_Response::clear_route() {
-  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+inline bool ProfilerGet_Response::_internal_enabled() const {
+  return _impl_.enabled_;
 }
-inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::_internal_route() const {
-  const ::com::wazuh::api::engine::router::Entry* p = _impl_.route_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::Entry&>(
-      ::com::wazuh::api::engine::router::_Entry_default_instance_);
+inline bool ProfilerGet_Response::enabled() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerGet_Response.enabled)
+  return _internal_enabled();
 }
-inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::route() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.route)
-  return _internal_route();
+inline void ProfilerGet_Response::_internal_set_enabled(bool value) {
+  
+  _impl_.enabled_ = value;
 }
-inline void RouteGet_Response::unsafe_arena_set_allocated_route(
-    ::com::wazuh::api::engine::router::Entry* route) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
-  }
-  _impl_.route_ = route;
-  if (route) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+inline void ProfilerGet_Response::set_enabled(bool value) {
+  _internal_set_enabled(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerGet_Response.enabled)
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::release_route() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+
+// uint32 sample_rate = 4;
+inline void ProfilerGet_Response::clear_sample_rate() {
+  _impl_.sample_rate_ = 0u;
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::unsafe_arena_release_route() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.route)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-  return temp;
+inline uint32_t ProfilerGet_Response::_internal_sample_rate() const {
+  return _impl_.sample_rate_;
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::_internal_mutable_route() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.route_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::Entry>(GetArenaForAllocation());
-    _impl_.route_ = p;
-  }
-  return _impl_.route_;
+inline uint32_t ProfilerGet_Response::sample_rate() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerGet_Response.sample_rate)
+  return _internal_sample_rate();
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::mutable_route() {
-  ::com::wazuh::api::engine::router::Entry* _msg = _internal_mutable_route();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.route)
-  return _msg;
+inline void ProfilerGet_Response::_internal_set_sample_rate(uint32_t value) {
+  
+  _impl_.sample_rate_ = value;
 }
-inline void RouteGet_Response::set_allocated_route(::com::wazuh::api::engine::router::Entry* route) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.route_;
-  }
-  if (route) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
-    if (message_arena != submessage_arena) {
-      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, route, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.route_ = route;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+inline void ProfilerGet_Response::set_sample_rate(uint32_t value) {
+  _internal_set_sample_rate(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfilerGet_Response.sample_rate)
 }
 
-// -------------------------------------------------------------------
-
-// RouteReload_Request
-
-// string name = 1;
-inline void RouteReload_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
-}
-inline const std::string& RouteReload_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteReload_Request.name)
-  return _internal_name();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RouteReload_Request::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteReload_Request.name)
-}
-inline std::string* RouteReload_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteReload_Request.name)
-  return _s;
+// repeated .com.wazuh.api.engine.router.ProfilerStats assets = 5;
+inline int ProfilerGet_Response::_internal_assets_size() const {
+  return _impl_.assets_.size();
 }
-inline const std::string& RouteReload_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline int ProfilerGet_Response::assets_size() const {
+  return _internal_assets_size();
 }
-inline void RouteReload_Request::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+inline void ProfilerGet_Response::clear_assets() {
+  _impl_.assets_.Clear();
 }
-inline std::string* RouteReload_Request::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline ::com::wazuh::api::engine::router::ProfilerStats* ProfilerGet_Response::mutable_assets(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfilerGet_Response.assets)
+  return _impl_.assets_.Mutable(index);
 }
-inline std::string* RouteReload_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteReload_Request.name)
-  return _impl_.name_.Release();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats >*
+ProfilerGet_Response::mutable_assets() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.ProfilerGet_Response.assets)
+  return &_impl_.assets_;
 }
-inline void RouteReload_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteReload_Request.name)
+inline const ::com::wazuh::api::engine::router::ProfilerStats& ProfilerGet_Response::_internal_assets(int index) const {
+  return _impl_.assets_.Get(index);
 }
-
-// -------------------------------------------------------------------
-
-// RoutePatchPriority_Request
-
-// string name = 1;
-inline void RoutePatchPriority_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+inline const ::com::wazuh::api::engine::router::ProfilerStats& ProfilerGet_Response::assets(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerGet_Response.assets)
+  return _internal_assets(index);
 }
-inline const std::string& RoutePatchPriority_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
-  return _internal_name();
+inline ::com::wazuh::api::engine::router::ProfilerStats* ProfilerGet_Response::_internal_add_assets() {
+  return _impl_.assets_.Add();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RoutePatchPriority_Request::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+inline ::com::wazuh::api::engine::router::ProfilerStats* ProfilerGet_Response::add_assets() {
+  ::com::wazuh::api::engine::router::ProfilerStats* _add = _internal_add_assets();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.ProfilerGet_Response.assets)
+  return _add;
 }
-inline std::string* RoutePatchPriority_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
-  return _s;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats >&
+ProfilerGet_Response::assets() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.ProfilerGet_Response.assets)
+  return _impl_.assets_;
 }
-inline const std::string& RoutePatchPriority_Request::_internal_name() const {
-  return _impl_.name_.Get();
+
+// repeated .com.wazuh.api.engine.router.ProfilerStats helpers = 6;
+inline int ProfilerGet_Response::_internal_helpers_size() const {
+  return _impl_.helpers_.size();
 }
-inline void RoutePatchPriority_Request::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+inline int ProfilerGet_Response::helpers_size() const {
+  return _internal_helpers_size();
 }
-inline std::string* RoutePatchPriority_Request::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline void ProfilerGet_Response::clear_helpers() {
+  _impl_.helpers_.Clear();
 }
-inline std::string* RoutePatchPriority_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
-  return _impl_.name_.Release();
+inline ::com::wazuh::api::engine::router::ProfilerStats* ProfilerGet_Response::mutable_helpers(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfilerGet_Response.helpers)
+  return _impl_.helpers_.Mutable(index);
 }
-inline void RoutePatchPriority_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats >*
+ProfilerGet_Response::mutable_helpers() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.ProfilerGet_Response.helpers)
+  return &_impl_.helpers_;
 }
-
-// uint32 priority = 2;
-inline void RoutePatchPriority_Request::clear_priority() {
-  _impl_.priority_ = 0u;
+inline const ::com::wazuh::api::engine::router::ProfilerStats& ProfilerGet_Response::_internal_helpers(int index) const {
+  return _impl_.helpers_.Get(index);
 }
-inline uint32_t RoutePatchPriority_Request::_internal_priority() const {
-  return _impl_.priority_;
+inline const ::com::wazuh::api::engine::router::ProfilerStats& ProfilerGet_Response::helpers(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfilerGet_Response.helpers)
+  return _internal_helpers(index);
 }
-inline uint32_t RoutePatchPriority_Request::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
-  return _internal_priority();
+inline ::com::wazuh::api::engine::router::ProfilerStats* ProfilerGet_Response::_internal_add_helpers() {
+  return _impl_.helpers_.Add();
 }
-inline void RoutePatchPriority_Request::_internal_set_priority(uint32_t value) {
-  
-  _impl_.priority_ = value;
+inline ::com::wazuh::api::engine::router::ProfilerStats* ProfilerGet_Response::add_helpers() {
+  ::com::wazuh::api::engine::router::ProfilerStats* _add = _internal_add_helpers();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.ProfilerGet_Response.helpers)
+  return _add;
 }
-inline void RoutePatchPriority_Request::set_priority(uint32_t value) {
-  _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfilerStats >&
+ProfilerGet_Response::helpers() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.ProfilerGet_Response.helpers)
+  return _impl_.helpers_;
 }
 
 // -------------------------------------------------------------------
 
-// TableGet_Request
-
-// -------------------------------------------------------------------
-
-// TableGet_Response
+// TapEnable_Request
 
-// .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void TableGet_Response::clear_status() {
-  _impl_.status_ = 0;
+// double sample_rate = 1;
+inline void TapEnable_Request::clear_sample_rate() {
+  _impl_.sample_rate_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::_internal_status() const {
-  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+inline double TapEnable_Request::_internal_sample_rate() const {
+  return _impl_.sample_rate_;
 }
-inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.status)
-  return _internal_status();
+inline double TapEnable_Request::sample_rate() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapEnable_Request.sample_rate)
+  return _internal_sample_rate();
 }
-inline void TableGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void TapEnable_Request::_internal_set_sample_rate(double value) {
   
-  _impl_.status_ = value;
+  _impl_.sample_rate_ = value;
 }
-inline void TableGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.status)
+inline void TapEnable_Request::set_sample_rate(double value) {
+  _internal_set_sample_rate(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapEnable_Request.sample_rate)
 }
 
-// optional string error = 2;
-inline bool TableGet_Response::_internal_has_error() const {
+// optional string field = 2;
+inline bool TapEnable_Request::_internal_has_field() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool TableGet_Response::has_error() const {
-  return _internal_has_error();
+inline bool TapEnable_Request::has_field() const {
+  return _internal_has_field();
 }
-inline void TableGet_Response::clear_error() {
-  _impl_.error_.ClearToEmpty();
+inline void TapEnable_Request::clear_field() {
+  _impl_.field_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& TableGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.error)
-  return _internal_error();
+inline const std::string& TapEnable_Request::field() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapEnable_Request.field)
+  return _internal_field();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void TableGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void TapEnable_Request::set_field(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.error)
+ _impl_.field_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapEnable_Request.field)
 }
-inline std::string* TableGet_Response::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.error)
+inline std::string* TapEnable_Request::mutable_field() {
+  std::string* _s = _internal_mutable_field();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TapEnable_Request.field)
   return _s;
 }
-inline const std::string& TableGet_Response::_internal_error() const {
-  return _impl_.error_.Get();
+inline const std::string& TapEnable_Request::_internal_field() const {
+  return _impl_.field_.Get();
 }
-inline void TableGet_Response::_internal_set_error(const std::string& value) {
+inline void TapEnable_Request::_internal_set_field(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.error_.Set(value, GetArenaForAllocation());
+  _impl_.field_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TableGet_Response::_internal_mutable_error() {
+inline std::string* TapEnable_Request::_internal_mutable_field() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+  return _impl_.field_.Mutable(GetArenaForAllocation());
 }
-inline std::string* TableGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TableGet_Response.error)
-  if (!_internal_has_error()) {
+inline std::string* TapEnable_Request::release_field() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TapEnable_Request.field)
+  if (!_internal_has_field()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.error_.Release();
+  auto* p = _impl_.field_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.field_.IsDefault()) {
+    _impl_.field_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void TableGet_Response::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
+inline void TapEnable_Request::set_allocated_field(std::string* field) {
+  if (field != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+  _impl_.field_.SetAllocated(field, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.field_.IsDefault()) {
+    _impl_.field_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TableGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TapEnable_Request.field)
 }
 
-// repeated .com.wazuh.api.engine.router.Entry table = 3;
-inline int TableGet_Response::_internal_table_size() const {
-  return _impl_.table_.size();
-}
-inline int TableGet_Response::table_size() const {
-  return _internal_table_size();
-}
-inline void TableGet_Response::clear_table() {
-  _impl_.table_.Clear();
-}
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::mutable_table(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _impl_.table_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >*
-TableGet_Response::mutable_table() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.TableGet_Response.table)
-  return &_impl_.table_;
-}
-inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::_internal_table(int index) const {
-  return _impl_.table_.Get(index);
-}
-inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::table(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _internal_table(index);
-}
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::_internal_add_table() {
-  return _impl_.table_.Add();
-}
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::add_table() {
-  ::com::wazuh::api::engine::router::Entry* _add = _internal_add_table();
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _add;
+// optional string value = 3;
+inline bool TapEnable_Request::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >&
-TableGet_Response::table() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _impl_.table_;
+inline bool TapEnable_Request::has_value() const {
+  return _internal_has_value();
 }
-
-// -------------------------------------------------------------------
-
-// QueuePost_Request
-
-// string wazuh_event = 1;
-inline void QueuePost_Request::clear_wazuh_event() {
-  _impl_.wazuh_event_.ClearToEmpty();
+inline void TapEnable_Request::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& QueuePost_Request::wazuh_event() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-  return _internal_wazuh_event();
+inline const std::string& TapEnable_Request::value() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapEnable_Request.value)
+  return _internal_value();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void QueuePost_Request::set_wazuh_event(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.wazuh_event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-}
-inline std::string* QueuePost_Request::mutable_wazuh_event() {
-  std::string* _s = _internal_mutable_wazuh_event();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+void TapEnable_Request::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapEnable_Request.value)
+}
+inline std::string* TapEnable_Request::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TapEnable_Request.value)
   return _s;
 }
-inline const std::string& QueuePost_Request::_internal_wazuh_event() const {
-  return _impl_.wazuh_event_.Get();
+inline const std::string& TapEnable_Request::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void QueuePost_Request::_internal_set_wazuh_event(const std::string& value) {
-  
-  _impl_.wazuh_event_.Set(value, GetArenaForAllocation());
+inline void TapEnable_Request::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline std::string* QueuePost_Request::_internal_mutable_wazuh_event() {
-  
-  return _impl_.wazuh_event_.Mutable(GetArenaForAllocation());
+inline std::string* TapEnable_Request::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline std::string* QueuePost_Request::release_wazuh_event() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-  return _impl_.wazuh_event_.Release();
+inline std::string* TapEnable_Request::release_value() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TapEnable_Request.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void QueuePost_Request::set_allocated_wazuh_event(std::string* wazuh_event) {
-  if (wazuh_event != nullptr) {
-    
+inline void TapEnable_Request::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.wazuh_event_.SetAllocated(wazuh_event, GetArenaForAllocation());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.wazuh_event_.IsDefault()) {
-    _impl_.wazuh_event_.Set("", GetArenaForAllocation());
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TapEnable_Request.value)
 }
 
 // -------------------------------------------------------------------
 
-// EpsUpdate_Request
+// TapDisable_Request
 
-// uint32 eps = 1;
-inline void EpsUpdate_Request::clear_eps() {
-  _impl_.eps_ = 0u;
-}
-inline uint32_t EpsUpdate_Request::_internal_eps() const {
-  return _impl_.eps_;
-}
-inline uint32_t EpsUpdate_Request::eps() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
-  return _internal_eps();
-}
-inline void EpsUpdate_Request::_internal_set_eps(uint32_t value) {
-  
-  _impl_.eps_ = value;
-}
-inline void EpsUpdate_Request::set_eps(uint32_t value) {
-  _internal_set_eps(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
-}
+// -------------------------------------------------------------------
 
-// uint32 refresh_interval = 2;
-inline void EpsUpdate_Request::clear_refresh_interval() {
-  _impl_.refresh_interval_ = 0u;
+// TapGet_Request
+
+// uint32 max = 1;
+inline void TapGet_Request::clear_max() {
+  _impl_.max_ = 0u;
 }
-inline uint32_t EpsUpdate_Request::_internal_refresh_interval() const {
-  return _impl_.refresh_interval_;
+inline uint32_t TapGet_Request::_internal_max() const {
+  return _impl_.max_;
 }
-inline uint32_t EpsUpdate_Request::refresh_interval() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
-  return _internal_refresh_interval();
+inline uint32_t TapGet_Request::max() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapGet_Request.max)
+  return _internal_max();
 }
-inline void EpsUpdate_Request::_internal_set_refresh_interval(uint32_t value) {
+inline void TapGet_Request::_internal_set_max(uint32_t value) {
   
-  _impl_.refresh_interval_ = value;
+  _impl_.max_ = value;
 }
-inline void EpsUpdate_Request::set_refresh_interval(uint32_t value) {
-  _internal_set_refresh_interval(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
+inline void TapGet_Request::set_max(uint32_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Request.max)
 }
 
 // -------------------------------------------------------------------
 
-// EpsGet_Request
-
-// -------------------------------------------------------------------
-
-// EpsGet_Response
+// TapGet_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void EpsGet_Response::clear_status() {
+inline void TapGet_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus TapGet_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus TapGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapGet_Response.status)
   return _internal_status();
 }
-inline void EpsGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void TapGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void EpsGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void TapGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Response.status)
 }
 
 // optional string error = 2;
-inline bool EpsGet_Response::_internal_has_error() const {
+inline bool TapGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool EpsGet_Response::has_error() const {
+inline bool TapGet_Response::has_error() const {
   return _internal_has_error();
 }
-inline void EpsGet_Response::clear_error() {
+inline void TapGet_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& EpsGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.error)
+inline const std::string& TapGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapGet_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EpsGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void TapGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Response.error)
 }
-inline std::string* EpsGet_Response::mutable_error() {
+inline std::string* TapGet_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TapGet_Response.error)
   return _s;
 }
-inline const std::string& EpsGet_Response::_internal_error() const {
+inline const std::string& TapGet_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void EpsGet_Response::_internal_set_error(const std::string& value) {
+inline void TapGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EpsGet_Response::_internal_mutable_error() {
+inline std::string* TapGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EpsGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EpsGet_Response.error)
+inline std::string* TapGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TapGet_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -4172,7 +6552,7 @@ inline std::string* EpsGet_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void EpsGet_Response::set_allocated_error(std::string* error) {
+inline void TapGet_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -4184,80 +6564,185 @@ inline void EpsGet_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TapGet_Response.error)
 }
 
-// uint32 eps = 3;
-inline void EpsGet_Response::clear_eps() {
-  _impl_.eps_ = 0u;
+// bool enabled = 3;
+inline void TapGet_Response::clear_enabled() {
+  _impl_.enabled_ = false;
 }
-inline uint32_t EpsGet_Response::_internal_eps() const {
-  return _impl_.eps_;
+inline bool TapGet_Response::_internal_enabled() const {
+  return _impl_.enabled_;
 }
-inline uint32_t EpsGet_Response::eps() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.eps)
-  return _internal_eps();
+inline bool TapGet_Response::enabled() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapGet_Response.enabled)
+  return _internal_enabled();
 }
-inline void EpsGet_Response::_internal_set_eps(uint32_t value) {
+inline void TapGet_Response::_internal_set_enabled(bool value) {
   
-  _impl_.eps_ = value;
+  _impl_.enabled_ = value;
 }
-inline void EpsGet_Response::set_eps(uint32_t value) {
-  _internal_set_eps(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.eps)
+inline void TapGet_Response::set_enabled(bool value) {
+  _internal_set_enabled(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Response.enabled)
 }
 
-// uint32 refresh_interval = 4;
-inline void EpsGet_Response::clear_refresh_interval() {
-  _impl_.refresh_interval_ = 0u;
+// double sample_rate = 4;
+inline void TapGet_Response::clear_sample_rate() {
+  _impl_.sample_rate_ = 0;
 }
-inline uint32_t EpsGet_Response::_internal_refresh_interval() const {
-  return _impl_.refresh_interval_;
+inline double TapGet_Response::_internal_sample_rate() const {
+  return _impl_.sample_rate_;
 }
-inline uint32_t EpsGet_Response::refresh_interval() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
-  return _internal_refresh_interval();
+inline double TapGet_Response::sample_rate() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapGet_Response.sample_rate)
+  return _internal_sample_rate();
 }
-inline void EpsGet_Response::_internal_set_refresh_interval(uint32_t value) {
+inline void TapGet_Response::_internal_set_sample_rate(double value) {
   
-  _impl_.refresh_interval_ = value;
+  _impl_.sample_rate_ = value;
 }
-inline void EpsGet_Response::set_refresh_interval(uint32_t value) {
-  _internal_set_refresh_interval(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
+inline void TapGet_Response::set_sample_rate(double value) {
+  _internal_set_sample_rate(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Response.sample_rate)
 }
 
-// bool enabled = 5;
-inline void EpsGet_Response::clear_enabled() {
-  _impl_.enabled_ = false;
+// repeated string events = 5;
+inline int TapGet_Response::_internal_events_size() const {
+  return _impl_.events_.size();
 }
-inline bool EpsGet_Response::_internal_enabled() const {
-  return _impl_.enabled_;
+inline int TapGet_Response::events_size() const {
+  return _internal_events_size();
 }
-inline bool EpsGet_Response::enabled() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.enabled)
-  return _internal_enabled();
+inline void TapGet_Response::clear_events() {
+  _impl_.events_.Clear();
 }
-inline void EpsGet_Response::_internal_set_enabled(bool value) {
+inline std::string* TapGet_Response::add_events() {
+  std::string* _s = _internal_add_events();
+  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.router.TapGet_Response.events)
+  return _s;
+}
+inline const std::string& TapGet_Response::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const std::string& TapGet_Response::events(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapGet_Response.events)
+  return _internal_events(index);
+}
+inline std::string* TapGet_Response::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TapGet_Response.events)
+  return _impl_.events_.Mutable(index);
+}
+inline void TapGet_Response::set_events(int index, const std::string& value) {
+  _impl_.events_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Response.events)
+}
+inline void TapGet_Response::set_events(int index, std::string&& value) {
+  _impl_.events_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Response.events)
+}
+inline void TapGet_Response::set_events(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.events_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.router.TapGet_Response.events)
+}
+inline void TapGet_Response::set_events(int index, const char* value, size_t size) {
+  _impl_.events_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.router.TapGet_Response.events)
+}
+inline std::string* TapGet_Response::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline void TapGet_Response::add_events(const std::string& value) {
+  _impl_.events_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.TapGet_Response.events)
+}
+inline void TapGet_Response::add_events(std::string&& value) {
+  _impl_.events_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.TapGet_Response.events)
+}
+inline void TapGet_Response::add_events(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.events_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.router.TapGet_Response.events)
+}
+inline void TapGet_Response::add_events(const char* value, size_t size) {
+  _impl_.events_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.router.TapGet_Response.events)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TapGet_Response::events() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.TapGet_Response.events)
+  return _impl_.events_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TapGet_Response::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.TapGet_Response.events)
+  return &_impl_.events_;
+}
+
+// uint64 sampled = 6;
+inline void TapGet_Response::clear_sampled() {
+  _impl_.sampled_ = uint64_t{0u};
+}
+inline uint64_t TapGet_Response::_internal_sampled() const {
+  return _impl_.sampled_;
+}
+inline uint64_t TapGet_Response::sampled() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapGet_Response.sampled)
+  return _internal_sampled();
+}
+inline void TapGet_Response::_internal_set_sampled(uint64_t value) {
   
-  _impl_.enabled_ = value;
+  _impl_.sampled_ = value;
 }
-inline void EpsGet_Response::set_enabled(bool value) {
-  _internal_set_enabled(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.enabled)
+inline void TapGet_Response::set_sampled(uint64_t value) {
+  _internal_set_sampled(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Response.sampled)
+}
+
+// uint64 dropped = 7;
+inline void TapGet_Response::clear_dropped() {
+  _impl_.dropped_ = uint64_t{0u};
+}
+inline uint64_t TapGet_Response::_internal_dropped() const {
+  return _impl_.dropped_;
+}
+inline uint64_t TapGet_Response::dropped() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TapGet_Response.dropped)
+  return _internal_dropped();
+}
+inline void TapGet_Response::_internal_set_dropped(uint64_t value) {
+  
+  _impl_.dropped_ = value;
+}
+inline void TapGet_Response::set_dropped(uint64_t value) {
+  _internal_set_dropped(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TapGet_Response.dropped)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
-// EpsEnable_Request
+// -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
 
-// EpsDisable_Request
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
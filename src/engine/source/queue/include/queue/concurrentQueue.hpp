@@ -5,14 +5,18 @@
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <concurrentqueue/blockingconcurrentqueue.h>
 #include <queue/iqueue.hpp>
+#include <queue/spillLog.hpp>
 
 #include <base/logging.hpp>
 #include <metrics/iMetricsManager.hpp>
@@ -111,6 +115,8 @@ public:
  * It also provides a way to flood the queue when it is full.
  * The queue will be flooded when the push method is called and the queue is full
  * and the pathFloodedFile is provided.
+ * Alternatively, the queue can overflow to a SpillLog: the events that do not fit are appended to the log and
+ * moved back to the queue by the consumers once it has room, so they are not lost.
  * @tparam T The type of the data to be stored in the queue.
  */
 template<typename T, typename D = moodycamel::ConcurrentQueueDefaultTraits>
@@ -126,6 +132,8 @@ private:
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_queued;   ///< Counter for the queued events
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_flooded;  ///< Counter for the flooded events
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_consumed; ///< Counter for the consumed events
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_spilled;  ///< Counter for the spilled events
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_replayed; ///< Counter for the spilled events replayed
 
         std::shared_ptr<metricsManager::IMetricsScope> m_metricsScopeDelta;       ///< Metrics scope for the queue
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_consumendPerSecond; ///< Counter for the used queue
@@ -141,6 +149,81 @@ private:
 
     Metrics m_metrics; ///< Metrics for the queue
 
+    using Decoder = std::function<T(std::string_view)>;
+    std::shared_ptr<SpillLog> m_spillLog; ///< Overflow of the queue, nullptr if the queue does not spill
+    Decoder m_decoder;                    ///< Rebuilds the spilled elements from their str()
+    std::size_t m_capacity {0};           ///< Capacity of the queue, the spilled events are moved back below it
+
+    template<typename U = T>
+    std::enable_if_t<has_str_method_v<U>, void> pushWithSpill(U&& element)
+    {
+        // Keep the order: while there are spilled events the new ones go after them
+        if (m_spillLog->empty() && m_queue.try_enqueue(std::move(element)))
+        {
+            m_metrics.m_queued->addValue(1UL);
+            m_metrics.m_used->addValue(1);
+            return;
+        }
+
+        if (element != nullptr && m_spillLog->append(element->str()))
+        {
+            m_metrics.m_spilled->addValue(1UL);
+            return;
+        }
+
+        // The spill log is full
+        m_metrics.m_flooded->addValue(1UL);
+    }
+
+    /**
+     * @brief Move up to max spilled events back to the queue, while it has room
+     */
+    void replaySpilled(std::size_t max)
+    {
+        if (!m_spillLog || m_spillLog->empty())
+        {
+            return;
+        }
+
+        std::size_t replayed {0};
+        const auto consume = [this, &replayed](std::string_view record)
+        {
+            T element;
+            try
+            {
+                element = m_decoder(record);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Discarding a spilled event that cannot be decoded: {}", e.what());
+                m_metrics.m_flooded->addValue(1UL);
+                return true;
+            }
+
+            // Lost the room to a producer, the event stays at the head of the log
+            if (!m_queue.try_enqueue(std::move(element)))
+            {
+                return false;
+            }
+            ++replayed;
+            return true;
+        };
+
+        for (std::size_t popped {0}; popped < max && m_queue.size_approx() < m_capacity; ++popped)
+        {
+            if (!m_spillLog->popIf(consume))
+            {
+                break;
+            }
+        }
+
+        if (replayed > 0)
+        {
+            m_metrics.m_replayed->addValue(replayed);
+            m_metrics.m_used->addValue(static_cast<int64_t>(replayed));
+        }
+    }
+
     template<typename U = T>
     std::enable_if_t<has_str_method_v<U>, void> pushWithStr(U&& element)
     {
@@ -268,15 +351,101 @@ public:
         m_metrics.m_used = m_metrics.m_metricsScope->getUpDownCounterInteger("UsedQueue");
         m_metrics.m_consumed = m_metrics.m_metricsScope->getCounterUInteger("ConsumedEvents");
         m_metrics.m_flooded = m_metrics.m_metricsScope->getCounterUInteger("FloodedEvents");
+        m_metrics.m_spilled = m_metrics.m_metricsScope->getCounterUInteger("SpilledEvents");
+        m_metrics.m_replayed = m_metrics.m_metricsScope->getCounterUInteger("ReplayedEvents");
 
         m_metrics.m_metricsScopeDelta = std::move(metricsScopeDelta);
         m_metrics.m_consumendPerSecond = m_metrics.m_metricsScopeDelta->getCounterUInteger("ConsumedEventsPerSecond");
     }
 
+    /**
+     * @brief Construct a new Concurrent Queue object that floods to a file shared with other queues
+     *
+     * @param capacity The capacity of the queue. (Approximate)
+     * @param metricsScope The metrics scope for the queue.
+     * @param metricsScopeDelta The metrics scope for the per second metrics of the queue.
+     * @param floodingFile The flooding file, its writes are serialized between all the queues.
+     * @param maxAttempts The maximum number of attempts to push an element to the queue.
+     * @param waitTime The time to wait for the queue to be not full.
+     * @param discard Discard the events that do not fit instead of writing them to the flooding file.
+     *
+     * @throw std::runtime_error if the capacity, maxAttempts or waitTime are less than or equal to 0, or the
+     * flooding file is empty or not ready to write
+     */
+    explicit ConcurrentQueue(const int capacity,
+                             std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                             std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                             std::shared_ptr<FloodingFile> floodingFile,
+                             const int maxAttempts,
+                             const int waitTime,
+                             const bool discard = false)
+        : ConcurrentQueue(capacity, std::move(metricsScope), std::move(metricsScopeDelta))
+    {
+        if (!floodingFile)
+        {
+            throw std::runtime_error("The flooding file cannot be empty");
+        }
+
+        if (floodingFile->getError())
+        {
+            throw std::runtime_error("Error opening the flooding file: " + floodingFile->getError().value());
+        }
+
+        if (maxAttempts <= 0)
+        {
+            throw std::runtime_error("The maximum number of attempts must be greater than 0");
+        }
+
+        if (waitTime <= 0)
+        {
+            throw std::runtime_error("The wait time must be greater than 0");
+        }
+
+        m_floodingFile = std::move(floodingFile);
+        m_maxAttempts = maxAttempts;
+        m_waitTime = std::chrono::microseconds(waitTime);
+        m_discard = discard;
+    }
+
+    /**
+     * @brief Construct a new Concurrent Queue object that overflows to a spill log
+     *
+     * @param capacity The capacity of the queue. (Approximate)
+     * @param metricsScope The metrics scope for the queue.
+     * @param metricsScopeDelta The metrics scope for the per second metrics of the queue.
+     * @param spillLog The spill log where the events that do not fit are appended, they are replayed before popping.
+     * @param decoder Rebuilds an element from the str() of a spilled one.
+     *
+     * @throw std::runtime_error if the capacity is less than or equal to 0, or the spill log or decoder are empty
+     * @note The events are discarded only when the spill log is full.
+     */
+    explicit ConcurrentQueue(const int capacity,
+                             std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                             std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                             std::shared_ptr<SpillLog> spillLog,
+                             Decoder decoder)
+        : ConcurrentQueue(capacity, std::move(metricsScope), std::move(metricsScopeDelta))
+    {
+        if (!spillLog || !decoder)
+        {
+            throw std::runtime_error("The spill log and its decoder cannot be empty");
+        }
+
+        m_spillLog = std::move(spillLog);
+        m_decoder = std::move(decoder);
+        m_capacity = static_cast<std::size_t>(capacity);
+        LOG_INFO("The queue will spill to disk when it is full ({} events pending).", m_spillLog->size());
+    }
+
     void push(T&& element) override
     {
         if constexpr (has_str_method_v<T>)
         {
+            if (m_spillLog)
+            {
+                pushWithSpill(std::move(element));
+                return;
+            }
             pushWithStr(std::move(element));
         }
         else
@@ -286,13 +455,36 @@ public:
     }
 
     /**
-     * @brief Pushes a new element to the queue.
+     * @brief Pushes several elements to the queue.
      *
-     * @param element The element to be pushed, it will be moved.
-     * @throw std::runtime_error if the queue is flooded and the file is not good.
-     * @note If the pathFloodedFile is not provided, the queue will not be flooded,and the
-     * push method will block until there is space in the queue.
+     * All the elements are enqueued at once if there is room for them, otherwise each one goes through push.
+     * @param elements The elements to be pushed, they are moved and the vector is cleared.
+     * @note The metrics are updated once per batch when the elements are enqueued at once.
      */
+    void pushBulk(std::vector<T>& elements) override
+    {
+        if (elements.empty())
+        {
+            return;
+        }
+
+        // try_enqueue_bulk does not touch the elements when there is no room for all of them
+        if ((!m_spillLog || m_spillLog->empty())
+            && m_queue.try_enqueue_bulk(std::make_move_iterator(elements.begin()), elements.size()))
+        {
+            m_metrics.m_queued->addValue(elements.size());
+            m_metrics.m_used->addValue(static_cast<int64_t>(elements.size()));
+        }
+        else
+        {
+            for (auto& element : elements)
+            {
+                push(std::move(element));
+            }
+        }
+
+        elements.clear();
+    }
 
     /**
      * @brief Tries to push an element to the queue.
@@ -326,6 +518,7 @@ public:
      */
     bool waitPop(T& element, int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
     {
+        replaySpilled(1);
         auto result = m_queue.wait_dequeue_timed(element, timeout);
         if (result)
         {
@@ -339,6 +532,7 @@ public:
 
     bool tryPop(T& element) override
     {
+        replaySpilled(1);
         auto result = m_queue.try_dequeue(element);
         if (result)
         {
@@ -349,6 +543,47 @@ public:
         return result;
     }
 
+    /**
+     * @brief Pops up to `max` elements from the queue, waiting for the first one at most `timeout` microseconds.
+     *
+     * @param elements The vector where the popped elements are appended.
+     * @param max The maximum number of elements to pop.
+     * @param timeout The timeout in microseconds.
+     * @return std::size_t The number of elements popped, 0 if the timeout was reached.
+     * @note The metrics are updated once per batch instead of once per element.
+     * @note The spilled events are moved back to the queue before and after popping, up to max.
+     */
+    std::size_t waitPopBulk(std::vector<T>& elements,
+                            std::size_t max,
+                            int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        if (max == 0)
+        {
+            return 0;
+        }
+
+        replaySpilled(max);
+        const auto offset = elements.size();
+        elements.resize(offset + max);
+        auto count = m_queue.wait_dequeue_bulk_timed(elements.begin() + offset, max, timeout);
+        if (count < max && m_spillLog && !m_spillLog->empty())
+        {
+            // Complete the batch with the spilled events, now that there is room for them
+            replaySpilled(max - count);
+            count += m_queue.try_dequeue_bulk(elements.begin() + offset + count, max - count);
+        }
+        elements.resize(offset + count);
+
+        if (count > 0)
+        {
+            m_metrics.m_consumed->addValue(count);
+            m_metrics.m_used->addValue(-static_cast<int64_t>(count));
+            m_metrics.m_consumendPerSecond->addValue(count);
+        }
+
+        return count;
+    }
+
     /**
      * @brief Checks if the queue is empty.
      *
@@ -356,14 +591,14 @@ public:
      * @return true if the queue is empty.
      * @return false otherwise.
      */
-    bool empty() const override { return m_queue.size_approx() == 0; }
+    bool empty() const override { return size() == 0; }
     /**
-     * @brief Gets the size of the queue.
+     * @brief Gets the size of the queue, including the spilled events.
      *
      * @note The size is approximate.
      * @return size_t The size of the queue.
      */
-    size_t size() const override { return m_queue.size_approx(); }
+    size_t size() const override { return m_queue.size_approx() + (m_spillLog ? m_spillLog->size() : 0); }
 };
 
 } // namespace base::queue
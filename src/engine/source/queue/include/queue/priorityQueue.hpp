@@ -0,0 +1,376 @@
+#ifndef _QUEUE_PRIORITYQUEUE_HPP
+#define _QUEUE_PRIORITYQUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <queue/iqueue.hpp>
+
+#include <metrics/iMetricsScope.hpp>
+
+namespace base::queue
+{
+
+constexpr int64_t PRIORITY_WAIT_SLICE_USEC = 1000;          ///< Wait on one class before checking the others again
+constexpr std::size_t MAX_PRIORITY_WEIGHT = 100;            ///< Max weight of a priority class
+constexpr int64_t LATENCY_PROBE_EXPIRE_USEC = 60 * 1000000; ///< Drop a tracked element that was never popped
+
+/**
+ * @brief Definition of a priority class, as configured
+ */
+struct PriorityClassSpec
+{
+    std::string name;     ///< Name of the class, used for its metrics
+    std::size_t weight;   ///< Share of the dequeued events when all the classes are backlogged
+    std::string queueIds; ///< Wazuh queue ids (first byte of the messages) of the events of the class
+};
+
+/**
+ * @brief Parse the priority classes, "<name>=<weight>:<queue ids>" separated by commas
+ *
+ * e.g. "realtime=8:1,bulk=1:8dp". The queue ids are the characters of the first byte of the messages.
+ *
+ * @param spec Classes in order of priority
+ * @return std::vector<PriorityClassSpec> The classes, empty if the spec is empty
+ * @throw std::runtime_error if a class is malformed, its weight is out of range or a queue id is repeated
+ */
+inline std::vector<PriorityClassSpec> parsePriorityClasses(std::string_view spec)
+{
+    std::vector<PriorityClassSpec> classes;
+    std::string seen;
+    while (!spec.empty())
+    {
+        const auto end = spec.find(',');
+        const auto item = spec.substr(0, end);
+        spec = end == std::string_view::npos ? std::string_view {} : spec.substr(end + 1);
+
+        const auto eq = item.find('=');
+        const auto colon = item.find(':', eq == std::string_view::npos ? 0 : eq);
+        if (eq == 0 || eq == std::string_view::npos || colon == std::string_view::npos)
+        {
+            throw std::runtime_error("Invalid priority class '" + std::string(item) + "', expected name=weight:ids");
+        }
+
+        PriorityClassSpec priorityClass {std::string(item.substr(0, eq)), 0, std::string(item.substr(colon + 1))};
+        const auto weight = item.substr(eq + 1, colon - eq - 1);
+        if (weight.empty() || weight.size() > 3
+            || !std::all_of(weight.begin(), weight.end(), [](unsigned char c) { return std::isdigit(c); }))
+        {
+            throw std::runtime_error("Invalid weight of the priority class '" + priorityClass.name + "'");
+        }
+        priorityClass.weight = std::stoul(std::string(weight));
+        if (priorityClass.weight == 0 || priorityClass.weight > MAX_PRIORITY_WEIGHT)
+        {
+            throw std::runtime_error("The weight of the priority class '" + priorityClass.name
+                                     + "' must be between 1 and " + std::to_string(MAX_PRIORITY_WEIGHT));
+        }
+        for (auto id : priorityClass.queueIds)
+        {
+            if (seen.find(id) != std::string::npos)
+            {
+                throw std::runtime_error(std::string("The queue id '") + id + "' is in more than one priority class");
+            }
+            seen.push_back(id);
+        }
+        classes.emplace_back(std::move(priorityClass));
+    }
+    return classes;
+}
+
+/**
+ * @brief Queue made of one queue per priority class, dequeued with weighted fair sharing.
+ *
+ * Each element is pushed to the queue of its class. The consumers take turns over a weighted round robin schedule
+ * of the classes: each batch is filled first from the class of its turn and then from the next classes, so when
+ * all the classes are backlogged each one gets a share of the batches proportional to its weight, and when some are
+ * idle the others take their share. The schedule position is a shared atomic, there are no locks.
+ *
+ * The depth of each class is reported by its own queue. The latency of each class is sampled: one element at a time
+ * is tracked from its push to the pop that takes it, and recorded in the QueueLatency histogram (ms) of the class.
+ *
+ * @tparam T The type of the data to be stored in the queue.
+ */
+template<typename T>
+class PriorityQueue : public iQueue<T>
+{
+public:
+    using Selector = std::function<std::size_t(const T&)>; ///< Index of the class of an element
+
+    struct PriorityClass
+    {
+        std::shared_ptr<iQueue<T>> queue;                            ///< Queue of the class
+        std::size_t weight;                                          ///< Weight of the class
+        std::shared_ptr<metricsManager::IMetricsScope> metricsScope; ///< Scope of the latency metric, can be empty
+    };
+
+private:
+    struct alignas(64) Latency
+    {
+        std::atomic<std::uint64_t> pushed {0}; ///< Elements pushed to the class
+        std::atomic<std::uint64_t> popped {0}; ///< Elements popped from the class
+        std::atomic<std::uint64_t> target {0}; ///< Pushed count of the tracked element, 0 if none
+        std::atomic<int64_t> start {0};        ///< Push time of the tracked element
+        std::shared_ptr<metricsManager::iHistogram<double>> histogram;
+    };
+
+    std::vector<PriorityClass> m_classes;
+    std::vector<std::unique_ptr<Latency>> m_latencies;
+    std::vector<std::size_t> m_schedule; ///< Weighted round robin order of the classes
+    std::atomic<std::size_t> m_turn {0}; ///< Next position of the schedule
+    Selector m_selector;
+
+    static int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    void onPush(std::size_t index, std::size_t count)
+    {
+        auto& latency = *m_latencies[index];
+        const auto pushed = latency.pushed.fetch_add(count, std::memory_order_relaxed) + count;
+        if (!latency.histogram)
+        {
+            return;
+        }
+
+        // The tracked element may have been discarded by a full queue
+        auto target = latency.target.load(std::memory_order_relaxed);
+        if (target != 0 && now() - latency.start.load(std::memory_order_relaxed) > LATENCY_PROBE_EXPIRE_USEC)
+        {
+            latency.target.compare_exchange_strong(target, 0, std::memory_order_relaxed);
+        }
+        if (latency.target.load(std::memory_order_relaxed) == 0)
+        {
+            latency.start.store(now(), std::memory_order_relaxed);
+            std::uint64_t none {0};
+            latency.target.compare_exchange_strong(none, pushed, std::memory_order_release);
+        }
+    }
+
+    void onPop(std::size_t index, std::size_t count)
+    {
+        auto& latency = *m_latencies[index];
+        const auto popped = latency.popped.fetch_add(count, std::memory_order_relaxed) + count;
+        auto target = latency.target.load(std::memory_order_acquire);
+        if (target != 0 && popped >= target
+            && latency.target.compare_exchange_strong(target, 0, std::memory_order_relaxed))
+        {
+            latency.histogram->recordValue((now() - latency.start.load(std::memory_order_relaxed)) / 1000.0);
+        }
+    }
+
+    /**
+     * @brief Take up to max elements without waiting, starting by the class of the turn
+     */
+    std::size_t popTurn(std::vector<T>& elements, std::size_t max, std::size_t first)
+    {
+        std::size_t count {0};
+        for (std::size_t i = 0; i < m_classes.size() && count < max; ++i)
+        {
+            const auto index = (first + i) % m_classes.size();
+            if (auto got = m_classes[index].queue->waitPopBulk(elements, max - count, 0); got > 0)
+            {
+                onPop(index, got);
+                count += got;
+            }
+        }
+        return count;
+    }
+
+    std::size_t selectClass(const T& element) const
+    {
+        const auto index = m_selector(element);
+        return index < m_classes.size() ? index : m_classes.size() - 1;
+    }
+
+public:
+    /**
+     * @brief Construct a new Priority Queue object
+     *
+     * @param classes Classes in order of priority, the selector defaults to the last one
+     * @param selector Index of the class of an element
+     * @throw std::runtime_error if there are no classes, a class has no queue or weight, or the selector is empty
+     */
+    PriorityQueue(std::vector<PriorityClass> classes, Selector selector)
+        : m_classes {std::move(classes)}
+        , m_selector {std::move(selector)}
+    {
+        if (m_classes.empty() || !m_selector)
+        {
+            throw std::runtime_error("The priority queue needs at least one class and a selector");
+        }
+
+        std::vector<int64_t> current(m_classes.size(), 0);
+        int64_t total {0};
+        for (const auto& priorityClass : m_classes)
+        {
+            if (!priorityClass.queue || priorityClass.weight == 0 || priorityClass.weight > MAX_PRIORITY_WEIGHT)
+            {
+                throw std::runtime_error("Each priority class needs a queue and a weight between 1 and "
+                                         + std::to_string(MAX_PRIORITY_WEIGHT));
+            }
+            total += priorityClass.weight;
+
+            auto latency = std::make_unique<Latency>();
+            if (priorityClass.metricsScope)
+            {
+                latency->histogram = priorityClass.metricsScope->getHistogramDouble("QueueLatency");
+            }
+            m_latencies.emplace_back(std::move(latency));
+        }
+
+        // Smooth weighted round robin, the turns of each class are spread over the schedule
+        for (int64_t slot = 0; slot < total; ++slot)
+        {
+            std::size_t best {0};
+            for (std::size_t i = 0; i < m_classes.size(); ++i)
+            {
+                current[i] += m_classes[i].weight;
+                if (current[i] > current[best])
+                {
+                    best = i;
+                }
+            }
+            current[best] -= total;
+            m_schedule.push_back(best);
+        }
+    }
+
+    void push(T&& element) override
+    {
+        const auto index = selectClass(element);
+        m_classes[index].queue->push(std::move(element));
+        onPush(index, 1);
+    }
+
+    /**
+     * @brief Pushes several elements, grouped by class. The order of the elements of each class is kept.
+     */
+    void pushBulk(std::vector<T>& elements) override
+    {
+        if (m_classes.size() == 1)
+        {
+            const auto count = elements.size();
+            m_classes.front().queue->pushBulk(elements);
+            onPush(0, count);
+            return;
+        }
+
+        std::vector<std::vector<T>> groups(m_classes.size());
+        for (auto& element : elements)
+        {
+            groups[selectClass(element)].emplace_back(std::move(element));
+        }
+        elements.clear();
+
+        for (std::size_t index = 0; index < groups.size(); ++index)
+        {
+            if (!groups[index].empty())
+            {
+                const auto count = groups[index].size();
+                m_classes[index].queue->pushBulk(groups[index]);
+                onPush(index, count);
+            }
+        }
+    }
+
+    bool tryPush(const T& element) override
+    {
+        const auto index = selectClass(element);
+        if (m_classes[index].queue->tryPush(element))
+        {
+            onPush(index, 1);
+            return true;
+        }
+        return false;
+    }
+
+    bool waitPop(T& element, int64_t timeout = 0) override
+    {
+        std::vector<T> elements;
+        if (waitPopBulk(elements, 1, timeout) == 0)
+        {
+            return false;
+        }
+        element = std::move(elements.front());
+        return true;
+    }
+
+    bool tryPop(T& element) override { return waitPop(element, 0); }
+
+    /**
+     * @copydoc iQueue::waitPopBulk
+     *
+     * While all the classes are empty the consumer waits on the class of its turn, in slices of
+     * PRIORITY_WAIT_SLICE_USEC, so an element of another class waits one slice at most.
+     */
+    std::size_t waitPopBulk(std::vector<T>& elements, std::size_t max, int64_t timeout = 0) override
+    {
+        if (max == 0)
+        {
+            return 0;
+        }
+
+        const auto first = m_schedule[m_turn.fetch_add(1, std::memory_order_relaxed) % m_schedule.size()];
+        if (auto count = popTurn(elements, max, first); count > 0 || timeout == 0)
+        {
+            return count;
+        }
+
+        const auto deadline = timeout < 0 ? int64_t {-1} : now() + timeout;
+        while (true)
+        {
+            const auto remaining = deadline < 0 ? PRIORITY_WAIT_SLICE_USEC : deadline - now();
+            if (remaining <= 0)
+            {
+                return 0;
+            }
+
+            const auto slice = std::min(remaining, PRIORITY_WAIT_SLICE_USEC);
+            if (auto got = m_classes[first].queue->waitPopBulk(elements, max, slice); got > 0)
+            {
+                onPop(first, got);
+                return got;
+            }
+            if (auto count = popTurn(elements, max, first); count > 0)
+            {
+                return count;
+            }
+        }
+    }
+
+    bool empty() const override
+    {
+        return std::all_of(
+            m_classes.begin(), m_classes.end(), [](const auto& priorityClass) { return priorityClass.queue->empty(); });
+    }
+
+    size_t size() const override
+    {
+        return std::accumulate(m_classes.begin(),
+                               m_classes.end(),
+                               std::size_t {0},
+                               [](std::size_t total, const auto& priorityClass)
+                               { return total + priorityClass.queue->size(); });
+    }
+
+    /**
+     * @brief Number of classes
+     */
+    std::size_t classes() const { return m_classes.size(); }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_PRIORITYQUEUE_HPP
@@ -0,0 +1,127 @@
+#ifndef _QUEUE_SPILLLOG_HPP
+#define _QUEUE_SPILLLOG_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace base::queue
+{
+
+constexpr std::size_t SPILL_SEGMENT_SIZE = 64 * 1024 * 1024; ///< Default size of each segment of the spill log
+
+/**
+ * @brief Size bounded, append-only log of records on disk, used as the overflow of a full queue.
+ *
+ * The log is a directory of segments of a fixed size, mapped in memory. Each record is written as its length
+ * followed by its bytes, and the segments are zero filled, so a zero length marks the end of the data. The first
+ * bytes of each segment keep the offset of the next record to read, so the records that were not read survive a
+ * restart and are read again in the same order. A segment is deleted when all its records are read.
+ *
+ * There is no flush per record, the mapped pages are written back by the kernel and synced when a segment is
+ * full or the log is closed.
+ *
+ * @warning append, pop and popIf are thread safe, they take the same mutex.
+ */
+class SpillLog
+{
+private:
+    struct Segment
+    {
+        std::filesystem::path path;  ///< File of the segment
+        char* data {nullptr};        ///< Mapped file
+        std::size_t writeOffset {0}; ///< Offset of the next record to write
+    };
+
+    std::filesystem::path m_dir;    ///< Directory of the segments
+    std::size_t m_segmentSize;      ///< Size of each segment
+    std::size_t m_maxSegments;      ///< Max number of segments, bounds the size of the log
+    std::uint64_t m_nextId {0};     ///< Id of the next segment, the segments are read in the order of their ids
+    std::deque<Segment> m_segments; ///< Segments from the oldest (read) to the newest (write)
+
+    std::atomic<std::size_t> m_size {0}; ///< Records not yet read
+    mutable std::mutex m_mutex;          ///< Protects the segments
+
+    std::uint64_t readOffset(const Segment& segment) const;
+    void setReadOffset(Segment& segment, std::uint64_t offset);
+
+    /**
+     * @brief Map a segment file, creating it if it does not exist
+     *
+     * @throw std::runtime_error if the file can't be created or mapped
+     */
+    Segment openSegment(const std::filesystem::path& path);
+
+    /**
+     * @brief Unmap the segment and delete its file
+     */
+    void removeSegment(Segment& segment);
+
+    /**
+     * @brief Load the segments of a previous run and count their unread records
+     */
+    void recover();
+
+public:
+    /**
+     * @brief Construct a new Spill Log object, loading the records of a previous run from the directory
+     *
+     * @param dir Directory of the segments, it is created if it does not exist
+     * @param maxBytes Max size of the log on disk, rounded up to a whole number of segments
+     * @param segmentSize Size of each segment
+     * @throw std::runtime_error if the sizes are invalid or the directory or its segments can't be opened
+     */
+    SpillLog(const std::string& dir, std::size_t maxBytes, std::size_t segmentSize = SPILL_SEGMENT_SIZE);
+
+    ~SpillLog();
+
+    SpillLog(const SpillLog&) = delete;
+    SpillLog& operator=(const SpillLog&) = delete;
+
+    /**
+     * @brief Append a record to the end of the log
+     *
+     * @param record Record to append
+     * @return true if the record was appended, false if the log is full or the record does not fit in a segment
+     */
+    bool append(std::string_view record);
+
+    /**
+     * @brief Read and remove the oldest record of the log
+     *
+     * @param record Where the record is written
+     * @return true if a record was read, false if the log is empty
+     */
+    bool pop(std::string& record);
+
+    /**
+     * @brief Remove the oldest record of the log only if it is consumed
+     *
+     * The record stays at the head of the log if consume returns false, so it is the next one read. Consume runs
+     * with the log locked, it must not use the log.
+     *
+     * @param consume Called with the oldest record, returns true if the record can be removed
+     * @return true if a record was consumed and removed, false if the log is empty or the record was kept
+     */
+    bool popIf(const std::function<bool(std::string_view)>& consume);
+
+    /**
+     * @brief Number of records not yet read, lock free
+     */
+    std::size_t size() const { return m_size.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Check if all the records were read, lock free
+     */
+    bool empty() const { return size() == 0; }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_SPILLLOG_HPP
@@ -1,7 +1,9 @@
 #ifndef _QUEUE_IQUEUE_HPP
 #define _QUEUE_IQUEUE_HPP
 
-
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace base::queue
 {
@@ -30,6 +32,13 @@ public:
      */
     virtual void push(T&& element) = 0;
 
+    /**
+     * @brief Push several elements into the queue, with the same policy as push for the ones that do not fit.
+     *
+     * @param elements The elements to push, they are moved and the vector is cleared.
+     */
+    virtual void pushBulk(std::vector<T>& elements) = 0;
+
     /**
      * @brief Try to push an element into the queue
      *
@@ -54,6 +63,18 @@ public:
      */
     virtual bool tryPop(T& element) = 0;
 
+    /**
+     * @brief Wait for and pop up to `max` elements from the queue.
+     *
+     * The popped elements are appended to the end of `elements`, the existing content is preserved.
+     *
+     * @param elements The vector where the popped elements are appended.
+     * @param max The maximum number of elements to pop.
+     * @param timeout (Optional) The maximum time to wait for the first element (in microseconds).
+     * @return The number of elements popped, 0 if the timeout was reached.
+     */
+    virtual std::size_t waitPopBulk(std::vector<T>& elements, std::size_t max, int64_t timeout = 0) = 0;
+
     /**
      * @brief Check if the queue is empty.
      *
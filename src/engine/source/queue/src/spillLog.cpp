@@ -0,0 +1,294 @@
+#include <queue/spillLog.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <base/logging.hpp>
+
+namespace base::queue
+{
+
+namespace
+{
+constexpr std::uint64_t SEGMENT_MAGIC = 0x314c4c4950535a57ULL; ///< "WZSPILL1"
+constexpr std::size_t HEADER_SIZE = 2 * sizeof(std::uint64_t);  ///< Magic and read offset
+constexpr std::size_t LENGTH_SIZE = sizeof(std::uint32_t);      ///< Length prefix of each record
+constexpr auto SEGMENT_EXTENSION = ".spill";
+
+std::uint32_t recordLength(const char* data, std::size_t offset)
+{
+    std::uint32_t length;
+    std::memcpy(&length, data + offset, LENGTH_SIZE);
+    return length;
+}
+
+std::filesystem::path segmentPath(const std::filesystem::path& dir, std::uint64_t id)
+{
+    auto name = std::to_string(id);
+    name.insert(0, 20 - std::min<std::size_t>(name.size(), 20), '0');
+    return dir / (name + SEGMENT_EXTENSION);
+}
+} // namespace
+
+SpillLog::SpillLog(const std::string& dir, std::size_t maxBytes, std::size_t segmentSize)
+    : m_dir {dir}
+    , m_segmentSize {segmentSize}
+{
+    if (m_segmentSize <= HEADER_SIZE + LENGTH_SIZE)
+    {
+        throw std::runtime_error("The segment size of the spill log is too small");
+    }
+    if (maxBytes == 0)
+    {
+        throw std::runtime_error("The size of the spill log must be greater than 0");
+    }
+    m_maxSegments = (maxBytes + m_segmentSize - 1) / m_segmentSize;
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_dir, ec);
+    if (ec)
+    {
+        throw std::runtime_error("Error creating the spill log directory '" + dir + "': " + ec.message());
+    }
+
+    recover();
+}
+
+SpillLog::~SpillLog()
+{
+    for (auto& segment : m_segments)
+    {
+        msync(segment.data, m_segmentSize, MS_SYNC);
+        munmap(segment.data, m_segmentSize);
+    }
+}
+
+std::uint64_t SpillLog::readOffset(const Segment& segment) const
+{
+    std::uint64_t offset;
+    std::memcpy(&offset, segment.data + sizeof(std::uint64_t), sizeof(offset));
+    return offset;
+}
+
+void SpillLog::setReadOffset(Segment& segment, std::uint64_t offset)
+{
+    std::memcpy(segment.data + sizeof(std::uint64_t), &offset, sizeof(offset));
+}
+
+SpillLog::Segment SpillLog::openSegment(const std::filesystem::path& path)
+{
+    auto fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0640);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Error opening the spill segment '" + path.string() + "': " + strerror(errno));
+    }
+
+    // Grow the new and truncated segments, the new bytes are zero
+    struct stat st
+    {
+    };
+    if (fstat(fd, &st) != 0
+        || (static_cast<std::size_t>(st.st_size) != m_segmentSize && ftruncate(fd, m_segmentSize) != 0))
+    {
+        auto error = strerror(errno);
+        ::close(fd);
+        throw std::runtime_error("Error sizing the spill segment '" + path.string() + "': " + error);
+    }
+
+    auto data = mmap(nullptr, m_segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw std::runtime_error("Error mapping the spill segment '" + path.string() + "': " + strerror(errno));
+    }
+
+    Segment segment {path, static_cast<char*>(data), HEADER_SIZE};
+    std::uint64_t magic;
+    std::memcpy(&magic, segment.data, sizeof(magic));
+    if (magic != SEGMENT_MAGIC)
+    {
+        // New segment, or one whose header was never written: it has no records
+        std::memset(segment.data, 0, HEADER_SIZE + LENGTH_SIZE);
+        std::memcpy(segment.data, &SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+        setReadOffset(segment, HEADER_SIZE);
+    }
+    return segment;
+}
+
+void SpillLog::removeSegment(Segment& segment)
+{
+    munmap(segment.data, m_segmentSize);
+    segment.data = nullptr;
+    std::error_code ec;
+    std::filesystem::remove(segment.path, ec);
+    if (ec)
+    {
+        LOG_WARNING("Error removing the spill segment '{}': {}", segment.path.string(), ec.message());
+    }
+}
+
+void SpillLog::recover()
+{
+    std::vector<std::pair<std::uint64_t, std::filesystem::path>> files;
+    for (const auto& entry : std::filesystem::directory_iterator(m_dir))
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != SEGMENT_EXTENSION)
+        {
+            continue;
+        }
+        try
+        {
+            files.emplace_back(std::stoull(entry.path().stem().string()), entry.path());
+        }
+        catch (const std::exception&)
+        {
+            LOG_WARNING("Ignoring the unknown file '{}' in the spill log directory", entry.path().string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    std::size_t records {0};
+    for (const auto& [id, path] : files)
+    {
+        m_nextId = id + 1;
+        auto segment = openSegment(path);
+
+        // Find the end of the data, the records before the read offset were already read
+        auto read = readOffset(segment);
+        std::size_t total {0};
+        std::size_t pending {0};
+        auto& offset = segment.writeOffset;
+        while (offset + LENGTH_SIZE <= m_segmentSize)
+        {
+            const auto length = recordLength(segment.data, offset);
+            if (length == 0 || offset + LENGTH_SIZE + length > m_segmentSize)
+            {
+                break;
+            }
+            ++total;
+            pending += offset >= read ? 1 : 0;
+            offset += LENGTH_SIZE + length;
+        }
+        if (read < HEADER_SIZE || read > offset)
+        {
+            LOG_WARNING("Invalid read offset in the spill segment '{}', reading it from the start", path.string());
+            setReadOffset(segment, HEADER_SIZE);
+            pending = total;
+        }
+
+        if (pending == 0 || m_segments.size() >= m_maxSegments)
+        {
+            if (pending != 0)
+            {
+                LOG_WARNING("Spill log is over its size, discarding {} records of '{}'", pending, path.string());
+            }
+            removeSegment(segment);
+            continue;
+        }
+        records += pending;
+        m_segments.emplace_back(std::move(segment));
+    }
+
+    m_size = records;
+    if (records > 0)
+    {
+        LOG_INFO("Spill log '{}' recovered with {} records", m_dir.string(), records);
+    }
+}
+
+bool SpillLog::append(std::string_view record)
+{
+    const auto needed = LENGTH_SIZE + record.size();
+    if (record.empty() || needed > m_segmentSize - HEADER_SIZE)
+    {
+        return false;
+    }
+
+    std::lock_guard lock {m_mutex};
+    if (m_segments.empty() || m_segments.back().writeOffset + needed > m_segmentSize)
+    {
+        // Drop the segments that were read completely before checking the bound
+        while (!m_segments.empty() && readOffset(m_segments.front()) == m_segments.front().writeOffset)
+        {
+            removeSegment(m_segments.front());
+            m_segments.pop_front();
+        }
+        if (m_segments.size() >= m_maxSegments)
+        {
+            return false;
+        }
+
+        if (!m_segments.empty())
+        {
+            msync(m_segments.back().data, m_segmentSize, MS_ASYNC);
+        }
+        try
+        {
+            m_segments.emplace_back(openSegment(segmentPath(m_dir, m_nextId++)));
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Cannot open a new spill segment: {}", e.what());
+            return false;
+        }
+    }
+
+    // The length is written last: until then the record reads as the end of the data
+    auto& segment = m_segments.back();
+    const auto length = static_cast<std::uint32_t>(record.size());
+    std::memcpy(segment.data + segment.writeOffset + LENGTH_SIZE, record.data(), record.size());
+    std::memcpy(segment.data + segment.writeOffset, &length, LENGTH_SIZE);
+    segment.writeOffset += needed;
+    m_size.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool SpillLog::pop(std::string& record)
+{
+    return popIf(
+        [&record](std::string_view head)
+        {
+            record.assign(head);
+            return true;
+        });
+}
+
+bool SpillLog::popIf(const std::function<bool(std::string_view)>& consume)
+{
+    std::lock_guard lock {m_mutex};
+    while (!m_segments.empty())
+    {
+        auto& segment = m_segments.front();
+        const auto offset = readOffset(segment);
+        if (offset < segment.writeOffset)
+        {
+            const auto length = recordLength(segment.data, offset);
+            if (!consume(std::string_view(segment.data + offset + LENGTH_SIZE, length)))
+            {
+                return false;
+            }
+            setReadOffset(segment, offset + LENGTH_SIZE + length);
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // The segment being written is kept, the next records go to it
+        if (m_segments.size() == 1)
+        {
+            return false;
+        }
+        removeSegment(segment);
+        m_segments.pop_front();
+    }
+    return false;
+}
+
+} // namespace base::queue
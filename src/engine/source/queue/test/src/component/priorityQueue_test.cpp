@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <queue/concurrentQueue.hpp>
+#include <queue/priorityQueue.hpp>
+
+#include "fakeMetric.hpp"
+
+using namespace base::queue;
+
+namespace
+{
+struct Item
+{
+    std::size_t priorityClass;
+    int value;
+
+    std::string str() const { return std::to_string(value); }
+};
+using ItemPtr = std::shared_ptr<Item>;
+
+std::shared_ptr<PriorityQueue<ItemPtr>> makeQueue(const std::vector<std::size_t>& weights)
+{
+    std::vector<PriorityQueue<ItemPtr>::PriorityClass> classes;
+    for (auto weight : weights)
+    {
+        classes.push_back({std::make_shared<ConcurrentQueue<ItemPtr>>(
+                               1024, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>()),
+                           weight,
+                           std::make_shared<FakeMetricScope>()});
+    }
+    return std::make_shared<PriorityQueue<ItemPtr>>(std::move(classes),
+                                                    [](const ItemPtr& item) { return item->priorityClass; });
+}
+} // namespace
+
+TEST(PriorityClassesTest, Parse)
+{
+    auto classes = parsePriorityClasses("realtime=8:1a,bulk=1:8dp");
+    ASSERT_EQ(classes.size(), 2);
+    EXPECT_EQ(classes[0].name, "realtime");
+    EXPECT_EQ(classes[0].weight, 8);
+    EXPECT_EQ(classes[0].queueIds, "1a");
+    EXPECT_EQ(classes[1].name, "bulk");
+    EXPECT_EQ(classes[1].weight, 1);
+    EXPECT_EQ(classes[1].queueIds, "8dp");
+
+    EXPECT_TRUE(parsePriorityClasses("").empty());
+    EXPECT_EQ(parsePriorityClasses("default=2:")[0].queueIds, "");
+}
+
+TEST(PriorityClassesTest, ParseErrors)
+{
+    EXPECT_THROW(parsePriorityClasses("realtime"), std::runtime_error);
+    EXPECT_THROW(parsePriorityClasses("=1:1"), std::runtime_error);
+    EXPECT_THROW(parsePriorityClasses("realtime=:1"), std::runtime_error);
+    EXPECT_THROW(parsePriorityClasses("realtime=0:1"), std::runtime_error);
+    EXPECT_THROW(parsePriorityClasses("realtime=101:1"), std::runtime_error);
+    EXPECT_THROW(parsePriorityClasses("realtime=x:1"), std::runtime_error);
+    EXPECT_THROW(parsePriorityClasses("realtime=1:12,bulk=1:2"), std::runtime_error);
+}
+
+TEST(PriorityQueueTest, InvalidClasses)
+{
+    EXPECT_THROW(PriorityQueue<ItemPtr>({}, [](const ItemPtr&) { return 0; }), std::runtime_error);
+    EXPECT_THROW(makeQueue({0}), std::runtime_error);
+    EXPECT_THROW(PriorityQueue<ItemPtr>({{nullptr, 1, nullptr}}, [](const ItemPtr&) { return 0; }),
+                 std::runtime_error);
+}
+
+TEST(PriorityQueueTest, WeightedShareWhenBacklogged)
+{
+    auto queue = makeQueue({3, 1});
+    for (int i = 0; i < 100; i++)
+    {
+        queue->push(std::make_shared<Item>(Item {0, i}));
+        queue->push(std::make_shared<Item>(Item {1, i}));
+    }
+    ASSERT_EQ(queue->size(), 200);
+
+    std::size_t taken[2] {0, 0};
+    for (int i = 0; i < 40; i++)
+    {
+        ItemPtr item;
+        ASSERT_TRUE(queue->waitPop(item, 0));
+        ++taken[item->priorityClass];
+    }
+    EXPECT_EQ(taken[0], 30);
+    EXPECT_EQ(taken[1], 10);
+}
+
+TEST(PriorityQueueTest, IdleClassesGiveTheirShare)
+{
+    auto queue = makeQueue({3, 1});
+    std::vector<ItemPtr> items;
+    for (int i = 0; i < 10; i++)
+    {
+        items.push_back(std::make_shared<Item>(Item {1, i}));
+    }
+    queue->pushBulk(items);
+    ASSERT_TRUE(items.empty());
+
+    // The order of each class is kept
+    std::vector<ItemPtr> batch;
+    ASSERT_EQ(queue->waitPopBulk(batch, 4, 0), 4);
+    ASSERT_EQ(queue->waitPopBulk(batch, 10, 0), 6);
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(batch[i]->value, i);
+    }
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST(PriorityQueueTest, UnknownClassGoesToTheLast)
+{
+    auto queue = makeQueue({1, 1});
+    queue->push(std::make_shared<Item>(Item {7, 0}));
+
+    std::vector<ItemPtr> batch;
+    ASSERT_EQ(queue->waitPopBulk(batch, 1, 0), 1);
+}
+
+TEST(PriorityQueueTest, WaitTimeout)
+{
+    auto queue = makeQueue({2, 1});
+    std::vector<ItemPtr> batch;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(queue->waitPopBulk(batch, 10, 5000), 0);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(5000));
+
+    ItemPtr item;
+    ASSERT_FALSE(queue->tryPop(item));
+}
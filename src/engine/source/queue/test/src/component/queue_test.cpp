@@ -128,3 +128,145 @@ TEST_F(ConcurrentQueueTest, Timeout)
     ASSERT_FALSE(cq.waitPop(d, 0));
     ASSERT_EQ(d->value, 0);
 }
+
+TEST_F(ConcurrentQueueTest, CanPopBulk)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        32, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    for (int i = 0; i < 5; i++)
+    {
+        cq.push(std::make_shared<Dummy>(i));
+    }
+
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(cq.waitPopBulk(batch, 3), 3);
+    ASSERT_EQ(batch.size(), 3);
+    ASSERT_EQ(cq.size(), 2);
+
+    // Appends to the existing elements
+    ASSERT_EQ(cq.waitPopBulk(batch, 10), 2);
+    ASSERT_EQ(batch.size(), 5);
+    for (int i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(batch[i]->value, i);
+    }
+    ASSERT_TRUE(cq.empty());
+}
+
+TEST_F(ConcurrentQueueTest, PopBulkTimeout)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        2, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(cq.waitPopBulk(batch, 10, 0), 0);
+    ASSERT_TRUE(batch.empty());
+    ASSERT_EQ(cq.waitPopBulk(batch, 0, 0), 0);
+}
+
+TEST_F(ConcurrentQueueTest, CanPushBulk)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        32, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    std::vector<std::shared_ptr<Dummy>> batch;
+    for (int i = 0; i < 5; i++)
+    {
+        batch.push_back(std::make_shared<Dummy>(i));
+    }
+
+    cq.pushBulk(batch);
+    ASSERT_TRUE(batch.empty());
+    ASSERT_EQ(cq.size(), 5);
+
+    ASSERT_EQ(cq.waitPopBulk(batch, 10), 5);
+    for (int i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(batch[i]->value, i);
+    }
+}
+
+TEST_F(ConcurrentQueueTest, PushBulkFloodsWhatDoesNotFit)
+{
+    std::string flood_file = "floodfile_bulk.txt";
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        32, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>(), flood_file, 3, 500);
+
+    std::vector<std::shared_ptr<Dummy>> batch;
+    for (int i = 0; i < 35; i++)
+    {
+        batch.push_back(std::make_shared<Dummy>(i));
+    }
+
+    cq.pushBulk(batch);
+    ASSERT_TRUE(batch.empty());
+    ASSERT_EQ(cq.size(), 32);
+
+    std::ifstream floodfile(flood_file);
+    int num_flooded = 0;
+    std::string line;
+    while (std::getline(floodfile, line))
+    {
+        num_flooded++;
+    }
+
+    ASSERT_EQ(num_flooded, 3);
+    floodfile.close();
+    std::filesystem::remove(flood_file);
+}
+
+TEST_F(ConcurrentQueueTest, SpillsWhenFullAndReplaysInOrder)
+{
+    std::string spill_dir = "spill_queue";
+    std::filesystem::remove_all(spill_dir);
+    auto decoder = [](std::string_view str)
+    {
+        return std::make_shared<Dummy>(std::stoi(std::string(str.substr(str.find(' ') + 1))));
+    };
+
+    {
+        ConcurrentQueue<std::shared_ptr<Dummy>> cq(32,
+                                                   std::make_shared<FakeMetricScope>(),
+                                                   std::make_shared<FakeMetricScope>(),
+                                                   std::make_shared<SpillLog>(spill_dir, 1024 * 1024, 4096),
+                                                   decoder);
+
+        for (int i = 0; i < 50; i++)
+        {
+            cq.push(std::make_shared<Dummy>(i));
+        }
+        ASSERT_EQ(cq.size(), 50);
+
+        std::vector<std::shared_ptr<Dummy>> batch;
+        ASSERT_EQ(cq.waitPopBulk(batch, 40, 0), 40);
+        for (int i = 0; i < 40; i++)
+        {
+            ASSERT_EQ(batch[i]->value, i);
+        }
+
+        // The queue is empty but the new events go after the spilled ones
+        for (int i = 50; i < 80; i++)
+        {
+            cq.push(std::make_shared<Dummy>(i));
+        }
+        ASSERT_EQ(cq.size(), 40);
+    }
+
+    // The events in the spill log survive a restart
+    auto spillLog = std::make_shared<SpillLog>(spill_dir, 1024 * 1024, 4096);
+    ASSERT_EQ(spillLog->size(), 40);
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        32, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>(), spillLog, decoder);
+
+    std::shared_ptr<Dummy> d;
+    ASSERT_TRUE(cq.waitPop(d, 0));
+    ASSERT_EQ(d->value, 40);
+    ASSERT_EQ(cq.size(), 39);
+
+    std::filesystem::remove_all(spill_dir);
+}
+
+TEST_F(ConcurrentQueueTest, SpillRequiresLogAndDecoder)
+{
+    ASSERT_THROW(ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+                     2, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>(), nullptr, nullptr),
+                 std::runtime_error);
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#include <base/logging.hpp>
+#include <queue/spillLog.hpp>
+
+using namespace base::queue;
+
+class SpillLogTest : public ::testing::Test
+{
+protected:
+    std::string m_dir;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_dir = "spill_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(m_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    std::size_t segments() const
+    {
+        return std::distance(std::filesystem::directory_iterator(m_dir), std::filesystem::directory_iterator {});
+    }
+};
+
+TEST_F(SpillLogTest, InvalidSizes)
+{
+    ASSERT_THROW(SpillLog(m_dir, 0, 1024), std::runtime_error);
+    ASSERT_THROW(SpillLog(m_dir, 1024, 8), std::runtime_error);
+}
+
+TEST_F(SpillLogTest, AppendAndPopInOrder)
+{
+    SpillLog log(m_dir, 4096, 1024);
+    ASSERT_TRUE(log.empty());
+
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_TRUE(log.append("event " + std::to_string(i)));
+    }
+    ASSERT_EQ(log.size(), 100);
+    ASSERT_GT(segments(), 1);
+
+    std::string record;
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_TRUE(log.pop(record));
+        ASSERT_EQ(record, "event " + std::to_string(i));
+    }
+    ASSERT_TRUE(log.empty());
+    ASSERT_FALSE(log.pop(record));
+
+    // Only the segment being written is kept
+    ASSERT_EQ(segments(), 1);
+}
+
+TEST_F(SpillLogTest, PopIfKeepsTheRejectedRecord)
+{
+    SpillLog log(m_dir, 4096, 1024);
+    ASSERT_TRUE(log.append("first"));
+    ASSERT_TRUE(log.append("second"));
+
+    std::string seen;
+    ASSERT_FALSE(log.popIf(
+        [&seen](std::string_view record)
+        {
+            seen.assign(record);
+            return false;
+        }));
+    ASSERT_EQ(seen, "first");
+    ASSERT_EQ(log.size(), 2);
+
+    ASSERT_TRUE(log.popIf(
+        [&seen](std::string_view record)
+        {
+            seen.assign(record);
+            return true;
+        }));
+    ASSERT_EQ(seen, "first");
+
+    std::string record;
+    ASSERT_TRUE(log.pop(record));
+    ASSERT_EQ(record, "second");
+    ASSERT_FALSE(log.popIf([](std::string_view) { return true; }));
+}
+
+TEST_F(SpillLogTest, SizeBounded)
+{
+    SpillLog log(m_dir, 2048, 1024);
+    const std::string record(100, 'x');
+
+    std::size_t appended {0};
+    while (log.append(record))
+    {
+        ++appended;
+    }
+    // 2 segments of 9 records (16 bytes of header and 104 bytes per record)
+    ASSERT_EQ(appended, 18);
+    ASSERT_EQ(segments(), 2);
+
+    // A record larger than a segment never fits
+    ASSERT_FALSE(log.append(std::string(1024, 'x')));
+
+    // Reading a whole segment frees it for new records
+    std::string popped;
+    for (int i = 0; i < 9; i++)
+    {
+        ASSERT_TRUE(log.pop(popped));
+    }
+    ASSERT_TRUE(log.append(record));
+    ASSERT_EQ(log.size(), 10);
+    ASSERT_EQ(segments(), 2);
+}
+
+TEST_F(SpillLogTest, RecoverUnreadRecords)
+{
+    {
+        SpillLog log(m_dir, 4096, 1024);
+        for (int i = 0; i < 50; i++)
+        {
+            ASSERT_TRUE(log.append("event " + std::to_string(i)));
+        }
+
+        std::string record;
+        for (int i = 0; i < 20; i++)
+        {
+            ASSERT_TRUE(log.pop(record));
+        }
+    }
+
+    SpillLog log(m_dir, 4096, 1024);
+    ASSERT_EQ(log.size(), 30);
+
+    std::string record;
+    for (int i = 20; i < 50; i++)
+    {
+        ASSERT_TRUE(log.pop(record));
+        ASSERT_EQ(record, "event " + std::to_string(i));
+    }
+    ASSERT_TRUE(log.empty());
+
+    // New records go after the recovered ones
+    ASSERT_TRUE(log.append("last"));
+    ASSERT_TRUE(log.pop(record));
+    ASSERT_EQ(record, "last");
+}
@@ -4,6 +4,7 @@
 #include <map>
 #include <optional>
 #include <stdexcept>
+#include <unordered_set>
 
 #include <fmt/format.h>
 
@@ -132,22 +133,21 @@ public:
 
     AuthFn getAuthFn(Resource res, Operation op) const override
     {
+        // The model does not change once loaded, so the decision for each role is taken here and the returned function
+        // only looks up the name of the role
         auto permission = Permission(res, op);
-
-        return [permission, roles = m_roles](const std::string& roleName)
+        std::unordered_set<std::string> allowedRoles;
+        for (const auto& [roleName, role] : m_roles)
         {
-            auto role = roles.find(roleName);
-            if (role == roles.end())
+            if (role.getPermissions().find(permission) != role.getPermissions().end())
             {
-                return false;
-            }
-
-            if (role->second.getPermissions().find(permission) == role->second.getPermissions().end())
-            {
-                return false;
+                allowedRoles.insert(roleName);
             }
+        }
 
-            return true;
+        return [allowedRoles = std::move(allowedRoles)](const std::string& roleName)
+        {
+            return allowedRoles.find(roleName) != allowedRoles.end();
         };
     }
 
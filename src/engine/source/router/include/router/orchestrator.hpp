@@ -1,17 +1,22 @@
 #ifndef _ROUTER_ORCHESTATOR_HPP
 #define _ROUTER_ORCHESTATOR_HPP
 
+#include <functional>
 #include <list>
 #include <memory>
 #include <shared_mutex>
+#include <vector>
 
 #include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
+#include <base/jsonArena.hpp>
 #include <base/parseEvent.hpp>
+#include <metrics/iMetricsScope.hpp>
 #include <queue/iqueue.hpp>
 #include <store/istore.hpp>
 
 #include <router/iapi.hpp>
+#include <router/rawEvent.hpp>
 #include <router/types.hpp>
 
 namespace router
@@ -24,6 +29,9 @@ using TestQueueType = base::queue::iQueue<test::QueueType>;
 class IWorker;
 class EnvironmentBuilder;
 class EntryConverter;
+class Profiler;
+class SessionLimiter;
+struct LaneOrder;
 
 // Change name to syncronizer
 class Orchestrator
@@ -35,27 +43,60 @@ protected:
     class EpsCounter;                         ///< PIMPL for the EPS counter
     std::shared_ptr<EpsCounter> m_epsCounter; ///< Counter to measure the events per second processed by the router
 
+    class Scaler; ///< PIMPL for the adaptive mode, grows and shrinks the running workers with the load
+
     constexpr static const char* STORE_PATH_TESTER_TABLE = "router/tester/0"; ///< Default path for the tester state
     constexpr static const char* STORE_PATH_ROUTER_TABLE = "router/router/0"; ///< Default path for the router state
     constexpr static const char* STORE_PATH_ROUTER_EPS = "router/eps/0";      ///< Default path for the EPS state
 
     // Workers synchronization
-    std::list<std::shared_ptr<IWorker>> m_workers; ///< List of workers
-    mutable std::shared_mutex m_syncMutex;         ///< Mutex for the Workers synchronization (1 query at a time)
+    std::list<std::shared_ptr<IWorker>> m_workers;     ///< List of workers
+    std::list<std::shared_ptr<IWorker>> m_testWorkers; ///< Tester only workers, empty if m_workers run the tests
+    mutable std::shared_mutex m_syncMutex;             ///< Mutex for the Workers synchronization (1 query at a time)
 
     // Workers configuration
     std::shared_ptr<ProdQueueType> m_eventQueue;      ///< The event queue
+    std::vector<std::shared_ptr<ProdQueueType>> m_eventLanes; ///< Per-worker event queues (sharded mode)
+    std::vector<std::shared_ptr<LaneOrder>> m_laneOrders;     ///< Order lock of each lane (sharded mode)
+    std::shared_ptr<json::ArenaPool> m_eventArenas;           ///< Arenas for the parsed events (optional)
+    std::shared_ptr<RawQueueType> m_rawQueue;                 ///< Events parsed by the workers (optional)
+    std::shared_ptr<RawEventPool> m_rawPool;                  ///< Buffers of the raw events, if m_rawQueue is set
     std::shared_ptr<TestQueueType> m_testQueue;       ///< The test queue
     std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< The environment builder
+    std::shared_ptr<Profiler> m_profiler;             ///< Last activated profiler, kept for its report
 
     // Configuration options
     std::weak_ptr<store::IStoreInternal> m_wStore; ///< Read and store configurations
     base::Name m_storeTesterName;                  ///< Path of internal configuration state for testers
     base::Name m_storeRouterName;                  ///< Path of internal configuration state for routers
     std::size_t m_testTimeout;                     ///< Timeout for the tests
+    std::size_t m_batchSize {1};                   ///< Max number of events dequeued at once by each worker
+    std::function<bool()> m_epsLimit;              ///< EPS limiter of the workers, copied by each started worker
+    std::shared_ptr<SessionLimiter> m_testSessions; ///< Tests in flight per session, nullptr for no limit
 
     using WorkerOp = std::function<base::OptError(const std::shared_ptr<IWorker>&)>;
     base::OptError forEachWorker(const WorkerOp& f); ///< Apply the function f to each worker
+    base::OptError forEachTester(const WorkerOp& f); ///< Apply the function f to each worker that runs tests
+
+    /**
+     * @brief Get the workers that run the tests, the tester only ones if there are any
+     */
+    const std::list<std::shared_ptr<IWorker>>& testers() const
+    {
+        return m_testWorkers.empty() ? m_workers : m_testWorkers;
+    }
+
+    /**
+     * @brief Push a test to the test queue, if its session has a free slot
+     *
+     * @param event The event to test
+     * @param opt The test options
+     * @param callbackFn Called by the tester with the output
+     * @return base::OptError The error if the session has too many tests in flight or the queue is full
+     */
+    base::OptError pushTest(base::Event&& event,
+                            const test::Options& opt,
+                            std::function<void(base::RespOrError<test::Output>&&)> callbackFn);
 
     void dumpTesters() const;                                                ///< Dump the testers to the store
     void dumpRouters() const;                                                ///< Dump the routers to the store
@@ -74,13 +115,39 @@ protected:
                               const std::vector<EntryConverter>& routerEntries,
                               const std::vector<EntryConverter>& testerEntries);
 
+    /**
+     * @brief Get the queue where the event must be pushed
+     *
+     * In sharded mode the lane is selected by the event location (which includes the agent ID), so all the events
+     * of the same agent are processed in order by the same worker. Otherwise the shared event queue is returned.
+     *
+     * @param event The event to push
+     * @return const std::shared_ptr<ProdQueueType>& The selected queue
+     */
+    const std::shared_ptr<ProdQueueType>& selectQueue(const base::Event& event) const;
+
+    /**
+     * @brief Get the index of the lane where the event must be pushed, 0 if there are no lanes
+     */
+    std::size_t selectLane(const base::Event& event) const;
+
     base::OptError addWorker(std::shared_ptr<IWorker> worker); ///< Add a new worker to the list
     base::OptError removeWorker();                             ///< Remove a worker from the list
 
+    /**
+     * @brief Sample the load and start or stop one worker if the autoscaler decides so, in adaptive mode
+     *
+     * The running workers are the first ones of the list, so a worker is started after the last running one and the
+     * last running one is stopped.
+     */
+    void scale();
+
+    std::unique_ptr<Scaler> m_scaler; ///< Adaptive mode state, nullptr if all the workers always run. Destroyed first
+
     Orchestrator() = default; ///< Default constructor for testing purposes
 
 public:
-    ~Orchestrator() = default;
+    ~Orchestrator();
     /**
      * @brief Configuration for the Orchestrator
      *
@@ -93,11 +160,86 @@ public:
         std::weak_ptr<builder::IBuilder> m_builder; ///< Builder use for creating environments
 
         std::shared_ptr<bk::IControllerMaker> m_controllerMaker; ///< Controller maker for creating controllers
-        std::shared_ptr<ProdQueueType> m_prodQueue;              ///< The event queue
+        std::shared_ptr<ProdQueueType> m_prodQueue;              ///< The event queue, unused with m_prodLanes
         std::shared_ptr<TestQueueType> m_testQueue;              ///< The test queue
 
         int m_testTimeout; ///< Timeout for handlers of testers
 
+        int m_batchSize {1}; ///< Max number of events dequeued at once by each worker
+
+        /**
+         * @brief Per-worker event queues (lanes), empty to share m_prodQueue between all the workers.
+         *
+         * If not empty, it must contain exactly m_numThreads queues. The events of an agent always go to the same lane.
+         * Workers steal from the backlogged lanes when their own lane is idle, one batch of a lane at a time so the
+         * events of the lane are still ingested in order.
+         */
+        std::vector<std::shared_ptr<ProdQueueType>> m_prodLanes {};
+
+        std::shared_ptr<json::ArenaPool> m_eventArenas {}; ///< Arenas for the parsed events, nullptr to disable
+
+        /**
+         * @brief Queue of the events as received, nullptr to parse the events when they are pushed.
+         *
+         * Otherwise the pushed events are only copied to a pooled buffer and queued, and the workers parse them, so
+         * the parsing scales with the workers instead of running on the endpoint thread. The m_prodQueue only gets
+         * the events given back by the stopped workers. Ignored, with a warning, if m_prodLanes is set.
+         */
+        std::shared_ptr<RawQueueType> m_rawQueue {};
+
+        /**
+         * @brief Build each route once and share it between all the workers, if its backend is thread-safe.
+         *
+         * Otherwise every worker builds its own copy of each route.
+         */
+        bool m_shareEnvironments {false};
+
+        /**
+         * @brief Place the workers on the NUMA nodes of the host.
+         *
+         * The workers are split in contiguous blocks, one per node, and each one runs on the CPUs of its node. The
+         * workers of a node are built on that node and get their own replica of the shared environments, and in
+         * sharded mode they steal from the lanes of the same node first. Ignored if the host has a single node.
+         */
+        bool m_numaAware {false};
+
+        /**
+         * @brief Workers always running, 0 to run all the m_numThreads workers.
+         *
+         * Otherwise the router starts with m_minThreads workers and starts or stops workers, up to m_numThreads,
+         * following the depth of the event queue, the time the workers wait on it and the idle CPU of the host.
+         * Not supported with m_prodLanes.
+         */
+        int m_minThreads {0};
+
+        int m_scaleIntervalMs {1000}; ///< Time between two evaluations of the load in adaptive mode
+
+        /**
+         * @brief Workers that only run tests, 0 to run the tests on the production workers.
+         *
+         * Otherwise the production workers never take events from the test queue, and these workers keep their own
+         * environments and only wait on it, so a test session doesn't delay the live events and the other way round.
+         */
+        int m_testThreads {0};
+
+        int m_testSessionLimit {0}; ///< Max tests queued or running per test environment, 0 for no limit
+
+        /**
+         * @brief Window in seconds in which the repeated production events are dropped before routing, 0 to disable.
+         *
+         * The events are compared by the values of m_dedupFields, or as a whole if it is empty.
+         */
+        int m_dedupWindow {0};
+
+        std::vector<std::string> m_dedupFields {}; ///< Fields that identify the repeated events, in dot notation
+
+        /**
+         * @brief Scope of the latency histograms of the stages of each route, nullptr to not time the routes.
+         *
+         * Each route records the time of its filter and of the decode, rules and outputs stages of its policy.
+         */
+        std::shared_ptr<metricsManager::IMetricsScope> m_latencyScope {};
+
         void validate() const; ///< Validate the configuration options if is invalid throw an  std::runtime_error
     };
 
@@ -116,17 +258,23 @@ public:
     void stop();
 
     /**
-     * @brief Push an event to the event queue
+     * @brief Push an event to the event queue, or to the raw queue to be parsed by a worker
      *
      * @param eventStr The event to push
      */
     void pushEvent(const std::string& eventStr)
     {
+        if (m_rawQueue)
+        {
+            m_rawQueue->push(m_rawPool->acquire(eventStr));
+            return;
+        }
+
         base::Event event;
         try
         {
-            event = base::parseEvent::parseWazuhEvent(eventStr);
-            m_eventQueue->push(std::move(event));
+            event = base::parseEvent::parseWazuhEvent(eventStr, m_eventArenas ? m_eventArenas->acquire() : nullptr);
+            selectQueue(event)->push(std::move(event));
         }
         catch (const std::exception& e)
         {
@@ -134,6 +282,23 @@ public:
         }
     }
 
+    /**
+     * @brief Push several events to the event queues
+     *
+     * The events are parsed and grouped by queue, then each group is pushed at once. With a raw queue they are
+     * pushed at once as received.
+     *
+     * @param eventStrs The events to push, the vector is left unchanged
+     */
+    void pushEvents(const std::vector<std::string>& eventStrs);
+
+    /**
+     * @brief Get the number of events waiting in the event queues
+     *
+     * @return std::size_t Approximate number of queued events, the sum of all the lanes in sharded mode
+     */
+    std::size_t queuedEvents() const;
+
     /**************************************************************************
      * IRouterAPI
      *************************************************************************/
@@ -171,7 +336,7 @@ public:
     /**
      * @copydoc router::IRouterAPI::postEvent
      */
-    void postEvent(base::Event&& event) override { m_eventQueue->push(std::move(event)); }
+    void postEvent(base::Event&& event) override { selectQueue(event)->push(std::move(event)); }
 
     /**
      * @copydoc router::IRouterAPI::postStrEvent
@@ -193,6 +358,26 @@ public:
      */
     base::OptError activateEpsCounter(bool activate) override;
 
+    /**
+     * @copydoc router::IRouterAPI::activateProfiler
+     */
+    base::OptError activateProfiler(bool activate, std::size_t sampleRate) override;
+
+    /**
+     * @copydoc router::IRouterAPI::getProfilerReport
+     */
+    base::RespOrError<prof::Report> getProfilerReport(std::size_t top) const override;
+
+    /**
+     * @copydoc router::IRouterAPI::activateTap
+     */
+    base::OptError activateTap(bool activate, double rate, const std::string& field, const std::string& value) override;
+
+    /**
+     * @copydoc router::IRouterAPI::getTapEvents
+     */
+    base::RespOrError<tap::Events> getTapEvents(std::size_t max) override;
+
     /**************************************************************************
      * ITesterAPI
      *************************************************************************/
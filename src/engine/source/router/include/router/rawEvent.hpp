@@ -0,0 +1,103 @@
+#ifndef _ROUTER_RAW_EVENT_HPP
+#define _ROUTER_RAW_EVENT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <queue/iqueue.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Event as received by the endpoint (`<queue>:<location>:<message>`), parsed by the worker that dequeues it
+ */
+class RawEvent
+{
+private:
+    std::string m_bytes; ///< Received bytes, the buffer is kept when the event returns to its pool
+
+public:
+    RawEvent() = default;
+    explicit RawEvent(std::string_view bytes)
+        : m_bytes(bytes)
+    {
+    }
+
+    /**
+     * @brief Replace the bytes, reusing the buffer if it is big enough
+     */
+    void assign(std::string_view bytes) { m_bytes.assign(bytes.data(), bytes.size()); }
+
+    /**
+     * @brief Get the received bytes, also used to flood or spill the event
+     */
+    const std::string& str() const { return m_bytes; }
+
+    /**
+     * @brief Get the size of the buffer
+     */
+    std::size_t capacity() const { return m_bytes.capacity(); }
+};
+
+using RawEventPtr = std::shared_ptr<RawEvent>;
+using RawQueueType = base::queue::iQueue<RawEventPtr>;
+
+/**
+ * @brief Pool of reusable buffers for the raw events
+ *
+ * The endpoint copies each received message to a buffer of the pool, and the buffer goes back to the pool when the
+ * worker that parsed the event releases it, so the steady state does not allocate the message bytes. The pool keeps
+ * at most maxBuffers buffers and drops the ones that grew over maxBufferSize, so a burst of big events does not pin
+ * memory. The events outlive the pool safely, the last ones are just freed.
+ */
+class RawEventPool
+{
+private:
+    struct FreeList
+    {
+        std::mutex m_mutex;                              ///< Protects the buffers
+        std::vector<std::unique_ptr<RawEvent>> m_events; ///< Free buffers, reused last in first out
+        std::size_t m_maxBuffers;                        ///< Max free buffers kept
+        std::size_t m_maxBufferSize;                     ///< Bigger buffers are freed instead of kept
+
+        void release(RawEvent* event);
+    };
+
+    std::shared_ptr<FreeList> m_free; ///< Shared with the released events, which may outlive the pool
+
+public:
+    static constexpr std::size_t DEFAULT_MAX_BUFFERS = 8192;
+    static constexpr std::size_t DEFAULT_MAX_BUFFER_SIZE = 8192;
+
+    /**
+     * @brief Construct a new Raw Event Pool
+     *
+     * @param maxBuffers Max number of free buffers kept
+     * @param maxBufferSize Max size of a kept buffer
+     * @throw std::runtime_error if maxBuffers is 0
+     */
+    explicit RawEventPool(std::size_t maxBuffers = DEFAULT_MAX_BUFFERS,
+                          std::size_t maxBufferSize = DEFAULT_MAX_BUFFER_SIZE);
+
+    /**
+     * @brief Get a raw event with a copy of the bytes, on a free buffer if there is one
+     *
+     * @param bytes Received message
+     * @return RawEventPtr The event, its buffer returns to the pool when the last reference is released
+     */
+    RawEventPtr acquire(std::string_view bytes);
+
+    /**
+     * @brief Get the number of free buffers
+     */
+    std::size_t available() const;
+};
+
+} // namespace router
+
+#endif // _ROUTER_RAW_EVENT_HPP
@@ -32,7 +32,7 @@ public:
     virtual void postEvent(base::Event&& event) = 0;
     virtual base::OptError postStrEvent(std::string_view event) = 0;
 
-    // Orchestrator: Change EPS settings
+    // Orchestrator: Change EPS settings, the refresh interval is stored but the token bucket limiter does not use it
     virtual base::OptError changeEpsSettings(uint eps, uint refreshInterval) = 0;
 
     // Orchestrator: Get EPS info
@@ -40,6 +40,20 @@ public:
 
     // Orchestrator: Activate/Deactivate EPS counter
     virtual base::OptError activateEpsCounter(bool activate) = 0;
+
+    // Orchestrator: Activate/Deactivate the profiler of the routes, timing 1 of each sampleRate invocations
+    virtual base::OptError activateProfiler(bool activate, std::size_t sampleRate) = 0;
+
+    // Orchestrator: Get the top assets and helpers of the profiler, 0 for all
+    virtual base::RespOrError<prof::Report> getProfilerReport(std::size_t top) const = 0;
+
+    // Orchestrator: Activate/Deactivate the tap of the production events, sampling a fraction of the events with the
+    // value in the field (all the events if the field is empty)
+    virtual base::OptError
+    activateTap(bool activate, double rate, const std::string& field, const std::string& value) = 0;
+
+    // Orchestrator: Take the oldest events sampled by the tap, 0 for all
+    virtual base::RespOrError<tap::Events> getTapEvents(std::size_t max) = 0;
 };
 
 class ITesterAPI
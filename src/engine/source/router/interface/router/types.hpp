@@ -7,6 +7,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_set>
+#include <vector>
 
 #include <base/logging.hpp>
 
@@ -51,6 +52,7 @@ private:
     base::Name m_filter;                      ///< Filter of the environment
     std::size_t m_priority;                   ///< Priority of the environment
     std::optional<std::string> m_description; ///< Description of the environment
+    bool m_tee;                               ///< Keep routing the accepted events to the next environments
 
     static constexpr std::size_t MAX_PRIORITY = 1000; ///< Max priority of the environment
 
@@ -71,6 +73,7 @@ public:
         , m_description {}
         , m_filter {std::move(filter)}
         , m_priority {priority}
+        , m_tee {false}
     {
     }
 
@@ -117,6 +120,13 @@ public:
     std::size_t priority() const { return m_priority; }
     void priority(std::size_t priority) { m_priority = priority; }
 
+    /**
+     * @brief A tee environment does not take the events it accepts, they are also offered to the environments with a
+     * lower priority, and each environment that accepts them gets its own copy.
+     */
+    bool tee() const { return m_tee; }
+    void tee(bool tee) { m_tee = tee; }
+
     static std::size_t maxPriority() { return MAX_PRIORITY; }
 };
 
@@ -361,6 +371,52 @@ using QueueType = std::shared_ptr<TestingTuple>;
 
 } // namespace test
 
+/**************************************************************************
+ *                      Profiler types (router)                           *
+ *************************************************************************/
+namespace prof
+{
+/**
+ * @brief Execution statistics of an asset or a helper
+ */
+struct Stats
+{
+    std::string name;      ///< Name of the asset or helper
+    std::uint64_t calls;   ///< Invocations
+    std::uint64_t matches; ///< Successful invocations, for an asset the ones that passed its condition
+    std::uint64_t totalNs; ///< Estimated cumulative execution time, from the sampled invocations
+};
+
+/**
+ * @brief Assets and helpers of the production routes with the highest cumulative time
+ */
+struct Report
+{
+    bool enabled;               ///< Profiler status
+    std::size_t sampleRate;     ///< 1 of each sampleRate invocations is timed
+    std::vector<Stats> assets;  ///< Assets by cumulative time, descending
+    std::vector<Stats> helpers; ///< Helpers by cumulative time, descending
+};
+} // namespace prof
+
+/**************************************************************************
+ *                      Tap types (router)                                *
+ *************************************************************************/
+namespace tap
+{
+/**
+ * @brief Events sampled by the tap of the production routes and its status
+ */
+struct Events
+{
+    bool enabled;                    ///< Tap status
+    double rate;                     ///< Fraction of the events sampled
+    std::vector<std::string> events; ///< Sampled events, oldest first
+    std::uint64_t sampled;           ///< Events sampled since the tap was enabled
+    std::uint64_t dropped;           ///< Sampled events dropped because they were not drained in time
+};
+} // namespace tap
+
 } // namespace router
 
 #endif // _ROUTER_TYPES_HPP
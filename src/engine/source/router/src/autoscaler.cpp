@@ -0,0 +1,101 @@
+#include "autoscaler.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace router
+{
+
+Autoscaler::Autoscaler(const Options& options)
+    : m_options {options}
+{
+    if (m_options.minWorkers < 1 || m_options.minWorkers > m_options.maxWorkers)
+    {
+        throw std::runtime_error {"The autoscaler bounds must satisfy 1 <= minWorkers <= maxWorkers"};
+    }
+    if (m_options.batchSize == 0 || m_options.upTicks == 0 || m_options.downTicks == 0)
+    {
+        throw std::runtime_error {"The autoscaler batch size and ticks must be greater than 0"};
+    }
+    if (m_options.busyLow < 0 || m_options.busyLow >= m_options.busyHigh || m_options.busyHigh > 1)
+    {
+        throw std::runtime_error {"The autoscaler busy thresholds must satisfy 0 <= busyLow < busyHigh <= 1"};
+    }
+}
+
+int Autoscaler::decide(const LoadSample& sample, std::size_t active)
+{
+    // More events than a round of batches of the active workers can take
+    const bool backlog = sample.queued > active * m_options.batchSize;
+    const bool saturated = (backlog || sample.busyRatio > m_options.busyHigh) && !sample.throttled
+                           && sample.cpuIdle >= m_options.minCpuIdle;
+    const bool idle = sample.queued <= m_options.batchSize && sample.busyRatio < m_options.busyLow;
+
+    m_upCount = saturated && active < m_options.maxWorkers ? m_upCount + 1 : 0;
+    m_downCount = idle && active > m_options.minWorkers ? m_downCount + 1 : 0;
+
+    if (m_upCount >= m_options.upTicks)
+    {
+        m_upCount = 0;
+        return 1;
+    }
+    if (m_downCount >= m_options.downTicks)
+    {
+        m_downCount = 0;
+        return -1;
+    }
+    return 0;
+}
+
+CpuSampler::CpuSampler(std::string path)
+    : m_path {std::move(path)}
+{
+    if (auto current = read(); current)
+    {
+        m_lastIdle = current->first;
+        m_lastTotal = current->second;
+    }
+}
+
+std::optional<std::pair<std::uint64_t, std::uint64_t>> CpuSampler::read() const
+{
+    std::ifstream file {m_path};
+    std::string line;
+    if (!file || !std::getline(file, line) || line.rfind("cpu ", 0) != 0)
+    {
+        return std::nullopt;
+    }
+
+    // cpu user nice system idle iowait irq softirq steal ...
+    std::istringstream fields {line.substr(4)};
+    std::uint64_t value {0};
+    std::uint64_t idle {0};
+    std::uint64_t total {0};
+    for (std::size_t i = 0; fields >> value; ++i)
+    {
+        total += value;
+        if (i == 3 || i == 4)
+        {
+            idle += value;
+        }
+    }
+    return std::make_pair(idle, total);
+}
+
+double CpuSampler::idle()
+{
+    auto current = read();
+    if (!current || current->second <= m_lastTotal)
+    {
+        return 1;
+    }
+
+    const auto idle = current->first - m_lastIdle;
+    const auto total = current->second - m_lastTotal;
+    m_lastIdle = current->first;
+    m_lastTotal = current->second;
+    return static_cast<double>(idle) / total;
+}
+
+} // namespace router
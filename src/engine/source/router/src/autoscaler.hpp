@@ -0,0 +1,112 @@
+#ifndef _ROUTER_AUTOSCALER_HPP
+#define _ROUTER_AUTOSCALER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace router
+{
+
+/**
+ * @brief Time spent by a worker ingesting events and waiting on its queue, read by the autoscaler.
+ *
+ * Each worker has its own counters, so the workers do not contend on them.
+ */
+struct alignas(64) WorkerLoad
+{
+    std::atomic<std::uint64_t> busyNs {0}; ///< Time ingesting production events
+    std::atomic<std::uint64_t> idleNs {0}; ///< Time waiting for events on the queue
+};
+
+/**
+ * @brief Load of the router sampled on each tick of the autoscaler
+ */
+struct LoadSample
+{
+    std::size_t queued {0}; ///< Events waiting on the production queue
+    double busyRatio {0};   ///< Fraction of the time the active workers spent ingesting since the last tick
+    double cpuIdle {1};     ///< Fraction of the host CPU left idle since the last tick, 1 if unknown
+    bool throttled {false}; ///< The EPS limit is active, more workers would not ingest more events
+};
+
+/**
+ * @brief Decides when to start or stop a worker of the router.
+ *
+ * A worker is added when the workers are saturated (the queue grows beyond what a round of batches drains, or the
+ * workers are busy most of the time), the host has CPU to spare and the EPS limit is not what holds them back. A
+ * worker is removed when the queue is drained and the workers are mostly waiting on it. The condition must hold for
+ * several consecutive ticks, more to remove than to add, and the counters restart after each change, so the pool
+ * does not oscillate around a threshold.
+ */
+class Autoscaler
+{
+public:
+    struct Options
+    {
+        std::size_t minWorkers {1}; ///< Workers always running
+        std::size_t maxWorkers {1}; ///< Workers running under the highest load
+        std::size_t batchSize {1};  ///< Events dequeued at once by each worker
+        std::size_t upTicks {2};    ///< Consecutive saturated ticks to add a worker
+        std::size_t downTicks {10}; ///< Consecutive idle ticks to remove a worker
+        double busyHigh {0.85};     ///< Busy ratio above which the workers are saturated
+        double busyLow {0.30};      ///< Busy ratio below which the workers are idle
+        double minCpuIdle {0.10};   ///< Host CPU idle below which no worker is added
+    };
+
+private:
+    Options m_options;
+    std::size_t m_upCount {0};   ///< Consecutive saturated ticks
+    std::size_t m_downCount {0}; ///< Consecutive idle ticks
+
+public:
+    /**
+     * @brief Construct a new Autoscaler
+     *
+     * @param options Bounds and thresholds
+     * @throw std::runtime_error if the bounds or thresholds are invalid
+     */
+    explicit Autoscaler(const Options& options);
+
+    /**
+     * @brief Evaluate one tick
+     *
+     * @param sample Load since the last tick
+     * @param active Workers currently running
+     * @return int +1 to start a worker, -1 to stop one, 0 to keep the pool
+     */
+    int decide(const LoadSample& sample, std::size_t active);
+
+    const Options& options() const { return m_options; }
+};
+
+/**
+ * @brief Sampler of the idle time of the host CPU, from /proc/stat
+ */
+class CpuSampler
+{
+private:
+    std::string m_path;
+    std::uint64_t m_lastIdle {0};
+    std::uint64_t m_lastTotal {0};
+
+    /**
+     * @brief Read the idle and total jiffies of all the CPUs, nullopt if the file can't be read
+     */
+    std::optional<std::pair<std::uint64_t, std::uint64_t>> read() const;
+
+public:
+    explicit CpuSampler(std::string path = "/proc/stat");
+
+    /**
+     * @brief Fraction of the CPU time left idle since the last call, 1 if it is unknown
+     */
+    double idle();
+};
+
+} // namespace router
+
+#endif // _ROUTER_AUTOSCALER_HPP
@@ -0,0 +1,161 @@
+#include "dedup.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace router
+{
+
+namespace
+{
+std::int64_t steadyNow()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Finalizer of splitmix64, derives the second hash of the double hashing from the first one
+std::uint64_t mix(std::uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+} // namespace
+
+Dedup::Dedup(const std::vector<std::string>& fields,
+             std::chrono::milliseconds window,
+             std::size_t bits,
+             std::function<std::int64_t()> clock)
+    : m_fields()
+    , m_windowMs {window.count()}
+    , m_words {std::max<std::size_t>(1, (bits + 63) / 64)}
+    , m_clock {clock ? std::move(clock) : std::function<std::int64_t()> {steadyNow}}
+    , m_filters()
+    , m_generation {0}
+    , m_rotateMutex()
+    , m_dropped {0}
+{
+    if (m_windowMs <= 0)
+    {
+        throw std::runtime_error {"The deduplication window must be greater than 0"};
+    }
+
+    for (const auto& field : fields)
+    {
+        m_fields.emplace_back(json::Json::formatJsonPath(field));
+    }
+
+    for (std::size_t i = 0; i < GENERATIONS; ++i)
+    {
+        m_filters[i] = std::make_unique<std::atomic<std::uint64_t>[]>(m_words);
+        clear(i);
+    }
+    m_generation.store(m_clock() / m_windowMs, std::memory_order_relaxed);
+}
+
+void Dedup::clear(std::size_t filter)
+{
+    for (std::size_t i = 0; i < m_words; ++i)
+    {
+        m_filters[filter][i].store(0, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t Dedup::fingerprint(const base::Event& event) const
+{
+    thread_local std::string key;
+    key.clear();
+
+    if (m_fields.empty())
+    {
+        thread_local rapidjson::StringBuffer buffer;
+        key.append(event->str(buffer));
+    }
+    else
+    {
+        // The values are serialized, a string is quoted, so the separator and a missing field can not be confused
+        for (const auto& field : m_fields)
+        {
+            if (auto value = event->str(field))
+            {
+                key.append(value.value());
+            }
+            key.push_back('|');
+        }
+    }
+
+    return static_cast<std::uint64_t>(std::hash<std::string> {}(key));
+}
+
+std::int64_t Dedup::rotate()
+{
+    const auto now = m_clock() / m_windowMs;
+    auto generation = m_generation.load(std::memory_order_acquire);
+    if (now <= generation)
+    {
+        return generation;
+    }
+
+    std::lock_guard lock {m_rotateMutex};
+    generation = m_generation.load(std::memory_order_relaxed);
+    if (now > generation)
+    {
+        // The filter of the new generation is cleared before it is published. If more than one generation passed the
+        // previous one is stale too.
+        clear(static_cast<std::size_t>(now) % GENERATIONS);
+        if (now - generation > 1)
+        {
+            clear(static_cast<std::size_t>(now - 1) % GENERATIONS);
+        }
+        m_generation.store(now, std::memory_order_release);
+        generation = now;
+    }
+
+    return generation;
+}
+
+bool Dedup::isDuplicate(const base::Event& event)
+{
+    if (!event)
+    {
+        return false;
+    }
+
+    const auto generation = rotate();
+    const auto& current = m_filters[static_cast<std::size_t>(generation) % GENERATIONS];
+    const auto& previous = m_filters[static_cast<std::size_t>(generation + GENERATIONS - 1) % GENERATIONS];
+
+    const auto hash = fingerprint(event);
+    const auto step = mix(hash) | 1;
+    const auto bits = m_words * 64;
+
+    std::array<std::size_t, HASHES> positions;
+    bool inCurrent = true;
+    bool inPrevious = true;
+    for (std::size_t i = 0; i < HASHES; ++i)
+    {
+        positions[i] = static_cast<std::size_t>((hash + i * step) % bits);
+        const auto mask = std::uint64_t {1} << (positions[i] % 64);
+        inCurrent = inCurrent && (current[positions[i] / 64].load(std::memory_order_relaxed) & mask) != 0;
+        inPrevious = inPrevious && (previous[positions[i] / 64].load(std::memory_order_relaxed) & mask) != 0;
+    }
+
+    if (inCurrent || inPrevious)
+    {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    for (const auto position : positions)
+    {
+        current[position / 64].fetch_or(std::uint64_t {1} << (position % 64), std::memory_order_relaxed);
+    }
+
+    return false;
+}
+
+} // namespace router
@@ -0,0 +1,85 @@
+#ifndef _ROUTER_DEDUP_HPP
+#define _ROUTER_DEDUP_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+#include <base/json.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Drops the repeated events before routing.
+ *
+ * An event is fingerprinted by the values of the configured fields, or by the whole event if there are none. The
+ * fingerprints of the events let through are kept in Bloom filters, one per generation of the length of the window, and
+ * an event is dropped if its fingerprint is in the current or the previous generation. So a burst of identical events
+ * lets one event through every one or two windows. The filters have a fixed size and are checked and set with atomic
+ * operations, the workers only take a lock when a new generation starts. A false positive drops a unique event, with
+ * the default size and 4 hashes the probability stays under 1e-4 up to ~150k distinct events per window.
+ */
+class Dedup
+{
+private:
+    constexpr static std::size_t GENERATIONS = 3; ///< Current, previous and the next one, cleared before it is used
+    constexpr static std::size_t HASHES = 4;      ///< Bits set per fingerprint
+
+    using Bits = std::unique_ptr<std::atomic<std::uint64_t>[]>;
+
+    std::vector<json::FieldRef> m_fields;      ///< Fields of the fingerprint, empty for the whole event
+    std::int64_t m_windowMs;                   ///< Length of a generation
+    std::size_t m_words;                       ///< 64-bit words of each filter
+    std::function<std::int64_t()> m_clock;     ///< Monotonic time in milliseconds
+    std::array<Bits, GENERATIONS> m_filters;   ///< Filters indexed by generation modulo GENERATIONS
+    std::atomic<std::int64_t> m_generation;    ///< Current generation
+    std::mutex m_rotateMutex;                  ///< Serializes the start of a new generation
+    std::atomic<std::uint64_t> m_dropped;      ///< Events dropped
+
+    std::uint64_t fingerprint(const base::Event& event) const;
+    std::int64_t rotate();
+    void clear(std::size_t filter);
+
+public:
+    constexpr static std::size_t DEFAULT_BITS = std::size_t {1} << 23; ///< Default size of each filter, 1 MiB
+
+    /**
+     * @brief Construct a new Dedup
+     *
+     * @param fields Fields of the fingerprint in dot notation, empty to fingerprint the whole event
+     * @param window Events repeated within the window are dropped, some of them up to twice the window
+     * @param bits Size of each filter, rounded up to a multiple of 64
+     * @param clock Monotonic time in milliseconds, the steady clock by default
+     *
+     * @throws std::runtime_error If the window is not positive
+     */
+    Dedup(const std::vector<std::string>& fields,
+          std::chrono::milliseconds window,
+          std::size_t bits = DEFAULT_BITS,
+          std::function<std::int64_t()> clock = {});
+
+    /**
+     * @brief Check if the event repeats one let through recently, otherwise remember it
+     *
+     * @param event Event to check, it is not modified
+     * @return true if the event is a repetition and must be dropped
+     */
+    bool isDuplicate(const base::Event& event);
+
+    /**
+     * @brief Events dropped since the start
+     */
+    std::uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+};
+
+} // namespace router
+
+#endif // _ROUTER_DEDUP_HPP
@@ -20,6 +20,7 @@ EntryConverter::EntryConverter(const prod::Entry& entry)
     , m_description {entry.description()}
     , m_filter {entry.filter()}
     , m_priority {entry.priority()}
+    , m_tee {entry.tee()}
 {
 }
 
@@ -39,6 +40,7 @@ EntryConverter::EntryConverter(const json::Json& jEntry)
     m_lastUse = jEntry.getInt64(LAST_USE_PATH);
     m_filter = jEntry.getString(FILTER_PATH);
     m_priority = jEntry.getInt64(PRIORITY_PATH);
+    m_tee = jEntry.getBool(TEE_PATH);
 }
 
 const std::string& EntryConverter::name() const
@@ -94,6 +96,11 @@ EntryConverter::operator json::Json() const
         jEntry.setInt64(static_cast<int64_t>(m_priority.value()), PRIORITY_PATH);
     }
 
+    if (m_tee)
+    {
+        jEntry.setBool(m_tee.value(), TEE_PATH);
+    }
+
     return jEntry;
 }
 
@@ -127,6 +134,7 @@ EntryConverter::operator prod::EntryPost() const
     {
         entryPost.description(m_description.value());
     }
+    entryPost.tee(m_tee.value_or(false));
 
     return entryPost;
 }
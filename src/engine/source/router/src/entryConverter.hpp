@@ -47,6 +47,7 @@ private:
     std::optional<int64_t> m_lastUse;
     std::optional<std::string> m_filter;
     std::optional<size_t> m_priority;
+    std::optional<bool> m_tee;
 
     static constexpr auto NAME_PATH = "/name";
     static constexpr auto POLICY_PATH = "/policy";
@@ -55,6 +56,7 @@ private:
     static constexpr auto LAST_USE_PATH = "/lastUse";
     static constexpr auto FILTER_PATH = "/filter";
     static constexpr auto PRIORITY_PATH = "/priority";
+    static constexpr auto TEE_PATH = "/tee";
 };
 
 } // namespace router
@@ -1,5 +1,7 @@
 #include "environment.hpp"
 
+#include <chrono>
+
 namespace
 {
 /**
@@ -89,7 +91,16 @@ namespace router
 
 bool Environment::isAccepted(const base::Event& event) const
 {
-    return evalExpr(m_filter, event);
+    if (!m_filterLatency)
+    {
+        return evalExpr(m_filter, event);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto accepted = evalExpr(m_filter, event);
+    m_filterLatency->recordValue(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+    return accepted;
 }
 
 } // namespace router
@@ -2,22 +2,40 @@
 #define _ROUTER_ENVIRONMENT_HPP
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
 
 #include <bk/icontroller.hpp>
 #include <base/expression.hpp>
+#include <builder/ibuilder.hpp>
+#include <metrics/iMetricsInstruments.hpp>
 
 #include <router/types.hpp>
 
 namespace router
 {
 
+/**
+ * @brief Policy of a route split at the decoders, so the routes with the same decoders can decode an event once
+ */
+struct PolicyStages
+{
+    base::Expression decoders;              ///< Decoders, the same expression for the policies with the same decoders
+    base::Expression postDecoders;          ///< Rules and outputs of the policy
+    std::unordered_set<std::string> assets; ///< Traceable assets of the policy
+};
+
 class Environment
 {
 
 private:
-    base::Expression m_filter;                     ///< Filter of the route
-    std::shared_ptr<bk::IController> m_controller; ///< Controller of the policy
-    std::string m_hash;                            ///< Hash of the current policy (controller)
+    base::Expression m_filter;                                  ///< Filter of the route
+    std::shared_ptr<bk::IController> m_controller;              ///< Controller of the policy
+    std::string m_hash;                                         ///< Hash of the current policy (controller)
+    std::optional<builder::AssetDiscriminator> m_discriminator; ///< Field value required by the filter, if any
+    std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_filterLatency; ///< Time of the filter (ns), may be null
+    std::optional<PolicyStages> m_stages; ///< Policy split at the decoders, empty if it cannot be run in stages
 
     /**
      * @brief Stop the controller
@@ -37,11 +55,17 @@ public:
      *
      * @param filter of the route
      * @param controller of the policy
+     * @param hash of the policy
+     * @param discriminator field value required by the filter, empty if it is unknown
      */
-    Environment(base::Expression&& filter, std::shared_ptr<bk::IController>&& controller, std::string&& hash)
+    Environment(base::Expression&& filter,
+                std::shared_ptr<bk::IController>&& controller,
+                std::string&& hash,
+                std::optional<builder::AssetDiscriminator>&& discriminator = std::nullopt)
         : m_filter {filter}
         , m_controller {controller}
         , m_hash {hash}
+        , m_discriminator {std::move(discriminator)}
     {
         if (!m_controller)
         {
@@ -75,6 +99,25 @@ public:
      */
     void ingest(base::Event&& event) const { m_controller->ingest(std::move(event)); }
 
+    /**
+     * @brief Ingest a batch of events into the environment, in order
+     *
+     * @param events Events to ingest, replaced by the processed events
+     */
+    void ingestBatch(std::vector<base::Event>& events) const { m_controller->ingestBatch(events); }
+
+    /**
+     * @brief Get the controller of the policy
+     *
+     */
+    bk::IController& controller() const { return *m_controller; }
+
+    /**
+     * @brief Check if the environment can ingest events from several workers at once
+     *
+     */
+    bool isThreadSafe() const { return m_controller->isThreadSafe(); }
+
     /**
      * @brief Set a new filter of the environment
      *
@@ -82,6 +125,16 @@ public:
      */
     void setFilter(base::Expression&& filter) { m_filter = std::move(filter); }
 
+    /**
+     * @brief Set the histogram of the time of the filter, null to not time it
+     *
+     * @param histogram
+     */
+    void setFilterLatency(std::shared_ptr<metricsManager::iHistogram<uint64_t>> histogram)
+    {
+        m_filterLatency = std::move(histogram);
+    }
+
     /**
      * @brief Set the Controller object
      *
@@ -95,11 +148,30 @@ public:
         m_controller = std::move(controller);
     }
 
+    /**
+     * @brief Set the stages of the policy, they must run the same expression as the controller
+     *
+     * @param stages
+     */
+    void setStages(PolicyStages&& stages) { m_stages = std::move(stages); }
+
+    /**
+     * @brief Get the stages of the policy, empty if the policy cannot be run in stages
+     *
+     */
+    const std::optional<PolicyStages>& stages() const { return m_stages; }
+
     /**
      * @brief Get hash of the current policy (controller)
      *
      */
     const std::string& hash() const { return m_hash; }
+
+    /**
+     * @brief Get the field value every event accepted by the filter has, the router uses it to index the routes.
+     *
+     */
+    const std::optional<builder::AssetDiscriminator>& discriminator() const { return m_discriminator; }
 };
 } // namespace router
 
@@ -2,13 +2,21 @@
 #define _ROUTER_ENVIRONMENT_BUILD_HPP
 
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
 #include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
 
+#include "dedup.hpp"
 #include "environment.hpp"
+#include "latency.hpp"
+#include "profiler.hpp"
+#include "tap.hpp"
 
 namespace router
 {
@@ -23,6 +31,19 @@ private:
     std::weak_ptr<builder::IBuilder> m_builder;              ///< The builder used to construct the policy and filter.
     std::shared_ptr<bk::IControllerMaker> m_controllerMaker; ///< The controller maker used to construct the controller.
 
+    bool m_shareEnvironments;                                               ///< Share the thread-safe environments
+    std::size_t m_shareDepth;                                               ///< Number of open share scopes
+    std::unordered_map<std::string, std::shared_ptr<Environment>> m_shared; ///< Built in the open scope
+    std::mutex m_sharedMutex;                                               ///< Mutex for the shared environments
+
+    std::shared_ptr<Profiler> m_profiler; ///< Instruments the environments of the routes, null if disabled
+    mutable std::mutex m_profilerMutex;   ///< Mutex for the profiler
+
+    std::shared_ptr<PipelineLatency> m_latency; ///< Times the stages of the routes built from now on, may be null
+
+    std::shared_ptr<Tap> m_tap;     ///< Samples the events of the routers built with this builder
+    std::shared_ptr<Dedup> m_dedup; ///< Drops the repeated events of the routers built with this builder, may be null
+
     /**
      * @brief Get the Expression object for a given filter.
      *
@@ -47,14 +68,45 @@ private:
         return builder->buildAsset(filterName);
     }
 
+    /**
+     * @brief Get the field value required by a filter, used by the router to index the routes.
+     *
+     * @param filterName The name of the filter.
+     * @return std::optional<builder::AssetDiscriminator> The discriminator, empty if the filter has none.
+     */
+    std::optional<builder::AssetDiscriminator> getDiscriminator(const base::Name& filterName)
+    {
+        auto builder = m_builder.lock();
+        if (builder == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        return builder->assetDiscriminator(filterName);
+    }
+
 public:
     /**
      * @brief Create a new EnvironmentBuilder
      *
+     * @param builder The builder used to construct the policy and filter.
+     * @param controllerMaker The controller maker used to construct the controller.
+     * @param shareEnvironments If true, createShared reuses the thread-safe environments built in the same ShareScope.
      */
-    EnvironmentBuilder(std::weak_ptr<builder::IBuilder> builder, std::shared_ptr<bk::IControllerMaker> controllerMaker)
+    EnvironmentBuilder(std::weak_ptr<builder::IBuilder> builder,
+                       std::shared_ptr<bk::IControllerMaker> controllerMaker,
+                       bool shareEnvironments = false)
         : m_builder(std::move(builder))
         , m_controllerMaker(std::move(controllerMaker))
+        , m_shareEnvironments(shareEnvironments)
+        , m_shareDepth(0)
+        , m_shared()
+        , m_sharedMutex()
+        , m_profiler()
+        , m_profilerMutex()
+        , m_latency()
+        , m_tap(std::make_shared<Tap>())
+        , m_dedup()
     {
         if (m_builder.expired() || m_builder.lock() == nullptr)
         {
@@ -73,12 +125,19 @@ public:
      * @brief Get the Controller object for a given policy.
      *
      * @param policyName The name of the policy.
-     * @param builder The builder used to construct the policy.
+     * @param profiler If not null, the controller runs an expression of the policy instrumented by the profiler.
+     * @param route Name of the route, the stages of the policy are timed under it if the latency is enabled.
+     * @param stages If not null, set to the policy split at the decoders when the policy is split and its expression
+     * is not instrumented.
      * @return std::shared_ptr<bk::IController> The constructed controller.
      * @throws std::runtime_error if the policy has no assets or if the backend cannot be built. // TODO Move to
      * base::Error
      */
-    auto makeController(const base::Name& policyName) -> std::pair<std::shared_ptr<bk::IController>, std::string>
+    auto makeController(const base::Name& policyName,
+                        const std::shared_ptr<Profiler>& profiler = nullptr,
+                        const std::string& route = "",
+                        std::optional<PolicyStages>* stages = nullptr)
+        -> std::pair<std::shared_ptr<bk::IController>, std::string>
     {
         if (policyName.parts().size() == 0 || policyName.parts()[0] != "policy")
         {
@@ -103,27 +162,68 @@ public:
                        std::inserter(assetNames, assetNames.begin()),
                        [](const auto& name) { return name.toStr(); });
 
-        auto controller = m_controllerMaker->create(policy->expression(), assetNames);
+        auto expression = profiler ? profiler->instrument(policy->expression()) : policy->expression();
+        const auto timed = m_latency && !route.empty();
+        if (timed)
+        {
+            expression = m_latency->instrument(route, expression);
+        }
+
+        // The stages would run the policy without the instrumentation, the instrumented routes are never split
+        if (stages != nullptr && !profiler && !timed && policy->decoders() && policy->postDecoders())
+        {
+            *stages = PolicyStages {policy->decoders(), policy->postDecoders(), assetNames};
+        }
+
+        auto controller = m_controllerMaker->create(expression, assetNames);
         return {controller, policy->hash()};
     }
 
+    /**
+     * @brief Get a controller that runs a stage of a policy.
+     *
+     * @param expression The expression of the stage.
+     * @param assetNames The traceable assets of the policy.
+     * @return std::shared_ptr<bk::IController> The constructed controller.
+     * @throws std::runtime_error if the backend cannot be built.
+     */
+    std::shared_ptr<bk::IController> makeStageController(const base::Expression& expression,
+                                                         const std::unordered_set<std::string>& assetNames)
+    {
+        return m_controllerMaker->create(expression, assetNames);
+    }
+
     /**
      * @brief Create an environment based on a policy and a filter.
      *
      * @param policyName The name of the policy.
      * @param filterName The name of the filter.
+     * @param route The name of the route, empty if the environment does not belong to a production route.
      * @return Environment The created environment.
      * @throws std::runtime_error if failed to create the environment. // TODO CHange to base::Error
      */
-    std::unique_ptr<Environment> create(const base::Name& policyName, const base::Name& filterName)
+    std::unique_ptr<Environment>
+    create(const base::Name& policyName, const base::Name& filterName, const std::string& route = "")
     {
         std::shared_ptr<bk::IController> controller = nullptr;
         try
         {
             std::string hash {};
-            std::tie(controller, hash) = makeController(policyName);
+            std::optional<PolicyStages> stages {};
+            std::tie(controller, hash) = makeController(policyName, profiler(), route, &stages);
             auto expression = getExpression(filterName);
-            return std::make_unique<Environment>(std::move(expression), std::move(controller), std::move(hash));
+            auto discriminator = getDiscriminator(filterName);
+            auto environment = std::make_unique<Environment>(
+                std::move(expression), std::move(controller), std::move(hash), std::move(discriminator));
+            if (stages)
+            {
+                environment->setStages(std::move(stages.value()));
+            }
+            if (m_latency && !route.empty())
+            {
+                environment->setFilterLatency(m_latency->histogram(route, "Filter"));
+            }
+            return environment;
         }
         catch (const std::runtime_error& e)
         {
@@ -135,6 +235,137 @@ public:
                 "Failed to create environment with policy '{}' and filter '{}': {}", policyName, filterName, e.what())};
         }
     }
+
+    /**
+     * @brief Set the profiler of the environments created from now on, the built environments are not modified.
+     *
+     * @param profiler The profiler, null to create the environments without instrumentation.
+     */
+    void setProfiler(std::shared_ptr<Profiler> profiler)
+    {
+        std::lock_guard lock {m_profilerMutex};
+        m_profiler = std::move(profiler);
+    }
+
+    /**
+     * @brief Get the profiler of the environments, null if disabled.
+     */
+    std::shared_ptr<Profiler> profiler() const
+    {
+        std::lock_guard lock {m_profilerMutex};
+        return m_profiler;
+    }
+
+    /**
+     * @brief Set the latency of the stages of the routes built from now on, the built environments are not modified.
+     *
+     * @param latency The latency, null to not time the routes.
+     */
+    void setLatency(std::shared_ptr<PipelineLatency> latency) { m_latency = std::move(latency); }
+
+    /**
+     * @brief Get the tap of the events, shared by all the routers built with this builder.
+     */
+    const std::shared_ptr<Tap>& tap() const { return m_tap; }
+
+    /**
+     * @brief Set the deduplication of the events, taken by the routers built after the call.
+     *
+     * @param dedup Shared by all the routers, null to disable it
+     */
+    void setDedup(std::shared_ptr<Dedup> dedup) { m_dedup = std::move(dedup); }
+
+    /**
+     * @brief Get the deduplication of the events, null if disabled.
+     */
+    const std::shared_ptr<Dedup>& dedup() const { return m_dedup; }
+
+    /**
+     * @brief Scope in which createShared builds each route only once.
+     *
+     * The orchestrator opens a scope around an operation applied to all the workers (load, post or reload of a route),
+     * so the first worker builds the environment and the others reuse it. The environments are released from the
+     * builder when the last scope is closed, the workers keep them.
+     */
+    class ShareScope
+    {
+    private:
+        EnvironmentBuilder* m_envBuilder;
+
+    public:
+        explicit ShareScope(EnvironmentBuilder& envBuilder)
+            : m_envBuilder(&envBuilder)
+        {
+            std::lock_guard lock {m_envBuilder->m_sharedMutex};
+            ++m_envBuilder->m_shareDepth;
+        }
+
+        ~ShareScope()
+        {
+            std::lock_guard lock {m_envBuilder->m_sharedMutex};
+            if (--m_envBuilder->m_shareDepth == 0)
+            {
+                m_envBuilder->m_shared.clear();
+            }
+        }
+
+        ShareScope(const ShareScope&) = delete;
+        ShareScope& operator=(const ShareScope&) = delete;
+    };
+
+    /**
+     * @brief Open a scope in which the environments are shared between the workers.
+     *
+     * @return ShareScope The scope, it does nothing if the builder does not share environments.
+     */
+    [[nodiscard]] ShareScope shareScope() { return ShareScope {*this}; }
+
+    /**
+     * @brief Create an environment that may be shared between workers.
+     *
+     * Inside a ShareScope, if the builder shares environments, the environment of a route is built once and returned
+     * to every caller as long as its controller is thread-safe. Otherwise it is the same as create.
+     * Callers on different NUMA nodes get their own replica, so the workers of a node never read a route built on
+     * another one.
+     *
+     * @param policyName The name of the policy.
+     * @param filterName The name of the filter.
+     * @param node The NUMA node of the caller, 0 if the workers are not placed per node.
+     * @param route The name of the route, empty if the environment does not belong to a production route.
+     * @return std::shared_ptr<Environment> The created or shared environment.
+     * @throws std::runtime_error if failed to create the environment.
+     */
+    std::shared_ptr<Environment> createShared(const base::Name& policyName,
+                                              const base::Name& filterName,
+                                              std::size_t node = 0,
+                                              const std::string& route = "")
+    {
+        if (!m_shareEnvironments)
+        {
+            return create(policyName, filterName, route);
+        }
+
+        // Workers are loaded one at a time, the build is done under the lock so every worker gets the same one
+        std::lock_guard lock {m_sharedMutex};
+        if (m_shareDepth == 0)
+        {
+            return create(policyName, filterName, route);
+        }
+
+        const auto key = policyName.toStr() + "|" + filterName.toStr() + "|" + std::to_string(node) + "|" + route;
+        if (auto it = m_shared.find(key); it != m_shared.end())
+        {
+            return it->second;
+        }
+
+        std::shared_ptr<Environment> environment = create(policyName, filterName, route);
+        if (environment->isThreadSafe())
+        {
+            m_shared.emplace(key, environment);
+        }
+
+        return environment;
+    }
 };
 
 } // namespace router
@@ -1,8 +1,10 @@
 #ifndef _ROUTER_EPS_COUNTER_HPP
 #define _ROUTER_EPS_COUNTER_HPP
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 
 namespace router
 {
@@ -10,19 +12,29 @@ constexpr auto DEFAULT_EPS = 1000;
 constexpr auto DEFAULT_INTERVAL = 10;
 constexpr auto DEFAULT_STATE = false;
 
+constexpr std::size_t MAX_LOCAL_TOKENS = 128; ///< Max tokens a worker takes at once for its local cache
+
 /**
- * @brief Class to count events per second and reset the counter after a given interval
+ * @brief Token bucket limiter for the events per second
+ *
+ * The bucket is refilled at `eps` tokens per second. It only holds the burst the workers need to fill their local
+ * caches, a tenth of the EPS or a local batch per worker if it is larger (never more than `eps`). In the worst case,
+ * a full bucket drained at once and refilled during the next second, `eps + capacity()` events are admitted in one
+ * second, `1.1 * eps` with up to 10 workers. The tokens are taken in batches with acquire(), so each worker can keep
+ * a local cache and only touch the shared atomics once per batch.
  *
+ * The refresh interval is only kept for the API and the stored settings: the limiter has no window, so it does not
+ * change the admission.
  */
 class Orchestrator::EpsCounter
 {
 private:
-    std::atomic_uint m_count;     ///< Counter for the number of events
-    std::atomic_bool m_canReset;  ///< Flag to ensure only one thread resets the counter
-    std::atomic_uint m_limit;     ///< Limit for the number of events per interval
-    std::atomic_ulong m_interval; ///< Interval windows size in nanoseconds
-    std::chrono::time_point<std::chrono::steady_clock> m_lastReset; ///< Last time the counter was reset
-    std::atomic_bool active;                                        ///< Flag to indicate if the counter is active
+    std::atomic<int64_t> m_tokens;     ///< Available tokens
+    std::atomic<int64_t> m_lastRefill; ///< Last refill time (steady clock, nanoseconds)
+    std::atomic_uint m_eps;            ///< Refill rate, tokens per second
+    std::atomic_uint m_interval;       ///< Refresh interval in seconds, not used by the limiter
+    std::atomic_size_t m_workers;      ///< Workers that cache tokens, sizes the bucket
+    std::atomic_bool active;           ///< Flag to indicate if the counter is active
 
     void checkSettings(uint eps, uint intervalSec)
     {
@@ -37,66 +49,135 @@ private:
         }
     }
 
+    static int64_t nowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /**
+     * @brief Max tokens in the bucket, enough for a local batch of each worker
+     */
+    int64_t capacity() const
+    {
+        const auto eps = static_cast<std::size_t>(m_eps.load(std::memory_order_relaxed));
+        const auto burst = std::max(eps / 10, localBatch() * m_workers.load(std::memory_order_relaxed));
+        return static_cast<int64_t>(std::clamp<std::size_t>(burst, 1, eps));
+    }
+
+    /**
+     * @brief Drop the tokens over the capacity, after the settings change
+     */
+    void shrink()
+    {
+        const auto cap = capacity();
+        auto current = m_tokens.load(std::memory_order_relaxed);
+        while (current > cap
+               && !m_tokens.compare_exchange_weak(current, cap, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * @brief Add the tokens generated since the last refill, only one thread wins the refill
+     */
+    void refill()
+    {
+        const auto now = nowNs();
+        auto last = m_lastRefill.load(std::memory_order_relaxed);
+        const auto elapsed = now - last;
+        const auto eps = static_cast<double>(m_eps.load(std::memory_order_relaxed));
+
+        const auto newTokens = static_cast<int64_t>(elapsed * eps / 1e9);
+        if (newTokens < 1)
+        {
+            return;
+        }
+
+        // Consume only the time used to generate whole tokens, unless the bucket is full
+        const auto cap = capacity();
+        const auto newLast = newTokens >= cap ? now : last + static_cast<int64_t>(newTokens * 1e9 / eps);
+        if (!m_lastRefill.compare_exchange_strong(last, newLast, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        auto current = m_tokens.load(std::memory_order_relaxed);
+        while (!m_tokens.compare_exchange_weak(
+            current, std::min(current + newTokens, cap), std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
 public:
     EpsCounter()
-        : m_count(0)
-        , m_canReset(true)
-        , m_limit(DEFAULT_EPS * DEFAULT_INTERVAL)
-        , m_interval(1e9 * DEFAULT_INTERVAL)
-        , m_lastReset(std::chrono::steady_clock::now())
+        : m_tokens(DEFAULT_EPS)
+        , m_lastRefill(nowNs())
+        , m_eps(DEFAULT_EPS)
+        , m_interval(DEFAULT_INTERVAL)
+        , m_workers(1)
         , active(DEFAULT_STATE)
     {
+        m_tokens.store(capacity(), std::memory_order_relaxed);
     }
 
     /**
      * @brief Construct a new Eps Counter object
      *
      * @param eps Maximum number of events per second
-     * @param intervalSec Interval window size in seconds
+     * @param intervalSec Refresh interval in seconds, kept for the settings, it does not change the admission
      */
     EpsCounter(uint eps, uint intervalSec, bool state)
-        : m_count(0)
-        , m_lastReset(std::chrono::steady_clock::now())
-        , m_canReset(true)
+        : m_tokens(0)
+        , m_lastRefill(nowNs())
+        , m_eps(0)
+        , m_interval(0)
+        , m_workers(1)
         , active(state)
     {
         checkSettings(eps, intervalSec);
-        m_limit.store(eps * intervalSec, std::memory_order_relaxed);
-        m_interval.store(1e9 * intervalSec, std::memory_order_relaxed);
+        m_eps.store(eps, std::memory_order_relaxed);
+        m_interval.store(intervalSec, std::memory_order_relaxed);
+        m_tokens.store(capacity(), std::memory_order_relaxed);
     }
 
-    bool limitReached()
+    /**
+     * @brief Take up to `count` tokens from the bucket
+     *
+     * @param count Number of tokens requested
+     * @return std::size_t Number of tokens taken, 0 if the limit is reached
+     */
+    std::size_t acquire(std::size_t count)
     {
-        // Preemptively check the limit, only then check and reset the counter
-        auto current = m_count.fetch_add(1, std::memory_order_relaxed);
-        if (++current <= m_limit.load(std::memory_order_relaxed))
-        {
-            return false;
-        }
-
-        auto now = std::chrono::steady_clock::now();
-        auto especulativeElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
+        refill();
 
-        if (especulativeElapsedTime >= m_interval.load(std::memory_order_relaxed))
+        auto current = m_tokens.load(std::memory_order_relaxed);
+        while (current > 0)
         {
-            // Ensure only one thread resets the counter
-            bool expected = true;
-            if (m_canReset.compare_exchange_strong(expected, false, std::memory_order_acquire))
+            const auto taken = std::min<int64_t>(current, count);
+            if (m_tokens.compare_exchange_weak(
+                    current, current - taken, std::memory_order_acquire, std::memory_order_relaxed))
             {
-                auto realElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
-                if (realElapsedTime >= m_interval.load(std::memory_order_relaxed))
-                {
-                    m_lastReset = now;
-                    m_count.store(0, std::memory_order_relaxed);
-                }
-
-                m_canReset.store(true, std::memory_order_release);
+                return taken;
             }
         }
 
-        return true;
+        return 0;
     }
 
+    /**
+     * @brief Number of tokens a worker should cache locally on each acquire
+     *
+     * A hundredth of the EPS, so the tokens cached by idle workers do not starve the others.
+     */
+    std::size_t localBatch() const
+    {
+        return std::clamp<std::size_t>(m_eps.load(std::memory_order_relaxed) / 100, 1, MAX_LOCAL_TOKENS);
+    }
+
+    bool limitReached() { return acquire(1) == 0; }
+
     void stop() { active.store(false, std::memory_order_relaxed); }
 
     void start() { active.store(true, std::memory_order_relaxed); }
@@ -107,15 +188,26 @@ public:
     {
         checkSettings(eps, intervalSec);
 
-        m_limit.store(eps * intervalSec, std::memory_order_relaxed);
-        m_interval.store(1e9 * intervalSec, std::memory_order_relaxed);
+        m_eps.store(eps, std::memory_order_relaxed);
+        m_interval.store(intervalSec, std::memory_order_relaxed);
+
+        // Do not keep more tokens than the new capacity
+        shrink();
     }
 
-    uint getEps() const
+    /**
+     * @brief Set the number of workers that take tokens, the bucket holds a local batch for each one
+     *
+     * @param workers Number of workers, at least 1
+     */
+    void setWorkers(std::size_t workers)
     {
-        return m_limit.load(std::memory_order_relaxed) / (m_interval.load(std::memory_order_relaxed) / 1e9);
+        m_workers.store(std::max<std::size_t>(workers, 1), std::memory_order_relaxed);
+        shrink();
     }
-    uint getRefreshInterval() const { return m_interval.load(std::memory_order_relaxed) / 1e9; }
+
+    uint getEps() const { return m_eps.load(std::memory_order_relaxed); }
+    uint getRefreshInterval() const { return m_interval.load(std::memory_order_relaxed); }
 };
 } // namespace router
 
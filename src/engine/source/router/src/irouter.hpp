@@ -4,6 +4,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <router/types.hpp>
 
@@ -81,6 +82,22 @@ public:
      * @param event The event to be ingested.
      */
     virtual void ingest(base::Event&& event) = 0;
+
+    /**
+     * @brief Ingest a batch of events into the router, in order.
+     *
+     * The default implementation ingests the events one by one, routers can override it to hand the events of each
+     * route to its environment at once.
+     * @param events The events to be ingested, the vector is left empty.
+     */
+    virtual void ingestBatch(std::vector<base::Event>& events)
+    {
+        for (auto& event : events)
+        {
+            ingest(std::move(event));
+        }
+        events.clear();
+    }
 };
 
 } // namespace router
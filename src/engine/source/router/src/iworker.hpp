@@ -19,7 +19,8 @@ public:
     /**
      * @brief Start the worker
      *
-     * @param epsCounter The counter to measure the events per second
+     * @param epsLimit Returns true if the event can't be processed due to the EPS limit. The worker keeps its own copy,
+     * so it may hold per-worker state.
      */
     virtual void start(const EpsLimit& epsLimit) = 0;
 
@@ -0,0 +1,101 @@
+#include "latency.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+namespace router
+{
+
+namespace
+{
+constexpr auto MARK_NAME = "PipelineLatency";
+
+/**
+ * @brief Last mark of the calling thread, the event it was run for and when.
+ */
+struct Mark
+{
+    const void* event {nullptr};
+    std::chrono::steady_clock::time_point time {};
+};
+
+thread_local Mark lastMark {};
+
+/**
+ * @brief Term that records the time since the last mark of the same event into a histogram, and marks the event.
+ *
+ * @param histogram Histogram of the stage that ends at the mark, null for the mark before the first stage
+ */
+base::Expression makeMark(std::shared_ptr<metricsManager::iHistogram<uint64_t>> histogram)
+{
+    return base::Term<base::EngineOp>::create(
+        MARK_NAME,
+        [histogram = std::move(histogram)](base::Event event)
+        {
+            const auto now = std::chrono::steady_clock::now();
+            if (histogram && lastMark.event == event.get())
+            {
+                histogram->recordValue(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastMark.time).count()));
+            }
+            lastMark = {event.get(), now};
+            return base::result::makeSuccess(std::move(event));
+        });
+}
+} // namespace
+
+PipelineLatency::PipelineLatency(std::shared_ptr<metricsManager::IMetricsScope> scope)
+    : m_scope {std::move(scope)}
+{
+    if (!m_scope)
+    {
+        throw std::runtime_error {"The metrics scope of the pipeline latency cannot be null"};
+    }
+}
+
+std::shared_ptr<metricsManager::iHistogram<uint64_t>> PipelineLatency::histogram(const std::string& route,
+                                                                                 const std::string& stage)
+{
+    return m_scope->getLatencyHistogram(route + "." + stage);
+}
+
+std::string PipelineLatency::stageName(const std::string& operandName)
+{
+    if (operandName == "decoderInput")
+    {
+        return "Decode";
+    }
+    if (operandName == "ruleInput")
+    {
+        return "Rules";
+    }
+    if (operandName == "outputInput")
+    {
+        return "Outputs";
+    }
+    return operandName;
+}
+
+base::Expression PipelineLatency::instrument(const std::string& route, const base::Expression& expression)
+{
+    if (!expression || !expression->isChain())
+    {
+        return expression;
+    }
+
+    // The chain evaluates all its operands whatever their result, the marks do not change the result of the policy
+    const auto& stages = expression->getPtr<base::Operation>()->getOperands();
+    std::vector<base::Expression> timed;
+    timed.reserve(stages.size() * 2 + 1);
+    timed.emplace_back(makeMark(nullptr));
+    for (const auto& stage : stages)
+    {
+        timed.emplace_back(stage);
+        timed.emplace_back(makeMark(histogram(route, stageName(stage->getName()))));
+    }
+
+    return base::Chain::create(expression->getName(), std::move(timed));
+}
+
+} // namespace router
@@ -0,0 +1,66 @@
+#ifndef _ROUTER_LATENCY_HPP
+#define _ROUTER_LATENCY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <base/expression.hpp>
+#include <metrics/iMetricsScope.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Latency of the stages of the production routes, recorded in latency histograms (ns) of a metrics scope.
+ *
+ * The histograms of a route are named "<route>.<stage>": Filter for the filter of the route, and Decode, Rules and
+ * Outputs for the stages of its policy. The stages are timed by terms inserted between the stages of a copy of the
+ * policy expression, so the backends need no changes. Each term records the time since the previous one if it ran
+ * for the same event on the same thread.
+ */
+class PipelineLatency
+{
+private:
+    std::shared_ptr<metricsManager::IMetricsScope> m_scope;
+
+public:
+    /**
+     * @brief Construct a new Pipeline Latency
+     *
+     * @param scope Scope of the histograms
+     * @throw std::runtime_error if the scope is null
+     */
+    explicit PipelineLatency(std::shared_ptr<metricsManager::IMetricsScope> scope);
+
+    /**
+     * @brief Get the histogram of a stage of a route
+     *
+     * @param route Name of the route
+     * @param stage Name of the stage
+     * @return std::shared_ptr<metricsManager::iHistogram<uint64_t>> The histogram, created on first use
+     */
+    std::shared_ptr<metricsManager::iHistogram<uint64_t>> histogram(const std::string& route,
+                                                                    const std::string& stage);
+
+    /**
+     * @brief Get a copy of a policy expression that times its stages, the expression is not modified.
+     *
+     * @param route Name of the route of the policy
+     * @param expression Expression of the policy, a chain of the stages
+     * @return base::Expression The timed expression, the same expression if it is not a chain of stages
+     */
+    base::Expression instrument(const std::string& route, const base::Expression& expression);
+
+    /**
+     * @brief Name of the stage of an operand of the policy expression
+     *
+     * @param operandName Name of the operand, the input of the subgraph of an asset type
+     * @return std::string Name of the stage
+     */
+    static std::string stageName(const std::string& operandName);
+};
+
+} // namespace router
+
+#endif // _ROUTER_LATENCY_HPP
@@ -0,0 +1,143 @@
+#include "numa.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace router::numa
+{
+
+namespace
+{
+int parseCpu(std::string_view text, std::string_view list)
+{
+    int cpu {-1};
+    const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), cpu);
+    if (ec != std::errc {} || ptr != text.data() + text.size() || cpu < 0)
+    {
+        throw std::runtime_error {"Invalid CPU list: '" + std::string {list} + "'"};
+    }
+    return cpu;
+}
+} // namespace
+
+std::vector<int> parseCpuList(std::string_view list)
+{
+    std::vector<int> cpus {};
+
+    // The kernel ends the files with a newline
+    while (!list.empty() && (list.back() == '\n' || list.back() == ' '))
+    {
+        list.remove_suffix(1);
+    }
+
+    std::size_t start {0};
+    while (start < list.size())
+    {
+        auto end = list.find(',', start);
+        if (end == std::string_view::npos)
+        {
+            end = list.size();
+        }
+        const auto range = list.substr(start, end - start);
+
+        if (const auto dash = range.find('-'); dash != std::string_view::npos)
+        {
+            const auto first = parseCpu(range.substr(0, dash), list);
+            const auto last = parseCpu(range.substr(dash + 1), list);
+            if (last < first)
+            {
+                throw std::runtime_error {"Invalid CPU list: '" + std::string {list} + "'"};
+            }
+            for (auto cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.emplace_back(cpu);
+            }
+        }
+        else
+        {
+            cpus.emplace_back(parseCpu(range, list));
+        }
+
+        start = end + 1;
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::vector<Node> nodes(const std::string& path)
+{
+    std::vector<Node> result {};
+    std::error_code ec;
+
+    for (const auto& entry : std::filesystem::directory_iterator(path, ec))
+    {
+        const auto name = entry.path().filename().string();
+        if (name.rfind("node", 0) != 0 || name.size() == 4)
+        {
+            continue;
+        }
+
+        Node node {};
+        const auto idText = std::string_view {name}.substr(4);
+        const auto [ptr, idEc] = std::from_chars(idText.data(), idText.data() + idText.size(), node.id);
+        if (idEc != std::errc {} || ptr != idText.data() + idText.size())
+        {
+            continue;
+        }
+
+        std::ifstream file {entry.path() / "cpulist"};
+        std::string list {};
+        if (!std::getline(file, list))
+        {
+            continue;
+        }
+
+        try
+        {
+            node.cpus = parseCpuList(list);
+        }
+        catch (const std::runtime_error&)
+        {
+            continue;
+        }
+
+        // Memory only nodes have no CPUs to run the workers
+        if (!node.cpus.empty())
+        {
+            result.emplace_back(std::move(node));
+        }
+    }
+
+    std::sort(result.begin(), result.end(), [](const Node& a, const Node& b) { return a.id < b.id; });
+    return result;
+}
+
+bool pinThread(const std::vector<int>& cpus)
+{
+    if (cpus.empty())
+    {
+        return true;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto cpu : cpus)
+    {
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+} // namespace router::numa
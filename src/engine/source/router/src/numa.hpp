@@ -0,0 +1,63 @@
+#ifndef _ROUTER_NUMA_HPP
+#define _ROUTER_NUMA_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace router::numa
+{
+
+constexpr auto SYSFS_NODES_PATH = "/sys/devices/system/node"; ///< Where the kernel lists the NUMA nodes
+
+/**
+ * @brief A NUMA node of the host and the CPUs it owns
+ */
+struct Node
+{
+    std::size_t id {0};     ///< Node number, as in nodeN
+    std::vector<int> cpus;  ///< Online CPUs of the node
+};
+
+/**
+ * @brief Parse a kernel CPU list, like "0-3,8,10-11"
+ *
+ * @param list The CPU list
+ * @return std::vector<int> The CPUs in ascending order
+ * @throw std::runtime_error if the list is malformed
+ */
+std::vector<int> parseCpuList(std::string_view list);
+
+/**
+ * @brief Read the NUMA nodes of the host
+ *
+ * @param path Directory with the nodeN entries
+ * @return std::vector<Node> The nodes with CPUs, sorted by id. Empty if the topology is not available
+ */
+std::vector<Node> nodes(const std::string& path = SYSFS_NODES_PATH);
+
+/**
+ * @brief Get the node of a worker, the workers are spread in contiguous blocks so neighbours share a node
+ *
+ * @param worker Index of the worker
+ * @param workers Number of workers
+ * @param nodes Number of nodes
+ * @return std::size_t Index of the node in the list of nodes
+ */
+inline std::size_t nodeOf(std::size_t worker, std::size_t workers, std::size_t nodes)
+{
+    return workers == 0 || nodes == 0 ? 0 : worker * nodes / workers;
+}
+
+/**
+ * @brief Restrict the calling thread to the given CPUs
+ *
+ * @param cpus The CPUs, nothing is done if empty
+ * @return true if the affinity was set or there was nothing to set
+ */
+bool pinThread(const std::vector<int>& cpus);
+
+} // namespace router::numa
+
+#endif // _ROUTER_NUMA_HPP
@@ -1,7 +1,19 @@
 #include <router/orchestrator.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <string_view>
+#include <thread>
+
+#include "autoscaler.hpp"
+#include "dedup.hpp"
 #include "entryConverter.hpp"
 #include "epsCounter.hpp"
+#include "latency.hpp"
+#include "numa.hpp"
+#include "profiler.hpp"
+#include "sessionLimiter.hpp"
 #include "worker.hpp"
 
 namespace router
@@ -25,6 +37,93 @@ void validatePointer(const T& ptr, const std::string& name)
 }
 } // namespace
 
+/**
+ * @brief State of the adaptive mode: the autoscaler, the load of the workers and the thread that evaluates it
+ */
+class Orchestrator::Scaler
+{
+public:
+    Autoscaler autoscaler;                          ///< Decides when to start or stop a worker
+    CpuSampler cpu;                                 ///< Idle time of the host
+    std::chrono::milliseconds interval;             ///< Time between two ticks
+    std::vector<std::shared_ptr<WorkerLoad>> loads; ///< Load of all the workers, running or not
+    std::size_t active {0};                         ///< Running workers, the first ones of m_workers
+    std::uint64_t lastBusyNs {0};                   ///< Busy time of all the workers on the last tick
+    std::uint64_t lastIdleNs {0};                   ///< Idle time of all the workers on the last tick
+
+    Scaler(const Autoscaler::Options& options, std::chrono::milliseconds interval)
+        : autoscaler {options}
+        , interval {interval}
+        , active {options.minWorkers}
+    {
+    }
+
+    ~Scaler() { stop(); }
+
+    /**
+     * @brief Fraction of the time the workers were ingesting since the last call
+     */
+    double busyRatio()
+    {
+        std::uint64_t busyNs {0};
+        std::uint64_t idleNs {0};
+        for (const auto& load : loads)
+        {
+            busyNs += load->busyNs.load(std::memory_order_relaxed);
+            idleNs += load->idleNs.load(std::memory_order_relaxed);
+        }
+
+        const auto busy = busyNs - lastBusyNs;
+        const auto total = busy + idleNs - lastIdleNs;
+        lastBusyNs = busyNs;
+        lastIdleNs = idleNs;
+        return total == 0 ? 0 : static_cast<double>(busy) / total;
+    }
+
+    /**
+     * @brief Run the tick function every interval until stop is called
+     */
+    void start(std::function<void()> tick)
+    {
+        std::lock_guard lock {m_mutex};
+        if (m_running)
+        {
+            return;
+        }
+        m_running = true;
+        m_thread = std::thread(
+            [this, tick = std::move(tick)]()
+            {
+                std::unique_lock lock {m_mutex};
+                while (!m_cv.wait_for(lock, interval, [this]() { return !m_running; }))
+                {
+                    lock.unlock();
+                    tick();
+                    lock.lock();
+                }
+            });
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard lock {m_mutex};
+            m_running = false;
+        }
+        m_cv.notify_all();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+private:
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_running {false};
+};
+
 // Private
 base::OptError Orchestrator::forEachWorker(const WorkerOp& f)
 {
@@ -38,6 +137,18 @@ base::OptError Orchestrator::forEachWorker(const WorkerOp& f)
     return std::nullopt;
 }
 
+base::OptError Orchestrator::forEachTester(const WorkerOp& f)
+{
+    for (const auto& worker : testers())
+    {
+        if (auto error = f(worker); error)
+        {
+            return error;
+        }
+    }
+    return std::nullopt;
+}
+
 /**************************************************************************
  * Manage configuration - Dump
  *************************************************************************/
@@ -85,7 +196,7 @@ void saveConfig(const std::weak_ptr<store::IStoreInternal>& wStore, const base::
 
 void Orchestrator::dumpTesters() const
 {
-    auto jDump = EntryConverter::toJsonArray(m_workers.front()->getTester()->getEntries());
+    auto jDump = EntryConverter::toJsonArray(testers().front()->getTester()->getEntries());
     saveConfig(m_wStore, m_storeTesterName, jDump);
 }
 
@@ -207,12 +318,142 @@ void Orchestrator::Options::validate() const
     validatePointer(m_wStore, "store");
     validatePointer(m_builder, "builder");
     validatePointer(m_controllerMaker, "controllerMaker");
-    validatePointer(m_prodQueue, "prodQueue");
+    if (m_prodLanes.empty())
+    {
+        validatePointer(m_prodQueue, "prodQueue");
+    }
     validatePointer(m_testQueue, "testQueue");
     if (m_testTimeout < 1)
     {
         throw std::runtime_error {"Configuration error: testTimeout must be greater than 0"};
     }
+    if (!m_prodLanes.empty())
+    {
+        if (m_prodLanes.size() != static_cast<std::size_t>(m_numThreads))
+        {
+            throw std::runtime_error {"Configuration error: the number of prodLanes must be equal to numThreads"};
+        }
+        for (const auto& lane : m_prodLanes)
+        {
+            validatePointer(lane, "prodLane");
+        }
+    }
+    if (m_batchSize < 1 || m_batchSize > 4096)
+    {
+        throw std::runtime_error {"Configuration error: batchSize must be between 1 and 4096"};
+    }
+    if (m_dedupWindow < 0)
+    {
+        throw std::runtime_error {"Configuration error: dedupWindow must be greater than or equal to 0"};
+    }
+    if (m_minThreads < 0 || m_minThreads > m_numThreads)
+    {
+        throw std::runtime_error {"Configuration error: minThreads must be between 0 and numThreads"};
+    }
+    if (m_minThreads > 0)
+    {
+        if (!m_prodLanes.empty())
+        {
+            throw std::runtime_error {"Configuration error: minThreads is not supported with prodLanes"};
+        }
+        if (m_scaleIntervalMs < 1)
+        {
+            throw std::runtime_error {"Configuration error: scaleInterval must be greater than 0"};
+        }
+    }
+    if (m_testThreads < 0 || m_testThreads > 128)
+    {
+        throw std::runtime_error {"Configuration error: testThreads must be between 0 and 128"};
+    }
+    if (m_testSessionLimit < 0)
+    {
+        throw std::runtime_error {"Configuration error: testSessionLimit cannot be negative"};
+    }
+}
+
+const std::shared_ptr<ProdQueueType>& Orchestrator::selectQueue(const base::Event& event) const
+{
+    if (m_eventLanes.empty())
+    {
+        return m_eventQueue;
+    }
+
+    return m_eventLanes[selectLane(event)];
+}
+
+std::size_t Orchestrator::selectLane(const base::Event& event) const
+{
+    if (m_eventLanes.empty())
+    {
+        return 0;
+    }
+
+    // The location of the agent events starts with the agent id, "[001] (name) ip->path", the rest of the location
+    // changes with the log file or the module, so only the id is hashed to keep all the events of an agent in order.
+    // The events of the manager have no id, they all go to the same lane.
+    std::string_view key {};
+    const auto location = event ? event->getString(base::parseEvent::EVENT_LOCATION_ID) : std::nullopt;
+    if (location && !location->empty() && location->front() == '[')
+    {
+        const auto end = location->find(']');
+        key = std::string_view {*location}.substr(0, end == std::string::npos ? location->size() : end + 1);
+    }
+
+    return std::hash<std::string_view> {}(key) % m_eventLanes.size();
+}
+
+void Orchestrator::pushEvents(const std::vector<std::string>& eventStrs)
+{
+    if (m_rawQueue)
+    {
+        std::vector<RawEventPtr> rawEvents;
+        rawEvents.reserve(eventStrs.size());
+        for (const auto& eventStr : eventStrs)
+        {
+            rawEvents.emplace_back(m_rawPool->acquire(eventStr));
+        }
+        m_rawQueue->pushBulk(rawEvents);
+        return;
+    }
+
+    // One batch per queue, each one keeps the order of its events
+    std::vector<std::vector<base::Event>> batches(m_eventLanes.empty() ? 1 : m_eventLanes.size());
+    for (const auto& eventStr : eventStrs)
+    {
+        try
+        {
+            auto event =
+                base::parseEvent::parseWazuhEvent(eventStr, m_eventArenas ? m_eventArenas->acquire() : nullptr);
+            batches[selectLane(event)].push_back(std::move(event));
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Error parsing event: '{}' (discarding...)", e.what());
+        }
+    }
+
+    for (std::size_t lane = 0; lane < batches.size(); ++lane)
+    {
+        if (!batches[lane].empty())
+        {
+            (m_eventLanes.empty() ? m_eventQueue : m_eventLanes[lane])->pushBulk(batches[lane]);
+        }
+    }
+}
+
+std::size_t Orchestrator::queuedEvents() const
+{
+    if (m_eventLanes.empty())
+    {
+        return m_eventQueue->size() + (m_rawQueue ? m_rawQueue->size() : 0);
+    }
+
+    std::size_t queued {0};
+    for (const auto& lane : m_eventLanes)
+    {
+        queued += lane->size();
+    }
+    return queued;
 }
 
 base::OptError Orchestrator::addWorker(std::shared_ptr<IWorker> worker)
@@ -244,6 +485,10 @@ Orchestrator::Orchestrator(const Options& opt)
     : m_workers()
     , m_eventQueue(opt.m_prodQueue)
     , m_testQueue(opt.m_testQueue)
+    , m_eventLanes(opt.m_prodLanes)
+    , m_eventArenas(opt.m_eventArenas)
+    , m_rawQueue(opt.m_prodLanes.empty() ? opt.m_rawQueue : nullptr)
+    , m_rawPool(m_rawQueue ? std::make_shared<RawEventPool>() : nullptr)
     , m_envBuilder()
     , m_syncMutex()
     , m_storeTesterName(STORE_PATH_TESTER_TABLE)
@@ -251,9 +496,29 @@ Orchestrator::Orchestrator(const Options& opt)
 {
     opt.validate();
 
-    m_envBuilder = std::make_shared<EnvironmentBuilder>(opt.m_builder, opt.m_controllerMaker);
+    if (opt.m_rawQueue && !opt.m_prodLanes.empty())
+    {
+        // The lanes are picked by the parsed fields of the events
+        LOG_WARNING("Router: The raw event queue is ignored with the sharded queues.");
+    }
+
+    m_envBuilder =
+        std::make_shared<EnvironmentBuilder>(opt.m_builder, opt.m_controllerMaker, opt.m_shareEnvironments);
+    if (opt.m_dedupWindow > 0)
+    {
+        m_envBuilder->setDedup(std::make_shared<Dedup>(opt.m_dedupFields, std::chrono::seconds {opt.m_dedupWindow}));
+    }
+    if (opt.m_latencyScope)
+    {
+        m_envBuilder->setLatency(std::make_shared<PipelineLatency>(opt.m_latencyScope));
+    }
     m_testTimeout = opt.m_testTimeout;
+    m_batchSize = opt.m_batchSize;
     m_wStore = opt.m_wStore;
+    if (opt.m_testSessionLimit > 0)
+    {
+        m_testSessions = std::make_shared<SessionLimiter>(opt.m_testSessionLimit);
+    }
 
     // Get the initial states from the store
     auto store = m_wStore.lock();
@@ -265,48 +530,278 @@ Orchestrator::Orchestrator(const Options& opt)
     auto routerEntries = getEntriesFromStore(store, m_storeRouterName);
     auto testerEntries = getEntriesFromStore(store, m_storeTesterName);
 
-    // Create the workers
-    for (std::size_t i = 0; i < opt.m_numThreads; ++i)
+    // In adaptive mode all the workers are created upfront, so a started worker already has the routes
+    if (opt.m_minThreads > 0)
+    {
+        Autoscaler::Options scalerOptions;
+        scalerOptions.minWorkers = opt.m_minThreads;
+        scalerOptions.maxWorkers = opt.m_numThreads;
+        scalerOptions.batchSize = m_batchSize;
+        m_scaler = std::make_unique<Scaler>(scalerOptions, std::chrono::milliseconds {opt.m_scaleIntervalMs});
+    }
+
+    // With tester only workers the production ones never see the test queue nor load the test environments
+    const bool ownTesters = opt.m_testThreads > 0;
+    const auto prodTestQueue = ownTesters ? nullptr : m_testQueue;
+    const auto& prodTesterEntries = ownTesters ? std::vector<EntryConverter> {} : testerEntries;
+
+    // Place the workers on the NUMA nodes, a single node is the same as no placement
+    std::vector<numa::Node> nodes {};
+    if (opt.m_numaAware)
+    {
+        nodes = numa::nodes();
+        if (nodes.size() < 2)
+        {
+            LOG_INFO("Router: NUMA placement disabled, the host has a single node");
+            nodes.clear();
+        }
+        else
+        {
+            LOG_INFO("Router: placing {} workers on {} NUMA nodes", opt.m_numThreads, nodes.size());
+        }
+    }
+    const auto nodeOf = [&](std::size_t worker)
+    {
+        return numa::nodeOf(worker, opt.m_numThreads, nodes.size());
+    };
+
+    // Shared by the owner of each lane and the workers that steal from it
+    m_laneOrders.resize(m_eventLanes.size());
+    for (auto& laneOrder : m_laneOrders)
+    {
+        laneOrder = std::make_shared<LaneOrder>();
+    }
+
+    const auto createWorker = [&](std::size_t i)
     {
-        auto worker = std::make_shared<Worker>(m_envBuilder, m_eventQueue, m_testQueue);
-        auto error = initWorker(worker, routerEntries, testerEntries);
+        Placement placement {};
+        if (!nodes.empty())
+        {
+            placement.node = nodes[nodeOf(i)].id;
+            placement.cpus = nodes[nodeOf(i)].cpus;
+        }
+
+        std::shared_ptr<Worker> worker;
+        if (m_eventLanes.empty())
+        {
+            worker = std::make_shared<Worker>(m_envBuilder,
+                                              m_eventQueue,
+                                              prodTestQueue,
+                                              m_batchSize,
+                                              nullptr,
+                                              std::vector<Lane> {},
+                                              std::move(placement),
+                                              m_rawQueue,
+                                              m_eventArenas);
+        }
+        else
+        {
+            std::vector<std::size_t> stealOrder {};
+            for (std::size_t j = 1; j < m_eventLanes.size(); ++j)
+            {
+                // Start stealing from the next lane, so idle workers spread over the backlogged lanes
+                stealOrder.emplace_back((i + j) % m_eventLanes.size());
+            }
+            // The lanes of the same node go first, their events were pushed on this node
+            std::stable_partition(stealOrder.begin(),
+                                  stealOrder.end(),
+                                  [&](std::size_t lane) { return nodeOf(lane) == nodeOf(i); });
+
+            std::vector<Lane> stealLanes {};
+            for (const auto lane : stealOrder)
+            {
+                stealLanes.push_back({m_eventLanes[lane], m_laneOrders[lane]});
+            }
+            worker = std::make_shared<Worker>(m_envBuilder,
+                                              m_eventLanes[i],
+                                              prodTestQueue,
+                                              m_batchSize,
+                                              m_laneOrders[i],
+                                              std::move(stealLanes),
+                                              std::move(placement));
+        }
+        auto error = initWorker(worker, routerEntries, prodTesterEntries);
         if (error)
         {
             LOG_ERROR("Router: Cannot load initial states from store: {}", error->message);
         }
+        if (m_scaler)
+        {
+            m_scaler->loads.emplace_back(worker->load());
+        }
         m_workers.emplace_back(std::move(worker));
+    };
+
+    // Create the workers, the routes are built by the first one (of each node) if they are shared
+    auto shareScope = m_envBuilder->shareScope();
+    if (nodes.empty())
+    {
+        for (std::size_t i = 0; i < opt.m_numThreads; ++i)
+        {
+            createWorker(i);
+        }
+    }
+    else
+    {
+        // The workers of a node are built by a thread running on it, so their environments are allocated there.
+        // The nodes are done one after the other to keep the workers in order.
+        std::size_t i = 0;
+        std::exception_ptr error {};
+        for (std::size_t node = 0; node < nodes.size() && !error; ++node)
+        {
+            std::thread builder(
+                [&]()
+                {
+                    try
+                    {
+                        numa::pinThread(nodes[node].cpus);
+                        for (; i < opt.m_numThreads && nodeOf(i) == node; ++i)
+                        {
+                            createWorker(i);
+                        }
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                    }
+                });
+            builder.join();
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for (std::size_t i = 0; i < opt.m_testThreads; ++i)
+    {
+        auto worker = std::make_shared<Worker>(m_envBuilder, nullptr, m_testQueue);
+        if (auto error = initWorker(worker, {}, testerEntries); error)
+        {
+            LOG_ERROR("Router: Cannot load initial tester states from store: {}", error->message);
+        }
+        m_testWorkers.emplace_back(std::move(worker));
     }
 
-    // Initialize the EpsCounter
+    // Initialize the EpsCounter, its bucket holds a local batch of tokens for each worker
     loadEpsCounter(m_wStore);
+    m_epsCounter->setWorkers(m_workers.size());
+}
+
+Orchestrator::~Orchestrator() = default;
+
+void Orchestrator::scale()
+{
+    std::shared_lock lock {m_syncMutex};
+    if (!m_scaler)
+    {
+        return;
+    }
+
+    LoadSample sample;
+    sample.queued = queuedEvents();
+    sample.busyRatio = m_scaler->busyRatio();
+    sample.cpuIdle = m_scaler->cpu.idle();
+    sample.throttled = m_epsCounter->isActive();
+
+    const auto decision = m_scaler->autoscaler.decide(sample, m_scaler->active);
+    if (decision > 0)
+    {
+        (*std::next(m_workers.begin(), m_scaler->active))->start(m_epsLimit);
+        ++m_scaler->active;
+    }
+    else if (decision < 0)
+    {
+        --m_scaler->active;
+        (*std::next(m_workers.begin(), m_scaler->active))->stop();
+    }
+    else
+    {
+        return;
+    }
+
+    LOG_DEBUG("Router: {} workers running (queued events: {}, busy ratio: {:.2f}, idle CPU: {:.2f})",
+              m_scaler->active,
+              sample.queued,
+              sample.busyRatio,
+              sample.cpuIdle);
 }
 
 void Orchestrator::start()
 {
     std::shared_lock lock {m_syncMutex};
-    IWorker::EpsLimit epsLimit = [epsCounter = m_epsCounter]() -> bool
+    // Each worker keeps its own copy of the limiter, so the cached tokens are local to the worker
+    m_epsLimit = [epsCounter = m_epsCounter, cached = std::size_t {0}]() mutable -> bool
     {
-        if (epsCounter->isActive())
+        if (!epsCounter->isActive())
         {
-            return epsCounter->limitReached();
+            cached = 0;
+            return false;
         }
+
+        if (cached == 0)
+        {
+            cached = epsCounter->acquire(epsCounter->localBatch());
+            if (cached == 0)
+            {
+                return true;
+            }
+        }
+
+        --cached;
         return false;
     };
 
-    for (const auto& worker : m_workers)
+    // In adaptive mode only the workers that were running are started, the rest are started by the scaler
+    const auto running = m_scaler ? m_scaler->active : m_workers.size();
+    auto worker = m_workers.begin();
+    for (std::size_t i = 0; i < running; ++i, ++worker)
     {
-        worker->start(epsLimit);
+        (*worker)->start(m_epsLimit);
+    }
+
+    // The tests are not limited by the EPS
+    for (const auto& worker : m_testWorkers)
+    {
+        worker->start([]() { return false; });
+    }
+
+    if (m_scaler)
+    {
+        m_scaler->start([this]() { scale(); });
     }
 }
 
 void Orchestrator::stop()
 {
+    // Stop the scaler before taking the lock, it takes it on each tick
+    if (m_scaler)
+    {
+        m_scaler->stop();
+    }
+
     std::shared_lock lock {m_syncMutex};
     dumpTesters(); // TODO: For save the last used time
     for (const auto& worker : m_workers)
     {
         worker->stop();
     }
+    for (const auto& worker : m_testWorkers)
+    {
+        worker->stop();
+    }
+
+    // No worker is left to take the batches the last ones stopped in the middle of, they go back to their lanes
+    for (std::size_t i = 0; i < m_laneOrders.size(); ++i)
+    {
+        std::lock_guard laneLock {m_laneOrders[i]->mutex};
+        if (!m_laneOrders[i]->pending.empty())
+        {
+            m_eventLanes[i]->pushBulk(m_laneOrders[i]->pending);
+            m_laneOrders[i]->pending.clear();
+            m_laneOrders[i]->hasPending.store(false, std::memory_order_relaxed);
+        }
+    }
 }
 
 /**************************************************************************
@@ -320,6 +815,7 @@ base::OptError Orchestrator::postEntry(const prod::EntryPost& entry)
     }
 
     std::unique_lock lock {m_syncMutex};
+    auto shareScope = m_envBuilder->shareScope();
     auto error = forEachWorker([&entry](const auto& worker) { return worker->getRouter()->addEntry(entry); });
 
     if (error)
@@ -372,6 +868,7 @@ base::OptError Orchestrator::reloadEntry(const std::string& name)
     }
 
     std::unique_lock lock {m_syncMutex};
+    auto shareScope = m_envBuilder->shareScope();
     auto err = forEachWorker([&name](const auto& worker) { return worker->getRouter()->rebuildEntry(name); });
     if (err)
     {
@@ -415,7 +912,7 @@ base::OptError Orchestrator::postStrEvent(std::string_view event)
     base::OptError err = std::nullopt;
     try
     {
-        base::Event ev = base::parseEvent::parseWazuhEvent(event.data());
+        base::Event ev = base::parseEvent::parseWazuhEvent(event, m_eventArenas ? m_eventArenas->acquire() : nullptr);
         this->postEvent(std::move(ev));
     }
     catch (const std::exception& e)
@@ -476,6 +973,87 @@ base::OptError Orchestrator::activateEpsCounter(bool activate)
     return std::nullopt;
 }
 
+base::OptError Orchestrator::activateProfiler(bool activate, std::size_t sampleRate)
+{
+    std::unique_lock lock {m_syncMutex};
+    if (activate)
+    {
+        if (m_envBuilder->profiler())
+        {
+            return base::Error {"Profiler is already active"};
+        }
+
+        if (sampleRate == 0)
+        {
+            return base::Error {"The sample rate of the profiler must be greater than 0"};
+        }
+
+        m_profiler = std::make_shared<Profiler>(m_workers.size(), sampleRate);
+        m_envBuilder->setProfiler(m_profiler);
+    }
+    else
+    {
+        if (!m_envBuilder->profiler())
+        {
+            return base::Error {"Profiler is already inactive"};
+        }
+
+        m_envBuilder->setProfiler(nullptr);
+    }
+
+    // Rebuild the routes with (or without) the instrumented expressions, a failed route keeps its environment
+    auto shareScope = m_envBuilder->shareScope();
+    const auto entries = m_workers.front()->getRouter()->getEntries();
+    return forEachWorker(
+        [&entries](const auto& worker)
+        {
+            for (const auto& entry : entries)
+            {
+                if (auto err = worker->getRouter()->rebuildEntry(entry.name()))
+                {
+                    LOG_WARNING("Profiler: route '{}' not rebuilt: {}", entry.name(), err->message);
+                }
+            }
+            return base::OptError {std::nullopt};
+        });
+}
+
+base::RespOrError<prof::Report> Orchestrator::getProfilerReport(std::size_t top) const
+{
+    std::shared_lock lock {m_syncMutex};
+    if (!m_profiler)
+    {
+        return base::Error {"Profiler has never been activated"};
+    }
+
+    auto report = m_profiler->report(top);
+    report.enabled = m_envBuilder->profiler() != nullptr;
+    return report;
+}
+
+base::OptError Orchestrator::activateTap(bool activate, double rate, const std::string& field, const std::string& value)
+{
+    std::unique_lock lock {m_syncMutex};
+    const auto& tap = m_envBuilder->tap();
+    if (activate)
+    {
+        return tap->enable(rate, field, value);
+    }
+
+    if (!tap->enabled())
+    {
+        return base::Error {"Tap is already inactive"};
+    }
+
+    tap->disable();
+    return std::nullopt;
+}
+
+base::RespOrError<tap::Events> Orchestrator::getTapEvents(std::size_t max)
+{
+    return m_envBuilder->tap()->drain(max);
+}
+
 /**************************************************************************
  * ITesterAPI
  *************************************************************************/
@@ -488,13 +1066,13 @@ base::OptError Orchestrator::postTestEntry(const test::EntryPost& entry)
     }
 
     std::unique_lock lock {m_syncMutex};
-    auto error = forEachWorker([&entry](const auto& worker) { return worker->getTester()->addEntry(entry); });
+    auto error = forEachTester([&entry](const auto& worker) { return worker->getTester()->addEntry(entry); });
     if (error)
     {
         return error;
     }
 
-    error = forEachWorker([&entry](const auto& worker) { return worker->getTester()->enableEntry(entry.name()); });
+    error = forEachTester([&entry](const auto& worker) { return worker->getTester()->enableEntry(entry.name()); });
     if (error)
     {
         return error;
@@ -512,7 +1090,7 @@ base::OptError Orchestrator::deleteTestEntry(const std::string& name)
         return base::Error {"Name cannot be empty"};
     }
 
-    auto error = forEachWorker([&name](const auto& worker) { return worker->getTester()->removeEntry(name); });
+    auto error = forEachTester([&name](const auto& worker) { return worker->getTester()->removeEntry(name); });
     if (error)
     {
         return error;
@@ -529,7 +1107,7 @@ base::RespOrError<test::Entry> Orchestrator::getTestEntry(const std::string& nam
     }
 
     std::shared_lock lock {m_syncMutex};
-    return m_workers.front()->getTester()->getEntry(name);
+    return testers().front()->getTester()->getEntry(name);
 }
 
 base::OptError Orchestrator::reloadTestEntry(const std::string& name)
@@ -540,18 +1118,67 @@ base::OptError Orchestrator::reloadTestEntry(const std::string& name)
     }
 
     std::unique_lock lock {m_syncMutex};
-    auto error = forEachWorker([&name](const auto& worker) { return worker->getTester()->rebuildEntry(name); });
+    auto error = forEachTester([&name](const auto& worker) { return worker->getTester()->rebuildEntry(name); });
     if (error)
     {
         return error;
     }
-    return forEachWorker([&name](const auto& worker) { return worker->getTester()->enableEntry(name); });
+    return forEachTester([&name](const auto& worker) { return worker->getTester()->enableEntry(name); });
 }
 
 std::list<test::Entry> Orchestrator::getTestEntries() const
 {
     std::shared_lock lock {m_syncMutex};
-    return m_workers.front()->getTester()->getEntries();
+    return testers().front()->getTester()->getEntries();
+}
+
+base::OptError Orchestrator::pushTest(base::Event&& event,
+                                      const test::Options& opt,
+                                      std::function<void(base::RespOrError<test::Output>&&)> callbackFn)
+{
+    // The slot is given back when the tester answers, before calling the API callback
+    const auto& session = opt.environmentName();
+    if (m_testSessions)
+    {
+        if (!m_testSessions->tryAcquire(session))
+        {
+            return base::Error {fmt::format("Too many concurrent tests for session '{}', the limit is {}",
+                                            session,
+                                            m_testSessions->limit())};
+        }
+        callbackFn = [sessions = m_testSessions, session, callbackFn = std::move(callbackFn)](
+                         base::RespOrError<test::Output>&& output)
+        {
+            sessions->release(session);
+            callbackFn(std::move(output));
+        };
+    }
+
+    auto tuple = std::make_shared<test::TestingTuple>(std::move(event), opt, std::move(callbackFn));
+    if (!m_testQueue->tryPush(tuple))
+    {
+        if (m_testSessions)
+        {
+            m_testSessions->release(session);
+        }
+        return base::Error {"Test queue is full"};
+    }
+
+    // Wake up a production worker waiting on an empty queue, the tester only workers wait on the test queue
+    if (m_testWorkers.empty() && m_rawQueue && m_rawQueue->empty())
+    {
+        m_rawQueue->push(RawEventPtr(nullptr));
+    }
+    else if (m_testWorkers.empty() && !m_rawQueue && m_eventLanes.empty() && m_eventQueue->empty())
+    {
+        m_eventQueue->push(base::Event(nullptr));
+    }
+
+    {
+        std::shared_lock lock {m_syncMutex};
+        testers().front()->getTester()->updateLastUsed(session);
+    }
+    return std::nullopt;
 }
 
 std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(base::Event&& event, const test::Options& opt)
@@ -569,22 +1196,11 @@ std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(base::Even
     {
         promisePtr->set_value(std::move(output));
     };
-    auto tuple = std::make_shared<test::TestingTuple>(std::move(event), opt, std::move(callback));
 
-    if (!m_testQueue->tryPush(tuple))
+    if (auto error = pushTest(std::move(event), opt, std::move(callback)); error)
     {
         return std::async(std::launch::deferred,
-                          []() -> base::RespOrError<test::Output> { return base::Error {"Test queue is full"}; });
-    }
-
-    if (m_eventQueue->empty())
-    {
-        m_eventQueue->push(base::Event(nullptr));
-    }
-
-    {
-        std::shared_lock lock {m_syncMutex};
-        m_workers.front()->getTester()->updateLastUsed(opt.environmentName());
+                          [err = std::move(*error)]() -> base::RespOrError<test::Output> { return err; });
     }
     return future;
 }
@@ -594,7 +1210,7 @@ std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(std::strin
 
     try
     {
-        base::Event ev = base::parseEvent::parseWazuhEvent(event.data());
+        base::Event ev = base::parseEvent::parseWazuhEvent(event);
         return this->ingestTest(std::move(ev), opt);
     }
     catch (const std::exception& e)
@@ -613,22 +1229,7 @@ base::OptError Orchestrator::ingestTest(base::Event&& event,
         return error;
     }
 
-    auto tuple = std::make_shared<test::TestingTuple>(std::move(event), opt, std::move(callbackFn));
-    if (!m_testQueue->tryPush(tuple))
-    {
-        return base::Error {"Test queue is full"};
-    }
-    if (m_eventQueue->empty())
-    {
-        m_eventQueue->push(base::Event(nullptr));
-    }
-
-    {
-        std::shared_lock lock {m_syncMutex};
-        m_workers.front()->getTester()->updateLastUsed(opt.environmentName());
-    }
-
-    return std::nullopt;
+    return pushTest(std::move(event), opt, std::move(callbackFn));
 }
 
 base::OptError Orchestrator::ingestTest(std::string_view event,
@@ -637,15 +1238,13 @@ base::OptError Orchestrator::ingestTest(std::string_view event,
 {
     try
     {
-        base::Event ev = base::parseEvent::parseWazuhEvent(event.data());
-        this->ingestTest(std::move(ev), opt, callbackFn);
+        base::Event ev = base::parseEvent::parseWazuhEvent(event);
+        return this->ingestTest(std::move(ev), opt, std::move(callbackFn));
     }
     catch (const std::exception& e)
     {
         return base::Error {e.what()};
     }
-
-    return std::nullopt;
 }
 
 base::RespOrError<std::unordered_set<std::string>> Orchestrator::getAssets(const std::string& name) const
@@ -656,7 +1255,7 @@ base::RespOrError<std::unordered_set<std::string>> Orchestrator::getAssets(const
     }
 
     std::shared_lock lock {m_syncMutex};
-    return m_workers.front()->getTester()->getAssets(name);
+    return testers().front()->getTester()->getAssets(name);
 }
 
 } // namespace router
@@ -0,0 +1,276 @@
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace router
+{
+
+namespace
+{
+/**
+ * @brief Index of the calling thread, assigned on its first invocation. Used to pick the shard of the thread.
+ */
+std::size_t threadIndex()
+{
+    static std::atomic<std::size_t> next {0};
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+/**
+ * @brief Per-thread xorshift, decides which invocations are timed without a shared counter.
+ */
+std::uint64_t nextRandom()
+{
+    thread_local std::uint64_t state = 0x9e3779b97f4a7c15ULL ^ (threadIndex() + 1);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/**
+ * @brief Check if the name of an operation is the name of an asset, i.e. type/name/version.
+ */
+bool isAssetName(const std::string& name)
+{
+    if (std::count(name.begin(), name.end(), '/') != 2)
+    {
+        return false;
+    }
+
+    const auto type = name.substr(0, name.find('/'));
+    return type == "decoder" || type == "rule" || type == "output" || type == "filter";
+}
+
+/**
+ * @brief Helper of a term, the names of the helper terms are "field: helper(args)".
+ */
+std::string helperName(const std::string& name)
+{
+    auto begin = name.find(": ");
+    begin = begin == std::string::npos ? 0 : begin + 2;
+    const auto end = name.find_first_of("([", begin);
+    return name.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+}
+} // namespace
+
+Profiler::Slot::Slot(std::string asset, std::string helper, bool entry, bool accept, std::size_t shards)
+    : asset {std::move(asset)}
+    , helper {std::move(helper)}
+    , entry {entry}
+    , accept {accept}
+    , shards(shards)
+{
+}
+
+Profiler::Shard& Profiler::Slot::shard()
+{
+    return shards[threadIndex() % shards.size()];
+}
+
+Profiler::Profiler(std::size_t shards, std::size_t sampleRate)
+    : m_shards {std::max<std::size_t>(shards, 1)}
+    , m_sampleRate {sampleRate}
+{
+    if (m_sampleRate == 0)
+    {
+        throw std::runtime_error {"The sample rate of the profiler must be greater than 0"};
+    }
+}
+
+std::shared_ptr<Profiler::Slot>
+Profiler::newSlot(const std::string& asset, const std::string& helper, bool entry, bool accept)
+{
+    auto slot = std::make_shared<Slot>(asset, helper, entry, accept, m_shards);
+    std::lock_guard lock {m_mutex};
+    m_slots.emplace_back(slot);
+    return slot;
+}
+
+base::Expression Profiler::instrument(const base::Expression& expression)
+{
+    // The same formula can be shared by several parents, instrument it once
+    std::unordered_map<unsigned int, base::Expression> visited;
+    // Assets whose first term was already instrumented
+    std::unordered_map<std::string, bool> entered;
+
+    std::function<base::Expression(const base::Expression&, const std::string&)> visit;
+    visit = [&](const base::Expression& formula, const std::string& parentAsset) -> base::Expression
+    {
+        if (auto it = visited.find(formula->getId()); it != visited.end())
+        {
+            return it->second;
+        }
+
+        base::Expression result;
+        if (formula->isTerm())
+        {
+            auto term = formula->getPtr<base::Term<base::EngineOp>>();
+            const auto name = term->getName();
+            const bool entry = !parentAsset.empty() && !entered[parentAsset];
+            entered[parentAsset] = true;
+
+            auto slot = newSlot(parentAsset, helperName(name), entry, name == "AcceptAll");
+            const auto sampleRate = m_sampleRate;
+            result = base::Term<base::EngineOp>::create(
+                name,
+                [fn = term->getFn(), slot, sampleRate](base::Event event)
+                {
+                    auto& shard = slot->shard();
+                    shard.calls.fetch_add(1, std::memory_order_relaxed);
+
+                    base::result::Result<base::Event> res;
+                    if (sampleRate == 1 || nextRandom() % sampleRate == 0)
+                    {
+                        const auto start = std::chrono::steady_clock::now();
+                        res = fn(std::move(event));
+                        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - start);
+                        shard.sampledCalls.fetch_add(1, std::memory_order_relaxed);
+                        shard.sampledNs.fetch_add(elapsed.count(), std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        res = fn(std::move(event));
+                    }
+
+                    if (res.success())
+                    {
+                        shard.matches.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    return res;
+                });
+        }
+        else if (formula->isOperation())
+        {
+            const auto name = formula->getName();
+            const auto asset = isAssetName(name) ? name : parentAsset;
+            const auto& operands = formula->getPtr<base::Operation>()->getOperands();
+
+            std::vector<base::Expression> instrumented;
+            instrumented.reserve(operands.size());
+            for (const auto& operand : operands)
+            {
+                instrumented.emplace_back(visit(operand, asset));
+            }
+
+            if (formula->isImplication())
+            {
+                result = base::Implication::create(name, instrumented[0], instrumented[1]);
+            }
+            else if (formula->isAnd())
+            {
+                result = base::And::create(name, std::move(instrumented));
+            }
+            else if (formula->isOr())
+            {
+                result = base::Or::create(name, std::move(instrumented));
+            }
+            else if (formula->isChain())
+            {
+                result = base::Chain::create(name, std::move(instrumented));
+            }
+            else if (formula->isBroadcast())
+            {
+                result = base::Broadcast::create(name, std::move(instrumented));
+            }
+            else
+            {
+                throw std::runtime_error {"Unsupported operation '" + name + "' in the profiled expression"};
+            }
+        }
+        else
+        {
+            throw std::runtime_error {"Unsupported formula '" + formula->getName() + "' in the profiled expression"};
+        }
+
+        visited.emplace(formula->getId(), result);
+        return result;
+    };
+
+    return visit(expression, "");
+}
+
+prof::Report Profiler::report(std::size_t top) const
+{
+    struct Totals
+    {
+        std::uint64_t calls {0};
+        std::uint64_t matches {0};
+        double ns {0};
+    };
+
+    std::map<std::string, Totals> assets;
+    std::map<std::string, Totals> helpers;
+    {
+        std::lock_guard lock {m_mutex};
+        for (const auto& slot : m_slots)
+        {
+            Totals slotTotals;
+            std::uint64_t sampledCalls {0};
+            std::uint64_t sampledNs {0};
+            for (const auto& shard : slot->shards)
+            {
+                slotTotals.calls += shard.calls.load(std::memory_order_relaxed);
+                slotTotals.matches += shard.matches.load(std::memory_order_relaxed);
+                sampledCalls += shard.sampledCalls.load(std::memory_order_relaxed);
+                sampledNs += shard.sampledNs.load(std::memory_order_relaxed);
+            }
+            // Estimate the time of all the invocations from the timed ones
+            if (sampledCalls > 0)
+            {
+                slotTotals.ns = static_cast<double>(sampledNs) * slotTotals.calls / sampledCalls;
+            }
+
+            auto& helper = helpers[slot->helper];
+            helper.calls += slotTotals.calls;
+            helper.matches += slotTotals.matches;
+            helper.ns += slotTotals.ns;
+
+            if (!slot->asset.empty())
+            {
+                auto& asset = assets[slot->asset];
+                asset.ns += slotTotals.ns;
+                if (slot->entry)
+                {
+                    asset.calls += slotTotals.calls;
+                }
+                if (slot->accept)
+                {
+                    asset.matches += slotTotals.calls;
+                }
+            }
+        }
+    }
+
+    auto toStats = [top](const std::map<std::string, Totals>& totals)
+    {
+        std::vector<prof::Stats> stats;
+        stats.reserve(totals.size());
+        for (const auto& [name, total] : totals)
+        {
+            stats.push_back({name, total.calls, total.matches, static_cast<std::uint64_t>(total.ns)});
+        }
+        std::stable_sort(
+            stats.begin(), stats.end(), [](const auto& lhs, const auto& rhs) { return lhs.totalNs > rhs.totalNs; });
+        if (top != 0 && stats.size() > top)
+        {
+            stats.resize(top);
+        }
+        return stats;
+    };
+
+    prof::Report report;
+    report.sampleRate = m_sampleRate;
+    report.assets = toStats(assets);
+    report.helpers = toStats(helpers);
+    return report;
+}
+
+} // namespace router
@@ -0,0 +1,98 @@
+#ifndef _ROUTER_PROFILER_HPP
+#define _ROUTER_PROFILER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <base/expression.hpp>
+
+#include <router/types.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Sampling profiler of the assets and helpers of the production routes.
+ *
+ * The profiler does not hook into the backends: it instruments a copy of the policy expression, wrapping each term
+ * with a counter of invocations and successes, and measures the time of 1 of each sampleRate invocations. The
+ * counters are sharded by thread, so the workers do not contend on them. When the profiler is disabled the routes
+ * are rebuilt from the original expression, so it has no cost.
+ *
+ * An asset is invoked when its first term is evaluated and matches when its condition passes (the AcceptAll term at
+ * the end of the condition is evaluated). The time of an asset is the time of its terms, the helpers are grouped by
+ * name across all the assets.
+ */
+class Profiler
+{
+private:
+    struct alignas(64) Shard
+    {
+        std::atomic<std::uint64_t> calls {0};        ///< Invocations
+        std::atomic<std::uint64_t> matches {0};      ///< Successful invocations
+        std::atomic<std::uint64_t> sampledCalls {0}; ///< Timed invocations
+        std::atomic<std::uint64_t> sampledNs {0};    ///< Time of the timed invocations
+    };
+
+    /**
+     * @brief Counters of one term of an instrumented expression
+     */
+    struct Slot
+    {
+        std::string asset;  ///< Asset of the term, empty if it is outside of any asset
+        std::string helper; ///< Helper or operation of the term
+        bool entry;         ///< First term of the asset
+        bool accept;        ///< Term evaluated when the condition of the asset passes
+        std::vector<Shard> shards;
+
+        Slot(std::string asset, std::string helper, bool entry, bool accept, std::size_t shards);
+
+        Shard& shard();
+    };
+
+    std::size_t m_shards;                       ///< Shards of each slot
+    std::size_t m_sampleRate;                   ///< 1 of each m_sampleRate invocations is timed
+    std::vector<std::shared_ptr<Slot>> m_slots; ///< Slots of all the instrumented expressions
+    mutable std::mutex m_mutex;                 ///< Protects m_slots
+
+    std::shared_ptr<Slot> newSlot(const std::string& asset, const std::string& helper, bool entry, bool accept);
+
+public:
+    /**
+     * @brief Construct a new Profiler
+     *
+     * @param shards Shards of the counters, the number of threads that ingest events
+     * @param sampleRate 1 of each sampleRate invocations is timed
+     * @throw std::runtime_error if the sample rate is 0
+     */
+    Profiler(std::size_t shards, std::size_t sampleRate);
+
+    /**
+     * @brief Get an instrumented copy of an expression, the expression is not modified.
+     *
+     * @param expression Expression of a policy
+     * @return base::Expression The instrumented expression
+     */
+    base::Expression instrument(const base::Expression& expression);
+
+    /**
+     * @brief Get the assets and helpers with the highest cumulative time
+     *
+     * @param top Max number of assets and helpers, 0 for all
+     * @return prof::Report The report, enabled is set by the owner of the profiler
+     */
+    prof::Report report(std::size_t top) const;
+
+    /**
+     * @brief Get the sample rate
+     */
+    std::size_t sampleRate() const { return m_sampleRate; }
+};
+
+} // namespace router
+
+#endif // _ROUTER_PROFILER_HPP
@@ -0,0 +1,79 @@
+#include <router/rawEvent.hpp>
+
+#include <stdexcept>
+
+namespace router
+{
+
+void RawEventPool::FreeList::release(RawEvent* event)
+{
+    std::unique_ptr<RawEvent> owned {event};
+    if (owned->capacity() > m_maxBufferSize)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock {m_mutex};
+    if (m_events.size() < m_maxBuffers)
+    {
+        m_events.emplace_back(std::move(owned));
+    }
+}
+
+RawEventPool::RawEventPool(std::size_t maxBuffers, std::size_t maxBufferSize)
+    : m_free(std::make_shared<FreeList>())
+{
+    if (maxBuffers == 0)
+    {
+        throw std::runtime_error {"The raw event pool must keep at least one buffer"};
+    }
+
+    m_free->m_maxBuffers = maxBuffers;
+    m_free->m_maxBufferSize = maxBufferSize;
+    m_free->m_events.reserve(maxBuffers);
+}
+
+RawEventPtr RawEventPool::acquire(std::string_view bytes)
+{
+    std::unique_ptr<RawEvent> event {};
+    {
+        std::lock_guard<std::mutex> lock {m_free->m_mutex};
+        if (!m_free->m_events.empty())
+        {
+            event = std::move(m_free->m_events.back());
+            m_free->m_events.pop_back();
+        }
+    }
+
+    if (event)
+    {
+        event->assign(bytes);
+    }
+    else
+    {
+        event = std::make_unique<RawEvent>(bytes);
+    }
+
+    // The buffer goes back to the free list if the pool still exists, otherwise it is freed
+    std::weak_ptr<FreeList> wFree {m_free};
+    return {event.release(),
+            [wFree](RawEvent* released)
+            {
+                if (auto free = wFree.lock())
+                {
+                    free->release(released);
+                }
+                else
+                {
+                    delete released;
+                }
+            }};
+}
+
+std::size_t RawEventPool::available() const
+{
+    std::lock_guard<std::mutex> lock {m_free->m_mutex};
+    return m_free->m_events.size();
+}
+
+} // namespace router
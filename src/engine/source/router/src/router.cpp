@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <functional>
 
@@ -8,6 +9,8 @@
 
 namespace
 {
+constexpr uint32_t UNPROCESSED_LOG_RATE = 10; ///< Max warnings per second for events no route accepts
+
 /**
  * @brief Return the current time in seconds since epoch
  */
@@ -26,9 +29,9 @@ base::OptError Router::addEntry(const prod::EntryPost& entryPost, bool ignoreFai
     auto entry = RuntimeEntry(entryPost);
     try
     {
-        auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter());
-        entry.hash(uniqueEnv->hash());
-        entry.environment() = std::move(uniqueEnv);
+        auto env = m_envBuilder->createShared(entry.policy(), entry.filter(), m_node, entryPost.name());
+        entry.hash(env->hash());
+        entry.environment() = std::move(env);
     }
     catch (const std::exception& e)
     {
@@ -55,6 +58,7 @@ base::OptError Router::addEntry(const prod::EntryPost& entryPost, bool ignoreFai
             return base::Error {"The priority of the route  is already in use"};
         }
         m_table.insert(entryPost.name(), entryPost.priority(), std::move(entry));
+        publishSnapshot();
     }
 
     return std::nullopt;
@@ -69,6 +73,7 @@ base::OptError Router::removeEntry(const std::string& name)
         return base::Error {"The route not exist"};
     }
     m_table.erase(name);
+    publishSnapshot();
     return std::nullopt;
 }
 
@@ -82,11 +87,12 @@ base::OptError Router::rebuildEntry(const std::string& name)
     auto& entry = m_table.get(name);
     try
     {
-        auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter());
-        entry.environment() = std::move(uniqueEnv);
+        auto env = m_envBuilder->createShared(entry.policy(), entry.filter(), m_node, name);
+        entry.environment() = std::move(env);
         entry.lastUpdate(getStartTime());
         entry.hash(entry.environment()->hash());
         // Mantaing the status of the environment
+        publishSnapshot();
     }
     catch (const std::exception& e)
     {
@@ -109,6 +115,7 @@ base::OptError Router::enableEntry(const std::string& name)
         return base::Error {"The route is not buided"};
     }
     entry.status(env::State::ENABLED);
+    publishSnapshot();
     return {};
 }
 
@@ -139,6 +146,7 @@ base::OptError Router::changePriority(const std::string& name, size_t priority)
     }
     // Sync the priority
     m_table.get(name).priority(priority);
+    publishSnapshot();
 
     return {};
 }
@@ -165,23 +173,323 @@ base::RespOrError<prod::Entry> Router::getEntry(const std::string& name) const
     return m_table.get(name);
 }
 
-void Router::ingest(base::Event&& event)
+void Router::publishSnapshot()
 {
-    std::shared_lock lock {m_mutex};
-
+    auto snapshot = std::make_shared<RouteSnapshot>();
     for (const auto& entry : m_table)
     {
-        if (entry.status() == env::State::ENABLED && entry.environment()->isAccepted(event))
+        if (entry.status() == env::State::ENABLED && entry.environment() != nullptr)
+        {
+            snapshot->routes.push_back(entry.environment());
+            snapshot->tee.push_back(entry.tee());
+        }
+    }
+    shareDecoders(*snapshot);
+
+    // Index by the field most routes require a string value of, an index is not worth it for a single route
+    std::unordered_map<std::string, std::size_t> fieldCount;
+    for (const auto& environment : snapshot->routes)
+    {
+        if (const auto& discriminator = environment->discriminator(); discriminator && discriminator->value.isString())
+        {
+            ++fieldCount[discriminator->field];
+        }
+    }
+
+    auto indexed = std::max_element(fieldCount.begin(),
+                                    fieldCount.end(),
+                                    [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+    if (indexed != fieldCount.end() && indexed->second > 1)
+    {
+        const auto& field = indexed->first;
+        auto keyOf = [&field](const Environment& environment) -> std::optional<std::string>
+        {
+            const auto& discriminator = environment.discriminator();
+            if (discriminator && discriminator->field == field)
+            {
+                return discriminator->value.getString();
+            }
+            return std::nullopt;
+        };
+
+        for (const auto& environment : snapshot->routes)
+        {
+            if (auto key = keyOf(*environment))
+            {
+                snapshot->byValue.try_emplace(key.value());
+            }
+        }
+
+        // Every list keeps the priority order, the unkeyed routes are interleaved in all of them
+        for (std::size_t i = 0; i < snapshot->routes.size(); ++i)
+        {
+            if (auto key = keyOf(*snapshot->routes[i]))
+            {
+                snapshot->byValue[key.value()].push_back(i);
+                continue;
+            }
+
+            snapshot->unkeyed.push_back(i);
+            for (auto& [value, candidates] : snapshot->byValue)
+            {
+                candidates.push_back(i);
+            }
+        }
+
+        snapshot->field = json::FieldRef(field);
+    }
+
+    m_snapshot = std::move(snapshot);
+    m_snapshotVersion.fetch_add(1, std::memory_order_release);
+}
+
+void Router::shareDecoders(RouteSnapshot& snapshot) const
+{
+    const auto& routes = snapshot.routes;
+    snapshot.decoders.resize(routes.size());
+    snapshot.postDecoders.resize(routes.size());
+
+    // Without tee routes every event is delivered to a single route, there is nothing to share
+    if (std::none_of(snapshot.tee.begin(), snapshot.tee.end(), [](bool tee) { return tee; }))
+    {
+        return;
+    }
+
+    const auto& previous = *m_snapshot;
+    for (std::size_t i = 0; i < routes.size(); ++i)
+    {
+        const auto& stages = routes[i]->stages();
+        auto sameDecoders = [&](const auto& environment)
+        {
+            return environment != routes[i] && environment->stages()
+                   && environment->stages()->decoders == stages->decoders;
+        };
+        if (!stages || std::none_of(routes.begin(), routes.end(), sameDecoders))
+        {
+            continue;
+        }
+
+        // The stages of an environment never change, the controllers of the last snapshot are kept
+        try
+        {
+            auto runsDecoders = [&](const auto& stage) { return stage && stage->expression() == stages->decoders; };
+            auto decoders = std::find_if(snapshot.decoders.begin(), snapshot.decoders.begin() + i, runsDecoders);
+            if (decoders != snapshot.decoders.begin() + i)
+            {
+                snapshot.decoders[i] = *decoders;
+            }
+            else if (auto it = std::find_if(previous.decoders.begin(), previous.decoders.end(), runsDecoders);
+                     it != previous.decoders.end())
+            {
+                snapshot.decoders[i] = *it;
+            }
+            else
+            {
+                snapshot.decoders[i] = std::make_shared<const StageController>(
+                    stages->decoders, m_envBuilder->makeStageController(stages->decoders, stages->assets));
+            }
+
+            auto it = std::find(previous.routes.begin(), previous.routes.end(), routes[i]);
+            if (it != previous.routes.end() && previous.postDecoders[it - previous.routes.begin()])
+            {
+                snapshot.postDecoders[i] = previous.postDecoders[it - previous.routes.begin()];
+            }
+            else
+            {
+                snapshot.postDecoders[i] = std::make_shared<const StageController>(
+                    stages->postDecoders, m_envBuilder->makeStageController(stages->postDecoders, stages->assets));
+            }
+        }
+        catch (const std::exception& e)
         {
-            entry.environment()->ingest(std::move(event));
-            event = nullptr;
-            break;
+            // The route still runs its whole policy
+            LOG_WARNING("Failed to share the decoders of a route, it decodes its events on its own: {}", e.what());
+            snapshot.decoders[i] = nullptr;
+            snapshot.postDecoders[i] = nullptr;
         }
     }
+}
+
+void Router::refreshSnapshot()
+{
+    // The lock is only taken to pick up a newer snapshot after the routes change, the common path is a single atomic
+    // load.
+    const auto version = m_snapshotVersion.load(std::memory_order_acquire);
+    if (m_ingestVersion != version)
+    {
+        std::shared_lock lock {m_mutex};
+        m_ingestSnapshot = m_snapshot;
+        m_ingestVersion = m_snapshotVersion.load(std::memory_order_relaxed);
+    }
+}
+
+template<typename Deliver>
+void Router::route(base::Event&& event, Deliver&& deliver)
+{
+    // The repeated events are dropped before anything else is done with them
+    if (m_dedup && m_dedup->isDuplicate(event))
+    {
+        return;
+    }
+
+    // Sampled before routing, the accepting environment takes the event
+    if (m_tap->enabled())
+    {
+        m_tap->offer(event);
+    }
+
+    // An event accepted by a tee route is still offered to the next routes, the accepting routes are collected first
+    const auto& snapshot = *m_ingestSnapshot;
+    m_accepted.clear();
+    auto tryRoute = [&](std::size_t index)
+    {
+        if (!snapshot.routes[index]->isAccepted(event))
+        {
+            return false;
+        }
+
+        m_accepted.push_back(index);
+        return !snapshot.tee[index];
+    };
+
+    if (snapshot.field)
+    {
+        // Routes keyed on another value of the field cannot accept the event, only the candidates are evaluated
+        const auto* candidates = &snapshot.unkeyed;
+        if (auto value = event->getString(snapshot.field.value()))
+        {
+            if (auto it = snapshot.byValue.find(value.value()); it != snapshot.byValue.end())
+            {
+                candidates = &it->second;
+            }
+        }
+
+        for (auto index : *candidates)
+        {
+            if (tryRoute(index))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t index = 0; index < snapshot.routes.size(); ++index)
+        {
+            if (tryRoute(index))
+            {
+                break;
+            }
+        }
+    }
+
+    if (m_accepted.empty())
+    {
+        LOG_WARNING_RL(UNPROCESSED_LOG_RATE, "Event not processed: {}", event->str());
+        return;
+    }
+
+    // A route only runs its decoders and its rules and outputs apart when another accepting route has the same
+    // decoders. The event is copied only when it is delivered to several routes, the last one takes the original.
+    auto sharedDecoders = [&](std::size_t position) -> const StageController*
+    {
+        const auto* decoders = snapshot.decoders[m_accepted[position]].get();
+        for (std::size_t other = 0; decoders != nullptr && other < m_accepted.size(); ++other)
+        {
+            if (other != position && snapshot.decoders[m_accepted[other]].get() == decoders)
+            {
+                return decoders;
+            }
+        }
+        return nullptr;
+    };
+
+    // Event decoded by each shared decoders, only filled when an event is accepted by several routes
+    std::vector<std::pair<const StageController*, base::Event>> decoded {};
+    for (std::size_t position = 0; position < m_accepted.size(); ++position)
+    {
+        const auto index = m_accepted[position];
+        const auto* decoders = sharedDecoders(position);
+        auto findDecoded = [&](const StageController* stage)
+        {
+            return std::find_if(
+                decoded.begin(), decoded.end(), [stage](const auto& entry) { return entry.first == stage; });
+        };
+
+        // The next routes need the raw event unless they only run decoders already run
+        auto rawUsedLater = [&]()
+        {
+            for (auto next = position + 1; next < m_accepted.size(); ++next)
+            {
+                const auto* stage = sharedDecoders(next);
+                if (stage == nullptr || (stage != decoders && findDecoded(stage) == decoded.end()))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        if (decoders == nullptr)
+        {
+            auto routed = rawUsedLater() ? std::make_shared<json::Json>(*event) : std::move(event);
+            deliver(snapshot.routes[index]->controller(), std::move(routed));
+            continue;
+        }
+
+        // The first route of the group decodes the event for the whole group
+        auto it = findDecoded(decoders);
+        if (it == decoded.end())
+        {
+            auto raw = rawUsedLater() ? std::make_shared<json::Json>(*event) : std::move(event);
+            it = decoded.emplace(decoded.end(), decoders, decoders->controller().ingestGet(std::move(raw)));
+        }
+
+        auto decodedUsedLater = false;
+        for (auto next = position + 1; next < m_accepted.size() && !decodedUsedLater; ++next)
+        {
+            decodedUsedLater = sharedDecoders(next) == decoders;
+        }
+
+        auto routed = decodedUsedLater ? std::make_shared<json::Json>(*it->second) : std::move(it->second);
+        deliver(snapshot.postDecoders[index]->controller(), std::move(routed));
+    }
+}
+
+void Router::ingest(base::Event&& event)
+{
+    refreshSnapshot();
+    route(std::move(event),
+          [](bk::IController& controller, base::Event&& routed) { controller.ingest(std::move(routed)); });
+}
+
+void Router::ingestBatch(std::vector<base::Event>& events)
+{
+    // The snapshot holds the environments until the end of the batch, even if the routes change meanwhile
+    refreshSnapshot();
+
+    // There are a few routes, a linear search of the controller is cheaper than a map
+    std::vector<std::pair<bk::IController*, std::vector<base::Event>>> routed {};
+    for (auto& event : events)
+    {
+        route(std::move(event),
+              [&routed](bk::IController& controller, base::Event&& accepted)
+              {
+                  auto it = std::find_if(routed.begin(),
+                                         routed.end(),
+                                         [&controller](const auto& batch) { return batch.first == &controller; });
+                  if (it == routed.end())
+                  {
+                      it = routed.emplace(routed.end(), &controller, std::vector<base::Event> {});
+                  }
+                  it->second.emplace_back(std::move(accepted));
+              });
+    }
+    events.clear();
 
-    if (event)
+    for (auto& [controller, batch] : routed)
     {
-        LOG_WARNING("Event not processed: {}", event->str());
+        controller->ingestBatch(batch);
     }
 }
 
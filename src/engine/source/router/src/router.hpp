@@ -1,9 +1,16 @@
 #ifndef _ROUTER_ROUTER_HPP
 #define _ROUTER_ROUTER_HPP
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
+#include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
 
 #include "table.hpp"
@@ -21,30 +28,127 @@ private:
     class RuntimeEntry : public prod::Entry
     {
     private:
-        std::unique_ptr<Environment> m_env; ///< The environment associated with the entry.
+        std::shared_ptr<Environment> m_env; ///< The environment associated with the entry, may be shared by workers.
 
     public:
         explicit RuntimeEntry(const prod::EntryPost& entry)
             : prod::Entry(entry) {};
 
-        const std::unique_ptr<Environment>& environment() const { return m_env; }
-        std::unique_ptr<Environment>& environment() { return m_env; }
+        const std::shared_ptr<Environment>& environment() const { return m_env; }
+        std::shared_ptr<Environment>& environment() { return m_env; }
+    };
+
+    /**
+     * @brief Controller of a stage of the policies, stopped when the last snapshot that runs it is released.
+     */
+    class StageController
+    {
+    private:
+        base::Expression m_expression;                 ///< Stage run by the controller
+        std::shared_ptr<bk::IController> m_controller; ///< Controller of the stage
+
+    public:
+        StageController(base::Expression expression, std::shared_ptr<bk::IController> controller)
+            : m_expression(std::move(expression))
+            , m_controller(std::move(controller))
+        {
+            if (!m_controller)
+            {
+                throw std::runtime_error {"Invalid controller"};
+            }
+        }
+
+        ~StageController() { m_controller->stop(); }
+
+        StageController(const StageController&) = delete;
+        StageController& operator=(const StageController&) = delete;
+
+        const base::Expression& expression() const { return m_expression; }
+        bk::IController& controller() const { return *m_controller; }
+    };
+
+    /**
+     * @brief Immutable view of the enabled environments in priority order, the only state read by ingest.
+     *
+     * When several routes require a string value in the same field (agent.id, wazuh.origin, a tenant label...), the
+     * routes are indexed by that value, so an event is only checked against the routes that can accept it. The
+     * routes whose filter does not require a value of the field are candidates for every event.
+     *
+     * When there are tee routes, the routes whose policies have the same decoders share a controller of the decoders
+     * and get one of their rules and outputs, so an event accepted by several of them is decoded once.
+     */
+    struct RouteSnapshot
+    {
+        std::vector<std::shared_ptr<Environment>> routes;                   ///< Enabled environments by priority
+        std::vector<bool> tee;                                              ///< Tee flag of each route
+        std::vector<std::shared_ptr<const StageController>> decoders;     ///< Shared decoders of each route, or null
+        std::vector<std::shared_ptr<const StageController>> postDecoders; ///< Rules and outputs of the sharing routes
+        std::optional<json::FieldRef> field;                                ///< Indexed field, empty if no index
+        std::unordered_map<std::string, std::vector<std::size_t>> byValue; ///< Candidate routes for each value
+        std::vector<std::size_t> unkeyed;                                  ///< Candidate routes for the other values
     };
 
     internal::Table<RuntimeEntry> m_table; ///< Internal table for managing Production Environments.
-    mutable std::shared_mutex m_mutex;     ///< Mutex for the table.
+    mutable std::shared_mutex m_mutex;     ///< Mutex for the table and the published snapshot.
+
+    std::shared_ptr<const RouteSnapshot> m_snapshot; ///< Last published snapshot, guarded by m_mutex.
+    std::atomic<uint64_t> m_snapshotVersion;         ///< Version of the last published snapshot.
+
+    // Snapshot used by ingest, only accessed by the worker thread that owns the router. A replaced snapshot, and the
+    // environments only it references, are released when the next event picks up the new one.
+    std::shared_ptr<const RouteSnapshot> m_ingestSnapshot; ///< Snapshot the events are routed with.
+    uint64_t m_ingestVersion;                              ///< Version of m_ingestSnapshot.
+    std::vector<std::size_t> m_accepted;                   ///< Routes that accepted the event being routed.
+
+    /**
+     * @brief Build a new snapshot from the table and publish it. Must be called with the unique lock held.
+     */
+    void publishSnapshot();
+
+    /**
+     * @brief Set the stage controllers of the routes that share their decoders, reusing the ones of the last snapshot.
+     *
+     * @param snapshot The snapshot being built, with its routes set.
+     */
+    void shareDecoders(RouteSnapshot& snapshot) const;
+
+    /**
+     * @brief Pick up the last published snapshot if the routes changed since the previous event.
+     */
+    void refreshSnapshot();
+
+    /**
+     * @brief Deduplicate, sample and route an event with the current snapshot.
+     *
+     * @param event The event to route.
+     * @param deliver Called with the controller of each accepting route and its event, the last one takes the original.
+     */
+    template<typename Deliver>
+    void route(base::Event&& event, Deliver&& deliver);
 
     std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< Environment builder for create new entries
+    std::shared_ptr<Tap> m_tap;                       ///< Tap of the environment builder, checked on each event
+    std::shared_ptr<Dedup> m_dedup;                   ///< Deduplication of the environment builder, null if disabled
+    std::size_t m_node;                               ///< NUMA node of the worker, selects the shared replicas
 
 public:
     /**
      * @brief Constructs a Router with the specified environment builder.
      * @param envBuilder The shared pointer to the EnvironmentBuilder.
+     * @param node The NUMA node of the worker that owns the router.
      */
-    Router(const std::shared_ptr<EnvironmentBuilder>& envBuilder)
+    Router(const std::shared_ptr<EnvironmentBuilder>& envBuilder, std::size_t node = 0)
         : m_table()
         , m_mutex()
-        , m_envBuilder(envBuilder) {};
+        , m_snapshot(std::make_shared<const RouteSnapshot>())
+        , m_snapshotVersion(0)
+        , m_ingestSnapshot(m_snapshot)
+        , m_ingestVersion(0)
+        , m_accepted()
+        , m_envBuilder(envBuilder)
+        , m_tap(m_envBuilder->tap())
+        , m_dedup(m_envBuilder->dedup())
+        , m_node(node) {};
 
     /**
      * @brief Constructs a Router with the specified builder.
@@ -53,7 +157,15 @@ public:
     Router(const std::weak_ptr<builder::IBuilder>& builder, std::shared_ptr<bk::IControllerMaker> controllerMaker)
         : m_table()
         , m_mutex()
-        , m_envBuilder(std::make_shared<EnvironmentBuilder>(builder, controllerMaker)) {};
+        , m_snapshot(std::make_shared<const RouteSnapshot>())
+        , m_snapshotVersion(0)
+        , m_ingestSnapshot(m_snapshot)
+        , m_ingestVersion(0)
+        , m_accepted()
+        , m_envBuilder(std::make_shared<EnvironmentBuilder>(builder, controllerMaker))
+        , m_tap(m_envBuilder->tap())
+        , m_dedup(m_envBuilder->dedup())
+        , m_node(0) {};
 
     /**
      * @copydoc IRouter::addEntry
@@ -92,8 +204,19 @@ public:
 
     /**
      * @copydoc IRouter::ingest
+     *
+     * Called only by the worker thread that owns the router, it reads the routes without taking the table lock.
      */
     void ingest(base::Event&& event) override;
+
+    /**
+     * @copydoc IRouter::ingestBatch
+     *
+     * The events accepted by each route are ingested as a single batch once the whole batch is routed, so a route sees
+     * its events in order, but not interleaved with the events of the other routes. The shared decoders run while the
+     * batch is routed.
+     */
+    void ingestBatch(std::vector<base::Event>& events) override;
 };
 
 } // namespace router
@@ -0,0 +1,90 @@
+#ifndef _ROUTER_SESSION_LIMITER_HPP
+#define _ROUTER_SESSION_LIMITER_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace router
+{
+
+/**
+ * @brief Bounds the number of tests of the same session (test environment) that are queued or running at once
+ *
+ * A session that sends tests faster than the testers process them gets an error instead of filling the test queue,
+ * so the other sessions keep their share of the testers.
+ */
+class SessionLimiter
+{
+private:
+    std::size_t m_limit;                                   ///< Max tests in flight per session
+    std::unordered_map<std::string, std::size_t> m_flying; ///< Tests in flight by session, only the non zero ones
+    mutable std::mutex m_mutex;                            ///< Protects the map
+
+public:
+    /**
+     * @brief Construct a new Session Limiter object
+     *
+     * @param limit Max tests in flight per session
+     * @throw std::runtime_error if the limit is 0
+     */
+    explicit SessionLimiter(std::size_t limit)
+        : m_limit {limit}
+    {
+        if (m_limit == 0)
+        {
+            throw std::runtime_error {"The limit of tests per session must be greater than 0"};
+        }
+    }
+
+    /**
+     * @brief Take a slot of the session
+     *
+     * @param session Name of the session
+     * @return true if the slot was taken, false if the session already has the max tests in flight
+     */
+    bool tryAcquire(const std::string& session)
+    {
+        std::lock_guard lock {m_mutex};
+        auto& flying = m_flying[session];
+        if (flying >= m_limit)
+        {
+            return false;
+        }
+        ++flying;
+        return true;
+    }
+
+    /**
+     * @brief Give back a slot taken with tryAcquire
+     *
+     * @param session Name of the session
+     */
+    void release(const std::string& session)
+    {
+        std::lock_guard lock {m_mutex};
+        auto it = m_flying.find(session);
+        if (it != m_flying.end() && --it->second == 0)
+        {
+            m_flying.erase(it);
+        }
+    }
+
+    /**
+     * @brief Get the number of tests in flight of the session
+     */
+    std::size_t inFlight(const std::string& session) const
+    {
+        std::lock_guard lock {m_mutex};
+        auto it = m_flying.find(session);
+        return it == m_flying.end() ? 0 : it->second;
+    }
+
+    std::size_t limit() const { return m_limit; }
+};
+
+} // namespace router
+
+#endif // _ROUTER_SESSION_LIMITER_HPP
@@ -0,0 +1,181 @@
+#include "tap.hpp"
+
+namespace router
+{
+
+namespace
+{
+/**
+ * @brief Per-thread xorshift, decides which events are sampled without a shared counter.
+ */
+std::uint64_t nextRandom()
+{
+    static std::atomic<std::uint64_t> seeds {0};
+    thread_local std::uint64_t state = 0x9e3779b97f4a7c15ULL ^ (seeds.fetch_add(1, std::memory_order_relaxed) + 1);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+std::size_t roundUpPowerOf2(std::size_t value)
+{
+    std::size_t power = 2;
+    while (power < value)
+    {
+        power <<= 1;
+    }
+    return power;
+}
+} // namespace
+
+Tap::Tap(std::size_t capacity)
+    : m_enabled {false}
+    , m_config {std::make_shared<const Config>(Config {1.0, std::nullopt, ""})}
+    , m_cells(roundUpPowerOf2(capacity))
+    , m_mask {m_cells.size() - 1}
+    , m_head {0}
+    , m_tail {0}
+    , m_sampled {0}
+    , m_dropped {0}
+{
+    for (std::size_t i = 0; i < m_cells.size(); ++i)
+    {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+// Bounded MPMC queue of Dmitry Vyukov: the sequence of a cell tells the producers and the consumers whose turn it is,
+// so a position is claimed with a single compare and swap.
+bool Tap::push(std::string&& event)
+{
+    auto pos = m_head.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& cell = m_cells[pos & m_mask];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.event = std::move(event);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = m_head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Tap::pop(std::string& event)
+{
+    auto pos = m_tail.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& cell = m_cells[pos & m_mask];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+        if (diff == 0)
+        {
+            if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                event = std::move(cell.event);
+                cell.event.clear();
+                cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+base::OptError Tap::enable(double rate, const std::string& field, const std::string& value)
+{
+    if (!(rate > 0.0 && rate <= 1.0))
+    {
+        return base::Error {"The sample rate of the tap must be greater than 0 and at most 1"};
+    }
+
+    auto config = std::make_shared<const Config>(Config {
+        rate,
+        field.empty() ? std::nullopt : std::make_optional(json::FieldRef(json::Json::formatJsonPath(field))),
+        value});
+    std::atomic_store(&m_config, std::shared_ptr<const Config>(std::move(config)));
+
+    m_sampled.store(0, std::memory_order_relaxed);
+    m_dropped.store(0, std::memory_order_relaxed);
+    m_enabled.store(true, std::memory_order_release);
+    return std::nullopt;
+}
+
+void Tap::disable()
+{
+    m_enabled.store(false, std::memory_order_release);
+}
+
+void Tap::offer(const base::Event& event)
+{
+    if (!event)
+    {
+        return;
+    }
+
+    const auto config = std::atomic_load(&m_config);
+    if (config->rate < 1.0 && static_cast<double>(nextRandom() >> 11) * 0x1.0p-53 >= config->rate)
+    {
+        return;
+    }
+
+    if (config->field)
+    {
+        const auto value = event->getString(config->field.value());
+        if (!value || value.value() != config->value)
+        {
+            return;
+        }
+    }
+
+    thread_local rapidjson::StringBuffer buffer;
+    if (push(std::string(event->str(buffer))))
+    {
+        m_sampled.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+tap::Events Tap::drain(std::size_t max)
+{
+    tap::Events result {};
+    result.enabled = enabled();
+    result.rate = std::atomic_load(&m_config)->rate;
+
+    std::string event;
+    while ((max == 0 || result.events.size() < max) && pop(event))
+    {
+        result.events.emplace_back(std::move(event));
+    }
+
+    result.sampled = m_sampled.load(std::memory_order_relaxed);
+    result.dropped = m_dropped.load(std::memory_order_relaxed);
+    return result;
+}
+
+} // namespace router
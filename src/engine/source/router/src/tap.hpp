@@ -0,0 +1,107 @@
+#ifndef _ROUTER_TAP_HPP
+#define _ROUTER_TAP_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+#include <base/error.hpp>
+#include <base/json.hpp>
+
+#include <router/types.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Sampling tap of the production events.
+ *
+ * The workers offer each event to the tap before routing it. A copy of a fraction of the events, optionally only the
+ * ones with a value in a field, is kept in a bounded lock-free ring that is drained through the API. When the ring is
+ * full the sampled events are dropped and counted, the workers never wait on the tap. When the tap is disabled the
+ * workers only pay a relaxed atomic load per event.
+ */
+class Tap
+{
+private:
+    /**
+     * @brief Sampling settings, replaced as a whole when the tap is enabled
+     */
+    struct Config
+    {
+        double rate;                         ///< Fraction of the events sampled, (0, 1]
+        std::optional<json::FieldRef> field; ///< Field of the filter, empty to sample all the events
+        std::string value;                   ///< Value of the field required by the filter
+    };
+
+    struct alignas(64) Cell
+    {
+        std::atomic<std::size_t> sequence; ///< Position of the ring the cell is ready for
+        std::string event;                 ///< Serialized event
+    };
+
+    std::atomic<bool> m_enabled;                      ///< Checked by the workers on each event
+    std::shared_ptr<const Config> m_config;           ///< Accessed with the atomic shared_ptr functions
+    std::vector<Cell> m_cells;                        ///< Ring of sampled events, the size is a power of 2
+    std::size_t m_mask;                               ///< Size of the ring minus 1
+    alignas(64) std::atomic<std::size_t> m_head;      ///< Next position to write
+    alignas(64) std::atomic<std::size_t> m_tail;      ///< Next position to read
+    alignas(64) std::atomic<std::uint64_t> m_sampled; ///< Events copied to the ring
+    std::atomic<std::uint64_t> m_dropped;             ///< Sampled events dropped because the ring was full
+
+    bool push(std::string&& event);
+    bool pop(std::string& event);
+
+public:
+    constexpr static std::size_t DEFAULT_CAPACITY = 1024; ///< Default size of the ring
+
+    /**
+     * @brief Construct a disabled Tap
+     *
+     * @param capacity Max number of sampled events waiting to be drained, rounded up to a power of 2
+     */
+    explicit Tap(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Enable the tap, or change its settings if it is already enabled. The counters are reset.
+     *
+     * @param rate Fraction of the events sampled, (0, 1]
+     * @param field Field of the filter in dot notation, empty to sample all the events
+     * @param value Value of the field required by the filter
+     * @return base::OptError Error if the rate is out of range
+     */
+    base::OptError enable(double rate, const std::string& field = "", const std::string& value = "");
+
+    /**
+     * @brief Disable the tap, the events already sampled can still be drained
+     */
+    void disable();
+
+    /**
+     * @brief Check if the tap is enabled
+     */
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Sample an event, called by the workers for each event when the tap is enabled
+     *
+     * @param event Event to sample, it is not modified
+     */
+    void offer(const base::Event& event);
+
+    /**
+     * @brief Take the oldest sampled events out of the ring
+     *
+     * @param max Max number of events, 0 for all
+     * @return tap::Events The events, the status and the counters of the tap
+     */
+    tap::Events drain(std::size_t max);
+};
+
+} // namespace router
+
+#endif // _ROUTER_TAP_HPP
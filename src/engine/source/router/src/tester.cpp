@@ -1,5 +1,7 @@
 #include "tester.hpp"
 
+#include <base/result.hpp>
+
 namespace
 {
 /**
@@ -205,8 +207,12 @@ base::RespOrError<test::Output> Tester::ingestTest(base::Event&& event, const te
         }
     }
 
-    // Run the test
-    result->event() = entry.controller()->ingestGet(std::move(event));
+    // Run the test, the operations only keep their traces if there is an asset to trace
+    {
+        base::result::TracingScope tracing {!opt.assets().empty()
+                                            && opt.traceLevel() != test::Options::TraceLevel::NONE};
+        result->event() = entry.controller()->ingestGet(std::move(event));
+    }
 
     // Reset controller
     entry.controller()->unsubscribeAll();
@@ -1,10 +1,146 @@
 #include "worker.hpp"
 
+#include <chrono>
+
 #include <base/logging.hpp>
+#include <base/parseEvent.hpp>
+
+#include "numa.hpp"
 
 namespace router
 {
 
+void Worker::processTestQueue(int64_t timeout)
+{
+    test::QueueType testEvent {};
+    const auto popped = timeout > 0 ? m_tQueue->waitPop(testEvent, timeout) : m_tQueue->tryPop(testEvent);
+    if (popped && testEvent != nullptr)
+    {
+        auto& [event, opt, callback] = *testEvent;
+        auto output = m_tester->ingestTest(std::move(event), opt);
+        try
+        {
+            callback(std::move(output));
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Error when executing API callback: ", e.what());
+        }
+    }
+}
+
+namespace
+{
+/**
+ * @brief Move the rest of the batch of a stopped worker to the batch, the lock of the lane must be held
+ */
+std::size_t takePending(LaneOrder& lane, std::vector<base::Event>& batch)
+{
+    if (!lane.hasPending.load(std::memory_order_relaxed))
+    {
+        return 0;
+    }
+
+    batch = std::move(lane.pending);
+    lane.pending.clear();
+    lane.hasPending.store(false, std::memory_order_relaxed);
+    return batch.size();
+}
+} // namespace
+
+std::size_t Worker::fillBatch(std::vector<base::Event>& batch,
+                              std::shared_ptr<base::queue::iQueue<base::Event>>& source,
+                              std::shared_ptr<LaneOrder>& lane,
+                              std::unique_lock<std::mutex>& order)
+{
+    source = m_rQueue;
+    lane = m_laneOrder;
+    if (m_rawQueue)
+    {
+        // The events given back by the stopped workers are already parsed
+        if (auto count = m_rQueue->waitPopBulk(batch, m_batchSize, 0); count > 0)
+        {
+            return count;
+        }
+
+        return m_rawQueue->waitPopBulk(m_rawBatch, m_batchSize, WAIT_DEQUEUE_TIMEOUT_USEC);
+    }
+
+    if (!m_laneOrder)
+    {
+        return m_rQueue->waitPopBulk(batch, m_batchSize, WAIT_DEQUEUE_TIMEOUT_USEC);
+    }
+
+    // Wait for the batch of the own lane stolen by another worker, if any, to be ingested before the next one
+    order = std::unique_lock {m_laneOrder->mutex};
+    if (auto count = takePending(*m_laneOrder, batch); count > 0)
+    {
+        return count;
+    }
+    const auto timeout = m_stealLanes.empty() ? WAIT_DEQUEUE_TIMEOUT_USEC : STEAL_DEQUEUE_TIMEOUT_USEC;
+    if (auto count = m_rQueue->waitPopBulk(batch, m_batchSize, timeout); count > 0)
+    {
+        return count;
+    }
+    order.unlock();
+
+    // Own lane is idle, help the lanes with backlog. Only backlogged lanes are stolen from, and only when they have
+    // no batch in flight, so the events of a lane are still ingested in order.
+    for (const auto& stealLane : m_stealLanes)
+    {
+        if (stealLane.queue->size() <= m_batchSize && !stealLane.order->hasPending.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        order = std::unique_lock {stealLane.order->mutex, std::try_to_lock};
+        if (!order.owns_lock())
+        {
+            continue;
+        }
+
+        source = stealLane.queue;
+        lane = stealLane.order;
+        if (auto count = takePending(*stealLane.order, batch); count > 0)
+        {
+            return count;
+        }
+        if (auto count = stealLane.queue->waitPopBulk(batch, m_batchSize, 0); count > 0)
+        {
+            return count;
+        }
+        order.unlock();
+    }
+
+    return 0;
+}
+
+std::size_t Worker::parseRawBatch(std::vector<base::Event>& batch)
+{
+    for (const auto& rawEvent : m_rawBatch)
+    {
+        // Null events only wake up the worker
+        if (rawEvent == nullptr)
+        {
+            continue;
+        }
+
+        try
+        {
+            batch.emplace_back(
+                base::parseEvent::parseWazuhEvent(rawEvent->str(), m_eventArenas ? m_eventArenas->acquire() : nullptr));
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Error parsing event: '{}' (discarding...)", e.what());
+        }
+    }
+
+    // The buffers go back to their pool
+    m_rawBatch.clear();
+    return batch.size();
+}
+
 void Worker::start(const EpsLimit& epsLimit)
 {
     if (m_isRunning)
@@ -17,31 +153,114 @@ void Worker::start(const EpsLimit& epsLimit)
         [this, epsLimit]()
         {
             std::size_t tID = std::hash<std::thread::id> {}(std::this_thread::get_id());
-            LOG_DEBUG("Router Worker {} started", tID);
+
+            if (!numa::pinThread(m_placement.cpus))
+            {
+                LOG_WARNING("Worker {} cannot be pinned to the CPUs of NUMA node {}", tID, m_placement.node);
+            }
+
+            // Tester only worker, it blocks on the test queue
+            if (!m_rQueue)
+            {
+                LOG_DEBUG("Tester Worker {} started", tID);
+                while (m_isRunning)
+                {
+                    processTestQueue(WAIT_DEQUEUE_TIMEOUT_USEC);
+                }
+                LOG_DEBUG("Tester Worker {} finished", tID);
+                return;
+            }
+
+            LOG_DEBUG("Router Worker {} started (batch size {})", tID, m_batchSize);
+
+            // Events dequeued but not yet ingested (pending due to the eps limit)
+            std::vector<base::Event> batch {};
+            batch.reserve(m_batchSize);
+            std::size_t next {0};
+            std::vector<base::Event> admitted {}; // Events of the batch admitted by the eps limit
+            admitted.reserve(m_batchSize);
+            std::shared_ptr<base::queue::iQueue<base::Event>> source {}; // Queue of the batch
+            std::shared_ptr<LaneOrder> lane {};                          // Lane of the batch, if source is a lane
+            std::unique_lock<std::mutex> order {};                       // Order lock of the lane of the batch
+
+            auto elapsedNs = [](std::chrono::steady_clock::time_point& since)
+            {
+                const auto now = std::chrono::steady_clock::now();
+                const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - since).count();
+                since = now;
+                return static_cast<std::uint64_t>(elapsed);
+            };
+            auto since = std::chrono::steady_clock::now();
+
             while (m_isRunning)
             {
-                // Process test queue
-                test::QueueType testEvent {};
-                if (m_tQueue->tryPop(testEvent) && testEvent != nullptr)
+                // Process test queue, once per batch, unless the tests run on their own workers
+                if (m_tQueue)
                 {
-                    auto& [event, opt, callback] = *testEvent;
-                    auto output = m_tester->ingestTest(std::move(event), opt);
-                    try
+                    processTestQueue();
+                }
+
+                // Refill the batch only when all the previous events were ingested
+                if (next == batch.size())
+                {
+                    batch.clear();
+                    next = 0;
+                    if (order.owns_lock())
                     {
-                        callback(std::move(output));
+                        order.unlock();
                     }
-                    catch (const std::exception& e)
+                    auto count = fillBatch(batch, source, lane, order);
+                    m_load->idleNs.fetch_add(elapsedNs(since), std::memory_order_relaxed);
+                    if (!m_rawBatch.empty())
                     {
-                        LOG_ERROR("Error when executing API callback: ", e.what());
+                        // Parsing is busy time of the worker, it is done here instead of on the endpoint
+                        count = parseRawBatch(batch);
+                    }
+                    if (count == 0)
+                    {
+                        continue;
                     }
                 }
 
-                // Process production queue
-                base::Event event {};
-                if (!epsLimit() && m_rQueue->waitPop(event, WAIT_DEQUEUE_TIMEOUT_USEC) && event != nullptr)
+                // Process production events, keep the remaining ones if the eps limit is reached
+                for (; next < batch.size() && m_isRunning; ++next)
                 {
-                    m_router->ingest(std::move(event));
+                    if (epsLimit())
+                    {
+                        break;
+                    }
+
+                    if (batch[next] != nullptr)
+                    {
+                        admitted.emplace_back(std::move(batch[next]));
+                    }
                 }
+                if (!admitted.empty())
+                {
+                    m_router->ingestBatch(admitted);
+                }
+                m_load->busyNs.fetch_add(elapsedNs(since), std::memory_order_relaxed);
+            }
+
+            // Give back the pending events, another worker ingests them
+            std::vector<base::Event> pending {};
+            for (; next < batch.size(); ++next)
+            {
+                if (batch[next] != nullptr)
+                {
+                    pending.emplace_back(std::move(batch[next]));
+                }
+            }
+            if (!pending.empty() && order.owns_lock())
+            {
+                // Pushed back to the lane they would go after the newer events of the same agents, the next worker
+                // that takes the lane ingests them first
+                lane->pending = std::move(pending);
+                lane->hasPending.store(true, std::memory_order_relaxed);
+            }
+            else if (!pending.empty())
+            {
+                source->pushBulk(pending);
             }
             LOG_DEBUG("Router Worker {} finished", tID);
         });
@@ -3,12 +3,17 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
+#include <base/jsonArena.hpp>
 #include <queue/iqueue.hpp>
 
+#include <router/rawEvent.hpp>
 #include <router/types.hpp>
 
+#include "autoscaler.hpp"
 #include "environmentBuilder.hpp"
 #include "iworker.hpp"
 #include "router.hpp"
@@ -18,6 +23,40 @@ namespace router
 {
 
 constexpr auto WAIT_DEQUEUE_TIMEOUT_USEC = 1 * 100000;
+constexpr auto STEAL_DEQUEUE_TIMEOUT_USEC = 1 * 1000;  ///< Wait on the own lane before trying to steal
+constexpr std::size_t DEFAULT_BATCH_SIZE = 1; ///< Default number of events dequeued at once by a worker
+
+/**
+ * @brief NUMA node of a worker and the CPUs its thread is restricted to
+ */
+struct Placement
+{
+    std::size_t node {0};  ///< Node of the worker, selects its replicas of the shared environments
+    std::vector<int> cpus; ///< CPUs of the node, empty to run anywhere
+};
+
+/**
+ * @brief Order lock of a lane, and the events of a batch of the lane that a stopped worker did not ingest
+ *
+ * The lock is held from the pop of a batch until all its events are ingested, so the owner and the workers that
+ * steal from the lane never ingest two batches of the same lane at once. A worker that stops in the middle of a batch
+ * leaves the rest of it here, and the next worker that takes the lock ingests them before popping the lane again.
+ */
+struct LaneOrder
+{
+    std::mutex mutex;                    ///< One batch of the lane in flight at a time
+    std::vector<base::Event> pending;    ///< Rest of the batch of a stopped worker, it goes before the lane
+    std::atomic_bool hasPending {false}; ///< If pending is not empty, read without the lock
+};
+
+/**
+ * @brief Event queue of a worker in sharded mode and its order lock
+ */
+struct Lane
+{
+    std::shared_ptr<base::queue::iQueue<base::Event>> queue; ///< Events of the lane
+    std::shared_ptr<LaneOrder> order;                        ///< Order lock of the lane
+};
 
 class Worker : public IWorker
 {
@@ -29,26 +68,115 @@ private:
 
     std::shared_ptr<base::queue::iQueue<base::Event>> m_rQueue;     ///< The router queue
     std::shared_ptr<base::queue::iQueue<test::QueueType>> m_tQueue; ///< The tester queue
+    std::size_t m_batchSize;                                        ///< Max number of events dequeued at once
+
+    std::shared_ptr<LaneOrder> m_laneOrder; ///< Order lock of the own queue (lane), nullptr if it is not a lane
+    std::vector<Lane> m_stealLanes;          ///< Lanes of other workers to steal from when the own lane is idle
+
+    std::shared_ptr<WorkerLoad> m_load; ///< Busy and idle time, read by the autoscaler
+    Placement m_placement;              ///< Where the worker thread runs
+
+    std::shared_ptr<RawQueueType> m_rawQueue;       ///< Events as received, parsed here, nullptr if they come parsed
+    std::shared_ptr<json::ArenaPool> m_eventArenas; ///< Arenas for the events parsed here, nullptr to disable
+    std::vector<RawEventPtr> m_rawBatch;            ///< Raw events dequeued and not parsed yet
+
+    /**
+     * @brief Process one pending test event, if any
+     *
+     * @param timeout Time to wait for a test event in microseconds, 0 to return at once
+     */
+    void processTestQueue(int64_t timeout = 0);
+
+    /**
+     * @brief Fill the batch with the events of the own queue, or steal them from a backlogged lane
+     *
+     * @param batch The batch to fill
+     * @param source Set to the queue the events come from
+     * @param lane Set to the order lock of the lane the events come from, nullptr if the queue is not a lane
+     * @param order Set to the lock of lane, it must be kept until the events are ingested
+     * @return std::size_t Number of events dequeued
+     */
+    std::size_t fillBatch(std::vector<base::Event>& batch,
+                          std::shared_ptr<base::queue::iQueue<base::Event>>& source,
+                          std::shared_ptr<LaneOrder>& lane,
+                          std::unique_lock<std::mutex>& order);
+
+    /**
+     * @brief Parse the dequeued raw events into the batch, the invalid ones are discarded
+     *
+     * @param batch The batch to fill
+     * @return std::size_t Number of events in the batch
+     */
+    std::size_t parseRawBatch(std::vector<base::Event>& batch);
 
 public:
     /**
      * @brief Construct a new Worker object
      *
+     * @param envBuilder The environment builder
+     * @param rQueue The router (production) queue, nullptr for a worker that only runs tests
+     * @param tQueue The tester queue, nullptr for a worker that never runs tests
+     * @param batchSize Max number of production events dequeued at once
+     * @param laneOrder Order lock of rQueue if it is a lane, required to steal
+     * @param stealLanes Lanes of other workers, used when the own lane is idle, in steal order
+     * @param placement NUMA node and CPUs of the worker thread
+     * @param rawQueue Production events as received, parsed by the worker, nullptr if rQueue is the only source. The
+     * rQueue is still drained first, it gets the events given back by the stopped workers
+     * @param eventArenas Arenas for the events parsed by the worker, nullptr to disable
+     * @throw std::logic_error if both queues are empty, a steal lane or a needed order lock is empty, the batch size is
+     * 0 or there is a raw queue without a router queue or with steal lanes
      */
     Worker(std::shared_ptr<EnvironmentBuilder> envBuilder,
            std::shared_ptr<base::queue::iQueue<base::Event>> rQueue,
-           std::shared_ptr<base::queue::iQueue<test::QueueType>> tQueue)
-        : m_router(std::make_shared<Router>(envBuilder))
+           std::shared_ptr<base::queue::iQueue<test::QueueType>> tQueue,
+           std::size_t batchSize = DEFAULT_BATCH_SIZE,
+           std::shared_ptr<LaneOrder> laneOrder = nullptr,
+           std::vector<Lane> stealLanes = {},
+           Placement placement = {},
+           std::shared_ptr<RawQueueType> rawQueue = nullptr,
+           std::shared_ptr<json::ArenaPool> eventArenas = nullptr)
+        : m_router(std::make_shared<Router>(envBuilder, placement.node))
         , m_tester(std::make_shared<Tester>(envBuilder))
         , m_isRunning(false)
         , m_thread()
         , m_rQueue(rQueue)
         , m_tQueue(tQueue)
+        , m_batchSize(batchSize)
+        , m_laneOrder(std::move(laneOrder))
+        , m_stealLanes(std::move(stealLanes))
+        , m_load(std::make_shared<WorkerLoad>())
+        , m_placement(std::move(placement))
+        , m_rawQueue(std::move(rawQueue))
+        , m_eventArenas(std::move(eventArenas))
     {
-        if (!m_rQueue || !m_tQueue)
+        if (!m_rQueue && !m_tQueue)
         {
             throw std::logic_error("Invalid queues for the worker");
         }
+
+        if (!m_stealLanes.empty() && (!m_rQueue || !m_laneOrder))
+        {
+            throw std::logic_error("A worker without a router lane cannot steal events");
+        }
+
+        for (const auto& lane : m_stealLanes)
+        {
+            if (!lane.queue || !lane.order)
+            {
+                throw std::logic_error("Invalid steal lane for the worker");
+            }
+        }
+
+        if (m_batchSize == 0)
+        {
+            throw std::logic_error("Invalid batch size for the worker");
+        }
+
+        if (m_rawQueue && (!m_rQueue || m_laneOrder))
+        {
+            throw std::logic_error("A worker with a raw queue needs a router queue and cannot steal events");
+        }
+        m_rawBatch.reserve(m_rawQueue ? m_batchSize : 0);
     }
 
     ~Worker() { stop(); }
@@ -60,9 +188,17 @@ public:
 
     /**
      * @copydoc IWorker::stop
+     *
+     * The events dequeued but not yet ingested are pushed back to the queue they come from, so a worker can be
+     * stopped while the router keeps running.
      */
     void stop() override;
 
+    /**
+     * @brief Get the busy and idle time of the worker
+     */
+    const std::shared_ptr<WorkerLoad>& load() const { return m_load; }
+
     const std::shared_ptr<IRouter>& getRouter() const { return m_router; }
     const std::shared_ptr<ITester>& getTester() const { return m_tester; }
 };
@@ -22,6 +22,13 @@ public:
     MOCK_METHOD(base::OptError, changeEpsSettings, (uint eps, uint refreshInterval), (override));
     MOCK_METHOD((base::RespOrError<std::tuple<uint, uint, bool>>), getEpsSettings, (), (const, override));
     MOCK_METHOD(base::OptError, activateEpsCounter, (bool activate), (override));
+    MOCK_METHOD(base::OptError, activateProfiler, (bool activate, std::size_t sampleRate), (override));
+    MOCK_METHOD(base::RespOrError<::router::prof::Report>, getProfilerReport, (std::size_t top), (const, override));
+    MOCK_METHOD(base::OptError,
+                activateTap,
+                (bool activate, double rate, const std::string& field, const std::string& value),
+                (override));
+    MOCK_METHOD(base::RespOrError<::router::tap::Events>, getTapEvents, (std::size_t max), (override));
 };
 
 }
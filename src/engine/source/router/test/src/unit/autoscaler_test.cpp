@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include "autoscaler.hpp"
+
+namespace
+{
+router::Autoscaler::Options makeOptions(std::size_t minWorkers, std::size_t maxWorkers)
+{
+    router::Autoscaler::Options options;
+    options.minWorkers = minWorkers;
+    options.maxWorkers = maxWorkers;
+    options.batchSize = 10;
+    options.upTicks = 2;
+    options.downTicks = 3;
+    return options;
+}
+
+router::LoadSample saturated()
+{
+    router::LoadSample sample;
+    sample.queued = 1000;
+    sample.busyRatio = 0.95;
+    return sample;
+}
+
+router::LoadSample idle()
+{
+    router::LoadSample sample;
+    sample.queued = 0;
+    sample.busyRatio = 0.05;
+    return sample;
+}
+} // namespace
+
+TEST(AutoscalerTest, InvalidOptions)
+{
+    EXPECT_THROW(router::Autoscaler(makeOptions(0, 2)), std::runtime_error);
+    EXPECT_THROW(router::Autoscaler(makeOptions(3, 2)), std::runtime_error);
+
+    auto options = makeOptions(1, 2);
+    options.busyLow = options.busyHigh;
+    EXPECT_THROW(router::Autoscaler {options}, std::runtime_error);
+
+    options = makeOptions(1, 2);
+    options.upTicks = 0;
+    EXPECT_THROW(router::Autoscaler {options}, std::runtime_error);
+}
+
+TEST(AutoscalerTest, ScaleUpAfterConsecutiveTicks)
+{
+    router::Autoscaler autoscaler {makeOptions(1, 4)};
+
+    EXPECT_EQ(autoscaler.decide(saturated(), 1), 0);
+    EXPECT_EQ(autoscaler.decide(saturated(), 1), 1);
+    // The counter restarts after a change
+    EXPECT_EQ(autoscaler.decide(saturated(), 2), 0);
+    EXPECT_EQ(autoscaler.decide(saturated(), 2), 1);
+}
+
+TEST(AutoscalerTest, Hysteresis)
+{
+    router::Autoscaler autoscaler {makeOptions(1, 4)};
+
+    // A tick between the thresholds restarts both counters
+    router::LoadSample steady;
+    steady.queued = 5;
+    steady.busyRatio = 0.5;
+
+    EXPECT_EQ(autoscaler.decide(saturated(), 2), 0);
+    EXPECT_EQ(autoscaler.decide(steady, 2), 0);
+    EXPECT_EQ(autoscaler.decide(saturated(), 2), 0);
+
+    EXPECT_EQ(autoscaler.decide(idle(), 2), 0);
+    EXPECT_EQ(autoscaler.decide(idle(), 2), 0);
+    EXPECT_EQ(autoscaler.decide(steady, 2), 0);
+    EXPECT_EQ(autoscaler.decide(idle(), 2), 0);
+    EXPECT_EQ(autoscaler.decide(idle(), 2), 0);
+    EXPECT_EQ(autoscaler.decide(idle(), 2), -1);
+}
+
+TEST(AutoscalerTest, Bounds)
+{
+    router::Autoscaler autoscaler {makeOptions(2, 3)};
+
+    for (auto i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(autoscaler.decide(saturated(), 3), 0);
+        EXPECT_EQ(autoscaler.decide(idle(), 2), 0);
+    }
+}
+
+TEST(AutoscalerTest, BacklogScalesUp)
+{
+    router::Autoscaler autoscaler {makeOptions(1, 4)};
+
+    // Workers waiting on a slow dequeue but the queue keeps growing
+    router::LoadSample sample;
+    sample.queued = 25;
+    sample.busyRatio = 0.5;
+
+    EXPECT_EQ(autoscaler.decide(sample, 2), 0);
+    EXPECT_EQ(autoscaler.decide(sample, 2), 1);
+    EXPECT_EQ(autoscaler.decide(sample, 3), 0);
+    EXPECT_EQ(autoscaler.decide(sample, 3), 0);
+}
+
+TEST(AutoscalerTest, NoCpuHeadroomOrThrottled)
+{
+    router::Autoscaler autoscaler {makeOptions(1, 4)};
+
+    auto noCpu = saturated();
+    noCpu.cpuIdle = 0.01;
+    auto throttled = saturated();
+    throttled.throttled = true;
+
+    for (auto i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(autoscaler.decide(noCpu, 1), 0);
+        EXPECT_EQ(autoscaler.decide(throttled, 1), 0);
+    }
+}
+
+TEST(CpuSamplerTest, IdleFraction)
+{
+    const auto path = std::string {"/tmp/autoscaler_test_stat"};
+    auto write = [&path](const std::string& line)
+    {
+        std::ofstream file {path, std::ios::trunc};
+        file << line << "\ncpu0 0 0 0 0 0 0 0 0\n";
+    };
+
+    write("cpu  100 0 100 700 100 0 0 0");
+    router::CpuSampler sampler {path};
+
+    // 400 jiffies, 100 of them idle or waiting on IO
+    write("cpu  300 0 200 780 120 0 0 0");
+    EXPECT_DOUBLE_EQ(sampler.idle(), 0.25);
+
+    // No time elapsed
+    EXPECT_DOUBLE_EQ(sampler.idle(), 1);
+
+    std::remove(path.c_str());
+    EXPECT_DOUBLE_EQ(sampler.idle(), 1);
+}
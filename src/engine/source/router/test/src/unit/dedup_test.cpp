@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "dedup.hpp"
+
+using namespace router;
+
+namespace
+{
+base::Event makeEvent(const std::string& ip, const std::string& message)
+{
+    const auto raw = R"({"source": {"ip": ")" + ip + R"("}, "message": ")" + message + R"("})";
+    return std::make_shared<json::Json>(raw.c_str());
+}
+} // namespace
+
+TEST(DedupTest, InvalidWindow)
+{
+    EXPECT_THROW(Dedup({}, std::chrono::milliseconds {0}), std::runtime_error);
+}
+
+TEST(DedupTest, WholeEvent)
+{
+    std::int64_t now = 0;
+    Dedup dedup({}, std::chrono::seconds {10}, Dedup::DEFAULT_BITS, [&now]() { return now; });
+
+    EXPECT_FALSE(dedup.isDuplicate(makeEvent("1.1.1.1", "a")));
+    EXPECT_TRUE(dedup.isDuplicate(makeEvent("1.1.1.1", "a")));
+    EXPECT_FALSE(dedup.isDuplicate(makeEvent("1.1.1.1", "b")));
+    EXPECT_FALSE(dedup.isDuplicate(makeEvent("2.2.2.2", "a")));
+    EXPECT_EQ(dedup.dropped(), 1);
+}
+
+TEST(DedupTest, Fields)
+{
+    std::int64_t now = 0;
+    Dedup dedup({"source.ip"}, std::chrono::seconds {10}, Dedup::DEFAULT_BITS, [&now]() { return now; });
+
+    EXPECT_FALSE(dedup.isDuplicate(makeEvent("1.1.1.1", "a")));
+    EXPECT_TRUE(dedup.isDuplicate(makeEvent("1.1.1.1", "b")));
+    EXPECT_FALSE(dedup.isDuplicate(makeEvent("2.2.2.2", "a")));
+
+    // A missing field is part of the fingerprint too
+    EXPECT_FALSE(dedup.isDuplicate(std::make_shared<json::Json>(R"({"message": "a"})")));
+    EXPECT_TRUE(dedup.isDuplicate(std::make_shared<json::Json>(R"({"message": "b"})")));
+    EXPECT_FALSE(dedup.isDuplicate(std::make_shared<json::Json>(R"({"source": {"ip": ""}})")));
+}
+
+TEST(DedupTest, Window)
+{
+    std::int64_t now = 0;
+    Dedup dedup({"source.ip"}, std::chrono::seconds {10}, Dedup::DEFAULT_BITS, [&now]() { return now; });
+
+    EXPECT_FALSE(dedup.isDuplicate(makeEvent("1.1.1.1", "a")));
+
+    // Still in the previous generation
+    now += 15000;
+    EXPECT_TRUE(dedup.isDuplicate(makeEvent("1.1.1.1", "a")));
+
+    // A burst lets one event through every one or two windows
+    now += 10000;
+    EXPECT_FALSE(dedup.isDuplicate(makeEvent("1.1.1.1", "a")));
+    EXPECT_TRUE(dedup.isDuplicate(makeEvent("1.1.1.1", "a")));
+
+    // Long idle periods clear all the generations
+    now += 100000;
+    EXPECT_FALSE(dedup.isDuplicate(makeEvent("1.1.1.1", "a")));
+}
+
+TEST(DedupTest, FalsePositives)
+{
+    Dedup dedup({"source.ip"}, std::chrono::seconds {60});
+
+    std::size_t dropped = 0;
+    for (auto i = 0; i < 100000; ++i)
+    {
+        dropped += dedup.isDuplicate(makeEvent(std::to_string(i), "a")) ? 1 : 0;
+    }
+
+    EXPECT_LT(dropped, 10);
+}
+
+TEST(DedupTest, ConcurrentWorkers)
+{
+    Dedup dedup({"source.ip"}, std::chrono::seconds {60});
+
+    std::atomic<std::size_t> passed {0};
+    std::vector<std::thread> workers;
+    for (auto t = 0; t < 4; ++t)
+    {
+        workers.emplace_back(
+            [&dedup, &passed]()
+            {
+                for (auto i = 0; i < 1000; ++i)
+                {
+                    if (!dedup.isDuplicate(makeEvent(std::to_string(i % 100), "a")))
+                    {
+                        ++passed;
+                    }
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    // Two workers may let the same new fingerprint through at the same time
+    EXPECT_GE(passed.load(), 100);
+    EXPECT_LE(passed.load(), 400);
+    EXPECT_EQ(dedup.dropped(), 4000 - passed.load());
+}
@@ -97,3 +97,101 @@ TEST(EnvironmentBuilderTest, Create_ValidPolicyAndInvalidFilter)
     EXPECT_CALL(*mockController, stop()).WillOnce(Return());
     ASSERT_THROW(eBuilder.create(policyName, filterName), std::runtime_error);
 }
+
+class EnvironmentBuilderShareTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<builder::mocks::MockBuilder> m_builder;
+    std::shared_ptr<bk::mocks::MockMakerController> m_controllerMaker;
+    std::shared_ptr<builder::mocks::MockPolicy> m_policy;
+    std::unordered_set<base::Name> m_assets;
+    base::Expression m_expression;
+    std::string m_hash;
+
+    const base::Name m_policyName {"policy/test/0"};
+    const base::Name m_filterName {"filter/test/0"};
+
+    void SetUp() override
+    {
+        m_builder = std::make_shared<builder::mocks::MockBuilder>();
+        m_controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+        m_policy = std::make_shared<builder::mocks::MockPolicy>();
+        m_assets = {base::Name("asset/test/0")};
+        m_hash = "hash";
+
+        EXPECT_CALL(*m_policy, assets()).WillRepeatedly(ReturnRef(m_assets));
+        EXPECT_CALL(*m_policy, expression()).WillRepeatedly(ReturnRef(m_expression));
+        EXPECT_CALL(*m_policy, hash()).WillRepeatedly(ReturnRef(m_hash));
+    }
+
+    /**
+     * @brief Expect the build of the route the given number of times
+     */
+    void expectBuilds(int times, bool threadSafe)
+    {
+        auto controller = std::make_shared<bk::mocks::MockController>();
+        EXPECT_CALL(*controller, isThreadSafe()).WillRepeatedly(Return(threadSafe));
+        EXPECT_CALL(*controller, stop()).WillRepeatedly(Return());
+
+        EXPECT_CALL(*m_builder, buildPolicy(m_policyName))
+            .Times(times)
+            .WillRepeatedly(Return(std::shared_ptr<builder::IPolicy>(m_policy)));
+        EXPECT_CALL(*m_controllerMaker, create(testing::_, testing::_, testing::_))
+            .Times(times)
+            .WillRepeatedly(Return(controller));
+        EXPECT_CALL(*m_builder, buildAsset(m_filterName)).Times(times).WillRepeatedly(Return(m_expression));
+    }
+};
+
+TEST_F(EnvironmentBuilderShareTest, CreateShared_ReusedInScope)
+{
+    EnvironmentBuilder eBuilder(m_builder, m_controllerMaker, true);
+    expectBuilds(2, true);
+
+    std::shared_ptr<Environment> first;
+    {
+        auto scope = eBuilder.shareScope();
+        first = eBuilder.createShared(m_policyName, m_filterName);
+        auto second = eBuilder.createShared(m_policyName, m_filterName);
+        ASSERT_NE(first, nullptr);
+        ASSERT_EQ(first, second);
+    }
+
+    // Closed scope, a reload builds a new environment
+    auto other = eBuilder.createShared(m_policyName, m_filterName);
+    ASSERT_NE(other, first);
+}
+
+TEST_F(EnvironmentBuilderShareTest, CreateShared_NotThreadSafe)
+{
+    EnvironmentBuilder eBuilder(m_builder, m_controllerMaker, true);
+    expectBuilds(2, false);
+
+    auto scope = eBuilder.shareScope();
+    auto first = eBuilder.createShared(m_policyName, m_filterName);
+    auto second = eBuilder.createShared(m_policyName, m_filterName);
+    ASSERT_NE(first, second);
+}
+
+TEST_F(EnvironmentBuilderShareTest, CreateShared_Disabled)
+{
+    EnvironmentBuilder eBuilder(m_builder, m_controllerMaker);
+    expectBuilds(2, true);
+
+    auto scope = eBuilder.shareScope();
+    auto first = eBuilder.createShared(m_policyName, m_filterName);
+    auto second = eBuilder.createShared(m_policyName, m_filterName);
+    ASSERT_NE(first, second);
+}
+
+TEST_F(EnvironmentBuilderShareTest, CreateShared_ReplicaPerNode)
+{
+    EnvironmentBuilder eBuilder(m_builder, m_controllerMaker, true);
+    expectBuilds(2, true);
+
+    auto scope = eBuilder.shareScope();
+    auto node0 = eBuilder.createShared(m_policyName, m_filterName, 0);
+    auto node1 = eBuilder.createShared(m_policyName, m_filterName, 1);
+    ASSERT_NE(node0, node1);
+    ASSERT_EQ(node1, eBuilder.createShared(m_policyName, m_filterName, 1));
+}
@@ -73,26 +73,89 @@ TEST(EpsCounter, LimitReachedSingleThread)
     EXPECT_EQ(counter.limitReached(), false);
     EXPECT_EQ(counter.limitReached(), true);
     std::this_thread::sleep_for(std::chrono::seconds(1));
-    EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), false);
-    std::this_thread::sleep_for(std::chrono::seconds(1));
     EXPECT_EQ(counter.limitReached(), true);
+    EXPECT_EQ(counter.limitReached(), true);
+    std::this_thread::sleep_for(std::chrono::seconds(1));
     EXPECT_EQ(counter.limitReached(), false);
     EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), true);
     std::this_thread::sleep_for(std::chrono::seconds(1));
-    EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), false);
     EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), true);
 }
 
+TEST(EpsCounter, NoBurstAfterIdle)
+{
+    // The bucket holds a tenth of the EPS, so idle periods do not accumulate more tokens
+    auto counter = T::EpsCounter(20, 3, true);
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    EXPECT_EQ(counter.acquire(100), 2);
+    EXPECT_EQ(counter.acquire(100), 0);
+}
+
+TEST(EpsCounter, WorstCaseBurst)
+{
+    // A full bucket drained at once and refilled during the next second, at most 1.1 * eps in one second
+    auto counter = T::EpsCounter(100, 1, true);
+    EXPECT_EQ(counter.acquire(1000), 10);
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_EQ(counter.acquire(1000), 10);
+    EXPECT_EQ(counter.acquire(1000), 0);
+}
+
+TEST(EpsCounter, CapacityFollowsTheWorkers)
+{
+    // A local batch (eps / 100) for each worker, up to the EPS
+    auto counter = T::EpsCounter(1000, 1, true);
+    EXPECT_EQ(counter.localBatch(), 10);
+    counter.setWorkers(20);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(counter.acquire(1000), 200);
+
+    counter.setWorkers(1000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    EXPECT_EQ(counter.acquire(2000), 1000);
+
+    // Fewer workers shrink the bucket
+    counter.setWorkers(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(counter.acquire(1000), 100);
+}
+
+TEST(EpsCounter, IntervalDoesNotChangeAdmission)
+{
+    auto counter = T::EpsCounter(100, 1, true);
+    auto counter1 = T::EpsCounter(100, 60, true);
+    EXPECT_EQ(counter.acquire(1000), counter1.acquire(1000));
+}
+
+TEST(EpsCounter, AcquireBatch)
+{
+    auto counter = T::EpsCounter(100, 2, true);
+    EXPECT_EQ(counter.acquire(7), 7);
+    EXPECT_EQ(counter.acquire(7), 3);
+    EXPECT_EQ(counter.acquire(7), 0);
+    EXPECT_EQ(counter.localBatch(), 1);
+}
+
+TEST(EpsCounter, ChangeSettingsShrinksBucket)
+{
+    auto counter = T::EpsCounter(100, 2, true);
+    counter.changeSettings(10, 1);
+    EXPECT_EQ(counter.acquire(10), 1);
+    EXPECT_EQ(counter.acquire(10), 0);
+}
+
 TEST(EpsCounter, LimitReachedMultipleThreads)
 {
     auto nThreads = 5;
     auto counter = std::make_shared<T::EpsCounter>(nThreads, 1, true);
+    counter->setWorkers(nThreads);
+    std::this_thread::sleep_for(std::chrono::seconds(1)); // Fill the bucket grown for the workers
     auto results = std::make_shared<std::vector<std::vector<bool>>>();
 
     for (auto i = 0; i < nThreads; i++)
@@ -127,6 +190,8 @@ TEST(EpsCounter, LimitReachedMultipleThreads)
     }
 
     counter = std::make_shared<T::EpsCounter>(nThreads - 1, 1, true);
+    counter->setWorkers(nThreads);
+    std::this_thread::sleep_for(std::chrono::seconds(1)); // Fill the bucket grown for the workers
     results = std::make_shared<std::vector<std::vector<bool>>>();
     for (auto i = 0; i < nThreads; i++)
     {
@@ -0,0 +1,125 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include <base/json.hpp>
+#include <mockMetricsScope.hpp>
+
+#include "latency.hpp"
+
+using namespace router;
+
+namespace
+{
+class FakeHistogram : public metricsManager::iHistogram<uint64_t>
+{
+public:
+    std::vector<uint64_t> values;
+
+    void recordValue(const uint64_t& value) override { values.emplace_back(value); }
+};
+
+base::Expression makeStage(const std::string& name)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [](base::Event event)
+                                              { return base::result::makeFailure(std::move(event)); });
+}
+
+/**
+ * @brief Run the operands of a chain in order, as the backends do
+ */
+void run(const base::Expression& chain, const base::Event& event)
+{
+    for (const auto& operand : chain->getPtr<base::Operation>()->getOperands())
+    {
+        operand->getPtr<base::Term<base::EngineOp>>()->getFn()(event);
+    }
+}
+
+class PipelineLatencyTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MockMetricsScope> m_scope;
+    std::map<std::string, std::shared_ptr<FakeHistogram>> m_histograms;
+
+    void SetUp() override
+    {
+        m_scope = std::make_shared<MockMetricsScope>();
+        ON_CALL(*m_scope, getLatencyHistogram(testing::_))
+            .WillByDefault(
+                [this](const std::string& name)
+                {
+                    auto& histogram = m_histograms[name];
+                    if (!histogram)
+                    {
+                        histogram = std::make_shared<FakeHistogram>();
+                    }
+                    return histogram;
+                });
+    }
+};
+} // namespace
+
+TEST_F(PipelineLatencyTest, NullScope)
+{
+    EXPECT_THROW(PipelineLatency {nullptr}, std::runtime_error);
+}
+
+TEST_F(PipelineLatencyTest, StageNames)
+{
+    EXPECT_EQ(PipelineLatency::stageName("decoderInput"), "Decode");
+    EXPECT_EQ(PipelineLatency::stageName("ruleInput"), "Rules");
+    EXPECT_EQ(PipelineLatency::stageName("outputInput"), "Outputs");
+    EXPECT_EQ(PipelineLatency::stageName("other"), "other");
+}
+
+TEST_F(PipelineLatencyTest, NotAChain)
+{
+    EXPECT_CALL(*m_scope, getLatencyHistogram(testing::_)).Times(0);
+    PipelineLatency latency {m_scope};
+
+    auto expression = makeStage("decoderInput");
+    EXPECT_EQ(latency.instrument("route", expression), expression);
+}
+
+TEST_F(PipelineLatencyTest, TimesEachStage)
+{
+    EXPECT_CALL(*m_scope, getLatencyHistogram(testing::_)).Times(3);
+    PipelineLatency latency {m_scope};
+
+    auto policy = base::Chain::create(
+        "policy/test/0", {makeStage("decoderInput"), makeStage("ruleInput"), makeStage("outputInput")});
+    auto timed = latency.instrument("route", policy);
+
+    ASSERT_TRUE(timed->isChain());
+    EXPECT_EQ(timed->getName(), "policy/test/0");
+    EXPECT_EQ(timed->getPtr<base::Operation>()->getOperands().size(), 7);
+    EXPECT_EQ(policy->getPtr<base::Operation>()->getOperands().size(), 3);
+
+    auto event = std::make_shared<json::Json>();
+    run(timed, event);
+    run(timed, event);
+
+    for (const auto& name : {"route.Decode", "route.Rules", "route.Outputs"})
+    {
+        ASSERT_EQ(m_histograms.count(name), 1) << name;
+        EXPECT_EQ(m_histograms[name]->values.size(), 2) << name;
+    }
+}
+
+TEST_F(PipelineLatencyTest, OtherEventIsNotTimed)
+{
+    PipelineLatency latency {m_scope};
+    auto timed = latency.instrument("route", base::Chain::create("policy/test/0", {makeStage("decoderInput")}));
+    const auto& operands = timed->getPtr<base::Operation>()->getOperands();
+
+    // The stage ends with an event other than the one it started with
+    auto first = std::make_shared<json::Json>();
+    auto second = std::make_shared<json::Json>();
+    operands[0]->getPtr<base::Term<base::EngineOp>>()->getFn()(first);
+    operands[2]->getPtr<base::Term<base::EngineOp>>()->getFn()(second);
+
+    EXPECT_TRUE(m_histograms["route.Decode"]->values.empty());
+}
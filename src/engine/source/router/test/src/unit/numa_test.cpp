@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "numa.hpp"
+
+using namespace router::numa;
+
+TEST(NumaTest, ParseCpuList)
+{
+    EXPECT_EQ(parseCpuList("0"), std::vector<int>({0}));
+    EXPECT_EQ(parseCpuList("0-3,8,10-11\n"), std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(parseCpuList("4,2-3,3"), std::vector<int>({2, 3, 4}));
+    EXPECT_TRUE(parseCpuList("").empty());
+}
+
+TEST(NumaTest, ParseInvalidCpuList)
+{
+    EXPECT_THROW(parseCpuList("a"), std::runtime_error);
+    EXPECT_THROW(parseCpuList("1-"), std::runtime_error);
+    EXPECT_THROW(parseCpuList("3-1"), std::runtime_error);
+    EXPECT_THROW(parseCpuList("1,,2"), std::runtime_error);
+}
+
+TEST(NumaTest, Nodes)
+{
+    const auto path = std::filesystem::temp_directory_path() / "router_numa_test";
+    std::filesystem::remove_all(path);
+    auto addNode = [&](const std::string& name, const std::string& cpus)
+    {
+        std::filesystem::create_directories(path / name);
+        std::ofstream(path / name / "cpulist") << cpus << "\n";
+    };
+    addNode("node1", "4-7");
+    addNode("node0", "0-3");
+    addNode("node2", ""); // Memory only
+    std::filesystem::create_directories(path / "power");
+
+    auto result = nodes(path.string());
+    std::filesystem::remove_all(path);
+
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].id, 0);
+    EXPECT_EQ(result[0].cpus, std::vector<int>({0, 1, 2, 3}));
+    EXPECT_EQ(result[1].id, 1);
+    EXPECT_EQ(result[1].cpus, std::vector<int>({4, 5, 6, 7}));
+}
+
+TEST(NumaTest, NodesWithoutTopology)
+{
+    EXPECT_TRUE(nodes("/nonexistent/router/numa").empty());
+}
+
+TEST(NumaTest, NodeOfSpreadsContiguousBlocks)
+{
+    EXPECT_EQ(nodeOf(0, 4, 2), 0);
+    EXPECT_EQ(nodeOf(1, 4, 2), 0);
+    EXPECT_EQ(nodeOf(2, 4, 2), 1);
+    EXPECT_EQ(nodeOf(3, 4, 2), 1);
+    EXPECT_EQ(nodeOf(2, 5, 2), 0);
+    EXPECT_EQ(nodeOf(3, 5, 2), 1);
+    EXPECT_EQ(nodeOf(0, 1, 2), 0);
+    EXPECT_EQ(nodeOf(3, 4, 0), 0);
+}
+
+TEST(NumaTest, PinThread)
+{
+    EXPECT_TRUE(pinThread({}));
+}
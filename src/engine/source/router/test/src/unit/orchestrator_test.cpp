@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <queue/mockQueue.hpp>
 #include <store/mockStore.hpp>
 
 #include <router/orchestrator.hpp>
@@ -25,6 +26,23 @@ public:
         m_wStore = m_mockstore;
     };
 
+    auto addMockLanes(std::size_t count) -> std::vector<std::shared_ptr<queue::mocks::MockQueue<base::Event>>>
+    {
+        std::vector<std::shared_ptr<queue::mocks::MockQueue<base::Event>>> lanes;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto lane = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+            m_eventLanes.emplace_back(lane);
+            lanes.emplace_back(lane);
+        }
+        return lanes;
+    }
+
+    const std::shared_ptr<ProdQueueType>& selectQueueToTest(const base::Event& event) const
+    {
+        return selectQueue(event);
+    }
+
     auto forEachWorkerMock(std::function<void(std::shared_ptr<MockWorker>)> func)
     {
         for (auto& mock : m_mocks)
@@ -863,3 +881,50 @@ TEST_F(OrchestratorTest, postStrEventFailtureInProtocol)
 {
     EXPECT_TRUE(base::isError(m_orchestrator->postStrEvent("message:1:any")));
 }
+
+TEST_F(OrchestratorTest, shardedLaneAffinity)
+{
+    auto lanes = m_orchestrator->addMockLanes(m_workersSize);
+
+    auto makeEvent = [](const std::string& location)
+    {
+        auto event = std::make_shared<json::Json>();
+        event->setString(location, base::parseEvent::EVENT_LOCATION_ID);
+        return event;
+    };
+
+    // The same location is always routed to the same lane
+    auto& lane = m_orchestrator->selectQueueToTest(makeEvent("[001] (agent) any->/var/log/syslog"));
+    for (auto i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(lane, m_orchestrator->selectQueueToTest(makeEvent("[001] (agent) any->/var/log/syslog")));
+    }
+
+    // All the events of an agent are routed to the same lane, whatever their source
+    EXPECT_EQ(lane, m_orchestrator->selectQueueToTest(makeEvent("[001] (agent) any->/var/log/auth.log")));
+    EXPECT_EQ(lane, m_orchestrator->selectQueueToTest(makeEvent("[001] (agent) any->syscheck")));
+
+    // The events of the manager too
+    auto& managerLane = m_orchestrator->selectQueueToTest(makeEvent("/var/log/syslog"));
+    EXPECT_EQ(managerLane, m_orchestrator->selectQueueToTest(makeEvent("syscheck")));
+
+    // Events without location are routed to a lane too
+    EXPECT_NE(m_orchestrator->selectQueueToTest(std::make_shared<json::Json>()), nullptr);
+    EXPECT_NE(m_orchestrator->selectQueueToTest(nullptr), nullptr);
+}
+
+TEST_F(OrchestratorTest, shardedPostEvent)
+{
+    auto lanes = m_orchestrator->addMockLanes(m_workersSize);
+    auto event = std::make_shared<json::Json>();
+    event->setString("[002] (agent) any->/var/log/auth.log", base::parseEvent::EVENT_LOCATION_ID);
+
+    auto selected = std::static_pointer_cast<queue::mocks::MockQueue<base::Event>>(
+        m_orchestrator->selectQueueToTest(event));
+    for (auto& lane : lanes)
+    {
+        EXPECT_CALL(*lane, push(testing::_)).Times(lane == selected ? 1 : 0);
+    }
+
+    m_orchestrator->postEvent(std::move(event));
+}
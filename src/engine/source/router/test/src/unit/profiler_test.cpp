@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+
+#include "profiler.hpp"
+
+namespace
+{
+base::Expression makeTerm(const std::string& name, bool success)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [success](base::Event event)
+                                              {
+                                                  return success ? base::result::makeSuccess(std::move(event))
+                                                                 : base::result::makeFailure(std::move(event));
+                                              });
+}
+
+/**
+ * @brief Asset with a condition on the field of the event and a map in its consequence
+ */
+base::Expression makeAsset(const std::string& name, bool match)
+{
+    auto condition =
+        base::And::create("condition", {makeTerm("field: int_equal(1)", match), makeTerm("AcceptAll", true)});
+    auto consequence = base::And::create("consequence", {makeTerm("target: map(2)", true)});
+    return base::Implication::create(name, condition, consequence);
+}
+
+/**
+ * @brief Minimal evaluation of the operations used in the tests
+ */
+bool evaluate(const base::Expression& expression)
+{
+    if (expression->isTerm())
+    {
+        return expression->getPtr<base::Term<base::EngineOp>>()->getFn()(nullptr).success();
+    }
+
+    const auto& operands = expression->getPtr<base::Operation>()->getOperands();
+    if (expression->isImplication())
+    {
+        if (!evaluate(operands[0]))
+        {
+            return false;
+        }
+        evaluate(operands[1]);
+        return true;
+    }
+    if (expression->isAnd())
+    {
+        for (const auto& operand : operands)
+        {
+            if (!evaluate(operand))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (expression->isOr())
+    {
+        for (const auto& operand : operands)
+        {
+            if (evaluate(operand))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Broadcast and chain
+    for (const auto& operand : operands)
+    {
+        evaluate(operand);
+    }
+    return true;
+}
+
+const router::prof::Stats* find(const std::vector<router::prof::Stats>& stats, const std::string& name)
+{
+    for (const auto& stat : stats)
+    {
+        if (stat.name == name)
+        {
+            return &stat;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+TEST(ProfilerTest, ZeroSampleRate)
+{
+    EXPECT_THROW(router::Profiler(1, 0), std::runtime_error);
+}
+
+TEST(ProfilerTest, InstrumentKeepsStructure)
+{
+    router::Profiler profiler(1, 1);
+    auto expression = base::Or::create("decoder", {makeAsset("decoder/match/0", true)});
+    auto instrumented = profiler.instrument(expression);
+
+    ASSERT_NE(instrumented, expression);
+    ASSERT_TRUE(instrumented->isOr());
+    EXPECT_EQ(instrumented->getName(), "decoder");
+    const auto& asset = instrumented->getPtr<base::Operation>()->getOperands()[0];
+    ASSERT_TRUE(asset->isImplication());
+    EXPECT_EQ(asset->getName(), "decoder/match/0");
+    EXPECT_EQ(asset->getPtr<base::Operation>()->getOperands().size(), 2);
+    EXPECT_TRUE(evaluate(instrumented));
+}
+
+TEST(ProfilerTest, CountsAssetsAndHelpers)
+{
+    router::Profiler profiler(2, 1);
+    auto expression =
+        base::Or::create("decoder", {makeAsset("decoder/other/0", false), makeAsset("decoder/match/0", true)});
+    auto instrumented = profiler.instrument(expression);
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(evaluate(instrumented));
+    }
+
+    auto report = profiler.report(0);
+    EXPECT_EQ(report.sampleRate, 1);
+    ASSERT_EQ(report.assets.size(), 2);
+
+    auto other = find(report.assets, "decoder/other/0");
+    ASSERT_NE(other, nullptr);
+    EXPECT_EQ(other->calls, 3);
+    EXPECT_EQ(other->matches, 0);
+
+    auto match = find(report.assets, "decoder/match/0");
+    ASSERT_NE(match, nullptr);
+    EXPECT_EQ(match->calls, 3);
+    EXPECT_EQ(match->matches, 3);
+
+    auto intEqual = find(report.helpers, "int_equal");
+    ASSERT_NE(intEqual, nullptr);
+    EXPECT_EQ(intEqual->calls, 6);
+    EXPECT_EQ(intEqual->matches, 3);
+
+    auto map = find(report.helpers, "map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(map->calls, 3);
+    EXPECT_EQ(map->matches, 3);
+}
+
+TEST(ProfilerTest, OriginalNotCounted)
+{
+    router::Profiler profiler(1, 1);
+    auto expression = makeAsset("decoder/match/0", true);
+    profiler.instrument(expression);
+
+    EXPECT_TRUE(evaluate(expression));
+
+    auto report = profiler.report(0);
+    auto match = find(report.assets, "decoder/match/0");
+    ASSERT_NE(match, nullptr);
+    EXPECT_EQ(match->calls, 0);
+}
+
+TEST(ProfilerTest, ReportTop)
+{
+    router::Profiler profiler(1, 1);
+    auto expression = base::Or::create(
+        "decoder",
+        {makeAsset("decoder/a/0", false), makeAsset("decoder/b/0", false), makeAsset("decoder/c/0", true)});
+    evaluate(profiler.instrument(expression));
+
+    auto report = profiler.report(2);
+    ASSERT_EQ(report.assets.size(), 2);
+    EXPECT_GE(report.assets[0].totalNs, report.assets[1].totalNs);
+    EXPECT_LE(report.helpers.size(), 2);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <router/rawEvent.hpp>
+
+using namespace router;
+
+TEST(RawEventPoolTest, InvalidArguments)
+{
+    EXPECT_THROW(RawEventPool(0), std::runtime_error);
+    EXPECT_NO_THROW(RawEventPool(1));
+}
+
+TEST(RawEventPoolTest, AcquireCopiesTheBytes)
+{
+    RawEventPool pool;
+    auto event = pool.acquire("1:location:message");
+    ASSERT_NE(event, nullptr);
+    EXPECT_EQ(event->str(), "1:location:message");
+}
+
+TEST(RawEventPoolTest, ReuseReleasedBuffers)
+{
+    RawEventPool pool(2);
+    EXPECT_EQ(pool.available(), 0);
+
+    auto event = pool.acquire("1:location:first message");
+    const auto* buffer = event->str().data();
+    event.reset();
+    EXPECT_EQ(pool.available(), 1);
+
+    // Same buffer, the new bytes fit in it
+    auto reused = pool.acquire("1:location:second");
+    EXPECT_EQ(pool.available(), 0);
+    EXPECT_EQ(reused->str(), "1:location:second");
+    EXPECT_EQ(reused->str().data(), buffer);
+}
+
+TEST(RawEventPoolTest, KeepAtMostMaxBuffers)
+{
+    RawEventPool pool(2);
+    {
+        auto first = pool.acquire("1:a:a");
+        auto second = pool.acquire("1:b:b");
+        auto third = pool.acquire("1:c:c");
+    }
+    EXPECT_EQ(pool.available(), 2);
+}
+
+TEST(RawEventPoolTest, DropBigBuffers)
+{
+    RawEventPool pool(2, 64);
+    pool.acquire(std::string(128, 'a')).reset();
+    EXPECT_EQ(pool.available(), 0);
+
+    pool.acquire(std::string(32, 'a')).reset();
+    EXPECT_EQ(pool.available(), 1);
+}
+
+TEST(RawEventPoolTest, EventsOutliveThePool)
+{
+    RawEventPtr event;
+    {
+        RawEventPool pool;
+        event = pool.acquire("1:location:message");
+    }
+    EXPECT_EQ(event->str(), "1:location:message");
+    event.reset();
+}
+
+TEST(RawEventPoolTest, ReleaseFromOtherThreads)
+{
+    RawEventPool pool(64);
+    std::vector<RawEventPtr> events;
+    for (auto i = 0; i < 64; ++i)
+    {
+        events.emplace_back(pool.acquire("1:location:" + std::to_string(i)));
+    }
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t)
+    {
+        std::vector<RawEventPtr> share(events.begin() + t * 16, events.begin() + (t + 1) * 16);
+        threads.emplace_back([share = std::move(share)]() mutable { share.clear(); });
+    }
+    events.clear();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(pool.available(), 64);
+}
@@ -367,3 +367,157 @@ TEST_F(RouterTest, IngestSuccess)
 
     EXPECT_TRUE(ingestEvent());
 }
+
+TEST_F(RouterTest, IngestAfterRemoveEntry)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+
+    enableEntry(ENVIRONMENT_NAME);
+    EXPECT_TRUE(ingestEvent());
+
+    // The removed route must not receive more events.
+    EXPECT_TRUE(removeEntry(ENVIRONMENT_NAME));
+    EXPECT_CALL(*m_mockController, ingest(testing::_)).Times(0);
+    m_router->ingest(std::make_shared<json::Json>(R"({"key": "value"})"));
+}
+
+TEST_F(RouterTest, IngestIndexedByFilterValue)
+{
+    auto discriminator = [](const std::string& agentId)
+    {
+        auto value = json::Json();
+        value.setString(agentId);
+        return builder::AssetDiscriminator {.field = "/agent/id", .value = std::move(value)};
+    };
+
+    EXPECT_CALL(*m_mockBuilder, assetDiscriminator(testing::_)).WillOnce(::testing::Return(discriminator("001")));
+    addEntry(router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY}, false);
+    EXPECT_CALL(*m_mockBuilder, assetDiscriminator(testing::_)).WillOnce(::testing::Return(discriminator("002")));
+    addEntry(router::prod::EntryPost {ENVIRONMENT_NAME + "mirror", POLICY_NAME, FILTER_NAME, PRIORITY + 1}, false);
+    stopControllerCall(2);
+
+    enableEntry(ENVIRONMENT_NAME);
+    enableEntry(ENVIRONMENT_NAME + "mirror");
+
+    // The filters accept any event, only the index keeps the events of other agents out of the routes
+    EXPECT_CALL(*m_mockController, ingest(testing::_)).Times(1);
+    m_router->ingest(std::make_shared<json::Json>(R"({"agent": {"id": "003"}})"));
+    m_router->ingest(std::make_shared<json::Json>(R"({"agent": {"id": "002"}})"));
+}
+
+TEST_F(RouterTest, IngestTeeRoute)
+{
+    auto teeEntry = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    teeEntry.tee(true);
+    addEntry(teeEntry, false);
+    addEntry(router::prod::EntryPost {ENVIRONMENT_NAME + "archive", POLICY_NAME, FILTER_NAME, PRIORITY + 1}, false);
+    addEntry(router::prod::EntryPost {ENVIRONMENT_NAME + "last", POLICY_NAME, FILTER_NAME, PRIORITY + 2}, false);
+    stopControllerCall(3);
+
+    enableEntry(ENVIRONMENT_NAME);
+    enableEntry(ENVIRONMENT_NAME + "archive");
+    enableEntry(ENVIRONMENT_NAME + "last");
+
+    // The tee route gets a copy, the next accepting route takes the original and the routing stops there
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    const auto* original = event.get();
+    std::vector<base::Event> received;
+    EXPECT_CALL(*m_mockController, ingest(testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke([&received](base::Event&& event) { received.push_back(event); }));
+    m_router->ingest(std::move(event));
+
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_NE(received[0].get(), original);
+    EXPECT_EQ(received[1].get(), original);
+    EXPECT_EQ(*received[0], *received[1]);
+}
+
+TEST_F(RouterTest, IngestTeeRoutesWithTheSameDecodersDecodeOnce)
+{
+    // The policies of both routes are built with the same decoders
+    base::Expression decoders = base::And::create("decoders", {});
+    base::Expression postDecoders = base::Chain::create("postDecoders", {});
+    EXPECT_CALL(*m_mockPolicy, decoders()).WillRepeatedly(::testing::Return(decoders));
+    EXPECT_CALL(*m_mockPolicy, postDecoders()).WillRepeatedly(::testing::Return(postDecoders));
+
+    auto teeEntry = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    teeEntry.tee(true);
+    addEntry(teeEntry, false);
+    addEntry(router::prod::EntryPost {ENVIRONMENT_NAME + "last", POLICY_NAME, FILTER_NAME, PRIORITY + 1}, false);
+    stopControllerCall(2);
+
+    // One controller runs the shared decoders, each route gets one of its rules and outputs
+    auto decodersController = std::make_shared<bk::mocks::MockController>();
+    auto postController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*m_mockControllerMaker, create(testing::Eq(decoders), testing::_, testing::_))
+        .WillOnce(::testing::Return(decodersController));
+    EXPECT_CALL(*m_mockControllerMaker, create(testing::Eq(postDecoders), testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(::testing::Return(postController));
+    EXPECT_CALL(*decodersController, stop()).Times(1);
+    EXPECT_CALL(*postController, stop()).Times(2);
+
+    enableEntry(ENVIRONMENT_NAME);
+    enableEntry(ENVIRONMENT_NAME + "last");
+
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    const auto* original = event.get();
+    std::vector<base::Event> received;
+    EXPECT_CALL(*m_mockController, ingest(testing::_)).Times(0);
+    EXPECT_CALL(*decodersController, ingestGet(testing::_))
+        .WillOnce(testing::Invoke(
+            [](base::Event&& event)
+            {
+                event->setString("decoded", "/stage");
+                return event;
+            }));
+    EXPECT_CALL(*postController, ingest(testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke([&received](base::Event&& event) { received.push_back(event); }));
+    m_router->ingest(std::move(event));
+
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_NE(received[0].get(), original);
+    EXPECT_EQ(received[1].get(), original);
+    EXPECT_EQ(received[0]->getString("/stage"), "decoded");
+    EXPECT_EQ(*received[0], *received[1]);
+}
+
+TEST_F(RouterTest, IngestBatchKeepsTheOrderOfEachRoute)
+{
+    auto teeEntry = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    teeEntry.tee(true);
+    addEntry(teeEntry, false);
+    addEntry(router::prod::EntryPost {ENVIRONMENT_NAME + "last", POLICY_NAME, FILTER_NAME, PRIORITY + 1}, false);
+    stopControllerCall(2);
+
+    enableEntry(ENVIRONMENT_NAME);
+    enableEntry(ENVIRONMENT_NAME + "last");
+
+    // Each route ingests its events at once and in order, the tee route first as it is the first to accept one
+    std::vector<base::Event> events {std::make_shared<json::Json>(R"({"seq": 1})"),
+                                     std::make_shared<json::Json>(R"({"seq": 2})")};
+    std::vector<const json::Json*> originals {events[0].get(), events[1].get()};
+    std::vector<base::Event> received;
+    EXPECT_CALL(*m_mockController, ingestGet(testing::_))
+        .Times(4)
+        .WillRepeatedly(testing::Invoke(
+            [&received](base::Event&& event)
+            {
+                received.push_back(event);
+                return event;
+            }));
+    m_router->ingestBatch(events);
+
+    EXPECT_TRUE(events.empty());
+    ASSERT_EQ(received.size(), 4);
+    EXPECT_EQ(*received[0], *received[2]);
+    EXPECT_EQ(*received[1], *received[3]);
+    EXPECT_NE(received[0].get(), originals[0]);
+    EXPECT_EQ(received[2].get(), originals[0]);
+    EXPECT_EQ(received[3].get(), originals[1]);
+    EXPECT_EQ(received[2]->getInt("/seq"), 1);
+    EXPECT_EQ(received[3]->getInt("/seq"), 2);
+}
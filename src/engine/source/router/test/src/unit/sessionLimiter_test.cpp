@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "sessionLimiter.hpp"
+
+TEST(SessionLimiterTest, InvalidLimit)
+{
+    EXPECT_THROW(router::SessionLimiter {0}, std::runtime_error);
+}
+
+TEST(SessionLimiterTest, LimitPerSession)
+{
+    router::SessionLimiter limiter {2};
+
+    EXPECT_TRUE(limiter.tryAcquire("a"));
+    EXPECT_TRUE(limiter.tryAcquire("a"));
+    EXPECT_FALSE(limiter.tryAcquire("a"));
+    EXPECT_EQ(limiter.inFlight("a"), 2);
+
+    // Other sessions keep their slots
+    EXPECT_TRUE(limiter.tryAcquire("b"));
+    EXPECT_EQ(limiter.inFlight("b"), 1);
+}
+
+TEST(SessionLimiterTest, Release)
+{
+    router::SessionLimiter limiter {1};
+
+    EXPECT_TRUE(limiter.tryAcquire("a"));
+    EXPECT_FALSE(limiter.tryAcquire("a"));
+    limiter.release("a");
+    EXPECT_EQ(limiter.inFlight("a"), 0);
+    EXPECT_TRUE(limiter.tryAcquire("a"));
+
+    // Releasing a session without slots is ignored
+    limiter.release("b");
+    EXPECT_EQ(limiter.inFlight("b"), 0);
+    EXPECT_TRUE(limiter.tryAcquire("b"));
+}
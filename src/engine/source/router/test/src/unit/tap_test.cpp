@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "tap.hpp"
+
+using namespace router;
+
+namespace
+{
+base::Event makeEvent(const std::string& id)
+{
+    const auto raw = R"({"agent": {"id": ")" + id + R"("}})";
+    return std::make_shared<json::Json>(raw.c_str());
+}
+} // namespace
+
+TEST(TapTest, DisabledByDefault)
+{
+    Tap tap;
+    EXPECT_FALSE(tap.enabled());
+
+    auto events = tap.drain(0);
+    EXPECT_FALSE(events.enabled);
+    EXPECT_TRUE(events.events.empty());
+}
+
+TEST(TapTest, InvalidRate)
+{
+    Tap tap;
+    EXPECT_TRUE(base::isError(tap.enable(0)));
+    EXPECT_TRUE(base::isError(tap.enable(1.5)));
+    EXPECT_TRUE(base::isError(tap.enable(-0.5)));
+    EXPECT_FALSE(tap.enabled());
+}
+
+TEST(TapTest, SampleAllInOrder)
+{
+    Tap tap;
+    ASSERT_FALSE(base::isError(tap.enable(1)));
+    for (auto i = 0; i < 10; ++i)
+    {
+        tap.offer(makeEvent(std::to_string(i)));
+    }
+
+    auto first = tap.drain(4);
+    ASSERT_EQ(first.events.size(), 4);
+    EXPECT_EQ(json::Json(first.events.front().c_str()).getString("/agent/id").value(), "0");
+    EXPECT_EQ(first.sampled, 10);
+
+    auto rest = tap.drain(0);
+    ASSERT_EQ(rest.events.size(), 6);
+    EXPECT_EQ(json::Json(rest.events.back().c_str()).getString("/agent/id").value(), "9");
+    EXPECT_TRUE(tap.drain(0).events.empty());
+}
+
+TEST(TapTest, Filter)
+{
+    Tap tap;
+    ASSERT_FALSE(base::isError(tap.enable(1, "agent.id", "2")));
+    for (auto i = 0; i < 5; ++i)
+    {
+        tap.offer(makeEvent(std::to_string(i)));
+    }
+
+    auto events = tap.drain(0);
+    ASSERT_EQ(events.events.size(), 1);
+    EXPECT_EQ(json::Json(events.events.front().c_str()).getString("/agent/id").value(), "2");
+}
+
+TEST(TapTest, Rate)
+{
+    Tap tap(16384);
+    ASSERT_FALSE(base::isError(tap.enable(0.1)));
+    const auto event = makeEvent("1");
+    for (auto i = 0; i < 10000; ++i)
+    {
+        tap.offer(event);
+    }
+
+    auto events = tap.drain(0);
+    EXPECT_GT(events.events.size(), 700);
+    EXPECT_LT(events.events.size(), 1300);
+}
+
+TEST(TapTest, DropWhenFull)
+{
+    Tap tap(8);
+    ASSERT_FALSE(base::isError(tap.enable(1)));
+    const auto event = makeEvent("1");
+    for (auto i = 0; i < 20; ++i)
+    {
+        tap.offer(event);
+    }
+
+    auto events = tap.drain(0);
+    EXPECT_EQ(events.events.size(), 8);
+    EXPECT_EQ(events.sampled, 8);
+    EXPECT_EQ(events.dropped, 12);
+}
+
+TEST(TapTest, DisableKeepsSampledEvents)
+{
+    Tap tap;
+    ASSERT_FALSE(base::isError(tap.enable(1)));
+    tap.offer(makeEvent("1"));
+    tap.disable();
+
+    auto events = tap.drain(0);
+    EXPECT_FALSE(events.enabled);
+    EXPECT_EQ(events.events.size(), 1);
+}
+
+TEST(TapTest, ConcurrentProducers)
+{
+    constexpr auto threads = 4;
+    constexpr auto perThread = 1000;
+    Tap tap(threads * perThread);
+    ASSERT_FALSE(base::isError(tap.enable(1)));
+
+    std::vector<std::thread> producers;
+    for (auto t = 0; t < threads; ++t)
+    {
+        producers.emplace_back(
+            [&tap, t]()
+            {
+                const auto event = makeEvent(std::to_string(t));
+                for (auto i = 0; i < perThread; ++i)
+                {
+                    tap.offer(event);
+                }
+            });
+    }
+
+    std::size_t drained = 0;
+    while (drained < threads * perThread)
+    {
+        drained += tap.drain(0).events.size();
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    auto events = tap.drain(0);
+    EXPECT_TRUE(events.events.empty());
+    EXPECT_EQ(events.sampled, threads * perThread);
+    EXPECT_EQ(events.dropped, 0);
+}
@@ -9,44 +9,53 @@ namespace schemf
 void Schema::Validator::registerCompatibles()
 {
     m_compatibles.emplace(Type::BOOLEAN,
-                          ValidationInfo {json::Json::Type::Boolean, validators::getBoolValidator(), {}});
+                          ValidationInfo {json::Json::Type::Boolean, validators::getBoolValidator(), true, {}});
     m_compatibles.emplace(Type::BYTE,
                           ValidationInfo {json::Json::Type::Number,
                                           validators::getShortValidator(),
+                                          false,
                                           {{Type::INTEGER, true}, {Type::LONG, true}, {Type::SHORT, false}}});
     m_compatibles.emplace(Type::SHORT,
                           ValidationInfo {json::Json::Type::Number,
                                           validators::getShortValidator(),
+                                          false,
                                           {{Type::INTEGER, true}, {Type::LONG, true}, {Type::BYTE, false}}});
     m_compatibles.emplace(Type::INTEGER,
                           ValidationInfo {json::Json::Type::Number,
                                           validators::getIntegerValidator(),
+                                          false,
                                           {{Type::LONG, true}, {Type::SHORT, false}, {Type::BYTE, false}}});
     m_compatibles.emplace(Type::LONG,
                           ValidationInfo {json::Json::Type::Number,
                                           validators::getLongValidator(),
+                                          false,
                                           {{Type::INTEGER, false}, {Type::SHORT, false}, {Type::BYTE, false}}});
     m_compatibles.emplace(
         Type::FLOAT,
         ValidationInfo {json::Json::Type::Number,
                         validators::getFloatValidator(),
+                        false,
                         {{Type::DOUBLE, true}, {Type::HALF_FLOAT, false}, {Type::SCALED_FLOAT, false}}});
     m_compatibles.emplace(Type::HALF_FLOAT,
                           ValidationInfo {json::Json::Type::Number,
                                           validators::getFloatValidator(),
+                                          false,
                                           {{Type::FLOAT, false}, {Type::DOUBLE, true}, {Type::SCALED_FLOAT, false}}});
     m_compatibles.emplace(Type::SCALED_FLOAT,
                           ValidationInfo {json::Json::Type::Number,
                                           validators::getFloatValidator(),
+                                          false,
                                           {{Type::FLOAT, false}, {Type::HALF_FLOAT, false}, {Type::DOUBLE, true}}});
     m_compatibles.emplace(
         Type::DOUBLE,
         ValidationInfo {json::Json::Type::Number,
                         validators::getDoubleValidator(),
+                        false,
                         {{Type::FLOAT, false}, {Type::HALF_FLOAT, false}, {Type::SCALED_FLOAT, false}}});
     m_compatibles.emplace(Type::KEYWORD,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getStringValidator(),
+                                          true,
                                           {{Type::TEXT, false},
                                            {Type::DATE, false},
                                            {Type::DATE_NANOS, false},
@@ -55,6 +64,7 @@ void Schema::Validator::registerCompatibles()
     m_compatibles.emplace(Type::TEXT,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getStringValidator(),
+                                          true,
                                           {{Type::KEYWORD, false},
                                            {Type::DATE, false},
                                            {Type::DATE_NANOS, false},
@@ -63,25 +73,29 @@ void Schema::Validator::registerCompatibles()
     m_compatibles.emplace(Type::DATE,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getDateValidator(),
+                                          false,
                                           {{Type::KEYWORD, true}, {Type::TEXT, true}}});
     m_compatibles.emplace(Type::DATE_NANOS,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getStringValidator(),
+                                          true,
                                           {{Type::KEYWORD, true}, {Type::TEXT, true}}});
     m_compatibles.emplace(Type::IP,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getIpValidator(),
+                                          false,
                                           {{Type::KEYWORD, true}, {Type::TEXT, true}}});
     m_compatibles.emplace(Type::BINARY,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getBinaryValidator(),
+                                          false,
                                           {{Type::KEYWORD, true}, {Type::TEXT, true}}});
     m_compatibles.emplace(Type::OBJECT,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), true, {}});
     m_compatibles.emplace(Type::NESTED,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), true, {}});
     m_compatibles.emplace(Type::GEO_POINT,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), true, {}});
 }
 
 base::RespOrError<ValidationResult> Schema::Validator::validate(const DotPath& name, const JTypeToken& token) const
@@ -96,6 +110,12 @@ base::RespOrError<ValidationResult> Schema::Validator::validate(const DotPath& n
                                         json::Json::typeToStr(entry.type))};
     }
 
+    // The operation already produces a value of the JSON type, nothing else to check at runtime.
+    if (entry.typeOnly)
+    {
+        return ValidationResult();
+    }
+
     // When validating json types, if the schema type has a validator, use it.
     return ValidationResult(token.isArray() ? asArray(entry.validator) : entry.validator);
 }
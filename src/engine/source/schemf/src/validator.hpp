@@ -12,6 +12,7 @@ struct ValidationInfo
 {
     json::Json::Type type;    ///< Associated JSON type.
     ValueValidator validator; ///< Validator for the json value.
+    bool typeOnly;            ///< Whether the validator only checks the JSON type, so a value of that type is valid.
     /// Compatible types. The bool value indicates whether the compatible type needs additional validation.
     std::unordered_map<schemf::Type, bool> compatibles;
 };
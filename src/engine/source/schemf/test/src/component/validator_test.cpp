@@ -42,6 +42,10 @@ const std::set<ST> ALLSCHEMATYPES = {ST::BOOLEAN,
 
 const std::set<JT> ALLJTYPES = {JT::Boolean, JT::Number, JT::String, JT::Object};
 
+// Schema types whose value is valid as long as it has the expected JSON type
+const std::set<ST> TYPEONLYSCHEMATYPES = {
+    ST::BOOLEAN, ST::KEYWORD, ST::TEXT, ST::DATE_NANOS, ST::OBJECT, ST::NESTED, ST::GEO_POINT};
+
 const json::Json J_BOOL {"true"};
 const json::Json J_BYTE {"1"};
 const json::Json J_SHORT {"1"};
@@ -100,7 +104,7 @@ namespace buildvalidationtest
 // targetField schemaType
 // valid schemaTypes(does not need runtime validation)
 // valid schemaTypes(does need runtime validation)
-// valid jsonTypes(does need runtime validation)
+// valid jsonTypes(does need runtime validation, unless the schema type only checks the json type)
 using BuildT = std::tuple<ST, std::set<ST>, std::set<ST>, std::set<JT>>;
 
 class BuildValidation : public TestWithParam<BuildT>
@@ -254,6 +258,7 @@ TEST_P(BuildValidation, CompatibleJType)
 
     auto target = getField(targetType);
     auto targetArray = getArrayField(targetType);
+    auto runtime = TYPEONLYSCHEMATYPES.count(targetType) == 0;
 
     // Non array success json validations
     for (auto type : validJTypesRun)
@@ -263,7 +268,7 @@ TEST_P(BuildValidation, CompatibleJType)
                                  GFAIL_CASE,
                                  schemf::typeToStr(targetType),
                                  json::Json::typeToStr(type));
-        validateTest(validator, target, valToken, true, true, trace);
+        validateTest(validator, target, valToken, true, runtime, trace);
     }
 
     // Array success json validations
@@ -274,7 +279,7 @@ TEST_P(BuildValidation, CompatibleJType)
                                  GFAIL_CASE,
                                  schemf::typeToStr(targetType),
                                  json::Json::typeToStr(type));
-        validateTest(validator, targetArray, valToken, true, true, trace);
+        validateTest(validator, targetArray, valToken, true, runtime, trace);
     }
 }
 
@@ -3,6 +3,11 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
 
 #include <metrics/iMetricsManager.hpp>
 
@@ -23,6 +28,16 @@ namespace engineserver::endpoint
  * available. If the client is configured as non-blocking, the client will receive a "Resource temporarily unavailable"
  * error. The size of the thread pool is defined by the taskQueueSize parameter.
  *
+ * In batched mode the socket is polled for readability and each wakeup drains up to
+ * batchSize datagrams per recvmmsg call into a preallocated ring of buffers, the whole batch is passed to the batch
+ * callback at once (inline or in one task of the thread pool).
+ *
+ * With flow control the endpoint reads only while the consumer has credits (free slots), so a full event queue never
+ * blocks the loop inside the callback: the endpoint pauses, the datagrams wait in the socket buffer and the blocking
+ * producers wait in sendto, then the endpoint resumes once the credits reach the resume threshold. In batched mode the
+ * producers that bind their socket receive the credits after each batch and on resume, as the datagram
+ * "credits:<n>", so they can throttle or buffer on their side before the socket buffer fills.
+ *
  * @note The thread pool is shared between all the endpoints.
  * @note Currently responses are not implemented, so the callback function must not return a string.
  */
@@ -33,12 +48,41 @@ private:
     std::shared_ptr<uvw::UDPHandle> m_handle;      ///< Handle to the socket
     int m_bufferSize;                              ///< Size of the receive buffer
 
+    // Batched mode
+    std::function<void(const std::vector<std::string>&)> m_batchCallback; ///< Callback for a batch of messages
+    std::size_t m_batchSize;                                              ///< Max datagrams read per recvmmsg call
+    std::shared_ptr<uvw::PollHandle> m_pollHandle; ///< Readability watcher of the socket (batched mode)
+    int m_socketFd;                                ///< Socket polled in batched mode, -1 if not open
+    std::vector<char> m_ring;                      ///< One buffer of MAX_MSG_SIZE bytes per message of a batch
+    std::vector<iovec> m_iovecs;                   ///< Buffer of each message of a batch
+    std::vector<mmsghdr> m_msgs;                   ///< Headers for recvmmsg
+    std::vector<sockaddr_un> m_senders;            ///< Address of the sender of each message of a batch
+
+public:
+    /**
+     * @brief Credit-based flow control of the producers
+     */
+    struct FlowControl
+    {
+        std::function<std::size_t()> credits; ///< Events the consumer can take now, called from the loop thread
+        std::size_t resumeCredits {1};        ///< Credits needed to resume reading once paused for lack of credits
+        std::size_t checkIntervalMs {10};     ///< Time between credit checks while paused
+    };
+
+private:
+    // Flow control
+    FlowControl m_flowControl;                      ///< Disabled if it has no credits function
+    bool m_flowPaused;                              ///< If the endpoint is paused for lack of credits
+    std::shared_ptr<uvw::TimerHandle> m_flowTimer;  ///< Credit check while paused
+    std::vector<std::string> m_creditListeners;     ///< Bound senders of the last batch, notified on resume
+
     struct Metric {
         std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope;     ///< Metrics scope for the endpoint
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_byteRecv;    ///< Counter for the total requests
         std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_eventSize; ///< Histogram for the event size
         std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_queueSize; ///< Histogram for the use queue size
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_busyQueue;   ///< Counter for the busy queue
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_noCredits;   ///< Counter for the pauses without credits
 
         std::shared_ptr<metricsManager::IMetricsScope> m_metricsScopeDelta; ///< Metrics scope for the endpoint rate
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_byteRecvPerSecond; ///< Byte received per second
@@ -54,6 +98,41 @@ private:
      */
     int bindUnixDatagramSocket(int& bufferSize);
 
+    /**
+     * @brief Check the address and initialize the metrics, shared by all the constructors.
+     */
+    void init(std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+              std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta);
+
+    /**
+     * @brief Run a task inline if the endpoint is synchronous, otherwise queue it in the thread pool and pause the
+     * endpoint while the queue is full.
+     */
+    void dispatch(std::function<void()> task);
+
+    /**
+     * @brief Drain the socket with recvmmsg and dispatch each batch (batched mode).
+     */
+    void receiveBatch();
+
+    /**
+     * @brief Pause the endpoint if the consumer has less than the needed credits (flow control).
+     *
+     * @param needed Credits needed to read the next message or batch.
+     * @return true if the endpoint can keep reading.
+     */
+    bool hasCredits(std::size_t needed);
+
+    /**
+     * @brief Resume the endpoint paused for lack of credits once the credits reach the resume threshold.
+     */
+    void checkCredits();
+
+    /**
+     * @brief Send the current credits to the bound senders, dropped if a sender is not reading.
+     */
+    void advertiseCredits(const std::vector<std::string>& senders, std::size_t credits);
+
 public:
     /**
      * @brief Create a Unix Datagram object
@@ -70,6 +149,24 @@ public:
                  std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
                  const std::size_t taskQueueSize = 0);
 
+    /**
+     * @brief Create a Unix Datagram object in batched mode
+     *
+     * @param address Path to the socket
+     * @param batchCallback Callback function to be called with each batch of received messages
+     * @param metricsScope Metrics scope for the endpoint
+     * @param metricsScopeDelta Metrics scope for the endpoint rate
+     * @param batchSize Maximum number of datagrams read per syscall, it reserves batchSize receive buffers
+     * @param taskQueueSize Size of the queue of tasks to be processed by the thread pool, each task is a batch
+     * @throw std::runtime_error if the batchSize is 0
+     */
+    UnixDatagram(const std::string& address,
+                 const std::function<void(const std::vector<std::string>&)>& batchCallback,
+                 std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                 std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                 const std::size_t batchSize,
+                 const std::size_t taskQueueSize);
+
     /**
      * @brief Construct a new Unix Datagram object
      *
@@ -104,6 +201,19 @@ public:
      */
     bool resume(void) override;
 
+    /**
+     * @brief Enable the credit-based flow control, must be called before bind.
+     *
+     * @param flowControl Credits of the consumer and resume threshold.
+     * @throw std::runtime_error if the endpoint is bound, the credits function is not set or the interval is 0.
+     */
+    void setFlowControl(FlowControl flowControl);
+
+    /**
+     * @brief Check if the endpoint is paused for lack of credits
+     */
+    bool isFlowPaused() const { return m_flowPaused; }
+
     /**
      * @brief Get the size of the receive buffer
      * @return int Size of the receive buffer
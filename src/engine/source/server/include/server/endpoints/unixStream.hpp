@@ -2,6 +2,7 @@
 #define _SERVER_ENDPOINT_UNIX_STREAM_HPP
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
 
 #include <metrics/iMetricsManager.hpp>
@@ -23,6 +24,9 @@ namespace engineserver::endpoint
  * If the queue is full, drop the message and respond with an error from the protocol handler,
  * "resource temporarily unavailable"
  *
+ * A client can pipeline requests, sending several of them without waiting for the responses. The responses are
+ * written in the order of the requests, and the ones ready at the same time go out with one scatter/gather write.
+ *
  * @note The thread pool is shared between all the endpoints.
  * @note Currently responses are not implemented, so the callback function must not return a string.
  */
@@ -46,6 +50,8 @@ private:
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_requestPerSecond; ///< Counter for the requests per second
     };
     Metric m_metric; ///< Metrics for the endpoint
+
+    class Pipeline; ///< Orders and writes the responses of a client
     /**
      * @brief Create a client
      *
@@ -61,13 +67,12 @@ private:
      *
      * This function is used to process the messages received from the client, it is called when a stream is parsed.
      * @param client Handle to the client that sent the message
-     * @param asyncs Array of AsyncHandler instance that will be used to send the event using send()
+     * @param pipeline Pipeline where the responses are written
      * @param protocolHandler Protocol handler to process the message
      * @param requests Messages to be processed
-     * @param response Shared memory where the callback executed by the AsyncHandle will write the response
      */
     void processMessages(std::weak_ptr<uvw::PipeHandle> clientRef,
-                         std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                         std::shared_ptr<Pipeline> pipeline,
                          std::shared_ptr<ProtocolHandler> protocolHandler,
                          std::vector<std::string>&& requests);
 
@@ -77,25 +82,27 @@ private:
      * This function is used to create a task work from a message received from the client, it is called when a message
      * is received and enqueued for processing by the thread pool.
      * @param client Handle to the client that sent the message
-     * @param asyncs Array of AsyncHandler instance that will be used to send the event using send()
+     * @param pipeline Pipeline where the responses are written
      * @param protocolHandler Protocol handler to process the message
      * @param request Message to be processed
+     * @param sequence Position of the response in the pipeline
      */
     void createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
-                              std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                              std::shared_ptr<Pipeline> pipeline,
                               std::shared_ptr<ProtocolHandler> protocolHandler,
-                              std::string&& request);
+                              std::string&& request,
+                              uint64_t sequence);
 
     /**
      * @brief Configure the client to close the connection gracefully
      *
      * @param client Client to close
-     * @param async Array of AsyncHandler instance that will be used to send the event using send()
+     * @param pipeline Pipeline to close if the client closes the connection
      * @param timer Timer to close if the client closes the connection
      */
     void configureCloseClient(std::shared_ptr<uvw::PipeHandle> client,
                               std::shared_ptr<uvw::TimerHandle> timer,
-                              std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> async);
+                              std::shared_ptr<Pipeline> pipeline);
 
     /**
      * @brief Create a Timer resource, this timer will be used to close the client connection if it doesn't send any
@@ -103,11 +110,11 @@ private:
      *
      * @param loop Loop to create the timer
      * @param wClient Client to close if the timer expires
-     * @param asyncs Array of AsyncHandler instance that will be used to send the event using send()
+     * @param pipeline Pipeline to close if the timer expires
      * @return Timer resource
      */
     std::shared_ptr<uvw::TimerHandle> createTimer(std::weak_ptr<uvw::PipeHandle> wClient,
-                                                  std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs);
+                                                  std::shared_ptr<Pipeline> pipeline);
 
 public:
     /**
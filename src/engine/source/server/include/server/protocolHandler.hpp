@@ -98,6 +98,24 @@ public:
      */
     virtual std::string getErrorResponse() = 0;
 
+    /**
+     * @brief Generate the header to send before a message
+     *
+     * Lets the endpoint send the header and the message with one scatter/gather write, without copying the message.
+     * @param size Size of the message
+     * @return The header, or std::nullopt if the message must be framed with streamToSend
+     *
+     * @note this method not throw any exception.
+     */
+    virtual std::optional<std::string> streamHeader(std::size_t size) { return std::nullopt; }
+
+    /**
+     * @brief Give back the buffer of a request already processed
+     *
+     * The protocol handler can reuse it to frame the next requests. It may be called from any thread.
+     * @param buffer Request returned by onData
+     */
+    virtual void releaseBuffer(std::string&& buffer) {}
 };
 
 // ProtocolHandler Factory
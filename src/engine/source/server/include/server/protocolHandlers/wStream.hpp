@@ -3,6 +3,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 
@@ -45,6 +46,16 @@ private:
     static const std::shared_ptr<std::string> m_busyResponse;  ///< Response when the server is busy
     static const std::shared_ptr<std::string> m_errorResponse; ///< Response when an unexpected error occurs
 
+    constexpr static std::size_t m_poolMaxBuffers {8};           ///< Max buffers kept for reuse
+    constexpr static std::size_t m_poolMaxCapacity {64 * 1024}; ///< Bigger buffers are released, not kept
+    std::vector<std::string> m_pool;                             ///< Released payload buffers of this connection
+    std::mutex m_poolMutex;                                      ///< Released buffers come from the workers
+
+    /**
+     * @brief Get an empty payload buffer, reusing a released one if available
+     */
+    std::string acquireBuffer();
+
 public:
     /**
      * @brief Construct a new WStream object
@@ -126,6 +137,16 @@ public:
      * @copydoc ProtocolHandler::getErrorResponse
      */
     std::string getErrorResponse() override;
+
+    /**
+     * @copydoc ProtocolHandler::streamHeader
+     */
+    std::optional<std::string> streamHeader(std::size_t size) override;
+
+    /**
+     * @copydoc ProtocolHandler::releaseBuffer
+     */
+    void releaseBuffer(std::string&& buffer) override;
 };
 
 class WStreamFactory : public ProtocolHandlerFactory
@@ -1,5 +1,7 @@
 #include <server/endpoints/unixDatagram.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstring>      // Unix  socket datagram bind
 #include <fcntl.h>      // Unix socket datagram bind
 #include <sys/socket.h> // Unix socket datagram bind
@@ -12,6 +14,8 @@
 namespace
 {
 constexpr unsigned int MAX_MSG_SIZE {65536 + 512}; ///< Maximum message size (TODO: I think this should be 65507)
+constexpr std::size_t MAX_BATCHES_PER_WAKEUP {16}; ///< Max recvmmsg calls per readable event (batched mode)
+constexpr std::size_t MAX_CREDIT_LISTENERS {64};   ///< Max bound senders remembered to be notified on resume
 } // namespace
 
 namespace engineserver::endpoint
@@ -25,15 +29,73 @@ UnixDatagram::UnixDatagram(const std::string& address,
     , m_callback(callback)
     , m_handle(nullptr)
     , m_bufferSize(-1)
+    , m_batchSize(0)
+    , m_pollHandle(nullptr)
+    , m_socketFd(-1)
+    , m_flowPaused(false)
 {
-    if (address.empty())
+    if (!callback)
+    {
+        throw std::runtime_error("Callback must be set");
+    }
+
+    init(std::move(metricsScope), std::move(metricsScopeDelta));
+}
+
+UnixDatagram::UnixDatagram(const std::string& address,
+                           const std::function<void(const std::vector<std::string>&)>& batchCallback,
+                           std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                           std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                           const std::size_t batchSize,
+                           const std::size_t taskQueueSize)
+    : Endpoint(address, taskQueueSize)
+    , m_handle(nullptr)
+    , m_bufferSize(-1)
+    , m_batchCallback(batchCallback)
+    , m_batchSize(batchSize)
+    , m_pollHandle(nullptr)
+    , m_socketFd(-1)
+    , m_flowPaused(false)
+{
+    if (!batchCallback)
+    {
+        throw std::runtime_error("Callback must be set");
+    }
+
+    if (0 == batchSize)
+    {
+        throw std::runtime_error("Batch size must be greater than 0");
+    }
+
+    init(std::move(metricsScope), std::move(metricsScopeDelta));
+
+    // The ring is reused by every recvmmsg call, the payloads are copied out before the next one
+    m_ring.resize(m_batchSize * MAX_MSG_SIZE);
+    m_iovecs.resize(m_batchSize);
+    m_msgs.resize(m_batchSize);
+    m_senders.resize(m_batchSize);
+    for (std::size_t i = 0; i < m_batchSize; ++i)
+    {
+        m_iovecs[i].iov_base = m_ring.data() + i * MAX_MSG_SIZE;
+        m_iovecs[i].iov_len = MAX_MSG_SIZE;
+        memset(&m_msgs[i], 0, sizeof(mmsghdr));
+        m_msgs[i].msg_hdr.msg_iov = &m_iovecs[i];
+        m_msgs[i].msg_hdr.msg_iovlen = 1;
+        m_msgs[i].msg_hdr.msg_name = &m_senders[i];
+    }
+}
+
+void UnixDatagram::init(std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                        std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta)
+{
+    if (m_address.empty())
     {
         throw std::runtime_error("Address must not be empty");
     }
 
-    if (address.length() >= sizeof(sockaddr_un::sun_path))
+    if (m_address.length() >= sizeof(sockaddr_un::sun_path))
     {
-        auto msg = fmt::format("Path '{}' too long, maximum length is {} ", address, sizeof(sockaddr_un::sun_path));
+        auto msg = fmt::format("Path '{}' too long, maximum length is {} ", m_address, sizeof(sockaddr_un::sun_path));
         throw std::runtime_error(msg);
     }
 
@@ -42,21 +104,16 @@ UnixDatagram::UnixDatagram(const std::string& address,
         throw std::runtime_error("Address must start with '/'");
     }
 
-    if (!callback)
-    {
-        throw std::runtime_error("Callback must be set");
-    }
-
     m_metric.m_metricsScope = std::move(metricsScope);
     m_metric.m_byteRecv = m_metric.m_metricsScope->getCounterUInteger("BytesReceived");
     m_metric.m_busyQueue = m_metric.m_metricsScope->getCounterUInteger("ServerBusy");
+    m_metric.m_noCredits = m_metric.m_metricsScope->getCounterUInteger("NoCredits");
     m_metric.m_queueSize = m_metric.m_metricsScope->getHistogramUInteger("UsedQueueHistory");
     m_metric.m_eventSize = m_metric.m_metricsScope->getHistogramUInteger("EventSizeHistory");
 
     m_metric.m_metricsScopeDelta = std::move(metricsScopeDelta);
     m_metric.m_byteRecvPerSecond = m_metric.m_metricsScopeDelta->getCounterUInteger("BytesReceivedPerSeconds");
     m_metric.m_eventPerSecond = m_metric.m_metricsScopeDelta->getCounterUInteger("EventsReceivedPerSeconds");
-
 }
 
 UnixDatagram::~UnixDatagram()
@@ -64,104 +121,347 @@ UnixDatagram::~UnixDatagram()
     if (isBound())
     {
         // Close
-        m_handle->close();
-        m_handle = nullptr;
+        if (m_flowTimer)
+        {
+            m_flowTimer->close();
+            m_flowTimer = nullptr;
+        }
+        if (m_pollHandle)
+        {
+            m_pollHandle->close();
+            m_pollHandle = nullptr;
+            ::close(m_socketFd);
+            m_socketFd = -1;
+        }
+        else
+        {
+            m_handle->close();
+            m_handle = nullptr;
+        }
         unlink(m_address.c_str());
-
     }
 }
 
-void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
+void UnixDatagram::dispatch(std::function<void()> task)
 {
-    if (isBound())
+    // Call the callback if is synchronous
+    if (0 == m_taskQueueSize)
     {
-        throw std::runtime_error("Endpoint already bound");
-    }
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+        }
 
-    m_loop = loop;
-    m_handle = m_loop->resource<uvw::UDPHandle>();
+        return;
+    }
 
-    // Listen for incoming data
-    m_handle->on<uvw::UDPDataEvent>(
-        [this](const uvw::UDPDataEvent& event, uvw::UDPHandle& handle)
-        {
-            // Get the data
-            auto data = std::string {event.data.get(), event.length};
+    // Call the callback if is asynchronous, (TODO: Should be decrement the size of the workers?)
+    if (++m_currentTaskQueueSize >= m_taskQueueSize)
 
-            // Update metrics
-            m_metric.m_byteRecv->addValue(event.length);
-            m_metric.m_byteRecvPerSecond->addValue(event.length);
-            m_metric.m_eventPerSecond->addValue(1UL);
-            m_metric.m_eventSize->recordValue(event.length);
+    {
+        LOG_WARNING("[Endpoint: {}] Queue is full, pause listening.", m_address);
+        pause();
+        // Update metric
+        m_metric.m_busyQueue->addValue(1UL);
+    }
+    m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
 
-            // Call the callback if is synchronous
-            if (0 == m_taskQueueSize)
+    // Create a job to the worker thread
+    auto workerJob = m_loop->resource<uvw::WorkReq>(
+        [this, task = std::move(task)]()
+        {
+            try
             {
-                try
-                {
-                    m_callback(data);
-                }
-                catch (const std::exception& e)
-                {
-                    LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
-                }
+                task();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+            }
+        });
 
-                return;
+    // Listen for the job completion
+    workerJob->on<uvw::WorkEvent>(
+        [this](const uvw::WorkEvent&, uvw::WorkReq& work)
+        {
+            m_currentTaskQueueSize--;
+            if (!m_flowPaused && resume())
+            {
+                LOG_WARNING("[Endpoint: {}] Resume listening.", m_address);
             }
+            m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
 
-            // Call the callback if is asynchronous, (TODO: Should be decrement the size of the workers?)
-            if (++m_currentTaskQueueSize >= m_taskQueueSize)
+        });
 
+    workerJob->on<uvw::ErrorEvent>(
+        [this](const uvw::ErrorEvent& error, uvw::WorkReq& work)
+        {
+            LOG_WARNING(
+                "[Endpoint: {}] Error calling the callback: {}", m_address, error.what(), error.code());
+            m_currentTaskQueueSize--;
+            if (!m_flowPaused && resume())
             {
-                LOG_WARNING("[Endpoint: {}] Queue is full, pause listening.", m_address);
-                pause();
-                // Update metric
-                m_metric.m_busyQueue->addValue(1UL);
+                LOG_WARNING("[Endpoint: {}] Resume listening.", m_address);
             }
             m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
 
-            // Create a job to the worker thread
-            std::shared_ptr<std::string> dataPtr {std::make_shared<std::string>(std::move(data))};
-            auto workerJob = m_loop->resource<uvw::WorkReq>(
-                [this, dataPtr]()
+        });
+    workerJob->queue();
+}
+
+void UnixDatagram::receiveBatch()
+{
+    // Bounded drain, so a flooded socket does not starve the other handles of the loop
+    for (std::size_t round = 0; round < MAX_BATCHES_PER_WAKEUP && m_running; ++round)
+    {
+        // A consumer smaller than a batch still reads once it reaches the resume threshold
+        if (!hasCredits(std::min(m_batchSize, m_flowControl.resumeCredits)))
+        {
+            return;
+        }
+
+        // The kernel sets the length of each sender address
+        for (auto& msg : m_msgs)
+        {
+            msg.msg_hdr.msg_namelen = sizeof(sockaddr_un);
+        }
+
+        const auto received = recvmmsg(m_socketFd, m_msgs.data(), m_batchSize, MSG_DONTWAIT, nullptr);
+        if (received < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            if (EAGAIN != errno && EWOULDBLOCK != errno)
+            {
+                LOG_WARNING("[Endpoint: {}] Error receiving: {} ({})", m_address, strerror(errno), errno);
+            }
+            return;
+        }
+
+        auto batch = std::make_shared<std::vector<std::string>>();
+        batch->reserve(received);
+        uint64_t bytes {0};
+        for (int i = 0; i < received; ++i)
+        {
+            const auto length = m_msgs[i].msg_len;
+            batch->emplace_back(m_ring.data() + i * MAX_MSG_SIZE, length);
+            m_metric.m_eventSize->recordValue(length);
+            bytes += length;
+        }
+
+        // Update metrics
+        m_metric.m_byteRecv->addValue(bytes);
+        m_metric.m_byteRecvPerSecond->addValue(bytes);
+        m_metric.m_eventPerSecond->addValue(static_cast<uint64_t>(received));
+
+        dispatch([this, batch]() { m_batchCallback(*batch); });
+
+        if (m_flowControl.credits)
+        {
+            // Unbound senders have no address to reply to
+            std::vector<std::string> senders;
+            for (int i = 0; i < received; ++i)
+            {
+                const auto nameLen = m_msgs[i].msg_hdr.msg_namelen;
+                if (nameLen > offsetof(sockaddr_un, sun_path) && m_senders[i].sun_path[0] != '\0')
                 {
-                    try
-                    {
-                        m_callback(*dataPtr);
-                    }
-                    catch (const std::exception& e)
+                    std::string sender(m_senders[i].sun_path,
+                                       strnlen(m_senders[i].sun_path, nameLen - offsetof(sockaddr_un, sun_path)));
+                    if (std::find(senders.begin(), senders.end(), sender) == senders.end())
                     {
-                        LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+                        senders.emplace_back(std::move(sender));
                     }
-                });
+                }
+            }
 
-            // Listen for the job completion
-            workerJob->on<uvw::WorkEvent>(
-                [this](const uvw::WorkEvent&, uvw::WorkReq& work)
+            if (!senders.empty())
+            {
+                advertiseCredits(senders, m_flowControl.credits());
+                for (auto& sender : senders)
                 {
-                    m_currentTaskQueueSize--;
-                    if (resume())
+                    if (m_creditListeners.size() < MAX_CREDIT_LISTENERS
+                        && std::find(m_creditListeners.begin(), m_creditListeners.end(), sender)
+                               == m_creditListeners.end())
                     {
-                        LOG_WARNING("[Endpoint: {}] Resume listening.", m_address);
+                        m_creditListeners.emplace_back(std::move(sender));
                     }
-                    m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
+                }
+            }
+        }
 
-                });
+        // A short batch means the socket is drained
+        if (static_cast<std::size_t>(received) < m_batchSize)
+        {
+            return;
+        }
+    }
+}
 
-            workerJob->on<uvw::ErrorEvent>(
-                [this](const uvw::ErrorEvent& error, uvw::WorkReq& work)
-                {
-                    LOG_WARNING(
-                        "[Endpoint: {}] Error calling the callback: {}", m_address, error.what(), error.code());
-                    m_currentTaskQueueSize--;
-                    if (resume())
-                    {
-                        LOG_WARNING("[Endpoint: {}] Resume listening.", m_address);
-                    }
-                    m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
+bool UnixDatagram::hasCredits(std::size_t needed)
+{
+    if (!m_flowControl.credits || m_flowControl.credits() >= needed)
+    {
+        return true;
+    }
+
+    if (pause())
+    {
+        LOG_DEBUG("[Endpoint: {}] No credits, pause listening.", m_address);
+        m_flowPaused = true;
+        m_metric.m_noCredits->addValue(1UL);
+        m_flowTimer->start(uvw::TimerHandle::Time {m_flowControl.checkIntervalMs},
+                           uvw::TimerHandle::Time {m_flowControl.checkIntervalMs});
+    }
+    return false;
+}
+
+void UnixDatagram::checkCredits()
+{
+    const auto credits = m_flowControl.credits();
+    if (!m_flowPaused || credits < m_flowControl.resumeCredits)
+    {
+        return;
+    }
+
+    m_flowTimer->stop();
+    m_flowPaused = false;
+
+    // The task queue may still be full, its next completed task resumes the endpoint
+    if (0 != m_taskQueueSize && m_currentTaskQueueSize >= m_taskQueueSize)
+    {
+        return;
+    }
+
+    if (resume())
+    {
+        LOG_DEBUG("[Endpoint: {}] Credits available, resume listening.", m_address);
+    }
+
+    // The producers waiting for credits do not have to wait for their next send
+    if (m_pollHandle && !m_creditListeners.empty())
+    {
+        // Copied, the listeners that are gone are removed while advertising
+        const auto listeners = m_creditListeners;
+        advertiseCredits(listeners, credits);
+    }
+}
+
+void UnixDatagram::advertiseCredits(const std::vector<std::string>& senders, std::size_t credits)
+{
+    const auto message = "credits:" + std::to_string(credits);
+    for (const auto& sender : senders)
+    {
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, sender.c_str(), sizeof(address.sun_path) - 1);
+
+        // Never block the loop, a sender that does not read its credits misses them
+        if (sendto(m_socketFd,
+                   message.data(),
+                   message.size(),
+                   MSG_DONTWAIT | MSG_NOSIGNAL,
+                   reinterpret_cast<sockaddr*>(&address),
+                   sizeof(address))
+            < 0)
+        {
+            LOG_DEBUG("[Endpoint: {}] Cannot send the credits to '{}': {} ({})",
+                      m_address,
+                      sender,
+                      strerror(errno),
+                      errno);
+            if (ECONNREFUSED == errno || ENOENT == errno)
+            {
+                m_creditListeners.erase(std::remove(m_creditListeners.begin(), m_creditListeners.end(), sender),
+                                        m_creditListeners.end());
+            }
+        }
+    }
+}
+
+void UnixDatagram::setFlowControl(FlowControl flowControl)
+{
+    if (isBound())
+    {
+        throw std::runtime_error("Flow control must be set before binding the endpoint");
+    }
+
+    if (!flowControl.credits)
+    {
+        throw std::runtime_error("Flow control needs a credits function");
+    }
+
+    if (0 == flowControl.checkIntervalMs)
+    {
+        throw std::runtime_error("Flow control check interval must be greater than 0");
+    }
+
+    m_flowControl = std::move(flowControl);
+}
+
+void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
+{
+    if (isBound())
+    {
+        throw std::runtime_error("Endpoint already bound");
+    }
 
-                });
-            workerJob->queue();
+    m_loop = loop;
+
+    if (m_flowControl.credits)
+    {
+        m_flowTimer = m_loop->resource<uvw::TimerHandle>();
+        m_flowTimer->on<uvw::TimerEvent>([this](const uvw::TimerEvent&, uvw::TimerHandle&) { checkCredits(); });
+    }
+
+    if (m_batchCallback)
+    {
+        m_socketFd = bindUnixDatagramSocket(m_bufferSize);
+        m_pollHandle = m_loop->resource<uvw::PollHandle>(m_socketFd);
+
+        m_pollHandle->on<uvw::PollEvent>([this](const uvw::PollEvent&, uvw::PollHandle&) { receiveBatch(); });
+
+        m_pollHandle->on<uvw::ErrorEvent>(
+            [this](const uvw::ErrorEvent& event, uvw::PollHandle& handle)
+            {
+                LOG_WARNING("[Endpoint: {}] Error: code=[{}]; name=[{}]; message=[{}].",
+                            m_address,
+                            event.code(),
+                            event.name(),
+                            event.what());
+            });
+
+        m_pollHandle->on<uvw::CloseEvent>([this](const uvw::CloseEvent& event, uvw::PollHandle& handle)
+                                          { LOG_INFO("[Endpoint: {}] Closed.", m_address); });
+        resume();
+        return;
+    }
+
+    m_handle = m_loop->resource<uvw::UDPHandle>();
+
+    // Listen for incoming data
+    m_handle->on<uvw::UDPDataEvent>(
+        [this](const uvw::UDPDataEvent& event, uvw::UDPHandle& handle)
+        {
+            // Get the data
+            auto data = std::make_shared<std::string>(event.data.get(), event.length);
+
+            // Update metrics
+            m_metric.m_byteRecv->addValue(event.length);
+            m_metric.m_byteRecvPerSecond->addValue(event.length);
+            m_metric.m_eventPerSecond->addValue(1UL);
+            m_metric.m_eventSize->recordValue(event.length);
+
+            dispatch([this, data]() { m_callback(*data); });
+
+            // The message is already read, stop before the next one if it could not be taken
+            hasCredits(1);
         });
 
     // Listen for errors
@@ -192,8 +492,26 @@ void UnixDatagram::close()
 {
     if (isBound())
     {
-        m_handle->close();
-        m_handle.reset();
+        if (m_flowTimer)
+        {
+            m_flowTimer->close();
+            m_flowTimer.reset();
+        }
+        m_flowPaused = false;
+        m_creditListeners.clear();
+        if (m_pollHandle)
+        {
+            // Closing the handle stops the polling, then the socket can be closed
+            m_pollHandle->close();
+            m_pollHandle.reset();
+            ::close(m_socketFd);
+            m_socketFd = -1;
+        }
+        else
+        {
+            m_handle->close();
+            m_handle.reset();
+        }
         m_loop.reset();
         m_running = false;
     }
@@ -203,7 +521,14 @@ bool UnixDatagram::pause()
 {
     if (m_running && isBound())
     {
-        m_handle->stop();
+        if (m_pollHandle)
+        {
+            m_pollHandle->stop();
+        }
+        else
+        {
+            m_handle->stop();
+        }
         m_running = false;
         return true;
     }
@@ -214,7 +539,14 @@ bool UnixDatagram::resume()
 {
     if (!m_running && isBound())
     {
-        m_handle->recv();
+        if (m_pollHandle)
+        {
+            m_pollHandle->start(uvw::PollHandle::Event::READABLE);
+        }
+        else
+        {
+            m_handle->recv();
+        }
         m_running = true;
         return true;
     }
@@ -1,5 +1,9 @@
 #include <server/endpoints/unixStream.hpp>
 
+#include <map>
+#include <mutex>
+#include <thread>
+
 #include <sys/un.h> // Unix socket datagram bind
 
 #include <base/logging.hpp>
@@ -142,25 +146,275 @@ bool UnixStream::resume()
     return false;
 }
 
+/**
+ * @brief Responses of a client, written in the order of its requests
+ *
+ * Each request takes a sequence number on the loop thread. The responses may come from any thread, the ones that come
+ * early wait until the previous ones are written. An AsyncHandle wakes the loop while some response is pending, it is
+ * closed when there are none so an idle client holds no extra handle.
+ */
+class UnixStream::Pipeline : public std::enable_shared_from_this<UnixStream::Pipeline>
+{
+public:
+    /**
+     * @brief Response waiting to be written
+     */
+    struct Frame
+    {
+        std::shared_ptr<std::string> response; ///< Response to frame with the protocol handler
+        std::unique_ptr<char[]> data;          ///< Already framed data, used if there is no response
+        std::size_t size;                      ///< Size of the framed data
+        base::chrono::Timer timer;             ///< Started when the request was received
+    };
+
+private:
+    /**
+     * @brief Buffers of one scatter/gather write, owned until libuv completes it
+     */
+    struct GatherWrite
+    {
+        uv_write_t req;
+        std::vector<std::string> headers;
+        std::vector<std::shared_ptr<std::string>> responses;
+        std::vector<std::unique_ptr<char[]>> framed;
+        std::vector<uv_buf_t> bufs;
+    };
+
+    std::weak_ptr<uvw::Loop> m_loop;
+    std::weak_ptr<uvw::PipeHandle> m_client;
+    std::shared_ptr<ProtocolHandler> m_protocolHandler;
+    Metric m_metric;
+    std::string m_address;
+    std::thread::id m_loopThread;
+
+    std::mutex m_mutex;                        ///< Guards the fields below, the workers add responses
+    std::map<uint64_t, Frame> m_ready;         ///< Responses waiting for the previous ones
+    std::shared_ptr<uvw::AsyncHandle> m_async; ///< Wakes the loop, only while some response is pending
+    uint64_t m_nextResponse {0};               ///< Sequence of the next response to write
+    bool m_closed {false};                     ///< The client is closed, responses are discarded
+
+    uint64_t m_nextRequest {0}; ///< Sequence of the next request (loop thread only)
+    bool m_batching {false};    ///< Processing the requests of a read, flushed at the end (loop thread only)
+
+    void write(std::vector<Frame>& frames)
+    {
+        auto client = m_client.lock();
+        if (!client || client->closing())
+        {
+            LOG_DEBUG("[Endpoint: {}] Client closed, discarding response", m_address);
+            return;
+        }
+
+        auto gather = std::make_unique<GatherWrite>();
+        // The buffers point to the headers, no reallocation allowed
+        gather->headers.reserve(frames.size());
+        for (auto& frame : frames)
+        {
+            if (frame.response)
+            {
+                auto header = m_protocolHandler->streamHeader(frame.response->size());
+                if (header)
+                {
+                    gather->headers.push_back(std::move(header.value()));
+                    auto& headerRef = gather->headers.back();
+                    gather->bufs.push_back(uv_buf_init(headerRef.data(), headerRef.size()));
+                    gather->bufs.push_back(uv_buf_init(frame.response->data(), frame.response->size()));
+                    gather->responses.push_back(std::move(frame.response));
+                }
+                else
+                {
+                    std::tie(frame.data, frame.size) = m_protocolHandler->streamToSend(frame.response);
+                }
+            }
+
+            if (frame.data)
+            {
+                gather->bufs.push_back(uv_buf_init(frame.data.get(), frame.size));
+                gather->framed.push_back(std::move(frame.data));
+            }
+            const auto elapsedTime = frame.timer.elapsed<std::chrono::milliseconds>();
+            m_metric.m_responseTime->recordValue(static_cast<uint64_t>(elapsedTime));
+        }
+
+        gather->req.data = gather.get();
+        auto result = uv_write(&gather->req,
+                               reinterpret_cast<uv_stream_t*>(client->raw()),
+                               gather->bufs.data(),
+                               gather->bufs.size(),
+                               [](uv_write_t* req, int status)
+                               {
+                                   std::unique_ptr<GatherWrite> done {static_cast<GatherWrite*>(req->data)};
+                                   if (status < 0)
+                                   {
+                                       LOG_DEBUG("Error writing response: {}", uv_strerror(status));
+                                   }
+                               });
+        if (0 != result)
+        {
+            LOG_WARNING("[Endpoint: {}] Error writing response: {}", m_address, uv_strerror(result));
+            return;
+        }
+        gather.release();
+    }
+
+public:
+    Pipeline(std::weak_ptr<uvw::Loop> loop,
+             std::weak_ptr<uvw::PipeHandle> client,
+             std::shared_ptr<ProtocolHandler> protocolHandler,
+             const Metric& metric,
+             const std::string& address)
+        : m_loop(std::move(loop))
+        , m_client(std::move(client))
+        , m_protocolHandler(std::move(protocolHandler))
+        , m_metric(metric)
+        , m_address(address)
+        , m_loopThread(std::this_thread::get_id())
+    {
+    }
+
+    /**
+     * @brief Take the sequence of a new request (loop thread)
+     */
+    uint64_t nextSequence() { return m_nextRequest++; }
+
+    /**
+     * @brief Start processing the requests of a read, the responses are written together at endBatch (loop thread)
+     */
+    void beginBatch() { m_batching = true; }
+
+    /**
+     * @brief Write the responses ready after processing the requests of a read (loop thread)
+     */
+    void endBatch()
+    {
+        m_batching = false;
+        flush();
+    }
+
+    /**
+     * @brief Add the response of a request, from any thread
+     *
+     * @param sequence Sequence of the request
+     * @param frame Response
+     */
+    void respond(uint64_t sequence, Frame&& frame)
+    {
+        {
+            std::lock_guard<std::mutex> lock {m_mutex};
+            if (m_closed)
+            {
+                return;
+            }
+
+            if (sequence < m_nextResponse || !m_ready.emplace(sequence, std::move(frame)).second)
+            {
+                LOG_DEBUG("[Endpoint: {}] Response already sent, discarding...", m_address);
+                return;
+            }
+
+            if (std::this_thread::get_id() != m_loopThread)
+            {
+                // Without handle the loop has not flushed the batch of the request yet, it takes the response then
+                if (m_async)
+                {
+                    m_async->send();
+                }
+                return;
+            }
+        }
+
+        if (!m_batching)
+        {
+            flush();
+        }
+    }
+
+    /**
+     * @brief Write the consecutive ready responses with one scatter/gather write (loop thread)
+     */
+    void flush()
+    {
+        std::vector<Frame> frames;
+        {
+            std::lock_guard<std::mutex> lock {m_mutex};
+            if (m_closed)
+            {
+                return;
+            }
+
+            for (auto it = m_ready.begin(); it != m_ready.end() && it->first == m_nextResponse; ++m_nextResponse)
+            {
+                frames.push_back(std::move(it->second));
+                it = m_ready.erase(it);
+            }
+
+            if (m_nextResponse < m_nextRequest)
+            {
+                auto loop = m_loop.lock();
+                if (!m_async && loop)
+                {
+                    m_async = loop->resource<uvw::AsyncHandle>();
+                    m_async->on<uvw::AsyncEvent>(
+                        [wPipeline = weak_from_this()](const uvw::AsyncEvent&, uvw::AsyncHandle&)
+                        {
+                            if (auto pipeline = wPipeline.lock())
+                            {
+                                pipeline->flush();
+                            }
+                        });
+                }
+            }
+            else if (m_async)
+            {
+                m_async->close();
+                m_async.reset();
+            }
+        }
+
+        if (!frames.empty())
+        {
+            write(frames);
+        }
+    }
+
+    /**
+     * @brief Discard the pending responses and release the handle (loop thread)
+     */
+    void close()
+    {
+        std::lock_guard<std::mutex> lock {m_mutex};
+        m_closed = true;
+        m_ready.clear();
+        if (m_async)
+        {
+            if (!m_async->closing())
+            {
+                m_async->close();
+            }
+            m_async.reset();
+        }
+    }
+};
+
 std::shared_ptr<uvw::PipeHandle> UnixStream::createClient()
 {
     // Create a new client
     auto client = m_loop->resource<uvw::PipeHandle>();
     auto weakClient = std::weak_ptr<uvw::PipeHandle>(client);
 
-    auto sharedAsyncs = std::make_shared<std::vector<std::weak_ptr<uvw::AsyncHandle>>>();
+    // Create protocol handler per client
+    auto protocolHandler = m_factory->create();
+
+    auto pipeline = std::make_shared<Pipeline>(m_loop, weakClient, protocolHandler, m_metric, m_address);
 
     // Create a new timer for the client timeout
-    auto timer = createTimer(weakClient, sharedAsyncs);
+    auto timer = createTimer(weakClient, pipeline);
 
     // Configure the close events for the client
-    configureCloseClient(client, timer, sharedAsyncs);
-
-    // Create protocol handler per client
-    auto protocolHandler = m_factory->create();
+    configureCloseClient(client, timer, pipeline);
 
     client->on<uvw::DataEvent>(
-        [this, weakClient, sharedAsyncs, timer, protocolHandler](const uvw::DataEvent& data, uvw::PipeHandle& clientRef)
+        [this, weakClient, pipeline, timer, protocolHandler](const uvw::DataEvent& data, uvw::PipeHandle& clientRef)
         {
             // Avoid use _clientRef, it's a reference to the client, but we want to use the shared_ptr
             // to avoid the client release the memory before the workers finish the processing
@@ -195,7 +449,7 @@ std::shared_ptr<uvw::PipeHandle> UnixStream::createClient()
             m_metric.m_totalRequest->addValue(result->size());
             m_metric.m_requestPerSecond->addValue(result->size());
 
-            processMessages(weakClient, sharedAsyncs, protocolHandler, std::move(result.value()));
+            processMessages(weakClient, pipeline, protocolHandler, std::move(result.value()));
         });
 
     // Accept the connection
@@ -204,157 +458,82 @@ std::shared_ptr<uvw::PipeHandle> UnixStream::createClient()
 }
 
 void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
-                                 std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                                 std::shared_ptr<Pipeline> pipeline,
                                  std::shared_ptr<ProtocolHandler> protocolHandler,
                                  std::vector<std::string>&& requests)
 {
+    pipeline->beginBatch();
     for (auto& request : requests)
     {
+        const auto sequence = pipeline->nextSequence();
+
         // No queue worker, process the message in the main thread
         if (0 == m_taskQueueSize)
         {
-            auto callbackFn =
-                [wClient, address = m_address, protocolHandler, metric = m_metric](const std::string& response) -> void
+            auto callbackFn = [pipeline, sequence, timer = base::chrono::Timer()](const std::string& response) -> void
             {
-                auto responseTimer = std::make_shared<base::chrono::Timer>();
-
-                // Check if client is closed
-                auto client = wClient.lock();
-                if (!client)
-                {
-                    LOG_DEBUG("[Endpoint: {}] endpoint: Client already closed (remote close), discarting response",
-                              address);
-                    return;
-                }
-                else if (client->closing())
-                {
-                    LOG_DEBUG("[Endpoint: {}] Client closed, discarding response", address);
-                    return;
-                }
-
-                // Send the response
-                auto [buffer, size] = protocolHandler->streamToSend(response);
-                client->write(std::move(buffer), size);
-                auto elapsedTime = responseTimer->elapsed<std::chrono::milliseconds>();
-                metric.m_responseTime->recordValue(static_cast<uint64_t>(elapsedTime));
+                auto frame = Pipeline::Frame {std::make_shared<std::string>(response), nullptr, 0, timer};
+                pipeline->respond(sequence, std::move(frame));
             };
 
-            protocolHandler->onMessage(request, callbackFn);
+            try
+            {
+                protocolHandler->onMessage(request, callbackFn);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("[Endpoint: {}] Error processing message: {}", m_address, e.what());
+                callbackFn(protocolHandler->getErrorResponse());
+            }
+            protocolHandler->releaseBuffer(std::move(request));
 
             continue;
         }
         // Send the message to the queue worker (#TODO: Should be add the size of the worker?)
         if (m_currentTaskQueueSize >= m_taskQueueSize)
         {
-            auto responseTimer = base::chrono::Timer();
             LOG_DEBUG("[Endpoint: {}] endpoint: No queue worker available, disarting...", m_address);
             auto [buffer, size] = protocolHandler->getBusyResponse();
-            auto client = wClient.lock();
-            if (!client)
-            {
-                LOG_WARNING("[Endpoint: {}] endpoint: Client already closed", m_address);
-                return;
-            }
-            client->write(std::move(buffer), size);
-
-            auto elapsedTime = responseTimer.elapsed<std::chrono::milliseconds>();
-            m_metric.m_responseTime->recordValue(static_cast<uint64_t>(elapsedTime));
+            pipeline->respond(sequence, Pipeline::Frame {nullptr, std::move(buffer), size, base::chrono::Timer()});
             m_metric.m_serverBusy->addValue(1L);
             continue;
         }
 
-        createAndEnqueueTask(wClient, asyncs, protocolHandler, std::move(request));
+        createAndEnqueueTask(wClient, pipeline, protocolHandler, std::move(request), sequence);
     }
+    pipeline->endBatch();
 }
 
 void UnixStream::createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
-                                      std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                                      std::shared_ptr<Pipeline> pipeline,
                                       std::shared_ptr<ProtocolHandler> protocolHandler,
-                                      std::string&& request)
+                                      std::string&& request,
+                                      uint64_t sequence)
 {
     ++m_currentTaskQueueSize;
 
-    auto response = std::make_shared<std::string>();
-    auto responseTimer = std::make_shared<base::chrono::Timer>();
-
-    // Create a Async Handle for asynchronous sending of responses
-    auto async = m_loop->resource<uvw::AsyncHandle>();
-    auto wAsync = std::weak_ptr<uvw::AsyncHandle>(async);
-    asyncs->push_back(wAsync);
-
-    async->on<uvw::AsyncEvent>(
-        [wClient,
-         address = m_address,
-         metric = m_metric,
-         responseTimer,
-         protocolHandler,
-         response,
-         asyncs](const uvw::AsyncEvent&, uvw::AsyncHandle& syncHandle)
+    // The pipeline wakes the loop to write the response, one handle for all the pending requests of the client
+    auto callbackFn = [pipeline, sequence, timer = base::chrono::Timer()](const std::string& response) -> void
+    {
+        pipeline->respond(sequence, Pipeline::Frame {std::make_shared<std::string>(response), nullptr, 0, timer});
+    };
+
+    // Create a new queue worker for the request
+    auto work = m_loop->resource<uvw::WorkReq>(
+        [request = std::move(request), callbackFn, protocolHandler, address = m_address]() mutable
         {
-            // Check if client is closed
-            auto client = wClient.lock();
-            if (!client)
-            {
-                LOG_DEBUG("[Endpoint: {}] endpoint: Client already closed (remote close), discarting response",
-                          address);
-                return;
-            }
-            else if (client->closing())
+            try
             {
-                LOG_DEBUG("[Endpoint: {}] Client closed, discarding response", address);
-                return;
+                protocolHandler->onMessage(request, callbackFn);
             }
-
-            // Send the response
-            auto [buffer, size] = protocolHandler->streamToSend(response);
-            client->write(std::move(buffer), size);
-            auto elapsedTime = responseTimer->elapsed<std::chrono::milliseconds>();
-            metric.m_responseTime->recordValue(static_cast<uint64_t>(elapsedTime));
-
-            // Find and remove the corresponding AsyncHandle from the array
-            auto it = std::find_if(asyncs->begin(), asyncs->end(),
-                                [&syncHandle](const auto& weakAsync) {
-                                    auto async = weakAsync.lock();
-                                    return async && async.get() == &syncHandle;
-                                });
-
-            if (it != asyncs->end())
+            catch (const std::exception& e)
             {
-                auto async = it->lock();
-                if (async)
-                {
-                    // Release the resources associated with the AsyncHandle
-                    async->close();
-                }
-
-                // Remove the AsyncHandle from the vector
-                asyncs->erase(it);
+                LOG_WARNING("[Endpoint: {}] Error processing message: {}", address, e.what());
+                callbackFn(protocolHandler->getErrorResponse());
             }
+            protocolHandler->releaseBuffer(std::move(request));
         });
 
-    auto callbackFn = [asyncs, wAsync, address = m_address, response](const std::string& res) -> void
-    {
-        *response = res;
-
-        auto async = wAsync.lock();
-        if (!async)
-        {
-            LOG_DEBUG("[Endpoint: {}] endpoint: Async already closed (remote close), discarting response", address);
-            return;
-        }
-        else if (async->closing())
-        {
-            LOG_DEBUG("[Endpoint: {}] endpoint: Async already closed, discarting response", address);
-            return;
-        }
-
-        async->send();
-    };
-
-    // Create a new queue worker for the request
-    auto work = m_loop->resource<uvw::WorkReq>([request, callbackFn, protocolHandler, address = m_address]()
-                                               { protocolHandler->onMessage(request, callbackFn); });
-
     // On error
     work->on<uvw::ErrorEvent>(
         [address = m_address, metric = m_metric, &currentTaskQueueSize = m_currentTaskQueueSize](
@@ -380,13 +559,13 @@ void UnixStream::createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
 }
 
 std::shared_ptr<uvw::TimerHandle> UnixStream::createTimer(std::weak_ptr<uvw::PipeHandle> wClient,
-                                                          std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs)
+                                                          std::shared_ptr<Pipeline> pipeline)
 {
     auto timer = m_loop->resource<uvw::TimerHandle>();
 
     // Timeout, close the client
     timer->on<uvw::TimerEvent>(
-        [wClient, asyncs, address = m_address](const uvw::TimerEvent&, uvw::TimerHandle& timerRef)
+        [wClient, pipeline, address = m_address](const uvw::TimerEvent&, uvw::TimerHandle& timerRef)
         {
             LOG_DEBUG("[Endpoint: {}] Client timeout, close connection.", address);
             auto client = wClient.lock();
@@ -399,18 +578,7 @@ std::shared_ptr<uvw::TimerHandle> UnixStream::createTimer(std::weak_ptr<uvw::Pip
                 client->close();
             }
 
-            for (auto& wAsync : *asyncs)
-            {
-                auto async = wAsync.lock();
-                if (wAsync.expired())
-                {
-                    LOG_DEBUG("[Endpoint: {}] Async Handle already closed", address);
-                }
-                else if (async && !async->closing())
-                {
-                    async->close();
-                }
-            }
+            pipeline->close();
 
             timerRef.close();
         });
@@ -430,28 +598,17 @@ std::shared_ptr<uvw::TimerHandle> UnixStream::createTimer(std::weak_ptr<uvw::Pip
 
 void UnixStream::configureCloseClient(std::shared_ptr<uvw::PipeHandle> client,
                                       std::shared_ptr<uvw::TimerHandle> timer,
-                                      std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs)
+                                      std::shared_ptr<Pipeline> pipeline)
 {
 
-    auto gracefullEnd = [timer, asyncs, metric = m_metric, address = m_address](uvw::PipeHandle& client)
+    auto gracefullEnd = [timer, pipeline, metric = m_metric, address = m_address](uvw::PipeHandle& client)
     {
         if (!timer->closing())
         {
             timer->stop();
             timer->close();
         }
-        for (auto& wAsync : *asyncs)
-        {
-            auto sAsync = wAsync.lock();
-            if (wAsync.expired())
-            {
-                LOG_DEBUG("[Endpoint: {}] Async Handle already closed", address);
-            }
-            else if (sAsync && !sAsync->closing())
-            {
-                sAsync->close();
-            }
-        }
+        pipeline->close();
         if (!client.closing())
         {
             client.close();
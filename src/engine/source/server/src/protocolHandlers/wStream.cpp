@@ -1,5 +1,6 @@
 #include <server/protocolHandlers/wStream.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -15,14 +16,23 @@ std::optional<std::vector<std::string>> WStream::onData(std::string_view data)
 {
     std::vector<std::string> messages;
 
-    for (auto c : data)
+    // Copy whole spans of the chunk, the completed payloads are moved out without copying them again
+    while (!data.empty())
     {
         if (m_stage == Stage::HEADER)
         {
-            m_header.push_back(c);
+            const auto length = std::min<std::size_t>(data.size(), m_headerSize - m_header.size());
+            m_header.append(data.data(), length);
+            data.remove_prefix(length);
             if (m_header.size() == m_headerSize)
             {
                 std::memcpy(&m_pending, m_header.data(), m_headerSize);
+                if (m_pending < 0)
+                {
+                    auto msg = fmt::format("Invalid payload size [{} bytes]", m_pending);
+                    reset();
+                    throw std::runtime_error(msg);
+                }
                 if (m_pending > maxPayloadSize)
                 {
                     auto msg = fmt::format(
@@ -30,24 +40,64 @@ std::optional<std::vector<std::string>> WStream::onData(std::string_view data)
                     reset();
                     throw std::runtime_error(msg);
                 }
+                m_payload = acquireBuffer();
+                m_payload.reserve(m_pending);
                 m_stage = Stage::PAYLOAD;
             }
         }
         else
         {
-            m_payload.push_back(c);
-            if (m_payload.size() == m_pending)
-            {
-                messages.push_back(m_payload);
-                m_payload.clear();
-                m_header.clear();
-                m_stage = Stage::HEADER;
-            }
+            const auto length = std::min<std::size_t>(data.size(), m_pending - m_payload.size());
+            m_payload.append(data.data(), length);
+            data.remove_prefix(length);
+        }
+
+        if (m_stage == Stage::PAYLOAD && m_payload.size() == static_cast<std::size_t>(m_pending))
+        {
+            messages.push_back(std::move(m_payload));
+            m_payload = std::string {};
+            m_header.clear();
+            m_stage = Stage::HEADER;
         }
     }
     return messages.empty() ? std::nullopt : std::optional<std::vector<std::string>>(std::move(messages));
 }
 
+std::string WStream::acquireBuffer()
+{
+    std::lock_guard<std::mutex> lock {m_poolMutex};
+    if (m_pool.empty())
+    {
+        return {};
+    }
+
+    auto buffer = std::move(m_pool.back());
+    m_pool.pop_back();
+    buffer.clear();
+    return buffer;
+}
+
+void WStream::releaseBuffer(std::string&& buffer)
+{
+    if (buffer.capacity() > m_poolMaxCapacity)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock {m_poolMutex};
+    if (m_pool.size() < m_poolMaxBuffers)
+    {
+        m_pool.push_back(std::move(buffer));
+    }
+}
+
+std::optional<std::string> WStream::streamHeader(std::size_t size)
+{
+    std::string header(m_headerSize, '\0');
+    std::memcpy(header.data(), &size, m_headerSize);
+    return header;
+}
+
 std::tuple<std::unique_ptr<char[]>, std::size_t> WStream::streamToSend(std::shared_ptr<std::string> message)
 {
     auto size = message->size();
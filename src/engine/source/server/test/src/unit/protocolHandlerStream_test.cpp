@@ -117,3 +117,54 @@ TEST_F(WStreamTest, onDataPayloadSizeExceeded)
     std::string data("\x00\xA0\x96\x01", 4); // Exceeded size encoded in 4 bytes
     EXPECT_THROW(wstream2.onData(data), std::runtime_error);
 }
+
+TEST_F(WStreamTest, onDataSeveralMessagesInOneChunk)
+{
+    std::string data;
+    for (const auto& payload : {"ONE", "", "THREE"})
+    {
+        data += uintToLittleEndianBytes(std::string(payload).size()) + payload;
+    }
+    // Start of the next message
+    data += uintToLittleEndianBytes(4) + "FO";
+
+    auto result = wstream.onData(data);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 3);
+    EXPECT_EQ((*result)[0], "ONE");
+    EXPECT_EQ((*result)[1], "");
+    EXPECT_EQ((*result)[2], "THREE");
+
+    result = wstream.onData("UR");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1);
+    EXPECT_EQ((*result)[0], "FOUR");
+}
+
+TEST_F(WStreamTest, onDataReusesReleasedBuffers)
+{
+    std::string big(1024, 'A');
+    auto result = wstream.onData(uintToLittleEndianBytes(big.size()) + big);
+    ASSERT_TRUE(result.has_value());
+    auto buffer = std::move((*result)[0]);
+    const auto* data = buffer.data();
+    wstream.releaseBuffer(std::move(buffer));
+
+    result = wstream.onData(uintToLittleEndianBytes(5) + "HELLO");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ((*result)[0], "HELLO");
+    EXPECT_EQ((*result)[0].data(), data);
+}
+
+TEST_F(WStreamTest, streamHeader)
+{
+    auto header = wstream.streamHeader(5);
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header.value(), uintToLittleEndianBytes(5));
+}
+
+TEST_F(WStreamTest, onDataNegativePayloadSize)
+{
+    std::string data("\xFF\xFF\xFF\xFF", 4);
+    EXPECT_THROW(wstream.onData(data), std::runtime_error);
+}
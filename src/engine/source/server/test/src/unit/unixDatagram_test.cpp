@@ -155,6 +155,169 @@ TEST_F(UnixDatagramTest, ReceiveData)
     endpoint.close();
 }
 
+TEST_F(UnixDatagramTest, ReceiveBatch)
+{
+    std::vector<std::vector<std::string>> batches;
+    UnixDatagram endpoint(
+        socketPath,
+        [&](const std::vector<std::string>& batch) { batches.push_back(batch); },
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        4,
+        0);
+    endpoint.bind(loop);
+
+    // Queued before the loop runs, so a single wakeup drains them
+    auto fd = getSendFD(socketPath);
+    for (int i = 0; i < 6; i++)
+    {
+        sendUnixDatagram(fd, "message " + std::to_string(i));
+    }
+    close(fd);
+
+    loop->run<uvw::Loop::Mode::ONCE>();
+
+    ASSERT_EQ(batches.size(), 2);
+    ASSERT_EQ(batches[0].size(), 4);
+    ASSERT_EQ(batches[1].size(), 2);
+    for (int i = 0; i < 6; i++)
+    {
+        ASSERT_EQ(batches[i / 4][i % 4], "message " + std::to_string(i));
+    }
+    endpoint.close();
+}
+
+TEST_F(UnixDatagramTest, BatchPauseAndResume)
+{
+    std::size_t received {0};
+    UnixDatagram endpoint(
+        socketPath,
+        [&](const std::vector<std::string>& batch) { received += batch.size(); },
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        4,
+        0);
+    endpoint.bind(loop);
+    ASSERT_TRUE(endpoint.pause());
+    ASSERT_FALSE(endpoint.pause());
+
+    sendUnixDatagram(socketPath, "Hello, Unix Datagram!");
+    loop->run<uvw::Loop::Mode::NOWAIT>();
+    ASSERT_EQ(received, 0);
+
+    ASSERT_TRUE(endpoint.resume());
+    loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_EQ(received, 1);
+    endpoint.close();
+}
+
+TEST_F(UnixDatagramTest, BatchSizeZero)
+{
+    ASSERT_THROW(UnixDatagram(
+                     socketPath,
+                     [](const std::vector<std::string>&) {},
+                     std::make_shared<FakeMetricScope>(),
+                     std::make_shared<FakeMetricScope>(),
+                     0,
+                     0),
+                 std::runtime_error);
+}
+
+TEST_F(UnixDatagramTest, FlowControlInvalid)
+{
+    UnixDatagram endpoint(
+        socketPath,
+        [](const std::string&) {},
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>());
+    ASSERT_THROW(endpoint.setFlowControl({.credits = nullptr, .resumeCredits = 1, .checkIntervalMs = 1}),
+                 std::runtime_error);
+    ASSERT_THROW(endpoint.setFlowControl({.credits = []() { return std::size_t {1}; },
+                                          .resumeCredits = 1,
+                                          .checkIntervalMs = 0}),
+                 std::runtime_error);
+
+    endpoint.bind(loop);
+    ASSERT_THROW(endpoint.setFlowControl({.credits = []() { return std::size_t {1}; },
+                                          .resumeCredits = 1,
+                                          .checkIntervalMs = 1}),
+                 std::runtime_error);
+    endpoint.close();
+}
+
+TEST_F(UnixDatagramTest, FlowControlPauseWithoutCredits)
+{
+    std::size_t credits {0};
+    std::size_t received {0};
+    UnixDatagram endpoint(
+        socketPath,
+        [&](const std::vector<std::string>& batch) { received += batch.size(); },
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        4,
+        0);
+    endpoint.setFlowControl({.credits = [&credits]() { return credits; }, .resumeCredits = 8, .checkIntervalMs = 1});
+    endpoint.bind(loop);
+
+    // No credits, the datagram stays in the socket
+    sendUnixDatagram(socketPath, "Hello, Unix Datagram!");
+    loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_EQ(received, 0);
+    ASSERT_TRUE(endpoint.isFlowPaused());
+
+    // Below the resume threshold
+    credits = 4;
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_TRUE(endpoint.isFlowPaused());
+
+    credits = 8;
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_FALSE(endpoint.isFlowPaused());
+
+    loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_EQ(received, 1);
+    endpoint.close();
+}
+
+TEST_F(UnixDatagramTest, FlowControlAdvertiseCredits)
+{
+    std::size_t received {0};
+    UnixDatagram endpoint(
+        socketPath,
+        [&](const std::vector<std::string>& batch) { received += batch.size(); },
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        4,
+        0);
+    endpoint.setFlowControl(
+        {.credits = []() { return std::size_t {42}; }, .resumeCredits = 1, .checkIntervalMs = 1});
+    endpoint.bind(loop);
+
+    // A producer that binds its socket receives the credits
+    const auto clientPath = socketPath + ".client";
+    unlink(clientPath.c_str());
+    auto fd = getSendFD(socketPath);
+    sockaddr_un clientAddr {};
+    clientAddr.sun_family = AF_UNIX;
+    strncpy(clientAddr.sun_path, clientPath.c_str(), sizeof(clientAddr.sun_path) - 1);
+    ASSERT_EQ(::bind(fd, reinterpret_cast<sockaddr*>(&clientAddr), sizeof(clientAddr)), 0);
+
+    sendUnixDatagram(fd, "Hello, Unix Datagram!");
+    loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_EQ(received, 1);
+
+    char buffer[64] {};
+    const auto length = recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    ASSERT_GT(length, 0);
+    ASSERT_EQ(std::string(buffer, length), "credits:42");
+
+    close(fd);
+    unlink(clientPath.c_str());
+    endpoint.close();
+}
+
 TEST_F(UnixDatagramTest, PauseResumeReceiveData)
 {
     std::atomic<bool> receivedData(false);
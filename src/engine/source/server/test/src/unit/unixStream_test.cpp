@@ -559,8 +559,8 @@ TEST_F(UnixStreamTest, QueueWorker_SameClient)
         response.append(buffer, received);
     };
 
-    // Check the responses (order is not guaranteed, so we check the length)
-    ASSERT_EQ(expectedResponse.length(), response.length());
+    // The responses keep the order of the requests
+    ASSERT_EQ(expectedResponse, response);
 
     server.close();
     stopHandler->send();
@@ -0,0 +1,117 @@
+#ifndef _SOCKIFACE_SYNCSOCKHANDLER_HPP
+#define _SOCKIFACE_SYNCSOCKHANDLER_HPP
+
+#include <memory>
+#include <mutex>
+
+#include <sockiface/isockHandler.hpp>
+
+namespace sockiface
+{
+
+/**
+ * @brief Handler that serializes the operations of another one, so it can be shared by several threads
+ *
+ * Used by the helpers of the routes that are shared between the router workers.
+ */
+class SyncSockHandler final : public ISockHandler
+{
+private:
+    std::shared_ptr<ISockHandler> m_handler; ///< The wrapped handler
+    mutable std::mutex m_mutex;              ///< One operation of the wrapped handler at a time
+
+public:
+    /**
+     * @brief Construct a new SyncSockHandler
+     *
+     * @param handler The handler to wrap
+     * @throw std::runtime_error if the handler is empty
+     */
+    explicit SyncSockHandler(std::shared_ptr<ISockHandler> handler)
+        : m_handler(std::move(handler))
+    {
+        if (!m_handler)
+        {
+            throw std::runtime_error("The socket handler cannot be empty");
+        }
+    }
+
+    /**
+     * @copydoc ISockHandler::getMaxMsgSize
+     */
+    uint32_t getMaxMsgSize() const noexcept override { return m_handler->getMaxMsgSize(); }
+
+    /**
+     * @copydoc ISockHandler::getPath
+     */
+    std::string getPath() const noexcept override { return m_handler->getPath(); }
+
+    /**
+     * @copydoc ISockHandler::socketConnect
+     *
+     * Does nothing if another thread already connected the socket.
+     */
+    void socketConnect() override
+    {
+        std::lock_guard lock {m_mutex};
+        if (!m_handler->isConnected())
+        {
+            m_handler->socketConnect();
+        }
+    }
+
+    /**
+     * @copydoc ISockHandler::socketDisconnect
+     */
+    void socketDisconnect() override
+    {
+        std::lock_guard lock {m_mutex};
+        m_handler->socketDisconnect();
+    }
+
+    /**
+     * @copydoc ISockHandler::isConnected
+     */
+    bool isConnected() const noexcept override
+    {
+        std::lock_guard lock {m_mutex};
+        return m_handler->isConnected();
+    }
+
+    /**
+     * @copydoc ISockHandler::sendMsg
+     */
+    SendRetval sendMsg(const std::string& msg) override
+    {
+        std::lock_guard lock {m_mutex};
+        return m_handler->sendMsg(msg);
+    }
+
+    /**
+     * @copydoc ISockHandler::recvMsg
+     */
+    std::vector<char> recvMsg() override
+    {
+        std::lock_guard lock {m_mutex};
+        return m_handler->recvMsg();
+    }
+};
+
+/**
+ * @brief Wrap a handler to share it between several threads
+ *
+ * @param handler The handler to wrap
+ * @return std::shared_ptr<ISockHandler> The wrapped handler, nullptr if the handler is empty
+ */
+inline std::shared_ptr<ISockHandler> makeSync(std::shared_ptr<ISockHandler> handler)
+{
+    if (!handler)
+    {
+        return nullptr;
+    }
+    return std::make_shared<SyncSockHandler>(std::move(handler));
+}
+
+} // namespace sockiface
+
+#endif // _SOCKIFACE_SYNCSOCKHANDLER_HPP
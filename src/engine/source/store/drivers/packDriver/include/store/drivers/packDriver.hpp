@@ -0,0 +1,148 @@
+#ifndef _PACK_DRIVER_H
+#define _PACK_DRIVER_H
+
+#include <store/idriver.hpp>
+
+#include <filesystem>
+#include <map>
+#include <shared_mutex>
+
+namespace store::drivers
+{
+
+/**
+ * @brief Pack driver.
+ *
+ * This driver stores all the jsons in one file, which is memory mapped and indexed by name, so reading a document
+ * does not touch the filesystem. The file is an append only log of records:
+ *
+ *   <type: uint8><name size: uint32><content size: uint32><name><content>\0
+ *
+ * A write appends the new content of the document, a delete appends a tombstone. The old records are dropped when
+ * the file is compacted, once they take more space than the live ones. The sizes are stored in host byte order, the
+ * pack is a local file of the engine.
+ */
+class PackDriver : public IDriver
+{
+private:
+    static constexpr uint8_t RECORD_DOC = 1;
+    static constexpr uint8_t RECORD_TOMBSTONE = 2;
+
+    struct Record
+    {
+        uint8_t type;
+        std::string name;
+        std::string content;
+    };
+
+    struct Entry
+    {
+        std::size_t offset; ///< Offset of the content in the file
+        std::size_t size;   ///< Content size, without the trailing \0
+    };
+
+    std::filesystem::path m_path;
+    int m_fd;
+    const char* m_data; ///< Mapped file
+    std::size_t m_size; ///< Mapped and file size
+
+    std::map<std::string, Entry> m_index; ///< Full name to content, sorted so collections are ranges
+    std::size_t m_deadBytes;
+    mutable std::shared_mutex m_mutex;
+
+    void load();
+    void map();
+    void unmap();
+    base::OptError append(const std::vector<Record>& records);
+    void compactIfNeeded();
+
+    bool isDoc(const std::string& name) const { return m_index.find(name) != m_index.end(); }
+    bool isCol(const std::string& name) const;
+    std::vector<std::string> children(const std::string& prefix) const;
+
+public:
+    /**
+     * @brief Construct a new Pack Driver object.
+     *
+     * @param path Path of the pack file.
+     * @param create If true, the file will be created if it doesn't exist.
+     * @throw std::runtime_error if the file can not be opened or is not a pack.
+     */
+    PackDriver(const std::filesystem::path& path, bool create = false);
+    ~PackDriver();
+
+    PackDriver(const PackDriver&) = delete;
+    PackDriver& operator=(const PackDriver&) = delete;
+
+    /**
+     * @brief Copy all the documents of another driver to the pack.
+     *
+     * @param source Driver to copy from, as the file driver of an existing store.
+     * @return base::OptError with the first error or empty if all the documents were copied.
+     */
+    base::OptError import(const IDriver& source);
+
+    /**
+     * @brief Check if the pack has no documents.
+     *
+     */
+    bool empty() const;
+
+    /**
+     * @copydoc IDriver::createDoc
+     */
+    base::OptError createDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::readDoc
+     */
+    base::RespOrError<Doc> readDoc(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::updateDoc
+     */
+    base::OptError updateDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::upsertDoc
+     */
+    base::OptError upsertDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::deleteDoc
+     */
+    base::OptError deleteDoc(const base::Name& name) override;
+
+    /**
+     * @copydoc IDriver::readCol
+     */
+    base::RespOrError<Col> readCol(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::readRoot
+     */
+    base::RespOrError<Col> readRoot() const override;
+
+    /**
+     * @copydoc IDriver::deleteCol
+     */
+    base::OptError deleteCol(const base::Name& name) override;
+
+    /**
+     * @copydoc IDriver::exists
+     */
+    bool exists(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::existsDoc
+     */
+    bool existsDoc(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::existsCol
+     */
+    bool existsCol(const base::Name& name) const override;
+};
+} // namespace store::drivers
+
+#endif // _PACK_DRIVER_H
@@ -0,0 +1,582 @@
+#include "store/drivers/packDriver.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <base/logging.hpp>
+
+namespace store::drivers
+{
+
+namespace
+{
+constexpr char MAGIC[] = "WZEPACK1";
+constexpr std::size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+constexpr std::size_t HEADER_SIZE = sizeof(uint8_t) + 2 * sizeof(uint32_t);
+constexpr std::size_t COMPACT_MIN_BYTES = 1024 * 1024; ///< Dead bytes before compacting
+
+std::size_t recordSize(std::size_t nameSize, std::size_t contentSize)
+{
+    return HEADER_SIZE + nameSize + contentSize + 1;
+}
+
+void appendRecord(std::string& buffer, uint8_t type, std::string_view name, std::string_view content)
+{
+    const auto nameSize = static_cast<uint32_t>(name.size());
+    const auto contentSize = static_cast<uint32_t>(content.size());
+    buffer.push_back(static_cast<char>(type));
+    buffer.append(reinterpret_cast<const char*>(&nameSize), sizeof(nameSize));
+    buffer.append(reinterpret_cast<const char*>(&contentSize), sizeof(contentSize));
+    buffer.append(name);
+    buffer.append(content);
+    buffer.push_back('\0');
+}
+
+bool writeAll(int fd, const std::string& buffer)
+{
+    std::size_t written = 0;
+    while (written < buffer.size())
+    {
+        auto n = ::write(fd, buffer.data() + written, buffer.size() - written);
+        if (n < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+} // namespace
+
+PackDriver::PackDriver(const std::filesystem::path& path, bool create)
+    : m_path(path)
+    , m_fd(-1)
+    , m_data(nullptr)
+    , m_size(0)
+    , m_deadBytes(0)
+{
+    LOG_DEBUG("Engine pack driver init with path '{}' and create '{}'.", path.string(), create);
+
+    if (!std::filesystem::exists(path) && !create)
+    {
+        throw std::runtime_error(fmt::format("Path '{}' does not exist", path.string()));
+    }
+    if (std::filesystem::is_directory(path))
+    {
+        throw std::runtime_error(fmt::format("Path '{}' is a directory", path.string()));
+    }
+
+    load();
+}
+
+PackDriver::~PackDriver()
+{
+    unmap();
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+    }
+}
+
+void PackDriver::map()
+{
+    auto* data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (MAP_FAILED == data)
+    {
+        throw std::runtime_error(fmt::format("File '{}' could not be mapped: {}", m_path.string(), strerror(errno)));
+    }
+    m_data = static_cast<const char*>(data);
+}
+
+void PackDriver::unmap()
+{
+    if (m_data != nullptr)
+    {
+        ::munmap(const_cast<char*>(m_data), m_size);
+        m_data = nullptr;
+    }
+}
+
+void PackDriver::load()
+{
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_APPEND | O_CREAT | O_CLOEXEC, 0660);
+    if (m_fd < 0)
+    {
+        throw std::runtime_error(fmt::format("File '{}' could not be opened: {}", m_path.string(), strerror(errno)));
+    }
+
+    struct stat st {};
+    if (0 != fstat(m_fd, &st))
+    {
+        throw std::runtime_error(fmt::format("File '{}' could not be read: {}", m_path.string(), strerror(errno)));
+    }
+    m_size = static_cast<std::size_t>(st.st_size);
+
+    if (0 == m_size)
+    {
+        if (!writeAll(m_fd, std::string(MAGIC, MAGIC_SIZE)))
+        {
+            throw std::runtime_error(
+                fmt::format("File '{}' could not be written: {}", m_path.string(), strerror(errno)));
+        }
+        m_size = MAGIC_SIZE;
+    }
+
+    map();
+    if (m_size < MAGIC_SIZE || 0 != std::memcmp(m_data, MAGIC, MAGIC_SIZE))
+    {
+        throw std::runtime_error(fmt::format("File '{}' is not a store pack", m_path.string()));
+    }
+
+    // Index the last record of each name
+    m_index.clear();
+    m_deadBytes = 0;
+    std::size_t offset = MAGIC_SIZE;
+    while (offset < m_size)
+    {
+        uint32_t nameSize = 0;
+        uint32_t contentSize = 0;
+        if (offset + HEADER_SIZE <= m_size)
+        {
+            std::memcpy(&nameSize, m_data + offset + 1, sizeof(nameSize));
+            std::memcpy(&contentSize, m_data + offset + 1 + sizeof(nameSize), sizeof(contentSize));
+        }
+
+        const auto size = recordSize(nameSize, contentSize);
+        if (offset + HEADER_SIZE > m_size || offset + size > m_size)
+        {
+            // Interrupted write, the record was never acknowledged
+            LOG_WARNING("Store pack '{}' has an incomplete record at {}, it is discarded.", m_path.string(), offset);
+            unmap();
+            if (0 != ::ftruncate(m_fd, static_cast<off_t>(offset)))
+            {
+                throw std::runtime_error(
+                    fmt::format("File '{}' could not be truncated: {}", m_path.string(), strerror(errno)));
+            }
+            m_size = offset;
+            map();
+            break;
+        }
+
+        const auto type = static_cast<uint8_t>(m_data[offset]);
+        std::string name(m_data + offset + HEADER_SIZE, nameSize);
+        auto it = m_index.find(name);
+        if (it != m_index.end())
+        {
+            m_deadBytes += recordSize(it->first.size(), it->second.size);
+        }
+
+        if (RECORD_DOC == type)
+        {
+            m_index[std::move(name)] = Entry {offset + HEADER_SIZE + nameSize, contentSize};
+        }
+        else if (RECORD_TOMBSTONE == type)
+        {
+            if (it != m_index.end())
+            {
+                m_index.erase(it);
+            }
+            m_deadBytes += size;
+        }
+        else
+        {
+            throw std::runtime_error(fmt::format("File '{}' is corrupted at offset {}", m_path.string(), offset));
+        }
+
+        offset += size;
+    }
+}
+
+base::OptError PackDriver::append(const std::vector<Record>& records)
+{
+    std::string buffer;
+    for (const auto& record : records)
+    {
+        appendRecord(buffer, record.type, record.name, record.content);
+    }
+
+    if (!writeAll(m_fd, buffer))
+    {
+        const std::string error = strerror(errno);
+        // Do not leave half a record behind
+        if (0 != ::ftruncate(m_fd, static_cast<off_t>(m_size)))
+        {
+            LOG_ERROR("Store pack '{}' could not be truncated: {}", m_path.string(), strerror(errno));
+        }
+        return base::Error {fmt::format("File '{}' could not be written: {}", m_path.string(), error)};
+    }
+
+    unmap();
+    auto offset = m_size;
+    m_size += buffer.size();
+    map();
+
+    for (const auto& record : records)
+    {
+        const auto size = recordSize(record.name.size(), record.content.size());
+        auto it = m_index.find(record.name);
+        if (it != m_index.end())
+        {
+            m_deadBytes += recordSize(it->first.size(), it->second.size);
+        }
+
+        if (RECORD_DOC == record.type)
+        {
+            m_index[record.name] = Entry {offset + HEADER_SIZE + record.name.size(), record.content.size()};
+        }
+        else
+        {
+            if (it != m_index.end())
+            {
+                m_index.erase(it);
+            }
+            m_deadBytes += size;
+        }
+        offset += size;
+    }
+
+    compactIfNeeded();
+    return base::noError();
+}
+
+void PackDriver::compactIfNeeded()
+{
+    const auto liveBytes = m_size - MAGIC_SIZE - m_deadBytes;
+    if (m_deadBytes < COMPACT_MIN_BYTES || m_deadBytes < liveBytes)
+    {
+        return;
+    }
+
+    const auto tmpPath = m_path.string() + ".tmp";
+    std::string buffer(MAGIC, MAGIC_SIZE);
+    buffer.reserve(MAGIC_SIZE + liveBytes);
+    for (const auto& [name, entry] : m_index)
+    {
+        appendRecord(buffer, RECORD_DOC, name, std::string_view(m_data + entry.offset, entry.size));
+    }
+
+    auto fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0660);
+    if (fd < 0 || !writeAll(fd, buffer) || 0 != ::fdatasync(fd))
+    {
+        LOG_WARNING("Store pack '{}' could not be compacted: {}", m_path.string(), strerror(errno));
+        if (fd >= 0)
+        {
+            ::close(fd);
+            std::filesystem::remove(tmpPath);
+        }
+        return;
+    }
+    ::close(fd);
+
+    if (0 != std::rename(tmpPath.c_str(), m_path.c_str()))
+    {
+        LOG_WARNING("Store pack '{}' could not be replaced: {}", m_path.string(), strerror(errno));
+        std::filesystem::remove(tmpPath);
+        return;
+    }
+
+    LOG_DEBUG("Store pack '{}' compacted, {} bytes released.", m_path.string(), m_deadBytes);
+    unmap();
+    ::close(m_fd);
+    load();
+}
+
+bool PackDriver::isCol(const std::string& name) const
+{
+    const auto prefix = name + base::Name::SEPARATOR_S;
+    auto it = m_index.lower_bound(prefix);
+    return it != m_index.end() && 0 == it->first.compare(0, prefix.size(), prefix);
+}
+
+std::vector<std::string> PackDriver::children(const std::string& prefix) const
+{
+    // The names under a prefix are contiguous in the index
+    std::vector<std::string> parts;
+    for (auto it = m_index.lower_bound(prefix);
+         it != m_index.end() && 0 == it->first.compare(0, prefix.size(), prefix);
+         ++it)
+    {
+        const auto end = it->first.find(base::Name::SEPARATOR_C, prefix.size());
+        auto part = it->first.substr(prefix.size(), end - prefix.size());
+        if (parts.empty() || parts.back() != part)
+        {
+            parts.emplace_back(std::move(part));
+        }
+    }
+    return parts;
+}
+
+base::OptError PackDriver::import(const IDriver& source)
+{
+    std::vector<Record> records;
+    auto visitor = [&](const base::Name& name, auto& visitorRef) -> base::OptError
+    {
+        if (source.existsDoc(name))
+        {
+            auto doc = source.readDoc(name);
+            if (base::isError(doc))
+            {
+                return base::getError(doc);
+            }
+            records.push_back(Record {RECORD_DOC, name.fullName(), base::getResponse<Doc>(doc).str()});
+            return base::noError();
+        }
+
+        auto col = source.readCol(name);
+        if (base::isError(col))
+        {
+            return base::getError(col);
+        }
+        for (const auto& child : base::getResponse<Col>(col))
+        {
+            if (auto error = visitorRef(child, visitorRef))
+            {
+                return error;
+            }
+        }
+        return base::noError();
+    };
+
+    auto root = source.readRoot();
+    if (base::isError(root))
+    {
+        return base::getError(root);
+    }
+    for (const auto& name : base::getResponse<Col>(root))
+    {
+        if (auto error = visitor(name, visitor))
+        {
+            return error;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (auto error = append(records))
+    {
+        return error;
+    }
+
+    LOG_INFO("Store pack '{}' imported {} documents.", m_path.string(), records.size());
+    return base::noError();
+}
+
+bool PackDriver::empty() const
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_index.empty();
+}
+
+base::OptError PackDriver::createDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("PackDriver createDoc name: '{}'.", name.fullName());
+    LOG_TRACE("PackDriver createDoc content: '{}'.", content.prettyStr());
+
+    auto duplicateError = content.checkDuplicateKeys();
+    if (duplicateError)
+    {
+        return base::Error {
+            fmt::format("Content '{}' has duplicate keys: {}", name.fullName(), duplicateError.value().message)};
+    }
+
+    const auto fullName = name.fullName();
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (isDoc(fullName) || isCol(fullName))
+    {
+        return base::Error {fmt::format("Document '{}' already exists", fullName)};
+    }
+
+    // A document can not be inside another one
+    for (auto end = fullName.find(base::Name::SEPARATOR_C); end != std::string::npos;
+         end = fullName.find(base::Name::SEPARATOR_C, end + 1))
+    {
+        if (isDoc(fullName.substr(0, end)))
+        {
+            return base::Error {fmt::format(
+                "Document '{}' could not be created, '{}' is a document", fullName, fullName.substr(0, end))};
+        }
+    }
+
+    return append({Record {RECORD_DOC, fullName, content.str()}});
+}
+
+base::RespOrError<Doc> PackDriver::readDoc(const base::Name& name) const
+{
+    LOG_DEBUG("PackDriver readDoc name: '{}'.", name.fullName());
+
+    const auto fullName = name.fullName();
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_index.find(fullName);
+    if (it == m_index.end())
+    {
+        if (isCol(fullName))
+        {
+            return base::Error {fmt::format("Document '{}' is a collection", fullName)};
+        }
+        return base::Error {fmt::format("Document '{}' does not exist", fullName)};
+    }
+
+    // The content is followed by \0, it is parsed in place
+    try
+    {
+        return Doc {m_data + it->second.offset};
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Document '{}' could not be parsed: {}", fullName, e.what())};
+    }
+}
+
+base::OptError PackDriver::updateDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("PackDriver updateDoc name: '{}'.", name.fullName());
+    LOG_TRACE("PackDriver updateDoc content: '{}'.", content.prettyStr());
+
+    auto duplicateError = content.checkDuplicateKeys();
+    if (duplicateError)
+    {
+        return base::Error {
+            fmt::format("Content '{}' has duplicate keys: {}", name.fullName(), duplicateError.value().message)};
+    }
+
+    const auto fullName = name.fullName();
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!isDoc(fullName))
+    {
+        if (isCol(fullName))
+        {
+            return base::Error {fmt::format("Document '{}' is a collection", fullName)};
+        }
+        return base::Error {fmt::format("Document '{}' does not exist", fullName)};
+    }
+
+    return append({Record {RECORD_DOC, fullName, content.str()}});
+}
+
+base::OptError PackDriver::upsertDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("PackDriver upsertDoc name: '{}'.", name.fullName());
+
+    if (existsDoc(name))
+    {
+        return updateDoc(name, content);
+    }
+    else
+    {
+        return createDoc(name, content);
+    }
+}
+
+base::OptError PackDriver::deleteDoc(const base::Name& name)
+{
+    LOG_DEBUG("PackDriver deleteDoc name: '{}'.", name.fullName());
+
+    const auto fullName = name.fullName();
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!isDoc(fullName))
+    {
+        return base::Error {fmt::format("Document '{}' does not exist", fullName)};
+    }
+
+    return append({Record {RECORD_TOMBSTONE, fullName, {}}});
+}
+
+base::RespOrError<Col> PackDriver::readCol(const base::Name& name) const
+{
+    LOG_DEBUG("PackDriver readCol name: '{}'.", name.fullName());
+
+    const auto fullName = name.fullName();
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    if (isDoc(fullName))
+    {
+        return base::Error {fmt::format("Collection '{}' is a document", fullName)};
+    }
+
+    const auto parts = children(fullName + base::Name::SEPARATOR_S);
+    if (parts.empty())
+    {
+        return base::Error {fmt::format("Collection '{}' does not exist", fullName)};
+    }
+
+    Col col;
+    col.reserve(parts.size());
+    for (const auto& part : parts)
+    {
+        col.emplace_back(name + base::Name(part));
+    }
+    return col;
+}
+
+base::RespOrError<Col> PackDriver::readRoot() const
+{
+    LOG_DEBUG("PackDriver readRoot.");
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    Col col;
+    for (const auto& part : children(""))
+    {
+        col.emplace_back(part);
+    }
+    return col;
+}
+
+base::OptError PackDriver::deleteCol(const base::Name& name)
+{
+    LOG_DEBUG("PackDriver deleteCol name: '{}'.", name.fullName());
+
+    const auto fullName = name.fullName();
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (isDoc(fullName))
+    {
+        return base::Error {fmt::format("Collection '{}' is a document", fullName)};
+    }
+    if (!isCol(fullName))
+    {
+        return base::Error {fmt::format("Collection '{}' does not exist", fullName)};
+    }
+
+    const auto prefix = fullName + base::Name::SEPARATOR_S;
+    std::vector<Record> tombstones;
+    for (auto it = m_index.lower_bound(prefix);
+         it != m_index.end() && 0 == it->first.compare(0, prefix.size(), prefix);
+         ++it)
+    {
+        tombstones.push_back(Record {RECORD_TOMBSTONE, it->first, {}});
+    }
+
+    return append(tombstones);
+}
+
+bool PackDriver::exists(const base::Name& name) const
+{
+    const auto fullName = name.fullName();
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return isDoc(fullName) || isCol(fullName);
+}
+
+bool PackDriver::existsDoc(const base::Name& name) const
+{
+    const auto fullName = name.fullName();
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return isDoc(fullName);
+}
+
+bool PackDriver::existsCol(const base::Name& name) const
+{
+    const auto fullName = name.fullName();
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return isCol(fullName);
+}
+
+} // namespace store::drivers
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <shared_mutex>
+#include <unordered_map>
 
 #include <store/idriver.hpp>
 #include <store/istore.hpp>
@@ -21,6 +22,26 @@ private:
     std::unique_ptr<DBDocNames> m_cache; ///< Cache for the doc names and virtual space names.
     mutable std::shared_mutex m_mutex;   ///< sync the m_cache with the store. and protect the m_cache access.
 
+    // Parsed documents by real name, the writes through the store invalidate them
+    mutable std::unordered_map<base::Name, Doc> m_docs;
+    mutable uint64_t m_docsGeneration;     ///< Incremented on each invalidation.
+    mutable std::shared_mutex m_docsMutex; ///< Protect the m_docs access.
+
+    /**
+     * @brief Read a document from the parsed documents cache or from the driver.
+     *
+     * @param realName The name of the document in the store driver.
+     * @return base::RespOrError<Doc> The document or the driver error.
+     */
+    base::RespOrError<Doc> readCachedDoc(const base::Name& realName) const;
+
+    /**
+     * @brief Drop a document from the parsed documents cache, or all of them if no name is given.
+     *
+     * @param realName The name of the document in the store driver.
+     */
+    void invalidateDoc(const std::optional<base::Name>& realName) const;
+
     /**
      * @brief Translate a virtual name to a real name in the store driver.
      *
@@ -283,6 +283,7 @@ Store::Store(std::shared_ptr<IDriver> driver)
     : m_driver(std::move(driver))
     , m_cache(std::make_unique<DBDocNames>())
     , m_mutex()
+    , m_docsGeneration(0)
 {
     if (m_driver == nullptr)
     {
@@ -360,6 +361,47 @@ Store::Store(std::shared_ptr<IDriver> driver)
 
 Store::~Store() = default;
 
+base::RespOrError<Doc> Store::readCachedDoc(const base::Name& realName) const
+{
+    uint64_t generation;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_docsMutex);
+        auto it = m_docs.find(realName);
+        if (it != m_docs.end())
+        {
+            return Doc {it->second};
+        }
+        generation = m_docsGeneration;
+    }
+
+    auto result = m_driver->readDoc(realName);
+    if (!base::isError(result))
+    {
+        std::unique_lock<std::shared_mutex> lock(m_docsMutex);
+        // Not cached if it was written while being read, it may be the old content
+        if (generation == m_docsGeneration)
+        {
+            m_docs.emplace(realName, Doc {base::getResponse<Doc>(result)});
+        }
+    }
+
+    return result;
+}
+
+void Store::invalidateDoc(const std::optional<base::Name>& realName) const
+{
+    std::unique_lock<std::shared_mutex> lock(m_docsMutex);
+    if (realName)
+    {
+        m_docs.erase(realName.value());
+    }
+    else
+    {
+        m_docs.clear();
+    }
+    ++m_docsGeneration;
+}
+
 //----------------------------------------------------------------------------------------
 //                                Read interface definition
 //----------------------------------------------------------------------------------------
@@ -385,7 +427,7 @@ base::RespOrError<Doc> Store::readDoc(const base::Name& name) const
     // Transform the virtual name to the real name
     const auto rname = virtualToRealName(name, *namespaceId);
 
-    return m_driver->readDoc(rname);
+    return readCachedDoc(rname);
 }
 
 std::vector<NamespaceId> Store::listNamespaces() const
@@ -459,7 +501,9 @@ base::OptError Store::updateDoc(const base::Name& name, const Doc& content)
 
     // update the document
     auto rName = virtualToRealName(name, *namespaceId);
-    return m_driver->updateDoc(rName, content);
+    auto error = m_driver->updateDoc(rName, content);
+    invalidateDoc(rName);
+    return error;
 }
 
 base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& namespaceId, const Doc& content)
@@ -475,6 +519,7 @@ base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& names
 
     auto rName = virtualToRealName(name, namespaceId);
     auto error = m_driver->upsertDoc(rName, content);
+    invalidateDoc(rName);
     if (error)
     {
         return error;
@@ -503,6 +548,7 @@ base::OptError Store::deleteDoc(const base::Name& name)
     auto rName = virtualToRealName(name, *namespaceId);
 
     auto error = m_driver->deleteDoc(rName);
+    invalidateDoc(rName);
     if (error)
     {
         return error;
@@ -524,6 +570,7 @@ base::OptError Store::deleteCol(const base::Name& name, const NamespaceId& names
 
     // Delete the collection
     auto error = m_driver->deleteCol(virtualToRealName(name, namespaceId));
+    invalidateDoc(std::nullopt);
     if (error)
     {
         return error;
@@ -553,7 +600,7 @@ base::OptError Store::createInternalDoc(const base::Name& name, const Doc& conte
 base::RespOrError<Doc> Store::readInternalDoc(const base::Name& name) const
 {
     // No check if the document starts with the internal namespace, allow to read any document
-    return m_driver->readDoc(name);
+    return readCachedDoc(name);
 }
 
 base::OptError Store::updateInternalDoc(const base::Name& name, const Doc& content)
@@ -565,7 +612,9 @@ base::OptError Store::updateInternalDoc(const base::Name& name, const Doc& conte
                                         name.fullName(),
                                         sm_prefixNS.parts()[0])};
     }
-    return m_driver->updateDoc(name, content);
+    auto error = m_driver->updateDoc(name, content);
+    invalidateDoc(name);
+    return error;
 }
 
 base::OptError Store::upsertInternalDoc(const base::Name& name, const Doc& content)
@@ -583,7 +632,9 @@ base::OptError Store::upsertInternalDoc(const base::Name& name, const Doc& conte
         return m_driver->createDoc(name, content);
     }
 
-    return m_driver->updateDoc(name, content);
+    auto error = m_driver->updateDoc(name, content);
+    invalidateDoc(name);
+    return error;
 }
 
 base::OptError Store::deleteInternalDoc(const base::Name& name)
@@ -595,7 +646,9 @@ base::OptError Store::deleteInternalDoc(const base::Name& name)
                                         name.fullName(),
                                         sm_prefixNS.parts()[0])};
     }
-    return m_driver->deleteDoc(name);
+    auto error = m_driver->deleteDoc(name);
+    invalidateDoc(name);
+    return error;
 }
 
 base::RespOrError<Col> Store::readInternalCol(const base::Name& name) const
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include <store/drivers/fileDriver.hpp>
+#include <store/drivers/packDriver.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <base/logging.hpp>
+#include <fmt/format.h>
+
+static const std::filesystem::path TEST_PATH = "/tmp/packDriver_test";
+static const base::Name TEST_NAME({"type", "name", "version"});
+static const base::Name TEST_NAME_2({"type", "name", "version2"});
+static const base::Name TEST_NAME_COLLECTION(std::vector<std::string> {"type", "name"});
+
+static const json::Json TEST_JSON {R"({"key": "value"})"};
+static const json::Json TEST_JSON2 {R"({"key": "value2"})"};
+
+using namespace store::drivers;
+
+class PackDriverTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_path;
+    std::filesystem::path m_packPath;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        auto pid = getpid();
+        auto tid = std::this_thread::get_id();
+        std::stringstream ss;
+        ss << pid << "_" << tid; // Unique path per thread and process
+        m_path = TEST_PATH / ss.str();
+        m_packPath = m_path / "store.pack";
+        std::filesystem::create_directories(m_path);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_path); }
+};
+
+TEST_F(PackDriverTest, Builds)
+{
+    ASSERT_THROW(PackDriver(m_packPath, false), std::runtime_error);
+    ASSERT_THROW(PackDriver(m_path, true), std::runtime_error);
+    ASSERT_NO_THROW(PackDriver(m_packPath, true));
+    ASSERT_TRUE(std::filesystem::is_regular_file(m_packPath));
+    ASSERT_NO_THROW(PackDriver(m_packPath, false));
+}
+
+TEST_F(PackDriverTest, BuildsNotAPack)
+{
+    {
+        std::ofstream file(m_packPath);
+        file << TEST_JSON.str();
+    }
+    ASSERT_THROW(PackDriver(m_packPath), std::runtime_error);
+}
+
+TEST_F(PackDriverTest, CreateAndRead)
+{
+    PackDriver driver(m_packPath, true);
+    ASSERT_TRUE(driver.empty());
+    ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(driver.empty());
+
+    auto result = driver.readDoc(TEST_NAME);
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(base::getResponse<store::Doc>(result), TEST_JSON);
+
+    ASSERT_TRUE(driver.existsDoc(TEST_NAME));
+    ASSERT_TRUE(driver.existsCol(TEST_NAME_COLLECTION));
+    ASSERT_TRUE(driver.exists(TEST_NAME_COLLECTION));
+    ASSERT_FALSE(driver.existsDoc(TEST_NAME_COLLECTION));
+}
+
+TEST_F(PackDriverTest, CreateFail)
+{
+    PackDriver driver(m_packPath, true);
+    ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+    // Already exists, is a collection or is inside a document
+    ASSERT_TRUE(driver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_TRUE(driver.createDoc(TEST_NAME_COLLECTION, TEST_JSON));
+    ASSERT_TRUE(driver.createDoc(TEST_NAME + base::Name("child"), TEST_JSON));
+    ASSERT_TRUE(driver.createDoc(TEST_NAME_2, json::Json {R"({"key": 1, "key": 2})"}));
+}
+
+TEST_F(PackDriverTest, ReadFail)
+{
+    PackDriver driver(m_packPath, true);
+    ASSERT_TRUE(base::isError(driver.readDoc(TEST_NAME)));
+    ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_TRUE(base::isError(driver.readDoc(TEST_NAME_COLLECTION)));
+    ASSERT_TRUE(base::isError(driver.readCol(TEST_NAME)));
+    ASSERT_TRUE(base::isError(driver.readCol(base::Name("none"))));
+}
+
+TEST_F(PackDriverTest, UpdateAndUpsert)
+{
+    PackDriver driver(m_packPath, true);
+    ASSERT_TRUE(driver.updateDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(driver.upsertDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(driver.updateDoc(TEST_NAME, TEST_JSON2));
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), TEST_JSON2);
+    ASSERT_FALSE(driver.upsertDoc(TEST_NAME, TEST_JSON));
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), TEST_JSON);
+}
+
+TEST_F(PackDriverTest, Delete)
+{
+    PackDriver driver(m_packPath, true);
+    ASSERT_TRUE(driver.deleteDoc(TEST_NAME));
+    ASSERT_TRUE(driver.deleteCol(TEST_NAME_COLLECTION));
+
+    ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_2, TEST_JSON));
+    ASSERT_TRUE(driver.deleteCol(TEST_NAME));
+    ASSERT_FALSE(driver.deleteDoc(TEST_NAME));
+    ASSERT_FALSE(driver.existsDoc(TEST_NAME));
+    ASSERT_TRUE(driver.existsDoc(TEST_NAME_2));
+
+    ASSERT_FALSE(driver.deleteCol(TEST_NAME_COLLECTION));
+    ASSERT_FALSE(driver.exists(TEST_NAME_COLLECTION));
+    ASSERT_TRUE(driver.empty());
+}
+
+TEST_F(PackDriverTest, ReadColAndRoot)
+{
+    PackDriver driver(m_packPath, true);
+    ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_2, TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(base::Name({"type", "other", "version"}), TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(base::Name({"type2", "name", "version"}), TEST_JSON));
+
+    auto col = driver.readCol(TEST_NAME_COLLECTION);
+    ASSERT_FALSE(base::isError(col));
+    ASSERT_EQ(base::getResponse<store::Col>(col), (store::Col {TEST_NAME, TEST_NAME_2}));
+
+    col = driver.readCol(base::Name("type"));
+    ASSERT_FALSE(base::isError(col));
+    ASSERT_EQ(base::getResponse<store::Col>(col),
+              (store::Col {base::Name({"type", "name"}), base::Name({"type", "other"})}));
+
+    auto root = driver.readRoot();
+    ASSERT_FALSE(base::isError(root));
+    ASSERT_EQ(base::getResponse<store::Col>(root), (store::Col {base::Name("type"), base::Name("type2")}));
+}
+
+TEST_F(PackDriverTest, Reopen)
+{
+    {
+        PackDriver driver(m_packPath, true);
+        ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+        ASSERT_FALSE(driver.createDoc(TEST_NAME_2, TEST_JSON));
+        ASSERT_FALSE(driver.updateDoc(TEST_NAME, TEST_JSON2));
+        ASSERT_FALSE(driver.deleteDoc(TEST_NAME_2));
+    }
+
+    PackDriver driver(m_packPath);
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), TEST_JSON2);
+    ASSERT_FALSE(driver.existsDoc(TEST_NAME_2));
+}
+
+TEST_F(PackDriverTest, ReopenIncompleteRecord)
+{
+    std::uintmax_t size;
+    {
+        PackDriver driver(m_packPath, true);
+        ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+        size = std::filesystem::file_size(m_packPath);
+        ASSERT_FALSE(driver.createDoc(TEST_NAME_2, TEST_JSON));
+    }
+    std::filesystem::resize_file(m_packPath, std::filesystem::file_size(m_packPath) - 3);
+
+    PackDriver driver(m_packPath);
+    ASSERT_TRUE(driver.existsDoc(TEST_NAME));
+    ASSERT_FALSE(driver.existsDoc(TEST_NAME_2));
+    ASSERT_EQ(std::filesystem::file_size(m_packPath), size);
+
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_2, TEST_JSON2));
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME_2)), TEST_JSON2);
+}
+
+TEST_F(PackDriverTest, Compacts)
+{
+    const json::Json bigJson {fmt::format(R"({{"key": "{}"}})", std::string(64 * 1024, 'x')).c_str()};
+
+    PackDriver driver(m_packPath, true);
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_2, TEST_JSON));
+    for (auto i = 0; i < 40; ++i)
+    {
+        ASSERT_FALSE(driver.upsertDoc(TEST_NAME, bigJson));
+    }
+    ASSERT_LT(std::filesystem::file_size(m_packPath), 40 * 64 * 1024);
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), bigJson);
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME_2)), TEST_JSON);
+
+    PackDriver reopened(m_packPath);
+    ASSERT_EQ(base::getResponse<store::Doc>(reopened.readDoc(TEST_NAME)), bigJson);
+}
+
+TEST_F(PackDriverTest, ImportFileDriver)
+{
+    const auto filesPath = m_path / "files";
+    {
+        FileDriver files(filesPath, true);
+        ASSERT_FALSE(files.createDoc(TEST_NAME, TEST_JSON));
+        ASSERT_FALSE(files.createDoc(TEST_NAME_2, TEST_JSON2));
+        ASSERT_FALSE(files.createDoc(base::Name({"type2", "name"}), TEST_JSON));
+    }
+
+    PackDriver driver(m_packPath, true);
+    ASSERT_FALSE(driver.import(FileDriver(filesPath)));
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), TEST_JSON);
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME_2)), TEST_JSON2);
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(base::Name({"type2", "name"}))), TEST_JSON);
+    ASSERT_EQ(base::getResponse<store::Col>(driver.readRoot()), (store::Col {base::Name("type"), base::Name("type2")}));
+}
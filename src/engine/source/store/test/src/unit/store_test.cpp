@@ -234,6 +234,37 @@ TEST_F(StoreTest, ReadDoc_ok)
     ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
 }
 
+TEST_F(StoreTest, ReadDoc_cached)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+    auto res = store->readDoc(doc_1A);
+
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+}
+
+TEST_F(StoreTest, ReadDoc_errorNotCached)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadError<Doc>()))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+    ASSERT_TRUE(base::isError(store->readDoc(doc_1A)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+}
+
+TEST_F(StoreTest, ReadDoc_invalidatedOnUpdate)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+    ASSERT_EQ(std::get<Doc>(store->readDoc(doc_1A)), jdoc_1A);
+
+    EXPECT_CALL(*driver, updateDoc(rDoc_1A, jdoc_1B)).WillOnce(testing::Return(std::nullopt));
+    ASSERT_FALSE(store->updateDoc(doc_1A, jdoc_1B));
+    ASSERT_EQ(std::get<Doc>(store->readDoc(doc_1A)), jdoc_1B);
+}
+
 /*******************************************************************************
                         Store::readCol
 *******************************************************************************/
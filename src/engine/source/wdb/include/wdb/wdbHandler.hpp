@@ -79,7 +79,19 @@ public:
      * code and the optional data (payload)
      */
     std::tuple<QueryResultCodes, std::optional<std::string>>
-    parseResult(const std::string& result) const noexcept override;
+    parseResult(const std::string& result) const noexcept override
+    {
+        return parse(result);
+    }
+
+    /**
+     * @brief Parse a query result, it does not need a connection
+     *
+     * @param result Result of the query
+     * @return std::tuple<QueryResultCodes, std::optional<std::string>> Tuple with the
+     * code and the optional data (payload)
+     */
+    static std::tuple<QueryResultCodes, std::optional<std::string>> parse(const std::string& result) noexcept;
 
     /**
      * @brief Perform a query and parse result
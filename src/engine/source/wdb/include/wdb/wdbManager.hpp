@@ -1,6 +1,7 @@
 #ifndef _WDB_WDB_MANAGER_HPP
 #define _WDB_WDB_MANAGER_HPP
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -12,32 +13,53 @@
 namespace wazuhdb
 {
 
+class WDBPool;
+
+/**
+ * @brief Connection pool options
+ *
+ */
+struct WDBOptions
+{
+    std::size_t connections = 1;               ///< Connections shared by all the handlers, sized to the workers
+    std::size_t cacheSize = 0;                 ///< Max cached results of `sql select` queries, 0 disables the cache
+    std::chrono::milliseconds cacheTtl {1000}; ///< Time a cached result is valid
+};
+
 class WDBManager final : public IWDBManager
 {
 private:
-    std::string m_sockPath;
-    std::shared_ptr<sockiface::ISockFactory> m_sockFactory;
+    std::shared_ptr<WDBPool> m_pool;
 
 public:
     using sockProtocol = sockiface::ISockHandler::Protocol;
 
-    WDBManager(const std::string& sockPath, std::shared_ptr<sockiface::ISockFactory> sockFactory)
-        : m_sockPath(sockPath)
-        , m_sockFactory(sockFactory)
-    {
-    }
+    /**
+     * @brief Construct a manager with a pool of connections to wazuh-db
+     *
+     * @param sockPath Path to the wdb socket
+     * @param sockFactory Factory of the connection sockets
+     * @param options Pool options
+     * @throw std::runtime_error if the pool has no connections
+     */
+    WDBManager(const std::string& sockPath,
+               std::shared_ptr<sockiface::ISockFactory> sockFactory,
+               const WDBOptions& options = WDBOptions {});
 
     ~WDBManager() = default;
 
-    /** @brief Create a WazuhDB connection handler from a path
+    /**
+     * @brief Get a handler of the pool. The handlers keep the pool alive and can be used by several threads, each
+     * query waits for a free connection.
      *
-     * @param sockPath Path to the wdb socket
      */
-    std::shared_ptr<IWDBHandler> connection() override
-    {
-        auto socket = m_sockFactory->getHandler(sockProtocol::STREAM, m_sockPath);
-        return std::make_shared<WDBHandler>(socket);
-    }
+    std::shared_ptr<IWDBHandler> connection() override;
+
+    /**
+     * @copydoc IWDBManager::queryAsync
+     */
+    std::future<std::tuple<QueryResultCodes, std::optional<std::string>>> queryAsync(const std::string& query,
+                                                                                      uint attempts) override;
 };
 
 } // namespace wazuhdb
@@ -1,6 +1,7 @@
 #ifndef _WDB_IWDB_MANAGER_HPP
 #define _WDB_IWDB_MANAGER_HPP
 
+#include <future>
 #include <memory>
 
 #include <wdb/iwdbHandler.hpp>
@@ -13,7 +14,24 @@ class IWDBManager
 public:
     virtual ~IWDBManager() = default;
 
+    /**
+     * @brief Get a handler to query wazuh-db
+     *
+     * @return std::shared_ptr<IWDBHandler> Handler, safe to share between threads
+     */
     virtual std::shared_ptr<IWDBHandler> connection() = 0;
+
+    /**
+     * @brief Perform a query without waiting for wazuh-db, retrying it `attempts` times
+     *
+     * The queries are dispatched to the free connections, so several of them are in flight at the same time.
+     *
+     * @param query Query to perform
+     * @param attempts Number of attempts to perform the query
+     * @return std::future with the code and the optional data (payload)
+     */
+    virtual std::future<std::tuple<QueryResultCodes, std::optional<std::string>>>
+    queryAsync(const std::string& query, uint attempts) = 0;
 };
 
 } // namespace wazuhdb
@@ -52,8 +52,7 @@ std::string WDBHandler::query(const std::string& query)
     return result;
 }
 
-std::tuple<QueryResultCodes, std::optional<std::string>>
-WDBHandler::parseResult(const std::string& result) const noexcept
+std::tuple<QueryResultCodes, std::optional<std::string>> WDBHandler::parse(const std::string& result) noexcept
 {
 
     QueryResultCodes code {QueryResultCodes::OK};
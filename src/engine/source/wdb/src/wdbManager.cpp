@@ -0,0 +1,26 @@
+#include "wdbManager.hpp"
+
+#include "wdbPool.hpp"
+
+namespace wazuhdb
+{
+
+WDBManager::WDBManager(const std::string& sockPath,
+                       std::shared_ptr<sockiface::ISockFactory> sockFactory,
+                       const WDBOptions& options)
+    : m_pool(std::make_shared<WDBPool>(sockPath, sockFactory, options.connections, options.cacheSize, options.cacheTtl))
+{
+}
+
+std::shared_ptr<IWDBHandler> WDBManager::connection()
+{
+    return std::make_shared<PooledWDBHandler>(m_pool);
+}
+
+std::future<std::tuple<QueryResultCodes, std::optional<std::string>>> WDBManager::queryAsync(const std::string& query,
+                                                                                              uint attempts)
+{
+    return m_pool->submit(query, attempts);
+}
+
+} // namespace wazuhdb
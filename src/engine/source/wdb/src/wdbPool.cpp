@@ -0,0 +1,243 @@
+#include "wdbPool.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace wazuhdb
+{
+
+namespace
+{
+bool startsWithNoCase(std::string_view str, std::string_view prefix)
+{
+    return str.size() >= prefix.size()
+           && std::equal(prefix.begin(),
+                         prefix.end(),
+                         str.begin(),
+                         [](unsigned char a, unsigned char b) { return std::tolower(a) == std::tolower(b); });
+}
+} // namespace
+
+std::string_view QueryCache::target(std::string_view query)
+{
+    // <agent id> or <global>, the database the query runs on
+    auto end = query.find(' ');
+    if (query.substr(0, end) == "agent" && end != std::string_view::npos)
+    {
+        end = query.find(' ', end + 1);
+    }
+    return query.substr(0, end);
+}
+
+bool QueryCache::isCacheable(std::string_view query)
+{
+    const auto db = target(query);
+    if (db.size() == query.size())
+    {
+        return false;
+    }
+
+    auto command = query.substr(db.size() + 1);
+    if (command.substr(0, 4) != "sql ")
+    {
+        return false;
+    }
+    command.remove_prefix(4);
+    return startsWithNoCase(command, "select ");
+}
+
+std::optional<std::string> QueryCache::get(const std::string& query)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(query);
+    if (it == m_entries.end())
+    {
+        return std::nullopt;
+    }
+
+    auto generation = m_generations.find(std::string(target(query)));
+    const auto current = generation == m_generations.end() ? 0 : generation->second;
+    if (it->second.generation != current || std::chrono::steady_clock::now() >= it->second.expiresAt)
+    {
+        m_entries.erase(it);
+        return std::nullopt;
+    }
+
+    return it->second.result;
+}
+
+uint64_t QueryCache::generation(const std::string& query)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_generations.find(std::string(target(query)));
+    return it == m_generations.end() ? 0 : it->second;
+}
+
+void QueryCache::invalidate(const std::string& query)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generations[std::string(target(query))];
+}
+
+void QueryCache::put(const std::string& query, const std::string& result, uint64_t generation)
+{
+    // Only successful reads, the errors are retried by the next query
+    if (std::get<0>(WDBHandler::parse(result)) != QueryResultCodes::OK)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // A write to the database while the read was in flight, the result may be stale
+    auto current = m_generations.find(std::string(target(query)));
+    if ((current == m_generations.end() ? 0 : current->second) != generation)
+    {
+        return;
+    }
+
+    if (m_entries.size() >= m_capacity)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            it = now >= it->second.expiresAt ? m_entries.erase(it) : std::next(it);
+        }
+        if (m_entries.size() >= m_capacity)
+        {
+            m_entries.clear();
+        }
+    }
+
+    m_entries[query] = Entry {result, std::chrono::steady_clock::now() + m_ttl, generation};
+}
+
+WDBPool::WDBPool(const std::string& sockPath,
+                 const std::shared_ptr<sockiface::ISockFactory>& sockFactory,
+                 std::size_t connections,
+                 std::size_t cacheSize,
+                 std::chrono::milliseconds cacheTtl)
+    : m_cache(cacheSize, cacheTtl)
+    , m_stop(false)
+{
+    if (0 == connections)
+    {
+        throw std::runtime_error("The wazuh-db pool needs at least one connection");
+    }
+
+    m_connections.reserve(connections);
+    for (std::size_t i = 0; i < connections; ++i)
+    {
+        auto socket = sockFactory->getHandler(sockiface::ISockHandler::Protocol::STREAM, sockPath);
+        m_connections.emplace_back(std::make_shared<WDBHandler>(socket));
+    }
+    m_free = m_connections;
+}
+
+WDBPool::~WDBPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_requestsMutex);
+        m_stop = true;
+    }
+    m_requestsCv.notify_all();
+    for (auto& dispatcher : m_dispatchers)
+    {
+        dispatcher.join();
+    }
+}
+
+WDBPool::Lease WDBPool::acquire()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_released.wait(lock, [this]() { return !m_free.empty(); });
+    auto handler = std::move(m_free.back());
+    m_free.pop_back();
+    return Lease {*this, std::move(handler)};
+}
+
+void WDBPool::release(std::shared_ptr<WDBHandler>&& handler)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free.push_back(std::move(handler));
+    }
+    m_released.notify_one();
+}
+
+std::string WDBPool::execute(const std::string& query, std::optional<uint> attempts)
+{
+    const auto cacheable = m_cache.enabled() && QueryCache::isCacheable(query);
+    uint64_t generation = 0;
+    if (cacheable)
+    {
+        if (auto cached = m_cache.get(query))
+        {
+            return std::move(cached.value());
+        }
+        generation = m_cache.generation(query);
+    }
+    else if (m_cache.enabled())
+    {
+        // Before sending it, so the reads that overlap the write are not cached
+        m_cache.invalidate(query);
+    }
+
+    std::string result;
+    {
+        auto connection = acquire();
+        result = attempts ? connection->tryQuery(query, attempts.value()) : connection->query(query);
+    }
+
+    if (cacheable)
+    {
+        m_cache.put(query, result, generation);
+    }
+    else if (m_cache.enabled())
+    {
+        // And after, a read sent before the write may have been answered after it
+        m_cache.invalidate(query);
+    }
+    return result;
+}
+
+std::future<QueryResult> WDBPool::submit(const std::string& query, uint attempts)
+{
+    Request request {query, attempts, {}};
+    auto future = request.promise.get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_requestsMutex);
+        if (m_dispatchers.empty())
+        {
+            for (std::size_t i = 0; i < m_connections.size(); ++i)
+            {
+                m_dispatchers.emplace_back(&WDBPool::runDispatcher, this);
+            }
+        }
+        m_requests.push_back(std::move(request));
+    }
+    m_requestsCv.notify_one();
+    return future;
+}
+
+void WDBPool::runDispatcher()
+{
+    while (true)
+    {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(m_requestsMutex);
+            m_requestsCv.wait(lock, [this]() { return m_stop || !m_requests.empty(); });
+            // Pending requests are answered before stopping
+            if (m_requests.empty())
+            {
+                return;
+            }
+            request = std::move(m_requests.front());
+            m_requests.pop_front();
+        }
+
+        request.promise.set_value(WDBHandler::parse(execute(request.query, request.attempts)));
+    }
+}
+
+} // namespace wazuhdb
@@ -0,0 +1,260 @@
+#ifndef _WDB_WDB_POOL_HPP
+#define _WDB_WDB_POOL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sockiface/isockFactory.hpp>
+#include <wdb/iwdbHandler.hpp>
+
+#include "wdbHandler.hpp"
+
+namespace wazuhdb
+{
+
+using QueryResult = std::tuple<QueryResultCodes, std::optional<std::string>>;
+
+/**
+ * @brief Short lived cache of the results of the read only queries.
+ *
+ * Only `sql select` queries are cached. Any other query to the same database (`agent <id>` or `global`) invalidates
+ * its cached results, so the reads done after a write see it.
+ */
+class QueryCache
+{
+public:
+    /**
+     * @brief Construct a new cache
+     *
+     * @param capacity Max cached results, 0 disables the cache
+     * @param ttl Time a result is valid
+     */
+    QueryCache(std::size_t capacity, std::chrono::milliseconds ttl)
+        : m_capacity(capacity)
+        , m_ttl(ttl)
+    {
+    }
+
+    bool enabled() const { return m_capacity > 0 && m_ttl.count() > 0; }
+
+    /**
+     * @brief Get the cached raw result of a query
+     *
+     * @return std::optional<std::string> The result, nullopt if it is not cached or it expired
+     */
+    std::optional<std::string> get(const std::string& query);
+
+    /**
+     * @brief Writes seen by the database of a query, taken before performing a read
+     *
+     */
+    uint64_t generation(const std::string& query);
+
+    /**
+     * @brief Store the raw result of a read, unless its database was written since `generation` was taken
+     *
+     */
+    void put(const std::string& query, const std::string& result, uint64_t generation);
+
+    /**
+     * @brief Invalidate the cached results of the database of a query
+     *
+     */
+    void invalidate(const std::string& query);
+
+    /**
+     * @brief Whether a query only reads
+     *
+     */
+    static bool isCacheable(std::string_view query);
+
+private:
+    struct Entry
+    {
+        std::string result;
+        std::chrono::steady_clock::time_point expiresAt;
+        uint64_t generation;
+    };
+
+    std::size_t m_capacity;
+    std::chrono::milliseconds m_ttl;
+    std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::unordered_map<std::string, uint64_t> m_generations; ///< Writes seen by each database
+
+    static std::string_view target(std::string_view query);
+};
+
+/**
+ * @brief Pool of wazuh-db connections shared by all the handlers of a manager.
+ *
+ * Each query borrows a free connection, which is used by one thread at a time. The connections are created up front
+ * and connect on the first query.
+ */
+class WDBPool
+{
+public:
+    /**
+     * @brief Construct a new pool
+     *
+     * @param sockPath Path to the wdb socket
+     * @param sockFactory Factory of the connection sockets
+     * @param connections Number of connections, at least 1
+     * @param cacheSize Max cached results of read queries, 0 disables the cache
+     * @param cacheTtl Time a cached result is valid
+     */
+    WDBPool(const std::string& sockPath,
+            const std::shared_ptr<sockiface::ISockFactory>& sockFactory,
+            std::size_t connections,
+            std::size_t cacheSize,
+            std::chrono::milliseconds cacheTtl);
+
+    /**
+     * @brief Answer the pending async queries and stop the dispatchers
+     *
+     */
+    ~WDBPool();
+
+    WDBPool(const WDBPool&) = delete;
+    WDBPool& operator=(const WDBPool&) = delete;
+
+    /**
+     * @brief A connection borrowed from the pool, returned on destruction
+     *
+     */
+    class Lease
+    {
+    public:
+        Lease(WDBPool& pool, std::shared_ptr<WDBHandler> handler)
+            : m_pool(pool)
+            , m_handler(std::move(handler))
+        {
+        }
+        ~Lease() { m_pool.release(std::move(m_handler)); }
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        WDBHandler* operator->() const { return m_handler.get(); }
+
+    private:
+        WDBPool& m_pool;
+        std::shared_ptr<WDBHandler> m_handler;
+    };
+
+    /**
+     * @brief Borrow a connection, waiting for a free one
+     *
+     */
+    Lease acquire();
+
+    /**
+     * @brief Perform a query on a free connection, using the cache for the read queries
+     *
+     * @param query Query to perform
+     * @param attempts Number of attempts, nullopt to perform it once and throw on errors as IWDBHandler::query does
+     * @return std::string Raw result of the query
+     */
+    std::string execute(const std::string& query, std::optional<uint> attempts);
+
+    /**
+     * @brief Queue a query for the dispatchers
+     *
+     */
+    std::future<QueryResult> submit(const std::string& query, uint attempts);
+
+    std::size_t size() const { return m_connections.size(); }
+
+private:
+    struct Request
+    {
+        std::string query;
+        uint attempts;
+        std::promise<QueryResult> promise;
+    };
+
+    std::vector<std::shared_ptr<WDBHandler>> m_connections;
+    std::mutex m_mutex;
+    std::condition_variable m_released;
+    std::vector<std::shared_ptr<WDBHandler>> m_free;
+
+    QueryCache m_cache;
+
+    // Async queries, one dispatcher per connection started with the first one
+    std::mutex m_requestsMutex;
+    std::condition_variable m_requestsCv;
+    std::deque<Request> m_requests;
+    std::vector<std::thread> m_dispatchers;
+    bool m_stop;
+
+    void release(std::shared_ptr<WDBHandler>&& handler);
+    void runDispatcher();
+};
+
+/**
+ * @brief Handler that performs each query on a connection of the pool, so it can be shared between threads.
+ *
+ */
+class PooledWDBHandler final : public IWDBHandler
+{
+private:
+    std::shared_ptr<WDBPool> m_pool;
+
+public:
+    explicit PooledWDBHandler(std::shared_ptr<WDBPool> pool)
+        : m_pool(std::move(pool))
+    {
+    }
+
+    /**
+     * @copydoc IWDBHandler::connect
+     */
+    void connect() override { m_pool->acquire()->connect(); }
+
+    /**
+     * @copydoc IWDBHandler::query
+     */
+    std::string query(const std::string& query) override { return m_pool->execute(query, std::nullopt); }
+
+    /**
+     * @copydoc IWDBHandler::tryQuery
+     */
+    std::string tryQuery(const std::string& query, uint attempts) noexcept override
+    {
+        return m_pool->execute(query, attempts);
+    }
+
+    /**
+     * @copydoc IWDBHandler::parseResult
+     */
+    QueryResult parseResult(const std::string& result) const noexcept override { return WDBHandler::parse(result); }
+
+    /**
+     * @copydoc IWDBHandler::queryAndParseResult
+     */
+    QueryResult queryAndParseResult(const std::string& query) override
+    {
+        return WDBHandler::parse(this->query(query));
+    }
+
+    /**
+     * @copydoc IWDBHandler::tryQueryAndParseResult
+     */
+    QueryResult tryQueryAndParseResult(const std::string& query, uint attempts) noexcept override
+    {
+        return WDBHandler::parse(tryQuery(query, attempts));
+    }
+
+    size_t getQueryMaxSize() const noexcept override { return m_pool->acquire()->getQueryMaxSize(); }
+};
+
+} // namespace wazuhdb
+
+#endif // _WDB_WDB_POOL_HPP
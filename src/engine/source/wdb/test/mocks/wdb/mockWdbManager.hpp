@@ -9,6 +9,10 @@ class MockWdbManager : public wazuhdb::IWDBManager
 {
 public:
     MOCK_METHOD(std::shared_ptr<wazuhdb::IWDBHandler>, connection, (), (override));
+    MOCK_METHOD((std::future<std::tuple<wazuhdb::QueryResultCodes, std::optional<std::string>>>),
+                queryAsync,
+                (const std::string& query, uint attempts),
+                (override));
 };
 
 #endif // _WDB_MOCK_WDB_MANAGER_HPP
@@ -0,0 +1,192 @@
+#include <wdb/wdbManager.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <base/logging.hpp>
+#include <sockiface/mockSockFactory.hpp>
+#include <sockiface/mockSockHandler.hpp>
+
+#include "wdbPool.hpp"
+
+using namespace wazuhdb;
+using namespace sockiface::mocks;
+
+namespace
+{
+constexpr const char* TEST_DUMMY_PATH {"/dummy/path"};
+constexpr const char* SELECT_QUERY {"agent 001 sql SELECT * FROM sca_policy"};
+constexpr const char* WRITE_QUERY {"agent 001 sca delete_policy cis"};
+constexpr const char* OTHER_AGENT_WRITE_QUERY {"agent 002 sca delete_policy cis"};
+
+class wdb_pool : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MockSockFactory> m_sockFactory;
+    std::vector<std::shared_ptr<testing::NiceMock<MockSockHandler>>> m_sockets;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_sockFactory = std::make_shared<MockSockFactory>();
+    }
+
+    WDBManager makeManager(std::size_t connections, std::size_t cacheSize = 0)
+    {
+        for (std::size_t i = 0; i < connections; ++i)
+        {
+            auto socket = std::make_shared<testing::NiceMock<MockSockHandler>>();
+            ON_CALL(*socket, getMaxMsgSize()).WillByDefault(testing::Return(1024));
+            ON_CALL(*socket, sendMsg(testing::_)).WillByDefault(testing::Return(successSendMsgRes()));
+            m_sockets.push_back(socket);
+        }
+
+        auto call = 0;
+        EXPECT_CALL(*m_sockFactory, getHandler(sockiface::ISockHandler::Protocol::STREAM, TEST_DUMMY_PATH))
+            .Times(connections)
+            .WillRepeatedly(testing::Invoke([this, call](auto, auto) mutable { return m_sockets[call++]; }));
+
+        return WDBManager(TEST_DUMMY_PATH, m_sockFactory, WDBOptions {connections, cacheSize});
+    }
+};
+} // namespace
+
+TEST_F(wdb_pool, NoConnections)
+{
+    ASSERT_THROW(WDBManager(TEST_DUMMY_PATH, m_sockFactory, WDBOptions {0}), std::runtime_error);
+}
+
+TEST_F(wdb_pool, HandlersShareTheConnections)
+{
+    auto manager = makeManager(2);
+    std::atomic<int> inFlight {0};
+    std::atomic<int> maxInFlight {0};
+    for (const auto& socket : m_sockets)
+    {
+        ON_CALL(*socket, recvMsg())
+            .WillByDefault(testing::Invoke(
+                [&]()
+                {
+                    auto current = ++inFlight;
+                    auto max = maxInFlight.load();
+                    while (current > max && !maxInFlight.compare_exchange_weak(max, current)) {}
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    --inFlight;
+                    return recvMsgRes("ok payload");
+                }));
+    }
+
+    std::vector<std::thread> workers;
+    std::atomic<int> ok {0};
+    for (auto i = 0; i < 8; ++i)
+    {
+        workers.emplace_back(
+            [&]()
+            {
+                auto wdb = manager.connection();
+                for (auto j = 0; j < 10; ++j)
+                {
+                    const auto [code, payload] = wdb->tryQueryAndParseResult(WRITE_QUERY, 1);
+                    if (code == QueryResultCodes::OK && payload == "payload")
+                    {
+                        ++ok;
+                    }
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    ASSERT_EQ(ok, 80);
+    ASSERT_LE(maxInFlight, 2);
+}
+
+TEST_F(wdb_pool, HandlerKeepsThePoolAlive)
+{
+    std::shared_ptr<IWDBHandler> wdb;
+    {
+        auto manager = makeManager(1);
+        wdb = manager.connection();
+    }
+    EXPECT_CALL(*m_sockets[0], recvMsg()).WillOnce(testing::Return(recvMsgRes("ok")));
+    ASSERT_EQ(std::get<0>(wdb->tryQueryAndParseResult(WRITE_QUERY, 1)), QueryResultCodes::OK);
+}
+
+TEST_F(wdb_pool, QueryAsync)
+{
+    auto manager = makeManager(2);
+    for (const auto& socket : m_sockets)
+    {
+        ON_CALL(*socket, recvMsg()).WillByDefault(testing::Return(recvMsgRes("ok async")));
+    }
+
+    std::vector<std::future<QueryResult>> futures;
+    for (auto i = 0; i < 10; ++i)
+    {
+        futures.push_back(manager.queryAsync(WRITE_QUERY, 1));
+    }
+    for (auto& future : futures)
+    {
+        const auto [code, payload] = future.get();
+        ASSERT_EQ(code, QueryResultCodes::OK);
+        ASSERT_EQ(payload, "async");
+    }
+}
+
+TEST_F(wdb_pool, CacheSelectQueries)
+{
+    auto manager = makeManager(1, 16);
+    EXPECT_CALL(*m_sockets[0], recvMsg()).WillOnce(testing::Return(recvMsgRes("ok [1]")));
+
+    auto wdb = manager.connection();
+    ASSERT_EQ(std::get<1>(wdb->tryQueryAndParseResult(SELECT_QUERY, 1)), "[1]");
+    ASSERT_EQ(std::get<1>(wdb->tryQueryAndParseResult(SELECT_QUERY, 1)), "[1]");
+}
+
+TEST_F(wdb_pool, CacheDoesNotStoreErrors)
+{
+    auto manager = makeManager(1, 16);
+    EXPECT_CALL(*m_sockets[0], recvMsg())
+        .WillOnce(testing::Return(recvMsgRes("err")))
+        .WillOnce(testing::Return(recvMsgRes("ok [1]")));
+
+    auto wdb = manager.connection();
+    ASSERT_EQ(std::get<0>(wdb->tryQueryAndParseResult(SELECT_QUERY, 1)), QueryResultCodes::ERROR);
+    ASSERT_EQ(std::get<1>(wdb->tryQueryAndParseResult(SELECT_QUERY, 1)), "[1]");
+}
+
+TEST_F(wdb_pool, WriteInvalidatesTheDatabase)
+{
+    auto manager = makeManager(1, 16);
+    EXPECT_CALL(*m_sockets[0], recvMsg())
+        .WillOnce(testing::Return(recvMsgRes("ok [1]")))
+        .WillOnce(testing::Return(recvMsgRes("ok")))
+        .WillOnce(testing::Return(recvMsgRes("ok")))
+        .WillOnce(testing::Return(recvMsgRes("ok []")));
+
+    auto wdb = manager.connection();
+    ASSERT_EQ(std::get<1>(wdb->tryQueryAndParseResult(SELECT_QUERY, 1)), "[1]");
+    // Another agent database, still cached
+    wdb->tryQueryAndParseResult(OTHER_AGENT_WRITE_QUERY, 1);
+    ASSERT_EQ(std::get<1>(wdb->tryQueryAndParseResult(SELECT_QUERY, 1)), "[1]");
+
+    wdb->tryQueryAndParseResult(WRITE_QUERY, 1);
+    ASSERT_EQ(std::get<1>(wdb->tryQueryAndParseResult(SELECT_QUERY, 1)), "[]");
+}
+
+TEST(wdb_queryCache, IsCacheable)
+{
+    ASSERT_TRUE(QueryCache::isCacheable("agent 001 sql SELECT * FROM sca_policy"));
+    ASSERT_TRUE(QueryCache::isCacheable("agent 001 sql select id FROM sca_policy"));
+    ASSERT_TRUE(QueryCache::isCacheable("global sql SELECT * FROM agent"));
+    ASSERT_FALSE(QueryCache::isCacheable("agent 001 sql DELETE FROM sca_policy"));
+    ASSERT_FALSE(QueryCache::isCacheable("agent 001 sca query_policies"));
+    ASSERT_FALSE(QueryCache::isCacheable("agent 001"));
+    ASSERT_FALSE(QueryCache::isCacheable("global"));
+    ASSERT_FALSE(QueryCache::isCacheable(""));
+}
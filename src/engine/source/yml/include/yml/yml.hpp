@@ -21,6 +21,8 @@ public:
     /**
      * @brief Load a YAML file and return a RapidJSON document.
      *
+     * The document is built from the parser events, without the YAML node tree. Only the first YAML document is loaded.
+     *
      * @param filepath Filepath of the YAML file.
      *
      * @return rapidjson::Document RapidJSON document loaded from the YAML file.
@@ -30,6 +32,8 @@ public:
     /**
      * @brief Load a YAML string and return a RapidJSON document.
      *
+     * The document is built from the parser events, without the YAML node tree. Only the first YAML document is loaded.
+     *
      * @param yamlStr YAML string.
      *
      * @return rapidjson::Document RapidJSON document loaded from the YAML string.
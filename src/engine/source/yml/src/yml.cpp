@@ -1,23 +1,210 @@
 #include <yml/yml.hpp>
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+#include <yaml-cpp/eventhandler.h>
+
 namespace yml
 {
+namespace
+{
 
-rapidjson::Document Converter::loadYMLfromFile(const std::string& filepath)
+/**
+ * @brief Builds the RapidJSON value of a YAML document from the parser events, without the YAML node tree.
+ *
+ * The result is the same as Converter::yamlToJson over the loaded node: scalars are typed by parseScalar, null map keys
+ * are "null" and the aliases are copies of their anchored values.
+ */
+class JsonEventHandler final : public YAML::EventHandler
+{
+private:
+    struct Frame
+    {
+        rapidjson::Value value; ///< Array or object being filled
+        YAML::anchor_t anchor;  ///< Anchor of the container, 0 if none
+        bool expectKey;         ///< Objects only, the next value is a key
+        std::string key;        ///< Objects only, key of the next value
+    };
+
+    struct Anchored
+    {
+        rapidjson::Value value; ///< Copy of the anchored value
+        bool isKey;             ///< The value can be used as a map key
+        std::string key;        ///< Map key text of the value
+    };
+
+    rapidjson::Document::AllocatorType& m_allocator;
+    rapidjson::Value m_root;
+    std::vector<Frame> m_stack;
+    std::unordered_map<YAML::anchor_t, Anchored> m_anchors;
+
+    // Plain scalars that can't be a number or a bool are strings, parseScalar is only needed for the rest
+    static bool isString(const std::string& scalar)
+    {
+        static constexpr std::string_view NON_STRING_START {"0123456789+-.yYnNtTfFoO"};
+        return !scalar.empty() && NON_STRING_START.find(scalar.front()) == std::string_view::npos;
+    }
+
+    rapidjson::Value scalarValue(const std::string& tag, const std::string& scalar)
+    {
+        rapidjson::Value v;
+        if (QUOTED_TAG == tag || isString(scalar))
+        {
+            v.SetString(scalar.c_str(), scalar.size(), m_allocator);
+        }
+        else
+        {
+            v = Converter::parseScalar(YAML::Node(scalar), m_allocator);
+        }
+
+        return v;
+    }
+
+    void anchor(YAML::anchor_t anchor, const rapidjson::Value& value, bool isKey, const std::string& key)
+    {
+        if (anchor != YAML::NullAnchor)
+        {
+            m_anchors[anchor] = Anchored {rapidjson::Value(value, m_allocator), isKey, key};
+        }
+    }
+
+    // Places a complete value in its parent, key is its text if it is used as a map key
+    void add(rapidjson::Value&& value, const YAML::Mark& mark, bool isKey, const std::string& key)
+    {
+        if (m_stack.empty())
+        {
+            m_root = std::move(value);
+            return;
+        }
+
+        auto& parent = m_stack.back();
+        if (parent.value.IsArray())
+        {
+            parent.value.PushBack(value, m_allocator);
+        }
+        else if (parent.expectKey)
+        {
+            if (!isKey)
+            {
+                throw YAML::ParserException(mark, "Map keys must be scalars");
+            }
+            parent.key = key;
+            parent.expectKey = false;
+        }
+        else
+        {
+            parent.value.AddMember(rapidjson::Value(parent.key.c_str(), parent.key.size(), m_allocator), value, m_allocator);
+            parent.expectKey = true;
+        }
+    }
+
+    void start(rapidjson::Value&& value, const YAML::Mark& mark, YAML::anchor_t anchor)
+    {
+        if (!m_stack.empty() && m_stack.back().value.IsObject() && m_stack.back().expectKey)
+        {
+            throw YAML::ParserException(mark, "Map keys must be scalars");
+        }
+        const auto isObject = value.IsObject();
+        m_stack.push_back(Frame {std::move(value), anchor, isObject, {}});
+    }
+
+    void end()
+    {
+        auto frame = std::move(m_stack.back());
+        m_stack.pop_back();
+        anchor(frame.anchor, frame.value, false, {});
+        add(std::move(frame.value), YAML::Mark::null_mark(), false, {});
+    }
+
+public:
+    explicit JsonEventHandler(rapidjson::Document::AllocatorType& allocator)
+        : m_allocator(allocator)
+    {
+    }
+
+    rapidjson::Value& root() { return m_root; }
+
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark& mark, YAML::anchor_t anchor) override
+    {
+        rapidjson::Value v;
+        this->anchor(anchor, v, true, "null");
+        add(std::move(v), mark, true, "null");
+    }
+
+    void OnAlias(const YAML::Mark& mark, YAML::anchor_t anchor) override
+    {
+        auto it = m_anchors.find(anchor);
+        if (it == m_anchors.end())
+        {
+            throw YAML::ParserException(mark, "Unknown anchor");
+        }
+        add(rapidjson::Value(it->second.value, m_allocator), mark, it->second.isKey, it->second.key);
+    }
+
+    void OnScalar(const YAML::Mark& mark,
+                  const std::string& tag,
+                  YAML::anchor_t anchor,
+                  const std::string& value) override
+    {
+        auto v = scalarValue(tag, value);
+        this->anchor(anchor, v, true, value);
+        add(std::move(v), mark, true, value);
+    }
+
+    void OnSequenceStart(const YAML::Mark& mark,
+                         const std::string&,
+                         YAML::anchor_t anchor,
+                         YAML::EmitterStyle::value) override
+    {
+        start(rapidjson::Value(rapidjson::kArrayType), mark, anchor);
+    }
+
+    void OnSequenceEnd() override { end(); }
+
+    void OnMapStart(const YAML::Mark& mark, const std::string&, YAML::anchor_t anchor, YAML::EmitterStyle::value) override
+    {
+        start(rapidjson::Value(rapidjson::kObjectType), mark, anchor);
+    }
+
+    void OnMapEnd() override { end(); }
+};
+
+rapidjson::Document loadYMLfromStream(std::istream& input)
 {
-    YAML::Node root = YAML::LoadFile(filepath);
     rapidjson::Document doc;
+    YAML::Parser parser(input);
+    JsonEventHandler handler(doc.GetAllocator());
 
-    rapidjson::Value val = yamlToJson(root, doc.GetAllocator());
-    doc.CopyFrom(val, doc.GetAllocator());
+    // Only the first document, as YAML::Load
+    parser.HandleNextDocument(handler);
+    static_cast<rapidjson::Value&>(doc).Swap(handler.root());
 
     return doc;
 }
 
+} // namespace
+
+rapidjson::Document Converter::loadYMLfromFile(const std::string& filepath)
+{
+    std::ifstream input(filepath);
+    if (!input)
+    {
+        throw YAML::BadFile(filepath);
+    }
+
+    return loadYMLfromStream(input);
+}
+
 rapidjson::Value Converter::parseScalar(const YAML::Node& node, rapidjson::Document::AllocatorType& allocator)
 {
     rapidjson::Value v;
@@ -82,13 +269,8 @@ YAML::Node Converter::parseScalar(const rapidjson::Value& node)
 
 rapidjson::Document Converter::loadYMLfromString(const std::string& yamlStr)
 {
-    YAML::Node root = YAML::Load(yamlStr);
-    rapidjson::Document doc;
-
-    rapidjson::Value val = yamlToJson(root, doc.GetAllocator());
-    doc.CopyFrom(val, doc.GetAllocator());
-
-    return doc;
+    std::istringstream input(yamlStr);
+    return loadYMLfromStream(input);
 }
 
 YAML::Node Converter::jsonToYaml(const rapidjson::Value& value)
@@ -215,3 +215,45 @@ TEST_F(YmlTest, LoadYMLfromFileTest)
     auto expected = json::Json {expectedJsonStr};
     EXPECT_TRUE(expected == result);
 }
+
+TEST_F(YmlTest, LoadYMLfromStringSameAsNodeConversion)
+{
+    const std::vector<std::string> yamlStrs = {
+        "a: 1\nb: -2\nc: 3.5\nd: true\ne: off\nf: ~\ng:\nh: 'quoted 1'\ni: \"2\"\nj: plain text\nk: 0x1F\n"
+        "l: 99999999999\nm: .inf\nn: +5\no: 12abc\np: ''\n",
+        "- a\n- [1, 2, {x: y}]\n- {}\n- []\n- !!str 42\n",
+        "base: &b {k: 1, l: [a, b]}\nother: *b\nscal: &s 7\nref: *s\n*s : aliased key\n",
+        "~: null key\n1: int key\ntrue: bool key\n",
+        "just a scalar",
+        ""};
+
+    for (const auto& yamlStr : yamlStrs)
+    {
+        auto streamed = json::Json {yml::Converter::loadYMLfromString(yamlStr)};
+
+        rapidjson::Document document;
+        const auto& value = yml::Converter::yamlToJson(YAML::Load(yamlStr), document.GetAllocator());
+        document.CopyFrom(value, document.GetAllocator());
+        auto expected = json::Json {std::move(document)};
+
+        EXPECT_TRUE(expected == streamed) << yamlStr;
+    }
+}
+
+TEST_F(YmlTest, LoadYMLfromStringKeepsDuplicateKeys)
+{
+    auto result = json::Json {yml::Converter::loadYMLfromString("dup: 1\ndup: 2\n")};
+    EXPECT_TRUE(base::isError(result.checkDuplicateKeys()));
+}
+
+TEST_F(YmlTest, LoadYMLfromStringInvalid)
+{
+    EXPECT_THROW(yml::Converter::loadYMLfromString("[a: b"), std::exception);
+    EXPECT_THROW(yml::Converter::loadYMLfromString("{[1]: x}"), std::exception);
+    EXPECT_THROW(yml::Converter::loadYMLfromString("a: *unknown\n"), std::exception);
+}
+
+TEST_F(YmlTest, LoadYMLfromFileNotFound)
+{
+    EXPECT_THROW(yml::Converter::loadYMLfromFile("/nonexistent/file.yml"), YAML::BadFile);
+}
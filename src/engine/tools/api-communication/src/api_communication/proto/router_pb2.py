@@ -14,17 +14,17 @@ _sym_db = _symbol_database.Default()
 import api_communication.proto.engine_pb2 as _engine_pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0crouter.proto\x12\x1b\x63om.wazuh.api.engine.router\x1a\x0c\x65ngine.proto\"u\n\tEntryPost\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x42\x0e\n\x0c_description\"\xf3\x01\n\x05\x45ntry\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x0bpolicy_sync\x18\x06 \x01(\x0e\x32!.com.wazuh.api.engine.router.Sync\x12\x38\n\x0c\x65ntry_status\x18\x07 \x01(\x0e\x32\".com.wazuh.api.engine.router.State\x12\x0e\n\x06uptime\x18\x08 \x01(\rB\x0e\n\x0c_description\"Y\n\x11RoutePost_Request\x12:\n\x05route\x18\x01 \x01(\x0b\x32&.com.wazuh.api.engine.router.EntryPostH\x00\x88\x01\x01\x42\x08\n\x06_route\"#\n\x13RouteDelete_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\" \n\x10RouteGet_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"\xa7\x01\n\x11RouteGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x05route\x18\x03 \x01(\x0b\x32\".com.wazuh.api.engine.router.EntryH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_route\"#\n\x13RouteReload_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"<\n\x1aRoutePatchPriority_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x10\n\x08priority\x18\x02 \x01(\r\"\x12\n\x10TableGet_Request\"\x98\x01\n\x11TableGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x05table\x18\x03 \x03(\x0b\x32\".com.wazuh.api.engine.router.EntryB\x08\n\x06_error\"5\n\x11QueuePost_Request\x12\x13\n\x0bwazuh_event\x18\x01 \x01(\tJ\x04\x08\x02\x10\x03R\x05\x65vent\":\n\x11\x45psUpdate_Request\x12\x0b\n\x03\x65ps\x18\x01 \x01(\r\x12\x18\n\x10refresh_interval\x18\x02 \x01(\r\"\x10\n\x0e\x45psGet_Request\"\x9b\x01\n\x0f\x45psGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0b\n\x03\x65ps\x18\x03 \x01(\r\x12\x18\n\x10refresh_interval\x18\x04 \x01(\r\x12\x0f\n\x07\x65nabled\x18\x05 \x01(\x08\x42\x08\n\x06_error\"\x13\n\x11\x45psEnable_Request\"\x14\n\x12\x45psDisable_Request*5\n\x05State\x12\x11\n\rSTATE_UNKNOWN\x10\x00\x12\x0c\n\x08\x44ISABLED\x10\x01\x12\x0b\n\x07\x45NABLED\x10\x02*>\n\x04Sync\x12\x10\n\x0cSYNC_UNKNOWN\x10\x00\x12\x0b\n\x07UPDATED\x10\x01\x12\x0c\n\x08OUTDATED\x10\x02\x12\t\n\x05\x45RROR\x10\x03\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0crouter.proto\x12\x1b\x63om.wazuh.api.engine.router\x1a\x0c\x65ngine.proto\"u\n\tEntryPost\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x42\x0e\n\x0c_description\"\xf3\x01\n\x05\x45ntry\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x0bpolicy_sync\x18\x06 \x01(\x0e\x32!.com.wazuh.api.engine.router.Sync\x12\x38\n\x0c\x65ntry_status\x18\x07 \x01(\x0e\x32\".com.wazuh.api.engine.router.State\x12\x0e\n\x06uptime\x18\x08 \x01(\rB\x0e\n\x0c_description\"Y\n\x11RoutePost_Request\x12:\n\x05route\x18\x01 \x01(\x0b\x32&.com.wazuh.api.engine.router.EntryPostH\x00\x88\x01\x01\x42\x08\n\x06_route\"#\n\x13RouteDelete_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\" \n\x10RouteGet_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"\xa7\x01\n\x11RouteGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x05route\x18\x03 \x01(\x0b\x32\".com.wazuh.api.engine.router.EntryH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_route\"#\n\x13RouteReload_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"<\n\x1aRoutePatchPriority_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x10\n\x08priority\x18\x02 \x01(\r\"\x12\n\x10TableGet_Request\"\x98\x01\n\x11TableGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x05table\x18\x03 \x03(\x0b\x32\".com.wazuh.api.engine.router.EntryB\x08\n\x06_error\"5\n\x11QueuePost_Request\x12\x13\n\x0bwazuh_event\x18\x01 \x01(\tJ\x04\x08\x02\x10\x03R\x05\x65vent\":\n\x11\x45psUpdate_Request\x12\x0b\n\x03\x65ps\x18\x01 \x01(\r\x12\x18\n\x10refresh_interval\x18\x02 \x01(\r\"\x10\n\x0e\x45psGet_Request\"\x9b\x01\n\x0f\x45psGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0b\n\x03\x65ps\x18\x03 \x01(\r\x12\x18\n\x10refresh_interval\x18\x04 \x01(\r\x12\x0f\n\x07\x65nabled\x18\x05 \x01(\x08\x42\x08\n\x06_error\"\x13\n\x11\x45psEnable_Request\"\x14\n\x12\x45psDisable_Request\"-\n\x16ProfilerEnable_Request\x12\x13\n\x0bsample_rate\x18\x01 \x01(\r\"\x19\n\x17ProfilerDisable_Request\"\"\n\x13ProfilerGet_Request\x12\x0b\n\x03top\x18\x01 \x01(\r\"c\n\rProfilerStats\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05\x63\x61lls\x18\x02 \x01(\x04\x12\x0f\n\x07matches\x18\x03 \x01(\x04\x12\x12\n\nmatch_rate\x18\x04 \x01(\x01\x12\x10\n\x08total_ns\x18\x05 \x01(\x04\"\x87\x02\n\x14ProfilerGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0f\n\x07\x65nabled\x18\x03 \x01(\x08\x12\x13\n\x0bsample_rate\x18\x04 \x01(\r\x12:\n\x06\x61ssets\x18\x05 \x03(\x0b\x32*.com.wazuh.api.engine.router.ProfilerStats\x12;\n\x07helpers\x18\x06 \x03(\x0b\x32*.com.wazuh.api.engine.router.ProfilerStatsB\x08\n\x06_error*5\n\x05State\x12\x11\n\rSTATE_UNKNOWN\x10\x00\x12\x0c\n\x08\x44ISABLED\x10\x01\x12\x0b\n\x07\x45NABLED\x10\x02*>\n\x04Sync\x12\x10\n\x0cSYNC_UNKNOWN\x10\x00\x12\x0b\n\x07UPDATED\x10\x01\x12\x0c\n\x08OUTDATED\x10\x02\x12\t\n\x05\x45RROR\x10\x03\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'router_pb2', globals())
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _STATE._serialized_start=1364
-  _STATE._serialized_end=1417
-  _SYNC._serialized_start=1419
-  _SYNC._serialized_end=1481
+  _STATE._serialized_start=1841
+  _STATE._serialized_end=1894
+  _SYNC._serialized_start=1896
+  _SYNC._serialized_end=1958
   _ENTRYPOST._serialized_start=59
   _ENTRYPOST._serialized_end=176
   _ENTRY._serialized_start=179
@@ -57,4 +57,14 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _EPSENABLE_REQUEST._serialized_end=1340
   _EPSDISABLE_REQUEST._serialized_start=1342
   _EPSDISABLE_REQUEST._serialized_end=1362
+  _PROFILERENABLE_REQUEST._serialized_start=1364
+  _PROFILERENABLE_REQUEST._serialized_end=1409
+  _PROFILERDISABLE_REQUEST._serialized_start=1411
+  _PROFILERDISABLE_REQUEST._serialized_end=1436
+  _PROFILERGET_REQUEST._serialized_start=1438
+  _PROFILERGET_REQUEST._serialized_end=1472
+  _PROFILERSTATS._serialized_start=1474
+  _PROFILERSTATS._serialized_end=1573
+  _PROFILERGET_RESPONSE._serialized_start=1576
+  _PROFILERGET_RESPONSE._serialized_end=1839
 # @@protoc_insertion_point(module_scope)
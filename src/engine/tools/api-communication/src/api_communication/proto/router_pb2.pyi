@@ -82,6 +82,52 @@ class EpsUpdate_Request(_message.Message):
     refresh_interval: int
     def __init__(self, eps: _Optional[int] = ..., refresh_interval: _Optional[int] = ...) -> None: ...
 
+class ProfilerDisable_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class ProfilerEnable_Request(_message.Message):
+    __slots__ = ["sample_rate"]
+    SAMPLE_RATE_FIELD_NUMBER: _ClassVar[int]
+    sample_rate: int
+    def __init__(self, sample_rate: _Optional[int] = ...) -> None: ...
+
+class ProfilerGet_Request(_message.Message):
+    __slots__ = ["top"]
+    TOP_FIELD_NUMBER: _ClassVar[int]
+    top: int
+    def __init__(self, top: _Optional[int] = ...) -> None: ...
+
+class ProfilerGet_Response(_message.Message):
+    __slots__ = ["assets", "enabled", "error", "helpers", "sample_rate", "status"]
+    ASSETS_FIELD_NUMBER: _ClassVar[int]
+    ENABLED_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    HELPERS_FIELD_NUMBER: _ClassVar[int]
+    SAMPLE_RATE_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    assets: _containers.RepeatedCompositeFieldContainer[ProfilerStats]
+    enabled: bool
+    error: str
+    helpers: _containers.RepeatedCompositeFieldContainer[ProfilerStats]
+    sample_rate: int
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., enabled: bool = ..., sample_rate: _Optional[int] = ..., assets: _Optional[_Iterable[_Union[ProfilerStats, _Mapping]]] = ..., helpers: _Optional[_Iterable[_Union[ProfilerStats, _Mapping]]] = ...) -> None: ...
+
+class ProfilerStats(_message.Message):
+    __slots__ = ["calls", "match_rate", "matches", "name", "total_ns"]
+    CALLS_FIELD_NUMBER: _ClassVar[int]
+    MATCHES_FIELD_NUMBER: _ClassVar[int]
+    MATCH_RATE_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    TOTAL_NS_FIELD_NUMBER: _ClassVar[int]
+    calls: int
+    match_rate: float
+    matches: int
+    name: str
+    total_ns: int
+    def __init__(self, name: _Optional[str] = ..., calls: _Optional[int] = ..., matches: _Optional[int] = ..., match_rate: _Optional[float] = ..., total_ns: _Optional[int] = ...) -> None: ...
+
 class QueuePost_Request(_message.Message):
     __slots__ = ["wazuh_event"]
     WAZUH_EVENT_FIELD_NUMBER: _ClassVar[int]
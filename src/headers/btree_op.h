@@ -0,0 +1,191 @@
+/**
+ * @file btree_op.h
+ * @brief B-tree data structure declaration
+ *
+ * @copyright Copyright (C) 2015 Wazuh, Inc.
+ */
+
+/*
+ * This program is a free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef BTREE_H
+#define BTREE_H
+
+/// Minimum degree of the tree: nodes hold between B_DEGREE - 1 and 2 * B_DEGREE - 1 keys
+#define B_DEGREE 16
+#define B_MAX_KEYS (2 * B_DEGREE - 1)
+
+/// B-tree node
+typedef struct b_node {
+    unsigned count;                         ///< Number of keys in the node
+    int leaf;                               ///< Whether the node has no children
+    char * keys[B_MAX_KEYS];                ///< Sorted keys
+    void * values[B_MAX_KEYS];              ///< Values of the keys
+    struct b_node * children[B_MAX_KEYS + 1]; ///< Children, only allocated for inner nodes
+} b_node;
+
+/**
+ * @brief B-tree abstract data type
+ *
+ * A B-tree is a self-balanced search tree that keeps many keys per node.
+ *
+ * It has the same interface as the red-black tree (rbtree_op.h) and supports
+ * O(log n) insertion, deletion and search, but a search visits a few nodes
+ * with contiguous arrays of keys instead of one allocation per key, which
+ * makes it friendlier to the cache on large tables.
+ */
+typedef struct b_tree {
+    b_node * root;              ///< Pointer to root node
+    unsigned size;              ///< Number of elements
+    void (*dispose)(void *);    ///< Pointer to function to dispose an element
+} b_tree;
+
+/**
+ * @brief Create a B-tree
+ *
+ * @return Pointer to an empty tree.
+ */
+
+b_tree * btree_init();
+
+/**
+ * @brief Free a B-tree
+ *
+ * If tree is NULL, no operation is performed.
+ *
+ * @post The tree is destroyed, including keys and values.
+ * @param tree Pointer to a B-tree.
+ */
+
+void btree_destroy(b_tree * tree);
+
+/**
+ * @brief Set free function to dispose elements
+ *
+ * btree_destroy, btree_replace and btree_delete will call this function for
+ * each element that they take out from the tree.
+ *
+ * @param tree Pointer to a B-tree.
+ * @param dispose Pointer to function to dispose an element.
+ */
+
+void btree_set_dispose(b_tree * tree, void (*dispose)(void *));
+
+/**
+ * @brief Insert a key-value in the tree
+ *
+ * Unlike rbtree_insert, no node is returned since elements move between
+ * nodes as the tree changes.
+ *
+ * @param tree Pointer to a B-tree.
+ * @param key Data key, used for ordering.
+ * @param value Data value.
+ * @retval 1 The element was inserted.
+ * @retval 0 Key already exists in the tree.
+ */
+
+int btree_insert(b_tree * tree, const char * key, void * value);
+
+/**
+ * @brief Update the value of an existing key
+ *
+ * @param tree Pointer to a B-tree.
+ * @param key Data key.
+ * @param value Data value.
+ * @post The old value is disposed if a dispose function was defined.
+ * @return Pointer to value, on success.
+ * @retval NULL Key not found.
+ */
+
+void * btree_replace(b_tree * tree, const char * key, void * value);
+
+/**
+ * @brief Retrieve a value from the tree
+ *
+ * @param tree Pointer to a B-tree.
+ * @param key Data key (search criteria).
+ * @return Pointer to data value, if found.
+ * @retval NULL Key not found.
+ */
+
+void * btree_get(const b_tree * tree, const char * key);
+
+/**
+ * @brief Remove a value from the tree
+ *
+ * @param tree Pointer to a B-tree.
+ * @param key Data key.
+ * @retval 1 The element was found and deleted.
+ * @retval 0 Key not in the tree.
+ */
+
+int btree_delete(b_tree * tree, const char * key);
+
+/**
+ * @brief Get the minimum key in the tree
+ *
+ * @param tree Pointer to a B-tree.
+ * @return Minimum key in the tree.
+ * @retval NULL The tree is empty.
+ */
+
+const char * btree_minimum(const b_tree * tree);
+
+/**
+ * @brief Get the maximum key in the tree
+ *
+ * @param tree Pointer to a B-tree.
+ * @return Maximum key in the tree.
+ * @retval NULL The tree is empty.
+ */
+
+const char * btree_maximum(const b_tree * tree);
+
+/**
+ * @brief Get all the keys in the tree
+ *
+ * Retrieve all the keys, ordered alphabetically (inorder traversal).
+ *
+ * @param tree Pointer to a B-tree.
+ * @return Null-terminated array of keys.
+ */
+
+char ** btree_keys(const b_tree * tree);
+
+/**
+ * @brief Get all the keys from the tree within a range
+ *
+ * Retrieve all the keys in the closed range [min, max], ordered alphabetically
+ * (inorder traversal).
+ *
+ * @param tree Pointer to a B-tree.
+ * @param min Minimum key.
+ * @param max Maximum key.
+ * @return Null-terminated array of keys.
+ */
+
+char ** btree_range(const b_tree * tree, const char * min, const char * max);
+
+/**
+ * @brief Get the size of the tree
+ *
+ * @param tree Pointer to a B-tree.
+ * @return unsigned Number of elements in the tree.
+ */
+
+unsigned btree_size(const b_tree * tree);
+
+/**
+ * @brief Check whether the tree is empty.
+ *
+ * @param tree Pointer to a B-tree.
+ * @retval 1 The tree is empty.
+ * @retval 0 The tree is not empty.
+ */
+int btree_empty(const b_tree * tree);
+
+#endif
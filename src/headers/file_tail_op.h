@@ -0,0 +1,149 @@
+/*
+ * File tail reader
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+/**
+ * Library that follows a growing line-based file, such as the alerts
+ * and archives logs, returning its complete lines in batches.
+ *
+ * The file is read in large blocks and split with memchr. A batch owns a
+ * copy of its lines, so it can be handed to another thread while the
+ * reader goes on. When the reader reaches the end of the file it checks
+ * whether the path was rotated or the file truncated, and reopens it.
+ * Where inotify is available, ftail_wait sleeps until the file changes
+ * instead of polling.
+ * */
+#ifndef FILE_TAIL_OP_H
+#define FILE_TAIL_OP_H
+
+#include <sys/types.h>
+
+#define FTAIL_READ_SIZE 65536
+
+/**
+ * @brief Matches a line of a multi-line record
+ *
+ * @param line the line, without its newline
+ * @param data argument given to the reader
+ * @return 1 if the line matches, 0 otherwise
+ * */
+typedef int (*w_ftail_match_t)(const char * line, void * data);
+
+/**
+ * position of the matching line in a multi-line record
+ * */
+typedef enum w_ftail_record_e {
+    FTAIL_RECORD_START, ///> A matching line starts a new record
+    FTAIL_RECORD_END    ///> A matching line ends the current record
+} w_ftail_record_t;
+
+/**
+ * batch of lines
+ * */
+typedef struct w_ftail_batch_s {
+    char * data;   ///> Lines, each one terminated by '\0' instead of '\n'
+    char ** lines; ///> Pointers to the lines or records in data
+    size_t count;  ///> Number of lines or records
+} w_ftail_batch_t;
+
+/**
+ * reader main structure
+ * */
+typedef struct w_ftail_s {
+    char * path;             ///> Path of the file
+    int fd;                  ///> File descriptor, -1 if the file is not opened
+    dev_t dev;               ///> Device of the opened file
+    ino_t inode;             ///> Inode of the opened file
+    off_t offset;            ///> Position of the next read
+    char * buffer;           ///> Read buffer
+    size_t size;             ///> Size of the read buffer
+    size_t max_size;         ///> Maximum size of the read buffer, lines that do not fit are discarded
+    size_t begin;            ///> Start of the first incomplete line in the buffer
+    size_t end;              ///> End of the read data in the buffer
+    size_t scanned;          ///> End of the data searched for a newline
+    size_t examined;         ///> End of the lines assembled into the pending multi-line record
+    int discard;             ///> Whether the rest of a long line is being discarded
+    unsigned long discarded; ///> Number of lines discarded for being too long
+    int inotify_fd;          ///> inotify instance, -1 if not available
+    int watch;               ///> inotify watch of the opened file
+} w_ftail_t;
+
+/**
+ * @brief Opens a file to follow
+ *
+ * @param path path of the file
+ * @param tail 1 to start at the end of the file, 0 to start at the beginning
+ * @param max_line maximum line length, at least FTAIL_READ_SIZE is used
+ * @return reader structure
+ *         NULL if the file could not be opened
+ * */
+w_ftail_t * ftail_open(const char * path, int tail, size_t max_line);
+
+/**
+ * @brief Closes a reader
+ *
+ * @param ftail the reader, NULL is allowed
+ * */
+void ftail_close(w_ftail_t * ftail);
+
+/**
+ * @brief Reads the next complete lines of the file
+ *
+ * Reads at most one block from the file. If the end of the file is reached,
+ * the file is reopened when it was rotated and read from the beginning when
+ * it was truncated.
+ *
+ * @param ftail the reader
+ * @param max maximum number of lines in the batch
+ * @return batch of lines, to be freed with ftail_batch_free
+ *         NULL if there is no complete line available
+ * */
+w_ftail_batch_t * ftail_read(w_ftail_t * ftail, size_t max);
+
+/**
+ * @brief Reads the next complete multi-line records of the file
+ *
+ * Lines are matched in the read buffer and grouped into records without
+ * copying them, then the records of the batch are copied once. A record is
+ * complete when the line that starts the next one or ends it arrives. The
+ * pending record is returned as it is when flush is set, for instance
+ * after a timeout without new data, or when it fills the buffer.
+ *
+ * Records keep the newlines between their lines. The same reader must not
+ * be used with ftail_read and ftail_read_multiline.
+ *
+ * @param ftail the reader
+ * @param match line matcher
+ * @param data argument for the matcher
+ * @param mode whether a matching line starts or ends a record
+ * @param max maximum number of records in the batch
+ * @param flush 1 to return the pending record if there is no complete one
+ * @return batch of records, to be freed with ftail_batch_free
+ *         NULL if there is no complete record available
+ * */
+w_ftail_batch_t * ftail_read_multiline(w_ftail_t * ftail, w_ftail_match_t match, void * data, w_ftail_record_t mode, size_t max, int flush);
+
+/**
+ * @brief Waits until the file may have new data (THREAD BLOCK)
+ *
+ * @param ftail the reader
+ * @param timeout maximum time to wait, in milliseconds
+ * @return 1 if the file changed
+ *         0 if the timeout expired or the change can not be watched
+ * */
+int ftail_wait(w_ftail_t * ftail, int timeout);
+
+/**
+ * @brief Frees a batch
+ *
+ * @param batch the batch, NULL is allowed
+ * */
+void ftail_batch_free(w_ftail_batch_t * batch);
+
+#endif // FILE_TAIL_OP_H
@@ -0,0 +1,152 @@
+/*
+ * Lock-free ring (abstract data type)
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+/**
+ * Library that creates a bounded circular buffer where items
+ * are pushed and popped following the FIFO (First In, First Out)
+ * principle without taking a lock.
+ *
+ * Any number of producers and consumers may use the ring at the same
+ * time. Each cell holds a sequence number that tells whether it is ready
+ * to be written or read at a given position, so a push or a pop only
+ * reserves a position with a compare-and-swap. The blocking variants
+ * sleep on a condition variable only when the ring is empty or full, and
+ * the opposite side signals it only if someone is waiting.
+ * */
+#ifndef RING_OP_H
+#define RING_OP_H
+
+#include <pthread.h>
+#include <time.h>
+
+#define W_RING_CACHE_LINE 64
+
+/**
+ * ring cell
+ * */
+typedef struct w_ring_cell_s {
+    size_t sequence; ///> Position the cell is ready for
+    void * data;     ///> Stored element
+} w_ring_cell_t;
+
+/**
+ * ring main structure
+ * */
+typedef struct w_ring_s {
+    w_ring_cell_t * cells; ///> Cells of the circular buffer
+    size_t mask;           ///> Size of the ring minus one, the size is a power of two
+    char pad0[W_RING_CACHE_LINE];
+    size_t head;           ///> Next position to push, shared by the producers
+    char pad1[W_RING_CACHE_LINE];
+    size_t tail;           ///> Next position to pop, shared by the consumers
+    char pad2[W_RING_CACHE_LINE];
+    unsigned int waiting_pop;  ///> Consumers sleeping in a blocking pop
+    unsigned int waiting_push; ///> Producers sleeping in a blocking push
+    pthread_mutex_t mutex; ///> mutex for the condition variables
+    pthread_cond_t available; ///> Condition variable when the ring is empty
+    pthread_cond_t available_not_full; ///> Condition variable when the ring is full
+} w_ring_t;
+
+/**
+ * @brief Initializes a new ring structure
+ *
+ * @param n minimum number of elements, it is rounded up to a power of two
+ * @return initialized ring structure
+ * */
+w_ring_t * ring_init(size_t n);
+
+/**
+ * @brief Frees an existent ring, the remaining elements are not freed
+ *
+ * @param ring
+ * */
+void ring_free(w_ring_t * ring);
+
+/**
+ * @brief Evaluates whether the ring is empty or not
+ *
+ * @param ring
+ * @return 1 if true, 0 if false
+ * */
+int ring_empty(const w_ring_t * ring);
+
+/**
+ * @brief Tries to insert an element into the ring
+ *
+ * @param ring the ring
+ * @param data data to be inserted
+ * @return -1 if ring is full
+ *          0 on success
+ * */
+int ring_push(w_ring_t * ring, void * data);
+
+/**
+ * @brief Tries to insert several elements into the ring, in order
+ *
+ * The elements are inserted while there is space, the ones that did not
+ * fit are left to the caller.
+ *
+ * @param ring the ring
+ * @param data elements to be inserted
+ * @param n number of elements
+ * @return number of elements inserted
+ * */
+size_t ring_push_batch(w_ring_t * ring, void ** data, size_t n);
+
+/**
+ * @brief Same as ring_push but if the ring is full will
+ * wait until there is space for the element (THREAD BLOCK)
+ *
+ * @param ring the ring
+ * @param data data to be inserted
+ * @return 0 always
+ * */
+int ring_push_ex_block(w_ring_t * ring, void * data);
+
+/**
+ * @brief Retrieves next item in the ring
+ *
+ * @param ring the ring
+ * @return element if ring has a next
+ *         NULL if ring is empty
+ * */
+void * ring_pop(w_ring_t * ring);
+
+/**
+ * @brief Retrieves up to n items from the ring, in order
+ *
+ * @param ring the ring
+ * @param data array to store the elements
+ * @param n maximum number of elements
+ * @return number of elements retrieved
+ * */
+size_t ring_pop_batch(w_ring_t * ring, void ** data, size_t n);
+
+/**
+ * @brief Same as ring_pop but if the ring is empty
+ * THREAD WILL BLOCK until an element is pushed
+ *
+ * @param ring the ring
+ * @return next element in the ring
+ * */
+void * ring_pop_ex(w_ring_t * ring);
+
+/**
+ * @brief Same as ring_pop_ex but with a configured timeout for the
+ * wait. If ring is empty THREAD WILL BLOCK
+ *
+ * @param ring the ring
+ * @param abstime timeout specification
+ * @return next element in the ring
+ *         NULL if the timeout expired
+ * */
+void * ring_pop_ex_timedwait(w_ring_t * ring, const struct timespec * abstime);
+
+#endif // RING_OP_H
@@ -253,9 +253,11 @@ extern const char *__local_name;
 #include "list_op.h"
 #include "hash_op.h"
 #include "rbtree_op.h"
+#include "btree_op.h"
 #include "queue_op.h"
 #include "queue_linked_op.h"
 #include "bqueue_op.h"
+#include "ring_op.h"
 #include "store_op.h"
 #include "rc.h"
 #include "ar.h"
@@ -263,6 +265,7 @@ extern const char *__local_name;
 #include "validate_op.h"
 #include "file-queue.h"
 #include "json-queue.h"
+#include "file_tail_op.h"
 #include "read-agents.h"
 #include "report_op.h"
 #include "string_op.h"
@@ -19,11 +19,18 @@
 
 typedef unsigned char uchar;
 
+static unsigned char *aes_iv = (unsigned char *)"FEDCBA0987654321";
+
+struct os_aes_ctx {
+    EVP_CIPHER_CTX *encrypt;
+    EVP_CIPHER_CTX *decrypt;
+};
+
 
 int OS_AES_Str(const char *input, char *output, const char *charkey,
               long size, short int action)
 {
-    static unsigned char *iv = (unsigned char *)"FEDCBA0987654321";
+    unsigned char *iv = aes_iv;
 
     if(action == OS_ENCRYPT)
     {
@@ -100,3 +107,74 @@ end:
 	EVP_CIPHER_CTX_free(ctx);
 	return plaintext_len;
 }
+
+os_aes_ctx *OS_AES_Ctx_New(const char *charkey)
+{
+    os_aes_ctx *ctx;
+
+    if (!(ctx = calloc(1, sizeof(os_aes_ctx)))) {
+        return NULL;
+    }
+
+    if (!(ctx->encrypt = EVP_CIPHER_CTX_new()) || !(ctx->decrypt = EVP_CIPHER_CTX_new())) {
+        goto error;
+    }
+
+    /* EVP uses the AES instructions of the CPU when it has them */
+    if (1 != EVP_EncryptInit_ex(ctx->encrypt, EVP_aes_256_cbc(), NULL, (const uchar *)charkey, aes_iv)) {
+        goto error;
+    }
+
+    if (1 != EVP_DecryptInit_ex(ctx->decrypt, EVP_aes_256_cbc(), NULL, (const uchar *)charkey, aes_iv)) {
+        goto error;
+    }
+
+    return ctx;
+
+error:
+    OS_AES_Ctx_Free(ctx);
+    return NULL;
+}
+
+int OS_AES_Ctx_Str(os_aes_ctx *ctx, const char *input, char *output,
+                   long size, short int action)
+{
+    int len;
+    int output_len;
+
+    if (action == OS_ENCRYPT) {
+        /* Without a cipher and a key, only the IV and the state are reset */
+        if (1 != EVP_EncryptInit_ex(ctx->encrypt, NULL, NULL, NULL, aes_iv) ||
+            1 != EVP_EncryptUpdate(ctx->encrypt, (uchar *)output, &len, (const uchar *)input, (int)size)) {
+            return 0;
+        }
+
+        output_len = len;
+
+        if (1 != EVP_EncryptFinal_ex(ctx->encrypt, (uchar *)output + len, &len)) {
+            return 0;
+        }
+    } else {
+        if (1 != EVP_DecryptInit_ex(ctx->decrypt, NULL, NULL, NULL, aes_iv) ||
+            1 != EVP_DecryptUpdate(ctx->decrypt, (uchar *)output, &len, (const uchar *)input, (int)size)) {
+            return 0;
+        }
+
+        output_len = len;
+
+        if (1 != EVP_DecryptFinal_ex(ctx->decrypt, (uchar *)output + len, &len)) {
+            return 0;
+        }
+    }
+
+    return output_len + len;
+}
+
+void OS_AES_Ctx_Free(os_aes_ctx *ctx)
+{
+    if (ctx) {
+        EVP_CIPHER_CTX_free(ctx->encrypt);
+        EVP_CIPHER_CTX_free(ctx->decrypt);
+        free(ctx);
+    }
+}
@@ -21,4 +21,22 @@ int decrypt_AES(const unsigned char *ciphertext, int ciphertext_len, unsigned ch
 int OS_AES_Str(const char *input, char *output, const char *charkey,
               long size, short int action) __attribute((nonnull));
 
+/* AES contexts of a key, kept for the messages of a connection */
+typedef struct os_aes_ctx os_aes_ctx;
+
+/* Create the contexts of a key, the key schedule is computed once.
+ * Returns NULL on error.
+ */
+os_aes_ctx *OS_AES_Ctx_New(const char *charkey) __attribute((nonnull));
+
+/* Same as OS_AES_Str with the contexts of the key. Only the IV is
+ * set again for each message, nothing is allocated.
+ * A context must not be used by several threads at once.
+ */
+int OS_AES_Ctx_Str(os_aes_ctx *ctx, const char *input, char *output,
+                   long size, short int action) __attribute((nonnull));
+
+/* Release the contexts of a key */
+void OS_AES_Ctx_Free(os_aes_ctx *ctx);
+
 #endif /* AES_OP_H */
@@ -21,12 +21,17 @@
 
 typedef unsigned char uchar;
 
+static const unsigned char cbc_iv [8] = {0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10};
+
+struct os_bf_key {
+    BF_KEY key;
+};
+
 
 int OS_BF_Str(const char *input, char *output, const char *charkey,
               long size, short int action)
 {
     BF_KEY key = {.P = {0}};
-    static unsigned char cbc_iv [8] = {0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10};
     unsigned char iv[8];
 
     memcpy(iv, cbc_iv, sizeof(iv));
@@ -38,3 +43,32 @@ int OS_BF_Str(const char *input, char *output, const char *charkey,
 
     return (1);
 }
+
+os_bf_key *OS_BF_Key_New(const char *charkey)
+{
+    os_bf_key *key = calloc(1, sizeof(os_bf_key));
+
+    if (key) {
+        BF_set_key(&key->key, (int)strlen(charkey), (const uchar *)charkey);
+    }
+
+    return (key);
+}
+
+int OS_BF_Key_Str(const os_bf_key *key, const char *input, char *output,
+                  long size, short int action)
+{
+    unsigned char iv[8];
+
+    memcpy(iv, cbc_iv, sizeof(iv));
+
+    BF_cbc_encrypt((const uchar *)input, (uchar *)output, (long)size,
+                   &key->key, iv, action);
+
+    return (1);
+}
+
+void OS_BF_Key_Free(os_bf_key *key)
+{
+    free(key);
+}
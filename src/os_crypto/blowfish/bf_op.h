@@ -21,4 +21,19 @@
 int OS_BF_Str(const char *input, char *output, const char *charkey,
               long size, short int action) __attribute((nonnull));
 
+/* Blowfish key schedule, kept for the messages of a connection */
+typedef struct os_bf_key os_bf_key;
+
+/* Compute the key schedule of a key.
+ * Returns NULL on error.
+ */
+os_bf_key *OS_BF_Key_New(const char *charkey) __attribute((nonnull));
+
+/* Same as OS_BF_Str with the key schedule of the key */
+int OS_BF_Key_Str(const os_bf_key *key, const char *input, char *output,
+                  long size, short int action) __attribute((nonnull));
+
+/* Release a key schedule */
+void OS_BF_Key_Free(os_bf_key *key);
+
 #endif /* BF_OP_H */
@@ -16,6 +16,9 @@
 #include "os_regex.h"
 #include "os_regex_internal.h"
 
+/* Internal prototypes */
+static int _OSMatch_Automaton(OSMatch *reg) __attribute__((nonnull));
+
 
 /* Compile a pattern to be used later
  * Allowed flags are:
@@ -43,6 +46,7 @@ int OSMatch_Compile(const char *pattern, OSMatch *reg, int flags)
     reg->patterns = NULL;
     reg->size = NULL;
     reg->match_fp = NULL;
+    reg->automaton = NULL;
     reg->negate = 0;
     reg->raw = NULL;
 
@@ -179,6 +183,12 @@ int OSMatch_Compile(const char *pattern, OSMatch *reg, int flags)
 
     } while (!end_of_string);
 
+    /* Match the sub patterns without ^ or $ in a single pass */
+    if (!_OSMatch_Automaton(reg)) {
+        reg->error = OS_REGEX_OUTOFMEMORY;
+        goto compile_error;
+    }
+
     /* Success return */
     free(new_str_free);
     return (1);
@@ -194,3 +204,120 @@ compile_error:
 
     return (0);
 }
+
+/* Build the automaton of the sub patterns matched with _OS_Match, if
+ * there are enough of them.
+ * Returns 1 on success or 0 on error.
+ */
+static int _OSMatch_Automaton(OSMatch *reg)
+{
+    match_automaton *ac;
+    uchar pattern_class[256] = {0};
+    unsigned int *fail = NULL;
+    unsigned int *queue = NULL;
+    unsigned int *next;
+    unsigned int state;
+    size_t plain = 0;
+    size_t max_states = 1;
+    size_t head = 0;
+    size_t tail = 0;
+    size_t i;
+    size_t j;
+    const char *pt;
+
+    for (i = 0; reg->patterns[i]; i++) {
+        if (reg->match_fp[i] == _OS_Match) {
+            plain++;
+            max_states += reg->size[i];
+        }
+    }
+
+    if (plain < OS_MATCH_AUTOMATON_MIN) {
+        return (1);
+    }
+
+    ac = (match_automaton *) calloc(1, sizeof(match_automaton));
+    if (!ac) {
+        return (0);
+    }
+    reg->automaton = ac;
+
+    /* A class for each character of the patterns. The string is
+     * compared case folded, the same as in _OS_Match.
+     */
+    ac->classes = 1;
+    for (i = 0; reg->patterns[i]; i++) {
+        if (reg->match_fp[i] != _OS_Match) {
+            continue;
+        }
+
+        for (pt = reg->patterns[i]; *pt != '\0'; pt++) {
+            if (!pattern_class[(uchar) *pt]) {
+                pattern_class[(uchar) *pt] = (uchar) ac->classes++;
+            }
+        }
+    }
+
+    for (i = 0; i < 256; i++) {
+        ac->class_map[i] = pattern_class[charmap[i]];
+    }
+
+    ac->delta = (unsigned int *) calloc(max_states * ac->classes, sizeof(unsigned int));
+    ac->final = (uchar *) calloc(max_states, sizeof(uchar));
+    fail = (unsigned int *) calloc(max_states, sizeof(unsigned int));
+    queue = (unsigned int *) calloc(max_states, sizeof(unsigned int));
+    if (!ac->delta || !ac->final || !fail || !queue) {
+        free(fail);
+        free(queue);
+        return (0);
+    }
+
+    /* Trie of the patterns. No transition goes to the initial state
+     * yet, so 0 stands for a missing one.
+     */
+    ac->states = 1;
+    for (i = 0; reg->patterns[i]; i++) {
+        if (reg->match_fp[i] != _OS_Match) {
+            continue;
+        }
+
+        state = 0;
+        for (pt = reg->patterns[i]; *pt != '\0'; pt++) {
+            next = &ac->delta[state * ac->classes + pattern_class[(uchar) *pt]];
+            if (!*next) {
+                *next = (unsigned int) ac->states++;
+            }
+            state = *next;
+        }
+        ac->final[state] = 1;
+    }
+
+    /* Failure links in breadth-first order. A missing transition takes
+     * the one of the failure state, which is already complete.
+     */
+    for (j = 1; j < ac->classes; j++) {
+        if (ac->delta[j]) {
+            queue[tail++] = ac->delta[j];
+        }
+    }
+
+    while (head < tail) {
+        state = queue[head++];
+
+        for (j = 1; j < ac->classes; j++) {
+            next = &ac->delta[state * ac->classes + j];
+            if (*next) {
+                fail[*next] = ac->delta[fail[state] * ac->classes + j];
+                ac->final[*next] |= ac->final[fail[*next]];
+                queue[tail++] = *next;
+            } else {
+                *next = ac->delta[fail[state] * ac->classes + j];
+            }
+        }
+    }
+
+    free(fail);
+    free(queue);
+
+    return (1);
+}
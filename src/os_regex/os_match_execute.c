@@ -15,6 +15,9 @@
 #include "os_regex.h"
 #include "os_regex_internal.h"
 
+/* Internal prototypes */
+static int _OSMatch_Automaton_Execute(const match_automaton *ac, const char *str, size_t str_len) __attribute__((nonnull));
+
 
 int _OS_Match(const char *pattern, const char *str, size_t str_len, size_t size)
 {
@@ -112,8 +115,13 @@ int OSMatch_Execute(const char *str, size_t str_len, OSMatch *reg)
         return (0);
     }
 
-    /* Loop over all sub patterns */
+    /* Loop over all sub patterns, the ones of the automaton are matched at once */
     while (reg->patterns[i]) {
+        if (reg->automaton && reg->match_fp[i] == _OS_Match) {
+            i++;
+            continue;
+        }
+
         if (reg->match_fp[i](reg->patterns[i],
                              str,
                              str_len,
@@ -123,5 +131,27 @@ int OSMatch_Execute(const char *str, size_t str_len, OSMatch *reg)
         i++;
     }
 
+    if (reg->automaton && _OSMatch_Automaton_Execute(reg->automaton, str, str_len) == TRUE) {
+        return(reg->negate == 0?1:0);
+    }
+
     return(reg->negate);
 }
+
+/* Read the string through the automaton.
+ * Returns TRUE if any of its sub patterns is in the string.
+ */
+static int _OSMatch_Automaton_Execute(const match_automaton *ac, const char *str, size_t str_len)
+{
+    unsigned int state = 0;
+    size_t i;
+
+    for (i = 0; i < str_len; i++) {
+        state = ac->delta[state * ac->classes + ac->class_map[(uchar)str[i]]];
+        if (ac->final[state]) {
+            return (TRUE);
+        }
+    }
+
+    return (FALSE);
+}
@@ -34,6 +34,13 @@ void OSMatch_FreePattern(OSMatch *reg)
         os_free(reg->patterns);
     }
 
+    /* Free the automaton */
+    if (reg->automaton) {
+        os_free(reg->automaton->delta);
+        os_free(reg->automaton->final);
+        os_free(reg->automaton);
+    }
+
     os_free(reg->size);
     os_free(reg->match_fp);
     os_free(reg->raw);
@@ -55,6 +55,7 @@ typedef struct _OSRegex {
     char *raw;
     int *flags;
     char **patterns;
+    char **literals;
     const char ** *prts_closure;
     pthread_mutex_t mutex;
     bool mutex_initialised;
@@ -64,6 +65,9 @@ typedef struct _OSRegex {
     regex_dynamic_size d_size;
 } OSRegex;
 
+/* Automaton of the OSMatch sub patterns without ^ or $ */
+typedef struct match_automaton match_automaton;
+
 /* OSmatch structure */
 typedef struct _OSMatch {
     short int negate;
@@ -72,6 +76,7 @@ typedef struct _OSMatch {
     size_t *size;
     char **patterns;
     int (**match_fp)(const char *str, const char *str2, size_t str_len, size_t size);
+    match_automaton *automaton;
 } OSMatch;
 
 /*** Prototypes ***/
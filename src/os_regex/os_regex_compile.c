@@ -17,6 +17,9 @@
 #include "shared.h"
 #include "os_regex_internal.h"
 
+/* Internal prototypes */
+static char *_OS_Regex_Literal(const char *pattern) __attribute__((nonnull));
+
 
 /* Compile a regular expression to be used later
  * Allowed flags are:
@@ -45,6 +48,7 @@ int OSRegex_Compile(const char *pattern, OSRegex *reg, int flags)
     /* Initialize OSRegex structure */
     reg->error = 0;
     reg->patterns = NULL;
+    reg->literals = NULL;
     reg->flags = NULL;
     reg->d_prts_str = NULL;
     reg->d_sub_strings = NULL;
@@ -177,10 +181,11 @@ int OSRegex_Compile(const char *pattern, OSRegex *reg, int flags)
     /* Allocate the memory for the sub patterns */
     count++;
     os_calloc(count + 1, sizeof(char *), reg->patterns);
+    os_calloc(count + 1, sizeof(char *), reg->literals);
     os_calloc(count + 1, sizeof(int), reg->flags);
 
     /* Memory allocation error check */
-    if (!reg->patterns || !reg->flags) {
+    if (!reg->patterns || !reg->literals || !reg->flags) {
         reg->error = OS_REGEX_OUTOFMEMORY;
         goto compile_error;
     }
@@ -241,6 +246,9 @@ int OSRegex_Compile(const char *pattern, OSRegex *reg, int flags)
 
             }
 
+            /* The literal the string must contain for the sub pattern to match */
+            reg->literals[i] = _OS_Regex_Literal(reg->patterns[i]);
+
             /* Set the parenthesis closures */
             /* The parenthesis closure if set */
             if (reg->prts_closure) {
@@ -341,3 +349,60 @@ compile_error:
 
     return (0);
 }
+
+/* Get the longest run of plain characters of a compiled sub pattern.
+ * The interpreter reads every plain character of the pattern against
+ * a consecutive character of the string, so a string without the run
+ * can not match the sub pattern and the execution can skip it.
+ * Returns the run or NULL if the sub pattern has no plain characters.
+ */
+static char *_OS_Regex_Literal(const char *pattern)
+{
+    const char *pt = pattern;
+    const char *run = NULL;
+    const char *longest = NULL;
+    size_t longest_size = 0;
+    char *literal = NULL;
+
+    while (*pt != '\0') {
+        if (*pt == BACKSLASH) {
+            run = NULL;
+            pt += 2;
+
+            /* A match can end before the character after the last
+             * regex of the pattern is read, it is not required.
+             */
+            if (*pt == '\0' || *(pt + 1) == '\0') {
+                break;
+            }
+
+            if (isPlus(*pt)) {
+                pt++;
+            }
+            continue;
+        }
+
+        if (prts(*pt) || isPlus(*pt)) {
+            run = NULL;
+            pt++;
+            continue;
+        }
+
+        if (!run) {
+            run = pt;
+        }
+        pt++;
+
+        if ((size_t) (pt - run) > longest_size) {
+            longest = run;
+            longest_size = (size_t) (pt - run);
+        }
+    }
+
+    if (longest) {
+        os_calloc(longest_size + 1, sizeof(char), literal);
+        memcpy(literal, longest, longest_size);
+    }
+
+    return (literal);
+}
@@ -18,6 +18,7 @@
 /* Internal prototypes */
 static const char *_OS_Regex(const char *pattern, const char *str, const char **prts_closure,
                              const char **prts_str, int flags) __attribute__((nonnull(1, 2)));
+static int _OS_Regex_HasLiteral(const char *str, const char *literal) __attribute__((nonnull));
 
 
 const char *OSRegex_Execute(const char *str, OSRegex *reg)
@@ -108,6 +109,12 @@ const char *OSRegex_Execute_ex(const char *str, OSRegex *reg, regex_matching *re
             /* Clean the prts_str */
             memset((void*)(*prts_str)[i], 0, (str_sizes) ? str_sizes->prts_str_size[i] : reg->d_size.prts_str_size[i]);
 
+            /* The sub pattern can't match without its literal */
+            if (reg->literals && reg->literals[i] && !_OS_Regex_HasLiteral(str, reg->literals[i])) {
+                i++;
+                continue;
+            }
+
             if ((ret = _OS_Regex(reg->patterns[i], str, reg->prts_closure[i],
                                  (*prts_str)[i], reg->flags[i]))) {
                 j = 0;
@@ -157,6 +164,11 @@ const char *OSRegex_Execute_ex(const char *str, OSRegex *reg, regex_matching *re
 
     /* Loop on all sub patterns */
     for (i = 0; reg->patterns[i]; i++) {
+        /* The sub pattern can't match without its literal */
+        if (reg->literals && reg->literals[i] && !_OS_Regex_HasLiteral(str, reg->literals[i])) {
+            continue;
+        }
+
         if ((ret = _OS_Regex(reg->patterns[i], str, NULL, NULL, reg->flags[i]))) {
             if (!external_context) {
                 w_mutex_unlock((pthread_mutex_t *)&reg->mutex);
@@ -171,6 +183,31 @@ const char *OSRegex_Execute_ex(const char *str, OSRegex *reg, regex_matching *re
     return (NULL);
 }
 
+/* Search the literal of a sub pattern in the string, ignoring the case
+ * the same way the pattern is compared.
+ * Returns 1 if the string contains the literal and 0 otherwise.
+ */
+static int _OS_Regex_HasLiteral(const char *str, const char *literal)
+{
+    const uchar first = (uchar) *literal;
+    size_t i;
+
+    for (; *str != '\0'; str++) {
+        if (charmap[(uchar) *str] != first) {
+            continue;
+        }
+
+        /* The end of the string never matches a character of the literal */
+        for (i = 1; literal[i] != '\0' && charmap[(uchar) str[i]] == (uchar) literal[i]; i++);
+
+        if (literal[i] == '\0') {
+            return (1);
+        }
+    }
+
+    return (0);
+}
+
 #define PRTS(x) ((prts(*x) && x++) || 1)
 #define ENDOFFILE(x) ( PRTS(x) && (*x == '\0'))
 
@@ -86,6 +86,22 @@ typedef unsigned char uchar;
                      (x == 'W' && (y < 48 || y > 122 || \
                      (y > 57 && y <65)||(y > 90 && y< 97)))
 
+/* Minimum number of sub patterns without ^ or $ to match them with an automaton */
+#define OS_MATCH_AUTOMATON_MIN  2
+
+/* Aho-Corasick automaton of the OSMatch sub patterns without ^ or $.
+ * The string is read once instead of once per sub pattern. The
+ * characters are mapped to classes, 0 for the ones of no pattern, and
+ * every state has a transition for each class.
+ */
+struct match_automaton {
+    uchar class_map[256];   /* Class of each character of the string */
+    size_t classes;         /* Number of classes */
+    size_t states;          /* Number of states, 0 is the initial one */
+    unsigned int *delta;    /* Next state, indexed by state * classes + class */
+    uchar *final;           /* If a sub pattern ends in the state */
+};
+
 /* Charmap for case insensitive search */
 extern const uchar charmap[256];
 
@@ -16,6 +16,11 @@
 #include <stdlib.h>
 #include <ctype.h>
 
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "os_xml.h"
 #include "os_xml_internal.h"
 #include "file_op.h"
@@ -25,29 +30,47 @@ static int _oscomment(OS_XML *_lxml) __attribute__((nonnull));
 static int _writecontent(const char *str, __attribute__((unused)) size_t size, unsigned int parent, OS_XML *_lxml) __attribute__((nonnull));
 static int _writememory(const char *str, XML_TYPE type, size_t size,
                         unsigned int parent, OS_XML *_lxml) __attribute__((nonnull));
-static int _xml_fgetc(FILE *fp, OS_XML *_lxml) __attribute__((nonnull));
+static int _xml_fgetc(OS_XML *_lxml) __attribute__((nonnull));
 int _xml_sgetc(OS_XML *_lxml)  __attribute__((nonnull));
+static int _xml_load(OS_XML *_lxml) __attribute__((nonnull));
+static void _xml_close(OS_XML *_lxml, char *str_base) __attribute__((nonnull(1)));
 static int _getattributes(unsigned int parent, OS_XML *_lxml, bool flag_truncate) __attribute__((nonnull));
 static void xml_error(OS_XML *_lxml, const char *msg, ...) __attribute__((format(printf, 2, 3), nonnull));
 
+/* Element being read at a depth, its buffers are reused by the next elements at the same depth */
+typedef struct _xml_frame {
+    char *elem;
+    char *cont;
+    char *closedelim;
+    unsigned int count;
+    unsigned int currentlycont;
+    short int location;
+    int prevv;
+    bool ignore_content;
+} xml_frame;
+
 /**
- * @brief Recursive method to read XML elements.
+ * @brief Read the XML elements. The nested elements are read in a stack of frames instead of recursing.
  *
- * @param parent Current depth.
  * @param _lxml XML structure.
- * @param recursion_level Max recursion level allowed.
  * @param flag_truncate If TRUE, truncates the content of a tag when it's bigger than XML_MAXSIZE. Fails if set to FALSE.
  * @return int Returns 0, -1 or -2.
  */
-static int _ReadElem(unsigned int parent, OS_XML *_lxml, unsigned int recursion_level, bool flag_truncate) __attribute__((nonnull));
+static int _ReadElem(OS_XML *_lxml, bool flag_truncate) __attribute__((nonnull));
 
-/* Local fgetc */
-static int _xml_fgetc(FILE *fp, OS_XML *_lxml)
+/* Local fgetc, reads the file content loaded by _xml_load */
+static int _xml_fgetc(OS_XML *_lxml)
 {
     int c;
 
     // If there is any character in the stash, get it
-    c = (_lxml->stash_i > 0) ? _lxml->stash[--_lxml->stash_i] : fgetc(fp);
+    if (_lxml->stash_i > 0) {
+        c = _lxml->stash[--_lxml->stash_i];
+    } else if (_lxml->file_pos < _lxml->file_size) {
+        c = (unsigned char) _lxml->file[_lxml->file_pos++];
+    } else {
+        c = EOF;
+    }
 
     if (c == '\n') { /* add newline */
         _lxml->line++;
@@ -103,6 +126,81 @@ static void xml_error(OS_XML *_lxml, const char *msg, ...)
     _lxml->err_line = _lxml->line;
 }
 
+/* Load the whole file at once, mapping it when possible */
+static int _xml_load(OS_XML *_lxml)
+{
+    char *buffer = NULL;
+    char *tmp;
+    size_t size = 0;
+    size_t length = 0;
+    size_t n;
+
+#ifndef WIN32
+    struct stat st;
+
+    if (fstat(fileno(_lxml->fp), &st) == 0 && S_ISREG(st.st_mode)) {
+        if (st.st_size == 0) {
+            return (0);
+        }
+
+        buffer = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fileno(_lxml->fp), 0);
+        if (buffer != MAP_FAILED) {
+            madvise(buffer, (size_t) st.st_size, MADV_SEQUENTIAL);
+            _lxml->file = buffer;
+            _lxml->file_size = (size_t) st.st_size;
+            _lxml->file_mapped = true;
+            return (0);
+        }
+        buffer = NULL;
+    }
+#endif
+
+    /* Not a regular file or not mappable, read the stream */
+    do {
+        if (length == size) {
+            size = size ? size * 2 : BUFSIZ;
+            tmp = (char *) realloc(buffer, size);
+            if (tmp == NULL) {
+                free(buffer);
+                snprintf(_lxml->err, XML_ERR_LENGTH, "XMLERR: Memory error.");
+                return (-1);
+            }
+            buffer = tmp;
+        }
+        n = fread(buffer + length, 1, size - length, _lxml->fp);
+        length += n;
+    } while (n > 0);
+
+    _lxml->file = buffer;
+    _lxml->file_size = length;
+    _lxml->file_mapped = false;
+    return (0);
+}
+
+/* Release the source of the XML */
+static void _xml_close(OS_XML *_lxml, char *str_base)
+{
+    if (_lxml->fp) {
+#ifndef WIN32
+        if (_lxml->file_mapped) {
+            munmap(_lxml->file, _lxml->file_size);
+        } else
+#endif
+        {
+            free(_lxml->file);
+        }
+        _lxml->file = NULL;
+        _lxml->file_size = 0;
+        _lxml->file_pos = 0;
+        _lxml->file_mapped = false;
+
+        fclose(_lxml->fp);
+        _lxml->fp = NULL;
+    } else if (str_base) {
+        free(str_base);
+    }
+}
+
 /* Clear memory */
 void OS_ClearXML(OS_XML *_lxml)
 {
@@ -112,6 +210,7 @@ void OS_ClearXML(OS_XML *_lxml)
         free(_lxml->ct[i]);
     }
     _lxml->cur = 0;
+    _lxml->size = 0;
     _lxml->fol = 0;
     _lxml->err_line = 0;
 
@@ -149,15 +248,14 @@ int ParseXML(OS_XML *_lxml, bool flag_truncate) {
     // Reset stash
     _lxml->stash_i = 0;
 
-    if ((r = _ReadElem(0, _lxml, 0, flag_truncate)) < 0) { /* First position */
-        if (r != LEOF) {
-
-            if(_lxml->fp){
-                fclose(_lxml->fp);
-            } else if (str_base){
-                free(str_base);
-            }
+    if (_lxml->fp && _xml_load(_lxml) < 0) {
+        _xml_close(_lxml, str_base);
+        return (-1);
+    }
 
+    if ((r = _ReadElem(_lxml, flag_truncate)) < 0) { /* First position */
+        if (r != LEOF) {
+            _xml_close(_lxml, str_base);
             return (-1);
         }
     }
@@ -165,22 +263,12 @@ int ParseXML(OS_XML *_lxml, bool flag_truncate) {
     for (i = 0; i < _lxml->cur; i++) {
         if (_lxml->ck[i] == 0) {
             xml_error(_lxml, "XMLERR: Element '%s' not closed.", _lxml->el[i]);
-
-            if(_lxml->fp){
-                fclose(_lxml->fp);
-            } else if (str_base){
-                free(str_base);
-            }
-
+            _xml_close(_lxml, str_base);
             return (-1);
         }
     }
 
-    if(_lxml->fp){
-        fclose(_lxml->fp);
-    } else if (str_base){
-        free(str_base);
-    }
+    _xml_close(_lxml, str_base);
 
     return (0);
 }
@@ -251,31 +339,55 @@ static int _oscomment(OS_XML *_lxml)
     return (0);
 }
 
-static int _ReadElem(unsigned int parent, OS_XML *_lxml, unsigned int recursion_level, bool flag_truncate) {
-    int c=0;
-    unsigned int count = 0;
-    unsigned int _currentlycont = 0;
-    short int location = -1;
-    int cmp = 0;
-    int retval = -1;
-    bool ignore_content = false;
-
-    int prevv = 1;
-    char *elem = NULL;
-    char *cont = NULL;
-    char *closedelim = NULL;
+/* Set up the frame of a new element at depth, allocating its buffers the first time the depth is reached */
+static int _xml_enter(xml_frame **stack, unsigned int *frames, unsigned int depth, OS_XML *_lxml)
+{
+    xml_frame *frame;
 
-    if (++recursion_level > 1024) {
+    if (depth >= XML_MAX_DEPTH) {
         // 1024 levels should be enough for configuration and eventchannel events
         xml_error(_lxml, "XMLERR: Max recursion level reached");
-        return -1;
+        return (-1);
+    }
+
+    if (depth == *frames) {
+        frame = (xml_frame *) realloc(*stack, (*frames + 1) * sizeof(xml_frame));
+        if (frame == NULL) {
+            return (-1);
+        }
+        *stack = frame;
+        frame = &(*stack)[(*frames)++];
+
+        frame->elem = calloc(XML_MAXSIZE + 1, sizeof(char));
+        frame->cont = calloc(XML_MAXSIZE + 1, sizeof(char));
+        frame->closedelim = calloc(XML_MAXSIZE + 1, sizeof(char));
+
+        if (frame->elem == NULL || frame->cont == NULL || frame->closedelim == NULL) {
+            return (-1);
+        }
     }
 
-    elem = calloc(XML_MAXSIZE + 1, sizeof(char));
-    cont = calloc(XML_MAXSIZE + 1, sizeof(char));
-    closedelim = calloc(XML_MAXSIZE + 1, sizeof(char));
+    frame = &(*stack)[depth];
+    frame->count = 0;
+    frame->currentlycont = 0;
+    frame->location = -1;
+    frame->prevv = 1;
+    frame->ignore_content = false;
+
+    return (0);
+}
 
-    if (elem == NULL || cont == NULL || closedelim == NULL) {
+static int _ReadElem(OS_XML *_lxml, bool flag_truncate) {
+    int c=0;
+    int cmp = 0;
+    int retval = -1;
+    unsigned int parent = 0;
+    unsigned int frames = 0;
+    unsigned int i;
+    xml_frame *stack = NULL;
+    xml_frame *f;
+
+    if (_xml_enter(&stack, &frames, 0, _lxml) < 0) {
         goto end;
     }
 
@@ -308,16 +420,19 @@ static int _ReadElem(unsigned int parent, OS_XML *_lxml, unsigned int recursion_
     _xml_ungetc(_R_CONFS, _lxml);
 
     while ((c = xml_getc_fun(_lxml->fp, _lxml)) != cmp) {
+        /* The stack may have been moved by _xml_enter */
+        f = &stack[parent];
+
         if (c == '\\') {
-            prevv *= -1;
-        } else if (c != _R_CONFS && prevv == -1){
-            prevv = 1;
+            f->prevv *= -1;
+        } else if (c != _R_CONFS && f->prevv == -1){
+            f->prevv = 1;
         }
 
         /* Max size */
-        if (count >= XML_MAXSIZE) {
-            if (flag_truncate && 1 == location) {
-                ignore_content = true;
+        if (f->count >= XML_MAXSIZE) {
+            if (flag_truncate && 1 == f->location) {
+                f->ignore_content = true;
             } else {
                 xml_error(_lxml, "XMLERR: String overflow.");
                 goto end;
@@ -336,7 +451,7 @@ static int _ReadElem(unsigned int parent, OS_XML *_lxml, unsigned int recursion_
         }
 
         /* Real checking */
-        if ((location == -1) && (prevv == 1)) {
+        if ((f->location == -1) && (f->prevv == 1)) {
             if (c == _R_CONFS) {
                 if ((c = xml_getc_fun(_lxml->fp, _lxml)) == '/') {
                     xml_error(_lxml, "XMLERR: Element not opened.");
@@ -344,27 +459,27 @@ static int _ReadElem(unsigned int parent, OS_XML *_lxml, unsigned int recursion_
                 } else {
                     _xml_ungetc(c, _lxml);
                 }
-                location = 0;
+                f->location = 0;
             } else {
                 continue;
             }
         }
 
-        else if ((location == 0) && ((c == _R_CONFE) || isspace(c))) {
+        else if ((f->location == 0) && ((c == _R_CONFE) || isspace(c))) {
             int _ge = 0;
             int _ga = 0;
-            elem[count] = '\0';
+            f->elem[f->count] = '\0';
 
             /* Remove the / at the end of the element name */
-            if (count > 0 && elem[count - 1] == '/') {
+            if (f->count > 0 && f->elem[f->count - 1] == '/') {
                 _ge = '/';
-                elem[count - 1] = '\0';
+                f->elem[f->count - 1] = '\0';
             }
 
-            if (_writememory(elem, XML_ELEM, count + 1, parent, _lxml) < 0) {
+            if (_writememory(f->elem, XML_ELEM, f->count + 1, parent, _lxml) < 0) {
                 goto end;
             }
-            _currentlycont = _lxml->cur - 1;
+            f->currentlycont = _lxml->cur - 1;
             if (isspace(c)) {
                 if ((_ga = _getattributes(parent, _lxml, flag_truncate)) < 0) {
                     goto end;
@@ -373,95 +488,85 @@ static int _ReadElem(unsigned int parent, OS_XML *_lxml, unsigned int recursion_
 
             /* If the element is closed already (finished in />) */
             if ((_ge == '/') || (_ga == '/')) {
-                if (_writecontent("\0", 2, _currentlycont, _lxml) < 0) {
+                if (_writecontent("\0", 2, f->currentlycont, _lxml) < 0) {
                     goto end;
                 }
-                _lxml->ck[_currentlycont] = 1;
-                _currentlycont = 0;
-                count = 0;
-                location = -1;
-
-                memset(elem, '\0', XML_MAXSIZE);
-                memset(closedelim, '\0', XML_MAXSIZE);
-                memset(cont, '\0', XML_MAXSIZE);
+                _lxml->ck[f->currentlycont] = 1;
+                f->currentlycont = 0;
+                f->count = 0;
+                f->location = -1;
 
+                /* Back to the content of the parent element */
                 if (parent > 0) {
-                    retval = 0;
-                    goto end;
+                    stack[--parent].count = 0;
                 }
             } else {
-                count = 0;
-                location = 1;
+                f->count = 0;
+                f->location = 1;
             }
         }
 
-        else if ((location == 2) && (c == _R_CONFE)) {
-            closedelim[count] = '\0';
-            if (strcmp(closedelim, elem) != 0) {
-                xml_error(_lxml, "XMLERR: Element '%s' not closed.", elem);
+        else if ((f->location == 2) && (c == _R_CONFE)) {
+            f->closedelim[f->count] = '\0';
+            if (strcmp(f->closedelim, f->elem) != 0) {
+                xml_error(_lxml, "XMLERR: Element '%s' not closed.", f->elem);
                 goto end;
             }
-            if (_writecontent(cont, strlen(cont) + 1, _currentlycont, _lxml) < 0) {
+            if (_writecontent(f->cont, strlen(f->cont) + 1, f->currentlycont, _lxml) < 0) {
                 goto end;
             }
-            _lxml->ck[_currentlycont] = 1;
-            memset(elem, '\0', XML_MAXSIZE);
-            memset(closedelim, '\0', XML_MAXSIZE);
-            memset(cont, '\0', XML_MAXSIZE);
-            _currentlycont = 0;
-            count = 0;
-            location = -1;
+            _lxml->ck[f->currentlycont] = 1;
+            f->currentlycont = 0;
+            f->count = 0;
+            f->location = -1;
+
+            /* Back to the content of the parent element */
             if (parent > 0) {
-                retval = 0;
-                goto end;
+                stack[--parent].count = 0;
             }
-        } else if ((location == 1) && (c == _R_CONFS) && (prevv == 1)) {
+        } else if ((f->location == 1) && (c == _R_CONFS) && (f->prevv == 1)) {
             if ((c = xml_getc_fun(_lxml->fp, _lxml)) == '/') {
-                cont[count] = '\0';
-                count = 0;
-                location = 2;
-                ignore_content = false;
+                f->cont[f->count] = '\0';
+                f->count = 0;
+                f->location = 2;
+                f->ignore_content = false;
             } else {
                 _xml_ungetc(c, _lxml);
                 _xml_ungetc(_R_CONFS, _lxml);
 
-                if (_ReadElem(parent + 1, _lxml, recursion_level, flag_truncate) < 0) {
+                /* Read the child element in the next frame */
+                if (_xml_enter(&stack, &frames, parent + 1, _lxml) < 0) {
                     goto end;
                 }
-                count = 0;
+                parent++;
             }
         } else {
-            if (location == 0) {
-                elem[count++] = (char) c;
-            } else if (location == 1 && !ignore_content) {
-                cont[count++] = (char) c;
-            } else if (location == 2) {
-                closedelim[count++] = (char) c;
+            if (f->location == 0) {
+                f->elem[f->count++] = (char) c;
+            } else if (f->location == 1 && !f->ignore_content) {
+                f->cont[f->count++] = (char) c;
+            } else if (f->location == 2) {
+                f->closedelim[f->count++] = (char) c;
             }
 
             if (_R_CONFS == c) {
-                prevv = 1;
+                f->prevv = 1;
             }
         }
     }
-    if (location == -1) {
+    if (parent == 0 && stack[0].location == -1) {
         retval = LEOF;
     }
 
     xml_error(_lxml, "XMLERR: End of file and some elements were not closed.");
 
 end:
-    if (elem) {
-        free(elem);
-    }
-
-    if (cont) {
-        free(cont);
-    }
-
-    if (closedelim) {
-        free(closedelim);
+    for (i = 0; i < frames; i++) {
+        free(stack[i].elem);
+        free(stack[i].cont);
+        free(stack[i].closedelim);
     }
+    free(stack);
 
     return retval;
 }
@@ -474,56 +579,69 @@ static int _writememory(const char *str, XML_TYPE type, size_t size,
     unsigned int *tmp3;
     XML_TYPE *tmp4;
 
-    /* Allocate for the element */
-    tmp = (char **)realloc(_lxml->el, (_lxml->cur + 1) * sizeof(char *));
-    if (tmp == NULL) {
-        goto fail;
+    /* Grow the positions geometrically instead of once per node */
+    if (_lxml->cur == _lxml->size) {
+        unsigned int nodes = _lxml->size ? _lxml->size * 2 : XML_INITIAL_NODES;
+
+        tmp = (char **)realloc(_lxml->el, nodes * sizeof(char *));
+        if (tmp == NULL) {
+            goto fail;
+        }
+        _lxml->el = tmp;
+
+        tmp = (char **)realloc(_lxml->ct, nodes * sizeof(char *));
+        if (tmp == NULL) {
+            goto fail;
+        }
+        _lxml->ct = tmp;
+
+        tmp4 = (XML_TYPE *) realloc(_lxml->tp, nodes * sizeof(XML_TYPE));
+        if (tmp4 == NULL) {
+            goto fail;
+        }
+        _lxml->tp = tmp4;
+
+        tmp3 = (unsigned int *) realloc(_lxml->rl, nodes * sizeof(unsigned int));
+        if (tmp3 == NULL) {
+            goto fail;
+        }
+        _lxml->rl = tmp3;
+
+        tmp2 = (int *) realloc(_lxml->ck, nodes * sizeof(int));
+        if (tmp2 == NULL) {
+            goto fail;
+        }
+        _lxml->ck = tmp2;
+
+        tmp3 = (unsigned int *) realloc(_lxml->ln, nodes * sizeof(unsigned int));
+        if (tmp3 == NULL) {
+            goto fail;
+        }
+        _lxml->ln = tmp3;
+
+        _lxml->size = nodes;
     }
-    _lxml->el = tmp;
+
+    /* Element */
     _lxml->el[_lxml->cur] = (char *)calloc(size, sizeof(char));
     if (_lxml->el[_lxml->cur] == NULL) {
         goto fail;
     }
     strncpy(_lxml->el[_lxml->cur], str, size - 1);
 
-    /* Allocate for the content */
-    tmp = (char **)realloc(_lxml->ct, (_lxml->cur + 1) * sizeof(char *));
-    if (tmp == NULL) {
-        goto fail;
-    }
-    _lxml->ct = tmp;
+    /* Content */
     _lxml->ct[_lxml->cur] = NULL;
 
-    /* Allocate for the type */
-    tmp4 = (XML_TYPE *) realloc(_lxml->tp, (_lxml->cur + 1) * sizeof(XML_TYPE));
-    if (tmp4 == NULL) {
-        goto fail;
-    }
-    _lxml->tp = tmp4;
+    /* Type */
     _lxml->tp[_lxml->cur] = type;
 
-    /* Allocate for the relation */
-    tmp3 = (unsigned int *) realloc(_lxml->rl, (_lxml->cur + 1) * sizeof(unsigned int));
-    if (tmp3 == NULL) {
-        goto fail;
-    }
-    _lxml->rl = tmp3;
+    /* Relation */
     _lxml->rl[_lxml->cur] = parent;
 
-    /* Allocate for the "check" */
-    tmp2 = (int *) realloc(_lxml->ck, (_lxml->cur + 1) * sizeof(int));
-    if (tmp2 == NULL) {
-        goto fail;
-    }
-    _lxml->ck = tmp2;
+    /* "check" */
     _lxml->ck[_lxml->cur] = 0;
 
-    /* Allocate for the line */
-    tmp3 = (unsigned int *) realloc(_lxml->ln, (_lxml->cur + 1) * sizeof(unsigned int));
-    if (tmp3 == NULL) {
-        goto fail;
-    }
-    _lxml->ln = tmp3;
+    /* Line */
     _lxml->ln[_lxml->cur] = _lxml->line;
 
     /* Attributes does not need to be closed */
@@ -27,12 +27,13 @@ typedef struct _xml_node {
 
 #define XML_ERR_LENGTH  128
 #define XML_STASH_LEN   2
-#define xml_getc_fun(x,y) (x)? _xml_fgetc(x,y) : _xml_sgetc(y)
+#define xml_getc_fun(x,y) (x)? _xml_fgetc(y) : _xml_sgetc(y)
 typedef enum _XML_TYPE { XML_ATTR, XML_ELEM, XML_VARIABLE_BEGIN = '$' } XML_TYPE;
 
 /* XML structure */
 typedef struct _OS_XML {
     unsigned int cur;           /* Current position (and last after reading) */
+    unsigned int size;          /* Allocated positions */
     int fol;                    /* Current position for the xml_access */
     XML_TYPE *tp;               /* Item type */
     unsigned int *rl;           /* Relation in the XML */
@@ -47,6 +48,10 @@ typedef struct _OS_XML {
     int stash_i;                /* Stash index */
     FILE *fp;                   /* File descriptor */
     char *string;               /* XML string */
+    char *file;                 /* File content, mapped or read at once */
+    size_t file_size;           /* File content size */
+    size_t file_pos;            /* Next file character */
+    bool file_mapped;           /* Whether the file content is mapped */
 } OS_XML;
 
 typedef xml_node **XML_NODE;
@@ -19,6 +19,8 @@
 
 #define XML_MAXSIZE           20480
 #define XML_VARIABLE_MAXSIZE  256
+#define XML_MAX_DEPTH         1024
+#define XML_INITIAL_NODES     64
 
 #define XML_VAR              "var"
 #define XML_VAR_ATTRIBUTE    "name"
@@ -8,10 +8,21 @@
  * Foundation
  */
 
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "os_zlib.h"
 
 #include "../external/zlib/zlib.h"
 
+struct os_zlib_stream {
+    z_stream strm;
+    int compress;           /* 1 if it is a deflate stream */
+    Bytef *dictionary;      /* Preset dictionary, NULL for none */
+    uInt dictionary_size;
+};
+
 unsigned long int os_zlib_compress(const char *src, char *dst,
                                    unsigned long int src_size,
                                    unsigned long int dst_size)
@@ -42,3 +53,134 @@ unsigned long int os_zlib_uncompress(const char *src, char *dst,
 
     return (0);
 }
+
+os_zlib_stream *os_zlib_stream_init(int compress, const char *dictionary,
+                                    unsigned long int dictionary_size)
+{
+    os_zlib_stream *stream;
+    int ret;
+
+    if (dictionary && dictionary_size > OS_ZLIB_DICTIONARY_MAXSIZE) {
+        return (NULL);
+    }
+
+    stream = (os_zlib_stream *)calloc(1, sizeof(os_zlib_stream));
+    if (!stream) {
+        return (NULL);
+    }
+
+    stream->compress = compress;
+
+    if (dictionary && dictionary_size > 0) {
+        stream->dictionary = (Bytef *)malloc(dictionary_size);
+        if (!stream->dictionary) {
+            free(stream);
+            return (NULL);
+        }
+        memcpy(stream->dictionary, dictionary, dictionary_size);
+        stream->dictionary_size = (uInt)dictionary_size;
+    }
+
+    if (compress) {
+        ret = deflateInit(&stream->strm, Z_BEST_COMPRESSION);
+    } else {
+        ret = inflateInit(&stream->strm);
+    }
+
+    if (ret != Z_OK) {
+        free(stream->dictionary);
+        free(stream);
+        return (NULL);
+    }
+
+    return (stream);
+}
+
+unsigned long int os_zlib_stream_compress(os_zlib_stream *stream,
+                                          const char *src, char *dst,
+                                          unsigned long int src_size,
+                                          unsigned long int dst_size)
+{
+    if (!stream || !stream->compress || !src || !dst || dst_size == 0 ||
+        src_size > UINT_MAX || dst_size - 1 > UINT_MAX) {
+        return (0);
+    }
+
+    if (deflateReset(&stream->strm) != Z_OK) {
+        return (0);
+    }
+
+    /* The dictionary is set again for each message, the reset drops it */
+    if (stream->dictionary &&
+        deflateSetDictionary(&stream->strm, stream->dictionary, stream->dictionary_size) != Z_OK) {
+        return (0);
+    }
+
+    stream->strm.next_in = (Bytef *)src;
+    stream->strm.avail_in = (uInt)src_size;
+    stream->strm.next_out = (Bytef *)dst;
+    stream->strm.avail_out = (uInt)(dst_size - 1);
+
+    if (deflate(&stream->strm, Z_FINISH) != Z_STREAM_END) {
+        return (0);
+    }
+
+    dst[stream->strm.total_out] = '\0';
+    return (stream->strm.total_out);
+}
+
+unsigned long int os_zlib_stream_uncompress(os_zlib_stream *stream,
+                                            const char *src, char *dst,
+                                            unsigned long int src_size,
+                                            unsigned long int dst_size)
+{
+    int ret;
+
+    if (!stream || stream->compress || !src || !dst || src_size == 0 || dst_size == 0 ||
+        src_size > UINT_MAX || dst_size - 1 > UINT_MAX) {
+        return (0);
+    }
+
+    if (inflateReset(&stream->strm) != Z_OK) {
+        return (0);
+    }
+
+    stream->strm.next_in = (Bytef *)src;
+    stream->strm.avail_in = (uInt)src_size;
+    stream->strm.next_out = (Bytef *)dst;
+    stream->strm.avail_out = (uInt)(dst_size - 1);
+
+    ret = inflate(&stream->strm, Z_FINISH);
+
+    /* The message says which dictionary it needs, zlib checks it is ours */
+    if (ret == Z_NEED_DICT) {
+        if (!stream->dictionary ||
+            inflateSetDictionary(&stream->strm, stream->dictionary, stream->dictionary_size) != Z_OK) {
+            return (0);
+        }
+        ret = inflate(&stream->strm, Z_FINISH);
+    }
+
+    if (ret != Z_STREAM_END) {
+        return (0);
+    }
+
+    dst[stream->strm.total_out] = '\0';
+    return (stream->strm.total_out);
+}
+
+void os_zlib_stream_free(os_zlib_stream *stream)
+{
+    if (!stream) {
+        return;
+    }
+
+    if (stream->compress) {
+        deflateEnd(&stream->strm);
+    } else {
+        inflateEnd(&stream->strm);
+    }
+
+    free(stream->dictionary);
+    free(stream);
+}
@@ -35,4 +35,58 @@ unsigned long int os_zlib_uncompress(const char *src, char *dst,
                                      unsigned long int src_size,
                                      unsigned long int dst_size);
 
+/* Maximum size of a preset dictionary, the size of the zlib window */
+#define OS_ZLIB_DICTIONARY_MAXSIZE 32768
+
+/* Persistent zlib stream.
+ * The stream is allocated once and reset for each message, which
+ * avoids setting up zlib per message. The messages are still
+ * compressed independently, so they can be lost or reordered.
+ * A stream must not be used by several threads at once.
+ */
+typedef struct os_zlib_stream os_zlib_stream;
+
+/* Create a stream
+ * compress: 1 to compress messages, 0 to uncompress them
+ * dictionary: preset dictionary, the strings most messages contain,
+ *             NULL for none. A message compressed with a dictionary
+ *             can only be uncompressed by a stream with the same one
+ * dictionary_size: the length of the dictionary
+ * Returns NULL on failure, else the stream
+ */
+os_zlib_stream *os_zlib_stream_init(int compress, const char *dictionary,
+                                    unsigned long int dictionary_size);
+
+/* Compress a string with a stream
+ * stream: a stream created to compress
+ * src: the source string to compress
+ * dst: the destination buffer for the compressed string, will be
+ *      null-terminated on success
+ * src_size: the length of the source string
+ * dst_size: the size of the destination buffer, including the terminator
+ * Returns 0 on failure, else the length of the compressed string
+ */
+unsigned long int os_zlib_stream_compress(os_zlib_stream *stream,
+                                          const char *src, char *dst,
+                                          unsigned long int src_size,
+                                          unsigned long int dst_size);
+
+/* Uncompress a string with a stream
+ * stream: a stream created to uncompress. It also uncompresses the
+ *         strings compressed without a dictionary
+ * src: the source string to uncompress
+ * dst: the destination buffer for the uncompressed string, will be
+ *      null-terminated on success
+ * src_size: the length of the source string
+ * dst_size: the size of the destination buffer, including the terminator
+ * Returns 0 on failure, else the length of the uncompressed string
+ */
+unsigned long int os_zlib_stream_uncompress(os_zlib_stream *stream,
+                                            const char *src, char *dst,
+                                            unsigned long int src_size,
+                                            unsigned long int dst_size);
+
+/* Release a stream */
+void os_zlib_stream_free(os_zlib_stream *stream);
+
 #endif /* OS_ZLIB_H */
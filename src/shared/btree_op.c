@@ -0,0 +1,497 @@
+/**
+ * @file btree_op.c
+ * @brief B-tree data structure definition
+ *
+ * @copyright Copyright (C) 2015 Wazuh, Inc.
+ */
+
+/*
+ * This program is a free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "shared.h"
+
+/// What bnode_remove takes out of a subtree
+typedef enum b_target { B_KEY, B_MIN, B_MAX } b_target;
+
+// Create a node. Leaves are allocated without the children array.
+
+static b_node * bnode_new(int leaf) {
+    b_node * node;
+
+    if (leaf) {
+        os_malloc(offsetof(b_node, children), node);
+    } else {
+        os_malloc(sizeof(b_node), node);
+    }
+
+    node->count = 0;
+    node->leaf = leaf;
+    return node;
+}
+
+// Free a subtree, disposing its elements
+
+static void bnode_destroy(b_node * node, void (*dispose)(void *)) {
+    unsigned i;
+
+    for (i = 0; i < node->count; i++) {
+        if (!node->leaf) {
+            bnode_destroy(node->children[i], dispose);
+        }
+
+        if (dispose != NULL) {
+            dispose(node->values[i]);
+        }
+
+        free(node->keys[i]);
+    }
+
+    if (!node->leaf) {
+        bnode_destroy(node->children[node->count], dispose);
+    }
+
+    free(node);
+}
+
+// Find the position of the first key not less than key
+
+static unsigned bnode_search(const b_node * node, const char * key, int * found) {
+    unsigned low = 0;
+    unsigned high = node->count;
+
+    *found = 0;
+
+    while (low < high) {
+        unsigned mid = (low + high) / 2;
+        int cmp = strcmp(key, node->keys[mid]);
+
+        if (cmp == 0) {
+            *found = 1;
+            return mid;
+        } else if (cmp < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+
+    return low;
+}
+
+// Split the full child i of node into two nodes, moving its median key up
+
+static void bnode_split(b_node * node, unsigned i) {
+    b_node * left = node->children[i];
+    b_node * right = bnode_new(left->leaf);
+
+    right->count = B_DEGREE - 1;
+    memcpy(right->keys, left->keys + B_DEGREE, (B_DEGREE - 1) * sizeof(char *));
+    memcpy(right->values, left->values + B_DEGREE, (B_DEGREE - 1) * sizeof(void *));
+
+    if (!left->leaf) {
+        memcpy(right->children, left->children + B_DEGREE, B_DEGREE * sizeof(b_node *));
+    }
+
+    left->count = B_DEGREE - 1;
+
+    memmove(node->keys + i + 1, node->keys + i, (node->count - i) * sizeof(char *));
+    memmove(node->values + i + 1, node->values + i, (node->count - i) * sizeof(void *));
+    memmove(node->children + i + 2, node->children + i + 1, (node->count - i) * sizeof(b_node *));
+
+    node->keys[i] = left->keys[B_DEGREE - 1];
+    node->values[i] = left->values[B_DEGREE - 1];
+    node->children[i + 1] = right;
+    node->count++;
+}
+
+// Merge the child i + 1 of node and the key i into the child i
+
+static void bnode_merge(b_node * node, unsigned i) {
+    b_node * left = node->children[i];
+    b_node * right = node->children[i + 1];
+
+    left->keys[left->count] = node->keys[i];
+    left->values[left->count] = node->values[i];
+    memcpy(left->keys + left->count + 1, right->keys, right->count * sizeof(char *));
+    memcpy(left->values + left->count + 1, right->values, right->count * sizeof(void *));
+
+    if (!left->leaf) {
+        memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(b_node *));
+    }
+
+    left->count += right->count + 1;
+
+    memmove(node->keys + i, node->keys + i + 1, (node->count - i - 1) * sizeof(char *));
+    memmove(node->values + i, node->values + i + 1, (node->count - i - 1) * sizeof(void *));
+    memmove(node->children + i + 1, node->children + i + 2, (node->count - i - 1) * sizeof(b_node *));
+    node->count--;
+
+    free(right);
+}
+
+// Move the last key of the child i - 1 through node into the child i
+
+static void bnode_rotate_right(b_node * node, unsigned i) {
+    b_node * left = node->children[i - 1];
+    b_node * child = node->children[i];
+
+    memmove(child->keys + 1, child->keys, child->count * sizeof(char *));
+    memmove(child->values + 1, child->values, child->count * sizeof(void *));
+
+    if (!child->leaf) {
+        memmove(child->children + 1, child->children, (child->count + 1) * sizeof(b_node *));
+        child->children[0] = left->children[left->count];
+    }
+
+    child->keys[0] = node->keys[i - 1];
+    child->values[0] = node->values[i - 1];
+    child->count++;
+
+    node->keys[i - 1] = left->keys[left->count - 1];
+    node->values[i - 1] = left->values[left->count - 1];
+    left->count--;
+}
+
+// Move the first key of the child i + 1 through node into the child i
+
+static void bnode_rotate_left(b_node * node, unsigned i) {
+    b_node * child = node->children[i];
+    b_node * right = node->children[i + 1];
+
+    child->keys[child->count] = node->keys[i];
+    child->values[child->count] = node->values[i];
+
+    if (!child->leaf) {
+        child->children[child->count + 1] = right->children[0];
+        memmove(right->children, right->children + 1, right->count * sizeof(b_node *));
+    }
+
+    child->count++;
+
+    node->keys[i] = right->keys[0];
+    node->values[i] = right->values[0];
+    memmove(right->keys, right->keys + 1, (right->count - 1) * sizeof(char *));
+    memmove(right->values, right->values + 1, (right->count - 1) * sizeof(void *));
+    right->count--;
+}
+
+/**
+ * @brief Take an element out of a subtree
+ *
+ * Every child is refilled to at least B_DEGREE keys before descending into
+ * it, so the removal never leaves a node under the minimum.
+ *
+ * @param node Subtree root, with at least B_DEGREE keys unless it is the root.
+ * @param key Key to remove, for B_KEY.
+ * @param target Whether to remove key, the minimum or the maximum.
+ * @param rkey Removed key.
+ * @param rvalue Removed value.
+ * @retval 1 An element was removed.
+ * @retval 0 Key not in the subtree.
+ */
+
+static int bnode_remove(b_node * node, const char * key, b_target target, char ** rkey, void ** rvalue) {
+    while (1) {
+        unsigned i;
+        int found;
+
+        switch (target) {
+        case B_MIN:
+            i = 0;
+            found = node->leaf;
+            break;
+        case B_MAX:
+            i = node->leaf ? node->count - 1 : node->count;
+            found = node->leaf;
+            break;
+        default:
+            i = bnode_search(node, key, &found);
+        }
+
+        if (found) {
+            *rkey = node->keys[i];
+            *rvalue = node->values[i];
+
+            if (node->leaf) {
+                memmove(node->keys + i, node->keys + i + 1, (node->count - i - 1) * sizeof(char *));
+                memmove(node->values + i, node->values + i + 1, (node->count - i - 1) * sizeof(void *));
+                node->count--;
+                return 1;
+            }
+
+            // Replace the key with its predecessor or successor, or merge both children around it
+
+            if (node->children[i]->count >= B_DEGREE) {
+                return bnode_remove(node->children[i], NULL, B_MAX, &node->keys[i], &node->values[i]);
+            }
+
+            if (node->children[i + 1]->count >= B_DEGREE) {
+                return bnode_remove(node->children[i + 1], NULL, B_MIN, &node->keys[i], &node->values[i]);
+            }
+
+            bnode_merge(node, i);
+            node = node->children[i];
+            continue;
+        }
+
+        if (node->leaf) {
+            return 0;
+        }
+
+        if (node->children[i]->count < B_DEGREE) {
+            if (i > 0 && node->children[i - 1]->count >= B_DEGREE) {
+                bnode_rotate_right(node, i);
+            } else if (i < node->count && node->children[i + 1]->count >= B_DEGREE) {
+                bnode_rotate_left(node, i);
+            } else if (i < node->count) {
+                bnode_merge(node, i);
+            } else {
+                bnode_merge(node, --i);
+            }
+        }
+
+        node = node->children[i];
+    }
+}
+
+// Append a copy of every key of the subtree within [min, max]
+
+static void bnode_range(const b_node * node, const char * min, const char * max, char ** array, unsigned * n) {
+    unsigned i = 0;
+    int found;
+
+    if (min != NULL) {
+        i = bnode_search(node, min, &found);
+    }
+
+    for (; ; i++) {
+        if (!node->leaf) {
+            bnode_range(node->children[i], min, max, array, n);
+        }
+
+        if (i == node->count || (max != NULL && strcmp(node->keys[i], max) > 0)) {
+            break;
+        }
+
+        os_strdup(node->keys[i], array[(*n)++]);
+    }
+}
+
+b_tree * btree_init() {
+    b_tree * tree;
+    os_calloc(1, sizeof(b_tree), tree);
+    return tree;
+}
+
+void btree_destroy(b_tree * tree) {
+    if (tree != NULL) {
+        if (tree->root != NULL) {
+            bnode_destroy(tree->root, tree->dispose);
+        }
+
+        free(tree);
+    }
+}
+
+void btree_set_dispose(b_tree * tree, void (*dispose)(void *)) {
+    assert(tree != NULL);
+    tree->dispose = dispose;
+}
+
+int btree_insert(b_tree * tree, const char * key, void * value) {
+    b_node * node;
+    unsigned i;
+    int found;
+
+    assert(tree != NULL);
+    assert(key != NULL);
+
+    if (tree->root == NULL) {
+        tree->root = bnode_new(1);
+    } else if (tree->root->count == B_MAX_KEYS) {
+        node = bnode_new(0);
+        node->children[0] = tree->root;
+        tree->root = node;
+        bnode_split(node, 0);
+    }
+
+    // Split full nodes on the way down, so that the leaf has room for the key
+
+    for (node = tree->root; ; node = node->children[i]) {
+        i = bnode_search(node, key, &found);
+
+        if (found) {
+            return 0;
+        }
+
+        if (node->leaf) {
+            break;
+        }
+
+        if (node->children[i]->count == B_MAX_KEYS) {
+            int cmp;
+
+            bnode_split(node, i);
+            cmp = strcmp(key, node->keys[i]);
+
+            if (cmp == 0) {
+                return 0;
+            } else if (cmp > 0) {
+                i++;
+            }
+        }
+    }
+
+    memmove(node->keys + i + 1, node->keys + i, (node->count - i) * sizeof(char *));
+    memmove(node->values + i + 1, node->values + i, (node->count - i) * sizeof(void *));
+    os_strdup(key, node->keys[i]);
+    node->values[i] = value;
+    node->count++;
+    tree->size++;
+
+    return 1;
+}
+
+void * btree_replace(b_tree * tree, const char * key, void * value) {
+    b_node * node;
+    unsigned i;
+    int found;
+
+    assert(tree != NULL);
+    assert(key != NULL);
+
+    for (node = tree->root; node != NULL; node = node->leaf ? NULL : node->children[i]) {
+        i = bnode_search(node, key, &found);
+
+        if (found) {
+            if (tree->dispose != NULL) {
+                tree->dispose(node->values[i]);
+            }
+
+            node->values[i] = value;
+            return value;
+        }
+    }
+
+    return NULL;
+}
+
+void * btree_get(const b_tree * tree, const char * key) {
+    const b_node * node;
+    unsigned i;
+    int found;
+
+    assert(tree != NULL);
+    assert(key != NULL);
+
+    for (node = tree->root; node != NULL; node = node->leaf ? NULL : node->children[i]) {
+        i = bnode_search(node, key, &found);
+
+        if (found) {
+            return node->values[i];
+        }
+    }
+
+    return NULL;
+}
+
+int btree_delete(b_tree * tree, const char * key) {
+    b_node * root;
+    char * rkey;
+    void * rvalue;
+    int removed;
+
+    assert(tree != NULL);
+    assert(key != NULL);
+
+    root = tree->root;
+
+    if (root == NULL) {
+        return 0;
+    }
+
+    removed = bnode_remove(root, key, B_KEY, &rkey, &rvalue);
+
+    // A merge may have emptied the root
+
+    if (root->count == 0) {
+        tree->root = root->leaf ? NULL : root->children[0];
+        free(root);
+    }
+
+    if (removed) {
+        if (tree->dispose != NULL) {
+            tree->dispose(rvalue);
+        }
+
+        free(rkey);
+        tree->size--;
+    }
+
+    return removed;
+}
+
+const char * btree_minimum(const b_tree * tree) {
+    const b_node * node;
+
+    assert(tree != NULL);
+
+    if (tree->root == NULL) {
+        return NULL;
+    }
+
+    for (node = tree->root; !node->leaf; node = node->children[0]);
+    return node->keys[0];
+}
+
+const char * btree_maximum(const b_tree * tree) {
+    const b_node * node;
+
+    assert(tree != NULL);
+
+    if (tree->root == NULL) {
+        return NULL;
+    }
+
+    for (node = tree->root; !node->leaf; node = node->children[node->count]);
+    return node->keys[node->count - 1];
+}
+
+char ** btree_keys(const b_tree * tree) {
+    return btree_range(tree, NULL, NULL);
+}
+
+char ** btree_range(const b_tree * tree, const char * min, const char * max) {
+    char ** array;
+    unsigned n = 0;
+
+    assert(tree != NULL);
+
+    os_malloc((tree->size + 1) * sizeof(char *), array);
+
+    if (tree->root != NULL) {
+        bnode_range(tree->root, min, max, array, &n);
+    }
+
+    array[n] = NULL;
+
+    if (n < tree->size) {
+        os_realloc(array, (n + 1) * sizeof(char *), array);
+    }
+
+    return array;
+}
+
+unsigned btree_size(const b_tree * tree) {
+    assert(tree != NULL);
+    return tree->size;
+}
+
+int btree_empty(const b_tree * tree) {
+    assert(tree != NULL);
+    return tree->root == NULL;
+}
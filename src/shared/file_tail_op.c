@@ -0,0 +1,377 @@
+/*
+ * File tail reader
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "shared.h"
+
+#ifdef INOTIFY_ENABLED
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+#ifdef O_CLOEXEC
+#define FTAIL_OPEN_FLAGS (O_RDONLY | O_CLOEXEC)
+#else
+#define FTAIL_OPEN_FLAGS O_RDONLY
+#endif
+
+/* Forget the data read from the previous file or position */
+static void ftail_reset(w_ftail_t * ftail) {
+    ftail->offset = 0;
+    ftail->begin = 0;
+    ftail->end = 0;
+    ftail->scanned = 0;
+    ftail->examined = 0;
+    ftail->discard = 0;
+}
+
+/* Open the file at the path, replacing the current one */
+static int ftail_reopen(w_ftail_t * ftail) {
+    struct stat st;
+    int fd;
+
+    fd = open(ftail->path, FTAIL_OPEN_FLAGS);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    if (ftail->fd >= 0) {
+        close(ftail->fd);
+    }
+
+    ftail->fd = fd;
+    ftail->dev = st.st_dev;
+    ftail->inode = st.st_ino;
+    ftail_reset(ftail);
+
+#ifdef INOTIFY_ENABLED
+    if (ftail->inotify_fd >= 0) {
+        if (ftail->watch >= 0) {
+            // The watch is already gone if the file was deleted
+            inotify_rm_watch(ftail->inotify_fd, ftail->watch);
+        }
+
+        ftail->watch = inotify_add_watch(ftail->inotify_fd, ftail->path, IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+    }
+#endif
+
+    return 0;
+}
+
+/**
+ * @brief Check the file at the end of the data
+ *
+ * @param ftail the reader
+ * @return 1 if the file was rotated or truncated and it is to be read again, 0 otherwise
+ * */
+static int ftail_rotated(w_ftail_t * ftail) {
+    struct stat st;
+
+    if (stat(ftail->path, &st) == 0 && (st.st_dev != ftail->dev || st.st_ino != ftail->inode)) {
+        return ftail_reopen(ftail) == 0;
+    }
+
+    if (fstat(ftail->fd, &st) == 0 && st.st_size < ftail->offset) {
+        if (lseek(ftail->fd, 0, SEEK_SET) < 0) {
+            return 0;
+        }
+
+        ftail_reset(ftail);
+        return 1;
+    }
+
+    return 0;
+}
+
+/* Read one block after the incomplete line */
+static void ftail_fill(w_ftail_t * ftail) {
+    ssize_t n;
+
+    // Move the incomplete line to the start of the buffer
+    if (ftail->begin > 0) {
+        memmove(ftail->buffer, ftail->buffer + ftail->begin, ftail->end - ftail->begin);
+        ftail->end -= ftail->begin;
+        ftail->scanned -= ftail->begin;
+        ftail->examined -= ftail->begin;
+        ftail->begin = 0;
+    }
+
+    if (ftail->end == ftail->size) {
+        if (ftail->size < ftail->max_size) {
+            ftail->size = ftail->size * 2 < ftail->max_size ? ftail->size * 2 : ftail->max_size;
+            os_realloc(ftail->buffer, ftail->size, ftail->buffer);
+        } else {
+            // The line does not fit, drop it up to its end
+            if (!ftail->discard) {
+                ftail->discarded++;
+                ftail->discard = 1;
+            }
+            ftail->end = 0;
+            ftail->scanned = 0;
+            ftail->examined = 0;
+        }
+    }
+
+    n = read(ftail->fd, ftail->buffer + ftail->end, ftail->size - ftail->end);
+
+    if (n == 0 && ftail_rotated(ftail)) {
+        n = read(ftail->fd, ftail->buffer + ftail->end, ftail->size - ftail->end);
+    }
+
+    if (n > 0) {
+        ftail->end += (size_t)n;
+        ftail->offset += n;
+    }
+}
+
+/* Find the end of the first complete line, skipping the rest of a discarded line */
+static char * ftail_newline(w_ftail_t * ftail) {
+    char * newline;
+
+    while ((newline = memchr(ftail->buffer + ftail->scanned, '\n', ftail->end - ftail->scanned)) != NULL) {
+        if (!ftail->discard) {
+            return newline;
+        }
+
+        ftail->begin = ftail->examined = ftail->scanned = (size_t)(newline - ftail->buffer) + 1;
+        ftail->discard = 0;
+    }
+
+    ftail->scanned = ftail->end;
+
+    if (ftail->discard) {
+        ftail->begin = ftail->examined = ftail->end;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Assemble the complete lines after the pending record into records
+ *
+ * The pending record spans from begin to examined. Each line is matched in
+ * place, replacing its newline for a moment.
+ *
+ * @param ftail the reader
+ * @param match line matcher
+ * @param data argument for the matcher
+ * @param mode whether a matching line starts or ends a record
+ * @param max maximum number of records
+ * @param ends ends of the records in the buffer, grown as needed
+ * @param count number of records in ends
+ * */
+static void ftail_records(w_ftail_t * ftail, w_ftail_match_t match, void * data, w_ftail_record_t mode, size_t max, size_t ** ends, size_t * count) {
+    char * newline;
+
+    while (*count < max && (newline = ftail_newline(ftail)) != NULL) {
+        size_t line = ftail->examined;
+        size_t next = (size_t)(newline - ftail->buffer) + 1;
+        size_t end = 0;
+        int matched;
+
+        *newline = '\0';
+        matched = match(ftail->buffer + line, data);
+        *newline = '\n';
+
+        if (matched) {
+            if (mode == FTAIL_RECORD_START) {
+                end = line > ftail->begin ? line : 0;
+            } else {
+                end = next;
+            }
+        }
+
+        ftail->scanned = ftail->examined = next;
+
+        if (end > 0) {
+            if ((*count & (*count - 1)) == 0) {
+                os_realloc(*ends, (*count ? *count * 2 : 1) * sizeof(size_t), *ends);
+            }
+
+            (*ends)[(*count)++] = end;
+            ftail->begin = end;
+        }
+    }
+}
+
+w_ftail_t * ftail_open(const char * path, int tail, size_t max_line) {
+    w_ftail_t * ftail;
+
+    os_calloc(1, sizeof(w_ftail_t), ftail);
+    os_strdup(path, ftail->path);
+    ftail->fd = -1;
+    ftail->inotify_fd = -1;
+    ftail->watch = -1;
+    ftail->size = FTAIL_READ_SIZE;
+    ftail->max_size = max_line + 1 > FTAIL_READ_SIZE ? max_line + 1 : FTAIL_READ_SIZE;
+    os_malloc(ftail->size, ftail->buffer);
+
+#ifdef INOTIFY_ENABLED
+    ftail->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+
+    if (ftail_reopen(ftail) < 0) {
+        ftail_close(ftail);
+        return NULL;
+    }
+
+    if (tail) {
+        off_t offset = lseek(ftail->fd, 0, SEEK_END);
+        ftail->offset = offset > 0 ? offset : 0;
+    }
+
+    return ftail;
+}
+
+void ftail_close(w_ftail_t * ftail) {
+    if (ftail) {
+        if (ftail->fd >= 0) {
+            close(ftail->fd);
+        }
+
+        if (ftail->inotify_fd >= 0) {
+            close(ftail->inotify_fd);
+        }
+
+        os_free(ftail->buffer);
+        os_free(ftail->path);
+        os_free(ftail);
+    }
+}
+
+w_ftail_batch_t * ftail_read(w_ftail_t * ftail, size_t max) {
+    w_ftail_batch_t * batch;
+    char * newline;
+    char * line;
+    size_t length;
+    size_t i;
+
+    if (max == 0) {
+        return NULL;
+    }
+
+    newline = ftail_newline(ftail);
+    if (newline == NULL) {
+        ftail_fill(ftail);
+
+        newline = ftail_newline(ftail);
+        if (newline == NULL) {
+            return NULL;
+        }
+    }
+
+    // Take the complete lines, up to max
+    os_calloc(1, sizeof(w_ftail_batch_t), batch);
+
+    do {
+        batch->count++;
+        ftail->scanned = (size_t)(newline - ftail->buffer) + 1;
+    } while (batch->count < max && (newline = memchr(ftail->buffer + ftail->scanned, '\n', ftail->end - ftail->scanned)) != NULL);
+
+    length = ftail->scanned - ftail->begin;
+    os_malloc(length, batch->data);
+    os_malloc(batch->count * sizeof(char *), batch->lines);
+    memcpy(batch->data, ftail->buffer + ftail->begin, length);
+    ftail->begin = ftail->examined = ftail->scanned;
+
+    for (i = 0, line = batch->data; i < batch->count; i++) {
+        newline = memchr(line, '\n', length - (size_t)(line - batch->data));
+        *newline = '\0';
+        batch->lines[i] = line;
+        line = newline + 1;
+    }
+
+    return batch;
+}
+
+w_ftail_batch_t * ftail_read_multiline(w_ftail_t * ftail, w_ftail_match_t match, void * data, w_ftail_record_t mode, size_t max, int flush) {
+    w_ftail_batch_t * batch;
+    size_t * ends = NULL;
+    size_t count = 0;
+    size_t start;
+    size_t i;
+    int full;
+
+    if (max == 0) {
+        return NULL;
+    }
+
+    start = ftail->begin;
+    ftail_records(ftail, match, data, mode, max, &ends, &count);
+
+    if (count == 0) {
+        // A pending record that fills the buffer can not grow anymore
+        full = ftail->end - ftail->begin == ftail->max_size && ftail->examined > ftail->begin;
+
+        if (!full) {
+            ftail_fill(ftail);
+            start = ftail->begin;
+            ftail_records(ftail, match, data, mode, max, &ends, &count);
+        }
+
+        if (count == 0) {
+            if (!(flush || full) || ftail->examined == ftail->begin) {
+                return NULL;
+            }
+
+            // Deliver the pending record as it is
+            os_malloc(sizeof(size_t), ends);
+            ends[count++] = ftail->examined;
+            ftail->begin = ftail->examined;
+        }
+    }
+
+    // Copy the records once, each one ends with the newline of its last line
+    os_calloc(1, sizeof(w_ftail_batch_t), batch);
+    os_malloc(ends[count - 1] - start, batch->data);
+    os_malloc(count * sizeof(char *), batch->lines);
+    memcpy(batch->data, ftail->buffer + start, ends[count - 1] - start);
+    batch->count = count;
+
+    for (i = 0; i < count; i++) {
+        batch->lines[i] = batch->data + (i > 0 ? ends[i - 1] - start : 0);
+        batch->data[ends[i] - start - 1] = '\0';
+    }
+
+    os_free(ends);
+    return batch;
+}
+
+int ftail_wait(w_ftail_t * ftail, int timeout) {
+#ifdef INOTIFY_ENABLED
+    if (ftail->inotify_fd >= 0 && ftail->watch >= 0) {
+        struct pollfd pfd = { .fd = ftail->inotify_fd, .events = POLLIN };
+        char events[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+        if (poll(&pfd, 1, timeout) > 0) {
+            // The events are only a hint, the next read finds out what changed
+            while (read(ftail->inotify_fd, events, sizeof(events)) > 0);
+            return 1;
+        }
+
+        return 0;
+    }
+#endif
+
+    w_time_delay((unsigned long int)timeout);
+    return 0;
+}
+
+void ftail_batch_free(w_ftail_batch_t * batch) {
+    if (batch) {
+        os_free(batch->data);
+        os_free(batch->lines);
+        os_free(batch);
+    }
+}
@@ -0,0 +1,249 @@
+/*
+ * Lock-free ring (abstract data type)
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "shared.h"
+
+/* Ready offset of a cell sequence for each side */
+#define RING_PUSH 0
+#define RING_POP  1
+
+/**
+ * @brief Reserve up to n consecutive positions of one side of the ring
+ *
+ * A cell is ready for the position pos of the producers when its sequence
+ * is pos, and for the position pos of the consumers when it is pos + 1.
+ *
+ * @param ring the ring
+ * @param position head or tail
+ * @param ready RING_PUSH or RING_POP
+ * @param n maximum number of positions
+ * @param start first reserved position
+ * @return number of reserved positions, 0 if the ring is full or empty
+ * */
+static size_t ring_reserve(w_ring_t * ring, size_t * position, size_t ready, size_t n, size_t * start) {
+    size_t pos = __atomic_load_n(position, __ATOMIC_RELAXED);
+
+    while (n > 0) {
+        size_t count = 0;
+
+        while (count < n) {
+            const w_ring_cell_t * cell = &ring->cells[(pos + count) & ring->mask];
+            if (__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) != pos + count + ready) {
+                break;
+            }
+            count++;
+        }
+
+        if (count == 0) {
+            const w_ring_cell_t * cell = &ring->cells[pos & ring->mask];
+            long diff = (long)(__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) - (pos + ready));
+
+            // The cell is a lap behind: the ring is full or empty
+            if (diff < 0) {
+                return 0;
+            }
+
+            // Another thread took the position
+            pos = __atomic_load_n(position, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        if (__atomic_compare_exchange_n(position, &pos, pos + count, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            *start = pos;
+            return count;
+        }
+    }
+
+    return 0;
+}
+
+/* Wake the threads sleeping on the other side, if there is any */
+static void ring_wake(w_ring_t * ring, unsigned int * waiting, pthread_cond_t * cond) {
+    // Pairs with the fence of the sleeping thread, either it sees the cells or we see it waiting
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(waiting, __ATOMIC_RELAXED) > 0) {
+        w_mutex_lock(&ring->mutex);
+        w_cond_broadcast(cond);
+        w_mutex_unlock(&ring->mutex);
+    }
+}
+
+w_ring_t * ring_init(size_t n) {
+    w_ring_t * ring;
+    size_t size = 2;
+    size_t i;
+
+    while (size < n) {
+        size <<= 1;
+    }
+
+    os_calloc(1, sizeof(w_ring_t), ring);
+    os_calloc(size, sizeof(w_ring_cell_t), ring->cells);
+
+    for (i = 0; i < size; i++) {
+        ring->cells[i].sequence = i;
+    }
+
+    ring->mask = size - 1;
+    w_mutex_init(&ring->mutex, NULL);
+    w_cond_init(&ring->available, NULL);
+    w_cond_init(&ring->available_not_full, NULL);
+
+    return ring;
+}
+
+void ring_free(w_ring_t * ring) {
+    if (ring) {
+        os_free(ring->cells);
+        w_mutex_destroy(&ring->mutex);
+        w_cond_destroy(&ring->available);
+        w_cond_destroy(&ring->available_not_full);
+        os_free(ring);
+    }
+}
+
+int ring_empty(const w_ring_t * ring) {
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    return __atomic_load_n(&ring->cells[tail & ring->mask].sequence, __ATOMIC_ACQUIRE) != tail + RING_POP;
+}
+
+/* Move elements into the ring without waking the consumers */
+static size_t ring_push_cells(w_ring_t * ring, void ** data, size_t n) {
+    size_t start = 0;
+    size_t count = ring_reserve(ring, &ring->head, RING_PUSH, n, &start);
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        w_ring_cell_t * cell = &ring->cells[(start + i) & ring->mask];
+        cell->data = data[i];
+        __atomic_store_n(&cell->sequence, start + i + 1, __ATOMIC_RELEASE);
+    }
+
+    return count;
+}
+
+/* Move elements out of the ring without waking the producers */
+static size_t ring_pop_cells(w_ring_t * ring, void ** data, size_t n) {
+    size_t start = 0;
+    size_t count = ring_reserve(ring, &ring->tail, RING_POP, n, &start);
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        w_ring_cell_t * cell = &ring->cells[(start + i) & ring->mask];
+        data[i] = cell->data;
+        __atomic_store_n(&cell->sequence, start + i + ring->mask + 1, __ATOMIC_RELEASE);
+    }
+
+    return count;
+}
+
+size_t ring_push_batch(w_ring_t * ring, void ** data, size_t n) {
+    size_t count = ring_push_cells(ring, data, n);
+
+    if (count > 0) {
+        ring_wake(ring, &ring->waiting_pop, &ring->available);
+    }
+
+    return count;
+}
+
+int ring_push(w_ring_t * ring, void * data) {
+    return ring_push_batch(ring, &data, 1) == 1 ? 0 : -1;
+}
+
+int ring_push_ex_block(w_ring_t * ring, void * data) {
+    while (ring_push(ring, data) < 0) {
+        size_t pushed;
+
+        w_mutex_lock(&ring->mutex);
+        __atomic_add_fetch(&ring->waiting_push, 1, __ATOMIC_SEQ_CST);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        // A consumer may have freed a cell before seeing us waiting
+        pushed = ring_push_cells(ring, &data, 1);
+        if (pushed == 0) {
+            w_cond_wait(&ring->available_not_full, &ring->mutex);
+        }
+
+        __atomic_sub_fetch(&ring->waiting_push, 1, __ATOMIC_SEQ_CST);
+        w_mutex_unlock(&ring->mutex);
+
+        if (pushed) {
+            ring_wake(ring, &ring->waiting_pop, &ring->available);
+            break;
+        }
+    }
+
+    return 0;
+}
+
+size_t ring_pop_batch(w_ring_t * ring, void ** data, size_t n) {
+    size_t count = ring_pop_cells(ring, data, n);
+
+    if (count > 0) {
+        ring_wake(ring, &ring->waiting_push, &ring->available_not_full);
+    }
+
+    return count;
+}
+
+void * ring_pop(w_ring_t * ring) {
+    void * data = NULL;
+    ring_pop_batch(ring, &data, 1);
+    return data;
+}
+
+/* Pop an element, sleeping while the ring is empty. abstime may be NULL to wait forever. */
+static void * ring_pop_wait(w_ring_t * ring, const struct timespec * abstime) {
+    void * data = NULL;
+
+    while (ring_pop_batch(ring, &data, 1) == 0) {
+        size_t popped;
+        int timeout = 0;
+
+        w_mutex_lock(&ring->mutex);
+        __atomic_add_fetch(&ring->waiting_pop, 1, __ATOMIC_SEQ_CST);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        // A producer may have pushed before seeing us waiting
+        popped = ring_pop_cells(ring, &data, 1);
+        if (popped == 0) {
+            if (abstime) {
+                timeout = pthread_cond_timedwait(&ring->available, &ring->mutex, abstime) != 0;
+            } else {
+                w_cond_wait(&ring->available, &ring->mutex);
+            }
+        }
+
+        __atomic_sub_fetch(&ring->waiting_pop, 1, __ATOMIC_SEQ_CST);
+        w_mutex_unlock(&ring->mutex);
+
+        if (popped) {
+            ring_wake(ring, &ring->waiting_push, &ring->available_not_full);
+            break;
+        }
+
+        if (timeout) {
+            ring_pop_batch(ring, &data, 1);
+            break;
+        }
+    }
+
+    return data;
+}
+
+void * ring_pop_ex(w_ring_t * ring) {
+    return ring_pop_wait(ring, NULL);
+}
+
+void * ring_pop_ex_timedwait(w_ring_t * ring, const struct timespec * abstime) {
+    return ring_pop_wait(ring, abstime);
+}
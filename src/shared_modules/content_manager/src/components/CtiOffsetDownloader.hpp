@@ -17,8 +17,12 @@
 #include "IURLRequest.hpp"
 #include "updaterContext.hpp"
 #include <algorithm>
+#include <exception>
+#include <future>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 /**
  * @class CtiOffsetDownloader
@@ -59,9 +63,20 @@ private:
         }
         const auto& consumerLastOffset {ctiParameters.lastOffset.value()};
 
-        // Iterate until the current offset is equal to the consumer offset.
+        // Amount of offsets to download on each query.
+        constexpr auto OFFSETS_DELTA {1000};
+
+        // Split the pending offsets into the ranges to download, in order.
+        std::vector<std::pair<int, int>> ranges;
+        for (auto fromOffset {context.currentOffset}; fromOffset < consumerLastOffset; fromOffset += OFFSETS_DELTA)
+        {
+            ranges.emplace_back(fromOffset, std::min(consumerLastOffset, fromOffset + OFFSETS_DELTA));
+        }
+
+        // Download the ranges in batches of concurrent queries. The paths keep the order of the ranges, so the
+        // offsets are applied in order no matter which query finishes first.
         auto pathsArray = nlohmann::json::array();
-        while (context.currentOffset < consumerLastOffset)
+        for (size_t batchBegin = 0; batchBegin < ranges.size(); batchBegin += m_parallelDownloads)
         {
             if (stopCondition->check())
             {
@@ -69,25 +84,56 @@ private:
                 return;
             }
 
-            // Amount of offsets to download on each query.
-            constexpr auto OFFSETS_DELTA {1000};
+            const auto batchEnd {std::min(ranges.size(), batchBegin + m_parallelDownloads)};
 
-            // Calculate the offset to download
-            const auto toOffset {std::min(consumerLastOffset, context.currentOffset + OFFSETS_DELTA)};
+            std::vector<std::string> batchPaths;
+            std::vector<std::future<void>> downloads;
+            for (auto i {batchBegin}; i < batchEnd; ++i)
+            {
+                const auto fromOffset {ranges.at(i).first};
+                const auto toOffset {ranges.at(i).second};
+
+                // full path where the content will be saved.
+                std::ostringstream filePathStream;
+                filePathStream << m_outputFolder << "/" << toOffset << "-" << m_fileName;
+                batchPaths.push_back(filePathStream.str());
+
+                // Download the content.
+                downloads.push_back(std::async(std::launch::async,
+                                               [this, fromOffset, toOffset, fullFilePath = batchPaths.back()]()
+                                               { downloadContent(fromOffset, toOffset, fullFilePath); }));
+            }
 
-            // full path where the content will be saved.
-            std::ostringstream filePathStream;
-            filePathStream << m_outputFolder << "/" << toOffset << "-" << m_fileName;
-            const std::string fullFilePath = filePathStream.str();
+            // Wait for all the queries of the batch before propagating the first error, if any.
+            std::exception_ptr downloadError;
+            for (auto& download : downloads)
+            {
+                try
+                {
+                    download.get();
+                }
+                catch (...)
+                {
+                    if (!downloadError)
+                    {
+                        downloadError = std::current_exception();
+                    }
+                }
+            }
 
-            // Download the content.
-            downloadContent(toOffset, fullFilePath, context);
+            if (downloadError)
+            {
+                std::rethrow_exception(downloadError);
+            }
 
             // Update the current offset.
-            context.currentOffset = toOffset;
+            context.currentOffset = ranges.at(batchEnd - 1).second;
 
-            // Save the path of the downloaded content in a temporary variable.
-            pathsArray.push_back(fullFilePath);
+            // Save the paths of the downloaded content in a temporary variable.
+            for (auto& path : batchPaths)
+            {
+                pathsArray.push_back(std::move(path));
+            }
         }
 
         // Commit changes.
@@ -113,19 +159,26 @@ private:
 
         // name of the file where the content will be saved.
         m_fileName = context.spUpdaterBaseContext->configData.at("contentFileName").get<std::string>();
+
+        // Amount of queries to perform at the same time.
+        m_parallelDownloads = context.spUpdaterBaseContext->configData.contains("parallelDownloads")
+                                  ? context.spUpdaterBaseContext->configData.at("parallelDownloads").get<size_t>()
+                                  : DEFAULT_PARALLEL_DOWNLOADS;
+        m_parallelDownloads = std::max(m_parallelDownloads, static_cast<size_t>(1));
     }
 
     /**
      * @brief Download the content from the API.
      *
+     * @param fromOffset start offset to download.
      * @param toOffset end offset to download.
      * @param fullFilePath full path where the content will be saved.
      */
-    void downloadContent(int toOffset, const std::string& fullFilePath, const UpdaterContext& context) const
+    void downloadContent(int fromOffset, int toOffset, const std::string& fullFilePath) const
     {
         // Define the parameters for the request.
         const auto queryParameters =
-            "/changes?from_offset=" + std::to_string(context.currentOffset) + "&to_offset=" + std::to_string(toOffset);
+            "/changes?from_offset=" + std::to_string(fromOffset) + "&to_offset=" + std::to_string(toOffset);
 
         // Empty on download success routine.
         const auto onSuccess {[]([[maybe_unused]] const std::string& data) {
@@ -140,6 +193,9 @@ private:
     std::string m_url {};          ///< URL of the API to connect to.
     std::string m_outputFolder {}; ///< output folder where the file will be saved
     std::string m_fileName {};     ///< name of the file where the content will be saved
+    size_t m_parallelDownloads {}; ///< amount of offset ranges downloaded at the same time
+
+    static constexpr size_t DEFAULT_PARALLEL_DOWNLOADS {4}; ///< default amount of concurrent queries
 
 public:
     /**
@@ -17,6 +17,7 @@
 #include "IURLRequest.hpp"
 #include "updaterContext.hpp"
 #include <filesystem>
+#include <fstream>
 #include <string>
 
 /**
@@ -58,12 +59,48 @@ private:
                                   context.data.at("offset") = context.currentOffset;
                               }};
 
+        // A snapshot kept in the downloads folder from a previous run isn't transferred again. The marker holds the
+        // offset of the snapshot and is only written once its download completes.
+        auto markerFilepath {outputFilepath};
+        markerFilepath += SNAPSHOT_MARKER_EXTENSION;
+        const auto snapshotOffset {std::to_string(context.currentOffset)};
+
+        if (std::filesystem::exists(outputFilepath) && readMarker(markerFilepath) == snapshotOffset)
+        {
+            logDebug2(WM_CONTENTUPDATER, "Reusing the downloaded snapshot '%s'", outputFilepath.string().c_str());
+            onSuccess("");
+            return;
+        }
+
+        std::filesystem::remove(markerFilepath);
+
         logDebug2(WM_CONTENTUPDATER, "Downloading snapshot from '%s'", lastSnapshotURL.string().c_str());
 
         // Download the content.
         performQueryWithRetry(lastSnapshotURL, onSuccess, "", outputFilepath);
+
+        if (std::filesystem::exists(outputFilepath) && !m_spUpdaterContext->spUpdaterBaseContext->spStopCondition->check())
+        {
+            std::ofstream {markerFilepath} << snapshotOffset;
+        }
     }
 
+    /**
+     * @brief Read the offset stored in a snapshot marker.
+     *
+     * @param markerFilepath Marker file path.
+     * @return std::string Offset, or empty if there is no marker.
+     */
+    static std::string readMarker(const std::filesystem::path& markerFilepath)
+    {
+        std::string offset;
+        std::ifstream marker {markerFilepath};
+        marker >> offset;
+        return offset;
+    }
+
+    static constexpr auto SNAPSHOT_MARKER_EXTENSION {".complete"}; ///< Extension of the downloaded snapshot markers.
+
 public:
     /**
      * @brief Class constructor.
@@ -34,6 +34,9 @@
 class XZDecompressor final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    uint32_t m_threadCount;  ///< Number of decompression threads. 0 uses all the available threads.
+    bool m_deleteCompressed; ///< Whether to delete each compressed file as soon as it's decompressed.
+
     /**
      * @brief Decompress the content and save it in the context.
      *
@@ -60,7 +63,13 @@ private:
             // Decompress.
             logDebug2(
                 WM_CONTENTUPDATER, "Decompressing '%s' into '%s'", inputPath.string().c_str(), outputPath.c_str());
-            Utils::XzHelper(inputPath, outputPath).decompress();
+            Utils::XzHelper(inputPath, outputPath, m_threadCount).decompress();
+
+            // The compressed file won't be used anymore: Free its space before decompressing the next one.
+            if (m_deleteCompressed)
+            {
+                std::filesystem::remove(inputPath);
+            }
 
             // Decompression finished: Update context path.
             path = std::move(outputPath);
@@ -68,6 +77,19 @@ private:
     }
 
 public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param threadCount Number of decompression threads. 0 uses all the available threads. Only the files with
+     * several xz blocks are decompressed in parallel.
+     * @param deleteCompressed If true, each compressed file is deleted right after being decompressed.
+     */
+    explicit XZDecompressor(const uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT, const bool deleteCompressed = false)
+        : m_threadCount(threadCount)
+        , m_deleteCompressed(deleteCompressed)
+    {
+    }
+
     /**
      * @brief Decompress the content.
      *
@@ -33,6 +33,9 @@
 class FactoryDecompressor final
 {
 private:
+    // All the available threads. liblzma caps the memory used by the threads to a quarter of the physical memory.
+    static constexpr uint32_t DEFAULT_XZ_DECOMPRESSION_THREADS {0};
+
     /**
      * @brief Deduces and returns the compression type given an input file extension.
      *
@@ -72,19 +75,27 @@ public:
 
         logDebug1(WM_CONTENTUPDATER, "Creating '%s' decompressor", decompressorType.c_str());
 
+        // The downloaded files are deleted by the cleaner at the end of the chain anyway, but deleting each one as
+        // soon as it's decompressed keeps the peak disk usage close to the size of the decompressed content.
+        const auto deleteCompressed {config.contains("deleteDownloadedContent") &&
+                                     config.at("deleteDownloadedContent").get<bool>()};
+
         if ("xz" == decompressorType)
         {
-            return std::make_shared<XZDecompressor>();
+            const auto threadCount {config.contains("decompressionThreads")
+                                        ? config.at("decompressionThreads").get<uint32_t>()
+                                        : DEFAULT_XZ_DECOMPRESSION_THREADS};
+            return std::make_shared<XZDecompressor>(threadCount, deleteCompressed);
         }
 
         if ("gzip" == decompressorType)
         {
-            return std::make_shared<GzipDecompressor>();
+            return std::make_shared<GzipDecompressor>(deleteCompressed);
         }
 
         if ("zip" == decompressorType)
         {
-            return std::make_shared<ZipDecompressor>();
+            return std::make_shared<ZipDecompressor>(deleteCompressed);
         }
 
         if ("raw" == decompressorType)
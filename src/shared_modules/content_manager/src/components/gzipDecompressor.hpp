@@ -33,6 +33,8 @@
 class GzipDecompressor final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    bool m_deleteCompressed; ///< Whether to delete each compressed file as soon as it's decompressed.
+
     /**
      * @brief Decompress the compressed content and update the context paths.
      *
@@ -61,12 +63,28 @@ private:
                 WM_CONTENTUPDATER, "Decompressing '%s' into '%s'", inputPath.string().c_str(), outputPath.c_str());
             Utils::ZlibHelper::gzipDecompress(inputPath, outputPath);
 
+            // The compressed file won't be used anymore: Free its space before decompressing the next one.
+            if (m_deleteCompressed)
+            {
+                std::filesystem::remove(inputPath);
+            }
+
             // Decompression finished: Update context path.
             path = std::move(outputPath);
         }
     }
 
 public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param deleteCompressed If true, each compressed file is deleted right after being decompressed.
+     */
+    explicit GzipDecompressor(const bool deleteCompressed = false)
+        : m_deleteCompressed(deleteCompressed)
+    {
+    }
+
     /**
      * @brief Decompress the GZ content and passes the control to the next step on the chain.
      *
@@ -34,6 +34,8 @@
 class ZipDecompressor final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    bool m_deleteCompressed; ///< Whether to delete each compressed file as soon as it's decompressed.
+
     /**
      * @brief Decompress the compressed content and update the context paths.
      *
@@ -56,6 +58,12 @@ private:
             newPaths.insert(newPaths.end(),
                             std::make_move_iterator(decompressedFiles.begin()),
                             std::make_move_iterator(decompressedFiles.end()));
+
+            // The compressed file won't be used anymore: Free its space before decompressing the next one.
+            if (m_deleteCompressed)
+            {
+                std::filesystem::remove(path.get_ref<const std::string&>());
+            }
         }
 
         // Decompression finished: Update paths.
@@ -63,6 +71,16 @@ private:
     }
 
 public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param deleteCompressed If true, each compressed file is deleted right after being decompressed.
+     */
+    explicit ZipDecompressor(const bool deleteCompressed = false)
+        : m_deleteCompressed(deleteCompressed)
+    {
+    }
+
     /**
      * @brief Decompress the ZIP content and passes the control to the next step on the chain.
      *
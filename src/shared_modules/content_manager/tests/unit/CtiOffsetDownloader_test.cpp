@@ -48,6 +48,25 @@ TEST_F(CtiOffsetDownloaderTest, TestHandleValidRequestWithRawData)
     EXPECT_FALSE(std::filesystem::exists(downloadPath));
 }
 
+/**
+ * @brief Tests handle a valid request with raw data and sequential downloads.
+ */
+TEST_F(CtiOffsetDownloaderTest, TestHandleValidRequestWithSequentialDownloads)
+{
+    m_spUpdaterBaseContext->configData["parallelDownloads"] = 1;
+
+    const auto& fileName {
+        m_spUpdaterContext->spUpdaterBaseContext->configData.at("contentFileName").get<std::string>()};
+    const auto contentPath {static_cast<std::string>(m_spUpdaterBaseContext->contentsFolder) + "/3-" + fileName};
+
+    EXPECT_NO_THROW(m_spCtiOffsetDownloader->handleRequest(m_spUpdaterContext));
+
+    EXPECT_EQ(m_spUpdaterContext->data.at("paths"), nlohmann::json::array({contentPath}));
+    EXPECT_EQ(m_spUpdaterContext->data.at("stageStatus"), OK_STATUS);
+    EXPECT_EQ(m_spUpdaterContext->data.at("offset"), 3);
+    EXPECT_TRUE(std::filesystem::exists(contentPath));
+}
+
 /**
  * @brief Tests handle a valid request with compressed data.
  */
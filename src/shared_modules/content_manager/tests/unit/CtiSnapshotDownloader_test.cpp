@@ -15,6 +15,7 @@
 #include "updaterContext.hpp"
 #include "gtest/gtest.h"
 #include <filesystem>
+#include <fstream>
 #include <memory>
 
 const auto OK_STATUS = R"([{"stage":"CtiSnapshotDownloader","status":"ok"}])"_json;
@@ -120,6 +121,40 @@ TEST_F(CtiSnapshotDownloaderTest, SnapshotDownloadWithRetry)
     EXPECT_TRUE(std::filesystem::exists(expectedContentPath));
 }
 
+/**
+ * @brief Tests that a snapshot completely downloaded on a previous run is reused instead of downloaded again.
+ *
+ */
+TEST_F(CtiSnapshotDownloaderTest, SnapshotDownloadReusesCompleteSnapshot)
+{
+    const auto contentPath {m_spUpdaterContext->spUpdaterBaseContext->downloadsFolder / SNAPSHOT_FILE_NAME};
+    auto markerPath {contentPath};
+    markerPath += ".complete";
+    constexpr auto KEPT_CONTENT {"kept snapshot"};
+    std::ofstream {contentPath} << KEPT_CONTENT;
+    std::ofstream {markerPath} << 3;
+
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    std::string content;
+    std::getline(std::ifstream {contentPath}, content);
+    EXPECT_EQ(content, KEPT_CONTENT);
+    EXPECT_EQ(m_spUpdaterContext->currentOffset, 3);
+    EXPECT_EQ(m_spUpdaterContext->data.at("paths").size(), 1);
+
+    // A marker of another snapshot doesn't avoid the download.
+    std::ofstream {markerPath} << 2;
+    m_spUpdaterContext->data.at("paths").clear();
+
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    std::getline(std::ifstream {contentPath}, content);
+    EXPECT_NE(content, KEPT_CONTENT);
+    std::string marker;
+    std::ifstream {markerPath} >> marker;
+    EXPECT_EQ(marker, "3");
+}
+
 /**
  * @brief Tests the download of the snapshot when last_snapshot_link metadata is missing.
  *
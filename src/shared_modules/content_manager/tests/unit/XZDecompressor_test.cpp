@@ -122,6 +122,59 @@ TEST_F(XZDecompressorTest, DecompressTwoFiles)
     EXPECT_TRUE(std::filesystem::exists(SAMPLE_B_OUTPUT_FILE));
 }
 
+/**
+ * @brief Tests the correct decompression of two files with all the available threads.
+ *
+ */
+TEST_F(XZDecompressorTest, DecompressTwoFilesMultiThread)
+{
+    m_spUpdaterContext->data.at("paths").push_back(SAMPLE_A_INPUT_FILE);
+    m_spUpdaterContext->data.at("paths").push_back(SAMPLE_B_INPUT_FILE);
+
+    ASSERT_NO_THROW(XZDecompressor(0).handleRequest(m_spUpdaterContext));
+
+    nlohmann::json expectedData;
+    expectedData["paths"] = nlohmann::json::array();
+    expectedData["paths"].push_back(SAMPLE_A_OUTPUT_FILE);
+    expectedData["paths"].push_back(SAMPLE_B_OUTPUT_FILE);
+    expectedData["stageStatus"] = nlohmann::json::array();
+    expectedData["stageStatus"].push_back(OK_STATUS);
+    expectedData["type"] = DEFAULT_TYPE;
+    expectedData["offset"] = 0;
+
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+    EXPECT_TRUE(std::filesystem::exists(SAMPLE_A_OUTPUT_FILE));
+    EXPECT_TRUE(std::filesystem::exists(SAMPLE_B_OUTPUT_FILE));
+}
+
+/**
+ * @brief Tests that the compressed file is deleted after being decompressed when requested.
+ *
+ */
+TEST_F(XZDecompressorTest, DecompressOneFileDeletesCompressed)
+{
+    // Work on a copy so the sample input file is kept for the other tests.
+    const auto inputFile {INPUT_FILES_FOLDER / "downloads" / "sample_a_copy.json.xz"};
+    const auto outputFile {CONTENT_FOLDER / "sample_a_copy.json"};
+    std::filesystem::copy_file(SAMPLE_A_INPUT_FILE, inputFile, std::filesystem::copy_options::overwrite_existing);
+
+    m_spUpdaterContext->data.at("paths").push_back(inputFile);
+
+    ASSERT_NO_THROW(XZDecompressor(1, true).handleRequest(m_spUpdaterContext));
+
+    nlohmann::json expectedData;
+    expectedData["paths"] = nlohmann::json::array();
+    expectedData["paths"].push_back(outputFile);
+    expectedData["stageStatus"] = nlohmann::json::array();
+    expectedData["stageStatus"].push_back(OK_STATUS);
+    expectedData["type"] = DEFAULT_TYPE;
+    expectedData["offset"] = 0;
+
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+    EXPECT_TRUE(std::filesystem::exists(outputFile));
+    EXPECT_FALSE(std::filesystem::exists(inputFile));
+}
+
 /**
  * @brief Tests the decompression of an inexistant file.
  *
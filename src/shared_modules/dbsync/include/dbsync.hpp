@@ -28,10 +28,12 @@
 #include <functional>
 #include "json.hpp"
 #include "db_exception.h"
+#include "dbsync_columnar.hpp"
 #include "commonDefs.h"
 #include "builder.hpp"
 
 using ResultCallbackData = const std::function<void(ReturnTypeCallback, const nlohmann::json&) >;
+using ColumnarResultCallbackData = const std::function<void(const DbSync::ColumnarRows&) >;
 
 class EXPORTED DBSync
 {
@@ -52,14 +54,19 @@ class EXPORTED DBSync
          * @param sqlStatement      SQL sentence to create tables in a SQL engine.
          * @param dbManagement      Database management type to be used at startup.
          * @param upgradeStatements SQL sentences to be executed when upgrading the database.
+         * @param readConnections   Read-only connections for the selects, 0 to share the write connection.
          *
+         * @details With read connections the database uses the WAL journal, and the selects of non TEMP tables run
+         *          on a free read connection at the same time as the writes. They see the data committed by the
+         *          last closed transaction (getDeletedRows), not the rows of the transaction in progress.
          */
         explicit DBSync(const HostType                  hostType,
                         const DbEngineType              dbType,
                         const std::string&              path,
                         const std::string&              sqlStatement,
                         const DbManagement              dbManagement = DbManagement::VOLATILE,
-                        const std::vector<std::string>& upgradeStatements = {});
+                        const std::vector<std::string>& upgradeStatements = {},
+                        const size_t                    readConnections = 0);
 
         /**
          * @brief DBSync Constructor.
@@ -120,6 +127,19 @@ class EXPORTED DBSync
         virtual void selectRows(const nlohmann::json& jsInput,
                                 ResultCallbackData    callbackData);
 
+        /**
+         * @brief Select data, based in \p jsInput data, from the database table, in batches of typed columns.
+         *
+         * @param jsInput         JSON with table name, fields and filters to apply in the query.
+         * @param batchSize       Max number of rows of each batch.
+         * @param callbackData    Result callback(std::function) will be called for each batch of rows.
+         *
+         * @details The batch is only valid during the callback, it is reused for the next rows.
+         */
+        virtual void selectRows(const nlohmann::json&      jsInput,
+                                const size_t               batchSize,
+                                ColumnarResultCallbackData callbackData);
+
         /**
          * @brief Deletes a database table record and its relationships based on \p jsInput value.
          *
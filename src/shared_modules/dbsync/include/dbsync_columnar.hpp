@@ -0,0 +1,150 @@
+/*
+ * Wazuh DBSYNC
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _DBSYNC_COLUMNAR_HPP_
+#define _DBSYNC_COLUMNAR_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace DbSync
+{
+    enum class ColumnValueType
+    {
+        Null = 0,
+        Integer,
+        Double,
+        Text
+    };
+
+    /**
+     * @brief Batch of selected rows stored by column, with the typed values as SQLite returns them.
+     *
+     * @details Each column keeps one vector per value kind, with an entry for every row, so reading a value is an
+     * index access and no document is built per row. The values that don't match the type of the row are empty.
+     */
+    class ColumnarRows final
+    {
+        public:
+            /**
+             * @brief Adds a column. The columns must be added before any row.
+             *
+             * @param name Column name.
+             */
+            void addColumn(const std::string& name)
+            {
+                m_names.push_back(name);
+                m_columns.emplace_back();
+            }
+
+            /**
+             * @brief Adds an empty row, whose values are then set column by column.
+             */
+            void addRow()
+            {
+                for (auto& column : m_columns)
+                {
+                    column.types.push_back(ColumnValueType::Null);
+                    column.integers.emplace_back();
+                    column.doubles.emplace_back();
+                    column.texts.emplace_back();
+                }
+
+                ++m_rows;
+            }
+
+            void setInteger(const size_t column, const int64_t value)
+            {
+                auto& data { m_columns.at(column) };
+                data.types.back() = ColumnValueType::Integer;
+                data.integers.back() = value;
+            }
+
+            void setDouble(const size_t column, const double value)
+            {
+                auto& data { m_columns.at(column) };
+                data.types.back() = ColumnValueType::Double;
+                data.doubles.back() = value;
+            }
+
+            void setText(const size_t column, std::string value)
+            {
+                auto& data { m_columns.at(column) };
+                data.types.back() = ColumnValueType::Text;
+                data.texts.back() = std::move(value);
+            }
+
+            /**
+             * @brief Removes the rows, keeping the columns and the allocated memory for the next batch.
+             */
+            void clearRows()
+            {
+                for (auto& column : m_columns)
+                {
+                    column.types.clear();
+                    column.integers.clear();
+                    column.doubles.clear();
+                    column.texts.clear();
+                }
+
+                m_rows = 0;
+            }
+
+            const std::vector<std::string>& columns() const
+            {
+                return m_names;
+            }
+
+            size_t rows() const
+            {
+                return m_rows;
+            }
+
+            ColumnValueType type(const size_t column, const size_t row) const
+            {
+                return m_columns.at(column).types.at(row);
+            }
+
+            int64_t integer(const size_t column, const size_t row) const
+            {
+                return m_columns.at(column).integers.at(row);
+            }
+
+            double real(const size_t column, const size_t row) const
+            {
+                return m_columns.at(column).doubles.at(row);
+            }
+
+            const std::string& text(const size_t column, const size_t row) const
+            {
+                return m_columns.at(column).texts.at(row);
+            }
+
+        private:
+            struct Column final
+            {
+                std::vector<ColumnValueType> types;
+                std::vector<int64_t> integers;
+                std::vector<double> doubles;
+                std::vector<std::string> texts;
+            };
+
+            std::vector<std::string> m_names;
+            std::vector<Column> m_columns;
+            size_t m_rows { 0 };
+    };
+
+    using ColumnarResultCallback = std::function<void(const ColumnarRows&)>;
+}// namespace DbSync
+
+#endif // _DBSYNC_COLUMNAR_HPP_
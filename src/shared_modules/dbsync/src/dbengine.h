@@ -19,6 +19,7 @@
 #include <shared_mutex>
 #include "json.hpp"
 #include "commonDefs.h"
+#include "dbsync_columnar.hpp"
 #include "abstractLocking.hpp"
 
 namespace DbSync
@@ -58,7 +59,13 @@ namespace DbSync
             virtual void selectData(const std::string& table,
                                     const nlohmann::json& query,
                                     const ResultCallback& callback,
-                                    std::unique_lock<std::shared_timed_mutex>& lock) = 0;
+                                    std::shared_lock<std::shared_timed_mutex>& lock) = 0;
+
+            virtual void selectData(const std::string& table,
+                                    const nlohmann::json& query,
+                                    const size_t batchSize,
+                                    const ColumnarResultCallback& callback,
+                                    std::shared_lock<std::shared_timed_mutex>& lock) = 0;
 
             virtual void deleteTableRowsData(const std::string& table,
                                              const nlohmann::json& jsDeletionData) = 0;
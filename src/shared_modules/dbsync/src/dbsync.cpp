@@ -672,8 +672,9 @@ DBSync::DBSync(const HostType                  hostType,
                const std::string&              path,
                const std::string&              sqlStatement,
                const DbManagement              dbManagement,
-               const std::vector<std::string>& upgradeStatements)
-    : m_dbsyncHandle { DBSyncImplementation::instance().initialize(hostType, dbType, path, sqlStatement, dbManagement, upgradeStatements) }
+               const std::vector<std::string>& upgradeStatements,
+               const size_t                    readConnections)
+    : m_dbsyncHandle { DBSyncImplementation::instance().initialize(hostType, dbType, path, sqlStatement, dbManagement, upgradeStatements, readConnections) }
     , m_shouldBeRemoved{ true }
 { }
 
@@ -739,6 +740,13 @@ void DBSync::selectRows(const nlohmann::json& jsInput,
     DBSyncImplementation::instance().selectData(m_dbsyncHandle, jsInput, callbackWrapper);
 }
 
+void DBSync::selectRows(const nlohmann::json&      jsInput,
+                        const size_t               batchSize,
+                        ColumnarResultCallbackData callbackData)
+{
+    DBSyncImplementation::instance().selectData(m_dbsyncHandle, jsInput, batchSize, callbackData);
+}
+
 void DBSync::deleteRows(const nlohmann::json& jsInput)
 {
     DBSyncImplementation::instance().deleteRowsData(m_dbsyncHandle, jsInput);
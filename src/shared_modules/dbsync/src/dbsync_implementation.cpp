@@ -20,9 +20,10 @@ DBSYNC_HANDLE DBSyncImplementation::initialize(const HostType                  h
                                                const std::string&              path,
                                                const std::string&              sqlStatement,
                                                const DbManagement              dbManagement,
-                                               const std::vector<std::string>& upgradeStatements)
+                                               const std::vector<std::string>& upgradeStatements,
+                                               const size_t                    readConnections)
 {
-    auto db{ FactoryDbEngine::create(dbType, path, sqlStatement, dbManagement, upgradeStatements) };
+    auto db{ FactoryDbEngine::create(dbType, path, sqlStatement, dbManagement, upgradeStatements, readConnections) };
     const auto spDbEngineContext
     {
         std::make_shared<DbEngineContext>(db, hostType, dbType)
@@ -173,9 +174,24 @@ void DBSyncImplementation::selectData(const DBSYNC_HANDLE   handle,
 {
     const auto ctx{ dbEngineContext(handle) };
 
-    std::unique_lock<std::shared_timed_mutex> lock{ ctx->m_syncMutex };
+    std::shared_lock<std::shared_timed_mutex> lock{ ctx->m_syncMutex };
+    ctx->m_dbEngine->selectData(json.at("table"),
+                                json.at("query"),
+                                callback,
+                                lock);
+}
+
+void DBSyncImplementation::selectData(const DBSYNC_HANDLE                   handle,
+                                      const nlohmann::json&                 json,
+                                      const size_t                          batchSize,
+                                      const DbSync::ColumnarResultCallback& callback)
+{
+    const auto ctx{ dbEngineContext(handle) };
+
+    std::shared_lock<std::shared_timed_mutex> lock{ ctx->m_syncMutex };
     ctx->m_dbEngine->selectData(json.at("table"),
                                 json.at("query"),
+                                batchSize,
                                 callback,
                                 lock);
 }
@@ -55,7 +55,8 @@ namespace DbSync
                                      const std::string&              path,
                                      const std::string&              sqlStatement,
                                      const DbManagement              dbManagement,
-                                     const std::vector<std::string>& upgradeStatements);
+                                     const std::vector<std::string>& upgradeStatements,
+                                     const size_t                    readConnections = 0);
 
             void setMaxRows(const DBSYNC_HANDLE handle,
                             const std::string& table,
@@ -75,6 +76,11 @@ namespace DbSync
                             const nlohmann::json&  json,
                             const ResultCallback&  callback);
 
+            void selectData(const DBSYNC_HANDLE                   handle,
+                            const nlohmann::json&                 json,
+                            const size_t                          batchSize,
+                            const DbSync::ColumnarResultCallback& callback);
+
             void addTableRelationship(const DBSYNC_HANDLE   handle,
                                       const nlohmann::json& json);
 
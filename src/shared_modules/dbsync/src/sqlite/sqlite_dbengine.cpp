@@ -25,15 +25,22 @@ SQLiteDBEngine::SQLiteDBEngine(const std::shared_ptr<ISQLiteFactory>& sqliteFact
                                const std::string&                     path,
                                const std::string&                     tableStmtCreation,
                                const DbManagement                     dbManagement,
-                               const std::vector<std::string>&        upgradeStatements)
+                               const std::vector<std::string>&        upgradeStatements,
+                               const size_t                           readConnections)
     : m_sqliteFactory(sqliteFactory)
 {
     initialize(path, tableStmtCreation, dbManagement, upgradeStatements);
+
+    if (0 != readConnections && path.compare(":memory:") != 0)
+    {
+        initializeReadConnections(path, readConnections);
+    }
 }
 
 SQLiteDBEngine::~SQLiteDBEngine()
 {
     std::lock_guard<std::mutex> lock(m_stmtMutex);
+    m_statementsIndex.clear();
     m_statementsCache.clear();
 
     if (m_transaction)
@@ -91,10 +98,42 @@ void SQLiteDBEngine::bulkInsert(const std::string& table,
     if (0 != loadTableData(table))
     {
         const auto& tableFieldsMetaData { m_tableFields[table] };
+        auto hasMaxRows { false };
 
-        for (const auto& element : data)
         {
-            insertElement(table, tableFieldsMetaData, element);
+            std::lock_guard<std::mutex> lock(m_maxRowsMutex);
+            hasMaxRows = m_maxRows.end() != m_maxRows.find(table);
+        }
+
+        if (hasMaxRows)
+        {
+            // Row by row, so the rows before the limit is reached are inserted.
+            for (const auto& element : data)
+            {
+                insertElement(table, tableFieldsMetaData, element);
+            }
+        }
+        else
+        {
+            // The consecutive elements with the same fields are inserted together.
+            std::string insertQuery;
+            std::vector<const nlohmann::json*> elements;
+
+            for (const auto& element : data)
+            {
+                auto query { buildInsertDataSqlQuery(table, element) };
+
+                if (query != insertQuery)
+                {
+                    insertElements(table, tableFieldsMetaData, insertQuery, elements);
+                    elements.clear();
+                    insertQuery = std::move(query);
+                }
+
+                elements.push_back(&element);
+            }
+
+            insertElements(table, tableFieldsMetaData, insertQuery, elements);
         }
     }
     else
@@ -108,8 +147,24 @@ void SQLiteDBEngine::refreshTableData(const nlohmann::json& data,
                                       std::unique_lock<std::shared_timed_mutex>& lock)
 {
     const std::string table { data.at("table").is_string() ? data.at("table").get_ref<const std::string&>() : "" };
+    auto inMemoryDiff { false };
+    const auto itOptions { data.find("options") };
+
+    if (data.end() != itOptions)
+    {
+        const auto itInMemoryDiff { itOptions->find(IN_MEMORY_DIFF_OPTION) };
 
-    if (createCopyTempTable(table))
+        if (itOptions->end() != itInMemoryDiff)
+        {
+            inMemoryDiff = itInMemoryDiff->is_boolean() ? itInMemoryDiff.value().get<bool>() : inMemoryDiff;
+        }
+    }
+
+    if (inMemoryDiff)
+    {
+        refreshTableDataInMemory(table, data.at("data"), callback, lock);
+    }
+    else if (createCopyTempTable(table))
     {
         bulkInsert(table + TEMP_TABLE_SUBFIX, data.at("data"));
 
@@ -430,11 +485,12 @@ void SQLiteDBEngine::returnRowsMarkedForDelete(const nlohmann::json& tableNames,
 void SQLiteDBEngine::selectData(const std::string& table,
                                 const nlohmann::json& query,
                                 const DbSync::ResultCallback& callback,
-                                std::unique_lock<std::shared_timed_mutex>& lock)
+                                std::shared_lock<std::shared_timed_mutex>& lock)
 {
     if (0 != loadTableData(table))
     {
-        const auto& stmt { m_sqliteFactory->createStatement(m_sqliteConnection, buildSelectQuery(table, query)) };
+        auto connection { selectConnection(table) };
+        const auto& stmt { m_sqliteFactory->createStatement(connection, buildSelectQuery(table, query)) };
 
         while (SQLITE_ROW == stmt->step())
         {
@@ -483,6 +539,99 @@ void SQLiteDBEngine::selectData(const std::string& table,
     }
 }
 
+void SQLiteDBEngine::selectData(const std::string& table,
+                                const nlohmann::json& query,
+                                const size_t batchSize,
+                                const DbSync::ColumnarResultCallback& callback,
+                                std::shared_lock<std::shared_timed_mutex>& lock)
+{
+    if (0 == batchSize)
+    {
+        throw dbengine_error { INVALID_PARAMETERS };
+    }
+
+    if (0 != loadTableData(table))
+    {
+        auto connection { selectConnection(table) };
+        const auto& stmt { m_sqliteFactory->createStatement(connection, buildSelectQuery(table, query)) };
+        DbSync::ColumnarRows batch;
+        std::vector<int32_t> columnIndexes;
+
+        const auto flushBatch
+        {
+            [&]()
+            {
+                if (callback && batch.rows())
+                {
+                    lock.unlock();
+                    callback(batch);
+                    lock.lock();
+                }
+
+                batch.clearRows();
+            }
+        };
+
+        while (SQLITE_ROW == stmt->step())
+        {
+            if (columnIndexes.empty())
+            {
+                for (int i = 0; i < stmt->columnsCount(); ++i)
+                {
+                    const auto& name { stmt->column(i)->name() };
+
+                    if (name != STATUS_FIELD_NAME)
+                    {
+                        batch.addColumn(name);
+                        columnIndexes.push_back(i);
+                    }
+                }
+            }
+
+            batch.addRow();
+
+            for (size_t i = 0; i < columnIndexes.size(); ++i)
+            {
+                const auto& column { stmt->column(columnIndexes[i]) };
+
+                if (column->hasValue())
+                {
+                    switch (column->type())
+                    {
+                        case SQLITE_TEXT:
+                            batch.setText(i, column->value(std::string{}));
+                            break;
+
+                        case SQLITE_INTEGER:
+                            batch.setInteger(i, column->value(int64_t{}));
+                            break;
+
+                        case SQLITE_FLOAT:
+                            batch.setDouble(i, column->value(double_t{}));
+                            break;
+
+                        // LCOV_EXCL_START
+                        default:
+                            throw dbengine_error{INVALID_COLUMN_TYPE};
+                            // LCOV_EXCL_STOP
+                    }
+                }
+            }
+
+            if (batch.rows() == batchSize)
+            {
+                flushBatch();
+            }
+        }
+
+        flushBatch();
+    }
+    else
+    {
+        throw dbengine_error { EMPTY_TABLE_METADATA };
+    }
+}
+
 void SQLiteDBEngine::deleteTableRowsData(const std::string&    table,
                                          const nlohmann::json& jsDeletionData)
 {
@@ -607,6 +756,25 @@ void SQLiteDBEngine::initialize(const std::string&              path,
 
             m_transaction = m_sqliteFactory->createTransaction(m_sqliteConnection);
         }
+
+        if (0 != dbVersion)
+        {
+            // The TEMP tables live only in memory, so a reused database needs them created again.
+            m_sqliteConnection->execute("PRAGMA temp_store = memory;");
+
+            for (const auto& query : Utils::split(tableStmtCreation, ';'))
+            {
+                if (Utils::startsWith(Utils::toUpperCase(Utils::trim(query, " \t\r\n")), "CREATE TEMP"))
+                {
+                    const auto stmt {m_sqliteFactory->createStatement(m_sqliteConnection, query)};
+
+                    if (SQLITE_DONE != stmt->step())
+                    {
+                        throw dbengine_error {STEP_ERROR_CREATE_STMT};
+                    }
+                }
+            }
+        }
     }
     else if (DbManagement::VOLATILE == dbManagement)
     {
@@ -614,6 +782,72 @@ void SQLiteDBEngine::initialize(const std::string&              path,
     }
 }
 
+void SQLiteDBEngine::initializeReadConnections(const std::string& path,
+                                               const size_t       readConnections)
+{
+    // The journal mode can't change inside a transaction.
+    const auto inTransaction { nullptr != m_transaction };
+
+    if (inTransaction)
+    {
+        m_transaction->commit();
+    }
+
+    // In WAL mode the readers don't block the writer and see the last committed data.
+    m_sqliteConnection->execute("PRAGMA journal_mode = WAL;");
+
+    if (inTransaction)
+    {
+        m_transaction = m_sqliteFactory->createTransaction(m_sqliteConnection);
+    }
+
+    const auto stmt { getStatement("SELECT name FROM sqlite_temp_master WHERE type='table';") };
+
+    while (SQLITE_ROW == stmt->step())
+    {
+        m_tempTables.emplace(stmt->column(0)->value(std::string{}));
+    }
+
+    std::lock_guard<std::mutex> lock(m_readConnectionsMutex);
+
+    for (size_t i = 0; i < readConnections; ++i)
+    {
+        m_readConnections.push_back(m_sqliteFactory->createReadOnlyConnection(path));
+    }
+}
+
+std::shared_ptr<SQLite::IConnection> SQLiteDBEngine::selectConnection(const std::string& table)
+{
+    std::shared_ptr<SQLite::IConnection> connection;
+
+    if (m_tempTables.end() == m_tempTables.find(table))
+    {
+        std::lock_guard<std::mutex> lock(m_readConnectionsMutex);
+
+        if (!m_readConnections.empty())
+        {
+            connection = m_readConnections.back();
+            m_readConnections.pop_back();
+        }
+    }
+
+    if (!connection)
+    {
+        // No read connection free, the select shares the write connection.
+        return m_sqliteConnection;
+    }
+
+    // The read connection goes back to the free list when the select and its statement release it.
+    return std::shared_ptr<SQLite::IConnection>
+    {
+        connection.get(), [this, connection](SQLite::IConnection*)
+        {
+            std::lock_guard<std::mutex> lock(m_readConnectionsMutex);
+            m_readConnections.push_back(connection);
+        }
+    };
+}
+
 bool SQLiteDBEngine::cleanDB(const std::string& path)
 {
     auto ret { true };
@@ -637,6 +871,10 @@ bool SQLiteDBEngine::cleanDB(const std::string& path)
                 ret = false;
             }
         }
+
+        // A WAL left by a previous run must not be applied to the new database.
+        std::remove((path + "-wal").c_str());
+        std::remove((path + "-shm").c_str());
     }
 
     return ret;
@@ -656,6 +894,166 @@ size_t SQLiteDBEngine::getDbVersion()
     return version;
 }
 
+void SQLiteDBEngine::refreshTableDataInMemory(const std::string& table,
+                                              const nlohmann::json& data,
+                                              const DbSync::ResultCallback callback,
+                                              std::unique_lock<std::shared_timed_mutex>& lock)
+{
+    std::vector<std::string> primaryKeyList;
+
+    if (0 == loadTableData(table) || !getPrimaryKeysFromTable(table, primaryKeyList))
+    {
+        throw dbengine_error { EMPTY_TABLE_METADATA };
+    }
+
+    if (primaryKeyList.empty())
+    {
+        throw dbengine_error { SQL_STMT_ERROR };
+    }
+
+    const auto tableFields { m_tableFields[table] };
+
+    // The current rows are read once and indexed by their primary keys, so the snapshot is diffed against them
+    // without copying it to a temporary table and joining both tables for each kind of change.
+    std::unordered_map<std::string, Row> currentRows;
+    const auto stmt { getStatement("SELECT * FROM " + table + ";") };
+
+    while (SQLITE_ROW == stmt->step())
+    {
+        Row row;
+
+        for (const auto& field : tableFields)
+        {
+            getTableData(stmt,
+                         std::get<TableHeader::CID>(field),
+                         std::get<TableHeader::Type>(field),
+                         std::get<TableHeader::Name>(field),
+                         row);
+        }
+
+        auto index { getPrimaryKeyIndex(primaryKeyList, row) };
+        currentRows.emplace(std::move(index), std::move(row));
+    }
+
+    std::unordered_set<std::string> snapshotRows;
+    std::vector<Row> rowsToInsert;
+    std::vector<Row> modifiedRows;
+    std::vector<nlohmann::json> rowsToUpdate;
+
+    for (const auto& element : data)
+    {
+        Row row;
+
+        for (const auto& field : tableFields)
+        {
+            getTableFieldFromJson(field, element, row);
+        }
+
+        auto index { getPrimaryKeyIndex(primaryKeyList, row) };
+        const auto itCurrent { currentRows.find(index) };
+
+        // Repeated rows in the snapshot are only diffed once, as the temporary table does not allow them either.
+        if (!snapshotRows.insert(std::move(index)).second)
+        {
+            continue;
+        }
+
+        if (currentRows.end() == itCurrent)
+        {
+            rowsToInsert.push_back(std::move(row));
+        }
+        else
+        {
+            // Same shape as the temporary table diff: the primary keys with the PK_ prefix and only the fields
+            // present in the snapshot element that changed.
+            Row modifiedRow;
+            nlohmann::json updatedData;
+
+            for (const auto& field : tableFields)
+            {
+                const auto& name { std::get<TableHeader::Name>(field) };
+
+                if (std::get<TableHeader::PK>(field))
+                {
+                    modifiedRow["PK_" + name] = row.at(name);
+                    updatedData[name] = element.at(name);
+                }
+                else if (element.end() != element.find(name) && row.at(name) != itCurrent->second.at(name))
+                {
+                    modifiedRow[name] = row.at(name);
+                    updatedData[name] = element.at(name);
+                }
+            }
+
+            if (modifiedRow.size() > primaryKeyList.size())
+            {
+                modifiedRows.push_back(std::move(modifiedRow));
+                rowsToUpdate.push_back(std::move(updatedData));
+            }
+        }
+    }
+
+    std::vector<Row> rowsToDelete;
+
+    for (const auto& current : currentRows)
+    {
+        if (snapshotRows.end() == snapshotRows.find(current.first))
+        {
+            Row row;
+
+            for (const auto& value : primaryKeyList)
+            {
+                row[value] = current.second.at(value);
+            }
+
+            rowsToDelete.push_back(std::move(row));
+        }
+    }
+
+    const auto notifyRows
+    {
+        [&](const ReturnTypeCallback type, const std::vector<Row>& rows)
+        {
+            if (callback)
+            {
+                for (const auto& row : rows)
+                {
+                    nlohmann::json object;
+
+                    for (const auto& value : row)
+                    {
+                        getFieldValueFromTuple(value, object);
+                    }
+
+                    lock.unlock();
+                    callback(type, object);
+                    lock.lock();
+                }
+            }
+        }
+    };
+
+    // The rows are written in the engine transaction, deleting first so the max rows limit counts the final ones.
+    if (!rowsToDelete.empty())
+    {
+        deleteRows(table, primaryKeyList, rowsToDelete);
+        notifyRows(ReturnTypeCallback::DELETED, rowsToDelete);
+    }
+
+    for (const auto& updatedData : rowsToUpdate)
+    {
+        updateSingleRow(table, updatedData);
+    }
+
+    notifyRows(ReturnTypeCallback::MODIFIED, modifiedRows);
+
+    if (!rowsToInsert.empty())
+    {
+        bulkInsert(table, rowsToInsert);
+        notifyRows(ReturnTypeCallback::INSERTED, rowsToInsert);
+    }
+}
+
 void SQLiteDBEngine::insertElement(const std::string& table,
                                    const TableColumns& tableFieldsMetaData,
                                    const nlohmann::json& element,
@@ -688,6 +1086,76 @@ void SQLiteDBEngine::insertElement(const std::string& table,
     }
 }
 
+void SQLiteDBEngine::insertElements(const std::string& table,
+                                    const TableColumns& tableFieldsMetaData,
+                                    const std::string& insertQuery,
+                                    const std::vector<const nlohmann::json*>& elements)
+{
+    // The rows are inserted in chunks of a power of two rows, so each set of fields only needs a few statements.
+    const auto parameters { std::max<size_t>(1ull, std::count(insertQuery.begin(), insertQuery.end(), '?')) };
+    auto maxChunkRows { 1ull };
+
+    while (maxChunkRows * 2 <= BULK_INSERT_MAX_ROWS && maxChunkRows * 2 * parameters <= BULK_INSERT_MAX_PARAMETERS)
+    {
+        maxChunkRows *= 2;
+    }
+
+    auto it { elements.begin() };
+
+    while (elements.end() != it)
+    {
+        auto chunkRows { maxChunkRows };
+
+        while (chunkRows > static_cast<size_t>(std::distance(it, elements.end())))
+        {
+            chunkRows /= 2;
+        }
+
+        const auto itEnd { std::next(it, chunkRows) };
+        auto inserted { false };
+
+        if (1 != chunkRows)
+        {
+            try
+            {
+                const auto stmt { getStatement(buildBulkInsertDataSqlQuery(insertQuery, chunkRows)) };
+                int32_t index { 1l };
+
+                for (auto itElement = it; itElement != itEnd; ++itElement)
+                {
+                    for (const auto& field : tableFieldsMetaData)
+                    {
+                        if (bindJsonData(stmt, field, **itElement, index))
+                        {
+                            ++index;
+                        }
+                    }
+                }
+
+                inserted = SQLITE_DONE == stmt->step();
+            }
+            catch (const std::exception&)
+            {
+                // The chunk is inserted again row by row below, failing in the same row it would without chunks.
+            }
+        }
+
+        if (inserted)
+        {
+            updateTableRowCounter(table, static_cast<long long>(chunkRows));
+        }
+        else
+        {
+            for (auto itElement = it; itElement != itEnd; ++itElement)
+            {
+                insertElement(table, tableFieldsMetaData, **itElement);
+            }
+        }
+
+        it = itEnd;
+    }
+}
+
 size_t SQLiteDBEngine::loadTableData(const std::string& table)
 {
     size_t fieldsNumber { 0ull };
@@ -909,7 +1377,12 @@ bool SQLiteDBEngine::getTableCreateQuery(const std::string& table,
                                          std::string& resultQuery)
 {
     auto ret { false };
-    const std::string sql { "SELECT sql FROM sqlite_master WHERE type='table' AND name=?;" };
+    // Tables created as TEMP are kept in memory and listed in the temp schema.
+    const std::string sql
+    {
+        "SELECT sql FROM (SELECT type, name, sql FROM sqlite_master UNION ALL "
+        "SELECT type, name, sql FROM sqlite_temp_master) WHERE type='table' AND name=?;"
+    };
 
     if (!table.empty())
     {
@@ -1016,6 +1489,86 @@ void SQLiteDBEngine::getTableData(std::shared_ptr<SQLite::IStatement>const stmt,
     }
 }
 
+void SQLiteDBEngine::getTableFieldFromJson(const ColumnData& cd,
+                                           const nlohmann::json& element,
+                                           Row& row)
+{
+    // Same conversions as bindJsonData, the missing fields get the value that a NULL column is read with.
+    const auto type { std::get<TableHeader::Type>(cd) };
+    const auto& name { std::get<TableHeader::Name>(cd) };
+    const auto it { element.find(name) };
+    const auto hasValue { element.end() != it };
+    const auto isText { hasValue && it->is_string() };
+    const auto hasNumber { isText && it->get_ref<const std::string&>().size() };
+
+    if (ColumnType::BigInt == type)
+    {
+        const int64_t value
+        {
+            hasValue && it->is_number() ? it->get<int64_t>() : hasNumber
+            ? std::stoll(it->get_ref<const std::string&>())
+            : 0
+        };
+        row[name] = std::make_tuple(type, std::string(), 0, value, 0, 0);
+    }
+    else if (ColumnType::UnsignedBigInt == type)
+    {
+        const uint64_t value
+        {
+            hasValue && it->is_number_unsigned() ? it->get<uint64_t>() : hasNumber
+            ? std::stoull(it->get_ref<const std::string&>())
+            : 0
+        };
+        row[name] = std::make_tuple(type, std::string(), 0, 0, value, 0);
+    }
+    else if (ColumnType::Integer == type)
+    {
+        const int32_t value
+        {
+            hasValue && it->is_number() ? it->get<int32_t>() : hasNumber
+            ? std::stoi(it->get_ref<const std::string&>())
+            : 0
+        };
+        row[name] = std::make_tuple(type, std::string(), value, 0, 0, 0);
+    }
+    else if (ColumnType::Text == type)
+    {
+        row[name] = std::make_tuple(type, isText ? it->get_ref<const std::string&>() : "", 0, 0, 0, 0);
+    }
+    else if (ColumnType::Double == type)
+    {
+        const double_t value
+        {
+            hasValue && it->is_number_float() ? it->get<double>() : hasNumber
+            ? std::stod(it->get_ref<const std::string&>())
+            : .0f
+        };
+        row[name] = std::make_tuple(type, std::string(), 0, 0, 0, value);
+    }
+    else
+    {
+        throw dbengine_error { INVALID_COLUMN_TYPE };
+    }
+}
+
+std::string SQLiteDBEngine::getPrimaryKeyIndex(const std::vector<std::string>& primaryKeyList,
+                                               const Row& row)
+{
+    std::string index;
+
+    for (const auto& value : primaryKeyList)
+    {
+        // Each value is prefixed with its length, so the values of different keys can't be mixed up.
+        std::string fieldValue;
+        getFieldValueFromTuple(*row.find(value), fieldValue);
+        index.append(std::to_string(fieldValue.size()));
+        index.append(":");
+        index.append(fieldValue);
+    }
+
+    return index;
+}
+
 bool SQLiteDBEngine::getLeftOnly(const std::string& t1,
                                  const std::string& t2,
                                  const std::vector<std::string>& primaryKeyList,
@@ -1101,6 +1654,34 @@ bool SQLiteDBEngine::getPKListLeftOnly(const std::string& t1,
     return ret;
 }
 
+std::string SQLiteDBEngine::buildBulkInsertDataSqlQuery(const std::string& insertQuery,
+                                                        const size_t rows)
+{
+    //
+    // The single row INSERT statement is extended with the values of the other rows:
+    //  INSERT INTO table (column1, column2, ...) VALUES (?, ?, ...),(?, ?, ...),...;
+    //
+    const auto valuesPosition { insertQuery.rfind(" VALUES ") };
+
+    if (std::string::npos == valuesPosition || insertQuery.back() != ';')
+    {
+        throw dbengine_error { SQL_STMT_ERROR };
+    }
+
+    const auto rowBinds { insertQuery.substr(valuesPosition + 8, insertQuery.size() - valuesPosition - 9) };
+    std::string sql { insertQuery.substr(0, insertQuery.size() - 1) };
+    sql.reserve(sql.size() + (rowBinds.size() + 1) * rows);
+
+    for (auto i = 1ull; i < rows; ++i)
+    {
+        sql.append(",");
+        sql.append(rowBinds);
+    }
+
+    sql.append(";");
+    return sql;
+}
+
 std::string SQLiteDBEngine::buildDeleteBulkDataSqlQuery(const std::string& table,
                                                         const std::vector<std::string>& primaryKeyList)
 {
@@ -1983,31 +2564,27 @@ void SQLiteDBEngine::getFieldValueFromTuple(const Field& value,
 std::shared_ptr<SQLite::IStatement>const SQLiteDBEngine::getStatement(const std::string& sql)
 {
     std::lock_guard<std::mutex> lock(m_stmtMutex);
-    const auto it
-    {
-        std::find_if(m_statementsCache.begin(),
-                     m_statementsCache.end(),
-                     [sql](const std::pair<std::string, std::shared_ptr<SQLite::IStatement>>& pair)
-        {
-            return 0 == pair.first.compare(sql);
-        })
-    };
+    const auto it { m_statementsIndex.find(sql) };
 
-    if (m_statementsCache.end() != it)
+    if (m_statementsIndex.end() != it)
     {
-        it->second->reset();
-        return it->second;
+        // Rebind the statement instead of preparing it again.
+        m_statementsCache.splice(m_statementsCache.begin(), m_statementsCache, it->second);
+        it->second->second->reset();
+        return it->second->second;
     }
     else
     {
-        m_statementsCache.emplace_back(sql, m_sqliteFactory->createStatement(m_sqliteConnection, sql));
+        m_statementsCache.emplace_front(sql, m_sqliteFactory->createStatement(m_sqliteConnection, sql));
+        m_statementsIndex.emplace(sql, m_statementsCache.begin());
 
-        if (CACHE_STMT_LIMIT <= m_statementsCache.size())
+        if (CACHE_STMT_LIMIT < m_statementsCache.size())
         {
-            m_statementsCache.pop_front();
+            m_statementsIndex.erase(m_statementsCache.back().first);
+            m_statementsCache.pop_back();
         }
 
-        return m_statementsCache.back().second;
+        return m_statementsCache.front().second;
     }
 }
 
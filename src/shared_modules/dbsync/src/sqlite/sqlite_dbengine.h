@@ -16,6 +16,9 @@
 #include <iostream>
 #include <mutex>
 #include <queue>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
 #include "dbengine.h"
 #include "sqlite_wrapper_factory.h"
 #include "isqlite_wrapper.h"
@@ -23,12 +26,25 @@
 
 constexpr auto TEMP_TABLE_SUBFIX {"_TEMP"};
 
+constexpr auto IN_MEMORY_DIFF_OPTION {"in_memory_diff"};
+
 constexpr auto STATUS_FIELD_NAME {"db_status_field_dm"};
 constexpr auto STATUS_FIELD_TYPE {"INTEGER"};
 
 constexpr auto CACHE_STMT_LIMIT
 {
-    30ull
+    64ull
+};
+
+// Default SQLITE_MAX_VARIABLE_NUMBER of the SQLite versions before 3.32.0.
+constexpr auto BULK_INSERT_MAX_PARAMETERS
+{
+    999ull
+};
+
+constexpr auto BULK_INSERT_MAX_ROWS
+{
+    256ull
 };
 
 const std::vector<std::string> InternalColumnNames =
@@ -120,7 +136,8 @@ class SQLiteDBEngine final : public DbSync::IDbEngine
                        const std::string&                     path,
                        const std::string&                     tableStmtCreation,
                        const DbManagement                     dbManagement = DbManagement::VOLATILE,
-                       const std::vector<std::string>&        upgradeStatements = {});
+                       const std::vector<std::string>&        upgradeStatements = {},
+                       const size_t                           readConnections = 0);
         ~SQLiteDBEngine();
 
         void bulkInsert(const std::string& table,
@@ -149,7 +166,13 @@ class SQLiteDBEngine final : public DbSync::IDbEngine
         void selectData(const std::string& table,
                         const nlohmann::json& query,
                         const DbSync::ResultCallback& callback,
-                        std::unique_lock<std::shared_timed_mutex>& lock) override;
+                        std::shared_lock<std::shared_timed_mutex>& lock) override;
+
+        void selectData(const std::string& table,
+                        const nlohmann::json& query,
+                        const size_t batchSize,
+                        const DbSync::ColumnarResultCallback& callback,
+                        std::shared_lock<std::shared_timed_mutex>& lock) override;
 
         void deleteTableRowsData(const std::string& table,
                                  const nlohmann::json& jsDeletionData) override;
@@ -162,8 +185,18 @@ class SQLiteDBEngine final : public DbSync::IDbEngine
                         const DbManagement              dbManagement,
                         const std::vector<std::string>& upgradeStatements);
 
+        void initializeReadConnections(const std::string& path,
+                                       const size_t       readConnections);
+
+        std::shared_ptr<SQLite::IConnection> selectConnection(const std::string& table);
+
         bool cleanDB(const std::string& path);
 
+        void refreshTableDataInMemory(const std::string& table,
+                                      const nlohmann::json& data,
+                                      const DbSync::ResultCallback callback,
+                                      std::unique_lock<std::shared_timed_mutex>& lock);
+
         size_t getDbVersion();
 
         size_t loadTableData(const std::string& table);
@@ -173,6 +206,9 @@ class SQLiteDBEngine final : public DbSync::IDbEngine
         std::string buildInsertDataSqlQuery(const std::string& table,
                                             const nlohmann::json& data = {});
 
+        std::string buildBulkInsertDataSqlQuery(const std::string& insertQuery,
+                                                const size_t rows);
+
         std::string buildDeleteBulkDataSqlQuery(const std::string& table,
                                                 const std::vector<std::string>& primaryKeyList);
 
@@ -228,6 +264,13 @@ class SQLiteDBEngine final : public DbSync::IDbEngine
                           const std::string& fieldName,
                           Row& row);
 
+        void getTableFieldFromJson(const ColumnData& cd,
+                                   const nlohmann::json& element,
+                                   Row& row);
+
+        std::string getPrimaryKeyIndex(const std::vector<std::string>& primaryKeyList,
+                                       const Row& row);
+
         void bindFieldData(const std::shared_ptr<SQLite::IStatement> stmt,
                            const int32_t index,
                            const TableField& fieldData);
@@ -315,14 +358,29 @@ class SQLiteDBEngine final : public DbSync::IDbEngine
                            const nlohmann::json& element,
                            const std::function<void()> callback = {});
 
+        void insertElements(const std::string& table,
+                            const TableColumns& tableColumns,
+                            const std::string& insertQuery,
+                            const std::vector<const nlohmann::json*>& elements);
+
         Utils::MapWrapperSafe<std::string, TableColumns> m_tableFields;
-        std::deque<std::pair<std::string, std::shared_ptr<SQLite::IStatement>>> m_statementsCache;
+        using StatementsCache = std::list<std::pair<std::string, std::shared_ptr<SQLite::IStatement>>>;
+        // Prepared statements by their SQL, which is the same for every table and operation shape. LRU order, the
+        // most recently used first, and an index to find them without comparing the SQL of every statement.
+        StatementsCache m_statementsCache;
+        std::unordered_map<std::string, StatementsCache::iterator> m_statementsIndex;
         const std::shared_ptr<ISQLiteFactory> m_sqliteFactory;
         std::shared_ptr<SQLite::IConnection> m_sqliteConnection;
         std::mutex m_stmtMutex;
         std::unique_ptr<SQLite::ITransaction> m_transaction;
         std::mutex m_maxRowsMutex;
         std::map<std::string, MaxRows> m_maxRows;
+        // Read-only connections free for the selects, only in WAL mode. They see the data committed by the write
+        // connection, so the selects don't wait for the statements of the transaction in progress.
+        std::mutex m_readConnectionsMutex;
+        std::vector<std::shared_ptr<SQLite::IConnection>> m_readConnections;
+        // TEMP tables are private to the write connection, their selects can't use the read connections.
+        std::unordered_set<std::string> m_tempTables;
 };
 
 #endif // _SQLITE_DBENGINE_H
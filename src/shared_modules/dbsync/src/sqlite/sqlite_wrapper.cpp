@@ -39,7 +39,7 @@ static void checkSqliteResult(const int result,
     }
 }
 
-static sqlite3* openSQLiteDb(const std::string& path, const int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE)
+static sqlite3* openSQLiteDb(const std::string& path, const int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX)
 {
     sqlite3* pDb{ nullptr };
     const auto result
@@ -79,6 +79,13 @@ Connection::Connection(const std::string& path)
 #endif
 }
 
+Connection::Connection(const std::string& path, const int flags)
+    : m_db{ openSQLiteDb(path, flags), [](sqlite3 * p)
+{
+    sqlite3_close_v2(p);
+} }
+{}
+
 void Connection::close()
 {
     m_db.reset();
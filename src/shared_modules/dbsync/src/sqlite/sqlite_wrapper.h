@@ -25,6 +25,8 @@ namespace SQLite
             Connection();
             ~Connection() = default;
             explicit Connection(const std::string& path);
+            Connection(const std::string& path, const int flags);
+            Connection(const std::string& path, const bool readOnly);
 
             void execute(const std::string& query) override;
             void close() override;
@@ -21,6 +21,7 @@ class ISQLiteFactory
         virtual ~ISQLiteFactory() = default;
         // LCOV_EXCL_STOP
         virtual std::shared_ptr<SQLite::IConnection> createConnection(const std::string& path) = 0;
+        virtual std::shared_ptr<SQLite::IConnection> createReadOnlyConnection(const std::string& path) = 0;
         virtual std::unique_ptr<SQLite::ITransaction> createTransaction(std::shared_ptr<SQLite::IConnection>& connection) = 0;
         virtual std::unique_ptr<SQLite::IStatement> createStatement(std::shared_ptr<SQLite::IConnection>& connection,
                                                                     const std::string& query) = 0;
@@ -40,6 +41,10 @@ class SQLiteFactory : public ISQLiteFactory
         {
             return std::make_shared<SQLite::Connection>(path);
         }
+        std::shared_ptr<SQLite::IConnection> createReadOnlyConnection(const std::string& path) override
+        {
+            return std::make_shared<SQLite::Connection>(path, SQLITE_OPEN_READONLY | SQLITE_OPEN_FULLMUTEX);
+        }
         std::unique_ptr<SQLite::ITransaction> createTransaction(std::shared_ptr<SQLite::IConnection>& connection) override
         {
             return std::make_unique<SQLite::Transaction>(connection);
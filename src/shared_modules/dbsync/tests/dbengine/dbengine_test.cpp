@@ -347,6 +347,100 @@ TEST_F(DBEngineTest, InitializeStatusFieldPreExistent)
     EXPECT_NO_THROW(spEngine->initializeStatusField(std::vector<std::string> {"dummy"}));
 }
 
+TEST_F(DBEngineTest, InitializeStatusFieldReusesStatement)
+{
+    const auto& mockFactory { std::make_shared<MockSQLiteFactory>() };
+    const auto& mockConnection { std::make_shared<MockConnection>() };
+
+    auto mockTransaction { std::make_unique<MockTransaction>() };
+
+    EXPECT_CALL(*mockFactory, createConnection(_))
+    .WillOnce(Return(mockConnection));
+    EXPECT_CALL(*mockFactory, createTransaction(_))
+    .WillOnce(Return(ByMove(std::move(mockTransaction))));
+
+    auto mockStatement_1 { std::make_unique<MockStatement>() };
+    EXPECT_CALL(*mockStatement_1, step())
+    .WillOnce(Return(SQLITE_DONE));
+    EXPECT_CALL(*mockFactory,
+                createStatement(_, "NNN"))
+    .WillOnce(Return(ByMove(std::move(mockStatement_1))));
+
+
+    EXPECT_CALL(*mockConnection, execute("PRAGMA temp_store = memory;")).Times(1);
+    EXPECT_CALL(*mockConnection, execute("PRAGMA journal_mode = truncate;")).Times(1);
+    EXPECT_CALL(*mockConnection, execute("PRAGMA synchronous = OFF;")).Times(1);
+    EXPECT_CALL(*mockConnection, execute("PRAGMA user_version = 1;")).Times(1);
+
+    std::unique_ptr<SQLiteDBEngine> spEngine;
+    EXPECT_NO_THROW(spEngine = std::make_unique<SQLiteDBEngine>(
+                                   mockFactory,
+                                   "1",
+                                   "NNN"));
+
+    auto mockColumn_1 { std::make_unique<MockColumn>() };
+    EXPECT_CALL(*mockColumn_1, value(An<const int32_t&>()))
+    .WillOnce(Return(0));
+    auto mockColumn_2 { std::make_unique<MockColumn>() };
+    EXPECT_CALL(*mockColumn_2, value(An<const std::string&>()))
+    .WillOnce(Return("PID"));
+    auto mockColumn_3 { std::make_unique<MockColumn>() };
+    EXPECT_CALL(*mockColumn_3, value(An<const std::string&>()))
+    .WillOnce(Return("INTEGER"));
+    auto mockColumn_4 { std::make_unique<MockColumn>() };
+    EXPECT_CALL(*mockColumn_4, value(An<const int32_t&>()))
+    .WillOnce(Return(1));
+
+    auto mockColumn_5 { std::make_unique<MockColumn>() };
+    EXPECT_CALL(*mockColumn_5, value(An<const int32_t&>()))
+    .WillOnce(Return(0));
+    auto mockColumn_6 { std::make_unique<MockColumn>() };
+    EXPECT_CALL(*mockColumn_6, value(An<const std::string&>()))
+    .WillOnce(Return(STATUS_FIELD_NAME));
+    auto mockColumn_7 { std::make_unique<MockColumn>() };
+    EXPECT_CALL(*mockColumn_7, value(An<const std::string&>()))
+    .WillOnce(Return(STATUS_FIELD_TYPE));
+    auto mockColumn_8 { std::make_unique<MockColumn>() };
+    EXPECT_CALL(*mockColumn_8, value(An<const int32_t&>()))
+    .WillOnce(Return(1));
+
+    auto mockStatement_2 { std::make_unique<MockStatement>() };
+    EXPECT_CALL(*mockStatement_2, step())
+    .WillOnce(Return(SQLITE_ROW))
+    .WillOnce(Return(SQLITE_ROW))
+    .WillOnce(Return(SQLITE_DONE));
+    EXPECT_CALL(*mockStatement_2, column(0))
+    .WillOnce(Return(ByMove(std::move(mockColumn_1))))
+    .WillOnce(Return(ByMove(std::move(mockColumn_5))));
+    EXPECT_CALL(*mockStatement_2, column(1))
+    .WillOnce(Return(ByMove(std::move(mockColumn_2))))
+    .WillOnce(Return(ByMove(std::move(mockColumn_6))));
+    EXPECT_CALL(*mockStatement_2, column(2))
+    .WillOnce(Return(ByMove(std::move(mockColumn_3))))
+    .WillOnce(Return(ByMove(std::move(mockColumn_7))));
+    EXPECT_CALL(*mockStatement_2, column(5))
+    .WillOnce(Return(ByMove(std::move(mockColumn_4))))
+    .WillOnce(Return(ByMove(std::move(mockColumn_8))));
+    EXPECT_CALL(*mockFactory,
+                createStatement(_, "PRAGMA table_info(dummy);"))
+    .WillOnce(Return(ByMove(std::move(mockStatement_2))));
+
+    // The statement is prepared once and reset to be used again.
+    auto mockStatement_4 { std::make_unique<MockStatement>() };
+    EXPECT_CALL(*mockStatement_4,
+                step())
+    .Times(2)
+    .WillRepeatedly(Return(0));
+    EXPECT_CALL(*mockStatement_4, reset()).Times(1);
+
+    EXPECT_CALL(*mockFactory,
+                createStatement(_, "UPDATE dummy SET db_status_field_dm=0;"))
+    .WillOnce(Return(ByMove(std::move(mockStatement_4))));
+
+    EXPECT_NO_THROW(spEngine->initializeStatusField(std::vector<std::string> {"dummy"}));
+    EXPECT_NO_THROW(spEngine->initializeStatusField(std::vector<std::string> {"dummy"}));
+}
+
 TEST_F(DBEngineTest, DeleteRowsByStatusField)
 {
     const auto& mockFactory { std::make_shared<MockSQLiteFactory>() };
@@ -650,7 +744,7 @@ TEST_F(DBEngineTest, selectDataWithoutMetadataShouldThrow)
 
     // Due to the no metadata this should throw
     std::shared_timed_mutex mutex;
-    std::unique_lock<std::shared_timed_mutex> lock(mutex);
+    std::shared_lock<std::shared_timed_mutex> lock(mutex);
     EXPECT_THROW(spEngine->selectData("dummy", {}, nullptr, lock), dbengine_error);
 }
 
@@ -1667,6 +1667,118 @@ TEST_F(DBSyncTest, selectCountCPP)
     EXPECT_NO_THROW(dbSync->deleteRows(nlohmann::json::parse(rowDeletePID4)));
 }
 
+TEST_F(DBSyncTest, selectRowsColumnarCPP)
+{
+    std::unique_ptr<DBSync> dbSync;
+
+    const auto sql{ "CREATE TABLE processes(`pid` BIGINT, `name` TEXT, `cpu_percentage` DOUBLE, PRIMARY KEY (`pid`)) WITHOUT ROWID;"};
+    EXPECT_NO_THROW(dbSync = std::make_unique<DBSync>(HostType::AGENT, DbEngineType::SQLITE3, DATABASE_TEMP, sql));
+
+    const auto selectData
+    {
+        R"({"table":"processes",
+           "query":{"column_list":["*"],
+           "row_filter":"",
+           "distinct_opt":false,
+           "order_by_opt":"pid",
+           "count_opt":100}})"
+    };
+
+    const auto insertionSqlStmt{ R"({"table":"processes","data":[{"pid":4,"name":"System1", "cpu_percentage":10.7},
+                                                                 {"pid":115,"name":"System2"},
+                                                                 {"pid":120,"cpu_percentage":22.1}]})"}; // Insert
+
+    std::vector<size_t> batchRows;
+    std::vector<int64_t> pids;
+
+    EXPECT_NO_THROW(dbSync->insertData(nlohmann::json::parse(insertionSqlStmt)));
+    EXPECT_NO_THROW(dbSync->selectRows(nlohmann::json::parse(selectData), 2, [&](const DbSync::ColumnarRows & rows)
+    {
+        EXPECT_EQ(std::vector<std::string>({"pid", "name", "cpu_percentage"}), rows.columns());
+        batchRows.push_back(rows.rows());
+
+        for (size_t row = 0; row < rows.rows(); ++row)
+        {
+            EXPECT_EQ(DbSync::ColumnValueType::Integer, rows.type(0, row));
+            pids.push_back(rows.integer(0, row));
+
+            if (4 == rows.integer(0, row))
+            {
+                EXPECT_EQ("System1", rows.text(1, row));
+                EXPECT_DOUBLE_EQ(10.7, rows.real(2, row));
+            }
+            else if (115 == rows.integer(0, row))
+            {
+                EXPECT_EQ(DbSync::ColumnValueType::Text, rows.type(1, row));
+                EXPECT_EQ(DbSync::ColumnValueType::Null, rows.type(2, row));
+            }
+            else
+            {
+                EXPECT_EQ(DbSync::ColumnValueType::Null, rows.type(1, row));
+                EXPECT_EQ(DbSync::ColumnValueType::Double, rows.type(2, row));
+            }
+        }
+    }));
+
+    EXPECT_EQ(std::vector<size_t>({2, 1}), batchRows);
+    EXPECT_EQ(std::vector<int64_t>({4, 115, 120}), pids);
+    EXPECT_ANY_THROW(dbSync->selectRows(nlohmann::json::parse(selectData), 0, [](const DbSync::ColumnarRows&) {}));
+}
+
+TEST_F(DBSyncTest, insertManyRowsCPP)
+{
+    CallbackMock wrapper;
+    std::unique_ptr<DBSync> dbSync;
+
+    const auto sql{ "CREATE TABLE processes(`pid` BIGINT, `name` TEXT, `tid` BIGINT, PRIMARY KEY (`pid`)) WITHOUT ROWID;"};
+    EXPECT_NO_THROW(dbSync = std::make_unique<DBSync>(HostType::AGENT, DbEngineType::SQLITE3, DATABASE_TEMP, sql));
+
+    const auto selectData
+    {
+        R"({"table":"processes",
+           "query":{"column_list":["count(*) AS count", "sum(tid) AS tids"],
+           "row_filter":"",
+           "distinct_opt":false,
+           "order_by_opt":"",
+           "count_opt":100}})"
+    };
+
+    // Several chunks of rows, with groups of elements with different fields.
+    nlohmann::json insertionData { {"table", "processes"}, {"data", nlohmann::json::array()} };
+
+    for (auto pid = 0; pid < 1003; ++pid)
+    {
+        nlohmann::json element { {"pid", pid}, {"name", "System" + std::to_string(pid)} };
+
+        if (pid % 300 < 150)
+        {
+            element["tid"] = 1;
+        }
+
+        insertionData["data"].push_back(element);
+    }
+
+    const auto duplicatedRows{ R"({"table":"processes","data":[{"pid":2000,"tid":1},{"pid":2001,"tid":1},{"pid":2001,"tid":1},{"pid":2002,"tid":1}]})"};
+
+    EXPECT_CALL(wrapper, callbackMock(SELECTED, nlohmann::json::parse(R"({"count":1003,"tids":553})"))).Times(1);
+    EXPECT_CALL(wrapper, callbackMock(SELECTED, nlohmann::json::parse(R"({"count":1005,"tids":555})"))).Times(1);
+
+    ResultCallbackData selectCallbackData
+    {
+        [&wrapper](ReturnTypeCallback type, const nlohmann::json & jsonResult)
+        {
+            wrapper.callbackMock(type, jsonResult);
+        }
+    };
+
+    EXPECT_NO_THROW(dbSync->insertData(insertionData));
+    EXPECT_NO_THROW(dbSync->selectRows(nlohmann::json::parse(selectData), selectCallbackData));
+
+    // The rows before the duplicated one are inserted, as when the rows are inserted one by one.
+    EXPECT_ANY_THROW(dbSync->insertData(nlohmann::json::parse(duplicatedRows)));
+    EXPECT_NO_THROW(dbSync->selectRows(nlohmann::json::parse(selectData), selectCallbackData));
+}
+
 TEST_F(DBSyncTest, TryToInsertMoreThanMaxRowsCPP)
 {
     const auto sql{ "CREATE TABLE processes(`pid` BIGINT, `name` TEXT, PRIMARY KEY (`pid`)) WITHOUT ROWID;"};
@@ -2052,6 +2164,133 @@ TEST_F(DBSyncTest, UpdateDataCPP)
     EXPECT_NO_THROW(dbSync->updateWithSnapshot(nlohmann::json::parse(insertionSqlStmt2), callbackData));
 }
 
+TEST_F(DBSyncTest, UpdateDataInMemoryDiffCPP)
+{
+    const auto sql{ "CREATE TABLE processes(`pid` BIGINT, `name` TEXT, `tid` INTEGER, `path` TEXT, PRIMARY KEY (`pid`,`name`)) WITHOUT ROWID;"};
+    const auto insertionSqlStmt1{ R"({"table":"processes","options":{"in_memory_diff":true},
+                                      "data":[{"pid":4,"name":"System","tid":1,"path":"C:\\"},{"pid":5,"name":"cmd","tid":2},{"pid":6,"name":"Test","tid":3}]})"};
+    const auto insertionSqlStmt2{ R"({"table":"processes","options":{"in_memory_diff":true},
+                                      "data":[{"pid":4,"name":"System","tid":7,"path":"C:\\"},{"pid":6,"name":"Test","tid":"3","path":"D:\\"},{"pid":"8","name":"powershell"}]})"};
+
+    std::unique_ptr<DBSync> dbSync;
+    EXPECT_NO_THROW(dbSync = std::make_unique<DBSync>(HostType::AGENT, DbEngineType::SQLITE3, DATABASE_TEMP, sql));
+
+    nlohmann::json jsResponse;
+
+    EXPECT_NO_THROW(dbSync->updateWithSnapshot(nlohmann::json::parse(insertionSqlStmt1), jsResponse));
+    EXPECT_EQ(3u, jsResponse.at("inserted").size());
+
+    CallbackMock wrapper;
+    EXPECT_CALL(wrapper, callbackMock(DELETED, nlohmann::json::parse(R"({"name":"cmd","pid":5})"))).Times(1);
+    EXPECT_CALL(wrapper, callbackMock(MODIFIED, nlohmann::json::parse(R"({"PK_name":"System","PK_pid":4,"tid":7})"))).Times(1);
+    EXPECT_CALL(wrapper, callbackMock(MODIFIED, nlohmann::json::parse(R"({"PK_name":"Test","PK_pid":6,"path":"D:\\"})"))).Times(1);
+    EXPECT_CALL(wrapper, callbackMock(INSERTED, nlohmann::json::parse(R"({"name":"powershell","path":"","pid":8,"tid":0})"))).Times(1);
+
+    ResultCallbackData callbackData
+    {
+        [&wrapper](ReturnTypeCallback type, const nlohmann::json & jsonResult)
+        {
+            wrapper.callbackMock(type, jsonResult);
+        }
+    };
+
+    EXPECT_NO_THROW(dbSync->updateWithSnapshot(nlohmann::json::parse(insertionSqlStmt2), callbackData));
+
+    // Nothing changed, so there are no events.
+    CallbackMock emptyWrapper;
+    EXPECT_CALL(emptyWrapper, callbackMock(testing::_, testing::_)).Times(0);
+
+    ResultCallbackData emptyCallbackData
+    {
+        [&emptyWrapper](ReturnTypeCallback type, const nlohmann::json & jsonResult)
+        {
+            emptyWrapper.callbackMock(type, jsonResult);
+        }
+    };
+
+    EXPECT_NO_THROW(dbSync->updateWithSnapshot(nlohmann::json::parse(insertionSqlStmt2), emptyCallbackData));
+}
+
+TEST_F(DBSyncTest, UpdateDataMemoryTableCPP)
+{
+    const auto sql{ "CREATE TEMP TABLE processes(`pid` BIGINT, `name` TEXT, `tid` INTEGER, PRIMARY KEY (`pid`)) WITHOUT ROWID;"};
+    const auto insertionSqlStmt1{ R"({"table":"processes","data":[{"pid":4,"name":"System","tid":1},{"pid":5,"name":"cmd","tid":2}]})"};
+    const auto insertionSqlStmt2{ R"({"table":"processes","data":[{"pid":4,"name":"System","tid":7},{"pid":6,"name":"Test","tid":3}]})"};
+
+    std::unique_ptr<DBSync> dbSync;
+    EXPECT_NO_THROW(dbSync = std::make_unique<DBSync>(HostType::AGENT, DbEngineType::SQLITE3, DATABASE_TEMP, sql));
+
+    nlohmann::json jsResponse;
+
+    EXPECT_NO_THROW(dbSync->updateWithSnapshot(nlohmann::json::parse(insertionSqlStmt1), jsResponse));
+    EXPECT_EQ(2u, jsResponse.at("inserted").size());
+
+    CallbackMock wrapper;
+    EXPECT_CALL(wrapper, callbackMock(DELETED, nlohmann::json::parse(R"({"pid":5})"))).Times(1);
+    EXPECT_CALL(wrapper, callbackMock(MODIFIED, nlohmann::json::parse(R"({"PK_pid":4,"tid":7})"))).Times(1);
+    EXPECT_CALL(wrapper, callbackMock(INSERTED, nlohmann::json::parse(R"({"name":"Test","pid":6,"tid":3})"))).Times(1);
+
+    ResultCallbackData callbackData
+    {
+        [&wrapper](ReturnTypeCallback type, const nlohmann::json & jsonResult)
+        {
+            wrapper.callbackMock(type, jsonResult);
+        }
+    };
+
+    EXPECT_NO_THROW(dbSync->updateWithSnapshot(nlohmann::json::parse(insertionSqlStmt2), callbackData));
+}
+
+TEST_F(DBSyncTest, ReadConnectionsCPP)
+{
+    const auto sql
+    {
+        "CREATE TABLE processes(`pid` BIGINT, `name` TEXT, PRIMARY KEY (`pid`)) WITHOUT ROWID;"
+        "CREATE TEMP TABLE ports(`port` BIGINT, PRIMARY KEY (`port`)) WITHOUT ROWID;"
+    };
+    const auto insertProcesses{ R"({"table":"processes","data":[{"pid":4,"name":"System"},{"pid":5,"name":"cmd"}]})"};
+    const auto insertPorts{ R"({"table":"ports","data":[{"port":22}]})"};
+
+    const auto count
+    {
+        [](std::unique_ptr<DBSync>& dbSync, const std::string & table)
+        {
+            const auto selectData
+            {
+                R"({"table":")" + table + R"(",
+                   "query":{"column_list":["count(*) AS count"],
+                   "row_filter":"",
+                   "distinct_opt":false,
+                   "order_by_opt":"",
+                   "count_opt":100}})"
+            };
+            int64_t result { -1 };
+            dbSync->selectRows(nlohmann::json::parse(selectData), [&result](ReturnTypeCallback, const nlohmann::json & jsonResult)
+            {
+                result = jsonResult.at("count").get<int64_t>();
+            });
+            return result;
+        }
+    };
+
+    std::unique_ptr<DBSync> dbSync;
+    EXPECT_NO_THROW(dbSync = std::make_unique<DBSync>(HostType::AGENT, DbEngineType::SQLITE3, DATABASE_TEMP, sql, DbManagement::VOLATILE, std::vector<std::string> {}, 2));
+
+    EXPECT_NO_THROW(dbSync->insertData(nlohmann::json::parse(insertProcesses)));
+    EXPECT_NO_THROW(dbSync->insertData(nlohmann::json::parse(insertPorts)));
+
+    // The read connections don't see the rows of the transaction in progress.
+    EXPECT_EQ(0, count(dbSync, "processes"));
+    // TEMP tables are only visible to the write connection.
+    EXPECT_EQ(1, count(dbSync, "ports"));
+
+    // The engine commits on destruction, the rows are there when the database is reused.
+    dbSync.reset();
+    EXPECT_NO_THROW(dbSync = std::make_unique<DBSync>(HostType::AGENT, DbEngineType::SQLITE3, DATABASE_TEMP, sql, DbManagement::PERSISTENT, std::vector<std::string> {}, 2));
+    EXPECT_EQ(2, count(dbSync, "processes"));
+    EXPECT_EQ(0, count(dbSync, "ports"));
+}
+
 TEST_F(DBSyncTest, constructorWithHandle)
 {
     const auto sql{ "CREATE TABLE processes(`pid` BIGINT, `name` TEXT, PRIMARY KEY (`pid`)) WITHOUT ROWID;"};
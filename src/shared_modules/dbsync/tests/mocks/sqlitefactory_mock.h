@@ -23,6 +23,10 @@ class MockSQLiteFactory : public ISQLiteFactory
                     createConnection,
                     (const std::string& path),
                     (override));
+        MOCK_METHOD(std::shared_ptr<SQLite::IConnection>,
+                    createReadOnlyConnection,
+                    (const std::string& path),
+                    (override));
         MOCK_METHOD(std::unique_ptr<SQLite::ITransaction>,
                     createTransaction,
                     (std::shared_ptr<SQLite::IConnection>& connection),
@@ -0,0 +1,369 @@
+/*
+ * Wazuh DBSYNC
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <json.hpp>
+#include "dbsync.hpp"
+
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+// Same schemas as the syscollector packages and processes tables.
+constexpr auto BENCHMARK_SQL_STATEMENT
+{
+    R"(CREATE TABLE dbsync_packages(
+    name TEXT,
+    version TEXT,
+    vendor TEXT,
+    install_time TEXT,
+    location TEXT,
+    architecture TEXT,
+    groups TEXT,
+    description TEXT,
+    size INTEGER,
+    priority TEXT,
+    multiarch TEXT,
+    source TEXT,
+    format TEXT,
+    checksum TEXT,
+    item_id TEXT,
+    PRIMARY KEY (name,version,architecture,format,location)) WITHOUT ROWID;
+    CREATE TABLE dbsync_processes (
+    pid TEXT,
+    name TEXT,
+    state TEXT,
+    ppid BIGINT,
+    utime BIGINT,
+    stime BIGINT,
+    cmd TEXT,
+    argvs TEXT,
+    euser TEXT,
+    ruser TEXT,
+    suser TEXT,
+    egroup TEXT,
+    rgroup TEXT,
+    sgroup TEXT,
+    fgroup TEXT,
+    priority BIGINT,
+    nice BIGINT,
+    size BIGINT,
+    vm_size BIGINT,
+    resident BIGINT,
+    share BIGINT,
+    start_time BIGINT,
+    pgrp BIGINT,
+    session BIGINT,
+    nlwp BIGINT,
+    tgid BIGINT,
+    tty BIGINT,
+    processor BIGINT,
+    checksum TEXT,
+    PRIMARY KEY (pid)) WITHOUT ROWID;)"
+};
+
+constexpr auto BENCHMARK_PACKAGES_TABLE { "dbsync_packages" };
+constexpr auto BENCHMARK_PROCESSES_TABLE { "dbsync_processes" };
+constexpr auto BENCHMARK_QUEUE_SIZE { 4096 };
+
+/**
+ * @brief Synthetic syscollector-like workload: every round is a scan of each table inside a dbsync transaction,
+ * where a percentage of the rows changed since the previous scan. Half of the churned rows are modified and the
+ * other half are replaced by new rows (one deletion plus one insertion).
+ */
+class Benchmark final
+{
+    public:
+        Benchmark(const std::string& dbPath,
+                  const size_t rows,
+                  const size_t rounds,
+                  const size_t churn)
+            : m_dbPath{ dbPath }
+            , m_rows{ rows }
+            , m_rounds{ rounds }
+            , m_churn{ churn }
+        {}
+
+        void run()
+        {
+            DBSync dbSync{ HostType::AGENT, DbEngineType::SQLITE3, m_dbPath, BENCHMARK_SQL_STATEMENT };
+            std::vector<TableState> tables
+            {
+                { BENCHMARK_PACKAGES_TABLE, &Benchmark::packageRow, {}, {} },
+                { BENCHMARK_PROCESSES_TABLE, &Benchmark::processRow, {}, {} }
+            };
+
+            for (auto& table : tables)
+            {
+                for (size_t i = 0; i < m_rows; ++i)
+                {
+                    table.keys.push_back(m_nextKey++);
+                    table.revisions.push_back(0);
+                }
+            }
+
+            const auto ioBefore { writeCounters() };
+            const auto start { std::chrono::steady_clock::now() };
+
+            // The first round loads the tables, the next ones apply the churn.
+            for (size_t round = 0; round <= m_rounds; ++round)
+            {
+                for (auto& table : tables)
+                {
+                    if (round > 0)
+                    {
+                        applyChurn(table);
+                    }
+
+                    scan(dbSync, table, round);
+                }
+            }
+
+            const std::chrono::duration<double> elapsed { std::chrono::steady_clock::now() - start };
+            const auto ioAfter { writeCounters() };
+
+            report(elapsed.count(), ioBefore, ioAfter);
+        }
+
+    private:
+        using RowGenerator = nlohmann::json (*)(const size_t key, const size_t revision);
+
+        struct TableState final
+        {
+            std::string name;
+            RowGenerator generator;
+            std::vector<size_t> keys;
+            std::vector<size_t> revisions;
+        };
+
+        struct WriteCounters final
+        {
+            bool available;
+            uint64_t calls;
+            uint64_t bytes;
+        };
+
+        static nlohmann::json packageRow(const size_t key, const size_t revision)
+        {
+            const auto name { "package-" + std::to_string(key) };
+            return
+            {
+                {"name", name},
+                {"version", "1.0." + std::to_string(key % 100)},
+                {"vendor", "Wazuh"},
+                {"install_time", "2026/10/15 00:00:00"},
+                {"location", " "},
+                {"architecture", "amd64"},
+                {"groups", "admin"},
+                {"description", name + " revision " + std::to_string(revision)},
+                {"size", static_cast<int64_t>(1024 + revision)},
+                {"priority", "optional"},
+                {"multiarch", " "},
+                {"source", name},
+                {"format", "deb"},
+                {"checksum", std::to_string(key) + ":" + std::to_string(revision)},
+                {"item_id", std::to_string(key)}
+            };
+        }
+
+        static nlohmann::json processRow(const size_t key, const size_t revision)
+        {
+            return
+            {
+                {"pid", std::to_string(key)},
+                {"name", "process-" + std::to_string(key)},
+                {"state", "S"},
+                {"ppid", 1},
+                {"utime", static_cast<int64_t>(revision * 10)},
+                {"stime", static_cast<int64_t>(revision * 5)},
+                {"cmd", "/usr/bin/process-" + std::to_string(key)},
+                {"argvs", "--foreground"},
+                {"euser", "root"},
+                {"ruser", "root"},
+                {"suser", "root"},
+                {"egroup", "root"},
+                {"rgroup", "root"},
+                {"sgroup", "root"},
+                {"fgroup", "root"},
+                {"priority", 20},
+                {"nice", 0},
+                {"size", 1024},
+                {"vm_size", 4096},
+                {"resident", static_cast<int64_t>(512 + revision)},
+                {"share", 256},
+                {"start_time", 1760486400},
+                {"pgrp", static_cast<int64_t>(key)},
+                {"session", static_cast<int64_t>(key)},
+                {"nlwp", 1},
+                {"tgid", static_cast<int64_t>(key)},
+                {"tty", 0},
+                {"processor", static_cast<int64_t>(key % 8)},
+                {"checksum", std::to_string(key) + ":" + std::to_string(revision)}
+            };
+        }
+
+        void applyChurn(TableState& table)
+        {
+            const auto churned { m_rows * m_churn / 100 };
+
+            // Walk the table with a stride so the churned rows are spread across the primary key space.
+            for (size_t i = 0; i < churned; ++i)
+            {
+                const auto index { (m_cursor + i * 7919) % m_rows };
+
+                if (i % 2 == 0)
+                {
+                    ++table.revisions[index];
+                }
+                else
+                {
+                    table.keys[index] = m_nextKey++;
+                    table.revisions[index] = 0;
+                }
+            }
+
+            m_cursor += churned;
+        }
+
+        void scan(DBSync& dbSync, const TableState& table, const size_t round)
+        {
+            size_t events { 0 };
+            const auto callback
+            {
+                [&events](ReturnTypeCallback, const nlohmann::json&)
+                {
+                    ++events;
+                }
+            };
+
+            const auto start { std::chrono::steady_clock::now() };
+            {
+                DBSyncTxn txn{ dbSync.handle(), nlohmann::json{table.name}, 0, BENCHMARK_QUEUE_SIZE, callback };
+                nlohmann::json input;
+                input["table"] = table.name;
+
+                for (size_t i = 0; i < m_rows; ++i)
+                {
+                    input["data"] = nlohmann::json::array({ table.generator(table.keys[i], table.revisions[i]) });
+                    txn.syncTxnRow(input);
+                }
+
+                txn.getDeletedRows(callback);
+            }
+            const std::chrono::duration<double, std::milli> latency { std::chrono::steady_clock::now() - start };
+
+            m_latencies.push_back(latency.count());
+            m_operations += m_rows;
+            m_events += events;
+
+            std::cout << "Round " << round << " " << table.name << ": " << events << " events in "
+                      << std::fixed << std::setprecision(2) << latency.count() << " ms" << std::endl;
+        }
+
+        // Write syscalls issued by the process. SQLite writes its database and journal pages one write call each,
+        // so the difference between two readings approximates the page writes.
+        static WriteCounters writeCounters()
+        {
+            WriteCounters counters { false, 0, 0 };
+            std::ifstream io{ "/proc/self/io" };
+            std::string key;
+            uint64_t value { 0 };
+
+            while (io >> key >> value)
+            {
+                if (key == "syscw:")
+                {
+                    counters.calls = value;
+                    counters.available = true;
+                }
+                else if (key == "wchar:")
+                {
+                    counters.bytes = value;
+                }
+            }
+
+            return counters;
+        }
+
+        static long peakRssKb()
+        {
+#ifndef WIN32
+            struct rusage usage {};
+
+            if (0 == getrusage(RUSAGE_SELF, &usage))
+            {
+                return usage.ru_maxrss;
+            }
+
+#endif
+            return -1;
+        }
+
+        double percentile(const double value) const
+        {
+            const auto index { static_cast<size_t>(value * (m_latencies.size() - 1)) };
+            return m_latencies[index];
+        }
+
+        void report(const double elapsed,
+                    const WriteCounters& ioBefore,
+                    const WriteCounters& ioAfter)
+        {
+            std::sort(m_latencies.begin(), m_latencies.end());
+            const auto total { std::accumulate(m_latencies.begin(), m_latencies.end(), 0.0) };
+
+            std::cout << std::endl << std::fixed << std::setprecision(2)
+                      << "Rows per table:        " << m_rows << std::endl
+                      << "Churn rounds:          " << m_rounds << " (" << m_churn << "% per round)" << std::endl
+                      << "Synced rows:           " << m_operations << std::endl
+                      << "Diff events:           " << m_events << std::endl
+                      << "Elapsed:               " << elapsed << " s" << std::endl
+                      << "Throughput:            " << m_operations / elapsed << " ops/s" << std::endl
+                      << "Transaction latency:   avg " << total / m_latencies.size()
+                      << " ms, p50 " << percentile(0.5)
+                      << " ms, p95 " << percentile(0.95)
+                      << " ms, max " << m_latencies.back() << " ms" << std::endl;
+
+            if (ioBefore.available && ioAfter.available)
+            {
+                std::cout << "Page writes:           " << ioAfter.calls - ioBefore.calls
+                          << " (" << (ioAfter.bytes - ioBefore.bytes) / 1024 << " KB)" << std::endl;
+            }
+            else
+            {
+                std::cout << "Page writes:           n/a" << std::endl;
+            }
+
+            std::cout << "Peak RSS:              " << peakRssKb() << " KB" << std::endl;
+        }
+
+        const std::string m_dbPath;
+        const size_t m_rows;
+        const size_t m_rounds;
+        const size_t m_churn;
+        size_t m_nextKey { 0 };
+        size_t m_cursor { 0 };
+        size_t m_operations { 0 };
+        size_t m_events { 0 };
+        std::vector<double> m_latencies;
+};
+
+#endif // _BENCHMARK_H_
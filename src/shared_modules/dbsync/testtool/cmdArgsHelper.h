@@ -21,10 +21,28 @@ class CmdLineArgs
 {
     public:
         CmdLineArgs(const int argc, const char* argv[])
-            : m_configFile{ paramValueOf(argc, argv, "-c") }
-            , m_outputFolder{ paramValueOf(argc, argv, "-o") }
-            , m_actions{ splitActions(paramValueOf(argc, argv, "-a")) }
-        {}
+            : m_benchmark{ switchPresent(argc, argv, "-b") }
+            , m_configFile{ paramValueOf(argc, argv, "-c", !m_benchmark) }
+            , m_outputFolder{ paramValueOf(argc, argv, "-o", !m_benchmark) }
+            , m_actions{ splitActions(paramValueOf(argc, argv, "-a", !m_benchmark)) }
+            , m_benchmarkDb{ paramValueOf(argc, argv, "-d", false, "benchmark.db") }
+            , m_rows{ std::stoull(paramValueOf(argc, argv, "-r", false, "10000")) }
+            , m_rounds{ std::stoull(paramValueOf(argc, argv, "-n", false, "10")) }
+            , m_churn{ std::stoull(paramValueOf(argc, argv, "-p", false, "5")) }
+        {
+            if (m_benchmark && (0 == m_rows || m_churn > 100))
+            {
+                throw std::runtime_error
+                {
+                    "The benchmark rows must be greater than zero and the churn a percentage."
+                };
+            }
+        }
+
+        bool benchmark() const
+        {
+            return m_benchmark;
+        }
 
         const std::string& configFile() const
         {
@@ -41,6 +59,26 @@ class CmdLineArgs
             return m_outputFolder;
         }
 
+        const std::string& benchmarkDb() const
+        {
+            return m_benchmarkDb;
+        }
+
+        size_t rows() const
+        {
+            return m_rows;
+        }
+
+        size_t rounds() const
+        {
+            return m_rounds;
+        }
+
+        size_t churn() const
+        {
+            return m_churn;
+        }
+
         static void showHelp()
         {
             std::cout << "\nUsage: dbsync_test_tool <option(s)> SOURCES \n"
@@ -49,8 +87,14 @@ class CmdLineArgs
                       << "\t-c JSON_CONFIG_FILE\tSpecifies the json config file to initialize the database.\n"
                       << "\t-a ACTION_LIST\t\tSpecifies the list of actions to exercise the database.\n"
                       << "\t-o OUTPUT_FOLDER\tSpecifies the output folder path where the results will be generated.\n"
+                      << "\t-b \t\t\tRuns the benchmark mode instead of the actions.\n"
+                      << "\t-d DB_FILE\t\tBenchmark database file (default benchmark.db).\n"
+                      << "\t-r ROWS\t\t\tBenchmark rows of each table (default 10000).\n"
+                      << "\t-n ROUNDS\t\tBenchmark churn rounds after the initial load (default 10).\n"
+                      << "\t-p CHURN\t\tPercentage of the rows changed in each round (default 5).\n"
                       << "\nExample:"
-                      << "\n\t./dbsync_test_tool -c config.json -a input1.json,input2.json,input3.json -o ./output\n"
+                      << "\n\t./dbsync_test_tool -c config.json -a input1.json,input2.json,input3.json -o ./output"
+                      << "\n\t./dbsync_test_tool -b -r 50000 -n 20 -p 10\n"
                       << std::endl;
         }
 
@@ -58,7 +102,9 @@ class CmdLineArgs
 
         static std::string paramValueOf(const int argc,
                                         const char* argv[],
-                                        const std::string& switchValue)
+                                        const std::string& switchValue,
+                                        const bool required = true,
+                                        const std::string& defaultValue = "")
         {
             for (int i = 1; i < argc; ++i)
             {
@@ -71,10 +117,30 @@ class CmdLineArgs
                 }
             }
 
-            throw std::runtime_error
+            if (required)
+            {
+                throw std::runtime_error
+                {
+                    "Switch value: " + switchValue + " not found."
+                };
+            }
+
+            return defaultValue;
+        }
+
+        static bool switchPresent(const int argc,
+                                  const char* argv[],
+                                  const std::string& switchValue)
+        {
+            for (int i = 1; i < argc; ++i)
             {
-                "Switch value: " + switchValue + " not found."
-            };
+                if (switchValue == argv[i])
+                {
+                    return true;
+                }
+            }
+
+            return false;
         }
 
         static std::vector<std::string> splitActions(const std::string& values)
@@ -92,9 +158,14 @@ class CmdLineArgs
             return actionsValues;
         }
 
+        const bool m_benchmark;
         const std::string m_configFile;
         const std::string m_outputFolder;
         const std::vector<std::string> m_actions;
+        const std::string m_benchmarkDb;
+        const size_t m_rows;
+        const size_t m_rounds;
+        const size_t m_churn;
 };
 
 #endif // _CMD_LINE_ARGS_HELPER_H_
\ No newline at end of file
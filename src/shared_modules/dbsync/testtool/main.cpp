@@ -19,6 +19,7 @@
 #include "testContext.h"
 #include "action.h"
 #include "factoryAction.h"
+#include "benchmark.h"
 
 static void loggerFunction(const char* msg)
 {
@@ -31,6 +32,15 @@ int main(int argc, const char* argv[])
     {
         CmdLineArgs cmdLineArgs(argc, argv);
 
+        if (cmdLineArgs.benchmark())
+        {
+            dbsync_initialize(loggerFunction);
+            Benchmark benchmark{ cmdLineArgs.benchmarkDb(), cmdLineArgs.rows(), cmdLineArgs.rounds(), cmdLineArgs.churn() };
+            benchmark.run();
+            dbsync_teardown();
+            return 0;
+        }
+
         const auto actions { cmdLineArgs.actions() };
 
         // dbsync configuration data
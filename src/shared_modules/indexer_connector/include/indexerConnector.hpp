@@ -27,6 +27,7 @@ class SecureCommunication;
 #include "threadEventDispatcher.hpp"
 #include <json.hpp>
 #include <string>
+#include <vector>
 
 using ThreadDispatchQueue = ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>>;
 using ThreadSyncQueue = Utils::AsyncDispatcher<std::string, std::function<void(const std::string&)>>;
@@ -49,6 +50,8 @@ class EXPORTED IndexerConnector final
     std::unique_ptr<Utils::RocksDBWrapper> m_db;
     std::unique_ptr<ThreadSyncQueue> m_syncQueue;
     std::string m_indexName;
+    std::string m_digestsIndexName;
+    std::string m_bulkEndpoint;
     std::mutex m_syncMutex;
     std::unique_ptr<ThreadDispatchQueue> m_dispatcher;
     std::unordered_map<std::string, std::chrono::system_clock::time_point> m_lastSync;
@@ -57,11 +60,13 @@ class EXPORTED IndexerConnector final
      * @brief This method is used to calculate the diff between the inventory database and the indexer.
      * @param responseJson Response JSON.
      * @param agentId Agent ID.
+     * @param digest Digest of the agent documents, stored in the indexer once they are synced.
      * @param secureCommunication Secure communication.
      * @param selector Server selector.
      */
     void diff(const nlohmann::json& responseJson,
               const std::string& agentId,
+              const std::string& digest,
               const SecureCommunication& secureCommunication,
               const std::shared_ptr<ServerSelector>& selector);
 
@@ -76,6 +81,24 @@ class EXPORTED IndexerConnector final
                                         const std::string& agentId,
                                         const SecureCommunication& secureCommunication) const;
 
+    /**
+     * @brief Digest of the agent documents in the inventory database.
+     * @param agentId Agent ID.
+     * @return Hex digest of the document ids and contents.
+     */
+    std::string agentDigest(const std::string& agentId);
+
+    /**
+     * @brief Get the digest of the agent documents stored in the indexer by the last sync.
+     * @param url Indexer URL.
+     * @param agentId Agent ID.
+     * @param secureCommunication Secure communication.
+     * @return Stored digest, empty if there is none.
+     */
+    std::string indexedDigest(const std::string& url,
+                              const std::string& agentId,
+                              const SecureCommunication& secureCommunication) const;
+
     /**
      * @brief Abuse control.
      * @param agentId Agent ID.
@@ -110,6 +133,13 @@ public:
      */
     void publish(const std::string& message);
 
+    /**
+     * @brief Publish a batch of messages into the queue map, as a single element.
+     *
+     * @param messages Serialized messages to be published.
+     */
+    void publish(const std::vector<std::string>& messages);
+
     /**
      * @brief Sync the inventory database with the indexer.
      * This method is used to synchronize the inventory database to the indexer.
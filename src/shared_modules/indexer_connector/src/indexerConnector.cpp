@@ -11,17 +11,31 @@
 
 #include "indexerConnector.hpp"
 #include "HTTPRequest.hpp"
+#include "hashHelper.h"
 #include "keyStore.hpp"
 #include "loggerHelper.h"
 #include "secureCommunication.hpp"
 #include "serverSelector.hpp"
+#include "stringHelper.h"
+#include <chrono>
 #include <fstream>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
 
 constexpr auto NOT_USED {-1};
 constexpr auto INDEXER_COLUMN {"indexer"};
 constexpr auto USER_KEY {"username"};
 constexpr auto PASSWORD_KEY {"password"};
 constexpr auto ELEMENTS_PER_BULK {1000};
+// Keep each bulk request within the size recommended for the indexer bulk API, whatever the size of the documents.
+constexpr auto MAX_BULK_SIZE {10 * 1024 * 1024};
+constexpr auto BULK_ENDPOINT {"/_bulk"};
+constexpr auto BULK_WAIT_FOR_REFRESH_ENDPOINT {"/_bulk?refresh=wait_for"};
+// The digests are kept out of the synced index, whose mapping is strict, and out of the patterns that match it.
+constexpr auto DIGESTS_INDEX_PREFIX {"wazuh-digests-"};
+// Status of the bulks, and of the bulk items, rejected because the indexer write queue is full.
+constexpr auto HTTP_TOO_MANY_REQUESTS {429};
 
 namespace Log
 {
@@ -72,8 +86,10 @@ static void initConfiguration(SecureCommunication& secureCommunication, const nl
         }
     }
 
-    Keystore::get(INDEXER_COLUMN, USER_KEY, username);
-    Keystore::get(INDEXER_COLUMN, PASSWORD_KEY, password);
+    std::vector<std::string> credentials;
+    Keystore::get(INDEXER_COLUMN, {USER_KEY, PASSWORD_KEY}, credentials);
+    username = std::move(credentials[0]);
+    password = std::move(credentials[1]);
 
     if (username.empty() && password.empty())
     {
@@ -116,6 +132,13 @@ static void builderBulkIndex(std::string& bulkData, std::string_view id, std::st
     bulkData.append("\n");
 }
 
+static bool isBulkThrottled(std::string_view response)
+{
+    // Only the responses with errors are searched, the item statuses are not parsed for the successful bulks.
+    return response.find(R"("errors":true)") != std::string_view::npos &&
+           response.find(R"("status":429)") != std::string_view::npos;
+}
+
 bool IndexerConnector::abuseControl(const std::string& agentId)
 {
     const auto currentTime = std::chrono::system_clock::now();
@@ -186,8 +209,55 @@ nlohmann::json IndexerConnector::getAgentDocumentsIds(const std::string& url,
     return responseJson;
 }
 
+std::string IndexerConnector::agentDigest(const std::string& agentId)
+{
+    Utils::HashData hash;
+
+    // The documents are iterated in key order, so the same content always gives the same digest.
+    for (const auto& [key, value] : m_db->seek(agentId))
+    {
+        hash.update(key.data(), key.size() + 1);
+        hash.update(value.data(), value.size());
+        hash.update("\n", 1);
+    }
+
+    return Utils::asciiToHex(hash.hash());
+}
+
+std::string IndexerConnector::indexedDigest(const std::string& url,
+                                            const std::string& agentId,
+                                            const SecureCommunication& secureCommunication) const
+{
+    std::string digest;
+
+    HTTPRequest::instance().get(
+        HttpURL(url + "/" + m_digestsIndexName + "/_doc/" + agentId),
+        [&digest](const std::string& response)
+        {
+            const auto responseJson = nlohmann::json::parse(response);
+            if (responseJson.contains("_source") && responseJson.at("_source").contains("digest"))
+            {
+                digest = responseJson.at("_source").at("digest").get<std::string>();
+            }
+        },
+        [](const std::string& error, const long statusCode)
+        {
+            // An agent that was never synced, or whose digest was lost with a restore, has no digest.
+            if (statusCode != 404)
+            {
+                throw std::runtime_error(error);
+            }
+        },
+        "",
+        DEFAULT_HEADERS,
+        secureCommunication);
+
+    return digest;
+}
+
 void IndexerConnector::diff(const nlohmann::json& responseJson,
                             const std::string& agentId,
+                            const std::string& digest,
                             const SecureCommunication& secureCommunication,
                             const std::shared_ptr<ServerSelector>& selector)
 {
@@ -203,26 +273,21 @@ void IndexerConnector::diff(const nlohmann::json& responseJson,
         }
     }
 
-    // Iterate over the database and check if the element is in the status vector.
+    // Iterate over the database and mark the elements that are in the indexer. As the digests diverge, any of them
+    // may be outdated in the indexer, so all of them are indexed again.
     for (const auto& [key, value] : m_db->seek(agentId))
     {
-        bool found {false};
         for (auto& [id, data] : status)
         {
             // If the element is found, mark it as found.
             if (key.compare(id) == 0)
             {
                 data = true;
-                found = true;
                 break;
             }
         }
 
-        // If the element is not found, add it to the actions vector. This element will be added to the indexer.
-        if (!found)
-        {
-            actions.emplace_back(key, false);
-        }
+        actions.emplace_back(key, false);
     }
 
     // Iterate over the status vector and check if the element is marked as not found.
@@ -236,9 +301,31 @@ void IndexerConnector::diff(const nlohmann::json& responseJson,
     }
 
     auto url = selector->getNext();
-    url.append("/_bulk?refresh=wait_for");
+    url.append(m_bulkEndpoint);
 
     std::string bulkData;
+    const auto postBulk = [&]()
+    {
+        HTTPRequest::instance().post(
+            HttpURL(url),
+            bulkData,
+            [](const std::string& response)
+            {
+                logDebug2(IC_NAME, "Response: %s", response.c_str());
+                // The digest is only stored once every document made it to the indexer.
+                if (const auto responseJson = nlohmann::json::parse(response, nullptr, false);
+                    !responseJson.is_discarded() && responseJson.value("errors", false))
+                {
+                    throw std::runtime_error("Some documents were not indexed.");
+                }
+            },
+            [](const std::string& error, const long statusCode) { throw std::runtime_error(error); },
+            "",
+            DEFAULT_HEADERS,
+            secureCommunication);
+        bulkData.clear();
+    };
+
     // Iterate over the actions vector and build the bulk data.
     // If the element is marked as deleted, the element will be deleted from the indexer.
     // If the element is not marked as deleted, the element will be added to the indexer.
@@ -257,19 +344,21 @@ void IndexerConnector::diff(const nlohmann::json& responseJson,
             }
             builderBulkIndex(bulkData, id, m_indexName, data);
         }
+
+        if (bulkData.size() >= MAX_BULK_SIZE)
+        {
+            postBulk();
+        }
     }
 
     if (!bulkData.empty())
     {
-        HTTPRequest::instance().post(
-            HttpURL(url),
-            bulkData,
-            [](const std::string& response) { logDebug2(IC_NAME, "Response: %s", response.c_str()); },
-            [](const std::string& error, const long statusCode) { throw std::runtime_error(error); },
-            "",
-            DEFAULT_HEADERS,
-            secureCommunication);
+        postBulk();
     }
+
+    // With the digest stored, the next syncs skip the agent until its content changes.
+    builderBulkIndex(bulkData, agentId, m_digestsIndexName, nlohmann::json {{"digest", digest}}.dump());
+    postBulk();
 }
 
 IndexerConnector::IndexerConnector(
@@ -292,6 +381,14 @@ IndexerConnector::IndexerConnector(
         throw std::runtime_error("Index name must be lowercase.");
     }
 
+    // Waiting for the refresh makes the documents searchable when the request returns, but blocks each bulk request
+    // until the next index refresh.
+    m_bulkEndpoint = config.contains("wait_for_refresh") && !config.at("wait_for_refresh").get<bool>()
+                         ? BULK_ENDPOINT
+                         : BULK_WAIT_FOR_REFRESH_ENDPOINT;
+
+    m_digestsIndexName = DIGESTS_INDEX_PREFIX + m_indexName;
+
     m_db = std::make_unique<Utils::RocksDBWrapper>(std::string(DATABASE_BASE_PATH) + "db/" + m_indexName);
 
     auto secureCommunication = SecureCommunication::builder();
@@ -300,8 +397,10 @@ IndexerConnector::IndexerConnector(
     // Initialize publisher.
     auto selector {std::make_shared<ServerSelector>(config.at("hosts"), timeout, secureCommunication)};
 
+    // The bulk body buffer is kept between dispatches, so it's only grown while the bulks grow and its capacity
+    // (bounded by MAX_BULK_SIZE plus one element) is reused by the next ones.
     m_dispatcher = std::make_unique<ThreadDispatchQueue>(
-        [this, selector, secureCommunication](std::queue<std::string>& dataQueue)
+        [this, selector, secureCommunication, bulkData = std::string()](std::queue<std::string>& dataQueue) mutable
         {
             std::scoped_lock lock(m_syncMutex);
 
@@ -317,54 +416,162 @@ IndexerConnector::IndexerConnector(
                 throw std::runtime_error("IndexerConnector is stopping, event processing will be skipped.");
             }
 
-            auto url = selector->getNext();
-            std::string bulkData;
-            url.append("/_bulk?refresh=wait_for");
+            // Drop the leftovers of a failed post, whose elements are dispatched again.
+            bulkData.clear();
 
-            while (!dataQueue.empty())
+            // Each bulk goes to the least loaded server, with as many elements as that server currently accepts.
+            auto server = selector->getLeastLoaded();
+            auto elementsPerBulk = selector->bulkLimit(server, ELEMENTS_PER_BULK);
+
+            // Pending actions by document, in order of first appearance. A document updated or deleted several
+            // times before the bulk is posted only keeps its last action: the data to index, or none to delete it.
+            std::vector<std::pair<std::string, std::optional<std::string>>> pendingActions;
+            std::unordered_map<std::string, size_t> pendingActionsIndex;
+            size_t pendingSize {0};
+
+            const auto postBulk = [&]()
+            {
+                for (const auto& [id, data] : pendingActions)
+                {
+                    if (data.has_value())
+                    {
+                        builderBulkIndex(bulkData, id, m_indexName, data.value());
+                    }
+                    else
+                    {
+                        builderBulkDelete(bulkData, id, m_indexName);
+                    }
+                }
+
+                if (!bulkData.empty())
+                {
+                    auto outcome {ServerSelector::Outcome::FAILED};
+                    const auto start = std::chrono::steady_clock::now();
+                    const auto onResponse = [&]()
+                    {
+                        selector->onResponse(server,
+                                             std::chrono::duration_cast<std::chrono::microseconds>(
+                                                 std::chrono::steady_clock::now() - start),
+                                             outcome);
+                    };
+
+                    // Process data.
+                    selector->onRequest(server);
+                    try
+                    {
+                        HTTPRequest::instance().post(
+                            HttpURL(server + m_bulkEndpoint),
+                            bulkData,
+                            [&outcome](const std::string& response)
+                            {
+                                logDebug2(IC_NAME, "Response: %s", response.c_str());
+                                outcome = isBulkThrottled(response) ? ServerSelector::Outcome::THROTTLED
+                                                                    : ServerSelector::Outcome::SUCCESS;
+                            },
+                            [&outcome](const std::string& error, const long statusCode)
+                            {
+                                logError(IC_NAME, "%s, status code: %ld.", error.c_str(), statusCode);
+                                if (statusCode == HTTP_TOO_MANY_REQUESTS)
+                                {
+                                    outcome = ServerSelector::Outcome::THROTTLED;
+                                }
+                                throw std::runtime_error(error);
+                            },
+                            "",
+                            DEFAULT_HEADERS,
+                            secureCommunication);
+                    }
+                    catch (...)
+                    {
+                        onResponse();
+                        throw;
+                    }
+                    onResponse();
+                    bulkData.clear();
+
+                    // The rejected elements were not indexed, the batch is dispatched again in smaller bulks.
+                    if (outcome == ServerSelector::Outcome::THROTTLED)
+                    {
+                        throw std::runtime_error("The indexer rejected part of the bulk.");
+                    }
+
+                    server = selector->getLeastLoaded();
+                    elementsPerBulk = selector->bulkLimit(server, ELEMENTS_PER_BULK);
+                }
+
+                pendingActions.clear();
+                pendingActionsIndex.clear();
+                pendingSize = 0;
+            };
+
+            const auto addPendingAction = [&](const std::string& id, std::optional<std::string> data)
+            {
+                pendingSize += data.has_value() ? data->size() : 0;
+
+                if (const auto it = pendingActionsIndex.find(id); it != pendingActionsIndex.end())
+                {
+                    auto& pendingData = pendingActions.at(it->second).second;
+                    pendingSize -= pendingData.has_value() ? pendingData->size() : 0;
+                    pendingData = std::move(data);
+                }
+                else
+                {
+                    pendingActionsIndex.emplace(id, pendingActions.size());
+                    pendingActions.emplace_back(id, std::move(data));
+                }
+
+                // Batches can hold many elements, keep the bulk requests bounded.
+                if (pendingActions.size() >= elementsPerBulk || pendingSize >= MAX_BULK_SIZE)
+                {
+                    postBulk();
+                }
+            };
+
+            const auto processElement = [&](const nlohmann::json& parsedData)
             {
-                auto data = dataQueue.front();
-                dataQueue.pop();
-                auto parsedData = nlohmann::json::parse(data);
                 const auto& id = parsedData.at("id").get_ref<const std::string&>();
                 // If the element should not be indexed, only delete it from the sync database.
                 const bool noIndex = parsedData.contains("no-index") ? parsedData.at("no-index").get<bool>() : false;
 
                 if (parsedData.at("operation").get_ref<const std::string&>().compare("DELETED") == 0)
                 {
+                    m_db->delete_(id);
                     if (!noIndex)
                     {
-                        builderBulkDelete(bulkData, id, m_indexName);
+                        addPendingAction(id, std::nullopt);
                     }
-                    m_db->delete_(id);
                 }
                 else
                 {
-                    const auto dataString = parsedData.at("data").dump();
+                    auto dataString = parsedData.at("data").dump();
+                    m_db->put(id, dataString);
                     if (!noIndex)
                     {
-                        builderBulkIndex(bulkData, id, m_indexName, dataString);
+                        addPendingAction(id, std::move(dataString));
                     }
-                    m_db->put(id, dataString);
                 }
-            }
+            };
 
-            if (!bulkData.empty())
+            while (!dataQueue.empty())
             {
-                // Process data.
-                HTTPRequest::instance().post(
-                    HttpURL(url),
-                    bulkData,
-                    [](const std::string& response) { logDebug2(IC_NAME, "Response: %s", response.c_str()); },
-                    [](const std::string& error, const long statusCode)
+                const auto data = std::move(dataQueue.front());
+                dataQueue.pop();
+
+                // A batch is published as a single queue element with an array of elements.
+                if (auto parsedData = nlohmann::json::parse(data); parsedData.is_array())
+                {
+                    for (const auto& element : parsedData)
                     {
-                        logError(IC_NAME, "%s, status code: %ld.", error.c_str(), statusCode);
-                        throw std::runtime_error(error);
-                    },
-                    "",
-                    DEFAULT_HEADERS,
-                    secureCommunication);
+                        processElement(element);
+                    }
+                }
+                else
+                {
+                    processElement(parsedData);
+                }
             }
+
+            postBulk();
         },
         DATABASE_BASE_PATH + m_indexName,
         ELEMENTS_PER_BULK);
@@ -378,11 +585,21 @@ IndexerConnector::IndexerConnector(
                 std::scoped_lock lock(m_syncMutex);
                 if (!abuseControl(agentId))
                 {
-                    logDebug2(IC_NAME, "Syncing agent '%s' with the indexer.", agentId.c_str());
-                    diff(getAgentDocumentsIds(selector->getNext(), agentId, secureCommunication),
-                         agentId,
-                         secureCommunication,
-                         selector);
+                    // Only the agents whose content diverges from the one last synced have their documents sent.
+                    if (const auto digest = agentDigest(agentId);
+                        digest.compare(indexedDigest(selector->getNext(), agentId, secureCommunication)) != 0)
+                    {
+                        logDebug2(IC_NAME, "Syncing agent '%s' with the indexer.", agentId.c_str());
+                        diff(getAgentDocumentsIds(selector->getNext(), agentId, secureCommunication),
+                             agentId,
+                             digest,
+                             secureCommunication,
+                             selector);
+                    }
+                    else
+                    {
+                        logDebug2(IC_NAME, "Agent '%s' is already in sync with the indexer.", agentId.c_str());
+                    }
                 }
             }
             catch (const std::exception& e)
@@ -413,6 +630,36 @@ void IndexerConnector::publish(const std::string& message)
     m_dispatcher->push(message);
 }
 
+void IndexerConnector::publish(const std::vector<std::string>& messages)
+{
+    if (messages.size() == 1)
+    {
+        m_dispatcher->push(messages.front());
+    }
+    else if (!messages.empty())
+    {
+        std::string batch;
+        batch.reserve(std::accumulate(messages.begin(),
+                                      messages.end(),
+                                      messages.size() + 1,
+                                      [](const size_t size, const std::string& message)
+                                      { return size + message.size(); }));
+
+        batch.append("[");
+        for (const auto& message : messages)
+        {
+            if (batch.size() > 1)
+            {
+                batch.append(",");
+            }
+            batch.append(message);
+        }
+        batch.append("]");
+
+        m_dispatcher->push(batch);
+    }
+}
+
 void IndexerConnector::sync(const std::string& agentId)
 {
     m_syncQueue->push(agentId);
@@ -15,8 +15,16 @@
 #include "monitoring.hpp"
 #include "roundRobinSelector.hpp"
 #include "secureCommunication.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @brief ServerSelector class.
@@ -24,8 +32,51 @@
  */
 class ServerSelector final : private RoundRobinSelector<std::string>
 {
+public:
+    /**
+     * @brief Outcome of a request sent to a server.
+     *
+     */
+    enum class Outcome
+    {
+        SUCCESS,   ///< The server processed the request.
+        THROTTLED, ///< The server rejected the request, or part of it, because it was overloaded.
+        FAILED     ///< The request failed for any other reason.
+    };
+
 private:
+    // Weight of the last response in the latency average.
+    static constexpr auto LATENCY_WEIGHT {0.2};
+    // Each throttled response halves the bulks sent to the server, down to 1/64 of the maximum.
+    static constexpr auto MAX_BACKOFF {6u};
+
+    /**
+     * @brief Load of a server, as seen by this selector.
+     *
+     */
+    struct Stats
+    {
+        std::atomic<double> latency {0};    ///< Average response time, in microseconds.
+        std::atomic<uint32_t> inFlight {0}; ///< Requests sent and not answered yet.
+        std::atomic<uint32_t> backoff {0};  ///< Times the bulks are halved.
+    };
+
     std::shared_ptr<Monitoring> monitoring;
+    std::vector<std::string> m_servers;
+    // Built once, so the stats are looked up without locking.
+    std::unordered_map<std::string, std::unique_ptr<Stats>> m_stats;
+
+    Stats& stats(const std::string& server) const
+    {
+        return *m_stats.at(server);
+    }
+
+    double load(const std::string& server) const
+    {
+        const auto& serverStats = stats(server);
+        // The servers without responses yet are tried first.
+        return serverStats.latency.load(std::memory_order_relaxed) * (serverStats.inFlight.load() + 1);
+    }
 
 public:
     ~ServerSelector() = default;
@@ -41,8 +92,13 @@ public:
                             const uint32_t timeout = INTERVAL,
                             const SecureCommunication& secureCommunication = {})
         : RoundRobinSelector<std::string>(values)
+        , m_servers(values)
     {
         monitoring = std::make_shared<Monitoring>(values, timeout, secureCommunication);
+        for (const auto& server : values)
+        {
+            m_stats.try_emplace(server, std::make_unique<Stats>());
+        }
     }
 
     /**
@@ -65,6 +121,107 @@ public:
         }
         return retValue;
     }
+
+    /**
+     * @brief Get the least loaded of two available servers picked at random (power of two choices).
+     *
+     * The load of a server is its average response time weighted by its requests in flight. Comparing only two servers
+     * spreads the requests of several senders instead of sending all of them to the same server.
+     *
+     * @return std::string Server address.
+     */
+    std::string getLeastLoaded()
+    {
+        thread_local std::minstd_rand generator {std::random_device {}()};
+
+        std::vector<std::reference_wrapper<const std::string>> available;
+        available.reserve(m_servers.size());
+        std::copy_if(m_servers.begin(),
+                     m_servers.end(),
+                     std::back_inserter(available),
+                     [this](const std::string& server) { return monitoring->isAvailable(server); });
+
+        if (available.empty())
+        {
+            throw std::runtime_error("No available server");
+        }
+        if (available.size() == 1)
+        {
+            return available.front();
+        }
+
+        std::uniform_int_distribution<std::size_t> distribution(0, available.size() - 1);
+        const auto first = distribution(generator);
+        // The second one is picked among the others, so both are different.
+        auto second = distribution(generator) % (available.size() - 1);
+        second += second >= first ? 1 : 0;
+
+        const std::string& firstServer = available[first];
+        const std::string& secondServer = available[second];
+        return load(secondServer) < load(firstServer) ? secondServer : firstServer;
+    }
+
+    /**
+     * @brief Register a request sent to a server.
+     *
+     * @param server Server address.
+     */
+    void onRequest(const std::string& server)
+    {
+        stats(server).inFlight.fetch_add(1);
+    }
+
+    /**
+     * @brief Register the response to a request registered with onRequest.
+     *
+     * @param server Server address.
+     * @param latency Time since the request was sent.
+     * @param outcome Outcome of the request.
+     */
+    void onResponse(const std::string& server, const std::chrono::microseconds latency, const Outcome outcome)
+    {
+        auto& serverStats = stats(server);
+        serverStats.inFlight.fetch_sub(1);
+
+        // The failed requests may not reach the server, so their latency is not representative.
+        if (outcome == Outcome::FAILED)
+        {
+            return;
+        }
+
+        auto average = serverStats.latency.load(std::memory_order_relaxed);
+        const auto sample = static_cast<double>(latency.count());
+        const auto next = average == 0 ? sample : average + LATENCY_WEIGHT * (sample - average);
+        // A lost update is replaced by the next response, there is no need to retry.
+        serverStats.latency.compare_exchange_strong(average, next, std::memory_order_relaxed);
+
+        auto backoff = serverStats.backoff.load();
+        if (outcome == Outcome::THROTTLED)
+        {
+            // Halve quickly when the server is overloaded, recover one step per response when it keeps up.
+            while (backoff < MAX_BACKOFF && !serverStats.backoff.compare_exchange_weak(backoff, backoff + 1))
+            {
+            }
+        }
+        else
+        {
+            while (backoff > 0 && !serverStats.backoff.compare_exchange_weak(backoff, backoff - 1))
+            {
+            }
+        }
+    }
+
+    /**
+     * @brief Get the elements of the next bulk sent to a server, reduced while the server throttles the bulks.
+     *
+     * @param server Server address.
+     * @param maxElements Elements of a bulk when the server is not throttling.
+     * @return std::size_t Elements of the next bulk, at least one.
+     */
+    std::size_t bulkLimit(const std::string& server, const std::size_t maxElements) const
+    {
+        return std::max<std::size_t>(maxElements >> stats(server).backoff.load(), 1);
+    }
 };
 
 #endif // _SERVER_SELECTOR_HPP
@@ -313,6 +313,121 @@ TEST_F(IndexerConnectorTest, PublishDeleted)
     ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
 }
 
+/**
+ * @brief Test the publication of a batch into a server. All the elements of the batch are sent in the same bulk
+ * request.
+ *
+ */
+TEST_F(IndexerConnectorTest, PublishBatch)
+{
+    nlohmann::json expectedIndexMetadata;
+    expectedIndexMetadata["index"]["_index"] = INDEXER_NAME;
+    expectedIndexMetadata["index"]["_id"] = INDEX_ID_A;
+
+    nlohmann::json expectedDeleteMetadata;
+    expectedDeleteMetadata["delete"]["_index"] = INDEXER_NAME;
+    expectedDeleteMetadata["delete"]["_id"] = INDEX_ID_B;
+
+    // Callback that checks the expected data to be published.
+    // First line: Metadata of the first element.
+    // Second line: Index data of the first element.
+    // Third line: Metadata of the second element, a DELETED operation without data.
+    constexpr auto INDEX_DATA {"content"};
+    auto callbackCalled {false};
+    const auto checkPublishedData {
+        [&expectedIndexMetadata, &expectedDeleteMetadata, &callbackCalled, &INDEX_DATA](const std::string& data)
+        {
+            const auto splitData {Utils::split(data, '\n')};
+            ASSERT_EQ(splitData.size(), 3);
+            ASSERT_EQ(nlohmann::json::parse(splitData.at(0)), expectedIndexMetadata);
+            ASSERT_EQ(nlohmann::json::parse(splitData.at(1)), INDEX_DATA);
+            ASSERT_EQ(nlohmann::json::parse(splitData.at(2)), expectedDeleteMetadata);
+            callbackCalled = true;
+        }};
+    m_indexerServers[A_IDX]->setPublishCallback(checkPublishedData);
+
+    // Create connector and wait until the connection is established.
+    nlohmann::json indexerConfig;
+    indexerConfig["name"] = INDEXER_NAME;
+    indexerConfig["hosts"] = nlohmann::json::array({A_ADDRESS});
+    auto indexerConnector {IndexerConnector(indexerConfig, logFunction, INDEXER_TIMEOUT)};
+
+    // Publish content and wait until the publication finishes.
+    nlohmann::json insertData;
+    insertData["id"] = INDEX_ID_A;
+    insertData["operation"] = "INSERT";
+    insertData["data"] = INDEX_DATA;
+
+    nlohmann::json deleteData;
+    deleteData["id"] = INDEX_ID_B;
+    deleteData["operation"] = "DELETED";
+
+    ASSERT_NO_THROW(indexerConnector.publish(std::vector<std::string> {insertData.dump(), deleteData.dump()}));
+    ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
+}
+
+/**
+ * @brief Test the publication of a batch that changes the same documents several times. Only the last action of each
+ * document is sent, in the order the documents were first seen.
+ *
+ */
+TEST_F(IndexerConnectorTest, PublishBatchCoalescesActions)
+{
+    nlohmann::json expectedIndexMetadata;
+    expectedIndexMetadata["index"]["_index"] = INDEXER_NAME;
+    expectedIndexMetadata["index"]["_id"] = INDEX_ID_A;
+
+    nlohmann::json expectedDeleteMetadata;
+    expectedDeleteMetadata["delete"]["_index"] = INDEXER_NAME;
+    expectedDeleteMetadata["delete"]["_id"] = INDEX_ID_B;
+
+    // Callback that checks the expected data to be published.
+    // First line: Metadata of the first element.
+    // Second line: Last index data of the first element.
+    // Third line: Metadata of the second element, indexed and then deleted.
+    constexpr auto INDEX_DATA {"content"};
+    constexpr auto LAST_INDEX_DATA {"lastContent"};
+    auto callbackCalled {false};
+    const auto checkPublishedData {
+        [&expectedIndexMetadata, &expectedDeleteMetadata, &callbackCalled, &LAST_INDEX_DATA](const std::string& data)
+        {
+            const auto splitData {Utils::split(data, '\n')};
+            ASSERT_EQ(splitData.size(), 3);
+            ASSERT_EQ(nlohmann::json::parse(splitData.at(0)), expectedIndexMetadata);
+            ASSERT_EQ(nlohmann::json::parse(splitData.at(1)), LAST_INDEX_DATA);
+            ASSERT_EQ(nlohmann::json::parse(splitData.at(2)), expectedDeleteMetadata);
+            callbackCalled = true;
+        }};
+    m_indexerServers[A_IDX]->setPublishCallback(checkPublishedData);
+
+    // Create connector and wait until the connection is established.
+    nlohmann::json indexerConfig;
+    indexerConfig["name"] = INDEXER_NAME;
+    indexerConfig["hosts"] = nlohmann::json::array({A_ADDRESS});
+    auto indexerConnector {IndexerConnector(indexerConfig, logFunction, INDEXER_TIMEOUT)};
+
+    // Publish content and wait until the publication finishes.
+    nlohmann::json insertDataA;
+    insertDataA["id"] = INDEX_ID_A;
+    insertDataA["operation"] = "INSERT";
+    insertDataA["data"] = INDEX_DATA;
+
+    auto insertDataB = insertDataA;
+    insertDataB["id"] = INDEX_ID_B;
+
+    nlohmann::json deleteDataB;
+    deleteDataB["id"] = INDEX_ID_B;
+    deleteDataB["operation"] = "DELETED";
+
+    auto modifyDataA = insertDataA;
+    modifyDataA["operation"] = "MODIFIED";
+    modifyDataA["data"] = LAST_INDEX_DATA;
+
+    ASSERT_NO_THROW(indexerConnector.publish(
+        std::vector<std::string> {insertDataA.dump(), insertDataB.dump(), deleteDataB.dump(), modifyDataA.dump()}));
+    ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
+}
+
 /**
  * @brief Test the publication to an unavailable server.
  *
@@ -120,3 +120,81 @@ TEST_F(ServerSelectorTest, TestGextNextWhenThereAreNoAvailableServers)
     // It throws an exception because there are no available servers
     EXPECT_THROW(nextServer = m_selector->getNext(), std::runtime_error);
 }
+
+/**
+ * @brief Test getLeastLoaded prefers the server with the lowest latency and fewest requests in flight.
+ *
+ */
+TEST_F(ServerSelectorTest, TestGetLeastLoaded)
+{
+    const auto hostGreenServer {m_servers.at(0)};
+    const auto hostRedServer {m_servers.at(1)};
+
+    EXPECT_NO_THROW(m_selector = std::make_shared<ServerSelector>(m_servers, SERVER_SELECTOR_HEALTH_CHECK_INTERVAL));
+
+    // The green server answers slower, so the red one is selected while both are available.
+    m_selector->onRequest(hostGreenServer);
+    m_selector->onResponse(hostGreenServer, std::chrono::milliseconds(100), ServerSelector::Outcome::SUCCESS);
+    m_selector->onRequest(hostRedServer);
+    m_selector->onResponse(hostRedServer, std::chrono::milliseconds(10), ServerSelector::Outcome::SUCCESS);
+    EXPECT_EQ(m_selector->getLeastLoaded(), hostRedServer);
+
+    // Enough requests in flight make the red server more loaded than the green one.
+    for (auto i = 0; i < 10; ++i)
+    {
+        m_selector->onRequest(hostRedServer);
+    }
+    EXPECT_EQ(m_selector->getLeastLoaded(), hostGreenServer);
+
+    // Interval to check the health of the servers
+    std::this_thread::sleep_for(std::chrono::seconds(SERVER_SELECTOR_HEALTH_CHECK_INTERVAL + 5));
+
+    // The red server isn't available, whatever its load.
+    for (auto i = 0; i < 10; ++i)
+    {
+        m_selector->onResponse(hostRedServer, std::chrono::milliseconds(1), ServerSelector::Outcome::SUCCESS);
+    }
+    EXPECT_EQ(m_selector->getLeastLoaded(), hostGreenServer);
+}
+
+/**
+ * @brief Test the bulks are halved while a server throttles them and recover when it keeps up.
+ *
+ */
+TEST_F(ServerSelectorTest, TestBulkLimitBackoff)
+{
+    const auto hostGreenServer {m_servers.at(0)};
+    constexpr auto MAX_ELEMENTS {1000u};
+
+    EXPECT_NO_THROW(m_selector = std::make_shared<ServerSelector>(m_servers, SERVER_SELECTOR_HEALTH_CHECK_INTERVAL));
+    EXPECT_EQ(m_selector->bulkLimit(hostGreenServer, MAX_ELEMENTS), MAX_ELEMENTS);
+
+    const auto respond = [&](const ServerSelector::Outcome outcome)
+    {
+        m_selector->onRequest(hostGreenServer);
+        m_selector->onResponse(hostGreenServer, std::chrono::milliseconds(10), outcome);
+    };
+
+    respond(ServerSelector::Outcome::THROTTLED);
+    EXPECT_EQ(m_selector->bulkLimit(hostGreenServer, MAX_ELEMENTS), MAX_ELEMENTS / 2);
+    respond(ServerSelector::Outcome::THROTTLED);
+    EXPECT_EQ(m_selector->bulkLimit(hostGreenServer, MAX_ELEMENTS), MAX_ELEMENTS / 4);
+
+    // The failures do not change the bulks, they may not have reached the server.
+    respond(ServerSelector::Outcome::FAILED);
+    EXPECT_EQ(m_selector->bulkLimit(hostGreenServer, MAX_ELEMENTS), MAX_ELEMENTS / 4);
+
+    // The backoff is bounded.
+    for (auto i = 0; i < 20; ++i)
+    {
+        respond(ServerSelector::Outcome::THROTTLED);
+    }
+    EXPECT_EQ(m_selector->bulkLimit(hostGreenServer, MAX_ELEMENTS), MAX_ELEMENTS >> 6);
+    EXPECT_EQ(m_selector->bulkLimit(hostGreenServer, 1), 1u);
+
+    for (auto i = 0; i < 6; ++i)
+    {
+        respond(ServerSelector::Outcome::SUCCESS);
+    }
+    EXPECT_EQ(m_selector->bulkLimit(hostGreenServer, MAX_ELEMENTS), MAX_ELEMENTS);
+}
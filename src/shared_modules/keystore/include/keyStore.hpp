@@ -13,6 +13,7 @@
 #define _KEYSTORE_HPP
 
 #include <string>
+#include <vector>
 
 class Keystore final
 {
@@ -37,6 +38,18 @@ public:
      * @param value The corresponding value to be returned.
      */
     static void get(const std::string& columnFamily, const std::string& key, std::string& value);
+
+    /**
+     * Get the values of several keys in the specified column family, opening the database only once.
+     *
+     * @param columnFamily The target column family.
+     * @param keys The keys to get.
+     * @param values The corresponding values to be returned, in the same order as the keys. Empty for the keys that
+     * don't exist.
+     */
+    static void get(const std::string& columnFamily,
+                    const std::vector<std::string>& keys,
+                    std::vector<std::string>& values);
 };
 
 #endif // _KEYSTORE_HPP
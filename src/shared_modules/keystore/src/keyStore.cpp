@@ -110,8 +110,32 @@ void Keystore::put(const std::string& columnFamily, const std::string& key, cons
  * @param value The corresponding value to be returned.
  */
 void Keystore::get(const std::string& columnFamily, const std::string& key, std::string& value)
+{
+    std::vector<std::string> values;
+
+    get(columnFamily, {key}, values);
+
+    // Keep the previous value if the key doesn't exist.
+    if (!values.front().empty())
+    {
+        value = std::move(values.front());
+    }
+}
+
+/**
+ * Get the values of several keys in the specified column family, opening the database only once.
+ *
+ * @param columnFamily The target column family.
+ * @param keys The keys to get.
+ * @param values The corresponding values to be returned, in the same order as the keys.
+ */
+void Keystore::get(const std::string& columnFamily,
+                   const std::vector<std::string>& keys,
+                   std::vector<std::string>& values)
 {
     std::string encryptedValue;
+    std::vector<char> encryptedValueVec;
+    EVPHelper evpHelper;
 
     auto keystoreDB = Utils::RocksDBWrapper(DATABASE_PATH, false);
 
@@ -120,13 +144,20 @@ void Keystore::get(const std::string& columnFamily, const std::string& key, std:
         keystoreDB.createColumn(columnFamily);
     }
 
-    // Upgrade the keystore if necessary and get the key-value pair, to get all keys encrypted with the same algorithm.
+    // Upgrade the keystore if necessary and get the key-value pairs, to get all keys encrypted with the same
+    // algorithm.
     upgrade(keystoreDB, columnFamily);
 
-    // Get the key-value pair using AES decryption.
-    if (keystoreDB.get(key, encryptedValue, columnFamily))
+    values.clear();
+    values.resize(keys.size());
+
+    for (size_t i = 0; i < keys.size(); ++i)
     {
-        std::vector<char> encryptedValueVec(encryptedValue.begin(), encryptedValue.end());
-        EVPHelper().decryptAES256(encryptedValueVec, value);
+        // Get the key-value pair using AES decryption.
+        if (keystoreDB.get(keys[i], encryptedValue, columnFamily))
+        {
+            encryptedValueVec.assign(encryptedValue.begin(), encryptedValue.end());
+            evpHelper.decryptAES256(encryptedValueVec, values[i]);
+        }
     }
 }
@@ -108,6 +108,19 @@ TEST(KeyStoreComponentTest, TestPutGet)
     ASSERT_EQ(out, "value2");
 }
 
+TEST(KeyStoreComponentTest, TestPutMultiGet)
+{
+    std::filesystem::remove_all(DATABASE_PATH);
+
+    Keystore::put("default", "key1", "value1");
+    Keystore::put("default", "key2", "value2");
+
+    // Get several values at once, the missing keys are returned empty.
+    std::vector<std::string> out;
+    Keystore::get("default", {"key2", "missing", "key1"}, out);
+    ASSERT_EQ(out, (std::vector<std::string> {"value2", "", "value1"}));
+}
+
 TEST(KeyStoreComponentTest, TestUpgrade)
 {
     std::filesystem::remove_all(DATABASE_PATH);
@@ -13,6 +13,7 @@
 #define _IROUTER_PROVIDER_HPP
 
 #include <functional>
+#include <string>
 #include <vector>
 
 /**
@@ -44,6 +45,18 @@ public:
      * @param data Data to be sent
      */
     virtual void send(const std::vector<char>& data) = 0;
+
+    /**
+     * @brief Sends the data to the provider with a routing key. Only the subscribers that accept the key, or that
+     * don't filter by key, receive it.
+     *
+     * @param data Data to be sent
+     * @param key Routing key of the data
+     */
+    virtual void send(const std::vector<char>& data, [[maybe_unused]] const std::string& key)
+    {
+        send(data);
+    }
 };
 
 #endif //_IROUTER_PROVIDER_HPP
@@ -52,6 +52,7 @@ public:
     void start();
     void start(const std::function<void()>& onConnect);
     void send(const std::vector<char>& data);
+    void send(const std::vector<char>& data, const std::string& key);
 };
 
 #endif //_ROUTER_PROVIDER_HPP
@@ -81,6 +81,20 @@ public:
      */
     void subscribe(const std::function<void(const std::vector<char>&)>& callback,
                    const std::function<void()>& onConnect);
+
+    /**
+     * @brief Adds subscriber to the list, receiving only the messages sent with some routing keys.
+     *
+     * The keys are checked by the publisher, so a remote subscriber doesn't receive the messages it filters out.
+     * The messages sent without a key are always received.
+     *
+     * @param callback Subscriber update callback.
+     * @param onConnect Callback to be called when the subscriber is connected to the broker.
+     * @param keys Routing keys accepted by the subscriber. Empty to receive all the messages.
+     */
+    void subscribe(const std::function<void(const std::vector<char>&)>& callback,
+                   const std::function<void()>& onConnect,
+                   const std::vector<std::string>& keys);
 };
 
 #endif //_ROUTER_SUBSCRIBER_HPP
@@ -18,18 +18,31 @@
 #include "subscriber.hpp"
 #include <external/nlohmann/json.hpp>
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 constexpr auto PUBLISHER_DISPATCH_THREAD_COUNT {1};
+constexpr auto PUBLISHER_HEADER {"P"};
+
+/**
+ * @brief Message published into a Publisher, with the routing key its subscribers are filtered by.
+ *
+ */
+struct RoutedMessage final
+{
+    std::string key;
+    std::vector<char> data;
+};
 
 /**
  * @brief Publisher class.
  *
  */
-class Publisher final : public Provider<const std::vector<char>&>
+class Publisher final : public Provider<const RoutedMessage&>
 {
 private:
-    using MsgDispatcher = Utils::FilterMsgDispatcher<const std::vector<char>&>;
+    using MsgDispatcher = Utils::FilterMsgDispatcher<const RoutedMessage&>;
     std::unique_ptr<SocketServer<Socket<OSPrimitives>, EpollWrapper>> m_socketServer {};
     std::unique_ptr<MsgDispatcher> m_msgDispatcher {};
 
@@ -39,13 +52,17 @@ public:
      *
      * @param endpointName Server's endpoint.
      * @param socketPath Server's socket path.
+     * @param dispatchThreadCount Threads that deliver the messages to the subscribers. With more than one thread the
+     * messages are no longer delivered in the order they were published.
      */
-    explicit Publisher(const std::string& endpointName, const std::string& socketPath)
+    explicit Publisher(const std::string& endpointName,
+                       const std::string& socketPath,
+                       const unsigned int dispatchThreadCount = PUBLISHER_DISPATCH_THREAD_COUNT)
         : m_socketServer(std::make_unique<SocketServer<Socket<OSPrimitives>, EpollWrapper>>(socketPath + endpointName))
-        , m_msgDispatcher(std::make_unique<MsgDispatcher>([this, endpointName](const std::vector<char>& data)
-                                                          { this->call(data); },
+        , m_msgDispatcher(std::make_unique<MsgDispatcher>([this, endpointName](const RoutedMessage& message)
+                                                          { Provider::call(message); },
                                                           nullptr,
-                                                          PUBLISHER_DISPATCH_THREAD_COUNT))
+                                                          dispatchThreadCount))
     {
         m_socketServer->listen(
             [this, msgDispatcher = m_msgDispatcher.get(), socketServer = m_socketServer.get()](
@@ -59,19 +76,31 @@ public:
 
                 if (headerSize > 0)
                 {
-                    if (headerString.compare("P") == 0)
+                    // The header is the publisher mark followed by the routing key of the message, if any.
+                    if (headerString.compare(0, 1, PUBLISHER_HEADER) == 0)
                     {
-                        auto message = std::vector<char>(body, body + bodySize);
-                        msgDispatcher->push(message);
+                        // The message is copied once from the socket buffer and then shared by all the subscribers.
+                        msgDispatcher->push(RoutedMessage {std::string(headerString.substr(1)),
+                                                           std::vector<char>(body, body + bodySize)});
                     }
                 }
                 else
                 {
                     auto jsonBody = nlohmann::json::parse(body, body + bodySize);
-                    this->addSubscriber(std::make_shared<Subscriber<const std::vector<char>&>>(
+                    std::unordered_set<std::string> keys;
+
+                    if (const auto it {jsonBody.find("keys")}; it != jsonBody.end())
+                    {
+                        keys = it->get<std::unordered_set<std::string>>();
+                    }
+
+                    // The messages a remote subscriber doesn't want are dropped here, before they are written into
+                    // its socket.
+                    this->addSubscriber(makeSubscriber(
                         [fd, socketServer](const std::vector<char>& message)
                         { socketServer->send(fd, message.data(), message.size()); },
-                        jsonBody.at("subscriberId").get_ref<const std::string&>()));
+                        jsonBody.at("subscriberId").get_ref<const std::string&>(),
+                        std::move(keys)));
 
                     const std::string responseString = R"({"Result":"OK"})";
                     socketServer->send(fd, responseString.c_str(), responseString.size());
@@ -79,14 +108,51 @@ public:
             });
     }
 
+    /**
+     * @brief Creates a subscriber that only receives the messages of some routing keys.
+     *
+     * @param callback Subscriber update callback.
+     * @param subscriberId Subscriber ID.
+     * @param keys Routing keys accepted by the subscriber. Empty to receive all the messages. The messages published
+     * without a key are received by all the subscribers.
+     * @return Subscriber to be added to the publisher.
+     */
+    static std::shared_ptr<Subscriber<const RoutedMessage&>>
+    makeSubscriber(const std::function<void(const std::vector<char>&)>& callback,
+                   const std::string& subscriberId,
+                   std::unordered_set<std::string> keys = {})
+    {
+        return std::make_shared<Subscriber<const RoutedMessage&>>(
+            [callback, keys = std::move(keys)](const RoutedMessage& message)
+            {
+                if (keys.empty() || message.key.empty() || keys.find(message.key) != keys.end())
+                {
+                    callback(message.data);
+                }
+            },
+            subscriberId);
+    }
+
+    /**
+     * @brief Notifies the subscribers synchronously.
+     *
+     * @param data Data to be sent.
+     * @param key Routing key of the data.
+     */
+    void call(const std::vector<char>& data, const std::string& key = "")
+    {
+        Provider::call(RoutedMessage {key, data});
+    }
+
     /**
      * @brief Pushes data into the message dispatcher.
      *
      * @param data Data to be pushed.
+     * @param key Routing key of the data, used to filter the subscribers. Empty to send it to all of them.
      */
-    void push(const std::vector<char>& data)
+    void push(const std::vector<char>& data, const std::string& key = "")
     {
-        m_msgDispatcher->push(data);
+        m_msgDispatcher->push(RoutedMessage {key, data});
     }
 
     ~Publisher() override
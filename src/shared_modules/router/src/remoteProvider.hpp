@@ -60,10 +60,19 @@ public:
      * @brief Sends a message into the client socket.
      *
      * @param message Message to be sent.
+     * @param key Routing key of the message, sent in the header after the publisher mark.
      */
-    void push(const std::vector<char>& message)
+    void push(const std::vector<char>& message, const std::string& key = "")
     {
-        m_socketClient->send(message.data(), message.size(), "P", 1);
+        if (key.empty())
+        {
+            m_socketClient->send(message.data(), message.size(), "P", 1);
+        }
+        else
+        {
+            const auto header {"P" + key};
+            m_socketClient->send(message.data(), message.size(), header.data(), header.size());
+        }
     }
 
     ~RemoteProvider() = default;
@@ -41,13 +41,16 @@ public:
      * @param callback Subscriber update callback.
      * @param socketPath Client socket path.
      * @param onConnect Callback to be called when the subscriber is connected.
+     * @param keys Routing keys accepted by the subscriber, filtered by the publisher. Empty to receive all the
+     * messages.
      */
     explicit RemoteSubscriber(
         std::string endpoint,
         const std::string& subscriberId,
         const std::function<void(const std::vector<char>&)>& callback,
         const std::string& socketPath,
-        const std::function<void()>& onConnect = []() {})
+        const std::function<void()>& onConnect = []() {},
+        const std::vector<std::string>& keys = {})
         : m_endpointName {std::move(endpoint)}
         , m_isRegistered {false}
         , m_remoteSubscriptionManager {std::make_unique<RemoteSubscriptionManager>()}
@@ -58,7 +61,7 @@ public:
 
         m_remoteSubscriptionManager->sendInitProviderMessage(
             m_endpointName,
-            [this, callback, socketClient = m_socketClient.get(), subscriberId, onConnect]()
+            [this, callback, socketClient = m_socketClient.get(), subscriberId, onConnect, keys]()
             {
                 socketClient->connect(
                     [this, callback, onConnect](const char* body, uint32_t bodySize, const char*, uint32_t)
@@ -91,11 +94,15 @@ public:
                             callback(std::vector<char>(body, body + bodySize));
                         }
                     },
-                    [subscriberId, socketClient]()
+                    [subscriberId, socketClient, keys]()
                     {
                         nlohmann::json jsonMessage;
                         jsonMessage["type"] = "subscribe";
                         jsonMessage["subscriberId"] = subscriberId;
+                        if (!keys.empty())
+                        {
+                            jsonMessage["keys"] = keys;
+                        }
                         auto jsonMessageString = jsonMessage.dump();
 
                         socketClient->send(jsonMessageString.c_str(), jsonMessageString.length());
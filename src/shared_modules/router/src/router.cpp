@@ -58,6 +58,12 @@ void RouterProvider::send(const std::vector<char>& data)
     RouterFacade::instance().push(m_topicName, data);
 }
 
+void RouterProvider::send(const std::vector<char>& data, const std::string& key)
+{
+    // Send data to the right provider, only to the subscribers of the key.
+    RouterFacade::instance().push(m_topicName, data, key);
+}
+
 void RouterProvider::start()
 {
     // Add provider to the list.
@@ -126,6 +132,22 @@ void RouterSubscriber::subscribe(const std::function<void(const std::vector<char
     }
 }
 
+void RouterSubscriber::subscribe(const std::function<void(const std::vector<char>&)>& callback,
+                                 const std::function<void()>& onConnect,
+                                 const std::vector<std::string>& keys)
+{
+    // Add subscriber to the list.
+    if (m_isLocal)
+    {
+        RouterFacade::instance().addSubscriber(m_topicName, m_subscriberId, callback, keys);
+        onConnect();
+    }
+    else
+    {
+        RouterFacade::instance().addSubscriberRemote(m_topicName, m_subscriberId, callback, onConnect, keys);
+    }
+}
+
 void RouterSubscriber::unsubscribe()
 {
     // Remove subscriber to the list.
@@ -124,7 +124,8 @@ void RouterFacade::removeProviderRemote(const std::string& name)
 
 void RouterFacade::addSubscriber(const std::string& name,
                                  const std::string& subscriberId,
-                                 const std::function<void(const std::vector<char>&)>& callback)
+                                 const std::function<void(const std::vector<char>&)>& callback,
+                                 const std::vector<std::string>& keys)
 {
     std::lock_guard<std::shared_mutex> lock {m_providersMutex};
     // If not exist, create it.
@@ -133,13 +134,15 @@ void RouterFacade::addSubscriber(const std::string& name,
         m_providers.emplace(name, std::make_unique<Publisher>(name, DEFAULT_SOCKET_PATH));
     }
 
-    m_providers[name]->addSubscriber(std::make_shared<Subscriber<const std::vector<char>&>>(callback, subscriberId));
+    m_providers[name]->addSubscriber(
+        Publisher::makeSubscriber(callback, subscriberId, std::unordered_set<std::string>(keys.begin(), keys.end())));
 }
 
 void RouterFacade::addSubscriberRemote(const std::string& name,
                                        const std::string& subscriberId,
                                        const std::function<void(const std::vector<char>&)>& callback,
-                                       const std::function<void()>& onConnect)
+                                       const std::function<void()>& onConnect,
+                                       const std::vector<std::string>& keys)
 {
     std::lock_guard<std::mutex> lock {m_remoteSubscribersMutex};
     // If exist throw exception
@@ -150,7 +153,7 @@ void RouterFacade::addSubscriberRemote(const std::string& name,
 
     // Send a message to the provider from the client side to add a remote subscriber
     m_remoteSubscribers[name] =
-        std::make_shared<RemoteSubscriber>(name, subscriberId, callback, DEFAULT_SOCKET_PATH, onConnect);
+        std::make_shared<RemoteSubscriber>(name, subscriberId, callback, DEFAULT_SOCKET_PATH, onConnect, keys);
 }
 
 void RouterFacade::removeSubscriberRemote(const std::string& name, const std::string& subscriberId)
@@ -173,14 +176,14 @@ void RouterFacade::removeSubscriberLocal(const std::string& name, const std::str
     }
 }
 
-void RouterFacade::push(const std::string& name, const std::vector<char>& data)
+void RouterFacade::push(const std::string& name, const std::vector<char>& data, const std::string& key)
 {
     std::unique_lock<std::mutex> lockRemoteProviders {m_remoteProvidersMutex};
     const auto itRemoteProvider {m_remoteProviders.find(name)};
 
     if (itRemoteProvider != m_remoteProviders.end())
     {
-        itRemoteProvider->second->push(data);
+        itRemoteProvider->second->push(data, key);
     }
     else
     {
@@ -189,7 +192,7 @@ void RouterFacade::push(const std::string& name, const std::vector<char>& data)
 
         if (itLocalProvider != m_providers.end())
         {
-            itLocalProvider->second->push(data);
+            itLocalProvider->second->push(data, key);
         }
         else
         {
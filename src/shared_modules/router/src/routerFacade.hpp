@@ -38,10 +38,12 @@ public:
      * @param name Provider name.
      * @param subscriberId Subscriber ID.
      * @param callback Subscriber update callback.
+     * @param keys Routing keys accepted by the subscriber. Empty to receive all the messages.
      */
     void addSubscriber(const std::string& name,
                        const std::string& subscriberId,
-                       const std::function<void(const std::vector<char>&)>& callback);
+                       const std::function<void(const std::vector<char>&)>& callback,
+                       const std::vector<std::string>& keys = {});
 
     /**
      * @brief Adds a subscriber to a given remote provider.
@@ -50,12 +52,14 @@ public:
      * @param subscriberId Subscriber ID.
      * @param callback Subscriber update callback.
      * @param onConnect Callback to be called when the subscriber is connected.
+     * @param keys Routing keys accepted by the subscriber. Empty to receive all the messages.
      */
     void addSubscriberRemote(
         const std::string& name,
         const std::string& subscriberId,
         const std::function<void(const std::vector<char>&)>& callback,
-        const std::function<void()>& onConnect = []() {});
+        const std::function<void()>& onConnect = []() {},
+        const std::vector<std::string>& keys = {});
 
     /**
      * @brief Removes a local subscriber.
@@ -110,8 +114,9 @@ public:
      *
      * @param name Provider name.
      * @param data Data to be pushed.
+     * @param key Routing key of the data. Empty to send it to all the subscribers.
      */
-    void push(const std::string& name, const std::vector<char>& data);
+    void push(const std::string& name, const std::vector<char>& data, const std::string& key = "");
 
     // From modulesd-router
 
@@ -232,3 +232,32 @@ TEST_F(PublisherTest, TestPublishSocketP)
         EXPECT_EQ(result, std::cv_status::no_timeout);
     }
 }
+
+/*
+ * @brief Tests that the subscribers only receive the messages of the routing keys they accept.
+ */
+TEST_F(PublisherTest, TestPublishFilteredByKey)
+{
+    constexpr auto ENDPOINT_NAME = "test";
+    constexpr auto SOCKET_PATH = "test/";
+
+    const auto publisher {std::make_shared<Publisher>(ENDPOINT_NAME, SOCKET_PATH)};
+    std::vector<std::string> received;
+
+    publisher->addSubscriber(Publisher::makeSubscriber(
+        [&received](const std::vector<char>& data)
+        { received.emplace_back("all:" + std::string(data.begin(), data.end())); },
+        "ID_ALL"));
+    publisher->addSubscriber(Publisher::makeSubscriber(
+        [&received](const std::vector<char>& data)
+        { received.emplace_back("a:" + std::string(data.begin(), data.end())); },
+        "ID_A",
+        {"a"}));
+
+    publisher->call({'1'}, "a");
+    publisher->call({'2'}, "b");
+    publisher->call({'3'});
+
+    const std::vector<std::string> expected {"all:1", "a:1", "all:2", "all:3", "a:3"};
+    EXPECT_EQ(received, expected);
+}
@@ -59,7 +59,7 @@ namespace RSync
                         outputData["checksum"] = data.checksum;
                     }
 
-                    outputMessage["data"] = outputData;
+                    outputMessage["data"] = std::move(outputData);
 
                     if (!data.checksum.empty() || INTEGRITY_CLEAR == data.type)
                     {
@@ -47,7 +47,7 @@ namespace RSync
                 outputData["timestamp"] = (lastEvent != config.end()) ? data.at(lastEvent->get_ref<const std::string&>()) : "";
                 outputData["attributes"] = data;
 
-                outputMessage["data"] = outputData;
+                outputMessage["data"] = std::move(outputData);
 
                 callback(outputMessage.dump());
             }
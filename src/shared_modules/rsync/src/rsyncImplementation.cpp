@@ -281,20 +281,20 @@ void RSyncImplementation::fillChecksum(const std::shared_ptr<DBSyncWrapper>& spD
 
     const auto& querySelect { jsonSyncConfiguration.at("range_checksum_query_json") };
     const auto& checksumFieldName { jsonSyncConfiguration.at("checksum_field").get_ref<const std::string&>() };
+    const auto& indexFieldName { jsonSyncConfiguration.at("index").get_ref<const std::string&>() };
     auto index { 1ull };
     const auto middle { ctx.size / 2 };
 
-    std::unique_ptr<Utils::HashData> hash{ std::make_unique<Utils::HashData>() };
+    Utils::HashData hash;
     ResultCallbackData callback
     {
         [&] (ReturnTypeCallback /*callback*/, const nlohmann::json & resultJSON)
         {
-            const auto checksumValue { resultJSON.at(checksumFieldName).get_ref<const std::string&>() };
-            hash->update(checksumValue.data(), checksumValue.size());
+            const auto& checksumValue { resultJSON.at(checksumFieldName).get_ref<const std::string&>() };
+            hash.update(checksumValue.data(), checksumValue.size());
 
             if (CHECKSUM_SPLIT == ctx.type)
             {
-                const auto& indexFieldName { jsonSyncConfiguration.at("index").get_ref<const std::string&>() };
                 const auto& result{resultJSON.at(indexFieldName)};
 
                 if (middle + 1 == index)
@@ -305,8 +305,8 @@ void RSyncImplementation::fillChecksum(const std::shared_ptr<DBSyncWrapper>& spD
                 else if (middle == index)
                 {
                     ctx.leftCtx.end = result.is_string() ? result.get_ref<const std::string&>() : std::to_string(result.get<unsigned long>());
-                    ctx.leftCtx.checksum = Utils::asciiToHex(hash->hash());
-                    hash = std::make_unique<Utils::HashData>();
+                    ctx.leftCtx.checksum = Utils::asciiToHex(hash.hash());
+                    hash.reset();
                 }
 
                 ++index;
@@ -327,7 +327,7 @@ void RSyncImplementation::fillChecksum(const std::shared_ptr<DBSyncWrapper>& spD
     spDBSyncWrapper->select(selectData, callback);
 
     // rightCtx field will have the final checksum
-    ctx.rightCtx.checksum = Utils::asciiToHex(hash->hash());
+    ctx.rightCtx.checksum = Utils::asciiToHex(hash.hash());
 }
 
 nlohmann::json RSyncImplementation::getRowData(const std::shared_ptr<DBSyncWrapper>& spDBSyncWrapper,
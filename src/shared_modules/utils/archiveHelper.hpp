@@ -17,7 +17,14 @@
 #include "customDeleter.hpp"
 #include <algorithm>
 #include <atomic>
+#include <exception>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <mutex>
+#include <streambuf>
+#include <thread>
 #include <vector>
 
 template<typename F, typename G, F func1, G func2>
@@ -42,7 +49,7 @@ using ArchiveWritePtr = std::unique_ptr<
 namespace Utils
 {
     /**
-     * @brief Decompression for .tar compressed files.
+     * @brief Decompression for .tar compressed files, and streaming reads of .tar and .zip files.
      *
      */
     class ArchiveHelper
@@ -76,6 +83,133 @@ namespace Utils
             }
         }
 
+        /**
+         * @brief Stream buffer over the data of the current entry of an archive, read as it decompresses.
+         *
+         */
+        class EntryStreamBuf final : public std::streambuf
+        {
+            struct archive* m_archive;
+            const std::atomic<bool>& m_forceStop;
+            std::vector<char> m_buffer;
+            std::string m_error;
+
+        protected:
+            int_type underflow() override
+            {
+                if (gptr() == egptr() && m_error.empty() && !m_forceStop.load())
+                {
+                    const auto size = archive_read_data(m_archive, m_buffer.data(), m_buffer.size());
+
+                    if (size < 0)
+                    {
+                        m_error = archive_error_string(m_archive) ? archive_error_string(m_archive) : "Unknown error";
+                    }
+                    else
+                    {
+                        setg(m_buffer.data(), m_buffer.data(), m_buffer.data() + size);
+                    }
+                }
+
+                return gptr() == egptr() ? traits_type::eof() : traits_type::to_int_type(*gptr());
+            }
+
+        public:
+            EntryStreamBuf(struct archive* archiveRead, const std::atomic<bool>& forceStop)
+                : m_archive(archiveRead)
+                , m_forceStop(forceStop)
+                , m_buffer(READ_BUFFER_SIZE)
+            {
+            }
+
+            /**
+             * @brief Error found reading the data, empty if none. The stream only sees an early end of the data.
+             *
+             */
+            const std::string& error() const
+            {
+                return m_error;
+            }
+        };
+
+        static constexpr size_t READ_BUFFER_SIZE {64 * 1024};
+
+        static ArchiveReadPtr openArchive(const std::string& filename, const std::function<void(struct archive*)>& setFormats)
+        {
+            ArchiveReadPtr archiveRead(archive_read_new());
+            setFormats(archiveRead.get());
+
+            if (archive_read_open_filename(archiveRead.get(), filename.c_str(), READ_BUFFER_SIZE) != ARCHIVE_OK)
+            {
+                const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
+            }
+
+            return archiveRead;
+        }
+
+        static bool isSelected(const std::vector<std::string>& extractOnly, const std::string& pathname)
+        {
+            return extractOnly.empty() || std::find_if(extractOnly.cbegin(),
+                                                       extractOnly.cend(),
+                                                       [&pathname](const std::string& path)
+                                                       {
+                                                           return pathname.find(path) != std::string::npos;
+                                                       }) != extractOnly.cend();
+        }
+
+        /**
+         * @brief Read the entries of an open archive, giving to the callback the selected files of this worker.
+         *
+         */
+        static void readEntries(struct archive* archiveRead,
+                                const std::function<void(const std::string&, std::istream&)>& onEntry,
+                                const std::atomic<bool>& forceStop,
+                                const std::vector<std::string>& extractOnly,
+                                size_t worker = 0,
+                                size_t workers = 1)
+        {
+            struct archive_entry* entry;
+
+            for (size_t index = 0; !forceStop.load(); ++index)
+            {
+                const auto retVal = archive_read_next_header(archiveRead, &entry);
+                if (retVal == ARCHIVE_EOF)
+                {
+                    break;
+                }
+
+                if (retVal != ARCHIVE_OK)
+                {
+                    const std::string errMsg = archive_error_string(archiveRead) ? archive_error_string(archiveRead) : "Unknown error";
+                    throw std::runtime_error("Error reading next header during decompression. Error: " + errMsg);
+                }
+
+                const std::string pathname = archive_entry_pathname(entry) ? archive_entry_pathname(entry) : "";
+
+                // The data of the skipped entries is not decompressed.
+                if (index % workers == worker && archive_entry_filetype(entry) == AE_IFREG &&
+                    isSelected(extractOnly, pathname))
+                {
+                    EntryStreamBuf buffer(archiveRead, forceStop);
+                    std::istream content(&buffer);
+                    onEntry(pathname, content);
+
+                    if (!buffer.error().empty())
+                    {
+                        throw std::runtime_error("Error reading file during data copy. Error: " + buffer.error());
+                    }
+                }
+            }
+        }
+
+        static bool isZip(const std::string& filename)
+        {
+            char magic[4] {};
+            std::ifstream file(filename, std::ios::binary);
+            return file.read(magic, sizeof(magic)) && std::equal(magic, magic + sizeof(magic), "PK\x03\x04");
+        }
+
     public:
         ArchiveHelper(const ArchiveHelper&) = delete;
         ArchiveHelper& operator=(const ArchiveHelper&) = delete;
@@ -168,6 +302,116 @@ namespace Utils
                 }
             }
         }
+
+        /**
+         * @brief Read the files of a TAR or ZIP archive as they decompress, without extracting them to disk.
+         *
+         * @param filename Compressed (.tar, .zip) file name.
+         * @param onEntry Called with the path of each file in the archive and a stream of its content. The stream is
+         * only valid during the call, the content not read is skipped.
+         * @param forceStop Stops the reading when set.
+         * @param extractOnly Compressed elements to read, all if empty.
+         */
+        static void forEachEntry(const std::string& filename,
+                                 const std::function<void(const std::string&, std::istream&)>& onEntry,
+                                 const std::atomic<bool>& forceStop = false,
+                                 const std::vector<std::string>& extractOnly = {})
+        {
+            const auto archiveRead = openArchive(filename,
+                                                 [](struct archive* archive)
+                                                 {
+                                                     archive_read_support_format_tar(archive);
+                                                     archive_read_support_format_zip(archive);
+                                                 });
+            readEntries(archiveRead.get(), onEntry, forceStop, extractOnly);
+        }
+
+        /**
+         * @brief Read the files of an archive in parallel, as they decompress.
+         *
+         * The entries of a ZIP archive are compressed independently: each worker opens the archive and decompresses
+         * its share of the entries, seeking over the others. Any other format is read by the calling thread, as
+         * forEachEntry does.
+         *
+         * @param filename Compressed (.tar, .zip) file name.
+         * @param onEntry Called with the path of each file and a stream of its content, from several threads at once.
+         * @param workers Number of workers.
+         * @param forceStop Stops the reading when set.
+         * @param extractOnly Compressed elements to read, all if empty.
+         */
+        static void forEachEntryParallel(const std::string& filename,
+                                         const std::function<void(const std::string&, std::istream&)>& onEntry,
+                                         size_t workers = std::max(std::thread::hardware_concurrency(), 1u),
+                                         const std::atomic<bool>& forceStop = false,
+                                         const std::vector<std::string>& extractOnly = {})
+        {
+            if (workers <= 1 || !isZip(filename))
+            {
+                forEachEntry(filename, onEntry, forceStop, extractOnly);
+                return;
+            }
+
+            std::vector<ArchiveReadPtr> archives;
+            for (size_t worker = 0; worker < workers; ++worker)
+            {
+                archives.emplace_back(openArchive(filename, archive_read_support_format_zip_seekable));
+            }
+
+            // The first error stops the other workers and is thrown once all of them finish. The stop requested by
+            // the caller is seen by each worker at its next entry.
+            std::atomic<bool> stop {forceStop.load()};
+            std::exception_ptr error;
+            std::mutex errorMutex;
+            const auto work = [&](size_t worker)
+            {
+                try
+                {
+                    readEntries(
+                        archives.at(worker).get(),
+                        [&](const std::string& pathname, std::istream& content)
+                        {
+                            if (forceStop.load())
+                            {
+                                stop = true;
+                            }
+                            else
+                            {
+                                onEntry(pathname, content);
+                            }
+                        },
+                        stop,
+                        extractOnly,
+                        worker,
+                        workers);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(errorMutex);
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                    stop = true;
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (size_t worker = 1; worker < workers; ++worker)
+            {
+                threads.emplace_back(work, worker);
+            }
+            work(0);
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
     };
 } // namespace Utils
 
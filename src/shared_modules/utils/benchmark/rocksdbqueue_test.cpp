@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 #include <filesystem>
 #include <system_error>
+#include <vector>
 #include "rocksDBQueue.hpp"
 
 constexpr auto TEST_DB = "test.db";
@@ -38,6 +39,41 @@ static void popBenchmark(benchmark::State& state)
 
 BENCHMARK(popBenchmark);
 
+static void pushBulkBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    RocksDBQueue<std::string> queue(TEST_DB);
+    const std::vector<std::string> bulk(state.range(0), "test");
+    for (auto _ : state)
+    {
+        queue.pushBulk(bulk);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(pushBulkBenchmark)->Arg(1)->Arg(100)->Arg(1000);
+
+static void popBulkBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    RocksDBQueue<std::string> queue(TEST_DB);
+    const std::vector<std::string> bulk(state.range(0), "test");
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        queue.pushBulk(bulk);
+        state.ResumeTiming();
+        queue.popBulk(state.range(0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(popBulkBenchmark)->Arg(1)->Arg(100)->Arg(1000);
+
 static void frontBenchmark(benchmark::State& state)
 {
     std::error_code ec;
@@ -135,6 +135,25 @@ public:
         }
     }
 
+    /**
+     * @brief Changes the capacity of the cache.
+     *
+     * If the capacity shrinks, the least recently used items are removed until the
+     * cache fits, so the most recently used ones are kept.
+     *
+     * @param capacity The new maximum number of key-value pairs, greater than zero.
+     */
+    void resize(const size_t capacity)
+    {
+        m_capacity = capacity;
+
+        while (m_map.size() > m_capacity)
+        {
+            m_map.erase(m_list.back());
+            m_list.pop_back();
+        }
+    }
+
     /**
      * @brief Clears the cache by removing all key-value pairs.
      */
@@ -61,6 +61,16 @@ class RealFileSystemT
         {
             return std::filesystem::is_directory(path);
         }
+
+        /**
+         * @brief Last modification time
+         * @param path Path to check
+         * @return The time of the last modification of the path
+         */
+        static std::filesystem::file_time_type last_write_time(const std::filesystem::path& path)
+        {
+            return std::filesystem::last_write_time(path);
+        }
 };
 
 using RealFileSystem = RealFileSystemT<>;
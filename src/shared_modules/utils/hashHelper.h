@@ -35,6 +35,7 @@ namespace Utils
         public:
             HashData(const HashType hashType = HashType::Sha1)
                 : m_spCtx{createContext()}
+                , m_hashType{hashType}
             {
                 initializeContext(hashType, m_spCtx);
             }
@@ -80,6 +81,28 @@ namespace Utils
                 // LCOV_EXCL_STOP
                 return {digest, digest + digestSize};
             }
+            /**
+             * @brief Restarts the digest to hash a new value, reusing the context instead of allocating a new one.
+             * It must be called after hash() to reuse the object.
+             */
+            void reset()
+            {
+                const auto ret
+                {
+                    EVP_DigestInit_ex(m_spCtx.get(), digestType(m_hashType), nullptr)
+                };
+
+                // LCOV_EXCL_START
+                if (!ret)
+                {
+                    throw std::runtime_error
+                    {
+                        "Error initializing EVP_MD_CTX."
+                    };
+                }
+
+                // LCOV_EXCL_STOP
+            }
         private:
             struct EvpContextDeleter final
             {
@@ -105,22 +128,24 @@ namespace Utils
                 // LCOV_EXCL_STOP
                 return ctx;
             }
-            static void initializeContext(const HashType hashType, std::unique_ptr<EVP_MD_CTX, EvpContextDeleter>& spCtx)
+            static const EVP_MD* digestType(const HashType hashType)
             {
-                auto ret{0};
-
                 switch (hashType)
                 {
                     case HashType::Sha1:
-                        ret = EVP_DigestInit(spCtx.get(), EVP_sha1());
-                        break;
+                        return EVP_sha1();
 
                     case HashType::Sha256:
-                        ret = EVP_DigestInit(spCtx.get(), EVP_sha256());
-                        break;
+                        return EVP_sha256();
                 }
 
-                if (!ret)
+                return nullptr;
+            }
+            static void initializeContext(const HashType hashType, std::unique_ptr<EVP_MD_CTX, EvpContextDeleter>& spCtx)
+            {
+                const auto type{ digestType(hashType) };
+
+                if (!type || !EVP_DigestInit(spCtx.get(), type))
                 {
                     throw std::runtime_error
                     {
@@ -129,6 +154,7 @@ namespace Utils
                 }
             }
             std::unique_ptr<EVP_MD_CTX, EvpContextDeleter> m_spCtx;
+            HashType m_hashType;
     };
 
     /**
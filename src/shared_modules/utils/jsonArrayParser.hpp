@@ -12,11 +12,21 @@
 #ifndef _JSON_ARRAY_PARSER_HPP
 #define _JSON_ARRAY_PARSER_HPP
 
+#include "defer.hpp"
 #include "json.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <queue>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace JsonArray
 {
@@ -451,5 +461,135 @@ namespace JsonArray
         nlohmann::json::sax_parse(file, &arrayParser);
     }
 
+    /**
+     * @brief Parses a JSON file and processes the items of the target array in parallel, committing the results in
+     * order.
+     * @details The calling thread parses the file and hands every item to a pool of worker threads, that run \p
+     * processItemCallback on them. The results are handed to \p commitItemCallback on the calling thread, in the same
+     * order the items appear in the file. At most a few items per worker are parsed ahead of the last committed one, so
+     * the memory stays bounded.
+     *
+     * @tparam Result Type of the result of processing an item.
+     * @param filepath Path to the JSON file.
+     * @param processItemCallback Callback invoked on a worker thread for every item found on the target array. It
+     * must be safe to call it concurrently.
+     * @param commitItemCallback Callback invoked on the calling thread with the result of every item, in order. If it
+     * returns false the parsing stops.
+     * @param threads Number of worker threads.
+     * @param arrayPointer JSON Pointer to the target array.
+     * @param processBodyCallback Callback invoked after all the items are committed, with the body of the JSON object.
+     * If the \p commitItemCallback stops the parsing, the \p processBodyCallback will not be called.
+     */
+    template<typename Result>
+    static void parallelParse(
+        const std::filesystem::path& filepath,
+        std::function<Result(nlohmann::json&&, const size_t)> processItemCallback,
+        std::function<bool(Result&&, const size_t)> commitItemCallback,
+        const size_t threads,
+        const nlohmann::json::json_pointer& arrayPointer = nlohmann::json::json_pointer(),
+        std::function<void(nlohmann::json&&)> processBodyCallback = [](nlohmann::json&&) {})
+    {
+        // Open the input file
+        std::ifstream file(filepath);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Unable to open input file: " + filepath.string());
+        }
+
+        std::mutex tasksMutex;
+        std::condition_variable tasksCondition;
+        std::queue<std::packaged_task<Result()>> tasks;
+        bool stopWorkers {false};
+        std::vector<std::thread> workers;
+
+        // Stop the workers on every exit path. The items not processed yet are discarded.
+        DEFER(
+            [&]()
+            {
+                {
+                    std::scoped_lock lock {tasksMutex};
+                    stopWorkers = true;
+                }
+                tasksCondition.notify_all();
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+            });
+
+        for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i)
+        {
+            workers.emplace_back(
+                [&]()
+                {
+                    while (true)
+                    {
+                        std::packaged_task<Result()> task;
+                        {
+                            std::unique_lock lock {tasksMutex};
+                            tasksCondition.wait(lock, [&]() { return stopWorkers || !tasks.empty(); });
+                            if (stopWorkers)
+                            {
+                                return;
+                            }
+                            task = std::move(tasks.front());
+                            tasks.pop();
+                        }
+                        task();
+                    }
+                });
+        }
+
+        // Items handed to the workers and not committed yet, in file order.
+        std::deque<std::pair<std::future<Result>, size_t>> pendingItems;
+        const auto maxPendingItems {workers.size() * 4};
+        bool continueParsing {true};
+        std::optional<nlohmann::json> body;
+
+        const auto commitItem = [&]()
+        {
+            auto future = std::move(pendingItems.front().first);
+            const auto itemId = pendingItems.front().second;
+            pendingItems.pop_front();
+            continueParsing = commitItemCallback(future.get(), itemId);
+        };
+
+        JsonSaxArrayParser arrayParser(
+            arrayPointer,
+            [&](nlohmann::json&& item, const size_t itemId)
+            {
+                std::packaged_task<Result()> task(
+                    [&processItemCallback, item = std::move(item), itemId]() mutable
+                    { return processItemCallback(std::move(item), itemId); });
+                pendingItems.emplace_back(task.get_future(), itemId);
+                {
+                    std::scoped_lock lock {tasksMutex};
+                    tasks.push(std::move(task));
+                }
+                tasksCondition.notify_one();
+
+                while (continueParsing && pendingItems.size() > maxPendingItems)
+                {
+                    commitItem();
+                }
+                return continueParsing;
+            },
+            // The body is handed over once the remaining items are committed.
+            [&body](nlohmann::json&& parsedBody) { body = std::move(parsedBody); });
+
+        // Parse the file
+        nlohmann::json::sax_parse(file, &arrayParser);
+
+        while (continueParsing && !pendingItems.empty())
+        {
+            commitItem();
+        }
+
+        if (continueParsing && body)
+        {
+            processBodyCallback(std::move(*body));
+        }
+    }
+
 } // namespace JsonArray
 #endif // _JSON_ARRAY_PARSER_HPP
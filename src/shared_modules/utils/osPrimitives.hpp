@@ -68,6 +68,11 @@ protected:
         return ::send(sockfd, buf, len, flags);
     }
 
+    inline ssize_t sendmsg(int sockfd, const struct msghdr* msg, int flags)
+    {
+        return ::sendmsg(sockfd, msg, flags);
+    }
+
     inline ssize_t recv(int sockfd, void* buf, size_t len, int flags)
     {
         return ::recv(sockfd, buf, len, flags);
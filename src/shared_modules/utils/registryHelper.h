@@ -19,7 +19,9 @@
 #include <windows.h>
 #include <winreg.h>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <vector>
 #include "encodingWindowsHelper.h"
 #include "windowsHelper.h"
 #include "stringHelper.h"
@@ -203,9 +205,8 @@ namespace Utils
                 return ret;
             }
 
-            std::string keyModificationDate() const
+            bool keyModificationTime(ULONGLONG& value) const
             {
-                std::string ret;
                 FILETIME lastModificationTime { };
                 const auto result
                 {
@@ -218,9 +219,21 @@ namespace Utils
 
                     time.LowPart = lastModificationTime.dwLowDateTime;
                     time.HighPart = lastModificationTime.dwHighDateTime;
+                    value = time.QuadPart;
+                }
+
+                return ERROR_SUCCESS == result;
+            }
 
+            std::string keyModificationDate() const
+            {
+                std::string ret;
+                ULONGLONG time { };
+
+                if (keyModificationTime(time))
+                {
                     // Use structure values to build 18-digit LDAP/FILETIME number
-                    ret = Utils::buildTimestamp(time.QuadPart);
+                    ret = Utils::buildTimestamp(time);
                 }
 
                 return ret;
@@ -314,6 +327,43 @@ namespace Utils
                 return ret;
             }
 
+            bool string(const std::string& valueName, std::string& value, std::vector<BYTE>& buffer) const
+            {
+                // The buffer is reused between reads, it's only grown when a value doesn't fit in it.
+                constexpr auto MIN_BUFFER_SIZE {256};
+
+                if (buffer.size() < MIN_BUFFER_SIZE)
+                {
+                    buffer.resize(MIN_BUFFER_SIZE);
+                }
+
+                auto size {static_cast<DWORD>(buffer.size())};
+                auto result {RegQueryValueEx(m_registryKey, valueName.c_str(), nullptr, nullptr, buffer.data(), &size)};
+
+                if (ERROR_MORE_DATA == result)
+                {
+                    buffer.resize(size);
+                    result = RegQueryValueEx(m_registryKey, valueName.c_str(), nullptr, nullptr, buffer.data(), &size);
+                }
+
+                bool ret {ERROR_SUCCESS == result};
+
+                if (ret)
+                {
+                    try
+                    {
+                        const auto data {reinterpret_cast<const char*>(buffer.data())};
+                        value = EncodingWindowsHelper::stringAnsiToStringUTF8(std::string {data, strnlen(data, size)});
+                    }
+                    catch (...)
+                    {
+                        ret = false;
+                    }
+                }
+
+                return ret;
+            }
+
         private:
             static HKEY openRegistry(const HKEY key, const std::string& subKey, const REGSAM access)
             {
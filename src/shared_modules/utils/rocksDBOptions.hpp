@@ -12,18 +12,33 @@
 #ifndef _ROCKS_DB_OPTIONS_HPP
 #define _ROCKS_DB_OPTIONS_HPP
 
+#include "rocksDBResources.hpp"
 #include <memory>
 #include <rocksdb/db.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
 #include <rocksdb/table.h>
+#include <rocksdb/utilities/table_properties_collectors.h>
 
 namespace Utils
 {
     constexpr auto ROCKSDB_WRITE_BUFFER_SIZE = 32 * 1024 * 1024;
-    constexpr auto ROCKSDB_WRITE_BUFFER_MANAGER_SIZE = 32 * 1024 * 1024;
     constexpr auto ROCKSDB_MAX_WRITE_BUFFER_NUMBER = 2;
     constexpr auto ROCKSDB_MAX_OPEN_FILES = 256;
     constexpr auto ROCKSDB_NUM_LEVELS = 4;
-    constexpr auto ROCKSDB_BLOCK_CACHE_SIZE = 16 * 1024 * 1024;
+    constexpr auto ROCKSDB_BLOOM_BITS_PER_KEY = 10;
+    constexpr auto ROCKSDB_MEMTABLE_BLOOM_RATIO = 0.02;
+    constexpr auto ROCKSDB_QUEUE_DELETION_WINDOW = 10000;
+    constexpr auto ROCKSDB_QUEUE_DELETION_TRIGGER = 5000;
+
+    /**
+     * @brief Access pattern the database is tuned for.
+     */
+    enum class RocksDBProfile
+    {
+        Lookup, ///< Point reads of keys that may be missing.
+        Queue   ///< Writes at the tail and reads of existing keys at the head.
+    };
 
     class RocksDBOptions final
     {
@@ -32,7 +47,8 @@ namespace Utils
          * @brief Builds the table options for the RocksDB instance.
          * @return rocksdb::BlockBasedTableOptions Table options.
          */
-        static rocksdb::BlockBasedTableOptions buildTableOptions(const std::shared_ptr<rocksdb::Cache>& readCache)
+        static rocksdb::BlockBasedTableOptions buildTableOptions(const std::shared_ptr<rocksdb::Cache>& readCache,
+                                                                 const RocksDBProfile profile)
         {
             if (readCache == nullptr)
             {
@@ -41,15 +57,45 @@ namespace Utils
 
             rocksdb::BlockBasedTableOptions tableOptions;
             tableOptions.block_cache = readCache;
+
+            if (profile == RocksDBProfile::Lookup)
+            {
+                // Skip the files that do not have the key without reading them.
+                tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(ROCKSDB_BLOOM_BITS_PER_KEY));
+                // Find the key inside the data block with a hash instead of a binary search.
+                tableOptions.data_block_index_type = rocksdb::BlockBasedTableOptions::kDataBlockBinaryAndHash;
+                // Charge the filters and indexes to the shared cache, keeping the ones of L0 always there.
+                tableOptions.cache_index_and_filter_blocks = true;
+                tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+            }
+
             return tableOptions;
         }
 
+        /**
+         * @brief Builds the collector that marks a table file for compaction when most of its entries are deletions.
+         * The queues delete every element they read, so their files fill up with tombstones that each read of the
+         * head would have to skip until a regular compaction reaches them.
+         * @return std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> Collector factory.
+         */
+        static std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> queueCompactionTrigger()
+        {
+            return rocksdb::NewCompactOnDeletionCollectorFactory(ROCKSDB_QUEUE_DELETION_WINDOW,
+                                                                 ROCKSDB_QUEUE_DELETION_TRIGGER);
+        }
+
     public:
         /**
          * @brief Builds the column family options for the RocksDB instance.
+         * @param readCache Block cache.
+         * @param profile Access pattern to tune the column family for.
+         * @param prefixExtractor Prefix of the keys added to the bloom filters for the seeks, none if empty.
          * @return rocksdb::ColumnFamilyOptions Column family options.
          */
-        static rocksdb::ColumnFamilyOptions buildColumnFamilyOptions(const std::shared_ptr<rocksdb::Cache>& readCache)
+        static rocksdb::ColumnFamilyOptions
+        buildColumnFamilyOptions(const std::shared_ptr<rocksdb::Cache>& readCache,
+                                 const RocksDBProfile profile = RocksDBProfile::Lookup,
+                                 const std::shared_ptr<const rocksdb::SliceTransform>& prefixExtractor = nullptr)
         {
             rocksdb::ColumnFamilyOptions columnFamilyOptions;
             // Amount of data to build up in memory (backed by an unsorted log
@@ -60,7 +106,21 @@ namespace Utils
             // The maximum number of levels of compaction to allow.
             columnFamilyOptions.num_levels = ROCKSDB_NUM_LEVELS;
             // The size of the LRU cache used to prevent cold reads.
-            columnFamilyOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(buildTableOptions(readCache)));
+            columnFamilyOptions.table_factory.reset(
+                rocksdb::NewBlockBasedTableFactory(buildTableOptions(readCache, profile)));
+
+            if (profile == RocksDBProfile::Lookup)
+            {
+                // Bloom filter of the whole keys in the memtable, so missing keys do not scan it.
+                columnFamilyOptions.memtable_whole_key_filtering = true;
+                columnFamilyOptions.memtable_prefix_bloom_size_ratio = ROCKSDB_MEMTABLE_BLOOM_RATIO;
+                // The prefixes are added to the same filters as the whole keys.
+                columnFamilyOptions.prefix_extractor = prefixExtractor;
+            }
+            else
+            {
+                columnFamilyOptions.table_properties_collector_factories.emplace_back(queueCompactionTrigger());
+            }
 
             return columnFamilyOptions;
         }
@@ -70,7 +130,8 @@ namespace Utils
          * @return rocksdb::Options DB options.
          */
         static rocksdb::Options buildDBOptions(const std::shared_ptr<rocksdb::WriteBufferManager>& writeManager,
-                                               const std::shared_ptr<rocksdb::Cache>& readCache)
+                                               const std::shared_ptr<rocksdb::Cache>& readCache,
+                                               const RocksDBProfile profile = RocksDBProfile::Lookup)
         {
             if (writeManager == nullptr)
             {
@@ -100,9 +161,41 @@ namespace Utils
             options.max_write_buffer_number = ROCKSDB_MAX_WRITE_BUFFER_NUMBER;
 
             // The size of the LRU cache used to prevent cold reads.
-            options.table_factory.reset(NewBlockBasedTableFactory(buildTableOptions(readCache)));
+            options.table_factory.reset(NewBlockBasedTableFactory(buildTableOptions(readCache, profile)));
+
+            if (profile == RocksDBProfile::Lookup)
+            {
+                options.memtable_whole_key_filtering = true;
+                options.memtable_prefix_bloom_size_ratio = ROCKSDB_MEMTABLE_BLOOM_RATIO;
+            }
+            else
+            {
+                options.table_properties_collector_factories.emplace_back(queueCompactionTrigger());
+            }
+
             return options;
         }
+
+        /**
+         * @brief Builds the DB options using the resources shared by the whole process.
+         * @param profile Access pattern to tune the database for.
+         * @return rocksdb::Options DB options.
+         */
+        static rocksdb::Options buildSharedDBOptions(const RocksDBProfile profile)
+        {
+            const auto& resources = RocksDBResources::instance();
+            return buildDBOptions(resources.writeManager(), resources.readCache(), profile);
+        }
+
+        /**
+         * @brief Builds the column family options using the block cache shared by the whole process.
+         * @param profile Access pattern to tune the column family for.
+         * @return rocksdb::ColumnFamilyOptions Column family options.
+         */
+        static rocksdb::ColumnFamilyOptions buildSharedColumnFamilyOptions(const RocksDBProfile profile)
+        {
+            return buildColumnFamilyOptions(RocksDBResources::instance().readCache(), profile);
+        }
     };
 } // namespace Utils
 
@@ -0,0 +1,82 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _ROCKS_DB_PREFIX_TRANSFORM_HPP
+#define _ROCKS_DB_PREFIX_TRANSFORM_HPP
+
+#include <rocksdb/slice.h>
+#include <rocksdb/slice_transform.h>
+#include <string>
+#include <string_view>
+
+namespace Utils
+{
+    /**
+     * @brief Prefix extractor that takes the key up to its first separator, inclusive. Keys without the separator
+     * have no prefix, so they are only looked up with the whole key filters.
+     *
+     * @details With it, the bloom filters also have the prefixes, and the seeks of keys that have the separator skip
+     * the files and memtables without their prefix. The iteration stays ordered for every key starting with the
+     * sought one, but it can stop when the prefix changes, so it must only be used when the seeks stop there.
+     */
+    class SeparatorPrefixTransform final : public rocksdb::SliceTransform
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param separator Separator that ends the prefix.
+         */
+        explicit SeparatorPrefixTransform(const char separator)
+            : m_separator {separator}
+            , m_name {std::string("wazuh.SeparatorPrefix.") + separator}
+        {
+        }
+
+        /**
+         * @brief Name of the extractor, stored in the files to know which ones can use their prefix filters.
+         *
+         * @return const char* Name.
+         */
+        const char* Name() const override
+        {
+            return m_name.c_str();
+        }
+
+        /**
+         * @brief Gets the prefix of a key.
+         *
+         * @param key Key that is in the domain.
+         * @return rocksdb::Slice Key up to the first separator, inclusive.
+         */
+        rocksdb::Slice Transform(const rocksdb::Slice& key) const override
+        {
+            return {key.data(), std::string_view(key.data(), key.size()).find(m_separator) + 1};
+        }
+
+        /**
+         * @brief Checks whether the key has a prefix.
+         *
+         * @param key Key.
+         * @return true if the key has the separator.
+         */
+        bool InDomain(const rocksdb::Slice& key) const override
+        {
+            return std::string_view(key.data(), key.size()).find(m_separator) != std::string_view::npos;
+        }
+
+    private:
+        const char m_separator;
+        const std::string m_name;
+    };
+} // namespace Utils
+
+#endif // _ROCKS_DB_PREFIX_TRANSFORM_HPP
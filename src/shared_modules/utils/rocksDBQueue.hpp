@@ -12,12 +12,16 @@
 #ifndef _ROCKSDB_QUEUE_HPP
 #define _ROCKSDB_QUEUE_HPP
 
+#include "rocksDBOptions.hpp"
 #include "rocksdb/db.h"
 #include "rocksdb/filter_policy.h"
 #include "rocksdb/table.h"
+#include "rocksdb/write_batch.h"
+#include <algorithm>
 #include <filesystem>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 // RocksDB integration as queue
 template<typename T, typename U = T>
@@ -27,25 +31,13 @@ public:
     explicit RocksDBQueue(const std::string& connectorName)
     {
         // RocksDB initialization.
-        // Read cache is used to cache the data read from the disk.
-        m_readCache = rocksdb::NewLRUCache(16 * 1024 * 1024);
-        rocksdb::BlockBasedTableOptions tableOptions;
-        tableOptions.block_cache = m_readCache;
-
-        // Write buffer manager is used to manage the memory used for writing data to the disk.
-        m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(64 * 1024 * 1024);
-
-        rocksdb::Options options;
-        options.table_factory.reset(NewBlockBasedTableFactory(tableOptions));
-        options.create_if_missing = true;
-        options.keep_log_file_num = 1;
-        options.info_log_level = rocksdb::InfoLogLevel::FATAL_LEVEL;
-        options.max_open_files = 64;
-        options.write_buffer_manager = m_writeManager;
-        options.num_levels = 4;
+        // Read cache and write buffer manager are shared by all the databases of the process.
+        m_readCache = Utils::RocksDBResources::instance().readCache();
+        m_writeManager = Utils::RocksDBResources::instance().writeManager();
 
-        options.write_buffer_size = 32 * 1024 * 1024;
-        options.max_write_buffer_number = 2;
+        rocksdb::Options options =
+            Utils::RocksDBOptions::buildDBOptions(m_writeManager, m_readCache, Utils::RocksDBProfile::Queue);
+        options.max_open_files = 64;
 
         rocksdb::DB* db;
 
@@ -105,6 +97,24 @@ public:
         ++m_size;
     }
 
+    void pushBulk(const std::vector<T>& data)
+    {
+        // RocksDB enqueue elements, all of them in a single write.
+        rocksdb::WriteBatch batch;
+        auto last = m_last;
+        for (const auto& element : data)
+        {
+            batch.Put(std::to_string(++last), element);
+        }
+
+        if (const auto status = m_db->Write(rocksdb::WriteOptions(), &batch); !status.ok())
+        {
+            throw std::runtime_error("Failed to enqueue elements");
+        }
+        m_last = last;
+        m_size += data.size();
+    }
+
     void pop()
     {
         // RocksDB dequeue element.
@@ -123,6 +133,31 @@ public:
         }
     }
 
+    void popBulk(const uint64_t elementsQuantity)
+    {
+        // RocksDB dequeue elements, all of them in a single write.
+        const auto count = std::min(elementsQuantity, m_size);
+        rocksdb::WriteBatch batch;
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            batch.Delete(std::to_string(m_first + i));
+        }
+
+        if (!m_db->Write(rocksdb::WriteOptions(), &batch).ok())
+        {
+            throw std::runtime_error("Failed to dequeue elements, can't delete them");
+        }
+
+        m_first += count;
+        m_size -= count;
+
+        if (m_size == 0)
+        {
+            m_first = 1;
+            m_last = 0;
+        }
+    }
+
     uint64_t size() const
     {
         return m_size;
@@ -17,15 +17,38 @@
 #include "rocksdb/filter_policy.h"
 #include "rocksdb/table.h"
 #include "stringHelper.h"
+#include <algorithm>
 #include <filesystem>
+#include <map>
+#include <set>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Operation of an element pushed with a coalescing key.
+ *
+ * An Insert adds or updates the keyed item and a Delete removes it.
+ */
+enum class CoalesceOperation
+{
+    Insert,
+    Delete
+};
 
 // RocksDB integration as queue
 template<typename T, typename U = T>
 class RocksDBQueueCF final
 {
 private:
+    struct CoalescedElement final
+    {
+        uint64_t position = 0;
+        // Whether the first element of the key was an insertion, that a deletion cancels.
+        bool inserted = false;
+    };
+
     struct QueueMetadata final
     {
         uint64_t head = 0;
@@ -34,13 +57,28 @@ private:
 
         // Time from epoch + postpone time.
         std::chrono::time_point<std::chrono::system_clock> postponeTime;
+
+        // Positions removed before reaching the head, skipped by pop.
+        std::set<uint64_t> holes;
+
+        // Pending elements pushed with a coalescing key, by position and by key. Not persisted: after a restart the
+        // queued elements are only replayed, not coalesced.
+        std::map<uint64_t, std::string> keys;
+        std::unordered_map<std::string, CoalescedElement> coalesced;
     };
 
+    std::string elementKey(std::string_view id, const uint64_t position) const
+    {
+        return std::string(id) + "_" + std::to_string(position);
+    }
+
     void initializeQueueData()
     {
         constexpr auto ID_QUEUE = 0;
         constexpr auto QUEUE_NUMBER = 1;
 
+        std::map<std::string, std::vector<uint64_t>> positions;
+
         auto it = std::unique_ptr<rocksdb::Iterator>(m_db->NewIterator(rocksdb::ReadOptions()));
         it->SeekToFirst();
         while (it->Valid())
@@ -68,22 +106,44 @@ private:
                 element.head = queueNumber;
             }
             ++element.size;
+            positions[id].push_back(queueNumber);
 
             it->Next();
         }
+
+        // Coalescing may have removed elements in the middle of a queue.
+        for (auto& [id, element] : m_queueMetadata)
+        {
+            if (element.size < element.tail - element.head + 1)
+            {
+                auto& present = positions[id];
+                std::sort(present.begin(), present.end());
+
+                for (auto position = element.head, i = uint64_t {0}; position <= element.tail; ++position)
+                {
+                    if (i < present.size() && present[i] == position)
+                    {
+                        ++i;
+                    }
+                    else
+                    {
+                        element.holes.insert(position);
+                    }
+                }
+            }
+        }
     }
 
 public:
     explicit RocksDBQueueCF(const std::string& path)
     {
         // RocksDB initialization.
-        // Read cache is used to cache the data read from the disk.
-        m_readCache = rocksdb::NewLRUCache(Utils::ROCKSDB_BLOCK_CACHE_SIZE);
-        // Write buffer manager is used to manage the memory used for writing data to the disk.
-        m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(Utils::ROCKSDB_WRITE_BUFFER_MANAGER_SIZE);
+        // Read cache and write buffer manager are shared by all the databases of the process.
+        m_readCache = Utils::RocksDBResources::instance().readCache();
+        m_writeManager = Utils::RocksDBResources::instance().writeManager();
 
-        rocksdb::Options options = Utils::RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
-        rocksdb::ColumnFamilyOptions columnFamilyOptions = Utils::RocksDBOptions::buildColumnFamilyOptions(m_readCache);
+        rocksdb::Options options =
+            Utils::RocksDBOptions::buildDBOptions(m_writeManager, m_readCache, Utils::RocksDBProfile::Queue);
 
         rocksdb::DB* dbRawPtr;
 
@@ -127,6 +187,63 @@ public:
         }
     }
 
+    /**
+     * @brief Push an element that coalesces with the pending element of the same key.
+     *
+     * If an element with the same key is waiting, and it is not the head (which may be in process), the new element
+     * replaces it in its position. If the pending chain of the key started with an insertion and the new element is a
+     * deletion, both cancel out and the pending element is removed.
+     *
+     * @param id Queue id.
+     * @param data Element.
+     * @param key Coalescing key, unique within the queue id.
+     * @param operation Operation of the element on the keyed item.
+     */
+    void push(std::string_view id, const T& data, const std::string& key, const CoalesceOperation operation)
+    {
+        if (const auto it {m_queueMetadata.find(id.data())}; it != m_queueMetadata.end())
+        {
+            auto& metadata = it->second;
+
+            if (const auto pending {metadata.coalesced.find(key)}; pending != metadata.coalesced.end())
+            {
+                const auto position = pending->second.position;
+
+                if (position != metadata.head)
+                {
+                    if (operation == CoalesceOperation::Delete && pending->second.inserted)
+                    {
+                        if (!m_db->Delete(rocksdb::WriteOptions(), elementKey(id, position)).ok())
+                        {
+                            throw std::runtime_error("Failed to cancel element, can't delete it");
+                        }
+
+                        metadata.holes.insert(position);
+                        metadata.keys.erase(position);
+                        metadata.coalesced.erase(pending);
+                        --metadata.size;
+                    }
+                    else if (!m_db->Put(rocksdb::WriteOptions(), elementKey(id, position), data).ok())
+                    {
+                        throw std::runtime_error("Failed to replace element");
+                    }
+
+                    return;
+                }
+
+                // The head may be in process, the new element goes after it.
+                metadata.keys.erase(position);
+                metadata.coalesced.erase(pending);
+            }
+        }
+
+        push(id, data);
+
+        auto& metadata = m_queueMetadata[std::string(id)];
+        metadata.keys.emplace(metadata.tail, key);
+        metadata.coalesced.emplace(key, CoalescedElement {metadata.tail, operation == CoalesceOperation::Insert});
+    }
+
     void pop(std::string_view id)
     {
         if (const auto it {m_queueMetadata.find(id.data())}; it != m_queueMetadata.end())
@@ -137,13 +254,28 @@ public:
                 throw std::runtime_error("Failed to dequeue element, can't delete it");
             }
 
-            ++it->second.head;
-            --it->second.size;
+            auto& metadata = it->second;
 
-            if (it->second.size == 0)
+            if (const auto key {metadata.keys.find(metadata.head)}; key != metadata.keys.end())
+            {
+                metadata.coalesced.erase(key->second);
+                metadata.keys.erase(key);
+            }
+
+            ++metadata.head;
+            --metadata.size;
+
+            if (metadata.size == 0)
             {
                 m_queueMetadata.erase(it);
             }
+            else
+            {
+                while (metadata.holes.erase(metadata.head) > 0)
+                {
+                    ++metadata.head;
+                }
+            }
         }
         else
         {
@@ -0,0 +1,64 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _ROCKS_DB_RESOURCES_HPP
+#define _ROCKS_DB_RESOURCES_HPP
+
+#include "singleton.hpp"
+#include <memory>
+#include <rocksdb/cache.h>
+#include <rocksdb/write_buffer_manager.h>
+
+namespace Utils
+{
+    constexpr auto ROCKSDB_SHARED_BLOCK_CACHE_SIZE = 128 * 1024 * 1024;
+    constexpr auto ROCKSDB_SHARED_WRITE_BUFFER_SIZE = 64 * 1024 * 1024;
+
+    /**
+     * @brief Memory resources shared by all the RocksDB instances of the process.
+     *
+     * The memtables are charged to the block cache, so the cache size bounds the memory used by reads and writes of
+     * every open database, instead of each instance adding its own cache and write buffers.
+     */
+    class RocksDBResources final : public Singleton<RocksDBResources>
+    {
+        std::shared_ptr<rocksdb::Cache> m_readCache;
+        std::shared_ptr<rocksdb::WriteBufferManager> m_writeManager;
+
+    public:
+        RocksDBResources()
+            : m_readCache {rocksdb::NewLRUCache(ROCKSDB_SHARED_BLOCK_CACHE_SIZE)}
+            , m_writeManager {std::make_shared<rocksdb::WriteBufferManager>(ROCKSDB_SHARED_WRITE_BUFFER_SIZE,
+                                                                            m_readCache)}
+        {
+        }
+
+        /**
+         * @brief Block cache shared by all the databases.
+         * @return const std::shared_ptr<rocksdb::Cache>& Block cache.
+         */
+        const std::shared_ptr<rocksdb::Cache>& readCache() const
+        {
+            return m_readCache;
+        }
+
+        /**
+         * @brief Write buffer manager shared by all the databases.
+         * @return const std::shared_ptr<rocksdb::WriteBufferManager>& Write buffer manager.
+         */
+        const std::shared_ptr<rocksdb::WriteBufferManager>& writeManager() const
+        {
+            return m_writeManager;
+        }
+    };
+} // namespace Utils
+
+#endif // _ROCKS_DB_RESOURCES_HPP
@@ -17,6 +17,7 @@
 #include "rocksDBOptions.hpp"
 #include <algorithm>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <rocksdb/db.h>
 #include <rocksdb/filter_policy.h>
@@ -65,16 +66,23 @@ namespace Utils
          *
          * @param dbPath Path to the RocksDB database.
          * @param enableWal Whether to enable WAL or not.
+         * @param prefixExtractor Prefix extractor of the columns, only for the databases whose seeks never go past the
+         * prefix of the sought key. None if empty.
          */
-        explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true)
+        explicit TRocksDBWrapper(std::string dbPath,
+                                 const bool enableWal = true,
+                                 std::shared_ptr<const rocksdb::SliceTransform> prefixExtractor = nullptr)
             : m_enableWal {enableWal}
             , m_path {std::move(dbPath)}
+            , m_prefixExtractor {std::move(prefixExtractor)}
         {
-            m_readCache = rocksdb::NewLRUCache(16 * 1024 * 1024);
-            m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(128 * 1024 * 1024);
+            // Read cache and write buffer manager are shared by all the databases of the process.
+            m_readCache = RocksDBResources::instance().readCache();
+            m_writeManager = RocksDBResources::instance().writeManager();
 
             rocksdb::Options options = RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
-            rocksdb::ColumnFamilyOptions columnFamilyOptions = RocksDBOptions::buildColumnFamilyOptions(m_readCache);
+            rocksdb::ColumnFamilyOptions columnFamilyOptions =
+                RocksDBOptions::buildColumnFamilyOptions(m_readCache, RocksDBProfile::Lookup, m_prefixExtractor);
 
             T* dbRawPtr;
             std::vector<rocksdb::ColumnFamilyDescriptor> columnsDescriptors;
@@ -329,6 +337,53 @@ namespace Utils
                     key};
         }
 
+        /**
+         * @brief Visit the keys of several prefixes with a single iterator.
+         *
+         * The prefixes are sought in key order, so the iterator only moves forward and the blocks read for one prefix
+         * are reused by the next ones. The reads are asynchronous with adaptive readahead, which hides most of the
+         * latency of the blocks that are not in the cache.
+         *
+         * @param prefixes Prefixes to seek, in any order. Repeated prefixes are visited once per occurrence.
+         * @param callback Called with the index of the prefix in prefixes and each key-value pair that starts with it.
+         * The value is only valid during the call.
+         * @param columnName Column name from where to read. If empty, the default column will be used.
+         */
+        void seekPrefixes(
+            const std::vector<std::string>& prefixes,
+            const std::function<void(size_t index, const std::string& key, const rocksdb::Slice& value)>& callback,
+            const std::string& columnName = "")
+        {
+            std::vector<size_t> order(prefixes.size());
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                order[i] = i;
+            }
+            std::stable_sort(
+                order.begin(), order.end(), [&prefixes](size_t a, size_t b) { return prefixes[a] < prefixes[b]; });
+
+            rocksdb::ReadOptions readOptions;
+            readOptions.async_io = true;
+            readOptions.adaptive_readahead = true;
+
+            std::unique_ptr<rocksdb::Iterator> it(
+                m_db->NewIterator(readOptions, getColumnFamilyBasedOnName(columnName).handle()));
+
+            for (const auto index : order)
+            {
+                const auto& prefix = prefixes[index];
+                for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next())
+                {
+                    callback(index, it->key().ToString(), it->value());
+                }
+            }
+
+            if (!it->status().ok())
+            {
+                throw std::runtime_error("Error seeking prefixes: " + it->status().ToString());
+            }
+        }
+
         /**
          * @brief Get an iterator to the database.
          * @return RocksDBIterator Iterator to the database.
@@ -429,7 +484,9 @@ namespace Utils
             rocksdb::ColumnFamilyHandle* pColumnFamily;
 
             if (const auto status {m_db->CreateColumnFamily(
-                    RocksDBOptions::buildColumnFamilyOptions(m_readCache), columnName, &pColumnFamily)};
+                    RocksDBOptions::buildColumnFamilyOptions(m_readCache, RocksDBProfile::Lookup, m_prefixExtractor),
+                    columnName,
+                    &pColumnFamily)};
                 !status.ok())
             {
                 throw std::runtime_error {"Couldn't create column family: " + std::string {status.getState()}};
@@ -655,6 +712,7 @@ namespace Utils
         std::vector<ColumnFamilyRAII> m_columnsInstances;            ///< List of column family.
         const bool m_enableWal;                                      ///< Whether to enable WAL or not.
         const std::string m_path;                                    ///< Location of the DB.
+        const std::shared_ptr<const rocksdb::SliceTransform> m_prefixExtractor; ///< Prefix extractor of the columns.
         std::shared_ptr<rocksdb::Cache> m_readCache;                 ///< Cache for read operations.
         std::shared_ptr<rocksdb::WriteBufferManager> m_writeManager; ///< Write buffer manager.
 
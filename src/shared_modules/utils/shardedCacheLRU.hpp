@@ -0,0 +1,288 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SHARDED_CACHE_LRU_HPP
+#define _SHARDED_CACHE_LRU_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+constexpr auto DEFAULT_LRU_SHARDS {16};
+
+/**
+ * @brief Hit and miss counters of a ShardedLRUCache.
+ */
+struct LRUCacheStats final
+{
+    uint64_t hits {0};        ///< Lookups that found a valid value.
+    uint64_t misses {0};      ///< Lookups that didn't find a value, or found an expired one.
+    uint64_t evictions {0};   ///< Values removed to make room for new ones.
+    uint64_t expirations {0}; ///< Values removed because their time to live elapsed.
+};
+
+/**
+ * @brief Thread-safe Least Recently Used (LRU) cache, split in shards with their own lock.
+ *
+ * Each shard is a hash map pointing to the nodes of its recency list, so lookups, inserts and refreshes are O(1).
+ * The keys are spread over the shards by their hash, so concurrent accesses to different keys rarely wait for each
+ * other. The least recently used values of a shard are evicted when its share of the capacity is exceeded.
+ *
+ * The capacity is a number of values unless a weigher is given, in which case it is the sum of the weights of the
+ * values, e.g. their size in bytes. Values can optionally expire after a time to live.
+ *
+ * @tparam KeyType The type of the keys used for caching.
+ * @tparam ValueType The type of the values associated with the keys.
+ * @tparam Hash Hash function of the keys.
+ */
+template<typename KeyType, typename ValueType, typename Hash = std::hash<KeyType>>
+class ShardedLRUCache final
+{
+public:
+    /**
+     * @brief Function that returns the weight of a value in the capacity of the cache.
+     */
+    using Weigher = std::function<size_t(const KeyType&, const ValueType&)>;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param capacity Maximum number of values, or maximum total weight if a weigher is given. Zero disables the
+     * cache.
+     * @param shards Number of shards, it is reduced so that every shard can hold at least one value.
+     * @param timeToLive Time after which a value expires, zero for values that don't expire.
+     * @param weigher Function that returns the weight of a value, every value weighs one if empty.
+     */
+    explicit ShardedLRUCache(const size_t capacity,
+                             const size_t shards = DEFAULT_LRU_SHARDS,
+                             const std::chrono::milliseconds timeToLive = std::chrono::milliseconds::zero(),
+                             Weigher weigher = {})
+        : m_shards(std::clamp<size_t>(std::min(capacity, shards), 1, std::max<size_t>(shards, 1)))
+        , m_shardCapacity((capacity + m_shards.size() - 1) / m_shards.size())
+        , m_timeToLive(timeToLive)
+        , m_weigher(std::move(weigher))
+    {
+    }
+
+    /**
+     * @brief Inserts or replaces the value of a key, which becomes the most recently used one.
+     *
+     * @param key The key to be inserted.
+     * @param value The value associated with the key.
+     */
+    void insertKey(const KeyType& key, const ValueType& value)
+    {
+        const auto weight = m_weigher ? m_weigher(key, value) : 1;
+        auto& shard = shardOf(key);
+        std::scoped_lock lock(shard.mutex);
+        const auto shardCapacity = m_shardCapacity.load(std::memory_order_relaxed);
+
+        if (auto it = shard.index.find(key); it != shard.index.end())
+        {
+            shard.weight -= it->second->weight;
+            shard.entries.erase(it->second);
+            shard.index.erase(it);
+        }
+
+        // A value heavier than the shard would evict everything and still not fit.
+        if (weight > shardCapacity)
+        {
+            return;
+        }
+
+        shard.entries.push_front({key, value, weight, expiration()});
+        shard.index.emplace(key, shard.entries.begin());
+        shard.weight += weight;
+
+        evict(shard, shardCapacity);
+    }
+
+    /**
+     * @brief Retrieves the value associated with a key, which becomes the most recently used one.
+     *
+     * @param key The key for which to retrieve the value.
+     * @return The value associated with the key, or an empty optional if the key isn't found or it expired.
+     */
+    std::optional<ValueType> getValue(const KeyType& key)
+    {
+        auto& shard = shardOf(key);
+        std::scoped_lock lock(shard.mutex);
+
+        const auto it = shard.index.find(key);
+        if (it == shard.index.end())
+        {
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        if (isExpired(*it->second))
+        {
+            shard.weight -= it->second->weight;
+            shard.entries.erase(it->second);
+            shard.index.erase(it);
+            m_expirations.fetch_add(1, std::memory_order_relaxed);
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        // Move the accessed item to the front of the list (most recently used)
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return it->second->value;
+    }
+
+    /**
+     * @brief Removes the value of a key.
+     *
+     * @param key The key to be removed.
+     */
+    void erase(const KeyType& key)
+    {
+        auto& shard = shardOf(key);
+        std::scoped_lock lock(shard.mutex);
+
+        if (auto it = shard.index.find(key); it != shard.index.end())
+        {
+            shard.weight -= it->second->weight;
+            shard.entries.erase(it->second);
+            shard.index.erase(it);
+        }
+    }
+
+    /**
+     * @brief Removes all the values.
+     */
+    void clear()
+    {
+        for (auto& shard : m_shards)
+        {
+            std::scoped_lock lock(shard.mutex);
+            shard.entries.clear();
+            shard.index.clear();
+            shard.weight = 0;
+        }
+    }
+
+    /**
+     * @brief Changes the capacity. When it shrinks, the least recently used values that no longer fit are evicted and
+     * the warmest ones are kept.
+     *
+     * @note The number of shards doesn't change, so the capacity is spread over the shards the cache was created with.
+     *
+     * @param capacity Maximum number of values, or maximum total weight if a weigher is given. Zero disables the
+     * cache.
+     */
+    void resize(const size_t capacity)
+    {
+        const auto shardCapacity = (capacity + m_shards.size() - 1) / m_shards.size();
+        m_shardCapacity.store(shardCapacity, std::memory_order_relaxed);
+
+        for (auto& shard : m_shards)
+        {
+            std::scoped_lock lock(shard.mutex);
+            evict(shard, shardCapacity);
+        }
+    }
+
+    /**
+     * @brief Gets the number of values in the cache, including the expired ones not removed yet.
+     *
+     * @return size_t Number of values.
+     */
+    size_t size()
+    {
+        size_t size {0};
+        for (auto& shard : m_shards)
+        {
+            std::scoped_lock lock(shard.mutex);
+            size += shard.index.size();
+        }
+        return size;
+    }
+
+    /**
+     * @brief Gets the hit and miss counters since the cache was created.
+     *
+     * @return LRUCacheStats Counters.
+     */
+    LRUCacheStats stats() const
+    {
+        return {m_hits.load(std::memory_order_relaxed),
+                m_misses.load(std::memory_order_relaxed),
+                m_evictions.load(std::memory_order_relaxed),
+                m_expirations.load(std::memory_order_relaxed)};
+    }
+
+private:
+    struct Entry final
+    {
+        KeyType key;
+        ValueType value;
+        size_t weight;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+
+    struct Shard final
+    {
+        std::mutex mutex;
+        std::list<Entry> entries; ///< Values in LRU order, the most recently used first.
+        std::unordered_map<KeyType, typename std::list<Entry>::iterator, Hash> index;
+        size_t weight {0};
+    };
+
+    std::vector<Shard> m_shards;
+    std::atomic<size_t> m_shardCapacity;
+    const std::chrono::milliseconds m_timeToLive;
+    const Weigher m_weigher;
+    Hash m_hash;
+    std::atomic<uint64_t> m_hits {0};
+    std::atomic<uint64_t> m_misses {0};
+    std::atomic<uint64_t> m_evictions {0};
+    std::atomic<uint64_t> m_expirations {0};
+
+    void evict(Shard& shard, const size_t shardCapacity)
+    {
+        while (shard.weight > shardCapacity)
+        {
+            const auto& leastRecentlyUsed = shard.entries.back();
+            shard.weight -= leastRecentlyUsed.weight;
+            shard.index.erase(leastRecentlyUsed.key);
+            shard.entries.pop_back();
+            m_evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Shard& shardOf(const KeyType& key)
+    {
+        return m_shards[m_hash(key) % m_shards.size()];
+    }
+
+    std::chrono::steady_clock::time_point expiration() const
+    {
+        return m_timeToLive == std::chrono::milliseconds::zero() ? std::chrono::steady_clock::time_point::max()
+                                                                  : std::chrono::steady_clock::now() + m_timeToLive;
+    }
+
+    bool isExpired(const Entry& entry) const
+    {
+        return m_timeToLive != std::chrono::milliseconds::zero() &&
+               entry.expiresAt <= std::chrono::steady_clock::now();
+    }
+};
+
+#endif // _SHARDED_CACHE_LRU_HPP
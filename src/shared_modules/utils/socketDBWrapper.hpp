@@ -16,7 +16,9 @@
 #include "singleton.hpp"
 #include "socketClient.hpp"
 #include "socketDBWrapperException.hpp"
-#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -44,6 +46,12 @@ enum class DbQueryStatus : uint8_t
 class SocketDBWrapper final : public Singleton<SocketDBWrapper>
 {
 private:
+    struct PendingQuery final
+    {
+        std::promise<nlohmann::json> promise;
+        std::function<void(nlohmann::json&&)> onRow;
+    };
+
     std::unique_ptr<SocketClient<Socket<OSPrimitives, SizeHeaderProtocol>, EpollWrapper>> m_dbSocket;
     nlohmann::json m_response;
     nlohmann::json m_responsePartial;
@@ -51,9 +59,77 @@ private:
     DbQueryStatus m_queryStatus {DbQueryStatus::UNKNOWN};
     std::mutex m_mutexMessage;
     std::mutex m_mutexResponse;
-    std::condition_variable m_conditionVariable;
+    // Queries sent and not answered yet, in the order they were sent. wazuh-db answers the queries of a connection
+    // in order, so each final response belongs to the oldest one.
+    std::deque<PendingQuery> m_pendingQueries;
+    bool m_rowsStreamed {false};
     bool m_teardown {false};
-    bool m_dataReady {false};
+
+    /**
+     * @brief Hands a response row to a streaming query, recording the error of the query if the callback throws.
+     */
+    void streamRow(const std::function<void(nlohmann::json&&)>& onRow, nlohmann::json&& row)
+    {
+        try
+        {
+            onRow(std::move(row));
+        }
+        catch (const std::exception& ex)
+        {
+            m_queryStatus = DbQueryStatus::UNKNOWN;
+            m_exceptionStr = std::string("Error processing DB response row: ") + ex.what();
+        }
+    }
+
+    /**
+     * @brief Completes the oldest pending query with the response gathered so far, and resets it for the next one.
+     */
+    void completeQuery()
+    {
+        if (!m_pendingQueries.empty())
+        {
+            auto& [promise, onRow] = m_pendingQueries.front();
+
+            if (onRow && m_exceptionStr.empty())
+            {
+                // Rows of a single final response, the chunked ones were already streamed.
+                for (auto& row : m_response)
+                {
+                    streamRow(onRow, std::move(row));
+                }
+                m_response = nlohmann::json {};
+            }
+
+            if (!m_exceptionStr.empty())
+            {
+                switch (m_queryStatus)
+                {
+                    case DbQueryStatus::QUERY_NOT_SYNCED:
+                        promise.set_exception(std::make_exception_ptr(SocketDbWrapperException(m_exceptionStr)));
+                        break;
+                    case DbQueryStatus::EMPTY_RESPONSE:
+                    case DbQueryStatus::UNKNOWN:
+                    case DbQueryStatus::QUERY_ERROR:
+                    case DbQueryStatus::QUERY_UNKNOWN:
+                    case DbQueryStatus::QUERY_IGNORE:
+                    case DbQueryStatus::JSON_PARSING:
+                    case DbQueryStatus::INVALID_RESPONSE:
+                    default: promise.set_exception(std::make_exception_ptr(std::runtime_error(m_exceptionStr))); break;
+                }
+            }
+            else
+            {
+                promise.set_value(std::move(m_response));
+            }
+
+            m_pendingQueries.pop_front();
+        }
+
+        m_response.clear();
+        m_responsePartial.clear();
+        m_exceptionStr.clear();
+        m_rowsStreamed = false;
+    }
 
 public:
     void init(const std::string& socketPath = WDB_SOCKET)
@@ -70,7 +146,16 @@ public:
                 {
                     try
                     {
-                        m_responsePartial.push_back(nlohmann::json::parse(responsePacket.substr(4)));
+                        auto row = nlohmann::json::parse(responsePacket.substr(4));
+                        if (!m_pendingQueries.empty() && m_pendingQueries.front().onRow)
+                        {
+                            streamRow(m_pendingQueries.front().onRow, std::move(row));
+                            m_rowsStreamed = true;
+                        }
+                        else
+                        {
+                            m_responsePartial.push_back(std::move(row));
+                        }
                     }
                     catch (const nlohmann::detail::exception& ex)
                     {
@@ -104,7 +189,7 @@ public:
                     }
                     else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_OK) - 1, DB_WRAPPER_OK))
                     {
-                        if (!m_responsePartial.empty())
+                        if (!m_responsePartial.empty() || m_rowsStreamed)
                         {
                             m_response = m_responsePartial;
                         }
@@ -146,57 +231,95 @@ public:
                         m_queryStatus = DbQueryStatus::INVALID_RESPONSE;
                         m_exceptionStr = "DB query invalid response: " + responsePacket;
                     }
-                    m_dataReady = true;
-                    m_conditionVariable.notify_one();
+                    completeQuery();
                 }
             });
     }
 
-    void query(const std::string& query, nlohmann::json& response)
+    /**
+     * @brief Sends a query without waiting for its response, so several queries can be in flight on the connection.
+     *
+     * @param query Query to send.
+     * @return Future with the response of the query. It holds an exception if the query fails, and an empty response
+     * if the wrapper is torn down before the response arrives.
+     */
+    std::future<nlohmann::json> queryAsync(const std::string& query)
     {
-        // Acquire lock to avoid multiple threads sending queries at the same time
+        return queryAsync(query, {});
+    }
+
+    /**
+     * @brief Sends a query without waiting for its response, handing each row of the response to a callback as it
+     * arrives instead of collecting the rows into one JSON array.
+     *
+     * @param query Query to send.
+     * @param onRow Callback called for every row of the response, in order. It runs in the socket thread, so it
+     * must not send queries through the wrapper.
+     * @return Future completed when the whole response was received. Its value is empty, and it holds an exception if
+     * the query or the callback fails.
+     */
+    std::future<nlohmann::json> queryAsync(const std::string& query, std::function<void(nlohmann::json&&)> onRow)
+    {
+        // Acquire lock to send the queries in the same order they are queued.
         std::scoped_lock lockMessage {m_mutexMessage};
+        std::promise<nlohmann::json> promise;
+        auto future = promise.get_future();
 
         if (m_teardown)
         {
-            return;
+            promise.set_value({});
+            return future;
         }
 
-        // Acquire lock before clearing the response
-        std::unique_lock lockResponse {m_mutexResponse};
-
-        m_dataReady = false;
-        m_response.clear();
-        m_responsePartial.clear();
-        // coverity[missing_lock]
-        m_exceptionStr.clear();
-
         if (!m_dbSocket)
         {
             throw std::runtime_error("Socket DB Wrapper not initialized");
         }
 
-        m_dbSocket->send(query.c_str(), query.size());
-        m_conditionVariable.wait(lockResponse, [this] { return m_dataReady || m_teardown; });
+        {
+            // Queue the query before sending it, its response may arrive before send returns.
+            std::scoped_lock lockResponse {m_mutexResponse};
+            m_pendingQueries.push_back({std::move(promise), std::move(onRow)});
+        }
 
-        if (!m_exceptionStr.empty())
+        try
         {
-            // coverity[missing_lock]
-            switch (m_queryStatus)
-            {
-                case DbQueryStatus::QUERY_NOT_SYNCED: throw SocketDbWrapperException(m_exceptionStr); break;
-                case DbQueryStatus::EMPTY_RESPONSE:
-                case DbQueryStatus::UNKNOWN:
-                case DbQueryStatus::QUERY_ERROR:
-                case DbQueryStatus::QUERY_UNKNOWN:
-                case DbQueryStatus::QUERY_IGNORE:
-                case DbQueryStatus::JSON_PARSING:
-                case DbQueryStatus::INVALID_RESPONSE:
-                default: throw std::runtime_error(m_exceptionStr); break;
-            }
+            m_dbSocket->send(query.c_str(), query.size());
+        }
+        catch (...)
+        {
+            std::scoped_lock lockResponse {m_mutexResponse};
+            m_pendingQueries.pop_back();
+            throw;
         }
 
-        response = m_response;
+        return future;
+    }
+
+    void query(const std::string& query, nlohmann::json& response)
+    {
+        if (m_teardown)
+        {
+            return;
+        }
+
+        response = queryAsync(query).get();
+    }
+
+    /**
+     * @brief Sends a query and waits for its response, handing each row of the response to a callback as it arrives.
+     *
+     * @param query Query to send.
+     * @param onRow Callback called for every row of the response, in order.
+     */
+    void query(const std::string& query, std::function<void(nlohmann::json&&)> onRow)
+    {
+        if (m_teardown)
+        {
+            return;
+        }
+
+        queryAsync(query, std::move(onRow)).get();
     }
 
     /**
@@ -206,7 +329,19 @@ public:
     void teardown()
     {
         m_teardown = true;
-        m_conditionVariable.notify_all();
+        {
+            // Release the callers still waiting for a response.
+            std::scoped_lock lockResponse {m_mutexResponse};
+            for (auto& pendingQuery : m_pendingQueries)
+            {
+                pendingQuery.promise.set_value({});
+            }
+            m_pendingQueries.clear();
+            m_response.clear();
+            m_responsePartial.clear();
+            m_exceptionStr.clear();
+            m_rowsStreamed = false;
+        }
         m_dbSocket->stop();
     }
 };
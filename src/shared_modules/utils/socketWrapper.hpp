@@ -15,16 +15,18 @@
 #include "osPrimitives.hpp"
 #include "packet.hpp"
 #include <arpa/inet.h>
+#include <array>
 #include <chrono>
 #include <cstring>
+#include <deque>
 #include <filesystem>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <thread>
 #include <unistd.h>
 
@@ -35,6 +37,7 @@ using HeaderFieldType = uint32_t;
 constexpr auto PACKET_FIELD_SIZE {sizeof(PacketFieldType)};
 constexpr auto HEADER_FIELD_SIZE {sizeof(HeaderFieldType)};
 constexpr auto BUFFER_MAX_SIZE {8192 * 8};
+constexpr auto SEND_MAX_PACKETS {64};
 
 enum class SocketType
 {
@@ -170,12 +173,14 @@ public:
     /**
      * @brief Get the size of the header according to this protocol.
      *
-     * @param buffer Buffer to obtain the header size from.
+     * @param packet Packet body to obtain the header size from.
      * @return auto Header size.
      */
-    auto static getHeaderSize(const std::vector<char>& buffer)
+    auto static getHeaderSize(const char* packet)
     {
-        return *reinterpret_cast<const uint32_t*>(buffer.data());
+        HeaderFieldType headerSize;
+        std::memcpy(&headerSize, packet, sizeof(headerSize));
+        return headerSize;
     }
 
     /**
@@ -252,10 +257,10 @@ public:
     /**
      * @brief Get the size of the header according to this protocol.
      *
-     * @param buffer Buffer to obtain the header size from.
+     * @param packet Packet body to obtain the header size from.
      * @return auto Header size.
      */
-    auto static getHeaderSize(const std::vector<char>& buffer)
+    auto static getHeaderSize(const char* packet)
     {
         return 0;
     }
@@ -328,10 +333,10 @@ public:
     /**
      * @brief Get the size of the header according to this protocol.
      *
-     * @param buffer Buffer to obtain the header size from.
+     * @param packet Packet body to obtain the header size from.
      * @return auto Header size.
      */
-    auto static getHeaderSize(const std::vector<char>& buffer)
+    auto static getHeaderSize(const char* packet)
     {
         return 0;
     }
@@ -358,12 +363,6 @@ public:
     }
 };
 
-enum class SocketStatus
-{
-    HEADER,
-    BODY
-};
-
 enum SocketError
 {
     ERROR_SUCCESS = 0,
@@ -380,22 +379,25 @@ class Socket final : public T
 {
 private:
     int m_sock;
-    SocketStatus m_status;
-    uint32_t m_readPosition;
-    uint32_t m_readSize;
-    uint32_t m_totalReadSize;
+    size_t m_readPosition; ///< End of the data read into the receive buffer.
+    size_t m_readOffset;   ///< Start of the first packet of the receive buffer that was not delivered yet.
     std::vector<char> m_recvDataBuffer {};
     std::vector<char> m_sendDataBuffer {};
-    std::queue<Packet> m_unsentPacketList {};
+    std::deque<Packet> m_unsentPacketList {};
     std::mutex m_mutex;
 
+    static PacketFieldType packetSize(const char* packet)
+    {
+        PacketFieldType size;
+        std::memcpy(&size, packet, sizeof(size));
+        return size;
+    }
+
 public:
     explicit Socket(const int sock = INVALID_SOCKET)
         : m_sock {sock}
-        , m_status {SocketStatus::HEADER}
         , m_readPosition {0}
-        , m_readSize {PACKET_FIELD_SIZE}
-        , m_totalReadSize {0}
+        , m_readOffset {0}
         , m_recvDataBuffer {}
         , m_sendDataBuffer {}
         , m_unsentPacketList {}
@@ -470,122 +472,84 @@ public:
 
     void read(const std::function<void(const int, const char*, uint32_t, const char*, uint32_t)>& callback)
     {
-        uint32_t* uip;
-        ssize_t ret;
-        bool dataToRead = true;
+        if (m_sock == INVALID_SOCKET)
+        {
+            throw std::runtime_error {"Invalid socket"};
+        }
 
-        if (m_sock != INVALID_SOCKET)
+        // Each recv reads as much as fits in the buffer, which may be several packets, so the small packets cost
+        // a fraction of a system call each instead of one for their size and another for their body.
+        while (true)
         {
-            while (dataToRead)
+            // Move the incomplete packet, if any, to the beginning of the buffer.
+            if (m_readOffset > 0)
             {
-                // First read the header.
-                if (SocketStatus::HEADER == m_status)
+                std::memmove(
+                    m_recvDataBuffer.data(), m_recvDataBuffer.data() + m_readOffset, m_readPosition - m_readOffset);
+                m_readPosition -= m_readOffset;
+                m_readOffset = 0;
+            }
+
+            // Make room for the whole incomplete packet, and shrink the buffer back once the big packets are gone.
+            const auto packetEnd {m_readPosition >= PACKET_FIELD_SIZE
+                                      ? PACKET_FIELD_SIZE + packetSize(m_recvDataBuffer.data())
+                                      : PACKET_FIELD_SIZE};
+            if (packetEnd > m_recvDataBuffer.size())
+            {
+                m_recvDataBuffer.resize(packetEnd + 1);
+            }
+            else if (packetEnd <= BUFFER_MAX_SIZE && m_recvDataBuffer.size() > BUFFER_MAX_SIZE)
+            {
+                m_recvDataBuffer.resize(BUFFER_MAX_SIZE);
+            }
+
+            const auto ret = T::recv(m_sock,
+                                     m_recvDataBuffer.data() + m_readPosition,
+                                     m_recvDataBuffer.size() - m_readPosition,
+                                     0);
+
+            if (ret == SOCKET_ERROR)
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
                 {
-                    ret = T::recv(m_sock, (char*)(m_recvDataBuffer.data() + m_readPosition), m_readSize, 0);
-
-                    if (ret == SOCKET_ERROR)
-                    {
-                        if (errno == EAGAIN || errno == EWOULDBLOCK)
-                        {
-                            // No more data to read.
-                            dataToRead = false;
-                        }
-                        else
-                        {
-                            // Error reading from socket.
-                            throw std::runtime_error {"Error reading from socket."};
-                        }
-                    }
-                    else if (ret == 0)
-                    {
-                        // Remote shutdown / disconnect.
-                        throw std::runtime_error {"Remote shutdown / disconnect."};
-                    }
-                    else
-                    {
-                        // Check if we have read the entire header.
-                        if (ret != m_readSize)
-                        {
-                            // In this case we need to read more data, when the next read is called.
-                            m_readPosition += ret;
-                            m_readSize -= ret;
-                        }
-                        else
-                        {
-                            uip = (uint32_t*)m_recvDataBuffer.data();
-                            m_totalReadSize = *uip;
-
-                            if (m_totalReadSize > BUFFER_MAX_SIZE)
-                            {
-                                m_recvDataBuffer.resize(m_totalReadSize + 1);
-                            }
-
-                            // We have read the entire header, now we need to read the body.
-                            m_readPosition = 0;
-                            m_readSize = m_totalReadSize;
-                            m_status = SocketStatus::BODY;
-                        }
-                    }
+                    // No more data to read.
+                    break;
                 }
 
-                if (SocketStatus::BODY == m_status)
+                // Error reading from socket.
+                throw std::runtime_error {"Error reading from socket."};
+            }
+
+            if (ret == 0)
+            {
+                // Remote shutdown / disconnect.
+                throw std::runtime_error {"Remote shutdown / disconnect."};
+            }
+
+            m_readPosition += ret;
+
+            // Deliver the complete packets. The read offset is updated before the callback, so a packet is never
+            // delivered twice even if the callback throws.
+            while (m_readPosition - m_readOffset >= PACKET_FIELD_SIZE)
+            {
+                const auto* packet = m_recvDataBuffer.data() + m_readOffset;
+                const auto size = packetSize(packet);
+
+                if (m_readPosition - m_readOffset - PACKET_FIELD_SIZE < size)
                 {
-                    ret = T::recv(m_sock, (char*)(m_recvDataBuffer.data() + m_readPosition), m_readSize, 0);
-
-                    if (ret == SOCKET_ERROR)
-                    {
-                        if (errno == EAGAIN || errno == EWOULDBLOCK)
-                        {
-                            // No more data to read.
-                            dataToRead = false;
-                        }
-                        else
-                        {
-                            // Error reading from socket.
-                            throw std::runtime_error {"Error reading from socket."};
-                        }
-                    }
-                    else if (ret == 0)
-                    {
-                        // Remote shutdown / disconnect.
-                        throw std::runtime_error {"Remote shutdown / disconnect."};
-                    }
-                    else
-                    {
-                        if (m_readSize != ret)
-                        {
-                            m_readSize -= ret;
-                            m_readPosition += ret;
-                        }
-                        else
-                        {
-                            m_readPosition = 0;
-                            m_readSize = PACKET_FIELD_SIZE;
-                            m_status = SocketStatus::HEADER;
-
-                            auto headerDataSize = TCommunicationProtocol::getHeaderSize(m_recvDataBuffer);
-                            auto dataOffset = TCommunicationProtocol::getDataOffset(headerDataSize);
-                            auto headerOffset = TCommunicationProtocol::getHeaderOffset();
-
-                            callback(m_sock,
-                                     m_recvDataBuffer.data() + dataOffset,
-                                     m_totalReadSize - dataOffset,
-                                     m_recvDataBuffer.data() + headerOffset,
-                                     headerDataSize);
-
-                            if (m_totalReadSize > BUFFER_MAX_SIZE)
-                            {
-                                m_recvDataBuffer.resize(BUFFER_MAX_SIZE);
-                            }
-                        }
-                    }
+                    break;
                 }
+
+                const auto* body = packet + PACKET_FIELD_SIZE;
+                m_readOffset += PACKET_FIELD_SIZE + size;
+
+                const auto headerDataSize = TCommunicationProtocol::getHeaderSize(body);
+                const auto dataOffset = TCommunicationProtocol::getDataOffset(headerDataSize);
+                const auto headerOffset = TCommunicationProtocol::getHeaderOffset();
+
+                callback(m_sock, body + dataOffset, size - dataOffset, body + headerOffset, headerDataSize);
             }
         }
-        else
-        {
-            throw std::runtime_error {"Invalid socket"};
-        }
     }
 
     int accept()
@@ -630,10 +594,24 @@ public:
     void sendUnsentMessages()
     {
         std::lock_guard<std::mutex> lock {m_mutex};
+        std::array<struct iovec, SEND_MAX_PACKETS> iov {};
+
         while (!m_unsentPacketList.empty())
         {
-            auto& packet = m_unsentPacketList.front();
-            auto ret = T::send(m_sock, packet.data.get() + packet.offset, packet.size - packet.offset, MSG_NOSIGNAL);
+            // Gather the pending packets so they leave in a single call instead of one call per packet.
+            size_t count {0};
+            for (auto it = m_unsentPacketList.begin(); it != m_unsentPacketList.end() && count < iov.size(); ++it)
+            {
+                iov[count].iov_base = it->data.get() + it->offset;
+                iov[count].iov_len = it->size - it->offset;
+                ++count;
+            }
+
+            struct msghdr message {};
+            message.msg_iov = iov.data();
+            message.msg_iovlen = count;
+
+            auto ret = T::sendmsg(m_sock, &message, MSG_NOSIGNAL);
             if (ret <= 0)
             {
                 if (errno == EAGAIN || errno == EWOULDBLOCK)
@@ -645,17 +623,22 @@ public:
                     throw std::system_error {errno, std::system_category(), "Error sending data to socket"};
                 }
             }
-            else
+
+            // Remove the packets that were entirely sent, the rest of a partially sent one goes in the next call.
+            auto sent = static_cast<size_t>(ret);
+            while (sent > 0)
             {
-                if (ret != packet.size)
+                auto& packet = m_unsentPacketList.front();
+                const size_t pending = packet.size - packet.offset;
+                if (sent < pending)
                 {
-                    // In this case we need to send the rest of the data, when the next send is called.
-                    packet.offset += ret;
+                    packet.offset += sent;
+                    sent = 0;
                 }
                 else
                 {
-                    // We have sent the entire packet, remove it from the queue.
-                    m_unsentPacketList.pop();
+                    sent -= pending;
+                    m_unsentPacketList.pop_front();
                 }
             }
         }
@@ -672,7 +655,7 @@ public:
         // If there is data in the unsent queue, add it to the queue.
         if (!m_unsentPacketList.empty())
         {
-            m_unsentPacketList.emplace(m_sendDataBuffer.data(), bufferSize);
+            m_unsentPacketList.emplace_back(m_sendDataBuffer.data(), bufferSize);
         }
         else
         {
@@ -684,7 +667,7 @@ public:
 
                 if (ret <= 0)
                 {
-                    m_unsentPacketList.emplace(m_sendDataBuffer.data() + amountSent, bufferSize - amountSent);
+                    m_unsentPacketList.emplace_back(m_sendDataBuffer.data() + amountSent, bufferSize - amountSent);
                     throw std::runtime_error {"Error sending data to socket: " + std::string(std::strerror(errno))};
                 }
                 else
@@ -14,10 +14,12 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <memory>
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #pragma GCC diagnostic push
@@ -72,12 +74,63 @@ namespace Utils
         auto pos {data.find(toSearch)};
         const auto ret {std::string::npos != pos};
 
+        if (toSearch.empty() || toReplace.size() > toSearch.size())
+        {
+            while (std::string::npos != pos)
+            {
+                data.replace(pos, toSearch.size(), toReplace);
+                pos = data.find(toSearch, pos);
+            }
+
+            return ret;
+        }
+
+        if (toSearch == toReplace)
+        {
+            return ret;
+        }
+
+        // The replacements that don't grow the string are written over it in a single pass: the result is kept in
+        // [0, write) and the input not read yet in [read, size). As each search starts at the last replacement, a
+        // match may begin in the result and end in the input.
+        auto write {pos};
+        auto read {pos};
+
         while (std::string::npos != pos)
         {
-            data.replace(pos, toSearch.size(), toReplace);
-            pos = data.find(toSearch, pos);
+            read += toSearch.size() - (write - pos);
+            std::copy(toReplace.begin(), toReplace.end(), data.begin() + pos);
+            write = pos + toReplace.size();
+            pos = std::string::npos;
+
+            for (auto start = write - toReplace.size(); start < write; ++start)
+            {
+                const auto inResult {write - start};
+
+                if (read + toSearch.size() - inResult <= data.size() &&
+                    data.compare(start, inResult, toSearch, 0, inResult) == 0 &&
+                    data.compare(read, toSearch.size() - inResult, toSearch, inResult) == 0)
+                {
+                    pos = start;
+                    break;
+                }
+            }
+
+            if (std::string::npos == pos)
+            {
+                if (const auto next {data.find(toSearch, read)}; std::string::npos != next)
+                {
+                    std::copy(data.begin() + read, data.begin() + next, data.begin() + write);
+                    write += next - read;
+                    read = next;
+                    pos = write;
+                }
+            }
         }
 
+        std::copy(data.begin() + read, data.end(), data.begin() + write);
+        data.resize(write + data.size() - read);
+
         return ret;
     }
 
@@ -95,72 +148,202 @@ namespace Utils
         return ret;
     }
 
-    static std::string leftTrim(const std::string& str, const std::string& args = " ")
+    static std::string_view leftTrimView(std::string_view str, std::string_view args = " ")
     {
         const auto pos {str.find_first_not_of(args)};
 
-        if (pos != std::string::npos)
+        return pos != std::string_view::npos ? str.substr(pos) : std::string_view {};
+    }
+
+    static std::string_view rightTrimView(std::string_view str, std::string_view args = " ")
+    {
+        const auto pos {str.find_last_not_of(args)};
+
+        return pos != std::string_view::npos ? str.substr(0, pos + 1) : std::string_view {};
+    }
+
+    static std::string_view trimView(std::string_view str, std::string_view args = " ")
+    {
+        return leftTrimView(rightTrimView(str, args), args);
+    }
+
+    static std::string leftTrim(const std::string& str, const std::string& args = " ")
+    {
+        return std::string(leftTrimView(str, args));
+    }
+
+    static std::string rightTrim(const std::string& str, const std::string& args = " ")
+    {
+        return std::string(rightTrimView(str, args));
+    }
+
+    static std::string trim(const std::string& str, const std::string& args = " ")
+    {
+        return std::string(trimView(str, args));
+    }
+
+    static void trimInPlace(std::string& str, std::string_view args = " ")
+    {
+        const auto trimmed {trimView(str, args)};
+
+        if (trimmed.empty())
         {
-            return str.substr(pos);
+            str.clear();
         }
         else
         {
-            return "";
+            str.erase(static_cast<size_t>(trimmed.data() - str.data()) + trimmed.size());
+            str.erase(0, static_cast<size_t>(trimmed.data() - str.data()));
         }
-
-        return str;
     }
 
-    static std::string rightTrim(const std::string& str, const std::string& args = " ")
+    /**
+     * @brief Splits a string in views of its tokens, without copying them.
+     *
+     * The tokens are the same of split: an empty string has no tokens, and a trailing delimiter doesn't start a new
+     * one. The views are valid while the string is.
+     */
+    class Tokenizer final
     {
-        const auto pos {str.find_last_not_of(args)};
+    public:
+        class Iterator final
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+
+            Iterator() = default;
+
+            Iterator(std::string_view str, const char delimiter)
+                : m_rest {str}
+                , m_delimiter {delimiter}
+                , m_end {false}
+            {
+                next();
+            }
 
-        if (pos != std::string::npos)
+            reference operator*() const
+            {
+                return m_token;
+            }
+
+            pointer operator->() const
+            {
+                return &m_token;
+            }
+
+            Iterator& operator++()
+            {
+                next();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                auto ret {*this};
+                next();
+                return ret;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return m_end == other.m_end && (m_end || m_token.data() == other.m_token.data());
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            void next()
+            {
+                if (m_rest.empty())
+                {
+                    m_token = {};
+                    m_end = true;
+                    return;
+                }
+
+                const auto pos {m_rest.find(m_delimiter)};
+                m_token = m_rest.substr(0, pos);
+                m_rest = pos == std::string_view::npos ? std::string_view {} : m_rest.substr(pos + 1);
+            }
+
+            std::string_view m_rest;
+            std::string_view m_token;
+            char m_delimiter {};
+            bool m_end {true};
+        };
+
+        Tokenizer(std::string_view str, const char delimiter)
+            : m_str {str}
+            , m_delimiter {delimiter}
         {
-            return str.substr(0, pos + 1);
         }
-        else
+
+        Iterator begin() const
         {
-            return "";
+            return Iterator {m_str, m_delimiter};
         }
 
-        return str;
+        Iterator end() const
+        {
+            return Iterator {};
+        }
+
+    private:
+        std::string_view m_str;
+        char m_delimiter;
+    };
+
+    static void splitView(std::string_view str, const char delimiter, std::vector<std::string_view>& tokens)
+    {
+        // The vector is reused, so splitting line by line only allocates for the longest line.
+        tokens.clear();
+
+        for (const auto token : Tokenizer(str, delimiter))
+        {
+            tokens.push_back(token);
+        }
     }
 
-    static std::string trim(const std::string& str, const std::string& args = " ")
+    static std::vector<std::string_view> splitView(std::string_view str, const char delimiter)
     {
-        return leftTrim(rightTrim(str, args), args);
+        std::vector<std::string_view> tokens;
+        splitView(str, delimiter, tokens);
+
+        return tokens;
     }
 
-    static std::vector<std::string> split(const std::string& str, const char delimiter)
+    static std::vector<std::string> split(std::string_view str, const char delimiter)
     {
         std::vector<std::string> tokens;
-        std::string token;
-        std::istringstream tokenStream {str};
 
-        while (std::getline(tokenStream, token, delimiter))
+        for (const auto token : Tokenizer(str, delimiter))
         {
-            tokens.push_back(token);
+            tokens.emplace_back(token);
         }
 
         return tokens;
     }
 
-    static std::string splitIndex(const std::string& str, const char delimiter, const size_t index)
+    static std::string splitIndex(std::string_view str, const char delimiter, const size_t index)
     {
-        std::string retVal;
-        const auto& splitResult {split(str, delimiter)};
+        auto i {0ull};
 
-        if (index < splitResult.size())
+        for (const auto token : Tokenizer(str, delimiter))
         {
-            retVal = splitResult.at(index);
-        }
-        else
-        {
-            throw std::runtime_error("Invalid index to get values.");
+            if (i++ == index)
+            {
+                return std::string(token);
+            }
         }
 
-        return retVal;
+        throw std::runtime_error("Invalid index to get values.");
     }
 
     static std::vector<std::string> splitNullTerminatedStrings(const char* buffer)
@@ -170,11 +353,11 @@ namespace Utils
 
         while (buffer[0] != NULL_TERMINATED_DELIMITER)
         {
-            const std::string token(buffer);
+            const std::string_view token(buffer);
 
             if (!token.empty())
             {
-                ret.push_back(token);
+                ret.emplace_back(token);
             }
 
             buffer += token.size() + 1;
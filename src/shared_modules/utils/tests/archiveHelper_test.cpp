@@ -13,6 +13,9 @@
 #include "archiveHelper.hpp"
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
 
 const auto BASE_PATH {std::filesystem::current_path() / "input_files/archiveHelper/"};
 const auto OUTPUT_DIR_PATH {std::filesystem::current_path() / "output_dir"};
@@ -20,6 +23,7 @@ const auto OUTPUT_NESTED_DIRS_PATH {std::filesystem::current_path() / "output_di
 
 const auto COMPRESSED_MULTIPLE_FILES_PATH {BASE_PATH / "content_examples.tar"};
 const auto COMPRESSED_DIR_PATH {BASE_PATH / "content_dir.tar"};
+const auto COMPRESSED_ZIP_PATH {BASE_PATH / "content_examples.zip"};
 const auto BASE_EXAMPLE1_PATH {BASE_PATH / "content_example1.json"};
 const auto BASE_EXAMPLE2_PATH {BASE_PATH / "content_example2.json"};
 
@@ -249,3 +253,75 @@ TEST(ArchiveHelperTest, SuccessfulDecompressionExtractOnly)
     EXPECT_STREQ(decompressedFile1.c_str(), originalFile1.c_str());
     EXPECT_TRUE(std::filesystem::remove_all(OUTPUT_DIR_PATH));
 }
+
+static std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+TEST(ArchiveHelperTest, StreamEntriesWithoutExtraction)
+{
+    std::map<std::string, std::string> entries;
+    Utils::ArchiveHelper::forEachEntry(COMPRESSED_DIR_PATH,
+                                       [&entries](const std::string& pathname, std::istream& content)
+                                       {
+                                           std::stringstream data;
+                                           data << content.rdbuf();
+                                           entries[pathname] = data.str();
+                                       });
+
+    ASSERT_EQ(2, entries.size());
+    EXPECT_EQ(readFile(BASE_EXAMPLE1_PATH), entries.at("content_dir/content_example1.json"));
+    EXPECT_EQ(readFile(BASE_EXAMPLE2_PATH), entries.at("content_dir/content_example2.json"));
+    EXPECT_FALSE(std::filesystem::exists(DECOMPRESSED_DIR_PATH));
+}
+
+TEST(ArchiveHelperTest, StreamEntriesExtractOnly)
+{
+    std::vector<std::string> entries;
+    Utils::ArchiveHelper::forEachEntry(
+        COMPRESSED_ZIP_PATH,
+        [&entries](const std::string& pathname, std::istream& /*content*/) { entries.emplace_back(pathname); },
+        false,
+        {"content_example2.json"});
+
+    ASSERT_EQ(1, entries.size());
+    EXPECT_EQ("content_example2.json", entries.front());
+}
+
+TEST(ArchiveHelperTest, StreamEntriesInParallel)
+{
+    std::mutex mutex;
+    std::map<std::string, std::string> entries;
+    const auto onEntry = [&](const std::string& pathname, std::istream& content)
+    {
+        std::stringstream data;
+        data << content.rdbuf();
+        std::lock_guard lock(mutex);
+        entries[pathname] = data.str();
+    };
+
+    // ZIP entries are split among the workers, the TAR ones are read by the calling thread.
+    for (const auto& path : {COMPRESSED_ZIP_PATH, COMPRESSED_MULTIPLE_FILES_PATH})
+    {
+        entries.clear();
+        Utils::ArchiveHelper::forEachEntryParallel(path, onEntry, 3);
+
+        ASSERT_EQ(2, entries.size());
+        EXPECT_EQ(readFile(BASE_EXAMPLE1_PATH), entries.at("content_example1.json"));
+        EXPECT_EQ(readFile(BASE_EXAMPLE2_PATH), entries.at("content_example2.json"));
+    }
+}
+
+TEST(ArchiveHelperTest, StreamEntriesCallbackError)
+{
+    EXPECT_THROW(Utils::ArchiveHelper::forEachEntryParallel(
+                     COMPRESSED_ZIP_PATH,
+                     [](const std::string& /*pathname*/, std::istream& /*content*/)
+                     { throw std::runtime_error("Invalid content"); },
+                     2),
+                 std::runtime_error);
+}
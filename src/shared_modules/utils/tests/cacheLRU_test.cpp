@@ -33,3 +33,25 @@ TEST_F(CacheLRUTest, insertAndMiss)
 
     EXPECT_FALSE(result.has_value());
 }
+
+TEST_F(CacheLRUTest, resizeKeepsMostRecentlyUsed)
+{
+    auto cacheMemory = LRUCache<int, int>(3);
+
+    cacheMemory.insertKey(1, 10);
+    cacheMemory.insertKey(2, 20);
+    cacheMemory.insertKey(3, 30);
+    EXPECT_TRUE(cacheMemory.getValue(1).has_value());
+
+    cacheMemory.resize(2);
+    EXPECT_TRUE(cacheMemory.isFull());
+    EXPECT_TRUE(cacheMemory.isHit(1));
+    EXPECT_TRUE(cacheMemory.isHit(3));
+    EXPECT_FALSE(cacheMemory.isHit(2));
+
+    cacheMemory.resize(3);
+    cacheMemory.insertKey(4, 40);
+    EXPECT_TRUE(cacheMemory.isHit(1));
+    EXPECT_TRUE(cacheMemory.isHit(3));
+    EXPECT_TRUE(cacheMemory.isHit(4));
+}
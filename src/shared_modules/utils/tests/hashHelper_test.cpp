@@ -94,6 +94,23 @@ TEST_F(HashHelperTest, HashHelperHashIterativeSha256)
  * @brief Test the hashing of a file.
  *
  */
+TEST_F(HashHelperTest, HashHelperResetSha256)
+{
+    HashData hash{HashType::Sha256};
+    const std::string first{"FIRST"};
+    hash.update(first.c_str(), first.size());
+    hash.hash();
+
+    // The reused context must give the same digest as a new one.
+    const std::string data{"HASH"};
+    hash.reset();
+    hash.update(data.c_str(), data.size());
+
+    HashData expected{HashType::Sha256};
+    expected.update(data.c_str(), data.size());
+    EXPECT_EQ(expected.hash(), hash.hash());
+}
+
 TEST_F(HashHelperTest, HashFile)
 {
     const std::vector<unsigned char> expectedHash { 0x2e, 0x95, 0xd7, 0x58, 0x2c, 0x53, 0x58, 0x3f, 0xa8, 0xaf,
@@ -14,7 +14,9 @@
 #include "json.hpp"
 #include "jsonArrayParser.hpp"
 #include "gtest/gtest.h"
+#include <chrono>
 #include <queue>
+#include <thread>
 
 /**
  * @brief Parse an array with simple objects
@@ -687,3 +689,125 @@ TEST_F(JsonArrayParserTest, InexistentFile)
     // Start the parse and expect an exception
     ASSERT_THROW(JsonArray::parse(testFilepath, callback, testArrayPointer), std::runtime_error);
 }
+
+/**
+ * @brief Process the items in parallel. The results must be committed in file order, followed by the body.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseCommitsInOrder)
+{
+    // Setup the input data
+    constexpr size_t ITEMS {200};
+    nlohmann::json testData;
+    testData["name"] = "feed";
+    for (size_t i = 0; i < ITEMS; ++i)
+    {
+        testData["test_array"].push_back({{"id", i}});
+    }
+    const auto testArrayPointer {"/test_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ParallelParseCommitsInOrder.json"};
+    createTestFile(testData.dump(), testFilepath);
+
+    // Items take different times to process, so they finish out of order.
+    auto processCallback = [](nlohmann::json&& item, const size_t /*itemId*/)
+    {
+        const auto id = item.at("id").get<size_t>();
+        std::this_thread::sleep_for(std::chrono::microseconds((ITEMS - id) % 7 * 100));
+        return static_cast<int>(id * 2);
+    };
+
+    std::vector<int> results;
+    std::vector<size_t> itemIds;
+    auto commitCallback = [&](int&& result, const size_t itemId)
+    {
+        results.push_back(result);
+        itemIds.push_back(itemId);
+        return true;
+    };
+
+    nlohmann::json body;
+    auto bodyCallback = [&](nlohmann::json&& parsedBody)
+    {
+        // All the items are committed before the body.
+        EXPECT_EQ(results.size(), ITEMS);
+        body = std::move(parsedBody);
+    };
+
+    ASSERT_NO_THROW(JsonArray::parallelParse<int>(
+        testFilepath, processCallback, commitCallback, 4, testArrayPointer, bodyCallback));
+
+    ASSERT_EQ(results.size(), ITEMS);
+    for (size_t i = 0; i < ITEMS; ++i)
+    {
+        EXPECT_EQ(results[i], static_cast<int>(i * 2));
+        EXPECT_EQ(itemIds[i], i + 1);
+    }
+    EXPECT_EQ(body, R"({"name":"feed","test_array":[]})"_json);
+}
+
+/**
+ * @brief Stop the parallel parsing from the commit callback. No more items are committed and the body callback is
+ * not called.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseStop)
+{
+    // Setup the input data
+    nlohmann::json testData;
+    for (auto i = 0; i < 100; ++i)
+    {
+        testData["test_array"].push_back(i);
+    }
+    const auto testArrayPointer {"/test_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ParallelParseStop.json"};
+    createTestFile(testData.dump(), testFilepath);
+
+    constexpr auto targetItem {10};
+    auto commitCounter {0};
+    auto bodyCalled {false};
+
+    ASSERT_NO_THROW(JsonArray::parallelParse<int>(
+        testFilepath,
+        [](nlohmann::json&& item, const size_t /*itemId*/) { return item.get<int>(); },
+        [&](int&& item, const size_t /*itemId*/)
+        {
+            ++commitCounter;
+            return item != targetItem;
+        },
+        2,
+        testArrayPointer,
+        [&bodyCalled](nlohmann::json&& /*body*/) { bodyCalled = true; }));
+
+    EXPECT_EQ(commitCounter, targetItem + 1);
+    EXPECT_FALSE(bodyCalled);
+}
+
+/**
+ * @brief The processing of an item fails. The exception is thrown by the parallel parsing.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseProcessError)
+{
+    // Setup the input data
+    const auto testData {R"({"test_array": [1, 2, 3]})"};
+    const auto testArrayPointer {"/test_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ParallelParseProcessError.json"};
+    createTestFile(testData, testFilepath);
+
+    auto processCallback = [](nlohmann::json&& item, const size_t /*itemId*/)
+    {
+        if (item == 2)
+        {
+            throw std::runtime_error("Processing error");
+        }
+        return item.get<int>();
+    };
+
+    EXPECT_THROW(JsonArray::parallelParse<int>(
+                     testFilepath,
+                     processCallback,
+                     [](int&& /*item*/, const size_t /*itemId*/) { return true; },
+                     2,
+                     testArrayPointer),
+                 std::runtime_error);
+}
@@ -184,3 +184,100 @@ TEST_F(RocksDBSafeQueuePrefixTest, ClearAllQueue)
     EXPECT_EQ(0, queue->size("001"));
     EXPECT_TRUE(queue->empty());
 }
+
+TEST_F(RocksDBSafeQueuePrefixTest, CoalesceSupersedesPending)
+{
+    queue->push("000", "head");
+    queue->push("000", "insert", "pkg1", CoalesceOperation::Insert);
+    queue->push("000", "other", "pkg2", CoalesceOperation::Insert);
+    queue->push("000", "update", "pkg1", CoalesceOperation::Insert);
+
+    EXPECT_EQ(3, queue->size("000"));
+
+    // The later element takes the position of the pending one.
+    for (const auto& expected : {"head", "update", "other"})
+    {
+        auto front {queue->front()};
+        EXPECT_EQ(expected, front.first);
+        EXPECT_NO_THROW(queue->pop(front.second));
+    }
+
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(RocksDBSafeQueuePrefixTest, CoalesceCancelsInsertAndDelete)
+{
+    queue->push("000", "head");
+    queue->push("000", "insert", "pkg1", CoalesceOperation::Insert);
+    queue->push("000", "other", "pkg2", CoalesceOperation::Insert);
+    queue->push("000", "delete", "pkg1", CoalesceOperation::Delete);
+    queue->push("000", "last");
+
+    EXPECT_EQ(3, queue->size("000"));
+
+    for (const auto& expected : {"head", "other", "last"})
+    {
+        auto front {queue->front()};
+        EXPECT_EQ(expected, front.first);
+        EXPECT_NO_THROW(queue->pop(front.second));
+    }
+
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(RocksDBSafeQueuePrefixTest, CoalesceDeleteInsertDeleteKeepsDelete)
+{
+    queue->push("000", "head");
+    queue->push("000", "delete", "pkg1", CoalesceOperation::Delete);
+    queue->push("000", "insert", "pkg1", CoalesceOperation::Insert);
+    queue->push("000", "delete2", "pkg1", CoalesceOperation::Delete);
+
+    EXPECT_EQ(2, queue->size("000"));
+
+    // The package existed before the first deletion, so the last one is kept.
+    for (const auto& expected : {"head", "delete2"})
+    {
+        auto front {queue->front()};
+        EXPECT_EQ(expected, front.first);
+        EXPECT_NO_THROW(queue->pop(front.second));
+    }
+}
+
+TEST_F(RocksDBSafeQueuePrefixTest, CoalesceSkipsHead)
+{
+    queue->push("000", "insert", "pkg1", CoalesceOperation::Insert);
+    queue->push("000", "delete", "pkg1", CoalesceOperation::Delete);
+
+    // The head may be in process, so it is neither replaced nor cancelled.
+    EXPECT_EQ(2, queue->size("000"));
+
+    for (const auto& expected : {"insert", "delete"})
+    {
+        auto front {queue->front()};
+        EXPECT_EQ(expected, front.first);
+        EXPECT_NO_THROW(queue->pop(front.second));
+    }
+}
+
+TEST_F(RocksDBSafeQueuePrefixTest, CoalescedHolesAfterReopen)
+{
+    queue->push("000", "head");
+    queue->push("000", "insert", "pkg1", CoalesceOperation::Insert);
+    queue->push("000", "delete", "pkg1", CoalesceOperation::Delete);
+    queue->push("000", "last");
+
+    queue.reset();
+    queue = std::make_unique<Utils::TSafeMultiQueue<std::string, std::string, RocksDBQueueCF<std::string>>>(
+        RocksDBQueueCF<std::string>("test.db"));
+
+    EXPECT_EQ(2, queue->size("000"));
+
+    for (const auto& expected : {"head", "last"})
+    {
+        auto front {queue->front()};
+        EXPECT_EQ(expected, front.first);
+        EXPECT_NO_THROW(queue->pop(front.second));
+    }
+
+    EXPECT_TRUE(queue->empty());
+}
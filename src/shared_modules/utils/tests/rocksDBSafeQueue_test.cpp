@@ -89,6 +89,57 @@ TEST_F(RocksDBSafeQueueTest, PopWithMultipleData)
     EXPECT_TRUE(queue->empty());
 }
 
+TEST_F(RocksDBSafeQueueTest, PopBulk)
+{
+    for (int i = 0; i < 10; i++)
+    {
+        queue->push(std::to_string(i));
+    }
+
+    auto bulk {queue->getBulk(4)};
+    EXPECT_EQ(4, bulk.size());
+    queue->popBulk(bulk.size());
+    EXPECT_EQ(6, queue->size());
+
+    std::string ret_val{};
+    EXPECT_TRUE(queue->pop(ret_val, false));
+    EXPECT_EQ("4", ret_val);
+
+    // Popping more elements than available empties the queue, which is then reused from the beginning.
+    queue->popBulk(100);
+    EXPECT_TRUE(queue->empty());
+
+    queue->push("10");
+    EXPECT_TRUE(queue->pop(ret_val, false));
+    EXPECT_EQ("10", ret_val);
+}
+
+TEST(RocksDBQueueTest, PushBulkAndReopen)
+{
+    const std::string DATABASE_NAME {"test_bulk.db"};
+    std::error_code ec;
+    std::filesystem::remove_all(DATABASE_NAME, ec);
+
+    {
+        RocksDBQueue<std::string> queue(DATABASE_NAME);
+        queue.push("0");
+        queue.pushBulk({"1", "2", "3", "4"});
+        EXPECT_EQ(5, queue.size());
+        queue.popBulk(2);
+        EXPECT_EQ("2", queue.front());
+        EXPECT_EQ("4", queue.at(2));
+    }
+
+    // The elements written in bulk are found again when the queue is reopened.
+    RocksDBQueue<std::string> queue(DATABASE_NAME);
+    EXPECT_EQ(3, queue.size());
+    EXPECT_EQ("2", queue.front());
+    queue.pushBulk({"5"});
+    EXPECT_EQ("5", queue.at(3));
+
+    std::filesystem::remove_all(DATABASE_NAME, ec);
+}
+
 TEST_F(RocksDBSafeQueueTest, BlockingPopByRef)
 {
     std::thread t1
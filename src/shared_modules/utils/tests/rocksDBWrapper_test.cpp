@@ -579,3 +579,87 @@ TEST_F(RocksDBWrapperTest, GetAllColumnFamiliesTest)
     EXPECT_EQ(columnFamilies[2], COLUMN_NAME_B);
     EXPECT_EQ(columnFamilies[3], COLUMN_NAME_C);
 }
+
+TEST_F(RocksDBWrapperTest, SeekWithPrefixExtractor)
+{
+    db_wrapper.reset();
+    db_wrapper = std::make_unique<Utils::RocksDBWrapper>(
+        m_databaseFolder, true, std::make_shared<Utils::SeparatorPrefixTransform>('_'));
+
+    constexpr auto COLUMN_NAME {"column_A"};
+    db_wrapper->createColumn(COLUMN_NAME);
+
+    // One agent in the flushed files and the other ones in the memtable.
+    db_wrapper->put("001_package1", "CVE-1", COLUMN_NAME);
+    db_wrapper->put("001_package2", "CVE-2", COLUMN_NAME);
+    db_wrapper->flush();
+    db_wrapper->put("002_package1", "CVE-3", COLUMN_NAME);
+    db_wrapper->put("0010_package1", "CVE-4", COLUMN_NAME);
+    db_wrapper->put("node_000_package1", "CVE-5", COLUMN_NAME);
+
+    std::vector<std::string> keys;
+    for (const auto& [key, value] : db_wrapper->seek("001_", COLUMN_NAME))
+    {
+        keys.emplace_back(key);
+    }
+    EXPECT_EQ(keys, std::vector<std::string>({"001_package1", "001_package2"}));
+
+    keys.clear();
+    for (const auto& [key, value] : db_wrapper->seek("node_000_", COLUMN_NAME))
+    {
+        keys.emplace_back(key);
+    }
+    EXPECT_EQ(keys, std::vector<std::string>({"node_000_package1"}));
+
+    keys.clear();
+    for (const auto& [key, value] : db_wrapper->seek("003_", COLUMN_NAME))
+    {
+        keys.emplace_back(key);
+    }
+    EXPECT_TRUE(keys.empty());
+
+    // Keys without the separator are sought in the whole column.
+    keys.clear();
+    for (const auto& [key, value] : db_wrapper->seek("001", COLUMN_NAME))
+    {
+        keys.emplace_back(key);
+    }
+    EXPECT_EQ(keys, std::vector<std::string>({"001_package1", "001_package2", "0010_package1"}));
+
+    std::string value;
+    EXPECT_TRUE(db_wrapper->get("001_package2", value, COLUMN_NAME));
+    EXPECT_EQ(value, "CVE-2");
+    EXPECT_FALSE(db_wrapper->get("002_package2", value, COLUMN_NAME));
+}
+
+TEST_F(RocksDBWrapperTest, SeekPrefixes)
+{
+    constexpr auto COLUMN_NAME {"column_A"};
+    db_wrapper->createColumn(COLUMN_NAME);
+
+    db_wrapper->put("curl_CVE-1", "1", COLUMN_NAME);
+    db_wrapper->put("curl_CVE-2", "2", COLUMN_NAME);
+    db_wrapper->flush();
+    db_wrapper->put("bash_CVE-3", "3", COLUMN_NAME);
+    db_wrapper->put("curlx_CVE-4", "4", COLUMN_NAME);
+
+    // The prefixes are sought in key order, the callback receives the index of each one.
+    std::vector<std::pair<size_t, std::string>> found;
+    db_wrapper->seekPrefixes(
+        {"curl_CVE", "openssl_CVE", "bash_CVE"},
+        [&found](size_t index, const std::string& key, const rocksdb::Slice& value)
+        {
+            found.emplace_back(index, key);
+            EXPECT_EQ(value.ToString(), key.substr(key.size() - 1));
+        },
+        COLUMN_NAME);
+
+    EXPECT_EQ(found,
+              (std::vector<std::pair<size_t, std::string>>(
+                  {{2, "bash_CVE-3"}, {0, "curl_CVE-1"}, {0, "curl_CVE-2"}})));
+
+    found.clear();
+    db_wrapper->seekPrefixes(
+        {}, [&found](size_t index, const std::string& key, const rocksdb::Slice&) { found.emplace_back(index, key); });
+    EXPECT_TRUE(found.empty());
+}
@@ -12,6 +12,7 @@
 #ifndef _ROCKS_DB_WRAPPER_TEST_HPP
 #define _ROCKS_DB_WRAPPER_TEST_HPP
 
+#include "rocksDBPrefixTransform.hpp"
 #include "rocksDBWrapper.hpp"
 #include "gtest/gtest.h"
 #include <filesystem>
@@ -0,0 +1,188 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "shardedCacheLRU_test.h"
+#include "shardedCacheLRU.hpp"
+#include <string>
+#include <thread>
+#include <vector>
+
+void ShardedCacheLRUTest::SetUp() {};
+
+void ShardedCacheLRUTest::TearDown() {};
+
+TEST_F(ShardedCacheLRUTest, insertAndHit)
+{
+    ShardedLRUCache<int, int> cacheMemory(10);
+
+    EXPECT_NO_THROW(cacheMemory.insertKey(1, 10));
+    EXPECT_EQ(cacheMemory.getValue(1).value(), 10);
+    EXPECT_EQ(cacheMemory.stats().hits, 1);
+}
+
+TEST_F(ShardedCacheLRUTest, insertAndMiss)
+{
+    ShardedLRUCache<int, int> cacheMemory(10);
+
+    EXPECT_NO_THROW(cacheMemory.insertKey(10, 10));
+    EXPECT_FALSE(cacheMemory.getValue(1).has_value());
+    EXPECT_EQ(cacheMemory.stats().misses, 1);
+}
+
+TEST_F(ShardedCacheLRUTest, replaceValue)
+{
+    ShardedLRUCache<int, int> cacheMemory(10);
+
+    cacheMemory.insertKey(1, 10);
+    cacheMemory.insertKey(1, 20);
+
+    EXPECT_EQ(cacheMemory.getValue(1).value(), 20);
+    EXPECT_EQ(cacheMemory.size(), 1);
+}
+
+TEST_F(ShardedCacheLRUTest, evictLeastRecentlyUsed)
+{
+    ShardedLRUCache<int, int> cacheMemory(2, 1);
+
+    cacheMemory.insertKey(1, 10);
+    cacheMemory.insertKey(2, 20);
+    EXPECT_TRUE(cacheMemory.getValue(1).has_value());
+    cacheMemory.insertKey(3, 30);
+
+    EXPECT_TRUE(cacheMemory.getValue(1).has_value());
+    EXPECT_FALSE(cacheMemory.getValue(2).has_value());
+    EXPECT_TRUE(cacheMemory.getValue(3).has_value());
+    EXPECT_EQ(cacheMemory.stats().evictions, 1);
+}
+
+TEST_F(ShardedCacheLRUTest, capacityIsShared)
+{
+    ShardedLRUCache<int, int> cacheMemory(100, 8);
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        cacheMemory.insertKey(i, i);
+    }
+
+    EXPECT_LE(cacheMemory.size(), 104);
+    EXPECT_TRUE(cacheMemory.getValue(999).has_value());
+}
+
+TEST_F(ShardedCacheLRUTest, zeroCapacityDisablesCache)
+{
+    ShardedLRUCache<int, int> cacheMemory(0);
+
+    cacheMemory.insertKey(1, 10);
+
+    EXPECT_FALSE(cacheMemory.getValue(1).has_value());
+    EXPECT_EQ(cacheMemory.size(), 0);
+}
+
+TEST_F(ShardedCacheLRUTest, expiredValues)
+{
+    ShardedLRUCache<int, int> cacheMemory(10, DEFAULT_LRU_SHARDS, std::chrono::milliseconds(10));
+
+    cacheMemory.insertKey(1, 10);
+    EXPECT_TRUE(cacheMemory.getValue(1).has_value());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    EXPECT_FALSE(cacheMemory.getValue(1).has_value());
+    EXPECT_EQ(cacheMemory.stats().expirations, 1);
+    EXPECT_EQ(cacheMemory.size(), 0);
+}
+
+TEST_F(ShardedCacheLRUTest, weightedCapacity)
+{
+    ShardedLRUCache<int, std::string> cacheMemory(
+        10, 1, std::chrono::milliseconds::zero(), [](const int&, const std::string& value) { return value.size(); });
+
+    cacheMemory.insertKey(1, "1234");
+    cacheMemory.insertKey(2, "1234");
+    cacheMemory.insertKey(3, "1234");
+
+    EXPECT_FALSE(cacheMemory.getValue(1).has_value());
+    EXPECT_TRUE(cacheMemory.getValue(2).has_value());
+    EXPECT_TRUE(cacheMemory.getValue(3).has_value());
+
+    // A value heavier than the capacity is never stored.
+    cacheMemory.insertKey(4, "12345678901");
+    EXPECT_FALSE(cacheMemory.getValue(4).has_value());
+    EXPECT_TRUE(cacheMemory.getValue(3).has_value());
+}
+
+TEST_F(ShardedCacheLRUTest, eraseAndClear)
+{
+    ShardedLRUCache<int, int> cacheMemory(10);
+
+    cacheMemory.insertKey(1, 10);
+    cacheMemory.insertKey(2, 20);
+
+    cacheMemory.erase(1);
+    EXPECT_FALSE(cacheMemory.getValue(1).has_value());
+    EXPECT_TRUE(cacheMemory.getValue(2).has_value());
+
+    cacheMemory.clear();
+    EXPECT_EQ(cacheMemory.size(), 0);
+}
+
+TEST_F(ShardedCacheLRUTest, resizeKeepsTheWarmestValues)
+{
+    ShardedLRUCache<int, int> cacheMemory(4, 1);
+
+    for (auto i = 1; i <= 4; ++i)
+    {
+        cacheMemory.insertKey(i, i * 10);
+    }
+    EXPECT_TRUE(cacheMemory.getValue(1).has_value());
+
+    cacheMemory.resize(2);
+    EXPECT_EQ(cacheMemory.size(), 2);
+    EXPECT_EQ(cacheMemory.stats().evictions, 2);
+    EXPECT_TRUE(cacheMemory.getValue(1).has_value());
+    EXPECT_TRUE(cacheMemory.getValue(4).has_value());
+
+    cacheMemory.resize(3);
+    cacheMemory.insertKey(5, 50);
+    EXPECT_EQ(cacheMemory.size(), 3);
+
+    cacheMemory.resize(0);
+    cacheMemory.insertKey(6, 60);
+    EXPECT_EQ(cacheMemory.size(), 0);
+}
+
+TEST_F(ShardedCacheLRUTest, concurrentAccess)
+{
+    ShardedLRUCache<int, int> cacheMemory(128);
+    std::vector<std::thread> threads;
+
+    for (auto t = 0; t < 8; ++t)
+    {
+        threads.emplace_back(
+            [&cacheMemory, t]()
+            {
+                for (auto i = 0; i < 10000; ++i)
+                {
+                    cacheMemory.insertKey((i * (t + 1)) % 512, i);
+                    cacheMemory.getValue(i % 512);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(cacheMemory.size(), 128);
+    const auto stats = cacheMemory.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 80000);
+}
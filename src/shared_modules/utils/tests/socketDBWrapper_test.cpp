@@ -69,6 +69,43 @@ TEST_F(SocketDBWrapperTest, DueTest)
     ASSERT_EQ(output[2].at("field"), "value3");
 }
 
+TEST_F(SocketDBWrapperTest, DueStreamTest)
+{
+    m_query = "SELECT * FROM test_table;";
+    m_responses = std::vector<std::string> {R"(due {"field": "value1"})",
+                                            R"(due {"field": "value2"})",
+                                            R"(due {"field": "value3"})",
+                                            R"(ok {"status":"SUCCESS"})"};
+
+    std::vector<std::string> rows;
+    EXPECT_NO_THROW(SocketDBWrapper::instance().query(
+        m_query, [&rows](nlohmann::json&& row) { rows.push_back(row.at("field")); }));
+
+    ASSERT_EQ(rows, (std::vector<std::string> {"value1", "value2", "value3"}));
+}
+
+TEST_F(SocketDBWrapperTest, OkStreamTest)
+{
+    m_query = "SELECT * FROM test_table;";
+    m_responses = std::vector<std::string> {R"(ok [{"field": "value1"}, {"field": "value2"}])"};
+
+    std::vector<std::string> rows;
+    EXPECT_NO_THROW(SocketDBWrapper::instance().query(
+        m_query, [&rows](nlohmann::json&& row) { rows.push_back(row.at("field")); }));
+
+    ASSERT_EQ(rows, (std::vector<std::string> {"value1", "value2"}));
+}
+
+TEST_F(SocketDBWrapperTest, StreamCallbackErrorTest)
+{
+    m_query = "SELECT * FROM test_table;";
+    m_responses = std::vector<std::string> {R"(due {"field": "value1"})", R"(ok {"status":"SUCCESS"})"};
+
+    EXPECT_THROW(SocketDBWrapper::instance().query(m_query,
+                                                   [](nlohmann::json&&) { throw std::runtime_error("row error"); }),
+                 std::runtime_error);
+}
+
 TEST_F(SocketDBWrapperTest, InvalidTest)
 {
     m_query = "SELECT * FROM test_table;";
@@ -89,6 +126,34 @@ TEST_F(SocketDBWrapperTest, OkTest)
     ASSERT_EQ(output[0].at("field"), "value");
 }
 
+TEST_F(SocketDBWrapperTest, PipelinedQueriesTest)
+{
+    m_echoQuery = true;
+
+    // Send all the queries before waiting for any response, each one must get its own.
+    constexpr auto QUERIES {50};
+    std::vector<std::future<nlohmann::json>> responses;
+    for (auto i = 0; i < QUERIES; ++i)
+    {
+        responses.push_back(SocketDBWrapper::instance().queryAsync("query " + std::to_string(i)));
+    }
+
+    for (auto i = 0; i < QUERIES; ++i)
+    {
+        const auto output = responses[i].get();
+        ASSERT_EQ(output[0].at("query"), "query " + std::to_string(i));
+    }
+}
+
+TEST_F(SocketDBWrapperTest, AsyncErrorTest)
+{
+    m_query = "SELECT * FROM test_table;";
+    m_responses = std::vector<std::string> {R"(err Things happened)"};
+
+    auto response = SocketDBWrapper::instance().queryAsync(m_query);
+    EXPECT_THROW(response.get(), std::runtime_error);
+}
+
 TEST_F(SocketDBWrapperTestNoSetUp, NoSocketTest)
 {
     SocketDBWrapper::instance();
@@ -42,6 +42,12 @@ protected:
                 std::ignore = sizeHeader;
 
                 std::string receivedMsg(data, size);
+                if (m_echoQuery)
+                {
+                    const auto response = R"(ok [{"query": ")" + receivedMsg + R"("}])";
+                    m_socketServer->send(fd, response.c_str(), response.size());
+                    return;
+                }
                 ASSERT_EQ(receivedMsg, m_query);
 
                 std::this_thread::sleep_for(std::chrono::milliseconds(m_sleepTime));
@@ -60,12 +66,14 @@ protected:
         m_query.clear();
         m_responses.clear();
         m_sleepTime = 0;
+        m_echoQuery = false;
     };
 
     std::shared_ptr<SocketServer<Socket<OSPrimitives, SizeHeaderProtocol>, EpollWrapper>> m_socketServer;
     std::string m_query;
     std::vector<std::string> m_responses;
     int m_sleepTime;
+    bool m_echoQuery {false};
 };
 
 class SocketDBWrapperTestNoSetUp : public ::testing::Test
@@ -39,6 +39,7 @@ public:
     MOCK_METHOD(int, close, (int));
     MOCK_METHOD(ssize_t, recv, (int, void*, size_t, int));
     MOCK_METHOD(ssize_t, send, (int, const void*, size_t, int));
+    MOCK_METHOD(ssize_t, sendmsg, (int, const struct msghdr*, int));
     MOCK_METHOD(int, shutdown, (int, int));
 };
 
@@ -13,7 +13,9 @@
 #include "../socketClient.hpp"
 #include "../socketServer.hpp"
 #include <chrono>
+#include <fcntl.h>
 #include <future>
+#include <sys/socket.h>
 
 TYPED_TEST_SUITE_P(SocketTest);
 
@@ -394,6 +396,110 @@ TYPED_TEST_P(SocketTest, SingleDelayedClientWithReconnectionServerReset)
     EXPECT_EQ(counter, MESSAGE_QUANTITY);
 }
 
+TYPED_TEST_P(SocketTest, ReadSeveralPacketsPerCall)
+{
+    int fds[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    ASSERT_NE(-1, fcntl(fds[1], F_SETFL, O_NONBLOCK));
+
+    Socket<OSPrimitives, TypeParam> sender(fds[0]);
+    Socket<OSPrimitives, TypeParam> receiver(fds[1]);
+
+    // Small packets, one bigger than the receive buffer and a last small one, all of them sent before reading.
+    constexpr auto SMALL_PACKETS {1000};
+    const std::string bigPacket(BUFFER_MAX_SIZE * 3, 'x');
+    std::thread senderThread(
+        [&]()
+        {
+            for (auto i = 0; i < SMALL_PACKETS; ++i)
+            {
+                const auto message {std::to_string(i)};
+                sender.send(message.data(), message.size());
+            }
+            sender.send(bigPacket.data(), bigPacket.size());
+            sender.send("end", 3);
+        });
+
+    std::vector<std::string> messages;
+    const auto deadline {std::chrono::steady_clock::now() + std::chrono::seconds(10)};
+    while (messages.size() < SMALL_PACKETS + 2 && std::chrono::steady_clock::now() < deadline)
+    {
+        receiver.read([&messages](const int, const char* body, uint32_t bodySize, const char*, uint32_t)
+                      { messages.emplace_back(body, bodySize); });
+    }
+    senderThread.join();
+
+    ASSERT_EQ(SMALL_PACKETS + 2, messages.size());
+    for (auto i = 0; i < SMALL_PACKETS; ++i)
+    {
+        EXPECT_EQ(std::to_string(i), messages.at(i));
+    }
+    EXPECT_EQ(bigPacket, messages.at(SMALL_PACKETS));
+    EXPECT_EQ("end", messages.at(SMALL_PACKETS + 1));
+
+    // The buffer grown for the big packet is shrunk back.
+    EXPECT_EQ(BUFFER_MAX_SIZE, receiver.recvBufferSize());
+}
+
+TYPED_TEST_P(SocketTest, SendQueuedPacketsTogether)
+{
+    int fds[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    ASSERT_NE(-1, fcntl(fds[0], F_SETFL, O_NONBLOCK));
+    ASSERT_NE(-1, fcntl(fds[1], F_SETFL, O_NONBLOCK));
+
+    Socket<OSPrimitives, TypeParam> sender(fds[0]);
+    Socket<OSPrimitives, TypeParam> receiver(fds[1]);
+
+    // Fill the socket until the packets start to be queued, then queue some more behind them.
+    const std::string payload(1024, 'x');
+    auto sent {0};
+    while (!sender.hasUnsentMessages())
+    {
+        try
+        {
+            sender.send(payload.data(), payload.size());
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+        ++sent;
+    }
+    constexpr auto QUEUED_PACKETS {200};
+    for (auto i = 0; i < QUEUED_PACKETS; ++i)
+    {
+        const auto message {std::to_string(i)};
+        sender.send(message.data(), message.size());
+    }
+
+    std::vector<std::string> messages;
+    const auto deadline {std::chrono::steady_clock::now() + std::chrono::seconds(10)};
+    while (messages.size() < static_cast<size_t>(sent + QUEUED_PACKETS) &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        receiver.read([&messages](const int, const char* body, uint32_t bodySize, const char*, uint32_t)
+                      { messages.emplace_back(body, bodySize); });
+        try
+        {
+            sender.sendUnsentMessages();
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+    }
+
+    EXPECT_FALSE(sender.hasUnsentMessages());
+    ASSERT_EQ(static_cast<size_t>(sent + QUEUED_PACKETS), messages.size());
+    for (auto i = 0; i < sent; ++i)
+    {
+        EXPECT_EQ(payload, messages.at(i));
+    }
+    for (auto i = 0; i < QUEUED_PACKETS; ++i)
+    {
+        EXPECT_EQ(std::to_string(i), messages.at(sent + i));
+    }
+}
+
 // All tests must be registered
 
 REGISTER_TYPED_TEST_SUITE_P(SocketTest,
@@ -402,7 +508,9 @@ REGISTER_TYPED_TEST_SUITE_P(SocketTest,
                             MultipleClients,
                             SingleDelayedClientWithReconnectionSendMessageOffline,
                             SingleDelayedClientWithReconnectionOnline,
-                            SingleDelayedClientWithReconnectionServerReset);
+                            SingleDelayedClientWithReconnectionServerReset,
+                            ReadSeveralPacketsPerCall,
+                            SendQueuedPacketsTogether);
 
 // Configuring typed-tests
 using ProtocolTypes = ::testing::Types<AppendHeaderProtocol, SizeHeaderProtocol>;
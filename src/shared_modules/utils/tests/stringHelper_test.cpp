@@ -589,3 +589,75 @@ TEST_F(StringUtilsTest, haveUpperCaseCharacters)
     EXPECT_FALSE(Utils::haveUpperCaseCharacters(""));
 }
 
+
+TEST_F(StringUtilsTest, Tokenizer)
+{
+    const std::string str {"hello,,world,"};
+    std::vector<std::string_view> tokens;
+
+    for (const auto token : Utils::Tokenizer(str, ','))
+    {
+        tokens.push_back(token);
+    }
+
+    // Same tokens as split, viewing the string.
+    EXPECT_EQ(3ull, tokens.size());
+    EXPECT_EQ(tokens[0], "hello");
+    EXPECT_EQ(tokens[1], "");
+    EXPECT_EQ(tokens[2], "world");
+    EXPECT_EQ(tokens[2].data(), str.data() + 7);
+
+    const Utils::Tokenizer empty {"", ','};
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST_F(StringUtilsTest, SplitView)
+{
+    std::vector<std::string_view> tokens;
+
+    Utils::splitView("a b c", ' ', tokens);
+    EXPECT_EQ(3ull, tokens.size());
+    EXPECT_EQ(tokens[2], "c");
+
+    // The vector is cleared before splitting again.
+    Utils::splitView("d", ' ', tokens);
+    EXPECT_EQ(1ull, tokens.size());
+    EXPECT_EQ(tokens[0], "d");
+
+    EXPECT_EQ(Utils::splitView("hello.world", '.'), Utils::splitView("hello.world.", '.'));
+}
+
+TEST_F(StringUtilsTest, TrimView)
+{
+    EXPECT_EQ(Utils::leftTrimView("  hello  "), "hello  ");
+    EXPECT_EQ(Utils::rightTrimView("  hello  "), "  hello");
+    EXPECT_EQ(Utils::trimView("\t hello \t", " \t"), "hello");
+    EXPECT_EQ(Utils::trimView("    "), "");
+}
+
+TEST_F(StringUtilsTest, TrimInPlace)
+{
+    std::string str {" \thello world\t "};
+    Utils::trimInPlace(str, " \t");
+    EXPECT_EQ(str, "hello world");
+
+    str = "   ";
+    Utils::trimInPlace(str);
+    EXPECT_TRUE(str.empty());
+}
+
+TEST_F(StringUtilsTest, CheckShrinkingReplacement)
+{
+    std::string str {"a--b----c"};
+    EXPECT_TRUE(Utils::replaceAll(str, "--", "-"));
+    // The search restarts at each replacement, so the runs are collapsed.
+    EXPECT_EQ(str, "a-b-c");
+
+    str = "aXbXXc";
+    EXPECT_TRUE(Utils::replaceAll(str, "X", ""));
+    EXPECT_EQ(str, "abc");
+
+    str = "abab";
+    EXPECT_TRUE(Utils::replaceAll(str, "ab", "ab"));
+    EXPECT_EQ(str, "abab");
+}
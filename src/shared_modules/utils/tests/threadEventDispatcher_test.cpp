@@ -11,6 +11,10 @@
 
 #include "threadEventDispatcher_test.hpp"
 #include "threadEventDispatcher.hpp"
+#include <future>
+#include <map>
+#include <mutex>
+#include <set>
 
 void ThreadEventDispatcherTest::SetUp() {
     // Not implemented
@@ -184,3 +188,65 @@ TEST_F(ThreadEventDispatcherTest, CtorPopFeatureSingleThread)
     promise.get_future().wait_for(std::chrono::seconds(10));
     EXPECT_EQ(MESSAGES_TO_SEND, counter);
 }
+
+TEST_F(ThreadEventDispatcherTest, KeyedLanesKeepTheOrderOfEachKey)
+{
+    constexpr auto MESSAGES_PER_KEY {200};
+    constexpr auto KEYS {8};
+    constexpr uint8_t LANES {4};
+
+    std::mutex mutex;
+    std::map<std::string, int> lastIndex;
+    std::set<std::thread::id> threads;
+    std::atomic<size_t> counter {0};
+    std::promise<void> promise;
+
+    ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(
+        [&](std::queue<std::string>& data)
+        {
+            std::lock_guard<std::mutex> lock {mutex};
+            threads.insert(std::this_thread::get_id());
+            counter += data.size();
+            while (!data.empty())
+            {
+                const auto value = data.front();
+                data.pop();
+                const auto separator = value.find(':');
+                const auto key = value.substr(0, separator);
+                const auto index = std::stoi(value.substr(separator + 1));
+
+                auto it = lastIndex.find(key);
+                EXPECT_EQ(it == lastIndex.end() ? -1 : it->second, index - 1) << "Out of order event of " << key;
+                lastIndex[key] = index;
+            }
+
+            if (counter == MESSAGES_PER_KEY * KEYS)
+            {
+                promise.set_value();
+            }
+        },
+        "test_keyed.db",
+        BULK_SIZE,
+        UNLIMITED_QUEUE_SIZE,
+        LANES);
+
+    for (int i = 0; i < MESSAGES_PER_KEY; ++i)
+    {
+        for (int key = 0; key < KEYS; ++key)
+        {
+            const auto agent = "agent" + std::to_string(key);
+            dispatcher.pushKeyed(agent, agent + ":" + std::to_string(i));
+        }
+    }
+    promise.get_future().wait_for(std::chrono::seconds(10));
+    EXPECT_EQ(MESSAGES_PER_KEY * KEYS, counter);
+    EXPECT_EQ(KEYS, lastIndex.size());
+    EXPECT_GT(threads.size(), 1);
+}
+
+TEST_F(ThreadEventDispatcherTest, KeyedLanesNeedASingleThreadedDispatcher)
+{
+    using MultiThreadDispatcher =
+        ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>, 4>;
+    EXPECT_THROW(MultiThreadDispatcher("test_keyed_multi.db", BULK_SIZE, UNLIMITED_QUEUE_SIZE, 2), std::runtime_error);
+}
@@ -9,7 +9,9 @@
  * Foundation.
  */
 
+#include <memory>
 #include <thread>
+#include <vector>
 #include "threadSafeQueue_test.h"
 #include "threadSafeQueue.h"
 
@@ -45,6 +47,28 @@ TEST_F(ThreadSafeQueueTest, NonBlockingPop)
     EXPECT_FALSE(spValue);
 }
 
+TEST_F(ThreadSafeQueueTest, NonBlockingPopBulk)
+{
+    SafeQueue<std::unique_ptr<int>> queue;
+    std::vector<std::unique_ptr<int>> values;
+    EXPECT_FALSE(queue.popBulk(values, 2, false));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        queue.push(std::make_unique<int>(i));
+    }
+
+    EXPECT_TRUE(queue.popBulk(values, 2, false));
+    ASSERT_EQ(2u, values.size());
+    EXPECT_EQ(0, *values[0]);
+    EXPECT_EQ(1, *values[1]);
+
+    EXPECT_TRUE(queue.popBulk(values, 2, false));
+    ASSERT_EQ(1u, values.size());
+    EXPECT_EQ(2, *values[0]);
+    EXPECT_TRUE(queue.empty());
+}
+
 TEST_F(ThreadSafeQueueTest, BlockingPopByRef)
 {
     SafeQueue<int> queue;
@@ -16,6 +16,7 @@
 #include <atomic>
 #include <future>
 #include <functional>
+#include <type_traits>
 #include <iostream>
 #include "threadSafeQueue.h"
 #include "promiseFactory.h"
@@ -60,6 +61,9 @@ namespace Utils
     //  void cancel();
     // };
 
+    // Maximum amount of messages a single-threaded dispatcher takes from its queue at once.
+    constexpr auto DISPATCH_BULK_SIZE { 64ull };
+
     template
     <
         typename Type,
@@ -105,6 +109,24 @@ namespace Utils
                 }
             }
 
+            // Moves the message into the queue, for the messages built just to be pushed.
+            void push(typename std::decay<Type>::type&& value)
+            {
+                if (m_running)
+                {
+                    if (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue.size() < m_maxQueueSize)
+                    {
+                        m_queue.push
+                        (
+                            [value = std::move(value), this]()
+                        {
+                            this->m_functor(value);
+                        }
+                        );
+                    }
+                }
+            }
+
             void rundown()
             {
                 if (m_running)
@@ -146,13 +168,24 @@ namespace Utils
             {
                 try
                 {
+                    // A single worker takes all the pending messages at once (up to a limit), locking the queue once
+                    // per batch instead of once per message. Several workers take them one by one to share them.
+                    const auto bulkSize { 1 == m_numberOfThreads ? DISPATCH_BULK_SIZE : 1 };
+                    std::vector<std::function<void()>> functions;
+
                     while (m_running)
                     {
-                        std::function<void()> fnc;
-
-                        if (m_queue.pop(fnc))
+                        if (m_queue.popBulk(functions, bulkSize))
                         {
-                            fnc();
+                            for (auto& fnc : functions)
+                            {
+                                if (!m_running)
+                                {
+                                    break;
+                                }
+
+                                fnc();
+                            }
                         }
                     }
                 }
@@ -19,7 +19,11 @@
 #include "threadSafeMultiQueue.hpp"
 #include "threadSafeQueue.h"
 #include <atomic>
+#include <functional>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <thread>
 
 template<typename T,
@@ -31,41 +35,50 @@ template<typename T,
 class TThreadEventDispatcher
 {
 public:
+    /**
+     * @brief Constructor that starts the consumers.
+     *
+     * @param functor Consumer of the events.
+     * @param dbPath Path of the persistent queue.
+     * @param bulkSize Maximum number of events passed to each call of the functor.
+     * @param maxQueueSize Maximum number of queued events, the new ones are dropped when it is reached.
+     * @param lanes Keyed mode with this number of lanes when greater than 1, see `pushKeyed`.
+     */
     explicit TThreadEventDispatcher(Functor functor,
                                     const std::string& dbPath,
                                     const uint64_t bulkSize = 1,
-                                    const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE)
+                                    const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE,
+                                    const uint8_t lanes = 1)
         : m_functor {std::move(functor)}
         , m_maxQueueSize {maxQueueSize}
         , m_bulkSize {bulkSize}
         , m_queue {std::make_unique<TSafeQueueType>(TQueueType(dbPath))}
     {
-        m_threads.reserve(TNumberOfThreads);
-
-        if constexpr (TNumberOfThreads == 1)
-        {
-            m_threads.push_back(std::thread {
-                &TThreadEventDispatcher<T, U, Functor, TNumberOfThreads, TQueueType, TSafeQueueType>::dispatch, this});
-        }
-        else
+        if constexpr (TNumberOfThreads != 1)
         {
             static_assert(isSameType, "T and U are not the same type");
-            for (unsigned int i = 0; i < TNumberOfThreads; ++i)
-            {
-                m_threads.push_back(std::thread {
-                    &TThreadEventDispatcher<T, U, Functor, TNumberOfThreads, TQueueType, TSafeQueueType>::dispatch,
-                    this});
-            }
         }
+        createLanes(dbPath, lanes);
+        startThreads();
     }
 
+    /**
+     * @brief Constructor that only opens the queue, the consumers are started by `startWorker`.
+     *
+     * @param dbPath Path of the persistent queue.
+     * @param bulkSize Maximum number of events passed to each call of the functor.
+     * @param maxQueueSize Maximum number of queued events, the new ones are dropped when it is reached.
+     * @param lanes Keyed mode with this number of lanes when greater than 1, see `pushKeyed`.
+     */
     explicit TThreadEventDispatcher(const std::string& dbPath,
                                     const uint64_t bulkSize = 1,
-                                    const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE)
+                                    const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE,
+                                    const uint8_t lanes = 1)
         : m_maxQueueSize {maxQueueSize}
         , m_bulkSize {bulkSize}
         , m_queue {std::make_unique<TSafeQueueType>(TQueueType(dbPath))}
     {
+        createLanes(dbPath, lanes);
     }
 
     TThreadEventDispatcher& operator=(const TThreadEventDispatcher&) = delete;
@@ -78,31 +91,57 @@ public:
     void startWorker(Functor functor)
     {
         m_functor = std::move(functor);
-        m_threads.reserve(TNumberOfThreads);
+        startThreads();
+    }
 
-        if constexpr (TNumberOfThreads == 1)
+    void push(const T& value)
+    {
+        if constexpr (!isTSafeMultiQueue)
         {
-            m_threads.push_back(std::thread {
-                &TThreadEventDispatcher<T, U, Functor, TNumberOfThreads, TQueueType, TSafeQueueType>::dispatch, this});
+            if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || size() < m_maxQueueSize))
+            {
+                m_queue->push(value);
+            }
         }
         else
         {
-            for (unsigned int i = 0; i < TNumberOfThreads; ++i)
+            // static assert to avoid compilation
+            static_assert(isTSafeMultiQueue, "This method is not supported for this queue type");
+        }
+    }
+
+    /**
+     * @brief Push an event to the lane of its key.
+     *
+     * The events of a key are consumed in order by the thread of its lane, the lanes are consumed in parallel, so the
+     * functor must be thread safe. Without lanes, it is the same as `push(value)`.
+     *
+     * @param key Key of the event, e.g. the agent ID.
+     * @param value Event.
+     */
+    void pushKeyed(std::string_view key, const T& value)
+    {
+        if constexpr (isTSafeQueue)
+        {
+            if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || size() < m_maxQueueSize))
             {
-                m_threads.push_back(std::thread {
-                    &TThreadEventDispatcher<T, U, Functor, TNumberOfThreads, TQueueType, TSafeQueueType>::dispatch,
-                    this});
+                lane(std::hash<std::string_view> {}(key) % laneCount()).push(value);
             }
         }
+        else
+        {
+            // static assert to avoid compilation
+            static_assert(isTSafeQueue, "This method is not supported for this queue type");
+        }
     }
 
-    void push(const T& value)
+    void push(std::string_view prefix, const T& value)
     {
-        if constexpr (!isTSafeMultiQueue)
+        if constexpr (isTSafeMultiQueue)
         {
-            if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size() < m_maxQueueSize))
+            if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size(prefix) < m_maxQueueSize))
             {
-                m_queue->push(value);
+                m_queue->push(prefix, value);
             }
         }
         else
@@ -112,13 +151,13 @@ public:
         }
     }
 
-    void push(std::string_view prefix, const T& value)
+    void push(std::string_view prefix, const T& value, const std::string& key, const CoalesceOperation operation)
     {
         if constexpr (isTSafeMultiQueue)
         {
             if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size(prefix) < m_maxQueueSize))
             {
-                m_queue->push(prefix, value);
+                m_queue->push(prefix, value, key, operation);
             }
         }
         else
@@ -145,6 +184,10 @@ public:
     {
         m_running = false;
         m_queue->cancel();
+        for (const auto& queue : m_lanes)
+        {
+            queue->cancel();
+        }
         joinThreads();
     }
 
@@ -157,7 +200,12 @@ public:
     {
         if constexpr (!isTSafeMultiQueue)
         {
-            return m_queue->size();
+            auto total = m_queue->size();
+            for (const auto& queue : m_lanes)
+            {
+                total += queue->size();
+            }
+            return total;
         }
         else
         {
@@ -217,18 +265,21 @@ private:
      * This function enters a loop that runs while the dispatcher is active. Depending on the number of threads,
      * it either processes the queue in a single-threaded, ordered manner or in a multi-threaded, unordered manner.
      *
-     * - In the single-threaded case, it uses the `singleAndOrdered` method.
+     * - In the single-threaded case, it uses the `singleAndOrdered` method, with one thread per lane in keyed mode.
      * - In the multi-threaded case, it uses the `multiAndUnordered` method.
+     *
+     * @param laneIndex Lane consumed by the thread, 0 without lanes.
      */
-    void dispatch()
+    void dispatch(const size_t laneIndex)
     {
         // Loop while the dispatcher is running
         while (m_running)
         {
-            // If only one thread is used, process the queue in a single-threaded, ordered manner
+            // If only one thread is used, process the queue (or the lane of the thread) in a single-threaded, ordered
+            // manner
             if constexpr (TNumberOfThreads == 1)
             {
-                singleAndOrdered();
+                singleAndOrdered(lane(laneIndex));
             }
             // If multiple threads are used, process the queue in a multi-threaded, unordered manner
             else
@@ -243,29 +294,31 @@ private:
      *
      * This function checks the type of the queue and processes it accordingly. It supports `RocksDBQueue` and
      * `RocksDBQueueCF` queue types. In case of an exception, it logs the error.
+     *
+     * @param queue Queue or lane to process.
      */
-    void singleAndOrdered()
+    void singleAndOrdered(TSafeQueueType& queue)
     {
         try
         {
             if constexpr (isTSafeQueue)
             {
-                std::queue<U> data = m_queue->getBulk(m_bulkSize);
+                std::queue<U> data = queue.getBulk(m_bulkSize);
                 const auto size = data.size();
 
                 if (!data.empty())
                 {
                     m_functor(data);
-                    m_queue->popBulk(size);
+                    queue.popBulk(size);
                 }
             }
             else if constexpr (isTSafeMultiQueue)
             {
-                std::pair<U, std::string> data = m_queue->front();
+                std::pair<U, std::string> data = queue.front();
                 if (!data.second.empty())
                 {
                     m_functor(data.first);
-                    m_queue->pop(data.second);
+                    queue.pop(data.second);
                 }
             }
             else
@@ -342,6 +395,70 @@ private:
         }
     }
 
+    /**
+     * @brief Open the lanes of the keyed mode, besides the main queue which is the first lane.
+     *
+     * The other lanes are persisted next to the main queue, in `<dbPath>_<lane>`.
+     *
+     * @param dbPath Path of the main queue.
+     * @param lanes Number of lanes.
+     */
+    void createLanes(const std::string& dbPath, const uint8_t lanes)
+    {
+        if (lanes <= 1)
+        {
+            return;
+        }
+
+        if constexpr (isTSafeQueue && TNumberOfThreads == 1)
+        {
+            for (uint8_t i = 1; i < lanes; ++i)
+            {
+                m_lanes.push_back(std::make_unique<TSafeQueueType>(TQueueType(dbPath + "_" + std::to_string(i))));
+            }
+        }
+        else
+        {
+            throw std::runtime_error("Keyed lanes need a single-threaded dispatcher over a RocksDBQueue");
+        }
+    }
+
+    void startThreads()
+    {
+        if constexpr (TNumberOfThreads == 1)
+        {
+            m_threads.reserve(laneCount());
+            for (size_t i = 0; i < laneCount(); ++i)
+            {
+                m_threads.push_back(std::thread {
+                    &TThreadEventDispatcher<T, U, Functor, TNumberOfThreads, TQueueType, TSafeQueueType>::dispatch,
+                    this,
+                    i});
+            }
+        }
+        else
+        {
+            m_threads.reserve(TNumberOfThreads);
+            for (unsigned int i = 0; i < TNumberOfThreads; ++i)
+            {
+                m_threads.push_back(std::thread {
+                    &TThreadEventDispatcher<T, U, Functor, TNumberOfThreads, TQueueType, TSafeQueueType>::dispatch,
+                    this,
+                    0});
+            }
+        }
+    }
+
+    size_t laneCount() const
+    {
+        return m_lanes.size() + 1;
+    }
+
+    TSafeQueueType& lane(const size_t index)
+    {
+        return index == 0 ? *m_queue : *m_lanes[index - 1];
+    }
+
     void joinThreads()
     {
         for (auto& thread : m_threads)
@@ -355,6 +472,7 @@ private:
 
     Functor m_functor;
     std::unique_ptr<TSafeQueueType> m_queue;
+    std::vector<std::unique_ptr<TSafeQueueType>> m_lanes; ///< Lanes after the first one (m_queue) in keyed mode.
     std::vector<std::thread> m_threads;
     std::atomic_bool m_running = true;
 
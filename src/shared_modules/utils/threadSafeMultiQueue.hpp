@@ -56,6 +56,17 @@ namespace Utils
             }
         }
 
+        template<typename TOperation>
+        void push(std::string_view prefix, const T& value, const std::string& key, const TOperation operation)
+        {
+            std::scoped_lock lock {m_mutex};
+            if (!m_canceled)
+            {
+                m_queue.push(prefix, value, key, operation);
+                m_cv.notify_one();
+            }
+        }
+
         std::pair<U, std::string> front()
         {
             std::unique_lock lock {m_mutex};
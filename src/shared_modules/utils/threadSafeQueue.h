@@ -18,6 +18,7 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace Utils
 {
@@ -58,6 +59,17 @@ namespace Utils
             }
         }
 
+        void push(T&& value)
+        {
+            std::lock_guard<std::mutex> lock {m_mutex};
+
+            if (!m_canceled)
+            {
+                m_queue.push(std::move(value));
+                m_cv.notify_one();
+            }
+        }
+
         bool pop(U& value, const bool wait = true)
         {
             std::unique_lock<std::mutex> lock {m_mutex};
@@ -91,7 +103,7 @@ namespace Utils
 
             if (ret)
             {
-                const auto spData {std::make_shared<U>(m_queue.front())};
+                const auto spData {std::make_shared<U>(std::move(m_queue.front()))};
                 m_queue.pop();
                 return spData;
             }
@@ -99,6 +111,36 @@ namespace Utils
             return nullptr;
         }
 
+        /**
+         * @brief Moves up to elementsQuantity elements into the caller's buffer, taking the lock once for all of them.
+         *
+         * @param values Buffer to fill, cleared first. Reusing it between calls keeps its capacity.
+         * @param elementsQuantity Maximum amount of elements to pop.
+         * @param wait Whether to wait for at least one element.
+         * @return true if any element was popped.
+         */
+        bool popBulk(std::vector<U>& values, const uint64_t elementsQuantity, const bool wait = true)
+        {
+            values.clear();
+            std::unique_lock<std::mutex> lock {m_mutex};
+
+            if (wait)
+            {
+                m_cv.wait(lock, [this]() { return !m_queue.empty() || m_canceled; });
+            }
+
+            if (!m_canceled)
+            {
+                while (values.size() < elementsQuantity && !m_queue.empty())
+                {
+                    values.push_back(std::move(m_queue.front()));
+                    m_queue.pop();
+                }
+            }
+
+            return !values.empty();
+        }
+
         std::queue<U> getBulk(const uint64_t elementsQuantity,
                               const std::chrono::seconds& timeout = std::chrono::seconds(5))
         {
@@ -133,10 +175,7 @@ namespace Utils
         void popBulk(const uint64_t elementsQuantity)
         {
             std::lock_guard<std::mutex> lock {m_mutex};
-            for (auto i = 0; i < elementsQuantity && !m_queue.empty(); ++i)
-            {
-                m_queue.pop();
-            }
+            popElements(m_queue, elementsQuantity, 0);
         }
 
         std::queue<U> getBulkAndPop(const uint64_t elementsQuantity,
@@ -168,10 +207,7 @@ namespace Utils
             }
 
             // Pop the elements from the queue after getting them.
-            for (auto i = 0; i < elementsQuantity && !m_queue.empty(); ++i)
-            {
-                m_queue.pop();
-            }
+            popElements(m_queue, elementsQuantity, 0);
 
             return bulkQueue;
         }
@@ -202,6 +238,23 @@ namespace Utils
         }
 
     private:
+        // Queues that can remove several elements at once (e.g. in a single database write) do it in one call.
+        template<typename Q>
+        static auto popElements(Q& queue, const uint64_t elementsQuantity, int)
+            -> decltype(queue.popBulk(elementsQuantity), void())
+        {
+            queue.popBulk(elementsQuantity);
+        }
+
+        template<typename Q>
+        static void popElements(Q& queue, const uint64_t elementsQuantity, long)
+        {
+            for (uint64_t i = 0; i < elementsQuantity && !queue.empty(); ++i)
+            {
+                queue.pop();
+            }
+        }
+
         mutable std::mutex m_mutex;
         std::condition_variable m_cv;
         std::atomic<bool> m_canceled {};
@@ -36,9 +36,42 @@ void test_aes_string
     assert_int_equal(strncmp(buffer2, string, strlen(string)), 0);
 }
 
+void test_aes_ctx_string(void **state)
+{
+    const char *key = "1234567890abcdef1234567890abcdef";
+    const char *string = "test string";
+    const int buffersize = 1024;
+    char buffer1[buffersize];
+    char buffer2[buffersize];
+    char buffer3[buffersize];
+
+    os_aes_ctx *ctx = OS_AES_Ctx_New(key);
+    assert_non_null(ctx);
+
+    // The cached contexts give the same messages as the one-shot function, message after message
+    for (int i = 0; i < 2; i++) {
+        memset(buffer1, 0, sizeof(buffer1));
+        memset(buffer2, 0, sizeof(buffer2));
+
+        assert_int_equal(OS_AES_Ctx_Str(ctx, string, buffer1, strlen(string), OS_ENCRYPT), 16);
+        assert_int_equal(OS_AES_Str(string, buffer3, key, strlen(string), OS_ENCRYPT), 16);
+        assert_memory_equal(buffer1, buffer3, 16);
+
+        assert_int_equal(OS_AES_Ctx_Str(ctx, buffer1, buffer2, 16, OS_DECRYPT), 11);
+        assert_int_equal(strncmp(buffer2, string, strlen(string)), 0);
+    }
+
+    // A message that is not valid does not break the next ones
+    assert_int_equal(OS_AES_Ctx_Str(ctx, buffer1, buffer2, 15, OS_DECRYPT), 0);
+    assert_int_equal(OS_AES_Ctx_Str(ctx, buffer1, buffer2, 16, OS_DECRYPT), 11);
+
+    OS_AES_Ctx_Free(ctx);
+}
+
 int main(void) {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_aes_string),
+        cmocka_unit_test(test_aes_ctx_string),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
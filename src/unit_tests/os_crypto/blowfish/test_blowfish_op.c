@@ -32,9 +32,36 @@ void test_blowfish(void **state)
     assert_string_equal(buffer2, string);
 }
 
+void test_blowfish_key(void **state)
+{
+    const char *key = "test_key";
+    const char *string = "test string";
+    const int buffersize = 1024;
+    char buffer1[buffersize];
+    char buffer2[buffersize];
+    char buffer3[buffersize];
+
+    memset(buffer1, 0, sizeof(buffer1));
+    memset(buffer3, 0, sizeof(buffer3));
+    strcpy(buffer1, string);
+
+    os_bf_key *bf_key = OS_BF_Key_New(key);
+    assert_non_null(bf_key);
+
+    assert_int_equal(OS_BF_Key_Str(bf_key, buffer1, buffer2, buffersize, OS_ENCRYPT), 1);
+    assert_int_equal(OS_BF_Str(buffer1, buffer3, key, buffersize, OS_ENCRYPT), 1);
+    assert_memory_equal(buffer2, buffer3, buffersize);
+
+    assert_int_equal(OS_BF_Key_Str(bf_key, buffer2, buffer3, buffersize, OS_DECRYPT), 1);
+    assert_string_equal(buffer3, string);
+
+    OS_BF_Key_Free(bf_key);
+}
+
 int main(void) {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_blowfish),
+        cmocka_unit_test(test_blowfish_key),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
@@ -95,6 +95,41 @@ void test_fail_match(void **state)
     }
 }
 
+void test_match_automaton(void **state)
+{
+    (void) state;
+
+    const char *tests[][3] = {
+        {"she|he|hers|his", "ushers", "1"},
+        {"abcd|bce", "abce", "1"},
+        {"abcd|bcf", "abce", "0"},
+        {"aab|ab", "aaab", "1"},
+        {"Error|FAIL", "login failed", "1"},
+        {"^start|end$|word|other", "a word here", "1"},
+        {"^start|end$|word|other", "start here", "1"},
+        {"^start|end$|word|other", "the end", "1"},
+        {"^start|end$|word|other", "no match", "0"},
+        {"!abc|def", "xxdefxx", "0"},
+        {"!abc|def", "xxdexx", "1"},
+        {NULL, NULL, NULL}
+    };
+
+    for (int i = 0; tests[i][0] != NULL ; i++) {
+        OSMatch reg;
+        assert_int_equal(OSMatch_Compile(tests[i][0], &reg, 0), 1);
+        assert_non_null(reg.automaton);
+        assert_int_equal(OSMatch_Execute(tests[i][1], strlen(tests[i][1]), &reg), tests[i][2][0] == '1');
+        OSMatch_FreePattern(&reg);
+    }
+
+    /* A single sub pattern without ^ or $ is matched directly */
+    OSMatch reg;
+    assert_int_equal(OSMatch_Compile("^start|word", &reg, 0), 1);
+    assert_null(reg.automaton);
+    assert_int_equal(OSMatch_Execute("a word", strlen("a word"), &reg), 1);
+    OSMatch_FreePattern(&reg);
+}
+
 void test_success_regex(void **state)
 {
     (void) state;
@@ -816,6 +851,7 @@ int main(void) {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_success_match),
         cmocka_unit_test(test_fail_match),
+        cmocka_unit_test(test_match_automaton),
         cmocka_unit_test(test_success_regex),
         cmocka_unit_test(test_fail_regex),
         cmocka_unit_test(test_success_wordmatch),
@@ -1086,6 +1086,62 @@ void test_os_readxml_empty_tag(void **state) {
     assert_int_equal(data->xml.err_line, 1);
 }
 
+void test_os_readxml_many_nodes(void **state) {
+    test_struct_t *data  = (test_struct_t *)*state;
+    char *xml_string = NULL;
+    unsigned int i;
+
+    os_calloc(300, 16, xml_string);
+    strcpy(xml_string, "<root>");
+    for (i = 0; i < 200; i++) {
+        strcat(xml_string, "<n>c</n>\n");
+    }
+    strcat(xml_string, "</root>");
+    create_xml_file(xml_string, data->xml_file_name, 256);
+    os_free(xml_string);
+
+    assert_int_equal(OS_ReadXML(data->xml_file_name, &data->xml), 0);
+    assert_int_equal(data->xml.cur, 201);
+    assert_string_equal(data->xml.el[200], "n");
+    assert_string_equal(data->xml.ct[200], "c");
+    assert_int_equal(data->xml.rl[200], 1);
+    assert_int_equal(data->xml.ck[200], 1);
+    assert_int_equal(data->xml.ln[200], 200);
+}
+
+static void create_nested_xml_file(unsigned int depth, char file_name[], size_t length) {
+    char *xml_string = NULL;
+    unsigned int i;
+
+    os_calloc(depth + 1, 8, xml_string);
+    for (i = 0; i < depth; i++) {
+        strcat(xml_string, "<n>");
+    }
+    for (i = 0; i < depth; i++) {
+        strcat(xml_string, "</n>");
+    }
+    create_xml_file(xml_string, file_name, length);
+    os_free(xml_string);
+}
+
+void test_os_readxml_max_depth(void **state) {
+    test_struct_t *data  = (test_struct_t *)*state;
+    create_nested_xml_file(XML_MAX_DEPTH, data->xml_file_name, 256);
+
+    assert_int_equal(OS_ReadXML(data->xml_file_name, &data->xml), 0);
+    assert_int_equal(data->xml.cur, XML_MAX_DEPTH);
+    assert_int_equal(data->xml.rl[XML_MAX_DEPTH - 1], XML_MAX_DEPTH - 1);
+    assert_int_equal(data->xml.ck[0], 1);
+}
+
+void test_os_readxml_max_depth_exceeded(void **state) {
+    test_struct_t *data  = (test_struct_t *)*state;
+    create_nested_xml_file(XML_MAX_DEPTH + 1, data->xml_file_name, 256);
+
+    assert_int_not_equal(OS_ReadXML(data->xml_file_name, &data->xml), 0);
+    assert_string_equal(data->xml.err, "XMLERR: Max recursion level reached");
+}
+
 void test_node_attribute_value_truncate_overflow(void **state) {
     test_struct_t *data  = (test_struct_t *)*state;
 
@@ -1334,6 +1390,9 @@ int main(void) {
         cmocka_unit_test_setup_teardown(test_os_readxml_random_string_with_valid_xml, test_setup, test_teardown),
         cmocka_unit_test_setup_teardown(test_os_readxml_non_empty_tag, test_setup, test_teardown),
         cmocka_unit_test_setup_teardown(test_os_readxml_empty_tag, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_os_readxml_many_nodes, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_os_readxml_max_depth, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_os_readxml_max_depth_exceeded, test_setup, test_teardown),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -19,6 +19,8 @@
 #define TEST_STRING_1 "Hello World!"
 #define TEST_STRING_2 "Test hello \n test \t test \r World\n"
 #define BUFFER_LENGTH 200
+#define TEST_DICTIONARY "ossec: Agent started: 'agent->any'. wazuh-agent wazuh-modulesd syscheck rootcheck"
+#define TEST_EVENT "ossec: Agent started: 'agent->any'. wazuh-modulesd"
 
 typedef struct test_struct {
     unsigned long int i1;
@@ -135,6 +137,100 @@ void test_fail_uncompress_no_dest_size(void **state) {
     assert_int_equal(i2, 0);
 }
 
+void test_success_stream_compress(void **state) {
+    char buffer[BUFFER_LENGTH];
+    char buffer2[BUFFER_LENGTH];
+    os_zlib_stream *deflate_stream = os_zlib_stream_init(1, NULL, 0);
+    os_zlib_stream *inflate_stream = os_zlib_stream_init(0, NULL, 0);
+    assert_non_null(deflate_stream);
+    assert_non_null(inflate_stream);
+
+    // The stream is reset for each message
+    for (int i = 0; i < 2; i++) {
+        unsigned long int i1 = os_zlib_stream_compress(deflate_stream, TEST_STRING_2, buffer, strlen(TEST_STRING_2), BUFFER_LENGTH);
+        assert_int_not_equal(i1, 0);
+
+        unsigned long int i2 = os_zlib_stream_uncompress(inflate_stream, buffer, buffer2, i1, BUFFER_LENGTH);
+        assert_int_equal(i2, strlen(TEST_STRING_2));
+        assert_string_equal(buffer2, TEST_STRING_2);
+
+        // Without a dictionary the messages are the ones of os_zlib_compress
+        i2 = os_zlib_uncompress(buffer, buffer2, i1, BUFFER_LENGTH);
+        assert_string_equal(buffer2, TEST_STRING_2);
+    }
+
+    os_zlib_stream_free(deflate_stream);
+    os_zlib_stream_free(inflate_stream);
+}
+
+void test_success_stream_uncompress_without_dictionary(void **state) {
+    test_struct_t *data  = (test_struct_t *)*state;
+    char buffer2[BUFFER_LENGTH];
+    os_zlib_stream *inflate_stream = os_zlib_stream_init(0, TEST_DICTIONARY, strlen(TEST_DICTIONARY));
+    assert_non_null(inflate_stream);
+
+    unsigned long int i2 = os_zlib_stream_uncompress(inflate_stream, data->buffer, buffer2, data->i1, BUFFER_LENGTH);
+    assert_int_equal(i2, strlen(TEST_STRING_1));
+    assert_string_equal(buffer2, TEST_STRING_1);
+
+    os_zlib_stream_free(inflate_stream);
+}
+
+void test_success_stream_dictionary(void **state) {
+    char buffer[BUFFER_LENGTH];
+    char buffer2[BUFFER_LENGTH];
+    os_zlib_stream *deflate_stream = os_zlib_stream_init(1, TEST_DICTIONARY, strlen(TEST_DICTIONARY));
+    os_zlib_stream *inflate_stream = os_zlib_stream_init(0, TEST_DICTIONARY, strlen(TEST_DICTIONARY));
+    assert_non_null(deflate_stream);
+    assert_non_null(inflate_stream);
+
+    unsigned long int i1 = os_zlib_stream_compress(deflate_stream, TEST_EVENT, buffer, strlen(TEST_EVENT), BUFFER_LENGTH);
+    assert_int_not_equal(i1, 0);
+    assert_true(i1 < os_zlib_compress(TEST_EVENT, buffer2, strlen(TEST_EVENT), BUFFER_LENGTH));
+
+    unsigned long int i2 = os_zlib_stream_uncompress(inflate_stream, buffer, buffer2, i1, BUFFER_LENGTH);
+    assert_int_equal(i2, strlen(TEST_EVENT));
+    assert_string_equal(buffer2, TEST_EVENT);
+
+    os_zlib_stream_free(deflate_stream);
+    os_zlib_stream_free(inflate_stream);
+}
+
+void test_fail_stream_dictionary_mismatch(void **state) {
+    char buffer[BUFFER_LENGTH];
+    char buffer2[BUFFER_LENGTH];
+    os_zlib_stream *deflate_stream = os_zlib_stream_init(1, TEST_DICTIONARY, strlen(TEST_DICTIONARY));
+    os_zlib_stream *inflate_stream = os_zlib_stream_init(0, TEST_STRING_2, strlen(TEST_STRING_2));
+    os_zlib_stream *plain_stream = os_zlib_stream_init(0, NULL, 0);
+
+    unsigned long int i1 = os_zlib_stream_compress(deflate_stream, TEST_EVENT, buffer, strlen(TEST_EVENT), BUFFER_LENGTH);
+    assert_int_not_equal(i1, 0);
+
+    assert_int_equal(os_zlib_stream_uncompress(inflate_stream, buffer, buffer2, i1, BUFFER_LENGTH), 0);
+    assert_int_equal(os_zlib_stream_uncompress(plain_stream, buffer, buffer2, i1, BUFFER_LENGTH), 0);
+    assert_int_equal(os_zlib_uncompress(buffer, buffer2, i1, BUFFER_LENGTH), 0);
+
+    os_zlib_stream_free(deflate_stream);
+    os_zlib_stream_free(inflate_stream);
+    os_zlib_stream_free(plain_stream);
+}
+
+void test_fail_stream_wrong_direction(void **state) {
+    char buffer[BUFFER_LENGTH];
+    os_zlib_stream *inflate_stream = os_zlib_stream_init(0, NULL, 0);
+
+    assert_int_equal(os_zlib_stream_compress(inflate_stream, TEST_STRING_1, buffer, strlen(TEST_STRING_1), BUFFER_LENGTH), 0);
+    assert_int_equal(os_zlib_stream_compress(NULL, TEST_STRING_1, buffer, strlen(TEST_STRING_1), BUFFER_LENGTH), 0);
+
+    os_zlib_stream_free(inflate_stream);
+}
+
+void test_fail_stream_dictionary_too_large(void **state) {
+    char *dictionary = calloc(1, OS_ZLIB_DICTIONARY_MAXSIZE + 1);
+    assert_null(os_zlib_stream_init(1, dictionary, OS_ZLIB_DICTIONARY_MAXSIZE + 1));
+    os_free(dictionary);
+}
+
 int main(void) {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_success_compress_string),
@@ -148,6 +244,12 @@ int main(void) {
         cmocka_unit_test_setup_teardown(test_fail_uncompress_null_dst, setup_uncompress_string1, teardown_uncompress),
         cmocka_unit_test_setup_teardown(test_fail_uncompress_no_src_size, setup_uncompress_string1, teardown_uncompress),
         cmocka_unit_test_setup_teardown(test_fail_uncompress_no_dest_size, setup_uncompress_string1, teardown_uncompress),
+        cmocka_unit_test(test_success_stream_compress),
+        cmocka_unit_test_setup_teardown(test_success_stream_uncompress_without_dictionary, setup_uncompress_string1, teardown_uncompress),
+        cmocka_unit_test(test_success_stream_dictionary),
+        cmocka_unit_test(test_fail_stream_dictionary_mismatch),
+        cmocka_unit_test(test_fail_stream_wrong_direction),
+        cmocka_unit_test(test_fail_stream_dictionary_too_large),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
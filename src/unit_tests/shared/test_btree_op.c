@@ -0,0 +1,401 @@
+/*
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "../headers/btree_op.h"
+
+#define RANDOM_KEYS 5000
+
+/* setup/teardowns */
+
+static int create_btree(void **state)
+{
+    b_tree *tree = btree_init();
+    *state = tree;
+    return 0;
+}
+
+static int create_btree_with_dispose(void **state)
+{
+    b_tree *tree = btree_init();
+
+    btree_set_dispose(tree, free);
+
+    *state = tree;
+    return 0;
+}
+
+static int delete_btree(void **state)
+{
+    b_tree *tree = *state;
+    btree_destroy(tree);
+    return 0;
+}
+
+/* auxiliary functions */
+
+static void free_keys(char **keys)
+{
+    int i;
+
+    for (i = 0; keys[i]; i++) {
+        free(keys[i]);
+    }
+
+    free(keys);
+}
+
+// Check the node bounds and the key order, and return the height of the subtree
+
+static int check_node(const b_node *node, const char *min, const char *max, int root)
+{
+    int height = 0;
+    unsigned i;
+
+    assert_true(node->count <= B_MAX_KEYS);
+    assert_true(node->count >= (root ? 1 : B_DEGREE - 1));
+
+    for (i = 0; i < node->count; i++) {
+        if (i > 0) {
+            assert_true(strcmp(node->keys[i - 1], node->keys[i]) < 0);
+        }
+        if (min) {
+            assert_true(strcmp(min, node->keys[i]) < 0);
+        }
+        if (max) {
+            assert_true(strcmp(node->keys[i], max) < 0);
+        }
+    }
+
+    if (!node->leaf) {
+        height = check_node(node->children[0], min, node->keys[0], 0);
+
+        for (i = 1; i <= node->count; i++) {
+            int h = check_node(node->children[i], node->keys[i - 1], i < node->count ? node->keys[i] : max, 0);
+            assert_int_equal(h, height);
+        }
+    }
+
+    return height + 1;
+}
+
+static void fill_tree(b_tree *tree, int n)
+{
+    char key[16];
+    int i;
+
+    for (i = 0; i < n; i++) {
+        snprintf(key, sizeof(key), "%05d", i);
+        assert_int_equal(btree_insert(tree, key, strdup(key)), 1);
+    }
+}
+
+/* tests */
+
+void test_btree_insert_success(void **state)
+{
+    b_tree *tree = *state;
+    char *value = strdup("testing");
+
+    assert_int_equal(btree_insert(tree, "test", value), 1);
+
+    assert_non_null(tree->root);
+    assert_string_equal(tree->root->keys[0], "test");
+    assert_ptr_equal(tree->root->values[0], value);
+    assert_int_equal(btree_size(tree), 1);
+}
+
+void test_btree_insert_failure(void **state)
+{
+    b_tree *tree = *state;
+    char *value = strdup("testing");
+
+    btree_insert(tree, "test", value);
+
+    assert_int_equal(btree_insert(tree, "test", value), 0);
+    assert_int_equal(btree_size(tree), 1);
+}
+
+void test_btree_insert_null_tree(void **state)
+{
+    (void) state;
+    char *value = strdup("testing");
+
+    expect_assert_failure(btree_insert(NULL, "test", value));
+
+    free(value);
+}
+
+void test_btree_insert_null_key(void **state)
+{
+    b_tree *tree = *state;
+    char *value = strdup("testing");
+
+    expect_assert_failure(btree_insert(tree, NULL, value));
+
+    free(value);
+}
+
+void test_btree_insert_null_value(void **state)
+{
+    b_tree *tree = *state;
+
+    assert_int_equal(btree_insert(tree, "test", NULL), 1);
+    assert_null(btree_get(tree, "test"));
+    assert_int_equal(btree_size(tree), 1);
+}
+
+void test_btree_replace_success(void **state)
+{
+    b_tree *tree = *state;
+    char *value = strdup("new");
+
+    btree_insert(tree, "test", strdup("old"));
+
+    assert_ptr_equal(btree_replace(tree, "test", value), value);
+    assert_ptr_equal(btree_get(tree, "test"), value);
+}
+
+void test_btree_replace_not_found(void **state)
+{
+    b_tree *tree = *state;
+    char *value = strdup("new");
+
+    btree_insert(tree, "test", strdup("old"));
+
+    assert_null(btree_replace(tree, "other", value));
+    assert_string_equal(btree_get(tree, "test"), "old");
+
+    free(value);
+}
+
+void test_btree_replace_null_key(void **state)
+{
+    b_tree *tree = *state;
+
+    expect_assert_failure(btree_replace(tree, NULL, NULL));
+}
+
+void test_btree_get_not_found(void **state)
+{
+    b_tree *tree = *state;
+
+    assert_null(btree_get(tree, "test"));
+
+    fill_tree(tree, 100);
+
+    assert_null(btree_get(tree, "test"));
+    assert_string_equal(btree_get(tree, "00050"), "00050");
+}
+
+void test_btree_get_null_key(void **state)
+{
+    b_tree *tree = *state;
+
+    expect_assert_failure(btree_get(tree, NULL));
+}
+
+void test_btree_delete_success(void **state)
+{
+    b_tree *tree = *state;
+
+    fill_tree(tree, 100);
+
+    assert_int_equal(btree_delete(tree, "00050"), 1);
+    assert_null(btree_get(tree, "00050"));
+    assert_int_equal(btree_size(tree), 99);
+    check_node(tree->root, NULL, NULL, 1);
+}
+
+void test_btree_delete_not_found(void **state)
+{
+    b_tree *tree = *state;
+
+    assert_int_equal(btree_delete(tree, "test"), 0);
+
+    fill_tree(tree, 100);
+
+    assert_int_equal(btree_delete(tree, "test"), 0);
+    assert_int_equal(btree_size(tree), 100);
+}
+
+void test_btree_delete_all(void **state)
+{
+    b_tree *tree = *state;
+    char key[16];
+    int i;
+
+    fill_tree(tree, 1000);
+
+    for (i = 0; i < 1000; i++) {
+        snprintf(key, sizeof(key), "%05d", i);
+        assert_int_equal(btree_delete(tree, key), 1);
+    }
+
+    assert_null(tree->root);
+    assert_int_equal(btree_empty(tree), 1);
+    assert_int_equal(btree_size(tree), 0);
+}
+
+void test_btree_minimum_maximum(void **state)
+{
+    b_tree *tree = *state;
+
+    assert_null(btree_minimum(tree));
+    assert_null(btree_maximum(tree));
+
+    fill_tree(tree, 1000);
+
+    assert_string_equal(btree_minimum(tree), "00000");
+    assert_string_equal(btree_maximum(tree), "00999");
+}
+
+void test_btree_keys(void **state)
+{
+    b_tree *tree = *state;
+    char key[16];
+    char **keys;
+    int i;
+
+    keys = btree_keys(tree);
+    assert_null(keys[0]);
+    free_keys(keys);
+
+    fill_tree(tree, 1000);
+
+    keys = btree_keys(tree);
+
+    for (i = 0; i < 1000; i++) {
+        snprintf(key, sizeof(key), "%05d", i);
+        assert_string_equal(keys[i], key);
+    }
+
+    assert_null(keys[i]);
+    free_keys(keys);
+}
+
+void test_btree_range(void **state)
+{
+    b_tree *tree = *state;
+    char key[16];
+    char **keys;
+    int i;
+
+    fill_tree(tree, 1000);
+
+    keys = btree_range(tree, "00100", "00199");
+
+    for (i = 0; i < 100; i++) {
+        snprintf(key, sizeof(key), "%05d", i + 100);
+        assert_string_equal(keys[i], key);
+    }
+
+    assert_null(keys[i]);
+    free_keys(keys);
+
+    // Bounds between keys
+    keys = btree_range(tree, "00100a", "00102a");
+    assert_string_equal(keys[0], "00101");
+    assert_string_equal(keys[1], "00102");
+    assert_null(keys[2]);
+    free_keys(keys);
+
+    keys = btree_range(tree, "1", "2");
+    assert_null(keys[0]);
+    free_keys(keys);
+}
+
+void test_btree_random(void **state)
+{
+    b_tree *tree = *state;
+    char present[RANDOM_KEYS] = { 0 };
+    unsigned size = 0;
+    char key[16];
+    int i;
+
+    srand(1);
+
+    // Compare with a presence table through random insertions and deletions
+    for (i = 0; i < 20 * RANDOM_KEYS; i++) {
+        int n = rand() % RANDOM_KEYS;
+        snprintf(key, sizeof(key), "%d", n);
+
+        if (rand() % 2) {
+            char *value = strdup(key);
+
+            if (btree_insert(tree, key, value)) {
+                assert_int_equal(present[n], 0);
+                present[n] = 1;
+                size++;
+            } else {
+                assert_int_equal(present[n], 1);
+                free(value);
+            }
+        } else {
+            assert_int_equal(btree_delete(tree, key), present[n]);
+            size -= present[n];
+            present[n] = 0;
+        }
+
+        if (i % 1000 == 0 && tree->root) {
+            check_node(tree->root, NULL, NULL, 1);
+        }
+    }
+
+    assert_int_equal(btree_size(tree), size);
+
+    for (i = 0; i < RANDOM_KEYS; i++) {
+        snprintf(key, sizeof(key), "%d", i);
+
+        if (present[i]) {
+            assert_string_equal(btree_get(tree, key), key);
+        } else {
+            assert_null(btree_get(tree, key));
+        }
+    }
+}
+
+void test_btree_size_null_tree(void **state)
+{
+    (void) state;
+
+    expect_assert_failure(btree_size(NULL));
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup_teardown(test_btree_insert_success, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_insert_failure, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_insert_null_tree, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_insert_null_key, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_insert_null_value, create_btree, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_replace_success, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_replace_not_found, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_replace_null_key, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_get_not_found, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_get_null_key, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_delete_success, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_delete_not_found, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_delete_all, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_minimum_maximum, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_keys, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_range, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test_setup_teardown(test_btree_random, create_btree_with_dispose, delete_btree),
+        cmocka_unit_test(test_btree_size_null_tree),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
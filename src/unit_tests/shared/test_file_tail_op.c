@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdio.h>
+
+#include "shared.h"
+
+typedef struct test_struct {
+    char file_name[256];
+    w_ftail_t * ftail;
+    w_ftail_batch_t * batch;
+} test_struct_t;
+
+/****************SETUP/TEARDOWN******************/
+static int test_setup(void **state) {
+    test_struct_t * data;
+    int fd;
+
+    os_calloc(1, sizeof(test_struct_t), data);
+    strncpy(data->file_name, "/tmp/tmp_ftail-XXXXXX", sizeof(data->file_name));
+    fd = mkstemp(data->file_name);
+    close(fd);
+
+    *state = data;
+    return 0;
+}
+
+static int test_teardown(void **state) {
+    test_struct_t * data = *state;
+
+    ftail_batch_free(data->batch);
+    ftail_close(data->ftail);
+    unlink(data->file_name);
+    os_free(data);
+    return 0;
+}
+
+static void append(const char * file_name, const char * str) {
+    FILE * fp = fopen(file_name, "a");
+    fputs(str, fp);
+    fclose(fp);
+}
+
+static void assert_batch(test_struct_t * data, size_t max, size_t count, const char ** lines) {
+    size_t i;
+
+    ftail_batch_free(data->batch);
+    data->batch = ftail_read(data->ftail, max);
+
+    if (count == 0) {
+        assert_null(data->batch);
+        return;
+    }
+
+    assert_non_null(data->batch);
+    assert_int_equal(data->batch->count, count);
+    for (i = 0; i < count; i++) {
+        assert_string_equal(data->batch->lines[i], lines[i]);
+    }
+}
+
+static int starts_with(const char * line, void * data) {
+    return strncmp(line, data, strlen(data)) == 0;
+}
+
+static void assert_records(test_struct_t * data, w_ftail_record_t mode, int flush, size_t count, const char ** records) {
+    size_t i;
+
+    ftail_batch_free(data->batch);
+    data->batch = ftail_read_multiline(data->ftail, starts_with, "--", mode, 10, flush);
+
+    if (count == 0) {
+        assert_null(data->batch);
+        return;
+    }
+
+    assert_non_null(data->batch);
+    assert_int_equal(data->batch->count, count);
+    for (i = 0; i < count; i++) {
+        assert_string_equal(data->batch->lines[i], records[i]);
+    }
+}
+
+/****************TESTS***************************/
+void test_ftail_open_not_found(void **state) {
+    assert_null(ftail_open("/tmp/not-found-ftail", 0, 0));
+}
+
+void test_ftail_read_lines(void **state) {
+    test_struct_t * data = *state;
+    const char * lines[] = { "first", "", "second", "third", "fourth" };
+
+    append(data->file_name, "first\n\nsecond\nthird\nfou");
+    data->ftail = ftail_open(data->file_name, 0, 0);
+    assert_non_null(data->ftail);
+
+    assert_batch(data, 2, 2, lines);
+    assert_batch(data, 10, 2, lines + 2);
+
+    // The incomplete line is kept until its end is written
+    assert_batch(data, 10, 0, NULL);
+    append(data->file_name, "rth\n");
+    assert_batch(data, 10, 1, lines + 4);
+    assert_batch(data, 10, 0, NULL);
+}
+
+void test_ftail_open_tail(void **state) {
+    test_struct_t * data = *state;
+    const char * lines[] = { "new" };
+
+    append(data->file_name, "old\n");
+    data->ftail = ftail_open(data->file_name, 1, 0);
+    assert_non_null(data->ftail);
+
+    assert_batch(data, 10, 0, NULL);
+    append(data->file_name, "new\n");
+    assert_batch(data, 10, 1, lines);
+}
+
+void test_ftail_truncated(void **state) {
+    test_struct_t * data = *state;
+    const char * lines[] = { "before truncate", "after" };
+    FILE * fp;
+
+    append(data->file_name, "before truncate\n");
+    data->ftail = ftail_open(data->file_name, 0, 0);
+    assert_batch(data, 10, 1, lines);
+
+    fp = fopen(data->file_name, "w");
+    fputs("after\n", fp);
+    fclose(fp);
+
+    assert_batch(data, 10, 1, lines + 1);
+}
+
+void test_ftail_rotated(void **state) {
+    test_struct_t * data = *state;
+    const char * lines[] = { "old file", "last of old file", "new file" };
+    char rotated[300];
+
+    append(data->file_name, "old file\n");
+    data->ftail = ftail_open(data->file_name, 0, 0);
+    assert_batch(data, 10, 1, lines);
+
+    snprintf(rotated, sizeof(rotated), "%s.1", data->file_name);
+    rename(data->file_name, rotated);
+    append(rotated, "last of old file\n");
+    append(data->file_name, "new file\n");
+
+    // The old file is read up to its end before following the path
+    assert_batch(data, 10, 1, lines + 1);
+    assert_batch(data, 10, 1, lines + 2);
+
+    unlink(rotated);
+}
+
+void test_ftail_long_line(void **state) {
+    test_struct_t * data = *state;
+    const char * lines[] = { "short" };
+    char * long_line;
+    int i;
+
+    os_calloc(3 * FTAIL_READ_SIZE, 1, long_line);
+    memset(long_line, 'a', 3 * FTAIL_READ_SIZE - 2);
+    long_line[3 * FTAIL_READ_SIZE - 2] = '\n';
+    append(data->file_name, long_line);
+    append(data->file_name, "short\n");
+    os_free(long_line);
+
+    data->ftail = ftail_open(data->file_name, 0, 2 * FTAIL_READ_SIZE);
+
+    // Each read takes one block, the long line spans several
+    for (i = 0; i < 10 && data->batch == NULL; i++) {
+        data->batch = ftail_read(data->ftail, 10);
+    }
+    assert_non_null(data->batch);
+    assert_int_equal(data->batch->count, 1);
+    assert_string_equal(data->batch->lines[0], lines[0]);
+    assert_int_equal(data->ftail->discarded, 1);
+}
+
+void test_ftail_multiline_start(void **state) {
+    test_struct_t * data = *state;
+    const char * records[] = { "garbage", "-- one\n  a\n  b", "-- two", "-- three\n  c" };
+
+    append(data->file_name, "garbage\n-- one\n  a\n  b\n-- two\n-- three\n");
+    data->ftail = ftail_open(data->file_name, 0, 0);
+
+    // The last record is pending until the next one starts
+    assert_records(data, FTAIL_RECORD_START, 0, 3, records);
+    assert_records(data, FTAIL_RECORD_START, 0, 0, NULL);
+    append(data->file_name, "  c\n");
+    assert_records(data, FTAIL_RECORD_START, 0, 0, NULL);
+
+    // Until the timeout of the caller expires
+    assert_records(data, FTAIL_RECORD_START, 1, 1, records + 3);
+    assert_records(data, FTAIL_RECORD_START, 1, 0, NULL);
+}
+
+void test_ftail_multiline_end(void **state) {
+    test_struct_t * data = *state;
+    const char * records[] = { "a\nb\n-- end", "-- end", "c\n-- end" };
+
+    append(data->file_name, "a\nb\n-- end\n-- end\nc\n-- e");
+    data->ftail = ftail_open(data->file_name, 0, 0);
+
+    assert_records(data, FTAIL_RECORD_END, 0, 2, records);
+    assert_records(data, FTAIL_RECORD_END, 0, 0, NULL);
+    append(data->file_name, "nd\n");
+    assert_records(data, FTAIL_RECORD_END, 0, 1, records + 2);
+}
+
+#ifdef INOTIFY_ENABLED
+void test_ftail_wait(void **state) {
+    test_struct_t * data = *state;
+
+    data->ftail = ftail_open(data->file_name, 0, 0);
+
+    assert_int_equal(ftail_wait(data->ftail, 0), 0);
+    append(data->file_name, "line\n");
+    assert_int_equal(ftail_wait(data->ftail, 1000), 1);
+}
+#endif
+
+int main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_ftail_open_not_found),
+        cmocka_unit_test_setup_teardown(test_ftail_read_lines, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_ftail_open_tail, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_ftail_truncated, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_ftail_rotated, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_ftail_long_line, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_ftail_multiline_start, test_setup, test_teardown),
+        cmocka_unit_test_setup_teardown(test_ftail_multiline_end, test_setup, test_teardown),
+#ifdef INOTIFY_ENABLED
+        cmocka_unit_test_setup_teardown(test_ftail_wait, test_setup, test_teardown),
+#endif
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdio.h>
+
+#include "shared.h"
+
+#define PRODUCERS 4
+#define PRODUCED 100000
+
+typedef struct producer_s {
+    w_ring_t * ring;
+    uintptr_t id;
+} producer_t;
+
+/****************SETUP/TEARDOWN******************/
+int setup_ring(void **state) {
+    *state = ring_init(5);
+    return 0;
+}
+
+int teardown_ring(void **state) {
+    ring_free(*state);
+    return 0;
+}
+
+static void * producer(void * arg) {
+    producer_t * p = arg;
+    uintptr_t i;
+
+    for (i = 1; i <= PRODUCED; i++) {
+        // The element encodes the producer and its sequence
+        ring_push_ex_block(p->ring, (void *)(p->id << 24 | i));
+    }
+
+    return NULL;
+}
+
+/****************TESTS***************************/
+void test_ring_init(void **state) {
+    w_ring_t * ring = *state;
+
+    assert_int_equal(ring->mask, 7);
+    assert_int_equal(ring_empty(ring), 1);
+}
+
+void test_ring_push_pop(void **state) {
+    w_ring_t * ring = *state;
+    uintptr_t i;
+
+    for (i = 1; i <= 8; i++) {
+        assert_int_equal(ring_push(ring, (void *)i), 0);
+    }
+    assert_int_equal(ring_push(ring, (void *)i), -1);
+    assert_int_equal(ring_empty(ring), 0);
+
+    for (i = 1; i <= 8; i++) {
+        assert_ptr_equal(ring_pop(ring), (void *)i);
+    }
+    assert_null(ring_pop(ring));
+    assert_int_equal(ring_empty(ring), 1);
+}
+
+void test_ring_batch(void **state) {
+    w_ring_t * ring = *state;
+    void * in[10];
+    void * out[10];
+    uintptr_t i;
+
+    for (i = 0; i < 10; i++) {
+        in[i] = (void *)(i + 1);
+    }
+
+    // Go around the ring several times, the batches cross its end
+    for (i = 0; i < 5; i++) {
+        assert_int_equal(ring_push_batch(ring, in, 3), 3);
+        assert_int_equal(ring_pop_batch(ring, out, 10), 3);
+        assert_memory_equal(out, in, 3 * sizeof(void *));
+    }
+
+    // Only what fits is pushed
+    assert_int_equal(ring_push_batch(ring, in, 10), 8);
+    assert_int_equal(ring_push_batch(ring, in + 8, 2), 0);
+    assert_int_equal(ring_pop_batch(ring, out, 5), 5);
+    assert_memory_equal(out, in, 5 * sizeof(void *));
+    assert_int_equal(ring_push_batch(ring, in + 8, 2), 2);
+    assert_int_equal(ring_pop_batch(ring, out, 10), 5);
+    assert_memory_equal(out, in + 5, 5 * sizeof(void *));
+    assert_int_equal(ring_pop_batch(ring, out, 10), 0);
+}
+
+void test_ring_pop_ex_timedwait_timeout(void **state) {
+    w_ring_t * ring = *state;
+    struct timespec abstime;
+
+    clock_gettime(CLOCK_REALTIME, &abstime);
+    abstime.tv_nsec += 10000000;
+    if (abstime.tv_nsec >= 1000000000) {
+        abstime.tv_sec++;
+        abstime.tv_nsec -= 1000000000;
+    }
+
+    assert_null(ring_pop_ex_timedwait(ring, &abstime));
+
+    ring_push(ring, (void *)1);
+    assert_ptr_equal(ring_pop_ex_timedwait(ring, &abstime), (void *)1);
+}
+
+void test_ring_producers(void **state) {
+    w_ring_t * ring = *state;
+    producer_t producers[PRODUCERS];
+    pthread_t threads[PRODUCERS];
+    uintptr_t last[PRODUCERS] = {0};
+    uintptr_t i;
+
+    for (i = 0; i < PRODUCERS; i++) {
+        producers[i].ring = ring;
+        producers[i].id = i;
+        assert_int_equal(pthread_create(&threads[i], NULL, producer, &producers[i]), 0);
+    }
+
+    // Every element arrives once, and in order for each producer
+    for (i = 0; i < PRODUCERS * PRODUCED; i++) {
+        uintptr_t data = (uintptr_t)ring_pop_ex(ring);
+        uintptr_t id = data >> 24;
+
+        assert_true(id < PRODUCERS);
+        assert_int_equal(data & 0xffffff, last[id] + 1);
+        last[id]++;
+    }
+
+    for (i = 0; i < PRODUCERS; i++) {
+        pthread_join(threads[i], NULL);
+        assert_int_equal(last[i], PRODUCED);
+    }
+    assert_int_equal(ring_empty(ring), 1);
+}
+
+int main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup_teardown(test_ring_init, setup_ring, teardown_ring),
+        cmocka_unit_test_setup_teardown(test_ring_push_pop, setup_ring, teardown_ring),
+        cmocka_unit_test_setup_teardown(test_ring_batch, setup_ring, teardown_ring),
+        cmocka_unit_test_setup_teardown(test_ring_pop_ex_timedwait_timeout, setup_ring, teardown_ring),
+        cmocka_unit_test_setup_teardown(test_ring_producers, setup_ring, teardown_ring),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -12,6 +12,7 @@
 #include "syscollector.hpp"
 #include "json.hpp"
 #include <iostream>
+#include <sys/stat.h>
 #include "stringHelper.h"
 #include "hashHelper.h"
 #include "timeHelper.h"
@@ -109,7 +110,7 @@ constexpr auto OS_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE os_name BETWEEN '?' and '?' ORDER BY os_name",
-                "column_list":["*"],
+                "column_list":["os_name, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -195,7 +196,7 @@ constexpr auto HW_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE board_serial BETWEEN '?' and '?' ORDER BY board_serial",
-                "column_list":["*"],
+                "column_list":["board_serial, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -276,7 +277,7 @@ constexpr auto HOTFIXES_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE hotfix BETWEEN '?' and '?' ORDER BY hotfix",
-                "column_list":["*"],
+                "column_list":["hotfix, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -340,6 +341,37 @@ constexpr auto PACKAGES_SQL_STATEMENT
 };
 static const std::vector<std::string> PACKAGES_ITEM_ID_FIELDS{"name", "version", "architecture", "format", "location"};
 
+// Databases and logs written by the system package managers. While none of them changes, a package scan finds the
+// same packages, so it's skipped up to PACKAGES_MAX_SKIPPED_SCANS times in a row. The full scan that follows is the
+// safety net for the packages that these files don't track, such as the language packages.
+static const std::vector<std::string> PACKAGES_DATABASE_PATHS
+{
+    "/var/lib/dpkg/status",
+    "/var/log/dpkg.log",
+    "/var/lib/rpm/Packages",
+    "/var/lib/rpm/rpmdb.sqlite",
+    "/var/lib/rpm/rpmdb.sqlite-wal",
+    "/var/log/dnf.rpm.log",
+    "/var/log/yum.log",
+    "/var/lib/pacman/local",
+    "/lib/apk/db/installed",
+    "/var/lib/snapd/state.json"
+};
+
+constexpr auto PACKAGES_MAX_SKIPPED_SCANS
+{
+    3u
+};
+
+// State of the package scans skipped by the fingerprint. Syscollector is a singleton, so it lives at file scope and
+// init() resets it: the volatile database starts empty, the first scan after init must always run.
+struct PackagesScanState
+{
+    std::string lastFingerprint;
+    unsigned int skippedScans {0};
+};
+static PackagesScanState packagesScanState;
+
 constexpr auto PACKAGES_SYNC_CONFIG_STATEMENT
 {
     R"(
@@ -370,7 +402,7 @@ constexpr auto PACKAGES_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE item_id BETWEEN '?' and '?' ORDER BY item_id",
-                "column_list":["*"],
+                "column_list":["item_id, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -476,7 +508,7 @@ constexpr auto PROCESSES_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE pid BETWEEN '?' and '?' ORDER BY pid",
-                "column_list":["*"],
+                "column_list":["pid, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -486,7 +518,7 @@ constexpr auto PROCESSES_SYNC_CONFIG_STATEMENT
 
 constexpr auto PROCESSES_SQL_STATEMENT
 {
-    R"(CREATE TABLE dbsync_processes (
+    R"(CREATE TEMP TABLE dbsync_processes (
     pid TEXT,
     name TEXT,
     state TEXT,
@@ -583,7 +615,7 @@ constexpr auto PORTS_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE item_id BETWEEN '?' and '?' ORDER BY item_id",
-                "column_list":["*"],
+                "column_list":["item_id, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -593,7 +625,7 @@ constexpr auto PORTS_SYNC_CONFIG_STATEMENT
 
 constexpr auto PORTS_SQL_STATEMENT
 {
-    R"(CREATE TABLE dbsync_ports (
+    R"(CREATE TEMP TABLE dbsync_ports (
        protocol TEXT,
        local_ip TEXT,
        local_port BIGINT,
@@ -675,7 +707,7 @@ constexpr auto NETIFACE_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE item_id BETWEEN '?' and '?' ORDER BY item_id",
-                "column_list":["*"],
+                "column_list":["item_id, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -770,7 +802,7 @@ constexpr auto NETPROTO_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE item_id BETWEEN '?' and '?' ORDER BY item_id",
-                "column_list":["*"],
+                "column_list":["item_id, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -856,7 +888,7 @@ constexpr auto NETADDRESS_SYNC_CONFIG_STATEMENT
         },
         "range_checksum_query_json": {
                 "row_filter":"WHERE item_id BETWEEN '?' and '?' ORDER BY item_id",
-                "column_list":["*"],
+                "column_list":["item_id, checksum"],
                 "distinct_opt":false,
                 "order_by_opt":""
         }
@@ -891,7 +923,9 @@ constexpr auto HW_TABLE           { "dbsync_hwinfo"           };
 
 static std::string getItemId(const nlohmann::json& item, const std::vector<std::string>& idFields)
 {
-    Utils::HashData hash;
+    // One digest context per thread, restarted for every item.
+    thread_local Utils::HashData hash;
+    hash.reset();
 
     for (const auto& field : idFields)
     {
@@ -916,11 +950,29 @@ static std::string getItemId(const nlohmann::json& item, const std::vector<std::
 static std::string getItemChecksum(const nlohmann::json& item)
 {
     const auto content{item.dump()};
-    Utils::HashData hash;
+    thread_local Utils::HashData hash;
+    hash.reset();
     hash.update(content.c_str(), content.size());
     return Utils::asciiToHex(hash.hash());
 }
 
+static std::string getPackagesDatabaseFingerprint()
+{
+    std::string fingerprint;
+
+    for (const auto& path : PACKAGES_DATABASE_PATHS)
+    {
+        struct stat info {};
+
+        if (0 == stat(path.c_str(), &info))
+        {
+            fingerprint += path + ":" + std::to_string(info.st_mtime) + ":" + std::to_string(info.st_size) + ";";
+        }
+    }
+
+    return fingerprint;
+}
+
 static void removeKeysWithEmptyValue(nlohmann::json& input)
 {
     for (auto& data : input)
@@ -1197,8 +1249,16 @@ void Syscollector::init(const std::shared_ptr<ISysInfo>& spInfo,
 
     std::unique_lock<std::mutex> lock{m_mutex};
     m_stopping = false;
-    m_spDBSync = std::make_unique<DBSync>(HostType::AGENT, DbEngineType::SQLITE3, dbPath, getCreateStatement());
-    m_spRsync = std::make_unique<RemoteSync>();
+    packagesScanState = PackagesScanState{};
+    // One read connection per rsync thread, so the integrity selects don't wait for the scans.
+    m_spDBSync = std::make_unique<DBSync>(HostType::AGENT,
+                                          DbEngineType::SQLITE3,
+                                          dbPath,
+                                          getCreateStatement(),
+                                          DbManagement::VOLATILE,
+                                          std::vector<std::string> {},
+                                          std::thread::hardware_concurrency());
+    m_spRsync = std::make_unique<RemoteSync>(std::thread::hardware_concurrency());
     m_spNormalizer = std::make_unique<SysNormalizer>(normalizerConfigPath, normalizerType);
     registerWithRsync();
     syncLoop(lock);
@@ -1416,6 +1476,16 @@ void Syscollector::scanPackages()
 {
     if (m_packages)
     {
+        auto& state {packagesScanState};
+        const auto fingerprint {getPackagesDatabaseFingerprint()};
+
+        if (!fingerprint.empty() && fingerprint == state.lastFingerprint && state.skippedScans < PACKAGES_MAX_SKIPPED_SCANS)
+        {
+            ++state.skippedScans;
+            m_logFunction(LOG_DEBUG_VERBOSE, "Packages databases unchanged, skipping packages scan");
+            return;
+        }
+
         m_logFunction(LOG_DEBUG_VERBOSE, "Starting packages scan");
         const auto callback
         {
@@ -1451,6 +1521,8 @@ void Syscollector::scanPackages()
         });
         txn.getDeletedRows(callback);
 
+        state.lastFingerprint = fingerprint;
+        state.skippedScans = 0;
         m_logFunction(LOG_DEBUG_VERBOSE, "Ending packages scan");
     }
 }
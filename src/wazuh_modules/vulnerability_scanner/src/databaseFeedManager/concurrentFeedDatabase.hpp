@@ -0,0 +1,128 @@
+/*
+ * Wazuh Vulnerability scanner - Database Feed Manager
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CONCURRENT_FEED_DATABASE_HPP
+#define _CONCURRENT_FEED_DATABASE_HPP
+
+#include "rocksDBWrapper.hpp"
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief ConcurrentFeedDatabase class.
+ *
+ * @details Feed database shared by the threads that apply the resources of an update in parallel. RocksDB reads and
+ * writes are thread-safe, but the wrapper keeps its column families in a list that grows when a column is created, so
+ * the creations exclude every other access. A column that another thread created in the meantime is not created
+ * again, so the check-then-create sequences of the update steps are safe.
+ */
+class ConcurrentFeedDatabase final : public Utils::IRocksDBWrapper
+{
+private:
+    Utils::IRocksDBWrapper& m_feedDatabase;
+    mutable std::shared_mutex m_columnsMutex; ///< Exclusive for the column creations, shared for the rest.
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param feedDatabase Feed database.
+     */
+    explicit ConcurrentFeedDatabase(Utils::IRocksDBWrapper& feedDatabase)
+        : m_feedDatabase(feedDatabase)
+    {
+    }
+
+    void put(const std::string& key, const rocksdb::Slice& value, const std::string& columnName) override
+    {
+        std::shared_lock lock(m_columnsMutex);
+        m_feedDatabase.put(key, value, columnName);
+    }
+
+    void put(const std::string& key, const rocksdb::Slice& value) override
+    {
+        std::shared_lock lock(m_columnsMutex);
+        m_feedDatabase.put(key, value);
+    }
+
+    void delete_(const std::string& key, const std::string& columnName) override // NOLINT
+    {
+        std::shared_lock lock(m_columnsMutex);
+        m_feedDatabase.delete_(key, columnName);
+    }
+
+    void delete_(const std::string& key) override // NOLINT
+    {
+        std::shared_lock lock(m_columnsMutex);
+        m_feedDatabase.delete_(key);
+    }
+
+    void commit() override
+    {
+        std::shared_lock lock(m_columnsMutex);
+        m_feedDatabase.commit();
+    }
+
+    bool get(const std::string& key, rocksdb::PinnableSlice& value, const std::string& columnName) override
+    {
+        std::shared_lock lock(m_columnsMutex);
+        return m_feedDatabase.get(key, value, columnName);
+    }
+
+    bool get(const std::string& key, rocksdb::PinnableSlice& value) override
+    {
+        std::shared_lock lock(m_columnsMutex);
+        return m_feedDatabase.get(key, value);
+    }
+
+    void createColumn(const std::string& columnName) override
+    {
+        std::unique_lock lock(m_columnsMutex);
+        if (!m_feedDatabase.columnExists(columnName))
+        {
+            m_feedDatabase.createColumn(columnName);
+        }
+    }
+
+    bool columnExists(const std::string& columnName) const override
+    {
+        std::shared_lock lock(m_columnsMutex);
+        return m_feedDatabase.columnExists(columnName);
+    }
+
+    void deleteAll() override
+    {
+        std::unique_lock lock(m_columnsMutex);
+        m_feedDatabase.deleteAll();
+    }
+
+    void flush() override
+    {
+        std::shared_lock lock(m_columnsMutex);
+        m_feedDatabase.flush();
+    }
+
+    std::vector<std::string> getAllColumns() override
+    {
+        std::shared_lock lock(m_columnsMutex);
+        return m_feedDatabase.getAllColumns();
+    }
+
+    Utils::RocksDBIterator seek(std::string_view key, const std::string& columnName = "") override // NOLINT
+    {
+        std::shared_lock lock(m_columnsMutex);
+        return m_feedDatabase.seek(key, columnName);
+    }
+};
+
+#endif // _CONCURRENT_FEED_DATABASE_HPP
@@ -17,6 +17,7 @@
 #include "cacheLRU.hpp"
 #include "contentManager.hpp"
 #include "contentRegister.hpp"
+#include "concurrentFeedDatabase.hpp"
 #include "databaseFeedManagerException.hpp"
 #include "eventDecoder.hpp"
 #include "feedIndexer.hpp"
@@ -25,6 +26,7 @@
 #include "jsonArrayParser.hpp"
 #include "loggerHelper.h"
 #include "observer.hpp"
+#include "regexPrefilter.hpp"
 #include "rocksDBWrapper.hpp"
 #include "routerSubscriber.hpp"
 #include "storeModel.hpp"
@@ -33,15 +35,22 @@
 #include "vulnerabilityRemediations_generated.h"
 #include "vulnerabilityScanner.hpp"
 #include <external/nlohmann/json.hpp>
+#include <filesystem>
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <regex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 using namespace NSVulnerabilityScanner;
 constexpr auto DATABASE_PATH {"queue/vd/feed"};
+constexpr auto NEXT_DATABASE_PATH {"queue/vd/feed.next"};
 constexpr auto OFFSET_TRANSACTION_SIZE {1000};
+constexpr auto OFFSET_UPDATE_THREADS {4};
 constexpr auto EMPTY_KEY {""};
 
 /**
@@ -94,16 +103,30 @@ struct Translation final
     std::optional<std::regex> productRegex; ///< Regular expression for product identification.
     std::optional<std::regex> vendorRegex;  ///< Regular expression for vendor identification.
     std::optional<std::regex> versionRegex; ///< Regular expression for version identification.
+    RegexPrefilter productFilter;           ///< Literal of the product regex, checked before running it.
+    RegexPrefilter vendorFilter;            ///< Literal of the vendor regex, checked before running it.
     std::vector<PackageData> translation;   ///< Vector of translated data.
     std::vector<std::string> target;        ///< Vector of valid targets.
 };
 
+/**
+ * @brief Translations of each target platform, in the order of the Level 2 cache.
+ * @details Key: Target platform, Value: Translations of the Level 2 cache that apply to it.
+ */
+using TranslationTargetIndex = std::unordered_map<std::string, std::vector<const Translation*>>;
+
 /**
  * @brief Translations cache.
  * @details Key: Translation ID, Value: Translation information.
  */
 using TranslationLRUCache = LRUCache<std::string, Translation>;
 
+/**
+ * @brief Vulnerability descriptions cache.
+ * @details Key: CVE ID, Value: Verified VulnerabilityDescription FlatBuffers data.
+ */
+using DescriptionLRUCache = LRUCache<std::string, std::shared_ptr<const std::string>>;
+
 /**
  * @brief DatabaseFeedManager class.
  *
@@ -127,10 +150,16 @@ public:
      * @param message Message received by the router.
      * @param topicName Topic name.
      * @param orchestration Chain of actions to execute for each valid resource extracted from the message.
+     * @param changes Changes of the update, a full feed replaces all the data so it requires a full scan.
+     *
+     * @details The offsets updates are applied in place while the scans wait. A full feed is loaded into a side
+     * database while the scans keep reading the current one, and replaces it once it is complete. In both cases the
+     * database is compacted afterwards, so the lookups read one file per level instead of many overlapping ones.
      */
     void processMessage(const std::vector<char>& message,
                         const std::string& topicName,
-                        const std::function<void(const nlohmann::json&, Utils::IRocksDBWrapper*)>& orchestration)
+                        const std::function<void(const nlohmann::json&, Utils::IRocksDBWrapper*)>& orchestration,
+                        FeedUpdateChanges* changes = nullptr)
     {
         auto parsedMessage = nlohmann::json::parse(message, nullptr, false);
 
@@ -139,35 +168,61 @@ public:
         {
             throw std::runtime_error("Invalid message");
         }
-        // Lock the mutex to protect the access to the internal databases.
-        std::scoped_lock<std::shared_mutex> lock(m_mutex);
         if (parsedMessage.at("type") == "offsets")
         {
+            // Lock the mutex to protect the access to the internal databases.
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
             auto jsonPointer {"/data"_json_pointer};
+            ConcurrentFeedDatabase feedDatabase(*m_feedDatabase);
+            std::vector<nlohmann::json> batch;
+            batch.reserve(OFFSET_TRANSACTION_SIZE);
+
             for (const auto& path : parsedMessage.at("paths"))
             {
                 auto currentOffset = 0LL;
                 logDebug2(WM_VULNSCAN_LOGTAG, "Processing file: %s", path.get_ref<const std::string&>().c_str());
 
-                // Parse the file and execute the chain/orchestration for each valid resource.
-                // The lambda function returns false if the module is stopped.
+                auto applyBatch = [&]()
+                {
+                    if (!batch.empty())
+                    {
+                        applyOffsets(batch, orchestration, feedDatabase);
+
+                        // Extract the offset from the last element.
+                        currentOffset = batch.back().at("offset");
+                        batch.clear();
+                    }
+                };
+
+                // Parse the file and execute the chain/orchestration for each batch of valid resources.
+                // The lambda function returns false if the module is stopped, the batch read so far is not applied.
                 // This uses the json sax api, so it is faster than the json tree api and it consumes less memory.
                 // LCOV_EXCL_START
                 JsonArray::parse(
                     path,
                     [&](nlohmann::json&& item, const size_t)
                     {
-                        orchestration(item, m_feedDatabase.get());
-
-                        // Extract the offset from the last element.
-                        currentOffset = item.at("offset");
+                        if (m_shouldStop.load())
+                        {
+                            return false;
+                        }
 
-                        // Commit the transaction for every 200 elements.
-                        return !m_shouldStop.load();
+                        batch.push_back(std::move(item));
+                        if (batch.size() == OFFSET_TRANSACTION_SIZE)
+                        {
+                            applyBatch();
+                        }
+                        return true;
                     },
                     jsonPointer);
                 // LCOV_EXCL_STOP
 
+                if (!m_shouldStop.load())
+                {
+                    applyBatch();
+                }
+                batch.clear();
+
                 // Update the offset in the database after processing the file.
                 // If the module is stopped, we update the offset in the last processed element.
                 // So that the next time the module is started, it will start from the last processed element.
@@ -178,6 +233,10 @@ public:
                     throw DatabaseFeedManagerException("Module stopped.");
                 }
             }
+            lock.unlock();
+
+            // The compaction runs alongside the scans, the database is only modified by the updates.
+            m_feedDatabase->compactDatabase();
         }
         else if (parsedMessage.at("type") == "raw")
         {
@@ -187,8 +246,13 @@ public:
             {
                 throw std::runtime_error("Invalid message");
             }
-            // Delete all the data in the database, because the raw message contains all and latest data.
-            m_feedDatabase->deleteAll();
+            // The raw message contains all and latest data, so it is loaded into an empty side database.
+            std::filesystem::remove_all(NEXT_DATABASE_PATH);
+            auto nextFeedDatabase = std::make_unique<TRocksDBWrapper>(NEXT_DATABASE_PATH, false);
+            if (changes)
+            {
+                changes->fullScanRequired = true;
+            }
 
             for (const auto& path : parsedMessage.at("paths"))
             {
@@ -224,11 +288,22 @@ public:
                     parsedLine["resource"] = parsedLine["name"];
                     parsedLine["type"] = "create";
 
-                    orchestration(parsedLine, m_feedDatabase.get());
+                    orchestration(parsedLine, nextFeedDatabase.get());
                 }
             }
 
-            m_feedDatabase->flush();
+            nextFeedDatabase->flush();
+            nextFeedDatabase->compactDatabase();
+            nextFeedDatabase.reset();
+
+            // Publish the new database in place of the current one.
+            {
+                std::scoped_lock<std::shared_mutex> lock(m_mutex);
+                m_feedDatabase.reset();
+                std::filesystem::remove_all(DATABASE_PATH);
+                std::filesystem::rename(NEXT_DATABASE_PATH, DATABASE_PATH);
+                m_feedDatabase = std::make_unique<TRocksDBWrapper>(DATABASE_PATH, false);
+            }
 
             // Update the offset.
             contentManagerUpdateOffset(topicName, parsedMessage.at("offset"));
@@ -255,7 +330,7 @@ public:
      * @param isLocalSubscriber Configures the router subscription lambda execution as local or remote.
      * @param reloadGlobalMapsStartup If true, the vendor and os cpe maps will be reloaded at startup.
      * @param initContentUpdater If true, the content updater will be initialized.
-     * @param postUpdateCallback Callback to be executed after the update process.
+     * @param postUpdateCallback Callback to be executed after the update process, with the changes of the update.
      */
     // LCOV_EXCL_START
     explicit TDatabaseFeedManager(
@@ -265,8 +340,8 @@ public:
         const bool isLocalSubscriber = true,
         const bool reloadGlobalMapsStartup = true,
         const bool initContentUpdater = true,
-        const std::function<void()>& postUpdateCallback =
-            []() { // Not used
+        const std::function<void(const FeedUpdateChanges&)>& postUpdateCallback =
+            [](const FeedUpdateChanges&) { // Not used
             })
         : Observer("database_feed_manager")
         , m_indexerConnector(std::move(indexerConnector))
@@ -315,25 +390,27 @@ public:
                 eventDecoder->setLast(std::make_shared<StoreModel>());
                 eventDecoder->setLast(std::make_shared<FeedIndexer<TIndexerConnector>>(m_indexerConnector));
 
+                FeedUpdateChanges changes;
                 auto orchestrationLambda = [&](const nlohmann::json& resource, Utils::IRocksDBWrapper* feedDatabaseArg)
                 {
                     auto eventContext =
                         std::make_shared<EventContext>(EventContext {.message = message,
                                                                      .resource = resource,
                                                                      .feedDatabase = feedDatabaseArg,
-                                                                     .resourceType = ResourceType::UNKNOWN});
+                                                                     .resourceType = ResourceType::UNKNOWN,
+                                                                     .changes = &changes});
                     eventDecoder->handleRequest(std::move(eventContext));
                 };
                 try
                 {
                     logInfo(WM_VULNSCAN_LOGTAG, "Initiating update feed process.");
-                    processMessage(message, topicName, orchestrationLambda);
+                    processMessage(message, topicName, orchestrationLambda, &changes);
 
                     // Verify vendor-map and oscpe-map values and update the maps in memory
                     reloadGlobalMaps();
 
                     // Dispatch the post update Callback
-                    postUpdateCallback();
+                    postUpdateCallback(changes);
                     logInfo(WM_VULNSCAN_LOGTAG, "Feed update process completed.");
                 }
                 catch (const DatabaseFeedManagerException& e)
@@ -364,6 +441,16 @@ public:
         }
     }
 
+    /**
+     * @brief Gets the generation of the feed, which changes each time a feed update is loaded.
+     *
+     * @return uint64_t Feed generation.
+     */
+    uint64_t feedGeneration() const
+    {
+        return m_feedGeneration.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Retrieves vulnerability remediation information from the database, for a given CVE ID.
      *
@@ -439,6 +526,7 @@ public:
 
         // Clear the translation filter before filling any cache
         m_translationFilter->clear();
+        m_translationsByTarget.clear();
 
         // Iterate over translations in the feed database
         for (const auto& [key, value] : m_feedDatabase->begin(TRANSLATIONS_COLUMN))
@@ -459,16 +547,26 @@ public:
             // Parse translation data
             auto queryData = GetTranslationEntry(reinterpret_cast<const uint8_t*>(value.data()));
 
-            // Prepare regular expressions for product, vendor and version matching
+            // Prepare regular expressions for product, vendor and version matching, they are compiled once per
+            // feed update
             auto createRegex = [](const auto regex) -> std::optional<std::regex>
             {
-                return regex && !regex->str().empty() ? std::optional<std::regex>(regex->str()) : std::nullopt;
+                return regex && !regex->str().empty()
+                           ? std::optional<std::regex>(
+                                 std::in_place, regex->str(), std::regex::ECMAScript | std::regex::optimize)
+                           : std::nullopt;
+            };
+            auto createFilter = [](const auto regex)
+            {
+                return regex ? RegexPrefilter::fromPattern(regex->str()) : RegexPrefilter {};
             };
 
             // Initialize Translation object to store translation data
             Translation translationQuery = {.productRegex = createRegex(queryData->source()->product()),
                                             .vendorRegex = createRegex(queryData->source()->vendor()),
-                                            .versionRegex = createRegex(queryData->source()->version())};
+                                            .versionRegex = createRegex(queryData->source()->version()),
+                                            .productFilter = createFilter(queryData->source()->product()),
+                                            .vendorFilter = createFilter(queryData->source()->vendor())};
 
             // Load target platforms into the Translation object
             for (const auto& target : *queryData->target())
@@ -488,6 +586,21 @@ public:
             // Insert translation into cache
             m_translationL2Cache->insertKey(key, translationQuery);
         }
+
+        // Index the cached translations by target, keeping the order of the cache
+        m_translationL2Cache->forEach(
+            [this]([[maybe_unused]] const auto& key, const auto& translation)
+            {
+                for (const auto& target : translation.target)
+                {
+                    auto& translations = m_translationsByTarget[target];
+                    if (translations.empty() || translations.back() != &translation)
+                    {
+                        translations.push_back(&translation);
+                    }
+                }
+                return true;
+            });
     }
 
     /**
@@ -506,52 +619,54 @@ public:
         // Vector to store the resulting translations
         std::vector<PackageData> translationResult;
 
-        // Iterate over the Level 2 cache data
-        m_translationL2Cache->forEach(
-            [&]([[maybe_unused]] const auto& key, const auto& cacheData)
+        // Only the translations of the platform are checked, in the order of the Level 2 cache
+        const auto platformTranslations = m_translationsByTarget.find(osPlatform);
+        if (platformTranslations == m_translationsByTarget.end())
+        {
+            return translationResult;
+        }
+
+        for (const auto* cacheData : platformTranslations->second)
+        {
+            /* Check conditions, the literals of the regexes discard most of the translations before running them */
+            // - The package name matches the product regex if present
+            if (cacheData->productRegex.has_value() &&
+                (!cacheData->productFilter.mayMatch(package.name) ||
+                 !std::regex_search(package.name, cacheData->productRegex.value())))
             {
-                /* Check conditions, return true to continue the loop, false to break it */
-                // - The target platform matches the provided OS platform
-                if (std::find(cacheData.target.begin(), cacheData.target.end(), osPlatform) == cacheData.target.end())
-                {
-                    return true;
-                }
-                // - The package name matches the product regex if present
-                if (cacheData.productRegex.has_value() &&
-                    !std::regex_search(package.name, cacheData.productRegex.value()))
-                {
-                    return true;
-                }
-                // - The vendor matches the vendor regex if present
-                if (cacheData.vendorRegex.has_value() &&
-                    !std::regex_search(package.vendor, cacheData.vendorRegex.value()))
+                continue;
+            }
+            // - The vendor matches the vendor regex if present
+            if (cacheData->vendorRegex.has_value() &&
+                (!cacheData->vendorFilter.mayMatch(package.vendor) ||
+                 !std::regex_search(package.vendor, cacheData->vendorRegex.value())))
+            {
+                continue;
+            }
+
+            // Append the matching translation to the result vector
+            for (const auto& translatedPackage : cacheData->translation)
+            {
+                PackageData translatedResult {.name = translatedPackage.name, .vendor = translatedPackage.vendor};
+                // Search for version regex or use translated version
+                std::smatch stringFound;
+                if (cacheData->versionRegex.has_value() &&
+                    std::regex_search(package.name, stringFound, cacheData->versionRegex.value()) &&
+                    stringFound.size() > 0)
                 {
-                    return true;
+                    // We only consider the first capture group
+                    translatedResult.version = stringFound.str(1);
                 }
-
-                // Append the matching translation to the result vector
-                for (const auto& translatedPackage : cacheData.translation)
+                else
                 {
-                    PackageData translatedResult {.name = translatedPackage.name, .vendor = translatedPackage.vendor};
-                    // Search for version regex or use translated version
-                    std::smatch stringFound;
-                    if (cacheData.versionRegex.has_value() &&
-                        std::regex_search(package.name, stringFound, cacheData.versionRegex.value()) &&
-                        stringFound.size() > 0)
-                    {
-                        // We only consider the first capture group
-                        translatedResult.version = stringFound.str(1);
-                    }
-                    else
-                    {
-                        translatedResult.version = translatedPackage.version;
-                    }
-                    translationResult.push_back(std::move(translatedResult));
+                    translatedResult.version = translatedPackage.version;
                 }
+                translationResult.push_back(std::move(translatedResult));
+            }
 
-                // Break the loop after finding the first matching translation
-                return false;
-            });
+            // Stop after finding the first matching translation
+            break;
+        }
 
         // Return the vector containing the matching translations
         return translationResult;
@@ -605,6 +720,69 @@ public:
         }
     }
 
+    /**
+     * @brief Get the Vulnerabilities Candidates information of several packages at once.
+     *
+     * The candidates of all the packages are read with a single iterator that seeks the package names in key order,
+     * instead of one seek per package. The callback is called in key order, not in the order of the packages, and the
+     * candidates of each key stop at the first vulnerable one, as in getVulnerabilitiesCandidates.
+     *
+     * @param cnaName RocksDB table identifier.
+     * @param packages Packages to look up.
+     * @param callback Store vulnerability data.
+     */
+    void getVulnerabilitiesCandidatesBatch(
+        const std::string& cnaName,
+        const std::vector<PackageData>& packages,
+        const std::function<bool(const std::string& cnaName,
+                                 const PackageData& package,
+                                 const NSVulnerabilityScanner::ScanVulnerabilityCandidate&)>& callback)
+    {
+        if (cnaName.empty())
+        {
+            throw std::runtime_error("Invalid package/cna name.");
+        }
+
+        std::vector<std::string> prefixes;
+        prefixes.reserve(packages.size());
+        for (const auto& package : packages)
+        {
+            if (package.name.empty())
+            {
+                throw std::runtime_error("Invalid package/cna name.");
+            }
+            prefixes.emplace_back(package.name + "_CVE");
+        }
+
+        m_feedDatabase->seekPrefixes(
+            prefixes,
+            [&](size_t index, const std::string& key, const rocksdb::Slice& value)
+            {
+                if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+                    !NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer(verifier))
+                {
+                    throw std::runtime_error("Error getting ScanVulnerabilityCandidateArray object from rocksdb. "
+                                             "FlatBuffers verifier failed");
+                }
+
+                auto candidatesArray =
+                    GetScanVulnerabilityCandidateArray(reinterpret_cast<const uint8_t*>(value.data()));
+
+                if (candidatesArray)
+                {
+                    for (const auto& candidate : *candidatesArray->candidates())
+                    {
+                        if (callback(cnaName, packages[index], *candidate))
+                        {
+                            // If the candidate is vulnerable, we stop looking for.
+                            break;
+                        }
+                    }
+                }
+            },
+            cnaName);
+    }
+
     /**
      * @brief Checks and translates package information.
      *
@@ -642,6 +820,9 @@ public:
             }
         };
 
+        // The caches are shared by the threads of a re-scan, the Level 2 search runs unlocked
+        std::unique_lock translationCacheLock(m_translationCacheMutex);
+
         // Check first the filter
         if (m_translationFilter->count(cacheKey) > 0)
         {
@@ -660,13 +841,15 @@ public:
                       package.name.c_str(),
                       osPlatform.c_str());
 
-            const auto& L1Translations = m_translationL1Cache->getValue(cacheKey).value();
+            const auto L1Translations = m_translationL1Cache->getValue(cacheKey).value();
             translatePackage(L1Translations);
             return vulnerabilityTranslations;
         }
 
         // Check Level 2 cache
+        translationCacheLock.unlock();
         const auto L2Translations = getTranslationFromL2(package, osPlatform);
+        translationCacheLock.lock();
         if (!L2Translations.empty())
         {
             logDebug2(WM_VULNSCAN_LOGTAG,
@@ -705,7 +888,10 @@ public:
     }
 
     /**
-     * @brief Updates scheduler interval.
+     * @brief Updates scheduler interval and the cache sizes.
+     *
+     * @details The caches keep their most recently used entries. The Level 2 translation cache holds the translations
+     * of the feed, so it's sized when it's filled with the next feed update.
      *
      * @param data Data containing the interval.
      */
@@ -715,23 +901,71 @@ public:
         {
             m_contentRegistration->changeSchedulerInterval(data.at("updater").at("interval").get<size_t>());
         }
+
+        if (const auto size = data.at("translationLRUSize").get<uint32_t>(); size > 0)
+        {
+            std::unique_lock translationCacheLock(m_translationCacheMutex);
+            m_translationL1Cache->resize(size);
+        }
+
+        const auto descriptionSize = data.at("descriptionLRUSize").get<uint32_t>();
+        std::scoped_lock descriptionLock(m_descriptionCacheMutex);
+        if (descriptionSize == 0)
+        {
+            m_descriptionCache.reset();
+        }
+        else if (m_descriptionCache)
+        {
+            m_descriptionCache->resize(descriptionSize);
+        }
+        else
+        {
+            m_descriptionCache = std::make_unique<DescriptionLRUCache>(descriptionSize);
+        }
     }
     // LCOV_EXCL_STOP
 
     /**
      * @brief Gets descriptive information for a cveid.
      *
+     * @details The descriptions of the most used CVEs are kept in memory, already verified, until the next feed
+     * update. On a cache hit the result container is pinned to the cached data, so nothing is copied.
+     *
      * @param cveId cveid to search.
      * @param resultContainer container struct to store the result.
      */
     void getVulnerabiltyDescriptiveInformation(const std::string_view cveId,
                                                FlatbufferDataPair<VulnerabilityDescription>& resultContainer)
     {
-        if (m_feedDatabase->get(std::string(cveId), resultContainer.slice, DESCRIPTIONS_COLUMN) == false)
+        const std::string key(cveId);
+
+        // The cache can be enabled, disabled or resized by a policy update, so it's only checked under its lock.
+        bool descriptionCacheEnabled {false};
+        {
+            std::shared_ptr<const std::string> cachedDescription;
+            {
+                std::scoped_lock lock(m_descriptionCacheMutex);
+                if (m_descriptionCache)
+                {
+                    descriptionCacheEnabled = true;
+                    if (auto value = m_descriptionCache->getValue(key); value)
+                    {
+                        cachedDescription = std::move(*value);
+                    }
+                }
+            }
+
+            if (cachedDescription)
+            {
+                pinDescription(std::move(cachedDescription), resultContainer);
+                return;
+            }
+        }
+
+        if (m_feedDatabase->get(key, resultContainer.slice, DESCRIPTIONS_COLUMN) == false)
         {
             throw std::runtime_error(
-                "Error getting VulnerabilityDescription object from rocksdb. Object not found for cveId: " +
-                std::string(cveId));
+                "Error getting VulnerabilityDescription object from rocksdb. Object not found for cveId: " + key);
         }
 
         if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(resultContainer.slice.data()),
@@ -742,6 +976,18 @@ public:
                 "Error getting VulnerabilityDescription object from rocksdb. FlatBuffers verifier failed");
         }
 
+        if (descriptionCacheEnabled)
+        {
+            auto description =
+                std::make_shared<const std::string>(resultContainer.slice.data(), resultContainer.slice.size());
+
+            std::scoped_lock lock(m_descriptionCacheMutex);
+            if (m_descriptionCache)
+            {
+                m_descriptionCache->insertKey(key, description);
+            }
+        }
+
         resultContainer.data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
             NSVulnerabilityScanner::GetVulnerabilityDescription(resultContainer.slice.data()));
     }
@@ -863,14 +1109,115 @@ private:
     std::unique_ptr<TranslationLRUCache> m_translationL2Cache =
         std::make_unique<TranslationLRUCache>(TPolicyManager::instance().getTranslationLRUSize());
 
+    TranslationTargetIndex m_translationsByTarget; ///< Translations of the Level 2 cache by target platform.
+
     std::unique_ptr<std::unordered_set<std::string>> m_translationFilter =
         std::make_unique<std::unordered_set<std::string>>();
     std::unique_ptr<LRUCache<std::string, std::vector<PackageData>>> m_translationL1Cache =
         std::make_unique<LRUCache<std::string, std::vector<PackageData>>>(
             TPolicyManager::instance().getTranslationLRUSize());
+    std::mutex m_translationCacheMutex; ///< Protects the translation filter and the Level 1 cache.
+    std::unique_ptr<DescriptionLRUCache> m_descriptionCache =
+        TPolicyManager::instance().getDescriptionLRUSize() > 0
+            ? std::make_unique<DescriptionLRUCache>(TPolicyManager::instance().getDescriptionLRUSize())
+            : nullptr;
+    std::mutex m_descriptionCacheMutex; ///< Protects the descriptions cache.
     std::unique_ptr<TRouterSubscriber> m_contentUpdateSubscription;
+    std::atomic<uint64_t> m_feedGeneration {0}; ///< Number of feeds loaded, the results of a scan are tied to one.
     const std::atomic<bool>& m_shouldStop;
 
+    /**
+     * @brief Pins the result container to a cached description, which is kept alive until the container is reset.
+     *
+     * @param description Cached description.
+     * @param resultContainer container struct to store the result.
+     */
+    static void pinDescription(std::shared_ptr<const std::string> description,
+                               FlatbufferDataPair<VulnerabilityDescription>& resultContainer)
+    {
+        auto owner = std::make_unique<std::shared_ptr<const std::string>>(std::move(description));
+        const rocksdb::Slice slice(**owner);
+
+        resultContainer.slice.Reset();
+        resultContainer.slice.PinSlice(
+            slice,
+            [](void* arg1, [[maybe_unused]] void* arg2)
+            { delete static_cast<std::shared_ptr<const std::string>*>(arg1); },
+            owner.release(),
+            nullptr);
+
+        resultContainer.data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
+            NSVulnerabilityScanner::GetVulnerabilityDescription(resultContainer.slice.data()));
+    }
+
+    /**
+     * @brief Applies a batch of offsets, in parallel for the different resources.
+     *
+     * @details The offsets are split in lanes by their resource, and each lane is applied on its own thread. The
+     * offsets of a resource always fall in the same lane, so they are applied in the order of the feed, and the
+     * batches are applied one after the other.
+     *
+     * @param batch Offsets, in the order of the feed.
+     * @param orchestration Chain of actions to execute for each resource. It must be safe to call it concurrently.
+     * @param feedDatabase Feed database, safe to share between the lanes.
+     * @throws The first exception thrown by the orchestration, once every lane is done.
+     */
+    static void applyOffsets(const std::vector<nlohmann::json>& batch,
+                             const std::function<void(const nlohmann::json&, Utils::IRocksDBWrapper*)>& orchestration,
+                             ConcurrentFeedDatabase& feedDatabase)
+    {
+        const auto laneCount = std::min<size_t>(OFFSET_UPDATE_THREADS, batch.size());
+        std::vector<std::vector<const nlohmann::json*>> lanes(laneCount);
+
+        for (const auto& item : batch)
+        {
+            const auto resource = item.find("resource");
+            const auto lane = resource != item.end() && resource->is_string()
+                                  ? std::hash<std::string> {}(resource->get_ref<const std::string&>()) % laneCount
+                                  : 0;
+            lanes[lane].push_back(&item);
+        }
+
+        std::exception_ptr laneException;
+        std::mutex laneExceptionMutex;
+
+        auto applyLane = [&](const std::vector<const nlohmann::json*>& lane)
+        {
+            try
+            {
+                for (const auto item : lane)
+                {
+                    orchestration(*item, &feedDatabase);
+                }
+            }
+            catch (...)
+            {
+                std::scoped_lock lock(laneExceptionMutex);
+                if (!laneException)
+                {
+                    laneException = std::current_exception();
+                }
+            }
+        };
+
+        // The calling thread applies the first lane.
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < laneCount; ++i)
+        {
+            threads.emplace_back(applyLane, std::cref(lanes[i]));
+        }
+        applyLane(lanes[0]);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        if (laneException)
+        {
+            std::rethrow_exception(laneException);
+        }
+    }
+
     void contentManagerUpdateOffset(const std::string& topicName, const long long currentOffset) const
     {
         nlohmann::json data;
@@ -953,6 +1300,14 @@ private:
 
         // Load translations into the Level 2 cache
         fillL2CacheTranslations();
+
+        // The descriptions may have changed with the feed
+        if (std::scoped_lock descriptionLock(m_descriptionCacheMutex); m_descriptionCache)
+        {
+            m_descriptionCache->clear();
+        }
+
+        m_feedGeneration.fetch_add(1, std::memory_order_release);
     }
 };
 
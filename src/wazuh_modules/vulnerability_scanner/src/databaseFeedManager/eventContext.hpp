@@ -15,6 +15,10 @@
 #include "flatbuffers/detached_buffer.h"
 #include "json.hpp"
 #include "rocksDBWrapper.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 enum class ResourceType
@@ -27,6 +31,27 @@ enum class ResourceType
     CNA_MAPPING
 };
 
+/**
+ * @brief Changes of a feed update, used to re-scan only the affected agents.
+ */
+struct FeedUpdateChanges final
+{
+    std::unordered_set<std::string> candidates; ///< Changed candidates, as "<cna>_<package name>".
+    std::atomic<bool> fullScanRequired {false}; ///< A change, like a translation, that may affect any package.
+    std::mutex mutex;                           ///< Protects the candidates, the resources are applied in parallel.
+
+    /**
+     * @brief Adds a changed candidate.
+     *
+     * @param candidate Candidate, as "<cna>_<package name>".
+     */
+    void addCandidate(std::string candidate)
+    {
+        std::scoped_lock lock(mutex);
+        candidates.emplace(std::move(candidate));
+    }
+};
+
 /**
  * @brief EventContext class.
  *
@@ -38,6 +63,7 @@ struct EventContext final
     flatbuffers::DetachedBuffer cve5Buffer; ///< CVE data.
     Utils::IRocksDBWrapper* feedDatabase;   ///< CVEs database.
     ResourceType resourceType;              ///< Resource type.
+    FeedUpdateChanges* changes {nullptr};   ///< Changes of the feed update, if they are tracked.
 };
 
 #endif // _EVENT_CONTEXT_HPP
@@ -22,6 +22,9 @@
 #include "packageTranslation_schema.h"
 #include "stringHelper.h"
 #include "vulnerabilityScannerDefs.hpp"
+#include <map>
+#include <memory>
+#include <utility>
 
 const static std::map<ResourceType, const char*> SCHEMA = {{ResourceType::CVE, cve5_SCHEMA},
                                                            {ResourceType::TRANSLATION, packageTranslation_SCHEMA},
@@ -42,6 +45,57 @@ const static std::map<ResourceType, const char*> COLUMNS = {{ResourceType::CVE,
 class EventDecoder final : public AbstractHandler<std::shared_ptr<EventContext>>
 {
 private:
+    /**
+     * @brief Parsers of each schema, and whether they output strict JSON, for the calling thread.
+     */
+    using SchemaParsers = std::map<std::pair<const char*, bool>, std::unique_ptr<flatbuffers::Parser>>;
+
+    static SchemaParsers& schemaParsers()
+    {
+        thread_local SchemaParsers parsers;
+        return parsers;
+    }
+
+    /**
+     * @brief Gets a parser of the schema with an empty builder. Parsing the schema is much more expensive than
+     * parsing a resource, so it is only done once per thread and the parser is reused for every resource.
+     *
+     * @param schema FlatBuffers schema.
+     * @param strictJson Whether the parser outputs strict JSON, with the default scalars.
+     * @return flatbuffers::Parser& Parser of the schema.
+     */
+    static flatbuffers::Parser& schemaParser(const char* schema, const bool strictJson)
+    {
+        auto& parser = schemaParsers()[{schema, strictJson}];
+        if (!parser)
+        {
+            flatbuffers::IDLOptions options;
+            options.output_default_scalars_in_json = strictJson;
+            options.strict_json = strictJson;
+
+            auto schemaParser = std::make_unique<flatbuffers::Parser>(options);
+            if (!schemaParser->Parse(schema))
+            {
+                throw std::runtime_error("Unable to parse schema: " + schemaParser->error_);
+            }
+            parser = std::move(schemaParser);
+        }
+
+        parser->builder_.Clear();
+        return *parser;
+    }
+
+    /**
+     * @brief Discards the parser of the schema, its state isn't reliable after a parsing error.
+     *
+     * @param schema FlatBuffers schema.
+     * @param strictJson Whether the parser outputs strict JSON, with the default scalars.
+     */
+    static void discardSchemaParser(const char* schema, const bool strictJson)
+    {
+        schemaParsers().erase({schema, strictJson});
+    }
+
     /**
      * @brief Process a CVE5 or Translation message.
      *
@@ -101,11 +155,13 @@ private:
                 else
                 {
                     // Resources in flatbuffer format.
-                    flatbuffers::Parser parser;
+                    auto& parser = schemaParser(schema, false);
 
-                    if (!parser.Parse(schema) || !parser.Parse(data->resource.at("payload").dump().c_str()))
+                    if (!parser.Parse(data->resource.at("payload").dump().c_str()))
                     {
-                        throw std::runtime_error("Unable to parse payload: " + parser.error_);
+                        const auto error = parser.error_;
+                        discardSchemaParser(schema, false);
+                        throw std::runtime_error("Unable to parse payload: " + error);
                     }
 
                     rocksdb::Slice flatbufferResource(reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
@@ -158,11 +214,7 @@ private:
                             }
                             break;
                     }
-                    flatbuffers::IDLOptions options;
-                    options.output_default_scalars_in_json = true;
-                    options.strict_json = true;
-                    flatbuffers::Parser parser(options);
-                    parser.Parse(schema);
+                    auto& parser = schemaParser(schema, true);
 
                     std::string strData;
                     flatbuffers::GenText(parser, reinterpret_cast<const uint8_t*>(slice.data()), &strData);
@@ -171,7 +223,9 @@ private:
                     jsonData.patch_inplace(data->resource.at("operations"));
                     if (!parser.Parse(jsonData.dump().c_str()))
                     {
-                        throw std::runtime_error("Unable to parse patched data: " + parser.error_);
+                        const auto error = parser.error_;
+                        discardSchemaParser(schema, true);
+                        throw std::runtime_error("Unable to parse patched data: " + error);
                     }
 
                     rocksdb::Slice flatbufferResource(reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
@@ -221,6 +275,12 @@ public:
         {
             return AbstractHandler<std::shared_ptr<EventContext>>::handleRequest(std::move(data));
         }
+
+        // Translations and global maps change how any package is scanned.
+        if (data->changes && data->resourceType != ResourceType::UNKNOWN)
+        {
+            data->changes->fullScanRequired = true;
+        }
         return nullptr;
     }
 };
@@ -0,0 +1,112 @@
+/*
+ * Wazuh Vulnerability scanner - Database Feed Manager
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _REGEX_PREFILTER_HPP
+#define _REGEX_PREFILTER_HPP
+
+#include <cctype>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Literal that any text matched by a regular expression (ECMAScript, case sensitive) must contain.
+ *
+ * @details The literal is the run of plain characters at the start of the pattern, after the optional '^' anchor,
+ * so the check is a prefix comparison for anchored patterns and a substring search otherwise. It is used to discard
+ * most of the texts before running std::regex_search. Patterns with alternations have no literal.
+ */
+struct RegexPrefilter final
+{
+    std::string literal;   ///< Text every match contains, empty if the pattern has no usable literal.
+    bool anchored {false}; ///< The literal is a prefix of every match.
+
+    /**
+     * @brief Extracts the leading literal of a regular expression.
+     *
+     * @param pattern Regular expression.
+     * @return RegexPrefilter Prefilter of the pattern, it accepts any text if no literal is found.
+     */
+    static RegexPrefilter fromPattern(std::string_view pattern)
+    {
+        RegexPrefilter prefilter;
+
+        // An alternation may skip the literal
+        if (pattern.find('|') != std::string_view::npos)
+        {
+            return prefilter;
+        }
+
+        size_t pos {0};
+        if (!pattern.empty() && pattern.front() == '^')
+        {
+            prefilter.anchored = true;
+            ++pos;
+        }
+
+        constexpr std::string_view META {"^$.*+?()[]{}|"};
+        while (pos < pattern.size())
+        {
+            auto current = pattern[pos];
+            auto next = pos + 1;
+            if (current == '\\')
+            {
+                // Only the escaped punctuation is a literal, the rest are classes, assertions or codes
+                if (next >= pattern.size() || std::isalnum(static_cast<unsigned char>(pattern[next])))
+                {
+                    break;
+                }
+                current = pattern[next++];
+            }
+            else if (META.find(current) != std::string_view::npos)
+            {
+                break;
+            }
+
+            // A quantifier applies to the last character only, which may then be missing or repeated
+            if (next < pattern.size())
+            {
+                const auto quantifier = pattern[next];
+                if (quantifier == '*' || quantifier == '?' || quantifier == '{')
+                {
+                    break;
+                }
+                if (quantifier == '+')
+                {
+                    prefilter.literal.push_back(current);
+                    break;
+                }
+            }
+
+            prefilter.literal.push_back(current);
+            pos = next;
+        }
+
+        return prefilter;
+    }
+
+    /**
+     * @brief Checks whether the text may match the pattern.
+     *
+     * @param text Text to check.
+     * @return true if the text contains the literal, so the pattern must be run on it.
+     * @return false if the pattern can't match the text.
+     */
+    bool mayMatch(std::string_view text) const
+    {
+        if (literal.empty())
+        {
+            return true;
+        }
+        return anchored ? text.substr(0, literal.size()) == literal : text.find(literal) != std::string_view::npos;
+    }
+};
+
+#endif // _REGEX_PREFILTER_HPP
@@ -57,14 +57,14 @@ public:
                     UpdateHotfixes::storeVulnerabilityHotfixes(cve5Entry, data->feedDatabase);
                     UpdateCVERemediations::storeVulnerabilityRemediation(cve5Entry, data->feedDatabase);
                     UpdateCVEDescription::storeVulnerabilityDescription(cve5Entry, data->feedDatabase);
-                    UpdateCVECandidates::storeVulnerabilityCandidate(cve5Entry, data->feedDatabase);
+                    UpdateCVECandidates::storeVulnerabilityCandidate(cve5Entry, data->feedDatabase, data->changes);
                 }
                 else if ("REJECTED" == state)
                 {
                     UpdateHotfixes::removeHotfix(cve5Entry, data->feedDatabase);
                     UpdateCVERemediations::removeRemediation(cve5Entry, data->feedDatabase);
                     UpdateCVEDescription::removeVulnerabilityDescription(cve5Entry, data->feedDatabase);
-                    UpdateCVECandidates::removeVulnerabilityCandidate(cve5Entry, data->feedDatabase);
+                    UpdateCVECandidates::removeVulnerabilityCandidate(cve5Entry, data->feedDatabase, data->changes);
                 }
                 else
                 {
@@ -78,7 +78,7 @@ public:
                     UpdateHotfixes::storeVulnerabilityHotfixes(cve5Entry, data->feedDatabase);
                     UpdateCVERemediations::storeVulnerabilityRemediation(cve5Entry, data->feedDatabase);
                     UpdateCVEDescription::storeVulnerabilityDescription(cve5Entry, data->feedDatabase);
-                    UpdateCVECandidates::storeVulnerabilityCandidate(cve5Entry, data->feedDatabase);
+                    UpdateCVECandidates::storeVulnerabilityCandidate(cve5Entry, data->feedDatabase, data->changes);
                 }
             }
             else
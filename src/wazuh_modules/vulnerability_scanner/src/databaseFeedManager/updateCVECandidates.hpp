@@ -13,6 +13,7 @@
 #define _UPDATE_CVE_CANDIDATES_HPP
 
 #include "cve5_generated.h"
+#include "eventContext.hpp"
 #include "rocksDBWrapper.hpp"
 #include "stringHelper.h"
 #include "vulnerabilityCandidate_generated.h"
@@ -36,8 +37,11 @@ public:
      *
      * @param cve5Flatbuffer CVE5 Flatbuffer.
      * @param feedDatabase rocksDB wrapper instance.
+     * @param changes Changes of the feed update, the stored and removed candidates are added to it.
      */
-    static void storeVulnerabilityCandidate(const cve_v5::Entry* cve5Flatbuffer, Utils::IRocksDBWrapper* feedDatabase)
+    static void storeVulnerabilityCandidate(const cve_v5::Entry* cve5Flatbuffer,
+                                            Utils::IRocksDBWrapper* feedDatabase,
+                                            FeedUpdateChanges* changes = nullptr)
     {
         if (!cve5Flatbuffer || !cve5Flatbuffer->containers())
         {
@@ -64,6 +68,14 @@ public:
             return cvePackageColumnName;
         };
 
+        auto addChange = [changes](const std::string& shortName, const std::string& packageName)
+        {
+            if (changes)
+            {
+                changes->addCandidate(shortName + "_" + packageName);
+            }
+        };
+
         auto candidateLambda = [&](const flatbuffers::Vector<::flatbuffers::Offset<cve_v5::Affected>>* affectedVector,
                                    const std::string& shortName)
         {
@@ -171,11 +183,15 @@ public:
                 {
                     feedDatabase->delete_(packageCve, shortName);
                     feedDatabase->delete_(cvePackage, CVE_PACKAGE_COLUMN_NAME);
+                    addChange(shortName, packageCandidate);
                 }
             }
 
             for (auto& [key, value] : candidatesArraysMap)
             {
+                // Any change of the CVE, even if the candidates are the same, affects the packages
+                addChange(shortName, key);
+
                 const auto finalArray =
                     NSVulnerabilityScanner::CreateScanVulnerabilityCandidateArrayDirect(value.second, &value.first);
                 value.second.Finish(finalArray);
@@ -264,8 +280,11 @@ public:
      *
      * @param cve5Flatbuffer Flatbuffer object containing the CVE information.
      * @param feedDatabase rocksDB wrapper instance.
+     * @param changes Changes of the feed update, the removed candidates are added to it.
      */
-    static void removeVulnerabilityCandidate(const cve_v5::Entry* cve5Flatbuffer, Utils::IRocksDBWrapper* feedDatabase)
+    static void removeVulnerabilityCandidate(const cve_v5::Entry* cve5Flatbuffer,
+                                             Utils::IRocksDBWrapper* feedDatabase,
+                                             FeedUpdateChanges* changes = nullptr)
     {
         if (!cve5Flatbuffer->cveMetadata() || !cve5Flatbuffer->cveMetadata()->cveId())
         {
@@ -300,6 +319,12 @@ public:
                 {
                     feedDatabase->delete_(packageCve.ToString(), cnaName);
                     cvePackagesToDelete.push_back(cvePackage);
+
+                    if (changes)
+                    {
+                        // Remove CVE-XXXX-XXXX_ from the key.
+                        changes->addCandidate(cnaName + "_" + cvePackage.substr(cveId.size()));
+                    }
                 }
 
                 for (const auto& cvePackage : cvePackagesToDelete)
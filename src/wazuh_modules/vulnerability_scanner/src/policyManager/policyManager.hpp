@@ -20,6 +20,7 @@
 #include "vulnerabilityScanner.hpp"
 #include <external/nlohmann/json.hpp>
 #include <functional>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -30,6 +31,8 @@ constexpr auto STATES_VD_INDEX_NAME_PREFIX {"wazuh-states-vulnerabilities"};
 constexpr auto DEFAULT_TRANSLATION_LRU_SIZE {2048};
 constexpr auto DEFAULT_OSDATA_LRU_SIZE {1000};
 constexpr auto DEFAULT_REMEDIATION_LRU_SIZE {2048};
+constexpr auto DEFAULT_DESCRIPTION_LRU_SIZE {4096};
+constexpr auto DEFAULT_RESCAN_THREADS {4};
 const static std::string UPDATER_PATH {"queue/vd_updater"};
 constexpr auto MANAGER_SCAN_DISABLED {1};
 constexpr auto MANAGER_SCAN_ENABLED {0};
@@ -42,7 +45,7 @@ class PolicyManager final : public Singleton<PolicyManager>
 {
 private:
     std::unique_ptr<Subject<nlohmann::json&>> m_subject;
-    nlohmann::json m_configuration;
+    std::shared_ptr<const nlohmann::json> m_configuration = std::make_shared<const nlohmann::json>();
     std::unique_ptr<RouterSubscriber> m_policyChangeSubscription;
 
     /**
@@ -178,11 +181,26 @@ private:
             newPolicy["remediationLRUSize"] = DEFAULT_REMEDIATION_LRU_SIZE;
         }
 
+        if (!newPolicy.contains("descriptionLRUSize"))
+        {
+            newPolicy["descriptionLRUSize"] = DEFAULT_DESCRIPTION_LRU_SIZE;
+        }
+
+        if (!newPolicy.contains("reScanThreads"))
+        {
+            newPolicy["reScanThreads"] = DEFAULT_RESCAN_THREADS;
+        }
+
         if (!newPolicy.contains("managerDisabledScan"))
         {
             newPolicy["managerDisabledScan"] = MANAGER_SCAN_ENABLED;
         }
 
+        if (!newPolicy.contains("clusterPartitionNodes"))
+        {
+            newPolicy["clusterPartitionNodes"] = nlohmann::json::array();
+        }
+
         if (!newPolicy.contains("clusterNodeName"))
         {
             newPolicy["clusterNodeName"] = UNKNOWN_VALUE;
@@ -395,7 +413,20 @@ private:
      */
     void loadConfiguration(const nlohmann::json& configuration)
     {
-        m_configuration = configuration;
+        std::atomic_store(&m_configuration, std::make_shared<const nlohmann::json>(configuration));
+    }
+
+    /**
+     * @brief Gets the current configuration snapshot.
+     *
+     * @details A snapshot is never modified, a new policy replaces it as a whole. The readers that hold it keep a
+     * consistent view of the policy they started with, while the next reads see the new one.
+     *
+     * @return std::shared_ptr<const nlohmann::json> Configuration snapshot.
+     */
+    std::shared_ptr<const nlohmann::json> configuration() const
+    {
+        return std::atomic_load(&m_configuration);
     }
 
 public:
@@ -421,8 +452,7 @@ public:
             {
                 try
                 {
-                    validateAndLoadConfiguration(nlohmann::json::parse(message));
-                    call(m_configuration);
+                    reload(nlohmann::json::parse(message));
                 }
                 catch (const std::exception& ex)
                 {
@@ -432,6 +462,23 @@ public:
     }
     // LCOV_EXCL_STOP
 
+    /**
+     * @brief Replaces the policy of the running module and notifies the subscribers.
+     *
+     * @details The running components read the new policy from their next access, the subscribers apply the settings
+     * they keep, like the cache sizes or the feed update interval. An invalid policy is rejected and the current one is
+     * kept.
+     *
+     * @param configuration New configuration.
+     */
+    void reload(const nlohmann::json& configuration)
+    {
+        validateAndLoadConfiguration(configuration);
+
+        auto data = *this->configuration();
+        call(data);
+    }
+
     /**
      * @brief Teardown manager.
      *
@@ -517,7 +564,7 @@ public:
      */
     nlohmann::json getUpdaterConfiguration() const
     {
-        return m_configuration.at("updater");
+        return configuration()->at("updater");
     }
 
     /**
@@ -527,7 +574,7 @@ public:
      */
     nlohmann::json getIndexerConfiguration() const
     {
-        return m_configuration.at("indexer");
+        return configuration()->at("indexer");
     }
 
     /**
@@ -537,7 +584,7 @@ public:
      */
     nlohmann::json getVulnerabilityDetection() const
     {
-        return m_configuration.at("vulnerability-detection");
+        return configuration()->at("vulnerability-detection");
     }
 
     /**
@@ -547,7 +594,7 @@ public:
      */
     bool isVulnerabilityDetectionEnabled() const
     {
-        return Utils::parseStrToBool(m_configuration.at("vulnerability-detection").at("enabled"));
+        return Utils::parseStrToBool(configuration()->at("vulnerability-detection").at("enabled"));
     }
 
     /**
@@ -557,8 +604,8 @@ public:
      */
     bool isIndexerEnabled() const
     {
-        return Utils::parseStrToBool(m_configuration.at("indexer").at("enabled")) &&
-               Utils::parseStrToBool(m_configuration.at("vulnerability-detection").at("index-status"));
+        return Utils::parseStrToBool(configuration()->at("indexer").at("enabled")) &&
+               Utils::parseStrToBool(configuration()->at("vulnerability-detection").at("index-status"));
     }
 
     /**
@@ -568,7 +615,7 @@ public:
      */
     std::string getFeedUrl() const
     {
-        return m_configuration.at("vulnerability-detection").at("offline-url").get<std::string>();
+        return configuration()->at("vulnerability-detection").at("offline-url").get<std::string>();
     }
 
     /**
@@ -579,7 +626,7 @@ public:
     long getFeedUpdateTime() const
     {
         return Utils::parseStrToTime(
-            m_configuration.at("vulnerability-detection").at("feed-update-interval").get<std::string>());
+            configuration()->at("vulnerability-detection").at("feed-update-interval").get<std::string>());
     }
 
     /**
@@ -589,7 +636,7 @@ public:
      */
     std::unordered_set<std::string> getHostList() const
     {
-        return m_configuration.at("indexer").at("hosts").get<std::unordered_set<std::string>>();
+        return configuration()->at("indexer").at("hosts").get<std::unordered_set<std::string>>();
     }
 
     /**
@@ -599,7 +646,7 @@ public:
      */
     std::unordered_set<std::string> getCAList() const
     {
-        return m_configuration.at("indexer")
+        return configuration()->at("indexer")
             .at("ssl")
             .at("certificate_authorities")
             .get<std::unordered_set<std::string>>();
@@ -612,7 +659,7 @@ public:
      */
     std::string getUsername() const
     {
-        return m_configuration.at("indexer").at("username").get<std::string>();
+        return configuration()->at("indexer").at("username").get<std::string>();
     }
 
     /**
@@ -622,7 +669,7 @@ public:
      */
     std::string getPassword() const
     {
-        return m_configuration.at("indexer").at("password").get<std::string>();
+        return configuration()->at("indexer").at("password").get<std::string>();
     }
 
     /**
@@ -632,7 +679,7 @@ public:
      */
     std::string getCertificate() const
     {
-        return m_configuration.at("indexer").at("ssl").at("certificate").get<std::string>();
+        return configuration()->at("indexer").at("ssl").at("certificate").get<std::string>();
     }
 
     /**
@@ -642,7 +689,7 @@ public:
      */
     std::string getKey() const
     {
-        return m_configuration.at("indexer").at("ssl").at("key").get<std::string>();
+        return configuration()->at("indexer").at("ssl").at("key").get<std::string>();
     }
 
     /**
@@ -651,7 +698,7 @@ public:
      */
     std::string getCTIUrl() const
     {
-        return m_configuration.at("updater").at("configData").at("url").get_ref<const std::string&>();
+        return configuration()->at("updater").at("configData").at("url").get_ref<const std::string&>();
     }
 
     /**
@@ -661,7 +708,7 @@ public:
      */
     uint32_t getTranslationLRUSize() const
     {
-        return m_configuration.at("translationLRUSize").get<uint32_t>();
+        return configuration()->at("translationLRUSize").get<uint32_t>();
     }
 
     /**
@@ -671,7 +718,7 @@ public:
      */
     uint32_t getOsdataLRUSize() const
     {
-        return m_configuration.at("osdataLRUSize").get<uint32_t>();
+        return configuration()->at("osdataLRUSize").get<uint32_t>();
     }
 
     /**
@@ -681,7 +728,27 @@ public:
      */
     uint32_t getRemediationLRUSize() const
     {
-        return m_configuration.at("remediationLRUSize").get<uint32_t>();
+        return configuration()->at("remediationLRUSize").get<uint32_t>();
+    }
+
+    /**
+     * @brief Get vulnerability description LRU size.
+     *
+     * @return uint32_t vulnerability description LRU size.
+     */
+    uint32_t getDescriptionLRUSize() const
+    {
+        return configuration()->at("descriptionLRUSize").get<uint32_t>();
+    }
+
+    /**
+     * @brief Get the number of threads that scan the agents of a full re-scan.
+     *
+     * @return uint32_t re-scan threads.
+     */
+    uint32_t getReScanThreads() const
+    {
+        return configuration()->at("reScanThreads").get<uint32_t>();
     }
 
     /**
@@ -694,7 +761,7 @@ public:
      */
     bool getManagerDisabledScan() const
     {
-        return m_configuration.at("managerDisabledScan").get<uint32_t>() == MANAGER_SCAN_DISABLED;
+        return configuration()->at("managerDisabledScan").get<uint32_t>() == MANAGER_SCAN_DISABLED;
     }
 
     /**
@@ -707,7 +774,19 @@ public:
      */
     std::string getClusterNodeName() const
     {
-        return m_configuration.at("clusterNodeName").get_ref<const std::string&>();
+        return configuration()->at("clusterNodeName").get_ref<const std::string&>();
+    }
+
+    /**
+     * @brief Get the cluster nodes that share the full re-scans.
+     *
+     * When the list is not empty, each node scans only the agents that the partition assigns to it.
+     *
+     * @return std::vector<std::string> partition node names, empty if the re-scans are not partitioned.
+     */
+    std::vector<std::string> getClusterPartitionNodes() const
+    {
+        return configuration()->at("clusterPartitionNodes").get<std::vector<std::string>>();
     }
 
     /**
@@ -717,7 +796,7 @@ public:
      */
     bool getClusterStatus() const
     {
-        return m_configuration.at("clusterEnabled").get<bool>();
+        return configuration()->at("clusterEnabled").get<bool>();
     }
 
     /**
@@ -727,7 +806,7 @@ public:
      */
     std::string getClusterName() const
     {
-        return m_configuration.at("clusterName").get_ref<const std::string&>();
+        return configuration()->at("clusterName").get_ref<const std::string&>();
     }
 
     /**
@@ -737,9 +816,10 @@ public:
      */
     uint32_t getAlertsMaxEventsPerSecond() const
     {
-        if (m_configuration.contains("wmMaxEps") && m_configuration.at("wmMaxEps").is_number())
+        if (const auto configuration = this->configuration();
+            configuration->contains("wmMaxEps") && configuration->at("wmMaxEps").is_number())
         {
-            return m_configuration.at("wmMaxEps").get<uint32_t>();
+            return configuration->at("wmMaxEps").get<uint32_t>();
         }
         return 0;
     }
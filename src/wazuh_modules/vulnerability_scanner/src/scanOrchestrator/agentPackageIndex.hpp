@@ -0,0 +1,155 @@
+/*
+ * Wazuh Vulnerability scanner - Scan Orchestrator
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _AGENT_PACKAGE_INDEX_HPP
+#define _AGENT_PACKAGE_INDEX_HPP
+
+#include "rocksDBWrapper.hpp"
+#include "singleton.hpp"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+constexpr auto PACKAGE_INDEX_DB_PATH = "queue/vd/package_index";
+constexpr auto PACKAGE_INDEX_COMPLETE_KEY = "#complete";
+
+/**
+ * @brief AgentPackageIndex class.
+ *
+ * @details Reverse index from the candidates looked up by the scans, as (CNA, package name), to the agents that have
+ * the package installed. Each key is "<cna>_<package name>_<agent id>". Entries are only added, so the agents returned
+ * for a candidate are a superset of the agents that have it; the index is rebuilt by every full re-scan, which clears
+ * it before scanning and marks it as complete afterwards. Until then it can't tell which agents are affected by a feed
+ * update.
+ *
+ * @note The index is disabled, and all the methods are no-ops, until it is initialized.
+ */
+class AgentPackageIndex final : public Singleton<AgentPackageIndex>
+{
+private:
+    std::unique_ptr<Utils::RocksDBWrapper> m_database;
+
+    static std::string candidateKey(std::string_view cnaName, std::string_view packageName)
+    {
+        std::string key;
+        key.reserve(cnaName.size() + packageName.size() + 2);
+        key.append(cnaName);
+        key.append("_");
+        key.append(packageName);
+        key.append("_");
+        return key;
+    }
+
+public:
+    /**
+     * @brief Opens the index database.
+     *
+     * @param path Database path.
+     */
+    void initialize(const std::string& path = PACKAGE_INDEX_DB_PATH)
+    {
+        m_database = std::make_unique<Utils::RocksDBWrapper>(path);
+    }
+
+    /**
+     * @brief Closes the index database.
+     */
+    void teardown()
+    {
+        m_database.reset();
+    }
+
+    /**
+     * @brief Records that the agent has a package whose candidates are looked up with the CNA and name.
+     *
+     * @param cnaName CNA name.
+     * @param packageName Package name used to look up the candidates.
+     * @param agentId Agent ID.
+     */
+    void insert(std::string_view cnaName, std::string_view packageName, std::string_view agentId)
+    {
+        if (!m_database || cnaName.empty() || packageName.empty())
+        {
+            return;
+        }
+
+        auto key = candidateKey(cnaName, packageName);
+        key.append(agentId);
+        m_database->put(key, "");
+    }
+
+    /**
+     * @brief Gets the agents that have any of the candidates.
+     *
+     * @param candidates Candidates, as "<cna>_<package name>".
+     * @return std::unordered_set<std::string> Agent IDs.
+     */
+    std::unordered_set<std::string> agents(const std::unordered_set<std::string>& candidates)
+    {
+        std::unordered_set<std::string> agentIds;
+        if (!m_database)
+        {
+            return agentIds;
+        }
+
+        for (const auto& candidate : candidates)
+        {
+            const auto prefix = candidate + "_";
+            for (const auto& [key, value] : m_database->seek(prefix))
+            {
+                // Agent IDs don't have separators, the rest are keys of a longer package name
+                if (const auto agentId = std::string_view(key).substr(prefix.size());
+                    agentId.find('_') == std::string_view::npos)
+                {
+                    agentIds.emplace(agentId);
+                }
+            }
+        }
+
+        return agentIds;
+    }
+
+    /**
+     * @brief Removes all the entries, the index isn't complete until markComplete() is called.
+     */
+    void clear()
+    {
+        if (m_database)
+        {
+            m_database->deleteAll();
+        }
+    }
+
+    /**
+     * @brief Marks the index as complete, every agent has been scanned since it was cleared.
+     */
+    void markComplete()
+    {
+        if (m_database)
+        {
+            m_database->put(PACKAGE_INDEX_COMPLETE_KEY, "");
+        }
+    }
+
+    /**
+     * @brief Checks whether the index has the packages of every agent.
+     *
+     * @return true if the index is complete.
+     */
+    bool isComplete()
+    {
+        std::string value;
+        return m_database && m_database->get(PACKAGE_INDEX_COMPLETE_KEY, value);
+    }
+};
+
+#endif // _AGENT_PACKAGE_INDEX_HPP
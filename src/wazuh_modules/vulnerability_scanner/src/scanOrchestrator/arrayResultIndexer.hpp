@@ -15,6 +15,8 @@
 #include "chainOfResponsability.hpp"
 #include "indexerConnector.hpp"
 #include "scanContext.hpp"
+#include <string>
+#include <vector>
 
 /**
  * @brief ArrayResultIndexer class.
@@ -51,12 +53,15 @@ public:
     {
         if (m_indexerConnector != nullptr)
         {
+            // The results of the scan are published as a single batch.
+            std::vector<std::string> messages;
+
             auto resultCallback = [&](const nlohmann::json& result, const std::string& key)
             {
                 logDebug2(WM_VULNSCAN_LOGTAG, "Processing and publish key: %s", key.c_str());
                 if (result.contains("operation") && result.contains("id"))
                 {
-                    m_indexerConnector->publish(result.dump());
+                    messages.push_back(result.dump());
                 }
                 else
                 {
@@ -78,6 +83,11 @@ public:
                     resultCallback(element, key);
                 }
             }
+
+            if (!messages.empty())
+            {
+                m_indexerConnector->publish(messages);
+            }
         }
         return AbstractHandler<std::shared_ptr<TScanContext>>::handleRequest(std::move(data));
     }
@@ -19,6 +19,9 @@
 #include "vulnerabilityScanner.hpp"
 #include "wazuhDBQueryBuilder.hpp"
 #include "wdbDataException.hpp"
+#include <iterator>
+#include <string>
+#include <vector>
 
 /**
  * @brief Orchestrates queries over the global Wazuh system
@@ -30,6 +33,55 @@
 template<typename TScanContext = ScanContext, typename TSocketDBWrapper = SocketDBWrapper>
 class TBuildAllAgentListContext final : public AbstractHandler<std::shared_ptr<TScanContext>>
 {
+private:
+    /**
+     * @brief Get the node that scans an agent, by rendezvous hashing.
+     *
+     * Every node computes the same owner from the same node list, and adding or removing a node only moves the
+     * agents of that node.
+     *
+     * @param agentId Agent id.
+     * @param nodes Partition node names.
+     * @return const std::string& Owner node name.
+     */
+    static const std::string& partitionOwner(const std::string& agentId, const std::vector<std::string>& nodes)
+    {
+        // FNV-1a with a final avalanche, stable across processes and builds unlike std::hash.
+        auto hash = [](const std::string& node, const std::string& key)
+        {
+            uint64_t value = 14695981039346656037ULL;
+            auto mix = [&value](const std::string& str)
+            {
+                for (const auto c : str)
+                {
+                    value = (value ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+                }
+            };
+            mix(node);
+            value = (value ^ 0xFF) * 1099511628211ULL;
+            mix(key);
+
+            // Spread the low-entropy FNV result over the high bits that decide the comparison.
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDULL;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53ULL;
+            value ^= value >> 33;
+            return value;
+        };
+
+        auto owner = nodes.begin();
+        auto ownerWeight = hash(*owner, agentId);
+        for (auto it = std::next(owner); it != nodes.end(); ++it)
+        {
+            if (const auto weight = hash(*it, agentId); weight > ownerWeight)
+            {
+                owner = it;
+                ownerWeight = weight;
+            }
+        }
+        return *owner;
+    }
 
 public:
     /**
@@ -44,8 +96,8 @@ public:
      * query response to a sub-orchestration component. The handling involves several steps:
      *
      * 1. It instantiates the socketWrapper for the Wazuh-DB if it hasn't been created.
-     * 2. Executes a query in the Wazuh-DB to fetch data.
-     * 3. Sends the query response to sub-orchestration as a scan context.
+     * 2. Executes a query in the Wazuh-DB to fetch data, adding each agent to the scan context as its row arrives.
+     * 3. Sends the scan context to sub-orchestration.
      *
      * @param data A shared pointer to the input data containing details of the query request.
      *
@@ -56,33 +108,27 @@ public:
      */
     std::shared_ptr<TScanContext> handleRequest(std::shared_ptr<TScanContext> data) override
     {
-        nlohmann::json response;
-
-        try
-        {
-            // Execute query
-            TSocketDBWrapper::instance().query(
-                WazuhDBQueryBuilder::builder().globalGetCommand("all-agents context").build(), response);
-        }
-        catch (const SocketDbWrapperException& e)
-        {
-            throw WdbDataException(e.what(), "all");
-        }
-        catch (std::exception& e)
-        {
-            logError(WM_VULNSCAN_LOGTAG, "Unable to retrieve global agents data. Reason: %s.", e.what());
-            return nullptr;
-        }
-
         const auto isManagerScanDisabled = PolicyManager::instance().getManagerDisabledScan();
-        for (const auto& agent : response)
+        const auto partitionNodes = PolicyManager::instance().getClusterPartitionNodes();
+        const auto clusterNodeName = PolicyManager::instance().getClusterNodeName();
+
+        // Each agent is added as its row arrives, the response of all the agents is never held at once.
+        auto addAgent = [&](nlohmann::json&& agent)
         {
             try
             {
+                auto agentId = Utils::padString(std::to_string(agent.at("id").get<int>()), '0', 3);
+
+                // In a partitioned cluster, the agents of the other nodes are scanned by them
+                if (!partitionNodes.empty() && partitionOwner(agentId, partitionNodes) != clusterNodeName)
+                {
+                    return;
+                }
+
                 // If the agent is the manager and the manager scan is disabled, skip it
                 if (!(isManagerScanDisabled && agent.at("id").get<int>() == 0))
                 {
-                    data->m_agents.push_back({Utils::padString(std::to_string(agent.at("id").get<int>()), '0', 3),
+                    data->m_agents.push_back({std::move(agentId),
                                               agent.at("name"),
                                               Utils::leftTrim(agent.at("version"), "Wazuh "),
                                               agent.at("ip")});
@@ -98,7 +144,24 @@ public:
                 logDebug2(WM_VULNSCAN_LOGTAG, "Error reading global agent data: %s", e.what());
             }
             // LCOV_EXCL_STOP
+        };
+
+        try
+        {
+            // Execute query
+            TSocketDBWrapper::instance().query(
+                WazuhDBQueryBuilder::builder().globalGetCommand("all-agents context").build(), addAgent);
+        }
+        catch (const SocketDbWrapperException& e)
+        {
+            throw WdbDataException(e.what(), "all");
         }
+        catch (std::exception& e)
+        {
+            logError(WM_VULNSCAN_LOGTAG, "Unable to retrieve global agents data. Reason: %s.", e.what());
+            return nullptr;
+        }
+
         logDebug2(WM_VULNSCAN_LOGTAG, "Fetched %d agents from Wazuh-DB.", data->m_agents.size());
         return AbstractHandler<std::shared_ptr<TScanContext>>::handleRequest(std::move(data));
     }
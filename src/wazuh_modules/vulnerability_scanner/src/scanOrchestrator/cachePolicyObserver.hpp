@@ -0,0 +1,56 @@
+/*
+ * Wazuh Vulnerability scanner - Scan Orchestrator
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CACHE_POLICY_OBSERVER_HPP
+#define _CACHE_POLICY_OBSERVER_HPP
+
+#include "observer.hpp"
+#include "osDataCache.hpp"
+#include "remediationDataCache.hpp"
+#include <external/nlohmann/json.hpp>
+
+/**
+ * @brief TCachePolicyObserver class.
+ *
+ * @details Applies the cache sizes of a new policy to the agent data caches, which keep their warmest entries.
+ *
+ * @tparam TOsDataCache OS data cache type.
+ * @tparam TRemediationDataCache Remediation data cache type.
+ */
+template<typename TOsDataCache = OsDataCache<>, typename TRemediationDataCache = RemediationDataCache<>>
+class TCachePolicyObserver final : public Observer<nlohmann::json&>
+{
+public:
+    // LCOV_EXCL_START
+    /**
+     * @brief Class constructor.
+     */
+    TCachePolicyObserver()
+        : Observer("cache_policy_observer")
+    {
+    }
+    // LCOV_EXCL_STOP
+
+    /**
+     * @brief Resizes the caches.
+     *
+     * @param data New configuration, with the default policy applied.
+     */
+    void update(nlohmann::json& data) override
+    {
+        TOsDataCache::instance().resize(data.at("osdataLRUSize").get<uint32_t>());
+        TRemediationDataCache::instance().resize(data.at("remediationLRUSize").get<uint32_t>());
+    }
+};
+
+using CachePolicyObserver = TCachePolicyObserver<>;
+
+#endif // _CACHE_POLICY_OBSERVER_HPP
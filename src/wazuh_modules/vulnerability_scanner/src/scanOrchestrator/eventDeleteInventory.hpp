@@ -64,8 +64,7 @@ public:
         const auto& column = AFFECTED_COMPONENT_COLUMNS.at(data->affectedComponentType());
         if (std::string value; TInventorySync<TScanContext>::m_inventoryDatabase.get(key, value, column))
         {
-            auto listCve = Utils::split(value, ',');
-            for (const auto& cve : listCve)
+            for (const auto cve : Utils::Tokenizer(value, ','))
             {
                 std::string elementKey;
                 elementKey.append(key);
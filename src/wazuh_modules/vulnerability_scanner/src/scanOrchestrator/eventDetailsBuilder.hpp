@@ -12,16 +12,27 @@
 #ifndef _EVENT_DETAILS_BUILDER_HPP
 #define _EVENT_DETAILS_BUILDER_HPP
 
+#include "cacheLRU.hpp"
 #include "chainOfResponsability.hpp"
 #include "databaseFeedManager.hpp"
 #include "loggerHelper.h"
 #include "numericHelper.h"
 #include "scanContext.hpp"
 #include "timeHelper.h"
+#include <mutex>
 
 constexpr auto WAZUH_SCHEMA_VERSION = "1.0.0";
 constexpr auto EMPTY_FIELD = "";
 
+/**
+ * @brief Vulnerability details that only depend on the CVE, rendered once and shared by every agent.
+ */
+struct CveDetails final
+{
+    std::string description;      ///< Serialized description the details were rendered from.
+    nlohmann::json vulnerability; ///< ECS vulnerability fields of the CVE.
+};
+
 /**
  * @brief TEventDetailsBuilder class.
  * This class is responsible for building the event details for the vulnerability event.
@@ -39,6 +50,58 @@ class TEventDetailsBuilder final : public AbstractHandler<std::shared_ptr<TScanC
 {
 private:
     std::shared_ptr<TDatabaseFeedManager> m_databaseFeedManager;
+    std::unique_ptr<LRUCache<std::string, std::shared_ptr<const CveDetails>>> m_cveDetailsCache;
+    std::mutex m_cveDetailsCacheMutex; ///< Protects the CVE details cache.
+
+    /**
+     * @brief Get the CVE-invariant vulnerability details, from the cache if the description did not change.
+     *
+     * The cached details keep the serialized description they were rendered from, so a feed update that changes the
+     * description renders them again.
+     *
+     * @param cve CVE id.
+     * @param description CVE description.
+     * @return std::shared_ptr<const CveDetails> Vulnerability details.
+     */
+    std::shared_ptr<const CveDetails>
+    cveDetails(const std::string& cve,
+               const FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& description)
+    {
+        const std::string_view serialized(description.slice.data(), description.slice.size());
+
+        if (m_cveDetailsCache)
+        {
+            std::scoped_lock lock(m_cveDetailsCacheMutex);
+            if (const auto value = m_cveDetailsCache->getValue(cve); value && (*value)->description == serialized)
+            {
+                return *value;
+            }
+        }
+
+        auto details = std::make_shared<CveDetails>();
+        auto& vulnerability = details->vulnerability;
+
+        vulnerability["classification"] = description.data->classification()->str();
+        vulnerability["description"] = description.data->description()->str();
+        vulnerability["enumeration"] = "CVE";
+        vulnerability["id"] = cve;
+        vulnerability["published_at"] = description.data->datePublished()->str();
+        vulnerability["reference"] = description.data->reference()->str();
+        vulnerability["scanner"]["vendor"] = "Wazuh";
+        vulnerability["score"]["base"] = Utils::floatToDoubleRound(description.data->scoreBase(), 2);
+        vulnerability["score"]["version"] = description.data->scoreVersion()->str();
+        vulnerability["severity"] = Utils::toSentenceCase(description.data->severity()->str());
+
+        if (m_cveDetailsCache)
+        {
+            details->description = serialized;
+
+            std::scoped_lock lock(m_cveDetailsCacheMutex);
+            m_cveDetailsCache->insertKey(cve, details);
+        }
+
+        return details;
+    }
 
     /**
      * @brief Populate a JSON field with a value if the value is non-empty (for strings) or always (for other types).
@@ -81,6 +144,11 @@ public:
     explicit TEventDetailsBuilder(std::shared_ptr<TDatabaseFeedManager>& databaseFeedManager)
         : m_databaseFeedManager(databaseFeedManager)
     {
+        // A CVE is usually reported for many agents, the cache follows the size of the descriptions cache.
+        if (const auto size = PolicyManager::instance().getDescriptionLRUSize(); size > 0)
+        {
+            m_cveDetailsCache = std::make_unique<LRUCache<std::string, std::shared_ptr<const CveDetails>>>(size);
+        }
     }
 
     /**
@@ -180,6 +248,8 @@ public:
         populateField(os, "/type"_json_pointer, std::move(osType));
         populateField(os, "/version"_json_pointer, std::move(osVersion));
 
+        const auto detectedAt = Utils::getCurrentISO8601();
+
         for (auto& [cve, json] : data->m_elements)
         {
             FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription> returnData;
@@ -188,6 +258,10 @@ public:
             {
                 auto ecsData = nlohmann::json::object();
 
+                // ECS vulnerability fields.
+                ecsData["vulnerability"] = cveDetails(cve, returnData)->vulnerability;
+                ecsData["vulnerability"]["detected_at"] = detectedAt;
+
                 // ECS agent fields.
                 ecsData["agent"] = agent;
 
@@ -212,21 +286,7 @@ public:
                 // ECS os fields.
                 ecsData["host"]["os"] = os;
 
-                // ECS vulnerability fields.
-                ecsData["vulnerability"]["classification"] = returnData.data->classification()->str();
-                ecsData["vulnerability"]["description"] = returnData.data->description()->str();
-                ecsData["vulnerability"]["detected_at"] = Utils::getCurrentISO8601();
-                ecsData["vulnerability"]["enumeration"] = "CVE";
-                ecsData["vulnerability"]["id"] = cve;
-                ecsData["vulnerability"]["published_at"] = returnData.data->datePublished()->str();
-                ecsData["vulnerability"]["reference"] = returnData.data->reference()->str();
-                ecsData["vulnerability"]["scanner"]["vendor"] = "Wazuh";
-                ecsData["vulnerability"]["score"]["base"] = Utils::floatToDoubleRound(returnData.data->scoreBase(), 2);
-                ecsData["vulnerability"]["score"]["version"] = returnData.data->scoreVersion()->str();
-                ecsData["vulnerability"]["severity"] = Utils::toSentenceCase(returnData.data->severity()->str());
-
                 // ECS wazuh fields.
-                auto vulnerabilityDetection = PolicyManager::instance().getVulnerabilityDetection();
                 ecsData["wazuh"]["cluster"]["name"] = data->clusterName();
                 ecsData["wazuh"]["schema"]["version"] = WAZUH_SCHEMA_VERSION;
 
@@ -79,7 +79,7 @@ public:
 
         if (TInventorySync<TScanContext>::m_inventoryDatabase.get(elementKey, rawCveList, column))
         {
-            auto listCve = Utils::split(rawCveList, ',');
+            const auto listCve = Utils::splitView(rawCveList, ',');
             for (auto& [key, value] : data->m_elements)
             {
                 if (std::find(listCve.begin(), listCve.end(), key) == listCve.end())
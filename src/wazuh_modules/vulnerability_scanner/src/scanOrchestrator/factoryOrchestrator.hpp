@@ -150,7 +150,8 @@ public:
                                                  inventoryDatabase,
                                                  reportDispatcher),
                     TFactoryOrchestrator::create(
-                        ScannerType::Os, databaseFeedManager, indexerConnector, inventoryDatabase, reportDispatcher)));
+                        ScannerType::Os, databaseFeedManager, indexerConnector, inventoryDatabase, reportDispatcher),
+                    PolicyManager::instance().getReScanThreads()));
                 break;
 
             case ScannerType::ReScanSingleAgent:
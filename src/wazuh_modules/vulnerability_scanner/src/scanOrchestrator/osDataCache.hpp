@@ -13,12 +13,12 @@
 #define _OS_DATA_CACHE_HPP
 
 #include "../policyManager/policyManager.hpp"
-#include "cacheLRU.hpp"
+#include "shardedCacheLRU.hpp"
 #include "singleton.hpp"
 #include "socketDBWrapper.hpp"
 #include "wazuhDBQueryBuilder.hpp"
 #include "wdbDataException.hpp"
-#include <shared_mutex>
+#include <mutex>
 #include <string>
 
 /**
@@ -51,8 +51,8 @@ template<typename TSocketDBWrapper = SocketDBWrapper>
 class OsDataCache final : public Singleton<OsDataCache<>>
 {
 private:
-    LRUCache<std::string, Os> m_osData {PolicyManager::instance().getOsdataLRUSize()};
-    std::shared_mutex m_mutex;
+    ShardedLRUCache<std::string, Os> m_osData {PolicyManager::instance().getOsdataLRUSize()};
+    std::mutex m_mutex; ///< Serializes the writes, the cache is thread-safe.
 
     Os getOsDataFromWdb(const std::string& agentId)
     {
@@ -109,14 +109,23 @@ public:
      */
     Os getOsData(const std::string& agentId)
     {
-        std::shared_lock lock(m_mutex);
         if (auto value = m_osData.getValue(agentId); value)
         {
             return *value;
         }
 
         // This may throw an exception that will be captured by the caller method.
+        // The query is done without the lock, so other agents aren't blocked by it.
         auto osData = getOsDataFromWdb(agentId);
+
+        std::scoped_lock lock(m_mutex);
+
+        // Data set while querying is kept, it is newer.
+        if (auto value = m_osData.getValue(agentId); value)
+        {
+            return *value;
+        }
+
         m_osData.insertKey(agentId, osData);
         return osData;
     }
@@ -132,5 +141,15 @@ public:
         std::scoped_lock lock(m_mutex);
         m_osData.insertKey(agentId, osData);
     }
+
+    /**
+     * @brief Changes the number of agents whose os data is cached, keeping the most recently used ones.
+     *
+     * @param size New cache size.
+     */
+    void resize(const size_t size)
+    {
+        m_osData.resize(size);
+    }
 };
 #endif // _OS_DATA_CACHE_HPP
@@ -12,12 +12,30 @@
 #ifndef _OS_SCANNER_HPP
 #define _OS_SCANNER_HPP
 
+#include "agentPackageIndex.hpp"
 #include "chainOfResponsability.hpp"
 #include "databaseFeedManager.hpp"
 #include "scanContext.hpp"
 #include "scannerHelper.hpp"
+#include "shardedCacheLRU.hpp"
 #include "versionMatcher/versionMatcher.hpp"
 #include "wdbDataException.hpp"
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// The fleets usually run a handful of OS builds.
+constexpr auto OS_SCAN_RESULTS_CACHE_SIZE {1024};
+
+/**
+ * @brief OS candidates that matched an OS fingerprint, shared by the agents that have it.
+ */
+struct OsScanResult final
+{
+    uint64_t feedGeneration {0};                                 ///< Feed the candidates were evaluated against.
+    std::vector<std::pair<std::string, MatchCondition>> matches; ///< Vulnerable CVEs and their match conditions.
+    std::unordered_map<std::string, std::vector<std::string>> remediations; ///< Updates that fix each CVE (Windows).
+};
 
 /**
  * @brief OsScanner class.
@@ -33,6 +51,64 @@ class TOsScanner final : public AbstractHandler<std::shared_ptr<TScanContext>>
 {
 private:
     std::shared_ptr<TDatabaseFeedManager> m_databaseFeedManager;
+    ShardedLRUCache<std::string, std::shared_ptr<const OsScanResult>> m_results {OS_SCAN_RESULTS_CACHE_SIZE};
+
+    /**
+     * @brief Builds the shareable result of the OS candidates that matched for an agent.
+     *
+     * @details On Windows, the candidates without remediation are discarded from the scan context, and the updates
+     * that fix each of the others are kept, so the agents only check them against their installed hotfixes.
+     *
+     * @param data Scan context, with the matches of the OS candidates.
+     * @param product OS product.
+     * @param feedGeneration Feed generation the candidates were evaluated against.
+     * @return std::shared_ptr<const OsScanResult> Result.
+     */
+    std::shared_ptr<const OsScanResult>
+    evaluatedResult(std::shared_ptr<TScanContext>& data, const std::string& product, const uint64_t feedGeneration)
+    {
+        auto result = std::make_shared<OsScanResult>();
+        result->feedGeneration = feedGeneration;
+
+        auto it = data->m_elements.begin();
+        while (it != data->m_elements.end())
+        {
+            const auto& cve = it->first;
+
+            if (data->osPlatform() == "windows")
+            {
+                FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo> remediations {};
+                m_databaseFeedManager->getVulnerabilityRemediation(cve, remediations);
+
+                if (remediations.data == nullptr || remediations.data->updates() == nullptr ||
+                    remediations.data->updates()->size() == 0)
+                {
+                    logDebug2(WM_VULNSCAN_LOGTAG,
+                              "No remediation available for OS '%s' on Agent '%s' for CVE: '%s', discarding.",
+                              product.c_str(),
+                              data->agentId().data(),
+                              cve.c_str());
+                    it = data->m_elements.erase(it);
+                    continue;
+                }
+
+                auto& updates = result->remediations[cve];
+                for (const auto& remediation : *(remediations.data->updates()))
+                {
+                    updates.emplace_back(remediation->str());
+                }
+            }
+
+            if (const auto matchCondition = data->m_matchConditions.find(cve);
+                matchCondition != data->m_matchConditions.end())
+            {
+                result->matches.emplace_back(cve, matchCondition->second);
+            }
+            ++it;
+        }
+
+        return result;
+    }
 
 public:
     /**
@@ -277,41 +353,56 @@ public:
                 {
                     PackageData package = {.name = osCPE.product};
 
-                    m_databaseFeedManager->getVulnerabilitiesCandidates("nvd", package, vulnerabilityScan);
+                    AgentPackageIndex::instance().insert("nvd", package.name, data->agentId());
+
+                    // Agents with the same OS fingerprint share the result of the evaluation of the OS candidates.
+                    std::string fingerprint {data->osPlatform()};
+                    fingerprint.append(1, '\0').append(osCPE.product).append(1, '\0').append(data->osVersion());
+
+                    const auto feedGeneration = m_databaseFeedManager->feedGeneration();
+                    auto result = m_results.getValue(fingerprint).value_or(nullptr);
+
+                    if (result && result->feedGeneration == feedGeneration)
+                    {
+                        logDebug2(WM_VULNSCAN_LOGTAG,
+                                  "Reusing the scan of OS '%s' (Version: %s) for Agent '%s'.",
+                                  osCPE.product.c_str(),
+                                  data->osVersion().data(),
+                                  data->agentId().data());
+
+                        for (const auto& [cve, matchCondition] : result->matches)
+                        {
+                            data->m_elements[cve] = nlohmann::json::object();
+                            data->m_matchConditions[cve] = matchCondition;
+                        }
+                    }
+                    else
+                    {
+                        m_databaseFeedManager->getVulnerabilitiesCandidates("nvd", package, vulnerabilityScan);
+                        result = evaluatedResult(data, osCPE.product, feedGeneration);
+                        m_results.insertKey(fingerprint, result);
+                    }
 
                     if (data->osPlatform() == "windows")
                     {
                         std::vector<std::string> cvesRemediated;
 
-                        auto it = data->m_elements.begin();
-                        while (it != data->m_elements.end())
+                        // Index the installed hotfixes once, each CVE checks all its updates against them.
+                        std::unordered_set<std::string_view> installedHotfixes;
+                        for (const auto& element : responseHotfixes)
                         {
-                            const auto& cve = it->first;
-                            FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo> remediations {};
-                            m_databaseFeedManager->getVulnerabilityRemediation(cve, remediations);
-
-                            if (remediations.data == nullptr || remediations.data->updates() == nullptr ||
-                                remediations.data->updates()->size() == 0)
+                            if (element.contains("hotfix") && element.at("hotfix").is_string())
                             {
-                                logDebug2(
-                                    WM_VULNSCAN_LOGTAG,
-                                    "No remediation available for OS '%s' on Agent '%s' for CVE: '%s', discarding.",
-                                    osCPE.product.c_str(),
-                                    data->agentId().data(),
-                                    cve.c_str());
-                                it = data->m_elements.erase(it);
-                                continue;
+                                installedHotfixes.emplace(element.at("hotfix").get_ref<const std::string&>());
                             }
+                        }
 
-                            for (const auto& remediation : *(remediations.data->updates()))
+                        for (const auto& [cve, updates] : result->remediations)
+                        {
+                            for (const auto& remediation : updates)
                             {
                                 // Delete element if the update is already installed
-                                if (std::find_if(responseHotfixes.begin(),
-                                                 responseHotfixes.end(),
-                                                 [&](const auto& element) {
-                                                     return element.contains("hotfix") &&
-                                                            element.at("hotfix") == remediation->str();
-                                                 }) != responseHotfixes.end())
+                                if (installedHotfixes.count(remediation) != 0)
                                 {
                                     logDebug2(WM_VULNSCAN_LOGTAG,
                                               "Remediation for OS '%s' on Agent '%s' has been found. CVE: '%s', "
@@ -319,12 +410,11 @@ public:
                                               osCPE.product.c_str(),
                                               data->agentId().data(),
                                               cve.c_str(),
-                                              remediation->str().c_str());
+                                              remediation.c_str());
                                     cvesRemediated.push_back(cve);
                                     break;
                                 }
                             }
-                            ++it;
                         }
 
                         for (const auto& cve : cvesRemediated)
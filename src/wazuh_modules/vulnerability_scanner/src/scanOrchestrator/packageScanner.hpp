@@ -12,6 +12,7 @@
 #ifndef _PACKAGE_SCANNER_HPP
 #define _PACKAGE_SCANNER_HPP
 
+#include "agentPackageIndex.hpp"
 #include "chainOfResponsability.hpp"
 #include "databaseFeedManager.hpp"
 #include "remediationDataCache.hpp"
@@ -19,6 +20,7 @@
 #include "scannerHelper.hpp"
 #include "versionMatcher/versionMatcher.hpp"
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <variant>
 
@@ -85,7 +87,7 @@ private:
         const auto osPlatform = data->osPlatform().data();
         const auto translations = m_databaseFeedManager->checkAndTranslatePackage(packageCandidate, osPlatform);
 
-        auto scanPackage = [this, &data, &cnaName, &vulnerabilityScan](const PackageData& package)
+        auto logScan = [&data, &cnaName](const PackageData& package)
         {
             logDebug1(WM_VULNSCAN_LOGTAG,
                       "Initiating a vulnerability scan for package '%s' (%s) (%s) with CVE Numbering Authorities (CNA) "
@@ -98,15 +100,27 @@ private:
                       data->agentId().data(),
                       data->agentVersion().data());
 
+            AgentPackageIndex::instance().insert(cnaName, package.name, data->agentId());
+        };
+
+        auto scanPackage = [this, &cnaName, &vulnerabilityScan, &logScan](const PackageData& package)
+        {
+            logScan(package);
             m_databaseFeedManager->getVulnerabilitiesCandidates(cnaName, package, vulnerabilityScan);
         };
 
-        if (!translations.empty())
+        if (translations.size() > 1)
         {
+            // All the translations are looked up at once, in key order
             for (const auto& translatedPackage : translations)
             {
-                scanPackage(translatedPackage);
+                logScan(translatedPackage);
             }
+            m_databaseFeedManager->getVulnerabilitiesCandidatesBatch(cnaName, translations, vulnerabilityScan);
+        }
+        else if (!translations.empty())
+        {
+            scanPackage(translations.front());
         }
         else
         {
@@ -499,7 +513,8 @@ private:
     bool packageHotfixSolved(const std::string& cnaName,
                              const PackageData& package,
                              const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData,
-                             std::shared_ptr<TScanContext> contextData)
+                             std::shared_ptr<TScanContext> contextData,
+                             std::optional<Remediation>& agentRemediations)
     {
         FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo> remediations {};
         m_databaseFeedManager->getVulnerabilityRemediation(callbackData.cveId()->str(), remediations);
@@ -510,9 +525,13 @@ private:
             return false;
         }
 
-        // Check that the agent has remediation data.
-        auto agentRemediations = TRemediationDataCache::instance().getRemediationData(contextData->agentId().data());
-        if (agentRemediations.hotfixes.empty())
+        // Check that the agent has remediation data, fetched once per package rather than once per CVE.
+        if (!agentRemediations.has_value())
+        {
+            agentRemediations = TRemediationDataCache::instance().getRemediationData(contextData->agentId().data());
+        }
+
+        if (agentRemediations->hotfixes.empty())
         {
             logDebug2(
                 WM_VULNSCAN_LOGTAG, "No remediations for agent '%s' have been found.", contextData->agentId().data());
@@ -523,7 +542,7 @@ private:
         for (const auto& remediation : *(remediations.data->updates()))
         {
             // Check if the remediation is installed on the agent.
-            if (agentRemediations.hotfixes.count(remediation->str()) != 0)
+            if (agentRemediations->hotfixes.count(remediation->str()) != 0)
             {
                 logDebug2(WM_VULNSCAN_LOGTAG,
                           "Remediation '%s' for package '%s' on agent '%s' that solves CVE '%s' has been found.",
@@ -568,6 +587,8 @@ public:
      */
     std::shared_ptr<TScanContext> handleRequest(std::shared_ptr<TScanContext> data) override
     {
+        std::optional<Remediation> agentRemediations;
+
         auto vulnerabilityScan = [&](const std::string& cnaName,
                                      const PackageData& package,
                                      const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData)
@@ -594,7 +615,7 @@ public:
                     // The candidate version matches the package. Post-match filtering.
                     if (data->osPlatform().compare("windows") == 0)
                     {
-                        if (packageHotfixSolved(cnaName, package, callbackData, data))
+                        if (packageHotfixSolved(cnaName, package, callbackData, data, agentRemediations))
                         {
                             // An installed hotfix solves the vulnerability.
                             return false;
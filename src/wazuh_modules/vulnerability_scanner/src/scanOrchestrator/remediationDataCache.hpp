@@ -13,12 +13,12 @@
 #define _REMEDIATION_DATA_CACHE_HPP
 
 #include "../policyManager/policyManager.hpp"
-#include "cacheLRU.hpp"
+#include "shardedCacheLRU.hpp"
 #include "singleton.hpp"
 #include "socketDBWrapper.hpp"
 #include "wazuhDBQueryBuilder.hpp"
 #include "wdbDataException.hpp"
-#include <shared_mutex>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 
@@ -39,8 +39,8 @@ template<typename TSocketDBWrapper = SocketDBWrapper>
 class RemediationDataCache final : public Singleton<RemediationDataCache<>>
 {
 private:
-    LRUCache<std::string, Remediation> m_remediationData {PolicyManager::instance().getRemediationLRUSize()};
-    std::shared_mutex m_mutex;
+    ShardedLRUCache<std::string, Remediation> m_remediationData {PolicyManager::instance().getRemediationLRUSize()};
+    std::mutex m_mutex; ///< Serializes the writes, the cache is thread-safe.
 
     Remediation getRemediationDataFromWdb(const std::string& agentId) const
     {
@@ -89,16 +89,24 @@ public:
      */
     Remediation getRemediationData(const std::string& agentId)
     {
-        std::shared_lock lock(m_mutex);
         if (auto value = m_remediationData.getValue(agentId); value)
         {
             return *value;
         }
 
+        // The query is done without the lock, so other agents aren't blocked by it.
         const auto remediationData = getRemediationDataFromWdb(agentId);
 
         if (!remediationData.hotfixes.empty())
         {
+            std::scoped_lock lock(m_mutex);
+
+            // Data added while querying is kept, it is newer.
+            if (auto value = m_remediationData.getValue(agentId); value)
+            {
+                return *value;
+            }
+
             // Update the cache with the queried data
             m_remediationData.insertKey(agentId, remediationData);
         }
@@ -126,6 +134,16 @@ public:
 
         m_remediationData.insertKey(agentId, newRemediationData);
     }
+
+    /**
+     * @brief Changes the number of agents whose remediation data is cached, keeping the most recently used ones.
+     *
+     * @param size New cache size.
+     */
+    void resize(const size_t size)
+    {
+        m_remediationData.resize(size);
+    }
 };
 
 #endif // _REMEDIATION_DATA_CACHE_HPP
@@ -15,6 +15,8 @@
 #include "chainOfResponsability.hpp"
 #include "indexerConnector.hpp"
 #include "scanContext.hpp"
+#include <string>
+#include <vector>
 
 /**
  * @brief ResultIndexer class.
@@ -51,6 +53,10 @@ public:
     {
         if (m_indexerConnector != nullptr)
         {
+            // The results of the scan are published as a single batch.
+            std::vector<std::string> messages;
+            messages.reserve(data->m_elements.size());
+
             for (auto& [key, value] : data->m_elements)
             {
                 // Add no-index field to the json object, based on the scan context value.
@@ -62,13 +68,18 @@ public:
                 logDebug2(WM_VULNSCAN_LOGTAG, "Processing and publish key: %s", key.c_str());
                 if (value.contains("operation") && value.contains("id"))
                 {
-                    m_indexerConnector->publish(value.dump());
+                    messages.push_back(value.dump());
                 }
                 else
                 {
                     logError(WM_VULNSCAN_LOGTAG, "Invalid element to publish: %s.", value.dump().c_str());
                 }
             }
+
+            if (!messages.empty())
+            {
+                m_indexerConnector->publish(messages);
+            }
         }
         return AbstractHandler<std::shared_ptr<TScanContext>>::handleRequest(std::move(data));
     }
@@ -19,6 +19,14 @@
 #include "socketDBWrapper.hpp"
 #include "wazuhDBQueryBuilder.hpp"
 #include "wdbDataException.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+constexpr auto RESCAN_PROGRESS_INTERVAL {std::chrono::seconds(30)};
 
 /**
  * @brief Orchestrates queries to the global Wazuh-DB system and initiates package scanning.
@@ -36,6 +44,49 @@ class TScanAgentList final : public AbstractHandler<std::shared_ptr<TScanContext
 private:
     std::shared_ptr<TAbstractHandler> m_packageScanSuborchestration;
     std::shared_ptr<TAbstractHandler> m_osScanSuborchestration;
+    size_t m_threadCount;
+
+    /**
+     * @brief Progress of the scan of an agent list, logged at most once per RESCAN_PROGRESS_INTERVAL and when the
+     * list is done. Single agent lists aren't logged.
+     */
+    class ScanProgress final
+    {
+        size_t m_total;
+        size_t m_scanned {0};
+        std::chrono::steady_clock::time_point m_start {std::chrono::steady_clock::now()};
+        std::chrono::steady_clock::time_point m_lastReport {m_start};
+        std::mutex m_mutex;
+
+    public:
+        explicit ScanProgress(const size_t total)
+            : m_total(total)
+        {
+        }
+
+        /**
+         * @brief Counts a scanned agent and logs the progress and the estimated time left when it is due.
+         */
+        void agentScanned()
+        {
+            std::scoped_lock lock(m_mutex);
+            ++m_scanned;
+
+            const auto now = std::chrono::steady_clock::now();
+            if (m_total > 1 && (m_scanned == m_total || now - m_lastReport >= RESCAN_PROGRESS_INTERVAL))
+            {
+                m_lastReport = now;
+                const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - m_start);
+                const auto eta = elapsed * (m_total - m_scanned) / m_scanned;
+                logInfo(WM_VULNSCAN_LOGTAG,
+                        "Scanned %zu of %zu agents in %lld seconds, estimated time left: %lld seconds.",
+                        m_scanned,
+                        m_total,
+                        static_cast<long long>(elapsed.count()),
+                        static_cast<long long>(eta.count()));
+            }
+        }
+    };
 
     /**
      * @brief The `scanAgentOs` method fetches the OS information of an agent from the Wazuh-DB and sends the data to
@@ -211,11 +262,14 @@ public:
      *
      * @param packageScanOrchestration package orchestration instance.
      * @param osScanOrchestration os orchestration instance.
+     * @param threadCount number of threads that scan the agents of the list.
      */
     explicit TScanAgentList(std::shared_ptr<TAbstractHandler> packageScanOrchestration,
-                            std::shared_ptr<TAbstractHandler> osScanOrchestration)
+                            std::shared_ptr<TAbstractHandler> osScanOrchestration,
+                            const size_t threadCount = 1)
         : m_packageScanSuborchestration(std::move(packageScanOrchestration))
         , m_osScanSuborchestration(std::move(osScanOrchestration))
+        , m_threadCount(std::max<size_t>(threadCount, 1))
     {
     }
 
@@ -225,8 +279,9 @@ public:
      * The `handleRequest` method processes incoming requests, executes queries in the Wazuh-DB, and forwards the
      * query response to a sub-orchestration component. The handling involves several steps:
      *
-     * 1. It iterates over the list of agents and executes queries to fetch data from the Wazuh-DB.
-     * 2. For each agent, it scans the OS and packages.
+     * 1. It iterates over the list of agents and executes queries to fetch data from the Wazuh-DB. Up to
+     *    `threadCount` threads take the next pending agent of the list, so a slow agent doesn't hold the rest.
+     * 2. For each agent, it scans the OS and packages, and the progress of the list is logged periodically.
      * 3. If a query fails, it logs a warning and adds the agent to a list of agents with incomplete scans.
      * 4. If the list is not empty, it throws an exception to initiate a rescan for the agents in the list.
      * @param data A shared pointer to the input data.
@@ -235,23 +290,48 @@ public:
      */
     std::shared_ptr<TScanContext> handleRequest(std::shared_ptr<TScanContext> data) override
     {
-        for (const auto& agent : data->m_agents)
+        const auto& agents = data->m_agents;
+        std::atomic<size_t> nextAgent {0};
+        std::mutex incompletedScanMutex;
+        ScanProgress progress(agents.size());
+
+        auto scanAgents = [&]()
         {
-            try
+            for (auto index = nextAgent++; index < agents.size(); index = nextAgent++)
             {
-                scanAgentOs(agent, data->m_noIndex);
-                scanAgentPackages(agent, data->m_noIndex);
-            }
-            catch (const WdbDataException& e)
-            {
-                logDebug2(
-                    WM_VULNSCAN_LOGTAG, "Error executing query to fetch agent data for agents. Reason: %s.", e.what());
-                data->m_agentsWithIncompletedScan.push_back(agent);
-            }
-            catch (const std::exception& e)
-            {
-                logError(WM_VULNSCAN_LOGTAG, "Error handling request: %s.", e.what());
+                const auto& agent = agents[index];
+                try
+                {
+                    scanAgentOs(agent, data->m_noIndex);
+                    scanAgentPackages(agent, data->m_noIndex);
+                }
+                catch (const WdbDataException& e)
+                {
+                    logDebug2(WM_VULNSCAN_LOGTAG,
+                              "Error executing query to fetch agent data for agents. Reason: %s.",
+                              e.what());
+                    std::scoped_lock lock(incompletedScanMutex);
+                    data->m_agentsWithIncompletedScan.push_back(agent);
+                }
+                catch (const std::exception& e)
+                {
+                    logError(WM_VULNSCAN_LOGTAG, "Error handling request: %s.", e.what());
+                }
+                progress.agentScanned();
             }
+        };
+
+        // The calling thread is one of the scanning threads
+        std::vector<std::thread> threads;
+        const auto threadCount = std::min(m_threadCount, agents.size());
+        for (size_t i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back(scanAgents);
+        }
+        scanAgents();
+        for (auto& thread : threads)
+        {
+            thread.join();
         }
 
         if (!data->m_agentsWithIncompletedScan.empty())
@@ -125,6 +125,9 @@ private:
      * The `extractData` function extracts and processes data from various message types using provided functions.
      *
      * @tparam T The return type of the extraction and processing functions.
+     * @tparam TDeltaFunc Type of the SyscollectorDeltas::Delta extraction function.
+     * @tparam TSyncFunc Type of the SyscollectorSynchronization::SyncMsg extraction function.
+     * @tparam TJsonFunc Type of the nlohmann::json extraction function.
      * @param sysDeltaFunc A function to extract and process data from SyscollectorDeltas::Delta messages.
      * @param sysSyncFunc A function to extract and process data from SyscollectorSynchronization::SyncMsg messages.
      * @param jsonFunc A function to extract and process data from nlohmann::json messages (defaulted to return a
@@ -134,26 +137,28 @@ private:
      * @note This function handles different message types and applies the appropriate extraction and processing
      * function. It returns the result of the extraction and processing, or a default-constructed T if the message type
      * is not a JSON query or action type. It may throw a std::runtime_error if the message type is unknown.
+     * The functions are taken by their own type rather than through std::function, so the accessors are resolved and
+     * inlined at compile time instead of being type-erased on every call.
      */
-    template<typename T>
+    template<typename T, typename TDeltaFunc, typename TSyncFunc, typename TJsonFunc = T (*)(const nlohmann::json*)>
     T extractData(
-        std::function<T(const SyscollectorDeltas::Delta*)> sysDeltaFunc,
-        std::function<T(const SyscollectorSynchronization::SyncMsg*)> sysSyncFunc,
-        std::function<T(const nlohmann::json*)> jsonFunc = [](const nlohmann::json*) -> T { return T(); }) const
+        TDeltaFunc sysDeltaFunc,
+        TSyncFunc sysSyncFunc,
+        TJsonFunc jsonFunc = [](const nlohmann::json*) -> T { return T(); }) const
     {
         if (m_messageType == MessageType::Delta)
         {
-            auto delta = std::get<const SyscollectorDeltas::Delta*>(m_data);
+            auto delta = *std::get_if<const SyscollectorDeltas::Delta*>(&m_data);
             return sysDeltaFunc(delta);
         }
         else if (m_messageType == MessageType::Sync)
         {
-            auto syncMsg = std::get<const SyscollectorSynchronization::SyncMsg*>(m_data);
+            auto syncMsg = *std::get_if<const SyscollectorSynchronization::SyncMsg*>(&m_data);
             return sysSyncFunc(syncMsg);
         }
         else if (m_messageType == MessageType::DataJSON)
         {
-            auto json = std::get<const nlohmann::json*>(m_data);
+            auto json = *std::get_if<const nlohmann::json*>(&m_data);
             return jsonFunc(json);
         }
         else if (m_messageType == MessageType::ActionTrigger)
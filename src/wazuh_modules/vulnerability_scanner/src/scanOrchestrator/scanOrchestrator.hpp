@@ -12,11 +12,13 @@
 #ifndef _SCAN_ORCHESTRATOR_HPP
 #define _SCAN_ORCHESTRATOR_HPP
 
+#include "agentPackageIndex.hpp"
 #include "factoryOrchestrator.hpp"
 #include "flatbuffers/include/syscollector_deltas_generated.h"
 #include "flatbuffers/include/syscollector_synchronization_generated.h"
 #include "indexerConnector.hpp"
 #include "messageBuffer_generated.h"
+#include "rocksDBPrefixTransform.hpp"
 #include "scanContext.hpp"
 #include "wdbDataException.hpp"
 #include <memory>
@@ -74,7 +76,9 @@ public:
                                std::shared_mutex& mutex)
         : m_mutex {mutex}
     {
-        m_inventoryDatabase = std::make_unique<Utils::RocksDBWrapper>(INVENTORY_DB_PATH);
+        // The keys start with the agent, and its entries are only sought with the agent prefix.
+        m_inventoryDatabase = std::make_unique<Utils::RocksDBWrapper>(
+            INVENTORY_DB_PATH, true, std::make_shared<Utils::SeparatorPrefixTransform>('_'));
         auto& inventoryDatabase = *m_inventoryDatabase;
 
         m_osOrchestration = TFactoryOrchestrator::create(
@@ -241,6 +245,36 @@ public:
     }
 
 private:
+    /**
+     * @brief Gets the coalescing key of an event postponed for its agent.
+     *
+     * A later delta of the same package, or a later osinfo delta, supersedes the pending one in the delayed queue,
+     * and a package deletion cancels a pending insertion. Other events are queued as they are.
+     *
+     * @param context Scan context of the event.
+     * @return Coalescing key, empty if the event is not coalesced.
+     */
+    static std::string coalescingKey(const TScanContext& context)
+    {
+        if (context.messageType() == MessageType::Delta)
+        {
+            switch (context.getType())
+            {
+                case ScannerType::PackageInsert:
+                case ScannerType::PackageDelete:
+                    if (const auto itemId = context.packageItemId(); !itemId.empty())
+                    {
+                        return "packages_" + std::string(itemId);
+                    }
+                    break;
+                case ScannerType::Os: return "osinfo";
+                default: break;
+            }
+        }
+
+        return {};
+    }
+
     /**
      * @brief Runs orchestrator, decoding and building context.
      *
@@ -263,7 +297,18 @@ private:
         if (!isDelayed && type != ScannerType::CleanupAllAgentData && type != ScannerType::ReScanAllAgents &&
             m_eventDelayedDispatcher->size(context->agentId()))
         {
-            m_eventDelayedDispatcher->push(context->agentId(), rawData);
+            if (const auto key = coalescingKey(*context); !key.empty())
+            {
+                m_eventDelayedDispatcher->push(context->agentId(),
+                                               rawData,
+                                               key,
+                                               type == ScannerType::PackageDelete ? CoalesceOperation::Delete
+                                                                                  : CoalesceOperation::Insert);
+            }
+            else
+            {
+                m_eventDelayedDispatcher->push(context->agentId(), rawData);
+            }
         }
         else
         {
@@ -278,7 +323,10 @@ private:
                     break;
                 // LCOV_EXCL_START
                 case ScannerType::ReScanAllAgents:
+                    // The scans rebuild the index of the agent packages
+                    AgentPackageIndex::instance().clear();
                     m_reScanAllOrchestration->handleRequest(std::move(context));
+                    AgentPackageIndex::instance().markComplete();
                     m_eventDelayedDispatcher->clear();
                     break;
                 case ScannerType::ReScanSingleAgent:
@@ -82,7 +82,8 @@ public:
     static CPE parseCPE(const std::string& cpeString)
     {
         CPE cpe {};
-        std::vector<std::string> cpeParts = Utils::split(cpeString, ':');
+        // The parts are views of the string, only the fields of the CPE are copied.
+        const auto cpeParts = Utils::splitView(cpeString, ':');
 
         // Check if is 2.2 or 2.3
         // If is 2.2, the first part is "cpe"
@@ -96,7 +97,7 @@ public:
 
         if (maxAvailableIndex >= CPEFIELDS::product + offset)
         {
-            cpe.part = Utils::leftTrim(cpeParts[CPEFIELDS::part + offset], "/");
+            cpe.part = Utils::leftTrimView(cpeParts[CPEFIELDS::part + offset], "/");
             cpe.vendor = cpeParts[CPEFIELDS::vendor + offset];
             cpe.product = cpeParts[CPEFIELDS::product + offset];
         }
@@ -21,9 +21,13 @@
 #include "versionObjectRpm.hpp"
 #include "versionObjectSemVer.hpp"
 #include "vulnerabilityScannerDefs.hpp"
+#include <array>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <variant>
 
 enum class VersionComparisonResult : int
@@ -46,6 +50,19 @@ enum class VersionMatcherStrategy : int
 
 using PackageMap = std::unordered_map<std::string_view, std::variant<VersionObjectType, VersionMatcherStrategy>>;
 
+/**
+ * @brief Parsed version, by value. The alternatives follow the order of VersionObjectType, so the index of the
+ * variant is the type of the version.
+ */
+using VersionValue = std::variant<VersionObjectCalVer,
+                                  VersionObjectPEP440,
+                                  VersionObjectMajorMinor,
+                                  VersionObjectSemVer,
+                                  VersionObjectDpkg,
+                                  VersionObjectRpm>;
+
+constexpr size_t VERSION_CACHE_MAX_ENTRIES {16384}; ///< Max parsed versions kept by each thread.
+
 /**
  * @brief VersionMatcher class.
  *
@@ -53,23 +70,66 @@ using PackageMap = std::unordered_map<std::string_view, std::variant<VersionObje
 class VersionMatcher final
 {
 private:
+    static constexpr size_t TYPE_COUNT {6};     ///< Number of VersionObjectType values.
+    static constexpr size_t STRATEGY_COUNT {7}; ///< Number of VersionMatcherStrategy values.
+
+    /**
+     * @brief Parsed versions by type (first the VersionObjectType values, then the VersionMatcherStrategy values) and
+     * version string. The versions that don't match their type are kept too, as std::nullopt.
+     */
+    struct VersionCache
+    {
+        std::array<std::unordered_map<std::string, std::optional<VersionValue>>, TYPE_COUNT + STRATEGY_COUNT> maps;
+        size_t size {0};
+    };
+
+    /**
+     * @brief Cache of the calling thread, no lock is needed and each scanner thread keeps its hot versions.
+     *
+     * @return VersionCache&
+     */
+    static VersionCache& cache()
+    {
+        thread_local VersionCache versionCache;
+        return versionCache;
+    }
+
+    /**
+     * @brief Drops all the cached versions if the cache is full.
+     *
+     * @note It is only called before the lookups of an operation, so the values returned by lookup stay valid until
+     * the operation ends.
+     */
+    static void trimCache()
+    {
+        auto& versionCache = cache();
+        if (versionCache.size >= VERSION_CACHE_MAX_ENTRIES)
+        {
+            for (auto& map : versionCache.maps)
+            {
+                map.clear();
+            }
+            versionCache.size = 0;
+        }
+    }
+
     /**
      * @brief Creates the corresponding version object using a strategy (VersionMatcherStrategy).
      *
      * @note A strategy is a set of rules to match a version string to a version object. For example, the default
      * strategy is to try to match the version string to a CalVer object, if it doesn't match, then it tries to match it
      * to a PEP440 object, and so on. If the version string doesn't match any of the specified types, it will return a
-     * nullptr.
+     * std::nullopt.
      *
      *
      * @param version string version item to create object from
      * @param strategy VersionMatcherStrategy to use.
-     * @return std::shared_ptr<IVersionObject>
+     * @return std::optional<VersionValue>
      */
-    static std::shared_ptr<IVersionObject> createVersionObject(const std::string& version,
-                                                               const VersionMatcherStrategy& strategy)
+    static std::optional<VersionValue> createVersionObject(const std::string& version,
+                                                           const VersionMatcherStrategy& strategy)
     {
-        std::shared_ptr<IVersionObject> matcher;
+        std::optional<VersionValue> matcher;
 
         switch (strategy)
         {
@@ -82,39 +142,24 @@ private:
             case VersionMatcherStrategy::APK:
                 // TODO: Define the APK strategy
             case VersionMatcherStrategy::Unspecified:
-                if (matcher = createVersionObject(version, VersionObjectType::CalVer); matcher)
-                {
-                    return matcher;
-                }
-                else if (matcher = createVersionObject(version, VersionObjectType::PEP440); matcher)
-                {
-                    return matcher;
-                }
-                else if (matcher = createVersionObject(version, VersionObjectType::MajorMinor); matcher)
+                for (const auto type : {VersionObjectType::CalVer,
+                                        VersionObjectType::PEP440,
+                                        VersionObjectType::MajorMinor,
+                                        VersionObjectType::SemVer,
+                                        VersionObjectType::DPKG,
+                                        VersionObjectType::RPM})
                 {
-                    return matcher;
-                }
-                else if (matcher = createVersionObject(version, VersionObjectType::SemVer); matcher)
-                {
-                    return matcher;
-                }
-                else if (matcher = createVersionObject(version, VersionObjectType::DPKG); matcher)
-                {
-                    return matcher;
-                }
-                else if (matcher = createVersionObject(version, VersionObjectType::RPM); matcher)
-                {
-                    return matcher;
-                }
-                else
-                {
-                    // LCOV_EXCL_START
-                    logDebug2(WM_VULNSCAN_LOGTAG,
-                              "Error creating VersionObject (Unspecified). Version string doesn't match "
-                              "any of the specified types. Version string: %s",
-                              version.c_str());
-                    // LCOV_EXCL_STOP
+                    if (matcher = createVersionObject(version, type); matcher)
+                    {
+                        return matcher;
+                    }
                 }
+                // LCOV_EXCL_START
+                logDebug2(WM_VULNSCAN_LOGTAG,
+                          "Error creating VersionObject (Unspecified). Version string doesn't match "
+                          "any of the specified types. Version string: %s",
+                          version.c_str());
+                // LCOV_EXCL_STOP
                 break;
             // LCOV_EXCL_START
             default:
@@ -123,7 +168,7 @@ private:
                 // LCOV_EXCL_STOP
         }
 
-        return nullptr;
+        return std::nullopt;
     } // LCOV_EXCL_LINE
 
     /**
@@ -132,26 +177,18 @@ private:
      * @param version string version item to create object from
      * @param type VersionObjectType to use (CalVer, PEP440, MajorMinor, SemVer, DPKG, RPM, etc).
      *
-     * @note If the version string doesn't match the specified type it will return nullptr.
+     * @note If the version string doesn't match the specified type it will return std::nullopt.
      *
-     * @return std::shared_ptr<IVersionObject>
+     * @return std::optional<VersionValue>
      */
-    static std::shared_ptr<IVersionObject> createVersionObject(const std::string& version,
-                                                               const VersionObjectType& type)
+    static std::optional<VersionValue> createVersionObject(const std::string& version, const VersionObjectType& type)
     {
-        CalVer calVer {};
-        PEP440 pep440 {};
-        MajorMinor majorMinor {};
-        SemVer semVer {};
-        Dpkg dpkgVer {};
-        Rpm rpmVer {};
-
         switch (type)
         {
             case VersionObjectType::CalVer:
-                if (VersionObjectCalVer::match(version, calVer))
+                if (CalVer calVer {}; VersionObjectCalVer::match(version, calVer))
                 {
-                    return std::make_shared<VersionObjectCalVer>(calVer);
+                    return VersionObjectCalVer(calVer);
                 }
                 logDebug2(WM_VULNSCAN_LOGTAG,
                           "Error creating VersionObject (CalVer). Version string doesn't match the specified type. "
@@ -160,9 +197,9 @@ private:
                 break;
 
             case VersionObjectType::PEP440:
-                if (VersionObjectPEP440::match(version, pep440))
+                if (PEP440 pep440 {}; VersionObjectPEP440::match(version, pep440))
                 {
-                    return std::make_shared<VersionObjectPEP440>(pep440);
+                    return VersionObjectPEP440(pep440);
                 }
                 logDebug2(WM_VULNSCAN_LOGTAG,
                           "Error creating VersionObject (PEP440). Version string doesn't match the specified type. "
@@ -171,9 +208,9 @@ private:
                 break;
 
             case VersionObjectType::MajorMinor:
-                if (VersionObjectMajorMinor::match(version, majorMinor))
+                if (MajorMinor majorMinor {}; VersionObjectMajorMinor::match(version, majorMinor))
                 {
-                    return std::make_shared<VersionObjectMajorMinor>(majorMinor);
+                    return VersionObjectMajorMinor(majorMinor);
                 }
                 logDebug2(WM_VULNSCAN_LOGTAG,
                           "Error creating VersionObject (MajorMinor). Version string doesn't match the specified type. "
@@ -182,9 +219,9 @@ private:
                 break;
 
             case VersionObjectType::SemVer:
-                if (VersionObjectSemVer::match(version, semVer))
+                if (SemVer semVer {}; VersionObjectSemVer::match(version, semVer))
                 {
-                    return std::make_shared<VersionObjectSemVer>(semVer);
+                    return VersionObjectSemVer(semVer);
                 }
                 logDebug2(WM_VULNSCAN_LOGTAG,
                           "Error creating VersionObject (SemVer). Version string doesn't match the specified type. "
@@ -193,9 +230,9 @@ private:
                 break;
 
             case VersionObjectType::DPKG:
-                if (VersionObjectDpkg::match(version, dpkgVer))
+                if (Dpkg dpkgVer {}; VersionObjectDpkg::match(version, dpkgVer))
                 {
-                    return std::make_shared<VersionObjectDpkg>(dpkgVer);
+                    return VersionObjectDpkg(dpkgVer);
                 }
                 logDebug2(WM_VULNSCAN_LOGTAG,
                           "Error creating VersionObject (DPKG). Version string doesn't match the specified type. "
@@ -204,9 +241,9 @@ private:
                 break;
 
             case VersionObjectType::RPM:
-                if (VersionObjectRpm::match(version, rpmVer))
+                if (Rpm rpmVer {}; VersionObjectRpm::match(version, rpmVer))
                 {
-                    return std::make_shared<VersionObjectRpm>(rpmVer);
+                    return VersionObjectRpm(rpmVer);
                 }
                 logDebug2(WM_VULNSCAN_LOGTAG,
                           "Error creating VersionObject (RPM). Version string doesn't match the specified type. "
@@ -220,35 +257,46 @@ private:
                 break;
                 // LCOV_EXCL_STOP
         }
-        return nullptr;
+        return std::nullopt;
     } // LCOV_EXCL_LINE
 
     /**
-     * @brief Creates a version object using the string and type specified.
+     * @brief Returns the parsed version of the string and type specified, parsing it only the first time.
      *
      * @param version string version item to create object from
      * @param type Version object or matcher strategy.
      *
-     * @return std::shared_ptr<IVersionObject>
+     * @return const std::optional<VersionValue>& std::nullopt if the version doesn't match the type. It is valid
+     * until the next call to trimCache.
      */
-    static std::shared_ptr<IVersionObject>
-    createVersionObject(const std::string& version, std::variant<VersionObjectType, VersionMatcherStrategy> type)
+    static const std::optional<VersionValue>&
+    lookup(const std::string& version, std::variant<VersionObjectType, VersionMatcherStrategy> type)
     {
-        if (std::holds_alternative<VersionObjectType>(type))
-        {
-            return createVersionObject(version, std::get<VersionObjectType>(type));
-        }
-        else if (std::holds_alternative<VersionMatcherStrategy>(type))
+        const auto index = std::holds_alternative<VersionObjectType>(type)
+                               ? static_cast<size_t>(std::get<VersionObjectType>(type))
+                               : TYPE_COUNT + static_cast<size_t>(std::get<VersionMatcherStrategy>(type));
+
+        // LCOV_EXCL_START
+        if (index >= TYPE_COUNT + STRATEGY_COUNT)
         {
-            return createVersionObject(version, std::get<VersionMatcherStrategy>(type));
+            logDebug2(WM_VULNSCAN_LOGTAG, "Error creating VersionObject: Invalid type.");
+            static const std::optional<VersionValue> invalid {};
+            return invalid;
         }
-        else
+        // LCOV_EXCL_STOP
+
+        auto& versionCache = cache();
+        auto& map = versionCache.maps[index];
+        if (const auto it = map.find(version); it != map.end())
         {
-            // LCOV_EXCL_START
-            logDebug2(WM_VULNSCAN_LOGTAG, "Error creating VersionObject: Invalid type.");
-            return nullptr;
-            // LCOV_EXCL_STOP
+            return it->second;
         }
+
+        auto value = std::holds_alternative<VersionObjectType>(type)
+                         ? createVersionObject(version, std::get<VersionObjectType>(type))
+                         : createVersionObject(version, std::get<VersionMatcherStrategy>(type));
+        ++versionCache.size;
+        return map.emplace(version, std::move(value)).first->second;
     }
 
 public:
@@ -265,24 +313,30 @@ public:
             const std::string& versionB,
             std::variant<VersionObjectType, VersionMatcherStrategy> type = VersionMatcherStrategy::Unspecified)
     {
-        auto pVersionObjectA = createVersionObject(versionA, type);
-        auto pVersionObjectB = createVersionObject(versionB, type);
+        trimCache();
+        const auto& versionObjectA = lookup(versionA, type);
+        const auto& versionObjectB = lookup(versionB, type);
 
-        if (pVersionObjectA && pVersionObjectB && pVersionObjectA->getType() == pVersionObjectB->getType())
+        if (versionObjectA && versionObjectB && versionObjectA->index() == versionObjectB->index())
         {
-
-            if (*pVersionObjectA == *pVersionObjectB)
-            {
-                return VersionComparisonResult::A_EQUAL_B;
-            }
-            else if (*pVersionObjectA < *pVersionObjectB)
-            {
-                return VersionComparisonResult::A_LESS_THAN_B;
-            }
-            else
-            {
-                return VersionComparisonResult::A_GREATER_THAN_B;
-            }
+            return std::visit(
+                [](const auto& a, const auto& b)
+                {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(a)>, std::decay_t<decltype(b)>>)
+                    {
+                        if (a == b)
+                        {
+                            return VersionComparisonResult::A_EQUAL_B;
+                        }
+                        else if (a < b)
+                        {
+                            return VersionComparisonResult::A_LESS_THAN_B;
+                        }
+                    }
+                    return VersionComparisonResult::A_GREATER_THAN_B;
+                },
+                *versionObjectA,
+                *versionObjectB);
         }
 
         throw std::invalid_argument("Unable to compare versions (" + versionA + " vs " + versionB + ").");
@@ -300,7 +354,8 @@ public:
      */
     static bool match(const std::string& version, std::variant<VersionObjectType, VersionMatcherStrategy> type)
     {
-        return (nullptr != createVersionObject(version, type));
+        trimCache();
+        return lookup(version, type).has_value();
     }
 };
 
@@ -135,7 +135,18 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return (m_year == pB->m_year && m_month == pB->m_month && m_day == pB->m_day && m_micro == pB->m_micro);
+        return *this == *pB;
+    }
+
+    /**
+     * @brief Comparison operator == with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool operator==(const VersionObjectCalVer& b) const
+    {
+        return (m_year == b.m_year && m_month == b.m_month && m_day == b.m_day && m_micro == b.m_micro);
     }
 
     /**
@@ -151,35 +162,45 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
+        return *this < *pB;
+    }
 
-        if (m_year < pB->m_year)
+    /**
+     * @brief Comparison operator < with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const VersionObjectCalVer& b) const
+    {
+        if (m_year < b.m_year)
         {
             return true;
         }
-        else if (m_year > pB->m_year)
+        else if (m_year > b.m_year)
         {
             return false;
         }
 
-        if (m_month < pB->m_month)
+        if (m_month < b.m_month)
         {
             return true;
         }
-        else if (m_month > pB->m_month)
+        else if (m_month > b.m_month)
         {
             return false;
         }
 
-        if (m_day < pB->m_day)
+        if (m_day < b.m_day)
         {
             return true;
         }
-        else if (m_day > pB->m_day)
+        else if (m_day > b.m_day)
         {
             return false;
         }
 
-        return m_micro < pB->m_micro;
+        return m_micro < b.m_micro;
     }
 };
 
@@ -309,7 +309,18 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return compareDpkgVersion(pB->m_epoch, pB->m_version, pB->m_revision) == 0;
+        return *this == *pB;
+    }
+
+    /**
+     * @brief Comparison operator == with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool operator==(const VersionObjectDpkg& b) const
+    {
+        return compareDpkgVersion(b.m_epoch, b.m_version, b.m_revision) == 0;
     }
 
     /**
@@ -325,7 +336,18 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return compareDpkgVersion(pB->m_epoch, pB->m_version, pB->m_revision) < 0;
+        return *this < *pB;
+    }
+
+    /**
+     * @brief Comparison operator < with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const VersionObjectDpkg& b) const
+    {
+        return compareDpkgVersion(b.m_epoch, b.m_version, b.m_revision) < 0;
     }
 };
 
@@ -98,7 +98,18 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return (m_major == pB->m_major && m_minor == pB->m_minor);
+        return *this == *pB;
+    }
+
+    /**
+     * @brief Comparison operator == with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool operator==(const VersionObjectMajorMinor& b) const
+    {
+        return (m_major == b.m_major && m_minor == b.m_minor);
     }
 
     /**
@@ -114,17 +125,27 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
+        return *this < *pB;
+    }
 
-        if (m_major < pB->m_major)
+    /**
+     * @brief Comparison operator < with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const VersionObjectMajorMinor& b) const
+    {
+        if (m_major < b.m_major)
         {
             return true;
         }
-        else if (m_major > pB->m_major)
+        else if (m_major > b.m_major)
         {
             return false;
         }
 
-        return m_minor < pB->m_minor;
+        return m_minor < b.m_minor;
     }
 };
 
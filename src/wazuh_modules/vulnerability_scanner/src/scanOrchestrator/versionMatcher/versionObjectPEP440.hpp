@@ -15,9 +15,12 @@
 #include "iVersionObjectInterface.hpp"
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <initializer_list>
 #include <memory>
-#include <regex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 /**
  * @brief PEP440 data struct.
@@ -43,8 +46,6 @@ struct PEP440
 class VersionObjectPEP440 final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
-    static std::regex m_parserVersionStrRegex;
     uint32_t m_epoch;
     std::string m_versionStr;
     std::string m_preReleaseStr;
@@ -56,53 +57,121 @@ private:
     bool m_hasDevRelease;
 
     /**
-     * @brief Comparison method for the versionStr variable members.
+     * @brief Converts a run of digits to a number, with the same truncation as std::stoul casted to uint32_t.
      *
-     * @param versionStrA versionStr member of object A.
-     * @param versionStrB versionStr member of object B.
-     * @return 0  if A is equal to B.
-     *         -1 if A is less than B.
-     *         1  if A is greater than B.
+     * @param digits digits to convert, empty is 0.
+     * @return uint32_t number.
      */
-    static int compareVersionStr(const std::string& versionStrA, const std::string& versionStrB)
+    static uint32_t toNumber(std::string_view digits)
     {
-        std::deque<uint32_t> versionStrSplitA;
-        std::sregex_token_iterator itA(versionStrA.begin(), versionStrA.end(), m_parserVersionStrRegex, -1);
-        std::sregex_token_iterator itEndA;
-        while (itA != itEndA)
+        unsigned long value {0};
+        if (std::from_chars(digits.data(), digits.data() + digits.size(), value).ec == std::errc::result_out_of_range)
         {
-            versionStrSplitA.push_back(static_cast<uint32_t>(std::stoul(itA->str())));
-            itA++;
+            throw std::out_of_range {"PEP440 version number out of range"};
         }
+        return static_cast<uint32_t>(value);
+    }
 
-        std::deque<uint32_t> versionStrSplitB;
-        std::sregex_token_iterator itB(versionStrB.begin(), versionStrB.end(), m_parserVersionStrRegex, -1);
-        std::sregex_token_iterator itEndB;
-        while (itB != itEndB)
+    /**
+     * @brief Consumes the digits starting at pos.
+     *
+     * @param str string to scan.
+     * @param pos position to start, moved after the digits.
+     * @return std::string_view digits consumed, empty if there are none.
+     */
+    static std::string_view scanDigits(std::string_view str, size_t& pos)
+    {
+        const auto start = pos;
+        while (pos < str.size() && std::isdigit(static_cast<unsigned char>(str[pos])))
         {
-            versionStrSplitB.push_back(static_cast<uint32_t>(std::stoul(itB->str())));
-            itB++;
+            ++pos;
         }
+        return str.substr(start, pos - start);
+    }
 
-        while (versionStrSplitA.size() < versionStrSplitB.size())
+    /**
+     * @brief Consumes an optional separator (-, _ or .) at pos.
+     */
+    static void skipSeparator(std::string_view str, size_t& pos)
+    {
+        if (pos < str.size() && (str[pos] == '-' || str[pos] == '_' || str[pos] == '.'))
         {
-            versionStrSplitA.push_back(0);
+            ++pos;
         }
+    }
 
-        while (versionStrSplitB.size() < versionStrSplitA.size())
+    /**
+     * @brief Consumes the first of the labels found at pos, case insensitive.
+     *
+     * @param str string to scan.
+     * @param pos position to start, moved after the label if one is found.
+     * @param labels labels to look for, a label must come before its prefixes.
+     * @return std::string_view label found, empty if none.
+     */
+    static std::string_view scanLabel(std::string_view str, size_t& pos, std::initializer_list<std::string_view> labels)
+    {
+        for (const auto& label : labels)
         {
-            versionStrSplitB.push_back(0);
+            if (str.size() - pos >= label.size() &&
+                std::equal(label.begin(),
+                           label.end(),
+                           str.begin() + pos,
+                           [](char l, char c) { return l == std::tolower(static_cast<unsigned char>(c)); }))
+            {
+                pos += label.size();
+                return label;
+            }
         }
+        return {};
+    }
 
-        for (size_t itemIdx = 0; itemIdx < versionStrSplitA.size(); itemIdx++)
+    /**
+     * @brief Returns the next item of a release version string and moves pos after it, 0 when there are no more.
+     */
+    static uint32_t nextVersionItem(const std::string& versionStr, size_t& pos)
+    {
+        if (pos >= versionStr.size())
         {
-            if (versionStrSplitA[itemIdx] < versionStrSplitB[itemIdx])
-            {
-                return -1;
-            }
-            if (versionStrSplitA[itemIdx] > versionStrSplitB[itemIdx])
+            return 0;
+        }
+        auto end = versionStr.find('.', pos);
+        if (end == std::string::npos)
+        {
+            end = versionStr.size();
+        }
+        const auto item = toNumber(std::string_view {versionStr}.substr(pos, end - pos));
+        pos = end + 1;
+        return item;
+    }
+
+    /**
+     * @brief Comparison method for the versionStr variable members.
+     *
+     * @details The missing trailing items count as 0, so 1.0 is equal to 1.0.0. An empty version string (the
+     * version "v" or "") can't be compared.
+     *
+     * @param versionStrA versionStr member of object A.
+     * @param versionStrB versionStr member of object B.
+     * @return 0  if A is equal to B.
+     *         -1 if A is less than B.
+     *         1  if A is greater than B.
+     */
+    static int compareVersionStr(const std::string& versionStrA, const std::string& versionStrB)
+    {
+        if (versionStrA.empty() || versionStrB.empty())
+        {
+            throw std::invalid_argument {"Empty PEP440 release version"};
+        }
+
+        size_t posA {0};
+        size_t posB {0};
+        while (posA < versionStrA.size() || posB < versionStrB.size())
+        {
+            const auto itemA = nextVersionItem(versionStrA, posA);
+            const auto itemB = nextVersionItem(versionStrB, posB);
+            if (itemA != itemB)
             {
-                return 1;
+                return itemA < itemB ? -1 : 1;
             }
         }
 
@@ -112,6 +181,12 @@ private:
 public:
     /**
      * @brief Match string for PEP440 version.
+     *
+     * @details Supports the alternative syntax as well as the canonical form, case insensitive:
+     * v?[N!]N(.N)*[{-_.}{a|b|c|rc|alpha|beta|pre|preview}{-_.}N][-N|{-_.}{post|rev|r}{-_.}N][{-_.}dev{-_.}N]
+     * where every separator and number between brackets of a segment is optional. The pre-release labels are
+     * normalized to a, b and rc.
+     *
      * @param version version string to match.
      * @param data PEP440 struct.
      *
@@ -119,57 +194,109 @@ public:
      */
     static bool match(const std::string& version, PEP440& data)
     {
-        std::smatch parserMatches;
-        if (!std::regex_match(version, parserMatches, m_parserRegex))
+        const std::string_view str {version};
+        size_t pos {0};
+
+        data.epoch = 0;
+        data.versionStr.clear();
+        data.preReleaseStr.clear();
+        data.preReleaseNumber = 0;
+        data.postReleaseNumber = 0;
+        data.devReleaseNumber = 0;
+        data.hasPreRelease = false;
+        data.hasPostRelease = false;
+        data.hasDevRelease = false;
+
+        if (pos < str.size() && std::tolower(static_cast<unsigned char>(str[pos])) == 'v')
         {
-            return false;
+            ++pos;
+        }
+        // Everything after the prefix is optional
+        if (pos == str.size())
+        {
+            return true;
         }
 
-        // Epoch
-        data.epoch = parserMatches.str(1).empty() ? 0 : static_cast<uint32_t>(std::stoul(parserMatches.str(1)));
-
-        // Release version string
-        data.versionStr = parserMatches.str(2);
+        // Epoch, then the release version string
+        auto release = scanDigits(str, pos);
+        if (release.empty())
+        {
+            return false;
+        }
+        if (pos < str.size() && str[pos] == '!')
+        {
+            data.epoch = toNumber(release);
+            ++pos;
+            if (release = scanDigits(str, pos); release.empty())
+            {
+                return false;
+            }
+        }
+        const auto releaseStart = static_cast<size_t>(release.data() - str.data());
+        while (pos + 1 < str.size() && str[pos] == '.' && std::isdigit(static_cast<unsigned char>(str[pos + 1])))
+        {
+            ++pos;
+            scanDigits(str, pos);
+        }
+        data.versionStr.assign(str.substr(releaseStart, pos - releaseStart));
 
         // Pre-release
-        data.hasPreRelease = parserMatches[3].matched;
-        if (data.hasPreRelease)
+        auto segment = pos;
+        skipSeparator(str, segment);
+        if (const auto label = scanLabel(str, segment, {"preview", "alpha", "beta", "pre", "rc", "a", "b", "c"});
+            !label.empty())
         {
-            data.preReleaseStr = parserMatches.str(3);
-            std::transform(data.preReleaseStr.begin(), data.preReleaseStr.end(), data.preReleaseStr.begin(), ::tolower);
-            if (data.preReleaseStr == "alpha")
+            data.hasPreRelease = true;
+            if (label == "alpha" || label == "a")
             {
                 data.preReleaseStr = "a";
             }
-            else if (data.preReleaseStr == "beta")
+            else if (label == "beta" || label == "b")
             {
                 data.preReleaseStr = "b";
             }
-            else if (data.preReleaseStr == "c" || data.preReleaseStr == "pre" || data.preReleaseStr == "preview")
+            else
             {
                 data.preReleaseStr = "rc";
             }
+            skipSeparator(str, segment);
+            data.preReleaseNumber = toNumber(scanDigits(str, segment));
+            pos = segment;
         }
-        data.preReleaseNumber = parserMatches.str(4).empty() ? 0 : std::stoul(parserMatches.str(4));
-
-        // Post release
-        data.hasPostRelease = parserMatches[6].matched || parserMatches[5].matched;
 
-        if (parserMatches[5].matched)
+        // Post release, implicit (-N) or explicit
+        segment = pos;
+        if (segment + 1 < str.size() && str[segment] == '-' && std::isdigit(static_cast<unsigned char>(str[segment + 1])))
         {
-            data.postReleaseNumber = std::stoul(parserMatches.str(5));
+            ++segment;
+            data.hasPostRelease = true;
+            data.postReleaseNumber = toNumber(scanDigits(str, segment));
+            pos = segment;
         }
         else
         {
-            data.postReleaseNumber = parserMatches.str(7).empty() ? 0 : std::stoul(parserMatches.str(7));
+            skipSeparator(str, segment);
+            if (!scanLabel(str, segment, {"post", "rev", "r"}).empty())
+            {
+                data.hasPostRelease = true;
+                skipSeparator(str, segment);
+                data.postReleaseNumber = toNumber(scanDigits(str, segment));
+                pos = segment;
+            }
         }
 
         // Development release
-        data.hasDevRelease = parserMatches[8].matched;
-
-        data.devReleaseNumber = parserMatches.str(9).empty() ? 0 : std::stoul(parserMatches.str(9));
+        segment = pos;
+        skipSeparator(str, segment);
+        if (!scanLabel(str, segment, {"dev"}).empty())
+        {
+            data.hasDevRelease = true;
+            skipSeparator(str, segment);
+            data.devReleaseNumber = toNumber(scanDigits(str, segment));
+            pos = segment;
+        }
 
-        return true;
+        return pos == str.size();
     }
 
     /**
@@ -216,11 +343,22 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return (m_epoch == pB->m_epoch && !compareVersionStr(m_versionStr, pB->m_versionStr) &&
-                m_preReleaseStr == pB->m_preReleaseStr && m_preReleaseNumber == pB->m_preReleaseNumber &&
-                m_postReleaseNumber == pB->m_postReleaseNumber && m_devReleaseNumber == pB->m_devReleaseNumber &&
-                m_hasPreRelease == pB->m_hasPreRelease && m_hasPostRelease == pB->m_hasPostRelease &&
-                m_hasDevRelease == pB->m_hasDevRelease);
+        return *this == *pB;
+    }
+
+    /**
+     * @brief Comparison operator == with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool operator==(const VersionObjectPEP440& b) const
+    {
+        return (m_epoch == b.m_epoch && !compareVersionStr(m_versionStr, b.m_versionStr) &&
+                m_preReleaseStr == b.m_preReleaseStr && m_preReleaseNumber == b.m_preReleaseNumber &&
+                m_postReleaseNumber == b.m_postReleaseNumber && m_devReleaseNumber == b.m_devReleaseNumber &&
+                m_hasPreRelease == b.m_hasPreRelease && m_hasPostRelease == b.m_hasPostRelease &&
+                m_hasDevRelease == b.m_hasDevRelease);
     }
 
     /**
@@ -236,17 +374,27 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
+        return *this < *pB;
+    }
 
-        if (m_epoch < pB->m_epoch)
+    /**
+     * @brief Comparison operator < with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const VersionObjectPEP440& b) const
+    {
+        if (m_epoch < b.m_epoch)
         {
             return true;
         }
-        else if (m_epoch > pB->m_epoch)
+        else if (m_epoch > b.m_epoch)
         {
             return false;
         }
 
-        int resultVersionStr = compareVersionStr(m_versionStr, pB->m_versionStr);
+        int resultVersionStr = compareVersionStr(m_versionStr, b.m_versionStr);
         if (resultVersionStr < 0)
         {
             return true;
@@ -256,17 +404,17 @@ public:
             return false;
         }
 
-        if (m_hasPreRelease && pB->m_hasPreRelease == false)
+        if (m_hasPreRelease && b.m_hasPreRelease == false)
         {
             return true;
         }
-        else if (m_hasPreRelease == false && pB->m_hasPreRelease)
+        else if (m_hasPreRelease == false && b.m_hasPreRelease)
         {
             return false;
         }
-        else if (m_hasPreRelease && pB->m_hasPreRelease)
+        else if (m_hasPreRelease && b.m_hasPreRelease)
         {
-            int resultPreReleaseStr = m_preReleaseStr.compare(pB->m_preReleaseStr);
+            int resultPreReleaseStr = m_preReleaseStr.compare(b.m_preReleaseStr);
             if (resultPreReleaseStr < 0)
             {
                 return true;
@@ -276,51 +424,51 @@ public:
                 return false;
             }
 
-            if (m_preReleaseNumber < pB->m_preReleaseNumber)
+            if (m_preReleaseNumber < b.m_preReleaseNumber)
             {
                 return true;
             }
-            else if (m_preReleaseNumber > pB->m_preReleaseNumber)
+            else if (m_preReleaseNumber > b.m_preReleaseNumber)
             {
                 return false;
             }
         }
 
-        if (m_hasPostRelease && pB->m_hasPostRelease == false)
+        if (m_hasPostRelease && b.m_hasPostRelease == false)
         {
             return false;
         }
-        else if (m_hasPostRelease == false && pB->m_hasPostRelease)
+        else if (m_hasPostRelease == false && b.m_hasPostRelease)
         {
             return true;
         }
-        else if (m_hasPostRelease && pB->m_hasPostRelease)
+        else if (m_hasPostRelease && b.m_hasPostRelease)
         {
-            if (m_postReleaseNumber < pB->m_postReleaseNumber)
+            if (m_postReleaseNumber < b.m_postReleaseNumber)
             {
                 return true;
             }
-            else if (m_postReleaseNumber > pB->m_postReleaseNumber)
+            else if (m_postReleaseNumber > b.m_postReleaseNumber)
             {
                 return false;
             }
         }
 
-        if (m_hasDevRelease && pB->m_hasDevRelease == false)
+        if (m_hasDevRelease && b.m_hasDevRelease == false)
         {
             return false;
         }
-        else if (m_hasDevRelease == false && pB->m_hasDevRelease)
+        else if (m_hasDevRelease == false && b.m_hasDevRelease)
         {
             return true;
         }
-        else if (m_hasDevRelease && pB->m_hasDevRelease)
+        else if (m_hasDevRelease && b.m_hasDevRelease)
         {
-            if (m_devReleaseNumber < pB->m_devReleaseNumber)
+            if (m_devReleaseNumber < b.m_devReleaseNumber)
             {
                 return true;
             }
-            else if (m_devReleaseNumber > pB->m_devReleaseNumber)
+            else if (m_devReleaseNumber > b.m_devReleaseNumber)
             {
                 return false;
             }
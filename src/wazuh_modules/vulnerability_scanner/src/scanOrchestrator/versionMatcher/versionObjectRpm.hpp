@@ -371,8 +371,18 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
+        return *this == *pB;
+    }
 
-        return compareRpmVersion(pB->m_epoch, pB->m_version, pB->m_release) == LEFT_EQ_RIGHT;
+    /**
+     * @brief Comparison operator == with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool operator==(const VersionObjectRpm& b) const
+    {
+        return compareRpmVersion(b.m_epoch, b.m_version, b.m_release) == LEFT_EQ_RIGHT;
     }
 
     /**
@@ -388,8 +398,18 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
+        return *this < *pB;
+    }
 
-        return compareRpmVersion(pB->m_epoch, pB->m_version, pB->m_release) == RIGHT_IS_NEWER;
+    /**
+     * @brief Comparison operator < with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const VersionObjectRpm& b) const
+    {
+        return compareRpmVersion(b.m_epoch, b.m_version, b.m_release) == RIGHT_IS_NEWER;
     }
 };
 
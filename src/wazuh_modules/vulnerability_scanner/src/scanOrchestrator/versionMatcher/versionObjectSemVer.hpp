@@ -109,8 +109,19 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return (m_major == pB->m_major && m_minor == pB->m_minor && m_patch == pB->m_patch &&
-                m_preRelease == pB->m_preRelease);
+        return *this == *pB;
+    }
+
+    /**
+     * @brief Comparison operator == with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool operator==(const VersionObjectSemVer& b) const
+    {
+        return (m_major == b.m_major && m_minor == b.m_minor && m_patch == b.m_patch &&
+                m_preRelease == b.m_preRelease);
     }
 
     /**
@@ -126,41 +137,51 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
+        return *this < *pB;
+    }
 
-        if (m_major < pB->m_major)
+    /**
+     * @brief Comparison operator < with an object of the same type, without the cast.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const VersionObjectSemVer& b) const
+    {
+        if (m_major < b.m_major)
         {
             return true;
         }
-        else if (m_major > pB->m_major)
+        else if (m_major > b.m_major)
         {
             return false;
         }
 
-        if (m_minor < pB->m_minor)
+        if (m_minor < b.m_minor)
         {
             return true;
         }
-        else if (m_minor > pB->m_minor)
+        else if (m_minor > b.m_minor)
         {
             return false;
         }
 
-        if (m_patch < pB->m_patch)
+        if (m_patch < b.m_patch)
         {
             return true;
         }
-        else if (m_patch > pB->m_patch)
+        else if (m_patch > b.m_patch)
         {
             return false;
         }
 
-        if (!m_preRelease.empty() && pB->m_preRelease.empty())
+        if (!m_preRelease.empty() && b.m_preRelease.empty())
         {
             return true;
         }
-        else if (!m_preRelease.empty() && !pB->m_preRelease.empty())
+        else if (!m_preRelease.empty() && !b.m_preRelease.empty())
         {
-            if (m_preRelease.compare(pB->m_preRelease) < 0)
+            if (m_preRelease.compare(b.m_preRelease) < 0)
             {
                 return true;
             }
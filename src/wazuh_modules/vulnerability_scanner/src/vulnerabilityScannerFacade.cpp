@@ -10,8 +10,10 @@
  */
 
 #include "vulnerabilityScannerFacade.hpp"
+#include "agentPackageIndex.hpp"
 #include "agentReScanListException.hpp"
 #include "archiveHelper.hpp"
+#include "cachePolicyObserver.hpp"
 #include "defs.h"
 #include "loggerHelper.h"
 #include "messageBuffer_generated.h"
@@ -463,6 +465,9 @@ void VulnerabilityScannerFacade::start(
             logDebug1(WM_VULNSCAN_LOGTAG, "Updated %s key of %s.", VD_DATABASE_VERSION_KEY, VD_STATE_QUEUE_PATH);
         }
 
+        // Index of the agents of each package, to re-scan only the agents affected by a content update.
+        AgentPackageIndex::instance().initialize();
+
         // Database feed manager initialization.
         m_databaseFeedManager = std::make_shared<DatabaseFeedManager>(
             m_indexerConnector,
@@ -471,11 +476,37 @@ void VulnerabilityScannerFacade::start(
             true,
             reloadGlobalMapsStartup,
             initContentUpdater,
-            [this, reloadGlobalMapsStartup]()
+            [this, reloadGlobalMapsStartup](const FeedUpdateChanges& changes)
             {
                 // Re-scan all agent after content update, only if is an instance of vulnerability scanner.
                 if (reloadGlobalMapsStartup)
                 {
+                    // Only the agents with the changed candidates are re-scanned if the index knows them.
+                    if (auto& packageIndex = AgentPackageIndex::instance();
+                        !changes.fullScanRequired && packageIndex.isComplete())
+                    {
+                        const auto agents = packageIndex.agents(changes.candidates);
+                        for (const auto& agentId : agents)
+                        {
+                            nlohmann::json actionData;
+                            actionData["action"] = "scanAgent";
+                            actionData["agent_info"]["agent_id"] = agentId;
+                            // We shouldn't index if we are in a cluster environment
+                            actionData["no-index"] = PolicyManager::instance().getClusterStatus();
+
+                            const std::string actionDataString = actionData.dump();
+                            const std::vector<char> actionMessage(actionDataString.begin(), actionDataString.end());
+
+                            pushEvent(actionMessage, BufferType::BufferType_JSON);
+                        }
+                        logInfo(WM_VULNSCAN_LOGTAG,
+                                "Triggered a re-scan of %zu agents affected by %zu changed packages after content "
+                                "update.",
+                                agents.size(),
+                                changes.candidates.size());
+                        return;
+                    }
+
                     nlohmann::json actionData;
                     actionData["action"] = "reboot";
                     // We shouldn't index if we are in a cluster environment
@@ -491,6 +522,7 @@ void VulnerabilityScannerFacade::start(
 
         // Add subscribers for policy updates.
         policyManager.addSubscriber(m_databaseFeedManager);
+        policyManager.addSubscriber(std::make_shared<CachePolicyObserver>());
 
         // Event dispatcher initialization.
         initEventDispatcher();
@@ -540,6 +572,7 @@ void VulnerabilityScannerFacade::stop()
     PolicyManager::instance().teardown();
     m_reportDispatcher.reset();
     m_eventDispatcher.reset();
+    AgentPackageIndex::instance().teardown();
 
     // Destroy socketDbWrapper
     SocketDBWrapper::instance().teardown();
@@ -76,6 +76,20 @@ public:
                                           const NSVulnerabilityScanner::ScanVulnerabilityCandidate&)>& callback),
                 ());
 
+    /**
+     * @brief Mock method for getVulnerabilitiesCandidatesBatch.
+     *
+     * @note This method is intended for testing purposes and does not perform any real action.
+     */
+    MOCK_METHOD(void,
+                getVulnerabilitiesCandidatesBatch,
+                (const std::string& cnaName,
+                 const std::vector<PackageData>& packages,
+                 const std::function<bool(const std::string& cnaName,
+                                          const PackageData& package,
+                                          const NSVulnerabilityScanner::ScanVulnerabilityCandidate&)>& callback),
+                ());
+
     /**
      * @brief Mock method for getCVEDatabase.
      *
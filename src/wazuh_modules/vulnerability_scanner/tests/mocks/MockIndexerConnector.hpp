@@ -13,6 +13,8 @@
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include <string>
+#include <vector>
 
 /**
  * @class MockIndexerConnector
@@ -39,6 +41,13 @@ public:
      */
     MOCK_METHOD(void, publish, (const std::string& message), (const));
 
+    /**
+     * @brief Mock method for publishing a batch.
+     *
+     * @note This method is intended for testing purposes and does not perform any real action.
+     */
+    MOCK_METHOD(void, publish, (const std::vector<std::string>& messages), (const));
+
     /**
      * @brief Mock method for syncing.
      *
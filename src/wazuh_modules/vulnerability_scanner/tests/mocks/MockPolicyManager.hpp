@@ -214,6 +214,13 @@ public:
      * @note This method is intended for testing purposes and does not perform any real action.
      */
     MOCK_METHOD(uint32_t, getRemediationLRUSize, (), (const));
+
+    /**
+     * @brief Mock method for getDescriptionLRUSize.
+     *
+     * @note This method is intended for testing purposes and does not perform any real action.
+     */
+    MOCK_METHOD(uint32_t, getDescriptionLRUSize, (), (const));
 };
 
 #endif // _MOCK_POLICYMANAGER_HPP
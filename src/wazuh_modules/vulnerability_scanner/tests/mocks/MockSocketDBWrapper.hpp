@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include "json.hpp"
+#include <functional>
 
 /**
  * @class MockSocketDBWrapper
@@ -52,6 +53,13 @@ public:
      */
     MOCK_METHOD(void, query, (const std::string& query, nlohmann::json& response), ());
 
+    /**
+     * @brief Mock method for query with a callback for each row of the response.
+     *
+     * @note This method is intended for testing purposes and does not perform any real action.
+     */
+    MOCK_METHOD(void, queryRows, (const std::string& query, std::function<void(nlohmann::json&&)> onRow), ());
+
     /**
      * @brief Mock method for init.
      *
@@ -42,6 +42,16 @@ public:
         spIndexerConnectorMock->publish(message);
     }
 
+    /**
+     * @brief Publish a batch of messages into the queue map.
+     *
+     * @param messages Messages to be published.
+     */
+    void publish(const std::vector<std::string>& messages) const
+    {
+        spIndexerConnectorMock->publish(messages);
+    }
+
     /**
      * @brief Sync the agent with the indexer.
      *
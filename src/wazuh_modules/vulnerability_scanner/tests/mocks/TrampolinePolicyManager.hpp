@@ -309,6 +309,16 @@ public:
     {
         return spPolicyManagerMock->getRemediationLRUSize();
     }
+
+    /**
+     * @brief Get vulnerability description LRU size.
+     *
+     * @return uint32_t vulnerability description LRU size.
+     */
+    uint32_t getDescriptionLRUSize() const
+    {
+        return spPolicyManagerMock->getDescriptionLRUSize();
+    }
 };
 
 #endif //_TRAMPOLINE_POLICYMANAGER_HPP
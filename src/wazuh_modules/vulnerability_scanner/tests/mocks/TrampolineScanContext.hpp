@@ -67,6 +67,24 @@ public:
     {
         return spScanContext->agentId();
     }
+
+    /**
+     * @brief Gets the message type.
+     * @return Message type.
+     */
+    MessageType messageType() const
+    {
+        return spScanContext->messageType();
+    }
+
+    /**
+     * @brief Gets package id.
+     * @return Package id.
+     */
+    std::string_view packageItemId() const
+    {
+        return spScanContext->packageItemId();
+    }
 };
 
 #endif // _TRAMPOLINE_SCANCONTEXT_HPP
@@ -45,6 +45,17 @@ public:
         spSocketDBWrapperMock->query(query, response);
     }
 
+    /**
+     * @brief Mock method for a query with a callback for each row of the response.
+     *
+     * @param query DB query string.
+     * @param onRow Callback called for every row of the response.
+     */
+    void query(const std::string& query, std::function<void(nlohmann::json&&)> onRow)
+    {
+        spSocketDBWrapperMock->queryRows(query, std::move(onRow));
+    }
+
     /**
      * @brief Mock method for initializing the orchestrator.
      *
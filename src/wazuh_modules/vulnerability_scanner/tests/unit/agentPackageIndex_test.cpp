@@ -0,0 +1,66 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "agentPackageIndex_test.hpp"
+#include "../../src/scanOrchestrator/agentPackageIndex.hpp"
+
+TEST_F(AgentPackageIndexTest, DisabledUntilInitialized)
+{
+    auto& packageIndex = AgentPackageIndex::instance();
+
+    EXPECT_NO_THROW(packageIndex.insert("nvd", "bash", "001"));
+    EXPECT_NO_THROW(packageIndex.markComplete());
+    EXPECT_FALSE(packageIndex.isComplete());
+    EXPECT_TRUE(packageIndex.agents({"nvd_bash"}).empty());
+}
+
+TEST_F(AgentPackageIndexTest, AgentsOfCandidates)
+{
+    auto& packageIndex = AgentPackageIndex::instance();
+    packageIndex.initialize(TEST_PACKAGE_INDEX_PATH);
+
+    packageIndex.insert("nvd", "bash", "001");
+    packageIndex.insert("nvd", "bash", "002");
+    packageIndex.insert("nvd", "bash_completion", "003");
+    packageIndex.insert("debian", "bash", "004");
+    packageIndex.insert("nvd", "firefox", "005");
+    packageIndex.insert("nvd", "bash", "001");
+
+    EXPECT_EQ(packageIndex.agents({"nvd_bash"}), (std::unordered_set<std::string> {"001", "002"}));
+    EXPECT_EQ(packageIndex.agents({"nvd_bash", "debian_bash"}),
+              (std::unordered_set<std::string> {"001", "002", "004"}));
+    EXPECT_EQ(packageIndex.agents({"nvd_bash_completion"}), (std::unordered_set<std::string> {"003"}));
+    EXPECT_TRUE(packageIndex.agents({"nvd_vim"}).empty());
+
+    packageIndex.teardown();
+}
+
+TEST_F(AgentPackageIndexTest, CompleteUntilCleared)
+{
+    auto& packageIndex = AgentPackageIndex::instance();
+    packageIndex.initialize(TEST_PACKAGE_INDEX_PATH);
+
+    EXPECT_FALSE(packageIndex.isComplete());
+    packageIndex.insert("nvd", "bash", "001");
+    packageIndex.markComplete();
+    EXPECT_TRUE(packageIndex.isComplete());
+
+    // The state is kept in the database
+    packageIndex.teardown();
+    packageIndex.initialize(TEST_PACKAGE_INDEX_PATH);
+    EXPECT_TRUE(packageIndex.isComplete());
+
+    packageIndex.clear();
+    EXPECT_FALSE(packageIndex.isComplete());
+    EXPECT_TRUE(packageIndex.agents({"nvd_bash"}).empty());
+
+    packageIndex.teardown();
+}
@@ -0,0 +1,41 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _AGENT_PACKAGE_INDEX_TEST_HPP
+#define _AGENT_PACKAGE_INDEX_TEST_HPP
+
+#include "gtest/gtest.h"
+#include <filesystem>
+
+const std::string TEST_PACKAGE_INDEX_PATH {"queue/vd/package_index_test"};
+
+/**
+ * @brief Runs unit tests for AgentPackageIndex class.
+ */
+class AgentPackageIndexTest : public ::testing::Test
+{
+protected:
+    // LCOV_EXCL_START
+    AgentPackageIndexTest() = default;
+    ~AgentPackageIndexTest() override = default;
+
+    /**
+     * @brief Clean up method after every test execution.
+     *
+     */
+    void TearDown() override
+    {
+        std::filesystem::remove_all(TEST_PACKAGE_INDEX_PATH);
+    }
+    // LCOV_EXCL_STOP
+};
+
+#endif // _AGENT_PACKAGE_INDEX_TEST_HPP
@@ -81,7 +81,7 @@ TEST_F(ArrayResultIndexerTest, TestHandleRequest)
     auto elementValue = nlohmann::json::parse(R"({"id": "id_test", "operation":"INSERTED"})");
 
     spIndexerConnectorMock = std::make_shared<MockIndexerConnector>();
-    EXPECT_CALL(*spIndexerConnectorMock, publish(elementValue.dump())).Times(1);
+    EXPECT_CALL(*spIndexerConnectorMock, publish(std::vector<std::string> {elementValue.dump()})).Times(1);
 
     auto pIndexerConnectorTrap = std::make_shared<TrampolineIndexerConnector>();
 
@@ -129,7 +129,7 @@ TEST_F(ArrayResultIndexerTest, TestHandleRequestNoOperation)
     auto elementValue = nlohmann::json::parse(R"({"id": "id_test"})");
 
     spIndexerConnectorMock = std::make_shared<MockIndexerConnector>();
-    EXPECT_CALL(*spIndexerConnectorMock, publish(elementValue.dump())).Times(0);
+    EXPECT_CALL(*spIndexerConnectorMock, publish(testing::A<const std::vector<std::string>&>())).Times(0);
 
     auto pIndexerConnectorTrap = std::make_shared<TrampolineIndexerConnector>();
 
@@ -175,7 +175,7 @@ TEST_F(ArrayResultIndexerTest, TestHandleRequestNoId)
     auto elementValue = nlohmann::json::parse(R"({"operation":"INSERTED"})");
 
     spIndexerConnectorMock = std::make_shared<MockIndexerConnector>();
-    EXPECT_CALL(*spIndexerConnectorMock, publish(elementValue.dump())).Times(0);
+    EXPECT_CALL(*spIndexerConnectorMock, publish(testing::A<const std::vector<std::string>&>())).Times(0);
 
     auto pIndexerConnectorTrap = std::make_shared<TrampolineIndexerConnector>();
 
@@ -221,7 +221,7 @@ TEST_F(ArrayResultIndexerTest, PublishObjectInsteadOfArray)
     auto elementValue = nlohmann::json::parse(R"({"operation":"INSERTED"})");
 
     spIndexerConnectorMock = std::make_shared<MockIndexerConnector>();
-    EXPECT_CALL(*spIndexerConnectorMock, publish(elementValue.dump())).Times(0);
+    EXPECT_CALL(*spIndexerConnectorMock, publish(testing::A<const std::vector<std::string>&>())).Times(0);
 
     auto pIndexerConnectorTrap = std::make_shared<TrampolineIndexerConnector>();
 
@@ -14,9 +14,27 @@
 #include "TrampolineRemediationDataCache.hpp"
 #include "TrampolineSocketDBWrapper.hpp"
 #include "buildAllAgentListContext.hpp"
+#include <set>
 
 using TrampolineScanContext = TScanContext<TrampolineOsDataCache, GlobalData, TrampolineRemediationDataCache>;
 
+/**
+ * @brief Action that hands the rows of a response to the callback of the query, one by one.
+ *
+ * @param rows Rows of the response.
+ */
+auto streamRows(const nlohmann::json& rows)
+{
+    return testing::Invoke(
+        [rows](const std::string& /*query*/, const std::function<void(nlohmann::json&&)>& onRow)
+        {
+            for (auto row : rows)
+            {
+                onRow(std::move(row));
+            }
+        });
+}
+
 const auto configClusterEnable = nlohmann::json::parse(R"(
     {
         "vulnerability-detection": {
@@ -52,7 +70,7 @@ TEST_F(BuildAllAgentListContextTest, BuildAllAgentListContext)
     policyManager->initialize(configClusterDisabled);
 
     spSocketDBWrapperMock = std::make_shared<MockSocketDBWrapper>();
-    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_)).Times(1);
+    EXPECT_CALL(*spSocketDBWrapperMock, queryRows(testing::_, testing::_)).Times(1);
 
     auto allAgentContext =
         std::make_shared<TBuildAllAgentListContext<TrampolineScanContext, TrampolineSocketDBWrapper>>();
@@ -76,9 +94,9 @@ TEST_F(BuildAllAgentListContextTest, BuildAllAgentListContextWithElements)
         }
     ])");
 
-    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_))
+    EXPECT_CALL(*spSocketDBWrapperMock, queryRows(testing::_, testing::_))
         .Times(1)
-        .WillOnce(testing::SetArgReferee<1>(queryResult));
+        .WillOnce(streamRows(queryResult));
 
     auto allAgentContext =
         std::make_shared<TBuildAllAgentListContext<TrampolineScanContext, TrampolineSocketDBWrapper>>();
@@ -110,9 +128,9 @@ TEST_F(BuildAllAgentListContextTest, MissingField)
     ])");
 
     // Set second argument to queryResult
-    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_))
+    EXPECT_CALL(*spSocketDBWrapperMock, queryRows(testing::_, testing::_))
         .Times(1)
-        .WillOnce(testing::SetArgReferee<1>(queryResult));
+        .WillOnce(streamRows(queryResult));
 
     auto allAgentContext =
         std::make_shared<TBuildAllAgentListContext<TrampolineScanContext, TrampolineSocketDBWrapper>>();
@@ -132,7 +150,7 @@ TEST_F(BuildAllAgentListContextTest, ExceptionOnDB)
 
     const std::string agentId {"1"};
 
-    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_))
+    EXPECT_CALL(*spSocketDBWrapperMock, queryRows(testing::_, testing::_))
         .Times(1)
         .WillOnce(testing::Throw(SocketDbWrapperException("Error on DB")));
 
@@ -165,9 +183,9 @@ TEST_F(BuildAllAgentListContextTest, BuildAllAgentListContextWithElementsInClust
         }
     ])");
 
-    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_))
+    EXPECT_CALL(*spSocketDBWrapperMock, queryRows(testing::_, testing::_))
         .Times(1)
-        .WillOnce(testing::SetArgReferee<1>(queryResult));
+        .WillOnce(streamRows(queryResult));
 
     auto allAgentContext =
         std::make_shared<TBuildAllAgentListContext<TrampolineScanContext, TrampolineSocketDBWrapper>>();
@@ -179,3 +197,51 @@ TEST_F(BuildAllAgentListContextTest, BuildAllAgentListContextWithElementsInClust
 
     EXPECT_EQ(scanContext->m_agents.size(), 1);
 }
+
+TEST_F(BuildAllAgentListContextTest, BuildAllAgentListContextPartitioned)
+{
+    nlohmann::json queryResult = nlohmann::json::array();
+    for (auto id = 0; id < 100; ++id)
+    {
+        queryResult.push_back({{"id", id}, {"name", "name"}, {"version", "Wazuh 4.8.0"}, {"ip", "192.168.0.1"}});
+    }
+
+    std::set<std::string> scannedAgents;
+    size_t scannedCount = 0;
+
+    for (const auto& nodeName : {"node_1", "node_2", "node_3"})
+    {
+        auto config = configClusterEnable;
+        config["clusterNodeName"] = nodeName;
+        config["clusterPartitionNodes"] = {"node_1", "node_2", "node_3"};
+        PolicyManager::instance().initialize(config);
+
+        spSocketDBWrapperMock = std::make_shared<MockSocketDBWrapper>();
+        EXPECT_CALL(*spSocketDBWrapperMock, queryRows(testing::_, testing::_))
+            .Times(1)
+            .WillOnce(streamRows(queryResult));
+
+        auto allAgentContext =
+            std::make_shared<TBuildAllAgentListContext<TrampolineScanContext, TrampolineSocketDBWrapper>>();
+        auto scanContext = std::make_shared<TrampolineScanContext>();
+
+        allAgentContext->handleRequest(scanContext);
+
+        // Each node scans a share of the agents.
+        EXPECT_GT(scanContext->m_agents.size(), 0);
+        EXPECT_LT(scanContext->m_agents.size(), 100);
+
+        for (const auto& agent : scanContext->m_agents)
+        {
+            scannedAgents.insert(agent.id);
+        }
+        scannedCount += scanContext->m_agents.size();
+
+        spSocketDBWrapperMock.reset();
+        PolicyManager::instance().teardown();
+    }
+
+    // Every agent is scanned by exactly one node.
+    EXPECT_EQ(scannedAgents.size(), 100);
+    EXPECT_EQ(scannedCount, 100);
+}
@@ -19,8 +19,11 @@
 #include "flatbuffers/idl.h"
 #include "routerModule.hpp"
 #include "routerProvider.hpp"
+#include <algorithm>
 #include <atomic>
 #include <filesystem>
+#include <map>
+#include <mutex>
 #include <string_view>
 
 using ::testing::_;
@@ -449,6 +452,82 @@ TEST_F(DatabaseFeedManagerTest, getVulnerabiltyDescriptiveInformation_Corrupted)
                  std::runtime_error);
 }
 
+TEST_F(DatabaseFeedManagerTest, getVulnerabiltyDescriptiveInformation_Cached)
+{
+    const auto configurationParameters = R"( {"topicName": "topicNameTest"} )"_json;
+
+    spIndexerConnectorMock = std::make_shared<MockIndexerConnector>();
+
+    spPolicyManagerMock = std::make_shared<MockPolicyManager>();
+    EXPECT_CALL(*spPolicyManagerMock, getUpdaterConfiguration()).WillRepeatedly(Return(configurationParameters));
+    EXPECT_CALL(*spPolicyManagerMock, getTranslationLRUSize()).WillRepeatedly(Return(2048));
+    EXPECT_CALL(*spPolicyManagerMock, getDescriptionLRUSize()).WillRepeatedly(Return(10));
+
+    spContentRegisterMock = std::make_shared<MockContentRegister>(
+        configurationParameters.at("topicName").get<const std::string>(), configurationParameters);
+
+    spRouterSubscriberMock = std::make_shared<MockRouterSubscriber>(
+        configurationParameters.at("topicName").get<const std::string>(), "vulnerability_feed_manager");
+    EXPECT_CALL(*spRouterSubscriberMock, subscribe(_));
+
+    flatbuffers::FlatBufferBuilder fbBuilder;
+    auto vdOriginalData = NSVulnerabilityScanner::CreateVulnerabilityDescriptionDirect(fbBuilder,
+                                                                                       "AccessComplexityStr",
+                                                                                       "AssignerStr",
+                                                                                       "AttackVectorStr",
+                                                                                       "AuthenticationStr",
+                                                                                       "AvailabilityStr",
+                                                                                       "ClassificationStr",
+                                                                                       "ConfidentialityImpactStr",
+                                                                                       "CWEIdStr",
+                                                                                       "DataPublishedStr",
+                                                                                       "DataUpdatedStr",
+                                                                                       "DescriptionStr",
+                                                                                       "IntegrityImpactStr",
+                                                                                       "PrivilegesRequiredStr",
+                                                                                       "ReferenceStr",
+                                                                                       "ScopeStr",
+                                                                                       999.99,
+                                                                                       "ScoreVersionStr",
+                                                                                       "SeverityStr",
+                                                                                       "UserInteractionStr");
+    fbBuilder.Finish(vdOriginalData);
+
+    {
+        auto dbWrapper = std::make_unique<Utils::RocksDBWrapper>(DATABASE_PATH);
+        rocksdb::Slice dbValue(reinterpret_cast<const char*>(fbBuilder.GetBufferPointer()), fbBuilder.GetSize());
+        if (!dbWrapper->columnExists(DESCRIPTIONS_COLUMN))
+        {
+            dbWrapper->createColumn(DESCRIPTIONS_COLUMN);
+        }
+        dbWrapper->put(CVEID_TEST_OK, dbValue, DESCRIPTIONS_COLUMN);
+    }
+
+    auto spTrampolineIndexerConnector = std::make_shared<TrampolineIndexerConnector>();
+    std::atomic<bool> shouldStop {false};
+    std::shared_mutex mutex;
+
+    auto spDatabaseFeedManager {std::make_shared<TDatabaseFeedManager<TrampolineIndexerConnector,
+                                                                      TrampolinePolicyManager,
+                                                                      TrampolineContentRegister,
+                                                                      TrampolineRouterSubscriber>>(
+        spTrampolineIndexerConnector, shouldStop, mutex)};
+
+    FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription> container;
+    EXPECT_NO_THROW(spDatabaseFeedManager->getVulnerabiltyDescriptiveInformation(CVEID_TEST_OK, container));
+
+    // The description is served from the cache once it is removed from the database.
+    spDatabaseFeedManager->getCVEDatabase().delete_(CVEID_TEST_OK, DESCRIPTIONS_COLUMN);
+
+    FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription> cachedContainer;
+    EXPECT_NO_THROW(spDatabaseFeedManager->getVulnerabiltyDescriptiveInformation(CVEID_TEST_OK, cachedContainer));
+    ASSERT_NE(cachedContainer.data, nullptr);
+    EXPECT_STREQ(cachedContainer.data->description()->c_str(), "DescriptionStr");
+    EXPECT_STREQ(cachedContainer.data->severity()->c_str(), "SeverityStr");
+    EXPECT_FLOAT_EQ(cachedContainer.data->scoreBase(), 999.99);
+    EXPECT_STREQ(container.data->description()->c_str(), "DescriptionStr");
+}
+
 TEST_F(DatabaseFeedManagerTest, DISABLED_GetVulnerabilityCandidatesSuccess)
 {
     const auto configurationParameters = R"( {"topicName": "topicNameTest"} )"_json;
@@ -1221,6 +1300,59 @@ TEST_F(DatabaseFeedManagerMessageProcessorTest, TestOffsetFileWithDataSuccess)
     EXPECT_NO_THROW(spDatabaseFeedManager->processMessage(message, "topicName", testingLambda1));
 }
 
+TEST_F(DatabaseFeedManagerMessageProcessorTest, TestOffsetFileAppliedInOrderPerResource)
+{
+    constexpr auto RESOURCES {8};
+    constexpr auto OFFSETS_PER_RESOURCE {300};
+
+    auto fileData = R"({"data": []})"_json;
+    for (auto offset = 0; offset < RESOURCES * OFFSETS_PER_RESOURCE; ++offset)
+    {
+        fileData["data"].push_back({{"resource", "CVE-2024-" + std::to_string(offset % RESOURCES)}, {"offset", offset}});
+    }
+
+    {
+        std::ofstream file {"file6.json"};
+        file << fileData.dump();
+    }
+
+    std::string stdMessage = R"({"type":"offsets","offset":1234,"paths":["file6.json"]})";
+    std::vector<char> message = std::vector<char>(stdMessage.begin(), stdMessage.end());
+
+    std::mutex appliedMutex;
+    std::map<std::string, std::vector<int>> applied;
+    auto testingLambda1 = [&](const nlohmann::json& obj, Utils::IRocksDBWrapper* dbWrapper)
+    {
+        std::scoped_lock lock(appliedMutex);
+        applied[obj.at("resource")].push_back(obj.at("offset"));
+    };
+    std::atomic<bool> shouldStop {false};
+    std::shared_mutex mutex;
+
+    const auto expectedOffsetPutData = R"({"topicName": "topicName", "offset": 2399})"_json;
+    EXPECT_CALL(MockUnixSocketRequest::instance(), put(_, expectedOffsetPutData, _, _)).Times(1);
+
+    auto spIndexerConnectorTramp = std::make_shared<TrampolineIndexerConnector>();
+    auto spDatabaseFeedManager {
+        std::make_shared<TDatabaseFeedManager<TrampolineIndexerConnector,
+                                              TrampolinePolicyManager,
+                                              TrampolineContentRegister,
+                                              RouterSubscriber,
+                                              MockUnixSocketRequest>>(spIndexerConnectorTramp, shouldStop, mutex)};
+
+    EXPECT_NO_THROW(spDatabaseFeedManager->processMessage(message, "topicName", testingLambda1));
+
+    // Every offset is applied once, and the offsets of each resource keep the order of the feed.
+    EXPECT_EQ(applied.size(), RESOURCES);
+    for (const auto& [resource, offsets] : applied)
+    {
+        EXPECT_EQ(offsets.size(), OFFSETS_PER_RESOURCE) << resource;
+        EXPECT_TRUE(std::is_sorted(offsets.begin(), offsets.end())) << resource;
+    }
+
+    std::remove("file6.json");
+}
+
 TEST_F(DatabaseFeedManagerMessageProcessorTest, TestOffsetFileWithDataSuccessButOffsetError)
 {
     std::string stdMessage = R"({"type":"offsets","offset":1234,"paths":["file3.json"]})";
@@ -661,6 +661,36 @@ TEST_F(EventDecoderTest, TestCreatedResource)
     EXPECT_EQ(nlohmann::json::parse(jsongen), jsonResource.at("payload"));
 }
 
+/*
+ * @brief Test a new resource after a resource with an invalid payload, the parser of the schema is reused.
+ */
+TEST_F(EventDecoderTest, TestCreatedResourceAfterInvalidPayload)
+{
+    std::vector<char> message {};
+    auto invalidResource = nlohmann::json::parse(CREATED_RESOURCE);
+    invalidResource["payload"]["cveMetadata"] = "invalid";
+    auto invalidEventContext = std::make_shared<EventContext>(
+        EventContext {.message = message, .resource = invalidResource, .feedDatabase = m_feedDb.get()});
+
+    auto jsonResource = nlohmann::json::parse(CREATED_RESOURCE);
+    auto eventContext = std::make_shared<EventContext>(
+        EventContext {.message = message, .resource = jsonResource, .feedDatabase = m_feedDb.get()});
+
+    auto eventDecoder = std::make_shared<EventDecoder>();
+
+    EXPECT_THROW(eventDecoder->handleRequest(invalidEventContext), std::runtime_error);
+    EXPECT_NO_THROW(eventDecoder->handleRequest(eventContext));
+    EXPECT_NO_THROW(eventDecoder->handleRequest(eventContext));
+
+    rocksdb::PinnableSlice slice;
+    EXPECT_TRUE(m_feedDb->get(CVE_ID, slice, COLUMNS.at(ResourceType::CVE)));
+
+    flatbuffers::Verifier verifierCVE5(reinterpret_cast<const uint8_t*>(slice.data()), slice.size());
+    EXPECT_TRUE(cve_v5::VerifyEntryBuffer(verifierCVE5));
+    ASSERT_NE(eventContext->cve5Buffer.data(), nullptr);
+    EXPECT_EQ(eventContext->cve5Buffer.size(), slice.size());
+}
+
 /*
  * @brief Test a new translation resource.
  */
@@ -809,3 +809,103 @@ TEST_F(EventDetailsBuilderTest, TestSuccessfulOsInserted)
     EXPECT_TRUE(elementData.at("vulnerability").at("detected_at").get_ref<const std::string&>() <=
                 Utils::getCurrentISO8601());
 }
+
+TEST_F(EventDetailsBuilderTest, TestCachedDetailsFollowDescriptionUpdates)
+{
+    auto buildDescription = [](flatbuffers::FlatBufferBuilder& fbBuilder, const char* description)
+    {
+        fbBuilder.Clear();
+        fbBuilder.Finish(NSVulnerabilityScanner::CreateVulnerabilityDescriptionDirect(fbBuilder,
+                                                                                      "accessComplexity_test_string",
+                                                                                      "assignerShortName_test_string",
+                                                                                      "attackVector_test_string",
+                                                                                      "authentication_test_string",
+                                                                                      "availabilityImpact_test_string",
+                                                                                      "classification_test_string",
+                                                                                      "confidentialityImpact_test_string",
+                                                                                      "cweId_test_string",
+                                                                                      "datePublished_test_string",
+                                                                                      "dateUpdated_test_string",
+                                                                                      description,
+                                                                                      "integrityImpact_test_string",
+                                                                                      "privilegesRequired_test_string",
+                                                                                      "reference_test_string",
+                                                                                      "scope_test_string",
+                                                                                      8.3,
+                                                                                      "2",
+                                                                                      "severity_test_string",
+                                                                                      "userInteraction_test_string"));
+    };
+
+    flatbuffers::FlatBufferBuilder fbBuilder;
+    buildDescription(fbBuilder, "description_test_string");
+
+    auto dbWrapper = std::make_unique<Utils::RocksDBWrapper>(TEST_DESCRIPTION_DATABASE_PATH);
+    dbWrapper->put(CVEID,
+                   rocksdb::Slice(reinterpret_cast<const char*>(fbBuilder.GetBufferPointer()), fbBuilder.GetSize()));
+
+    auto mockGetVulnerabiltyDescriptiveInformation =
+        [&](const std::string_view cveId,
+            FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& resultContainer)
+    {
+        dbWrapper->get(std::string(cveId), resultContainer.slice);
+        resultContainer.data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
+            NSVulnerabilityScanner::GetVulnerabilityDescription(resultContainer.slice.data()));
+    };
+
+    spOsDataCacheMock = std::make_shared<MockOsDataCache>();
+    EXPECT_CALL(*spOsDataCacheMock, getOsData(_)).WillRepeatedly(testing::Return(Os {}));
+
+    spRemediationDataCacheMock = std::make_shared<MockRemediationDataCache>();
+    EXPECT_CALL(*spRemediationDataCacheMock, getRemediationData(_)).WillRepeatedly(testing::Return(Remediation {}));
+
+    auto spDatabaseFeedManagerMock = std::make_shared<MockDatabaseFeedManager>();
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabiltyDescriptiveInformation(_, _))
+        .WillRepeatedly(testing::Invoke(mockGetVulnerabiltyDescriptiveInformation));
+
+    flatbuffers::Parser parser;
+    ASSERT_TRUE(parser.Parse(syscollector_deltas_SCHEMA));
+    ASSERT_TRUE(parser.Parse(DELTA_PACKAGES_INSERTED_MSG.c_str()));
+    uint8_t* buffer = parser.builder_.GetBufferPointer();
+
+    TEventDetailsBuilder<MockDatabaseFeedManager,
+                         TScanContext<TrampolineOsDataCache, GlobalData, TrampolineRemediationDataCache>>
+        eventDetailsBuilder(spDatabaseFeedManagerMock);
+
+    auto handleRequest = [&]()
+    {
+        std::variant<const SyscollectorDeltas::Delta*,
+                     const SyscollectorSynchronization::SyncMsg*,
+                     const nlohmann::json*>
+            syscollectorDelta = SyscollectorDeltas::GetDelta(reinterpret_cast<const char*>(buffer));
+        auto scanContext =
+            std::make_shared<TScanContext<TrampolineOsDataCache, GlobalData, TrampolineRemediationDataCache>>(
+                syscollectorDelta);
+        scanContext->m_elements[CVEID] =
+            R"({"operation":"INSERTED", "id":"001_ec465b7eb5fa011a336e95614072e4c7f1a65a53_CVE-2024-1234"})"_json;
+
+        EXPECT_NO_THROW(eventDetailsBuilder.handleRequest(scanContext));
+        return scanContext->m_elements[CVEID].at("data").at("vulnerability");
+    };
+
+    const auto first = handleRequest();
+    const auto cached = handleRequest();
+
+    // The details rendered from the cache are the same, only the detection time changes.
+    EXPECT_EQ(first.at("description"), "description_test_string");
+    auto firstDetails = first;
+    auto cachedDetails = cached;
+    firstDetails.erase("detected_at");
+    cachedDetails.erase("detected_at");
+    EXPECT_EQ(firstDetails, cachedDetails);
+    EXPECT_EQ(cached.at("category"), "Packages");
+
+    // A feed update that changes the description is not served from the cache.
+    buildDescription(fbBuilder, "updated_description_test_string");
+    dbWrapper->put(CVEID,
+                   rocksdb::Slice(reinterpret_cast<const char*>(fbBuilder.GetBufferPointer()), fbBuilder.GetSize()));
+
+    const auto updated = handleRequest();
+    EXPECT_EQ(updated.at("description"), "updated_description_test_string");
+    EXPECT_EQ(updated.at("classification"), "classification_test_string");
+}
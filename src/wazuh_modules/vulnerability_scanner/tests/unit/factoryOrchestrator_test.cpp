@@ -85,7 +85,8 @@ public:
      *
      */
     TFakeClass(std::shared_ptr<AbstractHandler<std::shared_ptr<std::vector<ScannerMockID>>>>,
-               std::shared_ptr<AbstractHandler<std::shared_ptr<std::vector<ScannerMockID>>>>) {};
+               std::shared_ptr<AbstractHandler<std::shared_ptr<std::vector<ScannerMockID>>>>,
+               size_t = 1) {};
     /**
      * @brief Construct a new TFakeClass object.
      */
@@ -345,6 +346,16 @@ TEST_F(FactoryOrchestratorTest, TestCreationCleanUpAllData)
  */
 TEST_F(FactoryOrchestratorTest, TestCreationReScanAllAgents)
 {
+    // The number of re-scan threads is read from the policy.
+    PolicyManager::instance().initialize(nlohmann::json::parse(R"({
+    "vulnerability-detection": {
+        "enabled": "yes",
+        "index-status": "yes",
+        "cti-url": "cti-url.com"
+    },
+    "reScanThreads": 2
+    })"));
+
     // Create the orchestrator for ReScanAllAgents.
     auto orchestration =
         TFactoryOrchestrator<TFakeClass<ScannerMockID::PACKAGE_SCANNER>,
@@ -384,6 +395,8 @@ TEST_F(FactoryOrchestratorTest, TestCreationReScanAllAgents)
     EXPECT_EQ(context->at(0), ScannerMockID::CLEAN_ALL_AGENT_INVENTORY);
     EXPECT_EQ(context->at(1), ScannerMockID::BUILD_ALL_AGENT_LIST_CONTEXT);
     EXPECT_EQ(context->at(2), ScannerMockID::SCAN_AGENT_LIST);
+
+    PolicyManager::instance().teardown();
 }
 
 /**
@@ -185,7 +185,9 @@ TEST_F(PolicyManagerTest, validConfigurationCheckParameters)
       "osdataLRUSize": 6000,
       "clusterName":"clusterName",
       "clusterEnabled":false,
-      "remediationLRUSize": 7000
+      "remediationLRUSize": 7000,
+      "descriptionLRUSize": 9000,
+      "reScanThreads": 8
     })")};
     EXPECT_NO_THROW(m_policyManager->initialize(configJson));
 
@@ -212,6 +214,8 @@ TEST_F(PolicyManagerTest, validConfigurationCheckParameters)
     EXPECT_EQ(m_policyManager->getTranslationLRUSize(), 5000);
     EXPECT_EQ(m_policyManager->getOsdataLRUSize(), 6000);
     EXPECT_EQ(m_policyManager->getRemediationLRUSize(), 7000);
+    EXPECT_EQ(m_policyManager->getDescriptionLRUSize(), 9000);
+    EXPECT_EQ(m_policyManager->getReScanThreads(), 8);
 }
 
 TEST_F(PolicyManagerTest, validConfigurationCheckParametersOffline)
@@ -292,6 +296,8 @@ TEST_F(PolicyManagerTest, validConfigurationDefaultValuesNoIndexer)
     EXPECT_EQ(m_policyManager->getTranslationLRUSize(), DEFAULT_TRANSLATION_LRU_SIZE);
     EXPECT_EQ(m_policyManager->getOsdataLRUSize(), DEFAULT_OSDATA_LRU_SIZE);
     EXPECT_EQ(m_policyManager->getRemediationLRUSize(), DEFAULT_REMEDIATION_LRU_SIZE);
+    EXPECT_EQ(m_policyManager->getDescriptionLRUSize(), DEFAULT_DESCRIPTION_LRU_SIZE);
+    EXPECT_EQ(m_policyManager->getReScanThreads(), DEFAULT_RESCAN_THREADS);
 }
 
 TEST_F(PolicyManagerTest, validConfigurationVulnerabilityScannerIgnoreIndexStatus)
@@ -413,6 +419,49 @@ TEST_F(PolicyManagerTest, updaterValidConfiguration)
     EXPECT_EQ(m_policyManager->getCTIUrl(), "https://updater-url.com");
 }
 
+TEST_F(PolicyManagerTest, reloadReplacesThePolicyAndNotifiesSubscribers)
+{
+    class PolicyObserver final : public Observer<nlohmann::json&>
+    {
+    public:
+        nlohmann::json lastPolicy;
+
+        PolicyObserver()
+            : Observer("policy_observer")
+        {
+        }
+
+        void update(nlohmann::json& data) override
+        {
+            lastPolicy = data;
+        }
+    };
+
+    EXPECT_NO_THROW(m_policyManager->initialize(UPDATER_BASIC_CONFIG));
+    const auto observer = std::make_shared<PolicyObserver>();
+    m_policyManager->addSubscriber(observer);
+
+    nlohmann::json newPolicy = UPDATER_BASIC_CONFIG;
+    newPolicy["osdataLRUSize"] = 10;
+    newPolicy["remediationLRUSize"] = 20;
+    newPolicy.at("vulnerability-detection")["feed-update-interval"] = "2h";
+    EXPECT_NO_THROW(m_policyManager->reload(newPolicy));
+
+    EXPECT_EQ(m_policyManager->getOsdataLRUSize(), 10);
+    EXPECT_EQ(m_policyManager->getRemediationLRUSize(), 20);
+    EXPECT_EQ(m_policyManager->getTranslationLRUSize(), DEFAULT_TRANSLATION_LRU_SIZE);
+    EXPECT_EQ(m_policyManager->getFeedUpdateTime(), 7200);
+    EXPECT_EQ(observer->lastPolicy.at("osdataLRUSize"), 10);
+
+    // An invalid policy keeps the current one.
+    newPolicy.at("updater").erase("interval");
+    EXPECT_THROW(m_policyManager->reload(newPolicy), std::runtime_error);
+    EXPECT_EQ(m_policyManager->getOsdataLRUSize(), 10);
+    EXPECT_EQ(m_policyManager->getFeedUpdateTime(), 7200);
+
+    m_policyManager->removeSubscriber("policy_observer");
+}
+
 TEST_F(PolicyManagerTest, updaterValidUrlhttp)
 {
     nlohmann::json basicConfigCopy = UPDATER_BASIC_CONFIG;
@@ -0,0 +1,72 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "regexPrefilter_test.hpp"
+#include "../../src/databaseFeedManager/regexPrefilter.hpp"
+#include <regex>
+
+TEST_F(RegexPrefilterTest, AnchoredLiteral)
+{
+    const auto prefilter = RegexPrefilter::fromPattern(R"(^Microsoft ASP\.NET Core ([0-9]\.*[0-9]*\.*[0-9]*))");
+
+    EXPECT_TRUE(prefilter.anchored);
+    EXPECT_EQ(prefilter.literal, "Microsoft ASP.NET Core ");
+    EXPECT_TRUE(prefilter.mayMatch("Microsoft ASP.NET Core 6.0.5"));
+    EXPECT_FALSE(prefilter.mayMatch("The Microsoft ASP.NET Core 6.0.5"));
+    EXPECT_FALSE(prefilter.mayMatch("Microsoft"));
+}
+
+TEST_F(RegexPrefilterTest, UnanchoredLiteral)
+{
+    const auto prefilter = RegexPrefilter::fromPattern("Visual C\\+\\+ [0-9]+");
+
+    EXPECT_FALSE(prefilter.anchored);
+    EXPECT_EQ(prefilter.literal, "Visual C++ ");
+    EXPECT_TRUE(prefilter.mayMatch("Microsoft Visual C++ 2019"));
+    EXPECT_FALSE(prefilter.mayMatch("Microsoft Visual Studio"));
+}
+
+TEST_F(RegexPrefilterTest, Quantifiers)
+{
+    EXPECT_EQ(RegexPrefilter::fromPattern("^abc?d").literal, "ab");
+    EXPECT_EQ(RegexPrefilter::fromPattern("^ab*").literal, "a");
+    EXPECT_EQ(RegexPrefilter::fromPattern("^ab{0,2}").literal, "a");
+    EXPECT_EQ(RegexPrefilter::fromPattern("^ab+c").literal, "ab");
+    EXPECT_EQ(RegexPrefilter::fromPattern("a*").literal, "");
+}
+
+TEST_F(RegexPrefilterTest, NoLiteral)
+{
+    for (const auto* pattern : {"", "^", ".*Java", "(Java|Oracle)", "Java|Oracle", "\\d+ Java", "[Jj]ava", "\\bJava"})
+    {
+        const auto prefilter = RegexPrefilter::fromPattern(pattern);
+        EXPECT_TRUE(prefilter.literal.empty()) << pattern;
+        EXPECT_TRUE(prefilter.mayMatch("anything")) << pattern;
+    }
+}
+
+TEST_F(RegexPrefilterTest, NeverDiscardsAMatch)
+{
+    const std::vector<std::pair<std::string, std::string>> cases {
+        {"^Mozilla Firefox", "Mozilla Firefox 115.0 (x64 en-US)"},
+        {"Adobe Acrobat", "Adobe Acrobat Reader DC"},
+        {"^7-Zip ([0-9.]+)", "7-Zip 23.01 (x64)"},
+        {"^Python 3\\.[0-9]+", "Python 3.11.4 (64-bit)"},
+        {"^Git version", "Git version 2.41.0"},
+        {"abc?d", "abd"},
+        {"ab+c", "abbbc"}};
+
+    for (const auto& [pattern, text] : cases)
+    {
+        ASSERT_TRUE(std::regex_search(text, std::regex(pattern))) << pattern;
+        EXPECT_TRUE(RegexPrefilter::fromPattern(pattern).mayMatch(text)) << pattern;
+    }
+}
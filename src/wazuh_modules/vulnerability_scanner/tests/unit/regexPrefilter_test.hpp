@@ -0,0 +1,29 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _REGEX_PREFILTER_TEST_HPP
+#define _REGEX_PREFILTER_TEST_HPP
+
+#include "gtest/gtest.h"
+
+/**
+ * @brief Runs unit tests for RegexPrefilter struct.
+ */
+class RegexPrefilterTest : public ::testing::Test
+{
+protected:
+    // LCOV_EXCL_START
+    RegexPrefilterTest() = default;
+    ~RegexPrefilterTest() override = default;
+    // LCOV_EXCL_STOP
+};
+
+#endif // _REGEX_PREFILTER_TEST_HPP
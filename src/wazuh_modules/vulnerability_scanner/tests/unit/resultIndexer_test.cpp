@@ -80,7 +80,7 @@ TEST_F(ResultIndexerTest, TestHandleRequest)
     auto elementValue = nlohmann::json::parse(R"({"id": "id_test","no-index":false,"operation":"INSERTED"})");
 
     spIndexerConnectorMock = std::make_shared<MockIndexerConnector>();
-    EXPECT_CALL(*spIndexerConnectorMock, publish(elementValue.dump())).Times(1);
+    EXPECT_CALL(*spIndexerConnectorMock, publish(std::vector<std::string> {elementValue.dump()})).Times(1);
 
     auto pIndexerConnectorTrap = std::make_shared<TrampolineIndexerConnector>();
 
@@ -130,7 +130,7 @@ TEST_F(ResultIndexerTest, TestHandleRequestNoOperation)
     auto elementValue = nlohmann::json::parse(R"({"id": "id_test"})");
 
     spIndexerConnectorMock = std::make_shared<MockIndexerConnector>();
-    EXPECT_CALL(*spIndexerConnectorMock, publish(elementValue.dump())).Times(0);
+    EXPECT_CALL(*spIndexerConnectorMock, publish(testing::A<const std::vector<std::string>&>())).Times(0);
 
     auto pIndexerConnectorTrap = std::make_shared<TrampolineIndexerConnector>();
 
@@ -180,7 +180,7 @@ TEST_F(ResultIndexerTest, TestHandleRequestNoId)
     auto elementValue = nlohmann::json::parse(R"({"operation":"INSERTED"})");
 
     spIndexerConnectorMock = std::make_shared<MockIndexerConnector>();
-    EXPECT_CALL(*spIndexerConnectorMock, publish(elementValue.dump())).Times(0);
+    EXPECT_CALL(*spIndexerConnectorMock, publish(testing::A<const std::vector<std::string>&>())).Times(0);
 
     auto pIndexerConnectorTrap = std::make_shared<TrampolineIndexerConnector>();
 
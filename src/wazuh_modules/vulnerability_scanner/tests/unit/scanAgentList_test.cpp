@@ -330,6 +330,85 @@ TEST_F(ScanAgentListTest, UnrecoverableException)
     spOsDataCacheMock.reset();
 }
 
+TEST_F(ScanAgentListTest, MultipleThreadsTest)
+{
+    spSocketDBWrapperMock = std::make_shared<MockSocketDBWrapper>();
+
+    Os osData {.hostName = "osdata_hostname",
+               .architecture = "osdata_architecture",
+               .name = "osdata_name",
+               .codeName = "upstream",
+               .majorVersion = "osdata_majorVersion",
+               .minorVersion = "osdata_minorVersion",
+               .patch = "osdata_patch",
+               .build = "osdata_build",
+               .platform = "osdata_platform",
+               .version = "osdata_version",
+               .release = "osdata_release",
+               .displayVersion = "osdata_displayVersion",
+               .sysName = "osdata_sysName",
+               .kernelVersion = "osdata_kernelVersion",
+               .kernelRelease = "osdata_kernelRelease"};
+
+    spOsDataCacheMock = std::make_shared<MockOsDataCache>();
+    EXPECT_CALL(*spOsDataCacheMock, getOsData(testing::_)).WillRepeatedly(testing::Return(osData));
+    EXPECT_CALL(*spOsDataCacheMock, setOsData(_, _)).Times(testing::AnyNumber());
+
+    spRemediationDataCacheMock = std::make_shared<MockRemediationDataCache>();
+    EXPECT_CALL(*spRemediationDataCacheMock, getRemediationData(testing::_))
+        .WillRepeatedly(testing::Return(Remediation {}));
+
+    auto spPackageInsertOrchestrationMock =
+        std::make_shared<MockAbstractHandler<std::shared_ptr<TrampolineScanContext>>>();
+    auto spOsOrchestrationMock = std::make_shared<MockAbstractHandler<std::shared_ptr<TrampolineScanContext>>>();
+
+    // Agent 005 can't be fetched, the other seven agents are scanned by the four threads.
+    EXPECT_CALL(*spPackageInsertOrchestrationMock, handleRequest(testing::_)).Times(14);
+    EXPECT_CALL(*spOsOrchestrationMock, handleRequest(testing::_)).Times(7);
+
+    auto scanAgentList = std::make_shared<TScanAgentList<TrampolineScanContext,
+                                                         MockAbstractHandler<std::shared_ptr<TrampolineScanContext>>,
+                                                         TrampolineSocketDBWrapper>>(
+        spPackageInsertOrchestrationMock, spOsOrchestrationMock, 4);
+
+    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::HasSubstr("osinfo get"), testing::_))
+        .Times(7)
+        .WillRepeatedly(testing::SetArgReferee<1>(nlohmann::json::parse(OS_RESPONSE)));
+    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::HasSubstr("package get"), testing::_))
+        .Times(7)
+        .WillRepeatedly(testing::SetArgReferee<1>(nlohmann::json::parse(PACKAGES_RESPONSE)));
+    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::HasSubstr("agent 005"), testing::_))
+        .WillOnce(testing::Throw(SocketDbWrapperException("Temporal error on DB")));
+
+    nlohmann::json jsonData = nlohmann::json::parse(
+        R"({"agent_info":  {"agent_id":"001",  "agent_version":"4.8.0",  "agent_name":"test_agent_name",  "agent_ip":"10.0.0.1",  "node_name":"node01"},  "action":"upgradeAgentDB"})");
+
+    std::variant<const SyscollectorDeltas::Delta*, const SyscollectorSynchronization::SyncMsg*, const nlohmann::json*>
+        data = &jsonData;
+
+    auto contextData = std::make_shared<TrampolineScanContext>(data);
+    for (auto id = 1; id <= 8; ++id)
+    {
+        contextData->m_agents.push_back(
+            {"00" + std::to_string(id), "test_agent_name_" + std::to_string(id), "4.8.0", "192.168.0.1"});
+    }
+
+    try
+    {
+        scanAgentList->handleRequest(contextData);
+        FAIL() << "Expected AgentReScanListException";
+    }
+    catch (const AgentReScanListException& e)
+    {
+        ASSERT_EQ(e.agentList().size(), 1);
+        EXPECT_EQ(e.agentList().front().id, "005");
+    }
+
+    spRemediationDataCacheMock.reset();
+    spSocketDBWrapperMock.reset();
+    spOsDataCacheMock.reset();
+}
+
 TEST_F(ScanAgentListTest, DISABLED_InsertAllTestNotSyncedResponse)
 {
     spSocketDBWrapperMock = std::make_shared<MockSocketDBWrapper>();
@@ -1337,7 +1337,8 @@ TEST_F(UpdateCVECandidatesTest, RemoveCandidates)
     const cve_v5::Entry* cve5Flatbuffer = cve_v5::GetEntry(buf);
 
     // Call function.
-    UpdateCVECandidates::storeVulnerabilityCandidate(cve5Flatbuffer, m_feedDatabase.get());
+    FeedUpdateChanges storeChanges;
+    UpdateCVECandidates::storeVulnerabilityCandidate(cve5Flatbuffer, m_feedDatabase.get(), &storeChanges);
 
     // Verify data
     rocksdb::PinnableSlice slice;
@@ -1362,8 +1363,18 @@ TEST_F(UpdateCVECandidatesTest, RemoveCandidates)
         m_feedDatabase->get("CVE-2020-0002_kernel", slice, std::string(CVE_PACKAGE_COLUMN_NAME_PREFIX) + "_canonical"));
     EXPECT_EQ(slice.ToString(), "kernel_CVE-2020-0002");
 
+    // Verify changes
+    for (const auto& candidate : {"debian_bash", "debian_firefox", "nvd_bash", "canonical_bash", "canonical_kernel"})
+    {
+        EXPECT_EQ(storeChanges.candidates.count(candidate), 1) << candidate;
+    }
+    EXPECT_FALSE(storeChanges.fullScanRequired);
+
     // Remove candidates
-    EXPECT_NO_THROW(UpdateCVECandidates::removeVulnerabilityCandidate(cve5Flatbuffer, m_feedDatabase.get()));
+    FeedUpdateChanges removeChanges;
+    EXPECT_NO_THROW(
+        UpdateCVECandidates::removeVulnerabilityCandidate(cve5Flatbuffer, m_feedDatabase.get(), &removeChanges));
+    EXPECT_EQ(removeChanges.candidates, storeChanges.candidates);
 
     // Verify data
     EXPECT_FALSE(m_feedDatabase->get("bash_CVE-2020-0002", slice, "debian"));
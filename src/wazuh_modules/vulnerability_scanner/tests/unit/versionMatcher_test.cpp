@@ -907,3 +907,46 @@ TEST_F(VersionMatcherTest, matchRPM)
 
     EXPECT_NO_THROW(VersionMatcher::compare("invalid", "3:2.3.15-24.el8", VersionObjectType::RPM));
 }
+
+TEST_F(VersionMatcherTest, comparePEP440_Ambiguous)
+{
+    // The separator after the pre-release wins over the implicit post-release
+    EXPECT_EQ(VersionMatcher::compare("1.0a-1", "1.0a1", VersionObjectType::PEP440),
+              VersionComparisonResult::A_EQUAL_B);
+    EXPECT_EQ(VersionMatcher::compare("1.0a.-1", "1.0a0.post1", VersionObjectType::PEP440),
+              VersionComparisonResult::A_EQUAL_B);
+    EXPECT_EQ(VersionMatcher::compare("1.0rev2", "1.0.post2", VersionObjectType::PEP440),
+              VersionComparisonResult::A_EQUAL_B);
+    EXPECT_EQ(VersionMatcher::compare("V2!1.0", "2!1.0.0", VersionObjectType::PEP440),
+              VersionComparisonResult::A_EQUAL_B);
+
+    EXPECT_FALSE(VersionMatcher::match("1.0.", VersionObjectType::PEP440));
+    EXPECT_FALSE(VersionMatcher::match("1!", VersionObjectType::PEP440));
+    EXPECT_FALSE(VersionMatcher::match("1.0prev1", VersionObjectType::PEP440));
+
+    // An empty release matches but can't be compared
+    EXPECT_TRUE(VersionMatcher::match("v", VersionObjectType::PEP440));
+    EXPECT_THROW(VersionMatcher::compare("v", "1.0", VersionObjectType::PEP440), std::invalid_argument);
+}
+
+TEST_F(VersionMatcherTest, cachedVersions)
+{
+    // The same strings give the same results once the versions are cached, for each type and strategy
+    for (auto i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(VersionMatcher::compare("1.2.3", "1.2.4"), VersionComparisonResult::A_LESS_THAN_B);
+        EXPECT_EQ(VersionMatcher::compare("1.2.3", "1.2.4", VersionObjectType::DPKG),
+                  VersionComparisonResult::A_LESS_THAN_B);
+        EXPECT_EQ(VersionMatcher::compare("1:1.0", "2.0", VersionObjectType::DPKG),
+                  VersionComparisonResult::A_GREATER_THAN_B);
+        EXPECT_FALSE(VersionMatcher::match("1:1.0", VersionObjectType::PEP440));
+        EXPECT_THROW(VersionMatcher::compare("1:1.0", "2.0", VersionObjectType::PEP440), std::invalid_argument);
+    }
+
+    // Filling the cache drops the old versions
+    for (size_t i = 0; i < VERSION_CACHE_MAX_ENTRIES + 10; ++i)
+    {
+        EXPECT_TRUE(VersionMatcher::match(std::to_string(i) + ".0", VersionObjectType::PEP440));
+    }
+    EXPECT_EQ(VersionMatcher::compare("1.2.3", "1.2.4"), VersionComparisonResult::A_LESS_THAN_B);
+}
@@ -0,0 +1,129 @@
+/*
+ * Wazuh cmdLineParser
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CMD_ARGS_PARSER_HPP_
+#define _CMD_ARGS_PARSER_HPP_
+
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Class to parse command line arguments.
+ */
+class CmdLineArgs
+{
+public:
+    /**
+     * @brief Constructor for CmdLineArgs.
+     * @param argc Number of arguments.
+     * @param argv Arguments.
+     */
+    explicit CmdLineArgs(const int argc, const char* argv[])
+        : m_configurationFilePath {paramValueOf(argc, argv, "-c")}
+        , m_agents {std::stoull(paramValueOf(argc, argv, "-a", std::make_pair(false, "100")))}
+        , m_packages {std::stoull(paramValueOf(argc, argv, "-p", std::make_pair(false, "100")))}
+        , m_logFilePath {paramValueOf(argc, argv, "-l", std::make_pair(false, ""))}
+    {
+        if (m_agents == 0 || m_packages == 0)
+        {
+            throw std::runtime_error("Error: The number of agents and packages must be greater than zero.");
+        }
+    }
+
+    /**
+     * @brief Gets the configuration file path.
+     * @return Configuration file path.
+     */
+    const std::string& getConfigurationFilePath() const
+    {
+        return m_configurationFilePath;
+    }
+
+    /**
+     * @brief Gets the number of agents of the synthetic fleet.
+     * @return Number of agents.
+     */
+    size_t getAgents() const
+    {
+        return m_agents;
+    }
+
+    /**
+     * @brief Gets the number of packages of each agent.
+     * @return Number of packages.
+     */
+    size_t getPackages() const
+    {
+        return m_packages;
+    }
+
+    /**
+     * @brief Gets the log file path.
+     *
+     * @return Path to the log file.
+     */
+    const std::string& getLogFilePath() const
+    {
+        return m_logFilePath;
+    }
+
+    /**
+     * @brief Shows the help to the user.
+     */
+    static void showHelp()
+    {
+        std::cout << "\nUsage: vd_scanner_benchmark <option(s)>\n"
+                  << "Options:\n"
+                  << "\t-h \t\t\tShow this help message\n"
+                  << "\t-c CONFIG_FILE\t\tSpecifies the configuration file.\n"
+                  << "\t-a AGENTS\t\tNumber of agents of the synthetic fleet (default 100).\n"
+                  << "\t-p PACKAGES\t\tNumber of packages of each agent (default 100).\n"
+                  << "\t-l LOG_FILE\t\tSpecifies the log file to write.\n"
+                  << "\nThe feed database (queue/vd/feed) must exist in the working directory, e.g. downloaded with "
+                     "'vd_scanner_testtool -c config.json -d'.\n"
+                  << "\nExample:"
+                  << "\n\t./vd_scanner_benchmark -c config.json\n"
+                  << "\n\t./vd_scanner_benchmark -c config.json -a 1000 -p 500 -l log.txt\n"
+                  << std::endl;
+    }
+
+private:
+    static std::string paramValueOf(const int argc,
+                                    const char* argv[],
+                                    const std::string& switchValue,
+                                    const std::pair<bool, std::string>& required = std::make_pair(true, ""))
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string currentValue {argv[i]};
+
+            if (currentValue == switchValue && i + 1 < argc)
+            {
+                // Switch found
+                return argv[i + 1];
+            }
+        }
+
+        if (required.first)
+        {
+            throw std::runtime_error {"Switch value: " + switchValue + " not found."};
+        }
+
+        return required.second;
+    }
+
+    const std::string m_configurationFilePath;
+    const size_t m_agents;
+    const size_t m_packages;
+    const std::string m_logFilePath;
+};
+
+#endif // _CMD_ARGS_PARSER_HPP_
@@ -0,0 +1,454 @@
+/*
+ * Wazuh Vulnerability scanner
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 15, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "argsParser.hpp"
+#include "databaseFeedManager.hpp"
+#include "flatbuffers/idl.h"
+#include "flatbuffers/include/syscollector_deltas_schema.h"
+#include "loggerHelper.h"
+#include "logging_helper.h"
+#include "messageBuffer_generated.h"
+#include "policyManager.hpp"
+#include "routerModule.hpp"
+#include "scanOrchestrator.hpp"
+#include "stringHelper.h"
+#include "timeHelper.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <rocksdb/perf_context.h>
+#include <rocksdb/perf_level.h>
+#include <sstream>
+#include <vector>
+
+auto constexpr MAXLEN {65536};
+auto constexpr BENCHMARK_REPORTS_QUEUE_PATH {"queue/vd/benchmark_reports"};
+
+// Allocations of the whole process, counted by the replaced global operator new.
+std::atomic<uint64_t> G_ALLOCATIONS {0};
+
+void* operator new(std::size_t size)
+{
+    G_ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size == 0 ? 1 : size); ptr)
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * @brief Package installed in every agent of an OS family.
+ */
+struct SyntheticPackage final
+{
+    const char* name;
+    const char* version;
+};
+
+/**
+ * @brief OS family of the synthetic agents, with the packages they have installed.
+ */
+struct OsFamily final
+{
+    const char* name;
+    const char* platform;
+    const char* major;
+    const char* minor;
+    const char* codename;
+    const char* version;
+    const char* format;
+    const char* vendor;
+    std::vector<SyntheticPackage> packages;
+};
+
+// The packages of an agent beyond the listed ones are synthetic and have no vulnerabilities, like most real ones.
+const std::vector<OsFamily> OS_FAMILIES {
+    {"Ubuntu",
+     "ubuntu",
+     "22",
+     "04",
+     "jammy",
+     "22.04.3 LTS (Jammy Jellyfish)",
+     "deb",
+     "Ubuntu Developers <ubuntu-devel-discuss@lists.ubuntu.com>",
+     {{"openssl", "3.0.2-0ubuntu1.10"},
+      {"libssl3", "3.0.2-0ubuntu1.10"},
+      {"curl", "7.81.0-1ubuntu1.13"},
+      {"libcurl4", "7.81.0-1ubuntu1.13"},
+      {"bash", "5.1-6ubuntu1"},
+      {"sudo", "1.9.9-1ubuntu2.4"},
+      {"openssh-server", "1:8.9p1-3ubuntu0.3"},
+      {"systemd", "249.11-0ubuntu3.9"},
+      {"vim", "2:8.2.3995-1ubuntu2.11"},
+      {"git", "1:2.34.1-1ubuntu1.9"},
+      {"python3.10", "3.10.12-1~22.04.2"},
+      {"libc6", "2.35-0ubuntu3.4"}}},
+    {"Debian GNU/Linux",
+     "debian",
+     "12",
+     "",
+     "bookworm",
+     "12 (bookworm)",
+     "deb",
+     "Debian OpenSSL Team <pkg-openssl-devel@alioth-lists.debian.net>",
+     {{"openssl", "3.0.9-1"},
+      {"curl", "7.88.1-10"},
+      {"bash", "5.2.15-2+b2"},
+      {"sudo", "1.9.13p3-1"},
+      {"openssh-server", "1:9.2p1-2"},
+      {"systemd", "252.12-1~deb12u1"},
+      {"vim", "2:9.0.1378-2"},
+      {"git", "1:2.39.2-1.1"},
+      {"libc6", "2.36-9+deb12u1"}}},
+    {"Red Hat Enterprise Linux",
+     "rhel",
+     "9",
+     "2",
+     "Plow",
+     "9.2",
+     "rpm",
+     "Red Hat, Inc.",
+     {{"openssl", "1:3.0.7-16.el9_2"},
+      {"curl", "7.76.1-23.el9_2.2"},
+      {"bash", "5.1.8-6.el9_1"},
+      {"sudo", "1.9.5p2-9.el9"},
+      {"openssh-server", "8.7p1-30.el9_2"},
+      {"systemd", "252-14.el9_2.3"},
+      {"vim-minimal", "2:8.2.2637-20.el9_1"},
+      {"git", "2.39.3-1.el9_2"},
+      {"glibc", "2.34-60.el9"}}}};
+
+/**
+ * @brief Builds the scan events of the synthetic agents, as the deltas received from syscollector.
+ */
+class SyntheticFleet final
+{
+public:
+    SyntheticFleet()
+        : m_parser(flatbuffers::IDLOptions())
+    {
+        if (!m_parser.Parse(syscollector_deltas_SCHEMA))
+        {
+            throw std::runtime_error("Unable to parse the deltas schema: " + m_parser.error_);
+        }
+    }
+
+    /**
+     * @brief Builds the events of an agent: its OS and its packages.
+     *
+     * @param index Index of the agent, its OS family is chosen round robin.
+     * @param packages Number of packages of the agent.
+     * @return std::vector<std::string> Messages, as pushed to the scanner queue.
+     */
+    std::vector<std::string> agentEvents(const size_t index, const size_t packages)
+    {
+        const auto& family = OS_FAMILIES[index % OS_FAMILIES.size()];
+
+        std::ostringstream agentId;
+        agentId << std::setfill('0') << std::setw(3) << index + 1;
+
+        nlohmann::json agentInfo;
+        agentInfo["agent_id"] = agentId.str();
+        agentInfo["agent_ip"] = "10.0.0.1";
+        agentInfo["agent_name"] = "agent-" + agentId.str();
+        agentInfo["agent_version"] = "v4.8.0";
+
+        std::vector<std::string> events;
+        events.reserve(packages + 1);
+
+        nlohmann::json os;
+        os["agent_info"] = agentInfo;
+        os["data_type"] = "dbsync_osinfo";
+        os["operation"] = "INSERTED";
+        os["data"] = {{"architecture", "x86_64"},
+                      {"checksum", "1691178971959743855"},
+                      {"hostname", "agent-" + agentId.str()},
+                      {"os_codename", family.codename},
+                      {"os_major", family.major},
+                      {"os_minor", family.minor},
+                      {"os_name", family.name},
+                      {"os_platform", family.platform},
+                      {"os_version", family.version},
+                      {"release", "5.15.0-91-generic"},
+                      {"scan_time", "2026/10/15 00:00:00"},
+                      {"sysname", "Linux"}};
+        events.emplace_back(message(os));
+
+        for (size_t i = 0; i < packages; ++i)
+        {
+            const auto listed = i < family.packages.size();
+            const auto name = listed ? std::string(family.packages[i].name) : "synthetic-package-" + std::to_string(i);
+
+            nlohmann::json package;
+            package["agent_info"] = agentInfo;
+            package["data_type"] = "dbsync_packages";
+            package["operation"] = "INSERTED";
+            package["data"] = {{"architecture", "amd64"},
+                               {"checksum", "checksum-" + std::to_string(i)},
+                               {"format", family.format},
+                               {"item_id", "item-" + std::to_string(i)},
+                               {"name", name},
+                               {"scan_time", "2026/10/15 00:00:00"},
+                               {"source", name},
+                               {"vendor", family.vendor},
+                               {"version", listed ? family.packages[i].version : "1.0.0"}};
+            events.emplace_back(message(package));
+        }
+
+        return events;
+    }
+
+private:
+    flatbuffers::Parser m_parser;
+
+    std::string message(const nlohmann::json& delta)
+    {
+        m_parser.builder_.Clear();
+        if (!m_parser.Parse(delta.dump().c_str()))
+        {
+            throw std::runtime_error("Unable to parse the synthetic delta: " + m_parser.error_);
+        }
+
+        const std::vector<int8_t> data(reinterpret_cast<const int8_t*>(m_parser.builder_.GetBufferPointer()),
+                                       reinterpret_cast<const int8_t*>(m_parser.builder_.GetBufferPointer()) +
+                                           m_parser.builder_.GetSize());
+
+        flatbuffers::FlatBufferBuilder builder;
+        builder.Finish(
+            CreateMessageBufferDirect(builder, &data, BufferType::BufferType_DBSync, Utils::getSecondsFromEpoch()));
+        return {reinterpret_cast<const char*>(builder.GetBufferPointer()), builder.GetSize()};
+    }
+};
+
+/**
+ * @brief Counters of the RocksDB reads done by the scans of the calling thread.
+ */
+struct ReadCounters final
+{
+    uint64_t memtableGets {0};
+    uint64_t seeks {0};
+    uint64_t iteratorSteps {0};
+    uint64_t blockReads {0};
+    uint64_t blockCacheHits {0};
+
+    void add(const rocksdb::PerfContext& context)
+    {
+        memtableGets += context.get_from_memtable_count;
+        seeks += context.iter_seek_count;
+        iteratorSteps += context.iter_next_count;
+        blockReads += context.block_read_count;
+        blockCacheHits += context.block_cache_hit_count;
+    }
+};
+
+/**
+ * @brief Counts the vulnerabilities stored in the inventory by the scans.
+ *
+ * @return size_t Number of vulnerabilities of the packages and the OS of every agent.
+ */
+size_t inventoryVulnerabilities()
+{
+    size_t vulnerabilities {0};
+    Utils::RocksDBWrapper inventoryDatabase(INVENTORY_DB_PATH);
+
+    for (const auto& [componentType, column] : AFFECTED_COMPONENT_COLUMNS)
+    {
+        if (!inventoryDatabase.columnExists(column))
+        {
+            continue;
+        }
+
+        for (const auto& [key, value] : inventoryDatabase.begin(column))
+        {
+            vulnerabilities += Utils::split(value.ToString(), ',').size();
+        }
+    }
+
+    return vulnerabilities;
+}
+
+int main(const int argc, const char* argv[])
+{
+    try
+    {
+        CmdLineArgs cmdLineArgs(argc, argv);
+
+        if (!std::filesystem::exists(DATABASE_PATH))
+        {
+            throw std::runtime_error(std::string("Feed database not found: ") + DATABASE_PATH);
+        }
+
+        // Every run starts from an empty inventory, so all the packages are scanned.
+        std::filesystem::remove_all(INVENTORY_DB_PATH);
+        std::filesystem::remove_all(DELAYED_QUEUE_PATH);
+        std::filesystem::remove_all(BENCHMARK_REPORTS_QUEUE_PATH);
+
+        std::ofstream logFile;
+        if (!cmdLineArgs.getLogFilePath().empty())
+        {
+            logFile.open(cmdLineArgs.getLogFilePath());
+            if (!logFile.is_open())
+            {
+                throw std::runtime_error("Failed to open log file: " + cmdLineArgs.getLogFilePath());
+            }
+        }
+
+        Log::assignLogFunction(
+            [&logFile](const int logLevel,
+                       const std::string& tag,
+                       const std::string&,
+                       const int,
+                       const std::string& func,
+                       const std::string& message,
+                       va_list args)
+            {
+                char formattedStr[MAXLEN] = {0};
+                vsnprintf(formattedStr, MAXLEN, message.c_str(), args);
+
+                if (logLevel == LOG_ERROR)
+                {
+                    std::cerr << tag << ":" << func << " : " << formattedStr << std::endl;
+                }
+
+                if (logFile.is_open())
+                {
+                    logFile << tag << ":" << func << " : " << formattedStr << std::endl;
+                }
+            });
+
+        const auto configuration = nlohmann::json::parse(std::ifstream(cmdLineArgs.getConfigurationFilePath()));
+        PolicyManager::instance().initialize(configuration);
+
+        auto& routerModule = RouterModule::instance();
+        routerModule.start();
+
+        std::atomic<bool> shouldStop {false};
+        std::shared_mutex mutex;
+
+        // The feed isn't updated during the run, all the scans use the same snapshot.
+        auto databaseFeedManager = std::make_shared<DatabaseFeedManager>(nullptr, shouldStop, mutex, true, true, false);
+
+        // The reports are discarded, only the time to build them is measured.
+        auto reportDispatcher = std::make_shared<ReportDispatcher>(
+            [](std::queue<std::string>& dataQueue)
+            {
+                while (!dataQueue.empty())
+                {
+                    dataQueue.pop();
+                }
+            },
+            BENCHMARK_REPORTS_QUEUE_PATH);
+
+        auto scanOrchestrator = std::make_shared<ScanOrchestrator>(nullptr, databaseFeedManager, reportDispatcher, mutex);
+
+        SyntheticFleet fleet;
+        std::vector<double> agentLatencies;
+        agentLatencies.reserve(cmdLineArgs.getAgents());
+        std::chrono::steady_clock::duration scanTime {0};
+        uint64_t allocations {0};
+        uint64_t failedEvents {0};
+        ReadCounters reads;
+
+        rocksdb::SetPerfLevel(rocksdb::PerfLevel::kEnableCount);
+
+        for (size_t agent = 0; agent < cmdLineArgs.getAgents(); ++agent)
+        {
+            // The events are built outside of the measured time.
+            const auto events = fleet.agentEvents(agent, cmdLineArgs.getPackages());
+            std::chrono::steady_clock::duration agentTime {0};
+
+            for (const auto& event : events)
+            {
+                rocksdb::PinnableSlice element;
+                element.PinSelf(event);
+
+                rocksdb::get_perf_context()->Reset();
+                const auto allocationsBefore = G_ALLOCATIONS.load(std::memory_order_relaxed);
+                const auto start = std::chrono::steady_clock::now();
+
+                try
+                {
+                    scanOrchestrator->processEvent(element);
+                }
+                catch (const std::exception& e)
+                {
+                    ++failedEvents;
+                    logError(WM_VULNSCAN_LOGTAG, "Error processing the synthetic event: %s.", e.what());
+                }
+
+                agentTime += std::chrono::steady_clock::now() - start;
+                allocations += G_ALLOCATIONS.load(std::memory_order_relaxed) - allocationsBefore;
+                reads.add(*rocksdb::get_perf_context());
+            }
+
+            scanTime += agentTime;
+            agentLatencies.push_back(std::chrono::duration<double, std::milli>(agentTime).count());
+        }
+
+        rocksdb::SetPerfLevel(rocksdb::PerfLevel::kDisable);
+
+        scanOrchestrator.reset();
+        reportDispatcher.reset();
+        databaseFeedManager.reset();
+        routerModule.stop();
+
+        const auto seconds = std::chrono::duration<double>(scanTime).count();
+        const auto packages = cmdLineArgs.getAgents() * cmdLineArgs.getPackages();
+        const auto percentile = [&agentLatencies](const double rank)
+        {
+            const auto position = static_cast<size_t>(rank * static_cast<double>(agentLatencies.size() - 1));
+            std::nth_element(agentLatencies.begin(), agentLatencies.begin() + position, agentLatencies.end());
+            return agentLatencies[position];
+        };
+
+        std::cout << std::fixed << std::setprecision(2) << "Agents: " << cmdLineArgs.getAgents()
+                  << ", packages per agent: " << cmdLineArgs.getPackages() << ", OS families: " << OS_FAMILIES.size()
+                  << "\n"
+                  << "Scan time: " << seconds << " s\n"
+                  << "Packages/s: " << static_cast<double>(packages) / seconds << "\n"
+                  << "Feed iterator steps (CVE candidates read)/s: " << static_cast<double>(reads.iteratorSteps) / seconds
+                  << "\n"
+                  << "Vulnerabilities found: " << inventoryVulnerabilities() << ", failed events: " << failedEvents
+                  << "\n"
+                  << "RocksDB memtable gets: " << reads.memtableGets << ", seeks: " << reads.seeks
+                  << ", iterator steps: " << reads.iteratorSteps << ", blocks read: " << reads.blockReads
+                  << ", block cache hits: " << reads.blockCacheHits << "\n"
+                  << "Allocations: " << allocations << " (" << static_cast<double>(allocations) / packages
+                  << " per package)\n"
+                  << "Agent scan latency (ms): p50 " << percentile(0.5) << ", p99 " << percentile(0.99) << ", max "
+                  << *std::max_element(agentLatencies.begin(), agentLatencies.end()) << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        CmdLineArgs::showHelp();
+        return 1;
+    }
+
+    return 0;
+}